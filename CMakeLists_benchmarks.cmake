@@ -0,0 +1,36 @@
+# This file was generated with tools/generate_cmakelists.sh
+
+add_executable(hikogui_benchmarks)
+target_link_libraries(hikogui_benchmarks PRIVATE hikogui)
+target_include_directories(hikogui_benchmarks PRIVATE "${CMAKE_CURRENT_BINARY_DIR}")
+set_target_properties(hikogui_benchmarks PROPERTIES DEBUG_POSTFIX "-dbg")
+set_target_properties(hikogui_benchmarks PROPERTIES RELEASE_POSTFIX "-rel")
+set_target_properties(hikogui_benchmarks PROPERTIES RELWITHDEBINFO_POSTFIX "-rdi")
+
+# Run the benchmarks and write the results to benchmarks.json in the build directory.
+add_custom_target(run_benchmarks
+    COMMAND hikogui_benchmarks > "${CMAKE_CURRENT_BINARY_DIR}/benchmarks.json"
+    DEPENDS hikogui_benchmarks
+    WORKING_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}"
+    USES_TERMINAL)
+
+target_sources(hikogui_benchmarks PRIVATE
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/benchmark_main.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/GUI/gui_window_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_sample_packer_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/BON8_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/png_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/zlib_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/function_fifo_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/lean_vector_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/wfree_fifo_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/graphic_path/bezier_curve_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/layout/grid_layout_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/parser/lexer_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/text/text_shaper_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/unicode_line_break_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/unicode_normalization_benchmarks.cpp
+)
+
+show_build_target_properties(hikogui_benchmarks)
@@ -23,14 +23,40 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     $<$<STREQUAL:${ARCHITECTURE_ID},none>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_generic.hpp>
     src/hikocpu/array_generic.hpp
     src/hikocpu/array_intrinsic.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},arm>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_f16x4_arm.hpp>
+    src/hikocpu/array_intrinsic_f16x4_arm.hpp
     $<$<STREQUAL:${ARCHITECTURE_ID},x86>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_f16x4_x86.hpp>
     src/hikocpu/array_intrinsic_f16x4_x86.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},x86>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_f32x16_x86.hpp>
+    src/hikocpu/array_intrinsic_f32x16_x86.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},arm>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_f32x4_arm.hpp>
+    src/hikocpu/array_intrinsic_f32x4_arm.hpp
     $<$<STREQUAL:${ARCHITECTURE_ID},x86>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_f32x4_x86.hpp>
     src/hikocpu/array_intrinsic_f32x4_x86.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},x86>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_f32x8_x86.hpp>
+    src/hikocpu/array_intrinsic_f32x8_x86.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},arm>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_f64x2_arm.hpp>
+    src/hikocpu/array_intrinsic_f64x2_arm.hpp
     $<$<STREQUAL:${ARCHITECTURE_ID},x86>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_f64x2_x86.hpp>
     src/hikocpu/array_intrinsic_f64x2_x86.hpp
     $<$<STREQUAL:${ARCHITECTURE_ID},x86>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_f64x4_x86.hpp>
     src/hikocpu/array_intrinsic_f64x4_x86.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},arm>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_i16x8_arm.hpp>
+    src/hikocpu/array_intrinsic_i16x8_arm.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},arm>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_i32x4_arm.hpp>
+    src/hikocpu/array_intrinsic_i32x4_arm.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},x86>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_i8x32_x86.hpp>
+    src/hikocpu/array_intrinsic_i8x32_x86.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},x86>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_u16x16_x86.hpp>
+    src/hikocpu/array_intrinsic_u16x16_x86.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},arm>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_u32x4_arm.hpp>
+    src/hikocpu/array_intrinsic_u32x4_arm.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},arm>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/array_intrinsic_u8x16_arm.hpp>
+    src/hikocpu/array_intrinsic_u8x16_arm.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},x86>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/cpu_dispatch_x86.hpp>
+    src/hikocpu/cpu_dispatch_x86.hpp
+    $<$<STREQUAL:${ARCHITECTURE_ID},arm>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/cpu_id_arm.hpp>
+    src/hikocpu/cpu_id_arm.hpp
     $<$<STREQUAL:${ARCHITECTURE_ID},none>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/cpu_id_generic.hpp>
     src/hikocpu/cpu_id_generic.hpp
     $<$<STREQUAL:${ARCHITECTURE_ID},x86>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/cpu_id_x86.hpp>
@@ -42,14 +68,27 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikocpu/macros.hpp
     src/hikocpu/simd_intf.hpp
     src/hikogui/DSP/DSP.hpp
+    src/hikogui/DSP/dsp_biquad.hpp
+    src/hikogui/DSP/dsp_convolver.hpp
+    src/hikogui/DSP/dsp_fft.hpp
     src/hikogui/DSP/dsp_float.hpp
+    src/hikogui/DSP/dsp_gain.hpp
+    src/hikogui/DSP/dsp_meter.hpp
+    src/hikogui/DSP/dsp_mix.hpp
     src/hikogui/DSP/dsp_mul.hpp
+    src/hikogui/DSP/dsp_parameter.hpp
+    src/hikogui/DSP/dsp_resample.hpp
     src/hikogui/DSP/for_each.hpp
     src/hikogui/GFX/GFX.hpp
+    src/hikogui/GFX/draw_context_cache.hpp
     src/hikogui/GFX/draw_context_impl.hpp
     src/hikogui/GFX/draw_context_intf.hpp
+    src/hikogui/GFX/draw_text_cache.hpp
+    src/hikogui/GFX/gfx_atlas_allocator.hpp
     src/hikogui/GFX/gfx_device_vulkan_impl.hpp
     src/hikogui/GFX/gfx_device_vulkan_intf.hpp
+    src/hikogui/GFX/gfx_memory_budget.hpp
+    src/hikogui/GFX/gfx_page_allocator.hpp
     src/hikogui/GFX/gfx_pipeline_SDF_vulkan_impl.hpp
     src/hikogui/GFX/gfx_pipeline_SDF_vulkan_intf.hpp
     src/hikogui/GFX/gfx_pipeline_box_vulkan_impl.hpp
@@ -63,6 +102,8 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/GFX/gfx_pipeline_vulkan_impl.hpp
     src/hikogui/GFX/gfx_pipeline_vulkan_intf.hpp
     src/hikogui/GFX/gfx_queue_vulkan.hpp
+    src/hikogui/GFX/gfx_readback_vulkan.hpp
+    src/hikogui/GFX/gfx_render_thread.hpp
     src/hikogui/GFX/gfx_surface_delegate_vulkan.hpp
     src/hikogui/GFX/gfx_surface_state.hpp
     src/hikogui/GFX/gfx_surface_vulkan_impl.hpp
@@ -70,10 +111,15 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/GFX/gfx_system_globals.hpp
     src/hikogui/GFX/gfx_system_vulkan_impl.hpp
     src/hikogui/GFX/gfx_system_vulkan_intf.hpp
+    src/hikogui/GFX/gfx_timestamp_queries_vulkan.hpp
+    src/hikogui/GFX/gfx_vertex_ring_vulkan.hpp
     src/hikogui/GFX/render_doc.hpp
     src/hikogui/GFX/renderdoc_app.h
+    src/hikogui/GFX/sdf_glyph_cache.hpp
     src/hikogui/GUI/GUI.hpp
+    src/hikogui/GUI/frame_statistics.hpp
     src/hikogui/GUI/gui_event.hpp
+    src/hikogui/GUI/gui_event_coalescer.hpp
     src/hikogui/GUI/gui_event_type.hpp
     src/hikogui/GUI/gui_event_variant.hpp
     src/hikogui/GUI/gui_window_size.hpp
@@ -91,6 +137,7 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/GUI/keyboard_virtual_key_win32_impl.hpp
     src/hikogui/GUI/mouse_buttons.hpp
     src/hikogui/GUI/mouse_cursor.hpp
+    src/hikogui/GUI/performance_overlay.hpp
     src/hikogui/GUI/theme.hpp
     src/hikogui/GUI/theme_book.hpp
     src/hikogui/GUI/widget_id.hpp
@@ -103,10 +150,14 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/algorithm/ranges.hpp
     src/hikogui/algorithm/recursive_iterator.hpp
     src/hikogui/algorithm/strings.hpp
+    $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/asio_driver_win32.hpp>
+    src/hikogui/audio/asio_driver_win32.hpp
     src/hikogui/audio/audio.hpp
     src/hikogui/audio/audio_block.hpp
+    src/hikogui/audio/audio_block_pool.hpp
     src/hikogui/audio/audio_channel.hpp
     src/hikogui/audio/audio_device.hpp
+    $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_device_asio.hpp>
     src/hikogui/audio/audio_device_asio.hpp
     src/hikogui/audio/audio_device_delegate.hpp
     src/hikogui/audio/audio_device_state.hpp
@@ -114,15 +165,24 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/audio/audio_device_win32.hpp
     src/hikogui/audio/audio_direction.hpp
     src/hikogui/audio/audio_format_range.hpp
+    src/hikogui/audio/audio_graph.hpp
+    src/hikogui/audio/audio_graph_node.hpp
+    src/hikogui/audio/audio_ring_buffer.hpp
     src/hikogui/audio/audio_sample_format.hpp
     src/hikogui/audio/audio_sample_packer.hpp
     src/hikogui/audio/audio_sample_unpacker.hpp
+    $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_stream_asio.hpp>
+    src/hikogui/audio/audio_stream_asio.hpp
     src/hikogui/audio/audio_stream_config.hpp
     src/hikogui/audio/audio_stream_format.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_stream_format_win32.hpp>
     src/hikogui/audio/audio_stream_format_win32.hpp
+    src/hikogui/audio/audio_stream_statistics.hpp
+    $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_stream_win32.hpp>
+    src/hikogui/audio/audio_stream_win32.hpp
     src/hikogui/audio/audio_system.hpp
     src/hikogui/audio/audio_system_aggregate.hpp
+    $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_system_asio.hpp>
     src/hikogui/audio/audio_system_asio.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_system_win32.hpp>
     src/hikogui/audio/audio_system_win32.hpp
@@ -144,18 +204,28 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/char_maps/utf_32.hpp
     src/hikogui/char_maps/utf_8.hpp
     src/hikogui/codec/BON8.hpp
+    src/hikogui/codec/BON8_view.hpp
     src/hikogui/codec/JSON.hpp
+    src/hikogui/codec/JSON_fast.hpp
+    src/hikogui/codec/JSON_view.hpp
+    src/hikogui/codec/JSON_writer.hpp
     src/hikogui/codec/SHA2.hpp
     src/hikogui/codec/base_n.hpp
     src/hikogui/codec/codec.hpp
     src/hikogui/codec/datum.hpp
+    src/hikogui/codec/deflate.hpp
     src/hikogui/codec/gzip.hpp
     src/hikogui/codec/huffman.hpp
     src/hikogui/codec/indent.hpp
     src/hikogui/codec/inflate.hpp
+    src/hikogui/codec/inflate_stream.hpp
     src/hikogui/codec/jsonpath.hpp
+    src/hikogui/codec/jsonpath_set.hpp
     src/hikogui/codec/pickle.hpp
     src/hikogui/codec/png.hpp
+    src/hikogui/codec/png_encode.hpp
+    src/hikogui/codec/png_unfilter.hpp
+    src/hikogui/codec/serialize.hpp
     src/hikogui/codec/zlib.hpp
     src/hikogui/color/Rec2020.hpp
     src/hikogui/color/Rec2100.hpp
@@ -182,23 +252,30 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/container/byte_string.hpp
     src/hikogui/container/container.hpp
     src/hikogui/container/expected_optional.hpp
+    src/hikogui/container/flat_map.hpp
     src/hikogui/container/function_fifo.hpp
     src/hikogui/container/functional.hpp
     src/hikogui/container/lean_vector.hpp
+    src/hikogui/container/lru_cache.hpp
     src/hikogui/container/polymorphic_optional.hpp
+    src/hikogui/container/rope.hpp
     src/hikogui/container/secure_vector.hpp
+    src/hikogui/container/shared_bstring.hpp
     src/hikogui/container/stable_set.hpp
     src/hikogui/container/stack.hpp
     src/hikogui/container/undo_stack.hpp
     src/hikogui/container/vector_span.hpp
     src/hikogui/container/void_span.hpp
     src/hikogui/container/wfree_fifo.hpp
+    src/hikogui/container/wfree_message_fifo.hpp
+    src/hikogui/container/work_stealing_deque.hpp
     src/hikogui/crt.hpp
     src/hikogui/crt/crt.hpp
     src/hikogui/crt/crt_utils.hpp
     src/hikogui/crt/crt_utils_intf.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/crt/crt_utils_win32_impl.hpp>
     src/hikogui/crt/crt_utils_win32_impl.hpp
+    src/hikogui/dispatch/async_loader.hpp
     src/hikogui/dispatch/async_task.hpp
     src/hikogui/dispatch/awaitable.hpp
     src/hikogui/dispatch/awaitable_stop_token_impl.hpp
@@ -207,18 +284,25 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/dispatch/awaitable_timer_intf.hpp
     src/hikogui/dispatch/dispatch.hpp
     src/hikogui/dispatch/function_timer.hpp
+    $<$<PLATFORM_ID:Linux>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/loop_linux_intf.hpp>
+    src/hikogui/dispatch/loop_linux_intf.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/loop_win32_intf.hpp>
     src/hikogui/dispatch/loop_win32_intf.hpp
     src/hikogui/dispatch/notifier.hpp
     src/hikogui/dispatch/progress.hpp
     src/hikogui/dispatch/socket_event.hpp
     src/hikogui/dispatch/socket_event_intf.hpp
+    $<$<PLATFORM_ID:Linux>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/socket_event_linux_impl.hpp>
+    src/hikogui/dispatch/socket_event_linux_impl.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/socket_event_win32_impl.hpp>
     src/hikogui/dispatch/socket_event_win32_impl.hpp
+    src/hikogui/dispatch/startup_graph.hpp
     src/hikogui/dispatch/task.hpp
     src/hikogui/dispatch/task_controller.hpp
+    src/hikogui/dispatch/thread_pool.hpp
     src/hikogui/dispatch/when_any.hpp
     src/hikogui/file/access_mode.hpp
+    src/hikogui/file/async_file.hpp
     src/hikogui/file/file.hpp
     src/hikogui/file/file_intf.hpp
     $<$<PLATFORM_ID:Linux>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/file/file_posix_impl.hpp>
@@ -230,16 +314,21 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/file/file_view_win32_impl.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/file/file_win32_impl.hpp>
     src/hikogui/file/file_win32_impl.hpp
+    src/hikogui/file/file_writer.hpp
+    src/hikogui/file/parallel_glob.hpp
+    src/hikogui/file/resource_archive.hpp
     src/hikogui/file/resource_view.hpp
     src/hikogui/file/seek_whence.hpp
     src/hikogui/font/elusive_icon.hpp
     src/hikogui/font/font.hpp
     src/hikogui/font/font_book.hpp
     src/hikogui/font/font_char_map.hpp
+    src/hikogui/font/font_fallback_map.hpp
     src/hikogui/font/font_family_id.hpp
     src/hikogui/font/font_font.hpp
     src/hikogui/font/font_glyph_ids.hpp
     src/hikogui/font/font_id.hpp
+    src/hikogui/font/font_index_cache.hpp
     src/hikogui/font/font_metrics.hpp
     src/hikogui/font/font_style.hpp
     src/hikogui/font/font_variant.hpp
@@ -248,7 +337,12 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/font/glyph_id.hpp
     src/hikogui/font/glyph_metrics.hpp
     src/hikogui/font/hikogui_icon.hpp
+    src/hikogui/font/otype_CBDT.hpp
+    src/hikogui/font/otype_COLR.hpp
+    src/hikogui/font/otype_CPAL.hpp
+    src/hikogui/font/otype_GPOS.hpp
     src/hikogui/font/otype_GSUB.hpp
+    src/hikogui/font/otype_class_def.hpp
     src/hikogui/font/otype_cmap.hpp
     src/hikogui/font/otype_coverage.hpp
     src/hikogui/font/otype_glyf.hpp
@@ -260,12 +354,14 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/font/otype_maxp.hpp
     src/hikogui/font/otype_name.hpp
     src/hikogui/font/otype_os2.hpp
+    src/hikogui/font/otype_sbix.hpp
     src/hikogui/font/otype_sfnt.hpp
     src/hikogui/font/otype_utilities.hpp
     src/hikogui/font/true_type_font.hpp
     src/hikogui/geometry/aarectangle.hpp
     src/hikogui/geometry/alignment.hpp
     src/hikogui/geometry/axis.hpp
+    src/hikogui/geometry/bulk_transform.hpp
     src/hikogui/geometry/circle.hpp
     src/hikogui/geometry/corner_radii.hpp
     src/hikogui/geometry/extent2.hpp
@@ -309,7 +405,9 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/i18n/language_tag_impl.hpp
     src/hikogui/i18n/language_tag_intf.hpp
     src/hikogui/image/image.hpp
+    src/hikogui/image/pixel_convert.hpp
     src/hikogui/image/pixmap.hpp
+    src/hikogui/image/pixmap_algorithm.hpp
     src/hikogui/image/pixmap_span.hpp
     src/hikogui/image/sdf_r8.hpp
     src/hikogui/image/sfloat_rg32.hpp
@@ -320,10 +418,12 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/image/sint_abgr8_pack.hpp
     src/hikogui/image/snorm_r8.hpp
     src/hikogui/image/srgb_abgr8_pack.hpp
+    src/hikogui/image/srgb_bc3_block.hpp
     src/hikogui/image/uint_abgr8_pack.hpp
     src/hikogui/image/unorm_a2bgr10_pack.hpp
     src/hikogui/l10n/l10n.hpp
     src/hikogui/l10n/label.hpp
+    src/hikogui/l10n/mo_parser.hpp
     src/hikogui/l10n/po_parser.hpp
     src/hikogui/l10n/po_translations.hpp
     src/hikogui/l10n/translation.hpp
@@ -333,21 +433,29 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/layout/grid_layout.hpp
     src/hikogui/layout/layout.hpp
     src/hikogui/layout/row_column_layout.hpp
+    src/hikogui/layout/spatial_index.hpp
     src/hikogui/layout/spreadsheet_address.hpp
+    src/hikogui/layout/virtual_list_layout.hpp
     src/hikogui/macros.hpp
+    src/hikogui/memory/frame_arena.hpp
     src/hikogui/memory/locked_memory_allocator.hpp
     src/hikogui/memory/locked_memory_allocator_intf.hpp
+    $<$<PLATFORM_ID:Linux>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/memory/locked_memory_allocator_posix_impl.hpp>
+    src/hikogui/memory/locked_memory_allocator_posix_impl.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/memory/locked_memory_allocator_win32_impl.hpp>
     src/hikogui/memory/locked_memory_allocator_win32_impl.hpp
+    src/hikogui/memory/locked_memory_pool_impl.hpp
     src/hikogui/memory/memory.hpp
     src/hikogui/memory/secure_memory_allocator.hpp
     src/hikogui/metadata/application_metadata.hpp
     src/hikogui/metadata/metadata.hpp
     src/hikogui/metadata/semantic_version.hpp
+    src/hikogui/net/message_channel.hpp
+    src/hikogui/net/metrics_server.hpp
     src/hikogui/net/net.hpp
     src/hikogui/net/packet.hpp
-    #src/hikogui/net/packet_buffer.hpp
-    #src/hikogui/net/stream.hpp
+    src/hikogui/net/packet_buffer.hpp
+    src/hikogui/net/stream.hpp
     src/hikogui/numeric/bigint.hpp
     src/hikogui/numeric/decimal.hpp
     src/hikogui/numeric/int_carry.hpp
@@ -365,6 +473,7 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/parser/placement.hpp
     src/hikogui/parser/token.hpp
     src/hikogui/path/URI.hpp
+    src/hikogui/path/URI_view.hpp
     src/hikogui/path/URL.hpp
     src/hikogui/path/cmake_install.hpp
     src/hikogui/path/glob.hpp
@@ -382,10 +491,13 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/random/xorshift128p.hpp
     src/hikogui/security/security.hpp
     src/hikogui/security/security_intf.hpp
+    $<$<PLATFORM_ID:Linux>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/security/security_posix_impl.hpp>
+    src/hikogui/security/security_posix_impl.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/security/security_win32_impl.hpp>
     src/hikogui/security/security_win32_impl.hpp
     src/hikogui/security/sip_hash.hpp
     src/hikogui/settings/os_settings.hpp
+    src/hikogui/settings/os_settings_category.hpp
     src/hikogui/settings/os_settings_intf.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/settings/os_settings_win32_impl.hpp>
     src/hikogui/settings/os_settings_win32_impl.hpp
@@ -397,12 +509,17 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/settings/user_settings_intf.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/settings/user_settings_win32_impl.hpp>
     src/hikogui/settings/user_settings_win32_impl.hpp
+    src/hikogui/telemetry/benchmark.hpp
     src/hikogui/telemetry/counters.hpp
     src/hikogui/telemetry/delayed_format.hpp
     src/hikogui/telemetry/format_check.hpp
+    src/hikogui/telemetry/histogram.hpp
     src/hikogui/telemetry/log.hpp
+    src/hikogui/telemetry/memory_tracking.hpp
+    src/hikogui/telemetry/openmetrics.hpp
     src/hikogui/telemetry/telemetry.hpp
     src/hikogui/telemetry/trace.hpp
+    src/hikogui/telemetry/trace_recorder.hpp
     src/hikogui/test.hpp
     src/hikogui/text/text.hpp
     src/hikogui/text/text_cursor.hpp
@@ -429,6 +546,7 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/unicode/gstring.hpp
     src/hikogui/unicode/markup.hpp
     src/hikogui/unicode/phrasing.hpp
+    src/hikogui/unicode/ucd_NFC_quick_checks.hpp
     src/hikogui/unicode/ucd_bidi_classes.hpp
     src/hikogui/unicode/ucd_bidi_mirroring_glyphs.hpp
     src/hikogui/unicode/ucd_bidi_paired_bracket_types.hpp
@@ -442,6 +560,7 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/unicode/ucd_line_break_classes.hpp
     src/hikogui/unicode/ucd_scripts.hpp
     src/hikogui/unicode/ucd_sentence_break_properties.hpp
+    src/hikogui/unicode/ucd_text_properties.hpp
     src/hikogui/unicode/ucd_word_break_properties.hpp
     src/hikogui/unicode/unicode.hpp
     src/hikogui/unicode/unicode_bidi.hpp
@@ -474,6 +593,7 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/utility/concepts.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/utility/console_win32.hpp>
     src/hikogui/utility/console_win32.hpp
+    src/hikogui/utility/coroutine_frame_pool.hpp
     src/hikogui/utility/debugger.hpp
     $<$<STREQUAL:${ARCHITECTURE_ID},none>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/utility/debugger_generic_impl.hpp>
     src/hikogui/utility/debugger_generic_impl.hpp
@@ -493,6 +613,8 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/utility/enum_metadata.hpp
     src/hikogui/utility/exception.hpp
     src/hikogui/utility/exception_intf.hpp
+    $<$<PLATFORM_ID:Linux>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/utility/exception_posix_impl.hpp>
+    src/hikogui/utility/exception_posix_impl.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/utility/exception_win32_impl.hpp>
     src/hikogui/utility/exception_win32_impl.hpp
     src/hikogui/utility/fixed_string.hpp
@@ -517,10 +639,13 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     src/hikogui/widgets/async_widget.hpp
     src/hikogui/widgets/audio_device_widget.hpp
     src/hikogui/widgets/button_delegate.hpp
+    src/hikogui/widgets/cache_widget.hpp
     src/hikogui/widgets/checkbox_widget.hpp
     src/hikogui/widgets/grid_widget.hpp
     src/hikogui/widgets/icon_widget.hpp
     src/hikogui/widgets/label_widget.hpp
+    src/hikogui/widgets/list_view_delegate.hpp
+    src/hikogui/widgets/list_view_widget.hpp
     src/hikogui/widgets/menu_button_widget.hpp
     src/hikogui/widgets/momentary_button_widget.hpp
     src/hikogui/widgets/overlay_widget.hpp
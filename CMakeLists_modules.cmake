@@ -29,7 +29,7 @@ target_sources(hikogui PUBLIC FILE_SET CXX_MODULES BASE_DIRS "${CMAKE_CURRENT_SO
     ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_block.ixx
     ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_channel.ixx
     ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_device.ixx
-    ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_device_asio.ixx
+    $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_device_asio.ixx>
     ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_device_delegate.ixx
     ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_device_state.ixx
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_device_win32.ixx>
@@ -43,7 +43,7 @@ target_sources(hikogui PUBLIC FILE_SET CXX_MODULES BASE_DIRS "${CMAKE_CURRENT_SO
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_stream_format_win32.ixx>
     ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_system.ixx
     ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_system_aggregate.ixx
-    ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_system_asio.ixx
+    $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_system_asio.ixx>
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio_system_win32.ixx>
     ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/audio.ixx
     ${CMAKE_CURRENT_SOURCE_DIR}/mod/hikogui/audio/pcm_format.ixx
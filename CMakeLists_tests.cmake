@@ -44,18 +44,41 @@ elseif(CMAKE_CXX_COMPILER_FRONTEND_VARIANT STREQUAL "GNU")
 endif()
 
 target_sources(hikogui_htests PRIVATE
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/cpu_dispatch_x86_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/float_to_half_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/half_to_float_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/simd_f16x4_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/simd_f32x16_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/simd_f32x2_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/simd_f32x4_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/simd_f32x8_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/simd_f64x2_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/simd_f64x4_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/simd_i8x32_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikocpu/simd_u16x16_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/DSP/dsp_biquad_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/DSP/dsp_convolver_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/DSP/dsp_fft_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/DSP/dsp_mix_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/DSP/dsp_parameter_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/DSP/dsp_resample_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/DSP/for_each_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/GFX/gfx_atlas_allocator_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/GFX/gfx_memory_budget_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/GFX/gfx_page_allocator_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/GFX/sdf_glyph_cache_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/GUI/frame_statistics_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/GUI/gui_event_coalescer_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/GUI/keyboard_bindings_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/GUI/widget_state_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/algorithm/algorithm_misc_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/algorithm/strings_tests.cpp
-    #${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_sample_packer_tests.cpp
-    #${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_sample_unpacker_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_block_pool_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_graph_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_ring_buffer_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_sample_packer_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_sample_unpacker_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/audio/audio_stream_statistics_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/char_maps/ascii_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/char_maps/char_converter_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/char_maps/cp_1252_tests.cpp
@@ -64,24 +87,59 @@ target_sources(hikogui_htests PRIVATE
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/char_maps/utf_32_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/char_maps/utf_8_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/BON8_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/BON8_view_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON_fast_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON_view_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON_writer_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/SHA2_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/base_n_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/datum_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/deflate_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/gzip_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/inflate_stream_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/inflate_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/jsonpath_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/jsonpath_set_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/png_encode_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/png_unfilter_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/serialize_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/color/color_space_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/concurrency/callback_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/concurrency/unfair_mutex_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/expected_optional_tests.cpp
-    #${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/lean_vector_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/flat_map_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/function_fifo_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/lean_vector_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/lru_cache_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/polymorphic_optional_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/rope_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/shared_bstring_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/stable_set_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/undo_stack_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/wfree_message_fifo_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/container/work_stealing_deque_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/async_loader_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/async_task_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/function_timer_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/loop_linux_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/notifier_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/startup_graph_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/task_controller_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/thread_pool_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/file/async_file_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/file/file_view_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/file/file_writer_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/file/parallel_glob_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/file/resource_archive_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/font_char_map_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/font_fallback_map_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/font_index_cache_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/font_weight_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/otype_COLR_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/otype_GPOS_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/otype_GSUB_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/geometry/bulk_transform_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/geometry/matrix3_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/geometry/point2_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/geometry/point3_tests.cpp
@@ -99,8 +157,21 @@ target_sources(hikogui_htests PRIVATE
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/i18n/iso_639_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/i18n/language_tag_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/image/pixmap_span_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/image/pixel_convert_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/image/pixmap_algorithm_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/image/pixmap_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/image/srgb_bc3_block_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/l10n/mo_parser_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/layout/grid_layout_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/layout/spatial_index_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/layout/spreadsheet_address_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/layout/virtual_list_layout_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/memory/frame_arena_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/memory/locked_memory_allocator_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/net/message_channel_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/net/metrics_server_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/net/packet_buffer_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/net/stream_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/numeric/bigint_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/numeric/int_carry_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/numeric/polynomial_tests.cpp
@@ -109,6 +180,7 @@ target_sources(hikogui_htests PRIVATE
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/parser/lexer_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/parser/lookahead_iterator_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/path/URI_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/path/URI_view_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/path/URL_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/path/glob_tests.cpp
     #${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/random/dither_tests.cpp
@@ -117,19 +189,29 @@ target_sources(hikogui_htests PRIVATE
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/security/sip_hash_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/settings/user_settings_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/counters_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/delayed_format_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/format_check_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/histogram_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/memory_tracking_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/openmetrics_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/trace_recorder_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/theme/style_parser_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/theme/style_path_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/grapheme_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/gstring_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/markup_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_scripts_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_text_properties_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/unicode_bidi_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/unicode_break_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/unicode_normalization_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/unicode_plural_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/units/em_squares_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/units/pixel_density_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/units/pixels_per_inch_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/utility/cast_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/utility/charconv_tests.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/utility/coroutine_frame_pool_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/utility/defer_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/utility/enum_metadata_tests.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/utility/fixed_string_tests.cpp
@@ -108,6 +108,13 @@ protected:
         co_yield *_label_widget;
     }
 
+    // This function should be overridden as well, it visits the same children as `children()`.
+    // It is used when traversing the widget tree, and is faster than resuming the co-routine.
+    void visit_children(bool include_invisible, hi::function<void(widget_intf&)>& func) noexcept override
+    {
+        func(*_label_widget);
+    }
+
 private:
     // Child widgets are owned by their parent.
     std::unique_ptr<hi::label_widget> _label_widget;
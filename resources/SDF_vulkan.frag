@@ -12,9 +12,10 @@ layout(push_constant) uniform push_constants {
 
 layout(constant_id = 0) const float sdf_max_distance = 1.0;
 layout(constant_id = 1) const float atlas_image_width = 1.0;
+layout(constant_id = 2) const int atlas_num_images = 128;
 
 layout(set = 0, binding = 0) uniform sampler in_sampler;
-layout(set = 0, binding = 1) uniform texture2D in_textures[128];
+layout(set = 0, binding = 1) uniform texture2D in_textures[atlas_num_images];
 
 layout(location = 0) in flat vec4 in_clipping_rectangle;
 layout(location = 1) in vec3 in_texture_coord;
@@ -43,44 +44,62 @@ vec4 get_texture_stride()
     return vec4(horizontal_texture_stride, vertical_texture_stride);
 }
 
-vec2 green_coord(vec4 texture_stride, vec2 coord)
-{
-    return coord;
-}
-
-vec2 red_coord(vec4 texture_stride, vec2 coord)
-{
-    vec4 tmp = texture_stride * pushConstants.red_subpixel_orientation.xxyy;
-    return coord + tmp.xy + tmp.zw;
-}
-
-vec2 blue_coord(vec4 texture_stride, vec2 coord)
+/** Get the distance from the center of the fragment to the nearest edge, in fragments.
+ *
+ * @param image_nr The index of the atlas image.
+ * @param coord The texture coordinate to sample.
+ * @param distance_multiplier The multiplier to convert a sample to a distance in fragments.
+ */
+float get_distance(int image_nr, vec2 coord, float distance_multiplier)
 {
-    vec4 tmp = texture_stride * pushConstants.blue_subpixel_orientation.xxyy;
-    return coord + tmp.xy + tmp.zw;
+    return texture(sampler2D(in_textures[nonuniformEXT(image_nr)], in_sampler), coord).r * distance_multiplier;
 }
 
-/** Get the distance from the sub-pixels to the nearest edge.
+/** Get the coverage of the fragment, or of each sub-pixel of the fragment.
+ *
+ * Without sub-pixels the coverage is a box-filter the size of the fragment.
  *
- * @return Distances to the edge from the center of the red, green and blue sub-pixels.
+ * With sub-pixels the coverage of five sub-pixel wide boxes is calculated
+ * along the sub-pixel axis, centered on the green sub-pixel. Each color is
+ * filtered from its own sub-pixel and its two neighbours with the
+ * weights 1/4, 1/2, 1/4. The filter reduces color fringes while keeping the
+ * horizontal resolution of the sub-pixels. The sum of the weights of the
+ * filter is one fragment wide, so that thin lines have the same weight as
+ * without sub-pixels.
+ *
+ * @return The coverage of the red, green and blue sub-pixels.
  */
-vec3 get_subpixel_to_edge_distances()
+vec3 get_subpixel_coverage()
 {
     int image_nr = int(in_texture_coord.z);
     vec2 image_coord = in_texture_coord.xy;
     vec4 texture_stride = get_texture_stride();
 
-    float green_distance = texture(sampler2D(in_textures[image_nr], in_sampler), green_coord(texture_stride, image_coord)).r;
+    float pixel_distance = length(texture_stride.xy);
+    float distance_multiplier = sdf_max_distance / (pixel_distance * atlas_image_width);
 
-    vec3 distances = vec3(green_distance, green_distance, green_distance);
-    if (pushConstants.has_subpixels) {
-        distances.r = texture(sampler2D(in_textures[image_nr], in_sampler), red_coord(texture_stride, image_coord)).r;
-        distances.b = texture(sampler2D(in_textures[image_nr], in_sampler), blue_coord(texture_stride, image_coord)).r;
+    if (!pushConstants.has_subpixels) {
+        float coverage = clamp(get_distance(image_nr, image_coord, distance_multiplier) + 0.5, 0.0, 1.0);
+        return vec3(coverage, coverage, coverage);
     }
 
-    float pixel_distance = length(texture_stride.xy);
-    float distance_multiplier = sdf_max_distance / (pixel_distance * atlas_image_width);
-    return distances * distance_multiplier;
+    // The distance in texture coordinates from one sub-pixel to the next, from the red toward the blue sub-pixel.
+    vec4 tmp = texture_stride * pushConstants.blue_subpixel_orientation.xxyy;
+    vec2 subpixel_stride = tmp.xy + tmp.zw;
+
+    // The distances are in fragments, a sub-pixel is a third of a fragment wide.
+    float subpixel_multiplier = distance_multiplier * 3.0;
+    vec4 coverage_0123 = clamp(vec4(
+        get_distance(image_nr, image_coord - 2.0 * subpixel_stride, subpixel_multiplier),
+        get_distance(image_nr, image_coord - subpixel_stride, subpixel_multiplier),
+        get_distance(image_nr, image_coord, subpixel_multiplier),
+        get_distance(image_nr, image_coord + subpixel_stride, subpixel_multiplier)) + 0.5, 0.0, 1.0);
+    float coverage_4 = clamp(get_distance(image_nr, image_coord + 2.0 * subpixel_stride, subpixel_multiplier) + 0.5, 0.0, 1.0);
+
+    return vec3(
+        dot(coverage_0123.xyz, vec3(0.25, 0.5, 0.25)),
+        dot(coverage_0123.yzw, vec3(0.25, 0.5, 0.25)),
+        dot(vec3(coverage_0123.zw, coverage_4), vec3(0.25, 0.5, 0.25)));
 }
 
 void main()
@@ -89,8 +108,7 @@ void main()
         discard;
     }
 
-    vec3 distances = get_subpixel_to_edge_distances();
-    vec3 coverage = clamp(distances + 0.5, 0.0, 1.0);
+    vec3 coverage = get_subpixel_coverage();
     if (coverage == vec3(0.0, 0.0, 0.0)) {
         discard;
     }
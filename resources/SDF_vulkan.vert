@@ -9,11 +9,19 @@ layout(push_constant) uniform push_constants {
     bool has_subpixels;
 } pushConstants;
 
-// In position is in window pixel position, with left-bottom origin.
-layout(location = 0) in vec3 in_position;
-layout(location = 1) in vec4 in_clipping_rectangle;
-layout(location = 2) in vec3 in_texture_coord;
-layout(location = 3) in vec4 in_color;
+// Per-instance attributes, one instance per glyph.
+// Positions are in window pixel position, with left-bottom origin.
+// Corners are in the order: bottom-left, bottom-right, top-left, top-right.
+layout(location = 0) in vec4 in_corners01;
+layout(location = 1) in vec4 in_corners23;
+layout(location = 2) in vec4 in_clipping_rectangle;
+layout(location = 3) in vec4 in_texture_rectangle;
+layout(location = 4) in float in_z;
+layout(location = 5) in uint in_image_index;
+layout(location = 6) in vec4 in_color0;
+layout(location = 7) in vec4 in_color1;
+layout(location = 8) in vec4 in_color2;
+layout(location = 9) in vec4 in_color3;
 
 layout(location = 0) out flat vec4 out_clipping_rectangle;
 layout(location = 1) out vec3 out_texture_coord;
@@ -41,11 +49,19 @@ vec4 convert_clipping_rectangle_to_screen(vec4 clipping_rectangle)
 }
 
 void main() {
-    gl_Position = convert_position_to_viewport(in_position);
+    // The first quad of the quad index buffer selects the corners 0, 1, 2, 2, 1, 3.
+    int corner = gl_VertexIndex;
+
+    vec2 positions[4] = vec2[4](in_corners01.xy, in_corners01.zw, in_corners23.xy, in_corners23.zw);
+    vec2 texture_coords[4] = vec2[4](
+        in_texture_rectangle.xy, in_texture_rectangle.zy, in_texture_rectangle.xw, in_texture_rectangle.zw);
+    vec4 colors[4] = vec4[4](in_color0, in_color1, in_color2, in_color3);
+
+    gl_Position = convert_position_to_viewport(vec3(positions[corner], in_z));
     out_clipping_rectangle = convert_clipping_rectangle_to_screen(in_clipping_rectangle);
-    out_texture_coord = in_texture_coord;
+    out_texture_coord = vec3(texture_coords[corner], float(in_image_index));
 
-    vec4 color = multiply_alpha(in_color);
+    vec4 color = multiply_alpha(colors[corner]);
 
     out_color = color;
     out_color_sqrt_rgby = sqrt(clamp(rgb_to_rgby(color.rgb), 0.0, 1.0));
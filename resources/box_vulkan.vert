@@ -6,13 +6,23 @@ layout(push_constant) uniform push_constants {
     vec2 viewport_scale;
 } constants;
 
-layout(location = 0) in vec4 in_position;
-layout(location = 1) in vec4 in_clipping_rectangle;
-layout(location = 2) in vec4 in_edge_distances;
-layout(location = 3) in vec4 in_corner_radii;
-layout(location = 4) in vec4 in_fill_color;
-layout(location = 5) in vec4 in_border_color;
-layout(location = 6) in float in_border_width;
+// Per-instance attributes, one instance per box.
+// Corners are in the order: bottom-left, bottom-right, top-left, top-right.
+layout(location = 0) in vec4 in_corner0;
+layout(location = 1) in vec4 in_corner1;
+layout(location = 2) in vec4 in_corner2;
+layout(location = 3) in vec4 in_corner3;
+layout(location = 4) in vec4 in_clipping_rectangle;
+layout(location = 5) in vec4 in_edge_lengths;
+layout(location = 6) in vec4 in_corner_radii;
+layout(location = 7) in vec4 in_fill_color0;
+layout(location = 8) in vec4 in_fill_color1;
+layout(location = 9) in vec4 in_fill_color2;
+layout(location = 10) in vec4 in_fill_color3;
+layout(location = 11) in vec4 in_border_color0;
+layout(location = 12) in vec4 in_border_color1;
+layout(location = 13) in vec4 in_border_color2;
+layout(location = 14) in vec4 in_border_color3;
 
 layout(location = 0) out flat vec4 out_clipping_rectangle;
 layout(location = 1) out vec4 out_edge_distances;
@@ -45,16 +55,32 @@ vec4 convert_clipping_rectangle_to_screen(vec4 clipping_rectangle)
 
 void main()
 {
+    // The first quad of the quad index buffer selects the corners 0, 1, 2, 2, 1, 3.
+    int corner = gl_VertexIndex;
+
+    vec4 corners[4] = vec4[4](in_corner0, in_corner1, in_corner2, in_corner3);
+    vec4 fill_colors[4] = vec4[4](in_fill_color0, in_fill_color1, in_fill_color2, in_fill_color3);
+    vec4 border_colors[4] = vec4[4](in_border_color0, in_border_color1, in_border_color2, in_border_color3);
+
+    // The distance from each edge at the corner, interpolated by the rasterizer.
+    // x = from the left edge, y = from the bottom edge, z = from the right edge, w = from the top edge.
+    vec4 edge_distances[4] = vec4[4](
+        vec4(0.0, 0.0, in_edge_lengths.x, in_edge_lengths.y),
+        vec4(in_edge_lengths.x, 0.0, 0.0, in_edge_lengths.w),
+        vec4(0.0, in_edge_lengths.y, in_edge_lengths.z, 0.0),
+        vec4(in_edge_lengths.z, in_edge_lengths.w, 0.0, 0.0));
+
+    float border_width = in_corner0.w;
     float border_start = 1.0;
-    float border_middle = border_start + in_border_width * 0.5;
-    float border_end = border_start + in_border_width;
+    float border_middle = border_start + border_width * 0.5;
+    float border_end = border_start + border_width;
 
-    vec4 fill_color = multiply_alpha(in_fill_color);
-    vec4 border_color = multiply_alpha(in_border_color);
+    vec4 fill_color = multiply_alpha(fill_colors[corner]);
+    vec4 border_color = multiply_alpha(border_colors[corner]);
 
-    gl_Position = convert_position_to_viewport(in_position.xyz);
+    gl_Position = convert_position_to_viewport(corners[corner].xyz);
     out_clipping_rectangle = convert_clipping_rectangle_to_screen(in_clipping_rectangle);
-    out_edge_distances = in_edge_distances;
+    out_edge_distances = edge_distances[corner];
     out_fill_color = fill_color;
     out_border_color = border_color;
     out_border_sqrt_y = sqrt(clamp(rgb_to_y(border_color.rgb), 0.0, 1.0));
@@ -7,8 +7,10 @@ layout(push_constant) uniform push_constants {
     vec2 viewportScale;
 } pushConstants;
 
+layout(constant_id = 0) const int atlas_num_images = 64;
+
 layout(set = 0, binding = 0) uniform sampler bilinearSampler;
-layout(set = 0, binding = 1) uniform texture2D textures[64];
+layout(set = 0, binding = 1) uniform texture2D textures[atlas_num_images];
 
 layout(location = 0) in flat vec4 inClippingRectangle;
 layout(location = 1) in vec3 inAtlasPosition;
@@ -31,5 +33,5 @@ void main() {
     vec2 textureCoord = inAtlasPosition.xy;
 
     // Vulkan blending operation expects pre-multiplied alpha and the texture map is in pre-multiplied alpha. 
-    outColor = texture(sampler2D(textures[atlasTextureIndex], bilinearSampler), textureCoord);
+    outColor = texture(sampler2D(textures[nonuniformEXT(atlasTextureIndex)], bilinearSampler), textureCoord);
 }
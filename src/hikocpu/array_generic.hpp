@@ -224,6 +224,71 @@ struct array_generic {
         return mask;
     }
 
+    /** Load the elements selected by the mask from memory.
+     *
+     * Memory of elements that are not selected is not accessed, so that
+     * the tail of a buffer may be loaded without reading past its end.
+     *
+     * @param ptr A pointer to N elements in memory.
+     * @param mask A bit for each element to load, the other elements are set to zero.
+     */
+    [[nodiscard]] hi_force_inline constexpr static array_type masked_load(value_type const *ptr, size_t mask) noexcept
+    {
+        if (not std::is_constant_evaluated()) {
+            if constexpr (requires { intrinsic_type::masked_load(ptr, mask); }) {
+                return intrinsic_type::masked_load(ptr, mask);
+            }
+        }
+        auto r = array_type{};
+        for (std::size_t i = 0; i != N; ++i) {
+            r[i] = mask & 1 ? ptr[i] : _zero_mask;
+            mask >>= 1;
+        }
+        return r;
+    }
+
+    /** Store the elements selected by the mask to memory.
+     *
+     * Memory of elements that are not selected is not accessed.
+     *
+     * @param ptr A pointer to N elements in memory.
+     * @param a The elements to store.
+     * @param mask A bit for each element to store.
+     */
+    hi_force_inline constexpr static void masked_store(value_type *ptr, array_type a, size_t mask) noexcept
+    {
+        if (not std::is_constant_evaluated()) {
+            if constexpr (requires { intrinsic_type::masked_store(ptr, a, mask); }) {
+                return intrinsic_type::masked_store(ptr, a, mask);
+            }
+        }
+        for (std::size_t i = 0; i != N; ++i) {
+            if (mask & 1) {
+                ptr[i] = a[i];
+            }
+            mask >>= 1;
+        }
+    }
+
+    /** Load elements from memory at the given indices.
+     *
+     * @param ptr A pointer to the first element of a table in memory.
+     * @param indices The index in the table of each element to load.
+     */
+    [[nodiscard]] hi_force_inline constexpr static array_type gather(value_type const *ptr, std::array<int32_t, N> indices) noexcept
+    {
+        if (not std::is_constant_evaluated()) {
+            if constexpr (requires { intrinsic_type::gather(ptr, indices); }) {
+                return intrinsic_type::gather(ptr, indices);
+            }
+        }
+        auto r = array_type{};
+        for (std::size_t i = 0; i != N; ++i) {
+            r[i] = ptr[indices[i]];
+        }
+        return r;
+    }
+
     template<array_generic_convertible_to<value_type> O>
     [[nodiscard]] hi_force_inline constexpr static array_type convert(std::array<O, N> a) noexcept
     {
@@ -700,7 +765,7 @@ struct array_generic {
             a = {};
         } else {
             for (std::size_t i = 0; i != N; ++i) {
-                a[i] = to_value(to_mask(a[0]) << b);
+                a[i] = to_value(to_mask(a[i]) << b);
             }
         }
         return a;
@@ -718,7 +783,7 @@ struct array_generic {
             a = {};
         } else {
             for (std::size_t i = 0; i != N; ++i) {
-                a[i] = to_value(to_mask(a[0]) >> b);
+                a[i] = to_value(to_mask(a[i]) >> b);
             }
         }
         return a;
@@ -737,7 +802,7 @@ struct array_generic {
         }
 
         for (std::size_t i = 0; i != N; ++i) {
-            a[i] = to_value(to_signed_mask(a[0]) >> b);
+            a[i] = to_value(to_signed_mask(a[i]) >> b);
         }
         return a;
     }
@@ -956,6 +1021,40 @@ struct array_generic {
         return broadcast(r);
     }
 
+    /** The smallest element, broadcast to all elements.
+     */
+    [[nodiscard]] hi_force_inline constexpr static array_type hmin(array_type a) noexcept
+    {
+        if (not std::is_constant_evaluated()) {
+            if constexpr (requires { intrinsic_type::hmin(a); }) {
+                return intrinsic_type::hmin(a);
+            }
+        }
+
+        auto r = a[0];
+        for (std::size_t i = 1; i != N; ++i) {
+            r = a[i] < r ? a[i] : r;
+        }
+        return broadcast(r);
+    }
+
+    /** The largest element, broadcast to all elements.
+     */
+    [[nodiscard]] hi_force_inline constexpr static array_type hmax(array_type a) noexcept
+    {
+        if (not std::is_constant_evaluated()) {
+            if constexpr (requires { intrinsic_type::hmax(a); }) {
+                return intrinsic_type::hmax(a);
+            }
+        }
+
+        auto r = a[0];
+        for (std::size_t i = 1; i != N; ++i) {
+            r = a[i] > r ? a[i] : r;
+        }
+        return broadcast(r);
+    }
+
     template<size_t Mask>
     [[nodiscard]] hi_force_inline constexpr static array_type dot(array_type a, array_type b) noexcept
     {
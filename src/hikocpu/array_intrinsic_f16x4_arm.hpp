@@ -0,0 +1,279 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "array_intrinsic.hpp"
+#include "half.hpp"
+#include "macros.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <bit>
+
+#include <arm_neon.h>
+
+hi_export_module(hikocpu : array_intrinsic_f16x4);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+#if defined(HI_HAS_NEON) and defined(HI_HAS_ARM64)
+/** Intrinsics for 4 half-precision floats.
+ *
+ * The bit-operations only need Advanced SIMD. The arithmetic is done natively
+ * in half-precision when the CPU supports FP16 vector arithmetic, otherwise
+ * the generic implementation converts each element to float.
+ */
+template<>
+struct array_intrinsic<half, 4> {
+    using value_type = half;
+    using register_type = uint16x4_t;
+    using array_type = std::array<half, 4>;
+
+    /** Load an array into a register.
+     */
+    [[nodiscard]] hi_force_inline static register_type L(array_type a) noexcept
+    {
+        return vcreate_u16(std::bit_cast<uint64_t>(a));
+    }
+
+    /** Store a register into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type S(register_type a) noexcept
+    {
+        return std::bit_cast<array_type>(vget_lane_u64(vreinterpret_u64_u16(a), 0));
+    }
+
+    /** Make a lane mask from a compile-time bit-mask.
+     */
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline static uint16x4_t _make_mask() noexcept
+    {
+        constexpr auto mask = std::array<uint16_t, 4>{
+            Mask & 0b0001 ? uint16_t{0xffff} : uint16_t{0},
+            Mask & 0b0010 ? uint16_t{0xffff} : uint16_t{0},
+            Mask & 0b0100 ? uint16_t{0xffff} : uint16_t{0},
+            Mask & 0b1000 ? uint16_t{0xffff} : uint16_t{0}};
+        return vld1_u16(mask.data());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_zero() noexcept
+    {
+        return S(vdup_n_u16(0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_all_ones() noexcept
+    {
+        return S(vdup_n_u16(0xffff));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_one() noexcept
+    {
+        return S(vdup_n_u16(0x3c00));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(half a) noexcept
+    {
+        return S(vdup_n_u16(a.intrinsic()));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(array_type a) noexcept
+    {
+        return S(vdup_lane_u16(L(a), 0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_mask(std::size_t mask) noexcept
+    {
+        constexpr auto bits = std::array<uint16_t, 4>{1, 2, 4, 8};
+        return S(vtst_u16(vdup_n_u16(static_cast<uint16_t>(mask)), vld1_u16(bits.data())));
+    }
+
+    /** Store a register as a mask-integer.
+     */
+    [[nodiscard]] hi_force_inline static std::size_t get_mask(array_type a) noexcept
+    {
+        constexpr auto shifts = std::array<int16_t, 4>{0, 1, 2, 3};
+        auto const top_bits = vshr_n_u16(L(a), 15);
+        return vaddv_u16(vshl_u16(top_bits, vld1_s16(shifts.data())));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type inv(array_type a) noexcept
+    {
+        return S(vmvn_u16(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static bool test(array_type a, array_type b) noexcept
+    {
+        return vget_lane_u64(vreinterpret_u64_u16(vand_u16(L(a), L(b))), 0) == 0;
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _or(array_type a, array_type b) noexcept
+    {
+        return S(vorr_u16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _and(array_type a, array_type b) noexcept
+    {
+        return S(vand_u16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _xor(array_type a, array_type b) noexcept
+    {
+        return S(veor_u16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type andnot(array_type a, array_type b) noexcept
+    {
+        return S(vbic_u16(L(b), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sll(array_type a, unsigned int b) noexcept
+    {
+        return S(vshl_u16(L(a), vdup_n_s16(static_cast<int16_t>(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type srl(array_type a, unsigned int b) noexcept
+    {
+        // A negative shift-left is a shift-right.
+        return S(vshl_u16(L(a), vdup_n_s16(static_cast<int16_t>(-static_cast<int>(b)))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sra(array_type a, unsigned int b) noexcept
+    {
+        auto const a_ = vreinterpret_s16_u16(L(a));
+        return S(vreinterpret_u16_s16(vshl_s16(a_, vdup_n_s16(static_cast<int16_t>(-static_cast<int>(b))))));
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type blend(array_type a, array_type b) noexcept
+    {
+        return S(vbsl_u16(_make_mask<Mask>(), L(b), L(a)));
+    }
+
+#if defined(HI_HAS_FP16)
+    /** Load an array into a register as half-precision floats.
+     */
+    [[nodiscard]] hi_force_inline static float16x4_t Lf(array_type a) noexcept
+    {
+        return vreinterpret_f16_u16(L(a));
+    }
+
+    /** Store a register of half-precision floats into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type Sf(float16x4_t a) noexcept
+    {
+        return S(vreinterpret_u16_f16(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type neg(array_type a) noexcept
+    {
+        return Sf(vneg_f16(Lf(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type abs(array_type a) noexcept
+    {
+        return Sf(vabs_f16(Lf(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sqrt(array_type a) noexcept
+    {
+        return Sf(vsqrt_f16(Lf(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type round(array_type a) noexcept
+    {
+        return Sf(vrndi_f16(Lf(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type floor(array_type a) noexcept
+    {
+        return Sf(vrndm_f16(Lf(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ceil(array_type a) noexcept
+    {
+        return Sf(vrndp_f16(Lf(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type add(array_type a, array_type b) noexcept
+    {
+        return Sf(vadd_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sub(array_type a, array_type b) noexcept
+    {
+        return Sf(vsub_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type mul(array_type a, array_type b) noexcept
+    {
+        return Sf(vmul_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type div(array_type a, array_type b) noexcept
+    {
+        return Sf(vdiv_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type eq(array_type a, array_type b) noexcept
+    {
+        return S(vceq_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ne(array_type a, array_type b) noexcept
+    {
+        return S(vmvn_u16(vceq_f16(Lf(a), Lf(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type lt(array_type a, array_type b) noexcept
+    {
+        return S(vclt_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gt(array_type a, array_type b) noexcept
+    {
+        return S(vcgt_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type le(array_type a, array_type b) noexcept
+    {
+        return S(vcle_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ge(array_type a, array_type b) noexcept
+    {
+        return S(vcge_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type max(array_type a, array_type b) noexcept
+    {
+        return Sf(vmax_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type min(array_type a, array_type b) noexcept
+    {
+        return Sf(vmin_f16(Lf(a), Lf(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type clamp(array_type v, array_type lo, array_type hi) noexcept
+    {
+        return Sf(vmin_f16(vmax_f16(Lf(v), Lf(lo)), Lf(hi)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmin(array_type a) noexcept
+    {
+        return Sf(vdup_n_f16(vminv_f16(Lf(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmax(array_type a) noexcept
+    {
+        return Sf(vdup_n_f16(vmaxv_f16(Lf(a))));
+    }
+#endif
+};
+#endif
+
+} // namespace v1
+} // namespace v1
@@ -0,0 +1,347 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "array_intrinsic.hpp"
+#include "macros.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <limits>
+
+#include <immintrin.h>
+
+hi_export_module(hikocpu : array_intrinsic_f32x16);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+#if defined(HI_HAS_AVX512F)
+/** Intrinsic operations on 16 floats.
+ *
+ * Only AVX-512F instructions are used; the floating point bitwise operations
+ * and mask conversions of AVX-512DQ are replaced by their integer equivalents.
+ */
+template<>
+struct array_intrinsic<float, 16> {
+    using value_type = float;
+    using register_type = __m512;
+    using array_type = std::array<float, 16>;
+
+    /** Load an array into a register.
+     */
+    [[nodiscard]] hi_force_inline static register_type L(array_type a) noexcept
+    {
+        return _mm512_loadu_ps(a.data());
+    }
+
+    /** Store a register into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type S(register_type a) noexcept
+    {
+        auto r = array_type{};
+        _mm512_storeu_ps(r.data(), a);
+        return r;
+    }
+
+    /** Store a mask register as an array with all ones in the selected elements.
+     */
+    [[nodiscard]] hi_force_inline static array_type S(__mmask16 a) noexcept
+    {
+        return S(_mm512_castsi512_ps(_mm512_maskz_set1_epi32(a, -1)));
+    }
+
+    [[nodiscard]] hi_force_inline static __m512i Li(array_type a) noexcept
+    {
+        return _mm512_castps_si512(L(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type Si(__m512i a) noexcept
+    {
+        return S(_mm512_castsi512_ps(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type undefined() noexcept
+    {
+        return S(_mm512_undefined_ps());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set(float a) noexcept
+    {
+        return S(_mm512_maskz_mov_ps(__mmask16{1}, _mm512_set1_ps(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_zero() noexcept
+    {
+        return S(_mm512_setzero_ps());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_all_ones() noexcept
+    {
+        return Si(_mm512_set1_epi32(-1));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_one() noexcept
+    {
+        return S(_mm512_set1_ps(1.0f));
+    }
+
+    template<size_t I>
+    [[nodiscard]] hi_force_inline static float get(array_type a) noexcept
+    {
+        static_assert(I < 16);
+
+        if constexpr (I == 0) {
+            return _mm512_cvtss_f32(L(a));
+        } else {
+            return _mm512_cvtss_f32(_mm512_permutexvar_ps(_mm512_set1_epi32(I), L(a)));
+        }
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(float a) noexcept
+    {
+        return S(_mm512_set1_ps(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(array_type a) noexcept
+    {
+        return S(_mm512_broadcastss_ps(_mm512_castps512_ps128(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_mask(std::size_t mask) noexcept
+    {
+        return S(static_cast<__mmask16>(mask));
+    }
+
+    /** Store a register as a mask-integer.
+     */
+    [[nodiscard]] hi_force_inline static std::size_t get_mask(array_type a) noexcept
+    {
+        return _mm512_cmplt_epi32_mask(Li(a), _mm512_setzero_si512());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type masked_load(float const *ptr, std::size_t mask) noexcept
+    {
+        return S(_mm512_maskz_loadu_ps(static_cast<__mmask16>(mask), ptr));
+    }
+
+    hi_force_inline static void masked_store(float *ptr, array_type a, std::size_t mask) noexcept
+    {
+        _mm512_mask_storeu_ps(ptr, static_cast<__mmask16>(mask), L(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gather(float const *ptr, std::array<int32_t, 16> indices) noexcept
+    {
+        return S(_mm512_i32gather_ps(_mm512_loadu_si512(indices.data()), ptr, sizeof(float)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type neg(array_type a) noexcept
+    {
+        return S(_mm512_sub_ps(_mm512_setzero_ps(), L(a)));
+    }
+
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline constexpr static array_type neg_mask(array_type a) noexcept
+    {
+        return S(_mm512_mask_sub_ps(L(a), static_cast<__mmask16>(Mask), _mm512_setzero_ps(), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type inv(array_type a) noexcept
+    {
+        return Si(_mm512_ternarylogic_epi32(Li(a), Li(a), Li(a), 0x55));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type rcp(array_type a) noexcept
+    {
+        return S(_mm512_rcp14_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sqrt(array_type a) noexcept
+    {
+        return S(_mm512_sqrt_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type rsqrt(array_type a) noexcept
+    {
+        return S(_mm512_rsqrt14_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type abs(array_type a) noexcept
+    {
+        return S(_mm512_abs_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type round(array_type a) noexcept
+    {
+        return S(_mm512_roundscale_ps(L(a), _MM_FROUND_CUR_DIRECTION));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type floor(array_type a) noexcept
+    {
+        return S(_mm512_roundscale_ps(L(a), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ceil(array_type a) noexcept
+    {
+        return S(_mm512_roundscale_ps(L(a), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type add(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_add_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sub(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_sub_ps(L(a), L(b)));
+    }
+
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline constexpr static array_type addsub_mask(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_mask_add_ps(_mm512_sub_ps(L(a), L(b)), static_cast<__mmask16>(Mask), L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type mul(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_mul_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type div(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_div_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type eq(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_cmp_ps_mask(L(a), L(b), _CMP_EQ_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ne(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_cmp_ps_mask(L(a), L(b), _CMP_NEQ_UQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type lt(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_cmp_ps_mask(L(a), L(b), _CMP_LT_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gt(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_cmp_ps_mask(L(a), L(b), _CMP_GT_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type le(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_cmp_ps_mask(L(a), L(b), _CMP_LE_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ge(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_cmp_ps_mask(L(a), L(b), _CMP_GE_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static bool test(array_type a, array_type b) noexcept
+    {
+        return _mm512_test_epi32_mask(Li(a), Li(b)) == 0;
+    }
+
+    [[nodiscard]] hi_force_inline static array_type max(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_max_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type min(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_min_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type clamp(array_type v, array_type lo, array_type hi) noexcept
+    {
+        return S(_mm512_min_ps(_mm512_max_ps(L(v), L(lo)), L(hi)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _or(array_type a, array_type b) noexcept
+    {
+        return Si(_mm512_or_si512(Li(a), Li(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _and(array_type a, array_type b) noexcept
+    {
+        return Si(_mm512_and_si512(Li(a), Li(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _xor(array_type a, array_type b) noexcept
+    {
+        return Si(_mm512_xor_si512(Li(a), Li(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type andnot(array_type a, array_type b) noexcept
+    {
+        return Si(_mm512_andnot_si512(Li(a), Li(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sll(array_type a, unsigned int b) noexcept
+    {
+        return Si(_mm512_sll_epi32(Li(a), _mm_set_epi32(0, 0, 0, b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type srl(array_type a, unsigned int b) noexcept
+    {
+        return Si(_mm512_srl_epi32(Li(a), _mm_set_epi32(0, 0, 0, b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sra(array_type a, unsigned int b) noexcept
+    {
+        return Si(_mm512_sra_epi32(Li(a), _mm_set_epi32(0, 0, 0, b)));
+    }
+
+    template<int... Indices>
+    [[nodiscard]] hi_force_inline static array_type shuffle(array_type a) noexcept
+    {
+        static_assert(sizeof...(Indices) == 16);
+
+        constexpr auto indices = [] {
+            auto r = std::array{Indices...};
+            for (auto i = 0; i != 16; ++i) {
+                r[i] = r[i] < 0 ? i : r[i];
+            }
+            return r;
+        }();
+        return S(_mm512_permutexvar_ps(_mm512_loadu_si512(indices.data()), L(a)));
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type blend(array_type a, array_type b) noexcept
+    {
+        return S(_mm512_mask_blend_ps(static_cast<__mmask16>(Mask), L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sum(array_type a) noexcept
+    {
+        return broadcast(_mm512_reduce_add_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmin(array_type a) noexcept
+    {
+        return broadcast(_mm512_reduce_min_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmax(array_type a) noexcept
+    {
+        return broadcast(_mm512_reduce_max_ps(L(a)));
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type dot(array_type a, array_type b) noexcept
+    {
+        return broadcast(_mm512_mask_reduce_add_ps(static_cast<__mmask16>(Mask), _mm512_mul_ps(L(a), L(b))));
+    }
+};
+#endif
+
+} // namespace v1
+} // namespace v1
@@ -0,0 +1,392 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "array_intrinsic.hpp"
+#include "half.hpp"
+#include "half_to_float.hpp"
+#include "macros.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <bit>
+
+#include <arm_neon.h>
+
+hi_export_module(hikocpu : array_intrinsic_f32x4);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+#if defined(HI_HAS_NEON) and defined(HI_HAS_ARM64)
+template<>
+struct array_intrinsic<float, 4> {
+    using value_type = float;
+    using register_type = float32x4_t;
+    using array_type = std::array<float, 4>;
+
+    /** Load an array into a register.
+     */
+    [[nodiscard]] hi_force_inline static register_type L(array_type a) noexcept
+    {
+        return vld1q_f32(a.data());
+    }
+
+    /** Store a register into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type S(register_type a) noexcept
+    {
+        auto r = array_type{};
+        vst1q_f32(r.data(), a);
+        return r;
+    }
+
+    /** Load an array into a register as 32-bit integers.
+     */
+    [[nodiscard]] hi_force_inline static uint32x4_t Li(array_type a) noexcept
+    {
+        return vreinterpretq_u32_f32(L(a));
+    }
+
+    /** Store a register of 32-bit integers into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type Si(uint32x4_t a) noexcept
+    {
+        return S(vreinterpretq_f32_u32(a));
+    }
+
+    /** Make a lane mask from a compile-time bit-mask.
+     */
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline static uint32x4_t _make_mask() noexcept
+    {
+        constexpr auto mask = std::array<uint32_t, 4>{
+            Mask & 0b0001 ? 0xffff'ffff : 0, Mask & 0b0010 ? 0xffff'ffff : 0, Mask & 0b0100 ? 0xffff'ffff : 0,
+            Mask & 0b1000 ? 0xffff'ffff : 0};
+        return vld1q_u32(mask.data());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type convert(std::array<half, 4> a) noexcept
+    {
+        return half_to_float(std::bit_cast<std::array<uint16_t, 4>>(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set(float a) noexcept
+    {
+        return S(vsetq_lane_f32(a, vdupq_n_f32(0.0f), 0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_zero() noexcept
+    {
+        return S(vdupq_n_f32(0.0f));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_all_ones() noexcept
+    {
+        return Si(vdupq_n_u32(0xffff'ffff));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_one() noexcept
+    {
+        return S(vdupq_n_f32(1.0f));
+    }
+
+    template<size_t I>
+    [[nodiscard]] hi_force_inline static float get(array_type a) noexcept
+    {
+        static_assert(I < 4);
+        return vgetq_lane_f32(L(a), I);
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(float a) noexcept
+    {
+        return S(vdupq_n_f32(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(array_type a) noexcept
+    {
+        return S(vdupq_laneq_f32(L(a), 0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_mask(std::size_t mask) noexcept
+    {
+        constexpr auto bits = std::array<uint32_t, 4>{1, 2, 4, 8};
+        return Si(vtstq_u32(vdupq_n_u32(static_cast<uint32_t>(mask)), vld1q_u32(bits.data())));
+    }
+
+    /** Store a register as a mask-integer.
+     */
+    [[nodiscard]] hi_force_inline static std::size_t get_mask(array_type a) noexcept
+    {
+        constexpr auto shifts = std::array<int32_t, 4>{0, 1, 2, 3};
+        auto const top_bits = vshrq_n_u32(Li(a), 31);
+        return vaddvq_u32(vshlq_u32(top_bits, vld1q_s32(shifts.data())));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type neg(array_type a) noexcept
+    {
+        return S(vnegq_f32(L(a)));
+    }
+
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type neg_mask(array_type a) noexcept
+    {
+        if constexpr (Mask == 0) {
+            return a;
+        } else if constexpr (Mask == 0b1111) {
+            return neg(a);
+        } else {
+            // Flip the sign-bit of the selected elements.
+            auto const sign_bits = vandq_u32(_make_mask<Mask>(), vdupq_n_u32(0x8000'0000));
+            return Si(veorq_u32(Li(a), sign_bits));
+        }
+    }
+
+    [[nodiscard]] hi_force_inline static array_type inv(array_type a) noexcept
+    {
+        return Si(vmvnq_u32(Li(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type abs(array_type a) noexcept
+    {
+        return S(vabsq_f32(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type rcp(array_type a) noexcept
+    {
+        // The estimate is only 8 bits, a single Newton-Raphson step makes it
+        // as accurate as the approximation on x86.
+        auto const a_ = L(a);
+        auto const estimate = vrecpeq_f32(a_);
+        return S(vmulq_f32(estimate, vrecpsq_f32(a_, estimate)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sqrt(array_type a) noexcept
+    {
+        return S(vsqrtq_f32(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type rsqrt(array_type a) noexcept
+    {
+        auto const a_ = L(a);
+        auto const estimate = vrsqrteq_f32(a_);
+        return S(vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(a_, estimate), estimate)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type round(array_type a) noexcept
+    {
+        return S(vrndiq_f32(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type floor(array_type a) noexcept
+    {
+        return S(vrndmq_f32(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ceil(array_type a) noexcept
+    {
+        return S(vrndpq_f32(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type add(array_type a, array_type b) noexcept
+    {
+        return S(vaddq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sub(array_type a, array_type b) noexcept
+    {
+        return S(vsubq_f32(L(a), L(b)));
+    }
+
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type addsub_mask(array_type a, array_type b) noexcept
+    {
+        if constexpr (Mask == 0) {
+            return sub(a, b);
+        } else if constexpr (Mask == 0b1111) {
+            return add(a, b);
+        } else {
+            return add(a, neg_mask<~Mask & 0b1111>(b));
+        }
+    }
+
+    [[nodiscard]] hi_force_inline static array_type mul(array_type a, array_type b) noexcept
+    {
+        return S(vmulq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type div(array_type a, array_type b) noexcept
+    {
+        return S(vdivq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type eq(array_type a, array_type b) noexcept
+    {
+        return Si(vceqq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ne(array_type a, array_type b) noexcept
+    {
+        return Si(vmvnq_u32(vceqq_f32(L(a), L(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type lt(array_type a, array_type b) noexcept
+    {
+        return Si(vcltq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gt(array_type a, array_type b) noexcept
+    {
+        return Si(vcgtq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type le(array_type a, array_type b) noexcept
+    {
+        return Si(vcleq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ge(array_type a, array_type b) noexcept
+    {
+        return Si(vcgeq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static bool test(array_type a, array_type b) noexcept
+    {
+        return vmaxvq_u32(vandq_u32(Li(a), Li(b))) == 0;
+    }
+
+    [[nodiscard]] hi_force_inline static array_type max(array_type a, array_type b) noexcept
+    {
+        return S(vmaxq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type min(array_type a, array_type b) noexcept
+    {
+        return S(vminq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type clamp(array_type v, array_type lo, array_type hi) noexcept
+    {
+        return S(vminq_f32(vmaxq_f32(L(v), L(lo)), L(hi)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _or(array_type a, array_type b) noexcept
+    {
+        return Si(vorrq_u32(Li(a), Li(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _and(array_type a, array_type b) noexcept
+    {
+        return Si(vandq_u32(Li(a), Li(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _xor(array_type a, array_type b) noexcept
+    {
+        return Si(veorq_u32(Li(a), Li(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type andnot(array_type a, array_type b) noexcept
+    {
+        return Si(vbicq_u32(Li(b), Li(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sll(array_type a, unsigned int b) noexcept
+    {
+        return Si(vshlq_u32(Li(a), vdupq_n_s32(static_cast<int32_t>(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type srl(array_type a, unsigned int b) noexcept
+    {
+        // A negative shift-left is a shift-right.
+        return Si(vshlq_u32(Li(a), vdupq_n_s32(-static_cast<int32_t>(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sra(array_type a, unsigned int b) noexcept
+    {
+        auto const a_ = vreinterpretq_s32_f32(L(a));
+        return S(vreinterpretq_f32_s32(vshlq_s32(a_, vdupq_n_s32(-static_cast<int32_t>(b)))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hadd(array_type a, array_type b) noexcept
+    {
+        return S(vpaddq_f32(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hsub(array_type a, array_type b) noexcept
+    {
+        auto const a_ = L(a);
+        auto const b_ = L(b);
+        return S(vsubq_f32(vuzp1q_f32(a_, b_), vuzp2q_f32(a_, b_)));
+    }
+
+    template<int... Indices>
+    [[nodiscard]] constexpr static std::array<uint8_t, 16> _make_indices_table() noexcept
+    {
+        static_assert(sizeof...(Indices) == 4);
+
+        constexpr auto indices = std::array{Indices...};
+        auto r = std::array<uint8_t, 16>{};
+        for (size_t i = 0; i != 4; ++i) {
+            auto const index = indices[i] < 0 ? i : static_cast<size_t>(indices[i]);
+            for (size_t j = 0; j != 4; ++j) {
+                r[i * 4 + j] = static_cast<uint8_t>(index * 4 + j);
+            }
+        }
+        return r;
+    }
+
+    template<int... Indices>
+    [[nodiscard]] hi_force_inline static array_type shuffle(array_type a) noexcept
+    {
+        constexpr auto table = _make_indices_table<Indices...>();
+        auto const a_ = vreinterpretq_u8_f32(L(a));
+        return S(vreinterpretq_f32_u8(vqtbl1q_u8(a_, vld1q_u8(table.data()))));
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type blend(array_type a, array_type b) noexcept
+    {
+        return S(vbslq_f32(_make_mask<Mask>(), L(b), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static std::array<array_type, 4> transpose(array_type a, array_type b, array_type c, array_type d)
+    {
+        auto const ab_02 = vreinterpretq_f64_f32(vtrn1q_f32(L(a), L(b)));
+        auto const ab_13 = vreinterpretq_f64_f32(vtrn2q_f32(L(a), L(b)));
+        auto const cd_02 = vreinterpretq_f64_f32(vtrn1q_f32(L(c), L(d)));
+        auto const cd_13 = vreinterpretq_f64_f32(vtrn2q_f32(L(c), L(d)));
+        return {
+            S(vreinterpretq_f32_f64(vtrn1q_f64(ab_02, cd_02))),
+            S(vreinterpretq_f32_f64(vtrn1q_f64(ab_13, cd_13))),
+            S(vreinterpretq_f32_f64(vtrn2q_f64(ab_02, cd_02))),
+            S(vreinterpretq_f32_f64(vtrn2q_f64(ab_13, cd_13)))};
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sum(array_type a) noexcept
+    {
+        return S(vdupq_n_f32(vaddvq_f32(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmin(array_type a) noexcept
+    {
+        return S(vdupq_n_f32(vminvq_f32(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmax(array_type a) noexcept
+    {
+        return S(vdupq_n_f32(vmaxvq_f32(L(a))));
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type dot(array_type a, array_type b) noexcept
+    {
+        auto const multiplied = vandq_u32(_make_mask<Mask>(), vreinterpretq_u32_f32(vmulq_f32(L(a), L(b))));
+        return S(vdupq_n_f32(vaddvq_f32(vreinterpretq_f32_u32(multiplied))));
+    }
+};
+#endif
+
+} // namespace v1
+} // namespace v1
@@ -0,0 +1,398 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "array_intrinsic.hpp"
+#include "macros.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <limits>
+
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#include <pmmintrin.h>
+#include <tmmintrin.h>
+#include <smmintrin.h>
+#include <nmmintrin.h>
+#include <immintrin.h>
+
+hi_export_module(hikocpu : array_intrinsic_f32x8);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+#if defined(HI_HAS_AVX)
+template<>
+struct array_intrinsic<float, 8> {
+    using value_type = float;
+    using register_type = __m256;
+    using array_type = std::array<float, 8>;
+
+    /** Load an array into a register.
+     */
+    [[nodiscard]] hi_force_inline static register_type L(array_type a) noexcept
+    {
+        return _mm256_loadu_ps(a.data());
+    }
+
+    /** Store a register into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type S(register_type a) noexcept
+    {
+        auto r = array_type{};
+        _mm256_storeu_ps(r.data(), a);
+        return r;
+    }
+
+#if defined(HI_HAS_AVX2)
+    /** Make a register with all ones in the elements selected by the mask.
+     */
+    [[nodiscard]] hi_force_inline static __m256i _mask_register(std::size_t mask) noexcept
+    {
+        auto const bits = _mm256_set_epi32(0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+        auto const mask_ = _mm256_set1_epi32(static_cast<int32_t>(mask));
+        return _mm256_cmpeq_epi32(_mm256_and_si256(mask_, bits), bits);
+    }
+#endif
+
+    [[nodiscard]] hi_force_inline static array_type undefined() noexcept
+    {
+        return S(_mm256_undefined_ps());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type
+    set(float a, float b, float c, float d, float e, float f, float g, float h) noexcept
+    {
+        return S(_mm256_set_ps(h, g, f, e, d, c, b, a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set(float a) noexcept
+    {
+        return S(_mm256_set_ps(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_zero() noexcept
+    {
+        return S(_mm256_setzero_ps());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_all_ones() noexcept
+    {
+        return S(_mm256_cmp_ps(_mm256_setzero_ps(), _mm256_setzero_ps(), _CMP_EQ_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_one() noexcept
+    {
+        return S(_mm256_set1_ps(1.0f));
+    }
+
+    template<size_t I>
+    [[nodiscard]] hi_force_inline static float get(array_type a) noexcept
+    {
+        static_assert(I < 8);
+
+        if constexpr (I == 0) {
+            return _mm256_cvtss_f32(L(a));
+        } else {
+            auto const tmp = _mm256_extractf128_ps(L(a), I / 4);
+            if constexpr (I % 4 == 0) {
+                return _mm_cvtss_f32(tmp);
+            } else {
+                return _mm_cvtss_f32(_mm_shuffle_ps(tmp, tmp, I % 4));
+            }
+        }
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(float a) noexcept
+    {
+        return S(_mm256_set1_ps(a));
+    }
+
+#if defined(HI_HAS_AVX2)
+    [[nodiscard]] hi_force_inline static array_type broadcast(array_type a) noexcept
+    {
+        return S(_mm256_broadcastss_ps(_mm256_castps256_ps128(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_mask(std::size_t mask) noexcept
+    {
+        return S(_mm256_castsi256_ps(_mask_register(mask)));
+    }
+#endif
+
+    /** Store a register as a mask-integer.
+     */
+    [[nodiscard]] hi_force_inline static std::size_t get_mask(array_type a) noexcept
+    {
+        return _mm256_movemask_ps(L(a));
+    }
+
+#if defined(HI_HAS_AVX2)
+    [[nodiscard]] hi_force_inline static array_type masked_load(float const *ptr, std::size_t mask) noexcept
+    {
+        return S(_mm256_maskload_ps(ptr, _mask_register(mask)));
+    }
+
+    hi_force_inline static void masked_store(float *ptr, array_type a, std::size_t mask) noexcept
+    {
+        _mm256_maskstore_ps(ptr, _mask_register(mask), L(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gather(float const *ptr, std::array<int32_t, 8> indices) noexcept
+    {
+        auto const indices_ = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(indices.data()));
+        return S(_mm256_i32gather_ps(ptr, indices_, sizeof(float)));
+    }
+#endif
+
+    [[nodiscard]] hi_force_inline static array_type neg(array_type a) noexcept
+    {
+        return S(_mm256_sub_ps(_mm256_setzero_ps(), L(a)));
+    }
+
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline constexpr static array_type neg_mask(array_type a) noexcept
+    {
+        if constexpr (Mask == 0) {
+            return a;
+        } else if constexpr (Mask == 0b1111'1111) {
+            return S(_mm256_sub_ps(_mm256_setzero_ps(), L(a)));
+        } else if constexpr (Mask == 0b0101'0101) {
+            return S(_mm256_addsub_ps(_mm256_setzero_ps(), L(a)));
+        } else {
+            auto const tmp = _mm256_sub_ps(_mm256_setzero_ps(), L(a));
+            return blend<Mask>(a, S(tmp));
+        }
+    }
+
+    [[nodiscard]] hi_force_inline static array_type inv(array_type a) noexcept
+    {
+        return _xor(set_all_ones(), a);
+    }
+
+    [[nodiscard]] hi_force_inline static array_type rcp(array_type a) noexcept
+    {
+        return S(_mm256_rcp_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sqrt(array_type a) noexcept
+    {
+        return S(_mm256_sqrt_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type rsqrt(array_type a) noexcept
+    {
+        return S(_mm256_rsqrt_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type round(array_type a) noexcept
+    {
+        return S(_mm256_round_ps(L(a), _MM_FROUND_CUR_DIRECTION));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type floor(array_type a) noexcept
+    {
+        return S(_mm256_floor_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ceil(array_type a) noexcept
+    {
+        return S(_mm256_ceil_ps(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type add(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_add_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sub(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_sub_ps(L(a), L(b)));
+    }
+
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline constexpr static array_type addsub_mask(array_type a, array_type b) noexcept
+    {
+        if constexpr (Mask == 0) {
+            return sub(a, b);
+        } else if constexpr (Mask == 0b1111'1111) {
+            return add(a, b);
+        } else if constexpr (Mask == 0b1010'1010) {
+            return S(_mm256_addsub_ps(L(a), L(b)));
+        } else {
+            return blend<Mask>(sub(a, b), add(a, b));
+        }
+    }
+
+    [[nodiscard]] hi_force_inline static array_type mul(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_mul_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type div(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_div_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type eq(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmp_ps(L(a), L(b), _CMP_EQ_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ne(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmp_ps(L(a), L(b), _CMP_NEQ_UQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type lt(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmp_ps(L(a), L(b), _CMP_LT_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gt(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmp_ps(L(a), L(b), _CMP_GT_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type le(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmp_ps(L(a), L(b), _CMP_LE_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ge(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmp_ps(L(a), L(b), _CMP_GE_OQ));
+    }
+
+    [[nodiscard]] hi_force_inline static bool test(array_type a, array_type b) noexcept
+    {
+        return static_cast<bool>(_mm256_testz_si256(_mm256_castps_si256(L(a)), _mm256_castps_si256(L(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type max(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_max_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type min(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_min_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type clamp(array_type v, array_type lo, array_type hi) noexcept
+    {
+        return S(_mm256_min_ps(_mm256_max_ps(L(v), L(lo)), L(hi)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _or(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_or_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _and(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_and_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _xor(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_xor_ps(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type andnot(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_andnot_ps(L(a), L(b)));
+    }
+
+#if defined(HI_HAS_AVX2)
+    [[nodiscard]] hi_force_inline static array_type sll(array_type a, unsigned int b) noexcept
+    {
+        auto const b_ = _mm_set_epi32(0, 0, 0, b);
+        return S(_mm256_castsi256_ps(_mm256_sll_epi32(_mm256_castps_si256(L(a)), b_)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type srl(array_type a, unsigned int b) noexcept
+    {
+        auto const b_ = _mm_set_epi32(0, 0, 0, b);
+        return S(_mm256_castsi256_ps(_mm256_srl_epi32(_mm256_castps_si256(L(a)), b_)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sra(array_type a, unsigned int b) noexcept
+    {
+        auto const b_ = _mm_set_epi32(0, 0, 0, b);
+        return S(_mm256_castsi256_ps(_mm256_sra_epi32(_mm256_castps_si256(L(a)), b_)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hadd(array_type a, array_type b) noexcept
+    {
+        // _mm256_hadd_ps() works on each 128-bit lane, reorder the 64-bit results
+        // so that the sums of @a a are followed by the sums of @a b.
+        auto const tmp = _mm256_castps_pd(_mm256_hadd_ps(L(a), L(b)));
+        return S(_mm256_castpd_ps(_mm256_permute4x64_pd(tmp, 0b11'01'10'00)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hsub(array_type a, array_type b) noexcept
+    {
+        auto const tmp = _mm256_castps_pd(_mm256_hsub_ps(L(a), L(b)));
+        return S(_mm256_castpd_ps(_mm256_permute4x64_pd(tmp, 0b11'01'10'00)));
+    }
+
+    template<int... Indices>
+    [[nodiscard]] hi_force_inline static array_type shuffle(array_type a) noexcept
+    {
+        static_assert(sizeof...(Indices) == 8);
+
+        constexpr auto indices = std::array{Indices...};
+        auto const indices_ = _mm256_set_epi32(
+            indices[7] < 0 ? 7 : indices[7],
+            indices[6] < 0 ? 6 : indices[6],
+            indices[5] < 0 ? 5 : indices[5],
+            indices[4] < 0 ? 4 : indices[4],
+            indices[3] < 0 ? 3 : indices[3],
+            indices[2] < 0 ? 2 : indices[2],
+            indices[1] < 0 ? 1 : indices[1],
+            indices[0] < 0 ? 0 : indices[0]);
+        return S(_mm256_permutevar8x32_ps(L(a), indices_));
+    }
+#endif
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type blend(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_blend_ps(L(a), L(b), Mask));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sum(array_type a) noexcept
+    {
+        auto const a_ = L(a);
+        auto const lo_hi = _mm_add_ps(_mm256_castps256_ps128(a_), _mm256_extractf128_ps(a_, 1));
+        auto const tmp = _mm_add_ps(lo_hi, _mm_movehl_ps(lo_hi, lo_hi));
+        auto const r = _mm_add_ss(tmp, _mm_shuffle_ps(tmp, tmp, 0b01));
+        return broadcast(_mm_cvtss_f32(r));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmin(array_type a) noexcept
+    {
+        auto const a_ = L(a);
+        auto const lo_hi = _mm_min_ps(_mm256_castps256_ps128(a_), _mm256_extractf128_ps(a_, 1));
+        auto const tmp = _mm_min_ps(lo_hi, _mm_movehl_ps(lo_hi, lo_hi));
+        auto const r = _mm_min_ss(tmp, _mm_shuffle_ps(tmp, tmp, 0b01));
+        return broadcast(_mm_cvtss_f32(r));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmax(array_type a) noexcept
+    {
+        auto const a_ = L(a);
+        auto const lo_hi = _mm_max_ps(_mm256_castps256_ps128(a_), _mm256_extractf128_ps(a_, 1));
+        auto const tmp = _mm_max_ps(lo_hi, _mm_movehl_ps(lo_hi, lo_hi));
+        auto const r = _mm_max_ss(tmp, _mm_shuffle_ps(tmp, tmp, 0b01));
+        return broadcast(_mm_cvtss_f32(r));
+    }
+};
+#endif
+
+} // namespace v1
+} // namespace v1
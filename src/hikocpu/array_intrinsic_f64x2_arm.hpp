@@ -0,0 +1,350 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "array_intrinsic.hpp"
+#include "macros.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include <arm_neon.h>
+
+hi_export_module(hikocpu : array_intrinsic_f64x2);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+// Double precision vectors are only available on AArch64.
+#if defined(HI_HAS_NEON) and defined(HI_HAS_ARM64)
+template<>
+struct array_intrinsic<double, 2> {
+    using value_type = double;
+    using register_type = float64x2_t;
+    using array_type = std::array<double, 2>;
+
+    /** Load an array into a register.
+     */
+    [[nodiscard]] hi_force_inline static register_type L(array_type a) noexcept
+    {
+        return vld1q_f64(a.data());
+    }
+
+    /** Store a register into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type S(register_type a) noexcept
+    {
+        auto r = array_type{};
+        vst1q_f64(r.data(), a);
+        return r;
+    }
+
+    /** Load an array into a register as 64-bit integers.
+     */
+    [[nodiscard]] hi_force_inline static uint64x2_t Li(array_type a) noexcept
+    {
+        return vreinterpretq_u64_f64(L(a));
+    }
+
+    /** Store a register of 64-bit integers into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type Si(uint64x2_t a) noexcept
+    {
+        return S(vreinterpretq_f64_u64(a));
+    }
+
+    /** Make a lane mask from a compile-time bit-mask.
+     */
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline static uint64x2_t _make_mask() noexcept
+    {
+        constexpr auto mask = std::array<uint64_t, 2>{
+            Mask & 0b01 ? 0xffff'ffff'ffff'ffff : 0, Mask & 0b10 ? 0xffff'ffff'ffff'ffff : 0};
+        return vld1q_u64(mask.data());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set(double a) noexcept
+    {
+        return S(vsetq_lane_f64(a, vdupq_n_f64(0.0), 0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_zero() noexcept
+    {
+        return S(vdupq_n_f64(0.0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_all_ones() noexcept
+    {
+        return Si(vdupq_n_u64(0xffff'ffff'ffff'ffff));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_one() noexcept
+    {
+        return S(vdupq_n_f64(1.0));
+    }
+
+    template<size_t I>
+    [[nodiscard]] hi_force_inline static double get(array_type a) noexcept
+    {
+        static_assert(I < 2);
+        return vgetq_lane_f64(L(a), I);
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(double a) noexcept
+    {
+        return S(vdupq_n_f64(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(array_type a) noexcept
+    {
+        return S(vdupq_laneq_f64(L(a), 0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_mask(std::size_t mask) noexcept
+    {
+        constexpr auto bits = std::array<uint64_t, 2>{1, 2};
+        return Si(vtstq_u64(vdupq_n_u64(mask), vld1q_u64(bits.data())));
+    }
+
+    /** Store a register as a mask-integer.
+     */
+    [[nodiscard]] hi_force_inline static std::size_t get_mask(array_type a) noexcept
+    {
+        auto const top_bits = vshrq_n_u64(Li(a), 63);
+        return vgetq_lane_u64(top_bits, 0) | (vgetq_lane_u64(top_bits, 1) << 1);
+    }
+
+    [[nodiscard]] hi_force_inline static array_type neg(array_type a) noexcept
+    {
+        return S(vnegq_f64(L(a)));
+    }
+
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type neg_mask(array_type a) noexcept
+    {
+        if constexpr (Mask == 0) {
+            return a;
+        } else if constexpr (Mask == 0b11) {
+            return neg(a);
+        } else {
+            // Flip the sign-bit of the selected elements.
+            auto const sign_bits = vandq_u64(_make_mask<Mask>(), vdupq_n_u64(0x8000'0000'0000'0000));
+            return Si(veorq_u64(Li(a), sign_bits));
+        }
+    }
+
+    [[nodiscard]] hi_force_inline static array_type inv(array_type a) noexcept
+    {
+        return Si(veorq_u64(Li(a), vdupq_n_u64(0xffff'ffff'ffff'ffff)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type abs(array_type a) noexcept
+    {
+        return S(vabsq_f64(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sqrt(array_type a) noexcept
+    {
+        return S(vsqrtq_f64(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type round(array_type a) noexcept
+    {
+        return S(vrndiq_f64(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type floor(array_type a) noexcept
+    {
+        return S(vrndmq_f64(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ceil(array_type a) noexcept
+    {
+        return S(vrndpq_f64(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type add(array_type a, array_type b) noexcept
+    {
+        return S(vaddq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sub(array_type a, array_type b) noexcept
+    {
+        return S(vsubq_f64(L(a), L(b)));
+    }
+
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type addsub_mask(array_type a, array_type b) noexcept
+    {
+        if constexpr (Mask == 0) {
+            return sub(a, b);
+        } else if constexpr (Mask == 0b11) {
+            return add(a, b);
+        } else {
+            return add(a, neg_mask<~Mask & 0b11>(b));
+        }
+    }
+
+    [[nodiscard]] hi_force_inline static array_type mul(array_type a, array_type b) noexcept
+    {
+        return S(vmulq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type div(array_type a, array_type b) noexcept
+    {
+        return S(vdivq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type eq(array_type a, array_type b) noexcept
+    {
+        return Si(vceqq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ne(array_type a, array_type b) noexcept
+    {
+        return inv(eq(a, b));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type lt(array_type a, array_type b) noexcept
+    {
+        return Si(vcltq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gt(array_type a, array_type b) noexcept
+    {
+        return Si(vcgtq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type le(array_type a, array_type b) noexcept
+    {
+        return Si(vcleq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ge(array_type a, array_type b) noexcept
+    {
+        return Si(vcgeq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static bool test(array_type a, array_type b) noexcept
+    {
+        auto const tmp = vreinterpretq_u32_u64(vandq_u64(Li(a), Li(b)));
+        return vmaxvq_u32(tmp) == 0;
+    }
+
+    [[nodiscard]] hi_force_inline static array_type max(array_type a, array_type b) noexcept
+    {
+        return S(vmaxq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type min(array_type a, array_type b) noexcept
+    {
+        return S(vminq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type clamp(array_type v, array_type lo, array_type hi) noexcept
+    {
+        return S(vminq_f64(vmaxq_f64(L(v), L(lo)), L(hi)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _or(array_type a, array_type b) noexcept
+    {
+        return Si(vorrq_u64(Li(a), Li(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _and(array_type a, array_type b) noexcept
+    {
+        return Si(vandq_u64(Li(a), Li(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _xor(array_type a, array_type b) noexcept
+    {
+        return Si(veorq_u64(Li(a), Li(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type andnot(array_type a, array_type b) noexcept
+    {
+        return Si(vbicq_u64(Li(b), Li(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sll(array_type a, unsigned int b) noexcept
+    {
+        return Si(vshlq_u64(Li(a), vdupq_n_s64(static_cast<int64_t>(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type srl(array_type a, unsigned int b) noexcept
+    {
+        // A negative shift-left is a shift-right.
+        return Si(vshlq_u64(Li(a), vdupq_n_s64(-static_cast<int64_t>(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sra(array_type a, unsigned int b) noexcept
+    {
+        auto const a_ = vreinterpretq_s64_f64(L(a));
+        return S(vreinterpretq_f64_s64(vshlq_s64(a_, vdupq_n_s64(-static_cast<int64_t>(b)))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hadd(array_type a, array_type b) noexcept
+    {
+        return S(vpaddq_f64(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hsub(array_type a, array_type b) noexcept
+    {
+        auto const a_ = L(a);
+        auto const b_ = L(b);
+        return S(vsubq_f64(vzip1q_f64(a_, b_), vzip2q_f64(a_, b_)));
+    }
+
+    template<int... Indices>
+    [[nodiscard]] hi_force_inline static array_type shuffle(array_type a) noexcept
+    {
+        static_assert(sizeof...(Indices) == 2);
+
+        constexpr auto indices = std::array{Indices...};
+        constexpr auto index0 = indices[0] < 0 ? 0 : indices[0];
+        constexpr auto index1 = indices[1] < 0 ? 1 : indices[1];
+
+        auto const a_ = L(a);
+        if constexpr (index0 == 0 and index1 == 1) {
+            return a;
+        } else if constexpr (index0 == 1 and index1 == 0) {
+            return S(vextq_f64(a_, a_, 1));
+        } else {
+            return S(vdupq_laneq_f64(a_, index0));
+        }
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type blend(array_type a, array_type b) noexcept
+    {
+        return S(vbslq_f64(_make_mask<Mask>(), L(b), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sum(array_type a) noexcept
+    {
+        return S(vdupq_n_f64(vaddvq_f64(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmin(array_type a) noexcept
+    {
+        return S(vdupq_n_f64(vminvq_f64(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmax(array_type a) noexcept
+    {
+        return S(vdupq_n_f64(vmaxvq_f64(L(a))));
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type dot(array_type a, array_type b) noexcept
+    {
+        auto const multiplied = vandq_u64(_make_mask<Mask>(), vreinterpretq_u64_f64(vmulq_f64(L(a), L(b))));
+        return S(vdupq_n_f64(vaddvq_f64(vreinterpretq_f64_u64(multiplied))));
+    }
+};
+#endif
+
+} // namespace v1
+} // namespace v1
@@ -0,0 +1,300 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "array_intrinsic.hpp"
+#include "macros.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include <arm_neon.h>
+
+hi_export_module(hikocpu : array_intrinsic_i16x8);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+#if defined(HI_HAS_NEON) and defined(HI_HAS_ARM64)
+template<>
+struct array_intrinsic<int16_t, 8> {
+    using value_type = int16_t;
+    using register_type = int16x8_t;
+    using array_type = std::array<int16_t, 8>;
+
+    /** Load an array into a register.
+     */
+    [[nodiscard]] hi_force_inline static register_type L(array_type a) noexcept
+    {
+        return vld1q_s16(a.data());
+    }
+
+    /** Store a register into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type S(register_type a) noexcept
+    {
+        auto r = array_type{};
+        vst1q_s16(r.data(), a);
+        return r;
+    }
+
+    /** Load an array into a register as unsigned integers.
+     */
+    [[nodiscard]] hi_force_inline static uint16x8_t Li(array_type a) noexcept
+    {
+        return vreinterpretq_u16_s16(L(a));
+    }
+
+    /** Store a register of unsigned integers into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type Si(uint16x8_t a) noexcept
+    {
+        return S(vreinterpretq_s16_u16(a));
+    }
+
+    /** Make a lane mask from a compile-time bit-mask.
+     */
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline static uint16x8_t _make_mask() noexcept
+    {
+        constexpr auto mask = [] {
+            auto r = std::array<uint16_t, 8>{};
+            for (std::size_t i = 0; i != 8; ++i) {
+                r[i] = (Mask >> i) & 1 ? uint16_t{0xffff} : uint16_t{0};
+            }
+            return r;
+        }();
+        return vld1q_u16(mask.data());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set(int16_t a) noexcept
+    {
+        return S(vsetq_lane_s16(a, vdupq_n_s16(0), 0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_zero() noexcept
+    {
+        return S(vdupq_n_s16(0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_all_ones() noexcept
+    {
+        return Si(vdupq_n_u16(0xffff));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_one() noexcept
+    {
+        return S(vdupq_n_s16(1));
+    }
+
+    template<size_t I>
+    [[nodiscard]] hi_force_inline static int16_t get(array_type a) noexcept
+    {
+        static_assert(I < 8);
+        return vgetq_lane_s16(L(a), I);
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(int16_t a) noexcept
+    {
+        return S(vdupq_n_s16(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(array_type a) noexcept
+    {
+        return S(vdupq_laneq_s16(L(a), 0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_mask(std::size_t mask) noexcept
+    {
+        constexpr auto bits = std::array<uint16_t, 8>{1, 2, 4, 8, 16, 32, 64, 128};
+        return Si(vtstq_u16(vdupq_n_u16(static_cast<uint16_t>(mask)), vld1q_u16(bits.data())));
+    }
+
+    /** Store a register as a mask-integer.
+     */
+    [[nodiscard]] hi_force_inline static std::size_t get_mask(array_type a) noexcept
+    {
+        constexpr auto shifts = std::array<int16_t, 8>{0, 1, 2, 3, 4, 5, 6, 7};
+        auto const top_bits = vshrq_n_u16(Li(a), 15);
+        return vaddvq_u16(vshlq_u16(top_bits, vld1q_s16(shifts.data())));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type neg(array_type a) noexcept
+    {
+        return S(vnegq_s16(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type inv(array_type a) noexcept
+    {
+        return S(vmvnq_s16(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type abs(array_type a) noexcept
+    {
+        return S(vabsq_s16(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type add(array_type a, array_type b) noexcept
+    {
+        return S(vaddq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sub(array_type a, array_type b) noexcept
+    {
+        return S(vsubq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type mul(array_type a, array_type b) noexcept
+    {
+        return S(vmulq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type eq(array_type a, array_type b) noexcept
+    {
+        return Si(vceqq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ne(array_type a, array_type b) noexcept
+    {
+        return Si(vmvnq_u16(vceqq_s16(L(a), L(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type lt(array_type a, array_type b) noexcept
+    {
+        return Si(vcltq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gt(array_type a, array_type b) noexcept
+    {
+        return Si(vcgtq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type le(array_type a, array_type b) noexcept
+    {
+        return Si(vcleq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ge(array_type a, array_type b) noexcept
+    {
+        return Si(vcgeq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static bool test(array_type a, array_type b) noexcept
+    {
+        return vmaxvq_u32(vreinterpretq_u32_u16(vandq_u16(Li(a), Li(b)))) == 0;
+    }
+
+    [[nodiscard]] hi_force_inline static array_type max(array_type a, array_type b) noexcept
+    {
+        return S(vmaxq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type min(array_type a, array_type b) noexcept
+    {
+        return S(vminq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type clamp(array_type v, array_type lo, array_type hi) noexcept
+    {
+        return S(vminq_s16(vmaxq_s16(L(v), L(lo)), L(hi)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _or(array_type a, array_type b) noexcept
+    {
+        return S(vorrq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _and(array_type a, array_type b) noexcept
+    {
+        return S(vandq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _xor(array_type a, array_type b) noexcept
+    {
+        return S(veorq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type andnot(array_type a, array_type b) noexcept
+    {
+        return S(vbicq_s16(L(b), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sll(array_type a, unsigned int b) noexcept
+    {
+        return S(vshlq_s16(L(a), vdupq_n_s16(static_cast<int16_t>(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type srl(array_type a, unsigned int b) noexcept
+    {
+        // A negative shift-left is a shift-right.
+        return Si(vshlq_u16(Li(a), vdupq_n_s16(static_cast<int16_t>(-static_cast<int>(b)))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sra(array_type a, unsigned int b) noexcept
+    {
+        return S(vshlq_s16(L(a), vdupq_n_s16(static_cast<int16_t>(-static_cast<int>(b)))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hadd(array_type a, array_type b) noexcept
+    {
+        return S(vpaddq_s16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hsub(array_type a, array_type b) noexcept
+    {
+        auto const a_ = L(a);
+        auto const b_ = L(b);
+        return S(vsubq_s16(vuzp1q_s16(a_, b_), vuzp2q_s16(a_, b_)));
+    }
+
+    template<int... Indices>
+    [[nodiscard]] constexpr static std::array<uint8_t, 16> _make_indices_table() noexcept
+    {
+        static_assert(sizeof...(Indices) == 8);
+
+        constexpr auto indices = std::array{Indices...};
+        auto r = std::array<uint8_t, 16>{};
+        for (size_t i = 0; i != 8; ++i) {
+            auto const index = indices[i] < 0 ? i : static_cast<size_t>(indices[i]);
+            for (size_t j = 0; j != 2; ++j) {
+                r[i * 2 + j] = static_cast<uint8_t>(index * 2 + j);
+            }
+        }
+        return r;
+    }
+
+    template<int... Indices>
+    [[nodiscard]] hi_force_inline static array_type shuffle(array_type a) noexcept
+    {
+        constexpr auto table = _make_indices_table<Indices...>();
+        auto const a_ = vreinterpretq_u8_s16(L(a));
+        return S(vreinterpretq_s16_u8(vqtbl1q_u8(a_, vld1q_u8(table.data()))));
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type blend(array_type a, array_type b) noexcept
+    {
+        return S(vbslq_s16(_make_mask<Mask>(), L(b), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sum(array_type a) noexcept
+    {
+        return S(vdupq_n_s16(vaddvq_s16(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmin(array_type a) noexcept
+    {
+        return S(vdupq_n_s16(vminvq_s16(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmax(array_type a) noexcept
+    {
+        return S(vdupq_n_s16(vmaxvq_s16(L(a))));
+    }
+};
+#endif
+
+} // namespace v1
+} // namespace v1
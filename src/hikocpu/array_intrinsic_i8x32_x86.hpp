@@ -0,0 +1,242 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "array_intrinsic.hpp"
+#include "macros.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include <immintrin.h>
+
+hi_export_module(hikocpu : array_intrinsic_i8x32);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+#if defined(HI_HAS_AVX2)
+template<>
+struct array_intrinsic<int8_t, 32> {
+    using value_type = int8_t;
+    using register_type = __m256i;
+    using array_type = std::array<int8_t, 32>;
+
+    /** Load an array into a register.
+     */
+    [[nodiscard]] hi_force_inline static register_type L(array_type a) noexcept
+    {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(a.data()));
+    }
+
+    /** Store a register into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type S(register_type a) noexcept
+    {
+        auto r = array_type{};
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(r.data()), a);
+        return r;
+    }
+
+    [[nodiscard]] hi_force_inline static array_type undefined() noexcept
+    {
+        return S(_mm256_undefined_si256());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set(int8_t a) noexcept
+    {
+        return S(_mm256_zextsi128_si256(_mm_cvtsi32_si128(static_cast<uint8_t>(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_zero() noexcept
+    {
+        return S(_mm256_setzero_si256());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_all_ones() noexcept
+    {
+        return S(_mm256_cmpeq_epi8(_mm256_setzero_si256(), _mm256_setzero_si256()));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_one() noexcept
+    {
+        return S(_mm256_set1_epi8(1));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(int8_t a) noexcept
+    {
+        return S(_mm256_set1_epi8(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(array_type a) noexcept
+    {
+        return S(_mm256_broadcastb_epi8(_mm256_castsi256_si128(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_mask(std::size_t mask) noexcept
+    {
+        // Copy each byte of the mask to the 8 elements it selects, then test a different bit in each element.
+        auto const mask_ = _mm256_set1_epi32(static_cast<int32_t>(mask));
+        auto const select = _mm256_setr_epi8(
+            0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+        auto const bits = _mm256_set1_epi64x(0x8040'2010'0804'0201);
+        return S(_mm256_cmpeq_epi8(_mm256_and_si256(_mm256_shuffle_epi8(mask_, select), bits), bits));
+    }
+
+    /** Store a register as a mask-integer.
+     */
+    [[nodiscard]] hi_force_inline static std::size_t get_mask(array_type a) noexcept
+    {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(L(a)));
+    }
+
+#if defined(HI_HAS_AVX512BW) and defined(HI_HAS_AVX512VL)
+    [[nodiscard]] hi_force_inline static array_type masked_load(int8_t const *ptr, std::size_t mask) noexcept
+    {
+        return S(_mm256_maskz_loadu_epi8(static_cast<__mmask32>(mask), ptr));
+    }
+
+    hi_force_inline static void masked_store(int8_t *ptr, array_type a, std::size_t mask) noexcept
+    {
+        _mm256_mask_storeu_epi8(ptr, static_cast<__mmask32>(mask), L(a));
+    }
+#endif
+
+    [[nodiscard]] hi_force_inline static array_type neg(array_type a) noexcept
+    {
+        return S(_mm256_sub_epi8(_mm256_setzero_si256(), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type inv(array_type a) noexcept
+    {
+        return _xor(set_all_ones(), a);
+    }
+
+    [[nodiscard]] hi_force_inline static array_type abs(array_type a) noexcept
+    {
+        return S(_mm256_abs_epi8(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type add(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_add_epi8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sub(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_sub_epi8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type eq(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmpeq_epi8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ne(array_type a, array_type b) noexcept
+    {
+        return inv(eq(a, b));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type lt(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmpgt_epi8(L(b), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gt(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmpgt_epi8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type le(array_type a, array_type b) noexcept
+    {
+        return inv(gt(a, b));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ge(array_type a, array_type b) noexcept
+    {
+        return inv(lt(a, b));
+    }
+
+    [[nodiscard]] hi_force_inline static bool test(array_type a, array_type b) noexcept
+    {
+        return static_cast<bool>(_mm256_testz_si256(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type max(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_max_epi8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type min(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_min_epi8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type clamp(array_type v, array_type lo, array_type hi) noexcept
+    {
+        return S(_mm256_min_epi8(_mm256_max_epi8(L(v), L(lo)), L(hi)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _or(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_or_si256(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _and(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_and_si256(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _xor(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_xor_si256(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type andnot(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_andnot_si256(L(a), L(b)));
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type blend(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_blendv_epi8(L(a), L(b), L(set_mask(Mask))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sum(array_type a) noexcept
+    {
+        // The sum of the unsigned bytes modulo 256 is the same as the sum of the signed bytes.
+        auto const sums = _mm256_sad_epu8(L(a), _mm256_setzero_si256());
+        auto const tmp = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+        auto const r = _mm_add_epi64(tmp, _mm_unpackhi_epi64(tmp, tmp));
+        return broadcast(static_cast<int8_t>(_mm_cvtsi128_si32(r)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmin(array_type a) noexcept
+    {
+        auto const a_ = L(a);
+        auto tmp = _mm_min_epi8(_mm256_castsi256_si128(a_), _mm256_extracti128_si256(a_, 1));
+        tmp = _mm_min_epi8(tmp, _mm_shuffle_epi32(tmp, 0b01'00'11'10));
+        tmp = _mm_min_epi8(tmp, _mm_shuffle_epi32(tmp, 0b10'11'00'01));
+        tmp = _mm_min_epi8(tmp, _mm_srli_epi32(tmp, 16));
+        tmp = _mm_min_epi8(tmp, _mm_srli_epi16(tmp, 8));
+        return S(_mm256_broadcastb_epi8(tmp));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmax(array_type a) noexcept
+    {
+        auto const a_ = L(a);
+        auto tmp = _mm_max_epi8(_mm256_castsi256_si128(a_), _mm256_extracti128_si256(a_, 1));
+        tmp = _mm_max_epi8(tmp, _mm_shuffle_epi32(tmp, 0b01'00'11'10));
+        tmp = _mm_max_epi8(tmp, _mm_shuffle_epi32(tmp, 0b10'11'00'01));
+        tmp = _mm_max_epi8(tmp, _mm_srli_epi32(tmp, 16));
+        tmp = _mm_max_epi8(tmp, _mm_srli_epi16(tmp, 8));
+        return S(_mm256_broadcastb_epi8(tmp));
+    }
+};
+#endif
+
+} // namespace v1
+} // namespace v1
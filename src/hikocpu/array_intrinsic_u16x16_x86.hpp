@@ -0,0 +1,269 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "array_intrinsic.hpp"
+#include "macros.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include <immintrin.h>
+
+hi_export_module(hikocpu : array_intrinsic_u16x16);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+#if defined(HI_HAS_AVX2)
+template<>
+struct array_intrinsic<uint16_t, 16> {
+    using value_type = uint16_t;
+    using register_type = __m256i;
+    using array_type = std::array<uint16_t, 16>;
+
+    /** Load an array into a register.
+     */
+    [[nodiscard]] hi_force_inline static register_type L(array_type a) noexcept
+    {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(a.data()));
+    }
+
+    /** Store a register into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type S(register_type a) noexcept
+    {
+        auto r = array_type{};
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(r.data()), a);
+        return r;
+    }
+
+    /** Flip the top bit, so that unsigned elements can be compared with signed instructions.
+     */
+    [[nodiscard]] hi_force_inline static register_type _to_signed(array_type a) noexcept
+    {
+        return _mm256_xor_si256(L(a), _mm256_set1_epi16(static_cast<int16_t>(0x8000)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type undefined() noexcept
+    {
+        return S(_mm256_undefined_si256());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set(uint16_t a) noexcept
+    {
+        return S(_mm256_zextsi128_si256(_mm_cvtsi32_si128(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_zero() noexcept
+    {
+        return S(_mm256_setzero_si256());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_all_ones() noexcept
+    {
+        return S(_mm256_cmpeq_epi16(_mm256_setzero_si256(), _mm256_setzero_si256()));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_one() noexcept
+    {
+        return S(_mm256_set1_epi16(1));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(uint16_t a) noexcept
+    {
+        return S(_mm256_set1_epi16(static_cast<int16_t>(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(array_type a) noexcept
+    {
+        return S(_mm256_broadcastw_epi16(_mm256_castsi256_si128(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_mask(std::size_t mask) noexcept
+    {
+        // clang-format off
+        auto const bits = _mm256_setr_epi16(
+            0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+            0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, static_cast<int16_t>(0x8000));
+        // clang-format on
+        auto const mask_ = _mm256_set1_epi16(static_cast<int16_t>(mask));
+        return S(_mm256_cmpeq_epi16(_mm256_and_si256(mask_, bits), bits));
+    }
+
+    /** Store a register as a mask-integer.
+     */
+    [[nodiscard]] hi_force_inline static std::size_t get_mask(array_type a) noexcept
+    {
+        // Saturating to bytes keeps the top-bit of each element, the packing is done per 128-bit lane.
+        auto const packed = _mm256_packs_epi16(L(a), _mm256_setzero_si256());
+        auto const ordered = _mm256_permute4x64_epi64(packed, 0b11'01'10'00);
+        return static_cast<uint32_t>(_mm256_movemask_epi8(ordered)) & 0xffff;
+    }
+
+#if defined(HI_HAS_AVX512BW) and defined(HI_HAS_AVX512VL)
+    [[nodiscard]] hi_force_inline static array_type masked_load(uint16_t const *ptr, std::size_t mask) noexcept
+    {
+        return S(_mm256_maskz_loadu_epi16(static_cast<__mmask16>(mask), ptr));
+    }
+
+    hi_force_inline static void masked_store(uint16_t *ptr, array_type a, std::size_t mask) noexcept
+    {
+        _mm256_mask_storeu_epi16(ptr, static_cast<__mmask16>(mask), L(a));
+    }
+#endif
+
+    [[nodiscard]] hi_force_inline static array_type neg(array_type a) noexcept
+    {
+        return S(_mm256_sub_epi16(_mm256_setzero_si256(), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type inv(array_type a) noexcept
+    {
+        return _xor(set_all_ones(), a);
+    }
+
+    [[nodiscard]] hi_force_inline static array_type add(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_add_epi16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sub(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_sub_epi16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type mul(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_mullo_epi16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type eq(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmpeq_epi16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ne(array_type a, array_type b) noexcept
+    {
+        return inv(eq(a, b));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type lt(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmpgt_epi16(_to_signed(b), _to_signed(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gt(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_cmpgt_epi16(_to_signed(a), _to_signed(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type le(array_type a, array_type b) noexcept
+    {
+        return inv(gt(a, b));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ge(array_type a, array_type b) noexcept
+    {
+        return inv(lt(a, b));
+    }
+
+    [[nodiscard]] hi_force_inline static bool test(array_type a, array_type b) noexcept
+    {
+        return static_cast<bool>(_mm256_testz_si256(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type max(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_max_epu16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type min(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_min_epu16(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type clamp(array_type v, array_type lo, array_type hi) noexcept
+    {
+        return S(_mm256_min_epu16(_mm256_max_epu16(L(v), L(lo)), L(hi)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _or(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_or_si256(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _and(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_and_si256(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _xor(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_xor_si256(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type andnot(array_type a, array_type b) noexcept
+    {
+        return S(_mm256_andnot_si256(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sll(array_type a, unsigned int b) noexcept
+    {
+        return S(_mm256_sll_epi16(L(a), _mm_set_epi32(0, 0, 0, b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type srl(array_type a, unsigned int b) noexcept
+    {
+        return S(_mm256_srl_epi16(L(a), _mm_set_epi32(0, 0, 0, b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sra(array_type a, unsigned int b) noexcept
+    {
+        return S(_mm256_sra_epi16(L(a), _mm_set_epi32(0, 0, 0, b)));
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type blend(array_type a, array_type b) noexcept
+    {
+        if constexpr ((Mask & 0xff) == (Mask >> 8)) {
+            // Both 128-bit lanes are blended the same.
+            return S(_mm256_blend_epi16(L(a), L(b), Mask & 0xff));
+        } else {
+            return S(_mm256_blendv_epi8(L(a), L(b), L(set_mask(Mask))));
+        }
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sum(array_type a) noexcept
+    {
+        // The sum modulo 65536 is the same when the elements are treated as signed.
+        auto const sums = _mm256_madd_epi16(L(a), _mm256_set1_epi16(1));
+        auto tmp = _mm_add_epi32(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+        tmp = _mm_add_epi32(tmp, _mm_shuffle_epi32(tmp, 0b01'00'11'10));
+        tmp = _mm_add_epi32(tmp, _mm_shuffle_epi32(tmp, 0b10'11'00'01));
+        return broadcast(static_cast<uint16_t>(_mm_cvtsi128_si32(tmp)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmin(array_type a) noexcept
+    {
+        auto const a_ = L(a);
+        auto const tmp = _mm_min_epu16(_mm256_castsi256_si128(a_), _mm256_extracti128_si256(a_, 1));
+        return S(_mm256_broadcastw_epi16(_mm_minpos_epu16(tmp)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmax(array_type a) noexcept
+    {
+        // The smallest inverted element is the largest element.
+        auto const a_ = L(a);
+        auto const ones = _mm_cmpeq_epi16(_mm_setzero_si128(), _mm_setzero_si128());
+        auto const tmp = _mm_max_epu16(_mm256_castsi256_si128(a_), _mm256_extracti128_si256(a_, 1));
+        auto const r = _mm_xor_si128(_mm_minpos_epu16(_mm_xor_si128(tmp, ones)), ones);
+        return S(_mm256_broadcastw_epi16(r));
+    }
+};
+#endif
+
+} // namespace v1
+} // namespace v1
@@ -0,0 +1,280 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "array_intrinsic.hpp"
+#include "macros.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include <arm_neon.h>
+
+hi_export_module(hikocpu : array_intrinsic_u8x16);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+#if defined(HI_HAS_NEON) and defined(HI_HAS_ARM64)
+template<>
+struct array_intrinsic<uint8_t, 16> {
+    using value_type = uint8_t;
+    using register_type = uint8x16_t;
+    using array_type = std::array<uint8_t, 16>;
+
+    /** Load an array into a register.
+     */
+    [[nodiscard]] hi_force_inline static register_type L(array_type a) noexcept
+    {
+        return vld1q_u8(a.data());
+    }
+
+    /** Store a register into an array.
+     */
+    [[nodiscard]] hi_force_inline static array_type S(register_type a) noexcept
+    {
+        auto r = array_type{};
+        vst1q_u8(r.data(), a);
+        return r;
+    }
+
+    /** Make a lane mask from a compile-time bit-mask.
+     */
+    template<std::size_t Mask>
+    [[nodiscard]] hi_force_inline static uint8x16_t _make_mask() noexcept
+    {
+        constexpr auto mask = [] {
+            auto r = std::array<uint8_t, 16>{};
+            for (std::size_t i = 0; i != 16; ++i) {
+                r[i] = (Mask >> i) & 1 ? uint8_t{0xff} : uint8_t{0};
+            }
+            return r;
+        }();
+        return vld1q_u8(mask.data());
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set(uint8_t a) noexcept
+    {
+        return S(vsetq_lane_u8(a, vdupq_n_u8(0), 0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_zero() noexcept
+    {
+        return S(vdupq_n_u8(0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_all_ones() noexcept
+    {
+        return S(vdupq_n_u8(0xff));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_one() noexcept
+    {
+        return S(vdupq_n_u8(1));
+    }
+
+    template<size_t I>
+    [[nodiscard]] hi_force_inline static uint8_t get(array_type a) noexcept
+    {
+        static_assert(I < 16);
+        return vgetq_lane_u8(L(a), I);
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(uint8_t a) noexcept
+    {
+        return S(vdupq_n_u8(a));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type broadcast(array_type a) noexcept
+    {
+        return S(vdupq_laneq_u8(L(a), 0));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type set_mask(std::size_t mask) noexcept
+    {
+        // Each byte of the mask selects 8 elements.
+        constexpr auto bits = std::array<uint8_t, 16>{1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+        auto const mask_ = vcombine_u8(vdup_n_u8(static_cast<uint8_t>(mask)), vdup_n_u8(static_cast<uint8_t>(mask >> 8)));
+        return S(vtstq_u8(mask_, vld1q_u8(bits.data())));
+    }
+
+    /** Store a register as a mask-integer.
+     */
+    [[nodiscard]] hi_force_inline static std::size_t get_mask(array_type a) noexcept
+    {
+        constexpr auto shifts = std::array<int8_t, 16>{0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7};
+        auto const bits = vshlq_u8(vshrq_n_u8(L(a), 7), vld1q_s8(shifts.data()));
+        auto const lo = static_cast<std::size_t>(vaddv_u8(vget_low_u8(bits)));
+        auto const hi = static_cast<std::size_t>(vaddv_u8(vget_high_u8(bits)));
+        return lo | (hi << 8);
+    }
+
+    [[nodiscard]] hi_force_inline static array_type inv(array_type a) noexcept
+    {
+        return S(vmvnq_u8(L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type add(array_type a, array_type b) noexcept
+    {
+        return S(vaddq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sub(array_type a, array_type b) noexcept
+    {
+        return S(vsubq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type mul(array_type a, array_type b) noexcept
+    {
+        return S(vmulq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type eq(array_type a, array_type b) noexcept
+    {
+        return S(vceqq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ne(array_type a, array_type b) noexcept
+    {
+        return S(vmvnq_u8(vceqq_u8(L(a), L(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type lt(array_type a, array_type b) noexcept
+    {
+        return S(vcltq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type gt(array_type a, array_type b) noexcept
+    {
+        return S(vcgtq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type le(array_type a, array_type b) noexcept
+    {
+        return S(vcleq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type ge(array_type a, array_type b) noexcept
+    {
+        return S(vcgeq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static bool test(array_type a, array_type b) noexcept
+    {
+        return vmaxvq_u32(vreinterpretq_u32_u8(vandq_u8(L(a), L(b)))) == 0;
+    }
+
+    [[nodiscard]] hi_force_inline static array_type max(array_type a, array_type b) noexcept
+    {
+        return S(vmaxq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type min(array_type a, array_type b) noexcept
+    {
+        return S(vminq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type clamp(array_type v, array_type lo, array_type hi) noexcept
+    {
+        return S(vminq_u8(vmaxq_u8(L(v), L(lo)), L(hi)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _or(array_type a, array_type b) noexcept
+    {
+        return S(vorrq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _and(array_type a, array_type b) noexcept
+    {
+        return S(vandq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type _xor(array_type a, array_type b) noexcept
+    {
+        return S(veorq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type andnot(array_type a, array_type b) noexcept
+    {
+        return S(vbicq_u8(L(b), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sll(array_type a, unsigned int b) noexcept
+    {
+        return S(vshlq_u8(L(a), vdupq_n_s8(static_cast<int8_t>(b))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type srl(array_type a, unsigned int b) noexcept
+    {
+        // A negative shift-left is a shift-right.
+        return S(vshlq_u8(L(a), vdupq_n_s8(static_cast<int8_t>(-static_cast<int>(b)))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sra(array_type a, unsigned int b) noexcept
+    {
+        auto const a_ = vreinterpretq_s8_u8(L(a));
+        return S(vreinterpretq_u8_s8(vshlq_s8(a_, vdupq_n_s8(static_cast<int8_t>(-static_cast<int>(b))))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hadd(array_type a, array_type b) noexcept
+    {
+        return S(vpaddq_u8(L(a), L(b)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hsub(array_type a, array_type b) noexcept
+    {
+        auto const a_ = L(a);
+        auto const b_ = L(b);
+        return S(vsubq_u8(vuzp1q_u8(a_, b_), vuzp2q_u8(a_, b_)));
+    }
+
+    template<int... Indices>
+    [[nodiscard]] constexpr static std::array<uint8_t, 16> _make_indices_table() noexcept
+    {
+        static_assert(sizeof...(Indices) == 16);
+
+        constexpr auto indices = std::array{Indices...};
+        auto r = std::array<uint8_t, 16>{};
+        for (size_t i = 0; i != 16; ++i) {
+            auto const index = indices[i] < 0 ? i : static_cast<size_t>(indices[i]);
+            for (size_t j = 0; j != 1; ++j) {
+                r[i * 1 + j] = static_cast<uint8_t>(index * 1 + j);
+            }
+        }
+        return r;
+    }
+
+    template<int... Indices>
+    [[nodiscard]] hi_force_inline static array_type shuffle(array_type a) noexcept
+    {
+        constexpr auto table = _make_indices_table<Indices...>();
+        return S(vqtbl1q_u8(L(a), vld1q_u8(table.data())));
+    }
+
+    template<size_t Mask>
+    [[nodiscard]] hi_force_inline static array_type blend(array_type a, array_type b) noexcept
+    {
+        return S(vbslq_u8(_make_mask<Mask>(), L(b), L(a)));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type sum(array_type a) noexcept
+    {
+        return S(vdupq_n_u8(vaddvq_u8(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmin(array_type a) noexcept
+    {
+        return S(vdupq_n_u8(vminvq_u8(L(a))));
+    }
+
+    [[nodiscard]] hi_force_inline static array_type hmax(array_type a) noexcept
+    {
+        return S(vdupq_n_u8(vmaxvq_u8(L(a))));
+    }
+};
+#endif
+
+} // namespace v1
+} // namespace v1
@@ -0,0 +1,195 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "cpu_id_x86.hpp"
+#include "macros.hpp"
+#include <array>
+#include <atomic>
+#include <utility>
+#include <cstddef>
+
+/** Run-time dispatch of functions on the x86-64 micro-architecture level.
+ *
+ * A `hi::cpu_dispatch` holds a version of a function for each of the
+ * x86-64 micro-architecture levels v1, v2, v3 and v4. On the first call the
+ * version for the highest level supported by the current CPU is selected,
+ * each call after that is an indirect call through the selected function
+ * pointer.
+ *
+ * There are two ways to create the versions of a function:
+ *  - Write a hand optimized version for each level, for example using
+ *    intrinsics inside functions decorated with `hi_target_x86_64_v3`, or
+ *    in separate translation units compiled with `-march=x86-64-v3`
+ *    or `/arch:AVX2`. Then pass the function pointers to the constructor.
+ *  - Write a single `hi_force_inline` kernel and use
+ *    `hi::cpu_dispatch::from_kernel<kernel>()`. The kernel is compiled for each
+ *    level separately, so that the compiler can auto-vectorize it for
+ *    that level.
+ *
+ * ```
+ * hi_force_inline void add_kernel(float *r, float const *a, float const *b, std::size_t n) noexcept
+ * {
+ *     for (auto i = 0uz; i != n; ++i) {
+ *         r[i] = a[i] + b[i];
+ *     }
+ * }
+ *
+ * inline auto add = hi::cpu_dispatch<void(float *, float const *, float const *, std::size_t)>::from_kernel<add_kernel>();
+ * ```
+ *
+ * The constructor is `constexpr` so that a `cpu_dispatch` at namespace
+ * scope is constant-initialized, and may be called during the dynamic
+ * initialization of other global variables.
+ *
+ * @module hikocpu.cpu_dispatch
+ */
+hi_export_module(hikocpu : cpu_dispatch);
+
+// clang-format off
+#if defined(__clang__) or defined(__GNUC__)
+#define HI_X86_64_V2_TARGET "cx16,sahf,popcnt,sse3,ssse3,sse4.1,sse4.2"
+#define HI_X86_64_V3_TARGET HI_X86_64_V2_TARGET ",avx,avx2,bmi,bmi2,f16c,fma,lzcnt,movbe,xsave"
+#define HI_X86_64_V4_TARGET HI_X86_64_V3_TARGET ",avx512f,avx512bw,avx512cd,avx512dq,avx512vl"
+
+/** Enable code-generation for x86-64-v2 for a single function.
+ */
+#define hi_target_x86_64_v2 hi_target(HI_X86_64_V2_TARGET)
+
+/** Enable code-generation for x86-64-v3 for a single function.
+ */
+#define hi_target_x86_64_v3 hi_target(HI_X86_64_V3_TARGET)
+
+/** Enable code-generation for x86-64-v4 for a single function.
+ */
+#define hi_target_x86_64_v4 hi_target(HI_X86_64_V4_TARGET)
+#else
+// MSVC can not change code-generation per function. Versions for
+// higher levels need to be compiled in a separate translation unit.
+#define hi_target_x86_64_v2
+#define hi_target_x86_64_v3
+#define hi_target_x86_64_v4
+#endif
+// clang-format on
+
+hi_export namespace hi {
+inline namespace v1 {
+
+template<typename Signature>
+class cpu_dispatch;
+
+/** A function that is dispatched on the x86-64 micro-architecture level.
+ *
+ * @tparam R The return type of the function.
+ * @tparam Args The argument types of the function.
+ */
+template<typename R, typename... Args>
+class cpu_dispatch<R(Args...)> {
+public:
+    using function_type = R (*)(Args...);
+
+    constexpr cpu_dispatch(cpu_dispatch const&) = delete;
+    constexpr cpu_dispatch(cpu_dispatch&&) = delete;
+    constexpr cpu_dispatch& operator=(cpu_dispatch const&) = delete;
+    constexpr cpu_dispatch& operator=(cpu_dispatch&&) = delete;
+
+    /** Create a dispatch from a version for each level.
+     *
+     * @param v1 The version for x86-64-v1, this version is required.
+     * @param v2 The version for x86-64-v2, or nullptr.
+     * @param v3 The version for x86-64-v3, or nullptr.
+     * @param v4 The version for x86-64-v4, or nullptr.
+     */
+    constexpr cpu_dispatch(
+        function_type v1,
+        function_type v2 = nullptr,
+        function_type v3 = nullptr,
+        function_type v4 = nullptr) noexcept :
+        _versions{v1, v2, v3, v4}
+    {
+    }
+
+    /** Create a dispatch by compiling a kernel for each level.
+     *
+     * @tparam Kernel A `hi_force_inline` function, which is inlined in
+     *         a function compiled for each level.
+     */
+    template<auto Kernel>
+    [[nodiscard]] constexpr static cpu_dispatch from_kernel() noexcept
+    {
+#if defined(__clang__) or defined(__GNUC__)
+        return {&_v1<Kernel>, &_v2<Kernel>, &_v3<Kernel>, &_v4<Kernel>};
+#else
+        return {&_v1<Kernel>};
+#endif
+    }
+
+    /** Get the version of the function for the current CPU.
+     *
+     * The version is selected on the first call.
+     */
+    [[nodiscard]] function_type get() const noexcept
+    {
+        if (auto f = _selected.load(std::memory_order::relaxed)) {
+            return f;
+        }
+
+        // Multiple threads may select concurrently, they all select the same version.
+        auto const f = select();
+        _selected.store(f, std::memory_order::relaxed);
+        return f;
+    }
+
+    /** Call the version of the function for the current CPU.
+     */
+    R operator()(Args... args) const
+    {
+        return get()(std::forward<Args>(args)...);
+    }
+
+private:
+    std::array<function_type, 4> _versions;
+    mutable std::atomic<function_type> _selected = nullptr;
+
+    [[nodiscard]] function_type select() const noexcept
+    {
+        if (_versions[3] != nullptr and has_x86_64_v4()) {
+            return _versions[3];
+        } else if (_versions[2] != nullptr and has_x86_64_v3()) {
+            return _versions[2];
+        } else if (_versions[1] != nullptr and has_x86_64_v2()) {
+            return _versions[1];
+        } else {
+            return _versions[0];
+        }
+    }
+
+    template<auto Kernel>
+    static R _v1(Args... args)
+    {
+        return Kernel(std::forward<Args>(args)...);
+    }
+
+    template<auto Kernel>
+    hi_target_x86_64_v2 static R _v2(Args... args)
+    {
+        return Kernel(std::forward<Args>(args)...);
+    }
+
+    template<auto Kernel>
+    hi_target_x86_64_v3 static R _v3(Args... args)
+    {
+        return Kernel(std::forward<Args>(args)...);
+    }
+
+    template<auto Kernel>
+    hi_target_x86_64_v4 static R _v4(Args... args)
+    {
+        return Kernel(std::forward<Args>(args)...);
+    }
+};
+
+} // namespace v1
+} // namespace v1
@@ -0,0 +1,66 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "hikocpu.hpp"
+#include "macros.hpp"
+#include <hikotest/hikotest.hpp>
+#include <cstddef>
+
+#if defined(HI_HAS_X86)
+namespace test_cpu_dispatch {
+
+[[nodiscard]] inline int level_v1() noexcept
+{
+    return 1;
+}
+
+[[nodiscard]] inline int level_v3() noexcept
+{
+    return 3;
+}
+
+hi_force_inline inline void add_kernel(float *r, float const *a, float const *b, std::size_t n) noexcept
+{
+    for (auto i = 0uz; i != n; ++i) {
+        r[i] = a[i] + b[i];
+    }
+}
+
+inline auto level = hi::cpu_dispatch<int()>{level_v1, nullptr, level_v3};
+
+inline auto add = hi::cpu_dispatch<void(float *, float const *, float const *, std::size_t)>::from_kernel<add_kernel>();
+
+} // namespace test_cpu_dispatch
+
+TEST_SUITE(cpu_dispatch_suite)
+{
+
+TEST_CASE(select_test)
+{
+    auto const expected = hi::has_x86_64_v3() ? 3 : 1;
+    REQUIRE(test_cpu_dispatch::level() == expected);
+
+    // The selected version does not change.
+    REQUIRE(test_cpu_dispatch::level.get() == test_cpu_dispatch::level.get());
+    REQUIRE(test_cpu_dispatch::level() == expected);
+}
+
+TEST_CASE(kernel_test)
+{
+    float a[19];
+    float b[19];
+    float r[19];
+    for (auto i = 0uz; i != 19; ++i) {
+        a[i] = static_cast<float>(i);
+        b[i] = static_cast<float>(i * 10);
+    }
+
+    test_cpu_dispatch::add(r, a, b, 19);
+    for (auto i = 0uz; i != 19; ++i) {
+        REQUIRE(r[i] == static_cast<float>(i * 11));
+    }
+}
+
+};
+#endif
@@ -0,0 +1,352 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "macros.hpp"
+
+#if defined(_WIN32)
+#include <Windows.h>
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#elif defined(__linux__)
+#include <sys/auxv.h>
+#endif
+
+#include <array>
+#include <utility>
+#include <cstdint>
+#include <format>
+#include <bit>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <iostream>
+#include <print>
+
+/** CPU-ID for ARM.
+ *
+ * This module is the ARM counterpart of the x86 cpu_id module.
+ *  - `HI_HAS_*` CPU feature that will always be available.
+ *  - `hi::has_*()` CPU feature that is available at runtime.
+ *
+ * ARM does not have an instruction available to user space to query the
+ * CPU features, therefor the features are retrieved from the operating
+ * system:
+ *  - Linux: `getauxval(AT_HWCAP)`.
+ *  - macOS: `sysctlbyname("hw.optional.*")`.
+ *  - Windows: `IsProcessorFeaturePresent()`.
+ *
+ * @module hikogui.utility.cpu_id
+ */
+hi_export_module(hikocpu : cpu_id);
+
+namespace hi { inline namespace v1 {
+
+/** Possible features of ARM CPUs that are used by HikoGUI.
+ */
+enum class cpu_feature : uint8_t {
+    neon,
+    fp16,
+    dotprod,
+    crc32,
+    aes,
+    sha2,
+};
+
+constexpr auto cpu_feature_metadata_init() noexcept
+{
+    // At most 64 cpu_feature flags are allowed.
+    auto r = std::array<std::string_view, 64>{};
+
+    r[std::to_underlying(cpu_feature::neon)] = "NEON";
+    r[std::to_underlying(cpu_feature::fp16)] = "FP16";
+    r[std::to_underlying(cpu_feature::dotprod)] = "DOTPROD";
+    r[std::to_underlying(cpu_feature::crc32)] = "CRC32";
+    r[std::to_underlying(cpu_feature::aes)] = "AES";
+    r[std::to_underlying(cpu_feature::sha2)] = "SHA2";
+    return r;
+}
+
+constexpr auto cpu_feature_metadata = cpu_feature_metadata_init();
+
+}} // namespace hi::v1
+
+hi_export template<>
+struct std::formatter<::hi::cpu_feature, char> : std::formatter<std::string_view, char> {
+    auto format(::hi::cpu_feature const& t, auto& fc) const
+    {
+        return std::formatter<std::string_view, char>::format(::hi::cpu_feature_metadata[std::to_underlying(t)], fc);
+    }
+};
+
+hi_export namespace hi {
+inline namespace v1 {
+
+template<std::integral Lhs>
+[[nodiscard]] constexpr unsigned long long operator<<(Lhs const& lhs, cpu_feature const& rhs)
+{
+    if (not std::cmp_equal(lhs, 1)) {
+        throw std::logic_error("lhs of a cpu_feature shift must be 1.");
+    }
+    if (not std::cmp_less(std::to_underlying(rhs), 64)) {
+        throw std::logic_error("cpu_feature is not allowed the have a value beyond 63");
+    }
+
+    return static_cast<unsigned long long>(lhs) << std::to_underlying(rhs);
+}
+
+/** A mask of features.
+ *
+ * Currently this implementation can handle up to 64 features.
+ */
+enum class cpu_feature_mask : uint64_t {
+    none = 0,
+
+    neon = 1 << cpu_feature::neon,
+    fp16 = 1 << cpu_feature::fp16,
+    dotprod = 1 << cpu_feature::dotprod,
+    crc32 = 1 << cpu_feature::crc32,
+    aes = 1 << cpu_feature::aes,
+    sha2 = 1 << cpu_feature::sha2,
+};
+
+[[nodiscard]] constexpr cpu_feature_mask operator|(cpu_feature_mask const& lhs, cpu_feature_mask const& rhs) noexcept
+{
+    return static_cast<cpu_feature_mask>(std::to_underlying(lhs) | std::to_underlying(rhs));
+}
+
+[[nodiscard]] constexpr cpu_feature_mask operator&(cpu_feature_mask const& lhs, cpu_feature_mask const& rhs) noexcept
+{
+    return static_cast<cpu_feature_mask>(std::to_underlying(lhs) & std::to_underlying(rhs));
+}
+
+[[nodiscard]] constexpr cpu_feature_mask operator-(cpu_feature_mask const& lhs, cpu_feature_mask const& rhs) noexcept
+{
+    return static_cast<cpu_feature_mask>(std::to_underlying(lhs) & ~std::to_underlying(rhs));
+}
+
+[[nodiscard]] constexpr bool to_bool(cpu_feature_mask const& rhs) noexcept
+{
+    return std::to_underlying(rhs) != 0;
+}
+
+[[nodiscard]] constexpr cpu_feature_mask operator|(cpu_feature_mask const& lhs, cpu_feature const& rhs) noexcept
+{
+    auto const rhs_ = static_cast<cpu_feature_mask>(1 << rhs);
+    return lhs | rhs_;
+}
+
+[[nodiscard]] constexpr cpu_feature_mask operator&(cpu_feature_mask const& lhs, cpu_feature const& rhs) noexcept
+{
+    auto const rhs_ = static_cast<cpu_feature_mask>(1 << rhs);
+    return lhs & rhs_;
+}
+
+constexpr cpu_feature_mask& operator|=(cpu_feature_mask& lhs, cpu_feature const& rhs) noexcept
+{
+    return lhs = lhs | rhs;
+}
+
+} // namespace v1
+}
+
+hi_export template<>
+struct std::formatter<::hi::cpu_feature_mask, char> : std::formatter<std::string, char> {
+    auto format(::hi::cpu_feature_mask const& t, auto& fc) const
+    {
+        using mask_type = std::underlying_type_t<::hi::cpu_feature_mask>;
+
+        auto str = std::string{};
+        for (mask_type mask = 1; mask != 0; mask <<= 1) {
+            if ((std::to_underlying(t) & mask) != 0) {
+                auto const feature = static_cast<::hi::cpu_feature>(std::countr_zero(mask));
+
+                if (str.empty()) {
+                    str = std::format("{}", feature);
+                } else {
+                    str = std::format("{}, {}", str, feature);
+                }
+            }
+        }
+
+        return std::formatter<std::string, char>::format(str, fc);
+    }
+};
+
+hi_export namespace hi {
+inline namespace v1 {
+namespace detail {
+
+/** Get a list of CPU features that the compiler expects.
+ */
+[[nodiscard]] constexpr cpu_feature_mask expected_cpu_features() noexcept
+{
+    auto r = cpu_feature_mask{};
+
+#if HI_HAS_NEON
+    r |= cpu_feature::neon;
+#endif
+#if HI_HAS_FP16
+    r |= cpu_feature::fp16;
+#endif
+#if HI_HAS_DOTPROD
+    r |= cpu_feature::dotprod;
+#endif
+#if HI_HAS_CRC32
+    r |= cpu_feature::crc32;
+#endif
+#if HI_HAS_AES
+    r |= cpu_feature::aes;
+#endif
+#if HI_HAS_SHA2
+    r |= cpu_feature::sha2;
+#endif
+
+    return r;
+}
+
+#if defined(__APPLE__)
+[[nodiscard]] inline bool sysctl_flag(char const *name) noexcept
+{
+    auto value = 0;
+    auto size = sizeof(value);
+    if (sysctlbyname(name, &value, &size, nullptr, 0) != 0) {
+        return false;
+    }
+    return value != 0;
+}
+#endif
+
+[[nodiscard]] inline cpu_feature_mask cpu_features_init() noexcept
+{
+    // clang-format off
+    auto r = cpu_feature_mask{};
+
+#if defined(_WIN32)
+    if (IsProcessorFeaturePresent(PF_ARM_NEON_INSTRUCTIONS_AVAILABLE)) { r |= cpu_feature::neon; }
+    if (IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE)) { r |= cpu_feature::crc32; }
+    if (IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE)) {
+        r |= cpu_feature::aes;
+        r |= cpu_feature::sha2;
+    }
+#if defined(PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE)
+    if (IsProcessorFeaturePresent(PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE)) { r |= cpu_feature::dotprod; }
+#endif
+
+#elif defined(__APPLE__)
+    // Advanced SIMD is always available on Apple silicon.
+    r |= cpu_feature::neon;
+    if (sysctl_flag("hw.optional.arm.FEAT_FP16")) { r |= cpu_feature::fp16; }
+    if (sysctl_flag("hw.optional.arm.FEAT_DotProd")) { r |= cpu_feature::dotprod; }
+    if (sysctl_flag("hw.optional.armv8_crc32")) { r |= cpu_feature::crc32; }
+    if (sysctl_flag("hw.optional.arm.FEAT_AES")) { r |= cpu_feature::aes; }
+    if (sysctl_flag("hw.optional.arm.FEAT_SHA256")) { r |= cpu_feature::sha2; }
+
+#elif defined(__linux__) and defined(HI_HAS_ARM64)
+    // The bits of AT_HWCAP from <asm/hwcap.h> on aarch64.
+    auto const hwcap = getauxval(AT_HWCAP);
+    if (hwcap & (1UL << 1)) { r |= cpu_feature::neon; } // HWCAP_ASIMD
+    if (hwcap & (1UL << 3)) { r |= cpu_feature::aes; } // HWCAP_AES
+    if (hwcap & (1UL << 6)) { r |= cpu_feature::sha2; } // HWCAP_SHA2
+    if (hwcap & (1UL << 7)) { r |= cpu_feature::crc32; } // HWCAP_CRC32
+    if (hwcap & (1UL << 10)) { r |= cpu_feature::fp16; } // HWCAP_ASIMDHP
+    if (hwcap & (1UL << 20)) { r |= cpu_feature::dotprod; } // HWCAP_ASIMDDP
+
+#else
+    // Without a way to query the CPU, trust the compiler flags.
+    r = expected_cpu_features();
+#endif
+    // clang-format on
+
+    if (auto const missing_features = expected_cpu_features() - r; to_bool(missing_features)) {
+        auto const error_message = std::format(
+            "This executable is incompatible with the CPU in this computer.\n"
+            "The CPU is missing the following features:\n"
+            "    {}",
+            missing_features);
+
+#if defined(_WIN32)
+        if (GetStdHandle(STD_ERROR_HANDLE) == NULL) {
+            // The application is not attached to the console, so probably a
+            // GUI application. Lets hope that ANSI code-page is set to UTF-8.
+            MessageBoxA(NULL, error_message.c_str(), NULL, MB_OK | MB_ICONERROR);
+            std::terminate();
+        }
+#endif
+
+        std::println(std::cerr, "{}", error_message);
+        std::terminate();
+    }
+
+    return r;
+}
+
+/** A set of features that are supported on this CPU.
+ */
+inline cpu_feature_mask const cpu_features = detail::cpu_features_init();
+
+}
+
+/** Get a list of features of the current CPU.
+ */
+[[nodiscard]] inline cpu_feature_mask cpu_features() noexcept
+{
+    return detail::cpu_features;
+}
+
+// clang-format off
+
+/** This CPU has the Advanced SIMD (NEON) instructions.
+ */
+#if HI_HAS_NEON
+[[nodiscard]] constexpr bool has_neon() noexcept { return true; }
+#else
+[[nodiscard]] inline bool has_neon() noexcept { return to_bool(cpu_features() & cpu_feature::neon); }
+#endif
+
+/** This CPU has the half-precision floating point vector arithmetic instructions.
+ */
+#if HI_HAS_FP16
+[[nodiscard]] constexpr bool has_fp16() noexcept { return true; }
+#else
+[[nodiscard]] inline bool has_fp16() noexcept { return to_bool(cpu_features() & cpu_feature::fp16); }
+#endif
+
+/** This CPU has the 8-bit integer dot-product instructions.
+ */
+#if HI_HAS_DOTPROD
+[[nodiscard]] constexpr bool has_dotprod() noexcept { return true; }
+#else
+[[nodiscard]] inline bool has_dotprod() noexcept { return to_bool(cpu_features() & cpu_feature::dotprod); }
+#endif
+
+/** This CPU has the CRC32 instructions.
+ */
+#if HI_HAS_CRC32
+[[nodiscard]] constexpr bool has_crc32() noexcept { return true; }
+#else
+[[nodiscard]] inline bool has_crc32() noexcept { return to_bool(cpu_features() & cpu_feature::crc32); }
+#endif
+
+/** This CPU has the AES instructions.
+ */
+#if HI_HAS_AES
+[[nodiscard]] constexpr bool has_aes() noexcept { return true; }
+#else
+[[nodiscard]] inline bool has_aes() noexcept { return to_bool(cpu_features() & cpu_feature::aes); }
+#endif
+
+/** This CPU has the SHA-256 instructions.
+ */
+#if HI_HAS_SHA2
+[[nodiscard]] constexpr bool has_sha2() noexcept { return true; }
+#else
+[[nodiscard]] inline bool has_sha2() noexcept { return to_bool(cpu_features() & cpu_feature::sha2); }
+#endif
+
+// clang-format on
+
+} // namespace v1
+}
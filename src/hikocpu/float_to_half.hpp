@@ -6,6 +6,8 @@
 #include "macros.hpp"
 #if defined(HI_HAS_X86)
 #include "cpu_id_x86.hpp"
+#elif defined(HI_HAS_ARM)
+#include "cpu_id_arm.hpp"
 #else
 #include "cpu_id_generic.hpp"
 #endif
@@ -13,6 +15,8 @@
 #include <bit>
 #include <type_traits>
 #include <array>
+#include <cstring>
+#include <cstddef>
 
 #ifdef HI_HAS_X86
 #include <immintrin.h>
@@ -206,5 +210,80 @@ hi_target("sse,sse2")
     return r;
 }
 
+inline void float_to_half_generic(float const *src, uint16_t *dst, size_t size) noexcept
+{
+    for (size_t i = 0; i != size; ++i) {
+        dst[i] = float_to_half_generic(src[i]);
+    }
+}
+
+#if HI_HAS_X86
+hi_target("sse,sse2,avx,f16c")
+inline void float_to_half_f16c(float const *src, uint16_t *dst, size_t size) noexcept
+{
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        auto const a = _mm256_loadu_ps(src + i);
+        auto const r = _mm256_cvtps_ph(a, _MM_FROUND_TO_ZERO);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), r);
+    }
+    for (; i + 4 <= size; i += 4) {
+        auto const a = _mm_loadu_ps(src + i);
+        auto const r = _mm_cvtps_ph(a, _MM_FROUND_TO_ZERO);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i), r);
+    }
+    float_to_half_generic(src + i, dst + i, size - i);
+}
+
+hi_target("sse,sse2,avx,avx2,f16c,fma,avx512f")
+inline void float_to_half_avx512(float const *src, uint16_t *dst, size_t size) noexcept
+{
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        auto const a = _mm512_loadu_ps(src + i);
+        auto const r = _mm512_cvtps_ph(a, _MM_FROUND_TO_ZERO);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), r);
+    }
+    float_to_half_f16c(src + i, dst + i, size - i);
+}
+
+hi_target("sse,sse2")
+inline void float_to_half_sse2(float const *src, uint16_t *dst, size_t size) noexcept
+{
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        auto a = std::array<float, 4>{};
+        std::memcpy(a.data(), src + i, sizeof(a));
+        auto const r = float_to_half_sse2(a);
+        std::memcpy(dst + i, r.data(), sizeof(r));
+    }
+    float_to_half_generic(src + i, dst + i, size - i);
+}
+#endif
+
+/** Convert a sequence of floats to halfs.
+ *
+ * The features of the CPU are checked once for the whole sequence.
+ *
+ * @param src A pointer to the floats to convert.
+ * @param[out] dst A pointer to the halfs to write.
+ * @param size The number of values to convert.
+ */
+inline void float_to_half(float const *src, uint16_t *dst, size_t size) noexcept
+{
+#if HI_HAS_X86
+    if (has_avx512f()) {
+        return float_to_half_avx512(src, dst, size);
+    }
+    if (has_f16c() and has_avx()) {
+        return float_to_half_f16c(src, dst, size);
+    }
+    if (has_sse2()) {
+        return float_to_half_sse2(src, dst, size);
+    }
+#endif
+    return float_to_half_generic(src, dst, size);
+}
+
 }}
 
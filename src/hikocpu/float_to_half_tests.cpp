@@ -3,7 +3,9 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "float_to_half.hpp"
+#include "half.hpp"
 #include <hikotest/hikotest.hpp>
+#include <array>
 
 TEST_SUITE(float_to_half_suite) {
 
@@ -494,4 +496,43 @@ TEST_CASE(sse2_test)
 }
 #endif
 
+TEST_CASE(batch_test)
+{
+    // The number of values exercises the 8-wide, 4-wide and scalar parts of the conversion.
+    float const values[19] = {
+        0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 65504.0f, 65520.0f, -65520.0f, 1e-8f, -1e-8f,
+        3.14159f, 2.71828f, 0.1f, 100.0f, -100.0f, 32768.002f, 6.1e-5f, 5.96e-8f, 1234.5f};
+
+    uint16_t expected[19];
+    for (auto i = 0; i != 19; ++i) {
+        expected[i] = hi::float_to_half_generic(values[i]);
+    }
+
+    uint16_t result[19] = {};
+    hi::float_to_half(values, result, 19);
+    for (auto i = 0; i != 19; ++i) {
+        REQUIRE(result[i] == expected[i]);
+    }
+}
+
+TEST_CASE(span_test)
+{
+    // 45 values; exercise the 16-wide, 8-wide, 4-wide and scalar parts of the conversion.
+    auto values = std::array<float, 45>{};
+    for (auto i = std::size_t{0}; i != values.size(); ++i) {
+        values[i] = static_cast<float>(i) * 123.456f - 2000.0f;
+    }
+
+    auto halfs = std::array<hi::half, 45>{};
+    hi::float_to_half(values, halfs);
+
+    auto floats = std::array<float, 45>{};
+    hi::half_to_float(halfs, floats);
+
+    for (auto i = std::size_t{0}; i != values.size(); ++i) {
+        REQUIRE(halfs[i].intrinsic() == hi::float_to_half_generic(values[i]));
+        REQUIRE(floats[i] == hi::half_to_float_generic(halfs[i].intrinsic()));
+    }
+}
+
 }; // TEST_SUITE(float_to_half_suite)
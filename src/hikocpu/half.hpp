@@ -12,6 +12,7 @@
 #include <bit>
 #include <algorithm>
 #include <numeric>
+#include <span>
 #include <format>
 
 hi_export_module(hikocpu : half);
@@ -131,6 +132,34 @@ static_assert(std::is_trivially_destructible_v<half>);
 static_assert(requires(half a) { std::bit_cast<uint16_t>(a); });
 static_assert(requires(uint16_t a) { std::bit_cast<half>(a); });
 
+/** Convert floats to halfs.
+ *
+ * The features of the CPU are checked once for the whole span, the values are
+ * converted using F16C or AVX-512 when available.
+ *
+ * @pre @a dst is at least as large as @a src.
+ * @param src The floats to convert.
+ * @param[out] dst The halfs.
+ */
+inline void float_to_half(std::span<float const> src, std::span<half> dst) noexcept
+{
+    float_to_half(src.data(), reinterpret_cast<uint16_t *>(dst.data()), src.size());
+}
+
+/** Convert halfs to floats.
+ *
+ * The features of the CPU are checked once for the whole span, the values are
+ * converted using F16C or AVX-512 when available, or through a table otherwise.
+ *
+ * @pre @a dst is at least as large as @a src.
+ * @param src The halfs to convert.
+ * @param[out] dst The floats.
+ */
+inline void half_to_float(std::span<half const> src, std::span<float> dst) noexcept
+{
+    half_to_float(reinterpret_cast<uint16_t const *>(src.data()), dst.data(), src.size());
+}
+
 } // namespace v1
 } // namespace hi::inline v1
 
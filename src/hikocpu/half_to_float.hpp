@@ -7,6 +7,8 @@
 #include "macros.hpp"
 #if defined(HI_HAS_X86)
 #include "cpu_id_x86.hpp"
+#elif defined(HI_HAS_ARM)
+#include "cpu_id_arm.hpp"
 #else
 #include "cpu_id_generic.hpp"
 #endif
@@ -20,6 +22,9 @@
 #include <emmintrin.h>
 #include <smmintrin.h>
 #endif
+#if defined(HI_HAS_NEON) and defined(HI_HAS_FP16_FORMAT)
+#include <arm_neon.h>
+#endif
 
 hi_export_module(hikocpu : half_to_float);
 
@@ -104,6 +109,17 @@ hi_target("sse,sse2,f16c") [[nodiscard]] inline std::array<float, 4> half_to_flo
 }
 #endif
 
+#if defined(HI_HAS_NEON) and defined(HI_HAS_FP16_FORMAT)
+[[nodiscard]] inline std::array<float, 4> half_to_float_neon(std::array<uint16_t, 4> v) noexcept
+{
+    auto const r = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(v.data())));
+
+    auto r_ = std::array<float, 4>{};
+    vst1q_f32(r_.data(), r);
+    return r_;
+}
+#endif
+
 [[nodiscard]] constexpr std::array<float, 4> half_to_float(std::array<uint16_t, 4> v) noexcept
 {
     if (not std::is_constant_evaluated()) {
@@ -111,6 +127,8 @@ hi_target("sse,sse2,f16c") [[nodiscard]] inline std::array<float, 4> half_to_flo
         if (has_f16c()) {
             return half_to_float_f16c(v);
         }
+#elif defined(HI_HAS_NEON) and defined(HI_HAS_FP16_FORMAT)
+        return half_to_float_neon(v);
 #endif
     }
 
@@ -136,6 +154,73 @@ hi_target("sse,sse2,f16c") [[nodiscard]] inline std::array<float, 4> half_to_flo
     return detail::half_to_float_table[v];
 }
 
+inline void half_to_float_generic(uint16_t const *src, float *dst, size_t size) noexcept
+{
+    for (size_t i = 0; i != size; ++i) {
+        dst[i] = detail::half_to_float_table[src[i]];
+    }
+}
 
-}}
+#if HI_HAS_X86
+hi_target("sse,sse2,avx,f16c")
+inline void half_to_float_f16c(uint16_t const *src, float *dst, size_t size) noexcept
+{
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        auto const a = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(a));
+    }
+    for (; i + 4 <= size; i += 4) {
+        auto const a = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(src + i));
+        _mm_storeu_ps(dst + i, _mm_cvtph_ps(a));
+    }
+    half_to_float_generic(src + i, dst + i, size - i);
+}
+
+hi_target("sse,sse2,avx,avx2,f16c,fma,avx512f")
+inline void half_to_float_avx512(uint16_t const *src, float *dst, size_t size) noexcept
+{
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        auto const a = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(a));
+    }
+    half_to_float_f16c(src + i, dst + i, size - i);
+}
+#endif
+
+#if defined(HI_HAS_NEON) and defined(HI_HAS_FP16_FORMAT)
+inline void half_to_float_neon(uint16_t const *src, float *dst, size_t size) noexcept
+{
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    }
+    half_to_float_generic(src + i, dst + i, size - i);
+}
+#endif
 
+/** Convert a sequence of halfs to floats.
+ *
+ * The features of the CPU are checked once for the whole sequence.
+ *
+ * @param src A pointer to the halfs to convert.
+ * @param[out] dst A pointer to the floats to write.
+ * @param size The number of values to convert.
+ */
+inline void half_to_float(uint16_t const *src, float *dst, size_t size) noexcept
+{
+#if HI_HAS_X86
+    if (has_avx512f()) {
+        return half_to_float_avx512(src, dst, size);
+    }
+    if (has_f16c() and has_avx()) {
+        return half_to_float_f16c(src, dst, size);
+    }
+#elif defined(HI_HAS_NEON) and defined(HI_HAS_FP16_FORMAT)
+    return half_to_float_neon(src, dst, size);
+#endif
+    return half_to_float_generic(src, dst, size);
+}
+
+}}
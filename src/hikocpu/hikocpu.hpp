@@ -8,16 +8,31 @@
 #include "macros.hpp"
 
 #include "array_generic.hpp" // export
-#ifndef HI_GENERIC
+#if defined(HI_HAS_X86)
 #include "array_intrinsic_f16x4_x86.hpp" // export
 #include "array_intrinsic_f32x4_x86.hpp" // export
+#include "array_intrinsic_f32x8_x86.hpp" // export
+#include "array_intrinsic_f32x16_x86.hpp" // export
 #include "array_intrinsic_f64x4_x86.hpp" // export
 #include "array_intrinsic_f64x2_x86.hpp" // export
+#include "array_intrinsic_i8x32_x86.hpp" // export
+#include "array_intrinsic_u16x16_x86.hpp" // export
+#elif defined(HI_HAS_ARM64)
+#include "array_intrinsic_f16x4_arm.hpp" // export
+#include "array_intrinsic_f32x4_arm.hpp" // export
+#include "array_intrinsic_f64x2_arm.hpp" // export
+#include "array_intrinsic_i16x8_arm.hpp" // export
+#include "array_intrinsic_i32x4_arm.hpp" // export
+#include "array_intrinsic_u32x4_arm.hpp" // export
+#include "array_intrinsic_u8x16_arm.hpp" // export
 #endif
 #include "array_intrinsic.hpp" // export
 #include "simd_intf.hpp" // export
 #if defined(HI_HAS_X86)
 #include "cpu_id_x86.hpp" // export
+#include "cpu_dispatch_x86.hpp" // export
+#elif defined(HI_HAS_ARM)
+#include "cpu_id_arm.hpp" // export
 #else
 #include "cpu_id_generic.hpp" // export
 #endif
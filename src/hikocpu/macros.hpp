@@ -108,6 +108,10 @@
 #define HI_HAS_VFP4
 #endif
 
+// MSVC arm64, Advanced SIMD is part of the base architecture.
+#elif defined(_M_ARM64)
+#define HI_HAS_NEON 1
+
 // Check for other CPU features from individual macro definition on compilers
 // other than MSVC.
 #else
@@ -198,6 +202,27 @@
 #if defined(__RDSEED__)
 #define HI_HAS_RDSEED 1
 #endif
+#if defined(__ARM_NEON)
+#define HI_HAS_NEON 1
+#endif
+#if defined(__ARM_FP16_FORMAT_IEEE)
+#define HI_HAS_FP16_FORMAT 1
+#endif
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#define HI_HAS_FP16 1
+#endif
+#if defined(__ARM_FEATURE_DOTPROD)
+#define HI_HAS_DOTPROD 1
+#endif
+#if defined(__ARM_FEATURE_CRC32)
+#define HI_HAS_CRC32 1
+#endif
+#if defined(__ARM_FEATURE_AES)
+#define HI_HAS_AES 1
+#endif
+#if defined(__ARM_FEATURE_SHA2)
+#define HI_HAS_SHA2 1
+#endif
 #endif
 
 // clang-format off
@@ -0,0 +1,67 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "hikocpu.hpp"
+#include "macros.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+
+TEST_SUITE(simd_f32x16_suite)
+{
+
+TEST_CASE(arithmetic_test)
+{
+    auto const tmp1 = hi::f32x16{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f};
+    auto const tmp2 = hi::f32x16::broadcast(2.0f);
+
+    REQUIRE(
+        tmp1 * tmp2 ==
+        hi::f32x16(2.0f, 4.0f, 6.0f, 8.0f, 10.0f, 12.0f, 14.0f, 16.0f, 18.0f, 20.0f, 22.0f, 24.0f, 26.0f, 28.0f, 30.0f, 32.0f));
+    REQUIRE(
+        tmp1 - tmp2 ==
+        hi::f32x16(-1.0f, 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f));
+    REQUIRE((tmp1 > tmp2).mask() == 0b1111'1111'1111'1100);
+}
+
+TEST_CASE(horizontal_test)
+{
+    auto const tmp = hi::f32x16{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, -7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f};
+
+    REQUIRE(sum(tmp) == hi::f32x16::broadcast(122.0f));
+    REQUIRE(hmin(tmp) == hi::f32x16::broadcast(-7.0f));
+    REQUIRE(hmax(tmp) == hi::f32x16::broadcast(16.0f));
+}
+
+TEST_CASE(masked_load_store_test)
+{
+    auto buffer = std::array<float, 16>{};
+    for (auto i = 0; i != 16; ++i) {
+        buffer[i] = static_cast<float>(i + 1);
+    }
+
+    auto const loaded = hi::f32x16::masked_load(buffer.data(), 0b1000'0000'0000'0011);
+    REQUIRE(loaded == hi::f32x16(1.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 16.0f));
+
+    auto result = std::array<float, 16>{};
+    masked_store(result.data(), hi::f32x16{buffer}, 0b0000'0000'0001'0000);
+    REQUIRE(result[3] == 0.0f);
+    REQUIRE(result[4] == 5.0f);
+    REQUIRE(result[5] == 0.0f);
+}
+
+TEST_CASE(gather_test)
+{
+    auto table = std::array<float, 32>{};
+    for (auto i = 0; i != 32; ++i) {
+        table[i] = static_cast<float>(i * 10);
+    }
+
+    auto const indices = hi::i32x16{31, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14};
+    auto const result = hi::f32x16::gather(table.data(), indices);
+    REQUIRE(result.x() == 310.0f);
+    REQUIRE(result.y() == 0.0f);
+    REQUIRE(result[15] == 140.0f);
+}
+
+};
@@ -0,0 +1,54 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "hikocpu.hpp"
+#include "macros.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+
+TEST_SUITE(simd_f32x8_suite)
+{
+
+TEST_CASE(arithmetic_test)
+{
+    auto const tmp1 = hi::f32x8{9.0f, 6.0f, 4.0f, 14.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+    auto const tmp2 = hi::f32x8{3.0f, -2.0f, 8.0f, 7.0f, 4.0f, 2.0f, -3.0f, 8.0f};
+
+    REQUIRE(tmp1 + tmp2 == hi::f32x8(12.0f, 4.0f, 12.0f, 21.0f, 5.0f, 4.0f, 0.0f, 12.0f));
+    REQUIRE(tmp1 - tmp2 == hi::f32x8(6.0f, 8.0f, -4.0f, 7.0f, -3.0f, 0.0f, 6.0f, -4.0f));
+    REQUIRE(tmp1 * tmp2 == hi::f32x8(27.0f, -12.0f, 32.0f, 98.0f, 4.0f, 4.0f, -9.0f, 32.0f));
+    REQUIRE(tmp1 / tmp2 == hi::f32x8(3.0f, -3.0f, 0.5f, 2.0f, 0.25f, 1.0f, -1.0f, 0.5f));
+}
+
+TEST_CASE(horizontal_test)
+{
+    auto const tmp = hi::f32x8{9.0f, 6.0f, 4.0f, 14.0f, -1.0f, 2.0f, 3.0f, 4.0f};
+
+    REQUIRE(sum(tmp) == hi::f32x8::broadcast(41.0f));
+    REQUIRE(hmin(tmp) == hi::f32x8::broadcast(-1.0f));
+    REQUIRE(hmax(tmp) == hi::f32x8::broadcast(14.0f));
+    REQUIRE(hadd(tmp, tmp) == hi::f32x8(15.0f, 18.0f, 1.0f, 7.0f, 15.0f, 18.0f, 1.0f, 7.0f));
+}
+
+TEST_CASE(masked_load_store_test)
+{
+    auto const buffer = std::array{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+
+    REQUIRE(hi::f32x8::masked_load(buffer.data(), 0b0000'0111) == hi::f32x8(1.0f, 2.0f, 3.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f));
+
+    auto result = std::array{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    masked_store(result.data(), hi::f32x8{buffer}, 0b1000'0001);
+    REQUIRE((result == std::array{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 8.0f}));
+}
+
+TEST_CASE(gather_test)
+{
+    auto const table = std::array{0.0f, 10.0f, 20.0f, 30.0f, 40.0f, 50.0f, 60.0f, 70.0f, 80.0f, 90.0f};
+
+    REQUIRE(
+        hi::f32x8::gather(table.data(), hi::i32x8{9, 0, 3, 3, 1, 8, 2, 7}) ==
+        hi::f32x8(90.0f, 0.0f, 30.0f, 30.0f, 10.0f, 80.0f, 20.0f, 70.0f));
+}
+
+};
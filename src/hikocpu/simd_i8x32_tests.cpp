@@ -0,0 +1,63 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "hikocpu.hpp"
+#include "macros.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+#include <cstdint>
+
+TEST_SUITE(simd_i8x32_suite)
+{
+
+[[nodiscard]] static hi::i8x32 iota(int8_t first) noexcept
+{
+    auto r = hi::i8x32{};
+    for (auto i = 0; i != 32; ++i) {
+        r[i] = static_cast<int8_t>(first + i);
+    }
+    return r;
+}
+
+TEST_CASE(compare_test)
+{
+    auto const tmp = iota(-16);
+
+    REQUIRE((tmp < hi::i8x32::make_zero()).mask() == 0x0000'ffff);
+    REQUIRE((tmp >= hi::i8x32::make_zero()).mask() == 0xffff'0000);
+    REQUIRE((tmp == hi::i8x32::broadcast(int8_t{0})).mask() == 0x0001'0000);
+}
+
+TEST_CASE(horizontal_test)
+{
+    auto const tmp = iota(-16);
+
+    REQUIRE(sum(tmp) == hi::i8x32::broadcast(int8_t{-16}));
+    REQUIRE(hmin(tmp) == hi::i8x32::broadcast(int8_t{-16}));
+    REQUIRE(hmax(tmp) == hi::i8x32::broadcast(int8_t{15}));
+}
+
+TEST_CASE(mask_test)
+{
+    REQUIRE(hi::i8x32::make_mask(0x8000'0001).mask() == 0x8000'0001);
+    REQUIRE(hi::i8x32::make_mask(0x0f0f'00ff).mask() == 0x0f0f'00ff);
+}
+
+TEST_CASE(masked_load_store_test)
+{
+    auto const buffer = iota(1);
+
+    auto const loaded = hi::i8x32::masked_load(buffer.data(), 0b101);
+    REQUIRE(loaded[0] == 1);
+    REQUIRE(loaded[1] == 0);
+    REQUIRE(loaded[2] == 3);
+    REQUIRE(loaded[3] == 0);
+
+    auto result = std::array<int8_t, 32>{};
+    masked_store(result.data(), buffer, 0x8000'0000);
+    REQUIRE(result[30] == 0);
+    REQUIRE(result[31] == 32);
+}
+
+};
@@ -78,6 +78,22 @@ struct simd : std::array<T, N> {
         return simd{generic_type::set_mask(mask)};
     }
 
+    /** Load the elements selected by the mask, the other elements are zero.
+     *
+     * @see array_generic::masked_load()
+     */
+    [[nodiscard]] constexpr static simd masked_load(value_type const *ptr, std::size_t mask) noexcept
+    {
+        return simd{generic_type::masked_load(ptr, mask)};
+    }
+
+    /** Load the elements at the indices of a table.
+     */
+    [[nodiscard]] constexpr static simd gather(value_type const *ptr, std::array<int32_t, N> indices) noexcept
+    {
+        return simd{generic_type::gather(ptr, indices)};
+    }
+
     [[nodiscard]] constexpr std::size_t mask() noexcept
     {
         return generic_type::get_mask(*this);
@@ -412,6 +428,25 @@ struct simd : std::array<T, N> {
         return simd{generic_type::sum(a)};
     }
 
+    [[nodiscard]] constexpr friend simd hmin(array_type a) noexcept
+    {
+        return simd{generic_type::hmin(a)};
+    }
+
+    [[nodiscard]] constexpr friend simd hmax(array_type a) noexcept
+    {
+        return simd{generic_type::hmax(a)};
+    }
+
+    /** Store the elements selected by the mask.
+     *
+     * @see array_generic::masked_store()
+     */
+    constexpr friend void masked_store(value_type *ptr, array_type a, std::size_t mask) noexcept
+    {
+        generic_type::masked_store(ptr, a, mask);
+    }
+
     template<std::size_t Mask>
     [[nodiscard]] constexpr friend simd dot(array_type a, array_type b) noexcept
     {
@@ -0,0 +1,67 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "hikocpu.hpp"
+#include "macros.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+#include <cstdint>
+
+TEST_SUITE(simd_u16x16_suite)
+{
+
+[[nodiscard]] static hi::u16x16 iota(uint16_t first, uint16_t step) noexcept
+{
+    auto r = hi::u16x16{};
+    for (auto i = 0; i != 16; ++i) {
+        r[i] = static_cast<uint16_t>(first + i * step);
+    }
+    return r;
+}
+
+TEST_CASE(arithmetic_test)
+{
+    auto const tmp = iota(1, 1);
+
+    REQUIRE(tmp + tmp == iota(2, 2));
+    REQUIRE(tmp * hi::u16x16::broadcast(uint16_t{3}) == iota(3, 3));
+    REQUIRE((tmp << 1) == iota(2, 2));
+    REQUIRE((iota(2, 2) >> 1) == tmp);
+}
+
+TEST_CASE(compare_test)
+{
+    auto const tmp = iota(0xfff8, 1);
+
+    // Elements 0 to 7 are above 0x7fff, elements 8 to 15 have wrapped around to 0 to 7.
+    REQUIRE((tmp > hi::u16x16::broadcast(uint16_t{0x7fff})).mask() == 0x00ff);
+    REQUIRE((tmp <= hi::u16x16::broadcast(uint16_t{3})).mask() == 0x0f00);
+}
+
+TEST_CASE(horizontal_test)
+{
+    auto const tmp = iota(0xfff8, 1);
+
+    REQUIRE(hmin(tmp) == hi::u16x16::broadcast(uint16_t{0}));
+    REQUIRE(hmax(tmp) == hi::u16x16::broadcast(uint16_t{0xffff}));
+    REQUIRE(sum(iota(1, 1)) == hi::u16x16::broadcast(uint16_t{136}));
+}
+
+TEST_CASE(masked_load_store_test)
+{
+    auto const buffer = iota(100, 1);
+
+    auto const loaded = hi::u16x16::masked_load(buffer.data(), 0b1010);
+    REQUIRE(loaded[0] == 0);
+    REQUIRE(loaded[1] == 101);
+    REQUIRE(loaded[2] == 0);
+    REQUIRE(loaded[3] == 103);
+
+    auto result = std::array<uint16_t, 16>{};
+    masked_store(result.data(), buffer, 0b1000'0000'0000'0000);
+    REQUIRE(result[14] == 0);
+    REQUIRE(result[15] == 115);
+}
+
+};
@@ -1,6 +1,17 @@
 
+
 #pragma once
 
 #include "dsp_float.hpp" // export
+#include "dsp_mul.hpp" // export
+#include "dsp_gain.hpp" // export
+#include "dsp_parameter.hpp" // export
+#include "dsp_meter.hpp" // export
+#include "dsp_biquad.hpp" // export
+#include "dsp_mix.hpp" // export
+#include "dsp_resample.hpp" // export
+#include "dsp_fft.hpp" // export
+#include "dsp_convolver.hpp" // export
+#include "for_each.hpp" // export
 
 hi_export_module(hikogui.DSP);
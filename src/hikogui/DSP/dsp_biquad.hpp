@@ -0,0 +1,282 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "dsp_float.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <numbers>
+#include <vector>
+#include <span>
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+
+hi_export_module(hikogui.DSP.dsp_biquad);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** The coefficients of a second order IIR filter.
+ *
+ * The coefficients are normalized so that `a0` is 1.0. The filter designs
+ * are from Robert Bristow-Johnson's "Audio EQ Cookbook".
+ */
+struct biquad_coefficients {
+    float b0 = 1.0f;
+    float b1 = 0.0f;
+    float b2 = 0.0f;
+    float a1 = 0.0f;
+    float a2 = 0.0f;
+
+    /** A filter which passes the signal unmodified.
+     */
+    constexpr biquad_coefficients() noexcept = default;
+
+    constexpr biquad_coefficients(float b0, float b1, float b2, float a1, float a2) noexcept :
+        b0(b0), b1(b1), b2(b2), a1(a1), a2(a2)
+    {
+    }
+
+    [[nodiscard]] static biquad_coefficients
+    low_pass(double sample_rate, double frequency, double q = std::numbers::sqrt2 / 2.0) noexcept
+    {
+        auto const [cos_w0, alpha] = cos_alpha(sample_rate, frequency, q);
+        return normalize((1.0 - cos_w0) / 2.0, 1.0 - cos_w0, (1.0 - cos_w0) / 2.0, 1.0 + alpha, -2.0 * cos_w0, 1.0 - alpha);
+    }
+
+    [[nodiscard]] static biquad_coefficients
+    high_pass(double sample_rate, double frequency, double q = std::numbers::sqrt2 / 2.0) noexcept
+    {
+        auto const [cos_w0, alpha] = cos_alpha(sample_rate, frequency, q);
+        return normalize((1.0 + cos_w0) / 2.0, -(1.0 + cos_w0), (1.0 + cos_w0) / 2.0, 1.0 + alpha, -2.0 * cos_w0, 1.0 - alpha);
+    }
+
+    /** A peaking equalizer.
+     *
+     * @param sample_rate The sample rate in Hz.
+     * @param frequency The center frequency in Hz.
+     * @param q The quality factor, the steepness of the slopes.
+     * @param gain The gain at the center frequency in dB.
+     */
+    [[nodiscard]] static biquad_coefficients peaking(double sample_rate, double frequency, double q, double gain) noexcept
+    {
+        auto const [cos_w0, alpha] = cos_alpha(sample_rate, frequency, q);
+        auto const A = std::pow(10.0, gain / 40.0);
+        return normalize(1.0 + alpha * A, -2.0 * cos_w0, 1.0 - alpha * A, 1.0 + alpha / A, -2.0 * cos_w0, 1.0 - alpha / A);
+    }
+
+    /** A low shelving filter.
+     *
+     * @param sample_rate The sample rate in Hz.
+     * @param frequency The corner frequency in Hz.
+     * @param q The quality factor, the steepness of the slope.
+     * @param gain The gain below the corner frequency in dB.
+     */
+    [[nodiscard]] static biquad_coefficients low_shelf(double sample_rate, double frequency, double q, double gain) noexcept
+    {
+        auto const [cos_w0, alpha] = cos_alpha(sample_rate, frequency, q);
+        auto const A = std::pow(10.0, gain / 40.0);
+        auto const beta = 2.0 * std::sqrt(A) * alpha;
+        return normalize(
+            A * ((A + 1.0) - (A - 1.0) * cos_w0 + beta),
+            2.0 * A * ((A - 1.0) - (A + 1.0) * cos_w0),
+            A * ((A + 1.0) - (A - 1.0) * cos_w0 - beta),
+            (A + 1.0) + (A - 1.0) * cos_w0 + beta,
+            -2.0 * ((A - 1.0) + (A + 1.0) * cos_w0),
+            (A + 1.0) + (A - 1.0) * cos_w0 - beta);
+    }
+
+    /** A high shelving filter.
+     *
+     * @param sample_rate The sample rate in Hz.
+     * @param frequency The corner frequency in Hz.
+     * @param q The quality factor, the steepness of the slope.
+     * @param gain The gain above the corner frequency in dB.
+     */
+    [[nodiscard]] static biquad_coefficients high_shelf(double sample_rate, double frequency, double q, double gain) noexcept
+    {
+        auto const [cos_w0, alpha] = cos_alpha(sample_rate, frequency, q);
+        auto const A = std::pow(10.0, gain / 40.0);
+        auto const beta = 2.0 * std::sqrt(A) * alpha;
+        return normalize(
+            A * ((A + 1.0) + (A - 1.0) * cos_w0 + beta),
+            -2.0 * A * ((A - 1.0) + (A + 1.0) * cos_w0),
+            A * ((A + 1.0) + (A - 1.0) * cos_w0 - beta),
+            (A + 1.0) - (A - 1.0) * cos_w0 + beta,
+            2.0 * ((A - 1.0) - (A + 1.0) * cos_w0),
+            (A + 1.0) - (A - 1.0) * cos_w0 - beta);
+    }
+
+private:
+    struct cos_alpha_type {
+        double cos_w0;
+        double alpha;
+    };
+
+    [[nodiscard]] static cos_alpha_type cos_alpha(double sample_rate, double frequency, double q) noexcept
+    {
+        hi_axiom(sample_rate > 0.0);
+        hi_axiom(frequency > 0.0 and frequency < sample_rate / 2.0);
+        hi_axiom(q > 0.0);
+
+        auto const w0 = 2.0 * std::numbers::pi * frequency / sample_rate;
+        return {std::cos(w0), std::sin(w0) / (2.0 * q)};
+    }
+
+    [[nodiscard]] static biquad_coefficients normalize(double b0, double b1, double b2, double a0, double a1, double a2) noexcept
+    {
+        return {
+            static_cast<float>(b0 / a0),
+            static_cast<float>(b1 / a0),
+            static_cast<float>(b2 / a0),
+            static_cast<float>(a1 / a0),
+            static_cast<float>(a2 / a0)};
+    }
+};
+
+/** A cascade of biquad filters for several channels.
+ *
+ * Each stage is a transposed direct form II biquad filter. The channels are
+ * processed in parallel, one channel in each lane of a `fast_simd` register;
+ * the coefficients and state are stored as structure-of-arrays so that a
+ * single sample of each stage is calculated with a handful of vector operations.
+ *
+ * Each channel may have its own coefficients for each stage, this allows
+ * for example a different equalizer on each speaker.
+ */
+class dsp_biquad_cascade {
+public:
+    using simd_type = fast_simd<float>;
+    constexpr static std::size_t num_lanes = std::tuple_size_v<simd_type>;
+
+    /** Create a cascade of pass-through filters.
+     *
+     * @param num_channels The number of channels to filter.
+     * @param num_stages The number of biquad filters in series.
+     */
+    dsp_biquad_cascade(std::size_t num_channels, std::size_t num_stages) :
+        _num_channels(num_channels),
+        _num_stages(num_stages),
+        _num_groups((num_channels + num_lanes - 1) / num_lanes),
+        _coefficients(_num_groups * num_stages, biquad_wide{}),
+        _state(_num_groups * num_stages, state_wide{})
+    {
+    }
+
+    [[nodiscard]] std::size_t num_channels() const noexcept
+    {
+        return _num_channels;
+    }
+
+    [[nodiscard]] std::size_t num_stages() const noexcept
+    {
+        return _num_stages;
+    }
+
+    /** Set the coefficients of a stage of a single channel.
+     */
+    void set_coefficients(std::size_t stage, std::size_t channel, biquad_coefficients const& coefficients) noexcept
+    {
+        hi_axiom(stage < _num_stages);
+        hi_axiom(channel < _num_channels);
+
+        auto& c = _coefficients[(channel / num_lanes) * _num_stages + stage];
+        auto const lane = channel % num_lanes;
+        c.b0[lane] = coefficients.b0;
+        c.b1[lane] = coefficients.b1;
+        c.b2[lane] = coefficients.b2;
+        c.a1[lane] = coefficients.a1;
+        c.a2[lane] = coefficients.a2;
+    }
+
+    /** Set the coefficients of a stage of all channels.
+     */
+    void set_coefficients(std::size_t stage, biquad_coefficients const& coefficients) noexcept
+    {
+        for (auto i = 0_uz; i != _num_channels; ++i) {
+            set_coefficients(stage, i, coefficients);
+        }
+    }
+
+    /** Clear the state of the filters.
+     *
+     * This should be called when the stream is discontinuous, so that the
+     * filters do not ring with the old audio.
+     */
+    void reset() noexcept
+    {
+        std::fill(_state.begin(), _state.end(), state_wide{});
+    }
+
+    /** Filter samples in place.
+     *
+     * @param channels A pointer to the samples of each channel, the number of channels must match.
+     * @param num_samples The number of samples in each channel.
+     */
+    void process(std::span<float *const> channels, std::size_t num_samples) noexcept
+    {
+        hi_axiom(channels.size() == _num_channels);
+
+        for (auto group = 0_uz; group != _num_groups; ++group) {
+            auto const first_channel = group * num_lanes;
+            auto const group_size = std::min(num_lanes, _num_channels - first_channel);
+            auto const *const coefficients = _coefficients.data() + group * _num_stages;
+            auto *const state = _state.data() + group * _num_stages;
+
+            for (auto i = 0_uz; i != num_samples; ++i) {
+                auto x = simd_type{};
+                for (auto lane = 0_uz; lane != group_size; ++lane) {
+                    x[lane] = channels[first_channel + lane][i];
+                }
+
+                for (auto stage = 0_uz; stage != _num_stages; ++stage) {
+                    auto const& c = coefficients[stage];
+                    auto& s = state[stage];
+
+                    auto const y = simd_type{c.b0 * x + s.z1};
+                    s.z1 = c.b1 * x - c.a1 * y + s.z2;
+                    s.z2 = c.b2 * x - c.a2 * y;
+                    x = y;
+                }
+
+                for (auto lane = 0_uz; lane != group_size; ++lane) {
+                    channels[first_channel + lane][i] = x[lane];
+                }
+            }
+        }
+    }
+
+private:
+    struct biquad_wide {
+        simd_type b0 = simd_type::broadcast(1.0f);
+        simd_type b1 = simd_type::make_zero();
+        simd_type b2 = simd_type::make_zero();
+        simd_type a1 = simd_type::make_zero();
+        simd_type a2 = simd_type::make_zero();
+    };
+
+    struct state_wide {
+        simd_type z1 = simd_type::make_zero();
+        simd_type z2 = simd_type::make_zero();
+    };
+
+    std::size_t _num_channels;
+    std::size_t _num_stages;
+
+    /** The number of groups of channels, each group fills the lanes of a simd register.
+     */
+    std::size_t _num_groups;
+
+    /** The coefficients for each group and stage: [group][stage].
+     */
+    std::vector<biquad_wide> _coefficients;
+
+    /** The state for each group and stage: [group][stage].
+     */
+    std::vector<state_wide> _state;
+};
+
+}} // namespace hi::inline v1
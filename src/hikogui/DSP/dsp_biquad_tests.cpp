@@ -0,0 +1,72 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_biquad.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <array>
+#include <cmath>
+
+TEST_SUITE(dsp_biquad_suite) {
+
+TEST_CASE(low_pass_dc_gain)
+{
+    auto const c = hi::biquad_coefficients::low_pass(48000.0, 1000.0);
+    auto const dc_gain = (c.b0 + c.b1 + c.b2) / (1.0f + c.a1 + c.a2);
+    REQUIRE(dc_gain == 1.0f, 0.0001f);
+}
+
+TEST_CASE(cascade_matches_scalar)
+{
+    // More channels than lanes, so that a partially filled group is processed.
+    constexpr auto num_channels = std::size_t{11};
+    constexpr auto num_samples = std::size_t{200};
+
+    auto const low_pass = hi::biquad_coefficients::low_pass(48000.0, 1000.0);
+    auto const peaking = hi::biquad_coefficients::peaking(48000.0, 3000.0, 1.0, 6.0);
+    auto const shelf = hi::biquad_coefficients::high_shelf(48000.0, 5000.0, 0.7, -3.0);
+
+    auto cascade = hi::dsp_biquad_cascade(num_channels, 2);
+    cascade.set_coefficients(0, low_pass);
+    cascade.set_coefficients(1, peaking);
+    cascade.set_coefficients(1, 1, shelf);
+
+    auto samples = std::vector<std::vector<float>>(num_channels, std::vector<float>(num_samples));
+    for (std::size_t i = 0; i != num_channels; ++i) {
+        for (std::size_t j = 0; j != num_samples; ++j) {
+            samples[i][j] = std::sin(static_cast<float>(j) * 0.1f * static_cast<float>(i + 1));
+        }
+    }
+    auto const input = samples;
+
+    // Process in two parts, to check that the state is kept between calls.
+    auto channels = std::vector<float *>{};
+    for (auto& channel : samples) {
+        channels.push_back(channel.data());
+    }
+    cascade.process(channels, 120);
+    for (auto& channel : channels) {
+        channel += 120;
+    }
+    cascade.process(channels, num_samples - 120);
+
+    for (std::size_t i = 0; i != num_channels; ++i) {
+        auto const stages = std::array{low_pass, i == 1 ? shelf : peaking};
+        auto z = std::array<std::array<float, 2>, 2>{};
+
+        for (std::size_t j = 0; j != num_samples; ++j) {
+            auto x = input[i][j];
+            for (std::size_t k = 0; k != 2; ++k) {
+                auto const& c = stages[k];
+                auto const y = c.b0 * x + z[k][0];
+                z[k][0] = c.b1 * x - c.a1 * y + z[k][1];
+                z[k][1] = c.b2 * x - c.a2 * y;
+                x = y;
+            }
+            REQUIRE(samples[i][j] == x, 0.00001f);
+        }
+    }
+}
+
+};
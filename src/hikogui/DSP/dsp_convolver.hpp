@@ -0,0 +1,233 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "dsp_fft.hpp"
+#include "dsp_float.hpp"
+#include "../audio/audio_block.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <vector>
+#include <span>
+#include <bit>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+
+hi_export_module(hikogui.DSP.dsp_convolver);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Convolution of audio with a long impulse response.
+ *
+ * This is a uniformly partitioned overlap-save convolver. The impulse response
+ * is split into partitions of the block size, each partition is convolved in the
+ * frequency domain with the spectrum of the input from an equally delayed block.
+ * The latency is a single block, while the cost grows only with the number of
+ * partitions and not with the square of the length of the impulse response.
+ *
+ * Each channel has its own history, all channels are convolved with the same
+ * impulse response. All buffers are allocated in the constructor, so that
+ * `process()` can be called from the audio thread.
+ */
+class dsp_convolver {
+public:
+    using simd_type = fast_simd<float>;
+
+    /** Prepare the convolver.
+     *
+     * @param num_channels The number of channels to convolve.
+     * @param block_size The number of samples of each block passed to `process()`,
+     *                   must be a power of two and at least 4.
+     * @param impulse_response The impulse response of the filter.
+     */
+    dsp_convolver(std::size_t num_channels, std::size_t block_size, std::span<float const> impulse_response) :
+        _num_channels(num_channels),
+        _block_size(block_size),
+        _num_partitions(std::max(1_uz, (impulse_response.size() + block_size - 1) / block_size)),
+        _fft(block_size * 2)
+    {
+        hi_assert(num_channels != 0);
+        hi_assert(std::has_single_bit(block_size) and block_size >= 4);
+
+        auto const fft_size = _fft.size();
+
+        _filter_re.resize(_num_partitions * fft_size, 0.0f);
+        _filter_im.resize(_num_partitions * fft_size, 0.0f);
+        for (auto i = 0_uz; i != _num_partitions; ++i) {
+            auto const offset = i * block_size;
+            auto const size = std::min(block_size, impulse_response.size() - std::min(offset, impulse_response.size()));
+
+            auto const re = std::span{_filter_re.data() + i * fft_size, fft_size};
+            auto const im = std::span{_filter_im.data() + i * fft_size, fft_size};
+            std::copy_n(impulse_response.data() + offset, size, re.data());
+            _fft.forward(re, im);
+        }
+
+        _input.resize(_num_channels * fft_size, 0.0f);
+        _history_re.resize(_num_channels * _num_partitions * fft_size, 0.0f);
+        _history_im.resize(_num_channels * _num_partitions * fft_size, 0.0f);
+        _history_index.resize(_num_channels, 0);
+        _work_re.resize(fft_size);
+        _work_im.resize(fft_size);
+    }
+
+    [[nodiscard]] std::size_t num_channels() const noexcept
+    {
+        return _num_channels;
+    }
+
+    [[nodiscard]] std::size_t block_size() const noexcept
+    {
+        return _block_size;
+    }
+
+    /** Clear the history of a channel.
+     */
+    void reset(std::size_t channel) noexcept
+    {
+        hi_axiom(channel < _num_channels);
+
+        auto const fft_size = _fft.size();
+        std::fill_n(_input.data() + channel * fft_size, fft_size, 0.0f);
+        std::fill_n(_history_re.data() + channel * _num_partitions * fft_size, _num_partitions * fft_size, 0.0f);
+        std::fill_n(_history_im.data() + channel * _num_partitions * fft_size, _num_partitions * fft_size, 0.0f);
+        _history_index[channel] = 0;
+    }
+
+    /** Convolve a block of samples of a channel in place.
+     *
+     * @param channel The channel to convolve.
+     * @param samples The samples, must be `block_size()` in length.
+     */
+    void process(std::size_t channel, std::span<float> samples) noexcept
+    {
+        hi_axiom(channel < _num_channels);
+        hi_axiom(samples.size() == _block_size);
+
+        auto const fft_size = _fft.size();
+        auto const work_re = std::span{_work_re};
+        auto const work_im = std::span{_work_im};
+
+        // Slide the input window by one block.
+        auto *const input = _input.data() + channel * fft_size;
+        std::memmove(input, input + _block_size, _block_size * sizeof(float));
+        std::memcpy(input + _block_size, samples.data(), _block_size * sizeof(float));
+
+        // Add the spectrum of the input window to the frequency-domain delay line.
+        auto& history_index = _history_index[channel];
+        auto *const history_re = _history_re.data() + channel * _num_partitions * fft_size;
+        auto *const history_im = _history_im.data() + channel * _num_partitions * fft_size;
+        auto const slot_re = std::span{history_re + history_index * fft_size, fft_size};
+        auto const slot_im = std::span{history_im + history_index * fft_size, fft_size};
+        std::memcpy(slot_re.data(), input, fft_size * sizeof(float));
+        std::fill(slot_im.begin(), slot_im.end(), 0.0f);
+        _fft.forward(slot_re, slot_im);
+
+        // Multiply each partition of the filter with the spectrum of the input that is delayed by as many blocks.
+        std::fill(work_re.begin(), work_re.end(), 0.0f);
+        std::fill(work_im.begin(), work_im.end(), 0.0f);
+        for (auto i = 0_uz; i != _num_partitions; ++i) {
+            auto const j = (history_index + _num_partitions - i) % _num_partitions;
+            multiply_accumulate(
+                history_re + j * fft_size,
+                history_im + j * fft_size,
+                _filter_re.data() + i * fft_size,
+                _filter_im.data() + i * fft_size);
+        }
+
+        if (++history_index == _num_partitions) {
+            history_index = 0;
+        }
+
+        // The first half of the result is aliased by the circular convolution, the second half is the output.
+        _fft.inverse(work_re, work_im);
+        std::memcpy(samples.data(), _work_re.data() + _block_size, _block_size * sizeof(float));
+    }
+
+    /** Convolve all channels of an audio block in place.
+     *
+     * A silent block is convolved as well, as the tail of the impulse response
+     * will still sound. A corrupt block is not touched and clears the history,
+     * so that the corruption does not ring.
+     *
+     * @param block The block, with `num_channels()` channels of `block_size()` samples.
+     */
+    void process(audio_block& block) noexcept
+    {
+        hi_axiom(block.num_channels == _num_channels);
+        hi_axiom(block.num_samples == _block_size);
+
+        if (block.state == audio_block_state::corrupt) {
+            for (auto i = 0_uz; i != _num_channels; ++i) {
+                reset(i);
+            }
+            return;
+        }
+
+        for (auto i = 0_uz; i != _num_channels; ++i) {
+            process(i, std::span{block.samples[i], _block_size});
+        }
+        block.state = audio_block_state::normal;
+    }
+
+private:
+    std::size_t _num_channels;
+    std::size_t _block_size;
+    std::size_t _num_partitions;
+    dsp_fft<float> _fft;
+
+    /** The spectrum of each partition of the impulse response: [partition][bin].
+     */
+    std::vector<float> _filter_re;
+    std::vector<float> _filter_im;
+
+    /** The last two blocks of input of each channel: [channel][sample].
+     */
+    std::vector<float> _input;
+
+    /** The frequency-domain delay line, the spectra of the last input windows: [channel][partition][bin].
+     */
+    std::vector<float> _history_re;
+    std::vector<float> _history_im;
+
+    /** The slot in the delay line of the newest spectrum of each channel.
+     */
+    std::vector<std::size_t> _history_index;
+
+    std::vector<float> _work_re;
+    std::vector<float> _work_im;
+
+    /** Complex multiply the spectrum @a x with @a h, and add to the work buffer.
+     */
+    void multiply_accumulate(float const *x_re, float const *x_im, float const *h_re, float const *h_im) noexcept
+    {
+        using S = simd_type;
+        constexpr auto stride = std::tuple_size_v<S>;
+
+        auto const fft_size = _fft.size();
+        auto *const r_re = _work_re.data();
+        auto *const r_im = _work_im.data();
+
+        auto i = 0_uz;
+        for (; i + stride <= fft_size; i += stride) {
+            auto const a_re = dsp_load<S>(x_re + i);
+            auto const a_im = dsp_load<S>(x_im + i);
+            auto const b_re = dsp_load<S>(h_re + i);
+            auto const b_im = dsp_load<S>(h_im + i);
+
+            dsp_store(S{dsp_load<S>(r_re + i) + a_re * b_re - a_im * b_im}, r_re + i);
+            dsp_store(S{dsp_load<S>(r_im + i) + a_re * b_im + a_im * b_re}, r_im + i);
+        }
+
+        for (; i != fft_size; ++i) {
+            r_re[i] += x_re[i] * h_re[i] - x_im[i] * h_im[i];
+            r_im[i] += x_re[i] * h_im[i] + x_im[i] * h_re[i];
+        }
+    }
+};
+
+}} // namespace hi::inline v1
@@ -0,0 +1,84 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_convolver.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <array>
+#include <cmath>
+
+/** Compare the convolver with a direct convolution.
+ */
+static void check_convolution(std::size_t block_size, std::size_t ir_size)
+{
+    auto impulse_response = std::vector<float>(ir_size);
+    for (std::size_t i = 0; i != ir_size; ++i) {
+        impulse_response[i] = std::sin(static_cast<float>(i) * 1.3f) / static_cast<float>(i + 1);
+    }
+
+    auto convolver = hi::dsp_convolver(1, block_size, impulse_response);
+
+    auto const num_samples = (ir_size / block_size + 4) * block_size;
+    auto input = std::vector<float>(num_samples);
+    for (std::size_t i = 0; i != num_samples; ++i) {
+        input[i] = std::cos(static_cast<float>(i * i) * 0.1f);
+    }
+
+    auto output = input;
+    for (std::size_t i = 0; i != num_samples; i += block_size) {
+        convolver.process(0, std::span{output.data() + i, block_size});
+    }
+
+    for (std::size_t i = 0; i != num_samples; ++i) {
+        auto expected = 0.0f;
+        for (std::size_t j = 0; j != ir_size and j <= i; ++j) {
+            expected += impulse_response[j] * input[i - j];
+        }
+        REQUIRE(output[i] == expected, 0.001f);
+    }
+}
+
+TEST_SUITE(dsp_convolver_suite) {
+
+TEST_CASE(short_impulse_response)
+{
+    check_convolution(16, 1);
+    check_convolution(16, 5);
+}
+
+TEST_CASE(partitioned_impulse_response)
+{
+    check_convolution(4, 17);
+    check_convolution(16, 100);
+    check_convolution(64, 513);
+}
+
+TEST_CASE(corrupt_block_resets)
+{
+    auto const impulse_response = std::array<float, 8>{1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+    auto convolver = hi::dsp_convolver(1, 4, impulse_response);
+
+    auto samples = std::array<float, 4>{1.0f, 0.0f, 0.0f, 0.0f};
+    auto channels = std::array<float *, 1>{samples.data()};
+    auto block = hi::audio_block{};
+    block.samples = channels.data();
+    block.num_channels = 1;
+    block.num_samples = 4;
+    block.state = hi::audio_block_state::normal;
+    convolver.process(block);
+    REQUIRE(samples[3] == 1.0f, 0.0001f);
+
+    block.state = hi::audio_block_state::corrupt;
+    convolver.process(block);
+
+    // The impulse from before the corruption no longer rings.
+    samples = std::array<float, 4>{};
+    block.state = hi::audio_block_state::silent;
+    convolver.process(block);
+    REQUIRE(block.state == hi::audio_block_state::normal);
+    REQUIRE(samples[0] == 0.0f, 0.0001f);
+    REQUIRE(samples[3] == 0.0f, 0.0001f);
+}
+
+};
@@ -0,0 +1,182 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "dsp_float.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <numbers>
+#include <vector>
+#include <span>
+#include <bit>
+#include <cmath>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.DSP.dsp_fft);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A fast Fourier transform.
+ *
+ * The transform works in-place on split-complex data; the real and imaginary
+ * parts are stored in separate arrays, so that four butterflies are
+ * calculated at once with `simd<T, 4>` without shuffling.
+ *
+ * The transform is an iterative decimation-in-time FFT. The first two stages
+ * are combined into a single radix-4 pass, the remaining stages are radix-2.
+ *
+ * @tparam T The numeric type, float or double.
+ */
+template<typename T>
+class dsp_fft {
+public:
+    using value_type = T;
+    using simd_type = simd<T, 4>;
+
+    /** Prepare the transform.
+     *
+     * @param size The number of complex values, must be a power of two and at least 4.
+     */
+    explicit dsp_fft(std::size_t size) : _size(size), _bit_reverse(size), _twiddle_re(size), _twiddle_im(size)
+    {
+        hi_assert(std::has_single_bit(size));
+        hi_assert(size >= 4);
+
+        auto const num_bits = std::countr_zero(size);
+        for (auto i = 0_uz; i != size; ++i) {
+            auto r = 0_uz;
+            for (auto b = 0; b != num_bits; ++b) {
+                r |= ((i >> b) & 1) << (num_bits - 1 - b);
+            }
+            _bit_reverse[i] = narrow_cast<uint32_t>(r);
+        }
+
+        // The twiddle factors of the stage with butterflies of `half` apart are
+        // stored at `half - 1`; consecutive, so that they can be loaded as a vector.
+        for (auto half = 1_uz; half != size; half *= 2) {
+            for (auto k = 0_uz; k != half; ++k) {
+                auto const angle = std::numbers::pi * static_cast<double>(k) / static_cast<double>(half);
+                _twiddle_re[half - 1 + k] = static_cast<T>(std::cos(angle));
+                _twiddle_im[half - 1 + k] = static_cast<T>(-std::sin(angle));
+            }
+        }
+    }
+
+    /** The number of complex values of the transform.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    /** Forward transform.
+     *
+     * The result is not scaled.
+     *
+     * @param re The real part of the values, replaced with the real part of the spectrum.
+     * @param im The imaginary part of the values, replaced with the imaginary part of the spectrum.
+     */
+    void forward(std::span<T> re, std::span<T> im) const noexcept
+    {
+        hi_axiom(re.size() == _size);
+        hi_axiom(im.size() == _size);
+        transform(re.data(), im.data());
+    }
+
+    /** Inverse transform.
+     *
+     * The result is scaled by `1 / size()`, so that `inverse(forward(x)) == x`.
+     *
+     * @param re The real part of the spectrum, replaced with the real part of the values.
+     * @param im The imaginary part of the spectrum, replaced with the imaginary part of the values.
+     */
+    void inverse(std::span<T> re, std::span<T> im) const noexcept
+    {
+        hi_axiom(re.size() == _size);
+        hi_axiom(im.size() == _size);
+
+        // Swapping the real and imaginary parts on input and output turns
+        // the forward transform into the inverse transform.
+        transform(im.data(), re.data());
+
+        auto const scale = T{1} / static_cast<T>(_size);
+        dsp_mul(re, scale);
+        dsp_mul(im, scale);
+    }
+
+private:
+    std::size_t _size;
+    std::vector<uint32_t> _bit_reverse;
+    std::vector<T> _twiddle_re;
+    std::vector<T> _twiddle_im;
+
+    void transform(T *re, T *im) const noexcept
+    {
+        for (auto i = 0_uz; i != _size; ++i) {
+            if (auto const j = _bit_reverse[i]; i < j) {
+                std::swap(re[i], re[j]);
+                std::swap(im[i], im[j]);
+            }
+        }
+
+        // The first two stages as a radix-4 butterfly, their twiddle factors are 1 and -i.
+        for (auto i = 0_uz; i != _size; i += 4) {
+            auto const a0_re = re[i] + re[i + 1];
+            auto const a0_im = im[i] + im[i + 1];
+            auto const a1_re = re[i] - re[i + 1];
+            auto const a1_im = im[i] - im[i + 1];
+            auto const a2_re = re[i + 2] + re[i + 3];
+            auto const a2_im = im[i + 2] + im[i + 3];
+            auto const a3_re = re[i + 2] - re[i + 3];
+            auto const a3_im = im[i + 2] - im[i + 3];
+
+            re[i] = a0_re + a2_re;
+            im[i] = a0_im + a2_im;
+            re[i + 2] = a0_re - a2_re;
+            im[i + 2] = a0_im - a2_im;
+            // a1 + -i * a3
+            re[i + 1] = a1_re + a3_im;
+            im[i + 1] = a1_im - a3_re;
+            // a1 - -i * a3
+            re[i + 3] = a1_re - a3_im;
+            im[i + 3] = a1_im + a3_re;
+        }
+
+        using S = simd_type;
+        for (auto half = 4_uz; half < _size; half *= 2) {
+            auto const *const twiddle_re = _twiddle_re.data() + half - 1;
+            auto const *const twiddle_im = _twiddle_im.data() + half - 1;
+
+            for (auto base = 0_uz; base != _size; base += half * 2) {
+                auto *const re0 = re + base;
+                auto *const im0 = im + base;
+                auto *const re1 = re0 + half;
+                auto *const im1 = im0 + half;
+
+                for (auto k = 0_uz; k != half; k += 4) {
+                    auto const w_re = dsp_load<S>(twiddle_re + k);
+                    auto const w_im = dsp_load<S>(twiddle_im + k);
+                    auto const a_re = dsp_load<S>(re0 + k);
+                    auto const a_im = dsp_load<S>(im0 + k);
+                    auto const b_re = dsp_load<S>(re1 + k);
+                    auto const b_im = dsp_load<S>(im1 + k);
+
+                    auto const t_re = S{b_re * w_re - b_im * w_im};
+                    auto const t_im = S{b_re * w_im + b_im * w_re};
+
+                    dsp_store(S{a_re + t_re}, re0 + k);
+                    dsp_store(S{a_im + t_im}, im0 + k);
+                    dsp_store(S{a_re - t_re}, re1 + k);
+                    dsp_store(S{a_im - t_im}, im1 + k);
+                }
+            }
+        }
+    }
+};
+
+}} // namespace hi::inline v1
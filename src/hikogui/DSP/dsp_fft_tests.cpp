@@ -0,0 +1,63 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_fft.hpp"
+#include <hikotest/hikotest.hpp>
+#include <numbers>
+#include <complex>
+#include <vector>
+#include <cmath>
+
+/** Compare the FFT with a direct calculation of the discrete Fourier transform.
+ */
+template<typename T>
+static void check_dft(std::size_t size, double tolerance)
+{
+    auto re = std::vector<T>(size);
+    auto im = std::vector<T>(size);
+    for (std::size_t i = 0; i != size; ++i) {
+        re[i] = static_cast<T>(std::sin(static_cast<double>(i) * 0.7) + 0.25);
+        im[i] = static_cast<T>(std::cos(static_cast<double>(i * i) * 0.3));
+    }
+    auto const input_re = re;
+    auto const input_im = im;
+
+    auto const fft = hi::dsp_fft<T>(size);
+    fft.forward(re, im);
+
+    for (std::size_t k = 0; k != size; ++k) {
+        auto expected = std::complex<double>{};
+        for (std::size_t i = 0; i != size; ++i) {
+            auto const angle = -2.0 * std::numbers::pi * static_cast<double>((i * k) % size) / static_cast<double>(size);
+            expected += std::complex<double>(input_re[i], input_im[i]) * std::polar(1.0, angle);
+        }
+        REQUIRE(static_cast<double>(re[k]) == expected.real(), tolerance);
+        REQUIRE(static_cast<double>(im[k]) == expected.imag(), tolerance);
+    }
+
+    fft.inverse(re, im);
+    for (std::size_t i = 0; i != size; ++i) {
+        REQUIRE(static_cast<double>(re[i]) == static_cast<double>(input_re[i]), tolerance);
+        REQUIRE(static_cast<double>(im[i]) == static_cast<double>(input_im[i]), tolerance);
+    }
+}
+
+TEST_SUITE(dsp_fft_suite) {
+
+TEST_CASE(float_dft)
+{
+    check_dft<float>(4, 0.0001);
+    check_dft<float>(8, 0.0001);
+    check_dft<float>(64, 0.001);
+    check_dft<float>(512, 0.01);
+}
+
+TEST_CASE(double_dft)
+{
+    check_dft<double>(4, 0.000000001);
+    check_dft<double>(32, 0.000000001);
+    check_dft<double>(1024, 0.000000001);
+}
+
+};
@@ -1,21 +1,43 @@
-
 #pragma once
 
+#include "../utility/utility.hpp"
 #include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <span>
+#include <cstring>
+#include <cstddef>
+#include <type_traits>
 
 hi_export_module(hikogui.DSP.dsp_float);
 
 hi_export namespace hi {
 inline namespace v1 {
 
-template<typename Context>
-concept dsp_argument =
-    std::same_as<Context, float> or
-    std::same_as<Context. double> or
-    std::same_as<Context. std::span<float>> or
-    std::same_as<Context. std::span<double>> or
-    std::same_as<Context. std::span<float const>> or
-    std::same_as<Context. std::span<double const>>;
+/** The SIMD type used by the DSP kernels to process values of type T.
+ *
+ * A 256 bit wide register is used, the compiler lowers the operations on
+ * this type to AVX, or two SSE operations, depending on the architecture.
+ */
+template<typename T>
+using fast_simd = simd<T, 32 / sizeof(T)>;
+
+/** Load values from unaligned memory.
+ */
+template<typename S>
+[[nodiscard]] S dsp_load(typename S::value_type const *ptr) noexcept
+{
+    auto r = S{};
+    std::memcpy(r.data(), ptr, sizeof(S));
+    return r;
+}
+
+/** Store values into unaligned memory.
+ */
+template<typename S>
+void dsp_store(S const& value, typename S::value_type *ptr) noexcept
+{
+    std::memcpy(ptr, value.data(), sizeof(S));
+}
 
 template<typename T, typename Op>
 void dsp_visit(std::span<T> r, std::span<T const> a, std::span<T const> b, Op op) noexcept
@@ -24,10 +46,10 @@ void dsp_visit(std::span<T> r, std::span<T const> a, std::span<T const> b, Op op
     hi_axiom(r.size() == b.size());
 
     using S = fast_simd<T>;
-    constexpr auto stride = S::size;
+    constexpr auto stride = std::tuple_size_v<S>;
 
-    auto size = r.size();
-    auto wide_size = (size / stride) * stride;
+    auto const size = r.size();
+    auto const wide_size = (size / stride) * stride;
 
     auto r_ = r.data();
     auto a_ = a.data();
@@ -35,15 +57,15 @@ void dsp_visit(std::span<T> r, std::span<T const> a, std::span<T const> b, Op op
 
     auto const a_wide_end = a.data() + wide_size;
     while (a_ != a_wide_end) {
-        op(S{a_}, S{b_}).store(r_);
+        dsp_store(S{op(dsp_load<S>(a_), dsp_load<S>(b_))}, r_);
 
         a_ += stride;
         b_ += stride;
         r_ += stride;
     }
 
-    auto const a_end = a_ptr + size;
-    while (a_ != size) {
+    auto const a_end = a.data() + size;
+    while (a_ != a_end) {
         *r_++ = op(*a_++, *b_++);
     }
 }
@@ -54,10 +76,10 @@ void dsp_visit(std::span<T> r, std::span<T const> a, T b, Op op) noexcept
     hi_axiom(r.size() == a.size());
 
     using S = fast_simd<T>;
-    constexpr auto stride = S::size;
+    constexpr auto stride = std::tuple_size_v<S>;
 
-    auto size = r.size();
-    auto wide_size = (size / stride) * stride;
+    auto const size = r.size();
+    auto const wide_size = (size / stride) * stride;
 
     auto r_ = r.data();
     auto a_ = a.data();
@@ -65,61 +87,96 @@ void dsp_visit(std::span<T> r, std::span<T const> a, T b, Op op) noexcept
     auto const b_wide = S::broadcast(b);
     auto const a_wide_end = a.data() + wide_size;
     while (a_ != a_wide_end) {
-        op(S{a_}, b_wide).store(r_);
+        dsp_store(S{op(dsp_load<S>(a_), b_wide)}, r_);
 
         a_ += stride;
         r_ += stride;
     }
 
-    auto const a_end = a_ptr + size;
-    while (a_ != size) {
+    auto const a_end = a.data() + size;
+    while (a_ != a_end) {
         *r_++ = op(*a_++, b);
     }
 }
 
 template<typename T, typename Op>
-void dsp_visit(std::span<float> r, float a, Op op) noexcept
+void dsp_visit(std::span<T> r, T a, Op op) noexcept
 {
-    using S = fast_simd<float>;
-    constexpr auto stride = S::size;
+    using S = fast_simd<T>;
+    constexpr auto stride = std::tuple_size_v<S>;
 
     auto const size = r.size();
     auto const wide_size = (size / stride) * stride;
 
-    auto r_ = a.data();
-    auto const a_ = S::broadcast(b);
+    auto r_ = r.data();
 
+    auto const a_wide = S::broadcast(a);
     auto const r_wide_end = r.data() + wide_size;
     while (r_ != r_wide_end) {
-        op(S{r_} + a_wide).store(r_);
+        dsp_store(S{op(dsp_load<S>(r_), a_wide)}, r_);
 
-        a_ += stride;
+        r_ += stride;
     }
 
-    auto const r_end = r_ + size;
-    while (r_ != size) {
-        *r_++ += a;
+    auto const r_end = r.data() + size;
+    while (r_ != r_end) {
+        *r_ = op(*r_, a);
+        ++r_;
     }
 }
 
-void dsp_add(dsp_argument auto... args) noexcept
+template<typename T>
+void dsp_add(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b) noexcept
 {
-    return dsp_operator(args..., [](auto a, auto b) { return a + b; });
+    return dsp_visit(r, a, b, [](auto a, auto b) { return a + b; });
 }
 
-void dsp_sub(dsp-argument auto... args) noexcept
+template<typename T>
+void dsp_add(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::type_identity_t<T> b) noexcept
 {
-    return dsp_operator(args..., [](auto a, auto b) { return a - b; });
+    return dsp_visit(r, a, b, [](auto a, auto b) { return a + b; });
 }
 
-void dsp_mul(dsp-argument auto... args) noexcept
+template<typename T>
+void dsp_add(std::span<T> r, std::type_identity_t<T> a) noexcept
 {
-    return dsp_operator(args..., [](auto a, auto b) { return a * b; });
+    return dsp_visit(r, a, [](auto a, auto b) { return a + b; });
 }
 
+template<typename T>
+void dsp_sub(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b) noexcept
+{
+    return dsp_visit(r, a, b, [](auto a, auto b) { return a - b; });
+}
 
+template<typename T>
+void dsp_sub(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::type_identity_t<T> b) noexcept
+{
+    return dsp_visit(r, a, b, [](auto a, auto b) { return a - b; });
+}
 
+template<typename T>
+void dsp_sub(std::span<T> r, std::type_identity_t<T> a) noexcept
+{
+    return dsp_visit(r, a, [](auto a, auto b) { return a - b; });
+}
 
+template<typename T>
+void dsp_mul(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b) noexcept
+{
+    return dsp_visit(r, a, b, [](auto a, auto b) { return a * b; });
+}
+
+template<typename T>
+void dsp_mul(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::type_identity_t<T> b) noexcept
+{
+    return dsp_visit(r, a, b, [](auto a, auto b) { return a * b; });
+}
 
-}}
+template<typename T>
+void dsp_mul(std::span<T> r, std::type_identity_t<T> a) noexcept
+{
+    return dsp_visit(r, a, [](auto a, auto b) { return a * b; });
+}
 
+}} // namespace hi::inline v1
@@ -0,0 +1,78 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "dsp_float.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <span>
+#include <cstddef>
+
+hi_export_module(hikogui.DSP.dsp_gain);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Multiply samples with a linearly changing gain.
+ *
+ * The gain of sample `i` is `start_gain + (end_gain - start_gain) * i / n`, so that
+ * a following call that starts at @a end_gain continues the ramp without a step.
+ * This is used to change the volume of a channel without audible zipper-noise.
+ *
+ * @param r The output samples.
+ * @param a The input samples, may be the same as @a r.
+ * @param start_gain The gain of the first sample.
+ * @param end_gain The gain of the sample following the last sample.
+ */
+inline void dsp_gain_ramp(std::span<float> r, std::span<float const> a, float start_gain, float end_gain) noexcept
+{
+    hi_axiom(r.size() == a.size());
+
+    using S = fast_simd<float>;
+    constexpr auto stride = std::tuple_size_v<S>;
+
+    auto const size = r.size();
+    if (size == 0) {
+        return;
+    }
+
+    auto const wide_size = (size / stride) * stride;
+    auto const step = (end_gain - start_gain) / static_cast<float>(size);
+
+    auto r_ = r.data();
+    auto a_ = a.data();
+
+    // Calculate the gain from the index of each sample, instead of accumulating
+    // the step, so that rounding errors do not build up over a long block.
+    auto lane_index = S{};
+    for (auto i = 0_uz; i != stride; ++i) {
+        lane_index[i] = static_cast<float>(i);
+    }
+
+    auto const step_wide = S::broadcast(step);
+    auto const start_wide = S::broadcast(start_gain);
+    auto i = 0_uz;
+    for (; i != wide_size; i += stride) {
+        auto const gain = start_wide + (lane_index + S::broadcast(static_cast<float>(i))) * step_wide;
+        dsp_store(S{dsp_load<S>(a_) * gain}, r_);
+
+        a_ += stride;
+        r_ += stride;
+    }
+
+    for (; i != size; ++i) {
+        *r_++ = *a_++ * (start_gain + static_cast<float>(i) * step);
+    }
+}
+
+/** Multiply samples in place with a linearly changing gain.
+ *
+ * @see dsp_gain_ramp(std::span<float>, std::span<float const>, float, float)
+ */
+inline void dsp_gain_ramp(std::span<float> r, float start_gain, float end_gain) noexcept
+{
+    return dsp_gain_ramp(r, std::span<float const>{r}, start_gain, end_gain);
+}
+
+}} // namespace hi::inline v1
@@ -0,0 +1,100 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "dsp_float.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <span>
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+
+hi_export_module(hikogui.DSP.dsp_meter);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** The peak absolute value of the samples.
+ *
+ * @param a The samples.
+ * @return The largest absolute sample value, or zero when there are no samples.
+ */
+[[nodiscard]] inline float dsp_peak(std::span<float const> a) noexcept
+{
+    using S = fast_simd<float>;
+    constexpr auto stride = std::tuple_size_v<S>;
+
+    auto const size = a.size();
+    auto const wide_size = (size / stride) * stride;
+
+    auto a_ = a.data();
+    auto const a_wide_end = a.data() + wide_size;
+    auto peak_wide = S::make_zero();
+    while (a_ != a_wide_end) {
+        peak_wide = max(peak_wide, S{abs(dsp_load<S>(a_))});
+        a_ += stride;
+    }
+
+    auto peak = 0.0f;
+    for (auto i = 0_uz; i != stride; ++i) {
+        peak = std::max(peak, peak_wide[i]);
+    }
+
+    auto const a_end = a.data() + size;
+    while (a_ != a_end) {
+        peak = std::max(peak, std::abs(*a_++));
+    }
+    return peak;
+}
+
+/** The sum of the squares of the samples.
+ *
+ * The sum is returned, instead of the mean, so that a meter can accumulate
+ * it over several blocks of different sizes.
+ *
+ * @param a The samples.
+ * @return The sum of the squares of each sample.
+ */
+[[nodiscard]] inline float dsp_sum_of_squares(std::span<float const> a) noexcept
+{
+    using S = fast_simd<float>;
+    constexpr auto stride = std::tuple_size_v<S>;
+
+    auto const size = a.size();
+    auto const wide_size = (size / stride) * stride;
+
+    auto a_ = a.data();
+    auto const a_wide_end = a.data() + wide_size;
+    auto sum_wide = S::make_zero();
+    while (a_ != a_wide_end) {
+        auto const a_wide = dsp_load<S>(a_);
+        sum_wide = sum_wide + a_wide * a_wide;
+        a_ += stride;
+    }
+
+    auto r = sum(sum_wide).x();
+
+    auto const a_end = a.data() + size;
+    while (a_ != a_end) {
+        r += *a_ * *a_;
+        ++a_;
+    }
+    return r;
+}
+
+/** The root-mean-square of the samples.
+ *
+ * @param a The samples.
+ * @return The RMS value of the samples, or zero when there are no samples.
+ */
+[[nodiscard]] inline float dsp_rms(std::span<float const> a) noexcept
+{
+    if (a.empty()) {
+        return 0.0f;
+    }
+    return std::sqrt(dsp_sum_of_squares(a) / static_cast<float>(a.size()));
+}
+
+}} // namespace hi::inline v1
@@ -0,0 +1,209 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "dsp_mul.hpp"
+#include "../audio/speaker_mapping.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <span>
+#include <array>
+#include <bit>
+#include <algorithm>
+#include <cstddef>
+
+hi_export_module(hikogui.DSP.dsp_mix);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A matrix to mix a set of input channels into a set of output channels.
+ *
+ * The matrix can be created from the speaker mappings of the input and output,
+ * in which case speakers in the input that do not exist in the output are
+ * folded into the nearest speakers of the output. For example, when the output
+ * is stereo, the center speaker is mixed into the left and right at -3 dB.
+ *
+ * The channels of a speaker mapping are ordered from the least significant bit
+ * of the mapping to the most significant bit.
+ */
+class dsp_mix_matrix {
+public:
+    /** Create a matrix with all gains set to zero.
+     */
+    dsp_mix_matrix(std::size_t num_inputs, std::size_t num_outputs) :
+        _num_inputs(num_inputs), _num_outputs(num_outputs), _gains(num_inputs * num_outputs, 0.0f)
+    {
+    }
+
+    /** Create a matrix to mix between two speaker mappings.
+     *
+     * @param input The speaker mapping of the input channels.
+     * @param output The speaker mapping of the output channels.
+     */
+    dsp_mix_matrix(speaker_mapping input, speaker_mapping output) : dsp_mix_matrix(popcount(input), popcount(output))
+    {
+        auto input_index = 0_uz;
+        for (auto input_mask = std::to_underlying(input); input_mask != 0; input_mask &= input_mask - 1) {
+            auto const speaker = static_cast<speaker_mapping>(input_mask & (~input_mask + 1));
+            route(output, input_index++, speaker, 1.0f, max_route_depth, true);
+        }
+    }
+
+    [[nodiscard]] std::size_t num_inputs() const noexcept
+    {
+        return _num_inputs;
+    }
+
+    [[nodiscard]] std::size_t num_outputs() const noexcept
+    {
+        return _num_outputs;
+    }
+
+    [[nodiscard]] float gain(std::size_t output, std::size_t input) const noexcept
+    {
+        hi_axiom(output < _num_outputs);
+        hi_axiom(input < _num_inputs);
+        return _gains[output * _num_inputs + input];
+    }
+
+    void set_gain(std::size_t output, std::size_t input, float gain) noexcept
+    {
+        hi_axiom(output < _num_outputs);
+        hi_axiom(input < _num_inputs);
+        _gains[output * _num_inputs + input] = gain;
+    }
+
+    /** Mix the input channels into the output channels.
+     *
+     * @param inputs A pointer to the samples of each input channel.
+     * @param outputs A pointer to the samples of each output channel, must not overlap with the inputs.
+     * @param num_samples The number of samples in each channel.
+     */
+    void mix(std::span<float const *const> inputs, std::span<float *const> outputs, std::size_t num_samples) const noexcept
+    {
+        hi_axiom(inputs.size() == _num_inputs);
+        hi_axiom(outputs.size() == _num_outputs);
+
+        for (auto i = 0_uz; i != _num_outputs; ++i) {
+            std::fill_n(outputs[i], num_samples, 0.0f);
+
+            for (auto j = 0_uz; j != _num_inputs; ++j) {
+                if (auto const g = gain(i, j); g != 0.0f) {
+                    dsp_mul_acc(inputs[j], g, outputs[i], num_samples);
+                }
+            }
+        }
+    }
+
+private:
+    constexpr static float minus_3dB = 0.70710678f;
+    constexpr static int max_route_depth = 4;
+
+    /** An alternative to a speaker that is missing in the output.
+     *
+     * @param targets One or two speakers in which to mix the missing speaker.
+     * @param gain The gain to apply to each of the targets.
+     */
+    struct fold_type {
+        speaker_mapping targets = speaker_mapping::none;
+        float gain = 0.0f;
+    };
+
+    std::size_t _num_inputs;
+    std::size_t _num_outputs;
+
+    /** The gain from each input to each output: [output][input].
+     */
+    std::vector<float> _gains;
+
+    /** The alternatives for a speaker, in order of preference.
+     */
+    [[nodiscard]] constexpr static std::array<fold_type, 2> folds(speaker_mapping speaker) noexcept
+    {
+        using enum speaker_mapping;
+
+        // clang-format off
+        switch (speaker) {
+        case front_left: return {fold_type{front_center, minus_3dB}};
+        case front_right: return {fold_type{front_center, minus_3dB}};
+        case front_center: return {fold_type{front_left | front_right, minus_3dB}};
+        case low_frequency: return {};
+        case back_left: return {fold_type{side_left, 1.0f}, fold_type{front_left, minus_3dB}};
+        case back_right: return {fold_type{side_right, 1.0f}, fold_type{front_right, minus_3dB}};
+        case front_left_of_center: return {fold_type{front_left | front_center, minus_3dB}, fold_type{front_left, 1.0f}};
+        case front_right_of_center: return {fold_type{front_right | front_center, minus_3dB}, fold_type{front_right, 1.0f}};
+        case back_center: return {fold_type{back_left | back_right, minus_3dB}};
+        case side_left: return {fold_type{back_left, 1.0f}, fold_type{front_left, minus_3dB}};
+        case side_right: return {fold_type{back_right, 1.0f}, fold_type{front_right, minus_3dB}};
+        case top_center: return {fold_type{front_center, minus_3dB}};
+        case top_front_left: return {fold_type{front_left, minus_3dB}};
+        case top_front_center: return {fold_type{front_center, minus_3dB}};
+        case top_front_right: return {fold_type{front_right, minus_3dB}};
+        case top_back_left: return {fold_type{back_left, minus_3dB}};
+        case top_back_center: return {fold_type{back_center, minus_3dB}};
+        case top_back_right: return {fold_type{back_right, minus_3dB}};
+        default: return {};
+        }
+        // clang-format on
+    }
+
+    /** Route an input speaker to the output speakers.
+     *
+     * @param output The speaker mapping of the output.
+     * @param input_index The index of the input channel.
+     * @param speaker The speaker to route.
+     * @param gain The accumulated gain for this route.
+     * @param depth The number of folds that may still be followed.
+     * @param apply When false only check if the speaker can be routed.
+     * @return True if the speaker could be routed to the output.
+     */
+    bool route(
+        speaker_mapping output,
+        std::size_t input_index,
+        speaker_mapping speaker,
+        float gain,
+        int depth,
+        bool apply) noexcept
+    {
+        if (to_bool(output & speaker)) {
+            if (apply) {
+                auto const output_index = popcount(output & static_cast<speaker_mapping>(std::to_underlying(speaker) - 1));
+                _gains[output_index * _num_inputs + input_index] += gain;
+            }
+            return true;
+        }
+
+        if (depth == 0) {
+            return false;
+        }
+
+        for (auto const& fold : folds(speaker)) {
+            auto const targets = std::to_underlying(fold.targets);
+            if (targets == 0) {
+                continue;
+            }
+
+            auto reachable = true;
+            for (auto mask = targets; mask != 0; mask &= mask - 1) {
+                auto const target = static_cast<speaker_mapping>(mask & (~mask + 1));
+                reachable &= route(output, input_index, target, gain * fold.gain, depth - 1, false);
+            }
+
+            if (reachable) {
+                if (apply) {
+                    for (auto mask = targets; mask != 0; mask &= mask - 1) {
+                        auto const target = static_cast<speaker_mapping>(mask & (~mask + 1));
+                        route(output, input_index, target, gain * fold.gain, depth - 1, true);
+                    }
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+}} // namespace hi::inline v1
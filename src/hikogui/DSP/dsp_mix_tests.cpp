@@ -0,0 +1,61 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_mix.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+
+TEST_SUITE(dsp_mix_suite) {
+
+TEST_CASE(identity)
+{
+    auto const matrix = hi::dsp_mix_matrix(hi::speaker_mapping::surround_5_1, hi::speaker_mapping::surround_5_1);
+    for (std::size_t i = 0; i != 6; ++i) {
+        for (std::size_t j = 0; j != 6; ++j) {
+            REQUIRE(matrix.gain(i, j) == (i == j ? 1.0f : 0.0f));
+        }
+    }
+}
+
+TEST_CASE(surround_to_stereo)
+{
+    // Inputs: front-left, front-right, front-center, low-frequency, back-left, back-right.
+    auto const matrix = hi::dsp_mix_matrix(hi::speaker_mapping::surround_5_1, hi::speaker_mapping::stereo_2_0);
+    REQUIRE(matrix.num_inputs() == 6);
+    REQUIRE(matrix.num_outputs() == 2);
+
+    REQUIRE(matrix.gain(0, 0) == 1.0f);
+    REQUIRE(matrix.gain(0, 1) == 0.0f);
+    REQUIRE(matrix.gain(0, 2) == 0.7071f, 0.0001f);
+    REQUIRE(matrix.gain(0, 3) == 0.0f);
+    REQUIRE(matrix.gain(0, 4) == 0.7071f, 0.0001f);
+    REQUIRE(matrix.gain(0, 5) == 0.0f);
+
+    REQUIRE(matrix.gain(1, 0) == 0.0f);
+    REQUIRE(matrix.gain(1, 1) == 1.0f);
+    REQUIRE(matrix.gain(1, 2) == 0.7071f, 0.0001f);
+    REQUIRE(matrix.gain(1, 3) == 0.0f);
+    REQUIRE(matrix.gain(1, 4) == 0.0f);
+    REQUIRE(matrix.gain(1, 5) == 0.7071f, 0.0001f);
+}
+
+TEST_CASE(mono_to_stereo_mix)
+{
+    auto const matrix = hi::dsp_mix_matrix(hi::speaker_mapping::mono_1_0, hi::speaker_mapping::stereo_2_0);
+
+    auto input = std::array<float, 10>{};
+    input.fill(1.0f);
+    auto left = std::array<float, 10>{};
+    auto right = std::array<float, 10>{};
+    auto const inputs = std::array<float const *, 1>{input.data()};
+    auto const outputs = std::array<float *, 2>{left.data(), right.data()};
+    matrix.mix(inputs, outputs, 10);
+
+    for (std::size_t i = 0; i != 10; ++i) {
+        REQUIRE(left[i] == 0.7071f, 0.0001f);
+        REQUIRE(right[i] == 0.7071f, 0.0001f);
+    }
+}
+
+};
@@ -1,8 +1,17 @@
 
+#pragma once
 
-#pragam once
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#if defined(HI_HAS_X86)
+#include <immintrin.h>
+#endif
+#include <type_traits>
+#include <cstddef>
+
+hi_export_module(hikogui.DSP.dsp_mul);
 
-namespace hi { inline namespace v1 {
+hi_export namespace hi { inline namespace v1 {
 
 /** Multiply two float arrays into another array.
  *
@@ -13,9 +22,11 @@ namespace hi { inline namespace v1 {
  */
 constexpr void dsp_mul(float const *a, float const *b, float *o, size_t n) noexcept
 {
+    auto const a_end = a + n;
+
     if (not std::is_constant_evaluated()) {
 #if defined(HI_HAS_AVX)
-        for (auto const a_end = a + floor(n, 8); a != a_end; a += 8, b += 8, o += 8) {
+        for (auto const a_wide_end = a + floor(n, 8_uz); a != a_wide_end; a += 8, b += 8, o += 8) {
             auto const a_ = _mm256_loadu_ps(a);
             auto const b_ = _mm256_loadu_ps(b);
             auto const o_ = _mm256_mul_ps(a_, b_);
@@ -23,7 +34,7 @@ constexpr void dsp_mul(float const *a, float const *b, float *o, size_t n) noexc
         }
 
 #elif defined(HI_HAS_SSE)
-        for (auto const a_end = a + floor(n, 4); a != a_end; a += 4, b += 4, o += 4) {
+        for (auto const a_wide_end = a + floor(n, 4_uz); a != a_wide_end; a += 4, b += 4, o += 4) {
             auto const a_ = _mm_loadu_ps(a);
             auto const b_ = _mm_loadu_ps(b);
             auto const o_ = _mm_mul_ps(a_, b_);
@@ -32,7 +43,7 @@ constexpr void dsp_mul(float const *a, float const *b, float *o, size_t n) noexc
 #endif
     }
 
-    for (auto const a_end = a + n; a != a_end; ++a, ++b, ++o) {
+    for (; a != a_end; ++a, ++b, ++o) {
         *o = *a * *b;
     }
 }
@@ -46,10 +57,12 @@ constexpr void dsp_mul(float const *a, float const *b, float *o, size_t n) noexc
  */
 constexpr void dsp_mul(float const *a, float b, float *o, size_t n) noexcept
 {
+    auto const a_end = a + n;
+
     if (not std::is_constant_evaluated()) {
 #if defined(HI_HAS_AVX)
         auto const b_ = _mm256_set1_ps(b);
-        for (auto const a_end = a + floor(n, 8); a != a_end; a += 8, o += 8) {
+        for (auto const a_wide_end = a + floor(n, 8_uz); a != a_wide_end; a += 8, o += 8) {
             auto const a_ = _mm256_loadu_ps(a);
             auto const o_ = _mm256_mul_ps(a_, b_);
             _mm256_storeu_ps(o, o_);
@@ -57,7 +70,7 @@ constexpr void dsp_mul(float const *a, float b, float *o, size_t n) noexcept
 
 #elif defined(HI_HAS_SSE)
         auto const b_ = _mm_set1_ps(b);
-        for (auto const a_end = a + floor(n, 4); a != a_end; a += 4, o += 4) {
+        for (auto const a_wide_end = a + floor(n, 4_uz); a != a_wide_end; a += 4, o += 4) {
             auto const a_ = _mm_loadu_ps(a);
             auto const o_ = _mm_mul_ps(a_, b_);
             _mm_storeu_ps(o, o_);
@@ -65,7 +78,7 @@ constexpr void dsp_mul(float const *a, float b, float *o, size_t n) noexcept
 #endif
     }
 
-    for (auto const a_end = a + n; a != a_end; ++a, ++o) {
+    for (; a != a_end; ++a, ++o) {
         *o = *a * b;
     }
 }
@@ -80,9 +93,11 @@ constexpr void dsp_mul(float const *a, float b, float *o, size_t n) noexcept
  */
 constexpr void dsp_mul_acc(float const *a, float const *b, float *o, size_t n) noexcept
 {
+    auto const a_end = a + n;
+
     if (not std::is_constant_evaluated()) {
 #if defined(HI_HAS_AVX)
-        for (auto const a_end = a + floor(n, 8); a != a_end; a += 8, b += 8, o += 8) {
+        for (auto const a_wide_end = a + floor(n, 8_uz); a != a_wide_end; a += 8, b += 8, o += 8) {
             auto const a_ = _mm256_loadu_ps(a);
             auto const b_ = _mm256_loadu_ps(b);
             auto const o_ = _mm256_mul_ps(a_, b_);
@@ -90,7 +105,7 @@ constexpr void dsp_mul_acc(float const *a, float const *b, float *o, size_t n) n
         }
 
 #elif defined(HI_HAS_SSE)
-        for (auto const a_end = a + floor(n, 4); a != a_end; a += 4, b += 4, o += 4) {
+        for (auto const a_wide_end = a + floor(n, 4_uz); a != a_wide_end; a += 4, b += 4, o += 4) {
             auto const a_ = _mm_loadu_ps(a);
             auto const b_ = _mm_loadu_ps(b);
             auto const o_ = _mm_mul_ps(a_, b_);
@@ -99,7 +114,7 @@ constexpr void dsp_mul_acc(float const *a, float const *b, float *o, size_t n) n
 #endif
     }
 
-    for (auto const a_end = a + n; a != a_end; ++a, ++b, ++o) {
+    for (; a != a_end; ++a, ++b, ++o) {
         *o = *o + *a * *b;
     }
 }
@@ -113,10 +128,12 @@ constexpr void dsp_mul_acc(float const *a, float const *b, float *o, size_t n) n
  */
 constexpr void dsp_mul_acc(float const *a, float b, float *o, size_t n) noexcept
 {
+    auto const a_end = a + n;
+
     if (not std::is_constant_evaluated()) {
 #if defined(HI_HAS_AVX)
         auto const b_ = _mm256_set1_ps(b);
-        for (auto const a_end = a + floor(n, 8); a != a_end; a += 8, o += 8) {
+        for (auto const a_wide_end = a + floor(n, 8_uz); a != a_wide_end; a += 8, o += 8) {
             auto const a_ = _mm256_loadu_ps(a);
             auto const o_ = _mm256_mul_ps(a_, b_);
             _mm256_storeu_ps(o, _mm256_add_ps(_mm256_loadu_ps(o), o_));
@@ -124,7 +141,7 @@ constexpr void dsp_mul_acc(float const *a, float b, float *o, size_t n) noexcept
 
 #elif defined(HI_HAS_SSE)
         auto const b_ = _mm_set1_ps(b);
-        for (auto const a_end = a + floor(n, 4); a != a_end; a += 4, o += 4) {
+        for (auto const a_wide_end = a + floor(n, 4_uz); a != a_wide_end; a += 4, o += 4) {
             auto const a_ = _mm_loadu_ps(a);
             auto const o_ = _mm_mul_ps(a_, b_);
             _mm_storeu_ps(o, _mm_add_ps(_mm_loadu_ps(o), o_));
@@ -132,10 +149,9 @@ constexpr void dsp_mul_acc(float const *a, float b, float *o, size_t n) noexcept
 #endif
     }
 
-    for (auto const a_end = a + n; a != a_end; ++a, ++o) {
+    for (; a != a_end; ++a, ++o) {
         *o = *o + *a * b;
     }
 }
 
-
-}}
+}} // namespace hi::inline v1
@@ -0,0 +1,360 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "dsp_float.hpp"
+#include "dsp_gain.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <atomic>
+#include <array>
+#include <span>
+#include <new>
+#include <bit>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.DSP.dsp_parameter);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Fill samples with a linear ramp.
+ *
+ * The value of sample `i` is `start + step * i`.
+ *
+ * @param r The output samples.
+ * @param start The value of the first sample.
+ * @param step The difference between consecutive samples.
+ */
+inline void dsp_ramp(std::span<float> r, float start, float step) noexcept
+{
+    using S = fast_simd<float>;
+    constexpr auto stride = std::tuple_size_v<S>;
+
+    auto const size = r.size();
+    auto const wide_size = (size / stride) * stride;
+
+    auto r_ = r.data();
+
+    // Calculate the value from the index of each sample, instead of accumulating
+    // the step, so that rounding errors do not build up over a long ramp.
+    auto lane_index = S{};
+    for (auto i = 0_uz; i != stride; ++i) {
+        lane_index[i] = static_cast<float>(i);
+    }
+
+    auto const step_wide = S::broadcast(step);
+    auto const start_wide = S::broadcast(start);
+    auto i = 0_uz;
+    for (; i != wide_size; i += stride) {
+        dsp_store(S{start_wide + (lane_index + S::broadcast(static_cast<float>(i))) * step_wide}, r_);
+        r_ += stride;
+    }
+
+    for (; i != size; ++i) {
+        *r_++ = start + static_cast<float>(i) * step;
+    }
+}
+
+/** A parameter of a DSP kernel that is smoothed over time.
+ *
+ * When the parameter is set to a new value it moves linearly from its current
+ * value to the new value over a number of samples, which prevents the zipper-noise
+ * of sudden jumps in for example the gain or the cut-off frequency of a filter.
+ *
+ * A parameter is owned by the audio thread, use a `dsp_parameter_queue` to
+ * change it from another thread.
+ */
+hi_export class dsp_parameter {
+public:
+    constexpr dsp_parameter() noexcept = default;
+
+    constexpr explicit dsp_parameter(float value) noexcept : _start(value), _target(value) {}
+
+    /** The value of the parameter at the current sample.
+     */
+    [[nodiscard]] constexpr float value() const noexcept
+    {
+        return ramping() ? _start + _step * static_cast<float>(_position) : _target;
+    }
+
+    /** The value at the end of the ramp.
+     */
+    [[nodiscard]] constexpr float target() const noexcept
+    {
+        return _target;
+    }
+
+    /** Check if the parameter is moving towards its target.
+     */
+    [[nodiscard]] constexpr bool ramping() const noexcept
+    {
+        return _position != _length;
+    }
+
+    /** Set a new value for the parameter.
+     *
+     * @param target The new value.
+     * @param ramp_length The number of samples to move from the current value to @a target,
+     *                    zero to jump to the new value immediately.
+     */
+    constexpr void set(float target, std::size_t ramp_length = 0) noexcept
+    {
+        if (ramp_length == 0) {
+            _start = target;
+            _step = 0.0f;
+            _position = 0;
+            _length = 0;
+
+        } else {
+            _start = value();
+            _step = (target - _start) / static_cast<float>(ramp_length);
+            _position = 0;
+            _length = ramp_length;
+        }
+        _target = target;
+    }
+
+    /** Advance the parameter without rendering its value.
+     *
+     * @param num_samples The number of samples to advance.
+     */
+    constexpr void advance(std::size_t num_samples) noexcept
+    {
+        _position += std::min(num_samples, _length - _position);
+    }
+
+    /** Render the value of the parameter for each sample and advance.
+     *
+     * @param r The values of the parameter for the next `r.size()` samples.
+     */
+    void render(std::span<float> r) noexcept
+    {
+        auto const n = std::min(r.size(), _length - _position);
+        if (n != 0) {
+            dsp_ramp(r.first(n), value(), _step);
+        }
+        std::fill(r.begin() + n, r.end(), _target);
+        advance(n);
+    }
+
+    /** Multiply samples with the value of the parameter and advance.
+     *
+     * @param r The output samples.
+     * @param a The input samples, may be the same as @a r.
+     */
+    void gain(std::span<float> r, std::span<float const> a) noexcept
+    {
+        hi_axiom(r.size() == a.size());
+
+        auto const n = std::min(r.size(), _length - _position);
+        if (n != 0) {
+            auto const start = value();
+            advance(n);
+            dsp_gain_ramp(r.first(n), a.first(n), start, value());
+        }
+        if (n != r.size()) {
+            dsp_mul(r.subspan(n), a.subspan(n), _target);
+        }
+    }
+
+    /** Multiply samples in place with the value of the parameter and advance.
+     *
+     * @param r The samples.
+     */
+    void gain(std::span<float> r) noexcept
+    {
+        return gain(r, std::span<float const>{r});
+    }
+
+private:
+    float _start = 0.0f;
+    float _step = 0.0f;
+    float _target = 0.0f;
+    std::size_t _position = 0;
+    std::size_t _length = 0;
+};
+
+/** A change of a parameter send to the audio thread.
+ */
+hi_export struct dsp_parameter_change {
+    /** The index of the parameter in the span passed to `dsp_parameter_queue::consume()`.
+     */
+    std::size_t index = 0;
+
+    /** The new value of the parameter.
+     */
+    float value = 0.0f;
+
+    /** The number of samples to ramp from the current to the new value.
+     */
+    std::size_t ramp_length = 0;
+
+    /** The sample count at which the change should start, see `audio_block::sample_count`.
+     *
+     * A sample count that lies before the block that is being processed starts the
+     * change at the first sample of that block; zero means as soon as possible.
+     */
+    int64_t sample_count = 0;
+};
+
+/** A wait-free single-producer/single-consumer queue of parameter changes.
+ *
+ * The queue carries parameter changes from a single thread, normally the GUI
+ * thread in the callback of an `observer<T>` bound to a widget, to the audio
+ * thread. Neither side allocates memory or takes a lock.
+ *
+ * The audio thread calls `consume()` for each block, which applies the changes
+ * at the exact sample they were scheduled for.
+ *
+ * @note `push()` may only be called from the producer thread, `consume()` and
+ *       `empty()` may only be called from the audio thread.
+ * @tparam Capacity The maximum number of changes in the queue, must be a power of two.
+ */
+hi_export template<std::size_t Capacity = 256>
+class dsp_parameter_queue {
+public:
+    static_assert(std::has_single_bit(Capacity), "Only power-of-two capacity allowed.");
+
+    constexpr static std::size_t capacity = Capacity;
+
+    constexpr dsp_parameter_queue() noexcept = default;
+    dsp_parameter_queue(dsp_parameter_queue const&) = delete;
+    dsp_parameter_queue(dsp_parameter_queue&&) = delete;
+    dsp_parameter_queue& operator=(dsp_parameter_queue const&) = delete;
+    dsp_parameter_queue& operator=(dsp_parameter_queue&&) = delete;
+
+    /** Schedule a parameter change.
+     *
+     * Changes must be pushed in the order of their sample count.
+     *
+     * @note Must be called from the producer thread.
+     * @param change The change to schedule.
+     * @return True if the change was queued, false if the queue was full.
+     */
+    bool push(dsp_parameter_change const& change) noexcept
+    {
+        auto const head = _head.load(std::memory_order::relaxed);
+        if (head - _cached_tail == capacity) {
+            _cached_tail = _tail.load(std::memory_order::acquire);
+            if (head - _cached_tail == capacity) {
+                ++global_counter<"dsp_parameter_queue:overflow">;
+                return false;
+            }
+        }
+
+        _changes[head % capacity] = change;
+        _head.store(head + 1, std::memory_order::release);
+        return true;
+    }
+
+    /** Schedule a parameter change.
+     *
+     * @note Must be called from the producer thread.
+     * @param index The index of the parameter.
+     * @param value The new value of the parameter.
+     * @param ramp_length The number of samples to ramp from the current to the new value.
+     * @param sample_count The sample count at which the change should start, zero for as soon as possible.
+     * @return True if the change was queued, false if the queue was full.
+     */
+    bool push(std::size_t index, float value, std::size_t ramp_length = 0, int64_t sample_count = 0) noexcept
+    {
+        return push(dsp_parameter_change{index, value, ramp_length, sample_count});
+    }
+
+    /** Check if there are no changes in the queue.
+     *
+     * @note Must be called from the audio thread.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _tail.load(std::memory_order::relaxed) == _head.load(std::memory_order::acquire);
+    }
+
+    /** Apply the changes for a block of samples.
+     *
+     * The block is split at the sample of each change, and @a func is called for
+     * each part of the block with the parameters set to their value at the start
+     * of that part. @a func is expected to render the parameters, or `advance()`
+     * them, over the part of the block it is called with.
+     *
+     * Changes scheduled after the block remain in the queue. Changes for a parameter
+     * index outside of @a parameters are dropped.
+     *
+     * @note Must be called from the audio thread.
+     * @param parameters The parameters that are changed by the queue.
+     * @param sample_count The sample count of the first sample in the block.
+     * @param num_samples The number of samples in the block.
+     * @param func A `void(std::size_t offset, std::size_t size)` called for each part of the block.
+     */
+    template<typename Func>
+    void consume(std::span<dsp_parameter> parameters, int64_t sample_count, std::size_t num_samples, Func&& func) noexcept
+    {
+        auto const end_sample_count = sample_count + narrow_cast<int64_t>(num_samples);
+
+        auto offset = 0_uz;
+        auto tail = _tail.load(std::memory_order::relaxed);
+        while (true) {
+            if (tail == _cached_head) {
+                _cached_head = _head.load(std::memory_order::acquire);
+                if (tail == _cached_head) {
+                    break;
+                }
+            }
+
+            auto const& change = _changes[tail % capacity];
+            if (change.sample_count >= end_sample_count) {
+                break;
+            }
+
+            auto const change_offset =
+                change.sample_count > sample_count ? narrow_cast<std::size_t>(change.sample_count - sample_count) : 0_uz;
+            if (change_offset > offset) {
+                func(offset, change_offset - offset);
+                offset = change_offset;
+            }
+
+            if (change.index < parameters.size()) {
+                parameters[change.index].set(change.value, change.ramp_length);
+            }
+
+            _tail.store(++tail, std::memory_order::release);
+        }
+
+        if (offset != num_samples) {
+            func(offset, num_samples - offset);
+        }
+    }
+
+private:
+#if defined(__cpp_lib_hardware_interference_size)
+    constexpr static size_t destructive_interference_size = std::hardware_destructive_interference_size;
+#else
+    constexpr static size_t destructive_interference_size = 128;
+#endif
+
+    std::array<dsp_parameter_change, capacity> _changes = {};
+
+    /** The index of the next change to write, owned by the producer.
+     */
+    alignas(destructive_interference_size) std::atomic<std::size_t> _head = 0;
+
+    /** The last known value of the _tail, owned by the producer.
+     */
+    std::size_t _cached_tail = 0;
+
+    /** The index of the next change to read, owned by the consumer.
+     */
+    alignas(destructive_interference_size) std::atomic<std::size_t> _tail = 0;
+
+    /** The last known value of the _head, owned by the consumer.
+     */
+    std::size_t _cached_head = 0;
+};
+
+}} // namespace hi::inline v1
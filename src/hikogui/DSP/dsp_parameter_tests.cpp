@@ -0,0 +1,124 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_parameter.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+#include <vector>
+#include <utility>
+
+TEST_SUITE(dsp_parameter_suite) {
+
+TEST_CASE(ramp)
+{
+    auto parameter = hi::dsp_parameter{1.0f};
+    parameter.set(0.0f, 100);
+    REQUIRE(parameter.ramping());
+
+    auto values = std::array<float, 70>{};
+    parameter.render(values);
+    for (std::size_t i = 0; i != values.size(); ++i) {
+        REQUIRE(values[i] == 1.0f - static_cast<float>(i) * 0.01f, 0.00001f);
+    }
+
+    // The ramp continues without a step in the next block, then holds the target.
+    parameter.render(values);
+    for (std::size_t i = 0; i != 30; ++i) {
+        REQUIRE(values[i] == 0.3f - static_cast<float>(i) * 0.01f, 0.00001f);
+    }
+    for (std::size_t i = 30; i != values.size(); ++i) {
+        REQUIRE(values[i] == 0.0f);
+    }
+    REQUIRE(not parameter.ramping());
+}
+
+TEST_CASE(jump)
+{
+    auto parameter = hi::dsp_parameter{1.0f};
+    parameter.set(0.5f, 10);
+    parameter.advance(5);
+    REQUIRE(parameter.value() == 0.75f, 0.00001f);
+
+    parameter.set(2.0f);
+    REQUIRE(not parameter.ramping());
+    REQUIRE(parameter.value() == 2.0f);
+}
+
+TEST_CASE(gain)
+{
+    auto parameter = hi::dsp_parameter{0.0f};
+    parameter.set(1.0f, 20);
+
+    auto samples = std::array<float, 37>{};
+    samples.fill(2.0f);
+    parameter.gain(samples);
+    for (std::size_t i = 0; i != 20; ++i) {
+        REQUIRE(samples[i] == static_cast<float>(i) * 0.1f, 0.00001f);
+    }
+    for (std::size_t i = 20; i != samples.size(); ++i) {
+        REQUIRE(samples[i] == 2.0f);
+    }
+}
+
+TEST_CASE(sample_accurate)
+{
+    auto queue = hi::dsp_parameter_queue<16>{};
+    auto parameters = std::array{hi::dsp_parameter{0.0f}, hi::dsp_parameter{0.0f}};
+
+    REQUIRE(queue.push(0, 1.0f));
+    REQUIRE(queue.push(1, 2.0f, 0, 1010));
+    REQUIRE(queue.push(0, 3.0f, 0, 1020));
+    REQUIRE(queue.push(1, 4.0f, 0, 1100));
+
+    // The block starts at sample 1000 and is 64 samples long.
+    auto parts = std::vector<std::pair<std::size_t, std::size_t>>{};
+    auto values = std::vector<std::pair<float, float>>{};
+    queue.consume(parameters, 1000, 64, [&](std::size_t offset, std::size_t size) {
+        parts.emplace_back(offset, size);
+        values.emplace_back(parameters[0].value(), parameters[1].value());
+    });
+
+    REQUIRE(parts.size() == 3);
+    REQUIRE(parts[0].first == 0);
+    REQUIRE(parts[0].second == 10);
+    REQUIRE(parts[1].first == 10);
+    REQUIRE(parts[1].second == 10);
+    REQUIRE(parts[2].first == 20);
+    REQUIRE(parts[2].second == 44);
+    REQUIRE(values[0].first == 1.0f);
+    REQUIRE(values[0].second == 0.0f);
+    REQUIRE(values[1].first == 1.0f);
+    REQUIRE(values[1].second == 2.0f);
+    REQUIRE(values[2].first == 3.0f);
+    REQUIRE(values[2].second == 2.0f);
+
+    // The last change is for the next block.
+    REQUIRE(not queue.empty());
+    parts.clear();
+    queue.consume(parameters, 1064, 64, [&](std::size_t offset, std::size_t size) {
+        parts.emplace_back(offset, size);
+    });
+    REQUIRE(parts.size() == 2);
+    REQUIRE(parts[1].first == 36);
+    REQUIRE(parts[1].second == 28);
+    REQUIRE(parameters[1].value() == 4.0f);
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE(overflow)
+{
+    auto queue = hi::dsp_parameter_queue<4>{};
+    auto parameters = std::array{hi::dsp_parameter{0.0f}};
+
+    for (auto i = 0; i != 4; ++i) {
+        REQUIRE(queue.push(0, static_cast<float>(i)));
+    }
+    REQUIRE(not queue.push(0, 5.0f));
+
+    queue.consume(parameters, 0, 16, [](std::size_t, std::size_t) {});
+    REQUIRE(parameters[0].value() == 3.0f);
+    REQUIRE(queue.push(0, 6.0f));
+}
+
+};
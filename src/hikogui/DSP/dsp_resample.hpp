@@ -0,0 +1,218 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "dsp_float.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <numbers>
+#include <numeric>
+#include <algorithm>
+#include <vector>
+#include <span>
+#include <cmath>
+#include <cstddef>
+
+hi_export_module(hikogui.DSP.dsp_resample);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A polyphase sample rate converter.
+ *
+ * The sample rate is converted by the rational factor `L / M`, by conceptually
+ * up-sampling by L, low-pass filtering and down-sampling by M. Only the filter
+ * taps that line up with an input sample are calculated, each output sample
+ * is a single dot-product of the last `num_taps` input samples with one phase of
+ * the filter.
+ *
+ * The prototype filter is a Blackman windowed sinc, with its cutoff just below
+ * the lower of the two Nyquist frequencies.
+ *
+ * The conversion of each channel is independent, so that channels of an
+ * `audio_block` can be processed one after another.
+ */
+class dsp_resampler {
+public:
+    using simd_type = fast_simd<float>;
+
+    /** Create a sample rate converter.
+     *
+     * @param num_channels The number of channels to convert.
+     * @param input_rate The sample rate of the input in Hz.
+     * @param output_rate The sample rate of the output in Hz.
+     * @param num_taps The number of input samples used for each output sample,
+     *                 must be a multiple of the number of lanes of `simd_type`.
+     */
+    dsp_resampler(std::size_t num_channels, std::size_t input_rate, std::size_t output_rate, std::size_t num_taps = 32) :
+        _num_channels(num_channels), _num_taps(num_taps)
+    {
+        hi_assert(num_channels != 0);
+        hi_assert(input_rate != 0 and output_rate != 0);
+        hi_assert(num_taps != 0 and num_taps % std::tuple_size_v<simd_type> == 0);
+
+        auto const g = std::gcd(input_rate, output_rate);
+        _up = output_rate / g;
+        _down = input_rate / g;
+
+        make_filter();
+
+        _history.resize(num_channels * num_taps * 2, 0.0f);
+        _history_index.resize(num_channels, 0);
+        _phase.resize(num_channels, 0);
+    }
+
+    [[nodiscard]] std::size_t num_channels() const noexcept
+    {
+        return _num_channels;
+    }
+
+    /** The up-sampling factor L.
+     */
+    [[nodiscard]] std::size_t up_factor() const noexcept
+    {
+        return _up;
+    }
+
+    /** The down-sampling factor M.
+     */
+    [[nodiscard]] std::size_t down_factor() const noexcept
+    {
+        return _down;
+    }
+
+    /** The delay of the filter in input samples.
+     */
+    [[nodiscard]] double delay() const noexcept
+    {
+        return static_cast<double>(_num_taps * _up - 1) / (2.0 * static_cast<double>(_up));
+    }
+
+    /** The maximum number of output samples for a number of input samples.
+     */
+    [[nodiscard]] std::size_t max_output_size(std::size_t num_input_samples) const noexcept
+    {
+        return (num_input_samples * _up + _down - 1) / _down;
+    }
+
+    /** Clear the history of all channels.
+     */
+    void reset() noexcept
+    {
+        std::fill(_history.begin(), _history.end(), 0.0f);
+        std::fill(_history_index.begin(), _history_index.end(), 0_uz);
+        std::fill(_phase.begin(), _phase.end(), 0_uz);
+    }
+
+    /** Convert samples of a channel.
+     *
+     * @param channel The channel to convert.
+     * @param input The input samples.
+     * @param output The buffer for the output samples, must have room for `max_output_size(input.size())` samples.
+     * @return The number of samples written to @a output.
+     */
+    std::size_t process(std::size_t channel, std::span<float const> input, std::span<float> output) noexcept
+    {
+        hi_axiom(channel < _num_channels);
+        hi_axiom(output.size() >= max_output_size(input.size()));
+
+        auto *const history = _history.data() + channel * _num_taps * 2;
+        auto& history_index = _history_index[channel];
+        auto& phase = _phase[channel];
+
+        auto num_output_samples = 0_uz;
+        for (auto const sample : input) {
+            // Each sample is written twice, so that the last num_taps samples are always contiguous.
+            history[history_index] = sample;
+            history[history_index + _num_taps] = sample;
+            if (++history_index == _num_taps) {
+                history_index = 0;
+            }
+
+            auto const *const window = history + history_index;
+            while (phase < _up) {
+                output[num_output_samples++] = dot(window, _coefficients.data() + phase * _num_taps);
+                phase += _down;
+            }
+            phase -= _up;
+        }
+        return num_output_samples;
+    }
+
+private:
+    std::size_t _num_channels;
+    std::size_t _num_taps;
+
+    /** The up-sampling factor L.
+     */
+    std::size_t _up;
+
+    /** The down-sampling factor M.
+     */
+    std::size_t _down;
+
+    /** The coefficients of each phase of the filter: [phase][tap].
+     *
+     * The taps of each phase are reversed, so that they can be multiplied
+     * with the history ordered from oldest to newest sample.
+     */
+    std::vector<float> _coefficients;
+
+    /** The last num_taps samples of each channel, twice.
+     */
+    std::vector<float> _history;
+
+    /** The position of the oldest sample in the history of each channel.
+     */
+    std::vector<std::size_t> _history_index;
+
+    /** The phase of the next output sample, relative to the last input sample, of each channel.
+     */
+    std::vector<std::size_t> _phase;
+
+    void make_filter() noexcept
+    {
+        // The cutoff is placed slightly below Nyquist, to leave room for the transition band.
+        constexpr auto rolloff = 0.95;
+
+        auto const size = _num_taps * _up;
+        auto const cutoff = rolloff * 0.5 / static_cast<double>(std::max(_up, _down));
+        auto const center = static_cast<double>(size - 1) / 2.0;
+
+        auto prototype = std::vector<double>(size);
+        for (auto i = 0_uz; i != size; ++i) {
+            auto const t = static_cast<double>(i) - center;
+            auto const x = 2.0 * std::numbers::pi * cutoff * t;
+            auto const sinc = t == 0.0 ? 1.0 : std::sin(x) / x;
+
+            auto const w = 2.0 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(size - 1);
+            auto const blackman = 0.42 - 0.5 * std::cos(w) + 0.08 * std::cos(2.0 * w);
+
+            // The gain of L compensates for the zeros inserted when up-sampling.
+            prototype[i] = 2.0 * cutoff * sinc * blackman * static_cast<double>(_up);
+        }
+
+        _coefficients.resize(size);
+        for (auto phase = 0_uz; phase != _up; ++phase) {
+            for (auto tap = 0_uz; tap != _num_taps; ++tap) {
+                _coefficients[phase * _num_taps + tap] =
+                    static_cast<float>(prototype[phase + (_num_taps - 1 - tap) * _up]);
+            }
+        }
+    }
+
+    [[nodiscard]] float dot(float const *a, float const *b) const noexcept
+    {
+        constexpr auto stride = std::tuple_size_v<simd_type>;
+
+        auto r = simd_type::make_zero();
+        for (auto i = 0_uz; i != _num_taps; i += stride) {
+            r = r + dsp_load<simd_type>(a + i) * dsp_load<simd_type>(b + i);
+        }
+        return sum(r).x();
+    }
+};
+
+}} // namespace hi::inline v1
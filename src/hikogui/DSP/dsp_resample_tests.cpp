@@ -0,0 +1,66 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_resample.hpp"
+#include <hikotest/hikotest.hpp>
+#include <numbers>
+#include <vector>
+#include <cmath>
+
+/** Convert a 1 kHz sine wave and compare it with the expected sine wave.
+ */
+static void check_sine(std::size_t input_rate, std::size_t output_rate)
+{
+    auto resampler = hi::dsp_resampler(1, input_rate, output_rate);
+
+    auto const num_input_samples = input_rate / 10;
+    auto input = std::vector<float>(num_input_samples);
+    for (std::size_t i = 0; i != num_input_samples; ++i) {
+        input[i] = static_cast<float>(std::sin(2.0 * std::numbers::pi * 1000.0 * static_cast<double>(i) / input_rate));
+    }
+
+    // Convert in small blocks, to check that the state is kept between calls.
+    auto output = std::vector<float>(resampler.max_output_size(num_input_samples));
+    auto num_output_samples = std::size_t{0};
+    for (std::size_t i = 0; i < num_input_samples; i += 100) {
+        auto const n = std::min(std::size_t{100}, num_input_samples - i);
+        num_output_samples += resampler.process(
+            0,
+            std::span{input.data() + i, n},
+            std::span{output.data() + num_output_samples, resampler.max_output_size(n)});
+    }
+    REQUIRE(num_output_samples == output_rate / 10);
+
+    // Skip the start-up of the filter.
+    auto const delay = resampler.delay() / static_cast<double>(input_rate);
+    for (std::size_t i = 200; i != num_output_samples; ++i) {
+        auto const t = static_cast<double>(i) / static_cast<double>(output_rate) - delay;
+        auto const expected = std::sin(2.0 * std::numbers::pi * 1000.0 * t);
+        REQUIRE(static_cast<double>(output[i]) == expected, 0.001);
+    }
+}
+
+TEST_SUITE(dsp_resample_suite) {
+
+TEST_CASE(factors)
+{
+    auto const resampler = hi::dsp_resampler(2, 44100, 48000);
+    REQUIRE(resampler.up_factor() == 160);
+    REQUIRE(resampler.down_factor() == 147);
+    REQUIRE(resampler.max_output_size(147) == 160);
+}
+
+TEST_CASE(up_sample)
+{
+    check_sine(44100, 48000);
+    check_sine(48000, 96000);
+}
+
+TEST_CASE(down_sample)
+{
+    check_sine(48000, 44100);
+    check_sine(96000, 48000);
+}
+
+};
@@ -1,12 +1,24 @@
-
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #pragma once
 
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#if defined(HI_HAS_X86)
+#include <immintrin.h>
+#endif
 #include <concepts>
+#include <type_traits>
+#include <span>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
 
-hi_export_module(hikogui.DSP.apply)
+hi_export_module(hikogui.DSP.for_each);
 
-hi_export namespace hi { inline v1 {
+hi_export namespace hi { inline namespace v1 {
 
 /** Different implementations of a operation.
  *
@@ -14,228 +26,498 @@ hi_export namespace hi { inline v1 {
  *  - (required) `constexpr T operator()(T a, T b) const noexcept`
  *  - (optional) `__m128 operator()(__m128 a, __m128 b) const noexcept`
  *  - (optional) `__m256 operator()(__m256 a, __m256 b) const noexcept`
- *  - (optional) `__m512 operator()(__m512 a, __m512 b) const noexcept`
  *  - (optional) `__m128d operator()(__m128d a, __m128d b) const noexcept`
  *  - (optional) `__m256d operator()(__m256d a, __m256d b) const noexcept`
- *  - (optional) `__m512d operator()(__m512d a, __m512d b) const noexcept`
- *  - (optional) `__m128i operator()(__m128i a, __m128i b) const noexcept`
- *  - (optional) `__m256i operator()(__m256i a, __m256i b) const noexcept`
- *  - (optional) `__m512i operator()(__m512i a, __m512i b) const noexcept`
+ *
+ * The register types that are used are selected by `dsp_wide_register`, an
+ * operation must implement those that match @a T.
  *
  * @tparam Operation The name of the operation
  * @tparam T The numeric type to operate on.
  */
 template<fixed_string Operation, typename T>
-struct dsp_op {
-};
+struct dsp_op {};
+
+template<>
+struct dsp_op<"+", float> {
+    [[nodiscard]] constexpr float operator()(float a, float b) const noexcept
+    {
+        return a + b;
+    }
 
+#if defined(HI_HAS_SSE)
+    [[nodiscard]] __m128 operator()(__m128 a, __m128 b) const noexcept
+    {
+        return _mm_add_ps(a, b);
+    }
+#endif
 
-template<typename Context, typename T>
-concept dsp_apply_argument = std::same_as<Context, T> or std::same_as<Context, T const *> or std::same_as<Context, T *>;;
+#if defined(HI_HAS_AVX)
+    [[nodiscard]] __m256 operator()(__m256 a, __m256 b) const noexcept
+    {
+        return _mm256_add_ps(a, b);
+    }
+#endif
+};
 
-template<typename Op>
-struct dps_op_traits {
+template<>
+struct dsp_op<"-", float> {
+    [[nodiscard]] constexpr float operator()(float a, float b) const noexcept
+    {
+        return a - b;
+    }
 
+#if defined(HI_HAS_SSE)
+    [[nodiscard]] __m128 operator()(__m128 a, __m128 b) const noexcept
+    {
+        return _mm_sub_ps(a, b);
+    }
+#endif
 
+#if defined(HI_HAS_AVX)
+    [[nodiscard]] __m256 operator()(__m256 a, __m256 b) const noexcept
+    {
+        return _mm256_sub_ps(a, b);
+    }
+#endif
 };
 
+template<>
+struct dsp_op<"*", float> {
+    [[nodiscard]] constexpr float operator()(float a, float b) const noexcept
+    {
+        return a * b;
+    }
 
-template<size_t I, typename Array, typename First, typename... Rest>
-[[nodiscard]] constexpr void _dsp_regs_init_float(Array &array, First first, Rest... rest) noexcept
-{
-    if constexpr (not std::is_pointer_v<First>) {
-        std::get<I>(array) = first;
+#if defined(HI_HAS_SSE)
+    [[nodiscard]] __m128 operator()(__m128 a, __m128 b) const noexcept
+    {
+        return _mm_mul_ps(a, b);
     }
-    if constexpr (sizeof...(Rest) != 0) {
-        return _dsp_regs_init<I + 1>(array, rest...);
+#endif
+
+#if defined(HI_HAS_AVX)
+    [[nodiscard]] __m256 operator()(__m256 a, __m256 b) const noexcept
+    {
+        return _mm256_mul_ps(a, b);
     }
-}
+#endif
+};
 
-template<size_t I, typename Array, typename First, typename... Rest>
-[[nodiscard]] constexpr void dsp_load(Array &array, First &first, Rest &... rest) noexcept
-{
-    using reg_type = Array::value_type;
+template<>
+struct dsp_op<"+", double> {
+    [[nodiscard]] constexpr double operator()(double a, double b) const noexcept
+    {
+        return a + b;
+    }
 
-    if constexpr (std::same_as<reg_type, float> and std::same_as<First, float const *>) {
-        std::get<I>(array) = *first++;
-    } else if constexpr (std::same_as<reg_type, double> and std::same_as<First, double const *>) {
-        std::get<I>(array) = *first++;
-    } else if constexpr (std::same_as<reg_type, int> and std::same_as<First, int const *>) {
-        std::get<I>(array) = *first++;
+#if defined(HI_HAS_SSE2)
+    [[nodiscard]] __m128d operator()(__m128d a, __m128d b) const noexcept
+    {
+        return _mm_add_pd(a, b);
+    }
+#endif
 
-#if defined(HI_HAS_SSE)
-    } else if constexpr (std::same_as<reg_type, __m128> and std::same_as<First, float const *>) {
-        std::get<I>(array) = _mm_loadu_ps(first);
-        first += 4;
-    } else if constexpr (std::same_as<reg_type, __m128> and std::same_as<First, double const *>) {
-        std::get<I>(array) = _mm_loadu_pd(first);
-        first += 2;
+#if defined(HI_HAS_AVX)
+    [[nodiscard]] __m256d operator()(__m256d a, __m256d b) const noexcept
+    {
+        return _mm256_add_pd(a, b);
+    }
 #endif
+};
+
+template<>
+struct dsp_op<"-", double> {
+    [[nodiscard]] constexpr double operator()(double a, double b) const noexcept
+    {
+        return a - b;
+    }
 
 #if defined(HI_HAS_SSE2)
-    } else if constexpr (std::same_as<reg_type, __m128i> and std::same_as<First, int const *>) {
-        std::get<I>(array) = _mm_loadu_epi32(first);
-        first += 4;
+    [[nodiscard]] __m128d operator()(__m128d a, __m128d b) const noexcept
+    {
+        return _mm_sub_pd(a, b);
+    }
 #endif
 
 #if defined(HI_HAS_AVX)
-    } else if constexpr (std::same_as<reg_type, __m256> and std::same_as<First, float const *>) {
-        std::get<I>(array) = _mm256_loadu_ps(first);
-        first += 8;
-    } else if constexpr (std::same_as<reg_type, __m256> and std::same_as<First, double const *>) {
-        std::get<I>(array) = _mm256_loadu_pd(first);
-        first += 4;
+    [[nodiscard]] __m256d operator()(__m256d a, __m256d b) const noexcept
+    {
+        return _mm256_sub_pd(a, b);
+    }
 #endif
+};
 
-#if defined(HI_HAS_AVX2)
-    } else if constexpr (std::same_as<reg_type, __m256i> and std::same_as<First, int const *>) {
-        std::get<I>(array) = _mm256_loadu_epi32(first);
-        first += 8;
-#endif
+template<>
+struct dsp_op<"*", double> {
+    [[nodiscard]] constexpr double operator()(double a, double b) const noexcept
+    {
+        return a * b;
+    }
 
-#if defined(HI_HAS_AVX512F)
-    } else if constexpr (std::same_as<reg_type, __m512> and std::same_as<First, float const *>) {
-        std::get<I>(array) = _mm512_loadu_ps(first);
-        first += 16;
-    } else if constexpr (std::same_as<reg_type, __m512> and std::same_as<First, double const *>) {
-        std::get<I>(array) = _mm512_loadu_pd(first);
-        first += 8;
-    } else if constexpr (std::same_as<reg_type, __m512i> and std::same_as<First, int const *>) {
-        std::get<I>(array) = _mm512_loadu_epi32(first);
-        first += 16;
+#if defined(HI_HAS_SSE2)
+    [[nodiscard]] __m128d operator()(__m128d a, __m128d b) const noexcept
+    {
+        return _mm_mul_pd(a, b);
+    }
 #endif
+
+#if defined(HI_HAS_AVX)
+    [[nodiscard]] __m256d operator()(__m256d a, __m256d b) const noexcept
+    {
+        return _mm256_mul_pd(a, b);
     }
+#endif
+};
+
+namespace detail {
+
+/** Load, store and broadcast values of type `T` in a register.
+ */
+template<typename Register>
+struct dsp_register;
 
-    if constexpr (sizeof...(Rest) != 0) {
-        return dsp_load<I + 1>(array, rest...);
+template<std::floating_point T>
+struct dsp_register<T> {
+    using value_type = T;
+    constexpr static std::size_t size = 1;
+
+    [[nodiscard]] constexpr static T load(T const *p) noexcept
+    {
+        return *p;
     }
-}
 
-template<size_t I, typename Array, typename First, typename... Rest>
-[[nodiscard]] constexpr void dsp_init_scalar(Array &array, First first, Rest... rest) noexcept
-{
-    using reg_type = Array::value_type;
+    constexpr static void store(T *p, T x) noexcept
+    {
+        *p = x;
+    }
 
-    if constexpr (std::same_as<reg_type, float> and std::same_as<First, float>) {
-        std::get<I>(array) = first;
-    } else if constexpr (std::same_as<reg_type, double> and std::same_as<First, double>) {
-        std::get<I>(array) = first;
-    } else if constexpr (std::same_as<reg_type, int> and std::same_as<First, int>) {
-        std::get<I>(array) = first;
+    [[nodiscard]] constexpr static T broadcast(T x) noexcept
+    {
+        return x;
+    }
+};
 
 #if defined(HI_HAS_SSE)
-    } else if constexpr (std::same_as<reg_type, __m128> and std::same_as<First, float>) {
-        std::get<I>(array) = _mm_set1_ps(first);
-    } else if constexpr (std::same_as<reg_type, __m128> and std::same_as<First, double>) {
-        std::get<I>(array) = _mm_set1_pd(first);
+template<>
+struct dsp_register<__m128> {
+    using value_type = float;
+    constexpr static std::size_t size = 4;
+
+    [[nodiscard]] static __m128 load(float const *p) noexcept
+    {
+        return _mm_loadu_ps(p);
+    }
+
+    static void store(float *p, __m128 x) noexcept
+    {
+        _mm_storeu_ps(p, x);
+    }
+
+    [[nodiscard]] static __m128 broadcast(float x) noexcept
+    {
+        return _mm_set1_ps(x);
+    }
+};
 #endif
 
 #if defined(HI_HAS_SSE2)
-    } else if constexpr (std::same_as<reg_type, __m128i> and std::same_as<First, int>) {
-        std::get<I>(array) = _mm_set1_epi32(first);
+template<>
+struct dsp_register<__m128d> {
+    using value_type = double;
+    constexpr static std::size_t size = 2;
+
+    [[nodiscard]] static __m128d load(double const *p) noexcept
+    {
+        return _mm_loadu_pd(p);
+    }
+
+    static void store(double *p, __m128d x) noexcept
+    {
+        _mm_storeu_pd(p, x);
+    }
+
+    [[nodiscard]] static __m128d broadcast(double x) noexcept
+    {
+        return _mm_set1_pd(x);
+    }
+};
 #endif
 
 #if defined(HI_HAS_AVX)
-    } else if constexpr (std::same_as<reg_type, __m256> and std::same_as<First, float>) {
-        std::get<I>(array) = _mm256_set1_ps(first);
-    } else if constexpr (std::same_as<reg_type, __m256> and std::same_as<First, double>) {
-        std::get<I>(array) = _mm256_set1_pd(first);
-#endif
+template<>
+struct dsp_register<__m256> {
+    using value_type = float;
+    constexpr static std::size_t size = 8;
 
-#if defined(HI_HAS_AVX2)
-    } else if constexpr (std::same_as<reg_type, __m256i> and std::same_as<First, int>) {
-        std::get<I>(array) = _mm256_set1_epi32(first);
-#endif
+    [[nodiscard]] static __m256 load(float const *p) noexcept
+    {
+        return _mm256_loadu_ps(p);
+    }
 
-#if defined(HI_HAS_AVX512F)
-    } else if constexpr (std::same_as<reg_type, __m512> and std::same_as<First, float>) {
-        std::get<I>(array) = _mm512_set1_ps(first);
-    } else if constexpr (std::same_as<reg_type, __m512> and std::same_as<First, double>) {
-        std::get<I>(array) = _mm512_set1_pd(first);
-    } else if constexpr (std::same_as<reg_type, __m512i> and std::same_as<First, int>) {
-        std::get<I>(array) = _mm512_set1_epi32(first);
-#endif
+    static void store(float *p, __m256 x) noexcept
+    {
+        _mm256_storeu_ps(p, x);
     }
 
-    if constexpr (sizeof...(Rest) != 0) {
-        return dsp_init_scalar<I + 1>(array, rest...);
+    [[nodiscard]] static __m256 broadcast(float x) noexcept
+    {
+        return _mm256_set1_ps(x);
     }
-}
+};
 
-template<typename T, typename... Args>
-[[nodiscard]] constexpr auto dsp_regs_init(Args... args) noexcept
-{
-    auto r = std::array<T, sizeof...(Args)>{};
-    dsp_init_scalar<0>(r, args...);
-    return r;
-}
+template<>
+struct dsp_register<__m256d> {
+    using value_type = double;
+    constexpr static std::size_t size = 4;
 
-/**
- */
-template<typename Operation, typename T, dsp_apply_argument<T>... Args>
-constexpr void dsp_for_each(T *r, T *r_last, Args... args) noexcept
-{
-    using traits = dsp_op_traits<Operation>;
-   
-    auto T_regs = dsp_regs_init<T>(args...);
+    [[nodiscard]] static __m256d load(double const *p) noexcept
+    {
+        return _mm256_loadu_pd(p);
+    }
 
-    auto r_align = ceil(r, traits::best_alignment());
-    inplace_min(r_align, r_last);
+    static void store(double *p, __m256d x) noexcept
+    {
+        _mm256_storeu_pd(p, x);
+    }
 
-    while (r != r_align) {
-        *r++ = Operation{}();
+    [[nodiscard]] static __m256d broadcast(double x) noexcept
+    {
+        return _mm256_set1_pd(x);
     }
+};
+#endif
 
-#if defined(HI_HAS_AVX512F)
+} // namespace detail
 
+/** The widest register that is used to operate on values of type `T`.
+ */
+template<typename T>
+struct dsp_wide_register {
+    using type = T;
+};
 
-#elif defined(HI_HAS_AVX2)
+#if defined(HI_HAS_AVX)
+template<>
+struct dsp_wide_register<float> {
+    using type = __m256;
+};
 
+template<>
+struct dsp_wide_register<double> {
+    using type = __m256d;
+};
 
-#elif defined(HI_HAS_SSE)
+#elif defined(HI_HAS_SSE2)
+template<>
+struct dsp_wide_register<float> {
+    using type = __m128;
+};
+
+template<>
+struct dsp_wide_register<double> {
+    using type = __m128d;
+};
 
-#else
+#elif defined(HI_HAS_SSE)
+template<>
+struct dsp_wide_register<float> {
+    using type = __m128;
+};
 #endif
 
-    while (r != sse_align) {
-        T_regs = dsp_regs_load_and_increment<T>(args...);
-        *r++ = Operation{}(T_regs);
+template<typename T>
+using dsp_wide_register_t = dsp_wide_register<T>::type;
+
+/** A node of a DSP expression.
+ *
+ * A DSP expression is a tree of operations on sample arrays and constants, that
+ * is evaluated by `dsp_for_each()` in a single loop. Each node implements:
+ *  - `using value_type = T;`
+ *  - `std::size_t size() const` The number of samples available, or the maximum size for a constant.
+ *  - `template<typename Register> Register get(std::size_t i) const` The samples at index @a i.
+ */
+template<typename Context>
+concept dsp_expression = requires(Context const& c) {
+    typename Context::value_type;
+    {
+        c.size()
+    } -> std::convertible_to<std::size_t>;
+    {
+        Context::is_dsp_expression
+    } -> std::convertible_to<bool>;
+};
+
+/** A leaf of a DSP expression that reads samples from an array.
+ */
+template<std::floating_point T>
+class dsp_samples {
+public:
+    using value_type = T;
+    constexpr static bool is_dsp_expression = true;
+
+    constexpr dsp_samples(std::span<T const> samples) noexcept : _samples(samples) {}
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return _samples.size();
     }
 
-    if constexpr (traits{}::sse()) {
+    template<typename Register>
+    [[nodiscard]] constexpr Register get(std::size_t i) const noexcept
+    {
+        return detail::dsp_register<Register>::load(_samples.data() + i);
     }
-#endif
 
-}
+private:
+    std::span<T const> _samples;
+};
 
+template<typename T>
+dsp_samples(std::span<T const>) -> dsp_samples<T>;
 
-template<>
-struct dsp_op<"+", float> {
-    constexpr float operator()(float a, float b) const noexcept
+template<typename T>
+dsp_samples(std::span<T>) -> dsp_samples<T>;
+
+/** A leaf of a DSP expression with the same value for each sample.
+ */
+template<std::floating_point T>
+class dsp_constant {
+public:
+    using value_type = T;
+    constexpr static bool is_dsp_expression = true;
+
+    constexpr dsp_constant(T value) noexcept : _value(value) {}
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
     {
-        return a + b;
+        return std::numeric_limits<std::size_t>::max();
     }
 
-#if HI_HAS_SSE
-    __m128 operator()(__m128 a, __m128 b) const noexcept
+    template<typename Register>
+    [[nodiscard]] constexpr Register get(std::size_t) const noexcept
     {
-        return _mm_add_ps(a, b);
+        // The broadcast is hoisted out of the loop by the optimizer.
+        return detail::dsp_register<Register>::broadcast(_value);
     }
-#endif
 
-#if HI_HAS_AVX
-    __m256 operator()(__m256 a, __m256 b) const noexcept
+private:
+    T _value;
+};
+
+/** A node of a DSP expression that applies a `dsp_op` to two expressions.
+ */
+template<fixed_string Operation, dsp_expression LHS, dsp_expression RHS>
+    requires std::same_as<typename LHS::value_type, typename RHS::value_type>
+class dsp_binary_expression {
+public:
+    using value_type = LHS::value_type;
+    constexpr static bool is_dsp_expression = true;
+
+    constexpr dsp_binary_expression(LHS lhs, RHS rhs) noexcept : _lhs(lhs), _rhs(rhs) {}
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
     {
-        return _mm256_add_ps(a, b);
+        return std::min(_lhs.size(), _rhs.size());
     }
-#endif
 
-#if HI_HAS_AVX512F
-    __m512 operator()(__m512 a, __m512 b) const noexcept
+    template<typename Register>
+    [[nodiscard]] constexpr Register get(std::size_t i) const noexcept
     {
-        return _mm512_add_ps(a, b);
+        return dsp_op<Operation, value_type>{}(_lhs.template get<Register>(i), _rhs.template get<Register>(i));
     }
-#endif
+
+private:
+    LHS _lhs;
+    RHS _rhs;
 };
 
-}}
+namespace detail {
+
+template<typename T, typename Other>
+struct dsp_operand {
+    using type = T;
+};
+
+template<std::floating_point T, dsp_expression Other>
+struct dsp_operand<T, Other> {
+    using type = dsp_constant<typename Other::value_type>;
+};
+
+template<typename T, typename Other>
+using dsp_operand_t = dsp_operand<T, Other>::type;
+
+template<typename LHS, typename RHS>
+concept dsp_operands = (dsp_expression<LHS> and dsp_expression<RHS>) or
+    (dsp_expression<LHS> and std::floating_point<RHS>) or (std::floating_point<LHS> and dsp_expression<RHS>);
+
+template<fixed_string Operation, typename LHS, typename RHS>
+[[nodiscard]] constexpr auto make_dsp_binary_expression(LHS const& lhs, RHS const& rhs) noexcept
+{
+    using lhs_type = dsp_operand_t<LHS, RHS>;
+    using rhs_type = dsp_operand_t<RHS, LHS>;
+    return dsp_binary_expression<Operation, lhs_type, rhs_type>{lhs_type(lhs), rhs_type(rhs)};
+}
+
+} // namespace detail
+
+template<typename LHS, typename RHS>
+    requires detail::dsp_operands<LHS, RHS>
+[[nodiscard]] constexpr auto operator+(LHS const& lhs, RHS const& rhs) noexcept
+{
+    return detail::make_dsp_binary_expression<"+">(lhs, rhs);
+}
+
+template<typename LHS, typename RHS>
+    requires detail::dsp_operands<LHS, RHS>
+[[nodiscard]] constexpr auto operator-(LHS const& lhs, RHS const& rhs) noexcept
+{
+    return detail::make_dsp_binary_expression<"-">(lhs, rhs);
+}
+
+template<typename LHS, typename RHS>
+    requires detail::dsp_operands<LHS, RHS>
+[[nodiscard]] constexpr auto operator*(LHS const& lhs, RHS const& rhs) noexcept
+{
+    return detail::make_dsp_binary_expression<"*">(lhs, rhs);
+}
+
+/** Evaluate a DSP expression for each sample.
+ *
+ * The whole expression is evaluated in a single loop, with one load for each
+ * sample array and one store for each output sample. For example a cross-fade:
+ *
+ * ```
+ * dsp_for_each(out, dsp_samples{a} * gain + dsp_samples{b} * (1.0f - gain));
+ * ```
+ *
+ * The output may be one of the inputs of the expression.
+ *
+ * @param r The output samples.
+ * @param expression The expression to evaluate, each of its sample arrays must be at least as large as @a r.
+ */
+template<std::floating_point T, dsp_expression Expression>
+    requires std::same_as<T, typename Expression::value_type>
+constexpr void dsp_for_each(std::span<T> r, Expression const& expression) noexcept
+{
+    hi_axiom(expression.size() >= r.size());
+
+    auto i = 0_uz;
+
+    if (not std::is_constant_evaluated()) {
+        using wide_type = dsp_wide_register_t<T>;
+        using wide_register = detail::dsp_register<wide_type>;
+
+        if constexpr (wide_register::size > 1) {
+            for (auto const wide_end = floor(r.size(), wide_register::size); i != wide_end; i += wide_register::size) {
+                wide_register::store(r.data() + i, expression.template get<wide_type>(i));
+            }
+        }
+    }
+
+    for (; i != r.size(); ++i) {
+        r[i] = expression.template get<T>(i);
+    }
+}
+
+}} // namespace hi::inline v1
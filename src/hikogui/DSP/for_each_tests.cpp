@@ -0,0 +1,55 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "for_each.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <span>
+#include <cstddef>
+
+TEST_SUITE(dsp_for_each_suite) {
+
+TEST_CASE(crossfade)
+{
+    // An odd size, so that both the wide loop and the scalar tail are used.
+    auto a = std::vector<float>(37);
+    auto b = std::vector<float>(37);
+    auto out = std::vector<float>(37);
+    for (std::size_t i = 0; i != a.size(); ++i) {
+        a[i] = static_cast<float>(i);
+        b[i] = 100.0f - static_cast<float>(i);
+    }
+
+    auto const gain = 0.25f;
+    hi::dsp_for_each(std::span{out}, hi::dsp_samples{std::span{a}} * gain + hi::dsp_samples{std::span{b}} * (1.0f - gain));
+
+    for (std::size_t i = 0; i != out.size(); ++i) {
+        REQUIRE(out[i] == a[i] * gain + b[i] * (1.0f - gain), 0.0001f);
+    }
+}
+
+TEST_CASE(in_place)
+{
+    auto samples = std::vector<double>(11, 2.0);
+
+    auto const s = hi::dsp_samples{std::span{samples}};
+    hi::dsp_for_each(std::span{samples}, 1.0 - s * s);
+
+    for (auto const sample : samples) {
+        REQUIRE(sample == -3.0);
+    }
+}
+
+TEST_CASE(constant_evaluated)
+{
+    constexpr auto r = [] {
+        float a[3] = {1.0f, 2.0f, 3.0f};
+        float out[3] = {};
+        hi::dsp_for_each(std::span<float>{out}, hi::dsp_samples{std::span<float const>{a}} - 1.0f);
+        return out[2];
+    }();
+    static_assert(r == 2.0f);
+}
+
+};
@@ -1,11 +1,18 @@
 
 #pragma once
 
+#include "draw_context_cache.hpp" // export
 #include "draw_context_intf.hpp" // export
 #include "draw_context_impl.hpp" // export
+#include "draw_text_cache.hpp" // export
+#include "gfx_atlas_allocator.hpp" // export
 #include "gfx_device_vulkan_intf.hpp" // export
 #include "gfx_device_vulkan_impl.hpp" // export
+#include "gfx_memory_budget.hpp" // export
+#include "gfx_page_allocator.hpp" // export
 #include "gfx_queue_vulkan.hpp" // export
+#include "gfx_readback_vulkan.hpp" // export
+#include "gfx_render_thread.hpp" // export
 #include "gfx_surface_delegate_vulkan.hpp" // export
 #include "gfx_surface_state.hpp" // export
 #include "gfx_surface_vulkan_intf.hpp" // export
@@ -13,6 +20,8 @@
 #include "gfx_system_globals.hpp" // export
 #include "gfx_system_vulkan_intf.hpp" // export
 #include "gfx_system_vulkan_impl.hpp" // export
+#include "gfx_timestamp_queries_vulkan.hpp" // export
+#include "gfx_vertex_ring_vulkan.hpp" // export
 #include "gfx_pipeline_override_vulkan_intf.hpp" // export
 #include "gfx_pipeline_override_vulkan_impl.hpp" // export
 #include "gfx_pipeline_box_vulkan_intf.hpp" // export
@@ -26,6 +35,7 @@
 #include "gfx_pipeline_vulkan_intf.hpp" // export
 #include "gfx_pipeline_vulkan_impl.hpp" // export
 #include "render_doc.hpp" // export
+#include "sdf_glyph_cache.hpp" // export
 
 hi_export_module(hikogui.GFX);
 
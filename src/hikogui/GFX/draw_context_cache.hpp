@@ -0,0 +1,183 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "draw_context_intf.hpp"
+#include "gfx_device_vulkan_intf.hpp"
+#include "../geometry/geometry.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+
+hi_export_module(hikogui.GFX : draw_context_cache);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Retained vertices of a widget-subtree.
+ *
+ * When a widget-subtree has not changed since the previous frame the
+ * vertices that were recorded during the previous frame are appended
+ * to the draw context, instead of drawing the widgets again.
+ *
+ * The owner of the cache is responsible for calling `invalidate()` when
+ * the subtree changes, for example on layout, on constraints and when
+ * a redraw is requested by one of the widgets in the subtree. The cache is
+ * also invalidated when glyphs are evicted from the glyph atlas.
+ */
+class draw_context_cache {
+public:
+    draw_context_cache() noexcept = default;
+    draw_context_cache(draw_context_cache const&) = delete;
+    draw_context_cache& operator=(draw_context_cache const&) = delete;
+
+    draw_context_cache(draw_context_cache&& other) noexcept :
+        _buffers(std::move(other._buffers)),
+        _atlas_pages(std::move(other._atlas_pages)),
+        _device(other._device),
+        _rectangle(other._rectangle),
+        _generation(other._generation.load(std::memory_order::relaxed)),
+        _valid_generation(other._valid_generation),
+        _atlas_generation(other._atlas_generation),
+        _movable(other._movable)
+    {
+    }
+
+    draw_context_cache& operator=(draw_context_cache&& other) noexcept
+    {
+        _buffers = std::move(other._buffers);
+        _atlas_pages = std::move(other._atlas_pages);
+        _device = other._device;
+        _rectangle = other._rectangle;
+        _generation.store(other._generation.load(std::memory_order::relaxed), std::memory_order::relaxed);
+        _valid_generation = other._valid_generation;
+        _atlas_generation = other._atlas_generation;
+        _movable = other._movable;
+        return *this;
+    }
+
+    /** Forget the retained vertices.
+     *
+     * This function may be called during drawing of the subtree, in that
+     * case the vertices recorded during this drawing are not retained.
+     *
+     * @note It is safe to call this function from other threads, such as
+     *       the threads of `draw_context::draw_parallel()`, while drawing.
+     */
+    void invalidate() noexcept
+    {
+        _generation.fetch_add(1, std::memory_order::relaxed);
+    }
+
+    /** Draw a widget-subtree, or replay its retained vertices.
+     *
+     * @param context The draw context to draw into.
+     * @param rectangle The clipping rectangle of the subtree in window coordinates.
+     * @param func The function `void(draw_context const&)` that draws the subtree.
+     */
+    template<typename Func>
+    void draw(draw_context const& context, aarectangle const& rectangle, Func const& func)
+    {
+        return draw(context, rectangle, false, func);
+    }
+
+    /** Draw a widget-subtree, or replay its retained vertices.
+     *
+     * When @a movable is set and the subtree was moved by a whole number of
+     * pixels, for example by scrolling, the retained vertices are moved instead
+     * of drawing the subtree again. This is only correct when the subtree is not
+     * clipped by its ancestors, both when it was drawn and now.
+     *
+     * @param context The draw context to draw into.
+     * @param rectangle The clipping rectangle of the subtree in window coordinates.
+     * @param movable The subtree is not clipped by its ancestors.
+     * @param func The function `void(draw_context const&)` that draws the subtree.
+     */
+    template<typename Func>
+    void draw(draw_context const& context, aarectangle const& rectangle, bool movable, Func const& func)
+    {
+        hi_axiom_not_null(context.device);
+        auto const atlas_generation = context.device->SDF_pipeline->atlas_generation.load(std::memory_order::relaxed);
+
+        auto const valid = _valid_generation == _generation.load(std::memory_order::relaxed);
+        if (valid and _device == context.device and _atlas_generation == atlas_generation) {
+            if (_rectangle == rectangle) {
+                ++global_counter<"draw_context_cache:hit">;
+                context.device->SDF_pipeline->touch_atlas_pages(_atlas_pages);
+                context.join(*_buffers);
+                return;
+            }
+
+            auto const offset = get<0>(rectangle) - get<0>(_rectangle);
+            if (movable and _movable and rectangle.size() == _rectangle.size() and offset.x() == std::round(offset.x()) and
+                offset.y() == std::round(offset.y()) and intersect(context.scissor_rectangle, rectangle) == rectangle and
+                not context.overlaps_occluder(rectangle)) {
+                // Glyphs are positioned on sub-pixels, so they may only be moved by whole pixels.
+                ++global_counter<"draw_context_cache:move">;
+                context.device->SDF_pipeline->touch_atlas_pages(_atlas_pages);
+                context.join(*_buffers, translate2{offset});
+                return;
+            }
+        }
+
+        if (intersect(context.scissor_rectangle, rectangle) != rectangle or context.overlaps_occluder(rectangle)) {
+            // Widgets outside of the scissor rectangle or behind an occluder are not drawn,
+            // therefor a partial draw can not be retained for the next frame.
+            ++global_counter<"draw_context_cache:partial">;
+            invalidate();
+            return func(context);
+        }
+
+        ++global_counter<"draw_context_cache:miss">;
+        if (not _buffers) {
+            _buffers = context.make_buffers();
+        }
+
+        // The subtree may request a redraw while it is being drawn, then the
+        // generation changes and the recorded vertices are not valid.
+        auto const generation = _generation.fetch_add(1, std::memory_order::relaxed) + 1;
+        func(context.fork(*_buffers));
+        context.join(*_buffers);
+
+        if (_buffers->pending_glyphs_rectangle) {
+            // The subtree must be drawn again when the glyphs become available.
+            ++global_counter<"draw_context_cache:pending">;
+        } else {
+            _valid_generation = generation;
+        }
+        _atlas_pages = gfx_pipeline_SDF::device_shared::atlas_pages(_buffers->sdf.vertices);
+        _device = context.device;
+        _rectangle = rectangle;
+        _atlas_generation = atlas_generation;
+        _movable = movable;
+    }
+
+private:
+    std::unique_ptr<draw_context_buffers> _buffers = {};
+
+    /** The glyph atlas pages used by the retained vertices, touched on replay.
+     */
+    std::vector<uint32_t> _atlas_pages = {};
+
+    gfx_device *_device = nullptr;
+    aarectangle _rectangle = {};
+
+    /** Incremented on each drawing and invalidation.
+     */
+    std::atomic<std::size_t> _generation = 1;
+
+    /** The generation of the retained vertices, valid when equal to `_generation`.
+     */
+    std::size_t _valid_generation = 0;
+
+    std::size_t _atlas_generation = 0;
+    bool _movable = false;
+};
+
+}} // namespace hi::v1
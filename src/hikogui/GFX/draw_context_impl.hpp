@@ -12,6 +12,10 @@
 #include "gfx_device_vulkan_intf.hpp"
 #include "../text/text.hpp"
 #include "../macros.hpp"
+#include <span>
+#include <utility>
+#include <tuple>
+#include <cmath>
 
 hi_export_module(hikogui.GFX : draw_context_impl);
 
@@ -19,22 +23,141 @@ hi_export namespace hi { inline namespace v1 {
 
 inline draw_context::draw_context(
     gfx_device& device,
-    vector_span<gfx_pipeline_box::vertex>& box_vertices,
+    vector_span<gfx_pipeline_box::instance>& box_instances,
     vector_span<gfx_pipeline_image::vertex>& image_vertices,
-    vector_span<gfx_pipeline_SDF::vertex>& sdf_vertices,
-    vector_span<gfx_pipeline_override::vertex>& override_vertices) noexcept :
+    vector_span<gfx_pipeline_SDF::instance>& sdf_instances,
+    vector_span<gfx_pipeline_override::vertex>& override_vertices,
+    bool& has_hdr_colors,
+    aarectangle& pending_glyphs_rectangle,
+    std::vector<draw_occluder>& occluders) noexcept :
     device(std::addressof(device)),
     frame_buffer_index(std::numeric_limits<size_t>::max()),
     scissor_rectangle(),
-    _box_vertices(&box_vertices),
+    _box_instances(&box_instances),
     _image_vertices(&image_vertices),
-    _sdf_vertices(&sdf_vertices),
-    _override_vertices(&override_vertices)
+    _sdf_instances(&sdf_instances),
+    _override_vertices(&override_vertices),
+    _has_hdr_colors(&has_hdr_colors),
+    _pending_glyphs_rectangle(&pending_glyphs_rectangle),
+    _occluders(&occluders)
 {
-    _box_vertices->clear();
+    _box_instances->clear();
     _image_vertices->clear();
-    _sdf_vertices->clear();
+    _sdf_instances->clear();
     _override_vertices->clear();
+    *_has_hdr_colors = false;
+    *_pending_glyphs_rectangle = aarectangle{};
+    _occluders->clear();
+}
+
+[[nodiscard]] inline draw_context draw_context::fork(draw_context_buffers& buffers) const noexcept
+{
+    auto r = *this;
+    r._box_instances = &buffers.box.vertices;
+    r._image_vertices = &buffers.image.vertices;
+    r._sdf_instances = &buffers.sdf.vertices;
+    r._override_vertices = &buffers.override_.vertices;
+    r._has_hdr_colors = &buffers.has_hdr_colors;
+    r._pending_glyphs_rectangle = &buffers.pending_glyphs_rectangle;
+
+    r._box_instances->clear();
+    r._image_vertices->clear();
+    r._sdf_instances->clear();
+    r._override_vertices->clear();
+    *r._has_hdr_colors = false;
+    *r._pending_glyphs_rectangle = aarectangle{};
+    return r;
+}
+
+namespace detail {
+
+template<fixed_string OverflowCounter, typename T>
+void draw_context_join(vector_span<T>& dst, vector_span<T> const& src) noexcept
+{
+    for (auto const& vertex : src) {
+        if (dst.full()) {
+            ++global_counter<OverflowCounter>;
+            return;
+        }
+        dst.push_back(vertex);
+    }
+}
+
+/** Append vertices, after modifying a copy of each vertex with @a func.
+ */
+template<fixed_string OverflowCounter, typename T, typename Func>
+void draw_context_join(vector_span<T>& dst, vector_span<T> const& src, Func const& func) noexcept
+{
+    for (auto vertex : src) {
+        if (dst.full()) {
+            ++global_counter<OverflowCounter>;
+            return;
+        }
+        func(vertex);
+        dst.push_back(vertex);
+    }
+}
+
+} // namespace detail
+
+inline void draw_context::join(draw_context_buffers const& buffers) const noexcept
+{
+    detail::draw_context_join<"draw_box::overflow">(*_box_instances, buffers.box.vertices);
+    detail::draw_context_join<"draw_image::overflow">(*_image_vertices, buffers.image.vertices);
+    detail::draw_context_join<"draw_glyph::overflow">(*_sdf_instances, buffers.sdf.vertices);
+    detail::draw_context_join<"override::overflow">(*_override_vertices, buffers.override_.vertices);
+    *_has_hdr_colors |= buffers.has_hdr_colors;
+    *_pending_glyphs_rectangle |= buffers.pending_glyphs_rectangle;
+}
+
+inline void draw_context::join(draw_context_buffers const& buffers, translate2 const& offset) const noexcept
+{
+    // Positions are moved in x and y, clipping rectangles are stored as (left, bottom, right, top).
+    auto const position_offset = static_cast<f32x4>(offset).xy00();
+    auto const clipping_offset = static_cast<f32x4>(offset).xyxy();
+
+    detail::draw_context_join<"draw_box::overflow">(*_box_instances, buffers.box.vertices, [&](auto& instance) {
+        for (auto& corner : instance.corners) {
+            corner = static_cast<f32x4>(corner) + position_offset;
+        }
+        instance.clipping_rectangle = static_cast<f32x4>(instance.clipping_rectangle) + clipping_offset;
+    });
+    detail::draw_context_join<"draw_image::overflow">(*_image_vertices, buffers.image.vertices, [&](auto& vertex) {
+        vertex.position = static_cast<f32x4>(vertex.position) + position_offset;
+        vertex.clipping_rectangle = static_cast<f32x4>(vertex.clipping_rectangle) + clipping_offset;
+    });
+    detail::draw_context_join<"draw_glyph::overflow">(*_sdf_instances, buffers.sdf.vertices, [&](auto& instance) {
+        // Each element of the corners holds the positions of two corners.
+        for (auto& corners : instance.corners) {
+            corners = static_cast<f32x4>(corners) + clipping_offset;
+        }
+        instance.clipping_rectangle = static_cast<f32x4>(instance.clipping_rectangle) + clipping_offset;
+    });
+    detail::draw_context_join<"override::overflow">(*_override_vertices, buffers.override_.vertices, [&](auto& vertex) {
+        vertex.position = static_cast<f32x4>(vertex.position) + position_offset;
+        vertex.clipping_rectangle = static_cast<f32x4>(vertex.clipping_rectangle) + clipping_offset;
+    });
+    *_has_hdr_colors |= buffers.has_hdr_colors;
+    if (buffers.pending_glyphs_rectangle) {
+        *_pending_glyphs_rectangle |= offset * buffers.pending_glyphs_rectangle;
+    }
+}
+
+[[nodiscard]] inline bool draw_context::is_occluded(aarectangle const& clipping_rectangle, quad const& box) const noexcept
+{
+    if (_occluders->empty()) {
+        return false;
+    }
+
+    auto const rectangle = intersect(clipping_rectangle, bounding_rectangle(box));
+    auto const elevation = box.p0.z();
+    for (auto const& occluder : *_occluders) {
+        if (occluder.elevation > elevation and intersect(occluder.rectangle, rectangle) == rectangle) {
+            ++global_counter<"draw_context:occluded">;
+            return true;
+        }
+    }
+    return false;
 }
 
 inline void
@@ -65,14 +188,21 @@ draw_context::_draw_box(aarectangle const& clipping_rectangle, quad box, draw_at
         attributes.corner_radius;
     // clang-format on
 
-    if (_box_vertices->full()) {
+    if (_box_instances->full()) {
         // Too many boxes where added, just don't draw them anymore.
         ++global_counter<"draw_box::overflow">;
         return;
     }
 
-    gfx_pipeline_box::device_shared::place_vertices(
-        *_box_vertices,
+    // The anti-aliasing and half of the border are drawn outside of the box.
+    if (is_occluded(clipping_rectangle, box_ + (attributes.line_width * 0.5f + 1.0f))) {
+        return;
+    }
+
+    record_colors(attributes.fill_color);
+    record_colors(attributes.line_color);
+    gfx_pipeline_box::device_shared::place_instance(
+        *_box_instances,
         clipping_rectangle,
         box_,
         attributes.fill_color,
@@ -81,6 +211,112 @@ draw_context::_draw_box(aarectangle const& clipping_rectangle, quad box, draw_at
         corner_radius);
 }
 
+inline void draw_context::_draw_polyline(
+    aarectangle const& clipping_rectangle,
+    translate3 const& transform,
+    std::span<point2 const> points,
+    draw_attributes const& attributes) const noexcept
+{
+    hi_assert_not_null(_box_instances);
+
+    if (points.size() < 2) {
+        return;
+    }
+
+    auto const radius = attributes.line_width * 0.5f;
+
+    // The joins and caps extend at most a radius beyond the points, the anti-aliasing is drawn outside of the line.
+    auto bounding_box = aarectangle{points.front(), points.front()};
+    for (auto const& point : points) {
+        bounding_box |= point;
+    }
+    if (is_occluded(clipping_rectangle, transform * quad{bounding_box + (attributes.line_width + 1.0f)})) {
+        return;
+    }
+
+    record_colors(attributes.fill_color);
+
+    struct segment_end {
+        /** The length to extend the segment beyond its end point.
+         */
+        float extension = 0.0f;
+        bool round = false;
+    };
+
+    auto const cap = [&](line_end_cap end_cap) {
+        return end_cap == line_end_cap::round ? segment_end{radius, true} : segment_end{};
+    };
+
+    auto const join = [&](vector2 from, vector2 to) {
+        if (attributes.line_join == line_join_style::none) {
+            return segment_end{};
+        }
+
+        auto const cos_angle = dot(from, to);
+        if (attributes.line_join == line_join_style::miter and cos_angle >= 0.0f) {
+            // Extend both segments until their outer corners meet: radius * tan(angle / 2).
+            return segment_end{radius * std::sqrt((1.0f - cos_angle) / (1.0f + cos_angle)), false};
+        }
+
+        // The round ends of both segments overlap to form a round join.
+        return segment_end{radius, true};
+    };
+
+    auto const place_segment = [&](point2 first, point2 last, vector2 tangent, segment_end begin, segment_end end) {
+        if (_box_instances->full()) {
+            ++global_counter<"draw_box::overflow">;
+            return;
+        }
+
+        auto const n = normal(tangent);
+        auto const origin = first - n * radius - tangent * begin.extension;
+        auto const right = (last - first) + tangent * (begin.extension + end.extension);
+        auto const box = transform * quad{rectangle{origin, right, n * attributes.line_width}};
+
+        gfx_pipeline_box::device_shared::place_instance(
+            *_box_instances,
+            clipping_rectangle,
+            box,
+            attributes.fill_color,
+            attributes.line_color,
+            0.0f,
+            make_corner_radii(
+                attributes.line_width,
+                begin.round ? line_end_cap::round : line_end_cap::flat,
+                end.round ? line_end_cap::round : line_end_cap::flat));
+    };
+
+    // Each segment is placed when the direction of the next segment is known.
+    auto begin = cap(attributes.begin_line_cap);
+    auto first = point2{};
+    auto last = point2{};
+    auto tangent = vector2{};
+    auto has_segment = false;
+    auto previous = points.front();
+    for (auto const& point : points.subspan(1)) {
+        if (point == previous) {
+            continue;
+        }
+
+        auto const next_tangent = normalize(point - previous);
+        if (has_segment) {
+            auto const end = join(tangent, next_tangent);
+            place_segment(first, last, tangent, begin, end);
+            begin = end;
+        }
+
+        first = previous;
+        last = point;
+        tangent = next_tangent;
+        has_segment = true;
+        previous = point;
+    }
+
+    if (has_segment) {
+        place_segment(first, last, tangent, begin, cap(attributes.end_line_cap));
+    }
+}
+
 [[nodiscard]] inline bool draw_context::_draw_image(
     aarectangle const& clipping_rectangle,
     quad const& box,
@@ -88,10 +324,15 @@ draw_context::_draw_box(aarectangle const& clipping_rectangle, quad box, draw_at
 {
     hi_assert_not_null(_image_vertices);
 
-    if (image.state != gfx_pipeline_image::paged_image::state_type::uploaded) {
+    if (not image.is_uploaded() or image.device != device) {
+        // An image that was uploaded to another device can not be drawn on this device.
         return false;
     }
 
+    if (is_occluded(clipping_rectangle, box)) {
+        return true;
+    }
+
     device->image_pipeline->place_vertices(*_image_vertices, clipping_rectangle, box, image);
     return true;
 }
@@ -103,9 +344,9 @@ inline void draw_context::_draw_glyph(
     glyph_id glyph,
     draw_attributes const& attributes) const noexcept
 {
-    hi_assert_not_null(_sdf_vertices);
+    hi_assert_not_null(_sdf_instances);
 
-    if (_sdf_vertices->full()) {
+    if (_sdf_instances->full()) {
         auto box_attributes = attributes;
         box_attributes.fill_color = hi::color{1.0f, 0.0f, 1.0f}; // Magenta.
         _draw_box(clipping_rectangle, box, box_attributes);
@@ -113,45 +354,224 @@ inline void draw_context::_draw_glyph(
         return;
     }
 
-    auto const atlas_was_updated =
-        device->SDF_pipeline->place_vertices(*_sdf_vertices, clipping_rectangle, box, font, glyph, attributes.fill_color);
+    if (is_occluded(clipping_rectangle, box)) {
+        return;
+    }
 
-    if (atlas_was_updated) {
+    if (_place_glyph(clipping_rectangle, box, font, glyph, attributes.fill_color)) {
         device->SDF_pipeline->prepare_atlas_for_rendering();
     }
 }
 
-inline void draw_context::_draw_text(
+inline bool draw_context::_place_glyph(
+    aarectangle const& clipping_rectangle,
+    quad const& box,
+    hi::font_id font,
+    glyph_id glyph,
+    quad_color const& color) const noexcept
+{
+    if (font->has_bitmaps()) {
+        if (auto const *image = device->image_pipeline->get_glyph_image(device, font, glyph)) {
+            if (not _draw_image(clipping_rectangle, box, *image)) {
+                // The glyph becomes visible after the image has been copied into the atlas.
+                record_pending_glyph(clipping_rectangle, box);
+                gfx_pipeline_image::device_shared::glyph_image_pending();
+            }
+            return false;
+        }
+    }
+
+    auto const layers = font->get_color_layers(glyph);
+    if (layers.empty()) {
+        record_colors(color);
+        auto const num_instances = _sdf_instances->size();
+        auto const atlas_was_updated =
+            device->SDF_pipeline->place_instance(*_sdf_instances, clipping_rectangle, box, font, glyph, color);
+        if (_sdf_instances->size() == num_instances) {
+            // The glyph is being rasterized.
+            record_pending_glyph(clipping_rectangle, box);
+        }
+        return atlas_was_updated;
+    }
+
+    // The box of the glyph is the union of the bounding rectangles of its layers.
+    auto glyph_rectangle = aarectangle{};
+    for (auto const& layer : layers) {
+        glyph_rectangle |= layer.bounding_rectangle;
+    }
+
+    auto atlas_was_updated = false;
+    for (auto const& layer : layers) {
+        if (_sdf_instances->full()) {
+            ++global_counter<"draw_glyph::overflow">;
+            break;
+        }
+
+        auto const layer_color = layer.foreground ? color : quad_color{layer.color};
+        auto const layer_box = map_onto_quad(box, glyph_rectangle, layer.bounding_rectangle);
+
+        record_colors(layer_color);
+        auto const num_instances = _sdf_instances->size();
+        atlas_was_updated |=
+            device->SDF_pipeline->place_instance(*_sdf_instances, clipping_rectangle, layer_box, font, layer.glyph, layer_color);
+        if (_sdf_instances->size() == num_instances) {
+            record_pending_glyph(clipping_rectangle, layer_box);
+        }
+    }
+    return atlas_was_updated;
+}
+
+inline void draw_context::_draw_path(
+    aarectangle const& clipping_rectangle,
+    graphic_path const& path,
+    float z,
+    draw_attributes const& attributes) const noexcept
+{
+    hi_assert_not_null(_sdf_instances);
+    hi_assert(not path.hasLayers());
+
+    if (_sdf_instances->full()) {
+        ++global_counter<"draw_path::overflow">;
+        return;
+    }
+
+    if (is_occluded(clipping_rectangle, quad{path.boundingBox()})) {
+        return;
+    }
+
+    record_colors(attributes.fill_color);
+    device->SDF_pipeline->place_instances(*_sdf_instances, clipping_rectangle, path, z, attributes.fill_color.p0);
+}
+
+inline bool draw_context::_place_text(
     aarectangle const& clipping_rectangle,
     matrix3 const& transform,
     text_shaper const& text,
     draw_attributes const& attributes) const noexcept
 {
-    hi_assert_not_null(_sdf_vertices);
+    hi_assert_not_null(_sdf_instances);
 
     auto atlas_was_updated = false;
+    auto complete = true;
     for (auto const& c : text) {
         auto const box = translate2{c.position} * c.metrics.bounding_rectangle;
         auto const color = attributes.num_colors > 0 ? attributes.fill_color : quad_color{c.style.color()};
 
-        if (not is_visible(c.general_category)) {
+        if (not is_visible(c.general_category) or c.glyphs.glyphs.empty()) {
+            // Invisible characters and characters that are part of a ligature are not drawn.
             continue;
 
-        } else if (_sdf_vertices->full()) {
+        } else if (_sdf_instances->full()) {
             auto box_attributes = attributes;
             box_attributes.fill_color = hi::color{1.0f, 0.0f, 1.0f}; // Magenta.
             _draw_box(clipping_rectangle, box, box_attributes);
             ++global_counter<"draw_glyph::overflow">;
+            complete = false;
             break;
         }
 
-        atlas_was_updated |= device->SDF_pipeline->place_vertices(
-            *_sdf_vertices, clipping_rectangle, transform * box, *c.glyphs.font, c.glyphs.front(), color);
+        auto const box_on_window = transform * box;
+        if (is_occluded(clipping_rectangle, box_on_window)) {
+            complete = false;
+            continue;
+        }
+
+        // Bitmap glyphs are drawn as images, glyphs that are being rasterized are drawn later.
+        complete &= not c.glyphs.font->has_bitmaps();
+        auto const num_instances = _sdf_instances->size();
+        atlas_was_updated |= _place_glyph(clipping_rectangle, box_on_window, c.glyphs.font, c.glyphs.front(), color);
+        complete &= _sdf_instances->size() != num_instances;
     }
 
     if (atlas_was_updated) {
         device->SDF_pipeline->prepare_atlas_for_rendering();
     }
+    return complete;
+}
+
+inline void draw_context::_draw_text(
+    aarectangle const& clipping_rectangle,
+    matrix3 const& transform,
+    text_shaper const& text,
+    draw_attributes const& attributes) const noexcept
+{
+    std::ignore = _place_text(clipping_rectangle, transform, text, attributes);
+}
+
+inline void draw_context::_draw_text(
+    aarectangle const& clipping_rectangle,
+    matrix3 const& transform,
+    text_shaper const& text,
+    draw_text_cache& cache,
+    draw_attributes const& attributes) const noexcept
+{
+    hi_assert_not_null(_sdf_instances);
+    hi_assert_not_null(device);
+
+    auto const atlas_generation = device->SDF_pipeline->atlas_generation.load(std::memory_order::relaxed);
+    auto const fill_color = attributes.num_colors > 0 ? attributes.fill_color : quad_color{};
+    // Occluders are added each frame, text that may be partially hidden is drawn glyph by glyph.
+    auto const occluded = overlaps_occluder(clipping_rectangle);
+
+    if (cache._valid and not occluded and cache._device == device and cache._atlas_generation == atlas_generation and
+        cache._text_generation == text.generation() and cache._num_colors == attributes.num_colors and
+        cache._fill_color == fill_color) {
+        auto const offset = get<3>(transform) - get<3>(cache._transform);
+        auto const move = translate2{offset.x(), offset.y()};
+        auto const moved_transform =
+            matrix3{get<0>(cache._transform), get<1>(cache._transform), get<2>(cache._transform), get<3>(transform)};
+
+        // Glyphs are positioned on sub-pixels, so they may only be moved by whole pixels.
+        if (moved_transform == transform and offset.z() == 0.0f and offset.x() == std::round(offset.x()) and
+            offset.y() == std::round(offset.y()) and clipping_rectangle == move * cache._clipping_rectangle) {
+            ++global_counter<"draw_text_cache:hit">;
+            device->SDF_pipeline->touch_atlas_pages(cache._atlas_pages);
+
+            auto const clipping_offset = static_cast<f32x4>(move).xyxy();
+            for (auto instance : cache._instances) {
+                if (_sdf_instances->full()) {
+                    ++global_counter<"draw_glyph::overflow">;
+                    break;
+                }
+                for (auto& corners : instance.corners) {
+                    corners = static_cast<f32x4>(corners) + clipping_offset;
+                }
+                instance.clipping_rectangle = static_cast<f32x4>(instance.clipping_rectangle) + clipping_offset;
+                _sdf_instances->push_back(instance);
+            }
+
+            if (cache._has_hdr_colors) {
+                *_has_hdr_colors = true;
+            }
+            return;
+        }
+    }
+
+    ++global_counter<"draw_text_cache:miss">;
+    auto const first = _sdf_instances->size();
+    auto const has_hdr_colors = std::exchange(*_has_hdr_colors, false);
+
+    auto const complete = _place_text(clipping_rectangle, transform, text, attributes);
+
+    cache._has_hdr_colors = *_has_hdr_colors;
+    *_has_hdr_colors |= has_hdr_colors;
+
+    // Text that was partially culled or drawn as images can not be replayed.
+    cache._valid = complete and not occluded;
+    if (cache._valid) {
+        cache._instances.clear();
+        for (auto i = first; i != _sdf_instances->size(); ++i) {
+            cache._instances.push_back((*_sdf_instances)[i]);
+        }
+        cache._atlas_pages = gfx_pipeline_SDF::device_shared::atlas_pages(cache._instances);
+        cache._device = device;
+        cache._atlas_generation = atlas_generation;
+        cache._text_generation = text.generation();
+        cache._transform = transform;
+        cache._clipping_rectangle = clipping_rectangle;
+        cache._fill_color = fill_color;
+        cache._num_colors = attributes.num_colors;
+    }
 }
 
 inline void draw_context::_draw_text_selection(
@@ -8,14 +8,23 @@
 #include "gfx_pipeline_image_vulkan_intf.hpp"
 #include "gfx_pipeline_SDF_vulkan_intf.hpp"
 #include "gfx_pipeline_override_vulkan_intf.hpp"
+#include "draw_text_cache.hpp"
 #include "../settings/settings.hpp"
 #include "../geometry/geometry.hpp"
 #include "../unicode/unicode.hpp"
 #include "../text/text.hpp"
 #include "../color/color.hpp"
 #include "../container/container.hpp"
+#include "../dispatch/dispatch.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
+#include <memory>
+#include <span>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <ranges>
+#include <memory_resource>
 
 hi_export_module(hikogui.GFX : draw_context_intf);
 
@@ -41,7 +50,8 @@ enum class border_side {
 
 template<typename Context>
 concept draw_attribute = std::same_as<Context, quad_color> or std::same_as<Context, color> or
-    std::same_as<Context, border_side> or std::same_as<Context, line_end_cap> or std::same_as<Context, corner_radii> or
+    std::same_as<Context, border_side> or std::same_as<Context, line_end_cap> or std::same_as<Context, line_join_style> or
+    std::same_as<Context, corner_radii> or
     std::same_as<Context, aarectangle> or std::same_as<Context, float> or std::same_as<Context, int>;
 
 /** The draw attributes used to draw shaped into the draw context.
@@ -90,6 +100,10 @@ struct draw_attributes {
      */
     line_end_cap end_line_cap = line_end_cap::flat;
 
+    /** The shape of the corners between the segments of a polyline.
+     */
+    line_join_style line_join = line_join_style::miter;
+
     constexpr draw_attributes(draw_attributes const&) noexcept = default;
     constexpr draw_attributes(draw_attributes&&) noexcept = default;
     constexpr draw_attributes& operator=(draw_attributes const&) noexcept = default;
@@ -105,6 +119,8 @@ struct draw_attributes {
      *  - By default the `begin_line_cap` and `end_line_cap` are set to flat.
      *  - The first `hi::line_end_cap` is used for both the `begin_line_cap` and `end_line_cap`.
      *  - The second `hi::line_end_cap` is used to override the `end_line_cap`.
+     *  - By default the `line_join` is set to miter.
+     *  - A `hi::line_join_style` argument is used to set the `line_join`.
      *  - By default the `border_side` is set to `border_side::on`
      *  - A `hi::border_side` argument is used to set the `border_side`.
      *  - By default the `corner_radius` are set to (0, 0, 0, 0).
@@ -152,6 +168,13 @@ struct draw_attributes {
             }
             hi_axiom(num_line_caps <= 2);
 
+        } else if constexpr (std::is_same_v<T, line_join_style>) {
+            line_join = attribute;
+#ifndef NDEBUG
+            hi_assert(not _has_line_join);
+            _has_line_join = true;
+#endif
+
         } else if constexpr (std::is_same_v<T, hi::border_side>) {
             border_side = attribute;
 #ifndef NDEBUG
@@ -197,6 +220,7 @@ private:
     bool _has_corner_radii = false;
     bool _has_clipping_rectangle = false;
     bool _has_line_width = false;
+    bool _has_line_join = false;
 #endif
 };
 
@@ -204,6 +228,93 @@ template<typename Context>
 concept draw_quad_shape = std::same_as<Context, quad> or std::same_as<Context, rectangle> or std::same_as<Context, aarectangle> or
     std::same_as<Context, aarectangle>;
 
+/** Vertex storage for a single pipeline, used when drawing on a separate thread.
+ */
+template<typename Vertex>
+class draw_context_buffer {
+public:
+    using value_type = Vertex;
+
+    ~draw_context_buffer()
+    {
+        vertices.clear();
+        std::allocator<value_type>{}.deallocate(_data, _capacity);
+    }
+
+    draw_context_buffer(draw_context_buffer const&) = delete;
+    draw_context_buffer(draw_context_buffer&&) = delete;
+    draw_context_buffer& operator=(draw_context_buffer const&) = delete;
+    draw_context_buffer& operator=(draw_context_buffer&&) = delete;
+
+    explicit draw_context_buffer(std::size_t capacity) :
+        _capacity(capacity), _data(std::allocator<value_type>{}.allocate(capacity)), vertices(_data, narrow_cast<ssize_t>(capacity))
+    {
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+private:
+    std::size_t _capacity;
+    value_type *_data;
+
+public:
+    vector_span<value_type> vertices;
+};
+
+/** A part of the window that is fully covered by opaque pixels of a widget.
+ *
+ * @see draw_context::add_occluder()
+ */
+struct draw_occluder {
+    /** The rectangle on the window that is covered.
+     */
+    aarectangle rectangle;
+
+    /** The elevation of the widget that covers the rectangle.
+     */
+    float elevation;
+};
+
+/** Vertex storage for drawing part of a widget-tree on a separate thread.
+ *
+ * @see draw_context::fork()
+ * @see draw_context::join()
+ */
+class draw_context_buffers {
+public:
+    draw_context_buffer<gfx_pipeline_box::instance> box;
+    draw_context_buffer<gfx_pipeline_image::vertex> image;
+    draw_context_buffer<gfx_pipeline_SDF::instance> sdf;
+    draw_context_buffer<gfx_pipeline_override::vertex> override_;
+
+    /** Set when a color outside of the standard dynamic range was drawn.
+     */
+    bool has_hdr_colors = false;
+
+    /** The area of the glyphs that were not drawn because they are not yet in an atlas.
+     */
+    aarectangle pending_glyphs_rectangle = {};
+
+    /** Allocate vertex storage.
+     *
+     * @param box_capacity The maximum number of instances for the box pipeline.
+     * @param image_capacity The maximum number of vertices for the image pipeline.
+     * @param sdf_capacity The maximum number of instances for the SDF pipeline.
+     * @param override_capacity The maximum number of vertices for the override pipeline.
+     */
+    draw_context_buffers(
+        std::size_t box_capacity,
+        std::size_t image_capacity,
+        std::size_t sdf_capacity,
+        std::size_t override_capacity) :
+        box(box_capacity), image(image_capacity), sdf(sdf_capacity), override_(override_capacity)
+    {
+    }
+};
+
 /** Draw context for drawing using the HikoGUI shaders.
  */
 class draw_context {
@@ -230,18 +341,188 @@ public:
      */
     utc_nanoseconds display_time_point;
 
+    /** The time of the oldest user input that is handled in this frame.
+     *
+     * Used to measure the latency between input and the frame being presented,
+     * zero when no input was handled since the previous frame.
+     */
+    utc_nanoseconds input_time_point = {};
+
+    /** Memory resource for temporaries during drawing, reclaimed at the end of the frame.
+     *
+     * May be nullptr, in which case the default memory resource should be used.
+     */
+    std::pmr::memory_resource *frame_resource = nullptr;
+
     draw_context(draw_context const& rhs) noexcept = default;
     draw_context(draw_context&& rhs) noexcept = default;
     draw_context& operator=(draw_context const& rhs) noexcept = default;
     draw_context& operator=(draw_context&& rhs) noexcept = default;
     ~draw_context() = default;
 
+    /** Create a draw context.
+     *
+     * @param device The device to draw with.
+     * @param box_instances The instances for the box pipeline, cleared.
+     * @param image_vertices The vertices for the image pipeline, cleared.
+     * @param sdf_instances The instances for the SDF pipeline, cleared.
+     * @param override_vertices The vertices for the override pipeline, cleared.
+     * @param[out] has_hdr_colors Set to true when a color outside of the standard dynamic range is drawn.
+     * @param[out] pending_glyphs_rectangle The area of the glyphs that are not yet in an atlas, cleared.
+     * @param occluders The occluders of the widgets on the window, cleared.
+     */
     draw_context(
         gfx_device& device,
-        vector_span<gfx_pipeline_box::vertex>& box_vertices,
+        vector_span<gfx_pipeline_box::instance>& box_instances,
         vector_span<gfx_pipeline_image::vertex>& image_vertices,
-        vector_span<gfx_pipeline_SDF::vertex>& sdf_vertices,
-        vector_span<gfx_pipeline_override::vertex>& override_vertices) noexcept;
+        vector_span<gfx_pipeline_SDF::instance>& sdf_instances,
+        vector_span<gfx_pipeline_override::vertex>& override_vertices,
+        bool& has_hdr_colors,
+        aarectangle& pending_glyphs_rectangle,
+        std::vector<draw_occluder>& occluders) noexcept;
+
+    /** Make a draw context to draw part of a widget-tree on a separate thread.
+     *
+     * The returned draw context shares all attributes with this draw context,
+     * but records the vertices into @a buffers. After drawing is finished
+     * the vertices must be appended into this draw context using `join()`,
+     * in the same order as the widgets would have been drawn.
+     *
+     * @param buffers The vertex storage for the new draw context, the buffers are cleared.
+     * @return A draw context that records vertices into @a buffers.
+     */
+    [[nodiscard]] draw_context fork(draw_context_buffers& buffers) const noexcept;
+
+    /** Append the vertices recorded into a forked draw context.
+     *
+     * @param buffers The vertex storage that was passed to `fork()`.
+     */
+    void join(draw_context_buffers const& buffers) const noexcept;
+
+    /** Append the vertices recorded into a forked draw context, moved to another position.
+     *
+     * The positions and clipping rectangles of the vertices are moved by @a offset.
+     *
+     * @param buffers The vertex storage that was passed to `fork()`.
+     * @param offset The offset in window coordinates to move the vertices by.
+     */
+    void join(draw_context_buffers const& buffers, translate2 const& offset) const noexcept;
+
+    /** Make vertex storage large enough to be used with `fork()`.
+     */
+    [[nodiscard]] std::unique_ptr<draw_context_buffers> make_buffers() const
+    {
+        return std::make_unique<draw_context_buffers>(
+            _box_instances->capacity(), _image_vertices->capacity(), _sdf_instances->capacity(), _override_vertices->capacity());
+    }
+
+    /** Make vertex storage for one of the slices of the work drawn with `draw_parallel()`.
+     *
+     * @param num_slices The number of draw contexts that will be forked and joined in this
+     *                   draw context. Each buffer is sized for its share of the space left in
+     *                   this draw context, with room for the work being divided unevenly.
+     */
+    [[nodiscard]] std::unique_ptr<draw_context_buffers> make_buffers(std::size_t num_slices) const
+    {
+        return std::make_unique<draw_context_buffers>(
+            slice_capacity(*_box_instances, num_slices),
+            slice_capacity(*_image_vertices, num_slices),
+            slice_capacity(*_sdf_instances, num_slices),
+            slice_capacity(*_override_vertices, num_slices));
+    }
+
+    /** Draw each item in a range in parallel.
+     *
+     * The items are divided in consecutive chunks, each being drawn on the global thread
+     * pool into its own vertex storage; the first chunk is drawn on the calling thread.
+     * Afterwards the vertices are appended in order, so that the result looks the same
+     * as when drawn sequentially. When called from a thread of the pool the items are
+     * drawn sequentially, so that the pool can not dead-lock waiting on itself.
+     *
+     * @note @a func is called from other threads, it must not throw, modify shared state or
+     *       call functions that may only be called from the main-thread.
+     * @param buffers A cache of vertex storage, reused between frames.
+     * @param range The items to draw.
+     * @param func The function `void(draw_context const&, item)` used for drawing each item.
+     */
+    template<std::ranges::random_access_range Range, typename Func>
+    void draw_parallel(std::vector<std::unique_ptr<draw_context_buffers>>& buffers, Range&& range, Func const& func) const
+    {
+        auto& pool = thread_pool::global();
+
+        auto const num_items = std::ranges::size(range);
+        auto const num_chunks = std::min(num_items, std::max(std::size_t{1}, std::size_t{std::thread::hardware_concurrency()}));
+        if (num_chunks <= 1 or pool.on_thread()) {
+            for (auto&& item : range) {
+                func(*this, item);
+            }
+            return;
+        }
+
+        // Reuse the buffers of previous frames, unless they are too small for their slice.
+        buffers.resize(std::max(buffers.size(), num_chunks));
+        for (auto i = std::size_t{0}; i != num_chunks; ++i) {
+            if (not buffers[i] or not fits(*buffers[i], num_chunks)) {
+                buffers[i] = make_buffers(num_chunks);
+            }
+        }
+
+        auto const first = std::ranges::begin(range);
+        auto const draw_chunk = [&](std::size_t i) {
+            auto const chunk_first = first + i * num_items / num_chunks;
+            auto const chunk_last = first + (i + 1) * num_items / num_chunks;
+
+            auto const sub_context = fork(*buffers[i]);
+            for (auto it = chunk_first; it != chunk_last; ++it) {
+                func(sub_context, *it);
+            }
+        };
+
+        pool.parallel_for(num_chunks, draw_chunk);
+
+        for (auto i = std::size_t{0}; i != num_chunks; ++i) {
+            join(*buffers[i]);
+        }
+    }
+
+    /** The area of the window with glyphs that could not be drawn yet.
+     *
+     * Glyphs are rasterized in the background, and images of bitmap glyphs are
+     * uploaded after the frame. Only this area needs to be redrawn once they
+     * become available, see `gfx_pipeline_SDF::device_shared::glyphs_rasterized`.
+     */
+    [[nodiscard]] aarectangle pending_glyphs_rectangle() const noexcept
+    {
+        return *_pending_glyphs_rectangle;
+    }
+
+    /** The number of instances that have been drawn for the box pipeline.
+     */
+    [[nodiscard]] std::size_t num_box_instances() const noexcept
+    {
+        return _box_instances->size();
+    }
+
+    /** The number of vertices that have been drawn for the image pipeline.
+     */
+    [[nodiscard]] std::size_t num_image_vertices() const noexcept
+    {
+        return _image_vertices->size();
+    }
+
+    /** The number of glyph instances that have been drawn for the SDF pipeline.
+     */
+    [[nodiscard]] std::size_t num_sdf_instances() const noexcept
+    {
+        return _sdf_instances->size();
+    }
+
+    /** The number of vertices that have been drawn for the override pipeline.
+     */
+    [[nodiscard]] std::size_t num_override_vertices() const noexcept
+    {
+        return _override_vertices->size();
+    }
 
     /** Check if the draw_context should be used for rendering.
      */
@@ -305,6 +586,39 @@ public:
         return draw_line(layout, line, draw_attributes{attributes...});
     }
 
+    /** Draw a line through a sequence of points.
+     *
+     * All the segments are placed in a single pass, with one occlusion test for
+     * the whole line. This should be used instead of `draw_line()` for lines with
+     * many points, like the line of a plot or a waveform.
+     *
+     * The segments are joined with the `line_join` and the ends of the line use
+     * the `begin_line_cap` and `end_line_cap` of the attributes. Bevel joins and
+     * miter joins sharper than 90 degrees are drawn as round joins.
+     *
+     * @param layout The layout to use, specifically the to_window transformation matrix and the clipping rectangle.
+     * @param points The points of the line.
+     * @param attributes The drawing attributes to use.
+     */
+    template<std::same_as<widget_layout> WidgetLayout>
+    void draw_polyline(WidgetLayout const& layout, std::span<point2 const> points, draw_attributes const& attributes) const noexcept
+    {
+        return _draw_polyline(
+            layout.clipping_rectangle_on_window(attributes.clipping_rectangle), layout.to_window3(), points, attributes);
+    }
+
+    /** Draw a line through a sequence of points.
+     *
+     * @param layout The layout to use, specifically the to_window transformation matrix and the clipping rectangle.
+     * @param points The points of the line.
+     * @param attributes The drawing attributes to use, see: `draw_attributes::draw_attributes()`.
+     */
+    template<std::same_as<widget_layout> WidgetLayout, draw_attribute... Attributes>
+    void draw_polyline(WidgetLayout const& layout, std::span<point2 const> points, Attributes const&...attributes) const noexcept
+    {
+        return draw_polyline(layout, points, draw_attributes{attributes...});
+    }
+
     /** Draw a circle.
      *
      * @param layout The layout to use, specifically the to_window transformation matrix and the clipping rectangle.
@@ -331,6 +645,36 @@ public:
         return draw_circle(layout, circle, draw_attributes{attributes...});
     }
 
+    /** Draw a filled path.
+     *
+     * The path is rasterized into a signed-distance-field the first time it is
+     * drawn, after that drawing the same path costs about the same as drawing a
+     * glyph. Use `graphic_path::toStroke()` to draw the outline of a path, like the
+     * line of a chart.
+     *
+     * @param layout The layout to use, specifically the to_window transformation matrix and the clipping rectangle.
+     * @param path The path to fill, the path must not have layers.
+     * @param attributes The drawing attributes to use, the path is filled with the color of the first corner.
+     */
+    template<std::same_as<widget_layout> WidgetLayout>
+    void draw_path(WidgetLayout const& layout, graphic_path const& path, draw_attributes const& attributes) const noexcept
+    {
+        return _draw_path(
+            layout.clipping_rectangle_on_window(attributes.clipping_rectangle), layout.to_window * path, layout.elevation, attributes);
+    }
+
+    /** Draw a filled path.
+     *
+     * @param layout The layout to use, specifically the to_window transformation matrix and the clipping rectangle.
+     * @param path The path to fill, the path must not have layers.
+     * @param attributes The drawing attributes to use, see: `draw_attributes::draw_attributes()`.
+     */
+    template<std::same_as<widget_layout> WidgetLayout, draw_attribute... Attributes>
+    void draw_path(WidgetLayout const& layout, graphic_path const& path, Attributes const&...attributes) const noexcept
+    {
+        return draw_path(layout, path, draw_attributes{attributes...});
+    }
+
     /** Draw an image
      *
      * @param layout The layout to use, specifically the to_window transformation matrix and the clipping rectangle.
@@ -485,6 +829,25 @@ public:
         return draw_text(layout, matrix3{}, text, draw_attributes{attributes...});
     }
 
+    /** Draw shaped text, retaining the glyph instances for the next frame.
+     *
+     * When @a text was not modified or laid out again since it was drawn with
+     * @a cache, the retained glyph instances are drawn instead.
+     *
+     * @param layout The layout to use, specifically the to_window transformation matrix and the clipping rectangle.
+     * @param text The shaped text to draw.
+     * @param cache The retained glyph instances of @a text.
+     * @param attributes The drawing attributes to use, see: `draw_attributes::draw_attributes()`.
+     */
+    template<std::same_as<widget_layout> WidgetLayout, draw_attribute... Attributes>
+    void draw_text(WidgetLayout const& layout, text_shaper const& text, draw_text_cache& cache, Attributes const&...attributes)
+        const noexcept
+    {
+        auto const attributes_ = draw_attributes{attributes...};
+        return _draw_text(
+            layout.clipping_rectangle_on_window(attributes_.clipping_rectangle), layout.to_window3(), text, cache, attributes_);
+    }
+
     /** Draw text-selection of shaped text.
      *
      * @param layout The layout to use, specifically the to_window transformation matrix and the clipping rectangle.
@@ -603,6 +966,34 @@ public:
         return draw_hole(layout, make_quad(box), draw_attributes{attributes...});
     }
 
+    /** Declare a rectangle of a widget that is fully covered by opaque pixels.
+     *
+     * Widgets are drawn back-to-front, therefor the occluders of all widgets are
+     * added before drawing starts, see `widget_intf::add_occluders()`. Boxes, images
+     * and glyphs of widgets at a lower elevation that are completely hidden behind
+     * an occluder are not drawn.
+     *
+     * @param layout The layout to use, specifically the to_window transformation matrix and the clipping rectangle.
+     * @param rectangle The rectangle that is covered, in the widget's local coordinate system.
+     */
+    template<std::same_as<widget_layout> WidgetLayout>
+    void add_occluder(WidgetLayout const& layout, aarectangle const& rectangle) const noexcept
+    {
+        _occluders->push_back(draw_occluder{layout.clipping_rectangle_on_window(rectangle), layout.elevation});
+    }
+
+    /** Check if a rectangle overlaps with any of the occluders.
+     *
+     * @param rectangle A rectangle in window coordinates.
+     * @return True if drawing inside @a rectangle may be partially culled.
+     */
+    [[nodiscard]] bool overlaps_occluder(aarectangle const& rectangle) const noexcept
+    {
+        return std::ranges::any_of(*_occluders, [&rectangle](auto const& occluder) {
+            return overlaps(occluder.rectangle, rectangle);
+        });
+    }
+
     /** Checks if a widget's layout overlaps with the part of the window that is being drawn.
      *
      * @param context The draw context which contains the scissor rectangle.
@@ -617,10 +1008,63 @@ public:
     }
 
 private:
-    vector_span<gfx_pipeline_box::vertex> *_box_vertices;
+    /** The capacity of a forked buffer for a slice of the space left in @a vertices.
+     *
+     * Each slice gets twice its even share, since the items of a slice will not draw
+     * exactly the same number of vertices; it is never more than the space left, which
+     * is all that can be joined back.
+     */
+    template<typename T>
+    [[nodiscard]] static std::size_t slice_capacity(vector_span<T> const& vertices, std::size_t num_slices) noexcept
+    {
+        hi_axiom(num_slices != 0);
+        auto const available = vertices.capacity() - vertices.size();
+        return std::min(available, (available * 2 + num_slices - 1) / num_slices);
+    }
+
+    /** Check if the buffers are large enough for a slice.
+     */
+    [[nodiscard]] bool fits(draw_context_buffers const& buffers, std::size_t num_slices) const noexcept
+    {
+        return buffers.box.capacity() >= slice_capacity(*_box_instances, num_slices) and
+            buffers.image.capacity() >= slice_capacity(*_image_vertices, num_slices) and
+            buffers.sdf.capacity() >= slice_capacity(*_sdf_instances, num_slices) and
+            buffers.override_.capacity() >= slice_capacity(*_override_vertices, num_slices);
+    }
+
+    vector_span<gfx_pipeline_box::instance> *_box_instances;
     vector_span<gfx_pipeline_image::vertex> *_image_vertices;
-    vector_span<gfx_pipeline_SDF::vertex> *_sdf_vertices;
+    vector_span<gfx_pipeline_SDF::instance> *_sdf_instances;
     vector_span<gfx_pipeline_override::vertex> *_override_vertices;
+    bool *_has_hdr_colors;
+    aarectangle *_pending_glyphs_rectangle;
+    std::vector<draw_occluder> *_occluders;
+
+    /** Check if a shape is completely hidden behind an occluder at a higher elevation.
+     *
+     * @param clipping_rectangle The clipping rectangle of the shape in window coordinates.
+     * @param box The bounding box of the shape in window coordinates, including the elevation.
+     */
+    [[nodiscard]] bool is_occluded(aarectangle const& clipping_rectangle, quad const& box) const noexcept;
+
+    /** Record if colors outside of the standard dynamic range are drawn.
+     *
+     * When only standard dynamic range colors are drawn the surface may render
+     * directly into the swapchain without the tone-mapper.
+     */
+    void record_colors(quad_color const& colors) const noexcept
+    {
+        if (not colors.is_sdr()) {
+            *_has_hdr_colors = true;
+        }
+    }
+
+    /** Record the area of a glyph that could not be drawn, because it is not yet in an atlas.
+     */
+    void record_pending_glyph(aarectangle const& clipping_rectangle, quad const& box) const noexcept
+    {
+        *_pending_glyphs_rectangle |= intersect(clipping_rectangle, bounding_rectangle(box));
+    }
 
     template<draw_quad_shape Shape>
     [[nodiscard]] constexpr static quad make_quad(Shape const& shape) noexcept
@@ -685,16 +1129,59 @@ private:
         return corner_radii{f32x4{circle}.wwww()};
     }
 
+    /** Map a rectangle onto the quad on which a reference rectangle is drawn.
+     *
+     * This is used to find the quads of the layers of a color glyph inside the quad of the glyph.
+     *
+     * @param box The quad on which @a reference is drawn.
+     * @param reference The reference rectangle.
+     * @param rectangle A rectangle in the same coordinate system as @a reference.
+     * @return The quad on which @a rectangle is drawn.
+     */
+    [[nodiscard]] constexpr static quad map_onto_quad(quad const& box, aarectangle const& reference, aarectangle const& rectangle) noexcept
+    {
+        if (reference.width() == 0.0f or reference.height() == 0.0f) {
+            return box;
+        }
+
+        auto const map = [&](point2 const& p) {
+            auto const u = (p.x() - reference.left()) / reference.width();
+            auto const v = (p.y() - reference.bottom()) / reference.height();
+            auto const bottom = box.p0 + (box.p1 - box.p0) * u;
+            auto const top = box.p2 + (box.p3 - box.p2) * u;
+            return bottom + (top - bottom) * v;
+        };
+        return quad{map(get<0>(rectangle)), map(get<1>(rectangle)), map(get<2>(rectangle)), map(get<3>(rectangle))};
+    }
+
     void _draw_override(aarectangle const& clipping_rectangle, quad box, draw_attributes const& attributes) const noexcept;
 
     void _draw_box(aarectangle const& clipping_rectangle, quad box, draw_attributes const& attributes) const noexcept;
 
+    /** Place the glyphs of shaped text.
+     *
+     * @return True if every glyph was placed in the SDF pipeline, false if glyphs
+     *         were culled, did not fit or were drawn as images.
+     */
+    [[nodiscard]] bool _place_text(
+        aarectangle const& clipping_rectangle,
+        matrix3 const& transform,
+        text_shaper const& text,
+        draw_attributes const& attributes) const noexcept;
+
     void _draw_text(
         aarectangle const& clipping_rectangle,
         matrix3 const& transform,
         text_shaper const& text,
         draw_attributes const& attributes) const noexcept;
 
+    void _draw_text(
+        aarectangle const& clipping_rectangle,
+        matrix3 const& transform,
+        text_shaper const& text,
+        draw_text_cache& cache,
+        draw_attributes const& attributes) const noexcept;
+
     void _draw_text_selection(
         aarectangle const& clipping_rectangle,
         matrix3 const& transform,
@@ -731,6 +1218,15 @@ private:
         bool dead_character_mode,
         draw_attributes const& attributes) const noexcept;
 
+    void _draw_polyline(
+        aarectangle const& clipping_rectangle,
+        translate3 const& transform,
+        std::span<point2 const> points,
+        draw_attributes const& attributes) const noexcept;
+
+    void _draw_path(aarectangle const& clipping_rectangle, graphic_path const& path, float z, draw_attributes const& attributes)
+        const noexcept;
+
     void _draw_glyph(
         aarectangle const& clipping_rectangle,
         quad const& box,
@@ -738,6 +1234,20 @@ private:
         glyph_id glyph,
         draw_attributes const& attributes) const noexcept;
 
+    /** Place the vertices of a glyph.
+     *
+     * A color glyph is placed as a glyph for each of its layers, and a bitmap
+     * glyph is placed as an image.
+     *
+     * @return True if the SDF atlas was updated.
+     */
+    [[nodiscard]] bool _place_glyph(
+        aarectangle const& clipping_rectangle,
+        quad const& box,
+        hi::font_id font,
+        glyph_id glyph,
+        quad_color const& color) const noexcept;
+
     [[nodiscard]] bool
     _draw_image(aarectangle const& clipping_rectangle, quad const& box, gfx_pipeline_image::paged_image const& image) const noexcept;
 };
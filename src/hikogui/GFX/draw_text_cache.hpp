@@ -0,0 +1,70 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "gfx_pipeline_SDF_vulkan_intf.hpp"
+#include "../geometry/geometry.hpp"
+#include "../color/color.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.GFX : draw_text_cache);
+
+hi_export namespace hi { inline namespace v1 {
+class gfx_device;
+
+/** Retained glyph instances of shaped text.
+ *
+ * When the text_shaper has not been modified or laid out again since the
+ * previous frame, the glyph instances that were placed during the previous
+ * frame are appended to the draw context, instead of looking up each glyph
+ * in the atlas again. When the text was moved by a whole number of pixels,
+ * for example by scrolling, the retained instances are moved.
+ *
+ * The cache is owned by the widget that owns the text_shaper, and is passed to
+ * `draw_context::draw_text()`. It is invalidated automatically when the text
+ * is modified, see `text_shaper::generation()`, or when glyphs are evicted from
+ * the glyph atlas.
+ */
+class draw_text_cache {
+public:
+    constexpr draw_text_cache() noexcept = default;
+    draw_text_cache(draw_text_cache const&) = delete;
+    draw_text_cache(draw_text_cache&&) noexcept = default;
+    draw_text_cache& operator=(draw_text_cache const&) = delete;
+    draw_text_cache& operator=(draw_text_cache&&) noexcept = default;
+
+    /** Forget the retained glyph instances.
+     */
+    void invalidate() noexcept
+    {
+        _valid = false;
+    }
+
+private:
+    /** The retained instances, as placed when the text was drawn.
+     */
+    std::vector<gfx_pipeline_SDF::instance> _instances = {};
+
+    /** The atlas pages used by the retained instances, touched on replay.
+     */
+    std::vector<uint32_t> _atlas_pages = {};
+
+    gfx_device *_device = nullptr;
+    std::size_t _atlas_generation = 0;
+    std::size_t _text_generation = 0;
+    matrix3 _transform = {};
+    aarectangle _clipping_rectangle = {};
+    quad_color _fill_color = {};
+    unsigned char _num_colors = 0;
+    bool _has_hdr_colors = false;
+    bool _valid = false;
+
+    friend class draw_context;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,276 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <atomic>
+#include <algorithm>
+
+hi_export_module(hikogui.GFX : gfx_atlas_allocator);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A shelf-allocator for rectangles in a set of texture atlas pages.
+ *
+ * Each page is divided in horizontal shelves, a shelf has a height which
+ * is a multiple of `shelf_granularity`. Rectangles are placed left to right
+ * on a shelf with a matching height.
+ *
+ * When all pages are full the least recently used page is evicted as a whole,
+ * the keys of all the rectangles on that page are passed to the eviction
+ * callback. Evicting complete pages means that there is never a need to
+ * defragment a page.
+ *
+ * @tparam Key The type of the key that identifies a rectangle, passed to the eviction callback.
+ */
+template<typename Key>
+class gfx_atlas_allocator {
+public:
+    using key_type = Key;
+
+    /** The height of shelves are rounded up to a multiple of this granularity.
+     */
+    constexpr static uint32_t shelf_granularity = 8;
+
+    struct allocation_type {
+        /** Index of the page, or `std::numeric_limits<size_t>::max()` when allocation failed.
+         */
+        std::size_t page = std::numeric_limits<std::size_t>::max();
+        uint32_t x = 0;
+        uint32_t y = 0;
+
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return page != std::numeric_limits<std::size_t>::max();
+        }
+    };
+
+    constexpr gfx_atlas_allocator() noexcept = default;
+
+    /** Create an allocator.
+     *
+     * @param page_width The width of a page in pixels.
+     * @param page_height The height of a page in pixels.
+     * @param max_num_pages The maximum number of pages that will be created.
+     */
+    constexpr gfx_atlas_allocator(uint32_t page_width, uint32_t page_height, std::size_t max_num_pages) noexcept :
+        _page_width(page_width), _page_height(page_height), _max_num_pages(max_num_pages), _budget(max_num_pages)
+    {
+        hi_axiom(max_num_pages > 0);
+    }
+
+    [[nodiscard]] constexpr uint32_t page_width() const noexcept
+    {
+        return _page_width;
+    }
+
+    [[nodiscard]] constexpr uint32_t page_height() const noexcept
+    {
+        return _page_height;
+    }
+
+    /** The number of pages that are added, before the least recently used page is evicted.
+     */
+    [[nodiscard]] constexpr std::size_t budget() const noexcept
+    {
+        return _budget;
+    }
+
+    /** Set the number of pages that are added, before the least recently used page is evicted.
+     *
+     * Pages that already exist are kept, a lower budget only stops the atlas from growing.
+     *
+     * @param num_pages The number of pages, clamped between 1 and the maximum number of pages.
+     */
+    constexpr void set_budget(std::size_t num_pages) noexcept
+    {
+        _budget = std::clamp(num_pages, std::size_t{1}, _max_num_pages);
+    }
+
+    /** The number of pages that are currently in use.
+     *
+     * The number of pages only grows, when it grows after `allocate()` the
+     * caller should create the textures for the new page.
+     */
+    [[nodiscard]] constexpr std::size_t num_pages() const noexcept
+    {
+        return _pages.size();
+    }
+
+    /** The keys of the rectangles that are allocated on a page.
+     */
+    [[nodiscard]] constexpr std::vector<key_type> const& keys(std::size_t page) const noexcept
+    {
+        hi_axiom_bounds(page, _pages);
+        return _pages[page].keys;
+    }
+
+    /** The current frame-number.
+     */
+    [[nodiscard]] constexpr std::size_t frame() const noexcept
+    {
+        return _frame;
+    }
+
+    /** Start a new frame.
+     *
+     * Pages that are used in the current frame are never evicted.
+     */
+    constexpr void next_frame() noexcept
+    {
+        ++_frame;
+    }
+
+    /** Mark a page as being used in the current frame.
+     *
+     * @note It is safe to call this function from multiple threads at the same time.
+     */
+    void touch(std::size_t page) noexcept
+    {
+        hi_axiom_bounds(page, _pages);
+        std::atomic_ref(_pages[page].last_used).store(_frame, std::memory_order::relaxed);
+    }
+
+    /** Allocate a rectangle.
+     *
+     * The newly allocated rectangle is marked as used in the current frame.
+     *
+     * @param width The width of the rectangle in pixels.
+     * @param height The height of the rectangle in pixels.
+     * @param key The key that identifies the rectangle.
+     * @param on_evict A function `void(key_type const&)` called for each
+     *                 rectangle that is evicted to make room for this one.
+     * @return The allocated rectangle, or an empty allocation when it does not fit.
+     */
+    template<typename OnEvict>
+    [[nodiscard]] allocation_type allocate(uint32_t width, uint32_t height, key_type const& key, OnEvict const& on_evict)
+    {
+        auto const shelf_height = ceil(std::max(height, uint32_t{1}), shelf_granularity);
+        if (width > _page_width or shelf_height > _page_height) {
+            return {};
+        }
+
+        // Append to an existing shelf with the same height.
+        for (auto page_nr = std::size_t{0}; page_nr != _pages.size(); ++page_nr) {
+            auto& page = _pages[page_nr];
+            for (auto& shelf : page.shelves) {
+                if (shelf.height == shelf_height and shelf.x + width <= _page_width) {
+                    return place(page_nr, shelf, width, key);
+                }
+            }
+        }
+
+        // Add a new shelf on an existing page.
+        for (auto page_nr = std::size_t{0}; page_nr != _pages.size(); ++page_nr) {
+            auto& page = _pages[page_nr];
+            if (page.next_shelf_y + shelf_height <= _page_height) {
+                return place(page_nr, add_shelf(page, shelf_height), width, key);
+            }
+        }
+
+        // Add a new page.
+        if (_pages.size() < _budget) {
+            auto& page = _pages.emplace_back();
+            return place(_pages.size() - 1, add_shelf(page, shelf_height), width, key);
+        }
+
+        // Evict the least recently used page that is not used in this frame.
+        auto lru_page_nr = std::numeric_limits<std::size_t>::max();
+        auto lru_frame = _frame;
+        for (auto page_nr = std::size_t{0}; page_nr != _pages.size(); ++page_nr) {
+            if (_pages[page_nr].last_used < lru_frame) {
+                lru_frame = _pages[page_nr].last_used;
+                lru_page_nr = page_nr;
+            }
+        }
+
+        if (lru_page_nr == std::numeric_limits<std::size_t>::max()) {
+            // All pages are in use by the current frame.
+            return {};
+        }
+
+        auto& page = _pages[lru_page_nr];
+        for (auto const& evicted_key : page.keys) {
+            on_evict(evicted_key);
+        }
+        page.keys.clear();
+        page.shelves.clear();
+        page.next_shelf_y = 0;
+        ++_num_evictions;
+
+        return place(lru_page_nr, add_shelf(page, shelf_height), width, key);
+    }
+
+    /** The number of pages that have been evicted since the creation of the allocator.
+     */
+    [[nodiscard]] constexpr std::size_t num_evictions() const noexcept
+    {
+        return _num_evictions;
+    }
+
+    /** The fraction of the maximum area of the atlas that is allocated.
+     *
+     * The area is measured along the shelves, so the unused space at
+     * the top of each shelf is counted as allocated.
+     */
+    [[nodiscard]] constexpr float occupancy() const noexcept
+    {
+        auto area = uint64_t{0};
+        for (auto const& page : _pages) {
+            for (auto const& shelf : page.shelves) {
+                area += uint64_t{shelf.x} * shelf.height;
+            }
+        }
+        return static_cast<float>(area) /
+            (static_cast<float>(_page_width) * static_cast<float>(_page_height) * static_cast<float>(_max_num_pages));
+    }
+
+private:
+    struct shelf_type {
+        uint32_t y;
+        uint32_t height;
+        uint32_t x;
+    };
+
+    struct page_type {
+        std::vector<shelf_type> shelves = {};
+        std::vector<key_type> keys = {};
+        uint32_t next_shelf_y = 0;
+        std::size_t last_used = 0;
+    };
+
+    uint32_t _page_width = 0;
+    uint32_t _page_height = 0;
+    std::size_t _max_num_pages = 1;
+    std::size_t _budget = 1;
+    std::size_t _frame = 1;
+    std::size_t _num_evictions = 0;
+    std::vector<page_type> _pages = {};
+
+    [[nodiscard]] static shelf_type& add_shelf(page_type& page, uint32_t shelf_height) noexcept
+    {
+        page.shelves.push_back(shelf_type{page.next_shelf_y, shelf_height, uint32_t{0}});
+        page.next_shelf_y += shelf_height;
+        return page.shelves.back();
+    }
+
+    [[nodiscard]] allocation_type place(std::size_t page_nr, shelf_type& shelf, uint32_t width, key_type const& key)
+    {
+        auto& page = _pages[page_nr];
+        page.keys.push_back(key);
+        page.last_used = _frame;
+
+        auto const r = allocation_type{page_nr, shelf.x, shelf.y};
+        shelf.x += width;
+        return r;
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,155 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gfx_atlas_allocator.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+
+TEST_SUITE(gfx_atlas_allocator_suite) {
+
+TEST_CASE(shelf_test)
+{
+    auto allocator = hi::gfx_atlas_allocator<int>(64, 64, 1);
+    auto num_evicted = 0;
+    auto const no_evict = [&](int) {
+        ++num_evicted;
+    };
+
+    auto const a = allocator.allocate(30, 10, 1, no_evict);
+    REQUIRE(static_cast<bool>(a));
+    REQUIRE(a.page == 0);
+    REQUIRE(a.x == 0);
+    REQUIRE(a.y == 0);
+
+    // Same height after rounding to the shelf granularity, placed on the same shelf.
+    auto const b = allocator.allocate(30, 16, 2, no_evict);
+    REQUIRE(b.page == 0);
+    REQUIRE(b.x == 30);
+    REQUIRE(b.y == 0);
+
+    // Does not fit horizontally on the first shelf.
+    auto const c = allocator.allocate(30, 10, 3, no_evict);
+    REQUIRE(c.page == 0);
+    REQUIRE(c.x == 0);
+    REQUIRE(c.y == 16);
+
+    // A different height gets its own shelf.
+    auto const d = allocator.allocate(10, 30, 4, no_evict);
+    REQUIRE(d.page == 0);
+    REQUIRE(d.x == 0);
+    REQUIRE(d.y == 32);
+
+    REQUIRE(allocator.num_pages() == 1);
+    REQUIRE(num_evicted == 0);
+}
+
+TEST_CASE(too_large_test)
+{
+    auto allocator = hi::gfx_atlas_allocator<int>(64, 64, 1);
+    auto num_evicted = 0;
+    auto const no_evict = [&](int) {
+        ++num_evicted;
+    };
+
+    REQUIRE(not allocator.allocate(65, 10, 1, no_evict));
+    REQUIRE(not allocator.allocate(10, 65, 2, no_evict));
+    REQUIRE(allocator.num_pages() == 0);
+    REQUIRE(num_evicted == 0);
+}
+
+TEST_CASE(grow_test)
+{
+    auto allocator = hi::gfx_atlas_allocator<int>(64, 64, 2);
+    auto num_evicted = 0;
+    auto const no_evict = [&](int) {
+        ++num_evicted;
+    };
+
+    REQUIRE(allocator.allocate(64, 64, 1, no_evict).page == 0);
+    REQUIRE(allocator.allocate(64, 64, 2, no_evict).page == 1);
+    REQUIRE(allocator.num_pages() == 2);
+
+    // All pages are used in the current frame.
+    REQUIRE(not allocator.allocate(64, 64, 3, no_evict));
+    REQUIRE(allocator.num_evictions() == 0);
+    REQUIRE(num_evicted == 0);
+}
+
+TEST_CASE(evict_test)
+{
+    auto allocator = hi::gfx_atlas_allocator<int>(64, 64, 2);
+    auto evicted = std::vector<int>{};
+    auto const on_evict = [&](int key) {
+        evicted.push_back(key);
+    };
+
+    REQUIRE(allocator.allocate(32, 64, 1, on_evict).page == 0);
+    REQUIRE(allocator.allocate(32, 64, 2, on_evict).page == 0);
+    REQUIRE(allocator.allocate(64, 64, 3, on_evict).page == 1);
+
+    allocator.next_frame();
+    allocator.touch(0);
+    allocator.next_frame();
+    allocator.touch(1);
+
+    // Page 0 was least recently used.
+    auto const a = allocator.allocate(64, 64, 4, on_evict);
+    REQUIRE(a.page == 0);
+    REQUIRE(a.x == 0);
+    REQUIRE(a.y == 0);
+    REQUIRE(evicted == (std::vector<int>{1, 2}));
+    REQUIRE(allocator.num_evictions() == 1);
+    REQUIRE(allocator.num_pages() == 2);
+}
+
+TEST_CASE(budget_test)
+{
+    auto allocator = hi::gfx_atlas_allocator<int>(64, 64, 4);
+    auto evicted = std::vector<int>{};
+    auto const on_evict = [&](int key) {
+        evicted.push_back(key);
+    };
+
+    REQUIRE(allocator.allocate(64, 64, 1, on_evict).page == 0);
+    REQUIRE(allocator.allocate(64, 64, 2, on_evict).page == 1);
+
+    // Existing pages are kept, but the atlas no longer grows.
+    allocator.set_budget(1);
+    REQUIRE(allocator.budget() == 1);
+    allocator.next_frame();
+    allocator.touch(1);
+    REQUIRE(allocator.allocate(64, 64, 3, on_evict).page == 0);
+    REQUIRE(allocator.num_pages() == 2);
+    REQUIRE(evicted == std::vector<int>{1});
+
+    allocator.set_budget(10);
+    REQUIRE(allocator.budget() == 4);
+    REQUIRE(allocator.allocate(64, 64, 4, on_evict).page == 2);
+}
+
+TEST_CASE(occupancy_test)
+{
+    auto allocator = hi::gfx_atlas_allocator<int>(64, 64, 2);
+    auto const no_evict = [](int) {};
+
+    REQUIRE(allocator.occupancy() == 0.0f);
+    REQUIRE(allocator.allocate(32, 64, 1, no_evict).page == 0);
+    REQUIRE(allocator.occupancy() == 0.25f);
+    REQUIRE(allocator.allocate(64, 64, 2, no_evict).page == 1);
+    REQUIRE(allocator.occupancy() == 0.75f);
+}
+
+TEST_CASE(keys_test)
+{
+    auto allocator = hi::gfx_atlas_allocator<int>(64, 64, 2);
+    auto const no_evict = [](int) {};
+
+    REQUIRE(allocator.allocate(32, 64, 1, no_evict).page == 0);
+    REQUIRE(allocator.allocate(32, 64, 2, no_evict).page == 0);
+    REQUIRE(allocator.allocate(64, 64, 3, no_evict).page == 1);
+    REQUIRE(allocator.keys(0) == (std::vector<int>{1, 2}));
+    REQUIRE(allocator.keys(1) == std::vector<int>{3});
+}
+
+};
@@ -8,17 +8,27 @@
 #include "gfx_system_vulkan_intf.hpp"
 #include "gfx_surface_vulkan_intf.hpp"
 #include "../file/file.hpp"
+#include "../path/path.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <vulkan/vulkan.hpp>
+#include <array>
 #include <span>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <filesystem>
+#include <expected>
+#include <system_error>
+#include <algorithm>
+#include <type_traits>
 
 hi_export_module(hikogui.GFX : gfx_device_impl);
 
 hi_export namespace hi::inline v1 {
 
-inline gfx_device::gfx_device(vk::PhysicalDevice physicalDevice) :
-    physicalIntrinsic(std::move(physicalDevice))
+inline gfx_device::gfx_device(vk::PhysicalDevice physicalDevice, std::size_t index) :
+    index(index), physicalIntrinsic(std::move(physicalDevice))
 {
     auto result = physicalIntrinsic.getProperties2KHR<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceIDProperties>(
         vulkan_loader());
@@ -37,13 +47,17 @@ inline gfx_device::gfx_device(vk::PhysicalDevice physicalDevice) :
     vendorID = resultDeviceProperties2.properties.vendorID;
     deviceName = std::string(resultDeviceProperties2.properties.deviceName.data());
     deviceUUID = uuid::from_big_endian(resultDeviceIDProperties.deviceUUID);
+    if (resultDeviceIDProperties.deviceLUIDValid) {
+        static_assert(sizeof(deviceLUID) == VK_LUID_SIZE);
+        std::memcpy(&deviceLUID, resultDeviceIDProperties.deviceLUID.data(), sizeof(deviceLUID));
+    }
 
     physicalProperties = physicalIntrinsic.getProperties();
 
     initialize_device();
 }
 
-inline int gfx_device::score(vk::SurfaceKHR surface) const
+inline int gfx_device::score(vk::SurfaceKHR surface, hi::policy performance_policy, uint64_t display_luid) const
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
@@ -70,7 +84,8 @@ inline int gfx_device::score(vk::SurfaceKHR surface) const
     bool device_has_compute = false;
     bool device_shares_graphics_and_present = false;
     for (auto const& queue : _queues) {
-        auto const has_present = to_bool(physicalIntrinsic.getSurfaceSupportKHR(queue.family_queue_index, surface));
+        // An offscreen surface does not present, any graphics queue will do.
+        auto const has_present = not surface or to_bool(physicalIntrinsic.getSurfaceSupportKHR(queue.family_queue_index, surface));
         auto const has_graphics = to_bool(queue.flags & vk::QueueFlagBits::eGraphics);
         auto const has_compute = to_bool(queue.flags & vk::QueueFlagBits::eCompute);
 
@@ -102,23 +117,26 @@ inline int gfx_device::score(vk::SurfaceKHR surface) const
         total_score += 10;
     }
 
-    hi_log_info(" - Surface formats:");
-    int surface_format_score = 0;
-    [[maybe_unused]] auto surface_format = get_surface_format(surface, &surface_format_score);
-    if (surface_format_score <= 0) {
-        hi_log_info(" - Does not have a suitable surface format.");
-        return -1;
-    }
-    total_score += surface_format_score;
-
-    hi_log_info(" - Present modes:");
-    int present_mode_score = 0;
-    [[maybe_unused]] auto present_mode = get_present_mode(surface, &present_mode_score);
-    if (present_mode_score <= 0) {
-        hi_log_info(" - Does not have a suitable present mode.");
-        return -1;
+    // The images of an offscreen surface are not bound to the formats and present modes of a window.
+    if (surface) {
+        hi_log_info(" - Surface formats:");
+        int surface_format_score = 0;
+        [[maybe_unused]] auto surface_format = get_surface_format(surface, &surface_format_score);
+        if (surface_format_score <= 0) {
+            hi_log_info(" - Does not have a suitable surface format.");
+            return -1;
+        }
+        total_score += surface_format_score;
+
+        hi_log_info(" - Present modes:");
+        int present_mode_score = 0;
+        [[maybe_unused]] auto present_mode = get_present_mode(surface, &present_mode_score);
+        if (present_mode_score <= 0) {
+            hi_log_info(" - Does not have a suitable present mode.");
+            return -1;
+        }
+        total_score += present_mode_score;
     }
-    total_score += present_mode_score;
 
     // Give score based on the performance of the device.
     auto device_type_score = 0;
@@ -143,6 +161,22 @@ inline int gfx_device::score(vk::SurfaceKHR surface) const
     hi_log_info(" - device-type={}, score={}", vk::to_string(properties.deviceType), device_type_score);
     total_score += device_type_score;
 
+    // Rendering on the device that drives the monitor avoids copying each frame between devices.
+    if (display_luid != 0 and display_luid == deviceLUID) {
+        hi_log_info(" - Device drives the monitor of the window.");
+        total_score += 20;
+    }
+
+    // An explicit GPU policy outweighs all other scores.
+    if (performance_policy == policy::low_power and properties.deviceType == vk::PhysicalDeviceType::eIntegratedGpu) {
+        hi_log_info(" - Device is preferred for low power.");
+        total_score += 100;
+    } else if (
+        performance_policy == policy::high_performance and properties.deviceType == vk::PhysicalDeviceType::eDiscreteGpu) {
+        hi_log_info(" - Device is preferred for performance.");
+        total_score += 100;
+    }
+
     hi_log_info(" - total score {}", total_score);
     return total_score;
 }
@@ -153,15 +187,99 @@ inline void gfx_device::initialize_device()
 
     auto const available_device_features = physicalIntrinsic.getFeatures();
 
+    // Timeline semaphores are core in Vulkan 1.2, they are used for asynchronous uploads.
+    // Update-after-bind descriptors are used to grow the atlases while their descriptor sets are in use.
+    if (physicalProperties.apiVersion >= VK_API_VERSION_1_2) {
+        auto const available_features = physicalIntrinsic.getFeatures2<
+            vk::PhysicalDeviceFeatures2,
+            vk::PhysicalDeviceTimelineSemaphoreFeatures,
+            vk::PhysicalDeviceDescriptorIndexingFeatures>();
+        supportsTimelineSemaphore =
+            available_features.get<vk::PhysicalDeviceTimelineSemaphoreFeatures>().timelineSemaphore == VK_TRUE;
+
+        auto const& indexing_features = available_features.get<vk::PhysicalDeviceDescriptorIndexingFeatures>();
+        auto const available_properties =
+            physicalIntrinsic.getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceDescriptorIndexingProperties>();
+        auto const& indexing_properties = available_properties.get<vk::PhysicalDeviceDescriptorIndexingProperties>();
+
+        maxNrBindlessImages = std::min(
+            {indexing_properties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+             indexing_properties.maxDescriptorSetUpdateAfterBindSampledImages,
+             uint32_t{4096}});
+        supportsBindlessImages = indexing_features.descriptorBindingPartiallyBound == VK_TRUE and
+            indexing_features.descriptorBindingSampledImageUpdateAfterBind == VK_TRUE and
+            indexing_features.descriptorBindingUpdateUnusedWhilePending == VK_TRUE and maxNrBindlessImages >= 128;
+    }
+
+    // Present-wait is used to start the next frame when the previous frame was displayed, for low-latency presentation.
+    auto const present_wait_extensions =
+        std::vector<char const *>{VK_KHR_PRESENT_ID_EXTENSION_NAME, VK_KHR_PRESENT_WAIT_EXTENSION_NAME};
+    if (physicalProperties.apiVersion >= VK_API_VERSION_1_1 and hasRequiredExtensions(physicalIntrinsic, present_wait_extensions)) {
+        auto const available_features = physicalIntrinsic.getFeatures2<
+            vk::PhysicalDeviceFeatures2,
+            vk::PhysicalDevicePresentIdFeaturesKHR,
+            vk::PhysicalDevicePresentWaitFeaturesKHR>();
+        supportsPresentWait = available_features.get<vk::PhysicalDevicePresentIdFeaturesKHR>().presentId == VK_TRUE and
+            available_features.get<vk::PhysicalDevicePresentWaitFeaturesKHR>().presentWait == VK_TRUE;
+    }
+    if (not supportsPresentWait) {
+        hi_log_info("Present-wait is not supported, low-latency presentation only uses the present mode.");
+    }
+
+    // The memory usage and budget of each heap is used to release cached resources before the device runs out of memory.
+    auto const memory_budget_extensions = std::vector<char const *>{VK_EXT_MEMORY_BUDGET_EXTENSION_NAME};
+    supportsMemoryBudget = hasRequiredExtensions(physicalIntrinsic, memory_budget_extensions);
+    if (not supportsMemoryBudget) {
+        hi_log_info("Memory budget is not supported, the budget is estimated from the size of the memory heaps.");
+    }
+
+    // Compressed images are uploaded into the atlas with a transfer and sampled with linear filtering.
+    auto const compressed_format_features = vk::FormatFeatureFlagBits::eSampledImage |
+        vk::FormatFeatureFlagBits::eSampledImageFilterLinear | vk::FormatFeatureFlagBits::eTransferDst;
+    auto const compressed_format_properties = physicalIntrinsic.getFormatProperties(vk::Format::eBc3SrgbBlock);
+    supportsCompressedImages = available_device_features.textureCompressionBC == VK_TRUE and
+        (compressed_format_properties.optimalTilingFeatures & compressed_format_features) == compressed_format_features;
+    if (not supportsCompressedImages) {
+        hi_log_info("BC3 compressed images are not supported, images are stored uncompressed.");
+    }
+
     // Enable optional features.
     device_features = gfx_system::global().requiredFeatures;
     device_features.setDualSrcBlend(available_device_features.dualSrcBlend);
+    device_features.setTextureCompressionBC(supportsCompressedImages);
     device_features.setShaderSampledImageArrayDynamicIndexing(VK_TRUE);
     auto physical_device_features = vk::PhysicalDeviceFeatures2{device_features};
 
+    auto device_timeline_semaphore_features = vk::PhysicalDeviceTimelineSemaphoreFeatures{};
+    device_timeline_semaphore_features.setTimelineSemaphore(VK_TRUE);
+    if (supportsTimelineSemaphore) {
+        physical_device_features.setPNext(&device_timeline_semaphore_features);
+    }
+
     auto device_descriptor_indexing_features = vk::PhysicalDeviceDescriptorIndexingFeatures{};
     device_descriptor_indexing_features.setPNext(&physical_device_features);
     device_descriptor_indexing_features.setShaderSampledImageArrayNonUniformIndexing(VK_TRUE);
+    if (supportsBindlessImages) {
+        device_descriptor_indexing_features.setDescriptorBindingPartiallyBound(VK_TRUE);
+        device_descriptor_indexing_features.setDescriptorBindingSampledImageUpdateAfterBind(VK_TRUE);
+        device_descriptor_indexing_features.setDescriptorBindingUpdateUnusedWhilePending(VK_TRUE);
+    }
+
+    auto enabled_extensions = requiredExtensions;
+    auto device_present_id_features = vk::PhysicalDevicePresentIdFeaturesKHR{};
+    auto device_present_wait_features = vk::PhysicalDevicePresentWaitFeaturesKHR{};
+    void *device_features_chain = &device_descriptor_indexing_features;
+    if (supportsPresentWait) {
+        enabled_extensions.insert(enabled_extensions.end(), present_wait_extensions.begin(), present_wait_extensions.end());
+        device_present_id_features.setPresentId(VK_TRUE);
+        device_present_id_features.setPNext(device_features_chain);
+        device_present_wait_features.setPresentWait(VK_TRUE);
+        device_present_wait_features.setPNext(&device_present_id_features);
+        device_features_chain = &device_present_wait_features;
+    }
+    if (supportsMemoryBudget) {
+        enabled_extensions.insert(enabled_extensions.end(), memory_budget_extensions.begin(), memory_budget_extensions.end());
+    }
 
     auto device_create_info = vk::DeviceCreateInfo{
         vk::DeviceCreateFlags(),
@@ -169,10 +287,10 @@ inline void gfx_device::initialize_device()
         device_queue_create_infos.data(),
         0,
         nullptr,
-        narrow_cast<uint32_t>(requiredExtensions.size()),
-        requiredExtensions.data(),
+        narrow_cast<uint32_t>(enabled_extensions.size()),
+        enabled_extensions.data(),
         nullptr};
-    device_create_info.setPNext(&device_descriptor_indexing_features);
+    device_create_info.setPNext(device_features_chain);
 
     intrinsic = physicalIntrinsic.createDevice(device_create_info);
 
@@ -180,6 +298,9 @@ inline void gfx_device::initialize_device()
     allocatorCreateInfo.physicalDevice = physicalIntrinsic;
     allocatorCreateInfo.device = intrinsic;
     allocatorCreateInfo.instance = vulkan_instance();
+    if (supportsMemoryBudget) {
+        allocatorCreateInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
     vmaCreateAllocator(&allocatorCreateInfo, &allocator);
 
     VmaAllocationCreateInfo lazyAllocationInfo = {};
@@ -197,6 +318,7 @@ inline void gfx_device::initialize_device()
 
     initialize_queues(device_queue_create_infos);
     initialize_quad_index_buffer();
+    initialize_pipeline_cache();
 
     box_pipeline = std::make_unique<gfx_pipeline_box::device_shared>(*this);
     image_pipeline = std::make_unique<gfx_pipeline_image::device_shared>(*this);
@@ -205,6 +327,238 @@ inline void gfx_device::initialize_device()
     tone_mapper_pipeline = std::make_unique<gfx_pipeline_tone_mapper::device_shared>(*this);
 }
 
+inline void gfx_device::teardown_device()
+{
+    destroy_quad_index_buffer();
+    destroy_pipeline_cache();
+
+    vmaDestroyAllocator(allocator);
+
+    for (auto const& queue : _queues) {
+        intrinsic.destroy(queue.command_pool);
+    }
+    _queues.clear();
+
+    intrinsic.destroy();
+}
+
+inline void gfx_device::recover()
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+    hi_assert(lost);
+    hi_assert(num_surfaces == 0);
+
+    auto const t = trace<"gfx_device:recover">{};
+    hi_log_info("Recovering the lost vulkan device '{}'.", deviceName);
+
+    // The objects of a lost device may still be destroyed. The pipelines are destroyed
+    // while they are still owned by this device, because the glyph images of the image
+    // pipeline free their pages through this device.
+    tone_mapper_pipeline->destroy(this);
+    tone_mapper_pipeline = nullptr;
+    override_pipeline->destroy(this);
+    override_pipeline = nullptr;
+    SDF_pipeline->destroy(this);
+    image_pipeline->destroy(this);
+    box_pipeline->destroy(this);
+    box_pipeline = nullptr;
+
+    // The atlas allocators and CPU-side mirrors survive the destruction of the Vulkan objects.
+    auto const old_SDF_pipeline = std::move(SDF_pipeline);
+    auto const old_image_pipeline = std::move(image_pipeline);
+
+    teardown_device();
+    lost = false;
+
+    initialize_device();
+
+    if (SDF_pipeline->copy_atlas_from(*old_SDF_pipeline)) {
+        hi_log_info("Restored the glyph atlas of device '{}'", deviceName);
+    }
+    if (image_pipeline->copy_atlas_from(*old_image_pipeline)) {
+        hi_log_info("Restored the image atlas of device '{}'", deviceName);
+    }
+
+    ++global_counter<"gfx_device:recover">;
+}
+
+namespace detail {
+
+/** The header in front of the data of the pipeline cache file.
+ *
+ * The driver also validates the pipeline cache data it is given, but a
+ * driver update may not change the data's header, so the driver version
+ * is checked as well.
+ */
+struct gfx_pipeline_cache_header {
+    constexpr static char magic_value[8] = {'h', 'i', 'p', 'c', 'a', 'c', 'h', 'e'};
+    constexpr static uint32_t version_value = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
+    uint64_t data_size;
+};
+
+static_assert(std::is_trivially_copyable_v<gfx_pipeline_cache_header>);
+
+} // namespace detail
+
+inline std::expected<std::filesystem::path, std::error_code> gfx_device::pipeline_cache_path() const noexcept
+{
+    if (auto const dir = data_dir()) {
+        return *dir / std::format("vulkan_pipeline_cache_{}.bin", deviceUUID.uuid_string());
+    } else {
+        return std::unexpected{dir.error()};
+    }
+}
+
+inline void gfx_device::initialize_pipeline_cache()
+{
+    auto initial_data = bstring{};
+
+    if (pipeline_cache_enabled) {
+        try {
+            auto const path = pipeline_cache_path();
+            if (not path) {
+                hi_log_error("Could not find the data directory for the pipeline cache. \"{}\"", path.error().message());
+
+            } else if (auto ec = std::error_code{}; std::filesystem::exists(*path, ec)) {
+                auto const view = file_view{*path};
+                auto const bytes = as_span<std::byte const>(view);
+
+                auto header = detail::gfx_pipeline_cache_header{};
+                if (bytes.size() < sizeof(header)) {
+                    hi_log_warning("Pipeline cache {} is too small.", path->string());
+
+                } else {
+                    std::memcpy(&header, bytes.data(), sizeof(header));
+
+                    if (std::memcmp(header.magic, header.magic_value, sizeof(header.magic)) != 0 or
+                        header.version != header.version_value) {
+                        hi_log_warning("Pipeline cache {} has an unknown format.", path->string());
+
+                    } else if (
+                        header.vendor_id != physicalProperties.vendorID or header.device_id != physicalProperties.deviceID or
+                        header.driver_version != physicalProperties.driverVersion or
+                        std::memcmp(
+                            header.pipeline_cache_uuid, physicalProperties.pipelineCacheUUID.data(), VK_UUID_SIZE) != 0) {
+                        hi_log_info("Pipeline cache {} was made by a different driver.", path->string());
+
+                    } else if (header.data_size > bytes.size() - sizeof(header)) {
+                        hi_log_warning("Pipeline cache {} is truncated.", path->string());
+
+                    } else {
+                        auto const data = bytes.subspan(sizeof(header), narrow_cast<std::size_t>(header.data_size));
+                        initial_data.assign(data.begin(), data.end());
+                    }
+                }
+            }
+        } catch (io_error const& e) {
+            hi_log_warning("Could not load pipeline cache. \"{}\"", e.what());
+        }
+    }
+
+    try {
+        pipeline_cache = intrinsic.createPipelineCache(
+            {vk::PipelineCacheCreateFlags(), initial_data.size(), initial_data.data()});
+
+        if (not initial_data.empty()) {
+            hi_log_info("Loaded {} bytes of pipeline cache.", initial_data.size());
+        }
+
+    } catch (vk::SystemError const& e) {
+        // The driver may reject the cache data even after checking the header.
+        hi_log_warning("Could not create pipeline cache from file, creating an empty cache. \"{}\"", e.what());
+        pipeline_cache = intrinsic.createPipelineCache({});
+    }
+}
+
+inline void gfx_device::destroy_pipeline_cache() noexcept
+{
+    if (not pipeline_cache) {
+        return;
+    }
+
+    if (pipeline_cache_enabled) {
+        try {
+            auto const data = intrinsic.getPipelineCacheData(pipeline_cache);
+
+            if (auto const path = pipeline_cache_path()) {
+                auto header = detail::gfx_pipeline_cache_header{};
+                std::memcpy(header.magic, header.magic_value, sizeof(header.magic));
+                header.version = header.version_value;
+                header.vendor_id = physicalProperties.vendorID;
+                header.device_id = physicalProperties.deviceID;
+                header.driver_version = physicalProperties.driverVersion;
+                std::memcpy(header.pipeline_cache_uuid, physicalProperties.pipelineCacheUUID.data(), VK_UUID_SIZE);
+                header.data_size = data.size();
+
+                auto tmp_path = *path;
+                tmp_path += ".tmp";
+
+                auto file = hi::file(tmp_path, access_mode::truncate_or_create_for_write | access_mode::rename);
+                file.write(&header, sizeof(header));
+                file.write(data.data(), data.size());
+                file.flush();
+                file.rename(*path, true);
+
+                hi_log_info("Saved {} bytes of pipeline cache to {}", data.size(), path->string());
+
+            } else {
+                hi_log_error("Could not find the data directory for the pipeline cache. \"{}\"", path.error().message());
+            }
+
+        } catch (io_error const& e) {
+            hi_log_error("Could not save pipeline cache to file. \"{}\"", e.what());
+        } catch (vk::SystemError const& e) {
+            hi_log_error("Could not get the pipeline cache data. \"{}\"", e.what());
+        }
+    }
+
+    intrinsic.destroy(pipeline_cache);
+    pipeline_cache = vk::PipelineCache{};
+}
+
+inline void gfx_device::update_memory_budget() noexcept
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    // VMA fetches the budget from the driver when the frame index changes.
+    vmaSetCurrentFrameIndex(allocator, ++_memory_budget_frame);
+
+    VkPhysicalDeviceMemoryProperties const *memory_properties;
+    vmaGetMemoryProperties(allocator, &memory_properties);
+
+    auto vma_budgets = std::array<VmaBudget, VK_MAX_MEMORY_HEAPS>{};
+    vmaGetHeapBudgets(allocator, vma_budgets.data());
+
+    auto heaps = std::vector<gfx_memory_budget::heap_type>{};
+    heaps.reserve(memory_properties->memoryHeapCount);
+    for (auto i = 0_uz; i != memory_properties->memoryHeapCount; ++i) {
+        heaps.push_back({narrow_cast<std::size_t>(vma_budgets[i].usage), narrow_cast<std::size_t>(vma_budgets[i].budget)});
+    }
+
+    global_counter<"gfx_device:memory:other"> = memory_budget.usage(gfx_memory_category::other);
+    global_counter<"gfx_device:memory:glyph-atlas"> = memory_budget.usage(gfx_memory_category::glyph_atlas);
+    global_counter<"gfx_device:memory:image-atlas"> = memory_budget.usage(gfx_memory_category::image_atlas);
+    global_counter<"gfx_device:memory:vertex-ring"> = memory_budget.usage(gfx_memory_category::vertex_ring);
+    global_counter<"gfx_device:memory:swapchain"> = memory_budget.usage(gfx_memory_category::swapchain);
+
+    if (auto const excess = memory_budget.update(heaps)) {
+        if (*excess != 0) {
+            ++global_counter<"gfx_device:memory:pressure">;
+            hi_log_info("Memory of gfx device {} is running low, releasing {} bytes of cached resources.", string(), *excess);
+        } else {
+            hi_log_info("Memory of gfx device {} is no longer running low.", string());
+        }
+        _memory_pressure_notifier(*excess);
+    }
+}
+
 inline void gfx_device::setDebugUtilsObjectNameEXT(vk::DebugUtilsObjectNameInfoEXT const& name_info) const
 {
 #ifndef NDEBUG
@@ -213,6 +567,13 @@ inline void gfx_device::setDebugUtilsObjectNameEXT(vk::DebugUtilsObjectNameInfoE
 #endif
 }
 
+inline vk::Result gfx_device::waitForPresentKHR(vk::SwapchainKHR swapchain, uint64_t present_id, uint64_t timeout) const
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+    hi_axiom(supportsPresentWait);
+    return intrinsic.waitForPresentKHR(swapchain, present_id, timeout, vulkan_loader());
+}
+
 inline void gfx_device::cmdBeginDebugUtilsLabelEXT(vk::CommandBuffer buffer, vk::DebugUtilsLabelEXT const& create_info) const
 {
 #ifndef NDEBUG
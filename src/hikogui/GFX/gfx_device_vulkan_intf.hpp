@@ -6,18 +6,24 @@
 
 #include "gfx_system_globals.hpp"
 #include "gfx_queue_vulkan.hpp"
+#include "gfx_memory_budget.hpp"
 #include "gfx_pipeline_image_vulkan_intf.hpp"
 #include "gfx_pipeline_box_vulkan_intf.hpp"
 #include "gfx_pipeline_SDF_vulkan_intf.hpp"
 #include "gfx_pipeline_override_vulkan_intf.hpp"
 #include "gfx_pipeline_tone_mapper_vulkan_intf.hpp"
 #include "../settings/settings.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../telemetry/telemetry.hpp"
 #include "../macros.hpp"
 #include <vulkan/vulkan.hpp>
 #include <vma/vk_mem_alloc.h>
 #include <filesystem>
+#include <expected>
+#include <system_error>
 #include <unordered_set>
 #include <string>
+#include <utility>
 
 hi_export_module(hikogui.GFX : gfx_device_intf);
 
@@ -30,6 +36,19 @@ public:
     uint32_t deviceID = 0;
     uuid deviceUUID = {};
 
+    /** The locally unique identifier of the display adapter of this device, or zero when not available.
+     *
+     * Used to find the device that drives the monitor of a window.
+     */
+    uint64_t deviceLUID = 0;
+
+    /** The index of this device in the gfx_system.
+     *
+     * The index is used to select the per-device data that is stored in other objects,
+     * like the locations of glyphs in the atlas of each device.
+     */
+    std::size_t index = 0;
+
     vk::PhysicalDevice physicalIntrinsic;
     vk::Device intrinsic;
     VmaAllocator allocator;
@@ -62,6 +81,20 @@ public:
     std::unique_ptr<gfx_pipeline_override::device_shared> override_pipeline;
     std::unique_ptr<gfx_pipeline_tone_mapper::device_shared> tone_mapper_pipeline;
 
+    /** The pipeline cache used when building the pipelines of all surfaces.
+     *
+     * The pipeline cache is loaded from the data directory when the device is
+     * created, and saved when the device is destroyed. So that the shaders do
+     * not need to be compiled by the driver each time the application starts.
+     */
+    vk::PipelineCache pipeline_cache;
+
+    /** Enable loading and saving the pipeline cache from the data directory.
+     *
+     * @note Must be set before the first window is created.
+     */
+    static inline bool pipeline_cache_enabled = true;
+
     /*! List if extension required on this device.
      */
     std::vector<const char *> requiredExtensions;
@@ -70,6 +103,62 @@ public:
     vk::ImageUsageFlags transientImageUsageFlags = vk::ImageUsageFlags{};
     VmaMemoryUsage lazyMemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY;
 
+    /** Timeline semaphores have been turned on for this device.
+     */
+    bool supportsTimelineSemaphore = false;
+
+    /** Descriptor arrays of sampled images may be partially bound and updated after being bound.
+     *
+     * When turned on the atlases of the image and SDF pipelines grow up to
+     * `maxNrBindlessImages` images, instead of being limited by a fixed-size
+     * descriptor array.
+     */
+    bool supportsBindlessImages = false;
+
+    /** Images may be stored in the atlas as BC3 compressed blocks with the sRGB transfer function.
+     */
+    bool supportsCompressedImages = false;
+
+    /** A swapchain image can be presented with an identifier, and the CPU can wait until it is displayed.
+     *
+     * Turned on when both `VK_KHR_present_id` and `VK_KHR_present_wait` are available.
+     */
+    bool supportsPresentWait = false;
+
+    /** The driver reports the memory usage and budget of each heap.
+     *
+     * Turned on when `VK_EXT_memory_budget` is available. Without it the budget
+     * is estimated by VMA from the size of the heaps.
+     */
+    bool supportsMemoryBudget = false;
+
+    /** The maximum number of images in a bindless descriptor array.
+     *
+     * This is clamped to 4096 to limit the size of the descriptor pools of each surface.
+     */
+    uint32_t maxNrBindlessImages = 0;
+
+    /** The memory allocated by this device for each category, and the budget of each heap.
+     *
+     * Access is protected by `gfx_system_mutex`.
+     */
+    mutable gfx_memory_budget memory_budget;
+
+    /** The device was lost, for example after a driver reset or a GPU timeout.
+     *
+     * While the device is lost nothing is waited on, so that the surfaces can tear
+     * down quickly. The device is recovered by `recover()` once no surface uses it.
+     *
+     * Access is protected by `gfx_system_mutex`.
+     */
+    bool lost = false;
+
+    /** The number of surfaces that have been built for this device.
+     *
+     * Access is protected by `gfx_system_mutex`.
+     */
+    std::size_t num_surfaces = 0;
+
     ~gfx_device()
     {
         try {
@@ -86,15 +175,7 @@ public:
             box_pipeline->destroy(this);
             box_pipeline = nullptr;
 
-            destroy_quad_index_buffer();
-
-            vmaDestroyAllocator(allocator);
-
-            for (auto const& queue : _queues) {
-                intrinsic.destroy(queue.command_pool);
-            }
-
-            intrinsic.destroy();
+            teardown_device();
 
         } catch (std::exception const& e) {
             hi_log_fatal("Could not properly destruct gfx_device. '{}'", e.what());
@@ -105,7 +186,7 @@ public:
     gfx_device& operator=(const gfx_device&) = delete;
     gfx_device(gfx_device&&) = delete;
     gfx_device& operator=(gfx_device&&) = delete;
-    gfx_device(vk::PhysicalDevice physicalDevice);
+    gfx_device(vk::PhysicalDevice physicalDevice, std::size_t index);
 
     std::string string() const noexcept
     {
@@ -114,6 +195,36 @@ public:
         return std::format("{0:04x}:{1:04x} {2} {3}", vendorID, deviceID, deviceName, deviceUUID.uuid_string());
     }
 
+    /** Mark the device as lost.
+     *
+     * Called when a Vulkan function returned `VK_ERROR_DEVICE_LOST`.
+     *
+     * @pre `gfx_system_mutex` must be locked.
+     */
+    void set_lost() noexcept
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+        if (not std::exchange(lost, true)) {
+            hi_log_error("The vulkan device '{}' was lost.", deviceName);
+            ++global_counter<"gfx_device:lost">;
+        }
+    }
+
+    /** Recover a lost device.
+     *
+     * The Vulkan device and all its objects are destroyed and created again.
+     * The atlases of the SDF and image pipelines are restored from their CPU-side
+     * mirrors, so that the glyphs and images do not need to be rasterized and drawn
+     * again. The locations of the glyphs and the pages of the paged images remain
+     * valid, because this object and the allocation of the atlases are kept.
+     *
+     * @pre `gfx_system_mutex` must be locked.
+     * @pre The device is lost and is not used by any surface.
+     * @throws gui_error When the device could not be created again.
+     */
+    void recover();
+
     /** Get a graphics queue.
      * Always returns the first queue that can handle graphics.
      */
@@ -127,12 +238,32 @@ public:
         hi_no_default();
     }
 
+    /** Get a transfer queue.
+     * Returns the first queue that can only handle transfers, on most GPUs this queue
+     * is a DMA engine that copies concurrently with rendering; or as fallback the first graphics queue.
+     */
+    [[nodiscard]] gfx_queue_vulkan const& get_transfer_queue() const noexcept
+    {
+        for (auto& queue : _queues) {
+            if ((queue.flags & vk::QueueFlagBits::eTransfer) and not(queue.flags & vk::QueueFlagBits::eGraphics) and
+                not(queue.flags & vk::QueueFlagBits::eCompute)) {
+                return queue;
+            }
+        }
+        return get_graphics_queue();
+    }
+
     /** Get a graphics queue.
      * Always returns the first queue that can handle both graphics and presenting;
      * or as fallback the first graphics queue.
      */
     [[nodiscard]] gfx_queue_vulkan const& get_graphics_queue(vk::SurfaceKHR surface) const noexcept
     {
+        if (not surface) {
+            // An offscreen surface does not present.
+            return get_graphics_queue();
+        }
+
         // First try to find a graphics queue which can also present.
         gfx_queue_vulkan const *graphics_queue = nullptr;
         for (auto& queue : _queues) {
@@ -156,6 +287,11 @@ public:
      */
     [[nodiscard]] gfx_queue_vulkan const& get_present_queue(vk::SurfaceKHR surface) const noexcept
     {
+        if (not surface) {
+            // An offscreen surface does not present.
+            return get_graphics_queue();
+        }
+
         // First try to find a graphics queue which can also present.
         gfx_queue_vulkan const *present_queue = nullptr;
         for (auto& queue : _queues) {
@@ -269,12 +405,16 @@ public:
     /** Get the present mode.
      * Always returns the best suitable present mode.
      *
-     * Prioritized a double buffering mode.
+     * Prioritized a double buffering mode. For low latency the mailbox mode is
+     * prioritized; a newly presented image replaces an image that is waiting to
+     * be displayed, instead of being queued behind it.
      *
      * @param surface The surface to determine the present mode for.
      * @param[out] score Optional return parameter for the quality of the present mode.
+     * @param low_latency Prioritize the present mode with the lowest latency.
      */
-    [[nodiscard]] vk::PresentModeKHR get_present_mode(vk::SurfaceKHR surface, int *score = nullptr) const noexcept
+    [[nodiscard]] vk::PresentModeKHR
+    get_present_mode(vk::SurfaceKHR surface, int *score = nullptr, bool low_latency = false) const noexcept
     {
         auto best_present_mode = vk::PresentModeKHR{};
         auto best_present_mode_score = 0;
@@ -292,7 +432,7 @@ public:
                 present_mode_score += 3;
                 break;
             case vk::PresentModeKHR::eMailbox:
-                present_mode_score += 1;
+                present_mode_score += low_latency ? 4 : 1;
                 break; // mailbox does not wait for vsync.
             default:
                 continue;
@@ -319,9 +459,15 @@ public:
      * It is possible for a surface to be created that is not presentable, in case of a headless-virtual-display,
      * however in this case it may still be able to be displayed by any device.
      *
+     * \param surface The surface to present on, or a null surface for an offscreen surface.
+     * \param performance_policy The GPU policy, preferring an integrated or a discrete GPU.
+     * \param display_luid The LUID of the display adapter driving the monitor of the window, or zero.
      * \returns -1 When not viable, 0 when not presentable, positive values for increasing score.
      */
-    int score(vk::SurfaceKHR surface) const;
+    int score(
+        vk::SurfaceKHR surface,
+        hi::policy performance_policy = policy::unspecified,
+        uint64_t display_luid = 0) const;
 
     /*! Find the minimum number of queue families to instantiate for a window.
      * This will give priority for having the Graphics and Present in the same
@@ -332,58 +478,150 @@ public:
      */
     std::vector<std::pair<uint32_t, uint8_t>> find_best_queue_family_indices(vk::SurfaceKHR surface) const;
 
-    std::pair<vk::Buffer, VmaAllocation>
-    createBuffer(const vk::BufferCreateInfo& bufferCreateInfo, const VmaAllocationCreateInfo& allocationCreateInfo) const
+    /** Create a buffer and allocate its memory.
+     *
+     * @param bufferCreateInfo The buffer to create.
+     * @param allocationCreateInfo How to allocate the memory of the buffer.
+     * @param category The kind of resource the memory is accounted to, the same category is passed to `destroyBuffer()`.
+     */
+    std::pair<vk::Buffer, VmaAllocation> createBuffer(
+        const vk::BufferCreateInfo& bufferCreateInfo,
+        const VmaAllocationCreateInfo& allocationCreateInfo,
+        gfx_memory_category category = gfx_memory_category::other) const
     {
         hi_axiom(gfx_system_mutex.recurse_lock_count());
 
         VkBuffer buffer;
         VmaAllocation allocation;
+        VmaAllocationInfo allocationInfo;
 
         auto const bufferCreateInfo_ = static_cast<VkBufferCreateInfo>(bufferCreateInfo);
-        auto const result =
-            vk::Result{vmaCreateBuffer(allocator, &bufferCreateInfo_, &allocationCreateInfo, &buffer, &allocation, nullptr)};
+        auto const result = vk::Result{
+            vmaCreateBuffer(allocator, &bufferCreateInfo_, &allocationCreateInfo, &buffer, &allocation, &allocationInfo)};
 
         if (result != vk::Result::eSuccess) {
             throw gui_error(std::format("vmaCreateBuffer() failed {}", to_string(result)));
         }
 
+        memory_budget.allocate(category, narrow_cast<std::size_t>(allocationInfo.size));
         return {buffer, allocation};
     }
 
-    void destroyBuffer(const vk::Buffer& buffer, const VmaAllocation& allocation) const
+    void destroyBuffer(
+        const vk::Buffer& buffer,
+        const VmaAllocation& allocation,
+        gfx_memory_category category = gfx_memory_category::other) const
     {
         hi_axiom(gfx_system_mutex.recurse_lock_count());
 
+        if (allocation == VK_NULL_HANDLE) {
+            // Already destroyed.
+            return;
+        }
+
+        VmaAllocationInfo allocationInfo;
+        vmaGetAllocationInfo(allocator, allocation, &allocationInfo);
+        memory_budget.deallocate(category, narrow_cast<std::size_t>(allocationInfo.size));
+
         vmaDestroyBuffer(allocator, buffer, allocation);
     }
 
-    std::pair<vk::Image, VmaAllocation>
-    createImage(const vk::ImageCreateInfo& imageCreateInfo, const VmaAllocationCreateInfo& allocationCreateInfo) const
+    /** Create an image and allocate its memory.
+     *
+     * @param imageCreateInfo The image to create.
+     * @param allocationCreateInfo How to allocate the memory of the image.
+     * @param category The kind of resource the memory is accounted to, the same category is passed to `destroyImage()`.
+     */
+    std::pair<vk::Image, VmaAllocation> createImage(
+        const vk::ImageCreateInfo& imageCreateInfo,
+        const VmaAllocationCreateInfo& allocationCreateInfo,
+        gfx_memory_category category = gfx_memory_category::other) const
     {
         hi_axiom(gfx_system_mutex.recurse_lock_count());
 
         VkImage image;
         VmaAllocation allocation;
+        VmaAllocationInfo allocationInfo;
 
         auto const imageCreateInfo_ = static_cast<VkImageCreateInfo>(imageCreateInfo);
-        auto const result =
-            vk::Result{vmaCreateImage(allocator, &imageCreateInfo_, &allocationCreateInfo, &image, &allocation, nullptr)};
+        auto const result = vk::Result{
+            vmaCreateImage(allocator, &imageCreateInfo_, &allocationCreateInfo, &image, &allocation, &allocationInfo)};
 
         if (result != vk::Result::eSuccess) {
             throw gui_error(std::format("vmaCreateImage() failed {}", to_string(result)));
         }
 
+        memory_budget.allocate(category, narrow_cast<std::size_t>(allocationInfo.size));
         return {image, allocation};
     }
 
-    void destroyImage(const vk::Image& image, const VmaAllocation& allocation) const
+    void destroyImage(
+        const vk::Image& image,
+        const VmaAllocation& allocation,
+        gfx_memory_category category = gfx_memory_category::other) const
     {
         hi_axiom(gfx_system_mutex.recurse_lock_count());
 
+        if (allocation == VK_NULL_HANDLE) {
+            // Already destroyed.
+            return;
+        }
+
+        VmaAllocationInfo allocationInfo;
+        vmaGetAllocationInfo(allocator, allocation, &allocationInfo);
+        memory_budget.deallocate(category, narrow_cast<std::size_t>(allocationInfo.size));
+
         vmaDestroyImage(allocator, image, allocation);
     }
 
+    /** Subscribe a callback for when memory of the device is running low.
+     *
+     * The callback `void(std::size_t excess)` is called from the render thread
+     * with `gfx_system_mutex` locked. The callback should release cached
+     * resources and stop the cache from growing, @a excess is the number of
+     * bytes that should be released by all caches together. When @a excess
+     * is zero the pressure is relieved and the caches may grow again.
+     */
+    template<forward_of<void(std::size_t)> Func>
+    [[nodiscard]] notifier<void(std::size_t)>::callback_type subscribe_memory_pressure(Func&& func) const noexcept
+    {
+        return _memory_pressure_notifier.subscribe(std::forward<Func>(func), callback_flags::synchronous);
+    }
+
+    /** Update the memory usage and budget of the heaps of this device.
+     *
+     * This is called once for each frame. The usage of each category is
+     * written to the telemetry counters, and the subscribers are notified when
+     * memory is running low.
+     *
+     * @pre `gfx_system_mutex` must be locked.
+     */
+    void update_memory_budget() noexcept;
+
+    /** Start a frame of a surface on this device.
+     *
+     * A frame of the device spans one frame of each surface that is rendering to it,
+     * a new frame of the device starts when a surface starts its second frame within
+     * the current one. Resources shared by the surfaces, such as the glyph atlas, use
+     * the frames of the device so that with several windows they do not age faster.
+     *
+     * @pre `gfx_system_mutex` must be locked.
+     * @param[in,out] surface_frame The frame of the device in which the surface started
+     *                              its previous frame, updated to the current frame.
+     * @return True when a new frame of the device was started.
+     */
+    bool start_surface_frame(std::size_t& surface_frame) noexcept
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+        auto const r = surface_frame == _frame_count;
+        if (r) {
+            ++_frame_count;
+        }
+        surface_frame = _frame_count;
+        return r;
+    }
+
     vk::CommandBuffer beginSingleTimeCommands() const
     {
         hi_axiom(gfx_system_mutex.recurse_lock_count());
@@ -576,15 +814,36 @@ public:
     void waitIdle() const
     {
         hi_axiom(gfx_system_mutex.recurse_lock_count());
+        if (lost) {
+            return;
+        }
         return intrinsic.waitIdle();
     }
 
     vk::Result waitForFences(vk::ArrayProxy<const vk::Fence> fences, vk::Bool32 waitAll, uint64_t timeout) const
     {
         hi_axiom(gfx_system_mutex.recurse_lock_count());
+        if (lost) {
+            return vk::Result::eErrorDeviceLost;
+        }
         return intrinsic.waitForFences(fences, waitAll, timeout);
     }
 
+    vk::Result waitSemaphores(vk::SemaphoreWaitInfo const& waitInfo, uint64_t timeout) const
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        if (lost) {
+            return vk::Result::eErrorDeviceLost;
+        }
+        return intrinsic.waitSemaphores(waitInfo, timeout);
+    }
+
+    uint64_t getSemaphoreCounterValue(vk::Semaphore semaphore) const
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        return intrinsic.getSemaphoreCounterValue(semaphore);
+    }
+
     vk::Result acquireNextImageKHR(
         vk::SwapchainKHR swapchain,
         uint64_t timeout,
@@ -596,6 +855,13 @@ public:
         return intrinsic.acquireNextImageKHR(swapchain, timeout, semaphore, fence, pImageIndex);
     }
 
+    /** Wait until a swapchain image with the present identifier is displayed.
+     *
+     * @pre `supportsPresentWait` must be true.
+     * @return eSuccess when the image was displayed, or eTimeout.
+     */
+    vk::Result waitForPresentKHR(vk::SwapchainKHR swapchain, uint64_t present_id, uint64_t timeout) const;
+
     void resetFences(vk::ArrayProxy<const vk::Fence> fences) const
     {
         hi_axiom(gfx_system_mutex.recurse_lock_count());
@@ -655,6 +921,18 @@ public:
         return intrinsic.createFence(createInfo);
     }
 
+    vk::CommandPool createCommandPool(const vk::CommandPoolCreateInfo& createInfo) const
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        return intrinsic.createCommandPool(createInfo);
+    }
+
+    void resetCommandPool(vk::CommandPool commandPool) const
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        return intrinsic.resetCommandPool(commandPool, vk::CommandPoolResetFlags{});
+    }
+
     vk::DescriptorSetLayout createDescriptorSetLayout(const vk::DescriptorSetLayoutCreateInfo& createInfo) const
     {
         hi_axiom(gfx_system_mutex.recurse_lock_count());
@@ -669,13 +947,13 @@ public:
 
     vk::PipelineLayout createPipelineLayout(const vk::PipelineLayoutCreateInfo& createInfo) const
     {
-        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        // no lock, creating objects on a device is thread-safe; pipelines are compiled concurrently.
         return intrinsic.createPipelineLayout(createInfo);
     }
 
     vk::Pipeline createGraphicsPipeline(vk::PipelineCache pipelineCache, const vk::GraphicsPipelineCreateInfo& createInfo) const
     {
-        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        // no lock, the pipeline cache is internally synchronized; pipelines are compiled concurrently.
         return intrinsic.createGraphicsPipeline(pipelineCache, createInfo).value;
     }
 
@@ -770,6 +1048,16 @@ public:
     }
 
 private:
+    mutable notifier<void(std::size_t)> _memory_pressure_notifier;
+
+    /** The frame index passed to VMA, so that it fetches the budget from the driver.
+     */
+    uint32_t _memory_budget_frame = 0;
+
+    /** The number of frames of the device, see `start_surface_frame()`.
+     */
+    std::size_t _frame_count = 1;
+
     static bool
     hasRequiredExtensions(const vk::PhysicalDevice& physicalDevice, const std::vector<const char *>& requiredExtensions)
     {
@@ -979,6 +1267,24 @@ private:
 
     void initialize_device();
 
+    /** Destroy the Vulkan device, after the pipelines have been destroyed.
+     */
+    void teardown_device();
+
+    /** The path of the pipeline cache file of this device.
+     *
+     * The file name includes the UUID of the device, so that each device has its own cache.
+     */
+    [[nodiscard]] std::expected<std::filesystem::path, std::error_code> pipeline_cache_path() const noexcept;
+
+    /** Create the pipeline cache, with the data loaded from the pipeline cache file.
+     */
+    void initialize_pipeline_cache();
+
+    /** Save the pipeline cache to the pipeline cache file and destroy the pipeline cache.
+     */
+    void destroy_pipeline_cache() noexcept;
+
     void initialize_quad_index_buffer()
     {
         hi_axiom(gfx_system_mutex.recurse_lock_count());
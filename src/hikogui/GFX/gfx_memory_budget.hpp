@@ -0,0 +1,183 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <array>
+#include <vector>
+#include <span>
+#include <optional>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.GFX : gfx_memory_budget);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** The kind of resource a device memory allocation is used for.
+ */
+enum class gfx_memory_category : uint8_t {
+    other,
+
+    /** The atlas textures of the SDF pipeline, and its staging texture.
+     */
+    glyph_atlas,
+
+    /** The atlas textures of the image pipeline, and its staging textures and buffers.
+     */
+    image_atlas,
+
+    /** The vertex rings of the surfaces.
+     */
+    vertex_ring,
+
+    /** The color and depth attachments, offscreen images and readback buffers of the surfaces.
+     */
+    swapchain
+};
+
+// clang-format off
+constexpr auto gfx_memory_category_metadata = enum_metadata{
+    gfx_memory_category::other, "other",
+    gfx_memory_category::glyph_atlas, "glyph-atlas",
+    gfx_memory_category::image_atlas, "image-atlas",
+    gfx_memory_category::vertex_ring, "vertex-ring",
+    gfx_memory_category::swapchain, "swapchain"
+};
+// clang-format on
+
+/** Track the memory usage of a device against the budget of the driver.
+ *
+ * The allocations of a device are tallied for each category. The usage and
+ * budget of each memory heap, as reported by the driver, are updated once per
+ * frame. When the usage of a heap exceeds `high_water` of its budget the caches
+ * are asked to release memory, until the usage is below `low_water` of the budget.
+ *
+ * Memory released by the caches may still be used by frames-in-flight, so
+ * the caches are asked again only after `num_settle_frames`.
+ */
+class gfx_memory_budget {
+public:
+    struct heap_type {
+        /** The number of bytes allocated from the heap by this process.
+         */
+        std::size_t usage = 0;
+
+        /** The number of bytes this process may allocate from the heap, or zero when unknown.
+         */
+        std::size_t budget = 0;
+    };
+
+    /** Caches are asked to release memory when the usage exceeds this fraction of the budget.
+     */
+    constexpr static double high_water = 0.9;
+
+    /** Caches are asked to release memory until the usage is below this fraction of the budget.
+     */
+    constexpr static double low_water = 0.75;
+
+    /** The number of frames to wait for released memory to be returned to the driver.
+     */
+    constexpr static std::size_t num_settle_frames = 4;
+
+    constexpr gfx_memory_budget() noexcept = default;
+
+    /** Account for a new allocation.
+     */
+    constexpr void allocate(gfx_memory_category category, std::size_t size) noexcept
+    {
+        _usage[std::to_underlying(category)] += size;
+    }
+
+    /** Account for the destruction of an allocation.
+     */
+    constexpr void deallocate(gfx_memory_category category, std::size_t size) noexcept
+    {
+        hi_axiom(_usage[std::to_underlying(category)] >= size);
+        _usage[std::to_underlying(category)] -= size;
+    }
+
+    /** The number of bytes allocated for a category.
+     */
+    [[nodiscard]] constexpr std::size_t usage(gfx_memory_category category) const noexcept
+    {
+        return _usage[std::to_underlying(category)];
+    }
+
+    /** The usage and budget of each memory heap, during the last update.
+     */
+    [[nodiscard]] constexpr std::vector<heap_type> const& heaps() const noexcept
+    {
+        return _heaps;
+    }
+
+    /** Check if the caches have been asked to release memory.
+     */
+    [[nodiscard]] constexpr bool under_pressure() const noexcept
+    {
+        return _under_pressure;
+    }
+
+    /** Update the usage and budget of the memory heaps.
+     *
+     * This function should be called once per frame.
+     *
+     * @param heaps The usage and budget of each memory heap.
+     * @return The number of bytes the caches should release, zero when the
+     *         caches may grow again, or empty when nothing has changed.
+     */
+    [[nodiscard]] std::optional<std::size_t> update(std::span<heap_type const> heaps) noexcept
+    {
+        _heaps.assign(heaps.begin(), heaps.end());
+
+        auto over_high_water = false;
+        auto over_low_water = false;
+        auto excess = std::size_t{0};
+        for (auto const& heap : _heaps) {
+            if (heap.budget == 0) {
+                continue;
+            }
+
+            auto const high = static_cast<std::size_t>(static_cast<double>(heap.budget) * high_water);
+            auto const low = static_cast<std::size_t>(static_cast<double>(heap.budget) * low_water);
+            if (heap.usage > low) {
+                over_low_water = true;
+                if (heap.usage > high) {
+                    over_high_water = true;
+                    excess = std::max(excess, heap.usage - low);
+                }
+            }
+        }
+
+        if (_settle_frames != 0) {
+            --_settle_frames;
+            return std::nullopt;
+        }
+
+        if (over_high_water) {
+            _under_pressure = true;
+            _settle_frames = num_settle_frames;
+            return excess;
+
+        } else if (_under_pressure and not over_low_water) {
+            _under_pressure = false;
+            return 0;
+
+        } else {
+            return std::nullopt;
+        }
+    }
+
+private:
+    std::array<std::size_t, gfx_memory_category_metadata.size()> _usage = {};
+    std::vector<heap_type> _heaps = {};
+    std::size_t _settle_frames = 0;
+    bool _under_pressure = false;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,71 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gfx_memory_budget.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <cstddef>
+
+using hi::operator""_uz;
+
+TEST_SUITE(gfx_memory_budget_suite) {
+
+TEST_CASE(usage_test)
+{
+    auto budget = hi::gfx_memory_budget{};
+    budget.allocate(hi::gfx_memory_category::glyph_atlas, 100);
+    budget.allocate(hi::gfx_memory_category::glyph_atlas, 50);
+    budget.allocate(hi::gfx_memory_category::swapchain, 1000);
+    REQUIRE(budget.usage(hi::gfx_memory_category::glyph_atlas) == 150);
+    REQUIRE(budget.usage(hi::gfx_memory_category::swapchain) == 1000);
+    REQUIRE(budget.usage(hi::gfx_memory_category::image_atlas) == 0);
+
+    budget.deallocate(hi::gfx_memory_category::glyph_atlas, 100);
+    REQUIRE(budget.usage(hi::gfx_memory_category::glyph_atlas) == 50);
+}
+
+TEST_CASE(pressure_test)
+{
+    using heap_type = hi::gfx_memory_budget::heap_type;
+
+    auto budget = hi::gfx_memory_budget{};
+
+    // Below the high water mark, or with an unknown budget.
+    auto heaps = std::vector<heap_type>{heap_type{800, 1000}, heap_type{5000, 0}};
+    REQUIRE(not budget.update(heaps));
+    REQUIRE(not budget.under_pressure());
+    REQUIRE(budget.heaps().size() == 2);
+
+    // Above the high water mark, release down to the low water mark.
+    heaps[0].usage = 950;
+    auto const excess = budget.update(heaps);
+    REQUIRE(excess.has_value());
+    REQUIRE(*excess == 200);
+    REQUIRE(budget.under_pressure());
+
+    // Wait for the released memory to settle, before asking again.
+    for (auto i = 0_uz; i != hi::gfx_memory_budget::num_settle_frames; ++i) {
+        REQUIRE(not budget.update(heaps));
+    }
+    auto const excess2 = budget.update(heaps);
+    REQUIRE(excess2.has_value());
+    REQUIRE(*excess2 == 200);
+
+    // Between the low and high water mark the pressure remains.
+    heaps[0].usage = 800;
+    for (auto i = 0_uz; i != hi::gfx_memory_budget::num_settle_frames + 1; ++i) {
+        REQUIRE(not budget.update(heaps));
+    }
+    REQUIRE(budget.under_pressure());
+
+    // Below the low water mark the caches may grow again.
+    heaps[0].usage = 700;
+    auto const relieved = budget.update(heaps);
+    REQUIRE(relieved.has_value());
+    REQUIRE(*relieved == 0);
+    REQUIRE(not budget.under_pressure());
+    REQUIRE(not budget.update(heaps));
+}
+
+};
@@ -0,0 +1,391 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.GFX : gfx_page_allocator);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** An allocator for fixed size pages in a set of texture atlas layers.
+ *
+ * A page is identified by `layer * num_pages_per_layer() + index`. Each layer
+ * has a kind, like the pixel format of the texture, pages are only allocated
+ * from layers of the requested kind.
+ *
+ * The pages of an allocation are placed in a contiguous run of pages in a
+ * single layer when possible. The run is selected best-fit from the fullest
+ * layer, so that free pages stay together and lightly used layers become
+ * empty. Layers are added while within the budget. A layer that became empty
+ * is released, except for the first layer and a single spare layer for each
+ * kind.
+ *
+ * Freed pages are retired for a number of frames before they can be allocated
+ * again, as they may still be read by frames-in-flight.
+ */
+class gfx_page_allocator {
+public:
+    using kind_type = uint8_t;
+
+    constexpr gfx_page_allocator() noexcept = default;
+
+    /** Create an allocator.
+     *
+     * @param num_pages_per_layer The number of pages in a layer.
+     * @param max_num_layers The maximum number of layers, this is also the initial budget.
+     * @param num_retire_frames The number of frames before freed pages can be allocated again.
+     */
+    constexpr gfx_page_allocator(std::size_t num_pages_per_layer, std::size_t max_num_layers, std::size_t num_retire_frames) noexcept :
+        _num_pages_per_layer(num_pages_per_layer),
+        _max_num_layers(max_num_layers),
+        _budget(max_num_layers),
+        _num_retire_frames(num_retire_frames)
+    {
+        hi_axiom(num_pages_per_layer > 0);
+        hi_axiom(max_num_layers > 0);
+    }
+
+    [[nodiscard]] constexpr std::size_t num_pages_per_layer() const noexcept
+    {
+        return _num_pages_per_layer;
+    }
+
+    [[nodiscard]] constexpr std::size_t max_num_layers() const noexcept
+    {
+        return _max_num_layers;
+    }
+
+    /** The maximum number of layers that pages are allocated from.
+     */
+    [[nodiscard]] constexpr std::size_t budget() const noexcept
+    {
+        return _budget;
+    }
+
+    /** Set the maximum number of layers that pages are allocated from.
+     *
+     * When the budget is lowered, the layers are released as they become empty.
+     *
+     * @param num_layers The number of layers, clamped between 1 and `max_num_layers()`.
+     */
+    constexpr void set_budget(std::size_t num_layers) noexcept
+    {
+        _budget = std::clamp(num_layers, std::size_t{1}, _max_num_layers);
+    }
+
+    /** The number of layers that exist.
+     */
+    [[nodiscard]] constexpr std::size_t num_layers() const noexcept
+    {
+        return _num_layers;
+    }
+
+    /** One beyond the highest index of a layer that exists.
+     */
+    [[nodiscard]] constexpr std::size_t layer_capacity() const noexcept
+    {
+        return _layers.size();
+    }
+
+    [[nodiscard]] constexpr bool has_layer(std::size_t layer) const noexcept
+    {
+        return layer < _layers.size() and _layers[layer].in_use;
+    }
+
+    /** The kind of a layer.
+     *
+     * @pre The layer must exist.
+     */
+    [[nodiscard]] constexpr kind_type kind(std::size_t layer) const noexcept
+    {
+        hi_axiom(has_layer(layer));
+        return _layers[layer].kind;
+    }
+
+    /** The number of pages that are allocated, including the retired pages.
+     */
+    [[nodiscard]] constexpr std::size_t num_allocated_pages() const noexcept
+    {
+        return _num_allocated_pages;
+    }
+
+    /** The number of pages that were freed, but can not be allocated yet.
+     */
+    [[nodiscard]] constexpr std::size_t num_retired_pages() const noexcept
+    {
+        return _retired_pages.size();
+    }
+
+    /** The number of pages that can be allocated from the existing layers.
+     */
+    [[nodiscard]] constexpr std::size_t num_free_pages() const noexcept
+    {
+        return _num_layers * _num_pages_per_layer - _num_allocated_pages;
+    }
+
+    /** The fraction of the pages within the budget that is allocated.
+     */
+    [[nodiscard]] constexpr float occupancy() const noexcept
+    {
+        return static_cast<float>(_num_allocated_pages) / static_cast<float>(_budget * _num_pages_per_layer);
+    }
+
+    /** Add an empty layer.
+     *
+     * This is used to create the first layer, which is never released.
+     *
+     * @param kind The kind of layer.
+     * @param on_add_layer The function `void(std::size_t layer, kind_type kind)` called
+     *                     to create the texture for the new layer.
+     * @return The index of the new layer.
+     */
+    template<typename OnAddLayer>
+    std::size_t add_layer(kind_type kind, OnAddLayer const& on_add_layer)
+    {
+        hi_axiom(_num_layers < _max_num_layers);
+
+        auto const it = std::ranges::find(_layers, false, &layer_type::in_use);
+        auto const layer_nr = narrow_cast<std::size_t>(std::distance(_layers.begin(), it));
+        if (it == _layers.end()) {
+            _layers.emplace_back();
+        }
+
+        auto& layer = _layers[layer_nr];
+        layer.free.assign(_num_pages_per_layer, true);
+        layer.num_free = _num_pages_per_layer;
+        layer.kind = kind;
+        layer.in_use = true;
+        ++_num_layers;
+
+        on_add_layer(layer_nr, kind);
+        return layer_nr;
+    }
+
+    /** Allocate pages.
+     *
+     * Either all pages are allocated or none. The pages are allocated in
+     * contiguous runs of at most a full layer, with the rest of the pages
+     * scattered over the largest free runs when the budget does not allow
+     * adding layers.
+     *
+     * @param num_pages The number of pages to allocate.
+     * @param kind The kind of layer to allocate the pages from.
+     * @param on_add_layer The function `void(std::size_t layer, kind_type kind)` called
+     *                     to create the texture for a new layer.
+     * @return The allocated pages, or empty when the pages do not fit within the budget.
+     */
+    template<typename OnAddLayer>
+    [[nodiscard]] std::vector<std::size_t> allocate(std::size_t num_pages, kind_type kind, OnAddLayer const& on_add_layer)
+    {
+        auto r = std::vector<std::size_t>{};
+
+        auto num_available = _budget > _num_layers ? (_budget - _num_layers) * _num_pages_per_layer : 0_uz;
+        for (auto const& layer : _layers) {
+            if (layer.in_use and layer.kind == kind) {
+                num_available += layer.num_free;
+            }
+        }
+        if (num_pages == 0 or num_pages > num_available) {
+            return r;
+        }
+
+        r.reserve(num_pages);
+        while (r.size() != num_pages) {
+            auto const size = std::min(num_pages - r.size(), _num_pages_per_layer);
+            if (auto const run = find_run(size, kind)) {
+                take(run.layer, run.first, size, r);
+            } else if (_num_layers < _budget) {
+                take(add_layer(kind, on_add_layer), 0, size, r);
+            } else {
+                break;
+            }
+        }
+
+        while (r.size() != num_pages) {
+            auto const run = find_largest_run(kind);
+            hi_axiom(static_cast<bool>(run));
+            take(run.layer, run.first, std::min(run.size, num_pages - r.size()), r);
+        }
+        return r;
+    }
+
+    /** Free pages.
+     *
+     * The pages are retired, and can be allocated again after a number of frames.
+     */
+    void free(std::vector<std::size_t> const& pages) noexcept
+    {
+        for (auto const page : pages) {
+            hi_axiom(has_layer(page / _num_pages_per_layer));
+            _retired_pages.emplace_back(_frame, page);
+        }
+    }
+
+    /** Start a new frame.
+     *
+     * Retired pages from old enough frames are returned to their layer, then
+     * layers that became empty are released.
+     *
+     * @param on_release_layer The function `void(std::size_t layer)` called
+     *                         to destroy the texture of a released layer.
+     */
+    template<typename OnReleaseLayer>
+    void next_frame(OnReleaseLayer const& on_release_layer)
+    {
+        ++_frame;
+
+        // The retired pages are ordered by the frame in which they were freed.
+        auto const it = std::ranges::find_if(_retired_pages, [&](auto const& item) {
+            return item.first + _num_retire_frames > _frame;
+        });
+        for (auto jt = _retired_pages.begin(); jt != it; ++jt) {
+            auto& layer = _layers[jt->second / _num_pages_per_layer];
+            auto const index = jt->second % _num_pages_per_layer;
+            hi_axiom(not layer.free[index]);
+            layer.free[index] = true;
+            ++layer.num_free;
+            --_num_allocated_pages;
+        }
+        _retired_pages.erase(_retired_pages.begin(), it);
+
+        auto spare_kinds = std::vector<kind_type>{};
+        for (auto layer_nr = 0_uz; layer_nr != _layers.size(); ++layer_nr) {
+            auto& layer = _layers[layer_nr];
+            if (not layer.in_use or layer.num_free != _num_pages_per_layer) {
+                continue;
+            }
+
+            auto const has_spare = std::ranges::find(spare_kinds, layer.kind) != spare_kinds.end();
+            if (layer_nr == 0 or (not has_spare and _num_layers <= _budget)) {
+                spare_kinds.push_back(layer.kind);
+                continue;
+            }
+
+            layer.in_use = false;
+            layer.free.clear();
+            layer.num_free = 0;
+            --_num_layers;
+            on_release_layer(layer_nr);
+        }
+
+        while (not _layers.empty() and not _layers.back().in_use) {
+            _layers.pop_back();
+        }
+    }
+
+private:
+    struct layer_type {
+        std::vector<bool> free = {};
+        std::size_t num_free = 0;
+        kind_type kind = 0;
+        bool in_use = false;
+    };
+
+    struct run_type {
+        std::size_t layer = std::numeric_limits<std::size_t>::max();
+        std::size_t first = 0;
+        std::size_t size = 0;
+
+        [[nodiscard]] constexpr explicit operator bool() const noexcept
+        {
+            return layer != std::numeric_limits<std::size_t>::max();
+        }
+    };
+
+    std::size_t _num_pages_per_layer = 1;
+    std::size_t _max_num_layers = 1;
+    std::size_t _budget = 1;
+    std::size_t _num_retire_frames = 0;
+    std::size_t _num_layers = 0;
+    std::size_t _num_allocated_pages = 0;
+    std::size_t _frame = 0;
+    std::vector<layer_type> _layers = {};
+
+    /** Pages that have been freed, together with the frame when they were freed.
+     */
+    std::vector<std::pair<std::size_t, std::size_t>> _retired_pages = {};
+
+    /** Call a function for each run of free pages in layers of a kind.
+     *
+     * @param kind The kind of layers.
+     * @param func The function `void(run_type const& run, layer_type const& layer)`.
+     */
+    template<typename Func>
+    void for_each_run(kind_type kind, Func const& func) const
+    {
+        for (auto layer_nr = 0_uz; layer_nr != _layers.size(); ++layer_nr) {
+            auto const& layer = _layers[layer_nr];
+            if (not layer.in_use or layer.kind != kind or layer.num_free == 0) {
+                continue;
+            }
+
+            auto i = 0_uz;
+            while (i != _num_pages_per_layer) {
+                if (not layer.free[i]) {
+                    ++i;
+                    continue;
+                }
+
+                auto const first = i;
+                while (i != _num_pages_per_layer and layer.free[i]) {
+                    ++i;
+                }
+                func(run_type{layer_nr, first, i - first}, layer);
+            }
+        }
+    }
+
+    /** Find the smallest run that fits, preferring the fullest layer.
+     */
+    [[nodiscard]] run_type find_run(std::size_t size, kind_type kind) const
+    {
+        auto r = run_type{};
+        auto r_num_free = 0_uz;
+        for_each_run(kind, [&](run_type const& run, layer_type const& layer) {
+            if (run.size >= size and (not r or run.size < r.size or (run.size == r.size and layer.num_free < r_num_free))) {
+                r = run;
+                r_num_free = layer.num_free;
+            }
+        });
+        return r;
+    }
+
+    /** Find the largest run, preferring the fullest layer.
+     */
+    [[nodiscard]] run_type find_largest_run(kind_type kind) const
+    {
+        auto r = run_type{};
+        auto r_num_free = 0_uz;
+        for_each_run(kind, [&](run_type const& run, layer_type const& layer) {
+            if (not r or run.size > r.size or (run.size == r.size and layer.num_free < r_num_free)) {
+                r = run;
+                r_num_free = layer.num_free;
+            }
+        });
+        return r;
+    }
+
+    void take(std::size_t layer_nr, std::size_t first, std::size_t size, std::vector<std::size_t>& pages) noexcept
+    {
+        auto& layer = _layers[layer_nr];
+        for (auto i = first; i != first + size; ++i) {
+            hi_axiom(layer.free[i]);
+            layer.free[i] = false;
+            pages.push_back(layer_nr * _num_pages_per_layer + i);
+        }
+        layer.num_free -= size;
+        _num_allocated_pages += size;
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,132 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gfx_page_allocator.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <cstddef>
+
+TEST_SUITE(gfx_page_allocator_suite) {
+
+TEST_CASE(contiguous_test)
+{
+    auto allocator = hi::gfx_page_allocator(8, 4, 0);
+    auto added = std::vector<std::size_t>{};
+    auto const on_add = [&](std::size_t layer, hi::gfx_page_allocator::kind_type) {
+        added.push_back(layer);
+    };
+
+    auto const a = allocator.allocate(3, 0, on_add);
+    auto const a_expected = std::vector<std::size_t>{0, 1, 2};
+    REQUIRE(a == a_expected);
+    auto const b = allocator.allocate(3, 0, on_add);
+    auto const b_expected = std::vector<std::size_t>{3, 4, 5};
+    REQUIRE(b == b_expected);
+    REQUIRE(added == std::vector<std::size_t>{0});
+
+    // Free pages 0, 1, 2. The run of two pages is placed best-fit in the run of two, not of three.
+    allocator.free(a);
+    allocator.next_frame([](std::size_t) {});
+    auto const c = allocator.allocate(2, 0, on_add);
+    auto const c_expected = std::vector<std::size_t>{6, 7};
+    REQUIRE(c == c_expected);
+    auto const d = allocator.allocate(3, 0, on_add);
+    auto const d_expected = std::vector<std::size_t>{0, 1, 2};
+    REQUIRE(d == d_expected);
+
+    // Does not fit contiguously in the first layer.
+    auto const e = allocator.allocate(2, 0, on_add);
+    auto const e_expected = std::vector<std::size_t>{8, 9};
+    REQUIRE(e == e_expected);
+    auto const added_expected = std::vector<std::size_t>{0, 1};
+    REQUIRE(added == added_expected);
+
+    // Larger than a layer, a full layer and the rest in a run.
+    auto const f = allocator.allocate(10, 0, on_add);
+    REQUIRE(f.size() == 10);
+    REQUIRE(f[0] == 16);
+    REQUIRE(f[7] == 23);
+    REQUIRE(f[8] == 10);
+    REQUIRE(f[9] == 11);
+    REQUIRE(allocator.num_allocated_pages() == 20);
+}
+
+TEST_CASE(kind_test)
+{
+    auto allocator = hi::gfx_page_allocator(8, 4, 0);
+    auto const on_add = [](std::size_t, hi::gfx_page_allocator::kind_type) {};
+
+    auto const a = allocator.allocate(2, 0, on_add);
+    auto const b = allocator.allocate(2, 1, on_add);
+    auto const a_expected = std::vector<std::size_t>{0, 1};
+    REQUIRE(a == a_expected);
+    auto const b_expected = std::vector<std::size_t>{8, 9};
+    REQUIRE(b == b_expected);
+    REQUIRE(allocator.kind(0) == 0);
+    REQUIRE(allocator.kind(1) == 1);
+}
+
+TEST_CASE(budget_test)
+{
+    auto allocator = hi::gfx_page_allocator(8, 4, 0);
+    auto const on_add = [](std::size_t, hi::gfx_page_allocator::kind_type) {};
+    allocator.set_budget(2);
+
+    auto const a = allocator.allocate(6, 0, on_add);
+    auto const b = allocator.allocate(6, 0, on_add);
+    REQUIRE(a.size() == 6);
+    REQUIRE(b.size() == 6);
+    REQUIRE(allocator.num_layers() == 2);
+
+    // The remaining 4 pages are scattered over both layers.
+    auto const c = allocator.allocate(4, 0, on_add);
+    auto const c_expected = std::vector<std::size_t>{6, 7, 14, 15};
+    REQUIRE(c == c_expected);
+
+    // The budget is completely allocated.
+    REQUIRE(allocator.allocate(1, 0, on_add).empty());
+    REQUIRE(allocator.num_layers() == 2);
+    REQUIRE(allocator.occupancy() == 1.0f);
+}
+
+TEST_CASE(release_test)
+{
+    auto allocator = hi::gfx_page_allocator(8, 4, 2);
+    auto const on_add = [](std::size_t, hi::gfx_page_allocator::kind_type) {};
+    auto released = std::vector<std::size_t>{};
+    auto const on_release = [&](std::size_t layer) {
+        released.push_back(layer);
+    };
+
+    auto const a = allocator.allocate(8, 0, on_add);
+    auto const b = allocator.allocate(8, 0, on_add);
+    auto const c = allocator.allocate(8, 0, on_add);
+    REQUIRE(allocator.num_layers() == 3);
+
+    allocator.free(b);
+    allocator.free(c);
+    REQUIRE(allocator.num_retired_pages() == 16);
+
+    // The pages are retired for two frames.
+    allocator.next_frame(on_release);
+    REQUIRE(allocator.num_allocated_pages() == 24);
+    allocator.next_frame(on_release);
+    REQUIRE(allocator.num_allocated_pages() == 8);
+
+    // A single empty layer is kept as spare.
+    REQUIRE(released == std::vector<std::size_t>{2});
+    REQUIRE(allocator.num_layers() == 2);
+    REQUIRE(allocator.layer_capacity() == 2);
+
+    // The first layer is never released.
+    allocator.free(a);
+    allocator.next_frame(on_release);
+    allocator.next_frame(on_release);
+    auto const released_expected = std::vector<std::size_t>{2, 1};
+    REQUIRE(released == released_expected);
+    REQUIRE(allocator.num_layers() == 1);
+    REQUIRE(allocator.has_layer(0));
+}
+
+};
@@ -8,8 +8,11 @@
 #include "gfx_surface_vulkan_intf.hpp"
 #include "gfx_device_vulkan_impl.hpp"
 #include "draw_context_intf.hpp"
+#include "../path/path.hpp"
 #include "../macros.hpp"
 #include <vulkan/vulkan.hpp>
+#include <algorithm>
+#include <cmath>
 
 hi_export_module(hikogui.GFX : gfx_pipeline_SDF_impl);
 
@@ -20,10 +23,9 @@ inline void gfx_pipeline_SDF::draw_in_command_buffer(vk::CommandBuffer commandBu
     gfx_pipeline::draw_in_command_buffer(commandBuffer, context);
 
     hi_axiom_not_null(device());
-    device()->flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof(vertex));
 
     std::vector<vk::Buffer> tmpvertexBuffers = {vertexBuffer};
-    std::vector<vk::DeviceSize> tmpOffsets = {0};
+    std::vector<vk::DeviceSize> tmpOffsets = {vertexBufferOffset};
     hi_assert(tmpvertexBuffers.size() == tmpOffsets.size());
 
     device()->SDF_pipeline->drawInCommandBuffer(commandBuffer);
@@ -32,10 +34,15 @@ inline void gfx_pipeline_SDF::draw_in_command_buffer(vk::CommandBuffer commandBu
 
     pushConstants.window_extent = extent2{narrow_cast<float>(extent.width), narrow_cast<float>(extent.height)};
     pushConstants.viewport_scale = scale2{narrow_cast<float>(2.0f / extent.width), narrow_cast<float>(2.0f / extent.height)};
-    pushConstants.has_subpixels = context.subpixel_orientation != subpixel_orientation::unknown;
+
+    // Without dual-source blending the coverage of each sub-pixel can not be blended separately,
+    // the colored fringes would then be visible.
+    auto const orientation =
+        device()->device_features.dualSrcBlend ? context.subpixel_orientation : subpixel_orientation::unknown;
+    pushConstants.has_subpixels = orientation != subpixel_orientation::unknown;
 
     constexpr float third = 1.0f / 3.0f;
-    switch (context.subpixel_orientation) {
+    switch (orientation) {
     case subpixel_orientation::unknown:
         pushConstants.red_subpixel_offset = vector2{0.0f, 0.0f};
         pushConstants.blue_subpixel_offset = vector2{0.0f, 0.0f};
@@ -67,10 +74,11 @@ inline void gfx_pipeline_SDF::draw_in_command_buffer(vk::CommandBuffer commandBu
         sizeof(push_constants),
         &pushConstants);
 
-    auto const numberOfRectangles = vertexBufferData.size() / 4;
-    auto const numberOfTriangles = numberOfRectangles * 2;
+    auto const numberOfGlyphs = vertexBufferData.size();
+
+    // Draw the first quad of the quad index buffer for each glyph instance.
     device()->cmdBeginDebugUtilsLabelEXT(commandBuffer, "draw glyphs");
-    commandBuffer.drawIndexed(narrow_cast<uint32_t>(numberOfTriangles * 3), 1, 0, 0, 0);
+    commandBuffer.drawIndexed(6, narrow_cast<uint32_t>(numberOfGlyphs), 0, 0, 0);
     device()->cmdEndDebugUtilsLabelEXT(commandBuffer);
 }
 
@@ -110,10 +118,24 @@ inline std::vector<vk::DescriptorSetLayoutBinding> gfx_pipeline_SDF::createDescr
          vk::ShaderStageFlagBits::eFragment},
         {1, // binding
          vk::DescriptorType::eSampledImage,
-         narrow_cast<uint32_t>(device_shared::atlasMaximumNrImages), // descriptorCount
+         narrow_cast<uint32_t>(device()->SDF_pipeline->atlasNrImages), // descriptorCount
          vk::ShaderStageFlagBits::eFragment}};
 }
 
+inline std::vector<vk::DescriptorBindingFlags> gfx_pipeline_SDF::createDescriptorSetLayoutBindingFlags() const
+{
+    hi_axiom_not_null(device());
+    if (not device()->supportsBindlessImages) {
+        return {};
+    }
+
+    // Atlas images are added while the descriptor sets of previous frames are still in use.
+    return {
+        vk::DescriptorBindingFlags{},
+        vk::DescriptorBindingFlagBits::ePartiallyBound | vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+            vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending};
+}
+
 inline std::vector<vk::WriteDescriptorSet> gfx_pipeline_SDF::createWriteDescriptorSet() const
 {
     hi_axiom_not_null(device());
@@ -134,7 +156,7 @@ inline std::vector<vk::WriteDescriptorSet> gfx_pipeline_SDF::createWriteDescript
             descriptorSet,
             1, // destBinding
             0, // arrayElement
-            narrow_cast<uint32_t>(device_shared::atlasMaximumNrImages), // descriptorCount
+            narrow_cast<uint32_t>(sharedImagePipeline->atlasDescriptorImageInfos.size()), // descriptorCount
             vk::DescriptorType::eSampledImage,
             sharedImagePipeline->atlasDescriptorImageInfos.data(),
             nullptr, // bufferInfo
@@ -156,40 +178,12 @@ inline std::vector<vk::PushConstantRange> gfx_pipeline_SDF::createPushConstantRa
 
 inline vk::VertexInputBindingDescription gfx_pipeline_SDF::createVertexInputBindingDescription() const
 {
-    return vertex::inputBindingDescription();
+    return instance::inputBindingDescription();
 }
 
 inline std::vector<vk::VertexInputAttributeDescription> gfx_pipeline_SDF::createVertexInputAttributeDescriptions() const
 {
-    return vertex::inputAttributeDescriptions();
-}
-
-inline void gfx_pipeline_SDF::build_vertex_buffers()
-{
-    using vertexIndexType = uint16_t;
-    constexpr ssize_t numberOfVertices = 1 << (sizeof(vertexIndexType) * CHAR_BIT);
-
-    vk::BufferCreateInfo const bufferCreateInfo = {
-        vk::BufferCreateFlags(),
-        sizeof(vertex) * numberOfVertices,
-        vk::BufferUsageFlagBits::eVertexBuffer,
-        vk::SharingMode::eExclusive};
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
-    allocationCreateInfo.pUserData = const_cast<char *>("sdf-pipeline vertex buffer");
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-
-    hi_axiom_not_null(device());
-    std::tie(vertexBuffer, vertexBufferAllocation) = device()->createBuffer(bufferCreateInfo, allocationCreateInfo);
-    device()->setDebugUtilsObjectNameEXT(vertexBuffer, "sdf-pipeline vertex buffer");
-    vertexBufferData = device()->mapMemory<vertex>(vertexBufferAllocation);
-}
-
-inline void gfx_pipeline_SDF::teardown_vertex_buffers()
-{
-    hi_axiom_not_null(device());
-    device()->unmapMemory(vertexBufferAllocation);
-    device()->destroyBuffer(vertexBuffer, vertexBufferAllocation);
+    return instance::inputAttributeDescriptions();
 }
 
 inline void gfx_pipeline_SDF::texture_map::transitionLayout(const gfx_device &device, vk::Format format, vk::ImageLayout nextLayout)
@@ -204,82 +198,185 @@ inline void gfx_pipeline_SDF::texture_map::transitionLayout(const gfx_device &de
 
 inline gfx_pipeline_SDF::device_shared::device_shared(gfx_device const& device) : device(device)
 {
+    // Use larger atlas images when the device supports them, so that more glyphs fit before eviction.
+    atlasImageWidth =
+        std::clamp(device.physicalProperties.limits.maxImageDimension2D, atlasMinimumImageWidth, atlasMaximumImageWidth);
+    atlasTextureCoordinateMultiplier = 1.0f / narrow_cast<float>(atlasImageWidth);
+
+    // Bindless images are not limited by the fixed-size descriptor array, only by the texel budget.
+    auto const max_descriptor_count =
+        device.supportsBindlessImages ? std::size_t{device.maxNrBindlessImages} : std::size_t{atlasMaximumNrImages};
+    atlasNrImages = std::clamp(
+        atlasMaximumNrTexels / (std::size_t{atlasImageWidth} * atlasImageWidth), std::size_t{1}, max_descriptor_count);
+    atlas_allocator = gfx_atlas_allocator<atlas_key_type>(atlasImageWidth, atlasImageWidth, atlasNrImages);
+
+    // Atlas images remain bound to the descriptor sets, so while memory is running low the least
+    // recently used atlas image is evicted instead of adding a new one.
+    memory_pressure_cbt = device.subscribe_memory_pressure([this](std::size_t excess) {
+        atlas_allocator.set_budget(excess != 0 ? atlas_allocator.num_pages() : atlasNrImages);
+        if (excess != 0) {
+            ++global_counter<"gfx_pipeline_SDF:atlas:pressure">;
+        }
+    });
+
     buildShaders();
     buildAtlas();
+    build_rasterizer();
 }
 
-inline gfx_pipeline_SDF::device_shared::~device_shared() {}
+inline gfx_pipeline_SDF::device_shared::~device_shared()
+{
+    teardown_rasterizer();
+}
 
 inline void gfx_pipeline_SDF::device_shared::destroy(gfx_device const *vulkanDevice)
 {
     hi_assert_not_null(vulkanDevice);
 
+    teardown_rasterizer();
     teardownShaders(vulkanDevice);
     teardownAtlas(vulkanDevice);
 }
 
-[[nodiscard]] inline glyph_atlas_info gfx_pipeline_SDF::device_shared::allocate_rect(extent2 draw_extent, scale2 draw_scale) noexcept
+[[nodiscard]] inline glyph_atlas_info
+gfx_pipeline_SDF::device_shared::allocate_rect(atlas_key_type const& key, extent2 draw_extent, scale2 draw_scale) noexcept
+{
+    auto const image_width = ceil_cast<uint32_t>(draw_extent.width());
+    auto const image_height = ceil_cast<uint32_t>(draw_extent.height());
+
+    auto const num_evictions = atlas_allocator.num_evictions();
+    auto const allocation =
+        atlas_allocator.allocate(image_width, image_height, key, [this](atlas_key_type const& evicted_key) {
+            if (evicted_key.font) {
+                evicted_key.font->atlas_info(evicted_key.glyph, device.index) = {};
+            } else {
+                path_tiles.erase(evicted_key);
+            }
+            // A glyph that is still being rasterized will not be uploaded into the evicted atlas texture.
+            pending_glyphs.erase(evicted_key);
+        });
+
+    if (atlas_allocator.num_evictions() != num_evictions) {
+        ++global_counter<"gfx_pipeline_SDF:atlas:evict">;
+        atlas_generation.fetch_add(1, std::memory_order::relaxed);
+    }
+
+    if (not allocation) {
+        ++global_counter<"gfx_pipeline_SDF:atlas:overflow">;
+        return {};
+    }
+
+    while (allocation.page >= atlasTextures.size()) {
+        addAtlasImage();
+    }
+
+    auto const position =
+        point3{narrow_cast<float>(allocation.x), narrow_cast<float>(allocation.y), narrow_cast<float>(allocation.page)};
+    return glyph_atlas_info{position, draw_extent, draw_scale, scale2{atlasTextureCoordinateMultiplier}};
+}
+
+inline void gfx_pipeline_SDF::device_shared::next_frame(bool new_device_frame) noexcept
+{
+    auto const gfx_lock = std::scoped_lock(gfx_system_mutex);
+    auto const lock = std::scoped_lock(atlas_mutex);
+    if (new_device_frame) {
+        atlas_allocator.next_frame();
+    }
+    upload_rasterized_glyphs();
+}
+
+inline bool gfx_pipeline_SDF::device_shared::copy_atlas_from(device_shared const& other) noexcept
 {
-    auto image_width = ceil_cast<int>(draw_extent.width());
-    auto image_height = ceil_cast<int>(draw_extent.height());
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
 
-    // Check if the glyph still fits in the same line of glyphs.
-    // Otherwise go to the next line.
-    if (atlas_allocation_position.x() + image_width > atlasImageWidth) {
-        atlas_allocation_position.x() = 0;
-        atlas_allocation_position.y() = atlas_allocation_position.y() + atlasAllocationMaxHeight;
-        atlasAllocationMaxHeight = 0;
+    if (&other == this) {
+        return false;
     }
 
-    // Check if the glyph still fits in the image.
-    // Otherwise allocate a new image.
-    if (atlas_allocation_position.y() + image_height > atlasImageHeight) {
-        atlas_allocation_position.x() = 0;
-        atlas_allocation_position.y() = 0;
-        atlas_allocation_position.z() = atlas_allocation_position.z() + 1;
-        atlasAllocationMaxHeight = 0;
+    // Both devices are only modified with `gfx_system_mutex` held, so the order of these locks does not matter.
+    auto const lock = std::scoped_lock(atlas_mutex);
+    auto const other_lock = std::shared_lock(other.atlas_mutex);
+
+    if (atlas_allocator.num_pages() != 0 or not pending_glyphs.empty() or not path_tiles.empty()) {
+        return false;
+    }
+
+    if (atlasImageWidth != other.atlasImageWidth or atlasNrImages != other.atlasNrImages) {
+        return false;
+    }
 
-        if (atlas_allocation_position.z() >= atlasMaximumNrImages) {
-            hi_log_fatal("gfx_pipeline_SDF atlas overflow, too many glyphs in use.");
+    atlas_allocator = other.atlas_allocator;
+    path_tiles = other.path_tiles;
+    for (auto page_nr = 0_uz; page_nr != atlas_allocator.num_pages(); ++page_nr) {
+        for (auto const& key : atlas_allocator.keys(page_nr)) {
+            if (key.font) {
+                key.font->atlas_info(key.glyph, device.index) = key.font->find_atlas_info(key.glyph, other.device.index);
+            }
         }
+    }
+
+    while (atlas_allocator.num_pages() > atlasTextures.size()) {
+        addAtlasImage();
+    }
 
-        if (atlas_allocation_position.z() >= atlasTextures.size()) {
-            addAtlasImage();
+    // Upload the mirror of each page through the staging image, one tile at a time.
+    auto regions_per_atlas_texture = std::vector<std::vector<vk::ImageCopy>>(atlasTextures.size());
+    for (auto page_nr = 0_uz; page_nr != atlas_allocator.num_pages(); ++page_nr) {
+        auto const& mirror = other.atlasMirror.at(page_nr);
+        auto const src = pixmap_span<sdf_r8 const>{mirror.data(), mirror.width(), mirror.height()};
+        auto& dst = atlasMirror.at(page_nr);
+        copy(src, pixmap_span<sdf_r8>{dst.data(), dst.width(), dst.height()});
+
+        for (auto y = 0_uz; y < dst.height(); y += stagingImageHeight) {
+            for (auto x = 0_uz; x < dst.width(); x += stagingImageWidth) {
+                auto const width = std::min(dst.width() - x, std::size_t{stagingImageWidth});
+                auto const height = std::min(dst.height() - y, std::size_t{stagingImageHeight});
+
+                prepareStagingPixmapForDrawing();
+                copy(src.subimage(x, y, width, height), stagingTexture.pixmap.subimage(0, 0, width, height));
+
+                regions_per_atlas_texture[page_nr].push_back(vk::ImageCopy{
+                    {vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+                    {0, 0, 0},
+                    {vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+                    {narrow_cast<int32_t>(x), narrow_cast<int32_t>(y), 0},
+                    {narrow_cast<uint32_t>(width), narrow_cast<uint32_t>(height), 1}});
+                uploadStagingPixmapToAtlas(regions_per_atlas_texture);
+            }
         }
     }
 
-    auto r = glyph_atlas_info{atlas_allocation_position, draw_extent, draw_scale, scale2{atlasTextureCoordinateMultiplier}};
-    atlas_allocation_position.x() = atlas_allocation_position.x() + image_width;
-    atlasAllocationMaxHeight = std::max(atlasAllocationMaxHeight, image_height);
-    return r;
+    prepare_atlas_for_rendering();
+    atlas_generation.fetch_add(1, std::memory_order::relaxed);
+    ++global_counter<"gfx_pipeline_SDF:atlas:copy">;
+    return true;
 }
 
-inline void gfx_pipeline_SDF::device_shared::uploadStagingPixmapToAtlas(glyph_atlas_info const& location)
+inline void gfx_pipeline_SDF::device_shared::uploadStagingPixmapToAtlas(
+    std::vector<std::vector<vk::ImageCopy>>& regions_per_atlas_texture)
 {
-    // Flush the given image, included the border.
+    // Flush the complete staging image, the glyphs are spread over the image.
     device.flushAllocation(
         stagingTexture.allocation, 0, (stagingTexture.pixmap.height() * stagingTexture.pixmap.stride()) * sizeof(sdf_r8));
 
     stagingTexture.transitionLayout(device, vk::Format::eR8Snorm, vk::ImageLayout::eTransferSrcOptimal);
 
-    std::array<std::vector<vk::ImageCopy>, atlasMaximumNrImages> regionsToCopyPerAtlasTexture;
-
-    auto regionsToCopy = std::vector{vk::ImageCopy{
-        {vk::ImageAspectFlagBits::eColor, 0, 0, 1},
-        {0, 0, 0},
-        {vk::ImageAspectFlagBits::eColor, 0, 0, 1},
-        {floor_cast<int32_t>(location.position.x()), floor_cast<int32_t>(location.position.y()), 0},
-        {ceil_cast<uint32_t>(location.size.width()), ceil_cast<uint32_t>(location.size.height()), 1}}};
+    for (auto i = 0_uz; i != regions_per_atlas_texture.size(); ++i) {
+        auto& regions_to_copy = regions_per_atlas_texture[i];
+        if (regions_to_copy.empty()) {
+            continue;
+        }
 
-    auto& atlasTexture = atlasTextures.at(floor_cast<std::size_t>(location.position.z()));
-    atlasTexture.transitionLayout(device, vk::Format::eR8Snorm, vk::ImageLayout::eTransferDstOptimal);
+        auto& atlasTexture = atlasTextures.at(i);
+        atlasTexture.transitionLayout(device, vk::Format::eR8Snorm, vk::ImageLayout::eTransferDstOptimal);
 
-    device.copyImage(
-        stagingTexture.image,
-        vk::ImageLayout::eTransferSrcOptimal,
-        atlasTexture.image,
-        vk::ImageLayout::eTransferDstOptimal,
-        std::move(regionsToCopy));
+        device.copyImage(
+            stagingTexture.image,
+            vk::ImageLayout::eTransferSrcOptimal,
+            atlasTexture.image,
+            vk::ImageLayout::eTransferDstOptimal,
+            std::exchange(regions_to_copy, {}));
+    }
 }
 
 inline void gfx_pipeline_SDF::device_shared::prepareStagingPixmapForDrawing()
@@ -296,6 +393,9 @@ inline void gfx_pipeline_SDF::device_shared::prepare_atlas_for_rendering()
 }
 
 /** Prepare the atlas for drawing a text.
+ *
+ * The glyph is rasterized by one of the rasterizer threads and uploaded at the
+ * start of a next frame, until then the glyph is not drawn.
  *
  *  +---------------------+
  *  |     draw border     |
@@ -313,6 +413,12 @@ inline void gfx_pipeline_SDF::device_shared::prepare_atlas_for_rendering()
  */
 inline void gfx_pipeline_SDF::device_shared::add_glyph_to_atlas(hi::font_id font, glyph_id glyph, glyph_atlas_info& info) noexcept
 {
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+    if (pending_glyphs.contains(atlas_key_type{font, glyph})) {
+        // The glyph is still being rasterized.
+        return;
+    }
+
     auto const glyph_metrics = font->get_metrics(glyph);
     auto const glyph_path = font->get_path(glyph);
     auto const glyph_bounding_box = glyph_metrics.bounding_rectangle;
@@ -332,40 +438,359 @@ inline void gfx_pipeline_SDF::device_shared::add_glyph_to_atlas(hi::font_id font
     // Transform the path to the scale of the fixed font size and drawing the bounding box inside the image.
     auto const draw_path = (translate2{draw_offset} * draw_scale) * glyph_path;
 
-    // Draw glyphs into staging buffer of the atlas and upload it to the correct position in the atlas.
-    auto const lock = std::scoped_lock(gfx_system_mutex);
-    prepareStagingPixmapForDrawing();
-    info = allocate_rect(image_size, image_size / draw_bounding_box.size());
-    auto pixmap =
-        stagingTexture.pixmap.subimage(0, 0, ceil_cast<size_t>(info.size.width()), ceil_cast<size_t>(info.size.height()));
-    fill(pixmap, draw_path);
-    uploadStagingPixmapToAtlas(info);
+    // Allocate the glyph in the atlas and let a rasterizer thread draw the glyph.
+    auto new_info = allocate_rect(atlas_key_type{font, glyph}, image_size, image_size / draw_bounding_box.size());
+    if (not new_info) {
+        // The glyph does not fit in the atlas, it will not be drawn.
+        return;
+    }
+
+    pending_glyphs[atlas_key_type{font, glyph}] = new_info;
+
+    {
+        auto const rasterize_lock = std::scoped_lock(_rasterize_mutex);
+        _rasterize_queue.push_back(rasterize_job_type{atlas_key_type{font, glyph}, font->file_hash, new_info, draw_path});
+    }
+    _rasterize_cv.notify_one();
+    ++global_counter<"gfx_pipeline_SDF:rasterize:queue">;
+}
+
+/** Upload the glyphs that where rasterized since the last call.
+ *
+ * The glyphs are copied into the staging pixmap side by side, then
+ * each atlas texture is updated with a single copy command.
+ */
+inline void gfx_pipeline_SDF::device_shared::upload_rasterized_glyphs() noexcept
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    auto rasterized_glyphs = std::vector<rasterize_job_type>{};
+    {
+        auto const rasterize_lock = std::scoped_lock(_rasterize_mutex);
+        std::swap(rasterized_glyphs, _rasterized_glyphs);
+    }
+
+    if (rasterized_glyphs.empty()) {
+        return;
+    }
+
+    auto staging_allocator = gfx_atlas_allocator<std::size_t>(stagingImageWidth, stagingImageHeight, 1);
+    auto regions_per_atlas_texture = std::vector<std::vector<vk::ImageCopy>>(atlasTextures.size());
+    auto staged_glyphs = std::vector<rasterize_job_type const *>{};
+
+    auto const flush = [&] {
+        uploadStagingPixmapToAtlas(regions_per_atlas_texture);
+        for (auto const *job : staged_glyphs) {
+            if (job->key.font) {
+                job->key.font->atlas_info(job->key.glyph, device.index) = job->info;
+            } else {
+                path_tiles[job->key] = job->info;
+            }
+            pending_glyphs.erase(job->key);
+        }
+        staged_glyphs.clear();
+        staging_allocator = gfx_atlas_allocator<std::size_t>(stagingImageWidth, stagingImageHeight, 1);
+    };
+
+    for (auto i = 0_uz; i != rasterized_glyphs.size(); ++i) {
+        auto const& job = rasterized_glyphs[i];
+
+        auto const it = pending_glyphs.find(job.key);
+        if (it == pending_glyphs.end() or it->second.position != job.info.position) {
+            // The glyph was evicted from the atlas while it was being rasterized.
+            ++global_counter<"gfx_pipeline_SDF:rasterize:discard">;
+            continue;
+        }
+
+        auto const width = narrow_cast<uint32_t>(job.image.width());
+        auto const height = narrow_cast<uint32_t>(job.image.height());
+        auto staging = staging_allocator.allocate(width, height, i, [](std::size_t) {});
+        if (not staging and not staged_glyphs.empty()) {
+            flush();
+            staging = staging_allocator.allocate(width, height, i, [](std::size_t) {});
+        }
+
+        if (not staging) {
+            // The glyph is larger than the staging image, it will not be drawn.
+            ++global_counter<"gfx_pipeline_SDF:rasterize:overflow">;
+            pending_glyphs.erase(it);
+            continue;
+        }
+
+        if (staged_glyphs.empty()) {
+            prepareStagingPixmapForDrawing();
+        }
+
+        auto const src = pixmap_span<sdf_r8 const>{job.image.data(), job.image.width(), job.image.height()};
+        copy(src, stagingTexture.pixmap.subimage(staging.x, staging.y, width, height));
+
+        auto const page_nr = floor_cast<std::size_t>(job.info.position.z());
+        hi_axiom_bounds(page_nr, atlasMirror);
+        auto& mirror = atlasMirror[page_nr];
+        copy(
+            src,
+            pixmap_span<sdf_r8>{mirror.data(), mirror.width(), mirror.height()}.subimage(
+                floor_cast<std::size_t>(job.info.position.x()), floor_cast<std::size_t>(job.info.position.y()), width, height));
+        hi_axiom_bounds(page_nr, regions_per_atlas_texture);
+        regions_per_atlas_texture[page_nr].push_back(vk::ImageCopy{
+            {vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+            {narrow_cast<int32_t>(staging.x), narrow_cast<int32_t>(staging.y), 0},
+            {vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+            {floor_cast<int32_t>(job.info.position.x()), floor_cast<int32_t>(job.info.position.y()), 0},
+            {width, height, 1}});
+        staged_glyphs.push_back(&job);
+    }
+
+    if (not staged_glyphs.empty()) {
+        flush();
+    }
+
+    prepare_atlas_for_rendering();
+
+    // Retained vertices were recorded without the glyphs that were still being rasterized.
+    atlas_generation.fetch_add(1, std::memory_order::relaxed);
+    ++global_counter<"gfx_pipeline_SDF:rasterize:upload">;
+}
+
+inline void gfx_pipeline_SDF::device_shared::build_rasterizer()
+{
+    if (glyph_cache_enabled) {
+        if (auto const dir = data_dir()) {
+            glyph_cache = std::make_unique<sdf_glyph_cache>(*dir / "sdf_glyph_cache.bin", drawfontSize, drawBorder);
+        } else {
+            hi_log_error("Could not find the data directory for the glyph cache. \"{}\"", dir.error().message());
+        }
+    }
+
+    // Leave enough cores for the render and main thread.
+    auto const num_threads = std::clamp(std::thread::hardware_concurrency() / 2, 1U, 4U);
+    for (auto i = 0U; i != num_threads; ++i) {
+        _rasterizer_threads.emplace_back([this](std::stop_token stop_token) {
+            rasterizer_thread_main(stop_token);
+        });
+    }
 }
 
-inline bool gfx_pipeline_SDF::device_shared::place_vertices(
-    vector_span<vertex>& vertices,
+inline void gfx_pipeline_SDF::device_shared::teardown_rasterizer()
+{
+    // Destroying std::jthread will request a stop and join the thread.
+    _rasterizer_threads.clear();
+
+    {
+        auto const rasterize_lock = std::scoped_lock(_rasterize_mutex);
+        _rasterize_queue.clear();
+        _rasterized_glyphs.clear();
+    }
+
+    if (glyph_cache) {
+        glyph_cache->save();
+    }
+}
+
+inline void gfx_pipeline_SDF::device_shared::rasterizer_thread_main(std::stop_token stop_token) noexcept
+{
+    set_thread_name("sdf_rasterizer");
+
+    while (true) {
+        auto job = rasterize_job_type{};
+        {
+            auto lock = std::unique_lock(_rasterize_mutex);
+            if (not _rasterize_cv.wait(lock, stop_token, [this] {
+                    return not _rasterize_queue.empty();
+                })) {
+                return;
+            }
+
+            job = std::move(_rasterize_queue.front());
+            _rasterize_queue.pop_front();
+        }
+
+        job.image = pixmap<sdf_r8>{ceil_cast<std::size_t>(job.info.size.width()), ceil_cast<std::size_t>(job.info.size.height())};
+        auto const image = pixmap_span<sdf_r8>{job.image.data(), job.image.width(), job.image.height()};
+
+        if (not glyph_cache or not glyph_cache->find(job.font_hash, job.key.glyph, image)) {
+            fill(image, job.path);
+
+            if (glyph_cache) {
+                glyph_cache->insert(job.font_hash, job.key.glyph, pixmap_span<sdf_r8 const>{job.image});
+            }
+        }
+
+        {
+            auto const rasterize_lock = std::scoped_lock(_rasterize_mutex);
+            _rasterized_glyphs.push_back(std::move(job));
+        }
+        glyphs_rasterized();
+    }
+}
+
+inline bool gfx_pipeline_SDF::device_shared::place_instance(
+    vector_span<instance>& instances,
     aarectangle const& clipping_rectangle,
     quad const& box,
     hi::font_id font, glyph_id glyph,
     quad_color colors) noexcept
 {
     auto const[atlas_rect, glyph_was_added] = this->get_glyph_from_atlas(font, glyph);
+    if (not atlas_rect) {
+        return false;
+    }
 
-    auto const box_with_border = scale_from_center(box, atlas_rect->border_scale);
-
-    auto image_index = atlas_rect->position.z();
-    auto t0 = point3(get<0>(atlas_rect->texture_coordinates), image_index);
-    auto t1 = point3(get<1>(atlas_rect->texture_coordinates), image_index);
-    auto t2 = point3(get<2>(atlas_rect->texture_coordinates), image_index);
-    auto t3 = point3(get<3>(atlas_rect->texture_coordinates), image_index);
+    auto const box_with_border = scale_from_center(box, atlas_rect.border_scale);
+    auto const image_index = floor_cast<uint32_t>(atlas_rect.position.z());
 
-    vertices.emplace_back(box_with_border.p0, clipping_rectangle, t0, colors.p0);
-    vertices.emplace_back(box_with_border.p1, clipping_rectangle, t1, colors.p1);
-    vertices.emplace_back(box_with_border.p2, clipping_rectangle, t2, colors.p2);
-    vertices.emplace_back(box_with_border.p3, clipping_rectangle, t3, colors.p3);
+    instances.emplace_back(box_with_border, clipping_rectangle, atlas_rect.texture_coordinates, image_index, colors);
     return glyph_was_added;
 }
 
+/** Place vertices for a filled path.
+ *
+ * The area of the path, with a border for the signed-distance, is divided
+ * in tiles that fit in the staging image. The image of each tile in the atlas
+ * has an extra border, so that the bi-linear interpolation along the edges
+ * of the quad of a tile samples the same pixels as the neighbouring tile.
+ *
+ *  +-------------------+
+ *  |    tile border    |
+ *  |  +-------------+  |
+ *  |  | quad / tile |  |
+ *  |  +-------------+  |
+ *  |                   |
+ *  O-------------------+
+ */
+inline void gfx_pipeline_SDF::device_shared::place_instances(
+    vector_span<instance>& instances,
+    aarectangle const& clipping_rectangle,
+    graphic_path const& path,
+    float z,
+    hi::color color) noexcept
+{
+    constexpr auto tile_border = 2.0f;
+    constexpr auto tile_size = static_cast<float>(pathTileWidth) - 2.0f * tile_border;
+
+    if (path.points.empty()) {
+        return;
+    }
+
+    // The tiles are aligned to the pixels of the window.
+    auto const bounding_box = path.boundingBox();
+    auto const left = std::floor(bounding_box.left()) - std::ceil(drawBorder);
+    auto const bottom = std::floor(bounding_box.bottom()) - std::ceil(drawBorder);
+    auto const width = std::ceil(bounding_box.right()) + std::ceil(drawBorder) - left;
+    auto const height = std::ceil(bounding_box.top()) + std::ceil(drawBorder) - bottom;
+    auto const num_columns = ceil_cast<std::size_t>(width / tile_size);
+    auto const num_rows = ceil_cast<std::size_t>(height / tile_size);
+    auto const num_tiles = num_columns * num_rows;
+
+    auto const tile_rectangle = [&](std::size_t i) {
+        auto const x = narrow_cast<float>(i % num_columns) * tile_size;
+        auto const y = narrow_cast<float>(i / num_columns) * tile_size;
+        return aarectangle{x, y, std::min(tile_size, width - x), std::min(tile_size, height - y)};
+    };
+
+    // The same path at another whole pixel position has the same image.
+    auto const image_path = translate2{-left, -bottom} * path;
+    auto const path_hash = std::hash<graphic_path>{}(image_path);
+
+    auto const place_tiles = [&] {
+        for (auto i = 0_uz; i != num_tiles; ++i) {
+            auto const it = path_tiles.find(atlas_key_type{{}, {}, path_hash, i});
+            if (it == path_tiles.end()) {
+                continue;
+            }
+
+            if (instances.full()) {
+                ++global_counter<"draw_path::overflow">;
+                return;
+            }
+
+            auto const& info = it->second;
+            atlas_allocator.touch(floor_cast<std::size_t>(info.position.z()));
+            auto const rectangle = tile_rectangle(i);
+            auto const box = translate2{left, bottom} * rectangle;
+            auto const texture_box = scale2{atlasTextureCoordinateMultiplier} *
+                aarectangle{info.position.x() + tile_border, info.position.y() + tile_border, rectangle.width(), rectangle.height()};
+
+            auto const image_index = floor_cast<uint32_t>(info.position.z());
+            instances.emplace_back(
+                quad{
+                    point3{box.left(), box.bottom(), z},
+                    point3{box.right(), box.bottom(), z},
+                    point3{box.left(), box.top(), z},
+                    point3{box.right(), box.top(), z}},
+                clipping_rectangle,
+                texture_box,
+                image_index,
+                quad_color{color});
+        }
+    };
+
+    auto const tiles_in_atlas = [&] {
+        for (auto i = 0_uz; i != num_tiles; ++i) {
+            if (not path_tiles.contains(atlas_key_type{{}, {}, path_hash, i})) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // A path that was drawn before is placed without waiting on the other draw threads.
+    {
+        auto const lock = std::shared_lock(atlas_mutex);
+        if (tiles_in_atlas()) [[likely]] {
+            place_tiles();
+            return;
+        }
+    }
+
+    auto const gfx_lock = std::scoped_lock(gfx_system_mutex);
+    auto const lock = std::scoped_lock(atlas_mutex);
+
+    auto curves = std::vector<bezier_curve>{};
+    auto num_rasterized = 0_uz;
+    for (auto i = 0_uz; i != num_tiles; ++i) {
+        auto const key = atlas_key_type{{}, {}, path_hash, i};
+        if (auto const it = path_tiles.find(key); it != path_tiles.end()) {
+            atlas_allocator.touch(floor_cast<std::size_t>(it->second.position.z()));
+            continue;
+        }
+
+        auto const image_rectangle = tile_rectangle(i) + tile_border;
+        auto const info = allocate_rect(key, image_rectangle.size(), scale2{1.0f, 1.0f});
+        if (not info) {
+            // The tile does not fit in the atlas, it will not be drawn.
+            continue;
+        }
+
+        if (curves.empty()) {
+            curves = image_path.getBeziers();
+        }
+
+        auto tile_curves = curves;
+        for (auto& curve : tile_curves) {
+            curve = translate2{-image_rectangle.left(), -image_rectangle.bottom()} * curve;
+        }
+
+        auto job = rasterize_job_type{key, 0, info};
+        job.image = pixmap<sdf_r8>{ceil_cast<std::size_t>(info.size.width()), ceil_cast<std::size_t>(info.size.height())};
+        fill(pixmap_span<sdf_r8>{job.image.data(), job.image.width(), job.image.height()}, tile_curves);
+
+        pending_glyphs[key] = info;
+        {
+            auto const rasterize_lock = std::scoped_lock(_rasterize_mutex);
+            _rasterized_glyphs.push_back(std::move(job));
+        }
+        ++num_rasterized;
+    }
+
+    if (num_rasterized != 0) {
+        ++global_counter<"gfx_pipeline_SDF:path:rasterize">;
+        upload_rasterized_glyphs();
+    }
+
+    place_tiles();
+}
+
 inline void gfx_pipeline_SDF::device_shared::drawInCommandBuffer(vk::CommandBuffer const& commandBuffer)
 {
     commandBuffer.bindIndexBuffer(device.quadIndexBuffer, 0, vk::IndexType::eUint16);
@@ -374,7 +799,8 @@ inline void gfx_pipeline_SDF::device_shared::drawInCommandBuffer(vk::CommandBuff
 inline void gfx_pipeline_SDF::device_shared::buildShaders()
 {
     specializationConstants.sdf_r8maxDistance = sdf_r8::max_distance;
-    specializationConstants.atlasImageWidth = atlasImageWidth;
+    specializationConstants.atlasImageWidth = narrow_cast<float>(atlasImageWidth);
+    specializationConstants.atlasNrImages = narrow_cast<int32_t>(atlasNrImages);
 
     fragmentShaderSpecializationMapEntries = specialization_constants::specializationConstantMapEntries();
     fragmentShaderSpecializationInfo = specializationConstants.specializationInfo(fragmentShaderSpecializationMapEntries);
@@ -408,7 +834,7 @@ inline void gfx_pipeline_SDF::device_shared::addAtlasImage()
         vk::ImageCreateFlags(),
         vk::ImageType::e2D,
         vk::Format::eR8Snorm,
-        vk::Extent3D(atlasImageWidth, atlasImageHeight, 1),
+        vk::Extent3D(atlasImageWidth, atlasImageWidth, 1),
         1, // mipLevels
         1, // arrayLayers
         vk::SampleCountFlagBits::e1,
@@ -424,7 +850,8 @@ inline void gfx_pipeline_SDF::device_shared::addAtlasImage()
     allocationCreateInfo.pUserData = const_cast<char *>(allocation_name.c_str());
     allocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
 
-    auto const[atlasImage, atlasImageAllocation] = device.createImage(imageCreateInfo, allocationCreateInfo);
+    auto const[atlasImage, atlasImageAllocation] =
+        device.createImage(imageCreateInfo, allocationCreateInfo, gfx_memory_category::glyph_atlas);
     device.setDebugUtilsObjectNameEXT(atlasImage, allocation_name.c_str());
 
     auto const clearValue = vk::ClearColorValue{std::array{-1.0f, -1.0f, -1.0f, -1.0f}};
@@ -450,14 +877,24 @@ inline void gfx_pipeline_SDF::device_shared::addAtlasImage()
 
     atlasTextures.push_back({atlasImage, atlasImageAllocation, atlasImageView});
 
+    auto& mirror = atlasMirror.emplace_back(atlasImageWidth, atlasImageWidth);
+    fill(mirror, sdf_r8{-sdf_r8::max_distance});
+
     // Build image descriptor info.
-    for (int i = 0; i < ssize(atlasDescriptorImageInfos); i++) {
-        // Point the descriptors to each imageView,
-        // repeat the first imageView if there are not enough.
-        atlasDescriptorImageInfos.at(i) = {
-            vk::Sampler(),
-            i < atlasTextures.size() ? atlasTextures.at(i).view : atlasTextures.at(0).view,
-            vk::ImageLayout::eShaderReadOnlyOptimal};
+    if (device.supportsBindlessImages) {
+        // Only the new image is written, the rest of the partially bound descriptor array stays unused.
+        atlasDescriptorImageInfos.emplace_back(vk::Sampler(), atlasImageView, vk::ImageLayout::eShaderReadOnlyOptimal);
+
+    } else {
+        atlasDescriptorImageInfos.resize(atlasNrImages);
+        for (auto i = 0_uz; i != atlasDescriptorImageInfos.size(); ++i) {
+            // Point the descriptors to each imageView,
+            // repeat the first imageView if there are not enough.
+            atlasDescriptorImageInfos[i] = {
+                vk::Sampler(),
+                i < atlasTextures.size() ? atlasTextures[i].view : atlasTextures.front().view,
+                vk::ImageLayout::eShaderReadOnlyOptimal};
+        }
     }
 }
 
@@ -482,7 +919,7 @@ inline void gfx_pipeline_SDF::device_shared::buildAtlas()
     allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
     allocationCreateInfo.pUserData = const_cast<char *>("sdf-pipeline staging image");
     allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-    auto const[image, allocation] = device.createImage(imageCreateInfo, allocationCreateInfo);
+    auto const[image, allocation] = device.createImage(imageCreateInfo, allocationCreateInfo, gfx_memory_category::glyph_atlas);
     device.setDebugUtilsObjectNameEXT(image, "sdf-pipeline staging image");
     auto const data = device.mapMemory<sdf_r8>(allocation);
 
@@ -528,12 +965,13 @@ inline void gfx_pipeline_SDF::device_shared::teardownAtlas(gfx_device const *vul
 
     for (const auto& atlasImage : atlasTextures) {
         vulkanDevice->destroy(atlasImage.view);
-        vulkanDevice->destroyImage(atlasImage.image, atlasImage.allocation);
+        vulkanDevice->destroyImage(atlasImage.image, atlasImage.allocation, gfx_memory_category::glyph_atlas);
     }
     atlasTextures.clear();
+    atlasDescriptorImageInfos.clear();
 
     vulkanDevice->unmapMemory(stagingTexture.allocation);
-    vulkanDevice->destroyImage(stagingTexture.image, stagingTexture.allocation);
+    vulkanDevice->destroyImage(stagingTexture.image, stagingTexture.allocation, gfx_memory_category::glyph_atlas);
 }
 
 }} // namespace hi::inline v1::gfx_pipeline_SDF
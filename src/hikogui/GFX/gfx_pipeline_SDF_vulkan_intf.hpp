@@ -5,14 +5,33 @@
 #pragma once
 
 #include "gfx_pipeline_vulkan_intf.hpp"
+#include "gfx_atlas_allocator.hpp"
+#include "gfx_system_globals.hpp"
+#include "sdf_glyph_cache.hpp"
 #include "../container/container.hpp"
 #include "../geometry/geometry.hpp"
 #include "../image/image.hpp"
 #include "../font/font.hpp"
+#include "../graphic_path/graphic_path.hpp"
+#include "../dispatch/dispatch.hpp"
 #include "../macros.hpp"
 #include <vulkan/vulkan.hpp>
 #include <vma/vk_mem_alloc.h>
 #include <span>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <atomic>
+#include <utility>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <thread>
+#include <stop_token>
 
 hi_export_module(hikogui.GFX : gfx_pipeline_SDF_intf);
 
@@ -23,40 +42,85 @@ hi_export namespace hi { inline namespace v1 {
  */
 class gfx_pipeline_SDF : public gfx_pipeline {
 public:
-    /*! A vertex defining a rectangle on a window.
-     * The vertex shader will convert window pixel-coordinates to normalized projection-coordinates.
+    /** An instance defining a glyph, or a tile of a path, on a window.
+     *
+     * Each glyph is drawn as a single instance of the first quad of the device's quad index buffer.
+     * The vertex shader selects the corner of the glyph from the vertex index, and converts
+     * window pixel-coordinates to normalized projection-coordinates.
      */
-    struct vertex {
-        //! The pixel-coordinates where the origin is located relative to the bottom-left corner of the window.
-        sfloat_rgb32 position;
+    struct alignas(16) instance {
+        /** The pixel-coordinates of the corners relative to the bottom-left corner of the window.
+         *
+         * The corners are in the order: bottom-left, bottom-right, top-left, top-right.
+         * (x, y) = first corner, (z, w) = second corner.
+         */
+        std::array<sfloat_rgba32, 2> corners;
 
         //! Clipping rectangle. (x,y)=bottom-left, (z,w)=top-right
-        sfloat_rgba32 clippingRectangle;
+        sfloat_rgba32 clipping_rectangle;
+
+        /** The rectangle inside the texture-atlas image, normalized to 16 bits.
+         *
+         * (x,y)=bottom-left, (z,w)=top-right
+         */
+        std::array<uint16_t, 4> texture_rectangle;
+
+        //! The depth of the glyph.
+        float z;
 
-        //! The x, y (relative to bottom-left) coordinate inside the texture-atlas, z is used as an index in the texture-atlas
-        //! array
-        sfloat_rgb32 textureCoord;
+        //! The index of the image in the texture-atlas.
+        uint32_t image_index;
 
-        //! The color of the glyph.
-        sfloat_rgba16 color;
+        //! The color of each corner of the glyph.
+        std::array<sfloat_rgba16, 4> colors;
 
-        vertex(point3 position, aarectangle clippingRectangle, point3 textureCoord, hi::color color) noexcept :
-            position(position), clippingRectangle(clippingRectangle), textureCoord(textureCoord), color(color)
+        instance(
+            quad const& box,
+            aarectangle const& clipping_rectangle,
+            aarectangle const& texture_rectangle,
+            uint32_t image_index,
+            quad_color const& colors) noexcept :
+            corners{
+                sfloat_rgba32{static_cast<f32x4>(box.p0).xy00() + static_cast<f32x4>(box.p1)._00xy()},
+                sfloat_rgba32{static_cast<f32x4>(box.p2).xy00() + static_cast<f32x4>(box.p3)._00xy()}},
+            clipping_rectangle(clipping_rectangle),
+            texture_rectangle(to_unorm16(texture_rectangle)),
+            z(box.p0.z()),
+            image_index(image_index),
+            colors{sfloat_rgba16{colors.p0}, sfloat_rgba16{colors.p1}, sfloat_rgba16{colors.p2}, sfloat_rgba16{colors.p3}}
         {
         }
 
         static vk::VertexInputBindingDescription inputBindingDescription()
         {
-            return {0, sizeof(vertex), vk::VertexInputRate::eVertex};
+            return {0, sizeof(instance), vk::VertexInputRate::eInstance};
         }
 
         static std::vector<vk::VertexInputAttributeDescription> inputAttributeDescriptions()
         {
             return {
-                {0, 0, vk::Format::eR32G32B32Sfloat, offsetof(vertex, position)},
-                {1, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(vertex, clippingRectangle)},
-                {2, 0, vk::Format::eR32G32B32Sfloat, offsetof(vertex, textureCoord)},
-                {3, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(vertex, color)}};
+                {0, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(instance, corners) + 0 * sizeof(sfloat_rgba32)},
+                {1, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(instance, corners) + 1 * sizeof(sfloat_rgba32)},
+                {2, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(instance, clipping_rectangle)},
+                {3, 0, vk::Format::eR16G16B16A16Unorm, offsetof(instance, texture_rectangle)},
+                {4, 0, vk::Format::eR32Sfloat, offsetof(instance, z)},
+                {5, 0, vk::Format::eR32Uint, offsetof(instance, image_index)},
+                {6, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, colors) + 0 * sizeof(sfloat_rgba16)},
+                {7, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, colors) + 1 * sizeof(sfloat_rgba16)},
+                {8, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, colors) + 2 * sizeof(sfloat_rgba16)},
+                {9, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, colors) + 3 * sizeof(sfloat_rgba16)},
+            };
+        }
+
+    private:
+        [[nodiscard]] static std::array<uint16_t, 4> to_unorm16(aarectangle const& rhs) noexcept
+        {
+            auto const v = static_cast<f32x4>(rhs);
+            auto r = std::array<uint16_t, 4>{};
+            for (auto i = 0_uz; i != 4; ++i) {
+                r[i] = static_cast<uint16_t>(std::round(std::clamp(v[i], 0.0f, 1.0f) * 65535.0f));
+            }
+            return r;
         }
     };
 
@@ -76,6 +140,7 @@ public:
     struct specialization_constants {
         float sdf_r8maxDistance;
         float atlasImageWidth;
+        int32_t atlasNrImages;
 
         [[nodiscard]] vk::SpecializationInfo specializationInfo(std::vector<vk::SpecializationMapEntry>& entries) const noexcept
         {
@@ -87,6 +152,7 @@ public:
             return {
                 {0, offsetof(specialization_constants, sdf_r8maxDistance), sizeof(sdf_r8maxDistance)},
                 {1, offsetof(specialization_constants, atlasImageWidth), sizeof(atlasImageWidth)},
+                {2, offsetof(specialization_constants, atlasNrImages), sizeof(atlasNrImages)},
             };
         }
     };
@@ -103,24 +169,94 @@ public:
 
     struct device_shared {
         // Studies in China have shown that literate individuals know and use between 3,000 and 4,000 characters.
-        // Handle up to 7 * 7 * 128 == 6321 characters with a 16 x 1024 x 1024, 16 x 1 MByte
+        // A 1024 x 1024 atlas image holds about 30 * 30 == 900 characters of 34 x 34 pixels, the atlas
+        // grows up to 16 of these images. When the atlas is full the least recently used image is evicted.
         //
-        // For latin characters we can store about 7 * 12 == 84 characters in a single image, which is enough
-        // for the full alpha numeric range that an application will use.
+        // For latin characters we can store about 7 * 12 == 84 characters in a single 256 x 256 image, which
+        // is enough for the full alpha numeric range that an application will use.
 
-        constexpr static int atlasImageWidth = 256; // 7-12 characters, of 34 pixels wide.
-        constexpr static int atlasImageHeight = 256; // 7 characters, of 34 pixels height.
-        static_assert(atlasImageWidth == atlasImageHeight, "needed for fwidth(textureCoord)");
+        constexpr static uint32_t atlasMinimumImageWidth = 256; // 7-12 characters, of 34 pixels wide.
+        constexpr static uint32_t atlasMaximumImageWidth = 1024; // 30 characters, of 34 pixels wide.
+        constexpr static std::size_t atlasMaximumNrTexels = 16 * 1024 * 1024; // 16 MByte.
 
-        constexpr static int atlasMaximumNrImages = 128; // 128 * 49 characters.
-        constexpr static int stagingImageWidth = 64; // One 'em' is 28 pixels, with edges 34 pixels.
-        constexpr static int stagingImageHeight = 64;
+        constexpr static int atlasMaximumNrImages = 128; // Size of the descriptor array without bindless images.
+        // One 'em' is 28 pixels, with edges 34 pixels. The staging image holds a batch of about 7 * 7 glyphs.
+        constexpr static int stagingImageWidth = 256;
+        constexpr static int stagingImageHeight = 256;
 
-        constexpr static float atlasTextureCoordinateMultiplier = 1.0f / atlasImageWidth;
         constexpr static float drawfontSize = 28.0f;
         constexpr static float drawBorder = sdf_r8::max_distance;
         constexpr static float scaledDrawBorder = drawBorder / drawfontSize;
 
+        /** The largest width and height in pixels of a tile of a path in the atlas, including its border.
+         *
+         * Each tile must fit in the staging image.
+         */
+        constexpr static uint32_t pathTileWidth = stagingImageWidth;
+
+        /** The key of an image in the atlas.
+         *
+         * A glyph is identified by its font and glyph-id. A tile of a path, see
+         * `place_instances()`, has an empty font and is identified by the hash of
+         * the path and the index of the tile.
+         */
+        struct atlas_key_type {
+            hi::font_id font = {};
+            glyph_id glyph = {};
+            std::size_t path_hash = 0;
+            std::size_t path_tile = 0;
+
+            [[nodiscard]] constexpr friend auto operator<=>(atlas_key_type const&, atlas_key_type const&) noexcept = default;
+        };
+
+        /** A glyph that is rasterized by one of the rasterizer threads.
+         *
+         * Tiles of paths are rasterized by the thread that draws them, and are
+         * uploaded to the atlas in the same way as glyphs.
+         */
+        struct rasterize_job_type {
+            atlas_key_type key;
+
+            /** The hash of the font file, used as the key in the glyph cache.
+             */
+            uint64_t font_hash = 0;
+
+            /** The location in the atlas, allocated before rasterization.
+             */
+            glyph_atlas_info info;
+
+            /** The path of the glyph, scaled and translated to the image.
+             */
+            graphic_path path;
+
+            /** The rasterized signed-distance-field.
+             */
+            pixmap<sdf_r8> image = {};
+        };
+
+        /** Notified from a rasterizer thread when glyphs are ready to be uploaded.
+         *
+         * Windows should redraw after this notification, the glyphs are uploaded
+         * to the atlas at the start of the next frame.
+         */
+        static inline notifier<void()> glyphs_rasterized;
+
+        /** Use a glyph cache file in the application's data directory.
+         *
+         * Rasterized glyphs are stored in the cache file when the device is
+         * destroyed, so that they do not need to be rasterized again when the
+         * application is started next time.
+         *
+         * @note Must be set before the first window is created.
+         */
+        static inline bool glyph_cache_enabled = false;
+
+        /** Cache of rasterized glyphs shared between runs of the application.
+         *
+         * nullptr when `glyph_cache_enabled` is false.
+         */
+        std::unique_ptr<sdf_glyph_cache> glyph_cache;
+
         gfx_device const& device;
 
         vk::ShaderModule vertexShaderModule;
@@ -134,13 +270,73 @@ public:
         texture_map stagingTexture;
         std::vector<texture_map> atlasTextures;
 
-        std::array<vk::DescriptorImageInfo, atlasMaximumNrImages> atlasDescriptorImageInfos;
+        /** The descriptors of the atlas images.
+         *
+         * With bindless images there is a descriptor for each atlas image, otherwise
+         * there are `atlasNrImages` descriptors, repeating the first atlas image.
+         */
+        std::vector<vk::DescriptorImageInfo> atlasDescriptorImageInfos;
         vk::Sampler atlasSampler;
         vk::DescriptorImageInfo atlasSamplerDescriptorImageInfo;
 
-        point3 atlas_allocation_position = {};
-        /// During allocation on a row, we keep track of the tallest glyph.
-        int atlasAllocationMaxHeight = 0;
+        /** The width and height of each atlas image.
+         *
+         * The width and height must be equal, needed for fwidth(textureCoord).
+         */
+        uint32_t atlasImageWidth = atlasMinimumImageWidth;
+        float atlasTextureCoordinateMultiplier = 1.0f / atlasMinimumImageWidth;
+
+        /** The maximum number of atlas images, and the size of the descriptor array.
+         */
+        std::size_t atlasNrImages = 1;
+
+        /** The lock of the atlas.
+         *
+         * Protects the `atlas_allocator`, `pending_glyphs`, `path_tiles` and the
+         * glyph table of each font for this device, see `font::atlas_info()`.
+         *
+         * Glyphs are looked up with a shared lock, so that widgets that are drawn
+         * in parallel do not wait on each other. An exclusive lock is only taken
+         * when a glyph or path is added to the atlas, in that case `gfx_system_mutex`
+         * is locked first, since the atlas may need a new Vulkan image.
+         */
+        mutable std::shared_mutex atlas_mutex;
+
+        gfx_atlas_allocator<atlas_key_type> atlas_allocator;
+
+        /** Stops the atlas from growing while the memory of the device is running low.
+         */
+        notifier<void(std::size_t)>::callback_type memory_pressure_cbt;
+
+        /** Incremented each time glyphs are evicted from the atlas.
+         *
+         * Vertices that are retained between frames must be redrawn when
+         * the generation has changed.
+         */
+        std::atomic<std::size_t> atlas_generation = 0;
+
+        /** Glyphs that have a location in the atlas, but are not yet uploaded.
+         *
+         * Access is protected by `atlas_mutex`.
+         */
+        std::map<atlas_key_type, glyph_atlas_info> pending_glyphs;
+
+        /** The location in the atlas of the tiles of paths.
+         *
+         * Access is protected by `atlas_mutex`.
+         */
+        std::map<atlas_key_type, glyph_atlas_info> path_tiles;
+
+        /** A copy of the atlas images in CPU memory.
+         *
+         * Used to seed the atlas of another device when a surface is moved
+         * to that device, so that the glyphs do not need to be rasterized again.
+         * The mirror is kept when the Vulkan objects are destroyed, so that the
+         * atlas can be restored after the device was lost.
+         *
+         * Access is protected by `gfx_system_mutex`.
+         */
+        std::vector<pixmap<sdf_r8>> atlasMirror;
 
         device_shared(gfx_device const& device);
         ~device_shared();
@@ -155,17 +351,98 @@ public:
          */
         void destroy(gfx_device const *vulkanDevice);
 
-        /** Allocate an glyph in the atlas.
-         * This may allocate an atlas texture, up to atlasMaximumNrImages.
+        /** Allocate an glyph or tile of a path in the atlas.
+         *
+         * This may allocate an atlas texture, or evict the least recently used
+         * atlas texture when the maximum number of atlas textures is reached.
+         *
+         * @pre `gfx_system_mutex` must be locked, and `atlas_mutex` must be locked exclusively.
+         * @return The location of the glyph in the atlas, or empty when the glyph does not fit.
+         */
+        [[nodiscard]] glyph_atlas_info allocate_rect(atlas_key_type const& key, extent2 draw_extent, scale2 draw_scale) noexcept;
+
+        /** The fraction of the maximum size of the atlas that is allocated.
+         */
+        [[nodiscard]] float atlas_occupancy() const noexcept
+        {
+            auto const lock = std::shared_lock(atlas_mutex);
+            return atlas_allocator.occupancy();
+        }
+
+        /** Copy the atlas of the same pipeline on another device.
+         *
+         * The atlas images are uploaded from the CPU-side mirror of @a other,
+         * and the location of each glyph is copied to the slot of this device.
+         * Nothing is copied when this atlas is already in use or has a different
+         * layout.
+         *
+         * @pre `gfx_system_mutex` must be locked.
+         * @param other The pipeline of the device that the surface used before,
+         *              or of this device before it was lost.
+         * @return True if the atlas was copied.
+         */
+        bool copy_atlas_from(device_shared const& other) noexcept;
+
+        /** Start a new frame of a surface.
+         *
+         * The glyphs that have been rasterized since the previous frame are
+         * uploaded to the atlas in a single batch.
+         *
+         * The atlas is shared by the surfaces of the device, its least recently used
+         * pages are tracked by frames of the device, see `gfx_device::start_surface_frame()`.
+         * Atlas textures used during the current frame of the device will not be evicted.
+         *
+         * @param new_device_frame This surface frame starts a new frame of the device.
+         */
+        void next_frame(bool new_device_frame) noexcept;
+
+        /** The distinct atlas pages used by instances.
+         *
+         * @param instances The glyph instances that are retained between frames.
+         * @return The sorted indices of the atlas pages.
+         */
+        template<typename Range>
+        [[nodiscard]] static std::vector<uint32_t> atlas_pages(Range const& instances) noexcept
+        {
+            auto r = std::vector<uint32_t>{};
+            for (auto const& instance : instances) {
+                r.push_back(instance.image_index);
+            }
+            std::ranges::sort(r);
+            auto const [first, last] = std::ranges::unique(r);
+            r.erase(first, last);
+            return r;
+        }
+
+        /** Mark atlas pages as used in the current frame.
+         *
+         * Retained instances are replayed without looking up their glyphs in the atlas,
+         * see `draw_text_cache` and `draw_context_cache`. Touching their pages stops the
+         * pages from being evicted as least recently used while they are still on screen.
+         *
+         * @param pages The pages returned by `atlas_pages()`.
          */
-        [[nodiscard]] glyph_atlas_info allocate_rect(extent2 draw_extent, scale2 draw_scale) noexcept;
+        void touch_atlas_pages(std::span<uint32_t const> pages) noexcept
+        {
+            if (pages.empty()) {
+                return;
+            }
+
+            auto const lock = std::shared_lock(atlas_mutex);
+            for (auto const page : pages) {
+                atlas_allocator.touch(page);
+            }
+        }
 
         void drawInCommandBuffer(vk::CommandBuffer const& commandBuffer);
 
         /** Once drawing in the staging pixmap is completed, you can upload it to the atlas.
          * This will transition the stating texture to 'source' and the atlas to 'destination'.
+         *
+         * @param regions_per_atlas_texture The regions to copy from the staging pixmap, for each atlas texture.
+         *                                  The regions are cleared after the upload.
          */
-        void uploadStagingPixmapToAtlas(glyph_atlas_info const& location);
+        void uploadStagingPixmapToAtlas(std::vector<std::vector<vk::ImageCopy>>& regions_per_atlas_texture);
 
         /** This will transition the staging texture to 'general' for writing by the CPU.
          */
@@ -175,51 +452,124 @@ public:
          */
         void prepare_atlas_for_rendering();
 
-        /** Place vertices for a single glyph.
+        /** Place an instance for a single glyph.
          *
-         * @param vertices The list of vertices to add to.
+         * @param instances The list of instances to add to.
          * @param clipping_rectangle The rectangle to clip the glyph.
          * @param box The rectangle of the glyph in window coordinates. The box's size must be the size
          *            of the glyph's bounding box times @a glyph_size.
          * @param glyphs The font-id, composed-glyphs to render
          * @param colors The color of each corner of the glyph.
-         * @return True is atlas was updated.
+         * @return True is atlas was updated. No instance is added if the glyph is not yet in the atlas.
          */
-        bool place_vertices(
-            vector_span<vertex>& vertices,
+        bool place_instance(
+            vector_span<instance>& instances,
             aarectangle const& clipping_rectangle,
             quad const& box,
             hi::font_id font,
             glyph_id glyph,
             quad_color colors) noexcept;
 
+        /** Place instances for a filled path.
+         *
+         * The path is split into tiles which are rasterized as signed-distance-fields
+         * into the atlas, by the calling thread, the first time the path is drawn.
+         * After that the path is drawn from the atlas until it is evicted.
+         *
+         * Paths are identified by their shape and their position relative to the pixels
+         * of the window, so a path that is moved by whole pixels is not rasterized again.
+         *
+         * @param instances The list of instances to add to, one for each tile.
+         * @param clipping_rectangle The rectangle to clip the path.
+         * @param path The path in window coordinates, without layers.
+         * @param z The depth of the path.
+         * @param color The color of the path.
+         */
+        void place_instances(
+            vector_span<instance>& instances,
+            aarectangle const& clipping_rectangle,
+            graphic_path const& path,
+            float z,
+            hi::color color) noexcept;
+
     private:
         void buildShaders();
         void teardownShaders(gfx_device const *vulkanDevice);
         void addAtlasImage();
         void buildAtlas();
         void teardownAtlas(gfx_device const *vulkanDevice);
+
+        /** Add a glyph to the atlas and let a rasterizer thread draw it.
+         *
+         * @pre `gfx_system_mutex` must be locked, and `atlas_mutex` must be locked exclusively.
+         */
         void add_glyph_to_atlas(hi::font_id font, glyph_id glyph, glyph_atlas_info& info) noexcept;
 
-        /**
+        /** Upload the glyphs that were rasterized by the rasterizer threads.
+         *
+         * @pre `gfx_system_mutex` must be locked, and `atlas_mutex` must be locked exclusively.
+         */
+        void upload_rasterized_glyphs() noexcept;
+
+        void build_rasterizer();
+        void teardown_rasterizer();
+        void rasterizer_thread_main(std::stop_token stop_token) noexcept;
+
+        std::mutex _rasterize_mutex;
+        std::condition_variable_any _rasterize_cv;
+        std::deque<rasterize_job_type> _rasterize_queue;
+        std::vector<rasterize_job_type> _rasterized_glyphs;
+        std::vector<std::jthread> _rasterizer_threads;
+
+        /** Find a glyph in the atlas, or add it.
+         *
+         * Widgets may be drawn on several threads, see `draw_context::draw_parallel()`.
+         * A glyph that is already in the atlas is found with a shared lock on
+         * `atlas_mutex`, the location is returned by value since it may be
+         * evicted as soon as the lock is released.
+         *
          * @return The Atlas rectangle and true if a new glyph was added to the atlas.
+         *         The atlas rectangle is empty while the glyph is being rasterized.
          */
-        hi_force_inline std::pair<glyph_atlas_info const *, bool>
-        get_glyph_from_atlas(hi::font_id font, glyph_id glyph) noexcept
+        hi_force_inline std::pair<glyph_atlas_info, bool> get_glyph_from_atlas(hi::font_id font, glyph_id glyph) noexcept
         {
-            auto& info = font->atlas_info(glyph);
+            {
+                auto const lock = std::shared_lock(atlas_mutex);
+                if (auto const info = font->find_atlas_info(glyph, device.index)) [[likely]] {
+                    atlas_allocator.touch(floor_cast<std::size_t>(info.position.z()));
+                    return {info, false};
+                }
+            }
 
-            if (info) [[likely]] {
-                return {&info, false};
+            auto const gfx_lock = std::scoped_lock(gfx_system_mutex);
+            auto const lock = std::scoped_lock(atlas_mutex);
 
-            } else {
-                add_glyph_to_atlas(font, glyph, info);
-                return {&info, true};
+            // Another thread may have added the glyph while no lock was held.
+            auto& info = font->atlas_info(glyph, device.index);
+            if (info) {
+                atlas_allocator.touch(floor_cast<std::size_t>(info.position.z()));
+                return {info, false};
             }
+
+            add_glyph_to_atlas(font, glyph, info);
+            return {info, true};
         }
     };
 
-    vector_span<vertex> vertexBufferData;
+    vector_span<instance> vertexBufferData;
+
+    /** Use a region of the surface's vertex ring for the glyph instances of the next frame.
+     *
+     * @param buffer The vertex ring buffer.
+     * @param offset The offset in bytes of the region in the buffer.
+     * @param data The persistently mapped memory of the region.
+     */
+    void set_vertex_buffer(vk::Buffer buffer, vk::DeviceSize offset, std::span<instance> data) noexcept
+    {
+        vertexBuffer = buffer;
+        vertexBufferOffset = offset;
+        vertexBufferData = vector_span<instance>{data};
+    }
 
     ~gfx_pipeline_SDF() = default;
     gfx_pipeline_SDF(const gfx_pipeline_SDF&) = delete;
@@ -236,20 +586,17 @@ private:
     int numberOfAtlasImagesInDescriptor = 0;
 
     vk::Buffer vertexBuffer;
-    VmaAllocation vertexBufferAllocation;
+    vk::DeviceSize vertexBufferOffset = 0;
 
     [[nodiscard]] std::vector<vk::PipelineShaderStageCreateInfo> createShaderStages() const override;
     [[nodiscard]] std::vector<vk::DescriptorSetLayoutBinding> createDescriptorSetLayoutBindings() const override;
     [[nodiscard]] std::vector<vk::WriteDescriptorSet> createWriteDescriptorSet() const override;
     [[nodiscard]] size_t getDescriptorSetVersion() const override;
+    [[nodiscard]] std::vector<vk::DescriptorBindingFlags> createDescriptorSetLayoutBindingFlags() const override;
     [[nodiscard]] std::vector<vk::PushConstantRange> createPushConstantRanges() const override;
     [[nodiscard]] vk::VertexInputBindingDescription createVertexInputBindingDescription() const override;
     [[nodiscard]] std::vector<vk::VertexInputAttributeDescription> createVertexInputAttributeDescriptions() const override;
     [[nodiscard]] std::vector<vk::PipelineColorBlendAttachmentState> getPipelineColorBlendAttachmentStates() const override;
-
-private:
-    void build_vertex_buffers() override;
-    void teardown_vertex_buffers() override;
 };
 
 }} // namespace hi
@@ -19,10 +19,9 @@ inline void gfx_pipeline_box::draw_in_command_buffer(vk::CommandBuffer commandBu
     gfx_pipeline::draw_in_command_buffer(commandBuffer, context);
 
     hi_axiom_not_null(device());
-    device()->flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof(vertex));
 
     std::vector<vk::Buffer> tmpvertexBuffers = {vertexBuffer};
-    std::vector<vk::DeviceSize> tmpOffsets = {0};
+    std::vector<vk::DeviceSize> tmpOffsets = {vertexBufferOffset};
     hi_assert(tmpvertexBuffers.size() == tmpOffsets.size());
 
     device()->box_pipeline->drawInCommandBuffer(commandBuffer);
@@ -38,11 +37,11 @@ inline void gfx_pipeline_box::draw_in_command_buffer(vk::CommandBuffer commandBu
         sizeof(push_constants),
         &pushConstants);
 
-    auto const numberOfRectangles = vertexBufferData.size() / 4;
-    auto const numberOfTriangles = numberOfRectangles * 2;
+    auto const numberOfBoxes = vertexBufferData.size();
 
+    // Draw the first quad of the quad index buffer for each box instance.
     device()->cmdBeginDebugUtilsLabelEXT(commandBuffer, "draw boxes");
-    commandBuffer.drawIndexed(narrow_cast<uint32_t>(numberOfTriangles * 3), 1, 0, 0, 0);
+    commandBuffer.drawIndexed(6, narrow_cast<uint32_t>(numberOfBoxes), 0, 0, 0);
     device()->cmdEndDebugUtilsLabelEXT(commandBuffer);
 }
 
@@ -74,40 +73,12 @@ inline std::vector<vk::PushConstantRange> gfx_pipeline_box::createPushConstantRa
 
 inline vk::VertexInputBindingDescription gfx_pipeline_box::createVertexInputBindingDescription() const
 {
-    return vertex::inputBindingDescription();
+    return instance::inputBindingDescription();
 }
 
 inline std::vector<vk::VertexInputAttributeDescription> gfx_pipeline_box::createVertexInputAttributeDescriptions() const
 {
-    return vertex::inputAttributeDescriptions();
-}
-
-inline void gfx_pipeline_box::build_vertex_buffers()
-{
-    using vertexIndexType = uint16_t;
-    constexpr ssize_t numberOfVertices = 1 << (sizeof(vertexIndexType) * CHAR_BIT);
-
-    vk::BufferCreateInfo const bufferCreateInfo = {
-        vk::BufferCreateFlags(),
-        sizeof(vertex) * numberOfVertices,
-        vk::BufferUsageFlagBits::eVertexBuffer,
-        vk::SharingMode::eExclusive};
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
-    allocationCreateInfo.pUserData = const_cast<char *>("box-pipeline vertex buffer");
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-
-    hi_axiom_not_null(device());
-    std::tie(vertexBuffer, vertexBufferAllocation) = device()->createBuffer(bufferCreateInfo, allocationCreateInfo);
-    device()->setDebugUtilsObjectNameEXT(vertexBuffer, "box-pipeline vertex buffer");
-    vertexBufferData = device()->mapMemory<vertex>(vertexBufferAllocation);
-}
-
-inline void gfx_pipeline_box::teardown_vertex_buffers()
-{
-    hi_axiom_not_null(device());
-    device()->unmapMemory(vertexBufferAllocation);
-    device()->destroyBuffer(vertexBuffer, vertexBufferAllocation);
+    return instance::inputAttributeDescriptions();
 }
 
 inline gfx_pipeline_box::device_shared::device_shared(gfx_device const &device) : device(device)
@@ -128,8 +99,8 @@ inline void gfx_pipeline_box::device_shared::drawInCommandBuffer(vk::CommandBuff
     commandBuffer.bindIndexBuffer(device.quadIndexBuffer, 0, vk::IndexType::eUint16);
 }
 
-inline void gfx_pipeline_box::device_shared::place_vertices(
-    vector_span<vertex> &vertices,
+inline void gfx_pipeline_box::device_shared::place_instance(
+    vector_span<instance> &instances,
     aarectangle clipping_rectangle,
     quad box,
     quad_color fill_colors,
@@ -143,25 +114,24 @@ inline void gfx_pipeline_box::device_shared::place_vertices(
     auto const extra_space = (line_width * 0.5f) + 1.0f;
     auto const[box_, lengths] = expand_and_edge_hypots(box, extent2{extra_space, extra_space});
 
-    // t0-t3 are used inside the shader to determine how far from the corner
-    // a certain fragment is.
-    //
-    // x = Number of pixels from the right edge.
-    // y = Number of pixels above the bottom edge.
-    // z = Number of pixels from the left edge.
-    // w = Number of pixels below the top edge.
-    auto const t0 = sfloat_rgba32{lengths._00xy()};
-    auto const t1 = sfloat_rgba32{lengths.x00w()};
-    auto const t2 = sfloat_rgba32{lengths._0yz0()};
-    auto const t3 = sfloat_rgba32{lengths.zw00()};
-
-    auto const clipping_rectangle_ = sfloat_rgba32{clipping_rectangle};
-    auto const corner_radii_ = sfloat_rgba32{corner_radii};
-
-    vertices.emplace_back(box_.p0, clipping_rectangle_, t0, corner_radii_, fill_colors.p0, line_colors.p0, line_width);
-    vertices.emplace_back(box_.p1, clipping_rectangle_, t1, corner_radii_, fill_colors.p1, line_colors.p1, line_width);
-    vertices.emplace_back(box_.p2, clipping_rectangle_, t2, corner_radii_, fill_colors.p2, line_colors.p2, line_width);
-    vertices.emplace_back(box_.p3, clipping_rectangle_, t3, corner_radii_, fill_colors.p3, line_colors.p3, line_width);
+    // The lengths of the edges are used inside the shader to determine
+    // how far from the corner a certain fragment is.
+    auto p0 = f32x4{box_.p0};
+    p0.w() = line_width;
+
+    instances.push_back(instance{
+        {sfloat_rgba32{p0}, sfloat_rgba32{box_.p1}, sfloat_rgba32{box_.p2}, sfloat_rgba32{box_.p3}},
+        sfloat_rgba32{clipping_rectangle},
+        sfloat_rgba32{lengths},
+        sfloat_rgba32{corner_radii},
+        {sfloat_rgba16{fill_colors.p0},
+         sfloat_rgba16{fill_colors.p1},
+         sfloat_rgba16{fill_colors.p2},
+         sfloat_rgba16{fill_colors.p3}},
+        {sfloat_rgba16{line_colors.p0},
+         sfloat_rgba16{line_colors.p1},
+         sfloat_rgba16{line_colors.p2},
+         sfloat_rgba16{line_colors.p3}}});
 }
 
 inline void gfx_pipeline_box::device_shared::buildShaders()
@@ -13,6 +13,7 @@
 #include <vulkan/vulkan.hpp>
 #include <vma/vk_mem_alloc.h>
 #include <span>
+#include <array>
 
 hi_export_module(hikogui.GFX : gfx_pipeline_box_intf);
 
@@ -22,75 +23,70 @@ hi_export namespace hi { inline namespace v1 {
  */
 class gfx_pipeline_box : public gfx_pipeline {
 public:
-    /*! A vertex defining a rectangle on a window.
-     * The vertex shader will convert window pixel-coordinates to normalized projection-coordinates.
+    /** An instance defining a box on a window.
+     *
+     * Each box is drawn as a single instance of the first quad of the device's quad index buffer.
+     * The vertex shader selects the corner of the box from the vertex index, and converts
+     * window pixel-coordinates to normalized projection-coordinates.
      */
-    struct alignas(16) vertex {
-        /** The pixel-coordinates where the origin is located relative to the bottom-left corner of the window.
+    struct alignas(16) instance {
+        /** The pixel-coordinates of the corners relative to the bottom-left corner of the window.
+         *
+         * The corners are in the order: bottom-left, bottom-right, top-left, top-right.
+         * The w-component of the first corner is the line width.
          */
-        sfloat_rgba32 position;
+        std::array<sfloat_rgba32, 4> corners;
 
         /** The position in pixels of the clipping rectangle relative to the bottom-left corner of the window, and extent in
          * pixels.
          */
         sfloat_rgba32 clipping_rectangle;
 
-        /** Double 2D coordinates inside the quad, used to determine the distance from the sides and corner inside the fragment
-         * shader. x = Number of pixels to the right from the left edge of the quad. y = Number of pixels above the bottom edge. z
-         * = Number of pixels to the left from the right edge of the quad. w = Number of pixels below the top edge.
+        /** The length in pixels of the edges of the quad, including the extra space for the border and anti-aliasing.
+         *
+         * x = top edge, y = left edge, z = bottom edge, w = right edge.
          *
-         * The rasteriser will interpolate these numbers, so that inside the fragment shader
-         * the distance from a corner can be determined easily.
+         * The vertex shader derives the distances from the sides for each corner from these lengths, the
+         * rasteriser will interpolate these distances, so that inside the fragment shader the distance
+         * from a corner can be determined easily.
          */
-        sfloat_rgba32 corner_coordinate;
+        sfloat_rgba32 edge_lengths;
 
         /** Shape of each corner, negative values are cut corners, positive values are rounded corners.
          */
         sfloat_rgba32 corner_radii;
 
-        /** background color of the box.
+        /** background color of each corner of the box.
          */
-        sfloat_rgba16 fill_color;
+        std::array<sfloat_rgba16, 4> fill_colors;
 
-        /** border color of the box.
+        /** border color of each corner of the box.
          */
-        sfloat_rgba16 line_color;
-
-        float line_width;
-
-        vertex(
-            sfloat_rgba32 position,
-            sfloat_rgba32 clipping_rectangle,
-            sfloat_rgba32 corner_coordinate,
-            sfloat_rgba32 corner_radii,
-            sfloat_rgba16 fill_color,
-            sfloat_rgba16 line_color,
-            float line_width) noexcept :
-            position(position),
-            clipping_rectangle(clipping_rectangle),
-            corner_coordinate(corner_coordinate),
-            corner_radii(corner_radii),
-            fill_color(fill_color),
-            line_color(line_color),
-            line_width(line_width)
-        {
-        }
+        std::array<sfloat_rgba16, 4> line_colors;
 
         static vk::VertexInputBindingDescription inputBindingDescription()
         {
-            return {0, sizeof(vertex), vk::VertexInputRate::eVertex};
+            return {0, sizeof(instance), vk::VertexInputRate::eInstance};
         }
 
         static std::vector<vk::VertexInputAttributeDescription> inputAttributeDescriptions()
         {
             return {
-                {0, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(vertex, position)},
-                {1, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(vertex, clipping_rectangle)},
-                {2, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(vertex, corner_coordinate)},
-                {3, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(vertex, corner_radii)},
-                {4, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(vertex, fill_color)},
-                {5, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(vertex, line_color)},
-                {6, 0, vk::Format::eR32Sfloat, offsetof(vertex, line_width)},
+                {0, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(instance, corners) + 0 * sizeof(sfloat_rgba32)},
+                {1, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(instance, corners) + 1 * sizeof(sfloat_rgba32)},
+                {2, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(instance, corners) + 2 * sizeof(sfloat_rgba32)},
+                {3, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(instance, corners) + 3 * sizeof(sfloat_rgba32)},
+                {4, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(instance, clipping_rectangle)},
+                {5, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(instance, edge_lengths)},
+                {6, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(instance, corner_radii)},
+                {7, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, fill_colors) + 0 * sizeof(sfloat_rgba16)},
+                {8, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, fill_colors) + 1 * sizeof(sfloat_rgba16)},
+                {9, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, fill_colors) + 2 * sizeof(sfloat_rgba16)},
+                {10, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, fill_colors) + 3 * sizeof(sfloat_rgba16)},
+                {11, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, line_colors) + 0 * sizeof(sfloat_rgba16)},
+                {12, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, line_colors) + 1 * sizeof(sfloat_rgba16)},
+                {13, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, line_colors) + 2 * sizeof(sfloat_rgba16)},
+                {14, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(instance, line_colors) + 3 * sizeof(sfloat_rgba16)},
             };
         }
     };
@@ -127,8 +123,8 @@ public:
 
         void drawInCommandBuffer(vk::CommandBuffer const& commandBuffer);
 
-        static void place_vertices(
-            vector_span<vertex>& vertices,
+        static void place_instance(
+            vector_span<instance>& instances,
             aarectangle clipping_rectangle,
             quad box,
             quad_color fill_colors,
@@ -141,7 +137,20 @@ public:
         void teardownShaders(gfx_device const *vulkanDevice);
     };
 
-    vector_span<vertex> vertexBufferData;
+    vector_span<instance> vertexBufferData;
+
+    /** Use a region of the surface's vertex ring for the box instances of the next frame.
+     *
+     * @param buffer The vertex ring buffer.
+     * @param offset The offset in bytes of the region in the buffer.
+     * @param data The persistently mapped memory of the region.
+     */
+    void set_vertex_buffer(vk::Buffer buffer, vk::DeviceSize offset, std::span<instance> data) noexcept
+    {
+        vertexBuffer = buffer;
+        vertexBufferOffset = offset;
+        vertexBufferData = vector_span<instance>{data};
+    }
 
     ~gfx_pipeline_box() = default;
     gfx_pipeline_box(const gfx_pipeline_box&) = delete;
@@ -157,7 +166,7 @@ protected:
     push_constants pushConstants;
 
     vk::Buffer vertexBuffer;
-    VmaAllocation vertexBufferAllocation;
+    vk::DeviceSize vertexBufferOffset = 0;
 
     [[nodiscard]] std::vector<vk::PipelineShaderStageCreateInfo> createShaderStages() const override;
     [[nodiscard]] std::vector<vk::DescriptorSetLayoutBinding> createDescriptorSetLayoutBindings() const override;
@@ -166,10 +175,6 @@ protected:
     [[nodiscard]] std::vector<vk::PushConstantRange> createPushConstantRanges() const override;
     [[nodiscard]] vk::VertexInputBindingDescription createVertexInputBindingDescription() const override;
     [[nodiscard]] std::vector<vk::VertexInputAttributeDescription> createVertexInputAttributeDescriptions() const override;
-
-private:
-    void build_vertex_buffers() override;
-    void teardown_vertex_buffers() override;
 };
 
 }} // namespace hi::v1
@@ -8,6 +8,8 @@
 #include "gfx_device_vulkan_impl.hpp"
 #include "../macros.hpp"
 #include <vulkan/vulkan.hpp>
+#include <algorithm>
+#include <limits>
 
 hi_export_module(hikogui.GFX : gfx_pipeline_image_impl);
 
@@ -15,14 +17,15 @@ hi_export namespace hi { inline namespace v1 {
 
 inline void gfx_pipeline_image::draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const& context)
 {
-    gfx_pipeline::draw_in_command_buffer(commandBuffer, context);
+    if (vertexBufferData.empty()) {
+        // Nothing to draw, the pipeline is compiled lazily on first use.
+        return;
+    }
 
-    hi_axiom_not_null(device());
-    device()->flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof(vertex));
-    device()->image_pipeline->prepare_atlas_for_rendering();
+    gfx_pipeline::draw_in_command_buffer(commandBuffer, context);
 
     std::vector<vk::Buffer> tmpvertexBuffers = {vertexBuffer};
-    std::vector<vk::DeviceSize> tmpOffsets = {0};
+    std::vector<vk::DeviceSize> tmpOffsets = {vertexBufferOffset};
     hi_assert(tmpvertexBuffers.size() == tmpOffsets.size());
 
     device()->image_pipeline->draw_in_command_buffer(commandBuffer);
@@ -63,10 +66,24 @@ inline std::vector<vk::DescriptorSetLayoutBinding> gfx_pipeline_image::createDes
          vk::ShaderStageFlagBits::eFragment},
         {1, // binding
          vk::DescriptorType::eSampledImage,
-         narrow_cast<uint32_t>(device_shared::atlas_maximum_num_images), // descriptorCount
+         narrow_cast<uint32_t>(device()->image_pipeline->atlas_num_images), // descriptorCount
          vk::ShaderStageFlagBits::eFragment}};
 }
 
+inline std::vector<vk::DescriptorBindingFlags> gfx_pipeline_image::createDescriptorSetLayoutBindingFlags() const
+{
+    hi_axiom_not_null(device());
+    if (not device()->supportsBindlessImages) {
+        return {};
+    }
+
+    // Atlas images are added while the descriptor sets of previous frames are still in use.
+    return {
+        vk::DescriptorBindingFlags{},
+        vk::DescriptorBindingFlagBits::ePartiallyBound | vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+            vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending};
+}
+
 inline std::vector<vk::WriteDescriptorSet> gfx_pipeline_image::createWriteDescriptorSet() const
 {
     hi_axiom_not_null(device());
@@ -98,7 +115,7 @@ inline std::vector<vk::WriteDescriptorSet> gfx_pipeline_image::createWriteDescri
 inline size_t gfx_pipeline_image::getDescriptorSetVersion() const
 {
     hi_axiom_not_null(device());
-    return device()->image_pipeline->atlas_textures.size();
+    return device()->image_pipeline->atlas_descriptor_version;
 }
 
 inline std::vector<vk::PushConstantRange> gfx_pipeline_image::createPushConstantRanges() const
@@ -116,34 +133,6 @@ inline std::vector<vk::VertexInputAttributeDescription> gfx_pipeline_image::crea
     return vertex::inputAttributeDescriptions();
 }
 
-inline void gfx_pipeline_image::build_vertex_buffers()
-{
-    using vertexIndexType = uint16_t;
-    constexpr ssize_t numberOfVertices = 1 << (sizeof(vertexIndexType) * CHAR_BIT);
-
-    vk::BufferCreateInfo const bufferCreateInfo = {
-        vk::BufferCreateFlags(),
-        sizeof(vertex) * numberOfVertices,
-        vk::BufferUsageFlagBits::eVertexBuffer,
-        vk::SharingMode::eExclusive};
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
-    allocationCreateInfo.pUserData = const_cast<char *>("image-pipeline vertex buffer");
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-
-    hi_axiom_not_null(device());
-    std::tie(vertexBuffer, vertexBufferAllocation) = device()->createBuffer(bufferCreateInfo, allocationCreateInfo);
-    device()->setDebugUtilsObjectNameEXT(vertexBuffer, "image-pipeline vertex buffer");
-    vertexBufferData = device()->mapMemory<vertex>(vertexBufferAllocation);
-}
-
-inline void gfx_pipeline_image::teardown_vertex_buffers()
-{
-    hi_axiom_not_null(device());
-    device()->unmapMemory(vertexBufferAllocation);
-    device()->destroyBuffer(vertexBuffer, vertexBufferAllocation);
-}
-
 inline void
 gfx_pipeline_image::texture_map::transitionLayout(const gfx_device& device, vk::Format format, vk::ImageLayout nextLayout)
 {
@@ -153,7 +142,11 @@ gfx_pipeline_image::texture_map::transitionLayout(const gfx_device& device, vk::
     }
 }
 
-inline gfx_pipeline_image::paged_image::paged_image(gfx_surface const *surface, std::size_t width, std::size_t height) noexcept :
+inline gfx_pipeline_image::paged_image::paged_image(
+    gfx_surface const *surface,
+    std::size_t width,
+    std::size_t height,
+    bool compressed) noexcept :
     device(nullptr), width(width), height(height), pages()
 {
     if (surface == nullptr) {
@@ -168,12 +161,29 @@ inline gfx_pipeline_image::paged_image::paged_image(gfx_surface const *surface,
     auto const lock = std::scoped_lock(gfx_system_mutex);
     if ((this->device = surface->device()) != nullptr) {
         auto const[num_columns, num_rows] = size_in_int_pages();
-        this->pages = device->image_pipeline->allocate_pages(num_columns * num_rows);
+        this->compressed = compressed and device->supportsCompressedImages;
+        this->pages = device->image_pipeline->allocate_pages(num_columns * num_rows, this->compressed);
+        if (this->pages.size() != num_columns * num_rows) {
+            // The atlas is full, return an empty image.
+            this->device = nullptr;
+        }
+    }
+}
+
+inline gfx_pipeline_image::paged_image::paged_image(
+    gfx_surface const *surface,
+    pixmap_span<sfloat_rgba16 const> image,
+    bool compressed) noexcept :
+    paged_image(surface, narrow_cast<std::size_t>(image.width()), narrow_cast<std::size_t>(image.height()), compressed)
+{
+    if (this->device) {
+        auto const lock = std::scoped_lock(gfx_system_mutex);
+        this->upload(image);
     }
 }
 
-inline gfx_pipeline_image::paged_image::paged_image(gfx_surface const *surface, pixmap_span<sfloat_rgba16 const> image) noexcept :
-    paged_image(surface, narrow_cast<std::size_t>(image.width()), narrow_cast<std::size_t>(image.height()))
+inline gfx_pipeline_image::paged_image::paged_image(gfx_surface const *surface, png const& image, bool compressed) noexcept :
+    paged_image(surface, narrow_cast<std::size_t>(image.width()), narrow_cast<std::size_t>(image.height()), compressed)
 {
     if (this->device) {
         auto const lock = std::scoped_lock(gfx_system_mutex);
@@ -181,11 +191,22 @@ inline gfx_pipeline_image::paged_image::paged_image(gfx_surface const *surface,
     }
 }
 
-inline gfx_pipeline_image::paged_image::paged_image(gfx_surface const *surface, png const& image) noexcept :
-    paged_image(surface, narrow_cast<std::size_t>(image.width()), narrow_cast<std::size_t>(image.height()))
+inline gfx_pipeline_image::paged_image::paged_image(
+    gfx_device *device,
+    pixmap_span<sfloat_rgba16 const> image,
+    bool compressed) noexcept :
+    device(device), width(narrow_cast<std::size_t>(image.width())), height(narrow_cast<std::size_t>(image.height())), pages()
 {
     if (this->device) {
         auto const lock = std::scoped_lock(gfx_system_mutex);
+        auto const[num_columns, num_rows] = size_in_int_pages();
+        this->compressed = compressed and this->device->supportsCompressedImages;
+        this->pages = this->device->image_pipeline->allocate_pages(num_columns * num_rows, this->compressed);
+        if (this->pages.size() != num_columns * num_rows) {
+            // The atlas is full, return an empty image.
+            this->device = nullptr;
+            return;
+        }
         this->upload(image);
     }
 }
@@ -195,7 +216,9 @@ inline gfx_pipeline_image::paged_image::paged_image(paged_image&& other) noexcep
     device(std::exchange(other.device, nullptr)),
     width(other.width),
     height(other.height),
-    pages(std::move(other.pages))
+    pages(std::move(other.pages)),
+    compressed(other.compressed),
+    upload_value(other.upload_value)
 {
 }
 
@@ -213,6 +236,8 @@ inline gfx_pipeline_image::paged_image& gfx_pipeline_image::paged_image::operato
     width = other.width;
     height = other.height;
     pages = std::move(other.pages);
+    compressed = other.compressed;
+    upload_value = other.upload_value;
     return *this;
 }
 
@@ -223,6 +248,23 @@ inline gfx_pipeline_image::paged_image::~paged_image()
     }
 }
 
+inline bool gfx_pipeline_image::paged_image::is_uploaded() const noexcept
+{
+    if (state == state_type::uploaded) {
+        return true;
+    }
+
+    if (device) {
+        // The lock makes sure `upload_value` is not being written by `upload()`.
+        auto const lock = std::scoped_lock(gfx_system_mutex);
+        if (state == state_type::drawing and device->image_pipeline->upload_completed(upload_value)) {
+            state = state_type::uploaded;
+            return true;
+        }
+    }
+    return false;
+}
+
 inline void gfx_pipeline_image::paged_image::upload(png const& image) noexcept
 {
     hi_assert(image.width() == width and image.height() == height);
@@ -232,11 +274,11 @@ inline void gfx_pipeline_image::paged_image::upload(png const& image) noexcept
 
         state = state_type::drawing;
 
-        auto staging_image = device->image_pipeline->get_staging_pixmap(image.width(), image.height());
-        image.decode_image(staging_image);
-        device->image_pipeline->update_atlas_with_staging_pixmap(*this);
-
-        state = state_type::uploaded;
+        // The bands of the image are decoded directly into the staging images.
+        auto const image_data = image.decode_lines();
+        upload_value = device->image_pipeline->upload_in_bands(*this, [&](std::size_t first_row, auto rows) {
+            image.decode_rows(image_data, first_row, rows);
+        });
     }
 }
 
@@ -249,17 +291,25 @@ inline void gfx_pipeline_image::paged_image::upload(pixmap_span<sfloat_rgba16 co
 
         state = state_type::drawing;
 
-        auto staging_image = device->image_pipeline->get_staging_pixmap(image.width(), image.height());
-        copy(image, staging_image);
-        device->image_pipeline->update_atlas_with_staging_pixmap(*this);
-
-        state = state_type::uploaded;
+        upload_value = device->image_pipeline->upload_in_bands(*this, [&](std::size_t first_row, auto rows) {
+            copy(image.subimage(0, first_row, rows.width(), rows.height()), rows);
+        });
     }
 }
 
 inline gfx_pipeline_image::device_shared::device_shared(gfx_device const& device) : device(device)
 {
+    atlas_num_images = device.supportsBindlessImages ? narrow_cast<int32_t>(device.maxNrBindlessImages) :
+                                                       narrow_cast<int32_t>(atlas_maximum_num_images);
+    _atlas_allocator =
+        gfx_page_allocator{atlas_num_pages_per_image, narrow_cast<std::size_t>(atlas_num_images), num_retire_frames};
+    _memory_pressure_cbt = device.subscribe_memory_pressure([this](std::size_t excess) {
+        on_memory_pressure(excess);
+    });
+    _mirror_atlas = atlas_mirror_enabled;
+
     build_shaders();
+    build_upload();
     build_atlas();
 }
 
@@ -268,35 +318,148 @@ inline gfx_pipeline_image::device_shared::~device_shared() {}
 inline void gfx_pipeline_image::device_shared::destroy(gfx_device const *old_device)
 {
     hi_assert_not_null(old_device);
+
+    // The glyph images free their pages in the atlas.
+    _glyph_images.clear();
+
     teardown_shaders(old_device);
+    teardown_upload(old_device);
     teardown_atlas(old_device);
 }
 
-inline std::vector<std::size_t> gfx_pipeline_image::device_shared::allocate_pages(std::size_t num_pages) noexcept
+inline bool gfx_pipeline_image::device_shared::copy_atlas_from(device_shared const& other) noexcept
 {
-    while (num_pages > _atlas_free_pages.size()) {
-        add_atlas_image();
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    if (&other == this or &other.device != &device or not other._mirror_atlas or not _mirror_atlas) {
+        return false;
+    }
+
+    if (atlas_num_images != other.atlas_num_images or _atlas_allocator.num_allocated_pages() != 0) {
+        return false;
+    }
+
+    _atlas_allocator = other._atlas_allocator;
+    _atlas_budget = other._atlas_budget;
+    _atlas_allocator.set_budget(std::min(_atlas_budget, _atlas_pressure_budget));
+
+    // The first atlas image was added when this pipeline was created, the mirror of a released layer is empty.
+    for (auto layer = 1_uz; layer < other._atlas_mirror.size(); ++layer) {
+        auto const& mirror = other._atlas_mirror[layer];
+        if (not mirror.pixels.empty() or not mirror.blocks.empty()) {
+            add_atlas_image(layer, not mirror.blocks.empty());
+        }
+    }
+    _atlas_mirror = other._atlas_mirror;
+
+    // The paged images wait for the upload values of the lost device, which are
+    // completed by the uploads of the mirror.
+    _upload_value = other._upload_value;
+    for (auto layer = 0_uz; layer != atlas_textures.size(); ++layer) {
+        if (atlas_textures[layer].image) {
+            std::ignore = upload_atlas_mirror(layer);
+        }
     }
 
-    auto r = std::vector<std::size_t>();
-    for (int i = 0; i < num_pages; i++) {
-        auto const page = _atlas_free_pages.back();
-        r.push_back(page);
-        _atlas_free_pages.pop_back();
+    if (upload_semaphore) {
+        auto const wait_info = vk::SemaphoreWaitInfo{vk::SemaphoreWaitFlags{}, 1, &upload_semaphore, &_upload_value};
+        std::ignore = device.waitSemaphores(wait_info, std::numeric_limits<uint64_t>::max());
+    }
+    _completed_upload_value = _upload_value;
+
+    ++global_counter<"image_pipeline:atlas:copy">;
+    return true;
+}
+
+inline std::vector<std::size_t> gfx_pipeline_image::device_shared::allocate_pages(std::size_t num_pages, bool compressed) noexcept
+{
+    hi_axiom(not compressed or device.supportsCompressedImages);
+
+    auto const kind = static_cast<gfx_page_allocator::kind_type>(compressed);
+    auto r = _atlas_allocator.allocate(num_pages, kind, [&](std::size_t layer, gfx_page_allocator::kind_type) {
+        add_atlas_image(layer, compressed);
+    });
+    if (r.size() != num_pages) {
+        ++global_counter<"image_pipeline:atlas:full">;
+        hi_log_warning("The image atlas is full, could not allocate {} pages.", num_pages);
     }
     return r;
 }
 
 inline void gfx_pipeline_image::device_shared::free_pages(std::vector<std::size_t> const& pages) noexcept
 {
-    _atlas_free_pages.insert(_atlas_free_pages.end(), pages.begin(), pages.end());
+    // The pages may still be read by frames-in-flight, they are reused after a couple of frames.
+    _atlas_allocator.free(pages);
 }
 
-inline hi::pixmap_span<sfloat_rgba16> gfx_pipeline_image::device_shared::get_staging_pixmap()
+inline void gfx_pipeline_image::device_shared::on_memory_pressure(std::size_t excess) noexcept
 {
-    staging_texture.transitionLayout(device, vk::Format::eR16G16B16A16Sfloat, vk::ImageLayout::eGeneral);
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    if (excess == 0) {
+        _atlas_pressure_budget = std::numeric_limits<std::size_t>::max();
+
+    } else {
+        // Atlas images are released when they become empty, by lowering the budget below the current number of images.
+        auto const num_layers = _atlas_allocator.num_layers();
+        auto const layer_size = device.memory_budget.usage(gfx_memory_category::image_atlas) / std::max(num_layers, 1_uz);
+        auto const num_release = layer_size != 0 ? (excess + layer_size - 1) / layer_size : 0_uz;
+        _atlas_pressure_budget = num_layers > num_release ? num_layers - num_release : 1_uz;
+        ++global_counter<"image_pipeline:atlas:pressure">;
+    }
 
-    return staging_texture.pixmap.subimage(1, 1, staging_image_width - 2, staging_image_height - 2);
+    _atlas_allocator.set_budget(std::min(_atlas_budget, _atlas_pressure_budget));
+}
+
+inline void gfx_pipeline_image::device_shared::next_frame() noexcept
+{
+    ++_frame_count;
+
+    _atlas_allocator.next_frame([&](std::size_t layer) {
+        remove_atlas_image(layer);
+    });
+
+    // The released atlas images are ordered by the frame in which they were released.
+    auto const it = std::find_if(_retired_atlas_textures.begin(), _retired_atlas_textures.end(), [&](auto const& item) {
+        return item.first + num_retire_frames > _frame_count;
+    });
+    for (auto jt = _retired_atlas_textures.begin(); jt != it; ++jt) {
+        device.destroy(jt->second.view);
+        device.destroyImage(jt->second.image, jt->second.allocation, gfx_memory_category::image_atlas);
+    }
+    _retired_atlas_textures.erase(_retired_atlas_textures.begin(), it);
+}
+
+inline bool gfx_pipeline_image::device_shared::upload_completed(uint64_t value) noexcept
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    if (value > _completed_upload_value and upload_semaphore) {
+        _completed_upload_value = device.getSemaphoreCounterValue(upload_semaphore);
+    }
+    return value <= _completed_upload_value;
+}
+
+inline void gfx_pipeline_image::device_shared::next_staging_texture()
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    if (++_staging_index == staging_textures.size()) {
+        _staging_index = 0;
+    }
+
+    // The previous image in this staging texture may still be copied into the atlas.
+    auto const& staging = staging_textures[_staging_index];
+    if (not upload_completed(staging.upload_value)) {
+        ++global_counter<"image_pipeline:staging-wait">;
+        auto const wait_info = vk::SemaphoreWaitInfo{vk::SemaphoreWaitFlags{}, 1, &upload_semaphore, &staging.upload_value};
+        std::ignore = device.waitSemaphores(wait_info, std::numeric_limits<uint64_t>::max());
+    }
+}
+
+inline hi::pixmap_span<sfloat_rgba16> gfx_pipeline_image::device_shared::get_staging_pixmap()
+{
+    return current_staging_texture().pixmap.subimage(1, 1, staging_image_width - 2, staging_image_height - 2);
 }
 
 /** Get the coordinate in the atlas from a page index.
@@ -333,7 +496,11 @@ inline point2 get_staging_position(const gfx_pipeline_image::paged_image& image,
         narrow_cast<float>((page_index / width_in_pages) * gfx_pipeline_image::paged_image::page_size + 1)};
 }
 
-inline void gfx_pipeline_image::device_shared::make_staging_border_transparent(aarectangle border_rectangle) noexcept
+inline void gfx_pipeline_image::device_shared::make_staging_border_transparent(
+    pixmap_span<sfloat_rgba16> staging_pixmap,
+    aarectangle border_rectangle,
+    bool bottom_edge,
+    bool top_edge) noexcept
 {
     auto const width = ceil_cast<std::size_t>(border_rectangle.width());
     auto const height = ceil_cast<std::size_t>(border_rectangle.height());
@@ -347,25 +514,32 @@ inline void gfx_pipeline_image::device_shared::make_staging_border_transparent(a
     hi_assert(top >= 2);
     hi_assert(right >= 2);
 
-    // Add a border below and above the image.
-    auto border_bottom_row = staging_texture.pixmap[bottom];
-    auto border_top_row = staging_texture.pixmap[top - 1];
-    auto image_bottom_row = staging_texture.pixmap[bottom + 1];
-    auto image_top_row = staging_texture.pixmap[top - 2];
-    for (auto x = 0_uz; x != width; ++x) {
-        border_bottom_row[x] = make_transparent(image_bottom_row[x]);
-        border_top_row[x] = make_transparent(image_top_row[x]);
+    // Add a border below and above the image. Inside the image the border was drawn from the neighbouring rows.
+    if (bottom_edge) {
+        auto border_bottom_row = staging_pixmap[bottom];
+        auto image_bottom_row = staging_pixmap[bottom + 1];
+        for (auto x = 0_uz; x != width; ++x) {
+            border_bottom_row[x] = make_transparent(image_bottom_row[x]);
+        }
+    }
+    if (top_edge) {
+        auto border_top_row = staging_pixmap[top - 1];
+        auto image_top_row = staging_pixmap[top - 2];
+        for (auto x = 0_uz; x != width; ++x) {
+            border_top_row[x] = make_transparent(image_top_row[x]);
+        }
     }
 
     // Add a border to the left and right of the image.
     for (auto y = 0_uz; y != height; ++y) {
-        auto row = staging_texture.pixmap[y];
+        auto row = staging_pixmap[y];
         row[left] = make_transparent(row[left + 1]);
-        row[right - 2] = make_transparent(row[right - 1]);
+        row[right - 1] = make_transparent(row[right - 2]);
     }
 }
 
 inline void gfx_pipeline_image::device_shared::clear_staging_between_border_and_upload(
+    pixmap_span<sfloat_rgba16> staging_pixmap,
     aarectangle border_rectangle,
     aarectangle upload_rectangle) noexcept
 {
@@ -381,7 +555,7 @@ inline void gfx_pipeline_image::device_shared::clear_staging_between_border_and_
 
     // Clear the area to the right of the border.
     for (auto y = 0_uz; y != border_top; ++y) {
-        auto row = staging_texture.pixmap[y];
+        auto row = staging_pixmap[y];
         for (auto x = border_right; x != upload_right; ++x) {
             row[x] = sfloat_rgba16{};
         }
@@ -389,39 +563,67 @@ inline void gfx_pipeline_image::device_shared::clear_staging_between_border_and_
 
     // Clear the area above the border.
     for (auto y = border_top; y != upload_top; ++y) {
-        auto row = staging_texture.pixmap[y];
+        auto row = staging_pixmap[y];
         for (auto x = 0_uz; x != upload_right; ++x) {
             row[x] = sfloat_rgba16{};
         }
     }
 }
 
-inline void gfx_pipeline_image::device_shared::prepare_staging_for_upload(paged_image const& image) noexcept
+inline void gfx_pipeline_image::device_shared::prepare_staging_for_upload(
+    paged_image const& image,
+    std::size_t band_height,
+    bool bottom_edge,
+    bool top_edge) noexcept
 {
-    auto const image_rectangle = aarectangle{point2{1.0f, 1.0f}, image.size()};
+    auto const image_rectangle =
+        aarectangle{point2{1.0f, 1.0f}, extent2{narrow_cast<float>(image.width), narrow_cast<float>(band_height)}};
     auto const border_rectangle = image_rectangle + 1;
     auto const upload_width = ceil(image.width, paged_image::page_size) + 2;
-    auto const upload_height = ceil(image.height, paged_image::page_size) + 2;
+    auto const upload_height = ceil(band_height, paged_image::page_size) + 2;
     auto const upload_rectangle = aarectangle{extent2{narrow_cast<float>(upload_width), narrow_cast<float>(upload_height)}};
 
-    make_staging_border_transparent(border_rectangle);
-    clear_staging_between_border_and_upload(border_rectangle, upload_rectangle);
+    make_staging_border_transparent(staging_pixmap(image), border_rectangle, bottom_edge, top_edge);
+    clear_staging_between_border_and_upload(staging_pixmap(image), border_rectangle, upload_rectangle);
+
+    if (image.compressed) {
+        // The compressed blocks are flushed after compression.
+        return;
+    }
+
+    auto& staging_texture = current_staging_texture();
+    if (_mirror_atlas) {
+        // The pages are copied into the mirror from the compression pixmap, see `update_atlas_with_staging_pixmap()`.
+        auto const src = pixmap_span<sfloat_rgba16>{_compression_pixmap}.subimage(0, 0, upload_width, upload_height);
+        copy(src, staging_texture.pixmap.subimage(0, 0, upload_width, upload_height));
+    }
 
     // Flush the given image, everything that may be uploaded.
     static_assert(std::is_same_v<decltype(staging_texture.pixmap)::value_type, sfloat_rgba16>);
     device.flushAllocation(staging_texture.allocation, 0, upload_height * staging_texture.pixmap.stride() * 8);
-    staging_texture.transitionLayout(device, vk::Format::eR16G16B16A16Sfloat, vk::ImageLayout::eTransferSrcOptimal);
 }
 
-inline void gfx_pipeline_image::device_shared::update_atlas_with_staging_pixmap(paged_image const& image) noexcept
+inline uint64_t gfx_pipeline_image::device_shared::update_atlas_with_staging_pixmap(
+    paged_image const& image,
+    std::size_t first_page_row,
+    std::size_t num_page_rows) noexcept
 {
-    prepare_staging_for_upload(image);
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+    hi_axiom_not_null(_upload_queue);
+
+    auto const num_columns = image.size_in_int_pages().first;
+    auto const first_index = first_page_row * num_columns;
+    auto const last_index = std::min((first_page_row + num_page_rows) * num_columns, size(image.pages));
 
-    std::array<std::vector<vk::ImageCopy>, atlas_maximum_num_images> regions_to_copy_per_atlas_texture;
-    for (std::size_t index = 0; index < size(image.pages); index++) {
+    auto& staging = staging_textures[_staging_index];
+
+    auto regions_to_copy_per_atlas_texture = std::vector<std::vector<vk::ImageCopy>>(atlas_textures.size());
+    auto buffer_regions_to_copy_per_atlas_texture = std::vector<std::vector<vk::BufferImageCopy>>(atlas_textures.size());
+    for (std::size_t index = first_index; index < last_index; index++) {
         auto const page = image.pages.at(index);
 
-        auto const src_position = get_staging_position(image, index);
+        // The band starts at the bottom of the staging image.
+        auto const src_position = get_staging_position(image, index - first_index);
         auto const dst_position = get_atlas_position(page);
 
         // Copy including a 1 pixel border.
@@ -433,6 +635,58 @@ inline void gfx_pipeline_image::device_shared::update_atlas_with_staging_pixmap(
         auto const dst_y = floor_cast<int32_t>(dst_position.y() - 1.0f);
         auto const dst_z = floor_cast<std::size_t>(dst_position.z());
 
+        // Compressed pages, and all pages when the atlas is mirrored, were drawn into the compression pixmap.
+        auto const compression_src = [&] {
+            return pixmap_span<sfloat_rgba16 const>{_compression_pixmap}.subimage(
+                narrow_cast<std::size_t>(src_x),
+                narrow_cast<std::size_t>(src_y),
+                narrow_cast<std::size_t>(width),
+                narrow_cast<std::size_t>(height));
+        };
+
+        if (image.compressed) {
+            // The atlas pages including their border are 64 x 64 pixels, aligned to the 4 x 4 pixel blocks.
+            auto const block_offset = (index - first_index) * num_blocks_per_page;
+            hi_axiom(block_offset + num_blocks_per_page <= staging.compressed_blocks.size());
+
+            auto const src = compression_src();
+            auto const dst = pixmap_span<srgb_bc3_block>{
+                staging.compressed_blocks.data() + block_offset, num_blocks_per_page_axis, num_blocks_per_page_axis};
+            if (_mirror_atlas) {
+                // Compress into the mirror, the staging buffer is uncached memory which is too slow to read back.
+                hi_axiom_bounds(dst_z, _atlas_mirror);
+                auto const mirror = pixmap_span<srgb_bc3_block>{_atlas_mirror[dst_z].blocks}.subimage(
+                    narrow_cast<std::size_t>(dst_x) / srgb_bc3_block::block_width,
+                    narrow_cast<std::size_t>(dst_y) / srgb_bc3_block::block_width,
+                    num_blocks_per_page_axis,
+                    num_blocks_per_page_axis);
+                compress(src, mirror);
+                copy(mirror, dst);
+            } else {
+                compress(src, dst);
+            }
+
+            buffer_regions_to_copy_per_atlas_texture.at(dst_z).emplace_back(
+                narrow_cast<vk::DeviceSize>(block_offset * sizeof(srgb_bc3_block)),
+                0, // bufferRowLength, tightly packed.
+                0, // bufferImageHeight, tightly packed.
+                vk::ImageSubresourceLayers{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+                vk::Offset3D{dst_x, dst_y, 0},
+                vk::Extent3D{width, height, 1});
+            continue;
+        }
+
+        if (_mirror_atlas) {
+            hi_axiom_bounds(dst_z, _atlas_mirror);
+            copy(
+                compression_src(),
+                pixmap_span<sfloat_rgba16>{_atlas_mirror[dst_z].pixels}.subimage(
+                    narrow_cast<std::size_t>(dst_x),
+                    narrow_cast<std::size_t>(dst_y),
+                    narrow_cast<std::size_t>(width),
+                    narrow_cast<std::size_t>(height)));
+        }
+
         auto& regionsToCopy = regions_to_copy_per_atlas_texture.at(dst_z);
         regionsToCopy.emplace_back(
             vk::ImageSubresourceLayers{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
@@ -442,29 +696,123 @@ inline void gfx_pipeline_image::device_shared::update_atlas_with_staging_pixmap(
             vk::Extent3D{width, height, 1});
     }
 
+    if (image.compressed) {
+        auto const num_blocks = (last_index - first_index) * num_blocks_per_page;
+        device.flushAllocation(staging.compressed_allocation, 0, num_blocks * sizeof(srgb_bc3_block));
+    }
+
+    return submit_staging_upload(regions_to_copy_per_atlas_texture, buffer_regions_to_copy_per_atlas_texture);
+}
+
+inline uint64_t gfx_pipeline_image::device_shared::submit_staging_upload(
+    std::vector<std::vector<vk::ImageCopy>> const& regions_per_atlas_texture,
+    std::vector<std::vector<vk::BufferImageCopy>> const& buffer_regions_per_atlas_texture) noexcept
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+    hi_axiom_not_null(_upload_queue);
+
+    auto& staging = staging_textures[_staging_index];
+
+    auto const command_buffer = staging.command_buffer;
+    command_buffer.begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+    device.cmdBeginDebugUtilsLabelEXT(command_buffer, "upload image");
+
+    // Pages of the atlas are reused, so copies must be done in order of submission.
+    auto const barrier = vk::MemoryBarrier{vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eTransferWrite};
+    command_buffer.pipelineBarrier(
+        vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eTransfer, vk::DependencyFlags(), barrier, {}, {});
+
     for (std::size_t atlas_texture_index = 0; atlas_texture_index < size(atlas_textures); atlas_texture_index++) {
-        auto const& regions_to_copy = regions_to_copy_per_atlas_texture.at(atlas_texture_index);
+        auto const& buffer_regions_to_copy = buffer_regions_per_atlas_texture.at(atlas_texture_index);
+        if (not buffer_regions_to_copy.empty()) {
+            command_buffer.copyBufferToImage(
+                staging.compressed_buffer,
+                atlas_textures.at(atlas_texture_index).image,
+                vk::ImageLayout::eGeneral,
+                buffer_regions_to_copy);
+        }
+
+        auto const& regions_to_copy = regions_per_atlas_texture.at(atlas_texture_index);
         if (regions_to_copy.empty()) {
             continue;
         }
 
-        auto& atlas_texture = atlas_textures.at(atlas_texture_index);
-        atlas_texture.transitionLayout(device, vk::Format::eR16G16B16A16Sfloat, vk::ImageLayout::eTransferDstOptimal);
-
-        device.copyImage(
-            staging_texture.image,
-            vk::ImageLayout::eTransferSrcOptimal,
-            atlas_texture.image,
-            vk::ImageLayout::eTransferDstOptimal,
+        // Both the staging and atlas images stay in the general layout, so that the atlas can be
+        // written on the transfer queue while the other pages are read by the fragment shader.
+        command_buffer.copyImage(
+            staging.texture.image,
+            vk::ImageLayout::eGeneral,
+            atlas_textures.at(atlas_texture_index).image,
+            vk::ImageLayout::eGeneral,
             regions_to_copy);
     }
+
+    device.cmdEndDebugUtilsLabelEXT(command_buffer);
+    command_buffer.end();
+
+    staging.upload_value = ++_upload_value;
+
+    if (upload_semaphore) {
+        auto const timeline_submit_info = vk::TimelineSemaphoreSubmitInfo{0, nullptr, 1, &staging.upload_value};
+        auto submit_info = vk::SubmitInfo{0, nullptr, nullptr, 1, &command_buffer, 1, &upload_semaphore};
+        submit_info.setPNext(&timeline_submit_info);
+        _upload_queue->queue.submit(submit_info, vk::Fence());
+
+    } else {
+        _upload_queue->queue.submit(vk::SubmitInfo{0, nullptr, nullptr, 1, &command_buffer}, vk::Fence());
+        _upload_queue->queue.waitIdle();
+        _completed_upload_value = staging.upload_value;
+    }
+
+    return staging.upload_value;
 }
 
-inline void gfx_pipeline_image::device_shared::prepare_atlas_for_rendering()
+inline uint64_t gfx_pipeline_image::device_shared::upload_atlas_mirror(std::size_t layer) noexcept
 {
-    for (auto& atlas_texture : atlas_textures) {
-        atlas_texture.transitionLayout(device, vk::Format::eR16G16B16A16Sfloat, vk::ImageLayout::eShaderReadOnlyOptimal);
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+    hi_axiom_bounds(layer, _atlas_mirror);
+    hi_axiom_bounds(layer, atlas_textures);
+
+    next_staging_texture();
+    auto& staging = staging_textures[_staging_index];
+    auto const& mirror = _atlas_mirror[layer];
+
+    constexpr auto axis_size = narrow_cast<uint32_t>(atlas_image_axis_size);
+    auto regions_per_atlas_texture = std::vector<std::vector<vk::ImageCopy>>(atlas_textures.size());
+    auto buffer_regions_per_atlas_texture = std::vector<std::vector<vk::BufferImageCopy>>(atlas_textures.size());
+
+    if (not mirror.blocks.empty()) {
+        auto const num_blocks = mirror.blocks.width() * mirror.blocks.height();
+        hi_axiom(num_blocks <= staging.compressed_blocks.size());
+
+        copy(
+            pixmap_span<srgb_bc3_block const>{mirror.blocks},
+            pixmap_span<srgb_bc3_block>{staging.compressed_blocks.data(), mirror.blocks.width(), mirror.blocks.height()});
+        device.flushAllocation(staging.compressed_allocation, 0, num_blocks * sizeof(srgb_bc3_block));
+
+        buffer_regions_per_atlas_texture[layer].emplace_back(
+            vk::DeviceSize{0},
+            0, // bufferRowLength, tightly packed.
+            0, // bufferImageHeight, tightly packed.
+            vk::ImageSubresourceLayers{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+            vk::Offset3D{0, 0, 0},
+            vk::Extent3D{axis_size, axis_size, 1});
+
+    } else {
+        auto const src = pixmap_span<sfloat_rgba16 const>{mirror.pixels};
+        copy(src, staging.texture.pixmap.subimage(0, 0, src.width(), src.height()));
+        device.flushAllocation(
+            staging.texture.allocation, 0, src.height() * staging.texture.pixmap.stride() * sizeof(sfloat_rgba16));
+
+        regions_per_atlas_texture[layer].emplace_back(
+            vk::ImageSubresourceLayers{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+            vk::Offset3D{0, 0, 0},
+            vk::ImageSubresourceLayers{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+            vk::Offset3D{0, 0, 0},
+            vk::Extent3D{axis_size, axis_size, 1});
     }
+
+    return submit_staging_upload(regions_per_atlas_texture, buffer_regions_per_atlas_texture);
 }
 
 inline void gfx_pipeline_image::device_shared::draw_in_command_buffer(vk::CommandBuffer const& commandBuffer)
@@ -477,9 +825,16 @@ inline void gfx_pipeline_image::device_shared::build_shaders()
     vertex_shader_module = device.loadShader(URL("resource:image_vulkan.vert.spv"));
     fragment_shader_module = device.loadShader(URL("resource:image_vulkan.frag.spv"));
 
+    fragment_shader_specialization_map_entry = {0, 0, sizeof(atlas_num_images)};
+    fragment_shader_specialization_info = {1, &fragment_shader_specialization_map_entry, sizeof(atlas_num_images), &atlas_num_images};
+
     shader_stages = {
         {vk::PipelineShaderStageCreateFlags(), vk::ShaderStageFlagBits::eVertex, vertex_shader_module, "main"},
-        {vk::PipelineShaderStageCreateFlags(), vk::ShaderStageFlagBits::eFragment, fragment_shader_module, "main"}};
+        {vk::PipelineShaderStageCreateFlags(),
+         vk::ShaderStageFlagBits::eFragment,
+         fragment_shader_module,
+         "main",
+         &fragment_shader_specialization_info}};
 }
 
 inline void gfx_pipeline_image::device_shared::teardown_shaders(gfx_device const *vulkanDevice)
@@ -489,24 +844,24 @@ inline void gfx_pipeline_image::device_shared::teardown_shaders(gfx_device const
     vulkanDevice->destroy(fragment_shader_module);
 }
 
-inline void gfx_pipeline_image::device_shared::add_atlas_image()
+inline void gfx_pipeline_image::device_shared::add_atlas_image(std::size_t layer, bool compressed)
 {
-    auto const current_image_index = size(atlas_textures);
+    auto const current_image_index = layer;
 
     // Create atlas image
     vk::ImageCreateInfo const imageCreateInfo = {
         vk::ImageCreateFlags(),
         vk::ImageType::e2D,
-        vk::Format::eR16G16B16A16Sfloat,
+        compressed ? vk::Format::eBc3SrgbBlock : vk::Format::eR16G16B16A16Sfloat,
         vk::Extent3D(atlas_image_axis_size, atlas_image_axis_size, 1),
         1, // mipLevels
         1, // arrayLayers
         vk::SampleCountFlagBits::e1,
         vk::ImageTiling::eOptimal,
         vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled,
-        vk::SharingMode::eExclusive,
-        0,
-        nullptr,
+        _queue_family_indices.empty() ? vk::SharingMode::eExclusive : vk::SharingMode::eConcurrent,
+        narrow_cast<uint32_t>(_queue_family_indices.size()),
+        _queue_family_indices.data(),
         vk::ImageLayout::eUndefined};
     VmaAllocationCreateInfo allocationCreateInfo = {};
     auto allocation_name = std::format("image-pipeline atlas image {}", current_image_index);
@@ -514,7 +869,8 @@ inline void gfx_pipeline_image::device_shared::add_atlas_image()
     allocationCreateInfo.pUserData = const_cast<char *>(allocation_name.c_str());
     allocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
 
-    auto const[atlasImage, atlasImageAllocation] = device.createImage(imageCreateInfo, allocationCreateInfo);
+    auto const[atlasImage, atlasImageAllocation] =
+        device.createImage(imageCreateInfo, allocationCreateInfo, gfx_memory_category::image_atlas);
     device.setDebugUtilsObjectNameEXT(atlasImage, allocation_name.c_str());
 
     auto const atlasImageView = device.createImageView(
@@ -531,28 +887,73 @@ inline void gfx_pipeline_image::device_shared::add_atlas_image()
              1 // layerCount
          }});
 
-    atlas_textures.push_back({atlasImage, atlasImageAllocation, atlasImageView});
+    if (atlas_textures.size() <= current_image_index) {
+        atlas_textures.resize(current_image_index + 1);
+    }
+    auto& atlas_texture = atlas_textures[current_image_index];
+    atlas_texture = {atlasImage, atlasImageAllocation, atlasImageView};
+    atlas_texture.format = imageCreateInfo.format;
+    atlas_texture.transitionLayout(device, imageCreateInfo.format, vk::ImageLayout::eGeneral);
+
+    if (_mirror_atlas) {
+        if (_atlas_mirror.size() <= current_image_index) {
+            _atlas_mirror.resize(current_image_index + 1);
+        }
+        auto& mirror = _atlas_mirror[current_image_index];
+        if (compressed) {
+            constexpr auto num_blocks_per_axis = atlas_image_axis_size / srgb_bc3_block::block_width;
+            mirror = {pixmap<sfloat_rgba16>{}, pixmap<srgb_bc3_block>{num_blocks_per_axis, num_blocks_per_axis}};
+        } else {
+            mirror = {pixmap<sfloat_rgba16>{atlas_image_axis_size, atlas_image_axis_size}, pixmap<srgb_bc3_block>{}};
+        }
+    }
 
-    // Add pages for this image to free list.
-    auto const page_offset = current_image_index * atlas_num_pages_per_image;
-    for (int i = 0; i < atlas_num_pages_per_image; i++) {
-        _atlas_free_pages.push_back({page_offset + i});
+    ++global_counter<"image_pipeline:atlas:add">;
+    update_atlas_descriptors();
+}
+
+inline void gfx_pipeline_image::device_shared::remove_atlas_image(std::size_t layer)
+{
+    // The first atlas image is used for the unused descriptors.
+    hi_axiom(layer != 0 and layer < atlas_textures.size());
+
+    // The image is destroyed when the frames-in-flight no longer use the descriptor set.
+    _retired_atlas_textures.emplace_back(_frame_count, std::exchange(atlas_textures[layer], texture_map{}));
+    while (not atlas_textures.back().image) {
+        atlas_textures.pop_back();
+    }
+    if (layer < _atlas_mirror.size()) {
+        _atlas_mirror[layer] = {};
     }
 
-    // Build image descriptor info.
+    ++global_counter<"image_pipeline:atlas:release">;
+    update_atlas_descriptors();
+}
+
+inline void gfx_pipeline_image::device_shared::update_atlas_descriptors()
+{
+    hi_axiom(not atlas_textures.empty());
+
+    // With bindless images the partially bound descriptor array only grows, released
+    // atlas images are replaced by the first atlas image, just like the unused descriptors
+    // without bindless images.
+    auto const num_descriptors = device.supportsBindlessImages ?
+        std::max(atlas_descriptor_image_infos.size(), atlas_textures.size()) :
+        narrow_cast<std::size_t>(atlas_num_images);
+
+    atlas_descriptor_image_infos.resize(num_descriptors);
     for (std::size_t i = 0; i < size(atlas_descriptor_image_infos); i++) {
-        // Point the descriptors to each imageView,
-        // repeat the first imageView if there are not enough.
-        atlas_descriptor_image_infos.at(i) = {
+        atlas_descriptor_image_infos[i] = {
             vk::Sampler(),
-            i < atlas_textures.size() ? atlas_textures.at(i).view : atlas_textures.at(0).view,
-            vk::ImageLayout::eShaderReadOnlyOptimal};
+            i < atlas_textures.size() and atlas_textures[i].view ? atlas_textures[i].view : atlas_textures.front().view,
+            vk::ImageLayout::eGeneral};
     }
+    ++atlas_descriptor_version;
 }
 
 inline void gfx_pipeline_image::device_shared::build_atlas()
 {
-    // Create staging image
+    // Create staging images
     vk::ImageCreateInfo const imageCreateInfo = {
         vk::ImageCreateFlags(),
         vk::ImageType::e2D,
@@ -563,23 +964,60 @@ inline void gfx_pipeline_image::device_shared::build_atlas()
         vk::SampleCountFlagBits::e1,
         vk::ImageTiling::eLinear,
         vk::ImageUsageFlagBits::eTransferSrc,
-        vk::SharingMode::eExclusive,
-        0,
-        nullptr,
+        _queue_family_indices.empty() ? vk::SharingMode::eExclusive : vk::SharingMode::eConcurrent,
+        narrow_cast<uint32_t>(_queue_family_indices.size()),
+        _queue_family_indices.data(),
         vk::ImageLayout::ePreinitialized};
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
-    allocationCreateInfo.pUserData = const_cast<char *>("image-pipeline staging image");
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-    auto const[image, allocation] = device.createImage(imageCreateInfo, allocationCreateInfo);
-    device.setDebugUtilsObjectNameEXT(image, "image-pipeline staging image");
-    auto const data = device.mapMemory<sfloat_rgba16>(allocation);
-
-    staging_texture = {
-        image,
-        allocation,
-        vk::ImageView(),
-        hi::pixmap_span<sfloat_rgba16>{data.data(), imageCreateInfo.extent.width, imageCreateInfo.extent.height}};
+    for (auto i = 0_uz; i != staging_textures.size(); ++i) {
+        auto allocation_name = std::format("image-pipeline staging image {}", i);
+        VmaAllocationCreateInfo allocationCreateInfo = {};
+        allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
+        allocationCreateInfo.pUserData = const_cast<char *>(allocation_name.c_str());
+        allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+        auto const[image, allocation] =
+            device.createImage(imageCreateInfo, allocationCreateInfo, gfx_memory_category::image_atlas);
+        device.setDebugUtilsObjectNameEXT(image, allocation_name.c_str());
+        auto const data = device.mapMemory<sfloat_rgba16>(allocation);
+
+        auto& staging_texture = staging_textures[i].texture;
+        staging_texture = {
+            image,
+            allocation,
+            vk::ImageView(),
+            hi::pixmap_span<sfloat_rgba16>{data.data(), imageCreateInfo.extent.width, imageCreateInfo.extent.height}};
+
+        // The staging image is written by the CPU and read by the transfer queue without further layout transitions.
+        staging_texture.transitionLayout(device, imageCreateInfo.format, vk::ImageLayout::eGeneral);
+    }
+
+    if (device.supportsCompressedImages or _mirror_atlas) {
+        _compression_pixmap = pixmap<sfloat_rgba16>{staging_image_width, staging_image_height};
+    }
+
+    if (device.supportsCompressedImages) {
+        for (auto i = 0_uz; i != staging_textures.size(); ++i) {
+            vk::BufferCreateInfo const bufferCreateInfo = {
+                vk::BufferCreateFlags(),
+                sizeof(srgb_bc3_block) * num_blocks_per_page * staging_num_pages,
+                vk::BufferUsageFlagBits::eTransferSrc,
+                _queue_family_indices.empty() ? vk::SharingMode::eExclusive : vk::SharingMode::eConcurrent,
+                narrow_cast<uint32_t>(_queue_family_indices.size()),
+                _queue_family_indices.data()};
+            auto allocation_name = std::format("image-pipeline compressed staging buffer {}", i);
+            VmaAllocationCreateInfo allocationCreateInfo = {};
+            allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
+            allocationCreateInfo.pUserData = const_cast<char *>(allocation_name.c_str());
+            allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+            auto const [buffer, allocation] =
+                device.createBuffer(bufferCreateInfo, allocationCreateInfo, gfx_memory_category::image_atlas);
+            device.setDebugUtilsObjectNameEXT(buffer, allocation_name.c_str());
+
+            auto& staging = staging_textures[i];
+            staging.compressed_buffer = buffer;
+            staging.compressed_allocation = allocation;
+            staging.compressed_blocks = device.mapMemory<srgb_bc3_block>(allocation);
+        }
+    }
 
     vk::SamplerCreateInfo const samplerCreateInfo = {
         vk::SamplerCreateFlags(),
@@ -605,7 +1043,9 @@ inline void gfx_pipeline_image::device_shared::build_atlas()
 
     // There needs to be at least one atlas image, so the array of samplers can point to
     // the single image.
-    add_atlas_image();
+    _atlas_allocator.add_layer(0, [&](std::size_t layer, gfx_page_allocator::kind_type) {
+        add_atlas_image(layer, false);
+    });
 }
 
 inline void gfx_pipeline_image::device_shared::teardown_atlas(gfx_device const *old_device)
@@ -614,13 +1054,89 @@ inline void gfx_pipeline_image::device_shared::teardown_atlas(gfx_device const *
     old_device->destroy(atlas_sampler);
 
     for (const auto& atlas_texture : atlas_textures) {
+        if (atlas_texture.image) {
+            old_device->destroy(atlas_texture.view);
+            old_device->destroyImage(atlas_texture.image, atlas_texture.allocation, gfx_memory_category::image_atlas);
+        }
+    }
+    for (const auto& [frame, atlas_texture] : _retired_atlas_textures) {
         old_device->destroy(atlas_texture.view);
-        old_device->destroyImage(atlas_texture.image, atlas_texture.allocation);
+        old_device->destroyImage(atlas_texture.image, atlas_texture.allocation, gfx_memory_category::image_atlas);
     }
     atlas_textures.clear();
+    _retired_atlas_textures.clear();
+    atlas_descriptor_image_infos.clear();
+
+    for (auto& staging : staging_textures) {
+        old_device->unmapMemory(staging.texture.allocation);
+        old_device->destroyImage(staging.texture.image, staging.texture.allocation, gfx_memory_category::image_atlas);
+        staging.texture = {};
+
+        if (staging.compressed_buffer) {
+            old_device->unmapMemory(staging.compressed_allocation);
+            old_device->destroyBuffer(
+                staging.compressed_buffer, staging.compressed_allocation, gfx_memory_category::image_atlas);
+            staging.compressed_buffer = vk::Buffer{};
+            staging.compressed_blocks = {};
+        }
+    }
+    _compression_pixmap = {};
+}
 
-    old_device->unmapMemory(staging_texture.allocation);
-    old_device->destroyImage(staging_texture.image, staging_texture.allocation);
+inline void gfx_pipeline_image::device_shared::build_upload()
+{
+    if (device.supportsTimelineSemaphore) {
+        auto const semaphore_type_create_info = vk::SemaphoreTypeCreateInfo{vk::SemaphoreType::eTimeline, 0};
+        auto semaphore_create_info = vk::SemaphoreCreateInfo{};
+        semaphore_create_info.setPNext(&semaphore_type_create_info);
+        upload_semaphore = device.createSemaphore(semaphore_create_info);
+        _upload_queue = &device.get_transfer_queue();
+
+    } else {
+        hi_log_info("Timeline semaphores are not supported, images are uploaded synchronously.");
+        _upload_queue = &device.get_graphics_queue();
+    }
+
+    // When the transfer queue is in a different queue family, the images are shared concurrently
+    // between all queue families so that no queue family ownership transfers are needed.
+    _queue_family_indices.clear();
+    if (_upload_queue->family_queue_index != device.get_graphics_queue().family_queue_index) {
+        for (auto const& queue : device._queues) {
+            _queue_family_indices.push_back(queue.family_queue_index);
+        }
+    }
+
+    auto const command_buffers = device.allocateCommandBuffers(
+        {_upload_queue->command_pool, vk::CommandBufferLevel::ePrimary, narrow_cast<uint32_t>(staging_textures.size())});
+    for (auto i = 0_uz; i != staging_textures.size(); ++i) {
+        staging_textures[i].command_buffer = command_buffers.at(i);
+        staging_textures[i].upload_value = 0;
+    }
+    _staging_index = 0;
+    _upload_value = 0;
+    _completed_upload_value = 0;
+}
+
+inline void gfx_pipeline_image::device_shared::teardown_upload(gfx_device const *old_device)
+{
+    hi_assert_not_null(old_device);
+    hi_assert_not_null(_upload_queue);
+
+    // Wait for uploads that are still copying from the staging images, a lost device does not finish them.
+    if (not old_device->lost) {
+        _upload_queue->queue.waitIdle();
+    }
+
+    for (auto& staging : staging_textures) {
+        old_device->freeCommandBuffers(_upload_queue->command_pool, {staging.command_buffer});
+        staging.command_buffer = vk::CommandBuffer{};
+    }
+
+    if (upload_semaphore) {
+        old_device->destroy(upload_semaphore);
+        upload_semaphore = vk::Semaphore{};
+    }
+    _upload_queue = nullptr;
 }
 
 inline void gfx_pipeline_image::device_shared::place_vertices(
@@ -682,4 +1198,31 @@ inline void gfx_pipeline_image::device_shared::place_vertices(
     }
 }
 
+inline gfx_pipeline_image::paged_image const *
+gfx_pipeline_image::device_shared::get_glyph_image(gfx_device *device, hi::font_id font, glyph_id glyph) noexcept
+{
+    auto const lock = std::scoped_lock(gfx_system_mutex);
+
+    auto key = glyph_image_key{font, glyph};
+    if (auto const *image = _glyph_images.find(key)) {
+        ++global_counter<"image_pipeline:glyph:hit">;
+        return *image ? image : nullptr;
+    }
+    ++global_counter<"image_pipeline:glyph:miss">;
+
+    auto image = paged_image{};
+    try {
+        if (auto const bitmap = font->get_bitmap(glyph)) {
+            image = paged_image{device, pixmap_span<sfloat_rgba16 const>{bitmap->image}};
+        }
+    } catch (std::exception const& e) {
+        hi_log_error("Could not decode bitmap glyph {} of font '{}': {}", *glyph, font->family_name, e.what());
+    }
+
+    // Glyphs without a bitmap are cached as well, so that the font is only asked once.
+    auto const cost = std::max(std::size_t{1}, image.pages.size());
+    auto const& r = _glyph_images.insert(std::move(key), std::move(image), cost);
+    return r ? &r : nullptr;
+}
+
 }} // namespace hi::v1
@@ -5,13 +5,24 @@
 #pragma once
 
 #include "gfx_pipeline_vulkan_intf.hpp"
+#include "gfx_page_allocator.hpp"
+#include "gfx_queue_vulkan.hpp"
+#include "gfx_system_globals.hpp"
 #include "../container/container.hpp"
 #include "../geometry/geometry.hpp"
 #include "../image/image.hpp"
 #include "../codec/codec.hpp"
+#include "../font/font.hpp"
+#include "../dispatch/dispatch.hpp"
 #include "../macros.hpp"
 #include <vulkan/vulkan.hpp>
 #include <vma/vk_mem_alloc.h>
+#include <span>
+#include <array>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <cstdint>
 
 hi_export_module(hikogui.GFX : gfx_pipeline_image_intf);
 
@@ -74,11 +85,16 @@ public:
         vk::ImageView view;
         hi::pixmap_span<sfloat_rgba16> pixmap;
         vk::ImageLayout layout = vk::ImageLayout::eUndefined;
+        vk::Format format = vk::Format::eUndefined;
 
         void transitionLayout(const gfx_device& device, vk::Format format, vk::ImageLayout nextLayout);
     };
 
     /** This is a image that is uploaded into the texture atlas.
+     *
+     * The upload is done asynchronously on the transfer queue, the state of the
+     * image changes from drawing to uploaded when `is_uploaded()` finds that the
+     * transfer has finished.
      */
     struct paged_image {
         enum class state_type { uninitialized, drawing, uploaded };
@@ -91,6 +107,14 @@ public:
         std::size_t height;
         std::vector<std::size_t> pages;
 
+        /** The pages are located in compressed atlas images.
+         */
+        bool compressed = false;
+
+        /** The value of the upload semaphore that is signaled when the image is copied into the atlas.
+         */
+        uint64_t upload_value = 0;
+
         ~paged_image();
         constexpr paged_image() noexcept = default;
         paged_image(paged_image&& other) noexcept;
@@ -98,14 +122,34 @@ public:
         paged_image(paged_image const& other) = delete;
         paged_image& operator=(paged_image const& other) = delete;
 
-        paged_image(gfx_surface const *surface, std::size_t width, std::size_t height) noexcept;
-        paged_image(gfx_surface const *surface, pixmap_span<sfloat_rgba16 const> image) noexcept;
-        paged_image(gfx_surface const *surface, pixmap<sfloat_rgba16> const& image) noexcept :
-            paged_image(surface, pixmap_span<sfloat_rgba16 const>{image})
+        /** Allocate pages in the atlas for an image.
+         *
+         * @param surface The surface on which the image is drawn.
+         * @param width The width of the image in pixels.
+         * @param height The height of the image in pixels.
+         * @param compressed Store the image in BC3 compressed pages, this falls back to
+         *                   uncompressed pages when the device does not support it.
+         *                   Compressed pages use 1/8th of the memory, but are lossy and
+         *                   clamp the colors to the standard-dynamic-range.
+         */
+        paged_image(gfx_surface const *surface, std::size_t width, std::size_t height, bool compressed = false) noexcept;
+        paged_image(gfx_surface const *surface, pixmap_span<sfloat_rgba16 const> image, bool compressed = false) noexcept;
+        paged_image(gfx_surface const *surface, pixmap<sfloat_rgba16> const& image, bool compressed = false) noexcept :
+            paged_image(surface, pixmap_span<sfloat_rgba16 const>{image}, compressed)
         {
         }
 
-        paged_image(gfx_surface const *surface, png const& image) noexcept;
+        paged_image(gfx_surface const *surface, png const& image, bool compressed = false) noexcept;
+
+        /** Allocate pages in the atlas of a device and upload an image.
+         *
+         * This is used for images that are shared between the surfaces of a device.
+         *
+         * @param device The device on which the image is drawn.
+         * @param image The image to upload.
+         * @param compressed Store the image in BC3 compressed pages.
+         */
+        paged_image(gfx_device *device, pixmap_span<sfloat_rgba16 const> image, bool compressed = false) noexcept;
 
         [[nodiscard]] constexpr explicit operator bool() const noexcept
         {
@@ -131,6 +175,15 @@ public:
             return extent2{size / page_size_};
         }
 
+        /** Check if the image has been uploaded to the atlas.
+         *
+         * When the transfer queue has finished copying the image into the
+         * atlas the state is changed from drawing to uploaded.
+         *
+         * @return True when the image may be drawn.
+         */
+        [[nodiscard]] bool is_uploaded() const noexcept;
+
         /** Upload image to atlas.
          */
         void upload(pixmap_span<sfloat_rgba16 const> image) noexcept;
@@ -144,20 +197,112 @@ public:
         constexpr static std::size_t atlas_num_pages_per_axis = 8;
         constexpr static std::size_t atlas_num_pages_per_image = atlas_num_pages_per_axis * atlas_num_pages_per_axis;
         constexpr static std::size_t atlas_image_axis_size = atlas_num_pages_per_axis * (paged_image::page_size + 2);
-        constexpr static std::size_t atlas_maximum_num_images = 64;
+        constexpr static std::size_t atlas_maximum_num_images = 64; // Size of the descriptor array without bindless images.
         constexpr static std::size_t staging_image_width = 1024;
         constexpr static std::size_t staging_image_height = 1024;
 
+        /** The number of rows of pages that are uploaded from a single staging image.
+         *
+         * One row of pixels is needed below and above the pages for the border.
+         */
+        constexpr static std::size_t staging_num_page_rows = (staging_image_height - 2) / paged_image::page_size;
+
+        /** The maximum number of pages in a band.
+         */
+        constexpr static std::size_t staging_num_pages = staging_num_page_rows * ((staging_image_width - 2) / paged_image::page_size);
+
+        /** The number of compressed blocks along each axis of a page, including its border.
+         */
+        constexpr static std::size_t num_blocks_per_page_axis = (paged_image::page_size + 2) / srgb_bc3_block::block_width;
+        constexpr static std::size_t num_blocks_per_page = num_blocks_per_page_axis * num_blocks_per_page_axis;
+
+        /** The number of staging images.
+         *
+         * An image can be drawn into a staging image while the previous uploads
+         * are still being copied into the atlas.
+         */
+        constexpr static std::size_t num_staging_textures = 4;
+
+        /** The number of frames before freed pages can be allocated again.
+         *
+         * A page may still be read by a frame-in-flight after the image was freed.
+         */
+        constexpr static std::size_t num_retire_frames = 4;
+
+        /** The maximum number of pages used by the images of bitmap glyphs.
+         */
+        constexpr static std::size_t glyph_image_cache_capacity = 1024;
+
+        /** Notifier when a bitmap glyph could not be drawn because its image is still being uploaded.
+         */
+        static inline notifier<void()> glyph_image_pending;
+
+        /** Keep a copy of the atlas images in CPU memory.
+         *
+         * With the mirror the atlas is restored by uploading the mirror after the
+         * device was lost, without the images needing to be drawn again. The mirror
+         * uses the same amount of memory as the atlas images.
+         *
+         * @note Must be set before the first window is created.
+         */
+        static inline bool atlas_mirror_enabled = true;
+
         gfx_device const& device;
 
         vk::ShaderModule vertex_shader_module;
         vk::ShaderModule fragment_shader_module;
         std::vector<vk::PipelineShaderStageCreateInfo> shader_stages;
 
-        texture_map staging_texture;
+        /** The maximum number of atlas images, and the size of the descriptor array.
+         *
+         * This is passed as a specialization constant to the fragment shader.
+         */
+        int32_t atlas_num_images = 1;
+        vk::SpecializationMapEntry fragment_shader_specialization_map_entry;
+        vk::SpecializationInfo fragment_shader_specialization_info;
+
+        struct staging_texture_map {
+            texture_map texture;
+            vk::CommandBuffer command_buffer;
+
+            /** The value of the upload semaphore when the copy from this staging texture has finished.
+             */
+            uint64_t upload_value = 0;
+
+            /** A buffer with the compressed blocks of the pages of a band.
+             *
+             * Only allocated when the device supports compressed images.
+             */
+            vk::Buffer compressed_buffer;
+            VmaAllocation compressed_allocation = {};
+            std::span<srgb_bc3_block> compressed_blocks;
+        };
+
+        std::array<staging_texture_map, num_staging_textures> staging_textures;
+
+        /** The atlas images, indexed by the layer of the atlas allocator.
+         *
+         * The atlas image of a released layer is empty.
+         */
         std::vector<texture_map> atlas_textures;
 
-        std::array<vk::DescriptorImageInfo, atlas_maximum_num_images> atlas_descriptor_image_infos;
+        /** Incremented each time an atlas image is added or released, so that the descriptor set is updated.
+         */
+        std::size_t atlas_descriptor_version = 0;
+
+        /** The timeline semaphore that is signaled by the transfer queue when an upload has finished.
+         *
+         * This semaphore is empty when the device does not support timeline semaphores,
+         * in that case uploads are done synchronously.
+         */
+        vk::Semaphore upload_semaphore;
+
+        /** The descriptors of the atlas images.
+         *
+         * With bindless images there is a descriptor for each atlas image, otherwise
+         * there are `atlas_num_images` descriptors, repeating the first atlas image.
+         */
+        std::vector<vk::DescriptorImageInfo> atlas_descriptor_image_infos;
         vk::Sampler atlas_sampler;
         vk::DescriptorImageInfo atlas_sampler_descriptor_image_info;
 
@@ -174,14 +319,93 @@ public:
          */
         void destroy(gfx_device const *vulkanDevice);
 
+        /** Copy the atlas of the image pipeline of this device before it was lost.
+         *
+         * The allocation of the pages is copied and the atlas images are uploaded
+         * from the CPU-side mirror of @a other, so that the paged images remain valid.
+         * Nothing is copied when @a other has no mirror or belongs to another device, since
+         * a paged image refers to the image pipeline through its device.
+         *
+         * @pre `gfx_system_mutex` must be locked.
+         * @param other The pipeline of this device before it was lost.
+         * @return True if the atlas was copied.
+         */
+        bool copy_atlas_from(device_shared const& other) noexcept;
+
         /** Allocate pages from the atlas.
+         *
+         * The pages of an image are allocated in contiguous runs in as few atlas images as possible.
+         *
+         * @param num_pages The number of pages to allocate.
+         * @param compressed Allocate pages from the compressed atlas images.
+         * @return The pages, or empty when the pages do not fit in the budget of the atlas.
          */
-        std::vector<std::size_t> allocate_pages(std::size_t num_pages) noexcept;
+        std::vector<std::size_t> allocate_pages(std::size_t num_pages, bool compressed) noexcept;
 
         /** Deallocate pages back to the atlas.
          */
         void free_pages(std::vector<std::size_t> const& pages) noexcept;
 
+        /** Set the maximum number of atlas images.
+         *
+         * Atlas images that become empty are released until the atlas fits in the budget.
+         * Images that do not fit within the budget are not drawn.
+         *
+         * @pre `gfx_system_mutex` must be locked.
+         * @param num_images The maximum number of atlas images, clamped to the size of the descriptor array.
+         */
+        void set_atlas_budget(std::size_t num_images) noexcept
+        {
+            hi_axiom(gfx_system_mutex.recurse_lock_count());
+            _atlas_budget = num_images;
+            _atlas_allocator.set_budget(std::min(_atlas_budget, _atlas_pressure_budget));
+        }
+
+        /** The fraction of the pages within the budget of the atlas that is allocated.
+         *
+         * Pages that have been freed, but may still be used by a frame-in-flight, are counted as allocated.
+         *
+         * @pre `gfx_system_mutex` must be locked.
+         */
+        [[nodiscard]] float atlas_occupancy() const noexcept
+        {
+            hi_axiom(gfx_system_mutex.recurse_lock_count());
+            return _atlas_allocator.occupancy();
+        }
+
+        /** The number of atlas images that exist.
+         *
+         * @pre `gfx_system_mutex` must be locked.
+         */
+        [[nodiscard]] std::size_t atlas_num_layers() const noexcept
+        {
+            hi_axiom(gfx_system_mutex.recurse_lock_count());
+            return _atlas_allocator.num_layers();
+        }
+
+        /** Check if an upload has finished.
+         *
+         * @param value The value of the upload semaphore of the upload.
+         * @return True if the upload has finished.
+         */
+        [[nodiscard]] bool upload_completed(uint64_t value) noexcept;
+
+        /** The value of the upload semaphore of all the uploads that are known to have finished.
+         *
+         * The graphics queue waits on this value, so that the images that are drawn
+         * in the frame are visible to the fragment shader.
+         */
+        [[nodiscard]] uint64_t completed_upload_value() const noexcept
+        {
+            return _completed_upload_value;
+        }
+
+        /** Called at the start of each frame.
+         *
+         * Retired pages are returned to the free list, and empty atlas images are released.
+         */
+        void next_frame() noexcept;
+
         void draw_in_command_buffer(vk::CommandBuffer const& commandBuffer);
 
         /** Get the full staging pixel map excluding border.
@@ -190,10 +414,6 @@ public:
          */
         hi::pixmap_span<sfloat_rgba16> get_staging_pixmap();
 
-        /** Prepare the atlas so that it can be used as a texture map by the shaders.
-         */
-        void prepare_atlas_for_rendering();
-
         /** Place vertices for a single image.
          *
          * @pre The image is uploaded.
@@ -208,28 +428,197 @@ public:
             quad const& box,
             paged_image const& image) noexcept;
 
+        /** Get the image of a bitmap glyph, like the emoji of an 'sbix' or 'CBDT' font.
+         *
+         * The image is decoded and uploaded on first use, and is retained in a
+         * least-recently-used cache.
+         *
+         * @param device The device that owns this pipeline.
+         * @param font The font of the glyph.
+         * @param glyph The glyph in the font.
+         * @return The image of the glyph, or nullptr if the glyph has no bitmap.
+         */
+        [[nodiscard]] paged_image const *get_glyph_image(gfx_device *device, hi::font_id font, glyph_id glyph) noexcept;
+
     private:
-        std::vector<std::size_t> _atlas_free_pages;
+        /** Lower the budget of the atlas while the memory of the device is running low.
+         *
+         * @param excess The number of bytes to release, or zero when the pressure is relieved.
+         */
+        void on_memory_pressure(std::size_t excess) noexcept;
+
+        struct glyph_image_key {
+            hi::font_id font;
+            glyph_id glyph;
+
+            [[nodiscard]] friend bool operator==(glyph_image_key const&, glyph_image_key const&) noexcept = default;
+        };
+
+        struct glyph_image_key_hash {
+            [[nodiscard]] std::size_t operator()(glyph_image_key const& rhs) const noexcept
+            {
+                return hash_mix(rhs.font, rhs.glyph);
+            }
+        };
+
+        /** The images of bitmap glyphs, glyphs without a bitmap are stored as an empty image.
+         */
+        lru_cache<glyph_image_key, paged_image, glyph_image_key_hash> _glyph_images{glyph_image_cache_capacity};
+
+        /** The allocator of the pages in the atlas images.
+         *
+         * The kind of a layer is 1 for compressed atlas images, 0 otherwise.
+         */
+        gfx_page_allocator _atlas_allocator;
+
+        /** The number of atlas images set with `set_atlas_budget()`.
+         */
+        std::size_t _atlas_budget = std::numeric_limits<std::size_t>::max();
+
+        /** The number of atlas images while the memory of the device is running low.
+         */
+        std::size_t _atlas_pressure_budget = std::numeric_limits<std::size_t>::max();
+
+        notifier<void(std::size_t)>::callback_type _memory_pressure_cbt;
+
+        /** The image that compressed pages are drawn into before they are compressed.
+         *
+         * When the atlas is mirrored, the uncompressed pages are drawn into this image
+         * as well, before they are copied into the staging image.
+         *
+         * The staging images are written through uncached memory, which is too slow
+         * to read back when compressing or mirroring.
+         */
+        pixmap<sfloat_rgba16> _compression_pixmap;
+
+        /** A copy of an atlas image in CPU memory.
+         *
+         * Depending on the format of the atlas image either the pixels or the compressed
+         * blocks are used.
+         */
+        struct atlas_mirror_type {
+            pixmap<sfloat_rgba16> pixels;
+            pixmap<srgb_bc3_block> blocks;
+        };
+
+        /** The mirrors of the atlas images, indexed by the layer of the atlas allocator.
+         *
+         * The mirror is kept when the Vulkan objects are destroyed, so that the atlas
+         * can be restored after the device was lost.
+         */
+        std::vector<atlas_mirror_type> _atlas_mirror;
+
+        /** The value of `atlas_mirror_enabled` when this pipeline was created.
+         */
+        bool _mirror_atlas = false;
+
+        /** Atlas images that were released, together with the frame count when they were released.
+         *
+         * The atlas image may still be bound to the descriptor set of a frame-in-flight.
+         */
+        std::vector<std::pair<std::size_t, texture_map>> _retired_atlas_textures;
+        std::size_t _frame_count = 0;
+
+        /** The queue families that access the atlas and staging images.
+         */
+        std::vector<uint32_t> _queue_family_indices;
+
+        /** The queue on which the images are copied into the atlas.
+         */
+        gfx_queue_vulkan const *_upload_queue = nullptr;
+
+        std::size_t _staging_index = 0;
+        uint64_t _upload_value = 0;
+        uint64_t _completed_upload_value = 0;
+
+        [[nodiscard]] texture_map& current_staging_texture() noexcept
+        {
+            return staging_textures[_staging_index].texture;
+        }
 
-        /** Get a submap of the staging pixel map to draw the image in.
+        /** The pixmap that a band of an image is drawn into.
+         *
+         * Compressed images, and all images when the atlas is mirrored, are drawn into the
+         * compression pixmap, other images directly into the current staging texture.
+         */
+        [[nodiscard]] pixmap_span<sfloat_rgba16> staging_pixmap(paged_image const& image) noexcept
+        {
+            if (image.compressed or _mirror_atlas) {
+                return _compression_pixmap;
+            } else {
+                return current_staging_texture().pixmap;
+            }
+        }
+
+        /** Select the next staging texture.
+         *
+         * This waits until the previous copy from this staging texture has finished.
+         */
+        void next_staging_texture();
+
+        /** Draw an image in bands into the staging images and copy each band into the atlas.
+         *
+         * Each band is a number of rows of pages that fits in a staging image. Together with the
+         * band the row of pixels below and above it are drawn, which become the border of the pages.
+         * This means that images that are taller than a staging image can be uploaded, without
+         * first decoding the image into a separate pixmap.
+         *
+         * @param image The paged image to upload.
+         * @param draw_rows The function `void(std::size_t first_row, pixmap_span<sfloat_rgba16> rows)`
+         *                  that draws the rows of the image starting at @a first_row, counted from the bottom.
+         * @return The value of the upload semaphore when the copy of the last band has finished.
          */
-        hi::pixmap_span<sfloat_rgba16> get_staging_pixmap(std::size_t width, std::size_t height)
+        template<typename DrawRows>
+        [[nodiscard]] uint64_t upload_in_bands(paged_image const& image, DrawRows const& draw_rows)
         {
-            return get_staging_pixmap().subimage(0, 0, width, height);
+            hi_axiom(gfx_system_mutex.recurse_lock_count());
+            hi_assert(image.width <= staging_image_width - 2);
+
+            auto const [num_columns, num_rows] = image.size_in_int_pages();
+
+            auto r = uint64_t{0};
+            for (auto first_page_row = 0_uz; first_page_row < num_rows; first_page_row += staging_num_page_rows) {
+                auto const num_page_rows = std::min(staging_num_page_rows, num_rows - first_page_row);
+
+                // Include the row of pixels below and above the band, except at the edge of the image.
+                auto const band_first = first_page_row * paged_image::page_size;
+                auto const band_last = std::min((first_page_row + num_page_rows) * paged_image::page_size, image.height);
+                auto const draw_first = band_first == 0 ? band_first : band_first - 1;
+                auto const draw_last = band_last == image.height ? band_last : band_last + 1;
+
+                next_staging_texture();
+                auto const draw_y = draw_first + 1 - band_first;
+                draw_rows(draw_first, staging_pixmap(image).subimage(1, draw_y, image.width, draw_last - draw_first));
+
+                prepare_staging_for_upload(image, band_last - band_first, band_first == 0, band_last == image.height);
+                r = update_atlas_with_staging_pixmap(image, first_page_row, num_page_rows);
+            }
+            return r;
         }
 
         /** Add a transparent border around the image.
          *
+         * @param staging_pixmap The pixmap that the band of the image was drawn into.
          * @param border_rectangle The rectangle of the border, the image-rectangle is inside this 1 pixel border.
+         * @param bottom_edge The bottom of the border is the edge of the image.
+         * @param top_edge The top of the border is the edge of the image.
          */
-        void make_staging_border_transparent(aarectangle border_rectangle) noexcept;
+        void make_staging_border_transparent(
+            pixmap_span<sfloat_rgba16> staging_pixmap,
+            aarectangle border_rectangle,
+            bool bottom_edge,
+            bool top_edge) noexcept;
 
         /** Clear the area between the border rectangle and upload rectangle.
          *
+         * @param staging_pixmap The pixmap that the band of the image was drawn into.
          * @param border_rectangle The rectangle where the border is located.
          * @param upload_rectangle The rectangle which will be uploaded to the atlas.
          */
-        void clear_staging_between_border_and_upload(aarectangle border_rectangle, aarectangle upload_rectangle) noexcept;
+        void clear_staging_between_border_and_upload(
+            pixmap_span<sfloat_rgba16> staging_pixmap,
+            aarectangle border_rectangle,
+            aarectangle upload_rectangle) noexcept;
 
         /** Prepare the staging image for upload.
          *
@@ -238,26 +627,78 @@ public:
          *    with the alpha channel set to zero.
          *  * On the right and upper edge the pixels are set to transparent-black up to
          *    a multiple of the `paged_image::page_size`.
-         *  * flush the image to the GPU
-         *  * transition the image for transferring to the atlas.
+         *  * flush the image to the GPU, compressed images are flushed after compression.
+         *
+         * @param image The image being uploaded.
+         * @param band_height The number of rows of pixels of the band in the staging image.
+         * @param bottom_edge The band is at the bottom of the image.
+         * @param top_edge The band is at the top of the image.
          */
-        void prepare_staging_for_upload(paged_image const& image) noexcept;
+        void
+        prepare_staging_for_upload(paged_image const& image, std::size_t band_height, bool bottom_edge, bool top_edge) noexcept;
 
-        /** Copy the image from the staging pixel map into the atlas.
+        /** Copy a band of the image from the staging pixel map into the atlas.
+         *
+         * The copy is submitted on the transfer queue without waiting for it to finish.
+         * The pages of a compressed image are first compressed into the buffer of the
+         * staging texture, then copied from the buffer into the atlas.
+         *
+         * @param image The image being uploaded.
+         * @param first_page_row The first row of pages of the band.
+         * @param num_page_rows The number of rows of pages in the band.
+         * @return The value of the upload semaphore when the copy has finished.
          */
-        void update_atlas_with_staging_pixmap(paged_image const& image) noexcept;
+        [[nodiscard]] uint64_t update_atlas_with_staging_pixmap(
+            paged_image const& image,
+            std::size_t first_page_row,
+            std::size_t num_page_rows) noexcept;
+
+        /** Submit the copies from the current staging texture into the atlas on the transfer queue.
+         *
+         * @param regions_per_atlas_texture The regions to copy from the staging image, for each atlas image.
+         * @param buffer_regions_per_atlas_texture The regions to copy from the compressed staging buffer,
+         *                                         for each atlas image.
+         * @return The value of the upload semaphore when the copy has finished.
+         */
+        [[nodiscard]] uint64_t submit_staging_upload(
+            std::vector<std::vector<vk::ImageCopy>> const& regions_per_atlas_texture,
+            std::vector<std::vector<vk::BufferImageCopy>> const& buffer_regions_per_atlas_texture) noexcept;
+
+        /** Upload the mirror of an atlas image into the atlas image.
+         *
+         * @param layer The layer of the atlas allocator.
+         * @return The value of the upload semaphore when the copy has finished.
+         */
+        [[nodiscard]] uint64_t upload_atlas_mirror(std::size_t layer) noexcept;
 
         void build_shaders();
         void teardown_shaders(gfx_device const *device);
-        void add_atlas_image();
+        void add_atlas_image(std::size_t layer, bool compressed);
+        void remove_atlas_image(std::size_t layer);
+        void update_atlas_descriptors();
         void build_atlas();
         void teardown_atlas(gfx_device const *device);
+        void build_upload();
+        void teardown_upload(gfx_device const *device);
 
         friend paged_image;
     };
 
     vector_span<vertex> vertexBufferData;
 
+    /** Use a region of the surface's vertex ring for the vertices of the next frame.
+     *
+     * @param buffer The vertex ring buffer.
+     * @param offset The offset in bytes of the region in the buffer.
+     * @param data The persistently mapped memory of the region.
+     */
+    void set_vertex_buffer(vk::Buffer buffer, vk::DeviceSize offset, std::span<vertex> data) noexcept
+    {
+        vertexBuffer = buffer;
+        vertexBufferOffset = offset;
+        vertexBufferData = vector_span<vertex>{data};
+    }
+
     ~gfx_pipeline_image() = default;
     gfx_pipeline_image(const gfx_pipeline_image&) = delete;
     gfx_pipeline_image& operator=(const gfx_pipeline_image&) = delete;
@@ -273,19 +714,16 @@ private:
     int numberOfAtlasImagesInDescriptor = 0;
 
     vk::Buffer vertexBuffer;
-    VmaAllocation vertexBufferAllocation;
+    vk::DeviceSize vertexBufferOffset = 0;
 
     [[nodiscard]] std::vector<vk::PipelineShaderStageCreateInfo> createShaderStages() const override;
     [[nodiscard]] std::vector<vk::DescriptorSetLayoutBinding> createDescriptorSetLayoutBindings() const override;
     [[nodiscard]] std::vector<vk::WriteDescriptorSet> createWriteDescriptorSet() const override;
     [[nodiscard]] size_t getDescriptorSetVersion() const override;
+    [[nodiscard]] std::vector<vk::DescriptorBindingFlags> createDescriptorSetLayoutBindingFlags() const override;
     [[nodiscard]] std::vector<vk::PushConstantRange> createPushConstantRanges() const override;
     [[nodiscard]] vk::VertexInputBindingDescription createVertexInputBindingDescription() const override;
     [[nodiscard]] std::vector<vk::VertexInputAttributeDescription> createVertexInputAttributeDescriptions() const override;
-
-private:
-    void build_vertex_buffers() override;
-    void teardown_vertex_buffers() override;
 };
 
 }} // namespace hi::v1
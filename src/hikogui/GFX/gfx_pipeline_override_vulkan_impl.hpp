@@ -36,13 +36,17 @@ inline std::vector<vk::PipelineColorBlendAttachmentState> gfx_pipeline_override:
 
 inline void gfx_pipeline_override::draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const& context)
 {
+    if (vertexBufferData.empty()) {
+        // Nothing to draw, the pipeline is compiled lazily on first use.
+        return;
+    }
+
     gfx_pipeline::draw_in_command_buffer(commandBuffer, context);
 
     hi_axiom_not_null(device());
-    device()->flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof(vertex));
 
     std::vector<vk::Buffer> tmpvertexBuffers = {vertexBuffer};
-    std::vector<vk::DeviceSize> tmpOffsets = {0};
+    std::vector<vk::DeviceSize> tmpOffsets = {vertexBufferOffset};
     hi_assert(tmpvertexBuffers.size() == tmpOffsets.size());
 
     device()->override_pipeline->drawInCommandBuffer(commandBuffer);
@@ -102,34 +106,6 @@ inline std::vector<vk::VertexInputAttributeDescription> gfx_pipeline_override::c
     return vertex::inputAttributeDescriptions();
 }
 
-inline void gfx_pipeline_override::build_vertex_buffers()
-{
-    using vertexIndexType = uint16_t;
-    constexpr ssize_t numberOfVertices = 1 << (sizeof(vertexIndexType) * CHAR_BIT);
-
-    vk::BufferCreateInfo const bufferCreateInfo = {
-        vk::BufferCreateFlags(),
-        sizeof(vertex) * numberOfVertices,
-        vk::BufferUsageFlagBits::eVertexBuffer,
-        vk::SharingMode::eExclusive};
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
-    allocationCreateInfo.pUserData = const_cast<char *>("alpha-pipeline vertex buffer");
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-
-    hi_axiom_not_null(device());
-    std::tie(vertexBuffer, vertexBufferAllocation) = device()->createBuffer(bufferCreateInfo, allocationCreateInfo);
-    device()->setDebugUtilsObjectNameEXT(vertexBuffer, "alpha-pipeline vertex buffer");
-    vertexBufferData = device()->mapMemory<vertex>(vertexBufferAllocation);
-}
-
-inline void gfx_pipeline_override::teardown_vertex_buffers()
-{
-    hi_axiom_not_null(device());
-    device()->unmapMemory(vertexBufferAllocation);
-    device()->destroyBuffer(vertexBuffer, vertexBufferAllocation);
-}
-
 inline gfx_pipeline_override::device_shared::device_shared(gfx_device const& device) : device(device)
 {
     buildShaders();
@@ -106,6 +106,19 @@ public:
 
     vector_span<vertex> vertexBufferData;
 
+    /** Use a region of the surface's vertex ring for the vertices of the next frame.
+     *
+     * @param buffer The vertex ring buffer.
+     * @param offset The offset in bytes of the region in the buffer.
+     * @param data The persistently mapped memory of the region.
+     */
+    void set_vertex_buffer(vk::Buffer buffer, vk::DeviceSize offset, std::span<vertex> data) noexcept
+    {
+        vertexBuffer = buffer;
+        vertexBufferOffset = offset;
+        vertexBufferData = vector_span<vertex>{data};
+    }
+
     ~gfx_pipeline_override() = default;
     gfx_pipeline_override(const gfx_pipeline_override&) = delete;
     gfx_pipeline_override& operator=(const gfx_pipeline_override&) = delete;
@@ -120,7 +133,7 @@ protected:
     push_constants pushConstants;
 
     vk::Buffer vertexBuffer;
-    VmaAllocation vertexBufferAllocation;
+    vk::DeviceSize vertexBufferOffset = 0;
 
     [[nodiscard]] std::vector<vk::PipelineColorBlendAttachmentState> getPipelineColorBlendAttachmentStates() const override;
     [[nodiscard]] std::vector<vk::PipelineShaderStageCreateInfo> createShaderStages() const override;
@@ -130,10 +143,6 @@ protected:
     [[nodiscard]] std::vector<vk::PushConstantRange> createPushConstantRanges() const override;
     [[nodiscard]] vk::VertexInputBindingDescription createVertexInputBindingDescription() const override;
     [[nodiscard]] std::vector<vk::VertexInputAttributeDescription> createVertexInputAttributeDescriptions() const override;
-
-private:
-    void build_vertex_buffers() override;
-    void teardown_vertex_buffers() override;
 };
 
 }} // namespace hi::v1
@@ -9,6 +9,7 @@
 #include "gfx_surface_vulkan_intf.hpp"
 #include "../telemetry/telemetry.hpp"
 #include "../macros.hpp"
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <vulkan/vulkan.hpp>
@@ -25,11 +26,29 @@ hi_export namespace hi { inline namespace v1 {
 
 inline void gfx_pipeline::draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const& context)
 {
-    commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, intrinsic);
+    if (not intrinsic) {
+        // Lazily compile the pipelines that were not needed for the first frame.
+        auto const t = trace<"gfx_pipeline:lazy_build">{};
+        build_pipeline();
+    }
 
-    if (descriptorSet) {
-        if (descriptorSetVersion < getDescriptorSetVersion()) {
-            descriptorSetVersion = getDescriptorSetVersion();
+    hi_axiom_not_null(surface);
+    if (surface->bypass_tone_mapper()) {
+        hi_axiom(direct_intrinsic);
+        commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, direct_intrinsic);
+    } else {
+        commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, intrinsic);
+    }
+
+    if (not descriptorSets.empty()) {
+        hi_axiom_not_null(surface);
+        auto const frame = surface->frame_in_flight_index();
+        hi_axiom_bounds(frame, descriptorSets);
+
+        // The writes of createWriteDescriptorSet() are done on the descriptor set of the current frame.
+        descriptorSet = descriptorSets[frame];
+        if (descriptorSetVersions[frame] < getDescriptorSetVersion()) {
+            descriptorSetVersions[frame] = getDescriptorSetVersion();
 
             hi_axiom_not_null(device());
             device()->updateDescriptorSets(createWriteDescriptorSet(), {});
@@ -46,40 +65,56 @@ inline void gfx_pipeline::build_descriptor_sets()
     if (ssize(descriptorSetLayoutBindings) == 0) {
         // Make sure that there is no descriptor set.
         descriptorSet = nullptr;
+        descriptorSets.clear();
+        descriptorSetVersions.clear();
         return;
     }
 
-    auto const descriptorSetLayoutCreateInfo = vk::DescriptorSetLayoutCreateInfo{
+    hi_axiom_not_null(surface);
+    auto const num_frames = surface->num_frames_in_flight();
+
+    auto const descriptorSetLayoutBindingFlags = createDescriptorSetLayoutBindingFlags();
+    auto const update_after_bind = not descriptorSetLayoutBindingFlags.empty();
+    hi_assert(not update_after_bind or descriptorSetLayoutBindingFlags.size() == descriptorSetLayoutBindings.size());
+
+    auto const descriptorSetLayoutBindingFlagsCreateInfo = vk::DescriptorSetLayoutBindingFlagsCreateInfo{
+        narrow_cast<uint32_t>(descriptorSetLayoutBindingFlags.size()), descriptorSetLayoutBindingFlags.data()};
+
+    auto descriptorSetLayoutCreateInfo = vk::DescriptorSetLayoutCreateInfo{
         vk::DescriptorSetLayoutCreateFlags(),
         narrow_cast<uint32_t>(descriptorSetLayoutBindings.size()),
         descriptorSetLayoutBindings.data()};
+    if (update_after_bind) {
+        descriptorSetLayoutCreateInfo.setFlags(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool);
+        descriptorSetLayoutCreateInfo.setPNext(&descriptorSetLayoutBindingFlagsCreateInfo);
+    }
 
     hi_axiom_not_null(device());
     descriptorSetLayout = device()->createDescriptorSetLayout(descriptorSetLayoutCreateInfo);
 
-    auto const descriptorPoolSizes =
-        transform<std::vector<vk::DescriptorPoolSize>>(descriptorSetLayoutBindings, [](auto x) -> vk::DescriptorPoolSize {
-            return {x.descriptorType, narrow_cast<uint32_t>(x.descriptorCount)};
+    auto const descriptorPoolSizes = transform<std::vector<vk::DescriptorPoolSize>>(
+        descriptorSetLayoutBindings, [num_frames](auto x) -> vk::DescriptorPoolSize {
+            return {x.descriptorType, narrow_cast<uint32_t>(x.descriptorCount * num_frames)};
         });
 
     descriptorPool = device()->createDescriptorPool(
-        {vk::DescriptorPoolCreateFlags(),
-         1, // maxSets
+        {update_after_bind ? vk::DescriptorPoolCreateFlags{vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind} :
+                            vk::DescriptorPoolCreateFlags{},
+         narrow_cast<uint32_t>(num_frames), // maxSets
          narrow_cast<uint32_t>(descriptorPoolSizes.size()),
          descriptorPoolSizes.data()});
 
-    auto const descriptorSetLayouts = std::array{descriptorSetLayout};
+    auto const descriptorSetLayouts = std::vector<vk::DescriptorSetLayout>(num_frames, descriptorSetLayout);
 
-    auto const descriptorSets = device()->allocateDescriptorSets(
+    descriptorSets = device()->allocateDescriptorSets(
         {descriptorPool, narrow_cast<uint32_t>(descriptorSetLayouts.size()), descriptorSetLayouts.data()});
-
+    descriptorSetVersions.assign(num_frames, 0);
     descriptorSet = descriptorSets.at(0);
-    descriptorSetVersion = 0;
 }
 
 inline void gfx_pipeline::teardown_descriptor_sets()
 {
-    if (!descriptorSet) {
+    if (descriptorSets.empty()) {
         return;
     }
 
@@ -87,6 +122,8 @@ inline void gfx_pipeline::teardown_descriptor_sets()
     device()->destroy(descriptorPool);
     device()->destroy(descriptorSetLayout);
     descriptorSet = nullptr;
+    descriptorSets.clear();
+    descriptorSetVersions.clear();
 }
 
 inline vk::PipelineDepthStencilStateCreateInfo gfx_pipeline::getPipelineDepthStencilStateCreateInfo() const
@@ -122,9 +159,16 @@ inline std::vector<vk::PipelineColorBlendAttachmentState> gfx_pipeline::getPipel
              vk::ColorComponentFlagBits::eA}};
 }
 
-inline void gfx_pipeline::build_pipeline(vk::RenderPass renderPass, uint32_t renderSubpass, vk::Extent2D _extent)
+inline void gfx_pipeline::build_pipeline(
+    vk::RenderPass _renderPass,
+    uint32_t _renderSubpass,
+    vk::Extent2D _extent,
+    vk::RenderPass _directRenderPass)
 {
     hi_log_info("buildPipeline previous size ({}, {})", extent.width, extent.height);
+    renderPass = _renderPass;
+    renderSubpass = _renderSubpass;
+    directRenderPass = _directRenderPass;
     extent = _extent;
 
     const auto pushConstantRanges = createPushConstantRanges();
@@ -212,7 +256,9 @@ inline void gfx_pipeline::build_pipeline(vk::RenderPass renderPass, uint32_t ren
         narrow_cast<uint32_t>(pipelineColorBlendAttachmentStates.size()),
         pipelineColorBlendAttachmentStates.data()};
 
-    auto const dynamicStates = std::array{vk::DynamicState::eScissor};
+    // The viewport and scissor are set when filling the command buffer, so that the
+    // pipeline does not need to be rebuild when the swapchain is resized.
+    auto const dynamicStates = std::array{vk::DynamicState::eViewport, vk::DynamicState::eScissor};
 
     auto const pipelineDynamicStateInfo = vk::PipelineDynamicStateCreateInfo{
         vk::PipelineDynamicStateCreateFlags(), narrow_cast<uint32_t>(dynamicStates.size()), dynamicStates.data()};
@@ -238,7 +284,15 @@ inline void gfx_pipeline::build_pipeline(vk::RenderPass renderPass, uint32_t ren
     };
 
     hi_axiom_not_null(device());
-    intrinsic = device()->createGraphicsPipeline(vk::PipelineCache(), graphicsPipelineCreateInfo);
+    intrinsic = device()->createGraphicsPipeline(device()->pipeline_cache, graphicsPipelineCreateInfo);
+
+    if (directRenderPass) {
+        // The direct render pass has the same subpasses, but with the swapchain as color attachment.
+        // A pipeline can only be used with a render pass that has the same attachment formats.
+        auto directGraphicsPipelineCreateInfo = graphicsPipelineCreateInfo;
+        directGraphicsPipelineCreateInfo.renderPass = directRenderPass;
+        direct_intrinsic = device()->createGraphicsPipeline(device()->pipeline_cache, directGraphicsPipelineCreateInfo);
+    }
     hi_log_info("/buildPipeline new size ({}, {})", extent.width, extent.height);
 }
 
@@ -246,7 +300,11 @@ inline void gfx_pipeline::teardown_pipeline()
 {
     hi_axiom_not_null(device());
     device()->destroy(intrinsic);
+    intrinsic = vk::Pipeline{};
+    device()->destroy(direct_intrinsic);
+    direct_intrinsic = vk::Pipeline{};
     device()->destroy(pipelineLayout);
+    pipelineLayout = vk::PipelineLayout{};
 }
 
 inline void gfx_pipeline::build_for_new_device()
@@ -259,18 +317,43 @@ inline void gfx_pipeline::teardown_for_device_lost()
     teardown_vertex_buffers();
 }
 
-inline void gfx_pipeline::build_for_new_swapchain(vk::RenderPass renderPass, uint32_t renderSubpass, vk::Extent2D _extent)
+inline void gfx_pipeline::build_for_new_swapchain(
+    vk::RenderPass _renderPass,
+    uint32_t _renderSubpass,
+    vk::Extent2D _extent,
+    vk::RenderPass _directRenderPass)
 {
     // Input attachments described by the descriptor set will change when a
     // new swap chain is created.
     build_descriptor_sets();
-    build_pipeline(renderPass, renderSubpass, _extent);
+
+    renderPass = _renderPass;
+    renderSubpass = _renderSubpass;
+    directRenderPass = _directRenderPass;
+    extent = _extent;
+}
+
+inline void gfx_pipeline::resize_for_swapchain(vk::Extent2D _extent) noexcept
+{
+    extent = _extent;
+
+    // The image views of the input attachments have been recreated with the new size.
+    std::fill(descriptorSetVersions.begin(), descriptorSetVersions.end(), 0);
+}
+
+inline void gfx_pipeline::build_pipeline()
+{
+    hi_assert(renderPass);
+    hi_assert(not intrinsic);
+    build_pipeline(renderPass, renderSubpass, extent, directRenderPass);
 }
 
 inline void gfx_pipeline::teardown_for_swapchain_lost()
 {
     teardown_pipeline();
     teardown_descriptor_sets();
+    renderPass = vk::RenderPass{};
+    directRenderPass = vk::RenderPass{};
 }
 
 }} // namespace hi::inline v1
@@ -19,6 +19,14 @@ class draw_context;
 class gfx_pipeline {
 public:
     vk::Pipeline intrinsic;
+
+    /** The pipeline for the render pass that renders directly into the swapchain.
+     *
+     * Only build when the surface has a direct render pass, it is used instead
+     * of `intrinsic` on frames that bypass the tone-mapper.
+     */
+    vk::Pipeline direct_intrinsic;
+
     gfx_surface *surface = nullptr;
 
     gfx_pipeline(gfx_surface *surface) : surface(surface) {}
@@ -33,13 +41,60 @@ public:
 
     void build_for_new_device();
     void teardown_for_device_lost();
-    void build_for_new_swapchain(vk::RenderPass renderPass, uint32_t renderSubpass, vk::Extent2D extent);
+    /** Prepare the pipeline for a new swapchain.
+     *
+     * This builds the descriptor sets and records the render passes, the
+     * pipeline itself is compiled by `build_pipeline()`.
+     */
+    void build_for_new_swapchain(
+        vk::RenderPass renderPass,
+        uint32_t renderSubpass,
+        vk::Extent2D extent,
+        vk::RenderPass directRenderPass = vk::RenderPass{});
     void teardown_for_swapchain_lost();
 
+    /** Update the pipeline for a swapchain that was recreated with a new size.
+     *
+     * The render passes and the formats of the swapchain remain the same, so the
+     * compiled pipeline is kept; the viewport and scissor are dynamic state.
+     * The descriptor sets are rewritten before they are next used.
+     */
+    void resize_for_swapchain(vk::Extent2D extent) noexcept;
+
+    /** Compile the pipeline for the render passes of the current swapchain.
+     *
+     * Pipelines may be compiled concurrently on different threads, compiling
+     * does not require the `gfx_system_mutex` to be held. When the pipeline
+     * was not compiled when the swapchain was build it is compiled when it
+     * is first used in `draw_in_command_buffer()`.
+     *
+     * @pre `build_for_new_swapchain()` was called.
+     */
+    void build_pipeline();
+
+    /** Check if the pipeline was compiled for the current swapchain.
+     */
+    [[nodiscard]] bool has_pipeline() const noexcept
+    {
+        return static_cast<bool>(intrinsic);
+    }
+
 protected:
+    /** The descriptor set of the current frame-in-flight.
+     */
     vk::DescriptorSet descriptorSet;
-    size_t descriptorSetVersion = 0;
+
+    /** A descriptor set for each frame-in-flight.
+     *
+     * A descriptor set may not be updated while a command buffer that uses it is
+     * pending, therefor each frame-in-flight has its own descriptor set.
+     */
+    std::vector<vk::DescriptorSet> descriptorSets;
+    std::vector<size_t> descriptorSetVersions;
     vk::Extent2D extent;
+    vk::RenderPass renderPass;
+    uint32_t renderSubpass = 0;
+    vk::RenderPass directRenderPass;
     vk::DescriptorSetLayout descriptorSetLayout;
     vk::PipelineLayout pipelineLayout;
     vk::DescriptorPool descriptorPool;
@@ -50,6 +105,19 @@ protected:
     [[nodiscard]] virtual std::vector<vk::DescriptorSetLayoutBinding> createDescriptorSetLayoutBindings() const = 0;
     [[nodiscard]] virtual std::vector<vk::WriteDescriptorSet> createWriteDescriptorSet() const = 0;
     [[nodiscard]] virtual size_t getDescriptorSetVersion() const = 0;
+
+    /** The binding flags for each of the bindings of createDescriptorSetLayoutBindings().
+     *
+     * When a pipeline returns binding flags the descriptor set layout and pool are
+     * created for update-after-bind.
+     *
+     * @return A list of binding flags, or an empty list when no flags are needed.
+     */
+    [[nodiscard]] virtual std::vector<vk::DescriptorBindingFlags> createDescriptorSetLayoutBindingFlags() const
+    {
+        return {};
+    }
+
     [[nodiscard]] virtual std::vector<vk::PushConstantRange> createPushConstantRanges() const
     {
         return {};
@@ -70,7 +138,11 @@ protected:
     virtual void teardown_vertex_buffers(){};
     virtual void build_descriptor_sets();
     virtual void teardown_descriptor_sets();
-    virtual void build_pipeline(vk::RenderPass renderPass, uint32_t renderSubpass, vk::Extent2D extent);
+    virtual void build_pipeline(
+        vk::RenderPass renderPass,
+        uint32_t renderSubpass,
+        vk::Extent2D extent,
+        vk::RenderPass directRenderPass);
     virtual void teardown_pipeline();
 };
 
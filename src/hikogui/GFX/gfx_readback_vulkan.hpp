@@ -0,0 +1,421 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "gfx_device_vulkan_intf.hpp"
+#include "../image/image.hpp"
+#include "../geometry/geometry.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../time/time.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vulkan/vulkan.hpp>
+#include <vma/vk_mem_alloc.h>
+#include <functional>
+#include <vector>
+#include <array>
+#include <span>
+#include <chrono>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.GFX : gfx_readback);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Copy the rendered images of a surface back to the CPU.
+ *
+ * After the render pass a region of the swapchain image is copied into a
+ * host-visible buffer of the frame-in-flight, in the same command buffer.
+ * The buffer is read once the fence of the frame-in-flight is signaled,
+ * which is checked without waiting; a readback never stalls the render loop.
+ *
+ * A frame is only read back when it is rendered. When nothing in the window
+ * was redrawn, the last delivered pixmap is still up to date.
+ */
+class gfx_readback {
+public:
+    /** Called with the pixels of the region, with the sRGB transfer function.
+     *
+     * The callback is called on the thread that renders the surface while the
+     * `gfx_system_mutex` is locked. Expensive work, like encoding the pixmap,
+     * should be handed off to another thread.
+     */
+    using callback_type = std::function<void(pixmap<srgb_abgr8_pack>)>;
+
+    gfx_readback() noexcept = default;
+    gfx_readback(gfx_readback const&) = delete;
+    gfx_readback(gfx_readback&&) = delete;
+    gfx_readback& operator=(gfx_readback const&) = delete;
+    gfx_readback& operator=(gfx_readback&&) = delete;
+
+    ~gfx_readback()
+    {
+        hi_assert(_slots.empty());
+    }
+
+    /** Read back the surface periodically.
+     *
+     * @param region The region of the surface in pixels, with the origin at the
+     *               bottom-left. An empty region reads back the whole surface.
+     * @param interval The minimum time between the frames that are read back,
+     *                 for example 200ms for 5 frames per second. With zero
+     *                 every rendered frame is read back.
+     * @param callback Called with the pixels of each frame that was read back.
+     */
+    void start(aarectangle region, std::chrono::nanoseconds interval, callback_type callback) noexcept
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        hi_assert(interval >= std::chrono::nanoseconds{0});
+
+        _region = region;
+        _interval = interval;
+        _callback = std::move(callback);
+        _once = false;
+        _next_time_point = {};
+    }
+
+    /** Read back the next rendered frame once.
+     *
+     * @param region The region of the surface in pixels, with the origin at the
+     *               bottom-left. An empty region reads back the whole surface.
+     * @param callback Called with the pixels of the frame.
+     */
+    void request(aarectangle region, callback_type callback) noexcept
+    {
+        start(region, std::chrono::nanoseconds{0}, std::move(callback));
+        _once = true;
+    }
+
+    /** Stop reading back frames.
+     *
+     * Frames that were already copied by the GPU are still delivered.
+     */
+    void stop() noexcept
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        _callback = nullptr;
+    }
+
+    [[nodiscard]] bool active() const noexcept
+    {
+        return static_cast<bool>(_callback);
+    }
+
+    /** Create a slot for each frame-in-flight.
+     *
+     * The buffers are allocated when a frame is read back.
+     *
+     * @param num_frames The number of frames-in-flight.
+     */
+    void build(std::size_t num_frames)
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        hi_assert(_slots.empty());
+
+        _slots.resize(num_frames);
+    }
+
+    /** Destroy the buffers.
+     *
+     * Readbacks that are still pending are dropped; the swapchain they were
+     * copied from is lost.
+     */
+    void teardown(gfx_device const& device) noexcept
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+        for (auto& slot : _slots) {
+            if (slot.buffer) {
+                device.destroyBuffer(slot.buffer, slot.allocation, gfx_memory_category::swapchain);
+            }
+        }
+        _slots.clear();
+    }
+
+    /** Check if the GPU is copying a frame for a frame-in-flight.
+     *
+     * @param frame The index of the frame-in-flight.
+     */
+    [[nodiscard]] bool pending(std::size_t frame) const noexcept
+    {
+        hi_axiom_bounds(frame, _slots);
+        return static_cast<bool>(_slots[frame].callback);
+    }
+
+    /** Record the copy of the region into the buffer of the frame-in-flight, when a readback is due.
+     *
+     * @note Must be recorded after the render pass, while the image is in the present layout.
+     * @pre The readback of the previous use of the frame-in-flight was resolved.
+     * @param device The device to allocate the buffer on.
+     * @param command_buffer The command buffer of the frame.
+     * @param frame The index of the frame-in-flight.
+     * @param image The swapchain image that was rendered into.
+     * @param format The format of the swapchain image.
+     * @param extent The size of the swapchain image.
+     * @param time_point The time point when the frame will be displayed.
+     */
+    void record(
+        gfx_device const& device,
+        vk::CommandBuffer command_buffer,
+        std::size_t frame,
+        vk::Image image,
+        vk::Format format,
+        vk::Extent2D extent,
+        utc_nanoseconds time_point)
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        hi_axiom_bounds(frame, _slots);
+
+        if (not _callback or time_point < _next_time_point) {
+            return;
+        }
+
+        auto& slot = _slots[frame];
+        hi_assert(not slot.callback);
+
+        auto const pixel_size = bytes_per_pixel(format);
+        if (pixel_size == 0) {
+            hi_log_error("Can not read back a swapchain with format {}.", vk::to_string(format));
+            _callback = nullptr;
+            return;
+        }
+
+        auto const image_rectangle = aarectangle{0.0f, 0.0f, narrow_cast<float>(extent.width), narrow_cast<float>(extent.height)};
+        auto const region = _region ? intersect(_region, image_rectangle) : image_rectangle;
+        if (not region) {
+            return;
+        }
+
+        // Round the region outward to whole pixels. Rows in the image are counted from the top.
+        auto const left = floor_cast<uint32_t>(region.left());
+        auto const bottom = floor_cast<uint32_t>(region.bottom());
+        auto const width = ceil_cast<uint32_t>(region.right()) - left;
+        auto const height = ceil_cast<uint32_t>(region.top()) - bottom;
+        auto const top = extent.height - bottom - height;
+
+        auto const size = vk::DeviceSize{width} * height * pixel_size;
+        if (slot.capacity < size) {
+            allocate(device, slot, size);
+        }
+
+        auto const range = vk::ImageSubresourceRange{vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1};
+        auto const to_transfer = vk::ImageMemoryBarrier{
+            vk::AccessFlagBits::eColorAttachmentWrite,
+            vk::AccessFlagBits::eTransferRead,
+            vk::ImageLayout::ePresentSrcKHR,
+            vk::ImageLayout::eTransferSrcOptimal,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            image,
+            range};
+        command_buffer.pipelineBarrier(
+            vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::PipelineStageFlagBits::eTransfer, {}, {}, {}, to_transfer);
+
+        auto const copy = vk::BufferImageCopy{
+            0,
+            0, // bufferRowLength, tightly packed
+            0, // bufferImageHeight, tightly packed
+            vk::ImageSubresourceLayers{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+            vk::Offset3D{narrow_cast<int32_t>(left), narrow_cast<int32_t>(top), 0},
+            vk::Extent3D{width, height, 1}};
+        command_buffer.copyImageToBuffer(image, vk::ImageLayout::eTransferSrcOptimal, slot.buffer, copy);
+
+        // The image is presented after the copy, the host reads the buffer after the fence is signaled.
+        auto const to_present = vk::ImageMemoryBarrier{
+            vk::AccessFlagBits::eTransferRead,
+            vk::AccessFlags{},
+            vk::ImageLayout::eTransferSrcOptimal,
+            vk::ImageLayout::ePresentSrcKHR,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            image,
+            range};
+        auto const to_host = vk::BufferMemoryBarrier{
+            vk::AccessFlagBits::eTransferWrite,
+            vk::AccessFlagBits::eHostRead,
+            VK_QUEUE_FAMILY_IGNORED,
+            VK_QUEUE_FAMILY_IGNORED,
+            slot.buffer,
+            0,
+            VK_WHOLE_SIZE};
+        command_buffer.pipelineBarrier(
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::PipelineStageFlagBits::eBottomOfPipe | vk::PipelineStageFlagBits::eHost,
+            {},
+            {},
+            to_host,
+            to_present);
+
+        slot.width = width;
+        slot.height = height;
+        slot.format = format;
+        slot.callback = _callback;
+        if (_once) {
+            _callback = nullptr;
+        }
+
+        // Keep the rate when frames are rendered faster than the interval, but don't catch up after an idle period.
+        _next_time_point += _interval;
+        if (_next_time_point <= time_point) {
+            _next_time_point = time_point + _interval;
+        }
+        ++global_counter<"gfx_surface:readback">;
+    }
+
+    /** Deliver the pixels that were copied for a frame-in-flight.
+     *
+     * @pre The fence of the frame-in-flight is signaled.
+     * @param device The device that owns the buffer.
+     * @param frame The index of the frame-in-flight.
+     */
+    void resolve(gfx_device const& device, std::size_t frame)
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        hi_axiom_bounds(frame, _slots);
+
+        auto& slot = _slots[frame];
+        auto const callback = std::exchange(slot.callback, nullptr);
+        if (not callback) {
+            return;
+        }
+
+        // The buffer may be in memory that is not host-coherent.
+        vmaInvalidateAllocation(device.allocator, slot.allocation, 0, VK_WHOLE_SIZE);
+
+        auto r = pixmap<srgb_abgr8_pack>{slot.width, slot.height};
+        auto const stride = std::size_t{slot.width} * bytes_per_pixel(slot.format);
+        for (auto y = 0_uz; y != slot.height; ++y) {
+            // The rows of the buffer start at the top, the rows of the pixmap at the bottom.
+            convert_row(slot.format, slot.data + y * stride, r[slot.height - y - 1]);
+        }
+
+        callback(std::move(r));
+    }
+
+private:
+    /** The buffer of a frame-in-flight and the readback that was recorded in its command buffer.
+     */
+    struct slot_type {
+        vk::Buffer buffer = {};
+        VmaAllocation allocation = {};
+        std::byte const *data = nullptr;
+        vk::DeviceSize capacity = 0;
+
+        uint32_t width = 0;
+        uint32_t height = 0;
+        vk::Format format = vk::Format::eUndefined;
+
+        /** The callback of the readback, empty when no readback is pending.
+         */
+        callback_type callback;
+    };
+
+    std::vector<slot_type> _slots;
+
+    aarectangle _region = {};
+    std::chrono::nanoseconds _interval = {};
+    utc_nanoseconds _next_time_point = {};
+    callback_type _callback;
+    bool _once = false;
+
+    /** A row of half-float pixels, to convert them to sRGB all at once.
+     */
+    std::vector<sfloat_rgba16> _half_row;
+
+    [[nodiscard]] static std::size_t bytes_per_pixel(vk::Format format) noexcept
+    {
+        switch (format) {
+        case vk::Format::eR8G8B8A8Srgb:
+        case vk::Format::eR8G8B8A8Unorm:
+        case vk::Format::eB8G8R8A8Srgb:
+        case vk::Format::eB8G8R8A8Unorm:
+            return 4;
+        case vk::Format::eR8G8B8Srgb:
+        case vk::Format::eR8G8B8Unorm:
+        case vk::Format::eB8G8R8Srgb:
+        case vk::Format::eB8G8R8Unorm:
+            return 3;
+        case vk::Format::eR16G16B16A16Sfloat:
+            return 8;
+        default:
+            return 0;
+        }
+    }
+
+    static void allocate(gfx_device const& device, slot_type& slot, vk::DeviceSize size)
+    {
+        if (slot.buffer) {
+            device.destroyBuffer(slot.buffer, slot.allocation, gfx_memory_category::swapchain);
+        }
+
+        vk::BufferCreateInfo const bufferCreateInfo = {
+            vk::BufferCreateFlags(), size, vk::BufferUsageFlagBits::eTransferDst, vk::SharingMode::eExclusive};
+        VmaAllocationCreateInfo allocationCreateInfo = {};
+        allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        allocationCreateInfo.pUserData = const_cast<char *>("surface readback buffer");
+        allocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
+
+        std::tie(slot.buffer, slot.allocation) =
+            device.createBuffer(bufferCreateInfo, allocationCreateInfo, gfx_memory_category::swapchain);
+        device.setDebugUtilsObjectNameEXT(slot.buffer, "surface readback buffer");
+
+        VmaAllocationInfo allocationInfo;
+        vmaGetAllocationInfo(device.allocator, slot.allocation, &allocationInfo);
+        slot.data = static_cast<std::byte const *>(allocationInfo.pMappedData);
+        slot.capacity = size;
+        hi_assert_not_null(slot.data);
+    }
+
+    /** Convert 8 bit per channel pixels to sRGB pixels.
+     *
+     * @tparam R The index of the red channel in a pixel.
+     * @tparam B The index of the blue channel in a pixel.
+     * @tparam PixelSize The number of bytes in a pixel, the alpha channel is the fourth byte.
+     */
+    template<std::size_t R, std::size_t B, std::size_t PixelSize>
+    static void convert_row_8(std::byte const *src, std::span<srgb_abgr8_pack> dst) noexcept
+    {
+        for (auto& pixel : dst) {
+            auto const r = uint32_t{std::to_integer<uint8_t>(src[R])};
+            auto const g = uint32_t{std::to_integer<uint8_t>(src[1])};
+            auto const b = uint32_t{std::to_integer<uint8_t>(src[B])};
+            auto const a = PixelSize == 4 ? uint32_t{std::to_integer<uint8_t>(src[3])} : uint32_t{0xff};
+            pixel = r | g << 8 | b << 16 | a << 24;
+            src += PixelSize;
+        }
+    }
+
+    void convert_row(vk::Format format, std::byte const *src, std::span<srgb_abgr8_pack> dst)
+    {
+        switch (format) {
+        case vk::Format::eR8G8B8A8Srgb:
+        case vk::Format::eR8G8B8A8Unorm:
+            // The red channel is stored in the lowest byte of srgb_abgr8_pack.
+            std::memcpy(dst.data(), src, dst.size_bytes());
+            return;
+        case vk::Format::eB8G8R8A8Srgb:
+        case vk::Format::eB8G8R8A8Unorm:
+            return convert_row_8<2, 0, 4>(src, dst);
+        case vk::Format::eR8G8B8Srgb:
+        case vk::Format::eR8G8B8Unorm:
+            return convert_row_8<0, 2, 3>(src, dst);
+        case vk::Format::eB8G8R8Srgb:
+        case vk::Format::eB8G8R8Unorm:
+            return convert_row_8<2, 0, 3>(src, dst);
+        case vk::Format::eR16G16B16A16Sfloat:
+            // The extended sRGB swapchain is linear, colors outside the standard dynamic range are clamped.
+            _half_row.resize(dst.size());
+            std::memcpy(_half_row.data(), src, dst.size() * sizeof(sfloat_rgba16));
+            return convert(std::span<sfloat_rgba16 const>{_half_row}, dst);
+        default:
+            hi_no_default();
+        }
+    }
+};
+
+}} // namespace hi::v1
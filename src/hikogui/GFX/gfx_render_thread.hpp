@@ -0,0 +1,132 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file GFX/gfx_render_thread.hpp Submit and present the frames of a surface on a separate thread.
+ */
+
+#pragma once
+
+#include "gfx_surface_vulkan_intf.hpp"
+#include "draw_context_intf.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../macros.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stop_token>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <memory>
+
+hi_export_module(hikogui.GFX : gfx_render_thread);
+
+hi_export namespace hi::inline v1 {
+
+/** A thread which submits and presents the frames of a single surface.
+ *
+ * The widgets are drawn on the main thread, after which the draw-context is
+ * handed to the render thread as the frame. The frame is immutable: the
+ * vertices are already in this frame's segment of the vertex ring. The render
+ * thread records and submits the command buffers and presents the swapchain
+ * image, so that the main thread can continue handling events while a
+ * GPU-limited surface presents.
+ *
+ * Only a single frame is in the hand-over at a time; the main thread should
+ * check `ready()` before it starts a new frame with `gfx_surface::render_start()`
+ * or changes the surface.
+ */
+class gfx_render_thread {
+public:
+    /** Finish the frame in the hand-over and stop the thread.
+     */
+    ~gfx_render_thread() = default;
+
+    gfx_render_thread(gfx_render_thread const&) = delete;
+    gfx_render_thread(gfx_render_thread&&) = delete;
+    gfx_render_thread& operator=(gfx_render_thread const&) = delete;
+    gfx_render_thread& operator=(gfx_render_thread&&) = delete;
+
+    /** Start a render thread.
+     *
+     * @param surface The surface to render to; must outlive the render thread.
+     */
+    gfx_render_thread(gfx_surface& surface) : _surface(std::addressof(surface))
+    {
+        _thread = std::jthread{[this](std::stop_token stop_token) {
+            run(std::move(stop_token));
+        }};
+    }
+
+    /** Check if the previous frame has been submitted.
+     *
+     * @return True when a new frame may be started.
+     * @throws An exception thrown by `gfx_surface::render_finish()` of the previous frame.
+     */
+    [[nodiscard]] bool ready()
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        if (auto error = std::exchange(_error, nullptr)) {
+            std::rethrow_exception(error);
+        }
+        return not _frame;
+    }
+
+    /** Hand over a drawn frame to the render thread.
+     *
+     * @pre `ready()` returned true.
+     * @param frame The context returned by `gfx_surface::render_start()`, after the widgets were drawn.
+     */
+    void submit(draw_context const& frame) noexcept
+    {
+        {
+            auto const lock = std::scoped_lock(_mutex);
+            hi_assert(not _frame);
+            _frame = frame;
+        }
+        _condition.notify_one();
+    }
+
+private:
+    gfx_surface *_surface;
+
+    mutable std::mutex _mutex;
+    std::condition_variable_any _condition;
+    std::optional<draw_context> _frame;
+    std::exception_ptr _error;
+
+    /** The thread is the last member, so that it is joined before the other members are destroyed.
+     */
+    std::jthread _thread;
+
+    void run(std::stop_token stop_token) noexcept
+    {
+        set_thread_name("render");
+
+        auto lock = std::unique_lock(_mutex);
+        // On a stop-request a frame that was already handed over is still presented.
+        while (_condition.wait(lock, stop_token, [this] {
+            return _frame.has_value();
+        })) {
+            // The main thread does not touch the frame until it is released below.
+            lock.unlock();
+            auto error = std::exception_ptr{};
+            try {
+                auto const t = trace<"render_thread::submit">();
+                _surface->render_finish(*_frame);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            if (error) {
+                _error = std::move(error);
+            }
+            _frame = std::nullopt;
+        }
+    }
+};
+
+} // namespace hi::inline v1
@@ -14,9 +14,14 @@
 #include "gfx_pipeline_override_vulkan_intf.hpp"
 #include "gfx_pipeline_tone_mapper_vulkan_intf.hpp"
 #include "../telemetry/telemetry.hpp"
+#include "../time/time.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <vector>
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <future>
 #include <vulkan/vulkan.hpp>
 
 hi_export_module(hikogui.GFX : gfx_surface_impl);
@@ -38,6 +43,10 @@ inline void gfx_surface::set_device(gfx_device *new_device) noexcept
     if (_device) {
         loss = gfx_surface_loss::device_lost;
         teardown();
+
+        if (new_device->SDF_pipeline->copy_atlas_from(*_device->SDF_pipeline)) {
+            hi_log_info("Copied the glyph atlas from device '{}' to '{}'", _device->deviceName, new_device->deviceName);
+        }
     }
 
     _device = new_device;
@@ -46,6 +55,19 @@ inline void gfx_surface::set_device(gfx_device *new_device) noexcept
     _graphics_queue = std::addressof(_device->get_graphics_queue(intrinsic));
 }
 
+inline void gfx_surface::reselect_device() noexcept
+{
+    auto const lock = std::scoped_lock(gfx_system_mutex);
+
+    if (offscreen() or state == gfx_surface_state::no_window) {
+        return;
+    }
+
+    if (auto new_device = find_best_device(*this); new_device and new_device != _device) {
+        set_device(new_device);
+    }
+}
+
 inline void gfx_surface::add_delegate(gfx_surface_delegate *delegate) noexcept
 {
     auto const lock = std::scoped_lock(gfx_system_mutex);
@@ -91,24 +113,54 @@ inline void gfx_surface::remove_delegate(gfx_surface_delegate *delegate) noexcep
     _delegates.erase(it);
 }
 
+inline void gfx_surface::start_readback(
+    aarectangle region,
+    std::chrono::nanoseconds interval,
+    gfx_readback::callback_type callback) noexcept
+{
+    auto const lock = std::scoped_lock(gfx_system_mutex);
+    _readback.start(region, interval, std::move(callback));
+}
+
+inline void gfx_surface::request_readback(aarectangle region, gfx_readback::callback_type callback) noexcept
+{
+    auto const lock = std::scoped_lock(gfx_system_mutex);
+    _readback.request(region, std::move(callback));
+}
+
+inline void gfx_surface::stop_readback() noexcept
+{
+    auto const lock = std::scoped_lock(gfx_system_mutex);
+    _readback.stop();
+}
+
 [[nodiscard]] inline extent2 gfx_surface::size() const noexcept
 {
     return {narrow_cast<float>(swapchainImageExtent.width), narrow_cast<float>(swapchainImageExtent.height)};
 }
 
-inline void gfx_surface::wait_idle()
+inline void gfx_surface::wait_for_frames_in_flight()
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
     hi_assert(_device);
-    if (renderFinishedFence) {
-        _device->waitForFences({renderFinishedFence}, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    for (auto const& frame : frame_in_flight_infos) {
+        if (frame.render_finished_fence) {
+            _device->waitForFences({frame.render_finished_fence}, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        }
     }
+}
+
+inline void gfx_surface::wait_idle()
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    wait_for_frames_in_flight();
     _device->waitIdle();
     hi_log_info("/waitIdle");
 }
 
-inline std::optional<uint32_t> gfx_surface::acquire_next_image_from_swapchain()
+inline std::optional<uint32_t> gfx_surface::acquire_next_image_from_swapchain(vk::Semaphore image_available_semaphore)
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
@@ -116,7 +168,7 @@ inline std::optional<uint32_t> gfx_surface::acquire_next_image_from_swapchain()
     uint32_t frameBufferIndex = 0;
     // hi_log_debug("acquireNextImage '{}'", title);
 
-    auto const result = _device->acquireNextImageKHR(swapchain, 0, imageAvailableSemaphore, vk::Fence(), &frameBufferIndex);
+    auto const result = _device->acquireNextImageKHR(swapchain, 0, image_available_semaphore, vk::Fence(), &frameBufferIndex);
     // hi_log_debug("acquireNextImage {}", frameBufferIndex);
 
     switch (result) {
@@ -154,12 +206,18 @@ inline std::optional<uint32_t> gfx_surface::acquire_next_image_from_swapchain()
         loss = gfx_surface_loss::window_lost;
         return std::nullopt;
 
+    case vk::Result::eErrorDeviceLost:
+        hi_log_error("acquireNextImageKHR() eErrorDeviceLost");
+        _device->set_lost();
+        loss = gfx_surface_loss::device_lost;
+        return std::nullopt;
+
     default:
         throw gui_error(std::format("Unknown result from acquireNextImageKHR(). '{}'", to_string(result)));
     }
 }
 
-inline void gfx_surface::present_image_to_queue(uint32_t frameBufferIndex, vk::Semaphore semaphore)
+inline void gfx_surface::present_image_to_queue(uint32_t frameBufferIndex, vk::Semaphore semaphore, utc_nanoseconds input_time_point)
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
@@ -168,23 +226,44 @@ inline void gfx_surface::present_image_to_queue(uint32_t frameBufferIndex, vk::S
     std::array<vk::Semaphore, 1> const renderFinishedSemaphores = {semaphore};
     std::array<vk::SwapchainKHR, 1> const presentSwapchains = {swapchain};
     std::array<uint32_t, 1> const presentImageIndices = {frameBufferIndex};
+    std::array<uint64_t, 1> const presentIds = {_present_id + 1};
     hi_assert(presentSwapchains.size() == presentImageIndices.size());
+    hi_assert(presentSwapchains.size() == presentIds.size());
+
+    auto present_info = vk::PresentInfoKHR{
+        narrow_cast<uint32_t>(renderFinishedSemaphores.size()),
+        renderFinishedSemaphores.data(),
+        narrow_cast<uint32_t>(presentSwapchains.size()),
+        presentSwapchains.data(),
+        presentImageIndices.data()};
+
+    // With present-wait the latency is measured when the image is displayed, in `wait_for_previous_present()`.
+    auto present_id_info = vk::PresentIdKHR{narrow_cast<uint32_t>(presentIds.size()), presentIds.data()};
+    if (_wait_for_present) {
+        present_info.setPNext(&present_id_info);
+    }
+
+    auto const record_present = [&] {
+        _present_id = presentIds.front();
+        _present_input_time_point = input_time_point;
+        if (not _wait_for_present and input_time_point != utc_nanoseconds{}) {
+            global_counter<"gfx_surface:input-to-present">.add_duration(
+                time_stamp_count::count_from_duration(std::chrono::utc_clock::now() - input_time_point));
+        }
+    };
 
     try {
         // hi_log_debug("presentQueue {}", presentImageIndices.at(0));
-        auto const result = _present_queue->queue.presentKHR(
-            {narrow_cast<uint32_t>(renderFinishedSemaphores.size()),
-             renderFinishedSemaphores.data(),
-             narrow_cast<uint32_t>(presentSwapchains.size()),
-             presentSwapchains.data(),
-             presentImageIndices.data()});
+        auto const result = _present_queue->queue.presentKHR(present_info);
 
         switch (result) {
         case vk::Result::eSuccess:
+            record_present();
             return;
 
         case vk::Result::eSuboptimalKHR:
             hi_log_info("presentKHR() eSuboptimalKHR");
+            record_present();
             loss = gfx_surface_loss::swapchain_lost;
             return;
 
@@ -204,12 +283,79 @@ inline void gfx_surface::present_image_to_queue(uint32_t frameBufferIndex, vk::S
     }
 }
 
+inline void gfx_surface::resolve_readbacks()
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    for (auto i = 0_uz; i != frame_in_flight_infos.size(); ++i) {
+        if (_readback.pending(i) and
+            _device->getFenceStatus(frame_in_flight_infos[i].render_finished_fence) == vk::Result::eSuccess) {
+            _readback.resolve(*_device, i);
+        }
+    }
+}
+
+inline void gfx_surface::wait_for_previous_present()
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+    hi_assert_not_null(_device);
+
+    if (not _wait_for_present or _present_id == 0) {
+        return;
+    }
+
+    auto const t = trace<"gfx_surface:wait-for-present">();
+
+    try {
+        auto const timeout = narrow_cast<uint64_t>(maximumPresentWait.count());
+        switch (_device->waitForPresentKHR(swapchain, _present_id, timeout)) {
+        case vk::Result::eSuccess:
+            break;
+
+        case vk::Result::eTimeout:
+            // The previous frame is not displayed, for example when the window is occluded.
+            ++global_counter<"gfx_surface:wait-for-present:timeout">;
+            return;
+
+        default:
+            return;
+        }
+
+    } catch (vk::OutOfDateKHRError const&) {
+        hi_log_info("waitForPresentKHR() eErrorOutOfDateKHR");
+        loss = gfx_surface_loss::swapchain_lost;
+        return;
+
+    } catch (vk::SurfaceLostKHRError const&) {
+        hi_log_info("waitForPresentKHR() eErrorSurfaceLostKHR");
+        loss = gfx_surface_loss::window_lost;
+        return;
+    }
+
+    if (auto const input_time_point = std::exchange(_present_input_time_point, utc_nanoseconds{});
+        input_time_point != utc_nanoseconds{}) {
+        global_counter<"gfx_surface:input-to-present">.add_duration(
+            time_stamp_count::count_from_duration(std::chrono::utc_clock::now() - input_time_point));
+    }
+}
+
 inline gfx_surface_loss gfx_surface::build_for_new_device() noexcept
 {
     if (_device->score(intrinsic) <= 0) {
         return gfx_surface_loss::device_lost;
     }
 
+    // The queues and the semaphores of the delegates are created again when a lost device is recovered.
+    _present_queue = std::addressof(_device->get_present_queue(intrinsic));
+    _graphics_queue = std::addressof(_device->get_graphics_queue(intrinsic));
+    for (auto& delegate_info : _delegates) {
+        if (not delegate_info.semaphore) {
+            delegate_info.semaphore = _device->createSemaphore();
+        }
+    }
+
+    _num_frames_in_flight = std::clamp(numberOfFramesInFlight, std::size_t{1}, maximumNumberOfFramesInFlight);
+    build_vertex_ring();
     box_pipeline->build_for_new_device();
     image_pipeline->build_for_new_device();
     SDF_pipeline->build_for_new_device();
@@ -224,6 +370,7 @@ inline gfx_surface_loss gfx_surface::build_for_new_device() noexcept
             _device->allocator, vulkan_instance(), _device->intrinsic, graphics_queue.queue, graphics_queue.family_queue_index);
     }
 
+    ++_device->num_surfaces;
     return gfx_surface_loss::none;
 }
 
@@ -257,11 +404,12 @@ inline gfx_surface_loss gfx_surface::build_for_new_swapchain(extent2 new_size) n
         hi_assert_not_null(SDF_pipeline);
         hi_assert_not_null(override_pipeline);
         hi_assert_not_null(tone_mapper_pipeline);
-        box_pipeline->build_for_new_swapchain(renderPass, 0, swapchainImageExtent);
-        image_pipeline->build_for_new_swapchain(renderPass, 1, swapchainImageExtent);
-        SDF_pipeline->build_for_new_swapchain(renderPass, 2, swapchainImageExtent);
+        box_pipeline->build_for_new_swapchain(renderPass, 0, swapchainImageExtent, directRenderPass);
+        image_pipeline->build_for_new_swapchain(renderPass, 1, swapchainImageExtent, directRenderPass);
+        SDF_pipeline->build_for_new_swapchain(renderPass, 2, swapchainImageExtent, directRenderPass);
         override_pipeline->build_for_new_swapchain(renderPass, 3, swapchainImageExtent);
         tone_mapper_pipeline->build_for_new_swapchain(renderPass, 4, swapchainImageExtent);
+        build_pipelines_concurrently();
 
         auto image_views = std::vector<vk::ImageView>{};
         image_views.reserve(swapchain_image_infos.size());
@@ -283,12 +431,147 @@ inline gfx_surface_loss gfx_surface::build_for_new_swapchain(extent2 new_size) n
     }
 }
 
+inline gfx_surface_loss gfx_surface::resize_swapchain(extent2 new_size) noexcept
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+    hi_assert(state == gfx_surface_state::has_swapchain);
+
+    auto const t = trace<"gfx_surface:resize_swapchain">{};
+
+    // After a failure halfway, tear down the rest of the swapchain here; the delegates
+    // must not be torn down twice.
+    auto delegates_torn_down = false;
+    auto const failed = [&](gfx_surface_loss r) noexcept {
+        if (delegates_torn_down) {
+            teardown_for_swapchain_lost(false);
+            state = gfx_surface_state::has_device;
+        }
+        return r;
+    };
+
+    try {
+        auto const[clamped_count, clamped_size] = get_image_count_and_size(defaultNumberOfSwapchainImages, new_size);
+        if (not new_size or clamped_count != nrSwapchainImages) {
+            // Minimized window, or a different number of images; rebuild the swapchain completely.
+            return gfx_surface_loss::swapchain_lost;
+        }
+
+        if (not offscreen() and _device->get_surface_format(intrinsic) != swapchainImageFormat) {
+            // The render passes and pipelines were build for the format of the swapchain.
+            return gfx_surface_loss::swapchain_lost;
+        }
+
+        // Only the frames of this surface use the swapchain and its attachments,
+        // there is no need to wait for the whole device to become idle.
+        wait_for_frames_in_flight();
+
+        for (auto [delegate, semaphore] : _delegates) {
+            hi_assert_not_null(delegate);
+            delegate->teardown_for_swapchain_lost();
+        }
+        delegates_torn_down = true;
+
+        teardown_frame_buffers();
+
+        // The old swapchain is handed to the new swapchain so that the presentation engine
+        // can reuse its resources, it is destroyed when its last images have been presented.
+        auto const old_swapchain = std::exchange(swapchain, vk::SwapchainKHR{});
+        teardown_swapchain();
+        auto const tmp = build_swapchain(clamped_count, clamped_size, old_swapchain);
+        if (old_swapchain) {
+            _retired_swapchains.emplace_back(old_swapchain, _frame_count + _num_frames_in_flight + 1);
+        }
+        if (tmp != gfx_surface_loss::none) {
+            return failed(tmp);
+        }
+
+        auto const[clamped_count_check, clamped_size_check] = get_image_count_and_size(clamped_count, clamped_size);
+        if (clamped_count_check != clamped_count or clamped_size_check != clamped_size) {
+            // Window has changed during swap chain creation, it is in a inconsistent bad state.
+            return failed(gfx_surface_loss::swapchain_lost);
+        }
+
+        build_frame_buffers();
+        box_pipeline->resize_for_swapchain(swapchainImageExtent);
+        image_pipeline->resize_for_swapchain(swapchainImageExtent);
+        SDF_pipeline->resize_for_swapchain(swapchainImageExtent);
+        override_pipeline->resize_for_swapchain(swapchainImageExtent);
+        tone_mapper_pipeline->resize_for_swapchain(swapchainImageExtent);
+
+        auto image_views = std::vector<vk::ImageView>{};
+        image_views.reserve(swapchain_image_infos.size());
+        for (auto const& image_info : swapchain_image_infos) {
+            image_views.push_back(image_info.image_view);
+        }
+
+        for (auto [delegate, semaphore] : _delegates) {
+            hi_assert_not_null(delegate);
+            delegate->build_for_new_swapchain(image_views, swapchainImageExtent, swapchainImageFormat);
+        }
+
+        ++global_counter<"gfx_surface:resize_swapchain">;
+        return gfx_surface_loss::none;
+
+    } catch (vk::SurfaceLostKHRError const&) {
+        return failed(gfx_surface_loss::window_lost);
+    }
+}
+
+inline void gfx_surface::destroy_retired_swapchains(bool all) noexcept
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    std::erase_if(_retired_swapchains, [&](auto const& item) {
+        if (all or item.second <= _frame_count) {
+            _device->destroy(item.first);
+            return true;
+        }
+        return false;
+    });
+}
+
+inline void gfx_surface::build_pipelines_concurrently()
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    auto const t = trace<"build_pipelines">{};
+
+    // The box, SDF and tone-mapper pipelines are needed for the first frame, compile them concurrently.
+    // The image and override pipelines are only used by some windows, they are compiled on first use.
+    auto box_future = std::async(std::launch::async, [this] {
+        box_pipeline->build_pipeline();
+    });
+    auto SDF_future = std::async(std::launch::async, [this] {
+        SDF_pipeline->build_pipeline();
+    });
+
+    tone_mapper_pipeline->build_pipeline();
+
+    // get() rethrows any exceptions thrown while compiling the pipeline.
+    box_future.get();
+    SDF_future.get();
+}
+
 inline void gfx_surface::build(extent2 new_size) noexcept
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
     hi_assert(loss == gfx_surface_loss::none);
 
     if (state == gfx_surface_state::has_window) {
+        if (_device and _device->lost) {
+            // The device is recovered once all surfaces have stopped using it.
+            if (_device->num_surfaces != 0) {
+                return;
+            }
+
+            try {
+                _device->recover();
+            } catch (std::exception const& e) {
+                hi_log_error("Could not recover the lost vulkan device '{}'. \"{}\"", _device->deviceName, e.what());
+                return;
+            }
+        }
+
         if (_device) {
             if (loss = build_for_new_device(); loss != gfx_surface_loss::none) {
                 return;
@@ -310,14 +593,16 @@ inline void gfx_surface::build(extent2 new_size) noexcept
     }
 }
 
-inline void gfx_surface::teardown_for_swapchain_lost() noexcept
+inline void gfx_surface::teardown_for_swapchain_lost(bool teardown_delegates) noexcept
 {
     hi_log_info("Tearing down because the window lost the swapchain.");
     wait_idle();
 
-    for (auto [delegate, semaphore] : _delegates) {
-        hi_assert_not_null(delegate);
-        delegate->teardown_for_swapchain_lost();
+    if (teardown_delegates) {
+        for (auto [delegate, semaphore] : _delegates) {
+            hi_assert_not_null(delegate);
+            delegate->teardown_for_swapchain_lost();
+        }
     }
 
     tone_mapper_pipeline->teardown_for_swapchain_lost();
@@ -330,6 +615,9 @@ inline void gfx_surface::teardown_for_swapchain_lost() noexcept
     teardown_frame_buffers();
     teardown_render_passes();
     teardown_swapchain();
+
+    // The device is idle, the old swapchains are no longer presenting.
+    destroy_retired_swapchains(true);
 }
 
 inline void gfx_surface::teardown_for_device_lost() noexcept
@@ -344,12 +632,28 @@ inline void gfx_surface::teardown_for_device_lost() noexcept
     SDF_pipeline->teardown_for_device_lost();
     image_pipeline->teardown_for_device_lost();
     box_pipeline->teardown_for_device_lost();
-    _device = nullptr;
+    teardown_vertex_ring();
+
+    hi_assert(_device->num_surfaces != 0);
+    --_device->num_surfaces;
+
+    if (_device->lost) {
+        // Keep the device, so that the surface is built again after the device has been recovered.
+        // The semaphores of the delegates belong to the Vulkan device that is destroyed during recovery.
+        for (auto& delegate_info : _delegates) {
+            _device->destroy(delegate_info.semaphore);
+            delegate_info.semaphore = vk::Semaphore{};
+        }
+    } else {
+        _device = nullptr;
+    }
 }
 
 inline void gfx_surface::teardown_for_window_lost() noexcept
 {
-    gfx_system::global().destroySurfaceKHR(intrinsic);
+    if (not offscreen()) {
+        gfx_system::global().destroySurfaceKHR(intrinsic);
+    }
 }
 
 inline void gfx_surface::teardown() noexcept
@@ -379,8 +683,9 @@ inline void gfx_surface::update(extent2 new_size) noexcept
     auto const lock = std::scoped_lock(gfx_system_mutex);
 
     if (size() != new_size and state == gfx_surface_state::has_swapchain) {
-        // On resize lose the swapchain, which will be cleaned up at teardown().
-        loss = gfx_surface_loss::swapchain_lost;
+        // On resize only the swapchain and frame buffers are recreated. When that
+        // is not possible lose the swapchain, which will be cleaned up at teardown().
+        loss = resize_swapchain(new_size);
     }
 
     // Tear down then buildup from the Vulkan objects that where invalid.
@@ -400,96 +705,168 @@ inline draw_context gfx_surface::render_start(aarectangle redraw_rectangle)
         box_pipeline->vertexBufferData,
         image_pipeline->vertexBufferData,
         SDF_pipeline->vertexBufferData,
-        override_pipeline->vertexBufferData};
+        override_pipeline->vertexBufferData,
+        _has_hdr_colors,
+        _pending_glyphs_rectangle,
+        _occluders};
 
-    // Bail out when the window is not yet ready to be rendered, or if there is nothing to render.
-    if (state != gfx_surface_state::has_swapchain or not redraw_rectangle) {
+    // Bail out when the window is not yet ready to be rendered.
+    if (state != gfx_surface_state::has_swapchain) {
         return r;
     }
 
-    auto const optional_frame_buffer_index = acquire_next_image_from_swapchain();
-    if (!optional_frame_buffer_index) {
-        // No image is ready to be rendered, yet, possibly because our vertical sync function
-        // is not working correctly.
+    // Bail out when another surface lost the device, until the device is recovered in `build()`.
+    if (_device->lost) {
+        loss = gfx_surface_loss::device_lost;
+        teardown();
         return r;
     }
 
-    // Setting the frame buffer index, also enabled the draw_context.
-    r.frame_buffer_index = narrow_cast<size_t>(*optional_frame_buffer_index);
+    try {
+        // Deliver the readbacks that the GPU has finished, also when nothing is redrawn.
+        resolve_readbacks();
 
-    // Record which part of the image will be redrawn on the current swapchain image.
-    auto& current_image = swapchain_image_infos.at(r.frame_buffer_index);
-    current_image.redraw_rectangle = redraw_rectangle;
+        // Bail out if there is nothing to render.
+        if (not redraw_rectangle) {
+            return r;
+        }
 
-    // Calculate the scissor rectangle, from the combined redraws of the complete swapchain.
-    // We need to do this so that old redraws are also executed in the current swapchain image.
-    r.scissor_rectangle =
-        std::accumulate(swapchain_image_infos.cbegin(), swapchain_image_infos.cend(), aarectangle{}, [](auto const& sum, auto const& item) {
-            return sum | item.redraw_rectangle;
-        });
+        // In low-latency mode start the frame once the previous frame is displayed, instead of queueing behind it.
+        wait_for_previous_present();
+        if (loss != gfx_surface_loss::none) {
+            teardown();
+            return r;
+        }
 
-    // Wait until previous rendering has finished, before the next rendering.
-    _device->waitForFences({renderFinishedFence}, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        auto const& frame = frame_in_flight_infos.at(_frame_in_flight_index);
 
-    // Unsignal the fence so we will not modify/destroy the command buffers during rendering.
-    _device->resetFences({renderFinishedFence});
+        // Wait until the GPU has finished the frame that used these frame-in-flight resources before.
+        // With more than one frame in flight, the GPU may still be rendering the previous frames.
+        _device->waitForFences({frame.render_finished_fence}, VK_TRUE, std::numeric_limits<uint64_t>::max());
 
-    return r;
+        // The GPU has finished the frame that used these frame-in-flight resources, so its timestamps are available.
+        timestamp_queries.resolve(*_device, _frame_in_flight_index);
+        _readback.resolve(*_device, _frame_in_flight_index);
+
+        auto const optional_frame_buffer_index = offscreen() ? acquire_next_offscreen_image(frame.image_available_semaphore) :
+                                                               acquire_next_image_from_swapchain(frame.image_available_semaphore);
+        if (!optional_frame_buffer_index) {
+            // No image is ready to be rendered, yet, possibly because our vertical sync function
+            // is not working correctly.
+            return r;
+        }
+
+        // Unsignal the fence so we will not modify/destroy the command buffers during rendering.
+        _device->resetFences({frame.render_finished_fence});
+
+        // Setting the frame buffer index, also enabled the draw_context.
+        r.frame_buffer_index = narrow_cast<size_t>(*optional_frame_buffer_index);
+        ++_frame_count;
+        destroy_retired_swapchains();
+        _device->update_memory_budget();
+        _device->SDF_pipeline->next_frame(_device->start_surface_frame(_device_frame));
+        _device->image_pipeline->next_frame();
+
+        // Record which part of the image will be redrawn on the current swapchain image.
+        auto& current_image = swapchain_image_infos.at(r.frame_buffer_index);
+        current_image.redraw_rectangle = redraw_rectangle;
+
+        // Calculate the scissor rectangle, from the combined redraws of the complete swapchain.
+        // We need to do this so that old redraws are also executed in the current swapchain image.
+        r.scissor_rectangle = std::accumulate(
+            swapchain_image_infos.cbegin(), swapchain_image_infos.cend(), aarectangle{}, [](auto const& sum, auto const& item) {
+                return sum | item.redraw_rectangle;
+            });
+
+        // The GPU has finished with this segment of the vertex ring, the vertices of this frame are written there.
+        vertex_ring.set_frame(_frame_in_flight_index);
+        use_vertex_ring_segment();
+
+        return r;
+
+    } catch (vk::DeviceLostError const&) {
+        hi_log_error("render_start() eErrorDeviceLost");
+        _device->set_lost();
+        loss = gfx_surface_loss::device_lost;
+        teardown();
+
+        // Disable the draw context, the frame is not rendered.
+        r.frame_buffer_index = std::numeric_limits<size_t>::max();
+        return r;
+    }
 }
 
 inline void gfx_surface::render_finish(draw_context const& context)
 {
     auto const lock = std::scoped_lock(gfx_system_mutex);
 
+    auto const& frame = frame_in_flight_infos.at(_frame_in_flight_index);
     auto& current_image = swapchain_image_infos.at(context.frame_buffer_index);
 
-    // Because we use a scissor/render_area, the image from the swapchain around the scissor-area is reused.
-    // Because of reuse the swapchain image must already be in the "ePresentSrcKHR" layout.
-    // The swapchain creates images in undefined layout, so we need to change the layout once.
-    if (not current_image.layout_is_present) {
-        _device->transition_layout(
-            current_image.image, swapchainImageFormat.format, vk::ImageLayout::eUndefined, vk::ImageLayout::ePresentSrcKHR);
+    try {
+        // Because we use a scissor/render_area, the image from the swapchain around the scissor-area is reused.
+        // Because of reuse the swapchain image must already be in the "ePresentSrcKHR" layout.
+        // The swapchain creates images in undefined layout, so we need to change the layout once.
+        if (not current_image.layout_is_present) {
+            _device->transition_layout(
+                current_image.image, swapchainImageFormat.format, vk::ImageLayout::eUndefined, vk::ImageLayout::ePresentSrcKHR);
+
+            current_image.layout_is_present = true;
+        }
 
-        current_image.layout_is_present = true;
-    }
+        // Clamp the scissor rectangle to the size of the window.
+        auto const clamped_scissor_rectangle = intersect(
+            context.scissor_rectangle,
+            aarectangle{0, 0, narrow_cast<float>(swapchainImageExtent.width), narrow_cast<float>(swapchainImageExtent.height)});
+
+        auto const render_area = vk::Rect2D{
+            vk::Offset2D(
+                round_cast<uint32_t>(clamped_scissor_rectangle.left()),
+                round_cast<uint32_t>(
+                    swapchainImageExtent.height - clamped_scissor_rectangle.bottom() - clamped_scissor_rectangle.height())),
+            vk::Extent2D(
+                round_cast<uint32_t>(clamped_scissor_rectangle.width()), round_cast<uint32_t>(clamped_scissor_rectangle.height()))};
+
+        // Start the first delegate when the swapchain-image becomes available.
+        auto start_semaphore = frame.image_available_semaphore;
+        for (auto [delegate, end_semaphore] : _delegates) {
+            hi_assert_not_null(delegate);
 
-    // Clamp the scissor rectangle to the size of the window.
-    auto const clamped_scissor_rectangle = intersect(
-        context.scissor_rectangle,
-        aarectangle{0, 0, narrow_cast<float>(swapchainImageExtent.width), narrow_cast<float>(swapchainImageExtent.height)});
-
-    auto const render_area = vk::Rect2D{
-        vk::Offset2D(
-            round_cast<uint32_t>(clamped_scissor_rectangle.left()),
-            round_cast<uint32_t>(
-                swapchainImageExtent.height - clamped_scissor_rectangle.bottom() - clamped_scissor_rectangle.height())),
-        vk::Extent2D(
-            round_cast<uint32_t>(clamped_scissor_rectangle.width()), round_cast<uint32_t>(clamped_scissor_rectangle.height()))};
-
-    // Start the first delegate when the swapchain-image becomes available.
-    auto start_semaphore = imageAvailableSemaphore;
-    for (auto [delegate, end_semaphore] : _delegates) {
-        hi_assert_not_null(delegate);
+            delegate->draw(narrow_cast<uint32_t>(context.frame_buffer_index), start_semaphore, end_semaphore, render_area);
+            start_semaphore = end_semaphore;
+        }
 
-        delegate->draw(narrow_cast<uint32_t>(context.frame_buffer_index), start_semaphore, end_semaphore, render_area);
-        start_semaphore = end_semaphore;
-    }
+        // The tone-mapper is only needed to desaturate, to punch holes for the delegates or to clamp high dynamic
+        // range colors.
+        _bypass_tone_mapper = directRenderPass and context.saturation == 1.0f and override_pipeline->vertexBufferData.empty() and
+            not _has_hdr_colors;
 
-    // Wait for the semaphore of the last delegate before it will write into the swapchain-image.
-    fill_command_buffer(current_image, context, render_area);
-    submit_command_buffer(start_semaphore);
+        // Wait for the semaphore of the last delegate before it will write into the swapchain-image.
+        fill_command_buffer(frame, current_image, context, render_area);
+        submit_command_buffer(frame, start_semaphore);
 
-    // Signal the fence when all rendering has finished on the graphics queue.
-    // When the fence is signaled we can modify/destroy the command buffers.
-    [[maybe_unused]] auto const submit_result = _graphics_queue->queue.submit(0, nullptr, renderFinishedFence);
+        if (not offscreen()) {
+            present_image_to_queue(
+                narrow_cast<uint32_t>(context.frame_buffer_index), frame.render_finished_semaphore, context.input_time_point);
+        }
+
+        // The next frame is recorded with the next set of frame-in-flight resources, while the GPU renders this frame.
+        if (++_frame_in_flight_index == frame_in_flight_infos.size()) {
+            _frame_in_flight_index = 0;
+        }
 
-    present_image_to_queue(narrow_cast<uint32_t>(context.frame_buffer_index), renderFinishedSemaphore);
+    } catch (vk::DeviceLostError const&) {
+        hi_log_error("render_finish() eErrorDeviceLost");
+        _device->set_lost();
+        loss = gfx_surface_loss::device_lost;
+    }
 
     // Do an early tear down of invalid vulkan objects.
     teardown();
 }
 
 inline void gfx_surface::fill_command_buffer(
+    frame_in_flight_info const& frame,
     swapchain_image_info const& current_image,
     draw_context const& context,
     vk::Rect2D render_area)
@@ -498,8 +875,15 @@ inline void gfx_surface::fill_command_buffer(
 
     auto t = trace<"fill_command_buffer">{};
 
-    commandBuffer.reset(vk::CommandBufferResetFlagBits::eReleaseResources);
-    commandBuffer.begin({vk::CommandBufferUsageFlagBits::eSimultaneousUse});
+    // The fence of this frame was waited on, so the command buffers allocated from this pool are no longer in use.
+    _device->resetCommandPool(frame.command_pool);
+
+    auto const commandBuffer = frame.command_buffer;
+    commandBuffer.begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+
+    using enum gfx_timestamp_queries::point;
+    timestamp_queries.reset(commandBuffer, _frame_in_flight_index);
+    timestamp_queries.write(commandBuffer, _frame_in_flight_index, start);
 
     auto const background_color_f32x4 = f32x4{1.0f, 0.0f, 0.0f, 1.0f};
     auto const background_color_array = static_cast<std::array<float, 4>>(background_color_f32x4);
@@ -513,57 +897,149 @@ inline void gfx_surface::fill_command_buffer(
         vk::ClearValue{sdfClearValue},
         vk::ClearValue{colorClearValue}};
 
+    // The viewport is dynamic state so that the pipelines are not rebuild when the swapchain is resized.
+    auto const viewports = std::array{vk::Viewport{
+        0.0f,
+        0.0f,
+        narrow_cast<float>(swapchainImageExtent.width),
+        narrow_cast<float>(swapchainImageExtent.height),
+        // Reverse-z, with float buffer this will give a linear depth buffer.
+        1.0f,
+        0.0f}};
+    commandBuffer.setViewport(0, viewports);
+
     // The scissor and render area makes sure that the frame buffer is not modified where we are not drawing the widgets.
     auto const scissors = std::array{render_area};
     commandBuffer.setScissor(0, scissors);
 
+    if (_bypass_tone_mapper) {
+        // Render directly into the swapchain, the swapchain is cleared with the background color.
+        // Without holes in the user interface the tone-mapper would have overwritten the complete render area.
+        auto const directClearValues = std::array{vk::ClearValue{depthClearValue}, vk::ClearValue{colorClearValue}};
+
+        commandBuffer.beginRenderPass(
+            {directRenderPass,
+             current_image.direct_frame_buffer,
+             render_area,
+             narrow_cast<uint32_t>(directClearValues.size()),
+             directClearValues.data()},
+            vk::SubpassContents::eInline);
+
+        box_pipeline->draw_in_command_buffer(commandBuffer, context);
+        timestamp_queries.write(commandBuffer, _frame_in_flight_index, box);
+        commandBuffer.nextSubpass(vk::SubpassContents::eInline);
+        image_pipeline->draw_in_command_buffer(commandBuffer, context);
+        timestamp_queries.write(commandBuffer, _frame_in_flight_index, image);
+        commandBuffer.nextSubpass(vk::SubpassContents::eInline);
+        SDF_pipeline->draw_in_command_buffer(commandBuffer, context);
+        timestamp_queries.write(commandBuffer, _frame_in_flight_index, SDF);
+
+        commandBuffer.endRenderPass();
+        if (_readback_supported) {
+            _readback.record(
+                *_device,
+                commandBuffer,
+                _frame_in_flight_index,
+                current_image.image,
+                swapchainImageFormat.format,
+                swapchainImageExtent,
+                context.display_time_point);
+        }
+        commandBuffer.end();
+        ++global_counter<"gfx_surface:bypass_tone_mapper">;
+        return;
+    }
+
     commandBuffer.beginRenderPass(
         {renderPass, current_image.frame_buffer, render_area, narrow_cast<uint32_t>(clearValues.size()), clearValues.data()},
         vk::SubpassContents::eInline);
 
     box_pipeline->draw_in_command_buffer(commandBuffer, context);
+    timestamp_queries.write(commandBuffer, _frame_in_flight_index, box);
     commandBuffer.nextSubpass(vk::SubpassContents::eInline);
     image_pipeline->draw_in_command_buffer(commandBuffer, context);
+    timestamp_queries.write(commandBuffer, _frame_in_flight_index, image);
     commandBuffer.nextSubpass(vk::SubpassContents::eInline);
     SDF_pipeline->draw_in_command_buffer(commandBuffer, context);
+    timestamp_queries.write(commandBuffer, _frame_in_flight_index, SDF);
     commandBuffer.nextSubpass(vk::SubpassContents::eInline);
     override_pipeline->draw_in_command_buffer(commandBuffer, context);
+    timestamp_queries.write(commandBuffer, _frame_in_flight_index, override_);
     commandBuffer.nextSubpass(vk::SubpassContents::eInline);
     tone_mapper_pipeline->draw_in_command_buffer(commandBuffer, context);
+    timestamp_queries.write(commandBuffer, _frame_in_flight_index, tone_mapper);
 
     commandBuffer.endRenderPass();
+    if (_readback_supported) {
+        // The tone-mapper has written the final colors into the swapchain image.
+        _readback.record(
+            *_device,
+            commandBuffer,
+            _frame_in_flight_index,
+            current_image.image,
+            swapchainImageFormat.format,
+            swapchainImageExtent,
+            context.display_time_point);
+    }
     commandBuffer.end();
 }
 
-inline void gfx_surface::submit_command_buffer(vk::Semaphore delegate_semaphore)
+inline void gfx_surface::submit_command_buffer(frame_in_flight_info const& frame, vk::Semaphore delegate_semaphore)
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
-    auto const waitSemaphores = std::array{delegate_semaphore};
-
-    auto const waitStages = std::array{vk::PipelineStageFlags{vk::PipelineStageFlagBits::eColorAttachmentOutput}};
+    auto waitSemaphores = std::vector<vk::Semaphore>{delegate_semaphore};
+    auto waitStages = std::vector<vk::PipelineStageFlags>{vk::PipelineStageFlagBits::eColorAttachmentOutput};
+    auto waitValues = std::vector<uint64_t>{0};
+
+    // Images are uploaded on the transfer queue, wait on the uploads that the draw context found to be completed.
+    // These uploads have already finished, but the wait makes the atlas pages visible to the fragment shader.
+    auto const upload_semaphore = _device->image_pipeline->upload_semaphore;
+    if (upload_semaphore) {
+        waitSemaphores.push_back(upload_semaphore);
+        waitStages.push_back(vk::PipelineStageFlagBits::eFragmentShader);
+        waitValues.push_back(_device->image_pipeline->completed_upload_value());
+    }
 
     hi_assert(waitSemaphores.size() == waitStages.size());
+    hi_assert(waitSemaphores.size() == waitValues.size());
 
-    auto const signalSemaphores = std::array{renderFinishedSemaphore};
-    auto const commandBuffersToSubmit = std::array{commandBuffer};
+    // The render-finished semaphore is waited on when presenting, an offscreen surface does not present.
+    auto const signalSemaphores = std::array{frame.render_finished_semaphore};
+    auto const numSignalSemaphores = offscreen() ? uint32_t{0} : narrow_cast<uint32_t>(signalSemaphores.size());
+    auto const commandBuffersToSubmit = std::array{frame.command_buffer};
 
-    auto const submitInfo = std::array{vk::SubmitInfo{
+    auto submitInfo = std::array{vk::SubmitInfo{
         narrow_cast<uint32_t>(waitSemaphores.size()),
         waitSemaphores.data(),
         waitStages.data(),
         narrow_cast<uint32_t>(commandBuffersToSubmit.size()),
         commandBuffersToSubmit.data(),
-        narrow_cast<uint32_t>(signalSemaphores.size()),
+        numSignalSemaphores,
         signalSemaphores.data()}};
 
-    _graphics_queue->queue.submit(submitInfo, vk::Fence());
+    // The values for the binary semaphores are ignored.
+    auto const timelineSubmitInfo =
+        vk::TimelineSemaphoreSubmitInfo{narrow_cast<uint32_t>(waitValues.size()), waitValues.data(), 0, nullptr};
+    if (upload_semaphore) {
+        submitInfo[0].setPNext(&timelineSubmitInfo);
+    }
+
+    // Signal the fence when all rendering has finished on the graphics queue.
+    // When the fence is signaled we can modify/destroy the command buffers of this frame.
+    _graphics_queue->queue.submit(submitInfo, frame.render_finished_fence);
 }
 
 inline std::tuple<std::size_t, extent2> gfx_surface::get_image_count_and_size(std::size_t new_count, extent2 new_size)
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
+    if (offscreen()) {
+        // The offscreen images are only limited by the maximum size of an image on the device.
+        auto const max_dimension = narrow_cast<float>(_device->physicalProperties.limits.maxImageDimension2D);
+        return {new_count, clamp(new_size, extent2{1.0f, 1.0f}, extent2{max_dimension, max_dimension})};
+    }
+
     auto const surfaceCapabilities = _device->getSurfaceCapabilitiesKHR(intrinsic);
 
     auto const min_count = narrow_cast<std::size_t>(surfaceCapabilities.minImageCount);
@@ -585,65 +1061,84 @@ inline std::tuple<std::size_t, extent2> gfx_surface::get_image_count_and_size(st
     return {clamped_count, clamped_size};
 }
 
-inline gfx_surface_loss gfx_surface::build_swapchain(std::size_t new_count, extent2 new_size)
+inline gfx_surface_loss gfx_surface::build_swapchain(std::size_t new_count, extent2 new_size, vk::SwapchainKHR old_swapchain)
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
-    hi_log_info("Building swap chain");
+    if (offscreen()) {
+        build_offscreen_images(new_count, new_size);
+        _readback_supported = true;
 
-    auto const sharingMode = _graphics_queue == _present_queue ? vk::SharingMode::eExclusive : vk::SharingMode::eConcurrent;
+    } else {
+        hi_log_info("Building swap chain");
 
-    std::array<uint32_t, 2> const sharingQueueFamilyAllIndices = {
-        _graphics_queue->family_queue_index, _present_queue->family_queue_index};
+        auto const sharingMode = _graphics_queue == _present_queue ? vk::SharingMode::eExclusive : vk::SharingMode::eConcurrent;
 
-    swapchainImageFormat = _device->get_surface_format(intrinsic);
-    nrSwapchainImages = narrow_cast<uint32_t>(new_count);
-    swapchainImageExtent = VkExtent2D{round_cast<uint32_t>(new_size.width()), round_cast<uint32_t>(new_size.height())};
-    vk::SwapchainCreateInfoKHR swapchainCreateInfo{
-        vk::SwapchainCreateFlagsKHR(),
-        intrinsic,
-        nrSwapchainImages,
-        swapchainImageFormat.format,
-        swapchainImageFormat.colorSpace,
-        swapchainImageExtent,
-        1, // imageArrayLayers
-        vk::ImageUsageFlagBits::eColorAttachment,
-        sharingMode,
-        sharingMode == vk::SharingMode::eConcurrent ? narrow_cast<uint32_t>(sharingQueueFamilyAllIndices.size()) : 0,
-        sharingMode == vk::SharingMode::eConcurrent ? sharingQueueFamilyAllIndices.data() : nullptr,
-        vk::SurfaceTransformFlagBitsKHR::eIdentity,
-        vk::CompositeAlphaFlagBitsKHR::eOpaque,
-        _device->get_present_mode(intrinsic),
-        VK_TRUE, // clipped
-        nullptr};
-
-    vk::Result const result = _device->createSwapchainKHR(&swapchainCreateInfo, nullptr, &swapchain);
-    switch (result) {
-    case vk::Result::eSuccess:
-        break;
+        std::array<uint32_t, 2> const sharingQueueFamilyAllIndices = {
+            _graphics_queue->family_queue_index, _present_queue->family_queue_index};
 
-    case vk::Result::eErrorSurfaceLostKHR:
-        return gfx_surface_loss::window_lost;
+        swapchainImageFormat = _device->get_surface_format(intrinsic);
+        _wait_for_present = lowLatencyPresentation and _device->supportsPresentWait;
+        nrSwapchainImages = narrow_cast<uint32_t>(new_count);
+        swapchainImageExtent = VkExtent2D{round_cast<uint32_t>(new_size.width()), round_cast<uint32_t>(new_size.height())};
 
-    default:
-        throw gui_error(std::format("Unknown result from createSwapchainKHR(). '{}'", to_string(result)));
-    }
+        // The swapchain images are copied from to read them back.
+        auto const supportedUsageFlags = _device->getSurfaceCapabilitiesKHR(intrinsic).supportedUsageFlags;
+        _readback_supported = static_cast<bool>(supportedUsageFlags & vk::ImageUsageFlagBits::eTransferSrc);
+        auto const imageUsageFlags = _readback_supported ?
+            vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc :
+            vk::ImageUsageFlags{vk::ImageUsageFlagBits::eColorAttachment};
 
-    hi_log_info("Finished building swap chain");
-    hi_log_info(" - extent=({}, {})", swapchainCreateInfo.imageExtent.width, swapchainCreateInfo.imageExtent.height);
-    hi_log_info(
-        " - colorSpace={}, format={}",
-        vk::to_string(swapchainCreateInfo.imageColorSpace),
-        vk::to_string(swapchainCreateInfo.imageFormat));
-    hi_log_info(
-        " - presentMode={}, imageCount={}", vk::to_string(swapchainCreateInfo.presentMode), swapchainCreateInfo.minImageCount);
+        vk::SwapchainCreateInfoKHR swapchainCreateInfo{
+            vk::SwapchainCreateFlagsKHR(),
+            intrinsic,
+            nrSwapchainImages,
+            swapchainImageFormat.format,
+            swapchainImageFormat.colorSpace,
+            swapchainImageExtent,
+            1, // imageArrayLayers
+            imageUsageFlags,
+            sharingMode,
+            sharingMode == vk::SharingMode::eConcurrent ? narrow_cast<uint32_t>(sharingQueueFamilyAllIndices.size()) : 0,
+            sharingMode == vk::SharingMode::eConcurrent ? sharingQueueFamilyAllIndices.data() : nullptr,
+            vk::SurfaceTransformFlagBitsKHR::eIdentity,
+            vk::CompositeAlphaFlagBitsKHR::eOpaque,
+            _device->get_present_mode(intrinsic, nullptr, lowLatencyPresentation),
+            VK_TRUE, // clipped
+            old_swapchain};
+
+        vk::Result const result = _device->createSwapchainKHR(&swapchainCreateInfo, nullptr, &swapchain);
+        switch (result) {
+        case vk::Result::eSuccess:
+            break;
+
+        case vk::Result::eErrorSurfaceLostKHR:
+            return gfx_surface_loss::window_lost;
+
+        default:
+            throw gui_error(std::format("Unknown result from createSwapchainKHR(). '{}'", to_string(result)));
+        }
+
+        hi_log_info("Finished building swap chain");
+        hi_log_info(" - extent=({}, {})", swapchainCreateInfo.imageExtent.width, swapchainCreateInfo.imageExtent.height);
+        hi_log_info(
+            " - colorSpace={}, format={}",
+            vk::to_string(swapchainCreateInfo.imageColorSpace),
+            vk::to_string(swapchainCreateInfo.imageFormat));
+        hi_log_info(
+            " - presentMode={}, imageCount={}, presentWait={}, readback={}",
+            vk::to_string(swapchainCreateInfo.presentMode),
+            swapchainCreateInfo.minImageCount,
+            _wait_for_present,
+            _readback_supported);
+    }
 
     // Create depth matching the swapchain.
     vk::ImageCreateInfo const depthImageCreateInfo = {
         vk::ImageCreateFlags(),
         vk::ImageType::e2D,
         depthImageFormat,
-        vk::Extent3D(swapchainCreateInfo.imageExtent.width, swapchainCreateInfo.imageExtent.height, 1),
+        vk::Extent3D(swapchainImageExtent.width, swapchainImageExtent.height, 1),
         1, // mipLevels
         1, // arrayLayers
         vk::SampleCountFlagBits::e1,
@@ -658,7 +1153,8 @@ inline gfx_surface_loss gfx_surface::build_swapchain(std::size_t new_count, exte
     depthAllocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
     depthAllocationCreateInfo.pUserData = const_cast<char *>("vk::Image depth attachment");
     depthAllocationCreateInfo.usage = _device->lazyMemoryUsage;
-    std::tie(depthImage, depthImageAllocation) = _device->createImage(depthImageCreateInfo, depthAllocationCreateInfo);
+    std::tie(depthImage, depthImageAllocation) =
+        _device->createImage(depthImageCreateInfo, depthAllocationCreateInfo, gfx_memory_category::swapchain);
     _device->setDebugUtilsObjectNameEXT(depthImage, "vk::Image depth attachment");
 
     // Create color image matching the swapchain.
@@ -666,7 +1162,7 @@ inline gfx_surface_loss gfx_surface::build_swapchain(std::size_t new_count, exte
         vk::ImageCreateFlags(),
         vk::ImageType::e2D,
         colorImageFormat,
-        vk::Extent3D(swapchainCreateInfo.imageExtent.width, swapchainCreateInfo.imageExtent.height, 1),
+        vk::Extent3D(swapchainImageExtent.width, swapchainImageExtent.height, 1),
         1, // mipLevels
         1, // arrayLayers
         vk::SampleCountFlagBits::e1,
@@ -682,21 +1178,97 @@ inline gfx_surface_loss gfx_surface::build_swapchain(std::size_t new_count, exte
     colorAllocationCreateInfo.pUserData = const_cast<char *>("vk::Image color attachment");
     colorAllocationCreateInfo.usage = _device->lazyMemoryUsage;
 
-    std::tie(colorImages[0], colorImageAllocations[0]) = _device->createImage(colorImageCreateInfo, colorAllocationCreateInfo);
+    std::tie(colorImages[0], colorImageAllocations[0]) =
+        _device->createImage(colorImageCreateInfo, colorAllocationCreateInfo, gfx_memory_category::swapchain);
     _device->setDebugUtilsObjectNameEXT(colorImages[0], "vk::Image color attachment");
 
     return gfx_surface_loss::none;
 }
 
+inline void gfx_surface::build_offscreen_images(std::size_t new_count, extent2 new_size)
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    hi_log_info("Building offscreen images");
+
+    // An sRGB format allows frames to be rendered with the direct render pass, like most swapchains.
+    swapchainImageFormat = vk::SurfaceFormatKHR{vk::Format::eB8G8R8A8Srgb, vk::ColorSpaceKHR::eSrgbNonlinear};
+    nrSwapchainImages = narrow_cast<uint32_t>(new_count);
+    swapchainImageExtent = VkExtent2D{round_cast<uint32_t>(new_size.width()), round_cast<uint32_t>(new_size.height())};
+    _offscreen_image_index = 0;
+
+    vk::ImageCreateInfo const imageCreateInfo = {
+        vk::ImageCreateFlags(),
+        vk::ImageType::e2D,
+        swapchainImageFormat.format,
+        vk::Extent3D(swapchainImageExtent.width, swapchainImageExtent.height, 1),
+        1, // mipLevels
+        1, // arrayLayers
+        vk::SampleCountFlagBits::e1,
+        vk::ImageTiling::eOptimal,
+        vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc,
+        vk::SharingMode::eExclusive,
+        0,
+        nullptr,
+        vk::ImageLayout::eUndefined};
+
+    VmaAllocationCreateInfo allocationCreateInfo = {};
+    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
+    allocationCreateInfo.pUserData = const_cast<char *>("vk::Image offscreen");
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+
+    offscreen_images.resize(nrSwapchainImages);
+    offscreen_image_allocations.resize(nrSwapchainImages);
+    for (auto i = 0_uz; i != offscreen_images.size(); ++i) {
+        std::tie(offscreen_images[i], offscreen_image_allocations[i]) =
+            _device->createImage(imageCreateInfo, allocationCreateInfo, gfx_memory_category::swapchain);
+        _device->setDebugUtilsObjectNameEXT(offscreen_images[i], "vk::Image offscreen");
+    }
+
+    hi_log_info(" - extent=({}, {}), imageCount={}", swapchainImageExtent.width, swapchainImageExtent.height, nrSwapchainImages);
+}
+
+inline std::optional<uint32_t> gfx_surface::acquire_next_offscreen_image(vk::Semaphore image_available_semaphore)
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    // The fence of the frame-in-flight was waited on, the image of the frame before it is no longer in use.
+    auto const r = _offscreen_image_index;
+    if (++_offscreen_image_index == offscreen_images.size()) {
+        _offscreen_image_index = 0;
+    }
+
+    // Signal the semaphore like the presentation engine would, so that the delegates
+    // and the command buffer wait for the image in the same way as for a swapchain.
+    auto const signalSemaphores = std::array{image_available_semaphore};
+    auto const submitInfo = std::array{vk::SubmitInfo{
+        0, nullptr, nullptr, 0, nullptr, narrow_cast<uint32_t>(signalSemaphores.size()), signalSemaphores.data()}};
+    _graphics_queue->queue.submit(submitInfo, vk::Fence{});
+    return r;
+}
+
 inline void gfx_surface::teardown_swapchain()
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
     _device->destroy(swapchain);
-    _device->destroyImage(depthImage, depthImageAllocation);
+    swapchain = vk::SwapchainKHR{};
+    _present_id = 0;
+    _present_input_time_point = {};
+    for (auto i = 0_uz; i != offscreen_images.size(); ++i) {
+        _device->destroyImage(offscreen_images[i], offscreen_image_allocations[i], gfx_memory_category::swapchain);
+    }
+    offscreen_images.clear();
+    offscreen_image_allocations.clear();
+
+    _device->destroyImage(depthImage, depthImageAllocation, gfx_memory_category::swapchain);
+    depthImage = vk::Image{};
+    depthImageAllocation = VK_NULL_HANDLE;
 
     for (std::size_t i = 0; i != colorImages.size(); ++i) {
-        _device->destroyImage(colorImages[i], colorImageAllocations[i]);
+        _device->destroyImage(colorImages[i], colorImageAllocations[i], gfx_memory_category::swapchain);
+        colorImages[i] = vk::Image{};
+        colorImageAllocations[i] = VK_NULL_HANDLE;
     }
 }
 
@@ -724,7 +1296,7 @@ inline void gfx_surface::build_frame_buffers()
         colorDescriptorImageInfos[i] = {vk::Sampler(), colorImageViews[i], vk::ImageLayout::eShaderReadOnlyOptimal};
     }
 
-    auto swapchain_images = _device->getSwapchainImagesKHR(swapchain);
+    auto swapchain_images = offscreen() ? offscreen_images : _device->getSwapchainImagesKHR(swapchain);
     for (auto image : swapchain_images) {
         auto image_view = _device->createImageView(
             {vk::ImageViewCreateFlags(),
@@ -746,8 +1318,28 @@ inline void gfx_surface::build_frame_buffers()
             1 // layers
         });
 
+        auto direct_frame_buffer = vk::Framebuffer{};
+        if (directRenderPass) {
+            auto const direct_attachments = std::array{depthImageView, image_view};
+
+            direct_frame_buffer = _device->createFramebuffer({
+                vk::FramebufferCreateFlags(),
+                directRenderPass,
+                narrow_cast<uint32_t>(direct_attachments.size()),
+                direct_attachments.data(),
+                swapchainImageExtent.width,
+                swapchainImageExtent.height,
+                1 // layers
+            });
+        }
+
         swapchain_image_infos.emplace_back(
-            std::move(image), std::move(image_view), std::move(frame_buffer), aarectangle{}, false);
+            std::move(image),
+            std::move(image_view),
+            std::move(frame_buffer),
+            std::move(direct_frame_buffer),
+            aarectangle{},
+            false);
     }
 
     hi_assert(swapchain_image_infos.size() == swapchain_images.size());
@@ -759,13 +1351,16 @@ inline void gfx_surface::teardown_frame_buffers()
 
     for (auto& info : swapchain_image_infos) {
         _device->destroy(info.frame_buffer);
+        _device->destroy(info.direct_frame_buffer);
         _device->destroy(info.image_view);
     }
     swapchain_image_infos.clear();
 
     _device->destroy(depthImageView);
+    depthImageView = vk::ImageView{};
     for (std::size_t i = 0; i != colorImageViews.size(); ++i) {
         _device->destroy(colorImageViews[i]);
+        colorImageViews[i] = vk::ImageView{};
     }
 }
 
@@ -951,6 +1546,118 @@ inline void gfx_surface::build_render_passes()
     renderPass = _device->createRenderPass(render_pass_create_info);
     auto const granularity = _device->getRenderAreaGranularity(renderPass);
     _render_area_granularity = extent2{narrow_cast<float>(granularity.width), narrow_cast<float>(granularity.height)};
+
+    build_direct_render_pass();
+}
+
+/** Build the direct render pass.
+ *
+ * One pass, with 3 subpasses:
+ *  1. box shader: to swapchain-attachment+depth
+ *  2. image shader: to swapchain-attachment+depth
+ *  3. sdf shader: to swapchain-attachment+depth
+ *
+ * The direct render pass is used for frames that do not need the tone-mapper,
+ * this saves a full-screen pass and the bandwidth of the float-16 color-attachment.
+ * It is only build when the swapchain uses the sRGB color space, so that the
+ * blending in the swapchain format matches the clamping of the tone-mapper.
+ */
+inline void gfx_surface::build_direct_render_pass()
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    if (swapchainImageFormat.colorSpace != vk::ColorSpaceKHR::eSrgbNonlinear) {
+        directRenderPass = vk::RenderPass{};
+        return;
+    }
+
+    auto const attachment_descriptions = std::array{
+        vk::AttachmentDescription{
+            // Depth attachment
+            vk::AttachmentDescriptionFlags(),
+            depthImageFormat,
+            vk::SampleCountFlagBits::e1,
+            vk::AttachmentLoadOp::eClear,
+            vk::AttachmentStoreOp::eDontCare,
+            vk::AttachmentLoadOp::eDontCare, // stencilLoadOp
+            vk::AttachmentStoreOp::eDontCare, // stencilStoreOp
+            vk::ImageLayout::eUndefined, // initialLayout
+            vk::ImageLayout::eDepthStencilAttachmentOptimal // finalLayout
+        },
+        vk::AttachmentDescription{
+            // Swapchain attachment, cleared inside the render area.
+            vk::AttachmentDescriptionFlags(),
+            swapchainImageFormat.format,
+            vk::SampleCountFlagBits::e1,
+            vk::AttachmentLoadOp::eClear,
+            vk::AttachmentStoreOp::eStore,
+            vk::AttachmentLoadOp::eDontCare, // stencilLoadOp
+            vk::AttachmentStoreOp::eDontCare, // stencilStoreOp
+            vk::ImageLayout::ePresentSrcKHR, // initialLayout
+            vk::ImageLayout::ePresentSrcKHR // finalLayout
+        }};
+
+    auto const depth_attachment_reference = vk::AttachmentReference{0, vk::ImageLayout::eDepthStencilAttachmentOptimal};
+    auto const swapchain_attachment_references = std::array{vk::AttachmentReference{1, vk::ImageLayout::eColorAttachmentOptimal}};
+
+    auto const subpass_description = vk::SubpassDescription{
+        vk::SubpassDescriptionFlags(),
+        vk::PipelineBindPoint::eGraphics,
+        0, // inputAttchmentReferencesCount
+        nullptr, // inputAttachmentReferences
+        narrow_cast<uint32_t>(swapchain_attachment_references.size()),
+        swapchain_attachment_references.data(),
+        nullptr, // resolveAttachments
+        &depth_attachment_reference};
+
+    // Subpass 0 Box, 1 Image, 2 SDF.
+    auto const subpass_descriptions = std::array{subpass_description, subpass_description, subpass_description};
+
+    auto const subpass_dependency = std::array{
+        vk::SubpassDependency{
+            VK_SUBPASS_EXTERNAL,
+            0,
+            vk::PipelineStageFlagBits::eBottomOfPipe,
+            vk::PipelineStageFlagBits::eColorAttachmentOutput,
+            vk::AccessFlagBits::eMemoryRead,
+            vk::AccessFlagBits::eColorAttachmentRead | vk::AccessFlagBits::eColorAttachmentWrite,
+            vk::DependencyFlagBits::eByRegion},
+        vk::SubpassDependency{
+            0,
+            1,
+            vk::PipelineStageFlagBits::eColorAttachmentOutput,
+            vk::PipelineStageFlagBits::eColorAttachmentOutput,
+            vk::AccessFlagBits::eColorAttachmentWrite,
+            vk::AccessFlagBits::eColorAttachmentRead,
+            vk::DependencyFlagBits::eByRegion},
+        vk::SubpassDependency{
+            1,
+            2,
+            vk::PipelineStageFlagBits::eColorAttachmentOutput,
+            vk::PipelineStageFlagBits::eColorAttachmentOutput,
+            vk::AccessFlagBits::eColorAttachmentWrite,
+            vk::AccessFlagBits::eColorAttachmentRead,
+            vk::DependencyFlagBits::eByRegion},
+        vk::SubpassDependency{
+            2,
+            VK_SUBPASS_EXTERNAL,
+            vk::PipelineStageFlagBits::eColorAttachmentOutput,
+            vk::PipelineStageFlagBits::eBottomOfPipe,
+            vk::AccessFlagBits::eColorAttachmentRead | vk::AccessFlagBits::eColorAttachmentWrite,
+            vk::AccessFlagBits::eMemoryRead,
+            vk::DependencyFlagBits::eByRegion}};
+
+    vk::RenderPassCreateInfo const render_pass_create_info = {
+        vk::RenderPassCreateFlags(),
+        narrow_cast<uint32_t>(attachment_descriptions.size()), // attachmentCount
+        attachment_descriptions.data(), // attachments
+        narrow_cast<uint32_t>(subpass_descriptions.size()), // subpassCount
+        subpass_descriptions.data(), // subpasses
+        narrow_cast<uint32_t>(subpass_dependency.size()), // dependencyCount
+        subpass_dependency.data() // dependencies
+    };
+
+    directRenderPass = _device->createRenderPass(render_pass_create_info);
 }
 
 inline void gfx_surface::teardown_render_passes()
@@ -958,45 +1665,117 @@ inline void gfx_surface::teardown_render_passes()
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
     _device->destroy(renderPass);
+    _device->destroy(directRenderPass);
+    directRenderPass = vk::RenderPass{};
 }
 
 inline void gfx_surface::build_semaphores()
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
-    imageAvailableSemaphore = _device->createSemaphore();
-    renderFinishedSemaphore = _device->createSemaphore();
+    frame_in_flight_infos.resize(_num_frames_in_flight);
+    _frame_in_flight_index = 0;
+
+    for (auto& frame : frame_in_flight_infos) {
+        frame.image_available_semaphore = _device->createSemaphore();
+        frame.render_finished_semaphore = _device->createSemaphore();
 
-    // This fence is used to wait for the Window and its Pipelines to be idle.
-    // It should therefor be signed at the start so that when no rendering has been
-    // done it is still idle.
-    renderFinishedFence = _device->createFence({vk::FenceCreateFlagBits::eSignaled});
+        // This fence is used to wait for the Window and its Pipelines to be idle.
+        // It should therefor be signed at the start so that when no rendering has been
+        // done it is still idle.
+        frame.render_finished_fence = _device->createFence({vk::FenceCreateFlagBits::eSignaled});
+    }
 }
 
 inline void gfx_surface::teardown_semaphores()
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
-    _device->destroy(renderFinishedSemaphore);
-    _device->destroy(imageAvailableSemaphore);
-    _device->destroy(renderFinishedFence);
+    for (auto& frame : frame_in_flight_infos) {
+        _device->destroy(frame.render_finished_semaphore);
+        _device->destroy(frame.image_available_semaphore);
+        _device->destroy(frame.render_finished_fence);
+        frame.render_finished_semaphore = vk::Semaphore{};
+        frame.image_available_semaphore = vk::Semaphore{};
+        frame.render_finished_fence = vk::Fence{};
+    }
 }
 
 inline void gfx_surface::build_command_buffers()
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
-    auto const commandBuffers = _device->allocateCommandBuffers({_graphics_queue->command_pool, vk::CommandBufferLevel::ePrimary, 1});
+    frame_in_flight_infos.resize(_num_frames_in_flight);
+
+    // Each frame-in-flight has its own command pool, so that it can be reset as a whole
+    // without synchronizing with the other frames.
+    for (auto& frame : frame_in_flight_infos) {
+        frame.command_pool = _device->createCommandPool(
+            {vk::CommandPoolCreateFlagBits::eTransient, _graphics_queue->family_queue_index});
+
+        auto const commandBuffers =
+            _device->allocateCommandBuffers({frame.command_pool, vk::CommandBufferLevel::ePrimary, 1});
+        frame.command_buffer = commandBuffers.at(0);
+    }
 
-    commandBuffer = commandBuffers.at(0);
+    timestamp_queries.build(*_device, _graphics_queue->family_queue_index, frame_in_flight_infos.size());
+    _readback.build(frame_in_flight_infos.size());
 }
 
 inline void gfx_surface::teardown_command_buffers()
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
-    auto const commandBuffers = std::vector<vk::CommandBuffer>{commandBuffer};
 
-    _device->freeCommandBuffers(_graphics_queue->command_pool, commandBuffers);
+    timestamp_queries.teardown(*_device);
+    _readback.teardown(*_device);
+
+    for (auto& frame : frame_in_flight_infos) {
+        // Destroying the pool also frees its command buffers.
+        _device->destroy(frame.command_pool);
+        frame.command_pool = vk::CommandPool{};
+        frame.command_buffer = vk::CommandBuffer{};
+    }
+}
+
+inline void gfx_surface::build_vertex_ring()
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    // The quad index buffer uses 16 bit indices.
+    constexpr std::size_t max_num_vertices = 1 << 16;
+    // Boxes and glyphs are drawn with one instance per quad.
+    constexpr std::size_t max_num_boxes = max_num_vertices / 4;
+    constexpr std::size_t max_num_glyphs = max_num_vertices / 4;
+
+    vertex_ring.build(
+        *_device,
+        _num_frames_in_flight,
+        {sizeof(gfx_pipeline_box::instance) * max_num_boxes,
+         sizeof(gfx_pipeline_image::vertex) * max_num_vertices,
+         sizeof(gfx_pipeline_SDF::instance) * max_num_glyphs,
+         sizeof(gfx_pipeline_override::vertex) * max_num_vertices},
+        "surface vertex ring");
+    use_vertex_ring_segment();
+}
+
+inline void gfx_surface::teardown_vertex_ring()
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    box_pipeline->set_vertex_buffer(vk::Buffer{}, 0, {});
+    image_pipeline->set_vertex_buffer(vk::Buffer{}, 0, {});
+    SDF_pipeline->set_vertex_buffer(vk::Buffer{}, 0, {});
+    override_pipeline->set_vertex_buffer(vk::Buffer{}, 0, {});
+    vertex_ring.teardown(*_device);
+}
+
+inline void gfx_surface::use_vertex_ring_segment() noexcept
+{
+    auto const buffer = vertex_ring.buffer();
+    box_pipeline->set_vertex_buffer(buffer, vertex_ring.offset(0), vertex_ring.span<gfx_pipeline_box::instance>(0));
+    image_pipeline->set_vertex_buffer(buffer, vertex_ring.offset(1), vertex_ring.span<gfx_pipeline_image::vertex>(1));
+    SDF_pipeline->set_vertex_buffer(buffer, vertex_ring.offset(2), vertex_ring.span<gfx_pipeline_SDF::instance>(2));
+    override_pipeline->set_vertex_buffer(buffer, vertex_ring.offset(3), vertex_ring.span<gfx_pipeline_override::vertex>(3));
 }
 
 [[nodiscard]] inline std::unique_ptr<gfx_surface> make_unique_gfx_surface(os_handle instance, void *os_window)
@@ -1021,4 +1800,20 @@ inline void gfx_surface::teardown_command_buffers()
     return surface;
 }
 
+[[nodiscard]] inline std::unique_ptr<gfx_surface> make_unique_offscreen_gfx_surface(extent2 size)
+{
+    auto const lock = std::scoped_lock(gfx_system_mutex);
+
+    auto surface = std::make_unique<gfx_surface>(vk::SurfaceKHR{});
+
+    auto device = find_best_device(*surface);
+    if (not device) {
+        throw gfx_error("Could not find a vulkan-device for an offscreen surface");
+    }
+    surface->set_device(device);
+    surface->update(size);
+
+    return surface;
+}
+
 } // namespace hi::inline v1
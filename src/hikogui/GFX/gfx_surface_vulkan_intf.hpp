@@ -8,15 +8,22 @@
 #include "gfx_surface_delegate_vulkan.hpp"
 #include "gfx_device_vulkan_intf.hpp"
 #include "gfx_queue_vulkan.hpp"
+#include "gfx_vertex_ring_vulkan.hpp"
+#include "gfx_timestamp_queries_vulkan.hpp"
+#include "gfx_readback_vulkan.hpp"
 #include "gfx_pipeline_image_vulkan_intf.hpp"
 #include "gfx_pipeline_box_vulkan_intf.hpp"
 #include "gfx_pipeline_SDF_vulkan_intf.hpp"
 #include "gfx_pipeline_override_vulkan_intf.hpp"
 #include "gfx_pipeline_tone_mapper_vulkan_intf.hpp"
+#include "draw_context_intf.hpp"
 #include "../macros.hpp"
 #include <vulkan/vulkan.hpp>
 #include <vma/vk_mem_alloc.h>
 #include <optional>
+#include <chrono>
+#include <vector>
+#include <utility>
 
 hi_export_module(hikogui.GFX : gfx_surface_intf);
 
@@ -26,19 +33,57 @@ struct swapchain_image_info {
     vk::Image image;
     vk::ImageView image_view;
     vk::Framebuffer frame_buffer;
+
+    /** The frame buffer of the direct render pass, only available on a standard dynamic range swapchain.
+     */
+    vk::Framebuffer direct_frame_buffer;
+
     aarectangle redraw_rectangle;
     bool layout_is_present = false;
 };
 
+/** The resources used by a single frame-in-flight.
+ */
+struct frame_in_flight_info {
+    vk::CommandPool command_pool;
+    vk::CommandBuffer command_buffer;
+    vk::Semaphore image_available_semaphore;
+    vk::Semaphore render_finished_semaphore;
+
+    /** Signaled when the GPU has finished rendering this frame.
+     */
+    vk::Fence render_finished_fence;
+};
+
 class gfx_surface {
 public:
     gfx_surface_state state = gfx_surface_state::has_window;
     gfx_surface_loss loss = gfx_surface_loss::none;
 
+    /** The Vulkan surface of the window, or null for an offscreen surface.
+     */
     vk::SurfaceKHR intrinsic;
 
+    /** The GPU policy of this surface, preferring an integrated or a discrete GPU.
+     *
+     * A change takes effect on the next call to `reselect_device()`.
+     */
+    hi::policy gpu_policy = policy::unspecified;
+
+    /** The LUID of the display adapter that drives the monitor of the window, or zero when unknown.
+     *
+     * The device with this LUID is preferred, so that the image does not need to be
+     * copied between GPUs before it is displayed.
+     */
+    uint64_t display_luid = 0;
+
     vk::SwapchainKHR swapchain;
 
+    /** The images that replace the swapchain of an offscreen surface.
+     */
+    std::vector<vk::Image> offscreen_images;
+    std::vector<VmaAllocation> offscreen_image_allocations;
+
     constexpr static uint32_t defaultNumberOfSwapchainImages = 2;
 
     uint32_t nrSwapchainImages;
@@ -60,11 +105,37 @@ public:
 
     vk::RenderPass renderPass;
 
-    vk::CommandBuffer commandBuffer;
+    /** A render pass without the tone-mapper that renders directly into the swapchain.
+     *
+     * The direct render pass is only build when the swapchain uses the sRGB color space.
+     * It has the box, image and SDF subpasses of `renderPass`.
+     */
+    vk::RenderPass directRenderPass;
+
+    /** The number of frames the CPU may record while the GPU is still rendering previous frames.
+     *
+     * With two or three frames in flight the CPU builds the next frame while the
+     * GPU renders the current one. The value is clamped between 1 and
+     * `maximumNumberOfFramesInFlight`, a change takes effect when the surface is
+     * built for a new device.
+     */
+    static inline std::size_t numberOfFramesInFlight = 2;
+    constexpr static std::size_t maximumNumberOfFramesInFlight = 3;
+
+    /** Present with the lowest latency between user input and the image on the screen.
+     *
+     * The swapchain prefers the mailbox present mode. When the device supports
+     * present-wait, a frame is started only after the previous frame was displayed,
+     * so that frames do not queue up in the swapchain. A change takes effect when
+     * the swapchain is rebuilt.
+     */
+    static inline bool lowLatencyPresentation = false;
+
+    /** The maximum time to wait for the previous frame to be displayed.
+     */
+    constexpr static std::chrono::nanoseconds maximumPresentWait = std::chrono::milliseconds(100);
 
-    vk::Semaphore imageAvailableSemaphore;
-    vk::Semaphore renderFinishedSemaphore;
-    vk::Fence renderFinishedFence;
+    std::vector<frame_in_flight_info> frame_in_flight_infos;
 
     std::unique_ptr<gfx_pipeline_image> image_pipeline;
     std::unique_ptr<gfx_pipeline_box> box_pipeline;
@@ -72,6 +143,14 @@ public:
     std::unique_ptr<gfx_pipeline_override> override_pipeline;
     std::unique_ptr<gfx_pipeline_tone_mapper> tone_mapper_pipeline;
 
+    /** The vertices of the box, image, SDF and override pipelines.
+     */
+    gfx_vertex_ring vertex_ring;
+
+    /** The GPU timestamps around each pipeline, when `gfx_timestamp_queries::enabled`.
+     */
+    gfx_timestamp_queries timestamp_queries;
+
     gfx_surface(vk::SurfaceKHR surface) : intrinsic(surface)
     {
         box_pipeline = std::make_unique<gfx_pipeline_box>(this);
@@ -103,13 +182,59 @@ public:
      */
     void set_device(gfx_device *device) noexcept;
 
+    /** Select the best device for this surface again.
+     *
+     * Called when the window moved to another monitor, or when the
+     * `gpu_policy` was changed. The glyph atlas of the current device
+     * is copied to the new device, so that text is drawn in the first frame.
+     */
+    void reselect_device() noexcept;
+
     [[nodiscard]] gfx_device *device() const noexcept
     {
         return _device;
     }
 
+    /** Check if this surface renders into images instead of a window.
+     *
+     * An offscreen surface has no swapchain; frames are rendered round-robin
+     * into its images and are never presented. It is used to measure the
+     * rendering of a widget tree without a window, for example in benchmarks.
+     */
+    [[nodiscard]] bool offscreen() const noexcept
+    {
+        return not intrinsic;
+    }
+
     [[nodiscard]] extent2 size() const noexcept;
 
+    /** The number of frames in flight, fixed while the surface has a device.
+     */
+    [[nodiscard]] std::size_t num_frames_in_flight() const noexcept
+    {
+        return _num_frames_in_flight;
+    }
+
+    /** The index of the frame-in-flight that is being recorded.
+     *
+     * Pipelines use this index to select their per-frame resources.
+     */
+    [[nodiscard]] std::size_t frame_in_flight_index() const noexcept
+    {
+        return _frame_in_flight_index;
+    }
+
+    /** Check if the frame that is being recorded bypasses the tone-mapper.
+     *
+     * The tone-mapper is bypassed when the frame can be rendered directly into
+     * the swapchain; when only colors in the standard dynamic range are drawn,
+     * without desaturation and without punching holes in the user interface.
+     */
+    [[nodiscard]] bool bypass_tone_mapper() const noexcept
+    {
+        return _bypass_tone_mapper;
+    }
+
     void update(extent2 new_size) noexcept;
 
     [[nodiscard]] draw_context render_start(aarectangle redraw_rectangle);
@@ -118,6 +243,32 @@ public:
     void add_delegate(gfx_surface_delegate *delegate) noexcept;
     void remove_delegate(gfx_surface_delegate *delegate) noexcept;
 
+    /** Read back the rendered frames periodically.
+     *
+     * The pixels are copied on the GPU after rendering and delivered when the
+     * frame has finished, without waiting on the GPU. Nothing is read back when
+     * the swapchain images can not be copied from.
+     *
+     * @param region The region of the surface in pixels, with the origin at the
+     *               bottom-left. An empty region reads back the whole surface.
+     * @param interval The minimum time between the frames that are read back,
+     *                 for example 200ms for 5 frames per second.
+     * @param callback Called with the pixels of each frame that was read back,
+     *                 see `gfx_readback::callback_type`.
+     */
+    void start_readback(aarectangle region, std::chrono::nanoseconds interval, gfx_readback::callback_type callback) noexcept;
+
+    /** Read back the next rendered frame once.
+     *
+     * @param region The region of the surface in pixels, or empty for the whole surface.
+     * @param callback Called with the pixels of the frame.
+     */
+    void request_readback(aarectangle region, gfx_readback::callback_type callback) noexcept;
+
+    /** Stop reading back frames.
+     */
+    void stop_readback() noexcept;
+
 private:
     struct delegate_type {
         gfx_surface_delegate *delegate;
@@ -131,6 +282,57 @@ private:
     gfx_queue_vulkan const *_graphics_queue;
     gfx_queue_vulkan const *_present_queue;
     extent2 _render_area_granularity;
+    std::size_t _num_frames_in_flight = 1;
+    std::size_t _frame_in_flight_index = 0;
+
+    /** The number of frames that have been started.
+     */
+    std::size_t _frame_count = 0;
+
+    /** The frame of the device in which this surface started its last frame.
+     */
+    std::size_t _device_frame = 0;
+
+    /** Swapchains that were replaced during a resize, with the frame count after which they are destroyed.
+     *
+     * After recreation the presentation engine may still be displaying the images of the old swapchain.
+     */
+    std::vector<std::pair<vk::SwapchainKHR, std::size_t>> _retired_swapchains;
+
+    /** The index of the next offscreen image to render into.
+     */
+    uint32_t _offscreen_image_index = 0;
+
+    /** Set by the draw context to the area of the glyphs that are not yet in an atlas.
+     */
+    aarectangle _pending_glyphs_rectangle = {};
+
+    /** Set by the draw context when colors outside of the standard dynamic range are drawn.
+     */
+    bool _has_hdr_colors = false;
+    bool _bypass_tone_mapper = false;
+
+    /** Wait for the previous frame to be displayed before rendering the next frame.
+     */
+    bool _wait_for_present = false;
+
+    /** The identifier of the last image presented to the swapchain, zero when nothing was presented yet.
+     */
+    uint64_t _present_id = 0;
+
+    /** The input time point of the frame with `_present_id`, zero when the frame did not handle input.
+     */
+    utc_nanoseconds _present_input_time_point = {};
+
+    /** The occluders of the widgets, collected before drawing each frame.
+     */
+    std::vector<draw_occluder> _occluders;
+
+    gfx_readback _readback;
+
+    /** The swapchain images may be copied from, which is needed to read them back.
+     */
+    bool _readback_supported = false;
 
     void teardown() noexcept;
     void build(extent2 new_size) noexcept;
@@ -138,40 +340,112 @@ private:
     gfx_surface_loss build_for_new_device() noexcept;
     gfx_surface_loss build_for_new_swapchain(extent2 new_size) noexcept;
 
-    void teardown_for_swapchain_lost() noexcept;
+    /** Recreate the swapchain and frame buffers with a new size.
+     *
+     * The render passes, pipelines, command buffers and semaphores are kept,
+     * and only the frames-in-flight of this surface are waited on.
+     *
+     * @param new_size The new size of the window.
+     * @return `gfx_surface_loss::none` on success. Otherwise the loss; when
+     *         the swapchain was partially torn down the state is set to
+     *         `gfx_surface_state::has_device`.
+     */
+    gfx_surface_loss resize_swapchain(extent2 new_size) noexcept;
+
+    /** Destroy the swapchains that were replaced during a resize.
+     *
+     * @param all Destroy all retired swapchains, not only those that are no longer presenting.
+     */
+    void destroy_retired_swapchains(bool all = false) noexcept;
+
+    /**
+     * @param teardown_delegates Tell the delegates that the swapchain is torn down.
+     */
+    void teardown_for_swapchain_lost(bool teardown_delegates = true) noexcept;
     void teardown_for_device_lost() noexcept;
     void teardown_for_window_lost() noexcept;
 
-    std::optional<uint32_t> acquire_next_image_from_swapchain();
-    void present_image_to_queue(uint32_t frameBufferIndex, vk::Semaphore renderFinishedSemaphore);
+    std::optional<uint32_t> acquire_next_image_from_swapchain(vk::Semaphore image_available_semaphore);
+
+    /** Select the next offscreen image to render into.
+     *
+     * @param image_available_semaphore The semaphore that is signaled when the image may be rendered into.
+     * @return The index of the image.
+     */
+    std::optional<uint32_t> acquire_next_offscreen_image(vk::Semaphore image_available_semaphore);
+    /** Present a swapchain image.
+     *
+     * @param frameBufferIndex The index of the swapchain image.
+     * @param renderFinishedSemaphore The semaphore that is signaled when rendering into the image has finished.
+     * @param input_time_point The time of the oldest user input handled in this frame, or zero.
+     */
+    void present_image_to_queue(uint32_t frameBufferIndex, vk::Semaphore renderFinishedSemaphore, utc_nanoseconds input_time_point);
+
+    /** Wait until the previous frame presented on the swapchain is displayed.
+     *
+     * The latency between the input handled by that frame and it being displayed
+     * is added to the "gfx_surface:input-to-present" counter.
+     */
+    void wait_for_previous_present();
+
+    /** Deliver the readbacks of the frames-in-flight that the GPU has finished.
+     */
+    void resolve_readbacks();
 
     /**
+     * @param frame The resources of the current frame-in-flight.
      * @param current_image Information about the swapchain-image to be rendered.
      * @param context The drawing context.
      */
-    void fill_command_buffer(swapchain_image_info const& current_image, draw_context const& context, vk::Rect2D render_area);
+    void fill_command_buffer(
+        frame_in_flight_info const& frame,
+        swapchain_image_info const& current_image,
+        draw_context const& context,
+        vk::Rect2D render_area);
 
     /** Submit the command buffer updated with fill command buffer.
      *
+     * @param frame The resources of the current frame-in-flight.
      * @param delegate_semaphore The semaphore of the last delegate to trigger writing into the swapchain-image.
      */
-    void submit_command_buffer(vk::Semaphore delegate_semaphore);
+    void submit_command_buffer(frame_in_flight_info const& frame, vk::Semaphore delegate_semaphore);
 
     bool read_surface_extent(extent2 minimum_size, extent2 maximum_size);
     bool check_surface_extent();
 
     void build_semaphores();
     void teardown_semaphores();
-    gfx_surface_loss build_swapchain(std::size_t new_count, extent2 new_size);
+    /**
+     * @param new_count The number of images in the swapchain.
+     * @param new_size The size of the images in the swapchain.
+     * @param old_swapchain The swapchain that is replaced, or null.
+     */
+    gfx_surface_loss build_swapchain(std::size_t new_count, extent2 new_size, vk::SwapchainKHR old_swapchain = {});
+    void build_offscreen_images(std::size_t new_count, extent2 new_size);
     void teardown_swapchain();
     void build_command_buffers();
     void teardown_command_buffers();
     void build_render_passes();
+    void build_direct_render_pass();
     void teardown_render_passes();
     void build_frame_buffers();
     void teardown_frame_buffers();
     void build_pipelines();
+
+    /** Compile the pipelines needed for the first frame on multiple threads.
+     */
+    void build_pipelines_concurrently();
     void teardown_pipelines();
+    void build_vertex_ring();
+    void teardown_vertex_ring();
+
+    /** Hand out the regions of the current segment of the vertex ring to the pipelines.
+     */
+    void use_vertex_ring_segment() noexcept;
+
+    /** Wait until the GPU has finished the frames-in-flight of this surface.
+     */
+    void wait_for_frames_in_flight();
 
     void wait_idle();
 
@@ -188,9 +462,17 @@ private:
 
 [[nodiscard]] std::unique_ptr<gfx_surface> make_unique_gfx_surface(os_handle instance, void *os_window);
 
+/** Make a surface that renders into images instead of a window.
+ *
+ * @param size The size of the images.
+ * @return The surface, with a device and images of the given size.
+ * @throws gfx_error When no Vulkan device was found.
+ */
+[[nodiscard]] std::unique_ptr<gfx_surface> make_unique_offscreen_gfx_surface(extent2 size);
+
 [[nodiscard]] inline gfx_device *find_best_device(gfx_surface const &surface)
 {
-    return find_best_device(surface.intrinsic);
+    return find_best_device(surface.intrinsic, surface.gpu_policy, surface.display_luid);
 }
 
 } // namespace hi::inline v1
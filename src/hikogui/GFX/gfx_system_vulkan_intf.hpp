@@ -5,6 +5,8 @@
 #pragma once
 
 #include "gfx_device_vulkan_intf.hpp"
+#include "../font/font.hpp"
+#include "../settings/settings.hpp"
 #include "../macros.hpp"
 #include <vulkan/vulkan.hpp>
 #include <unordered_set>
@@ -132,18 +134,46 @@ public:
         }
     }
 
-    
-    [[nodiscard]] gfx_device *find_best_device(vk::SurfaceKHR surface)
+    /** The GPU policy of the application.
+     *
+     * Used for surfaces that do not have their own GPU policy.
+     */
+    static inline hi::policy gpu_policy = policy::unspecified;
+
+    /** Find the best device for a Vulkan surface.
+     *
+     * The GPU policy is selected in the same order as `os_settings::preferred_gpus()`:
+     *  1. os_settings::gpu_policy(), the per-application setting of the operating system.
+     *  2. The @a performance_policy argument.
+     *  3. gfx_system::gpu_policy.
+     *
+     * @param surface The surface to find the best device for.
+     * @param performance_policy The GPU policy of the surface.
+     * @param display_luid The LUID of the display adapter driving the monitor of the window, or zero.
+     * @return A pointer to a gfx device.
+     */
+    [[nodiscard]] gfx_device *find_best_device(
+        vk::SurfaceKHR surface,
+        hi::policy performance_policy = policy::unspecified,
+        uint64_t display_luid = 0)
     {
         enumerate_devices();
 
         auto const lock = std::scoped_lock(gfx_system_mutex);
 
+        auto actual_policy = os_settings::gpu_policy();
+        if (actual_policy == policy::unspecified) {
+            actual_policy = performance_policy;
+        }
+        if (actual_policy == policy::unspecified) {
+            actual_policy = gpu_policy;
+        }
+
         int best_score = -1;
         gfx_device *best_device = nullptr;
 
         for (auto const& device : devices) {
-            auto const score = device->score(surface);
+            auto const score = device->score(surface, actual_policy, display_luid);
             if (score >= best_score) {
                 best_score = score;
                 best_device = device.get();
@@ -186,7 +216,12 @@ private:
         }
             
         for (auto physical_device : intrinsic.enumeratePhysicalDevices()) {
-            devices.push_back(std::make_shared<gfx_device>(physical_device));
+            // Each device has its own locations of the glyphs in the atlas, stored in the fonts.
+            if (devices.size() == font::max_num_atlases) {
+                hi_log_warning("Only the first {} Vulkan devices are used.", font::max_num_atlases);
+                break;
+            }
+            devices.push_back(std::make_shared<gfx_device>(physical_device, devices.size()));
         }
     }
 
@@ -279,12 +314,17 @@ inline vk::DispatchLoaderDynamic vulkan_loader() noexcept
 /** Find the best device for a Vulkan surface.
  * 
  * @param surface The surface to find the best device for.
+ * @param performance_policy The GPU policy of the surface.
+ * @param display_luid The LUID of the display adapter driving the monitor of the window, or zero.
  * @return A pointer to a gfx device.
  * @retval nullptr Could not find a Vulkan device for this surface.
  */
-[[nodiscard]] inline gfx_device *find_best_device(vk::SurfaceKHR surface)
+[[nodiscard]] inline gfx_device *find_best_device(
+    vk::SurfaceKHR surface,
+    hi::policy performance_policy = policy::unspecified,
+    uint64_t display_luid = 0)
 {
-    return gfx_system::global().find_best_device(surface);
+    return gfx_system::global().find_best_device(surface, performance_policy, display_luid);
 }
 
 /** Find the best device for a surface.
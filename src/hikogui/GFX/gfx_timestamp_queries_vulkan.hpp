@@ -0,0 +1,240 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "gfx_device_vulkan_intf.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../time/time.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.GFX : gfx_timestamp_queries);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** GPU timestamp queries to measure the duration of each pipeline of a surface.
+ *
+ * Each frame-in-flight has its own range of queries in a single query pool.
+ * The results are read when the frame-in-flight is reused, after its fence
+ * was waited on; reading the results will never stall the CPU.
+ *
+ * The durations are added to the global counters "gpu:box", "gpu:image",
+ * "gpu:SDF", "gpu:override", "gpu:tone_mapper" and "gpu:frame", which are
+ * logged periodically together with the statistics of the other counters.
+ */
+class gfx_timestamp_queries {
+public:
+    /** The points in the command buffer where a timestamp is written.
+     *
+     * Each point, except `start`, is written after the pipeline with the same name.
+     */
+    enum class point : uint32_t { start, box, image, SDF, override_, tone_mapper };
+
+    constexpr static uint32_t num_points = 6;
+
+    /** Enable GPU timestamp queries.
+     *
+     * @note Must be set before the first window is created.
+     */
+    static inline bool enabled = false;
+
+    gfx_timestamp_queries() noexcept = default;
+    gfx_timestamp_queries(gfx_timestamp_queries const&) = delete;
+    gfx_timestamp_queries(gfx_timestamp_queries&&) = delete;
+    gfx_timestamp_queries& operator=(gfx_timestamp_queries const&) = delete;
+    gfx_timestamp_queries& operator=(gfx_timestamp_queries&&) = delete;
+
+    ~gfx_timestamp_queries()
+    {
+        hi_assert(not _pool);
+    }
+
+    /** Create the query pool.
+     *
+     * Nothing is created when timestamp queries are not enabled or not supported.
+     *
+     * @param device The device to create the query pool on.
+     * @param queue_family_index The queue family of the command buffers that write the timestamps.
+     * @param num_frames The number of frames-in-flight.
+     */
+    void build(gfx_device const& device, uint32_t queue_family_index, std::size_t num_frames)
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        hi_assert(not _pool);
+
+        if (not enabled) {
+            return;
+        }
+
+        auto const queue_families = device.physicalIntrinsic.getQueueFamilyProperties();
+        hi_assert_bounds(queue_family_index, queue_families);
+
+        auto const valid_bits = queue_families[queue_family_index].timestampValidBits;
+        auto const period = device.physicalProperties.limits.timestampPeriod;
+        if (valid_bits == 0 or period == 0.0f) {
+            hi_log_warning("GPU timestamp queries are not supported on queue family {}.", queue_family_index);
+            return;
+        }
+
+        _valid_mask = valid_bits >= 64 ? ~uint64_t{0} : (uint64_t{1} << valid_bits) - 1;
+        _period = period;
+        _num_written.assign(num_frames, 0);
+        _pool = device.intrinsic.createQueryPool(
+            {vk::QueryPoolCreateFlags(), vk::QueryType::eTimestamp, narrow_cast<uint32_t>(num_frames * num_points)});
+    }
+
+    void teardown(gfx_device const& device) noexcept
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+        device.destroy(_pool);
+        _pool = vk::QueryPool{};
+        _num_written.clear();
+        _last_frame_duration = {};
+    }
+
+    /** Publish the timestamps of the previous use of a frame-in-flight.
+     *
+     * @pre The fence of the frame-in-flight has been waited on.
+     * @param device The device that owns the query pool.
+     * @param frame The index of the frame-in-flight.
+     */
+    void resolve(gfx_device const& device, std::size_t frame) noexcept
+    {
+        if (not _pool) {
+            return;
+        }
+
+        hi_axiom_bounds(frame, _num_written);
+        auto const num_written = std::exchange(_num_written[frame], 0);
+        if (num_written < 2) {
+            return;
+        }
+
+        auto timestamps = std::array<uint64_t, num_points>{};
+        auto const result = device.intrinsic.getQueryPoolResults(
+            _pool,
+            first_query(frame),
+            num_written,
+            num_written * sizeof(uint64_t),
+            timestamps.data(),
+            sizeof(uint64_t),
+            vk::QueryResultFlagBits::e64);
+
+        if (result != vk::Result::eSuccess) {
+            ++global_counter<"gpu:not_ready">;
+            return;
+        }
+
+        for (auto i = 1U; i != num_written; ++i) {
+            add_duration(static_cast<point>(i), duration(timestamps[i - 1], timestamps[i]));
+        }
+        _last_frame_duration = duration(timestamps[0], timestamps[num_written - 1]);
+        global_counter<"gpu:frame">.add_duration(time_stamp_count::count_from_duration(_last_frame_duration));
+    }
+
+    /** The GPU duration of the most recently resolved frame.
+     *
+     * The timestamps are read when a frame-in-flight is reused, so this is
+     * the duration of a frame that was rendered a few frames ago.
+     *
+     * @return The duration, or zero when timestamp queries are not enabled.
+     */
+    [[nodiscard]] std::chrono::nanoseconds last_frame_duration() const noexcept
+    {
+        return _last_frame_duration;
+    }
+
+    /** Reset the queries of a frame-in-flight.
+     *
+     * @note Must be recorded outside of a render pass, before the first `write()`.
+     * @param command_buffer The command buffer of the frame.
+     * @param frame The index of the frame-in-flight.
+     */
+    void reset(vk::CommandBuffer command_buffer, std::size_t frame) noexcept
+    {
+        if (not _pool) {
+            return;
+        }
+
+        command_buffer.resetQueryPool(_pool, first_query(frame), num_points);
+    }
+
+    /** Write a timestamp when all previous commands have finished.
+     *
+     * The points must be written in order, starting with `point::start`.
+     *
+     * @param command_buffer The command buffer of the frame.
+     * @param frame The index of the frame-in-flight.
+     * @param p The point in the frame.
+     */
+    void write(vk::CommandBuffer command_buffer, std::size_t frame, point p) noexcept
+    {
+        if (not _pool) {
+            return;
+        }
+
+        hi_axiom_bounds(frame, _num_written);
+        hi_axiom(std::to_underlying(p) == _num_written[frame]);
+
+        auto const query = first_query(frame) + std::to_underlying(p);
+        command_buffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, _pool, query);
+        ++_num_written[frame];
+    }
+
+private:
+    vk::QueryPool _pool = {};
+    uint64_t _valid_mask = 0;
+
+    /** The number of nanoseconds per timestamp tick.
+     */
+    float _period = 0.0f;
+
+    std::chrono::nanoseconds _last_frame_duration = {};
+
+    /** The number of timestamps written in the command buffer of each frame-in-flight.
+     */
+    std::vector<uint32_t> _num_written;
+
+    [[nodiscard]] static uint32_t first_query(std::size_t frame) noexcept
+    {
+        return narrow_cast<uint32_t>(frame * num_points);
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds duration(uint64_t first, uint64_t last) const noexcept
+    {
+        auto const ticks = (last - first) & _valid_mask;
+        return std::chrono::nanoseconds{static_cast<int64_t>(static_cast<double>(ticks) * _period)};
+    }
+
+    static void add_duration(point p, std::chrono::nanoseconds duration) noexcept
+    {
+        auto const count = time_stamp_count::count_from_duration(duration);
+
+        switch (p) {
+        case point::box:
+            return global_counter<"gpu:box">.add_duration(count);
+        case point::image:
+            return global_counter<"gpu:image">.add_duration(count);
+        case point::SDF:
+            return global_counter<"gpu:SDF">.add_duration(count);
+        case point::override_:
+            return global_counter<"gpu:override">.add_duration(count);
+        case point::tone_mapper:
+            return global_counter<"gpu:tone_mapper">.add_duration(count);
+        default:
+            hi_no_default();
+        }
+    }
+};
+
+}} // namespace hi::v1
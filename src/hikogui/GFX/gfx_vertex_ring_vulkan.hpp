@@ -0,0 +1,170 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "gfx_device_vulkan_intf.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vulkan/vulkan.hpp>
+#include <vma/vk_mem_alloc.h>
+#include <vector>
+#include <span>
+#include <cstddef>
+
+hi_export_module(hikogui.GFX : gfx_vertex_ring);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A ring of vertex buffers, one segment for each frame-in-flight.
+ *
+ * The ring is a single persistently mapped buffer in host-coherent memory.
+ * Each segment is divided in regions, one region for each pipeline.
+ * Since the memory is coherent and stays mapped there is no need to map,
+ * unmap or flush the vertex buffers each frame.
+ *
+ * A segment may only be written after the GPU has finished rendering the
+ * frame that used this segment before.
+ */
+class gfx_vertex_ring {
+public:
+    /** The alignment of each region in the buffer.
+     *
+     * This alignment satisfies the alignment of all vertex types.
+     */
+    constexpr static vk::DeviceSize region_alignment = 256;
+
+    gfx_vertex_ring() noexcept = default;
+    gfx_vertex_ring(gfx_vertex_ring const&) = delete;
+    gfx_vertex_ring(gfx_vertex_ring&&) = delete;
+    gfx_vertex_ring& operator=(gfx_vertex_ring const&) = delete;
+    gfx_vertex_ring& operator=(gfx_vertex_ring&&) = delete;
+
+    ~gfx_vertex_ring()
+    {
+        hi_assert(not _buffer);
+    }
+
+    /** Allocate the buffer.
+     *
+     * @param device The device to allocate the buffer on.
+     * @param num_frames The number of segments in the ring.
+     * @param region_sizes The size in bytes of each region in a segment.
+     * @param name The name of the buffer for debugging.
+     */
+    void build(gfx_device const& device, std::size_t num_frames, std::vector<vk::DeviceSize> const& region_sizes, char const *name)
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+        hi_assert(not _buffer);
+        hi_assert(num_frames > 0);
+
+        _region_offsets.clear();
+        _region_sizes.clear();
+        _segment_size = 0;
+        for (auto const region_size : region_sizes) {
+            _region_offsets.push_back(_segment_size);
+            _region_sizes.push_back(region_size);
+            _segment_size += ceil(region_size, region_alignment);
+        }
+        _num_frames = num_frames;
+        _frame = 0;
+
+        vk::BufferCreateInfo const bufferCreateInfo = {
+            vk::BufferCreateFlags(),
+            _segment_size * _num_frames,
+            vk::BufferUsageFlagBits::eVertexBuffer,
+            vk::SharingMode::eExclusive};
+        VmaAllocationCreateInfo allocationCreateInfo = {};
+        allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        allocationCreateInfo.pUserData = const_cast<char *>(name);
+        allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+        allocationCreateInfo.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+        std::tie(_buffer, _allocation) =
+            device.createBuffer(bufferCreateInfo, allocationCreateInfo, gfx_memory_category::vertex_ring);
+        device.setDebugUtilsObjectNameEXT(_buffer, name);
+
+        VmaAllocationInfo allocationInfo;
+        vmaGetAllocationInfo(device.allocator, _allocation, &allocationInfo);
+        _data = static_cast<std::byte *>(allocationInfo.pMappedData);
+        hi_assert_not_null(_data);
+    }
+
+    void teardown(gfx_device const& device) noexcept
+    {
+        hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+        if (_buffer) {
+            device.destroyBuffer(_buffer, _allocation, gfx_memory_category::vertex_ring);
+        }
+        _buffer = vk::Buffer{};
+        _allocation = {};
+        _data = nullptr;
+    }
+
+    [[nodiscard]] vk::Buffer buffer() const noexcept
+    {
+        return _buffer;
+    }
+
+    [[nodiscard]] std::size_t num_frames() const noexcept
+    {
+        return _num_frames;
+    }
+
+    /** The index of the current segment.
+     */
+    [[nodiscard]] std::size_t frame() const noexcept
+    {
+        return _frame;
+    }
+
+    /** Select the segment of a frame-in-flight.
+     *
+     * @param frame The index of the frame-in-flight.
+     */
+    void set_frame(std::size_t frame) noexcept
+    {
+        hi_axiom(frame < _num_frames);
+        _frame = frame;
+    }
+
+    /** The offset in bytes of a region of the current segment.
+     */
+    [[nodiscard]] vk::DeviceSize offset(std::size_t region) const noexcept
+    {
+        hi_axiom_bounds(region, _region_offsets);
+        return _frame * _segment_size + _region_offsets[region];
+    }
+
+    /** The mapped memory of a region of the current segment.
+     *
+     * @tparam T The vertex type.
+     * @param region The index of the region.
+     */
+    template<typename T>
+    [[nodiscard]] std::span<T> span(std::size_t region) const noexcept
+    {
+        hi_axiom_not_null(_data);
+        hi_axiom_bounds(region, _region_sizes);
+        static_assert(region_alignment % alignof(T) == 0);
+
+        // The GPU has created the memory, not the C++ application. Same as `gfx_device::mapMemory()`.
+        auto *ptr = reinterpret_cast<T *>(_data + offset(region));
+        return std::span<T>{ptr, narrow_cast<std::size_t>(_region_sizes[region] / sizeof(T))};
+    }
+
+private:
+    vk::Buffer _buffer = {};
+    VmaAllocation _allocation = {};
+    std::byte *_data = nullptr;
+
+    std::size_t _num_frames = 0;
+    std::size_t _frame = 0;
+    vk::DeviceSize _segment_size = 0;
+    std::vector<vk::DeviceSize> _region_offsets;
+    std::vector<vk::DeviceSize> _region_sizes;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,328 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../file/file.hpp"
+#include "../image/image.hpp"
+#include "../font/font.hpp"
+#include "../container/container.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include <system_error>
+
+hi_export_module(hikogui.GFX : sdf_glyph_cache);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A persistent cache of rasterized signed-distance-field glyphs.
+ *
+ * The cache file is memory mapped when it is opened, glyphs found in the
+ * cache do not need to be rasterized again. Glyphs that are added to the
+ * cache are kept in memory until `save()` writes a new cache file.
+ *
+ * Glyphs are identified by the hash of the font file and the glyph-id. The
+ * parameters used for rasterizing are stored in the header of the file, when
+ * the parameters change the complete cache is discarded.
+ *
+ * @note `find()` and `insert()` may be called from multiple threads.
+ */
+class sdf_glyph_cache {
+public:
+    /** The maximum number of bytes of pixels stored in the cache file.
+     */
+    constexpr static std::size_t max_num_pixel_bytes = 64 * 1024 * 1024;
+
+    sdf_glyph_cache() noexcept = default;
+    sdf_glyph_cache(sdf_glyph_cache const&) = delete;
+    sdf_glyph_cache(sdf_glyph_cache&&) = delete;
+    sdf_glyph_cache& operator=(sdf_glyph_cache const&) = delete;
+    sdf_glyph_cache& operator=(sdf_glyph_cache&&) = delete;
+
+    /** Open a glyph cache.
+     *
+     * @param path The path to the cache file, the file does not need to exist.
+     * @param draw_font_size The font size used to rasterize the glyphs.
+     * @param max_distance The maximum distance of the signed-distance-field.
+     */
+    sdf_glyph_cache(std::filesystem::path path, float draw_font_size, float max_distance) noexcept :
+        _path(std::move(path)), _draw_font_size(draw_font_size), _max_distance(max_distance)
+    {
+        load();
+    }
+
+    /** Find a glyph in the cache.
+     *
+     * @param font_hash The hash of the font file, see `font::file_hash`.
+     * @param glyph The glyph in the font.
+     * @param[out] image The image to copy the glyph into, the size must match the cached glyph.
+     * @return True if the glyph was found and copied into the image.
+     */
+    [[nodiscard]] bool find(uint64_t font_hash, glyph_id glyph, pixmap_span<sdf_r8> image) const noexcept
+    {
+        if (font_hash == 0) {
+            return false;
+        }
+
+        auto const lock = std::scoped_lock(_mutex);
+
+        auto const key = key_type{font_hash, *glyph};
+        if (auto const it = _entries.find(key); it != _entries.end()) {
+            auto const& entry = *it->second;
+            if (entry.width != image.width() or entry.height != image.height()) {
+                ++global_counter<"sdf_glyph_cache:mismatch">;
+                return false;
+            }
+
+            auto const pixels = as_span<std::byte const>(_view).subspan(narrow_cast<std::size_t>(entry.offset));
+            copy_pixels(pixels, image);
+            ++global_counter<"sdf_glyph_cache:hit">;
+            return true;
+        }
+
+        if (auto const it = _new_entries.find(key); it != _new_entries.end()) {
+            auto const& cached_image = it->second;
+            if (cached_image.width() != image.width() or cached_image.height() != image.height()) {
+                ++global_counter<"sdf_glyph_cache:mismatch">;
+                return false;
+            }
+
+            copy(pixmap_span<sdf_r8 const>{cached_image}, image);
+            ++global_counter<"sdf_glyph_cache:hit">;
+            return true;
+        }
+
+        ++global_counter<"sdf_glyph_cache:miss">;
+        return false;
+    }
+
+    /** Add a glyph to the cache.
+     *
+     * @param font_hash The hash of the font file, see `font::file_hash`.
+     * @param glyph The glyph in the font.
+     * @param image The rasterized glyph.
+     */
+    void insert(uint64_t font_hash, glyph_id glyph, pixmap_span<sdf_r8 const> image) noexcept
+    {
+        if (font_hash == 0 or _path.empty()) {
+            return;
+        }
+
+        auto const lock = std::scoped_lock(_mutex);
+
+        auto const key = key_type{font_hash, *glyph};
+        if (_entries.contains(key) or _new_entries.contains(key)) {
+            return;
+        }
+
+        if (_num_pixel_bytes + image.width() * image.height() > max_num_pixel_bytes) {
+            ++global_counter<"sdf_glyph_cache:full">;
+            return;
+        }
+
+        _num_pixel_bytes += image.width() * image.height();
+        _new_entries.emplace(key, pixmap<sdf_r8>{image});
+    }
+
+    /** Write the cache file when glyphs where added.
+     */
+    void save() noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+
+        if (_new_entries.empty()) {
+            return;
+        }
+
+        auto const num_entries = _entries.size() + _new_entries.size();
+
+        auto header = header_type{};
+        std::memcpy(header.magic, magic, sizeof(header.magic));
+        header.version = version;
+        header.num_entries = narrow_cast<uint32_t>(num_entries);
+        header.draw_font_size = _draw_font_size;
+        header.max_distance = _max_distance;
+
+        auto entries = std::vector<entry_type>{};
+        entries.reserve(num_entries);
+        auto pixels = bstring{};
+        pixels.reserve(_num_pixel_bytes);
+
+        auto const old_bytes = _view ? as_span<std::byte const>(_view) : std::span<std::byte const>{};
+        auto const pixels_offset = sizeof(header_type) + num_entries * sizeof(entry_type);
+
+        for (auto const& [key, old_entry] : _entries) {
+            auto entry = *old_entry;
+            entry.offset = pixels_offset + pixels.size();
+            entries.push_back(entry);
+
+            auto const num_bytes = std::size_t{old_entry->width} * old_entry->height;
+            auto const old_pixels = old_bytes.subspan(narrow_cast<std::size_t>(old_entry->offset), num_bytes);
+            pixels.append(old_pixels.data(), old_pixels.size());
+        }
+
+        for (auto const& [key, image] : _new_entries) {
+            auto entry = entry_type{};
+            entry.font_hash = key.font_hash;
+            entry.glyph = key.glyph;
+            entry.width = narrow_cast<uint16_t>(image.width());
+            entry.height = narrow_cast<uint16_t>(image.height());
+            entry.offset = pixels_offset + pixels.size();
+            entries.push_back(entry);
+
+            pixels.append(reinterpret_cast<std::byte const *>(image.data()), image.width() * image.height());
+        }
+
+        // The file that is being replaced must not be mapped.
+        _entries.clear();
+        _new_entries.clear();
+        _view = {};
+
+        try {
+            auto tmp_path = _path;
+            tmp_path += ".tmp";
+
+            auto file = hi::file(tmp_path, access_mode::truncate_or_create_for_write | access_mode::rename);
+            file.write(&header, sizeof(header));
+            file.write(entries.data(), entries.size() * sizeof(entry_type));
+            file.write(pixels);
+            file.flush();
+            file.rename(_path, true);
+
+            hi_log_info("Saved {} glyphs to glyph cache {}", num_entries, _path.string());
+
+        } catch (io_error const& e) {
+            hi_log_error("Could not save glyph cache to file. \"{}\"", e.what());
+        }
+
+        load();
+    }
+
+private:
+    constexpr static char magic[8] = {'h', 'i', 'g', 'l', 'y', 'p', 'h', '\0'};
+    constexpr static uint32_t version = 1;
+
+    struct header_type {
+        char magic[8];
+        uint32_t version;
+        uint32_t num_entries;
+        float draw_font_size;
+        float max_distance;
+    };
+
+    struct entry_type {
+        uint64_t font_hash;
+        uint64_t offset;
+        uint16_t glyph;
+        uint16_t width;
+        uint16_t height;
+        uint16_t reserved = 0;
+    };
+
+    struct key_type {
+        uint64_t font_hash;
+        uint16_t glyph;
+
+        [[nodiscard]] constexpr friend auto operator<=>(key_type const&, key_type const&) noexcept = default;
+    };
+
+    static_assert(sizeof(sdf_r8) == 1);
+    static_assert(std::is_trivially_copyable_v<header_type>);
+    static_assert(std::is_trivially_copyable_v<entry_type>);
+
+    std::filesystem::path _path = {};
+    float _draw_font_size = 0.0f;
+    float _max_distance = 0.0f;
+
+    mutable std::mutex _mutex;
+    file_view _view = {};
+    std::size_t _num_pixel_bytes = 0;
+
+    /** The entries in the mapped cache file.
+     */
+    std::map<key_type, entry_type const *> _entries;
+
+    /** The glyphs added since the cache file was mapped.
+     */
+    std::map<key_type, pixmap<sdf_r8>> _new_entries;
+
+    static void copy_pixels(std::span<std::byte const> src, pixmap_span<sdf_r8> dst) noexcept
+    {
+        for (auto y = 0_uz; y != dst.height(); ++y) {
+            std::memcpy(dst[y].data(), src.data() + y * dst.width(), dst.width());
+        }
+    }
+
+    void load() noexcept
+    {
+        _entries.clear();
+        _num_pixel_bytes = 0;
+
+        auto ec = std::error_code{};
+        if (_path.empty() or not std::filesystem::exists(_path, ec)) {
+            return;
+        }
+
+        try {
+            _view = file_view{_path};
+        } catch (io_error const& e) {
+            hi_log_warning("Could not open glyph cache file. \"{}\"", e.what());
+            return;
+        }
+
+        auto const bytes = as_span<std::byte const>(_view);
+        if (bytes.size() < sizeof(header_type)) {
+            hi_log_warning("Glyph cache {} is too small.", _path.string());
+            _view = {};
+            return;
+        }
+
+        auto const& header = *reinterpret_cast<header_type const *>(bytes.data());
+        if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 or header.version != version) {
+            hi_log_warning("Glyph cache {} has an unknown format.", _path.string());
+            _view = {};
+            return;
+        }
+
+        if (header.draw_font_size != _draw_font_size or header.max_distance != _max_distance) {
+            hi_log_info("Glyph cache {} was made with different parameters.", _path.string());
+            _view = {};
+            return;
+        }
+
+        if (sizeof(header_type) + std::size_t{header.num_entries} * sizeof(entry_type) > bytes.size()) {
+            hi_log_warning("Glyph cache {} is truncated.", _path.string());
+            _view = {};
+            return;
+        }
+
+        auto const *entries = reinterpret_cast<entry_type const *>(bytes.data() + sizeof(header_type));
+        for (auto i = 0_uz; i != header.num_entries; ++i) {
+            auto const& entry = entries[i];
+            auto const num_bytes = std::size_t{entry.width} * entry.height;
+            if (entry.offset > bytes.size() or num_bytes > bytes.size() - entry.offset) {
+                hi_log_warning("Glyph cache {} is corrupt.", _path.string());
+                _entries.clear();
+                _num_pixel_bytes = 0;
+                _view = {};
+                return;
+            }
+
+            _num_pixel_bytes += num_bytes;
+            _entries[key_type{entry.font_hash, entry.glyph}] = &entry;
+        }
+
+        hi_log_info("Loaded {} glyphs from glyph cache {}", _entries.size(), _path.string());
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,52 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "sdf_glyph_cache.hpp"
+#include <hikotest/hikotest.hpp>
+#include <filesystem>
+
+TEST_SUITE(sdf_glyph_cache_suite) {
+
+TEST_CASE(save_and_load)
+{
+    auto const path = std::filesystem::temp_directory_path() / "hikogui_sdf_glyph_cache_tests.bin";
+    std::filesystem::remove(path);
+
+    auto glyph = hi::pixmap<hi::sdf_r8>(3, 2);
+    for (auto y = std::size_t{0}; y != glyph.height(); ++y) {
+        for (auto x = std::size_t{0}; x != glyph.width(); ++x) {
+            glyph[y][x] = static_cast<float>(x) - static_cast<float>(y);
+        }
+    }
+
+    {
+        auto cache = hi::sdf_glyph_cache(path, 28.0f, 3.0f);
+        cache.insert(42, hi::glyph_id{5}, hi::pixmap_span<hi::sdf_r8 const>{glyph});
+        cache.save();
+    }
+
+    {
+        auto cache = hi::sdf_glyph_cache(path, 28.0f, 3.0f);
+        auto found = hi::pixmap<hi::sdf_r8>(3, 2);
+        REQUIRE(cache.find(42, hi::glyph_id{5}, hi::pixmap_span<hi::sdf_r8>{found}));
+        REQUIRE(found == glyph);
+
+        // Different glyph, font or size.
+        REQUIRE(not cache.find(42, hi::glyph_id{6}, hi::pixmap_span<hi::sdf_r8>{found}));
+        REQUIRE(not cache.find(43, hi::glyph_id{5}, hi::pixmap_span<hi::sdf_r8>{found}));
+        auto wrong_size = hi::pixmap<hi::sdf_r8>(2, 2);
+        REQUIRE(not cache.find(42, hi::glyph_id{5}, hi::pixmap_span<hi::sdf_r8>{wrong_size}));
+    }
+
+    {
+        // The cache is discarded when the parameters change.
+        auto cache = hi::sdf_glyph_cache(path, 32.0f, 3.0f);
+        auto found = hi::pixmap<hi::sdf_r8>(3, 2);
+        REQUIRE(not cache.find(42, hi::glyph_id{5}, hi::pixmap_span<hi::sdf_r8>{found}));
+    }
+
+    std::filesystem::remove(path);
+}
+
+};
@@ -1,7 +1,9 @@
 
 #pragma once
 
+#include "frame_statistics.hpp" // export
 #include "gui_event.hpp" // export
+#include "gui_event_coalescer.hpp" // export
 #include "gui_event_type.hpp" // export
 #include "gui_event_variant.hpp" // export
 #include "gui_window_size.hpp" // export
@@ -21,6 +23,7 @@
 #endif
 #include "mouse_buttons.hpp" // export
 #include "mouse_cursor.hpp" // export
+#include "performance_overlay.hpp" // export
 #include "theme.hpp" // export
 #include "theme_book.hpp" // export
 #include "widget_id.hpp" // export
@@ -0,0 +1,211 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file GUI/frame_statistics.hpp Defines frame_statistics.
+ * @ingroup GUI
+ */
+
+#pragma once
+
+#include "../telemetry/telemetry.hpp"
+#include "../time/time.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <array>
+#include <string>
+#include <string_view>
+#include <format>
+#include <chrono>
+#include <iterator>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.GUI : frame_statistics);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** The phases of rendering a frame of a window.
+ * @ingroup GUI
+ */
+enum class frame_phase : uint8_t { constrain, layout, draw, submit };
+
+// clang-format off
+constexpr auto frame_phase_metadata = enum_metadata{
+    frame_phase::constrain, "constrain",
+    frame_phase::layout, "layout",
+    frame_phase::draw, "draw",
+    frame_phase::submit, "submit",
+};
+// clang-format on
+
+/** The history of the timings of the recent frames of a window.
+ *
+ * Unlike the performance overlay, the history is always kept, so that when a
+ * frame takes longer than `budget` the window can save a report of the slow
+ * frame: the trace events recorded during the frame, the history of the
+ * preceding frames and the state of the window. This allows diagnosing
+ * intermittent jank without reproducing it.
+ *
+ * @ingroup GUI
+ */
+class frame_statistics {
+public:
+    /** The number of frames in the history.
+     */
+    constexpr static std::size_t num_frames = 240;
+
+    constexpr static std::size_t num_phases = 4;
+
+    /** The duration of each phase, in `time_stamp_count` ticks.
+     */
+    using phases_type = std::array<uint64_t, num_phases>;
+
+    struct frame_type {
+        /** The time stamp count at the start of the frame.
+         */
+        uint64_t begin = 0;
+
+        /** The time stamp count at the end of the frame.
+         */
+        uint64_t end = 0;
+
+        /** The CPU time of each phase of the frame.
+         */
+        phases_type phases = {};
+
+        /** The GPU time of a recent frame.
+         *
+         * GPU timestamps are read back a few frames later, see
+         * `gfx_timestamp_queries::last_frame_duration()`. Zero when not available.
+         */
+        std::chrono::nanoseconds gpu = {};
+
+        [[nodiscard]] std::chrono::nanoseconds duration() const noexcept
+        {
+            return time_stamp_count::duration_from_count(end - begin);
+        }
+    };
+
+    /** Frames that take longer than the budget are slow, zero disables.
+     */
+    std::chrono::nanoseconds budget = {};
+
+    /** The minimum time between two captures of a slow frame.
+     *
+     * This stops a window that is continuously slow from flooding the log directory.
+     */
+    std::chrono::nanoseconds capture_interval = std::chrono::seconds{10};
+
+    /** The number of frames in the history.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _num_frames;
+    }
+
+    /** Get a frame from the history.
+     *
+     * @param i The index of the frame, 0 is the oldest frame.
+     */
+    [[nodiscard]] frame_type const& operator[](std::size_t i) const noexcept
+    {
+        hi_axiom(i < _num_frames);
+        return _frames[(_frame_index + num_frames - _num_frames + i) % num_frames];
+    }
+
+    /** The number of frames that exceeded the budget.
+     */
+    [[nodiscard]] std::size_t num_slow_frames() const noexcept
+    {
+        return _num_slow_frames;
+    }
+
+    /** Add a frame to the history.
+     *
+     * @param frame The timings of the frame.
+     * @return True when the frame was slow and should be captured.
+     */
+    [[nodiscard]] bool add_frame(frame_type const& frame) noexcept
+    {
+        _frames[_frame_index] = frame;
+        _frame_index = (_frame_index + 1) % num_frames;
+        _num_frames = std::min(_num_frames + 1, num_frames);
+
+        if (budget == std::chrono::nanoseconds{} or frame.duration() <= budget) {
+            return false;
+        }
+
+        ++_num_slow_frames;
+        ++global_counter<"gui_window:slow-frame">;
+
+        if (_num_captures != 0 and time_stamp_count::duration_from_count(frame.end - _last_capture) < capture_interval) {
+            return false;
+        }
+        ++_num_captures;
+        _last_capture = frame.end;
+        return true;
+    }
+
+    /** Create a report of a slow frame.
+     *
+     * @param frame The slow frame.
+     * @param state JSON members with the state of the window, like `"widgets":42`, or empty.
+     * @return A document in the Chrome trace event format with the trace events of the frame;
+     *         the frame, the history and @a state are added as "otherData".
+     */
+    [[nodiscard]] std::string slow_frame_report(frame_type const& frame, std::string_view state = {}) const noexcept
+    {
+        auto other_data = std::string{"{\"frame\":"};
+        append_frame(other_data, frame);
+
+        other_data += ",\n\"history\":[";
+        for (auto i = 0_uz; i != _num_frames; ++i) {
+            other_data += i == 0 ? "\n" : ",\n";
+            append_frame(other_data, (*this)[i]);
+        }
+        other_data += "]";
+
+        if (not state.empty()) {
+            other_data += ",\n";
+            other_data += state;
+        }
+        other_data += "}";
+
+        return trace_recorder_global.chrome_trace(frame.begin, frame.end, other_data);
+    }
+
+private:
+    std::array<frame_type, num_frames> _frames = {};
+    std::size_t _frame_index = 0;
+    std::size_t _num_frames = 0;
+    std::size_t _num_slow_frames = 0;
+    std::size_t _num_captures = 0;
+
+    /** The time stamp count at the end of the last captured frame.
+     */
+    uint64_t _last_capture = 0;
+
+    [[nodiscard]] static double to_ms(std::chrono::nanoseconds duration) noexcept
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    static void append_frame(std::string& r, frame_type const& frame) noexcept
+    {
+        auto out = std::back_inserter(r);
+        std::format_to(out, "{{\"duration\":{:.3f}", to_ms(frame.duration()));
+        for (auto i = 0_uz; i != num_phases; ++i) {
+            std::format_to(
+                out,
+                ",\"{}\":{:.3f}",
+                frame_phase_metadata[static_cast<frame_phase>(i)],
+                to_ms(time_stamp_count::duration_from_count(frame.phases[i])));
+        }
+        std::format_to(out, ",\"gpu\":{:.3f}}}", to_ms(frame.gpu));
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,74 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "frame_statistics.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+TEST_SUITE(frame_statistics_suite) {
+
+/** Make a frame with a duration in time stamp count ticks.
+ */
+[[nodiscard]] static hi::frame_statistics::frame_type make_frame(uint64_t begin, uint64_t duration)
+{
+    auto r = hi::frame_statistics::frame_type{};
+    r.begin = begin;
+    r.end = begin + duration;
+    r.phases[std::to_underlying(hi::frame_phase::draw)] = duration;
+    return r;
+}
+
+TEST_CASE(history)
+{
+    auto statistics = hi::frame_statistics{};
+    REQUIRE(statistics.size() == 0);
+
+    auto begin = uint64_t{1'000'000};
+    for (auto i = std::size_t{0}; i != hi::frame_statistics::num_frames + 10; ++i) {
+        REQUIRE(not statistics.add_frame(make_frame(begin + i, 1'000)));
+    }
+
+    // Only the last frames are kept, oldest first.
+    REQUIRE(statistics.size() == hi::frame_statistics::num_frames);
+    REQUIRE(statistics[0].begin == begin + 10);
+    REQUIRE(statistics[hi::frame_statistics::num_frames - 1].begin == begin + hi::frame_statistics::num_frames + 9);
+}
+
+TEST_CASE(slow_frame)
+{
+    auto statistics = hi::frame_statistics{};
+    statistics.budget = hi::time_stamp_count::duration_from_count(100'000);
+    statistics.capture_interval = hi::time_stamp_count::duration_from_count(100'000'000);
+
+    auto begin = uint64_t{100'000'000};
+    REQUIRE(not statistics.add_frame(make_frame(begin, 10'000)));
+    REQUIRE(statistics.add_frame(make_frame(begin, 1'000'000)));
+
+    // A slow frame shortly after a capture is counted, but not captured.
+    REQUIRE(not statistics.add_frame(make_frame(begin, 1'000'000)));
+    REQUIRE(statistics.num_slow_frames() == 2);
+
+    begin += 200'000'000;
+    REQUIRE(statistics.add_frame(make_frame(begin, 1'000'000)));
+    REQUIRE(statistics.num_slow_frames() == 3);
+}
+
+TEST_CASE(slow_frame_report)
+{
+    auto statistics = hi::frame_statistics{};
+    auto const frame = make_frame(1'000'000, 1'000'000);
+    REQUIRE(not statistics.add_frame(frame));
+
+    auto const report = statistics.slow_frame_report(frame, "\"widgets\":42");
+    REQUIRE(report.starts_with("{\"traceEvents\":["));
+    REQUIRE(report.find("\"otherData\":{\"frame\":{\"duration\":") != std::string::npos);
+    REQUIRE(report.find("\"draw\":") != std::string::npos);
+    REQUIRE(report.find("\"history\":[") != std::string::npos);
+    REQUIRE(report.find("\"widgets\":42}") != std::string::npos);
+}
+
+};
@@ -24,11 +24,50 @@
 #include "../macros.hpp"
 #include <chrono>
 #include <memory>
+#include <span>
+#include <cstddef>
 
 hi_export_module(hikogui.GUI : gui_event);
 
 hi_export namespace hi { inline namespace v1 {
 
+/** The positions of mouse moves that were coalesced into a single event.
+ *
+ * High polling-rate mice send many moves for each frame, these are dispatched
+ * as a single event with the last position. Widgets that need the full path
+ * of the mouse, like a drawing canvas, can use the history.
+ *
+ * @note The positions refer to storage in the window, and are only valid
+ *       while handling the event.
+ */
+struct mouse_move_history {
+    /** The positions before the position of the event, oldest first, in window coordinates.
+     */
+    std::span<point2 const> positions = {};
+
+    /** The translation from window coordinates to the coordinates of the event.
+     */
+    vector2 offset = {};
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return positions.size();
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return positions.empty();
+    }
+
+    /** Get a position, in the same coordinate system as the event.
+     */
+    [[nodiscard]] constexpr point2 operator[](std::size_t i) const noexcept
+    {
+        hi_axiom_bounds(i, positions.size());
+        return positions[i] + offset;
+    }
+};
+
 /** Information for a mouse event.
  * @ingroup GUI
  */
@@ -68,6 +107,10 @@ struct mouse_event_data {
     /** Number of clicks from the last button clicked.
      */
     uint8_t click_count = 0;
+
+    /** The earlier positions of the mouse moves that were coalesced into this event.
+     */
+    mouse_move_history history = {};
 };
 
 struct keyboard_target_data {
@@ -408,6 +451,7 @@ public:
         if (rhs == gui_event_variant::mouse) {
             r.mouse().position = transform * rhs.mouse().position;
             r.mouse().down_position = transform * rhs.mouse().down_position;
+            r.mouse().history.offset = (transform * (point2{} + rhs.mouse().history.offset)) - point2{};
         }
         return r;
     }
@@ -0,0 +1,133 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file GUI/gui_event_coalescer.hpp Coalesce high-frequency input events.
+ * @ingroup GUI
+ */
+
+#pragma once
+
+#include "gui_event.hpp"
+#include "../geometry/geometry.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <concepts>
+#include <utility>
+
+hi_export_module(hikogui.GUI : gui_event_coalescer);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Coalesce high-frequency input events until the next frame.
+ *
+ * A high-polling-rate mouse or a touch pad generates mouse-move and
+ * mouse-wheel events much faster than the display refresh rate. Each of these
+ * events would walk the widget tree, while only the last one will be visible
+ * on the next frame.
+ *
+ * Consecutive mouse-move and mouse-drag events, with the same buttons and
+ * modifiers held down, are merged into the last event; the earlier positions
+ * are available to the widgets through `mouse_event_data::history`.
+ * Consecutive mouse-wheel events are merged by adding their deltas.
+ *
+ * Any other event first dispatches the pending event, so that the order of the
+ * events is maintained.
+ *
+ * @ingroup GUI
+ */
+class gui_event_coalescer {
+public:
+    gui_event_coalescer() noexcept = default;
+    gui_event_coalescer(gui_event_coalescer const&) = delete;
+    gui_event_coalescer(gui_event_coalescer&&) = delete;
+    gui_event_coalescer& operator=(gui_event_coalescer const&) = delete;
+    gui_event_coalescer& operator=(gui_event_coalescer&&) = delete;
+
+    /** Check if there is an event waiting to be dispatched.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _pending == gui_event_type::none;
+    }
+
+    /** Add an event.
+     *
+     * @param event The event to coalesce or dispatch.
+     * @param dispatch The function `void(gui_event const&)` called with each event that is dispatched.
+     */
+    template<std::invocable<gui_event const&> Func>
+    void add(gui_event const& event, Func&& dispatch)
+    {
+        using enum gui_event_type;
+
+        if (can_merge(event)) {
+            if (event == mouse_wheel) {
+                auto const wheel_delta = _pending.mouse().wheel_delta + event.mouse().wheel_delta;
+                _pending = event;
+                _pending.mouse().wheel_delta = wheel_delta;
+            } else {
+                _history.push_back(_pending.mouse().position);
+                _pending = event;
+            }
+            return;
+        }
+
+        flush(dispatch);
+        if (event == mouse_move or event == mouse_drag or event == mouse_wheel) {
+            _pending = event;
+        } else {
+            dispatch(event);
+        }
+    }
+
+    /** Dispatch the pending event.
+     *
+     * This is called before rendering a frame.
+     *
+     * @param dispatch The function `void(gui_event const&)` called with the pending event.
+     */
+    template<std::invocable<gui_event const&> Func>
+    void flush(Func&& dispatch)
+    {
+        if (empty()) {
+            return;
+        }
+
+        // The dispatch may add events, so the pending event and its history are removed first.
+        auto event = std::exchange(_pending, gui_event{});
+        auto history = std::exchange(_history, {});
+        if (event.variant() == gui_event_variant::mouse) {
+            event.mouse().history.positions = history;
+        }
+        dispatch(event);
+
+        // Reuse the allocation for the next history.
+        if (_history.empty()) {
+            history.clear();
+            _history = std::move(history);
+        }
+    }
+
+private:
+    gui_event _pending = {};
+
+    /** The positions of mouse-move events that were merged into the pending event.
+     */
+    std::vector<point2> _history;
+
+    [[nodiscard]] bool can_merge(gui_event const& event) const noexcept
+    {
+        using enum gui_event_type;
+
+        if (empty() or event.type() != _pending.type()) {
+            return false;
+        }
+        if (event != mouse_move and event != mouse_drag and event != mouse_wheel) {
+            return false;
+        }
+        return event.keyboard_modifiers == _pending.keyboard_modifiers and event.mouse().down == _pending.mouse().down;
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,89 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gui_event_coalescer.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+
+TEST_SUITE(gui_event_coalescer) {
+
+[[nodiscard]] static hi::gui_event make_mouse_event(hi::gui_event_type type, float x, float y)
+{
+    auto r = hi::gui_event{type};
+    r.mouse().position = hi::point2{x, y};
+    return r;
+}
+
+TEST_CASE(coalesce_moves)
+{
+    auto coalescer = hi::gui_event_coalescer{};
+    auto num_dispatched = 0;
+    auto last_position = hi::point2{};
+    auto history = std::vector<hi::point2>{};
+    auto const dispatch = [&](hi::gui_event const& event) {
+        ++num_dispatched;
+        last_position = event.mouse().position;
+        for (auto i = 0uz; i != event.mouse().history.size(); ++i) {
+            history.push_back(event.mouse().history[i]);
+        }
+    };
+
+    for (auto i = 0; i != 8; ++i) {
+        coalescer.add(make_mouse_event(hi::gui_event_type::mouse_move, static_cast<float>(i), 1.0f), dispatch);
+    }
+    REQUIRE(num_dispatched == 0);
+    REQUIRE(not coalescer.empty());
+
+    coalescer.flush(dispatch);
+    REQUIRE(num_dispatched == 1);
+    REQUIRE(coalescer.empty());
+    REQUIRE(last_position == hi::point2(7.0f, 1.0f));
+    REQUIRE(history.size() == 7);
+    REQUIRE(history[0] == hi::point2(0.0f, 1.0f));
+    REQUIRE(history[6] == hi::point2(6.0f, 1.0f));
+}
+
+TEST_CASE(accumulate_wheel)
+{
+    auto coalescer = hi::gui_event_coalescer{};
+    auto wheel_delta = hi::vector2{};
+    auto const dispatch = [&](hi::gui_event const& event) {
+        wheel_delta = event.mouse().wheel_delta;
+    };
+
+    for (auto i = 0; i != 4; ++i) {
+        auto event = make_mouse_event(hi::gui_event_type::mouse_wheel, 1.0f, 1.0f);
+        event.mouse().wheel_delta = hi::vector2{0.0f, 2.5f};
+        coalescer.add(event, dispatch);
+    }
+    coalescer.flush(dispatch);
+    REQUIRE(wheel_delta == hi::vector2(0.0f, 10.0f));
+}
+
+TEST_CASE(maintain_order)
+{
+    auto coalescer = hi::gui_event_coalescer{};
+    auto types = std::vector<hi::gui_event_type>{};
+    auto const dispatch = [&](hi::gui_event const& event) {
+        types.push_back(event.type());
+    };
+
+    coalescer.add(make_mouse_event(hi::gui_event_type::mouse_move, 1.0f, 1.0f), dispatch);
+    coalescer.add(make_mouse_event(hi::gui_event_type::mouse_move, 2.0f, 1.0f), dispatch);
+    coalescer.add(make_mouse_event(hi::gui_event_type::mouse_down, 2.0f, 1.0f), dispatch);
+
+    auto drag = make_mouse_event(hi::gui_event_type::mouse_drag, 3.0f, 1.0f);
+    drag.mouse().down.left_button = true;
+    coalescer.add(drag, dispatch);
+    coalescer.add(make_mouse_event(hi::gui_event_type::mouse_move, 4.0f, 1.0f), dispatch);
+    coalescer.flush(dispatch);
+
+    REQUIRE(types.size() == 4);
+    REQUIRE(types[0] == hi::gui_event_type::mouse_move);
+    REQUIRE(types[1] == hi::gui_event_type::mouse_down);
+    REQUIRE(types[2] == hi::gui_event_type::mouse_drag);
+    REQUIRE(types[3] == hi::gui_event_type::mouse_move);
+}
+
+};
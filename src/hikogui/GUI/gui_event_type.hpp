@@ -52,6 +52,7 @@ enum class gui_event_type {
     window_normalize, ///< Request the window to be restored to the original size after a minimize and maximize commands.
     window_close, ///< Request the window to be closed.
     window_open_sysmenu, ///< Open the operating system provided menu for the window.
+    window_toggle_performance_overlay, ///< Show or hide the performance overlay of the window.
     window_set_keyboard_target, ///< Change the keyboard target widget for this window.
     window_set_clipboard, ///< Place data on the clipboard.
     window_activate, ///< The window becomes the top-window.
@@ -137,6 +138,7 @@ constexpr auto gui_event_type_metadata = enum_metadata{
     gui_event_type::window_maximize, "window_maximize",
     gui_event_type::window_normalize, "window_normalize",
     gui_event_type::window_open_sysmenu, "window_open_sysmenu",
+    gui_event_type::window_toggle_performance_overlay, "window_toggle_performance_overlay",
     gui_event_type::window_close, "window_close",
     gui_event_type::window_set_keyboard_target, "window_set_keyboard_target",
     gui_event_type::window_set_clipboard, "window_set_clipboard",
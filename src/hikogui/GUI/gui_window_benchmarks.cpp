@@ -0,0 +1,140 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../macros.hpp"
+#if HI_OPERATING_SYSTEM == HI_OS_WINDOWS
+#include "GUI.hpp"
+#include "../widgets/widgets.hpp"
+#include "../GFX/GFX.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../time/time.hpp"
+#include <memory>
+#include <array>
+#include <tuple>
+#include <format>
+#include <chrono>
+
+using hi::operator""_uz;
+
+/** The trace spans of the phases of a frame, and the GPU time of a frame.
+ */
+constexpr auto frame_phases =
+    std::array{"window::constrain", "window::layout", "window::occluders", "window::draw", "window::submit", "gpu:frame"};
+
+/** Discard the durations of the phases measured before the benchmark loop.
+ */
+static void reset_frame_phases() noexcept
+{
+    for (auto const name : frame_phases) {
+        if (auto *counter = hi::get_global_counter_if(name)) {
+            std::ignore = counter->take_durations();
+        }
+    }
+}
+
+/** Report the median and 99th percentile duration of each phase of the frames rendered in the benchmark loop.
+ */
+static void set_frame_phase_metrics(hi::benchmark_state& state) noexcept
+{
+    auto const to_ns = [](uint64_t count) {
+        return std::chrono::duration<double, std::nano>(hi::time_stamp_count::duration_from_count(count)).count();
+    };
+
+    for (auto const name : frame_phases) {
+        if (auto *counter = hi::get_global_counter_if(name)) {
+            if (auto const durations = counter->take_durations(); durations.count() != 0) {
+                state.set_metric(std::format("{}:p50_ns", name), to_ns(durations.percentile(0.5)));
+                state.set_metric(std::format("{}:p99_ns", name), to_ns(durations.percentile(0.99)));
+            }
+        }
+    }
+}
+
+/** A window with a few widgets, like the examples/widgets applications.
+ */
+[[nodiscard]] static std::unique_ptr<hi::window_widget> make_small_widget_tree()
+{
+    static auto checkbox_value = hi::observer<int>{1};
+    static auto toggle_value = hi::observer<int>{0};
+    static auto radio_value = hi::observer<int>{2};
+
+    auto r = std::make_unique<hi::window_widget>(hi::txt("Benchmark"));
+    r->content().emplace<hi::label_widget>("A1", hi::txt("checkbox:"));
+    r->content().emplace<hi::checkbox_with_label_widget>("B1", checkbox_value, 1, 2);
+    r->content().emplace<hi::label_widget>("A2", hi::txt("toggle:"));
+    r->content().emplace<hi::toggle_with_label_widget>("B2", toggle_value, 1, 2);
+    r->content().emplace<hi::label_widget>("A3", hi::txt("radio buttons:"));
+    r->content().emplace<hi::radio_with_label_widget>("B3", radio_value, 1, hi::txt("one"));
+    r->content().emplace<hi::radio_with_label_widget>("B4", radio_value, 2, hi::txt("two"));
+    r->content().emplace<hi::radio_with_label_widget>("B5", radio_value, 3, hi::txt("three"));
+    return r;
+}
+
+/** A window with a grid of 100 x 100 labels.
+ */
+[[nodiscard]] static std::unique_ptr<hi::window_widget> make_grid_widget_tree()
+{
+    auto r = std::make_unique<hi::window_widget>(hi::txt("Benchmark"));
+    for (auto row = 0_uz; row != 100; ++row) {
+        for (auto column = 0_uz; column != 100; ++column) {
+            r->content().emplace<hi::label_widget>(column, row, hi::txt("{}:{}", column, row));
+        }
+    }
+    return r;
+}
+
+/** Render frames of a widget tree into an offscreen window.
+ *
+ * @param state The state of the benchmark.
+ * @param widget The top-level widget.
+ * @param reconstrain Constrain and layout all the widgets on each frame, otherwise only redraw.
+ */
+static void render_frames(hi::benchmark_state& state, std::unique_ptr<hi::window_widget> widget, bool reconstrain)
+{
+    // Must be enabled before the surface is built.
+    hi::gfx_timestamp_queries::enabled = true;
+
+    auto window = hi::gui_window{std::move(widget), hi::extent2{1920.0f, 1080.0f}};
+
+    // The first frame resizes the window to fit the widgets and builds the surface for that size.
+    window.render(std::chrono::utc_clock::now());
+    reset_frame_phases();
+
+    while (state.running()) {
+        if (reconstrain) {
+            window.request_reconstrain_all();
+        } else {
+            window.process_event({hi::gui_event_type::window_redraw, hi::aarectangle{window.rectangle.size()}});
+        }
+        window.render(std::chrono::utc_clock::now());
+    }
+
+    set_frame_phase_metrics(state);
+}
+
+hi_benchmark(gui_window_small_frame)
+{
+    render_frames(state, make_small_widget_tree(), true);
+}
+
+hi_benchmark(gui_window_small_redraw)
+{
+    render_frames(state, make_small_widget_tree(), false);
+}
+
+hi_benchmark(gui_window_grid_10k_frame)
+{
+    auto widget = make_grid_widget_tree();
+    state.set_items_per_iteration(10'000);
+    render_frames(state, std::move(widget), true);
+}
+
+hi_benchmark(gui_window_grid_10k_redraw)
+{
+    auto widget = make_grid_widget_tree();
+    state.set_items_per_iteration(10'000);
+    render_frames(state, std::move(widget), false);
+}
+
+#endif
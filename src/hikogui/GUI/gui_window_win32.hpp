@@ -7,16 +7,27 @@
 #include "../win32_headers.hpp"
 
 #include "gui_event.hpp"
+#include "gui_event_coalescer.hpp"
 #include "gui_window_size.hpp"
 #include "hitbox.hpp"
 #include "keyboard_bindings.hpp"
 #include "theme_book.hpp"
 #include "widget_intf.hpp"
 #include "mouse_cursor.hpp"
+#include "performance_overlay.hpp"
+#include "frame_statistics.hpp"
 #include "../GFX/GFX.hpp"
 #include "../crt/crt.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../file/file.hpp"
+#include "../l10n/l10n.hpp"
+#include "../memory/memory.hpp"
+#include "../path/path.hpp"
 #include "../macros.hpp"
 #include <unordered_map>
+#include <chrono>
+#include <tuple>
+#include <utility>
 
 hi_export_module(hikogui.GUI : gui_window);
 
@@ -84,50 +95,22 @@ public:
         hi_assert_not_null(_widget);
 
         if (_first_window) {
-            if (not os_settings::start_subsystem()) {
-                hi_log_fatal("Could not start the os_settings subsystem.");
-            }
-
-            register_font_file(URL{"resource:elusiveicons-webfont.ttf"});
-            register_font_file(URL{"resource:hikogui_icons.ttf"});
-            register_font_directories(font_dirs());
-
-            register_theme_directories(theme_dirs());
-
-            try {
-                load_system_keyboard_bindings(URL{"resource:win32.keybinds.json"});
-            } catch (std::exception const& e) {
-                hi_log_fatal("Could not load keyboard bindings. \"{}\"", e.what());
-            }
-
+            start_gui_subsystems();
             SetProcessDpiAwarenessContext(DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2);
-
-            _first_window = true;
+            _first_window = false;
         }
 
         // Reset the keyboard target to not focus anything.
         update_keyboard_target({});
 
-        // For changes in setting on the OS we should reconstrain/layout/redraw the window
-        // For example when the language or theme changes.
-        _setting_change_cbt = os_settings::subscribe(
-            [this] {
-                ++global_counter<"gui_window:os_setting:constrain">;
-                this->process_event({gui_event_type::window_reconstrain});
-            },
-            callback_flags::main);
-
-        // Subscribe on theme changes.
-        _selected_theme_cbt = theme_book::global().selected_theme.subscribe(
-            [this](auto...) {
-                ++global_counter<"gui_window:selected_theme:constrain">;
-                this->process_event({gui_event_type::window_reconstrain});
-            },
-            callback_flags::main);
+        subscribe_to_global_changes();
 
         _render_cbt = loop::main().subscribe_render([this](utc_nanoseconds display_time) {
             this->render(display_time);
         });
+        if (gfx_surface::lowLatencyPresentation) {
+            loop::main().set_low_latency(true);
+        }
 
         // Delegate has been called, layout of widgets has been calculated for the
         // minimum and maximum size of the window.
@@ -145,6 +128,36 @@ public:
         show_window(new_size);
     }
 
+    /** Create a window that renders into images instead of onto the screen.
+     *
+     * The window has no operating system window and is not rendered by the
+     * main loop; each call to `render()` renders a frame into the offscreen
+     * surface. This is used to measure the constrain, layout, draw and submit
+     * phases of a widget tree, for example in benchmarks.
+     *
+     * @param widget The top-level widget of the window.
+     * @param size The size of the window.
+     * @throws gfx_error When no Vulkan device was found.
+     */
+    gui_window(std::unique_ptr<widget_intf> widget, extent2 size) : _widget(std::move(widget)), track_mouse_leave_event_parameters()
+    {
+        hi_assert_not_null(_widget);
+
+        start_gui_subsystems();
+
+        // Reset the keyboard target to not focus anything.
+        update_keyboard_target({});
+
+        subscribe_to_global_changes();
+
+        rectangle = aarectangle{size};
+        surface = make_unique_offscreen_gfx_surface(size);
+
+        apply_window_data(*_widget, this, pixel_density, get_selected_theme().attributes_from_theme_function());
+        theme = get_selected_theme().transform(pixel_density);
+        _widget_constraints = _widget->update_constraints();
+    }
+
     ~gui_window()
     {
         try {
@@ -162,6 +175,8 @@ public:
         _widget = {};
 
         try {
+            // Present the last frame before the surface is destroyed.
+            _render_thread = {};
             surface.reset();
             hi_log_info("Window '{}' has been properly destructed.", _title);
 
@@ -186,12 +201,32 @@ public:
      */
     void render(utc_nanoseconds display_time_point)
     {
+        // The loop only calls render() on frames that are requested. Request the next frame when
+        // this frame could not do everything, for example while the window is minimized.
+        auto const d = defer([this] {
+            if (need_render()) {
+                loop::main().request_render();
+            }
+        });
+
+        // Dispatch the mouse-moves and mouse-wheel events that were coalesced since the last frame.
+        flush_input_events();
+
+        if (_render_thread and not _render_thread->ready()) {
+            // The render thread is still presenting the previous frame, which uses the surface.
+            // Try again on the next vertical sync, instead of blocking the main loop.
+            ++global_counter<"gui_window:render:thread-busy">;
+            loop::main().request_render();
+            return;
+        }
+
         if (surface->device() == nullptr) {
             // If there is no device configured for the surface don't try to render.
             return;
         }
 
         auto const t1 = trace<"window::render">();
+        auto const frame_begin = time_stamp_count{time_stamp_count::inplace{}};
 
         hi_axiom(loop::main().on_thread());
         hi_assert_not_null(surface);
@@ -208,8 +243,18 @@ public:
 
         if (need_reconstrain) {
             auto const t2 = trace<"window::constrain">();
+            auto const p2 = _performance_overlay.measure(frame_phase::constrain);
 
             theme = get_selected_theme().transform(pixel_density);
+
+            // Only the widgets on the path to a widget that requested a reconstrain
+            // are constrained again, unless the change affects all widgets.
+            if (_reconstrain_all.exchange(false, std::memory_order_relaxed)) {
+                ++global_counter<"gui_window:constrain:all">;
+                apply(*_widget, [](widget_intf& w) {
+                    w.invalidate_constraints();
+                });
+            }
             _widget_constraints = _widget->update_constraints();
         }
 
@@ -261,15 +306,31 @@ public:
 
         if (need_reconstrain or need_relayout or widget_size != rectangle.size()) {
             auto const t2 = trace<"window::layout">();
+            auto const p2 = _performance_overlay.measure(frame_phase::layout);
+            auto const need_full_redraw = need_reconstrain or widget_size != rectangle.size();
             widget_size = rectangle.size();
 
             // Guarantee that the layout size is always at least the minimum size.
             // We do this because it simplifies calculations if no minimum checks are necessary inside widget.
             auto const widget_layout_size = max(_widget_constraints.minimum, widget_size);
-            _widget->set_layout(widget_layout{widget_layout_size, _size_state, subpixel_orientation(), display_time_point});
-
-            // After layout do a complete redraw.
-            _redraw_rectangle = aarectangle{widget_size};
+            _widget->set_layout(
+                widget_layout{widget_layout_size, _size_state, subpixel_orientation(), display_time_point, &_frame_arena});
+
+            // Mouse events between layouts skip the sub-trees that are not under the mouse.
+            _widget->update_hitbox_bounds();
+
+            if (need_full_redraw) {
+                // After a change in constraints or window size do a complete redraw.
+                ++global_counter<"gui_window:layout:full-redraw">;
+                _widget_rectangles.clear();
+                [[maybe_unused]] auto const full_rectangle = update_widget_rectangles(*_widget);
+                _redraw_rectangle = aarectangle{widget_size};
+
+            } else {
+                // Only redraw the widgets that have been moved, resized, added or removed.
+                ++global_counter<"gui_window:layout:partial-redraw">;
+                _redraw_rectangle.fetch_or(update_widget_rectangles(*_widget));
+            }
         }
 
 #if 0
@@ -277,22 +338,91 @@ public:
         _redraw_rectangle = aarectangle{widget_size};
 #endif
 
+        if (_performance_overlay.enabled()) {
+            // The overlay is updated on every frame, it covers widgets that are not redrawn.
+            _redraw_rectangle = aarectangle{widget_size};
+        }
+
         // Draw widgets if the _redraw_rectangle was set.
         if (auto draw_context = surface->render_start(_redraw_rectangle)) {
             _redraw_rectangle = aarectangle{};
             draw_context.display_time_point = display_time_point;
+            draw_context.input_time_point = std::exchange(_input_time_point, utc_nanoseconds{});
             draw_context.subpixel_orientation = subpixel_orientation();
             draw_context.saturation = 1.0f;
+            draw_context.frame_resource = &_frame_arena;
 
+            {
+                auto const t2 = trace<"window::occluders">();
+                auto const p2 = _performance_overlay.measure(frame_phase::draw);
+                _widget->add_occluders(draw_context);
+            }
             {
                 auto const t2 = trace<"window::draw">();
+                auto const p2 = _performance_overlay.measure(frame_phase::draw);
                 _widget->draw(draw_context);
             }
-            {
+            _pending_glyphs_rectangle |= draw_context.pending_glyphs_rectangle();
+            _performance_overlay.draw(
+                draw_context,
+                widget_layout{widget_size, _size_state, subpixel_orientation(), display_time_point, &_frame_arena},
+                theme,
+                pixel_density);
+            if (_render_thread) {
+                _render_thread->submit(draw_context);
+            } else {
                 auto const t2 = trace<"window::submit">();
+                auto const p2 = _performance_overlay.measure(frame_phase::submit);
                 surface->render_finish(draw_context);
             }
         }
+
+        finish_frame_statistics(frame_begin);
+        _performance_overlay.finish_frame();
+        if (_performance_overlay.enabled()) {
+            loop::main().request_render();
+        }
+
+        // All temporaries of this frame have been destroyed.
+        _frame_arena.reset();
+    }
+
+    /** Submit and present the frames of this window on its own render thread.
+     *
+     * The widgets are still laid out and drawn on the main thread, after which
+     * the frame is handed to the render thread. This keeps the main loop, and
+     * the other windows, responsive while a GPU-limited window presents.
+     *
+     * @param enable True to use a render thread, false to submit frames on the main thread.
+     */
+    void set_render_thread(bool enable) noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+        hi_assert_not_null(surface);
+
+        if (enable and not _render_thread) {
+            _render_thread = std::make_unique<gfx_render_thread>(*surface);
+        } else if (not enable) {
+            // Joining the thread finishes the frame that was already handed over.
+            _render_thread = {};
+        }
+    }
+
+    /** Set the GPU policy of this window.
+     *
+     * On a hybrid system a window with a simple user interface should use
+     * `policy::low_power`, so that the discrete GPU can stay powered down.
+     * The window moves to the selected device on the next frame.
+     *
+     * @param gpu_policy The GPU policy, `policy::unspecified` to use `gfx_system::gpu_policy`.
+     */
+    void set_gpu_policy(hi::policy gpu_policy) noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+        hi_assert_not_null(surface);
+
+        surface->gpu_policy = gpu_policy;
+        reselect_device();
     }
 
     /** Set the mouse cursor icon.
@@ -502,6 +632,39 @@ public:
         }
     }
 
+    /** Show or hide the performance overlay.
+     */
+    void toggle_performance_overlay() noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+        _performance_overlay.toggle();
+        hi_log_info("The performance overlay is {}.", _performance_overlay.enabled() ? "shown" : "hidden");
+        process_event({gui_event_type::window_redraw, aarectangle{rectangle.size()}});
+    }
+
+    /** The timings of the recent frames of this window.
+     */
+    [[nodiscard]] frame_statistics const& statistics() const noexcept
+    {
+        return _frame_statistics;
+    }
+
+    /** Capture frames that take longer than a budget.
+     *
+     * When a frame exceeds the budget, the trace events recorded during the frame,
+     * the timings of the recent frames, the sizes of the widget tree and the state
+     * of the atlases are saved in the log directory. The report is in the Chrome
+     * trace event format, which can be opened with `chrome://tracing` or
+     * https://ui.perfetto.dev.
+     *
+     * @param budget The maximum duration of a frame, or zero to disable capturing.
+     */
+    void set_frame_budget(std::chrono::nanoseconds budget) noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+        _frame_statistics.budget = budget;
+    }
+
     /** Open the system menu of the window.
      *
      * On windows 10 this is activated by pressing Alt followed by Spacebar.
@@ -532,6 +695,12 @@ public:
     {
         hi_axiom(loop::main().on_thread());
 
+        if (win32Window == nullptr) {
+            // An offscreen window is resized directly; the surface follows on the next frame.
+            rectangle = aarectangle{get<0>(rectangle), new_extent};
+            return;
+        }
+
         RECT original_rect;
         if (not GetWindowRect(win32Window, &original_rect)) {
             hi_log_error("Could not get the window's rectangle on the screen.");
@@ -787,6 +956,17 @@ public:
         return ~window_to_screen();
     }
 
+    /** Constrain all the widgets on the next frame.
+     *
+     * This is used for changes that affect every widget, like a change of theme,
+     * language or pixel density.
+     */
+    void request_reconstrain_all() noexcept
+    {
+        _reconstrain_all.store(true, std::memory_order_relaxed);
+        process_event({gui_event_type::window_reconstrain});
+    }
+
     /** Process the event.
      *
      * This is called by the event handler to start processing events.
@@ -799,23 +979,30 @@ public:
     {
         using enum gui_event_type;
 
+        if (event == window_redraw) {
+            // A redraw may be requested from any thread, for example by widgets that are drawn in parallel.
+            _redraw_rectangle.fetch_or(event.rectangle());
+            loop::main().request_render();
+            return true;
+        }
+
         hi_axiom(loop::main().on_thread());
 
         switch (event.type()) {
-        case window_redraw:
-            _redraw_rectangle.fetch_or(event.rectangle());
-            return true;
 
         case window_relayout:
             _relayout.store(true, std::memory_order_relaxed);
+            loop::main().request_render();
             return true;
 
         case window_reconstrain:
             _reconstrain.store(true, std::memory_order_relaxed);
+            loop::main().request_render();
             return true;
 
         case window_resize:
             _resize.store(true, std::memory_order_relaxed);
+            loop::main().request_render();
             return true;
 
         case window_minimize:
@@ -838,6 +1025,10 @@ public:
             open_system_menu();
             return true;
 
+        case window_toggle_performance_overlay:
+            toggle_performance_overlay();
+            return true;
+
         case window_set_keyboard_target:
             {
                 auto const& target = event.keyboard_target();
@@ -876,11 +1067,14 @@ public:
         }
 
         // Translate keyboard events, using the keybindings.
-        auto events = std::vector<gui_event>{event};
+        auto events = std::vector<gui_event>{};
         if (event.type() == keyboard_down) {
-            for (auto& e : translate_keyboard_event(event)) {
-                events.push_back(e);
-            }
+            auto const commands = translate_keyboard_event(event);
+            events.reserve(commands.size() + 1);
+            events.push_back(event);
+            events.insert(events.end(), commands.begin(), commands.end());
+        } else {
+            events.push_back(event);
         }
 
         for (auto& event_ : events) {
@@ -897,6 +1091,11 @@ public:
         auto const handled = send_events_to_widget(
             events.front().variant() == gui_event_variant::mouse ? _mouse_target_id : _keyboard_target_id, events);
 
+        // Remember the oldest handled input for measuring the latency until it is presented.
+        if (handled and _input_time_point == utc_nanoseconds{}) {
+            _input_time_point = event.time_point;
+        }
+
         // Intercept the keyboard generated escape.
         // A keyboard generated escape should always remove keyboard focus.
         // The update_keyboard_target() function will send gui_keyboard_exit and a
@@ -904,6 +1103,8 @@ public:
         for (auto const event_ : events) {
             if (event_ == gui_cancel) {
                 update_keyboard_target({}, keyboard_focus_group::all);
+            } else if (event_ == window_toggle_performance_overlay) {
+                toggle_performance_overlay();
             }
         }
 
@@ -915,6 +1116,7 @@ private:
     constexpr static std::chrono::nanoseconds _animation_duration = std::chrono::milliseconds(150);
 
     inline static bool _first_window = true;
+    inline static bool _gui_subsystems_started = false;
     inline static const wchar_t *win32WindowClassName = nullptr;
     inline static WNDCLASSW win32WindowClass = {};
     inline static bool win32WindowClassIsRegistered = false;
@@ -931,8 +1133,52 @@ private:
     box_constraints _widget_constraints = {};
 
     std::atomic<aarectangle> _redraw_rectangle = aarectangle{};
+
+    /** The area of glyphs that were drawn before they were available in an atlas.
+     *
+     * Redrawn when glyphs become available, instead of the whole window.
+     */
+    aarectangle _pending_glyphs_rectangle = {};
+
+    /** The time of the oldest input handled since the last frame was drawn, or zero.
+     */
+    utc_nanoseconds _input_time_point = {};
+
+    /** The monitor that the window was on when the device was last selected.
+     */
+    HMONITOR _monitor = nullptr;
+
+    /** Memory for temporaries during layout and drawing, reset at the end of `render()`.
+     */
+    frame_arena _frame_arena;
+
+    /** The debug overlay, toggled with the `window_toggle_performance_overlay` command.
+     */
+    performance_overlay _performance_overlay;
+
+    /** The timings of the recent frames, used to capture slow frames.
+     */
+    frame_statistics _frame_statistics;
+
+    struct widget_rectangle_type {
+        aarectangle rectangle;
+
+        /** The layout-generation when this widget was last seen.
+         */
+        size_t generation;
+    };
+
+    /** The clipping rectangles of the visible widgets on the window since the last layout.
+     */
+    std::unordered_map<widget_id, widget_rectangle_type> _widget_rectangles;
+    size_t _widget_rectangles_generation = 0;
     std::atomic<bool> _relayout = false;
     std::atomic<bool> _reconstrain = false;
+
+    /** All widgets need to be constrained, not only the widgets that requested it.
+     */
+    std::atomic<bool> _reconstrain_all = false;
+
     std::atomic<bool> _resize = false;
 
     /** Current size state of the window.
@@ -973,10 +1219,306 @@ private:
 
     bool keymenu_pressed = false;
 
+    /** Mouse-move and mouse-wheel events waiting for the next frame.
+     */
+    gui_event_coalescer _input_coalescer;
+
+    /** The thread that submits the frames, when enabled with `set_render_thread()`.
+     */
+    std::unique_ptr<gfx_render_thread> _render_thread;
+
     callback<void()> _setting_change_cbt;
     callback<void(std::string)> _selected_theme_cbt;
+    callback<void()> _glyphs_rasterized_cbt;
+    callback<void()> _glyph_image_pending_cbt;
     callback<void(utc_nanoseconds)> _render_cbt;
 
+    /** Start the subsystems needed by the first window.
+     *
+     * Independent subsystems are started concurrently on the thread pool, to
+     * reduce the time to the first frame. The duration of each subsystem is
+     * recorded in the trace recorder and logged.
+     */
+    static void start_gui_subsystems() noexcept
+    {
+        if (std::exchange(_gui_subsystems_started, true)) {
+            return;
+        }
+
+        auto graph = startup_graph{};
+
+        auto const settings = graph.add<"startup:os_settings">([] {
+            if (not os_settings::start_subsystem()) {
+                hi_log_fatal("Could not start the os_settings subsystem.");
+            }
+        });
+
+        auto const fonts = graph.add<"startup:fonts">([] {
+            register_font_file(URL{"resource:elusiveicons-webfont.ttf"});
+            register_font_file(URL{"resource:hikogui_icons.ttf"});
+            register_font_directories(font_dirs());
+        });
+
+        // Themes select font families from the font book.
+        graph.add<"startup:themes">(
+            [] {
+                register_theme_directories(theme_dirs());
+            },
+            {settings, fonts});
+
+        graph.add<"startup:keyboard_bindings">([] {
+            try {
+                load_system_keyboard_bindings(URL{"resource:win32.keybinds.json"});
+            } catch (std::exception const& e) {
+                hi_log_fatal("Could not load keyboard bindings. \"{}\"", e.what());
+            }
+        });
+
+        graph.add<"startup:translations">(
+            [] {
+                load_translations(os_settings::language_tags());
+            },
+            {settings});
+
+        // Creating the Vulkan instance loads the driver, which may take a long time.
+        graph.add<"startup:gfx_system">([] {
+            std::ignore = gfx_system::global();
+        });
+
+        graph.start();
+        try {
+            graph.wait();
+        } catch (std::exception const& e) {
+            hi_log_fatal("Could not start the GUI subsystems. \"{}\"", e.what());
+        }
+
+        for (auto const& entry : graph.timeline()) {
+            hi_log_info(
+                "{} started at {} ms, took {} ms.",
+                entry.name,
+                std::chrono::duration<double, std::milli>(entry.start).count(),
+                std::chrono::duration<double, std::milli>(entry.duration).count());
+        }
+    }
+
+    /** Reconstrain, relayout or redraw the window when global settings change.
+     */
+    void subscribe_to_global_changes() noexcept
+    {
+        // For changes in setting on the OS we should reconstrain/layout/redraw the window
+        // For example when the language or theme changes.
+        _setting_change_cbt = os_settings::subscribe(
+            [this] {
+                ++global_counter<"gui_window:os_setting:constrain">;
+                this->request_reconstrain_all();
+            },
+            callback_flags::main);
+
+        // Subscribe on theme changes.
+        _selected_theme_cbt = theme_book::global().selected_theme.subscribe(
+            [this](auto...) {
+                ++global_counter<"gui_window:selected_theme:constrain">;
+                this->request_reconstrain_all();
+            },
+            callback_flags::main);
+
+        // Glyphs that were rasterized in the background become visible after a redraw.
+        _glyphs_rasterized_cbt = gfx_pipeline_SDF::device_shared::glyphs_rasterized.subscribe(
+            [this] {
+                redraw_pending_glyphs<"gui_window:glyphs_rasterized:redraw">();
+            },
+            callback_flags::main);
+
+        // Bitmap glyphs become visible after their images have been uploaded.
+        _glyph_image_pending_cbt = gfx_pipeline_image::device_shared::glyph_image_pending.subscribe(
+            [this] {
+                redraw_pending_glyphs<"gui_window:glyph_image_pending:redraw">();
+            },
+            callback_flags::main);
+    }
+
+    /** Process an event from the keyboard or mouse.
+     *
+     * High-frequency events are coalesced and processed before the next frame
+     * is rendered, other events are processed directly after the pending events.
+     */
+    void process_input_event(gui_event const& event) noexcept
+    {
+        _input_coalescer.add(event, [this](gui_event const& e) {
+            process_event(e);
+        });
+
+        if (not _input_coalescer.empty()) {
+            loop::main().request_render();
+        }
+    }
+
+    /** Process the coalesced input events.
+     */
+    void flush_input_events() noexcept
+    {
+        _input_coalescer.flush([this](gui_event const& e) {
+            process_event(e);
+        });
+    }
+
+    /** Redraw the widgets that were waiting on glyphs.
+     *
+     * The glyphs of a whole batch become available at the same time, only the first
+     * notification before the next frame requests a redraw; widgets that are still waiting
+     * add themselves again when they are drawn.
+     */
+    template<fixed_string Counter>
+    void redraw_pending_glyphs() noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+
+        if (auto const pending = std::exchange(_pending_glyphs_rectangle, aarectangle{})) {
+            ++global_counter<Counter>;
+            process_event({gui_event_type::window_redraw, pending});
+        }
+    }
+
+    /** Add the timings of the frame to the statistics, and capture the frame when it was slow.
+     *
+     * @param frame_begin The time stamp count at the start of `render()`.
+     */
+    void finish_frame_statistics(time_stamp_count const& frame_begin) noexcept
+    {
+        auto frame = frame_statistics::frame_type{};
+        frame.begin = frame_begin.count();
+        frame.end = time_stamp_count{time_stamp_count::inplace{}}.count();
+        frame.phases = _performance_overlay.current_frame();
+        frame.gpu = surface->timestamp_queries.last_frame_duration();
+
+        if (_frame_statistics.add_frame(frame)) {
+            capture_slow_frame(frame);
+        }
+    }
+
+    /** Save a report of a slow frame in the log directory.
+     *
+     * The report is created on the main thread, before the trace events of the
+     * frame are overwritten; it is written to a file on the thread pool.
+     *
+     * @param frame The slow frame.
+     */
+    void capture_slow_frame(frame_statistics::frame_type const& frame) noexcept
+    {
+        auto const t = trace<"window::capture_slow_frame">();
+
+        auto num_widgets = 0_uz;
+        auto max_depth = 0_uz;
+        auto todo = std::vector<std::pair<widget_intf const *, std::size_t>>{{_widget.get(), 1_uz}};
+        while (not todo.empty()) {
+            auto const [w, depth] = todo.back();
+            todo.pop_back();
+
+            ++num_widgets;
+            max_depth = std::max(max_depth, depth);
+            w->for_each_child(true, [&todo, depth](widget_intf const& child) {
+                todo.emplace_back(&child, depth + 1);
+            });
+        }
+
+        auto state = std::format(
+            "\"width\":{},\"height\":{},\"widgets\":{},\"visible_widgets\":{},\"widget_depth\":{}",
+            widget_size.width(),
+            widget_size.height(),
+            num_widgets,
+            _widget_rectangles.size(),
+            max_depth);
+
+        if (auto const device = surface->device()) {
+            auto const lock = std::scoped_lock(gfx_system_mutex);
+            state += std::format(
+                ",\"atlas_SDF\":{:.3f},\"atlas_SDF_generation\":{},\"atlas_image\":{:.3f}",
+                device->SDF_pipeline->atlas_occupancy(),
+                device->SDF_pipeline->atlas_generation.load(std::memory_order::relaxed),
+                device->image_pipeline->atlas_occupancy());
+        }
+
+        auto report = _frame_statistics.slow_frame_report(frame, state);
+
+        auto const dir = log_dir();
+        if (not dir) {
+            hi_log_error("Could not save slow frame: {}", dir.error().message());
+            return;
+        }
+
+        auto path = *dir / std::format("slow_frame_{}_{}.json", GetCurrentProcessId(), _frame_statistics.num_slow_frames());
+        hi_log_warning(
+            "Window '{}' rendered a slow frame of {:.2f} ms, captured in {}",
+            _title,
+            std::chrono::duration<double, std::milli>(frame.duration()).count(),
+            path.string());
+
+        thread_pool::global().post_function([path = std::move(path), report = std::move(report)] {
+            try {
+                auto f = file{path, access_mode::truncate_or_create_for_write};
+                f.write(report);
+                f.close();
+            } catch (std::exception const& e) {
+                hi_log_error("Could not save slow frame to {}: {}", path.string(), e.what());
+            }
+        });
+    }
+
+    /** Check if the window needs to be rendered on the next frame.
+     */
+    [[nodiscard]] bool need_render() const noexcept
+    {
+        return _reconstrain.load(std::memory_order::relaxed) or _relayout.load(std::memory_order::relaxed) or
+            _resize.load(std::memory_order::relaxed) or not _redraw_rectangle.load(std::memory_order::relaxed).empty() or
+            widget_size != rectangle.size();
+    }
+
+    /** Update the window-rectangles of all visible widgets and calculate the damage.
+     *
+     * @param root The top-level widget of the window.
+     * @return The union of the old and new clipping rectangles of the widgets that
+     *         changed position or size, and of widgets that appeared or disappeared.
+     */
+    [[nodiscard]] aarectangle update_widget_rectangles(widget_intf const& root) noexcept
+    {
+        auto const generation = ++_widget_rectangles_generation;
+        auto r = aarectangle{};
+
+        auto todo = std::vector<widget_intf const *>{&root};
+        while (not todo.empty()) {
+            auto const& w = *todo.back();
+            todo.pop_back();
+
+            auto const new_rectangle = w.layout().clipping_rectangle_on_window();
+            auto [it, inserted] = _widget_rectangles.try_emplace(w.id, widget_rectangle_type{new_rectangle, generation});
+            if (inserted) {
+                r |= new_rectangle;
+            } else {
+                if (it->second.rectangle != new_rectangle) {
+                    r |= it->second.rectangle | new_rectangle;
+                    it->second.rectangle = new_rectangle;
+                }
+                it->second.generation = generation;
+            }
+
+            w.for_each_child(false, [&todo](widget_intf const& child) {
+                todo.push_back(&child);
+            });
+        }
+
+        // Widgets that were not visited have been removed or made invisible.
+        std::erase_if(_widget_rectangles, [&](auto const& item) {
+            if (item.second.generation != generation) {
+                r |= item.second.rectangle;
+                return true;
+            } else {
+                return false;
+            }
+        });
+
+        return r;
+    }
+
     /** Send event to a target widget.
      *
      * The commands are send in order, until the command is handled, then processing stops immediately.
@@ -1008,6 +1550,100 @@ private:
         return false;
     }
 
+    /** Get the LUID of the display adapter that drives a monitor.
+     *
+     * @param monitor The monitor to find the display adapter of.
+     * @return The LUID of the display adapter, or zero when not found.
+     */
+    [[nodiscard]] static uint64_t display_adapter_luid(HMONITOR monitor) noexcept
+    {
+        IDXGIFactory *factory = nullptr;
+        if (FAILED(CreateDXGIFactory(__uuidof(IDXGIFactory), (void **)&factory))) {
+            hi_log_error("Could not IDXGIFactory. {}", get_last_error_message());
+            return 0;
+        }
+        hi_assert_not_null(factory);
+        auto const d1 = defer([&] {
+            factory->Release();
+        });
+
+        IDXGIAdapter *adapter = nullptr;
+        for (UINT i = 0; SUCCEEDED(factory->EnumAdapters(i, &adapter)); ++i) {
+            auto const d2 = defer([&] {
+                adapter->Release();
+            });
+
+            IDXGIOutput *output = nullptr;
+            for (UINT j = 0; SUCCEEDED(adapter->EnumOutputs(j, &output)); ++j) {
+                auto const d3 = defer([&] {
+                    output->Release();
+                });
+
+                DXGI_OUTPUT_DESC output_description;
+                if (FAILED(output->GetDesc(&output_description)) or output_description.Monitor != monitor) {
+                    continue;
+                }
+
+                DXGI_ADAPTER_DESC adapter_description;
+                if (FAILED(adapter->GetDesc(&adapter_description))) {
+                    hi_log_error("Could not IDXGIAdapter::GetDesc(). {}", get_last_error_message());
+                    return 0;
+                }
+
+                auto r = uint64_t{0};
+                static_assert(sizeof(adapter_description.AdapterLuid) == sizeof(r));
+                std::memcpy(&r, std::addressof(adapter_description.AdapterLuid), sizeof(r));
+                return r;
+            }
+        }
+
+        return 0;
+    }
+
+    /** Select the best device for the surface again.
+     *
+     * The glyph atlas is copied to the new device, the other pipelines are
+     * rebuild, and the widgets are constrained again so that they upload their
+     * images to the new device.
+     */
+    void reselect_device() noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+        hi_assert_not_null(surface);
+
+        auto const old_device = surface->device();
+        surface->reselect_device();
+        if (surface->device() != old_device) {
+            hi_log_info("Window '{}' moved to device {}", _title, surface->device()->string());
+            ++global_counter<"gui_window:device:constrain">;
+            this->request_reconstrain_all();
+        }
+    }
+
+    /** Check if the window was moved to another monitor.
+     *
+     * When the window is on another monitor the device that drives that monitor
+     * is preferred, so that frames do not need to be copied between GPUs.
+     */
+    void update_monitor() noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+
+        if (_render_thread and not _render_thread->ready()) {
+            // The render thread is still using the surface, try again after the next move.
+            return;
+        }
+
+        auto const monitor = MonitorFromWindow(win32Window, MONITOR_DEFAULTTONEAREST);
+        if (monitor == _monitor) {
+            return;
+        }
+        _monitor = monitor;
+
+        surface->display_luid = display_adapter_luid(monitor);
+        reselect_device();
+    }
+
     void setOSWindowRectangleFromRECT(RECT new_rectangle) noexcept
     {
         hi_axiom(loop::main().on_thread());
@@ -1332,6 +1968,7 @@ private:
         }
         pixel_density = {unit::pixels_per_inch(ppi_), os_settings::device_type()};
         surface = make_unique_gfx_surface(crt_application_instance, win32Window);
+        update_monitor();
     }
 
     /** Complete the creation of the window by showing it.
@@ -1480,6 +2117,11 @@ private:
                 new_rectangle.right = windowpos_ptr->x + windowpos_ptr->cx;
                 new_rectangle.bottom = windowpos_ptr->y + windowpos_ptr->cy;
                 setOSWindowRectangleFromRECT(new_rectangle);
+
+                if (not resizing) {
+                    // Moved by the application or by a keyboard shortcut, like Win+Shift+Arrow.
+                    update_monitor();
+                }
             }
             break;
 
@@ -1500,6 +2142,7 @@ private:
             // After a manual move of the window, it is clear that the window is in normal mode.
             _restore_rectangle = rectangle;
             _size_state = gui_window_size::normal;
+            update_monitor();
             this->process_event({gui_event_type::window_redraw, aarectangle{rectangle.size()}});
             break;
 
@@ -1517,7 +2160,7 @@ private:
                 hi_log_error("Unknown WM_ACTIVE value.");
             }
             ++global_counter<"gui_window:WM_ACTIVATE:constrain">;
-            this->process_event({gui_event_type::window_reconstrain});
+            this->request_reconstrain_all();
             break;
 
         case WM_GETMINMAXINFO:
@@ -1538,26 +2181,26 @@ private:
                 // Tell the 3rd party keyboard handler application that we support WM_UNICHAR.
                 return 1;
 
-            } else if (auto const gc = ucd_get_general_category(c); not is_C(gc) and not is_M(gc)) {
+            } else if (auto const gc = ucd_get_text_properties(c).general_category(); not is_C(gc) and not is_M(gc)) {
                 // Only pass code-points that are non-control and non-mark.
-                process_event(gui_event::keyboard_grapheme(grapheme{c}));
+                process_input_event(gui_event::keyboard_grapheme(grapheme{c}));
             }
             break;
 
         case WM_DEADCHAR:
             if (auto c = handle_suragates(char_cast<char32_t>(wParam))) {
-                if (auto const gc = ucd_get_general_category(c); not is_C(gc) and not is_M(gc)) {
+                if (auto const gc = ucd_get_text_properties(c).general_category(); not is_C(gc) and not is_M(gc)) {
                     // Only pass code-points that are non-control and non-mark.
-                    process_event(gui_event::keyboard_partial_grapheme(grapheme{c}));
+                    process_input_event(gui_event::keyboard_partial_grapheme(grapheme{c}));
                 }
             }
             break;
 
         case WM_CHAR:
             if (auto c = handle_suragates(char_cast<char32_t>(wParam))) {
-                if (auto const gc = ucd_get_general_category(c); not is_C(gc) and not is_M(gc)) {
+                if (auto const gc = ucd_get_text_properties(c).general_category(); not is_C(gc) and not is_M(gc)) {
                     // Only pass code-points that are non-control and non-mark.
-                    process_event(gui_event::keyboard_grapheme(grapheme{c}));
+                    process_input_event(gui_event::keyboard_grapheme(grapheme{c}));
                 }
             }
             break;
@@ -1565,7 +2208,7 @@ private:
         case WM_SYSCOMMAND:
             if (wParam == SC_KEYMENU) {
                 keymenu_pressed = true;
-                process_event(gui_event{gui_event_type::keyboard_down, keyboard_virtual_key::menu});
+                process_input_event(gui_event{gui_event_type::keyboard_down, keyboard_virtual_key::menu});
                 return 0;
             }
             break;
@@ -1586,7 +2229,7 @@ private:
                 if (virtual_key != keyboard_virtual_key::nul) {
                     auto const key_state = get_keyboard_state();
                     auto const event_type = uMsg == WM_KEYDOWN ? gui_event_type::keyboard_down : gui_event_type::keyboard_up;
-                    process_event(gui_event{event_type, virtual_key, key_modifiers, key_state});
+                    process_input_event(gui_event{event_type, virtual_key, key_modifiers, key_state});
                 }
             }
             break;
@@ -1608,7 +2251,7 @@ private:
         case WM_MOUSEMOVE:
         case WM_MOUSELEAVE:
             keymenu_pressed = false;
-            process_event(create_mouse_event(uMsg, wParam, lParam));
+            process_input_event(create_mouse_event(uMsg, wParam, lParam));
             break;
 
         case WM_NCCALCSIZE:
@@ -1712,7 +2355,7 @@ private:
                     new_rectangle->bottom - new_rectangle->top,
                     SWP_NOZORDER | SWP_NOACTIVATE);
                 ++global_counter<"gui_window:WM_DPICHANGED:constrain">;
-                this->process_event({gui_event_type::window_reconstrain});
+                this->request_reconstrain_all();
 
                 // XXX #667 use mp-units formatting.
                 hi_log_info("DPI has changed to {} ppi", pixel_density.ppi.in(unit::pixels_per_inch));
@@ -1722,6 +2365,13 @@ private:
             }
             break;
 
+        case WM_DISPLAYCHANGE:
+            hi_axiom(loop::main().on_thread());
+            // Monitors may have been connected to another display adapter.
+            _monitor = nullptr;
+            update_monitor();
+            break;
+
         default:
             break;
         }
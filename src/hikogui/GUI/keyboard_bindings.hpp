@@ -10,6 +10,9 @@
 #include "../codec/codec.hpp"
 #include "../macros.hpp"
 #include <unordered_map>
+#include <array>
+#include <vector>
+#include <span>
 #include <tuple>
 #include <filesystem>
 #include <coroutine>
@@ -18,6 +21,12 @@ hi_export_module(hikogui.GUI : keyboard_bindings);
 
 hi_export namespace hi { inline namespace v1 {
 
+/** The bindings of keys to commands.
+ *
+ * The bindings are compiled into a table, indexed directly by the modifiers
+ * and the virtual key. Translating a key press is a single lookup in this
+ * table, without allocations; which matters for key-repeat in text fields.
+ */
 class keyboard_bindings {
 public:
     keyboard_bindings() noexcept : bindings() {}
@@ -27,33 +36,34 @@ public:
     void add_system_binding(keyboard_key key, gui_event_type command) noexcept
     {
         bindings[key].add_system_command(command);
+        compile();
     }
 
     void add_ignored_binding(keyboard_key key, gui_event_type command) noexcept
     {
         bindings[key].add_ignored_command(command);
+        compile();
     }
 
     void add_user_binding(keyboard_key key, gui_event_type command) noexcept
     {
         bindings[key].add_user_command(command);
+        compile();
     }
 
     /** translate a key press in the empty-context to a command.
      *
      * @param event The event to look up in the bindings.
-     * @return The event list translated from the keyboard event.
+     * @return The event list translated from the keyboard event, valid until the bindings are modified.
      */
-    [[nodiscard]] generator<gui_event> translate(gui_event event) const noexcept
+    [[nodiscard]] std::span<gui_event const> translate(gui_event const& event) const noexcept
     {
-        if (event == gui_event_type::keyboard_down) {
-            auto const i = bindings.find(keyboard_key{event.keyboard_modifiers, event.key()});
-            if (i != bindings.cend()) {
-                for (auto& e : i->second.get_events()) {
-                    co_yield e;
-                }
-            }
+        if (event != gui_event_type::keyboard_down) {
+            return {};
         }
+
+        auto const& entry = _table[table_index(keyboard_key{event.keyboard_modifiers, event.key()})];
+        return std::span{_events}.subspan(entry.offset, entry.size);
     }
 
     /** Clear all bindings.
@@ -64,6 +74,7 @@ public:
     void clear() noexcept
     {
         bindings.clear();
+        compile();
     }
 
     /** Load bindings from a JSON file.
@@ -104,16 +115,19 @@ public:
                     throw parse_error(std::format("Could not parse command '{}'", command_name));
                 }
 
+                // The table is compiled once, after all bindings are added.
                 if (ignored_binding) {
-                    add_ignored_binding(key, command);
+                    bindings[key].add_ignored_command(command);
                 } else if (system_binding) {
-                    add_system_binding(key, command);
+                    bindings[key].add_system_command(command);
                 } else {
-                    add_user_binding(key, command);
+                    bindings[key].add_user_command(command);
                 }
             }
+            compile();
 
         } catch (std::exception const& e) {
+            compile();
             throw io_error(std::format("{}: Could not load keyboard bindings.\n{}", path.string(), e.what()));
         }
     }
@@ -196,9 +210,50 @@ private:
         }
     };
 
+    /** The events of a key in the compiled table.
+     */
+    struct table_entry_type {
+        uint16_t offset = 0;
+        uint16_t size = 0;
+    };
+
+    /** The number of entries in the compiled table, one for each combination of modifiers and virtual key.
+     */
+    constexpr static std::size_t table_size = 16 * 256;
+
     /** Bindings made by the user which may be saved for the user.
      */
     std::unordered_map<keyboard_key, commands_t> bindings;
+
+    /** The compiled table, indexed by `table_index()`.
+     */
+    std::array<table_entry_type, table_size> _table = {};
+
+    /** The events of all the keys in the table.
+     */
+    std::vector<gui_event> _events = {};
+
+    [[nodiscard]] constexpr static std::size_t table_index(keyboard_key const& key) noexcept
+    {
+        auto const modifiers = std::to_underlying(key.modifiers);
+        hi_axiom(modifiers < 16);
+        return (modifiers << 8) | std::to_underlying(key.virtual_key);
+    }
+
+    /** Compile the bindings into the table.
+     */
+    void compile() noexcept
+    {
+        _table = {};
+        _events.clear();
+        for (auto const& [key, commands] : bindings) {
+            auto const& events = commands.get_events();
+            auto& entry = _table[table_index(key)];
+            entry.offset = narrow_cast<uint16_t>(_events.size());
+            entry.size = narrow_cast<uint16_t>(events.size());
+            _events.insert(_events.end(), events.begin(), events.end());
+        }
+    }
 };
 
 namespace detail {
@@ -223,11 +278,14 @@ inline void load_system_keyboard_bindings(std::filesystem::path const& path)
     return keyboard_bindings::global().load_bindings(path, true);
 }
 
-inline generator<gui_event> translate_keyboard_event(gui_event event) noexcept
+/** Translate a key press to commands, using the global keyboard bindings.
+ *
+ * @param event The keyboard event to translate.
+ * @return The commands bound to the key, valid until the bindings are modified.
+ */
+[[nodiscard]] inline std::span<gui_event const> translate_keyboard_event(gui_event const& event) noexcept
 {
-    for (auto& e : keyboard_bindings::global().translate(event)) {
-        co_yield e;
-    }
+    return keyboard_bindings::global().translate(event);
 }
 
 }} // namespace hi::v1
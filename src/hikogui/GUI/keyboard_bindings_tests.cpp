@@ -0,0 +1,40 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "keyboard_bindings.hpp"
+#include <hikotest/hikotest.hpp>
+
+TEST_SUITE(keyboard_bindings_suite) {
+
+TEST_CASE(translate_test)
+{
+    using enum hi::gui_event_type;
+
+    auto bindings = hi::keyboard_bindings{};
+    auto const ctrl_v = hi::keyboard_key{hi::keyboard_modifiers::control, hi::keyboard_virtual_key::V};
+    auto const left = hi::keyboard_key{hi::keyboard_modifiers::none, hi::keyboard_virtual_key::left};
+
+    bindings.add_system_binding(ctrl_v, text_edit_paste);
+    bindings.add_system_binding(left, text_cursor_left_char);
+    bindings.add_system_binding(left, gui_widget_prev);
+    bindings.add_ignored_binding(left, gui_widget_prev);
+
+    auto const paste =
+        bindings.translate(hi::gui_event{keyboard_down, hi::keyboard_virtual_key::V, hi::keyboard_modifiers::control});
+    REQUIRE(paste.size() == 1);
+    REQUIRE(paste[0] == text_edit_paste);
+
+    auto const cursor = bindings.translate(hi::gui_event{keyboard_down, hi::keyboard_virtual_key::left});
+    REQUIRE(cursor.size() == 1);
+    REQUIRE(cursor[0] == text_cursor_left_char);
+
+    // Without the modifier, or on key release, the key is not bound.
+    REQUIRE(bindings.translate(hi::gui_event{keyboard_down, hi::keyboard_virtual_key::V}).empty());
+    REQUIRE(bindings.translate(hi::gui_event{keyboard_up, hi::keyboard_virtual_key::V, hi::keyboard_modifiers::control}).empty());
+
+    bindings.clear();
+    REQUIRE(bindings.translate(hi::gui_event{keyboard_down, hi::keyboard_virtual_key::left}).empty());
+}
+
+};
@@ -26,6 +26,8 @@ struct mouse_buttons {
         x2_button(false)
     {
     }
+
+    [[nodiscard]] constexpr friend bool operator==(mouse_buttons const&, mouse_buttons const&) noexcept = default;
 };
 
 } // namespace hi::inline v1
@@ -0,0 +1,325 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file GUI/performance_overlay.hpp Defines performance_overlay.
+ * @ingroup GUI
+ */
+
+#pragma once
+
+#include "frame_statistics.hpp"
+#include "theme.hpp"
+#include "widget_layout.hpp"
+#include "../GFX/GFX.hpp"
+#include "../text/text.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../time/time.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <array>
+#include <string>
+#include <format>
+#include <chrono>
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.GUI : performance_overlay);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A debug overlay that shows the performance of a window.
+ *
+ * The overlay is drawn on top of the widgets and shows:
+ *  - a graph of the CPU time of the recent frames, split in frame phases,
+ *  - the mean duration of each frame phase,
+ *  - the number of vertices drawn for each pipeline,
+ *  - the occupancy of the texture atlases of the SDF and image pipelines,
+ *  - the memory used by each subsystem, see `track_allocation()`,
+ *  - the global counters with the highest total count.
+ *
+ * While the overlay is enabled the window is completely redrawn on each frame,
+ * so that the graph keeps updating.
+ *
+ * @ingroup GUI
+ */
+class performance_overlay {
+public:
+    /** The number of frames shown in the graph.
+     */
+    constexpr static std::size_t num_frames = 120;
+
+    /** The number of global counters shown.
+     */
+    constexpr static std::size_t num_counters = 8;
+
+    /** The number of subsystems shown with their memory usage.
+     */
+    constexpr static std::size_t num_memory_usages = 6;
+
+    /** Measure the duration of a frame phase until it goes out of scope.
+     */
+    class scoped_phase {
+    public:
+        scoped_phase(scoped_phase const&) = delete;
+        scoped_phase(scoped_phase&&) = delete;
+        scoped_phase& operator=(scoped_phase const&) = delete;
+        scoped_phase& operator=(scoped_phase&&) = delete;
+
+        scoped_phase(performance_overlay& overlay, frame_phase phase) noexcept :
+            _overlay(overlay), _phase(phase), _time_stamp(time_stamp_count::inplace{})
+        {
+        }
+
+        ~scoped_phase()
+        {
+            auto const current_time_stamp = time_stamp_count{time_stamp_count::inplace{}};
+            _overlay._current_frame[std::to_underlying(_phase)] += current_time_stamp.count() - _time_stamp.count();
+        }
+
+    private:
+        performance_overlay& _overlay;
+        frame_phase _phase;
+        time_stamp_count _time_stamp;
+    };
+
+    [[nodiscard]] bool enabled() const noexcept
+    {
+        return _enabled;
+    }
+
+    /** Show or hide the overlay.
+     *
+     * The history of frames is cleared, so that it does not include frames from
+     * before the overlay was last shown.
+     */
+    void toggle() noexcept
+    {
+        _enabled = not _enabled;
+        _frames = {};
+        _num_frames = 0;
+        _frame_index = 0;
+    }
+
+    /** Measure the duration of a frame phase.
+     *
+     * @param phase The phase of the frame that is measured.
+     * @return An object that adds the duration to the current frame when it is destroyed.
+     */
+    [[nodiscard]] scoped_phase measure(frame_phase phase) noexcept
+    {
+        return scoped_phase{*this, phase};
+    }
+
+    /** The measured phases of the current frame.
+     */
+    [[nodiscard]] frame_statistics::phases_type const& current_frame() const noexcept
+    {
+        return _current_frame;
+    }
+
+    /** Add the measured phases of the current frame to the history.
+     */
+    void finish_frame() noexcept
+    {
+        if (_enabled) {
+            _frames[_frame_index] = _current_frame;
+            _frame_index = (_frame_index + 1) % num_frames;
+            _num_frames = std::min(_num_frames + 1, num_frames);
+        }
+        _current_frame = {};
+    }
+
+    /** Draw the overlay.
+     *
+     * This should be called after the widgets are drawn, so that the number of
+     * vertices of the widgets is known.
+     *
+     * @param context The draw context of the window.
+     * @param layout The layout of the window.
+     * @param theme The theme of the window.
+     * @param pixel_density The pixel density of the window.
+     */
+    void draw(
+        draw_context const& context,
+        widget_layout const& layout,
+        hi::theme const& theme,
+        unit::pixel_density pixel_density) const noexcept
+    {
+        if (not _enabled) {
+            return;
+        }
+
+        // Draw in front of the widgets, including their overlays.
+        auto overlay_layout = layout;
+        overlay_layout.elevation = elevation;
+
+        auto const text = std::format(
+            "{}\nbox: {}  image: {}  SDF: {}  override: {}\n{}{}{}",
+            phases_text(),
+            context.num_box_instances(),
+            context.num_image_vertices(),
+            context.num_sdf_instances(),
+            context.num_override_vertices(),
+            atlas_text(*context.device),
+            memory_text(),
+            counters_text());
+
+        auto shaped_text = text_shaper{text, theme.text_style_set(), pixel_density, alignment::top_left(), true};
+        auto const margin = theme.margin<float>();
+        auto const text_bounding_rectangle = ceil(shaped_text.bounding_rectangle(std::numeric_limits<float>::infinity()));
+        auto const text_size = text_bounding_rectangle.size();
+        auto const width = std::max(text_size.width(), graph_width);
+        auto const height = graph_height + margin + text_size.height();
+
+        auto const panel_rectangle = aarectangle{
+            margin, layout.window_size.height() - height - 3.0f * margin, width + 2.0f * margin, height + 2.0f * margin};
+        context.draw_box(overlay_layout, panel_rectangle, color{0.0f, 0.0f, 0.0f, 0.75f});
+
+        auto const graph_rectangle =
+            aarectangle{panel_rectangle.left() + margin, panel_rectangle.top() - margin - graph_height, graph_width, graph_height};
+        draw_graph(context, overlay_layout, graph_rectangle);
+
+        auto const text_rectangle =
+            aarectangle{panel_rectangle.left() + margin, panel_rectangle.bottom() + margin, width, text_size.height()};
+        // The bounding rectangle is relative to the baseline of the first line.
+        auto const baseline = text_rectangle.top() - text_bounding_rectangle.top();
+        shaped_text.layout(text_rectangle, baseline, layout.sub_pixel_size, layout.frame_resource);
+        context.draw_text(overlay_layout, shaped_text, theme.foreground_color());
+    }
+
+private:
+    constexpr static std::size_t num_phases = frame_statistics::num_phases;
+    constexpr static float elevation = 99.0f;
+    constexpr static float graph_width = 2.0f * num_frames;
+    constexpr static float graph_height = 60.0f;
+
+    /** The colors of the phases in the graph.
+     */
+    inline static std::array<color, num_phases> const phase_colors = {
+        color{0.0f, 0.3f, 1.0f}, color{0.0f, 0.8f, 0.3f}, color{1.0f, 0.6f, 0.0f}, color{0.9f, 0.1f, 0.1f}};
+
+    using frame_type = frame_statistics::phases_type;
+
+    bool _enabled = false;
+
+    /** The duration of each phase of the frame being rendered, in `time_stamp_count` ticks.
+     */
+    frame_type _current_frame = {};
+
+    /** The durations of the phases of recent frames, a ring-buffer.
+     */
+    std::array<frame_type, num_frames> _frames = {};
+    std::size_t _frame_index = 0;
+    std::size_t _num_frames = 0;
+
+    [[nodiscard]] static float to_ms(uint64_t count) noexcept
+    {
+        return std::chrono::duration<float, std::milli>(time_stamp_count::duration_from_count(count)).count();
+    }
+
+    [[nodiscard]] static uint64_t total(frame_type const& frame) noexcept
+    {
+        auto r = uint64_t{0};
+        for (auto const duration : frame) {
+            r += duration;
+        }
+        return r;
+    }
+
+    /** The frame with index 0 is the oldest frame in the history.
+     */
+    [[nodiscard]] frame_type const& frame(std::size_t i) const noexcept
+    {
+        hi_axiom(i < _num_frames);
+        return _frames[(_frame_index + num_frames - _num_frames + i) % num_frames];
+    }
+
+    [[nodiscard]] std::string phases_text() const
+    {
+        auto sum = frame_type{};
+        auto max_total = uint64_t{0};
+        for (auto i = 0_uz; i != _num_frames; ++i) {
+            auto const& f = frame(i);
+            for (auto j = 0_uz; j != num_phases; ++j) {
+                sum[j] += f[j];
+            }
+            max_total = std::max(max_total, total(f));
+        }
+
+        auto const n = static_cast<float>(std::max(_num_frames, 1_uz));
+        auto r = std::format("frame: {:.2f} ms (max {:.2f} ms)\n", to_ms(total(sum)) / n, to_ms(max_total));
+        for (auto j = 0_uz; j != num_phases; ++j) {
+            r += std::format("{}: {:.2f} ms  ", frame_phase_metadata[static_cast<frame_phase>(j)], to_ms(sum[j]) / n);
+        }
+        return r;
+    }
+
+    [[nodiscard]] static std::string atlas_text(gfx_device const& device)
+    {
+        auto const lock = std::scoped_lock(gfx_system_mutex);
+        return std::format(
+            "atlas SDF: {:.1f}%  image: {:.1f}%",
+            device.SDF_pipeline->atlas_occupancy() * 100.0f,
+            device.image_pipeline->atlas_occupancy() * 100.0f);
+    }
+
+    [[nodiscard]] static std::string memory_text()
+    {
+        auto r = std::string{};
+        auto const usages = get_memory_usage();
+        for (auto i = 0_uz; i != std::min(usages.size(), num_memory_usages); ++i) {
+            auto const& usage = usages[i];
+            r += std::format(
+                "\n{:>9.1f} KiB {:>8} memory:{}", static_cast<double>(usage.bytes) / 1024.0, usage.allocations, usage.tag);
+        }
+        return r;
+    }
+
+    [[nodiscard]] static std::string counters_text()
+    {
+        auto r = std::string{};
+        for (auto const& [name, count] : get_largest_global_counters(num_counters)) {
+            r += std::format("\n{:>12} {}", count, name);
+        }
+        return r;
+    }
+
+    /** Draw the phases of each frame as stacked bars.
+     *
+     * The graph is scaled to the slowest frame, but at least to a 60 fps frame time.
+     */
+    void draw_graph(draw_context const& context, widget_layout const& layout, aarectangle const& rectangle) const noexcept
+    {
+        auto max_total = uint64_t{0};
+        for (auto i = 0_uz; i != _num_frames; ++i) {
+            max_total = std::max(max_total, total(frame(i)));
+        }
+        auto const scale = rectangle.height() / std::max(to_ms(max_total), 1000.0f / 60.0f);
+
+        auto const bar_width = rectangle.width() / static_cast<float>(num_frames);
+        for (auto i = 0_uz; i != _num_frames; ++i) {
+            auto const& f = frame(i);
+            auto const x = rectangle.left() + static_cast<float>(num_frames - _num_frames + i) * bar_width;
+            auto y = rectangle.bottom();
+            for (auto j = 0_uz; j != num_phases; ++j) {
+                auto const bar_height = to_ms(f[j]) * scale;
+                if (bar_height > 0.0f) {
+                    context.draw_box(layout, aarectangle{x, y, bar_width, bar_height}, phase_colors[j]);
+                }
+                y += bar_height;
+            }
+        }
+
+        // A line at 60 fps.
+        auto const y = rectangle.bottom() + 1000.0f / 60.0f * scale;
+        context.draw_line(
+            layout, line_segment{point2{rectangle.left(), y}, point2{rectangle.right(), y}}, 1.0f, color{1.0f, 1.0f, 1.0f, 0.5f});
+    }
+};
+
+}} // namespace hi::v1
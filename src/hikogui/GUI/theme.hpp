@@ -11,11 +11,16 @@
 #include "../geometry/geometry.hpp"
 #include "../codec/codec.hpp"
 #include "../theme/theme.hpp"
+#include "../telemetry/telemetry.hpp"
 #include "../macros.hpp"
 #include <gsl/gsl>
 #include <array>
 #include <filesystem>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 hi_export_module(hikogui.GUI : theme);
@@ -37,18 +42,63 @@ public:
     theme& operator=(theme&&) noexcept = default;
 
     /** Open and parse a theme file.
+     *
+     * The theme file is either a `*.theme.json` text file, or a `*.theme.bon8`
+     * file compiled from the JSON text. A compiled theme is decoded directly
+     * from the memory-mapped file, without tokenizing the text.
+     */
+    theme(std::filesystem::path const& path) : theme(path, read(path)) {}
+
+    /** Parse a theme that was read from a file.
+     *
+     * @param path The path of the theme file, used in error messages.
+     * @param data The data returned by `theme::read()`.
      */
-    theme(std::filesystem::path const& path)
+    theme(std::filesystem::path const& path, datum const& data)
     {
         try {
             hi_log_info("Parsing theme at {}", path.string());
-            auto const data = parse_JSON(path);
             parse(data);
         } catch (std::exception const& e) {
             throw io_error(std::format("{}: Could not load theme.\n{}", path.string(), e.what()));
         }
     }
 
+    /** Read a theme file, without parsing the theme.
+     *
+     * Unlike parsing a theme, which modifies the named colors, reading a
+     * theme file may be done on any thread.
+     *
+     * @param path The path to a `*.theme.json` or `*.theme.bon8` file.
+     * @return The data of the theme file.
+     * @throws io_error When the file could not be read.
+     */
+    [[nodiscard]] static datum read(std::filesystem::path const& path)
+    {
+        try {
+            return path.extension() == ".bon8" ? decode_BON8(as_bstring_view(file_view(path))) : parse_JSON(path);
+        } catch (std::exception const& e) {
+            throw io_error(std::format("{}: Could not load theme.\n{}", path.string(), e.what()));
+        }
+    }
+
+    /** Parse the mode of a theme.
+     *
+     * @param mode_name The value of the 'mode' attribute of a theme.
+     * @throws parse_error When the mode is not "light" or "dark".
+     */
+    [[nodiscard]] static theme_mode parse_mode(std::string_view mode_name)
+    {
+        auto const mode_name_ = to_lower(mode_name);
+        if (mode_name_ == "light") {
+            return theme_mode::light;
+        } else if (mode_name_ == "dark") {
+            return theme_mode::dark;
+        } else {
+            throw parse_error(std::format("Attribute 'mode' must be \"light\" or \"dark\", got \"{}\".", mode_name_));
+        }
+    }
+
     /** Distance between widgets and between widgets and the border of the container.
      */
     template<typename T = hi::margins>
@@ -205,14 +255,30 @@ public:
         return _text_style_set;
     }
 
+    /** Get a function to retrieve the style attributes of a widget from this theme.
+     *
+     * Many widgets share the same style-path, such as the labels in a list.
+     * Therefor the function caches the attributes for each path and pseudo-class.
+     * Each call makes a new function with an empty cache, so that switching
+     * themes starts with an empty cache.
+     */
     [[nodiscard]] style::attributes_from_theme_type attributes_from_theme_function() const noexcept
     {
-        return [](style_path const &path, style_pseudo_class const &pseudo_class) -> style_attributes {
-            return style_attributes{};
+        auto cache = std::make_shared<attributes_cache_type>();
+        return [cache](style_path const &path, style_pseudo_class const &pseudo_class) -> style_attributes {
+            auto& attributes = (*cache)[path][std::to_underlying(pseudo_class)];
+            if (not attributes) {
+                ++global_counter<"theme:attributes:resolve">;
+                attributes = resolve_attributes(path, pseudo_class);
+            }
+            return *attributes;
         };
     }
 
 private:
+    using attributes_cache_type =
+        std::unordered_map<style_path, std::array<std::optional<style_attributes>, style_pseudo_class_size>>;
+
     /** Distance between widgets and between widgets and the border of the container.
      */
     float _margin = 5.0f;
@@ -259,6 +325,11 @@ private:
 
     hi::text_style_set _text_style_set;
 
+    [[nodiscard]] static style_attributes resolve_attributes(style_path const &path, style_pseudo_class pseudo_class) noexcept
+    {
+        return style_attributes{};
+    }
+
     [[nodiscard]] float parse_float(datum const& data, char const* object_name)
     {
         if (!data.contains(object_name)) {
@@ -366,7 +437,7 @@ private:
                 throw parse_error(std::format("Expect all integers or all floating point numbers in a color, got {}.", data));
             }
 
-        } else if (auto const* color_name = get_if<std::string>(data)) {
+        } else if (auto const color_name = get_if<std::string>(data)) {
             auto const color_name_ = to_lower(*color_name);
             if (color_name_.starts_with("#")) {
                 return color_from_sRGB(color_name_);
@@ -492,14 +563,7 @@ private:
 
         name = parse_string(data, "name");
 
-        auto const mode_name = to_lower(parse_string(data, "mode"));
-        if (mode_name == "light") {
-            mode = theme_mode::light;
-        } else if (mode_name == "dark") {
-            mode = theme_mode::dark;
-        } else {
-            throw parse_error(std::format("Attribute 'mode' must be \"light\" or \"dark\", got \"{}\".", mode_name));
-        }
+        mode = parse_mode(parse_string(data, "mode"));
 
         named_color<"blue"> = parse_color(data, "blue");
         named_color<"green"> = parse_color(data, "green");
@@ -6,11 +6,21 @@
 
 #include "theme.hpp"
 #include "../settings/settings.hpp"
+#include "../file/file.hpp"
+#include "../codec/codec.hpp"
+#include "../dispatch/dispatch.hpp"
 #include "../macros.hpp"
 #include <limits>
 #include <vector>
 #include <memory>
 #include <filesystem>
+#include <system_error>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <atomic>
+#include <exception>
+#include <algorithm>
 
 hi_export_module(hikogui.GUI : theme_book);
 
@@ -18,6 +28,13 @@ hi_export namespace hi::inline v1 {
 
 /** theme_book keeps track of multiple themes.
  *
+ * When reloading only the name and mode of each theme file is read. A theme
+ * is parsed when it is first found, usually the selected theme. The other
+ * themes may be read in the background with `preload()`, for example when
+ * showing a list of themes to the user.
+ *
+ * @note Parsing a theme modifies the named colors, therefor all member
+ *       functions must be called from the main thread.
  */
 class theme_book {
 public:
@@ -41,22 +58,29 @@ public:
 
     void reload() noexcept
     {
-        themes.clear();
+        _entries.clear();
 
         for (auto const& theme_directory : _theme_directories) {
-            auto const theme_directory_glob = theme_directory / "**" / "*.theme.json";
-            for (auto const& theme_path : glob(theme_directory_glob)) {
-                auto t = trace<"theme_scan">{};
+            for (auto const extension : {"*.theme.bon8", "*.theme.json"}) {
+                auto const theme_directory_glob = theme_directory / "**" / extension;
+                for (auto const& theme_path : parallel_glob(theme_directory_glob)) {
+                    if (is_superseded(theme_path)) {
+                        continue;
+                    }
 
-                try {
-                    themes.push_back(std::make_unique<theme>(theme_path));
-                } catch (std::exception const& e) {
-                    hi_log_error("Failed parsing theme at {}. \"{}\"", theme_path.string(), e.what());
+                    auto t = trace<"theme_scan">{};
+
+                    try {
+                        auto [name, mode] = read_metadata(theme_path);
+                        _entries.emplace_back(theme_path, std::move(name), mode);
+                    } catch (std::exception const& e) {
+                        hi_log_error("Failed parsing theme at {}. \"{}\"", theme_path.string(), e.what());
+                    }
                 }
             }
         }
 
-        if (ssize(themes) == 0) {
+        if (ssize(_entries) == 0) {
             hi_log_fatal("Did not load any themes.");
         }
     }
@@ -65,8 +89,8 @@ public:
     {
         std::vector<std::string> names;
 
-        for (auto const& t : themes) {
-            names.push_back(t->name);
+        for (auto const& entry : _entries) {
+            names.push_back(entry.name);
         }
 
         std::sort(names.begin(), names.end());
@@ -75,7 +99,34 @@ public:
         return names;
     }
 
+    /** Read the themes that are not parsed yet, in the background.
+     *
+     * The files are read on the thread pool, the themes are parsed when
+     * they are found.
+     */
+    void preload() noexcept
+    {
+        for (auto& entry : _entries) {
+            if (entry.theme or entry.preload) {
+                continue;
+            }
+
+            entry.preload = std::make_shared<preload_type>();
+            thread_pool::global().post_function([path = entry.path, preload = entry.preload] {
+                try {
+                    preload->data = theme::read(path);
+                } catch (...) {
+                    preload->exception = std::current_exception();
+                }
+                preload->done.store(true, std::memory_order::release);
+            });
+        }
+    }
+
     /** Find a theme matching the name and mode.
+     *
+     * The theme is parsed when it is found for the first time. A theme that
+     * fails to parse is removed from the book.
      *
      * @param name The name of the theme to select.
      * @param mode The mode of the theme to select.
@@ -83,41 +134,163 @@ public:
      */
     [[nodiscard]] theme const& find(std::string_view name, theme_mode mode) const noexcept
     {
-        theme *default_theme = nullptr;
-        theme *default_theme_and_mode = nullptr;
-        theme *matching_theme = nullptr;
-        theme *matching_theme_and_mode = nullptr;
-
-        for (auto const& t : themes) {
-            if (t->name == name and t->mode == mode) {
-                matching_theme_and_mode = t.get();
-            } else if (t->name == name) {
-                matching_theme = t.get();
-            } else if (t->name == "default" and t->mode == mode) {
-                default_theme_and_mode = t.get();
-            } else if (t->name == "default") {
-                default_theme = t.get();
+        while (not _entries.empty()) {
+            auto const it = find_entry(name, mode);
+            if (it->theme) {
+                return *it->theme;
             }
-        }
 
-        if (matching_theme_and_mode) {
-            return *matching_theme_and_mode;
-        } else if (matching_theme) {
-            return *matching_theme;
-        } else if (default_theme_and_mode) {
-            return *default_theme_and_mode;
-        } else if (default_theme) {
-            return *default_theme;
-        } else if (ssize(themes) > 0) {
-            return *themes[0].get();
-        } else {
-            hi_no_default();
+            try {
+                it->theme = load(*it);
+                it->preload = nullptr;
+                return *it->theme;
+            } catch (std::exception const& e) {
+                hi_log_error("Failed parsing theme at {}. \"{}\"", it->path.string(), e.what());
+                _entries.erase(it);
+            }
         }
+        hi_log_fatal("Did not load any themes.");
     }
 
 private:
+    /** A theme file read by `preload()`.
+     */
+    struct preload_type {
+        std::atomic<bool> done = false;
+        datum data = {};
+        std::exception_ptr exception = nullptr;
+    };
+
+    struct entry_type {
+        std::filesystem::path path;
+        std::string name;
+        theme_mode mode;
+
+        /** The parsed theme, or empty when not parsed yet.
+         */
+        std::unique_ptr<hi::theme> theme = {};
+
+        /** The theme file being read in the background.
+         */
+        std::shared_ptr<preload_type> preload = {};
+    };
+
+    using entries_type = std::vector<entry_type>;
+
     std::vector<std::filesystem::path> _theme_directories;
-    std::vector<std::unique_ptr<theme>> themes;
+
+    /** The themes, they are parsed when they are found.
+     */
+    mutable entries_type _entries;
+
+    /** Find the entry most closely matching the name and mode.
+     *
+     * @pre There must be at least a single entry.
+     */
+    [[nodiscard]] entries_type::iterator find_entry(std::string_view name, theme_mode mode) const noexcept
+    {
+        hi_axiom(not _entries.empty());
+
+        auto default_theme = _entries.end();
+        auto default_theme_and_mode = _entries.end();
+        auto matching_theme = _entries.end();
+        auto matching_theme_and_mode = _entries.end();
+
+        for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+            if (it->name == name and it->mode == mode) {
+                matching_theme_and_mode = it;
+            } else if (it->name == name) {
+                matching_theme = it;
+            } else if (it->name == "default" and it->mode == mode) {
+                default_theme_and_mode = it;
+            } else if (it->name == "default") {
+                default_theme = it;
+            }
+        }
+
+        if (matching_theme_and_mode != _entries.end()) {
+            return matching_theme_and_mode;
+        } else if (matching_theme != _entries.end()) {
+            return matching_theme;
+        } else if (default_theme_and_mode != _entries.end()) {
+            return default_theme_and_mode;
+        } else if (default_theme != _entries.end()) {
+            return default_theme;
+        } else {
+            return _entries.begin();
+        }
+    }
+
+    /** Parse the theme of an entry.
+     *
+     * When the file was read in the background the data is reused, otherwise
+     * the file is read now.
+     */
+    [[nodiscard]] static std::unique_ptr<theme> load(entry_type const& entry)
+    {
+        if (entry.preload and entry.preload->done.load(std::memory_order::acquire)) {
+            if (entry.preload->exception) {
+                std::rethrow_exception(entry.preload->exception);
+            }
+            auto t = trace<"theme_load">{};
+            return std::make_unique<theme>(entry.path, entry.preload->data);
+        }
+
+        auto t = trace<"theme_load">{};
+        return std::make_unique<theme>(entry.path);
+    }
+
+    /** Read the name and mode of a theme, without parsing the rest of the theme.
+     *
+     * @param theme_path The path to a `*.theme.json` or `*.theme.bon8` file.
+     * @return The name and mode of the theme.
+     * @throws io_error When the file could not be read.
+     * @throws parse_error When the name or mode is missing or invalid.
+     */
+    [[nodiscard]] static std::pair<std::string, theme_mode> read_metadata(std::filesystem::path const& theme_path)
+    {
+        if (theme_path.extension() == ".bon8") {
+            auto const file = file_view(theme_path);
+            return read_metadata(decode_BON8_view(as_bstring_view(file)));
+        } else {
+            auto const document = json_document{theme_path};
+            return read_metadata(document.root());
+        }
+    }
+
+    template<typename View>
+    [[nodiscard]] static std::pair<std::string, theme_mode> read_metadata(View const& root)
+    {
+        auto const name = root.member("name");
+        hi_check(name and name->is_string(), "'name' attribute must be a string.");
+        auto const mode = root.member("mode");
+        hi_check(mode and mode->is_string(), "'mode' attribute must be a string.");
+
+        return {std::string{name->string()}, theme::parse_mode(mode->string())};
+    }
+
+    /** Check if a theme file is skipped in favour of the same theme in the other format.
+     *
+     * A compiled `*.theme.bon8` file is preferred over the `*.theme.json` file
+     * it was compiled from, unless the JSON file was modified afterwards.
+     */
+    [[nodiscard]] static bool is_superseded(std::filesystem::path const& theme_path) noexcept
+    {
+        auto const is_compiled = theme_path.extension() == ".bon8";
+        auto other_path = theme_path;
+        other_path.replace_extension(is_compiled ? ".json" : ".bon8");
+
+        auto ec = std::error_code{};
+        auto const other_time = std::filesystem::last_write_time(other_path, ec);
+        if (ec) {
+            return false;
+        }
+        auto const time = std::filesystem::last_write_time(theme_path, ec);
+        if (ec) {
+            return false;
+        }
+        return is_compiled ? time < other_time : time <= other_time;
+    }
 };
 
 namespace detail {
@@ -161,6 +334,11 @@ inline void register_theme_directories(R &&r) noexcept
     return theme_book::global().names();
 }
 
+inline void preload_themes() noexcept
+{
+    return theme_book::global().preload();
+}
+
 [[nodiscard]] inline theme const &get_selected_theme() noexcept
 {
     return find_theme(*theme_book::global().selected_theme, os_settings::theme_mode());
@@ -13,8 +13,11 @@
 #include "../GFX/GFX.hpp"
 #include "../telemetry/telemetry.hpp"
 #include "../theme/theme.hpp"
+#include "../container/functional.hpp"
 #include "../macros.hpp"
 #include <coroutine>
+#include <concepts>
+#include <utility>
 
 hi_export_module(hikogui.GUI : widget_intf);
 
@@ -22,7 +25,7 @@ hi_export namespace hi {
 inline namespace v1 {
 class gui_window;
 
-class widget_intf {
+class widget_intf : public tracked_allocated<"widget"> {
 public:
     /** The numeric identifier of a widget.
      *
@@ -61,9 +64,9 @@ public:
                 // may change as well. Therefor we update the parent-path of the
                 // children to trigger a re-evaluation of the style.
                 ++global_counter<"widget:style:path">;
-                for (auto &child : children()) {
+                for_each_child(true, [&](widget_intf& child) {
                     child.style.set_parent_path(style.path());
-                }
+                });
             }
 
             if (to_bool(mask & style_modify_mask::layout)) {
@@ -94,7 +97,7 @@ public:
 
                 } else if (need_relayout(*old_state, *state)) {
                     ++global_counter<"widget:state:relayout">;
-                    process_event({gui_event_type::window_relayout});
+                    request_relayout();
 
                 } else if (need_redraw(*old_state, *state)) {
                     ++global_counter<"widget:state:redraw">;
@@ -210,9 +213,49 @@ public:
         }
     }
 
+    /** Call a function for each child widget.
+     *
+     * This visits the same children as `children()`, in the same order.
+     * The default implementation iterates over `children()`; a widget that
+     * overrides `children()` should override this function as well, so that
+     * tree traversals do not need to resume a co-routine for each child.
+     *
+     * @see for_each_child()
+     */
+    virtual void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept
+    {
+        for (auto& child : children(include_invisible)) {
+            func(child);
+        }
+    }
+
+    /** Call a function for each child widget.
+     *
+     * This is used by the traversals of the widget tree on the hot paths,
+     * `children()` remains available for generic code.
+     *
+     * @param include_invisible Also visit the invisible children.
+     * @param func The function called with a reference to each child.
+     */
+    template<std::invocable<widget_intf&> Func>
+    void for_each_child(bool include_invisible, Func&& func) noexcept
+    {
+        auto func_ = make_function<void(widget_intf&)>(std::forward<Func>(func));
+        visit_children(include_invisible, func_);
+    }
+
+    template<std::invocable<widget_intf const&> Func>
+    void for_each_child(bool include_invisible, Func&& func) const noexcept
+    {
+        auto func_ = make_function<void(widget_intf&)>([&func](widget_intf& child) {
+            func(std::as_const(child));
+        });
+        const_cast<widget_intf *>(this)->visit_children(include_invisible, func_);
+    }
+
     /** Update the constraints of the widget.
      *
-     * Typically the implementation of this function starts with recursively calling update_constraints()
+     * Typically the implementation of this function starts with recursively calling `constraints()`
      * on its children.
      *
      * If the container, due to a change in constraints, wants the window to resize to the minimum size
@@ -236,6 +279,95 @@ public:
      */
     virtual void set_layout(widget_layout const& context) noexcept = 0;
 
+    /** Get the constraints of the widget.
+     *
+     * A container calls this function on its children, instead of `update_constraints()`.
+     * `update_constraints()` is only called when the widget, or one of its
+     * children, requested a reconstrain since the last call; otherwise the
+     * constraints of the last call are returned.
+     *
+     * @return The constraints of the widget.
+     */
+    [[nodiscard]] box_constraints const& constraints() noexcept
+    {
+        if (_need_reconstrain) {
+            _need_reconstrain = false;
+            _constraints = update_constraints();
+        }
+        return _constraints;
+    }
+
+    /** Lay out the widget.
+     *
+     * A container calls this function on its children, instead of `set_layout()`.
+     * `set_layout()` is only called when the widget is placed differently from
+     * the last layout, or when the widget, or one of its children, requested
+     * a relayout; otherwise the layout of the whole sub-tree is skipped.
+     *
+     * @param context The layout for this child.
+     */
+    void update_layout(widget_layout const& context) noexcept
+    {
+        if (_need_relayout or not _layout.same_placement(context)) {
+            _need_relayout = false;
+            set_layout(context);
+        } else {
+            ++global_counter<"widget:update_layout:skip">;
+        }
+    }
+
+    /** Update the hit-test bounds of this widget and its children.
+     *
+     * The bounds of a widget include the bounds of its children, which turns the
+     * widget tree into a bounding volume hierarchy; `hitbox_test_from_parent()`
+     * skips whole sub-trees that are not under the mouse. The window calls this
+     * on the top-level widget once after each layout.
+     *
+     * @return The bounds of the sub-tree, in the coordinate system of the parent.
+     */
+    aarectangle update_hitbox_bounds() noexcept
+    {
+        // A widget only returns a hitbox for positions inside its rectangle and clipping rectangle.
+        auto r = intersect(_layout.rectangle(), _layout.clipping_rectangle);
+        for_each_child(true, [&r](widget_intf& child) {
+            r |= child.update_hitbox_bounds();
+        });
+
+        // Widen by a pixel so that rounding in the translation never excludes a hit on the edge.
+        _hitbox_bounds = r ? _layout.to_parent * r + 1.0f : aarectangle{};
+        return _hitbox_bounds;
+    }
+
+    /** The bounds of the widget and its children for hit-testing.
+     *
+     * @return The bounds in the coordinate system of the parent, or a very large
+     *         rectangle when the widget was not laid out since it was added.
+     */
+    [[nodiscard]] aarectangle const& hitbox_bounds() const noexcept
+    {
+        return _hitbox_bounds;
+    }
+
+    /** Mark the widget to be constrained and laid out on the next frame.
+     *
+     * This is done for each widget on the path from a widget that requested a
+     * reconstrain to the window, so that only that path is constrained again.
+     */
+    void invalidate_constraints() const noexcept
+    {
+        _need_reconstrain = true;
+        _need_relayout = true;
+    }
+
+    /** Mark the widget to be laid out on the next frame.
+     *
+     * @see invalidate_constraints()
+     */
+    void invalidate_layout() const noexcept
+    {
+        _need_relayout = true;
+    }
+
     /** Get the current layout for this widget.
      */
     [[nodiscard]] widget_layout const& layout() const noexcept
@@ -259,6 +391,23 @@ public:
      */
     virtual void draw(draw_context const& context) noexcept = 0;
 
+    /** Declare the opaque parts of the widget.
+     *
+     * This function is called by the window on every frame before `draw()`.
+     * A widget with an opaque background should call `draw_context::add_occluder()`
+     * so that widgets hidden behind it are not drawn.
+     *
+     * The default implementation recursively calls this function on every visible child.
+     *
+     * @param context The context to where the widget will draw.
+     */
+    virtual void add_occluders(draw_context const& context) const noexcept
+    {
+        for_each_child(false, [&context](widget_intf const& child) {
+            child.add_occluders(context);
+        });
+    }
+
     /** Find the widget that is under the mouse cursor.
      * This function will recursively test with visual child widgets, when
      * widgets overlap on the screen the hitbox object with the highest elevation is returned.
@@ -277,6 +426,18 @@ public:
      */
     virtual void request_redraw() const noexcept = 0;
 
+    /** Request the widget to be laid out on the next frame.
+     *
+     * The window only redraws the parts where the layout of widgets has
+     * changed, therefor the widget is also redrawn in case it changes its
+     * visuals without changing its layout.
+     */
+    void request_relayout() const noexcept
+    {
+        request_redraw();
+        process_event({gui_event_type::window_relayout});
+    }
+
     /** Send a event to the window.
      */
     virtual bool process_event(gui_event const& event) const noexcept = 0;
@@ -357,6 +518,17 @@ protected:
 
 private:
     widget_intf *_parent = nullptr;
+
+    /** The constraints returned by the last call to `update_constraints()` from `constraints()`.
+     */
+    box_constraints _constraints = {};
+
+    /** The bounds of this widget and its children, see `update_hitbox_bounds()`.
+     */
+    aarectangle _hitbox_bounds = aarectangle::large();
+
+    mutable bool _need_reconstrain = true;
+    mutable bool _need_relayout = true;
 };
 
 inline widget_intf *get_if(widget_intf *start, widget_id id, bool include_invisible) noexcept
@@ -393,9 +565,9 @@ inline void apply(widget_intf& start, Func &&func, bool include_invisible = true
 
         func(*tmp);
 
-        for (auto &child : tmp->children(include_invisible)) {
+        tmp->for_each_child(include_invisible, [&todo](widget_intf& child) {
             todo.push_back(&child);
-        }
+        });
     }
 }
 
@@ -405,6 +577,9 @@ inline void apply_window_data(widget_intf& start, gui_window *new_window, unit::
         w.window = new_window;
         w.style.set_pixel_density(new_density);
         w.style.set_attributes_from_theme(new_attributes_from_theme);
+
+        // The constraints depend on the window's theme and pixel density.
+        w.invalidate_constraints();
     });
 }
 
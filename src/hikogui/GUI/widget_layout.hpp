@@ -15,6 +15,7 @@
 #include "../utility/utility.hpp"
 #include "../settings/settings.hpp"
 #include "../macros.hpp"
+#include <memory_resource>
 
 hi_export_module(hikogui.GUI : widget_layout);
 
@@ -128,6 +129,12 @@ public:
      */
     utc_nanoseconds display_time_point = {};
 
+    /** Memory resource for temporaries during layout, reclaimed at the end of the frame.
+     *
+     * May be nullptr, in which case the default memory resource should be used.
+     */
+    std::pmr::memory_resource *frame_resource = nullptr;
+
     constexpr widget_layout(widget_layout const&) noexcept = default;
     constexpr widget_layout(widget_layout&&) noexcept = default;
     constexpr widget_layout& operator=(widget_layout const&) noexcept = default;
@@ -141,7 +148,8 @@ public:
         extent2 window_size,
         gui_window_size window_size_state,
         hi::subpixel_orientation subpixel_orientation,
-        utc_nanoseconds display_time_point) noexcept :
+        utc_nanoseconds display_time_point,
+        std::pmr::memory_resource *frame_resource = nullptr) noexcept :
         to_parent(),
         from_parent(),
         to_window(),
@@ -151,7 +159,8 @@ public:
         window_size_state(window_size_state),
         clipping_rectangle(window_size),
         sub_pixel_size(hi::sub_pixel_size(subpixel_orientation)),
-        display_time_point(display_time_point)
+        display_time_point(display_time_point),
+        frame_resource(frame_resource)
     {
     }
 
@@ -166,6 +175,29 @@ public:
         return not empty();
     }
 
+    /** Check if two layouts place a widget in the same way.
+     *
+     * The display time point and frame resource change on every frame and are
+     * only used while laying out, they are ignored.
+     */
+    [[nodiscard]] constexpr bool same_placement(widget_layout const& other) const noexcept
+    {
+        // clang-format off
+        return
+            shape == other.shape and
+            to_parent == other.to_parent and
+            from_parent == other.from_parent and
+            to_window == other.to_window and
+            from_window == other.from_window and
+            window_size == other.window_size and
+            window_size_state == other.window_size_state and
+            elevation == other.elevation and
+            layer == other.layer and
+            clipping_rectangle == other.clipping_rectangle and
+            sub_pixel_size == other.sub_pixel_size;
+        // clang-format on
+    }
+
     [[nodiscard]] constexpr translate3 to_window3() const noexcept
     {
         return translate3{to_window, elevation};
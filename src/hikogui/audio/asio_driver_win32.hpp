@@ -0,0 +1,306 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_sample_format.hpp"
+#include "../win32/win32.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include "../win32_headers.hpp"
+#include <string>
+#include <vector>
+#include <bit>
+#include <cstdint>
+
+hi_export_module(hikogui.audio.asio_driver_win32);
+
+/** @file audio/asio_driver_win32.hpp
+ *
+ * The binary interface of ASIO drivers.
+ *
+ * ASIO drivers are in-process COM objects which are registered in
+ * `HKEY_LOCAL_MACHINE\SOFTWARE\ASIO`. The interface is declared here, with
+ * the same layout as in the ASIO SDK, so that the SDK is not needed to build hikogui.
+ * The names of the types and constants of the SDK are mentioned in the comments.
+ *
+ * @note The methods of `IASIO` use the default calling convention of the
+ *       compiler; which matches the drivers on x64 only. On 32-bit x86 the
+ *       drivers use `thiscall`, which would need thunks.
+ */
+
+hi_export namespace hi { inline namespace v1 {
+
+/** ASIOError
+ */
+enum class asio_error : long {
+    ok = 0, ///< ASE_OK
+    success = 0x3f4847a0, ///< ASE_SUCCESS, returned by future().
+    not_present = -1000, ///< ASE_NotPresent
+    hw_malfunction, ///< ASE_HWMalfunction
+    invalid_parameter, ///< ASE_InvalidParameter
+    invalid_mode, ///< ASE_InvalidMode
+    sp_not_advancing, ///< ASE_SPNotAdvancing
+    no_clock, ///< ASE_NoClock
+    no_memory ///< ASE_NoMemory
+};
+
+/** ASIOBool
+ */
+using asio_bool = long;
+
+/** ASIOSampleRate
+ */
+using asio_sample_rate = double;
+
+/** ASIOSamples and ASIOTimeStamp, a 64 bit integer split in two.
+ */
+struct asio_int64 {
+    unsigned long hi;
+    unsigned long lo;
+
+    [[nodiscard]] constexpr uint64_t value() const noexcept
+    {
+        return (uint64_t{hi} << 32) | uint64_t{lo};
+    }
+};
+
+/** ASIOSampleType
+ */
+enum class asio_sample_type : long {
+    int16_msb = 0,
+    int24_msb = 1,
+    int32_msb = 2,
+    float32_msb = 3,
+    float64_msb = 4,
+    int32_msb16 = 8,
+    int32_msb18 = 9,
+    int32_msb20 = 10,
+    int32_msb24 = 11,
+    int16_lsb = 16,
+    int24_lsb = 17,
+    int32_lsb = 18,
+    float32_lsb = 19,
+    float64_lsb = 20,
+    int32_lsb16 = 24,
+    int32_lsb18 = 25,
+    int32_lsb20 = 26,
+    int32_lsb24 = 27,
+    dsd_int8_lsb1 = 32,
+    dsd_int8_msb1 = 33,
+    dsd_int8_ner8 = 40
+};
+
+/** Get the audio sample format of an ASIO sample type.
+ *
+ * The `int32_lsb16` to `int32_lsb24` types are samples that are stored in
+ * the least significant bits of a 32 bit container; the unused most significant
+ * bits are handled as guard bits.
+ *
+ * @param type The ASIO sample type.
+ * @return The audio sample format, or an empty format when the type is not supported.
+ */
+[[nodiscard]] constexpr audio_sample_format to_audio_sample_format(asio_sample_type type) noexcept
+{
+    using enum asio_sample_type;
+    constexpr auto big = std::endian::big;
+    constexpr auto little = std::endian::little;
+
+    switch (type) {
+    case int16_msb:
+        return audio_sample_format::int16_be();
+    case int24_msb:
+        return audio_sample_format::int24_be();
+    case int32_msb:
+        return audio_sample_format::int32_be();
+    case float32_msb:
+        return audio_sample_format::float32_be();
+    case int32_msb16:
+        return {4, 16, 15, false, big};
+    case int32_msb18:
+        return {4, 14, 17, false, big};
+    case int32_msb20:
+        return {4, 12, 19, false, big};
+    case int32_msb24:
+        return {4, 8, 23, false, big};
+    case int16_lsb:
+        return audio_sample_format::int16_le();
+    case int24_lsb:
+        return audio_sample_format::int24_le();
+    case int32_lsb:
+        return audio_sample_format::int32_le();
+    case float32_lsb:
+        return audio_sample_format::float32_le();
+    case int32_lsb16:
+        return {4, 16, 15, false, little};
+    case int32_lsb18:
+        return {4, 14, 17, false, little};
+    case int32_lsb20:
+        return {4, 12, 19, false, little};
+    case int32_lsb24:
+        return {4, 8, 23, false, little};
+    default:
+        // 64 bit float and DSD samples.
+        return {};
+    }
+}
+
+/** ASIOClockSource
+ */
+struct asio_clock_source {
+    long index;
+    long associated_channel;
+    long associated_group;
+    asio_bool is_current_source;
+    char name[32];
+};
+
+/** ASIOChannelInfo
+ */
+struct asio_channel_info {
+    long channel;
+    asio_bool is_input;
+    asio_bool is_active;
+    long channel_group;
+    asio_sample_type type;
+    char name[32];
+};
+
+/** ASIOBufferInfo
+ */
+struct asio_buffer_info {
+    asio_bool is_input;
+    long channel_num;
+
+    /** The two halves of the double buffer of the channel, filled in by createBuffers().
+     */
+    void *buffers[2];
+};
+
+/** ASIOTime, only passed by pointer.
+ */
+struct asio_time;
+
+/** ASIOCallbacks
+ */
+struct asio_callbacks {
+    void (*buffer_switch)(long double_buffer_index, asio_bool direct_process);
+    void (*sample_rate_did_change)(asio_sample_rate sample_rate);
+    long (*asio_message)(long selector, long value, void *message, double *opt);
+    asio_time *(*buffer_switch_time_info)(asio_time *params, long double_buffer_index, asio_bool direct_process);
+};
+
+/** The selectors of asio_callbacks::asio_message.
+ */
+enum class asio_message_selector : long {
+    selector_supported = 1, ///< kAsioSelectorSupported
+    engine_version, ///< kAsioEngineVersion
+    reset_request, ///< kAsioResetRequest
+    buffer_size_change, ///< kAsioBufferSizeChange
+    resync_request, ///< kAsioResyncRequest
+    latencies_changed, ///< kAsioLatenciesChanged
+    supports_time_info, ///< kAsioSupportsTimeInfo
+    supports_time_code, ///< kAsioSupportsTimeCode
+    mmc_command, ///< kAsioMMCCommand
+    supports_input_monitor, ///< kAsioSupportsInputMonitor
+    supports_input_gain, ///< kAsioSupportsInputGain
+    supports_input_meter, ///< kAsioSupportsInputMeter
+    supports_output_gain, ///< kAsioSupportsOutputGain
+    supports_output_meter, ///< kAsioSupportsOutputMeter
+    overload ///< kAsioOverload
+};
+
+/** The COM interface of an ASIO driver.
+ *
+ * The interface-id of a driver is the same as its class-id.
+ */
+struct IASIO : public IUnknown {
+    virtual asio_bool init(void *sys_handle) = 0;
+    virtual void getDriverName(char *name) = 0;
+    virtual long getDriverVersion() = 0;
+    virtual void getErrorMessage(char *string) = 0;
+    virtual asio_error start() = 0;
+    virtual asio_error stop() = 0;
+    virtual asio_error getChannels(long *num_input_channels, long *num_output_channels) = 0;
+    virtual asio_error getLatencies(long *input_latency, long *output_latency) = 0;
+    virtual asio_error getBufferSize(long *min_size, long *max_size, long *preferred_size, long *granularity) = 0;
+    virtual asio_error canSampleRate(asio_sample_rate sample_rate) = 0;
+    virtual asio_error getSampleRate(asio_sample_rate *sample_rate) = 0;
+    virtual asio_error setSampleRate(asio_sample_rate sample_rate) = 0;
+    virtual asio_error getClockSources(asio_clock_source *clocks, long *num_sources) = 0;
+    virtual asio_error setClockSource(long reference) = 0;
+    virtual asio_error getSamplePosition(asio_int64 *sample_position, asio_int64 *time_stamp) = 0;
+    virtual asio_error getChannelInfo(asio_channel_info *info) = 0;
+    virtual asio_error
+    createBuffers(asio_buffer_info *buffer_infos, long num_channels, long buffer_size, asio_callbacks *callbacks) = 0;
+    virtual asio_error disposeBuffers() = 0;
+    virtual asio_error controlPanel() = 0;
+    virtual asio_error future(long selector, void *opt) = 0;
+    virtual asio_error outputReady() = 0;
+};
+
+/** An ASIO driver that is registered on the system.
+ */
+struct asio_driver_info {
+    /** The name of the registry key of the driver.
+     */
+    std::string key;
+
+    /** The user friendly name of the driver.
+     */
+    std::string description;
+
+    /** The class-id, and interface-id, of the driver as a string.
+     */
+    std::string clsid_string;
+
+    CLSID clsid;
+};
+
+/** Get the ASIO drivers that are registered on the system.
+ *
+ * Drivers with a missing or malformed class-id are skipped.
+ */
+[[nodiscard]] inline std::vector<asio_driver_info> asio_drivers() noexcept
+{
+    auto r = std::vector<asio_driver_info>{};
+
+    auto const keys = win32_RegEnumKeyEx(HKEY_LOCAL_MACHINE, "SOFTWARE\\ASIO");
+    if (not keys) {
+        // Without the key no ASIO driver has ever been installed.
+        if (keys.error() != win32_error::file_not_found) {
+            hi_log_error("Could not enumerate the ASIO drivers: {}", make_error_code(keys.error()).message());
+        }
+        return r;
+    }
+
+    for (auto const& key : *keys) {
+        auto const path = std::string{"SOFTWARE\\ASIO\\"} + key;
+
+        auto const clsid_string = win32_RegGetValue<std::string>(HKEY_LOCAL_MACHINE, path, "CLSID");
+        if (not clsid_string) {
+            hi_log_warning("ASIO driver '{}' does not have a CLSID.", key);
+            continue;
+        }
+
+        auto const wclsid_string = win32_MultiByteToWideChar(*clsid_string);
+        if (not wclsid_string) {
+            continue;
+        }
+
+        auto clsid = CLSID{};
+        if (FAILED(CLSIDFromString(wclsid_string->c_str(), &clsid))) {
+            hi_log_warning("ASIO driver '{}' has an invalid CLSID '{}'.", key, *clsid_string);
+            continue;
+        }
+
+        auto description = win32_RegGetValue<std::string>(HKEY_LOCAL_MACHINE, path, "Description");
+        r.emplace_back(key, description ? std::move(*description) : key, *clsid_string, clsid);
+    }
+
+    return r;
+}
+
+}} // namespace hi::inline v1
@@ -2,28 +2,36 @@
 #pragma once
 
 #include "audio_block.hpp" // export
+#include "audio_block_pool.hpp" // export
 #include "audio_channel.hpp" // export
 #include "audio_device.hpp" // export
-#include "audio_device_asio.hpp" // export
 #include "audio_device_delegate.hpp" // export
 #include "audio_device_state.hpp" // export
 #include "audio_direction.hpp" // export
 #include "audio_format_range.hpp" // export
+#include "audio_graph.hpp" // export
+#include "audio_graph_node.hpp" // export
+#include "audio_ring_buffer.hpp" // export
 //#include "audio_sample_format.hpp" // export
 //#include "audio_sample_packer.hpp" // export
 //#include "audio_sample_unpacker.hpp" // export
 #include "audio_stream_config.hpp" // export
 #include "audio_stream_format.hpp" // export
+#include "audio_stream_statistics.hpp" // export
 #include "audio_system.hpp" // export
 #include "audio_system_aggregate.hpp" // export
-#include "audio_system_asio.hpp" // export
 #include "pcm_format.hpp" // export
 #include "speaker_mapping.hpp" // export
 #include "surround_mode.hpp" // export
 
 #if HI_OPERATING_SYSTEM == HI_OS_WINDOWS
+#include "asio_driver_win32.hpp" // export
+#include "audio_device_asio.hpp" // export
 #include "audio_device_win32.hpp" // export
+#include "audio_stream_asio.hpp" // export
 #include "audio_stream_format_win32.hpp" // export
+#include "audio_stream_win32.hpp" // export
+#include "audio_system_asio.hpp" // export
 #include "audio_system_win32.hpp" // export
 #include "speaker_mapping_win32.hpp" // export
 #include "win32_device_interface.hpp" // export
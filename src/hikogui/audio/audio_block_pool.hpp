@@ -0,0 +1,185 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_block.hpp"
+#include "../memory/memory.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.audio.audio_block_pool);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A pool of preallocated audio blocks.
+ *
+ * All sample buffers are allocated, and locked in memory, when the pool is
+ * created. Each channel's sample buffer is aligned to and a multiple of 4096
+ * bytes in size, as is promised by `audio_block`.
+ *
+ * Blocks are handed out and returned through a lock-free free list, so that
+ * `allocate()` and `deallocate()` can be called from the real-time audio thread;
+ * they do not allocate memory or take locks.
+ */
+class audio_block_pool {
+public:
+    audio_block_pool(audio_block_pool const&) = delete;
+    audio_block_pool(audio_block_pool&&) = delete;
+    audio_block_pool& operator=(audio_block_pool const&) = delete;
+    audio_block_pool& operator=(audio_block_pool&&) = delete;
+
+    /** Create a pool of audio blocks.
+     *
+     * @param num_blocks The number of blocks in the pool.
+     * @param num_channels The number of channels of each block.
+     * @param max_num_samples The maximum number of samples for each channel of a block.
+     */
+    audio_block_pool(std::size_t num_blocks, std::size_t num_channels, std::size_t max_num_samples) :
+        _num_channels(num_channels),
+        _max_num_samples(max_num_samples),
+        _channel_size(ceil(max_num_samples * sizeof(float), std::size_t{4096}) / sizeof(float)),
+        _blocks(num_blocks),
+        _next(std::make_unique<std::atomic<uint32_t>[]>(num_blocks)),
+        _channel_pointers(num_blocks * num_channels)
+    {
+        hi_assert(num_blocks != 0 and num_blocks < empty_index);
+        hi_assert(num_channels != 0);
+        hi_assert(max_num_samples != 0);
+
+        // Allocated as a single buffer from locked memory, which is page aligned.
+        _samples.resize(num_blocks * num_channels * _channel_size);
+
+        for (auto i = 0_uz; i != num_blocks; ++i) {
+            for (auto j = 0_uz; j != num_channels; ++j) {
+                _channel_pointers[i * num_channels + j] = _samples.data() + (i * num_channels + j) * _channel_size;
+            }
+
+            _blocks[i] = audio_block{};
+            _blocks[i].samples = _channel_pointers.data() + i * num_channels;
+            _blocks[i].num_channels = num_channels;
+            _blocks[i].num_samples = max_num_samples;
+
+            // Link all blocks into the free list.
+            _next[i].store(i + 1 == num_blocks ? empty_index : narrow_cast<uint32_t>(i + 1), std::memory_order::relaxed);
+        }
+        _head.store(make_head(0, 0), std::memory_order::release);
+    }
+
+    /** The number of blocks in the pool.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _blocks.size();
+    }
+
+    [[nodiscard]] std::size_t num_channels() const noexcept
+    {
+        return _num_channels;
+    }
+
+    /** The maximum number of samples for each channel of a block.
+     */
+    [[nodiscard]] std::size_t max_num_samples() const noexcept
+    {
+        return _max_num_samples;
+    }
+
+    /** Take a block from the pool.
+     *
+     * This function is lock-free and may be called from the audio thread.
+     *
+     * @return A block with `num_channels()` channels and `max_num_samples()` samples,
+     *         or nullptr when all blocks are in use.
+     */
+    [[nodiscard]] audio_block *allocate() noexcept
+    {
+        auto head = _head.load(std::memory_order::acquire);
+        while (true) {
+            auto const index = head_index(head);
+            if (index == empty_index) {
+                return nullptr;
+            }
+
+            // The tag is incremented on each change of the head, so that a block that was taken
+            // and returned by another thread in the meantime will not be mistaken for this head (ABA).
+            auto const next = _next[index].load(std::memory_order::relaxed);
+            if (_head.compare_exchange_weak(
+                    head, make_head(next, head_tag(head) + 1), std::memory_order::acquire, std::memory_order::acquire)) {
+                auto& r = _blocks[index];
+                r.num_channels = _num_channels;
+                r.num_samples = _max_num_samples;
+                r.state = audio_block_state::normal;
+                return &r;
+            }
+        }
+    }
+
+    /** Return a block to the pool.
+     *
+     * This function is lock-free and may be called from the audio thread.
+     *
+     * @param block A block that was returned by `allocate()` of this pool.
+     */
+    void deallocate(audio_block *block) noexcept
+    {
+        hi_assert_not_null(block);
+        hi_assert(block >= _blocks.data() and block < _blocks.data() + _blocks.size());
+        auto const index = narrow_cast<uint32_t>(block - _blocks.data());
+
+        auto head = _head.load(std::memory_order::relaxed);
+        do {
+            _next[index].store(head_index(head), std::memory_order::relaxed);
+        } while (not _head.compare_exchange_weak(
+            head, make_head(index, head_tag(head) + 1), std::memory_order::release, std::memory_order::relaxed));
+    }
+
+private:
+    constexpr static uint32_t empty_index = std::numeric_limits<uint32_t>::max();
+
+    std::size_t _num_channels;
+    std::size_t _max_num_samples;
+
+    /** The number of floats between the start of each channel.
+     */
+    std::size_t _channel_size;
+
+    std::vector<float, locked_memory_allocator<float>> _samples;
+    std::vector<audio_block> _blocks;
+
+    /** The index of the next free block, for each block on the free list.
+     */
+    std::unique_ptr<std::atomic<uint32_t>[]> _next;
+
+    std::vector<float *> _channel_pointers;
+
+    /** The head of the free list.
+     * The low 32 bits are the index of the first free block,
+     * the high 32 bits are a tag that is incremented on each change.
+     */
+    std::atomic<uint64_t> _head = make_head(empty_index, 0);
+
+    [[nodiscard]] constexpr static uint64_t make_head(uint32_t index, uint32_t tag) noexcept
+    {
+        return (uint64_t{tag} << 32) | index;
+    }
+
+    [[nodiscard]] constexpr static uint32_t head_index(uint64_t head) noexcept
+    {
+        return truncate<uint32_t>(head);
+    }
+
+    [[nodiscard]] constexpr static uint32_t head_tag(uint64_t head) noexcept
+    {
+        return truncate<uint32_t>(head >> 32);
+    }
+};
+
+}} // namespace hi::inline v1
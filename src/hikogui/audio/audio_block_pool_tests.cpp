@@ -0,0 +1,76 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_block_pool.hpp"
+#include <hikotest/hikotest.hpp>
+#include <thread>
+#include <vector>
+#include <set>
+#include <cstdint>
+
+TEST_SUITE(audio_block_pool_suite) {
+
+TEST_CASE(allocate_all)
+{
+    auto pool = hi::audio_block_pool(3, 2, 100);
+    REQUIRE(pool.size() == 3);
+    REQUIRE(pool.num_channels() == 2);
+    REQUIRE(pool.max_num_samples() == 100);
+
+    auto blocks = std::vector<hi::audio_block *>{};
+    auto channels = std::set<float *>{};
+    for (auto i = 0; i != 3; ++i) {
+        auto *block = pool.allocate();
+        REQUIRE(block != nullptr);
+        REQUIRE(block->num_channels == 2);
+        REQUIRE(block->num_samples == 100);
+        for (std::size_t j = 0; j != block->num_channels; ++j) {
+            // Sample buffers are page aligned so that vector instructions may over-read and over-write.
+            REQUIRE(reinterpret_cast<uintptr_t>(block->samples[j]) % 4096 == 0);
+            channels.insert(block->samples[j]);
+        }
+        blocks.push_back(block);
+    }
+    REQUIRE(channels.size() == 6);
+
+    // The pool is empty.
+    REQUIRE(pool.allocate() == nullptr);
+
+    pool.deallocate(blocks[1]);
+    REQUIRE(pool.allocate() == blocks[1]);
+    REQUIRE(pool.allocate() == nullptr);
+
+    for (auto *block : blocks) {
+        pool.deallocate(block);
+    }
+}
+
+TEST_CASE(concurrent)
+{
+    auto pool = hi::audio_block_pool(4, 1, 16);
+
+    auto worker = [&pool] {
+        for (auto i = 0; i != 100'000; ++i) {
+            if (auto *block = pool.allocate()) {
+                block->samples[0][0] = static_cast<float>(i);
+                pool.deallocate(block);
+            }
+        }
+    };
+
+    {
+        auto a = std::jthread{worker};
+        auto b = std::jthread{worker};
+        auto c = std::jthread{worker};
+    }
+
+    // All blocks have been returned to the pool.
+    auto blocks = std::set<hi::audio_block *>{};
+    while (auto *block = pool.allocate()) {
+        blocks.insert(block);
+    }
+    REQUIRE(blocks.size() == 4);
+}
+
+};
@@ -9,6 +9,7 @@
 #include "audio_channel.hpp"
 #include "audio_direction.hpp"
 #include "audio_device_state.hpp"
+#include "audio_stream_statistics.hpp"
 #include "speaker_mapping.hpp"
 #include "../numeric/numeric.hpp"
 #include "../l10n/l10n.hpp"
@@ -141,30 +142,49 @@ public:
      */
     [[nodiscard]] virtual std::vector<hi::speaker_mapping> available_output_speaker_mappings() const noexcept = 0;
 
-    /** Start a session. Start a session, which will cause data to be stream to
-     * and from the audio device and the delegate's process_audio() function to
-     * be called.
+    /** Start a stream, which will cause data to be streamed to or from the
+     * audio device and the delegate's process_audio() function to be called.
      *
-     * This function may spawn a thread to handle the audio processing. This
-     * function may throw an exception if it is not possible to start a session.
+     * The stream uses the current exclusive-mode, sample rate and speaker mapping
+     * of the device; a stream that is already running is stopped first.
      *
-     * @param id a unique ID used by the operating system to remember audio
-     *        parameters for this stream, such as volume, across reboots.
-     * @param name A name used to by the operating system to display to the user
-     *        when changing audio parameters through the operating system's
-     *        preferences.
-     * bit-depth. XXX Windows allows for an icon to be passed to a session.
+     * This function may spawn a thread to handle the audio processing.
+     *
+     * @param delegate The delegate to process the audio; must outlive the stream.
+     * @throws io_error When it is not possible to start the stream.
      */
-    // virtual void start_stream(std::string id, std::string name) = 0;
+    virtual void start_stream(audio_device_delegate& delegate) = 0;
 
-    /** Stop a session.
-     * Stop a session, which will also stop the streams of audio.
+    /** Stop a stream.
+     *
+     * After this function returns the delegate's process_audio() function will no longer be called.
      */
-    // virtual void stop_stream() noexcept = 0;
+    virtual void stop_stream() noexcept = 0;
+
+    /** Get the timing statistics of the stream.
+     *
+     * The statistics of the last started stream are kept after the stream is stopped.
+     * This function may be called from any thread.
+     */
+    [[nodiscard]] audio_stream_statistics::snapshot_type statistics() const noexcept
+    {
+        return _statistics.snapshot();
+    }
+
+    /** Reset the counters of the timing statistics.
+     */
+    void reset_statistics() noexcept
+    {
+        _statistics.reset();
+    }
 
 protected:
     std::string _id;
     std::string _name;
+
+    /** The timing statistics, updated by the audio thread of the stream.
+     */
+    audio_stream_statistics _statistics;
 };
 
 }} // namespace hi::inline v1
@@ -1,18 +1,248 @@
+// Copyright Take Vos 2020-2023.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #pragma once
 
 #include "audio_device.hpp"
+#include "asio_driver_win32.hpp"
+#include "audio_stream_asio.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../l10n/l10n.hpp"
+#include "../utility/utility.hpp"
 #include "../macros.hpp"
+#include "../win32_headers.hpp"
+#include <string>
+#include <vector>
+#include <memory>
+#include <format>
+#include <limits>
 
 hi_export_module(hikogui.audio.audio_device_asio);
 
 hi_export namespace hi { inline namespace v1 {
 
-/** A class representing an audio device on the system.
+/** A class representing an ASIO driver on the system.
+ *
+ * An ASIO driver is a single device with both inputs and outputs, which are
+ * streamed together through a single call to `audio_device_delegate::process_audio()`.
+ * ASIO drivers always have exclusive access to the hardware.
+ *
+ * The driver is loaded when a stream is started and unloaded when it is stopped,
+ * since many drivers can only be loaded once, and loading a driver may
+ * take a long time or show a dialogue.
  */
 hi_export class audio_device_asio : public audio_device {
+public:
+    /** Create an audio device for a registered ASIO driver.
+     *
+     * @param driver_info The information of the driver from the registry.
+     */
+    audio_device_asio(asio_driver_info const& driver_info) : audio_device(), _clsid(driver_info.clsid)
+    {
+        _id = std::string{"asio:"} + driver_info.clsid_string;
+        _name = driver_info.description;
+    }
+
+    ~audio_device_asio()
+    {
+        stop_stream();
+    }
+
+    [[nodiscard]] hi::label label() const noexcept override
+    {
+        return {elusive_icon::Headphones, txt("{}", name())};
+    }
+
+    void update_state() noexcept override {}
+
+    [[nodiscard]] audio_device_state state() const noexcept override
+    {
+        return _state;
+    }
+
+    [[nodiscard]] audio_direction direction() const noexcept override
+    {
+        return audio_direction::bidirectional;
+    }
+
+    [[nodiscard]] bool exclusive() const noexcept override
+    {
+        return true;
+    }
+
+    void set_exclusive(bool exclusive) noexcept override
+    {
+        // ASIO drivers are always in exclusive mode.
+    }
+
+    [[nodiscard]] double sample_rate() const noexcept override
+    {
+        return _sample_rate;
+    }
+
+    void set_sample_rate(double sample_rate) noexcept override
+    {
+        _sample_rate = sample_rate;
+    }
+
+    /** Get the input speaker mapping.
+     *
+     * ASIO channels do not have speaker positions; the number of speakers of
+     * the mapping selects the number of input channels of the stream. With
+     * `speaker_mapping::none` all input channels of the driver are streamed.
+     */
+    [[nodiscard]] hi::speaker_mapping input_speaker_mapping() const noexcept override
+    {
+        return _input_speaker_mapping;
+    }
+
+    void set_input_speaker_mapping(hi::speaker_mapping speaker_mapping) noexcept override
+    {
+        _input_speaker_mapping = speaker_mapping;
+    }
+
+    [[nodiscard]] std::vector<hi::speaker_mapping> available_input_speaker_mappings() const noexcept override
+    {
+        return {};
+    }
+
+    /** Get the output speaker mapping.
+     *
+     * @see input_speaker_mapping()
+     */
+    [[nodiscard]] hi::speaker_mapping output_speaker_mapping() const noexcept override
+    {
+        return _output_speaker_mapping;
+    }
+
+    void set_output_speaker_mapping(hi::speaker_mapping speaker_mapping) noexcept override
+    {
+        _output_speaker_mapping = speaker_mapping;
+    }
+
+    [[nodiscard]] std::vector<hi::speaker_mapping> available_output_speaker_mappings() const noexcept override
+    {
+        return {};
+    }
+
+    void start_stream(audio_device_delegate& delegate) override
+    {
+        hi_axiom(loop::main().on_thread());
+
+        stop_stream();
+        load_driver();
+
+        try {
+            _stream = std::make_unique<audio_stream_asio>(
+                _driver,
+                num_channels(_input_speaker_mapping),
+                num_channels(_output_speaker_mapping),
+                _sample_rate,
+                delegate,
+                _statistics,
+                [this] {
+                    loop::main().wfree_post_function([this] {
+                        restart_stream();
+                    });
+                });
+        } catch (...) {
+            unload_driver();
+            throw;
+        }
+
+        _delegate = &delegate;
+        hi_log_info(
+            "Started ASIO stream on '{}' with {} inputs, {} outputs, a buffer of {} frames at {} Hz, zero-copy={}",
+            name(),
+            _stream->num_input_channels(),
+            _stream->num_output_channels(),
+            _stream->buffer_size(),
+            _stream->sample_rate(),
+            _stream->zero_copy());
+    }
+
+    void stop_stream() noexcept override
+    {
+        _stream = nullptr;
+        _delegate = nullptr;
+        unload_driver();
+    }
+
+private:
+    CLSID _clsid;
+    audio_device_state _state = audio_device_state::active;
+    double _sample_rate = 0.0;
+    hi::speaker_mapping _input_speaker_mapping = hi::speaker_mapping::none;
+    hi::speaker_mapping _output_speaker_mapping = hi::speaker_mapping::none;
+
+    IASIO *_driver = nullptr;
+
+    /** The running stream, or nullptr when the device is not streaming.
+     */
+    std::unique_ptr<audio_stream_asio> _stream;
+
+    /** The delegate of the running stream.
+     */
+    audio_device_delegate *_delegate = nullptr;
+
+    [[nodiscard]] static std::size_t num_channels(hi::speaker_mapping speaker_mapping) noexcept
+    {
+        if (speaker_mapping == hi::speaker_mapping::none) {
+            return std::numeric_limits<std::size_t>::max();
+        }
+        return popcount(speaker_mapping);
+    }
+
+    void load_driver()
+    {
+        hi_assert(_driver == nullptr);
+
+        // The interface-id of an ASIO driver is its class-id.
+        if (FAILED(CoCreateInstance(_clsid, NULL, CLSCTX_INPROC_SERVER, _clsid, reinterpret_cast<void **>(&_driver)))) {
+            _driver = nullptr;
+            _state = audio_device_state::not_present;
+            throw io_error(std::format("Could not load ASIO driver '{}': {}", name(), get_last_error_message()));
+        }
+        hi_assert_not_null(_driver);
+
+        if (not _driver->init(GetDesktopWindow())) {
+            char message[128] = {};
+            _driver->getErrorMessage(message);
+            unload_driver();
+            _state = audio_device_state::disabled;
+            throw io_error(std::format("Could not initialize ASIO driver '{}': {}", name(), message));
+        }
+        _state = audio_device_state::active;
+    }
+
+    void unload_driver() noexcept
+    {
+        if (_driver != nullptr) {
+            _driver->Release();
+            _driver = nullptr;
+        }
+    }
+
+    /** Restart the stream after the driver requested a reset.
+     *
+     * For example after the buffer size was changed in the control panel of the driver.
+     */
+    void restart_stream() noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+
+        if (_stream == nullptr or _delegate == nullptr) {
+            return;
+        }
+
+        auto& delegate = *_delegate;
+        try {
+            start_stream(delegate);
+        } catch (std::exception const& e) {
+            hi_log_error("Could not restart ASIO stream on '{}': {}", name(), e.what());
+        }
+    }
 };
 
 }} // namespace hi::inline v1
@@ -13,12 +13,20 @@ hi_export namespace hi { inline namespace v1 {
 
 hi_export class audio_device_delegate {
 public:
-    audio_device_delegate();
-    virtual ~audio_device_delegate() = 0;
+    audio_device_delegate() noexcept = default;
+    virtual ~audio_device_delegate() = default;
 
     /** Process a block of samples.
+     *
+     * This function is called on the real-time audio thread of a device. It must
+     * not allocate memory, take locks or block in any other way.
+     *
+     * @param input The samples captured by an input device, or nullptr for an output device.
+     * @param[out] output The samples to be rendered by an output device, or nullptr for an input device.
+     *             Set `output->state` to `audio_block_state::silent` to render silence without
+     *             writing to the sample buffers.
      */
-    virtual void process_audio() noexcept = 0;
+    virtual void process_audio(audio_block const *input, audio_block *output) noexcept = 0;
 };
 
 }} // namespace hi::inline v1
@@ -7,6 +7,7 @@
 #include "audio_device.hpp"
 #include "audio_stream_format.hpp"
 #include "audio_stream_format_win32.hpp"
+#include "audio_stream_win32.hpp"
 #include "win32_device_interface.hpp"
 #include "win32_wave_device.hpp"
 #include "audio_format_range.hpp"
@@ -15,6 +16,7 @@
 #include "../win32_headers.hpp"
 #include <algorithm>
 #include <vector>
+#include <memory>
 #include <coroutine>
 
 hi_export_module(hikogui.audio.audio_device_win32);
@@ -25,6 +27,25 @@ hi_export namespace hi { inline namespace v1 {
  */
 hi_export class audio_device_win32 : public audio_device {
 public:
+    /** The state of the end-point, queried by `probe()`.
+     */
+    struct probe_type {
+        std::string name;
+        audio_device_state state = audio_device_state::uninitialized;
+
+        /** The formats supported in exclusive mode, only probed for active end-points.
+         */
+        std::vector<audio_format_range> format_ranges = {};
+    };
+
+    /** Open an audio end-point.
+     *
+     * The device is constructed without querying its state, so that it may be
+     * constructed on a background thread. `update_state()` must be called on
+     * the main thread before the device is used.
+     *
+     * @param device The win32 end-point, the audio device takes ownership.
+     */
     audio_device_win32(IMMDevice *device) :
         audio_device(), _previous_state(audio_device_state::uninitialized), _device(device), _audio_client(nullptr)
     {
@@ -49,12 +70,12 @@ public:
         default:
             hi_no_default();
         }
-
-        update_state();
     }
 
     ~audio_device_win32()
     {
+        stop_stream();
+
         _property_store->Release();
         _end_point->Release();
         _device->Release();
@@ -85,25 +106,66 @@ public:
         return device_id_;
     }
 
+    /** Query the state of the end-point.
+     *
+     * This function only reads the end-point and may be called from any
+     * thread, so that the slow queries of the driver are done away from the
+     * main thread.
+     *
+     * @param probe_formats Probe the formats supported by an active end-point.
+     */
+    [[nodiscard]] probe_type probe(bool probe_formats) const noexcept
+    {
+        auto r = probe_type{end_point_name(), state()};
+
+        if (probe_formats and r.state == audio_device_state::active) {
+            // Use a separate audio client, the audio client of the device belongs to the main thread.
+            IAudioClient *audio_client = nullptr;
+            if (SUCCEEDED(_device->Activate(__uuidof(IAudioClient), CLSCTX_ALL, NULL, reinterpret_cast<void **>(&audio_client)))) {
+                r.format_ranges = make_vector(get_format_ranges(audio_client));
+                audio_client->Release();
+            }
+        }
+        return r;
+    }
+
     /// @privatesection
+    /** The state of the end-point as of the last call to `update_state()`.
+     */
+    [[nodiscard]] audio_device_state last_state() const noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+        return _previous_state;
+    }
+
     void update_state() noexcept override
+    {
+        update_state(probe(_previous_state != audio_device_state::active));
+    }
+
+    /** Update the device to the state of the end-point.
+     *
+     * @param probe The state of the end-point, see `probe()`.
+     */
+    void update_state(probe_type const& probe) noexcept
     {
         hi_axiom(loop::main().on_thread());
 
-        _name = end_point_name();
+        _name = probe.name;
 
-        auto new_state = state();
+        auto const new_state = probe.state;
 
         // Log the correct message.
         if (_previous_state == audio_device_state::uninitialized) {
-            hi_log_info(" * Found new audio device '{}' {} ({})", name(), id(), state());
+            hi_log_info(" * Found new audio device '{}' {} ({})", name(), id(), new_state);
 
         } else if (_previous_state != new_state) {
-            hi_log_info(" * Audio device changed state '{}' {} ({})", name(), id(), state());
+            hi_log_info(" * Audio device changed state '{}' {} ({})", name(), id(), new_state);
         }
 
         // Start and stop the audio device depending if it was enabled/disabled for some reason.
         if (_previous_state == audio_device_state::active and new_state != audio_device_state::active) {
+            stop_stream();
             _audio_client->Release();
             _audio_client = nullptr;
 
@@ -113,7 +175,9 @@ public:
                 _audio_client = nullptr;
             }
 
-            update_supported_formats();
+            for (auto const& format_range : probe.format_ranges) {
+                hi_log_info("      * {}", format_range);
+            }
 
             // By setting exclusivity to false at the start the audio stream format is initialized properly.
             set_exclusive(false);
@@ -244,12 +308,57 @@ public:
         return {};
     }
 
+    void start_stream(audio_device_delegate& delegate) override
+    {
+        hi_axiom(loop::main().on_thread());
+
+        stop_stream();
+        if (_current_stream_format.empty()) {
+            throw io_error(std::format("Audio device {} does not have a stream format.", name()));
+        }
+
+        _stream = std::make_unique<audio_stream_win32>(
+            _device, _direction, _current_stream_format, _exclusive, delegate, _statistics);
+        hi_log_info(
+            "Started audio stream on '{}' with a buffer of {} frames, exclusive={}", name(), _stream->buffer_size(), _exclusive);
+    }
+
+    void stop_stream() noexcept override
+    {
+        _stream = nullptr;
+    }
+
     [[nodiscard]] bool supports_format(audio_stream_format const& format) const noexcept
     {
+        return supports_format(_audio_client, format);
+    }
+    /// @endprivatesection
+private:
+    std::string _end_point_id;
+    audio_device_state _previous_state;
+    audio_direction _direction;
+    bool _exclusive = false;
+    double _sample_rate = 0.0;
+    hi::speaker_mapping _speaker_mapping = hi::speaker_mapping::none;
+    audio_stream_format _current_stream_format;
+
+    IMMDevice *_device = nullptr;
+    IMMEndpoint *_end_point = nullptr;
+    IPropertyStore *_property_store = nullptr;
+    IAudioClient *_audio_client = nullptr;
+
+    /** The running stream, or nullptr when the device is not streaming.
+     */
+    std::unique_ptr<audio_stream_win32> _stream;
+
+    [[nodiscard]] static bool supports_format(IAudioClient *audio_client, audio_stream_format const& format) noexcept
+    {
+        hi_assert_not_null(audio_client);
+
         if (not win32_use_extensible(format)) {
             // First try the simple format.
             auto format_ = audio_stream_format_to_win32(format, false);
-            switch (_audio_client->IsFormatSupported(
+            switch (audio_client->IsFormatSupported(
                 AUDCLNT_SHAREMODE_EXCLUSIVE, reinterpret_cast<WAVEFORMATEX const *>(&format_), NULL)) {
             case S_OK:
                 return true;
@@ -264,7 +373,7 @@ public:
         // Always check the extensible format as fallback.
         {
             auto format_ = audio_stream_format_to_win32(format, true);
-            switch (_audio_client->IsFormatSupported(
+            switch (audio_client->IsFormatSupported(
                 AUDCLNT_SHAREMODE_EXCLUSIVE, reinterpret_cast<WAVEFORMATEX const *>(&format_), NULL)) {
             case S_OK:
                 return true;
@@ -278,20 +387,6 @@ public:
 
         return false;
     }
-    /// @endprivatesection
-private:
-    std::string _end_point_id;
-    audio_device_state _previous_state;
-    audio_direction _direction;
-    bool _exclusive = false;
-    double _sample_rate = 0.0;
-    hi::speaker_mapping _speaker_mapping = hi::speaker_mapping::none;
-    audio_stream_format _current_stream_format;
-
-    IMMDevice *_device = nullptr;
-    IMMEndpoint *_end_point = nullptr;
-    IPropertyStore *_property_store = nullptr;
-    IAudioClient *_audio_client = nullptr;
 
     template<typename T>
     [[nodiscard]] static T get_property(IPropertyStore *property_store, REFPROPERTYKEY key)
@@ -475,19 +570,6 @@ private:
         return r;
     }*/
 
-    /** Query the audio device through the driver to determine the supported formats.
-     */
-    void update_supported_formats() noexcept
-    {
-        // https://stackoverflow.com/questions/50396224/how-to-get-audio-formats-supported-by-physical-device-winapi-windows
-        // https://github.com/EddieRingle/portaudio/blob/master/src/os/win/pa_win_wdmks_utils.c
-        // https://docs.microsoft.com/en-us/previous-versions/ff561658(v=vs.85)
-
-        for (auto const& format_range : get_format_ranges()) {
-            hi_log_info("      * {}", format_range);
-        }
-    }
-
     /** Find a stream format based on the prototype_stream_format.
      *
      * This function looks for a supported stream format when the device is used in exclusive-mode.
@@ -521,8 +603,16 @@ private:
         return r;
     }
 
-    [[nodiscard]] generator<audio_format_range> get_format_ranges() const noexcept
+    /** Query the audio device through the driver to determine the supported formats.
+     *
+     * @param audio_client The audio client used to check if a format is supported in exclusive mode.
+     */
+    [[nodiscard]] generator<audio_format_range> get_format_ranges(IAudioClient *audio_client) const noexcept
     {
+        // https://stackoverflow.com/questions/50396224/how-to-get-audio-formats-supported-by-physical-device-winapi-windows
+        // https://github.com/EddieRingle/portaudio/blob/master/src/os/win/pa_win_wdmks_utils.c
+        // https://docs.microsoft.com/en-us/previous-versions/ff561658(v=vs.85)
+
         // try {
         auto wave_device = win32_wave_device::find_matching_end_point(direction(), _end_point_id);
         auto device_interface = wave_device.open_device_interface();
@@ -538,7 +628,7 @@ private:
             auto const format = audio_stream_format{it->format, it->min_sample_rate, it->num_channels};
 
             // Eliminate bit-depths that are not supported.
-            if (not supports_format(format)) {
+            if (not supports_format(audio_client, format)) {
                 last = unordered_remove(first, last, it);
                 continue;
             }
@@ -550,14 +640,14 @@ private:
                 surround_format.speaker_mapping = to_speaker_mapping(mode);
                 surround_format.num_channels = narrow_cast<uint16_t>(popcount(surround_format.speaker_mapping));
 
-                if (surround_format.num_channels <= it->num_channels and supports_format(surround_format)) {
+                if (surround_format.num_channels <= it->num_channels and supports_format(audio_client, surround_format)) {
                     it->surround_mode_mask |= mode;
                 }
             }
 
             auto odd_rate_format = format;
             ++odd_rate_format.sample_rate;
-            if (not supports_format(odd_rate_format)) {
+            if (not supports_format(audio_client, odd_rate_format)) {
                 // The device was lying that it could handle the full range of sample rates.
                 // Look for specific sample rates and create separate format ranges.
                 for (auto sample_rate : common_sample_rates) {
@@ -565,7 +655,7 @@ private:
                     common_rate_format.sample_rate = sample_rate;
 
                     if (it->min_sample_rate <= sample_rate and sample_rate <= it->max_sample_rate and
-                        supports_format(common_rate_format)) {
+                        supports_format(audio_client, common_rate_format)) {
                         tmp.emplace_back(it->format, it->num_channels, sample_rate, sample_rate, it->surround_mode_mask);
                     }
                 }
@@ -0,0 +1,546 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_block.hpp"
+#include "audio_block_pool.hpp"
+#include "audio_device_delegate.hpp"
+#include "audio_graph_node.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../time/time.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <stop_token>
+#include <chrono>
+#include <optional>
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.audio.audio_graph);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A graph of audio processing nodes.
+ *
+ * The graph is the delegate of an audio device. Each time the device needs or
+ * has a buffer of audio, every node of the graph is processed once, after the
+ * nodes connected to its inputs.
+ *
+ * The nodes are processed by the audio thread of the device together with a
+ * pool of worker threads. Each node has a wait-free counter of the number of
+ * inputs that still need to be processed; the node that decrements a counter
+ * to zero pushes the dependent node on a ready queue, from which the threads
+ * take nodes to process. Nodes on the longest path to the end of the graph
+ * are queued first, so that the critical path is started as early as possible.
+ *
+ * A node that finishes after the deadline of the buffer, the duration of the
+ * buffer after the start of the callback, is counted as an overrun of that node.
+ *
+ * The graph is built, and compiled, on the main thread while the graph is not
+ * processing audio. All memory is allocated during compile(); processing does
+ * not allocate or take locks.
+ */
+hi_export class audio_graph : public audio_device_delegate {
+public:
+    constexpr static std::size_t none_id = std::numeric_limits<std::size_t>::max();
+
+    /** The id of the node that produces the input block of the audio device.
+     */
+    constexpr static std::size_t input_id = 0;
+
+    struct node_statistics {
+        /** The number of times processing finished after the deadline of the buffer.
+         */
+        uint64_t num_overruns = 0;
+
+        /** The duration of processing the last buffer.
+         */
+        std::chrono::nanoseconds last_duration = {};
+
+        /** The longest duration of processing a buffer.
+         */
+        std::chrono::nanoseconds max_duration = {};
+    };
+
+    audio_graph(audio_graph const&) = delete;
+    audio_graph(audio_graph&&) = delete;
+    audio_graph& operator=(audio_graph const&) = delete;
+    audio_graph& operator=(audio_graph&&) = delete;
+
+    /** Create an audio graph.
+     *
+     * @param num_input_channels The number of channels of the input of the audio device.
+     * @param max_num_samples The maximum number of samples of a buffer of the audio device.
+     * @param num_threads The number of worker threads in addition to the audio thread of the device.
+     */
+    audio_graph(std::size_t num_input_channels, std::size_t max_num_samples, std::size_t num_threads) :
+        _max_num_samples(max_num_samples)
+    {
+        hi_assert(max_num_samples != 0);
+
+        // The input node is not processed, its output are the samples of the audio device.
+        _nodes.push_back(std::make_unique<node_type>());
+        _nodes.front()->num_channels = num_input_channels;
+
+        // Used when the device does not have an input.
+        if (num_input_channels != 0) {
+            _silent_pool = std::make_unique<audio_block_pool>(1, num_input_channels, max_num_samples);
+            _silent_input = _silent_pool->allocate();
+            for (auto i = 0_uz; i != num_input_channels; ++i) {
+                std::memset(_silent_input->samples[i], 0, max_num_samples * sizeof(float));
+            }
+            _silent_input->state = audio_block_state::silent;
+        }
+
+        for (auto i = 0_uz; i != num_threads; ++i) {
+            _threads.emplace_back([this](std::stop_token stop_token) {
+                run(std::move(stop_token));
+            });
+        }
+    }
+
+    ~audio_graph()
+    {
+        for (auto& thread : _threads) {
+            thread.request_stop();
+        }
+        _cycle.fetch_add(1, std::memory_order::release);
+        _cycle.notify_all();
+        _threads.clear();
+    }
+
+    /** Add a node to the graph.
+     *
+     * @param node The node to add.
+     * @return The id of the node.
+     */
+    std::size_t add_node(std::unique_ptr<audio_graph_node> node)
+    {
+        hi_assert_not_null(node);
+
+        _compiled = false;
+        auto& n = *_nodes.emplace_back(std::make_unique<node_type>());
+        n.num_channels = node->num_channels();
+        n.node = std::move(node);
+        return _nodes.size() - 1;
+    }
+
+    /** Connect the output of a node to the input of another node.
+     *
+     * @param source The id of the node to read the output from.
+     * @param destination The id of the node to add an input to.
+     */
+    void connect(std::size_t source, std::size_t destination)
+    {
+        hi_assert_bounds(source, _nodes);
+        hi_assert_bounds(destination, _nodes);
+        hi_assert(destination != input_id);
+
+        _compiled = false;
+        _nodes[destination]->inputs.push_back(source);
+    }
+
+    /** Select the node that writes the output of the audio device.
+     *
+     * The node is passed the output block of the device, instead of its own block.
+     * Its output should not be connected to other nodes.
+     *
+     * @param id The id of the output node, or `none_id` to output silence.
+     */
+    void set_output(std::size_t id)
+    {
+        hi_assert(id == none_id or (id != input_id and id < _nodes.size()));
+
+        _compiled = false;
+        _output_id = id;
+    }
+
+    /** Prepare the graph for processing.
+     *
+     * @throws operation_error When the graph contains a cycle.
+     */
+    void compile()
+    {
+        _compiled = false;
+
+        auto const num_nodes = _nodes.size();
+        for (auto& node : _nodes) {
+            node->successors.clear();
+            node->num_dependencies = 0;
+            node->priority = 0;
+            node->input_blocks.assign(node->inputs.size(), nullptr);
+
+            if (node->node and not node->pool and node->num_channels != 0) {
+                node->pool = std::make_unique<audio_block_pool>(1, node->num_channels, _max_num_samples);
+                node->own_block = node->pool->allocate();
+            }
+        }
+
+        for (auto id = 0_uz; id != num_nodes; ++id) {
+            for (auto const source : _nodes[id]->inputs) {
+                _nodes[source]->successors.push_back(id);
+                if (source != input_id) {
+                    ++_nodes[id]->num_dependencies;
+                }
+            }
+        }
+
+        // Kahn's algorithm; the input node is not processed and is excluded.
+        auto order = std::vector<std::size_t>{};
+        auto num_pending = std::vector<std::size_t>(num_nodes);
+        for (auto id = 1_uz; id != num_nodes; ++id) {
+            num_pending[id] = _nodes[id]->num_dependencies;
+            if (num_pending[id] == 0) {
+                order.push_back(id);
+            }
+        }
+        for (auto i = 0_uz; i != order.size(); ++i) {
+            for (auto const successor : _nodes[order[i]]->successors) {
+                if (--num_pending[successor] == 0) {
+                    order.push_back(successor);
+                }
+            }
+        }
+        if (order.size() != num_nodes - 1) {
+            throw operation_error("The audio graph contains a cycle.");
+        }
+
+        // The priority is the number of nodes on the longest path to the end of the graph.
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            auto& node = *_nodes[*it];
+            for (auto const successor : node.successors) {
+                node.priority = std::max(node.priority, _nodes[successor]->priority);
+            }
+            ++node.priority;
+        }
+
+        for (auto& node : _nodes) {
+            std::ranges::stable_sort(node->successors, [this](auto a, auto b) {
+                return _nodes[a]->priority > _nodes[b]->priority;
+            });
+        }
+
+        _sources.clear();
+        for (auto const id : order) {
+            if (_nodes[id]->num_dependencies == 0) {
+                _sources.push_back(id);
+            }
+        }
+        std::ranges::stable_sort(_sources, [this](auto a, auto b) {
+            return _nodes[a]->priority > _nodes[b]->priority;
+        });
+
+        _num_to_run = narrow_cast<uint32_t>(num_nodes - 1);
+        _ready = std::make_unique<std::atomic<uint32_t>[]>(num_nodes);
+        for (auto i = 0_uz; i != num_nodes; ++i) {
+            _ready[i].store(empty_id, std::memory_order::relaxed);
+        }
+
+        // Threads that wake up spuriously find that all nodes have been taken.
+        _ready_head.store(make_head(0, _num_to_run), std::memory_order::relaxed);
+        _ready_tail.store(_num_to_run, std::memory_order::relaxed);
+        _num_done.store(_num_to_run, std::memory_order::release);
+
+        _compiled = true;
+    }
+
+    /** Get the timing statistics of a node.
+     *
+     * This function may be called from any thread.
+     */
+    [[nodiscard]] node_statistics statistics(std::size_t id) const noexcept
+    {
+        hi_assert_bounds(id, _nodes);
+        auto const& node = *_nodes[id];
+
+        auto r = node_statistics{};
+        r.num_overruns = node.num_overruns.load(std::memory_order::relaxed);
+        r.last_duration = time_stamp_count::duration_from_count(node.last_duration.load(std::memory_order::relaxed));
+        r.max_duration = time_stamp_count::duration_from_count(node.max_duration.load(std::memory_order::relaxed));
+        return r;
+    }
+
+    /** The id of the node that most recently overran the deadline.
+     *
+     * This function may be called from any thread.
+     */
+    [[nodiscard]] std::optional<std::size_t> last_overrun() const noexcept
+    {
+        auto const id = _last_overrun.load(std::memory_order::relaxed);
+        if (id == none_id) {
+            return std::nullopt;
+        }
+        return id;
+    }
+
+    void process_audio(audio_block const *input, audio_block *output) noexcept override
+    {
+        auto const start = time_stamp_count::now();
+
+        auto const *reference = output != nullptr ? output : input;
+        if (not _compiled or reference == nullptr or reference->num_samples > _max_num_samples) {
+            ++global_counter<"audio:graph_skipped">;
+            if (output != nullptr) {
+                output->state = audio_block_state::silent;
+            }
+            return;
+        }
+
+        for (auto& node : _nodes) {
+            node->block = node->own_block;
+        }
+
+        // The successors of the input node only see the input block as const.
+        _nodes.front()->block = input != nullptr ? const_cast<audio_block *>(input) : _silent_input;
+        if (_output_id != none_id and output != nullptr) {
+            _nodes[_output_id]->block = output;
+        } else if (output != nullptr) {
+            output->state = audio_block_state::silent;
+        }
+
+        _num_samples = reference->num_samples;
+        _sample_rate = reference->sample_rate;
+        _sample_count = reference->sample_count;
+        _time_stamp = reference->time_stamp;
+        _cycle_start = start.count();
+        _deadline = std::chrono::nanoseconds{
+            narrow_cast<int64_t>(_num_samples * 1'000'000'000ULL / narrow_cast<uint64_t>(std::max(_sample_rate, 1)))};
+
+        // All nodes of the previous cycle are done, and no thread will take a node until it is pushed.
+        for (auto i = 0_uz; i != _num_to_run; ++i) {
+            _ready[i].store(empty_id, std::memory_order::relaxed);
+        }
+        for (auto i = 1_uz; i != _nodes.size(); ++i) {
+            _nodes[i]->num_pending.store(narrow_cast<uint32_t>(_nodes[i]->num_dependencies), std::memory_order::relaxed);
+        }
+        _num_done.store(0, std::memory_order::relaxed);
+        _ready_tail.store(0, std::memory_order::relaxed);
+        _ready_head.store(make_head(++_head_tag, 0), std::memory_order::release);
+
+        for (auto const id : _sources) {
+            push(id);
+        }
+
+        _cycle.fetch_add(1, std::memory_order::release);
+        _cycle.notify_all();
+
+        // The audio thread processes nodes as well, then waits for the other threads to finish.
+        work();
+        while (_num_done.load(std::memory_order::acquire) != _num_to_run) {
+            std::this_thread::yield();
+        }
+
+    }
+
+private:
+    constexpr static uint32_t empty_id = std::numeric_limits<uint32_t>::max();
+
+    struct node_type {
+        std::unique_ptr<audio_graph_node> node;
+        std::size_t num_channels = 0;
+
+        /** The ids of the nodes connected to the inputs.
+         */
+        std::vector<std::size_t> inputs;
+
+        /** The ids of the nodes that have this node as input, with the highest priority first.
+         */
+        std::vector<std::size_t> successors;
+
+        /** The number of inputs that are processed by the graph; excluding the input node.
+         */
+        std::size_t num_dependencies = 0;
+
+        /** The number of nodes on the longest path from this node to the end of the graph.
+         */
+        std::size_t priority = 0;
+
+        /** The output blocks of the inputs, passed to the node.
+         */
+        std::vector<audio_block const *> input_blocks;
+
+        std::unique_ptr<audio_block_pool> pool;
+
+        /** The block that the node writes into, from the pool.
+         */
+        audio_block *own_block = nullptr;
+
+        /** The block that the node writes into during the current cycle.
+         *
+         * This is the own block, except for the input and output node.
+         */
+        audio_block *block = nullptr;
+
+        /** The number of inputs that still need to be processed in the current cycle.
+         */
+        std::atomic<uint32_t> num_pending = 0;
+
+        std::atomic<uint64_t> num_overruns = 0;
+
+        /** Durations in `time_stamp_count` ticks.
+         */
+        std::atomic<uint64_t> last_duration = 0;
+        std::atomic<uint64_t> max_duration = 0;
+    };
+
+    std::size_t _max_num_samples;
+    std::vector<std::unique_ptr<node_type>> _nodes;
+    std::size_t _output_id = none_id;
+    bool _compiled = false;
+
+    std::unique_ptr<audio_block_pool> _silent_pool;
+    audio_block *_silent_input = nullptr;
+
+    /** The nodes without dependencies, with the highest priority first.
+     */
+    std::vector<std::size_t> _sources;
+
+    /** The number of nodes processed each cycle.
+     */
+    uint32_t _num_to_run = 0;
+
+    /** The queue of nodes that are ready to be processed.
+     *
+     * Each node is pushed once per cycle, so the queue does not wrap around.
+     */
+    std::unique_ptr<std::atomic<uint32_t>[]> _ready;
+
+    /** The index of the next node to take from the ready queue.
+     *
+     * The upper 32 bits are a tag that is changed each cycle, so that a thread that
+     * was preempted during the previous cycle will not take a node from a stale index.
+     */
+    std::atomic<uint64_t> _ready_head = 0;
+    uint32_t _head_tag = 0;
+    std::atomic<uint32_t> _ready_tail = 0;
+    std::atomic<uint32_t> _num_done = 0;
+
+    /** Incremented at the start of each cycle to wake up the worker threads.
+     */
+    std::atomic<uint64_t> _cycle = 0;
+
+    std::atomic<std::size_t> _last_overrun = none_id;
+
+    /** The parameters of the current cycle.
+     */
+    std::size_t _num_samples = 0;
+    int _sample_rate = 0;
+    int64_t _sample_count = 0;
+    utc_nanoseconds _time_stamp = {};
+    uint64_t _cycle_start = 0;
+    std::chrono::nanoseconds _deadline = {};
+
+    std::vector<std::jthread> _threads;
+
+    void run(std::stop_token stop_token) noexcept
+    {
+        set_thread_name("audio graph");
+        if (not set_thread_audio_priority()) {
+            hi_log_warning("Could not give the audio graph thread real-time priority.");
+        }
+        try {
+            // The deadline of the audio graph can not be met on the efficiency cores of a hybrid CPU.
+            set_thread_core_class(cpu_core_class::performance);
+        } catch (std::exception const& e) {
+            hi_log_warning("Could not run the audio graph thread on the performance cores: {}", e.what());
+        }
+
+        auto cycle = _cycle.load(std::memory_order::acquire);
+        while (not stop_token.stop_requested()) {
+            _cycle.wait(cycle, std::memory_order::acquire);
+            cycle = _cycle.load(std::memory_order::acquire);
+            if (stop_token.stop_requested()) {
+                break;
+            }
+            work();
+        }
+    }
+
+    [[nodiscard]] constexpr static uint64_t make_head(uint32_t tag, uint32_t index) noexcept
+    {
+        return (uint64_t{tag} << 32) | index;
+    }
+
+    [[nodiscard]] constexpr static uint32_t head_index(uint64_t head) noexcept
+    {
+        return truncate<uint32_t>(head);
+    }
+
+    void push(std::size_t id) noexcept
+    {
+        auto const index = _ready_tail.fetch_add(1, std::memory_order::relaxed);
+        hi_axiom(index < _num_to_run);
+        _ready[index].store(narrow_cast<uint32_t>(id), std::memory_order::release);
+    }
+
+    /** Process nodes from the ready queue, until all the nodes of the cycle have been taken.
+     */
+    void work() noexcept
+    {
+        auto head = _ready_head.load(std::memory_order::acquire);
+        while (head_index(head) < _num_to_run) {
+            auto const id = _ready[head_index(head)].load(std::memory_order::acquire);
+            if (id == empty_id) {
+                // The node at the head of the queue is not ready yet.
+                std::this_thread::yield();
+                head = _ready_head.load(std::memory_order::acquire);
+
+            } else if (_ready_head.compare_exchange_weak(head, head + 1, std::memory_order::acq_rel)) {
+                process_node(id);
+                head = _ready_head.load(std::memory_order::acquire);
+            }
+        }
+    }
+
+    void process_node(std::size_t id) noexcept
+    {
+        auto& node = *_nodes[id];
+
+        for (auto i = 0_uz; i != node.inputs.size(); ++i) {
+            node.input_blocks[i] = _nodes[node.inputs[i]]->block;
+        }
+
+        if (auto *block = node.block) {
+            block->num_samples = _num_samples;
+            block->sample_rate = _sample_rate;
+            block->sample_count = _sample_count;
+            block->time_stamp = _time_stamp;
+            block->state = audio_block_state::normal;
+
+            auto const start = time_stamp_count::now().count();
+            node.node->process(node.input_blocks, *block);
+            auto const end = time_stamp_count::now().count();
+
+            auto const duration = end - start;
+            node.last_duration.store(duration, std::memory_order::relaxed);
+            fetch_max(node.max_duration, duration, std::memory_order::relaxed);
+
+            if (time_stamp_count::duration_from_count(end - _cycle_start) > _deadline) {
+                ++global_counter<"audio:graph_overrun">;
+                node.num_overruns.fetch_add(1, std::memory_order::relaxed);
+                _last_overrun.store(id, std::memory_order::relaxed);
+            }
+        }
+
+        for (auto const successor : node.successors) {
+            if (_nodes[successor]->num_pending.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+                push(successor);
+            }
+        }
+
+        _num_done.fetch_add(1, std::memory_order::release);
+    }
+};
+
+}} // namespace hi::inline v1
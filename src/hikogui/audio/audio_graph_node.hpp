@@ -0,0 +1,70 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_block.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <span>
+#include <cstddef>
+
+hi_export_module(hikogui.audio.audio_graph_node);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A node of an `audio_graph`.
+ *
+ * A node processes the blocks of the nodes that are connected to its inputs
+ * into a single output block. Nodes that do not depend on each other are
+ * processed in parallel by the threads of the graph.
+ */
+hi_export class audio_graph_node {
+public:
+    virtual ~audio_graph_node() = default;
+    audio_graph_node(audio_graph_node const&) = delete;
+    audio_graph_node(audio_graph_node&&) = delete;
+    audio_graph_node& operator=(audio_graph_node const&) = delete;
+    audio_graph_node& operator=(audio_graph_node&&) = delete;
+
+    /** Create a node.
+     *
+     * @param name The name of the node, used when reporting overruns.
+     * @param num_channels The number of channels of the output block of the node.
+     */
+    audio_graph_node(std::string name, std::size_t num_channels) noexcept : _name(std::move(name)), _num_channels(num_channels) {}
+
+    [[nodiscard]] std::string const& name() const noexcept
+    {
+        return _name;
+    }
+
+    /** The number of channels of the output block.
+     */
+    [[nodiscard]] std::size_t num_channels() const noexcept
+    {
+        return _num_channels;
+    }
+
+    /** Process a block of audio.
+     *
+     * This function is called from one of the real-time threads of the graph,
+     * and must not allocate memory, take locks or otherwise block.
+     *
+     * The output block is prepared with the number of samples, sample count and
+     * time stamp of the current buffer and with its state set to normal. For the
+     * output node of the graph it is the output block of the audio device.
+     *
+     * @param inputs The output blocks of the nodes connected to the inputs, in order of connection.
+     * @param output The block to write the result into.
+     */
+    virtual void process(std::span<audio_block const *const> inputs, audio_block& output) noexcept = 0;
+
+private:
+    std::string _name;
+    std::size_t _num_channels;
+};
+
+}} // namespace hi::inline v1
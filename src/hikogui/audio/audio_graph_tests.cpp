@@ -0,0 +1,167 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_graph.hpp"
+#include <hikotest/hikotest.hpp>
+#include <memory>
+#include <thread>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/** Output a constant value on each channel.
+ */
+class constant_node : public hi::audio_graph_node {
+public:
+    constant_node(std::size_t num_channels, float value) : audio_graph_node("constant", num_channels), _value(value) {}
+
+    void process(std::span<hi::audio_block const *const> inputs, hi::audio_block& output) noexcept override
+    {
+        for (auto i = std::size_t{0}; i != output.num_channels; ++i) {
+            std::fill_n(output.samples[i], output.num_samples, _value);
+        }
+    }
+
+private:
+    float _value;
+};
+
+/** Add the inputs together and multiply by a gain.
+ */
+class sum_node : public hi::audio_graph_node {
+public:
+    sum_node(std::size_t num_channels, float gain = 1.0f) : audio_graph_node("sum", num_channels), _gain(gain) {}
+
+    void process(std::span<hi::audio_block const *const> inputs, hi::audio_block& output) noexcept override
+    {
+        for (auto i = std::size_t{0}; i != output.num_channels; ++i) {
+            for (auto j = std::size_t{0}; j != output.num_samples; ++j) {
+                auto sum = 0.0f;
+                for (auto const *input : inputs) {
+                    sum += input->samples[i][j];
+                }
+                output.samples[i][j] = sum * _gain;
+            }
+        }
+    }
+
+private:
+    float _gain;
+};
+
+/** Take longer than the period of the buffer.
+ */
+class slow_node : public sum_node {
+public:
+    using sum_node::sum_node;
+
+    void process(std::span<hi::audio_block const *const> inputs, hi::audio_block& output) noexcept override
+    {
+        std::this_thread::sleep_for(5ms);
+        sum_node::process(inputs, output);
+    }
+};
+
+[[nodiscard]] hi::audio_block *make_block(hi::audio_block_pool& pool, float value)
+{
+    auto *r = pool.allocate();
+    r->num_samples = 48;
+    r->sample_rate = 48000;
+    r->sample_count = 0;
+    for (auto i = std::size_t{0}; i != r->num_channels; ++i) {
+        std::fill_n(r->samples[i], r->num_samples, value);
+    }
+    return r;
+}
+
+} // namespace
+
+TEST_SUITE(audio_graph_suite) {
+
+TEST_CASE(chain)
+{
+    auto pool = hi::audio_block_pool{2, 2, 64};
+    auto *input = make_block(pool, 0.25f);
+    auto *output = make_block(pool, 0.0f);
+
+    auto graph = hi::audio_graph{2, 64, 0};
+    auto const gain = graph.add_node(std::make_unique<sum_node>(2, 2.0f));
+    auto const out = graph.add_node(std::make_unique<sum_node>(2, 0.5f));
+    graph.connect(hi::audio_graph::input_id, gain);
+    graph.connect(gain, out);
+    graph.connect(hi::audio_graph::input_id, out);
+    graph.set_output(out);
+    graph.compile();
+
+    graph.process_audio(input, output);
+    REQUIRE(output->state == hi::audio_block_state::normal);
+    REQUIRE(output->samples[0][0] == 0.375f);
+    REQUIRE(output->samples[1][47] == 0.375f);
+}
+
+TEST_CASE(parallel)
+{
+    auto pool = hi::audio_block_pool{1, 4, 64};
+    auto *output = make_block(pool, 0.0f);
+
+    // A mix of 16 sources in two groups, processed by three threads.
+    auto graph = hi::audio_graph{0, 64, 2};
+    auto const mix = graph.add_node(std::make_unique<sum_node>(4));
+    auto const group_a = graph.add_node(std::make_unique<sum_node>(4));
+    auto const group_b = graph.add_node(std::make_unique<sum_node>(4));
+    graph.connect(group_a, mix);
+    graph.connect(group_b, mix);
+
+    auto expected = 0.0f;
+    for (auto i = 0; i != 16; ++i) {
+        auto const value = static_cast<float>(i + 1);
+        auto const source = graph.add_node(std::make_unique<constant_node>(4, value));
+        graph.connect(source, i % 2 == 0 ? group_a : group_b);
+        expected += value;
+    }
+    graph.set_output(mix);
+    graph.compile();
+
+    for (auto cycle = 0; cycle != 1000; ++cycle) {
+        output->samples[3][10] = 0.0f;
+        graph.process_audio(nullptr, output);
+        REQUIRE(output->samples[3][10] == expected);
+    }
+}
+
+TEST_CASE(cycle)
+{
+    auto graph = hi::audio_graph{0, 64, 0};
+    auto const a = graph.add_node(std::make_unique<sum_node>(1));
+    auto const b = graph.add_node(std::make_unique<sum_node>(1));
+    graph.connect(a, b);
+    graph.connect(b, a);
+    REQUIRE_THROWS(graph.compile(), hi::operation_error);
+}
+
+TEST_CASE(overrun)
+{
+    auto pool = hi::audio_block_pool{1, 1, 64};
+    auto *output = make_block(pool, 0.0f);
+
+    auto graph = hi::audio_graph{0, 64, 1};
+    auto const source = graph.add_node(std::make_unique<constant_node>(1, 1.0f));
+    auto const slow = graph.add_node(std::make_unique<slow_node>(1));
+    graph.connect(source, slow);
+    graph.set_output(slow);
+    graph.compile();
+    REQUIRE(not graph.last_overrun());
+
+    // 48 samples at 48 kHz is a deadline of 1 ms.
+    graph.process_audio(nullptr, output);
+    REQUIRE(output->samples[0][0] == 1.0f);
+    REQUIRE(graph.statistics(source).num_overruns == 0);
+    REQUIRE(graph.statistics(slow).num_overruns == 1);
+    REQUIRE(graph.statistics(slow).max_duration >= 5ms);
+    REQUIRE(graph.last_overrun() == slow);
+}
+
+};
@@ -0,0 +1,349 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_block.hpp"
+#include "../memory/memory.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <atomic>
+#include <vector>
+#include <span>
+#include <new>
+#include <bit>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+
+hi_export_module(hikogui.audio.audio_ring_buffer);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A wait-free single-producer/single-consumer ring buffer of audio samples.
+ *
+ * The ring buffer moves non-interleaved floating point samples between the audio
+ * thread of a device and other threads, such as the GUI for metering or a thread
+ * which writes a recording to disk. Both the producer and the consumer are
+ * wait-free; neither side allocates memory or takes a lock.
+ *
+ * When the producer writes more frames than there is room for, the frames that
+ * do not fit are dropped and "audio_ring_buffer:overflow" is incremented. When
+ * the consumer reads more frames than are available "audio_ring_buffer:underflow"
+ * is incremented.
+ *
+ * @note `write()` and `write_available()` may only be called from the producer thread,
+ *       `read()` and `read_available()` may only be called from the consumer thread.
+ */
+class audio_ring_buffer {
+public:
+    audio_ring_buffer(audio_ring_buffer const&) = delete;
+    audio_ring_buffer(audio_ring_buffer&&) = delete;
+    audio_ring_buffer& operator=(audio_ring_buffer const&) = delete;
+    audio_ring_buffer& operator=(audio_ring_buffer&&) = delete;
+
+    /** Create a ring buffer.
+     *
+     * @param num_channels The number of channels.
+     * @param capacity The minimum number of frames that can be stored, rounded up to a power of two.
+     */
+    audio_ring_buffer(std::size_t num_channels, std::size_t capacity) :
+        _num_channels(num_channels), _capacity(std::bit_ceil(capacity)), _mask(_capacity - 1)
+    {
+        hi_assert(num_channels != 0);
+        hi_assert(capacity != 0);
+
+        // The buffer is locked in memory so that the audio thread will not page-fault.
+        _samples.resize(_num_channels * _capacity);
+    }
+
+    [[nodiscard]] std::size_t num_channels() const noexcept
+    {
+        return _num_channels;
+    }
+
+    /** The maximum number of frames that can be stored in the ring buffer.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    /** The number of frames that can be written.
+     *
+     * @note Must be called from the producer thread.
+     */
+    [[nodiscard]] std::size_t write_available() const noexcept
+    {
+        auto const head = _head.load(std::memory_order::relaxed);
+        auto const tail = _tail.load(std::memory_order::acquire);
+        return _capacity - (head - tail);
+    }
+
+    /** The number of frames that can be read.
+     *
+     * @note Must be called from the consumer thread.
+     */
+    [[nodiscard]] std::size_t read_available() const noexcept
+    {
+        auto const tail = _tail.load(std::memory_order::relaxed);
+        auto const head = _head.load(std::memory_order::acquire);
+        return head - tail;
+    }
+
+    /** Write frames into the ring buffer.
+     *
+     * @note Must be called from the producer thread.
+     * @param channels A pointer to the samples of each channel, the number of channels must match.
+     * @param num_frames The number of frames to write.
+     * @return The number of frames written, less than @a num_frames when the ring buffer overflowed.
+     */
+    std::size_t write(std::span<float const *const> channels, std::size_t num_frames) noexcept
+    {
+        hi_axiom(channels.size() == _num_channels);
+
+        auto const head = _head.load(std::memory_order::relaxed);
+        if (_capacity - (head - _cached_tail) < num_frames) {
+            _cached_tail = _tail.load(std::memory_order::acquire);
+        }
+
+        auto const num_written = std::min(num_frames, _capacity - (head - _cached_tail));
+        if (num_written != num_frames) {
+            ++global_counter<"audio_ring_buffer:overflow">;
+        }
+
+        for (auto i = 0_uz; i != _num_channels; ++i) {
+            copy_to_ring(channels[i], i, head, num_written);
+        }
+
+        _head.store(head + num_written, std::memory_order::release);
+        return num_written;
+    }
+
+    /** Write frames into the ring buffer.
+     *
+     * @note Must be called from the producer thread.
+     * @param channels The samples of each channel, all channels must have the same number of samples.
+     * @return The number of frames written, less than the size of the channels when the ring buffer overflowed.
+     */
+    std::size_t write(std::span<std::span<float const> const> channels) noexcept
+    {
+        hi_axiom(channels.size() == _num_channels);
+
+        auto const head = _head.load(std::memory_order::relaxed);
+        auto const num_frames = channels.front().size();
+        if (_capacity - (head - _cached_tail) < num_frames) {
+            _cached_tail = _tail.load(std::memory_order::acquire);
+        }
+
+        auto const num_written = std::min(num_frames, _capacity - (head - _cached_tail));
+        if (num_written != num_frames) {
+            ++global_counter<"audio_ring_buffer:overflow">;
+        }
+
+        for (auto i = 0_uz; i != _num_channels; ++i) {
+            hi_axiom(channels[i].size() == num_frames);
+            copy_to_ring(channels[i].data(), i, head, num_written);
+        }
+
+        _head.store(head + num_written, std::memory_order::release);
+        return num_written;
+    }
+
+    /** Write silence into the ring buffer.
+     *
+     * @note Must be called from the producer thread.
+     * @param num_frames The number of frames of silence to write.
+     * @return The number of frames written, less than @a num_frames when the ring buffer overflowed.
+     */
+    std::size_t write_silence(std::size_t num_frames) noexcept
+    {
+        auto const head = _head.load(std::memory_order::relaxed);
+        if (_capacity - (head - _cached_tail) < num_frames) {
+            _cached_tail = _tail.load(std::memory_order::acquire);
+        }
+
+        auto const num_written = std::min(num_frames, _capacity - (head - _cached_tail));
+        if (num_written != num_frames) {
+            ++global_counter<"audio_ring_buffer:overflow">;
+        }
+
+        for (auto i = 0_uz; i != _num_channels; ++i) {
+            copy_to_ring(nullptr, i, head, num_written);
+        }
+
+        _head.store(head + num_written, std::memory_order::release);
+        return num_written;
+    }
+
+    /** Write the samples of an audio block into the ring buffer.
+     *
+     * A corrupt block is written as silence, so that the consumer stays
+     * aligned with the time-line of the producer.
+     *
+     * @note Must be called from the producer thread.
+     * @param block The block to write, the number of channels must match.
+     * @return The number of frames written.
+     */
+    std::size_t write(audio_block const& block) noexcept
+    {
+        hi_axiom(block.num_channels == _num_channels);
+
+        if (block.state == audio_block_state::corrupt) {
+            return write_silence(block.num_samples);
+        }
+        return write(std::span<float const *const>{block.samples, block.num_channels}, block.num_samples);
+    }
+
+    /** Read frames from the ring buffer.
+     *
+     * @note Must be called from the consumer thread.
+     * @param channels A pointer to the sample buffer of each channel, the number of channels must match.
+     * @param num_frames The number of frames to read.
+     * @return The number of frames read, less than @a num_frames when the ring buffer underflowed.
+     */
+    std::size_t read(std::span<float *const> channels, std::size_t num_frames) noexcept
+    {
+        hi_axiom(channels.size() == _num_channels);
+
+        auto const tail = _tail.load(std::memory_order::relaxed);
+        if (_cached_head - tail < num_frames) {
+            _cached_head = _head.load(std::memory_order::acquire);
+        }
+
+        auto const num_read = std::min(num_frames, _cached_head - tail);
+        if (num_read != num_frames) {
+            ++global_counter<"audio_ring_buffer:underflow">;
+        }
+
+        for (auto i = 0_uz; i != _num_channels; ++i) {
+            copy_from_ring(channels[i], i, tail, num_read);
+        }
+
+        _tail.store(tail + num_read, std::memory_order::release);
+        return num_read;
+    }
+
+    /** Read frames from the ring buffer.
+     *
+     * @note Must be called from the consumer thread.
+     * @param channels The sample buffers of each channel, all channels must have the same number of samples.
+     * @return The number of frames read, less than the size of the channels when the ring buffer underflowed.
+     */
+    std::size_t read(std::span<std::span<float> const> channels) noexcept
+    {
+        hi_axiom(channels.size() == _num_channels);
+
+        auto const tail = _tail.load(std::memory_order::relaxed);
+        auto const num_frames = channels.front().size();
+        if (_cached_head - tail < num_frames) {
+            _cached_head = _head.load(std::memory_order::acquire);
+        }
+
+        auto const num_read = std::min(num_frames, _cached_head - tail);
+        if (num_read != num_frames) {
+            ++global_counter<"audio_ring_buffer:underflow">;
+        }
+
+        for (auto i = 0_uz; i != _num_channels; ++i) {
+            hi_axiom(channels[i].size() == num_frames);
+            copy_from_ring(channels[i].data(), i, tail, num_read);
+        }
+
+        _tail.store(tail + num_read, std::memory_order::release);
+        return num_read;
+    }
+
+    /** Read frames from the ring buffer into an audio block.
+     *
+     * When not enough frames are available the rest of the block is filled with zeros.
+     *
+     * @note Must be called from the consumer thread.
+     * @param[out] block The block to fill, the number of channels must match.
+     * @return The number of frames read.
+     */
+    std::size_t read(audio_block& block) noexcept
+    {
+        hi_axiom(block.num_channels == _num_channels);
+
+        auto const num_read = read(std::span<float *const>{block.samples, block.num_channels}, block.num_samples);
+        for (auto i = 0_uz; i != block.num_channels; ++i) {
+            std::fill(block.samples[i] + num_read, block.samples[i] + block.num_samples, 0.0f);
+        }
+        block.state = num_read == 0 ? audio_block_state::silent : audio_block_state::normal;
+        return num_read;
+    }
+
+private:
+#if defined(__cpp_lib_hardware_interference_size)
+    constexpr static size_t destructive_interference_size = std::hardware_destructive_interference_size;
+#else
+    constexpr static size_t destructive_interference_size = 128;
+#endif
+
+    std::size_t _num_channels;
+    std::size_t _capacity;
+    std::size_t _mask;
+
+    /** The samples of each channel, channel after channel.
+     */
+    std::vector<float, locked_memory_allocator<float>> _samples;
+
+    /** The index of the next frame to write, owned by the producer.
+     */
+    alignas(destructive_interference_size) std::atomic<std::size_t> _head = 0;
+
+    /** The last known value of the _tail, owned by the producer.
+     */
+    std::size_t _cached_tail = 0;
+
+    /** The index of the next frame to read, owned by the consumer.
+     */
+    alignas(destructive_interference_size) std::atomic<std::size_t> _tail = 0;
+
+    /** The last known value of the _head, owned by the consumer.
+     */
+    std::size_t _cached_head = 0;
+
+    /** Copy samples of a channel into the ring.
+     *
+     * @param src The samples to copy, or nullptr to copy silence.
+     */
+    void copy_to_ring(float const *src, std::size_t channel, std::size_t index, std::size_t num_frames) noexcept
+    {
+        hi_axiom(num_frames <= _capacity);
+        if (num_frames == 0) {
+            return;
+        }
+
+        auto *const dst = _samples.data() + channel * _capacity;
+        auto const offset = index & _mask;
+        auto const first_size = std::min(num_frames, _capacity - offset);
+        if (src == nullptr) {
+            std::fill_n(dst + offset, first_size, 0.0f);
+            std::fill_n(dst, num_frames - first_size, 0.0f);
+        } else {
+            std::memcpy(dst + offset, src, first_size * sizeof(float));
+            std::memcpy(dst, src + first_size, (num_frames - first_size) * sizeof(float));
+        }
+    }
+
+    void copy_from_ring(float *dst, std::size_t channel, std::size_t index, std::size_t num_frames) const noexcept
+    {
+        hi_axiom(num_frames <= _capacity);
+        if (num_frames == 0) {
+            return;
+        }
+        hi_axiom_not_null(dst);
+
+        auto const *const src = _samples.data() + channel * _capacity;
+        auto const offset = index & _mask;
+        auto const first_size = std::min(num_frames, _capacity - offset);
+        std::memcpy(dst, src + offset, first_size * sizeof(float));
+        std::memcpy(dst + first_size, src, (num_frames - first_size) * sizeof(float));
+    }
+};
+
+}} // namespace hi::inline v1
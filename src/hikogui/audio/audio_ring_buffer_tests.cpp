@@ -0,0 +1,97 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_ring_buffer.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+
+TEST_SUITE(audio_ring_buffer_suite) {
+
+TEST_CASE(capacity)
+{
+    auto buffer = hi::audio_ring_buffer(2, 100);
+    REQUIRE(buffer.num_channels() == 2);
+    REQUIRE(buffer.capacity() == 128);
+    REQUIRE(buffer.read_available() == 0);
+    REQUIRE(buffer.write_available() == 128);
+}
+
+TEST_CASE(write_read)
+{
+    auto buffer = hi::audio_ring_buffer(2, 8);
+
+    auto left = std::array<float, 5>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+    auto right = std::array<float, 5>{-1.0f, -2.0f, -3.0f, -4.0f, -5.0f};
+    auto const input = std::array<float const *, 2>{left.data(), right.data()};
+    REQUIRE(buffer.write(input, 5) == 5);
+    REQUIRE(buffer.read_available() == 5);
+    REQUIRE(buffer.write_available() == 3);
+
+    auto out_left = std::array<float, 3>{};
+    auto out_right = std::array<float, 3>{};
+    auto const output = std::array<float *, 2>{out_left.data(), out_right.data()};
+    REQUIRE(buffer.read(output, 3) == 3);
+    REQUIRE(out_left == (std::array<float, 3>{1.0f, 2.0f, 3.0f}));
+    REQUIRE(out_right == (std::array<float, 3>{-1.0f, -2.0f, -3.0f}));
+    REQUIRE(buffer.read_available() == 2);
+}
+
+TEST_CASE(wrap_around)
+{
+    auto buffer = hi::audio_ring_buffer(1, 4);
+
+    auto samples = std::array<float, 3>{1.0f, 2.0f, 3.0f};
+    auto result = std::array<float, 3>{};
+    auto const input = std::array<float const *, 1>{samples.data()};
+    auto const output = std::array<float *, 1>{result.data()};
+
+    for (auto i = 0; i != 10; ++i) {
+        REQUIRE(buffer.write(input, 3) == 3);
+        result = {};
+        REQUIRE(buffer.read(output, 3) == 3);
+        REQUIRE(result == samples);
+    }
+}
+
+TEST_CASE(overflow_underflow)
+{
+    auto buffer = hi::audio_ring_buffer(1, 4);
+
+    auto samples = std::array<float, 6>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+    auto const input = std::array<float const *, 1>{samples.data()};
+    REQUIRE(buffer.write(input, 6) == 4);
+    REQUIRE(buffer.write_available() == 0);
+    REQUIRE(buffer.write(input, 1) == 0);
+
+    auto result = std::array<float, 6>{};
+    auto const output = std::array<float *, 1>{result.data()};
+    REQUIRE(buffer.read(output, 6) == 4);
+    REQUIRE(result == (std::array<float, 6>{1.0f, 2.0f, 3.0f, 4.0f, 0.0f, 0.0f}));
+    REQUIRE(buffer.read(output, 1) == 0);
+}
+
+TEST_CASE(read_block)
+{
+    auto buffer = hi::audio_ring_buffer(1, 4);
+
+    REQUIRE(buffer.write_silence(1) == 1);
+    auto samples = std::array<float, 1>{0.5f};
+    auto const input = std::array<float const *, 1>{samples.data()};
+    REQUIRE(buffer.write(input, 1) == 1);
+
+    auto result = std::array<float, 4>{1.0f, 1.0f, 1.0f, 1.0f};
+    float *channels[1] = {result.data()};
+    auto block = hi::audio_block{};
+    block.samples = channels;
+    block.num_samples = result.size();
+    block.num_channels = 1;
+    REQUIRE(buffer.read(block) == 2);
+    REQUIRE(block.state == hi::audio_block_state::normal);
+    REQUIRE(result == (std::array<float, 4>{0.0f, 0.5f, 0.0f, 0.0f}));
+
+    REQUIRE(buffer.read(block) == 0);
+    REQUIRE(block.state == hi::audio_block_state::silent);
+}
+
+};
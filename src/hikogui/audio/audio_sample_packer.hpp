@@ -9,8 +9,17 @@
 #include "../random/random.hpp"
 #include "../macros.hpp"
 #include <hikocpu/hikocpu.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <bit>
+#include <tuple>
+
+#if defined(HI_HAS_X86)
+#include <immintrin.h>
+#endif
 
 hi_export_module(hikogui.audio.audio_sample_packer);
 
@@ -29,20 +38,28 @@ public:
     audio_sample_packer(audio_sample_format format, std::size_t stride) noexcept :
         _dither(format.num_bits), _format(format), _stride(stride)
     {
-        _store_shuffle_indices = format.store_shuffle_indices(stride);
-        _concat_shuffle_indices = format.concat_shuffle_indices(stride);
-
-        _multiplier = f32x4::broadcast(format.pack_multiplier());
+        hi_assert(stride >= format.num_bytes);
+
+        if (not format.is_float) {
+            // Samples are rounded at the precision of the format, then shifted to
+            // the most significant bits of an int32, below the guard bits.
+            hi_assert(format.num_bits + format.num_guard_bits <= 31);
+            _multiplier = static_cast<float>((1_uz << format.num_bits) - 1);
+            _shift = 31 - format.num_bits - format.num_guard_bits;
+        }
 
-        _num_chunks_per_quad = format.num_chunks_per_quad(stride);
-        _chunk_stride = format.chunk_stride(stride);
+        // The largest float below 2^31, so that a full-scale 32 bit sample does not overflow.
+        _maximum = std::min(_multiplier, 2147483520.0f);
 
         _direction = format.endian == std::endian::little ? 1 : -1;
         _start_byte = format.endian == std::endian::little ? 0 : format.num_bytes - 1;
         _align_shift = 32 - format.num_bytes * 8;
     }
 
-    /** Unpack samples.
+    /** Pack samples.
+     *
+     * The bulk of the samples is handled 16 (AVX2) or 32 (AVX-512) at a time
+     * when the CPU supports it, the rest of the samples one at a time.
      *
      * @param src A pointer to an array of floating point samples of a single channel.
      * @param dst A pointer to a byte array to store the packed samples into.
@@ -50,77 +67,250 @@ public:
      */
     void operator()(float const *hi_restrict src, std::byte *hi_restrict dst, std::size_t num_samples) const noexcept
     {
+#if defined(HI_HAS_X86)
+        return (*this)(src, dst, num_samples, cpu_features());
+#else
+        return (*this)(src, dst, num_samples, cpu_feature_mask{});
+#endif
+    }
+
+    /** Pack samples using a subset of the instruction set extensions of the CPU.
+     *
+     * This allows testing each implementation on a CPU that supports all of them.
+     *
+     * @param src A pointer to an array of floating point samples of a single channel.
+     * @param dst A pointer to a byte array to store the packed samples into.
+     * @param num_samples Number of samples.
+     * @param features The instruction set extensions that may be used, a subset of `cpu_features()`.
+     */
+    void operator()(float const *hi_restrict src, std::byte *hi_restrict dst, std::size_t num_samples, cpu_feature_mask features)
+        const noexcept
+    {
         hi_assert(src != nullptr);
         hi_assert(dst != nullptr);
 
-        // Calculate a conservative number of samples that can be copied quickly
-        // without overflowing the dst buffer.
-        auto const src_end = src + num_samples;
-        auto const src_fast_end = src + _format.num_fast_quads(_stride, num_samples) * 4;
+        auto dither = _dither;
+
+        auto i = 0_uz;
+#if defined(HI_HAS_X86)
+        if (to_bool(features & cpu_feature::avx512f) and to_bool(features & cpu_feature::avx512bw)) {
+            i = pack_avx512(src, dst, num_samples, dither);
+        } else if (to_bool(features & cpu_feature::avx2)) {
+            i = pack_avx2(src, dst, num_samples, dither);
+        }
+#else
+        std::ignore = features;
+#endif
+        pack_generic(src + i, dst + i * _stride, num_samples - i, dither);
 
-        auto const store_shuffle_indices = _store_shuffle_indices;
-        auto const concat_shuffle_indices = _concat_shuffle_indices;
-        auto const num_chunks_per_quad = _num_chunks_per_quad;
-        auto const chunk_stride = _chunk_stride;
+        _dither = dither;
+    }
 
+private:
+    mutable dither _dither;
+    audio_sample_format _format;
+    std::size_t _stride;
+    float _multiplier = 1.0f;
+    float _maximum = 1.0f;
+    int _shift = 0;
+    int _direction;
+    int _start_byte;
+    int _align_shift;
+
+    void pack_generic(float const *hi_restrict src, std::byte *hi_restrict dst, std::size_t num_samples, dither& dither)
+        const noexcept
+    {
         if (_format.is_float) {
-            while (src != src_fast_end) {
-                auto const float_samples = load_samples(src);
-                auto const int_samples = i8x16::cast_from(float_samples);
-                store_samples(int_samples, dst, store_shuffle_indices, concat_shuffle_indices, num_chunks_per_quad, chunk_stride);
-            }
-            while (src != src_end) {
-                auto const float_sample = load_sample(src);
-                auto const int_sample = std::bit_cast<int32_t>(float_sample);
+            for (auto i = 0_uz; i != num_samples; ++i) {
+                auto const int_sample = std::bit_cast<int32_t>(src[i]);
                 store_sample(int_sample, dst, _stride, _format.num_bytes, _direction, _start_byte, _align_shift);
             }
 
         } else {
-            auto const multiplier = _multiplier;
-            auto const one = f32x4::broadcast(1);
-            auto const min_one = f32x4::broadcast(-1);
-
-            auto dither = _dither;
-
-            while (src != src_fast_end) {
-                auto const dither_value = dither.next();
-
-                auto float_samples = load_samples(src);
-                float_samples += dither_value;
-                float_samples = min(float_samples, one);
-                float_samples = max(float_samples, min_one);
-                float_samples *= multiplier;
-                auto const int_samples = i8x16::cast_from(static_cast<i32x4>(float_samples));
-                store_samples(int_samples, dst, store_shuffle_indices, concat_shuffle_indices, num_chunks_per_quad, chunk_stride);
-            }
-            while (src != src_end) {
-                auto const dither_value = dither.next();
-
-                auto float_sample = f32x4::broadcast(load_sample(src));
-                float_sample += dither_value;
-                float_sample = min(float_sample, one);
-                float_sample = max(float_sample, min_one);
-                float_sample *= multiplier;
-                auto const int_sample = get<0>(static_cast<i32x4>(float_sample));
+            auto dither_values = f32x8{};
+            for (auto i = 0_uz; i != num_samples; ++i) {
+                if (i % 8 == 0) {
+                    dither_values = dither.next_f32x8();
+                }
+
+                auto float_sample = (src[i] + dither_values[i % 8]) * _multiplier;
+                float_sample = std::clamp(float_sample, -_multiplier, _maximum);
+                auto const int_sample = static_cast<int32_t>(std::nearbyint(float_sample)) << _shift;
                 store_sample(int_sample, dst, _stride, _format.num_bytes, _direction, _start_byte, _align_shift);
             }
+        }
+    }
 
-            _dither = dither;
+    /** Store samples that are left aligned in 32 bit integers one at a time.
+     */
+    void store_samples(int32_t const *int_samples, std::byte *hi_restrict& dst, std::size_t num_samples) const noexcept
+    {
+        for (auto i = 0_uz; i != num_samples; ++i) {
+            store_sample(int_samples[i], dst, _stride, _format.num_bytes, _direction, _start_byte, _align_shift);
         }
     }
 
-private:
-    i8x16 _store_shuffle_indices;
-    i8x16 _concat_shuffle_indices;
-    f32x4 _multiplier;
-    mutable dither _dither;
-    audio_sample_format _format;
-    std::size_t _num_chunks_per_quad;
-    std::size_t _stride;
-    std::size_t _chunk_stride;
-    int _direction;
-    int _start_byte;
-    int _align_shift;
+#if defined(HI_HAS_X86)
+    /** Pack samples 16 at a time.
+     *
+     * @return The number of samples that where packed.
+     */
+    hi_target("sse,sse2,sse3,ssse3,sse4.1,avx,avx2") std::size_t
+        pack_avx2(float const *hi_restrict src, std::byte *hi_restrict dst, std::size_t num_samples, dither& dither)
+            const noexcept
+    {
+        auto const num_fast_samples = num_samples & ~15_uz;
+
+        auto const multiplier = _mm256_set1_ps(_multiplier);
+        auto const minimum = _mm256_set1_ps(-_multiplier);
+        auto const maximum = _mm256_set1_ps(_maximum);
+        auto const shift = _mm_cvtsi32_si128(_shift);
+        auto const byte_swap16 = _mm256_setr_epi8(
+            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+        auto const byte_swap32 = _mm256_setr_epi8(
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        auto const is_big_endian = _format.endian == std::endian::big;
+
+        alignas(32) std::array<int32_t, 16> int_samples;
+        for (auto i = 0_uz; i != num_fast_samples; i += 16) {
+            auto lo_samples = _mm256_loadu_ps(src + i);
+            auto hi_samples = _mm256_loadu_ps(src + i + 8);
+
+            auto lo_int_samples = __m256i{};
+            auto hi_int_samples = __m256i{};
+            if (_format.is_float) {
+                lo_int_samples = _mm256_castps_si256(lo_samples);
+                hi_int_samples = _mm256_castps_si256(hi_samples);
+
+            } else {
+                auto lo_dither = __m256{};
+                auto hi_dither = __m256{};
+                dither.next_avx2(lo_dither, hi_dither);
+
+                lo_samples = _mm256_mul_ps(_mm256_add_ps(lo_samples, lo_dither), multiplier);
+                hi_samples = _mm256_mul_ps(_mm256_add_ps(hi_samples, hi_dither), multiplier);
+                lo_samples = _mm256_min_ps(_mm256_max_ps(lo_samples, minimum), maximum);
+                hi_samples = _mm256_min_ps(_mm256_max_ps(hi_samples, minimum), maximum);
+                lo_int_samples = _mm256_sll_epi32(_mm256_cvtps_epi32(lo_samples), shift);
+                hi_int_samples = _mm256_sll_epi32(_mm256_cvtps_epi32(hi_samples), shift);
+            }
+
+            if (_format.num_bytes == 4 and _stride == 4) {
+                // Non-interleaved 32 bit samples.
+                if (is_big_endian) {
+                    lo_int_samples = _mm256_shuffle_epi8(lo_int_samples, byte_swap32);
+                    hi_int_samples = _mm256_shuffle_epi8(hi_int_samples, byte_swap32);
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), lo_int_samples);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 32), hi_int_samples);
+                dst += 64;
+
+            } else if (_format.num_bytes == 2 and _stride == 2) {
+                // Non-interleaved 16 bit samples, packing works per 128 bit lane so the 64 bit halves are reordered.
+                auto packed_samples =
+                    _mm256_packs_epi32(_mm256_srai_epi32(lo_int_samples, 16), _mm256_srai_epi32(hi_int_samples, 16));
+                packed_samples = _mm256_permute4x64_epi64(packed_samples, 0b11'01'10'00);
+                if (is_big_endian) {
+                    packed_samples = _mm256_shuffle_epi8(packed_samples, byte_swap16);
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), packed_samples);
+                dst += 32;
+
+            } else {
+                // Interleaved samples and 24 bit samples are stored one at a time.
+                _mm256_store_si256(reinterpret_cast<__m256i *>(int_samples.data()), lo_int_samples);
+                _mm256_store_si256(reinterpret_cast<__m256i *>(int_samples.data() + 8), hi_int_samples);
+                store_samples(int_samples.data(), dst, 16);
+            }
+        }
+        return num_fast_samples;
+    }
+
+    /** Pack samples 32 at a time.
+     *
+     * @return The number of samples that where packed.
+     */
+    hi_target("sse,sse2,sse3,ssse3,sse4.1,avx,avx2,avx512f,avx512bw") std::size_t
+        pack_avx512(float const *hi_restrict src, std::byte *hi_restrict dst, std::size_t num_samples, dither& dither)
+            const noexcept
+    {
+        auto const num_fast_samples = num_samples & ~31_uz;
+
+        auto const multiplier = _mm512_set1_ps(_multiplier);
+        auto const minimum = _mm512_set1_ps(-_multiplier);
+        auto const maximum = _mm512_set1_ps(_maximum);
+        auto const shift = _mm_cvtsi32_si128(_shift);
+        auto const byte_swap16 = _mm256_setr_epi8(
+            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+        auto const byte_swap32 = _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+        auto const offsets = _mm512_mullo_epi32(
+            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+            _mm512_set1_epi32(narrow_cast<int>(_stride)));
+        auto const is_big_endian = _format.endian == std::endian::big;
+
+        alignas(64) std::array<int32_t, 32> int_samples;
+        for (auto i = 0_uz; i != num_fast_samples; i += 32) {
+            auto lo_samples = _mm512_loadu_ps(src + i);
+            auto hi_samples = _mm512_loadu_ps(src + i + 16);
+
+            auto lo_int_samples = __m512i{};
+            auto hi_int_samples = __m512i{};
+            if (_format.is_float) {
+                lo_int_samples = _mm512_castps_si512(lo_samples);
+                hi_int_samples = _mm512_castps_si512(hi_samples);
+
+            } else {
+                auto lo_dither = __m512{};
+                auto hi_dither = __m512{};
+                dither.next_avx512(lo_dither, hi_dither);
+
+                lo_samples = _mm512_mul_ps(_mm512_add_ps(lo_samples, lo_dither), multiplier);
+                hi_samples = _mm512_mul_ps(_mm512_add_ps(hi_samples, hi_dither), multiplier);
+                lo_samples = _mm512_min_ps(_mm512_max_ps(lo_samples, minimum), maximum);
+                hi_samples = _mm512_min_ps(_mm512_max_ps(hi_samples, minimum), maximum);
+                lo_int_samples = _mm512_sll_epi32(_mm512_cvtps_epi32(lo_samples), shift);
+                hi_int_samples = _mm512_sll_epi32(_mm512_cvtps_epi32(hi_samples), shift);
+            }
+
+            if (_format.num_bytes == 4) {
+                if (is_big_endian) {
+                    lo_int_samples = _mm512_shuffle_epi8(lo_int_samples, byte_swap32);
+                    hi_int_samples = _mm512_shuffle_epi8(hi_int_samples, byte_swap32);
+                }
+
+                if (_stride == 4) {
+                    // Non-interleaved 32 bit samples.
+                    _mm512_storeu_si512(dst, lo_int_samples);
+                    _mm512_storeu_si512(dst + 64, hi_int_samples);
+                } else {
+                    // Interleaved 32 bit samples are scattered over the frames.
+                    _mm512_i32scatter_epi32(dst, offsets, lo_int_samples, 1);
+                    _mm512_i32scatter_epi32(dst + 16 * _stride, offsets, hi_int_samples, 1);
+                }
+                dst += 32 * _stride;
+
+            } else if (_format.num_bytes == 2 and _stride == 2) {
+                // Non-interleaved 16 bit samples.
+                auto lo_packed_samples = _mm512_cvtepi32_epi16(_mm512_srai_epi32(lo_int_samples, 16));
+                auto hi_packed_samples = _mm512_cvtepi32_epi16(_mm512_srai_epi32(hi_int_samples, 16));
+                if (is_big_endian) {
+                    lo_packed_samples = _mm256_shuffle_epi8(lo_packed_samples, byte_swap16);
+                    hi_packed_samples = _mm256_shuffle_epi8(hi_packed_samples, byte_swap16);
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), lo_packed_samples);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 32), hi_packed_samples);
+                dst += 64;
+
+            } else {
+                // Interleaved 16 bit samples and 24 bit samples are stored one at a time.
+                _mm512_store_si512(int_samples.data(), lo_int_samples);
+                _mm512_store_si512(int_samples.data() + 16, hi_int_samples);
+                store_samples(int_samples.data(), dst, 32);
+            }
+        }
+        return num_fast_samples;
+    }
+#endif
 
     static void store_sample(
         int32_t int_sample,
@@ -143,58 +333,6 @@ private:
 
         dst += stride;
     }
-
-    static void
-    store_samples(i8x16 int_samples, std::byte * hi_restrict & dst, i8x16 store_shuffle_indices, std::size_t stride) noexcept
-    {
-        hi_axiom(dst != nullptr);
-        hi_axiom(stride > 0);
-
-        // Read out the samples from the other channels, that where packed before.
-        auto tmp = i8x16::load(dst);
-
-        auto const packed_samples = permute(int_samples, store_shuffle_indices);
-
-        // When the shuffle-index is -1 use the samples from the other channels.
-        tmp = blend(packed_samples, tmp, store_shuffle_indices);
-
-        // Store back the samples from this channel and from the other channel.
-        tmp.store(dst);
-
-        dst += stride;
-    }
-
-    static void store_samples(
-        i8x16 int_samples,
-        std::byte * hi_restrict & dst,
-        i8x16 store_shuffle_indices,
-        i8x16 concat_shuffle_indices,
-        std::size_t num_chunks,
-        std::size_t stride) noexcept
-    {
-        hi_assert(dst != nullptr);
-        hi_assert(num_chunks > 0 and num_chunks <= 4);
-        hi_assert(stride > 0);
-
-        do {
-            store_samples(int_samples, dst, store_shuffle_indices, stride);
-            int_samples = permute(int_samples, concat_shuffle_indices);
-            // The result of the last shuffle is not used, so will be pipelined by the CPU.
-        } while (--num_chunks);
-    }
-
-    [[nodiscard]] static float load_sample(float const * hi_restrict & src) noexcept
-    {
-        hi_axiom(src != nullptr);
-        return *(src++);
-    }
-
-    [[nodiscard]] static f32x4 load_samples(float const * hi_restrict & src) noexcept
-    {
-        auto const r = f32x4::load(src);
-        src += 4;
-        return r;
-    }
 };
 
 }} // namespace hi::inline v1
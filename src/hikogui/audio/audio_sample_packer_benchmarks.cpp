@@ -0,0 +1,54 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_sample_packer.hpp"
+#include "audio_sample_format.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <vector>
+#include <cmath>
+#include <cstddef>
+
+using hi::operator""_uz;
+
+/** A buffer of samples of a sine wave, the size of a large audio-proc buffer.
+ */
+[[nodiscard]] static std::vector<float> packer_benchmark_samples()
+{
+    auto r = std::vector<float>(4096);
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        r[i] = 0.9f * std::sin(static_cast<float>(i) * 0.01f);
+    }
+    return r;
+}
+
+/** Pack the samples of a single channel into an interleaved stereo buffer.
+ */
+static void packer_benchmark(hi::benchmark_state& state, hi::audio_sample_format format)
+{
+    auto const samples = packer_benchmark_samples();
+    auto const stride = format.num_bytes * 2_uz;
+    auto packed = std::vector<std::byte>(samples.size() * stride);
+    auto const packer = hi::audio_sample_packer{format, stride};
+
+    state.set_items_per_iteration(samples.size());
+    while (state.running()) {
+        packer(samples.data(), packed.data(), samples.size());
+        hi::do_not_optimize(packed);
+    }
+}
+
+hi_benchmark(audio_sample_packer_int16)
+{
+    packer_benchmark(state, hi::audio_sample_format::int16_le());
+}
+
+hi_benchmark(audio_sample_packer_int24)
+{
+    packer_benchmark(state, hi::audio_sample_format::int24_le());
+}
+
+hi_benchmark(audio_sample_packer_float32)
+{
+    packer_benchmark(state, hi::audio_sample_format::float32_le());
+}
@@ -4,12 +4,18 @@
 
 #pragma once
 
-//#include "audio_sample_format.hpp"
+#include "audio_sample_format.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <hikocpu/hikocpu.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <bit>
+#include <tuple>
+
+#if defined(HI_HAS_X86)
+#include <immintrin.h>
+#endif
 
 hi_export_module(hikogui.audio.audio_sample_unpacker);
 
@@ -27,12 +33,9 @@ public:
      */
     audio_sample_unpacker(audio_sample_format format, std::size_t stride) noexcept : _format(format), _stride(stride)
     {
-        _load_shuffle_indices = format.load_shuffle_indices(stride);
-        _concat_shuffle_indices = format.concat_shuffle_indices(stride);
+        hi_assert(stride >= format.num_bytes);
 
-        _multiplier = f32x4::broadcast(format.unpack_multiplier());
-        _num_chunks_per_quad = format.num_chunks_per_quad(stride);
-        _chunk_stride = format.chunk_stride(stride);
+        _multiplier = format.unpack_multiplier();
 
         _direction = format.endian == std::endian::little ? -1 : 1;
         _start_byte = format.endian == std::endian::little ? format.num_bytes - 1 : 0;
@@ -40,6 +43,9 @@ public:
     }
 
     /** Unpack samples.
+     *
+     * The bulk of the samples is handled 8 (AVX2) or 16 (AVX-512) at a time
+     * when the CPU supports it, the rest of the samples one at a time.
      *
      * @param src A pointer to a byte array containing samples.
      * @param dst A pointer to a array of floating point samples of a single channel.
@@ -47,56 +53,164 @@ public:
      */
     void operator()(std::byte const *hi_restrict src, float *hi_restrict dst, std::size_t num_samples) const noexcept
     {
+#if defined(HI_HAS_X86)
+        return (*this)(src, dst, num_samples, cpu_features());
+#else
+        return (*this)(src, dst, num_samples, cpu_feature_mask{});
+#endif
+    }
+
+    /** Unpack samples using a subset of the instruction set extensions of the CPU.
+     *
+     * This allows testing each implementation on a CPU that supports all of them.
+     *
+     * @param src A pointer to a byte array containing samples.
+     * @param dst A pointer to a array of floating point samples of a single channel.
+     * @param num_samples Number of samples.
+     * @param features The instruction set extensions that may be used, a subset of `cpu_features()`.
+     */
+    void operator()(std::byte const *hi_restrict src, float *hi_restrict dst, std::size_t num_samples, cpu_feature_mask features)
+        const noexcept
+    {
         hi_assert(src != nullptr);
         hi_assert(dst != nullptr);
 
-        // Calculate a conservative number of samples that can be copied quickly
-        // without overflowing the src buffer.
-        auto const *const dst_end = dst + num_samples;
-        auto const *const dst_fast_end = dst + _format.num_fast_quads(_stride, num_samples) * 4;
+        auto i = 0_uz;
+#if defined(HI_HAS_X86)
+        if (to_bool(features & cpu_feature::avx512f) and to_bool(features & cpu_feature::avx512bw)) {
+            i = unpack_avx512(src, dst, num_samples);
+        } else if (to_bool(features & cpu_feature::avx2)) {
+            i = unpack_avx2(src, dst, num_samples);
+        }
+#else
+        std::ignore = features;
+#endif
+        unpack_generic(src + i * _stride, dst + i, num_samples - i);
+    }
+
+private:
+    audio_sample_format _format;
+    std::size_t _stride;
+    float _multiplier;
+    int _direction;
+    int _start_byte;
+    int _align_shift;
 
+    void unpack_generic(std::byte const *hi_restrict src, float *hi_restrict dst, std::size_t num_samples) const noexcept
+    {
         if (_format.is_float) {
-            while (dst != dst_fast_end) {
-                auto const int_samples =
-                    load_samples(src, _load_shuffle_indices, _concat_shuffle_indices, _num_chunks_per_quad, _chunk_stride);
-                auto const float_samples = f32x4::cast_from(int_samples);
-                store_samples(dst, float_samples);
-            }
-            while (dst != dst_end) {
+            for (auto i = 0_uz; i != num_samples; ++i) {
                 auto const int_sample = load_sample(src, _stride, _format.num_bytes, _direction, _start_byte, _align_shift);
-                auto const float_sample = std::bit_cast<float>(int_sample);
-                store_sample(dst, float_sample);
+                dst[i] = std::bit_cast<float>(int_sample);
             }
 
         } else {
-            auto const multiplier = _multiplier;
-            while (dst != dst_fast_end) {
-                auto const int_samples =
-                    load_samples(src, _load_shuffle_indices, _concat_shuffle_indices, _num_chunks_per_quad, _chunk_stride);
-                auto const float_samples = static_cast<f32x4>(int_samples) * multiplier;
-                store_samples(dst, float_samples);
-            }
-            while (dst != dst_end) {
+            for (auto i = 0_uz; i != num_samples; ++i) {
                 auto const int_sample = load_sample(src, _stride, _format.num_bytes, _direction, _start_byte, _align_shift);
-                auto const float_sample = static_cast<float>(int_sample) * get<0>(multiplier);
-                store_sample(dst, float_sample);
+                dst[i] = static_cast<float>(int_sample) * _multiplier;
             }
         }
     }
 
-private:
-    f32x4 _multiplier;
-    i8x16 _load_shuffle_indices;
-    i8x16 _concat_shuffle_indices;
-    std::size_t _num_chunks_per_quad;
-    std::size_t _stride;
-    std::size_t _chunk_stride;
-    audio_sample_format _format;
-    int _direction;
-    int _start_byte;
-    int _align_shift;
+    /** The number of samples that can be loaded with 32 bit gathers.
+     *
+     * Each gather loads 4 bytes per sample, the samples at the end of the buffer
+     * are excluded when these loads would read beyond the last sample.
+     *
+     * @param num_samples The total number of samples.
+     * @param num_lanes The number of samples loaded at a time.
+     */
+    [[nodiscard]] std::size_t num_fast_samples(std::size_t num_samples, std::size_t num_lanes) const noexcept
+    {
+        auto const num_over_read = (4 - _format.num_bytes + _stride - 1) / _stride;
+        if (num_samples <= num_over_read) {
+            return 0;
+        }
+        return (num_samples - num_over_read) / num_lanes * num_lanes;
+    }
+
+#if defined(HI_HAS_X86)
+    /** Unpack samples 8 at a time.
+     *
+     * @return The number of samples that where unpacked.
+     */
+    hi_target("sse,sse2,sse3,ssse3,sse4.1,avx,avx2") std::size_t
+        unpack_avx2(std::byte const *hi_restrict src, float *hi_restrict dst, std::size_t num_samples) const noexcept
+    {
+        auto const num_fast = num_fast_samples(num_samples, 8);
+
+        auto const multiplier = _mm256_set1_ps(_multiplier);
+        auto const align_shift = _mm_cvtsi32_si128(_align_shift);
+        auto const align_mask = _mm256_set1_epi32(truncate<int32_t>(0xffff'ffffU << _align_shift));
+        auto const byte_swap32 = _mm256_setr_epi8(
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        auto const offsets =
+            _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(narrow_cast<int>(_stride)));
+        auto const is_contiguous = _stride == 4;
+        auto const is_big_endian = _format.endian == std::endian::big;
+
+        for (auto i = 0_uz; i != num_fast; i += 8) {
+            // Load 4 bytes for each sample, starting at the first byte of the sample.
+            auto int_samples = is_contiguous ? _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src)) :
+                                               _mm256_i32gather_epi32(reinterpret_cast<int const *>(src), offsets, 1);
+            src += 8 * _stride;
+
+            // Left align the sample, and remove the bytes of the next sample.
+            if (is_big_endian) {
+                int_samples = _mm256_and_si256(_mm256_shuffle_epi8(int_samples, byte_swap32), align_mask);
+            } else {
+                int_samples = _mm256_sll_epi32(int_samples, align_shift);
+            }
+
+            if (_format.is_float) {
+                _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(int_samples));
+            } else {
+                _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(int_samples), multiplier));
+            }
+        }
+        return num_fast;
+    }
+
+    /** Unpack samples 16 at a time.
+     *
+     * @return The number of samples that where unpacked.
+     */
+    hi_target("sse,sse2,sse3,ssse3,sse4.1,avx,avx2,avx512f,avx512bw") std::size_t
+        unpack_avx512(std::byte const *hi_restrict src, float *hi_restrict dst, std::size_t num_samples) const noexcept
+    {
+        auto const num_fast = num_fast_samples(num_samples, 16);
+
+        auto const multiplier = _mm512_set1_ps(_multiplier);
+        auto const align_shift = _mm_cvtsi32_si128(_align_shift);
+        auto const align_mask = _mm512_set1_epi32(truncate<int32_t>(0xffff'ffffU << _align_shift));
+        auto const byte_swap32 = _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+        auto const offsets = _mm512_mullo_epi32(
+            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+            _mm512_set1_epi32(narrow_cast<int>(_stride)));
+        auto const is_contiguous = _stride == 4;
+        auto const is_big_endian = _format.endian == std::endian::big;
+
+        for (auto i = 0_uz; i != num_fast; i += 16) {
+            // Load 4 bytes for each sample, starting at the first byte of the sample.
+            auto int_samples = is_contiguous ? _mm512_loadu_si512(src) : _mm512_i32gather_epi32(offsets, src, 1);
+            src += 16 * _stride;
+
+            // Left align the sample, and remove the bytes of the next sample.
+            if (is_big_endian) {
+                int_samples = _mm512_and_si512(_mm512_shuffle_epi8(int_samples, byte_swap32), align_mask);
+            } else {
+                int_samples = _mm512_sll_epi32(int_samples, align_shift);
+            }
 
-    //[[nodiscard]] std::size_t calculate_num_fast_samples(std::size_t num_samples) const noexcept;
+            if (_format.is_float) {
+                _mm512_storeu_ps(dst + i, _mm512_castsi512_ps(int_samples));
+            } else {
+                _mm512_storeu_ps(dst + i, _mm512_mul_ps(_mm512_cvtepi32_ps(int_samples), multiplier));
+            }
+        }
+        return num_fast;
+    }
+#endif
 
     [[nodiscard]] static int32_t load_sample(
         std::byte const *hi_restrict & src,
@@ -129,51 +243,6 @@ private:
         src += stride;
         return truncate<int32_t>(r);
     }
-
-    [[nodiscard]] static i8x16 load_samples(std::byte const *hi_restrict & src, i8x16 load_shuffle_indices, std::size_t stride) noexcept
-    {
-        hi_axiom(src != nullptr);
-        hi_axiom(stride > 0);
-
-        auto r = permute(i8x16::load(src), load_shuffle_indices);
-        src += stride;
-        return r;
-    }
-
-    [[nodiscard]] static i32x4 load_samples(
-        std::byte const *hi_restrict & src,
-        i8x16 load_shuffle_indices,
-        i8x16 concat_shuffle_indices,
-        std::size_t num_chunks,
-        std::size_t stride) noexcept
-    {
-        hi_assert(src != nullptr);
-        hi_assert(num_chunks > 0 and num_chunks <= 4);
-        hi_assert(stride > 0);
-
-        auto int_samples = i8x16{};
-        do {
-            int_samples = permute(int_samples, concat_shuffle_indices);
-            // Due to int_samples reset the dependency is broken on the first iteration, the load_samples
-            // call here should be pipelined in parallel with the first shuffle.
-            int_samples |= load_samples(src, load_shuffle_indices, stride);
-        } while (--num_chunks);
-
-        return std::bit_cast<i32x4>(int_samples);
-    }
-
-    static void store_sample(float *hi_restrict & dst, float sample) noexcept
-    {
-        hi_axiom(dst != nullptr);
-        *(dst++) = sample;
-    }
-
-    static void store_samples(float *hi_restrict & dst, f32x4 samples) noexcept
-    {
-        hi_axiom(dst != nullptr);
-        samples.store(reinterpret_cast<std::byte *>(dst));
-        dst += 4;
-    }
 };
 
 }} // namespace hi::inline v1
@@ -0,0 +1,535 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "asio_driver_win32.hpp"
+#include "audio_block.hpp"
+#include "audio_block_pool.hpp"
+#include "audio_device_delegate.hpp"
+#include "audio_sample_format.hpp"
+#include "audio_sample_packer.hpp"
+#include "audio_sample_unpacker.hpp"
+#include "audio_stream_statistics.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../time/time.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include "../win32_headers.hpp"
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <functional>
+#include <chrono>
+#include <algorithm>
+#include <string_view>
+#include <bit>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.audio.audio_stream_asio);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A stream of audio to and from an ASIO driver.
+ *
+ * The driver calls `bufferSwitch()` from its own real-time thread each time
+ * one half of its double buffers needs to be processed. The input and output
+ * channels are handed to `audio_device_delegate::process_audio()` in a single
+ * call, in the order of the channels of the driver.
+ *
+ * When the buffers of the driver are in native float format, and page aligned
+ * so that they fulfil the promises of `audio_block`, the blocks point directly
+ * into the buffers of the driver. Otherwise the samples are converted from and
+ * to blocks of the block pools of the stream.
+ *
+ * The callbacks of ASIO do not have a context pointer, therefore only a single
+ * ASIO stream can run at a time in a process.
+ *
+ * The duration of each callback, overloads reported by the driver and skipped
+ * buffers are recorded in an `audio_stream_statistics`. ASIO does not have a
+ * clock to measure the latency against; only the latency reported by the
+ * driver is recorded.
+ */
+class audio_stream_asio {
+public:
+    audio_stream_asio(audio_stream_asio const&) = delete;
+    audio_stream_asio(audio_stream_asio&&) = delete;
+    audio_stream_asio& operator=(audio_stream_asio const&) = delete;
+    audio_stream_asio& operator=(audio_stream_asio&&) = delete;
+
+    /** Start streaming.
+     *
+     * @param driver An initialized ASIO driver; must outlive the stream.
+     * @param num_input_channels The number of input channels to stream, limited to the number of channels of the driver.
+     * @param num_output_channels The number of output channels to stream, limited to the number of channels of the driver.
+     * @param sample_rate The sample rate to configure the driver to, or 0.0 to keep the current sample rate.
+     * @param delegate The delegate to process the audio; must outlive the stream.
+     * @param statistics The statistics to record the timing of the stream in; must outlive the stream.
+     * @param reset_request Called, from any thread, when the driver requests to be restarted.
+     * @throws io_error When the stream could not be started.
+     */
+    audio_stream_asio(
+        IASIO *driver,
+        std::size_t num_input_channels,
+        std::size_t num_output_channels,
+        double sample_rate,
+        audio_device_delegate& delegate,
+        audio_stream_statistics& statistics,
+        std::function<void()> reset_request) :
+        _driver(driver), _delegate(delegate), _statistics(statistics), _reset_request(std::move(reset_request))
+    {
+        hi_assert_not_null(driver);
+
+        auto expected = static_cast<audio_stream_asio *>(nullptr);
+        if (not _active.compare_exchange_strong(expected, this, std::memory_order::acq_rel)) {
+            throw io_error("Only a single ASIO stream can run at a time.");
+        }
+
+        try {
+            initialize(num_input_channels, num_output_channels, sample_rate);
+            check(_driver->start(), "start");
+        } catch (...) {
+            release();
+            _active.store(nullptr, std::memory_order::release);
+            throw;
+        }
+    }
+
+    /** Stop streaming.
+     *
+     * The driver is stopped before the stream is destroyed, after which
+     * the delegate will no longer be called.
+     */
+    ~audio_stream_asio()
+    {
+        _driver->stop();
+        release();
+        _active.store(nullptr, std::memory_order::release);
+    }
+
+    /** The number of frames in each half of the double buffers of the driver.
+     */
+    [[nodiscard]] std::size_t buffer_size() const noexcept
+    {
+        return _buffer_size;
+    }
+
+    /** The sample rate the driver is running at.
+     */
+    [[nodiscard]] double sample_rate() const noexcept
+    {
+        return _sample_rate;
+    }
+
+    [[nodiscard]] std::size_t num_input_channels() const noexcept
+    {
+        return _num_inputs;
+    }
+
+    [[nodiscard]] std::size_t num_output_channels() const noexcept
+    {
+        return _num_outputs;
+    }
+
+    /** The blocks passed to the delegate point directly into the buffers of the driver.
+     */
+    [[nodiscard]] bool zero_copy() const noexcept
+    {
+        return (_num_inputs == 0 or not _input_pool) and (_num_outputs == 0 or not _output_pool);
+    }
+
+private:
+    /** The stream that receives the callbacks of the driver.
+     */
+    inline static std::atomic<audio_stream_asio *> _active = nullptr;
+
+    IASIO *_driver;
+    audio_device_delegate& _delegate;
+    audio_stream_statistics& _statistics;
+    std::function<void()> _reset_request;
+    std::atomic<bool> _reset_requested = false;
+
+    double _sample_rate = 0.0;
+    std::size_t _num_inputs = 0;
+    std::size_t _num_outputs = 0;
+
+    /** The number of frames in each half of the double buffers.
+     */
+    std::size_t _buffer_size = 0;
+
+    /** The latency reported by the driver in frames.
+     */
+    std::size_t _input_latency = 0;
+    std::size_t _output_latency = 0;
+
+    /** The input channels followed by the output channels.
+     */
+    std::vector<asio_buffer_info> _buffer_infos;
+    std::vector<audio_sample_format> _sample_formats;
+    bool _buffers_created = false;
+
+    /** The driver supports outputReady() to reduce output latency.
+     */
+    bool _post_output = false;
+
+    /** The number of blocks in each block pool.
+     */
+    constexpr static std::size_t num_pool_blocks = 4;
+
+    /** The blocks to convert samples into; nullptr when the buffers of the driver are used directly.
+     */
+    std::unique_ptr<audio_block_pool> _input_pool;
+    std::unique_ptr<audio_block_pool> _output_pool;
+
+    std::vector<audio_sample_unpacker> _unpackers;
+    std::vector<audio_sample_packer> _packers;
+
+    /** The blocks pointing directly into the buffers of the driver.
+     */
+    audio_block _input_block = {};
+    audio_block _output_block = {};
+    std::vector<float *> _input_pointers;
+    std::vector<float *> _output_pointers;
+
+    /** The sample count of the first sample of the next block.
+     */
+    int64_t _sample_count = 0;
+
+    /** The sample position of the driver at the previous buffer switch.
+     */
+    uint64_t _sample_position = 0;
+    bool _has_sample_position = false;
+
+    /** Throw an io_error with the message of the driver when a call failed.
+     */
+    void check(asio_error error, std::string_view function) const
+    {
+        if (error != asio_error::ok) {
+            char message[128] = {};
+            _driver->getErrorMessage(message);
+            throw io_error(std::format("Call to ASIO {}() failed with {}: {}", function, std::to_underlying(error), message));
+        }
+    }
+
+    void initialize(std::size_t num_input_channels, std::size_t num_output_channels, double sample_rate)
+    {
+        long max_inputs = 0;
+        long max_outputs = 0;
+        check(_driver->getChannels(&max_inputs, &max_outputs), "getChannels");
+        _num_inputs = std::min(num_input_channels, narrow_cast<std::size_t>(max_inputs));
+        _num_outputs = std::min(num_output_channels, narrow_cast<std::size_t>(max_outputs));
+        if (_num_inputs == 0 and _num_outputs == 0) {
+            throw io_error("The ASIO driver does not have any channels to stream.");
+        }
+
+        if (sample_rate != 0.0) {
+            if (_driver->canSampleRate(sample_rate) != asio_error::ok) {
+                throw io_error(std::format("The ASIO driver does not support a sample rate of {} Hz.", sample_rate));
+            }
+            check(_driver->setSampleRate(sample_rate), "setSampleRate");
+        }
+        check(_driver->getSampleRate(&_sample_rate), "getSampleRate");
+        if (_sample_rate <= 0.0) {
+            throw io_error("The ASIO driver does not have a sample rate.");
+        }
+
+        long min_size = 0;
+        long max_size = 0;
+        long preferred_size = 0;
+        long granularity = 0;
+        check(_driver->getBufferSize(&min_size, &max_size, &preferred_size, &granularity), "getBufferSize");
+        _buffer_size = narrow_cast<std::size_t>(preferred_size);
+
+        _buffer_infos.resize(_num_inputs + _num_outputs);
+        for (auto i = 0_uz; i != _buffer_infos.size(); ++i) {
+            auto const is_input = i < _num_inputs;
+            _buffer_infos[i].is_input = is_input ? 1 : 0;
+            _buffer_infos[i].channel_num = narrow_cast<long>(is_input ? i : i - _num_inputs);
+        }
+        // The driver keeps a pointer to the callbacks until disposeBuffers().
+        static auto callbacks = asio_callbacks{
+            buffer_switch_callback, sample_rate_did_change_callback, asio_message_callback, buffer_switch_time_info_callback};
+        check(
+            _driver->createBuffers(_buffer_infos.data(), narrow_cast<long>(_buffer_infos.size()), preferred_size, &callbacks),
+            "createBuffers");
+        _buffers_created = true;
+
+        auto input_zero_copy = true;
+        auto output_zero_copy = true;
+        for (auto const& buffer_info : _buffer_infos) {
+            auto info = asio_channel_info{};
+            info.channel = buffer_info.channel_num;
+            info.is_input = buffer_info.is_input;
+            check(_driver->getChannelInfo(&info), "getChannelInfo");
+
+            auto const sample_format = to_audio_sample_format(info.type);
+            if (not sample_format) {
+                throw io_error(std::format("The ASIO driver uses unsupported sample type {}.", std::to_underlying(info.type)));
+            }
+            _sample_formats.push_back(sample_format);
+
+            // Over-reading and over-writing the samples of an audio_block up to the next
+            // page must not touch the other half of the double buffer, or other channels.
+            auto const can_zero_copy = info.type == asio_sample_type::float32_lsb and
+                std::endian::native == std::endian::little and
+                std::bit_cast<uintptr_t>(buffer_info.buffers[0]) % 4096 == 0 and
+                std::bit_cast<uintptr_t>(buffer_info.buffers[1]) % 4096 == 0;
+
+            auto& zero_copy = buffer_info.is_input ? input_zero_copy : output_zero_copy;
+            zero_copy = zero_copy and can_zero_copy;
+        }
+
+        for (auto i = 0_uz; i != _buffer_infos.size(); ++i) {
+            // The buffers of the driver are not interleaved.
+            if (i < _num_inputs) {
+                _unpackers.emplace_back(_sample_formats[i], _sample_formats[i].num_bytes);
+            } else {
+                _packers.emplace_back(_sample_formats[i], _sample_formats[i].num_bytes);
+            }
+        }
+
+        if (_num_inputs != 0 and not input_zero_copy) {
+            _input_pool = std::make_unique<audio_block_pool>(num_pool_blocks, _num_inputs, _buffer_size);
+        }
+        if (_num_outputs != 0 and not output_zero_copy) {
+            _output_pool = std::make_unique<audio_block_pool>(num_pool_blocks, _num_outputs, _buffer_size);
+        }
+        _input_pointers.resize(_num_inputs);
+        _output_pointers.resize(_num_outputs);
+
+        long input_latency = 0;
+        long output_latency = 0;
+        if (_driver->getLatencies(&input_latency, &output_latency) == asio_error::ok) {
+            _input_latency = narrow_cast<std::size_t>(input_latency);
+            _output_latency = narrow_cast<std::size_t>(output_latency);
+        }
+        _statistics.start(frames_duration(_buffer_size), frames_duration(_input_latency + _output_latency));
+
+        // Drivers that support outputReady() return ok when it is called before the stream is started.
+        _post_output = _driver->outputReady() == asio_error::ok;
+    }
+
+    void release() noexcept
+    {
+        if (_buffers_created) {
+            _driver->disposeBuffers();
+            _buffers_created = false;
+        }
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds frames_duration(std::size_t num_frames) const noexcept
+    {
+        return std::chrono::nanoseconds{static_cast<int64_t>(static_cast<double>(num_frames) * 1'000'000'000.0 / _sample_rate)};
+    }
+
+    static void buffer_switch_callback(long double_buffer_index, asio_bool direct_process) noexcept
+    {
+        if (auto *self = _active.load(std::memory_order::acquire)) {
+            self->buffer_switch(double_buffer_index);
+        }
+    }
+
+    static asio_time *
+    buffer_switch_time_info_callback(asio_time *params, long double_buffer_index, asio_bool direct_process) noexcept
+    {
+        // Only called by drivers that ignore that time-info is not supported.
+        buffer_switch_callback(double_buffer_index, direct_process);
+        return nullptr;
+    }
+
+    static void sample_rate_did_change_callback(asio_sample_rate sample_rate) noexcept
+    {
+        if (auto *self = _active.load(std::memory_order::acquire)) {
+            self->_statistics.add_discontinuity();
+        }
+    }
+
+    static long asio_message_callback(long selector, long value, void *message, double *opt) noexcept
+    {
+        using enum asio_message_selector;
+
+        auto *self = _active.load(std::memory_order::acquire);
+
+        switch (static_cast<asio_message_selector>(selector)) {
+        case selector_supported:
+            switch (static_cast<asio_message_selector>(value)) {
+            case engine_version:
+            case reset_request:
+            case buffer_size_change:
+            case resync_request:
+            case latencies_changed:
+            case overload:
+                return 1;
+            default:
+                return 0;
+            }
+
+        case engine_version:
+            return 2;
+
+        case reset_request:
+        case buffer_size_change:
+            // The driver needs to be reinitialized, which must not be done from inside the callback.
+            if (self != nullptr) {
+                self->request_reset();
+            }
+            return 1;
+
+        case resync_request:
+            if (self != nullptr) {
+                self->_statistics.add_discontinuity();
+            }
+            return 1;
+
+        case latencies_changed:
+            // The new latency is reported when the stream is restarted.
+            return 1;
+
+        case overload:
+            if (self != nullptr) {
+                self->_statistics.add_xrun();
+            }
+            return 1;
+
+        case supports_time_info:
+            // The driver will call bufferSwitch() instead of bufferSwitchTimeInfo().
+            return 0;
+
+        default:
+            return 0;
+        }
+    }
+
+    void request_reset() noexcept
+    {
+        if (not _reset_requested.exchange(true, std::memory_order::relaxed) and _reset_request) {
+            _reset_request();
+        }
+    }
+
+    /** Detect buffers that were skipped by the driver from its sample position.
+     */
+    void check_sample_position() noexcept
+    {
+        auto position = asio_int64{};
+        auto time_stamp = asio_int64{};
+        if (_driver->getSamplePosition(&position, &time_stamp) != asio_error::ok) {
+            return;
+        }
+
+        auto const sample_position = position.value();
+        if (_has_sample_position) {
+            auto const expected_position = _sample_position + _buffer_size;
+            if (sample_position > expected_position) {
+                _statistics.add_xrun();
+            } else if (sample_position < expected_position) {
+                _statistics.add_discontinuity();
+            }
+        }
+        _sample_position = sample_position;
+        _has_sample_position = true;
+    }
+
+    /** Get a block to pass to the delegate.
+     *
+     * @param pool The pool to take the block from, or nullptr to use the buffers of the driver directly.
+     * @param direct_block The block to use for the buffers of the driver.
+     * @param direct_pointers The channel pointers of the direct block.
+     * @param first_buffer The index in `_buffer_infos` of the first channel.
+     * @param index The half of the double buffers to use.
+     * @return A block, or nullptr when the delegate has taken all the blocks of the pool.
+     */
+    [[nodiscard]] audio_block *make_block(
+        audio_block_pool *pool,
+        audio_block& direct_block,
+        std::vector<float *>& direct_pointers,
+        std::size_t first_buffer,
+        long index) noexcept
+    {
+        auto *r = &direct_block;
+        if (pool != nullptr) {
+            r = pool->allocate();
+            if (r == nullptr) {
+                ++global_counter<"audio:block_pool_empty">;
+                return nullptr;
+            }
+
+        } else {
+            for (auto i = 0_uz; i != direct_pointers.size(); ++i) {
+                direct_pointers[i] = static_cast<float *>(_buffer_infos[first_buffer + i].buffers[index]);
+            }
+            r->samples = direct_pointers.data();
+            r->num_channels = direct_pointers.size();
+            r->state = audio_block_state::normal;
+        }
+
+        r->num_samples = _buffer_size;
+        r->sample_rate = static_cast<int>(_sample_rate);
+        r->sample_count = _sample_count;
+        return r;
+    }
+
+    void buffer_switch(long index) noexcept
+    {
+        hi_axiom(index == 0 or index == 1);
+
+        auto const start = time_stamp_count::now();
+        auto const now = time_stamp_utc::make(start);
+
+        check_sample_position();
+
+        audio_block *input = nullptr;
+        if (_num_inputs != 0) {
+            input = make_block(_input_pool.get(), _input_block, _input_pointers, 0, index);
+        }
+        if (input != nullptr) {
+            input->time_stamp = now - frames_duration(_input_latency);
+            if (_input_pool) {
+                for (auto i = 0_uz; i != _num_inputs; ++i) {
+                    auto const *src = static_cast<std::byte const *>(_buffer_infos[i].buffers[index]);
+                    _unpackers[i](src, input->samples[i], _buffer_size);
+                }
+            }
+        }
+
+        audio_block *output = nullptr;
+        if (_num_outputs != 0) {
+            output = make_block(_output_pool.get(), _output_block, _output_pointers, _num_inputs, index);
+        }
+        if (output != nullptr) {
+            output->time_stamp = now + frames_duration(_output_latency);
+        }
+
+        if (input != nullptr or output != nullptr) {
+            _delegate.process_audio(input, output);
+        }
+
+        for (auto i = 0_uz; i != _num_outputs; ++i) {
+            auto *dst = static_cast<std::byte *>(_buffer_infos[_num_inputs + i].buffers[index]);
+            if (output == nullptr or output->state != audio_block_state::normal) {
+                std::memset(dst, 0, _buffer_size * _sample_formats[_num_inputs + i].num_bytes);
+            } else if (_output_pool) {
+                _packers[i](output->samples[i], dst, _buffer_size);
+            }
+        }
+
+        if (_post_output) {
+            _driver->outputReady();
+        }
+
+        if (input != nullptr and _input_pool) {
+            _input_pool->deallocate(input);
+        }
+        if (output != nullptr and _output_pool) {
+            _output_pool->deallocate(output);
+        }
+
+        _sample_count += narrow_cast<int64_t>(_buffer_size);
+        _statistics.add_callback(time_stamp_count::now().count() - start.count());
+    }
+};
+
+}} // namespace hi::inline v1
@@ -72,7 +72,8 @@ hi_export [[nodiscard]] inline audio_stream_format audio_stream_format_from_win3
     } else if (wave_format.SubFormat == KSDATAFORMAT_SUBTYPE_PCM) {
         auto const num_bytes = narrow_cast<uint8_t>(wave_format.Format.wBitsPerSample / 8);
         auto const num_minor_bits = narrow_cast<uint8_t>(wave_format.Samples.wValidBitsPerSample - 1);
-        r.format = pcm_format{false, std::endian::native, true, num_bytes, 0, num_minor_bits};
+        // The valid bits of WAVEFORMATEXTENSIBLE are stored in the most significant bits of the container.
+        r.format = pcm_format{false, std::endian::native, false, num_bytes, 0, num_minor_bits};
     } else {
         throw parse_error("Unknown SubFormat");
     }
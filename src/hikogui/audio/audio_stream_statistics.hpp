@@ -0,0 +1,233 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../telemetry/telemetry.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../time/time.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.audio.audio_stream_statistics);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Timing statistics of an audio stream.
+ *
+ * The audio thread records the duration of each callback, glitches and the
+ * latency of the stream; other threads, such as the GUI, can take a snapshot
+ * at any time. Recording is wait-free and does not allocate, so that it can be
+ * done from the audio thread.
+ *
+ * The statistics are also added to the global counters:
+ *  - "audio:callback" the duration of each callback.
+ *  - "audio:xrun" a callback that took longer than the buffer period, or a buffer that ran empty.
+ *  - "audio:discontinuity" a gap in the stream reported by the device.
+ */
+class audio_stream_statistics {
+public:
+    /** The number of buckets of the callback load histogram.
+     *
+     * Each bucket is 1/8 of the buffer period; bucket 8 and up are callbacks
+     * that ran longer than the buffer period. The last bucket also counts all
+     * callbacks that took even longer.
+     */
+    constexpr static std::size_t num_buckets = 16;
+    constexpr static std::size_t buckets_per_period = 8;
+
+    struct snapshot_type {
+        /** The number of callbacks since the stream started or since reset().
+         */
+        uint64_t num_callbacks = 0;
+
+        /** The number of callbacks that did not finish on time, or buffers that ran empty.
+         */
+        uint64_t num_xruns = 0;
+
+        /** The number of gaps in the stream that were detected or reported by the device.
+         */
+        uint64_t num_discontinuities = 0;
+
+        /** The number of callbacks for each 1/8 of the buffer period that the callback took.
+         */
+        std::array<uint64_t, num_buckets> load_histogram = {};
+
+        /** The longest callback.
+         */
+        std::chrono::nanoseconds max_callback_duration = {};
+
+        /** The time between callbacks.
+         */
+        std::chrono::nanoseconds buffer_period = {};
+
+        /** The latency of the stream as reported by the device driver.
+         */
+        std::chrono::nanoseconds reported_latency = {};
+
+        /** The latency of the stream as measured from the device clock.
+         *
+         * For an input this is the time between the first sample of a buffer
+         * arriving at the device and the callback. For an output this is the
+         * time between the callback and the last sample of the buffer leaving the device.
+         */
+        std::chrono::nanoseconds measured_latency = {};
+
+        /** The highest callback duration relative to the buffer period.
+         */
+        [[nodiscard]] double peak_load() const noexcept
+        {
+            if (buffer_period.count() == 0) {
+                return 0.0;
+            }
+            return static_cast<double>(max_callback_duration.count()) / static_cast<double>(buffer_period.count());
+        }
+
+        /** The reported round-trip latency of an input and output stream.
+         */
+        [[nodiscard]] friend std::chrono::nanoseconds
+        reported_round_trip_latency(snapshot_type const& input, snapshot_type const& output) noexcept
+        {
+            return input.reported_latency + output.reported_latency;
+        }
+
+        /** The measured round-trip latency of an input and output stream.
+         */
+        [[nodiscard]] friend std::chrono::nanoseconds
+        measured_round_trip_latency(snapshot_type const& input, snapshot_type const& output) noexcept
+        {
+            return input.measured_latency + output.measured_latency;
+        }
+    };
+
+    audio_stream_statistics() noexcept = default;
+    audio_stream_statistics(audio_stream_statistics const&) = delete;
+    audio_stream_statistics(audio_stream_statistics&&) = delete;
+    audio_stream_statistics& operator=(audio_stream_statistics const&) = delete;
+    audio_stream_statistics& operator=(audio_stream_statistics&&) = delete;
+
+    /** Start recording the statistics of a new stream.
+     *
+     * @note Must be called before the audio thread is started.
+     * @param buffer_period The time between callbacks.
+     * @param reported_latency The latency of the stream as reported by the device driver.
+     */
+    void start(std::chrono::nanoseconds buffer_period, std::chrono::nanoseconds reported_latency) noexcept
+    {
+        _buffer_period.store(buffer_period.count(), std::memory_order::relaxed);
+        _reported_latency.store(reported_latency.count(), std::memory_order::relaxed);
+        _measured_latency.store(0, std::memory_order::relaxed);
+        reset();
+    }
+
+    /** Reset the counters and histogram.
+     */
+    void reset() noexcept
+    {
+        _num_callbacks.store(0, std::memory_order::relaxed);
+        _num_xruns.store(0, std::memory_order::relaxed);
+        _num_discontinuities.store(0, std::memory_order::relaxed);
+        _max_callback_duration.store(0, std::memory_order::relaxed);
+        for (auto& bucket : _load_histogram) {
+            bucket.store(0, std::memory_order::relaxed);
+        }
+    }
+
+    /** Record the duration of a callback.
+     *
+     * @note Called from the audio thread.
+     * @param count The duration in `time_stamp_count` ticks.
+     */
+    void add_callback(uint64_t count) noexcept
+    {
+        global_counter<"audio:callback">.add_duration(count);
+
+        auto const duration = time_stamp_count::duration_from_count(count).count();
+        auto const period = _buffer_period.load(std::memory_order::relaxed);
+
+        _num_callbacks.fetch_add(1, std::memory_order::relaxed);
+        fetch_max(_max_callback_duration, duration, std::memory_order::relaxed);
+
+        if (period > 0) {
+            auto const bucket = std::min(
+                static_cast<std::size_t>(duration * static_cast<int64_t>(buckets_per_period) / period), num_buckets - 1);
+            _load_histogram[bucket].fetch_add(1, std::memory_order::relaxed);
+
+            if (duration > period) {
+                add_xrun();
+            }
+        }
+    }
+
+    /** Record a buffer that was not delivered or filled in time.
+     *
+     * @note Called from the audio thread.
+     */
+    void add_xrun() noexcept
+    {
+        ++global_counter<"audio:xrun">;
+        _num_xruns.fetch_add(1, std::memory_order::relaxed);
+    }
+
+    /** Record a gap in the stream.
+     *
+     * @note Called from the audio thread.
+     */
+    void add_discontinuity() noexcept
+    {
+        ++global_counter<"audio:discontinuity">;
+        _num_discontinuities.fetch_add(1, std::memory_order::relaxed);
+    }
+
+    /** Record the latency measured from the device clock.
+     *
+     * @note Called from the audio thread.
+     */
+    void set_measured_latency(std::chrono::nanoseconds latency) noexcept
+    {
+        _measured_latency.store(latency.count(), std::memory_order::relaxed);
+    }
+
+    /** Get a copy of the statistics.
+     *
+     * The values are read one by one while the audio thread may be updating
+     * them, so the values may be slightly out of sync with each other.
+     */
+    [[nodiscard]] snapshot_type snapshot() const noexcept
+    {
+        auto r = snapshot_type{};
+        r.num_callbacks = _num_callbacks.load(std::memory_order::relaxed);
+        r.num_xruns = _num_xruns.load(std::memory_order::relaxed);
+        r.num_discontinuities = _num_discontinuities.load(std::memory_order::relaxed);
+        for (auto i = 0_uz; i != num_buckets; ++i) {
+            r.load_histogram[i] = _load_histogram[i].load(std::memory_order::relaxed);
+        }
+        r.max_callback_duration = std::chrono::nanoseconds{_max_callback_duration.load(std::memory_order::relaxed)};
+        r.buffer_period = std::chrono::nanoseconds{_buffer_period.load(std::memory_order::relaxed)};
+        r.reported_latency = std::chrono::nanoseconds{_reported_latency.load(std::memory_order::relaxed)};
+        r.measured_latency = std::chrono::nanoseconds{_measured_latency.load(std::memory_order::relaxed)};
+        return r;
+    }
+
+private:
+    std::atomic<uint64_t> _num_callbacks = 0;
+    std::atomic<uint64_t> _num_xruns = 0;
+    std::atomic<uint64_t> _num_discontinuities = 0;
+    std::array<std::atomic<uint64_t>, num_buckets> _load_histogram = {};
+
+    /** Durations in nanoseconds.
+     */
+    std::atomic<int64_t> _max_callback_duration = 0;
+    std::atomic<int64_t> _buffer_period = 0;
+    std::atomic<int64_t> _reported_latency = 0;
+    std::atomic<int64_t> _measured_latency = 0;
+};
+
+}} // namespace hi::inline v1
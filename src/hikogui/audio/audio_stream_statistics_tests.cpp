@@ -0,0 +1,62 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_stream_statistics.hpp"
+#include <hikotest/hikotest.hpp>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+TEST_SUITE(audio_stream_statistics_suite) {
+
+TEST_CASE(start)
+{
+    auto statistics = hi::audio_stream_statistics{};
+    statistics.start(10ms, 25ms);
+
+    auto const snapshot = statistics.snapshot();
+    REQUIRE(snapshot.num_callbacks == 0);
+    REQUIRE(snapshot.num_xruns == 0);
+    REQUIRE(snapshot.num_discontinuities == 0);
+    REQUIRE(snapshot.buffer_period == 10ms);
+    REQUIRE(snapshot.reported_latency == 25ms);
+    REQUIRE(snapshot.measured_latency == 0ms);
+}
+
+TEST_CASE(xrun_and_discontinuity)
+{
+    auto statistics = hi::audio_stream_statistics{};
+    statistics.start(10ms, 25ms);
+
+    statistics.add_xrun();
+    statistics.add_xrun();
+    statistics.add_discontinuity();
+
+    auto snapshot = statistics.snapshot();
+    REQUIRE(snapshot.num_xruns == 2);
+    REQUIRE(snapshot.num_discontinuities == 1);
+
+    statistics.reset();
+    snapshot = statistics.snapshot();
+    REQUIRE(snapshot.num_xruns == 0);
+    REQUIRE(snapshot.num_discontinuities == 0);
+    REQUIRE(snapshot.reported_latency == 25ms);
+}
+
+TEST_CASE(round_trip_latency)
+{
+    auto input = hi::audio_stream_statistics{};
+    auto output = hi::audio_stream_statistics{};
+    input.start(10ms, 20ms);
+    output.start(10ms, 30ms);
+    input.set_measured_latency(22ms);
+    output.set_measured_latency(35ms);
+
+    auto const input_snapshot = input.snapshot();
+    auto const output_snapshot = output.snapshot();
+    REQUIRE(reported_round_trip_latency(input_snapshot, output_snapshot) == 50ms);
+    REQUIRE(measured_round_trip_latency(input_snapshot, output_snapshot) == 57ms);
+}
+
+};
@@ -0,0 +1,541 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_block.hpp"
+#include "audio_block_pool.hpp"
+#include "audio_device_delegate.hpp"
+#include "audio_direction.hpp"
+#include "audio_sample_format.hpp"
+#include "audio_sample_packer.hpp"
+#include "audio_sample_unpacker.hpp"
+#include "audio_stream_format.hpp"
+#include "audio_stream_format_win32.hpp"
+#include "audio_stream_statistics.hpp"
+#include "../memory/memory.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../time/time.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include "../win32_headers.hpp"
+#include <vector>
+#include <memory>
+#include <array>
+#include <thread>
+#include <stop_token>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.audio.audio_stream_win32);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A stream of audio to or from a WASAPI audio end-point.
+ *
+ * The stream is event driven: the audio engine signals an event each time it
+ * needs or has a buffer of samples. A dedicated thread, registered with MMCSS
+ * as "Pro Audio", waits for this event, converts between the interleaved samples
+ * of the device and the non-interleaved samples of an `audio_block`, and calls
+ * `audio_device_delegate::process_audio()`.
+ *
+ * All buffers are allocated, and locked in memory, when the stream is created.
+ * The audio thread does not allocate memory or take locks; the blocks passed
+ * to the delegate are taken from, and returned to, the block pool of the stream.
+ *
+ * The duration of each callback, buffer under- and overruns and the latency
+ * measured from the clock of the device are recorded in an `audio_stream_statistics`.
+ */
+class audio_stream_win32 {
+public:
+    audio_stream_win32(audio_stream_win32 const&) = delete;
+    audio_stream_win32(audio_stream_win32&&) = delete;
+    audio_stream_win32& operator=(audio_stream_win32 const&) = delete;
+    audio_stream_win32& operator=(audio_stream_win32&&) = delete;
+
+    /** Start streaming.
+     *
+     * @param device The end-point to stream to or from.
+     * @param direction The direction of the end-point, either input or output.
+     * @param format The format of the stream.
+     * @param exclusive True to open the end-point in exclusive-mode, false for shared-mode.
+     * @param delegate The delegate to process the audio; must outlive the stream.
+     * @param statistics The statistics to record the timing of the stream in; must outlive the stream.
+     * @throws io_error When the stream could not be started.
+     */
+    audio_stream_win32(
+        IMMDevice *device,
+        audio_direction direction,
+        audio_stream_format const& format,
+        bool exclusive,
+        audio_device_delegate& delegate,
+        audio_stream_statistics& statistics) :
+        _direction(direction), _format(format), _exclusive(exclusive), _delegate(delegate), _statistics(statistics)
+    {
+        hi_assert_not_null(device);
+        hi_assert(direction == audio_direction::input or direction == audio_direction::output);
+
+        if (format.empty() or format.sample_rate == 0 or format.num_channels == 0 or format.format.num_bytes() > 4) {
+            throw io_error("Unsupported audio stream format for streaming.");
+        }
+
+        try {
+            initialize(device);
+        } catch (...) {
+            release();
+            throw;
+        }
+
+        _thread = std::jthread{[this](std::stop_token stop_token) {
+            run(std::move(stop_token));
+        }};
+    }
+
+    /** Stop streaming.
+     *
+     * The audio thread is joined before the stream is destroyed, after which
+     * the delegate will no longer be called.
+     */
+    ~audio_stream_win32()
+    {
+        if (_thread.joinable()) {
+            _thread.request_stop();
+            SetEvent(_stop_event);
+            _thread.join();
+        }
+        release();
+    }
+
+    /** The number of frames in the buffer of the audio engine.
+     */
+    [[nodiscard]] std::size_t buffer_size() const noexcept
+    {
+        return _buffer_size;
+    }
+
+    /** The pool of audio blocks of this stream.
+     *
+     * The blocks have the number of channels of the stream and fit a full
+     * buffer of the audio engine. Blocks in excess of the one used by the
+     * audio thread may be taken by the delegate, for example to delay processing.
+     */
+    [[nodiscard]] audio_block_pool& block_pool() noexcept
+    {
+        hi_axiom_not_null(_block_pool);
+        return *_block_pool;
+    }
+
+private:
+    audio_direction _direction;
+    audio_stream_format _format;
+    bool _exclusive;
+    audio_device_delegate& _delegate;
+    audio_stream_statistics& _statistics;
+
+    IAudioClient *_audio_client = nullptr;
+    IAudioRenderClient *_render_client = nullptr;
+    IAudioCaptureClient *_capture_client = nullptr;
+    IAudioClock *_audio_clock = nullptr;
+
+    /** The number of units per second of the position of the audio clock.
+     */
+    UINT64 _clock_frequency = 0;
+
+    /** The frequency of the performance counter.
+     */
+    int64_t _qpc_frequency = 0;
+
+    /** The expected device position of the next captured packet.
+     */
+    UINT64 _next_device_position = 0;
+
+    /** Signalled by the audio engine when a buffer is needed or available.
+     */
+    HANDLE _buffer_event = nullptr;
+
+    /** Signalled to wake up the audio thread when the stream is stopped.
+     */
+    HANDLE _stop_event = nullptr;
+
+    /** The number of frames in the buffer of the audio engine.
+     */
+    std::size_t _buffer_size = 0;
+
+    /** The number of bytes of a frame of interleaved samples.
+     */
+    std::size_t _frame_size = 0;
+
+    /** The number of blocks in the block pool.
+     */
+    constexpr static std::size_t num_pool_blocks = 4;
+
+    /** The non-interleaved sample buffers handed to the delegate.
+     */
+    std::unique_ptr<audio_block_pool> _block_pool;
+
+    std::vector<audio_sample_packer> _packers;
+    std::vector<audio_sample_unpacker> _unpackers;
+
+    /** The sample count of the first sample of the next block.
+     */
+    int64_t _sample_count = 0;
+
+    std::jthread _thread;
+
+    void initialize(IMMDevice *device)
+    {
+        hi_hresult_check(device->Activate(__uuidof(IAudioClient), CLSCTX_ALL, NULL, reinterpret_cast<void **>(&_audio_client)));
+        hi_assert_not_null(_audio_client);
+
+        auto const wave_format = audio_stream_format_to_win32(_format, win32_use_extensible(_format));
+
+        // In exclusive-mode with event callbacks the buffer duration and periodicity must be equal.
+        REFERENCE_TIME default_period = 0;
+        REFERENCE_TIME minimum_period = 0;
+        hi_hresult_check(_audio_client->GetDevicePeriod(&default_period, &minimum_period));
+
+        auto const share_mode = _exclusive ? AUDCLNT_SHAREMODE_EXCLUSIVE : AUDCLNT_SHAREMODE_SHARED;
+        hi_hresult_check(_audio_client->Initialize(
+            share_mode,
+            AUDCLNT_STREAMFLAGS_EVENTCALLBACK,
+            default_period,
+            _exclusive ? default_period : 0,
+            reinterpret_cast<WAVEFORMATEX const *>(&wave_format),
+            NULL));
+
+        _buffer_event = CreateEventW(NULL, FALSE, FALSE, NULL);
+        _stop_event = CreateEventW(NULL, TRUE, FALSE, NULL);
+        if (_buffer_event == nullptr or _stop_event == nullptr) {
+            throw io_error(std::format("Could not create events for audio stream: {}", get_last_error_message()));
+        }
+        hi_hresult_check(_audio_client->SetEventHandle(_buffer_event));
+
+        UINT32 buffer_size = 0;
+        hi_hresult_check(_audio_client->GetBufferSize(&buffer_size));
+        _buffer_size = buffer_size;
+
+        hi_hresult_check(_audio_client->GetService(__uuidof(IAudioClock), reinterpret_cast<void **>(&_audio_clock)));
+        hi_hresult_check(_audio_clock->GetFrequency(&_clock_frequency));
+
+        LARGE_INTEGER qpc_frequency;
+        QueryPerformanceFrequency(&qpc_frequency);
+        _qpc_frequency = qpc_frequency.QuadPart;
+
+        // The latency of the audio engine and driver, plus the buffer that we fill or read.
+        REFERENCE_TIME stream_latency = 0;
+        hi_hresult_check(_audio_client->GetStreamLatency(&stream_latency));
+        _statistics.start(
+            reference_time_to_duration(default_period),
+            reference_time_to_duration(stream_latency) + frames_duration(_buffer_size));
+
+        if (_direction == audio_direction::output) {
+            hi_hresult_check(_audio_client->GetService(__uuidof(IAudioRenderClient), reinterpret_cast<void **>(&_render_client)));
+        } else {
+            hi_hresult_check(
+                _audio_client->GetService(__uuidof(IAudioCaptureClient), reinterpret_cast<void **>(&_capture_client)));
+        }
+
+        auto const num_channels = std::size_t{_format.num_channels};
+        auto const num_bytes = std::size_t{_format.format.num_bytes()};
+        _frame_size = num_channels * num_bytes;
+
+        _block_pool = std::make_unique<audio_block_pool>(num_pool_blocks, num_channels, _buffer_size);
+
+        auto const sample_format = audio_sample_format::from_pcm_format(_format.format);
+        for (auto i = 0_uz; i != num_channels; ++i) {
+            if (_direction == audio_direction::output) {
+                _packers.emplace_back(sample_format, _frame_size);
+            } else {
+                _unpackers.emplace_back(sample_format, _frame_size);
+            }
+        }
+    }
+
+    void release() noexcept
+    {
+        if (_render_client) {
+            _render_client->Release();
+            _render_client = nullptr;
+        }
+        if (_capture_client) {
+            _capture_client->Release();
+            _capture_client = nullptr;
+        }
+        if (_audio_clock) {
+            _audio_clock->Release();
+            _audio_clock = nullptr;
+        }
+        if (_audio_client) {
+            _audio_client->Release();
+            _audio_client = nullptr;
+        }
+        if (_buffer_event) {
+            CloseHandle(_buffer_event);
+            _buffer_event = nullptr;
+        }
+        if (_stop_event) {
+            CloseHandle(_stop_event);
+            _stop_event = nullptr;
+        }
+    }
+
+    void run(std::stop_token stop_token) noexcept
+    {
+        set_thread_name("audio");
+
+        auto const com_initialized = SUCCEEDED(CoInitializeEx(NULL, COINIT_MULTITHREADED));
+
+        DWORD task_index = 0;
+        auto const mmcss_handle = AvSetMmThreadCharacteristicsW(L"Pro Audio", &task_index);
+        if (mmcss_handle == nullptr) {
+            hi_log_warning("Could not register the audio thread with MMCSS: {}", get_last_error_message());
+        }
+        try {
+            // Dropouts happen when the callback is scheduled on the efficiency cores of a hybrid CPU.
+            set_thread_core_class(cpu_core_class::performance);
+        } catch (std::exception const& e) {
+            hi_log_warning("Could not run the audio thread on the performance cores: {}", e.what());
+        }
+
+        // Fill the buffer before starting, so that the device does not start with a glitch.
+        if (_direction == audio_direction::output) {
+            render();
+        }
+
+        if (FAILED(_audio_client->Start())) {
+            hi_log_error("Could not start audio stream.");
+        } else {
+            auto const events = std::array<HANDLE, 2>{_buffer_event, _stop_event};
+            while (not stop_token.stop_requested()) {
+                auto const result = WaitForMultipleObjects(narrow_cast<DWORD>(events.size()), events.data(), FALSE, 2000);
+                if (result == WAIT_OBJECT_0) {
+                    auto const start = time_stamp_count::now();
+                    if (_direction == audio_direction::output) {
+                        render();
+                    } else {
+                        capture();
+                    }
+                    _statistics.add_callback(time_stamp_count::now().count() - start.count());
+
+                } else if (result == WAIT_OBJECT_0 + 1) {
+                    break;
+
+                } else if (result == WAIT_TIMEOUT) {
+                    // The device stopped signalling, for example when it was unplugged.
+                    ++global_counter<"audio:timeout">;
+
+                } else {
+                    ++global_counter<"audio:error">;
+                    break;
+                }
+            }
+
+            _audio_client->Stop();
+        }
+
+        if (mmcss_handle != nullptr) {
+            AvRevertMmThreadCharacteristics(mmcss_handle);
+        }
+        if (com_initialized) {
+            CoUninitialize();
+        }
+    }
+
+    /** Take a block from the pool.
+     *
+     * @return A block, or nullptr when the delegate has taken all the blocks of the pool.
+     */
+    [[nodiscard]] audio_block *make_block(std::size_t num_frames, utc_nanoseconds time_stamp) noexcept
+    {
+        hi_axiom(num_frames <= _buffer_size);
+
+        auto *r = _block_pool->allocate();
+        if (r == nullptr) {
+            ++global_counter<"audio:block_pool_empty">;
+            return nullptr;
+        }
+
+        r->num_samples = num_frames;
+        r->sample_rate = narrow_cast<int>(_format.sample_rate);
+        r->sample_count = _sample_count;
+        r->time_stamp = time_stamp;
+        return r;
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds frames_duration(std::size_t num_frames) const noexcept
+    {
+        return std::chrono::nanoseconds{narrow_cast<int64_t>(num_frames * 1'000'000'000ULL / _format.sample_rate)};
+    }
+
+    [[nodiscard]] static std::chrono::nanoseconds reference_time_to_duration(REFERENCE_TIME reference_time) noexcept
+    {
+        // REFERENCE_TIME is in units of 100 ns.
+        return std::chrono::nanoseconds{reference_time * 100};
+    }
+
+    /** The current value of the performance counter, in the 100 ns units used by the audio clock.
+     */
+    [[nodiscard]] UINT64 qpc_now() const noexcept
+    {
+        LARGE_INTEGER count;
+        QueryPerformanceCounter(&count);
+
+        auto const seconds = count.QuadPart / _qpc_frequency;
+        auto const remainder = count.QuadPart % _qpc_frequency;
+        return narrow_cast<UINT64>(seconds * 10'000'000 + remainder * 10'000'000 / _qpc_frequency);
+    }
+
+    /** Measure the latency of the output from the position of the audio clock.
+     *
+     * @param num_frames_written The total number of frames written to the device.
+     */
+    void measure_render_latency(uint64_t num_frames_written) noexcept
+    {
+        UINT64 position = 0;
+        UINT64 qpc_position = 0;
+        if (FAILED(_audio_clock->GetPosition(&position, &qpc_position)) or _clock_frequency == 0) {
+            return;
+        }
+
+        // The position is of the frame that is currently leaving the device.
+        auto const num_frames_played = position * _format.sample_rate / _clock_frequency;
+        if (num_frames_played > num_frames_written) {
+            return;
+        }
+
+        // Compensate for the time since the position was read.
+        auto const now_position = qpc_now();
+        auto const age = now_position >= qpc_position ?
+            reference_time_to_duration(narrow_cast<REFERENCE_TIME>(now_position - qpc_position)) :
+            std::chrono::nanoseconds{0};
+        _statistics.set_measured_latency(frames_duration(num_frames_written - num_frames_played) - age);
+    }
+
+    void render() noexcept
+    {
+        hi_axiom_not_null(_render_client);
+
+        auto num_padding_frames = 0_uz;
+        if (not _exclusive) {
+            // In shared-mode the buffer may still contain frames that were not yet played.
+            UINT32 padding = 0;
+            if (FAILED(_audio_client->GetCurrentPadding(&padding))) {
+                ++global_counter<"audio:error">;
+                return;
+            }
+            num_padding_frames = padding;
+
+            // The audio engine consumed every frame before this callback; the device ran dry.
+            if (num_padding_frames == 0 and _sample_count != 0) {
+                _statistics.add_xrun();
+            }
+        }
+
+        auto const num_frames = _buffer_size - std::min(num_padding_frames, _buffer_size);
+        if (num_frames == 0) {
+            return;
+        }
+
+        BYTE *data = nullptr;
+        if (FAILED(_render_client->GetBuffer(narrow_cast<UINT32>(num_frames), &data))) {
+            ++global_counter<"audio:error">;
+            return;
+        }
+
+        auto const now = time_stamp_utc::make(time_stamp_count::now());
+        auto *block = make_block(num_frames, now + frames_duration(num_padding_frames));
+        if (block != nullptr) {
+            _delegate.process_audio(nullptr, block);
+        }
+
+        if (block != nullptr and block->state == audio_block_state::normal) {
+            auto *dst = reinterpret_cast<std::byte *>(data);
+            auto const num_bytes = std::size_t{_format.format.num_bytes()};
+            for (auto i = 0_uz; i != _packers.size(); ++i) {
+                _packers[i](block->samples[i], dst + i * num_bytes, num_frames);
+            }
+            _render_client->ReleaseBuffer(narrow_cast<UINT32>(num_frames), 0);
+
+        } else {
+            _render_client->ReleaseBuffer(narrow_cast<UINT32>(num_frames), AUDCLNT_BUFFERFLAGS_SILENT);
+        }
+
+        if (block != nullptr) {
+            _block_pool->deallocate(block);
+        }
+
+        _sample_count += narrow_cast<int64_t>(num_frames);
+        measure_render_latency(narrow_cast<uint64_t>(_sample_count));
+    }
+
+    void capture() noexcept
+    {
+        hi_axiom_not_null(_capture_client);
+
+        UINT32 packet_size = 0;
+        while (SUCCEEDED(_capture_client->GetNextPacketSize(&packet_size)) and packet_size != 0) {
+            BYTE *data = nullptr;
+            UINT32 num_frames = 0;
+            DWORD flags = 0;
+            UINT64 device_position = 0;
+            UINT64 qpc_position = 0;
+            if (FAILED(_capture_client->GetBuffer(&data, &num_frames, &flags, &device_position, &qpc_position))) {
+                ++global_counter<"audio:error">;
+                return;
+            }
+
+            // A gap is either reported by the audio engine, or seen as a jump in the device position.
+            if ((flags & AUDCLNT_BUFFERFLAGS_DATA_DISCONTINUITY) or
+                (_sample_count != 0 and device_position != _next_device_position)) {
+                _statistics.add_discontinuity();
+            }
+            _next_device_position = device_position + num_frames;
+
+            // The time between the first frame arriving at the device and now.
+            if (auto const now_position = qpc_now(); now_position >= qpc_position) {
+                auto const age = narrow_cast<REFERENCE_TIME>(now_position - qpc_position);
+                _statistics.set_measured_latency(reference_time_to_duration(age));
+            }
+
+            auto const now = time_stamp_utc::make(time_stamp_count::now());
+
+            // A packet is never larger than the buffer, but handle it in parts just in case.
+            auto const *src = reinterpret_cast<std::byte const *>(data);
+            auto const num_bytes = std::size_t{_format.format.num_bytes()};
+            for (auto offset = 0_uz; offset < num_frames; offset += _buffer_size) {
+                auto const num_block_frames = std::min(std::size_t{num_frames} - offset, _buffer_size);
+                auto *block = make_block(num_block_frames, now - frames_duration(num_frames - offset));
+                if (block == nullptr) {
+                    // The samples are dropped, the sample count still advances to keep the time-line.
+                    _sample_count += narrow_cast<int64_t>(num_block_frames);
+                    continue;
+                }
+
+                if (flags & AUDCLNT_BUFFERFLAGS_SILENT) {
+                    for (auto i = 0_uz; i != block->num_channels; ++i) {
+                        std::memset(block->samples[i], 0, num_block_frames * sizeof(float));
+                    }
+                    block->state = audio_block_state::silent;
+
+                } else {
+                    for (auto i = 0_uz; i != _unpackers.size(); ++i) {
+                        _unpackers[i](src + offset * _frame_size + i * num_bytes, block->samples[i], num_block_frames);
+                    }
+                }
+
+                _delegate.process_audio(block, nullptr);
+                _block_pool->deallocate(block);
+                _sample_count += narrow_cast<int64_t>(num_block_frames);
+            }
+
+            _capture_client->ReleaseBuffer(num_frames);
+        }
+    }
+};
+
+}} // namespace hi::inline v1
@@ -1,16 +1,78 @@
+// Copyright Take Vos 2023.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #pragma once
 
 #include "audio_system.hpp"
+#include "audio_device_asio.hpp"
+#include "asio_driver_win32.hpp"
+#include "../container/container.hpp"
+#include "../memory/memory.hpp"
 #include "../macros.hpp"
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <coroutine>
 
 hi_export_module(hikogui.audio.audio_system_asio);
 
 hi_export namespace hi { inline namespace v1 {
 
+/** The audio system of the ASIO drivers registered on the system.
+ *
+ * ASIO does not notify about drivers that are installed or removed; the
+ * drivers are enumerated when the audio system is created.
+ *
+ * @note COM must be initialized on the main thread before the audio system is created.
+ */
 hi_export class audio_system_asio : public audio_system {
+public:
+    using super = audio_system;
+
+    audio_system_asio() : super()
+    {
+        update_device_list();
+    }
+
+    [[nodiscard]] generator<audio_device&> devices() noexcept override
+    {
+        for (auto const& device : _devices) {
+            co_yield *device;
+        }
+    }
+
+private:
+    /** The devices that are part of the audio system.
+     *
+     * @see audio_system_win32::_devices
+     */
+    std::vector<std::shared_ptr<audio_device>> _devices;
+
+    void update_device_list() noexcept
+    {
+        hi_log_info("Updating ASIO device list:");
+
+        auto old_devices = std::move(_devices);
+        _devices.clear();
+        for (auto const& driver_info : asio_drivers()) {
+            auto const device_id = std::string{"asio:"} + driver_info.clsid_string;
+
+            auto it = std::find_if(old_devices.begin(), old_devices.end(), [&device_id](auto& item) {
+                return item->id() == device_id;
+            });
+
+            if (it != old_devices.end()) {
+                _devices.push_back(std::move(*it));
+                old_devices.erase(it);
+
+            } else {
+                hi_log_info("Found ASIO driver \"{}\"", driver_info.description);
+                _devices.push_back(
+                    std::allocate_shared<audio_device_asio>(locked_memory_allocator<audio_device_asio>{}, driver_info));
+            }
+        }
+    }
 };
 
 }} // namespace hi::inline v1
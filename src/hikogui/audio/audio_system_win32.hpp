@@ -6,11 +6,18 @@
 
 #include "audio_system.hpp"
 #include "audio_device_win32.hpp"
+#include "audio_system_asio.hpp"
 #include "../container/container.hpp"
 #include "../memory/memory.hpp"
+#include "../dispatch/dispatch.hpp"
 #include "../macros.hpp"
 #include "../win32_headers.hpp"
 #include <memory>
+#include <vector>
+#include <string>
+#include <optional>
+#include <utility>
+#include <algorithm>
 #include <coroutine>
 
 hi_export_module(hikogui.audio.audio_system_win32);
@@ -40,12 +47,15 @@ public:
 
         _device_enumerator->RegisterEndpointNotificationCallback(_notification_client.get());
 
-        // Start with enumerating the devices.
+        // Start with enumerating the devices, the device list is published when the enumeration has finished.
         update_device_list();
     }
 
     virtual ~audio_system_win32()
     {
+        // An enumeration that is still running on the background thread should not publish its result.
+        *_self = nullptr;
+
         if (_device_enumerator) {
             _device_enumerator->UnregisterEndpointNotificationCallback(_notification_client.get());
             _device_enumerator->Release();
@@ -70,7 +80,6 @@ private:
         {
             loop::main().wfree_post_function([this]() {
                 _system->update_device_list();
-                _system->_notifier();
             });
             return S_OK;
         }
@@ -79,7 +88,6 @@ private:
         {
             loop::main().wfree_post_function([this]() {
                 _system->update_device_list();
-                _system->_notifier();
             });
             return S_OK;
         }
@@ -96,7 +104,6 @@ private:
             hi_assert_not_null(device_id);
             loop::main().wfree_post_function([this]() {
                 _system->update_device_list();
-                _system->_notifier();
             });
             return S_OK;
         }
@@ -105,7 +112,6 @@ private:
         {
             loop::main().wfree_post_function([this]() {
                 _system->update_device_list();
-                _system->_notifier();
             });
             return S_OK;
         }
@@ -114,7 +120,6 @@ private:
         {
             loop::main().wfree_post_function([this]() {
                 _system->update_device_list();
-                _system->_notifier();
             });
             return S_OK;
         }
@@ -138,6 +143,13 @@ private:
         audio_system_win32 *_system;
     };
 
+    /** A device found during enumeration, with the state of its end-point.
+     */
+    struct device_update_type {
+        std::shared_ptr<audio_device_win32> device;
+        audio_device_win32::probe_type probe;
+    };
+
     /** The devices that are part of the audio system.
      *
      * Due to complicated threading and callback function interactions
@@ -147,23 +159,91 @@ private:
      * audio devices need to be allocated on locked memory, and
      * unique_ptr does not support allocators.
      */
-    std::vector<std::shared_ptr<audio_device>> _devices;
+    std::vector<std::shared_ptr<audio_device_win32>> _devices;
 
     IMMDeviceEnumerator *_device_enumerator;
     std::unique_ptr<audio_system_win32_notification_client> _notification_client;
 
-    /** Before clients are notified, this function is called to update the device list.
+    /** Points to this audio system until it is destroyed; shared with the enumeration that is running.
+     */
+    std::shared_ptr<audio_system_win32 *> _self = std::make_shared<audio_system_win32 *>(this);
+
+    /** Set while the devices are enumerated on the background thread.
+     */
+    bool _enumerating = false;
+
+    /** Set when the devices changed again during enumeration.
+     */
+    bool _enumerate_again = false;
+
+    /** Start enumerating the devices on a background thread.
+     *
+     * Enumeration and probing the supported formats of the drivers may take
+     * hundreds of milliseconds, for example for USB and Bluetooth devices.
+     * The result is published to the main thread by `publish_device_list()`.
+     *
+     * The end-point notifications arrive in bursts, while an enumeration is
+     * running a single new enumeration is scheduled.
      */
     void update_device_list() noexcept
     {
         hi_axiom(loop::main().on_thread());
-        hi_log_info("Updating audio device list:");
+
+        if (_enumerating) {
+            _enumerate_again = true;
+            return;
+        }
+        _enumerating = true;
+
+        // The formats of devices that were already active do not need to be probed again.
+        auto known_devices = std::vector<std::pair<std::shared_ptr<audio_device_win32>, bool>>{};
+        known_devices.reserve(_devices.size());
+        for (auto const& device : _devices) {
+            known_devices.emplace_back(device, device->last_state() == audio_device_state::active);
+        }
+
+        _device_enumerator->AddRef();
+        thread_pool::background().post_function(
+            [self = _self, device_enumerator = _device_enumerator, known_devices = std::move(known_devices)]() mutable {
+                auto updates = enumerate_devices(device_enumerator, known_devices);
+                known_devices.clear();
+                device_enumerator->Release();
+
+                loop::main().post_function([self = std::move(self), updates = std::move(updates)]() mutable {
+                    if (auto *system = *self) {
+                        system->publish_device_list(std::move(updates));
+                    }
+                });
+            });
+    }
+
+    /** Enumerate the audio end-points and query their state.
+     *
+     * This function is called on a background thread.
+     *
+     * @param device_enumerator The enumerator of the audio end-points.
+     * @param known_devices The devices known before enumeration, with a flag if the device was active.
+     * @return The devices of the end-points, reusing the known devices, or empty when enumeration failed.
+     */
+    [[nodiscard]] static std::optional<std::vector<device_update_type>> enumerate_devices(
+        IMMDeviceEnumerator *device_enumerator,
+        std::vector<std::pair<std::shared_ptr<audio_device_win32>, bool>> const& known_devices) noexcept
+    {
+        hi_assert_not_null(device_enumerator);
+
+        // The enumerator lives in the multi-threaded apartment.
+        auto const com_result = CoInitializeEx(NULL, COINIT_MULTITHREADED);
+        auto const d = defer([&] {
+            if (SUCCEEDED(com_result)) {
+                CoUninitialize();
+            }
+        });
 
         IMMDeviceCollection *device_collection;
-        if (FAILED(_device_enumerator->EnumAudioEndpoints(
+        if (FAILED(device_enumerator->EnumAudioEndpoints(
                 eAll, DEVICE_STATE_ACTIVE | DEVICE_STATE_DISABLED | DEVICE_STATE_UNPLUGGED, &device_collection))) {
             hi_log_error("EnumAudioEndpoints() failed: {}", get_last_error_message());
-            return;
+            return std::nullopt;
         }
         hi_assert(device_collection);
 
@@ -171,17 +251,17 @@ private:
         if (FAILED(device_collection->GetCount(&number_of_devices))) {
             hi_log_error("EnumAudioEndpoints()->GetCount() failed: {}", get_last_error_message());
             device_collection->Release();
-            return;
+            return std::nullopt;
         }
 
-        auto old_devices = _devices;
-        _devices.clear();
+        auto r = std::vector<device_update_type>{};
+        r.reserve(number_of_devices);
         for (UINT i = 0; i < number_of_devices; i++) {
             IMMDevice *win32_device;
             if (FAILED(device_collection->Item(i, &win32_device))) {
                 hi_log_error("EnumAudioEndpoints()->Item({}) failed: {}", i, get_last_error_message());
                 device_collection->Release();
-                return;
+                return std::nullopt;
             }
             hi_assert(win32_device);
 
@@ -192,36 +272,59 @@ private:
                 hi_log_error("EnumAudioEndpoints()->Item({})->get_device_id failed: {}", i, e.what());
                 device_collection->Release();
                 win32_device->Release();
-                return;
+                return std::nullopt;
             }
 
-            auto it = std::find_if(old_devices.begin(), old_devices.end(), [&win32_device_id](auto& item) {
-                return item->id() == win32_device_id;
+            auto it = std::find_if(known_devices.begin(), known_devices.end(), [&win32_device_id](auto& item) {
+                return item.first->id() == win32_device_id;
             });
 
-            if (it != old_devices.end()) {
+            if (it != known_devices.end()) {
                 // This device was already instantiated.
                 win32_device->Release();
-                _devices.push_back(std::move(*it));
-                old_devices.erase(it);
-
-                // Let the audio device them self see if anything has changed in their own state.
-                _devices.back()->update_state();
+                auto const& [device, was_active] = *it;
+                r.emplace_back(device, device->probe(not was_active));
 
             } else {
                 auto device =
                     std::allocate_shared<audio_device_win32>(locked_memory_allocator<audio_device_win32>{}, win32_device);
-                // hi_log_info(
-                //    "Found audio device \"{}\", state={}, channels={}, speakers={}",
-                //    device->name(),
-                //    device->state(),
-                //    device->full_num_channels(),
-                //    device->full_channel_mapping());
-                _devices.push_back(std::move(device));
+                auto probe = device->probe(true);
+                r.emplace_back(std::move(device), std::move(probe));
             }
         }
 
         device_collection->Release();
+        return r;
+    }
+
+    /** Replace the device list with the result of an enumeration.
+     *
+     * @param updates The devices found by `enumerate_devices()`.
+     */
+    void publish_device_list(std::optional<std::vector<device_update_type>> updates) noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+        hi_assert(_enumerating);
+        _enumerating = false;
+
+        if (updates) {
+            hi_log_info("Updating audio device list:");
+
+            auto devices = std::vector<std::shared_ptr<audio_device_win32>>{};
+            devices.reserve(updates->size());
+            for (auto& [device, probe] : *updates) {
+                // Let the audio device them self see if anything has changed in their own state.
+                device->update_state(probe);
+                devices.push_back(std::move(device));
+            }
+
+            _devices = std::move(devices);
+            _notifier();
+        }
+
+        if (std::exchange(_enumerate_again, false)) {
+            update_device_list();
+        }
     }
 
     friend class audio_system_win32_notification_client;
@@ -231,8 +334,9 @@ hi_export [[nodiscard]] inline audio_system &audio_system::global() noexcept
 {
     if (not detail::audio_system_global) {
         auto tmp = std::make_unique<audio_system_aggregate>();
+        // The WASAPI audio system initializes COM, which is needed by ASIO.
         tmp->add_child(std::make_unique<audio_system_win32>());
-        // Possibly add asio here as well.
+        tmp->add_child(std::make_unique<audio_system_asio>());
 
         detail::audio_system_global = std::move(tmp);
     }
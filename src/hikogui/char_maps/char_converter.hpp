@@ -84,6 +84,16 @@ hi_export namespace hi { inline namespace v1 {
  * ```
  *  - _chunk_ A chunk of 16 ascii characters. bit 7 is always '0'.
  *  - _ptr_ The pointer to the first code-unit where the ASCII characters must be written to.
+ *
+ *
+ * ### Validate a text (optional).
+ * ```cpp
+ * bool validate(char_type const *first, char_type const *last) const noexcept
+ * ```
+ * When available, `validate()` is used for identity conversions instead of reading each code-point.
+ *  - _first_ A pointer to the first code-unit of the text.
+ *  - _last_ A pointer to one beyond the last code-unit of the text.
+ *  - _return_ True if `read()` would return valid for every code-point in the text.
  */
 template<fixed_string Encoding>
 struct char_map;
@@ -282,6 +292,16 @@ private:
     template<typename It, typename EndIt>
     [[nodiscard]] constexpr std::pair<size_t, bool> _size(It it, EndIt last) const noexcept
     {
+        if constexpr (From == To and std::is_same_v<It, EndIt> and requires { from_encoder_type{}.validate(it, last); }) {
+            if (not std::is_constant_evaluated()) {
+                // For an identity conversion the size is known, only the validity needs to be checked.
+                // A vectorized validation is much faster than reading each code-point.
+                if (from_encoder_type{}.validate(it, last)) {
+                    return {narrow_cast<size_t>(std::distance(it, last)), true};
+                }
+            }
+        }
+
         auto count = 0_uz;
         auto valid = true;
         while (true) {
@@ -12,13 +12,22 @@
 #include "../utility/utility.hpp"
 #include "char_converter.hpp"
 #include "cp_1252.hpp"
+#include <hikocpu/hikocpu.hpp>
 #include <bit>
 #include <utility>
+#include <iterator>
+#include <memory>
+#include <array>
+#include <cstring>
+#include <cstdint>
 #include <cstddef>
 #include <compare>
 #if defined(HI_HAS_SSE2)
 #include <emmintrin.h>
 #endif
+#if HI_PROCESSOR == HI_CPU_X86_64
+#include <immintrin.h>
+#endif
 
 hi_export_module(hikogui.char_maps.utf_8);
 
@@ -29,6 +38,279 @@ hi_warning_ignore_msvc(26490);
 
 hi_export namespace hi { inline namespace v1 {
 
+#if HI_PROCESSOR == HI_CPU_X86_64
+namespace detail {
+
+/** Tables for validating UTF-8 using nibble lookups.
+ *
+ * Each error class gets a bit, the bits are looked up using the high and low
+ * nibble of the previous byte, and the high nibble of the current byte. An
+ * error is found when a bit is set in all three lookups.
+ *
+ * See: John Keiser, Daniel Lemire, "Validating UTF-8 In Less Than One
+ * Instruction Per Byte", Software: Practice and Experience 51 (5), 2021.
+ */
+struct utf8_validate_tables {
+    // 11______ 0_______ or 11______ 11______
+    constexpr static uint8_t too_short = 1 << 0;
+    // 0_______ 10______
+    constexpr static uint8_t too_long = 1 << 1;
+    // 11100000 100_____
+    constexpr static uint8_t overlong_3 = 1 << 2;
+    // 11110100 1001____, 11110100 101_____, 11110101 1001____, ...
+    constexpr static uint8_t too_large = 1 << 3;
+    // 11101101 101_____
+    constexpr static uint8_t surrogate = 1 << 4;
+    // 1100000_ 10______
+    constexpr static uint8_t overlong_2 = 1 << 5;
+    // 11110101 1000____ or 11110000 1000____
+    constexpr static uint8_t too_large_1000 = 1 << 6;
+    constexpr static uint8_t overlong_4 = 1 << 6;
+    // 10______ 10______
+    constexpr static uint8_t two_continuations = 1 << 7;
+    // Errors which do not depend on the low nibble of the first byte.
+    constexpr static uint8_t carry = too_short | too_long | two_continuations;
+
+    constexpr static std::array<uint8_t, 16> byte_1_high = {
+        // 0_______ ________: ASCII
+        too_long,
+        too_long,
+        too_long,
+        too_long,
+        too_long,
+        too_long,
+        too_long,
+        too_long,
+        // 10______ ________: continuation
+        two_continuations,
+        two_continuations,
+        two_continuations,
+        two_continuations,
+        // 1100____ ________: two byte lead
+        too_short | overlong_2,
+        // 1101____ ________: two byte lead
+        too_short,
+        // 1110____ ________: three byte lead
+        too_short | overlong_3 | surrogate,
+        // 1111____ ________: four byte lead
+        too_short | too_large | too_large_1000 | overlong_4};
+
+    constexpr static std::array<uint8_t, 16> byte_1_low = {
+        // ____0000 ________
+        carry | overlong_3 | overlong_2 | overlong_4,
+        // ____0001 ________
+        carry | overlong_2,
+        // ____001_ ________
+        carry,
+        carry,
+        // ____0100 ________
+        carry | too_large,
+        // ____0101 ________
+        carry | too_large | too_large_1000,
+        // ____011_ ________
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        // ____1___ ________
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        // ____1101 ________
+        carry | too_large | too_large_1000 | surrogate,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000};
+
+    constexpr static std::array<uint8_t, 16> byte_2_high = {
+        // ________ 0_______: ASCII
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+        // ________ 1000____
+        too_long | overlong_2 | two_continuations | overlong_3 | too_large_1000 | overlong_4,
+        // ________ 1001____
+        too_long | overlong_2 | two_continuations | overlong_3 | too_large,
+        // ________ 101_____
+        too_long | overlong_2 | two_continuations | surrogate | too_large,
+        too_long | overlong_2 | two_continuations | surrogate | too_large,
+        // ________ 11______: lead
+        too_short,
+        too_short,
+        too_short,
+        too_short};
+
+    /** The maximum value of the last bytes of a block that do not start a sequence that continues into the next block.
+     */
+    constexpr static std::array<uint8_t, 32> incomplete_max = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf};
+};
+
+hi_target("sse2,ssse3") [[nodiscard]] inline __m128i utf8_validate_load_table(std::array<uint8_t, 16> const& table) noexcept
+{
+    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.data()));
+}
+
+/** Check a block of 16 bytes of UTF-8.
+ *
+ * @param input The current block.
+ * @param[in,out] prev_input The previous block, on return the current block.
+ * @param[in,out] prev_incomplete A non-zero byte if the previous block ended in an incomplete sequence.
+ * @param[in,out] error A non-zero byte when an error was found.
+ */
+hi_target("sse2,ssse3") inline void
+utf8_validate_block_ssse3(__m128i input, __m128i& prev_input, __m128i& prev_incomplete, __m128i& error) noexcept
+{
+    using tables = utf8_validate_tables;
+
+    if (_mm_movemask_epi8(input) == 0) {
+        // An ASCII block is only valid if the previous block did not end in an incomplete sequence.
+        error = _mm_or_si128(error, prev_incomplete);
+        prev_incomplete = _mm_setzero_si128();
+
+    } else {
+        auto const nibble_mask = _mm_set1_epi8(0x0f);
+        auto const prev1 = _mm_alignr_epi8(input, prev_input, 15);
+        auto const prev2 = _mm_alignr_epi8(input, prev_input, 14);
+        auto const prev3 = _mm_alignr_epi8(input, prev_input, 13);
+
+        auto const prev1_high = _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble_mask);
+        auto const prev1_low = _mm_and_si128(prev1, nibble_mask);
+        auto const input_high = _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask);
+
+        auto special_cases = _mm_shuffle_epi8(utf8_validate_load_table(tables::byte_1_high), prev1_high);
+        special_cases = _mm_and_si128(special_cases, _mm_shuffle_epi8(utf8_validate_load_table(tables::byte_1_low), prev1_low));
+        special_cases = _mm_and_si128(special_cases, _mm_shuffle_epi8(utf8_validate_load_table(tables::byte_2_high), input_high));
+
+        // The third and fourth byte of a sequence must be a continuation, set bit 7 for those bytes.
+        auto const is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80));
+        auto const is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80));
+        auto const must_be_continuation =
+            _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+
+        error = _mm_or_si128(error, _mm_xor_si128(must_be_continuation, special_cases));
+
+        auto const incomplete_max = _mm_loadu_si128(reinterpret_cast<__m128i const *>(tables::incomplete_max.data() + 16));
+        prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+    }
+    prev_input = input;
+}
+
+/** Validate UTF-8 in blocks of 16 bytes.
+ *
+ * @param ptr A pointer to the UTF-8 text.
+ * @param size The number of bytes of the text.
+ * @return True if the text is valid UTF-8.
+ */
+hi_target("sse2,ssse3") [[nodiscard]] inline bool utf8_validate_ssse3(uint8_t const *ptr, std::size_t size) noexcept
+{
+    auto error = _mm_setzero_si128();
+    auto prev_input = _mm_setzero_si128();
+    auto prev_incomplete = _mm_setzero_si128();
+
+    auto i = 0_uz;
+    for (; i + 16 <= size; i += 16) {
+        auto const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + i));
+        utf8_validate_block_ssse3(input, prev_input, prev_incomplete, error);
+    }
+
+    // The tail is padded with NUL, which also flushes out an incomplete sequence at the end of the text.
+    auto tail = std::array<uint8_t, 16>{};
+    std::memcpy(tail.data(), ptr + i, size - i);
+    utf8_validate_block_ssse3(utf8_validate_load_table(tail), prev_input, prev_incomplete, error);
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xffff;
+}
+
+/** Check a block of 32 bytes of UTF-8.
+ *
+ * @param input The current block.
+ * @param[in,out] prev_input The previous block, on return the current block.
+ * @param[in,out] prev_incomplete A non-zero byte if the previous block ended in an incomplete sequence.
+ * @param[in,out] error A non-zero byte when an error was found.
+ */
+hi_target("sse2,ssse3,sse4.1,avx,avx2") inline void
+utf8_validate_block_avx2(__m256i input, __m256i& prev_input, __m256i& prev_incomplete, __m256i& error) noexcept
+{
+    using tables = utf8_validate_tables;
+
+    if (_mm256_movemask_epi8(input) == 0) {
+        // An ASCII block is only valid if the previous block did not end in an incomplete sequence.
+        error = _mm256_or_si256(error, prev_incomplete);
+        prev_incomplete = _mm256_setzero_si256();
+
+    } else {
+        auto const nibble_mask = _mm256_set1_epi8(0x0f);
+
+        // The _mm256_alignr_epi8() instruction works on each 128 bit lane separately; shift in
+        // the upper lane of the previous block into the lower lane, and the lower lane of the input into the upper lane.
+        auto const shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+        auto const prev1 = _mm256_alignr_epi8(input, shifted, 15);
+        auto const prev2 = _mm256_alignr_epi8(input, shifted, 14);
+        auto const prev3 = _mm256_alignr_epi8(input, shifted, 13);
+
+        auto const prev1_high = _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble_mask);
+        auto const prev1_low = _mm256_and_si256(prev1, nibble_mask);
+        auto const input_high = _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble_mask);
+
+        auto const byte_1_high = _mm256_broadcastsi128_si256(utf8_validate_load_table(tables::byte_1_high));
+        auto const byte_1_low = _mm256_broadcastsi128_si256(utf8_validate_load_table(tables::byte_1_low));
+        auto const byte_2_high = _mm256_broadcastsi128_si256(utf8_validate_load_table(tables::byte_2_high));
+
+        auto special_cases = _mm256_shuffle_epi8(byte_1_high, prev1_high);
+        special_cases = _mm256_and_si256(special_cases, _mm256_shuffle_epi8(byte_1_low, prev1_low));
+        special_cases = _mm256_and_si256(special_cases, _mm256_shuffle_epi8(byte_2_high, input_high));
+
+        // The third and fourth byte of a sequence must be a continuation, set bit 7 for those bytes.
+        auto const is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xe0 - 0x80));
+        auto const is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xf0 - 0x80));
+        auto const must_be_continuation =
+            _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(static_cast<char>(0x80)));
+
+        error = _mm256_or_si256(error, _mm256_xor_si256(must_be_continuation, special_cases));
+
+        auto const incomplete_max = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(tables::incomplete_max.data()));
+        prev_incomplete = _mm256_subs_epu8(input, incomplete_max);
+    }
+    prev_input = input;
+}
+
+/** Validate UTF-8 in blocks of 32 bytes.
+ *
+ * @param ptr A pointer to the UTF-8 text.
+ * @param size The number of bytes of the text.
+ * @return True if the text is valid UTF-8.
+ */
+hi_target("sse2,ssse3,sse4.1,avx,avx2") [[nodiscard]] inline bool
+utf8_validate_avx2(uint8_t const *ptr, std::size_t size) noexcept
+{
+    auto error = _mm256_setzero_si256();
+    auto prev_input = _mm256_setzero_si256();
+    auto prev_incomplete = _mm256_setzero_si256();
+
+    auto i = 0_uz;
+    for (; i + 32 <= size; i += 32) {
+        auto const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr + i));
+        utf8_validate_block_avx2(input, prev_input, prev_incomplete, error);
+    }
+
+    // The tail is padded with NUL, which also flushes out an incomplete sequence at the end of the text.
+    auto tail = std::array<uint8_t, 32>{};
+    std::memcpy(tail.data(), ptr + i, size - i);
+    auto const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(tail.data()));
+    utf8_validate_block_avx2(input, prev_input, prev_incomplete, error);
+
+    return _mm256_testz_si256(error, error) != 0;
+}
+
+} // namespace detail
+#endif
+
 /** Unicode UTF-8 encoding.
  * @ingroup char_maps
  */
@@ -133,6 +415,41 @@ struct char_map<"utf-8"> {
         }
     }
 
+    /** Check if a text is valid UTF-8.
+     *
+     * The text is valid when `read()` would return valid for each code-point.
+     *
+     * @param first An iterator to the first code-unit of the text.
+     * @param last An iterator to one beyond the last code-unit of the text.
+     * @return True if the text is completely valid UTF-8.
+     */
+    template<std::contiguous_iterator It>
+    [[nodiscard]] bool validate(It first, It last) const noexcept
+    {
+        static_assert(sizeof(std::iter_value_t<It>) == 1);
+
+#if HI_PROCESSOR == HI_CPU_X86_64
+        auto const size = narrow_cast<std::size_t>(std::distance(first, last));
+        if (size == 0) {
+            return true;
+        }
+
+        auto const ptr = reinterpret_cast<uint8_t const *>(std::to_address(first));
+        if (has_avx2()) {
+            return detail::utf8_validate_avx2(ptr, size);
+        } else if (has_ssse3()) {
+            return detail::utf8_validate_ssse3(ptr, size);
+        }
+#endif
+
+        while (first != last) {
+            if (not read(first, last).second) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     [[nodiscard]] constexpr std::pair<uint8_t, bool> size(char32_t code_point) const noexcept
     {
         hi_axiom(code_point < 0x11'0000);
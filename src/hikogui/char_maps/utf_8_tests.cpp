@@ -5,6 +5,8 @@
 #include "utf_8.hpp"
 #include "random_char.hpp"
 #include <hikotest/hikotest.hpp>
+#include <array>
+#include <string>
 
 TEST_SUITE(char_maps_utf_8_suite) {
 
@@ -119,4 +121,30 @@ TEST_CASE(identity_invalid_chars)
         REQUIRE(expected == result);
     }
 }
+TEST_CASE(validate)
+{
+    auto valid_tst = std::u8string{};
+    for (size_t i = 0; i != 200; ++i) {
+        push_utf_8(hi::random_char(), valid_tst);
+    }
+
+    for (size_t i = 0; i != valid_tst.size(); ++i) {
+        // Only a text that starts in the middle of a code-point is invalid.
+        auto const test = valid_tst.substr(i);
+        auto const expected = (test.front() & 0xc0) != 0x80;
+        REQUIRE(hi::char_map<"utf-8">{}.validate(test.begin(), test.end()) == expected, std::format("i = {}", i));
+    }
+
+    auto const invalid_tsts = std::array<std::string, 8>{
+        "\x80", "\xc0\x80", "\xe0\x80\x80", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xf8\x88\x80\x80\x80", "\xe2\x82", "\xff"};
+
+    for (auto const& invalid_tst : invalid_tsts) {
+        // Place the invalid sequence at each position in and around a 32 byte block.
+        for (size_t i = 0; i != 40; ++i) {
+            auto const test = std::string(i, 'a') + invalid_tst + std::string(8, 'b');
+            REQUIRE(not hi::char_map<"utf-8">{}.validate(test.begin(), test.end()), std::format("i = {}", i));
+        }
+    }
+}
+
 }; // TEST_SUITE(char_maps_utf_8_suite)
@@ -10,6 +10,7 @@
 #include "../macros.hpp"
 #include <cstddef>
 #include <string>
+#include <string_view>
 
 hi_export_module(hikogui.codec.BON8);
 
@@ -81,6 +82,67 @@ public:
         return output;
     }
 
+    /** The number of encoded bytes that have not been taken.
+     */
+    [[nodiscard]] std::size_t pending_size() const noexcept
+    {
+        return output.size();
+    }
+
+    /** Pre-allocate the buffer for the encoded bytes.
+     */
+    void reserve(std::size_t new_capacity)
+    {
+        output.reserve(new_capacity);
+    }
+
+    /** Take the encoded bytes, keeping the allocation for more bytes.
+     *
+     * Unlike `get()` a string at the end is not terminated, so that the
+     * encoding continues correctly with the next value.
+     *
+     * @param func A function `void(bstring_view)` called with the encoded bytes.
+     */
+    template<typename Func>
+    void take(Func&& func)
+    {
+        std::forward<Func>(func)(bstring_view{output});
+        output.clear();
+    }
+
+    /** Start an array with an unknown number of items.
+     *
+     * The array is terminated by `end_array()`.
+     */
+    void begin_array() noexcept
+    {
+        open_string = false;
+        output += static_cast<std::byte>(BON8_code_array);
+    }
+
+    void end_array() noexcept
+    {
+        open_string = false;
+        output += static_cast<std::byte>(BON8_code_eoc);
+    }
+
+    /** Start an object with an unknown number of members.
+     *
+     * Add each member as a string key followed by its value. The object
+     * is terminated by `end_object()`.
+     */
+    void begin_object() noexcept
+    {
+        open_string = false;
+        output += static_cast<std::byte>(BON8_code_object);
+    }
+
+    void end_object() noexcept
+    {
+        open_string = false;
+        output += static_cast<std::byte>(BON8_code_eoc);
+    }
+
     /** And a signed integer.
      * @param value A signed integer.
      */
@@ -409,7 +471,7 @@ public:
         }
 
         for (auto const& item : items) {
-            if (auto *s = get_if<std::string>(item.first)) {
+            if (auto s = get_if<std::string>(item.first)) {
                 add(*s);
             } else {
                 throw operation_error("BON8 object keys must be strings");
@@ -818,6 +880,101 @@ hi_export [[nodiscard]] inline bstring encode_BON8(datum const& value)
     return encoder.get();
 }
 
+/** Stream a BON8 message to a file.
+ *
+ * The message is built from events, without first creating a `datum`. The
+ * encoded bytes are collected in a buffer which is written to the sink each
+ * time it grows beyond its capacity; the buffer is reused for the next bytes.
+ *
+ * Call `flush()` after the last value; bytes that are not flushed are discarded.
+ *
+ * @tparam Sink A type with a `write(void const *, std::size_t)` member function, like `file`.
+ */
+hi_export template<byte_writer Sink>
+class BON8_writer {
+public:
+    BON8_writer(BON8_writer const&) = delete;
+    BON8_writer(BON8_writer&&) = delete;
+    BON8_writer& operator=(BON8_writer const&) = delete;
+    BON8_writer& operator=(BON8_writer&&) = delete;
+
+    /** Create a writer.
+     *
+     * @param sink The sink to write the encoded bytes to.
+     * @param capacity The number of bytes to collect before writing to the sink.
+     */
+    explicit BON8_writer(Sink& sink, std::size_t capacity = 65536) : _sink(sink), _capacity(capacity)
+    {
+        _encoder.reserve(capacity);
+    }
+
+    void begin_array()
+    {
+        _encoder.begin_array();
+    }
+
+    void end_array()
+    {
+        _encoder.end_array();
+        spill();
+    }
+
+    void begin_object()
+    {
+        _encoder.begin_object();
+    }
+
+    void end_object()
+    {
+        _encoder.end_object();
+        spill();
+    }
+
+    /** Add the name of the next member of an object.
+     *
+     * @param name A valid UTF-8 string.
+     */
+    void key(std::string_view name)
+    {
+        _encoder.add(name);
+    }
+
+    /** Add a value.
+     *
+     * @param value An integer, floating point, boolean, nullptr, string, datum,
+     *              or a vector or map of those.
+     */
+    template<typename T>
+    void value(T const& value)
+    {
+        _encoder.add(value);
+        spill();
+    }
+
+    /** Terminate the message and write all the buffered bytes to the sink.
+     */
+    void flush()
+    {
+        auto const& bytes = _encoder.get();
+        _sink.write(bytes.data(), bytes.size());
+        _encoder.take([](bstring_view) {});
+    }
+
+private:
+    Sink& _sink;
+    std::size_t _capacity;
+    detail::BON8_encoder _encoder;
+
+    void spill()
+    {
+        if (_encoder.pending_size() >= _capacity) {
+            _encoder.take([&](bstring_view bytes) {
+                _sink.write(bytes.data(), bytes.size());
+            });
+        }
+    }
+};
+
 } // namespace hi::inline v1
 
 hi_warning_pop();
@@ -0,0 +1,49 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "BON8.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <format>
+#include <span>
+
+/** A message with an array of records.
+ */
+[[nodiscard]] static hi::datum BON8_benchmark_message()
+{
+    auto records = hi::datum::make_vector();
+    for (auto i = 0; i != 1000; ++i) {
+        auto record = hi::datum::make_map();
+        record["id"] = i;
+        record["name"] = std::format("record {}", i);
+        record["value"] = i * 3 + 0.5;
+        record["enabled"] = i % 2 == 0;
+        record["tags"] = hi::datum::make_vector("alpha", "beta", "gamma");
+        records.push_back(std::move(record));
+    }
+
+    auto r = hi::datum::make_map();
+    r["version"] = 1;
+    r["records"] = std::move(records);
+    return r;
+}
+
+hi_benchmark(encode_BON8)
+{
+    auto const message = BON8_benchmark_message();
+
+    state.set_bytes_per_iteration(hi::encode_BON8(message).size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::encode_BON8(message));
+    }
+}
+
+hi_benchmark(decode_BON8)
+{
+    auto const bytes = hi::encode_BON8(BON8_benchmark_message());
+
+    state.set_bytes_per_iteration(bytes.size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::decode_BON8(std::span<std::byte const>{bytes.data(), bytes.size()}));
+    }
+}
@@ -5,6 +5,7 @@
 #include "BON8.hpp"
 #include "../utility/utility.hpp"
 #include <hikotest/hikotest.hpp>
+#include <format>
 
 TEST_SUITE(BON8_suite) {
 
@@ -76,4 +77,58 @@ TEST_CASE(decode_negative_integers)
         hi::decode_BON8(hi::to_bstring(0x8d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)));
 }
 
+struct bstring_sink {
+    hi::bstring bytes;
+
+    void write(void const *data, std::size_t size)
+    {
+        bytes.append(static_cast<std::byte const *>(data), size);
+    }
+};
+
+TEST_CASE(writer_events)
+{
+    auto sink = bstring_sink{};
+    auto writer = hi::BON8_writer{sink};
+
+    writer.begin_object();
+    writer.key("foo");
+    writer.value("bar");
+    writer.key("baz");
+    writer.begin_array();
+    writer.value(1);
+    writer.value("a");
+    writer.value("b");
+    writer.end_array();
+    writer.end_object();
+    writer.flush();
+
+    auto expected = hi::datum::make_map();
+    expected["foo"] = "bar";
+    expected["baz"] = hi::datum::make_vector(1, "a", "b");
+    REQUIRE(hi::decode_BON8(sink.bytes) == expected);
+}
+
+TEST_CASE(writer_reuse_buffer)
+{
+    auto sink = bstring_sink{};
+    auto writer = hi::BON8_writer{sink, 16};
+
+    auto expected = hi::datum::make_vector();
+    writer.begin_array();
+    for (auto i = 0; i != 100; ++i) {
+        writer.value(std::format("item {}", i));
+        expected.push_back(std::format("item {}", i));
+    }
+    writer.end_array();
+    writer.value("last");
+    writer.flush();
+
+    hi::cbyteptr ptr = sink.bytes.data();
+    hi::cbyteptr const last = ptr + sink.bytes.size();
+    REQUIRE(hi::detail::decode_BON8(ptr, last) == expected);
+    REQUIRE(hi::detail::decode_BON8(ptr, last) == hi::datum{"last"});
+    REQUIRE(ptr == last);
+}
+
 }; // TEST_SUITE(BON8_suite)
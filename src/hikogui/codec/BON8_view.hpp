@@ -0,0 +1,626 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/BON8_view.hpp Read-only access to a BON8 message, without building a datum tree.
+ */
+
+#pragma once
+
+#include "BON8.hpp"
+#include "datum.hpp"
+#include "../container/container.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <optional>
+#include <iterator>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.BON8_view);
+
+hi_export namespace hi { inline namespace v1 {
+namespace detail {
+
+/** Check if the value at @a ptr is a string.
+ */
+[[nodiscard]] inline bool BON8_is_string(cbyteptr ptr, cbyteptr last)
+{
+    hi_axiom(ptr != last);
+    auto const c = static_cast<uint8_t>(*ptr);
+    if (c <= 0x7f or c == BON8_code_eot) {
+        return true;
+    } else if (c >= 0xc2 and c <= 0xf7) {
+        return BON8_multibyte_count(ptr, last) > 0;
+    } else {
+        return false;
+    }
+}
+
+/** Skip over a string, while validating it.
+ *
+ * @param[in,out] ptr The pointer to the first byte of the string, on return this points
+ *                    beyond the string, including its end-of-text when present.
+ * @param last The pointer beyond the buffer.
+ * @throws parse_error When the string is not correctly encoded, or not terminated
+ *         before the end of the buffer.
+ */
+inline void BON8_skip_string(cbyteptr& ptr, cbyteptr last)
+{
+    while (ptr != last) {
+        auto const c = static_cast<uint8_t>(*ptr);
+        if (c <= 0x7f) {
+            ++ptr;
+
+        } else if (c == BON8_code_eot) {
+            ++ptr;
+            return;
+
+        } else if (c >= 0xc2 and c <= 0xf7) {
+            auto const count = BON8_multibyte_count(ptr, last);
+            if (count < 0) {
+                // A multi-byte integer follows the string.
+                return;
+            }
+            for (auto i = 1; i != count; ++i) {
+                auto const cu = static_cast<uint8_t>(ptr[i]);
+                hi_check(cu >= 0x80 and cu <= 0xbf, "Invalid continuation code-unit in string");
+            }
+            ptr += count;
+
+        } else {
+            // A non-string value follows the string.
+            return;
+        }
+    }
+    throw parse_error("Unexpected end-of-buffer");
+}
+
+inline void BON8_skip(cbyteptr& ptr, cbyteptr last);
+
+/** Skip over the values of an array or the members of an object, while validating them.
+ *
+ * @param[in,out] ptr The pointer to the first value, on return this points beyond the container.
+ * @param last The pointer beyond the buffer.
+ * @param count The number of values or members, or -1 when terminated by end-of-container.
+ * @param is_object True when skipping the members of an object.
+ * @throws parse_error When a value is not correctly encoded.
+ */
+inline void BON8_skip_container(cbyteptr& ptr, cbyteptr last, int count, bool is_object)
+{
+    while (count != 0) {
+        hi_check(ptr != last, "Incomplete container at end of buffer");
+        if (count < 0 and *ptr == static_cast<std::byte>(BON8_code_eoc)) {
+            ++ptr;
+            return;
+        }
+
+        if (is_object) {
+            hi_check(BON8_is_string(ptr, last), "Key in object is not a string");
+            BON8_skip_string(ptr, last);
+        }
+        BON8_skip(ptr, last);
+
+        if (count > 0) {
+            --count;
+        }
+    }
+}
+
+/** Skip over a BON8 encoded value, while validating it.
+ *
+ * @param[in,out] ptr The pointer to the first byte of the value.
+ *                     On return this points beyond the value.
+ * @param last The pointer beyond the buffer.
+ * @throws parse_error When the value is not correctly encoded.
+ */
+inline void BON8_skip(cbyteptr& ptr, cbyteptr last)
+{
+    hi_check(ptr != last, "Unexpected end-of-buffer");
+
+    auto const c = static_cast<uint8_t>(*ptr);
+    if (c <= 0x7f or c == BON8_code_eot) {
+        return BON8_skip_string(ptr, last);
+
+    } else if (c >= 0xc2 and c <= 0xf7) {
+        auto const count = BON8_multibyte_count(ptr, last);
+        if (count > 0) {
+            return BON8_skip_string(ptr, last);
+        } else {
+            ptr += -count;
+            return;
+        }
+    }
+
+    ++ptr;
+    switch (c) {
+    case BON8_code_int32:
+    case BON8_code_binary32:
+        hi_check(last - ptr >= 4, "Incomplete number at end of buffer");
+        ptr += 4;
+        return;
+    case BON8_code_int64:
+    case BON8_code_binary64:
+        hi_check(last - ptr >= 8, "Incomplete number at end of buffer");
+        ptr += 8;
+        return;
+    case BON8_code_array:
+        return BON8_skip_container(ptr, last, -1, false);
+    case BON8_code_object:
+        return BON8_skip_container(ptr, last, -1, true);
+    case BON8_code_eoc:
+        throw parse_error("Unexpected end-of-container");
+    default:
+        if (c >= BON8_code_array_count0 and c <= BON8_code_array_count4) {
+            return BON8_skip_container(ptr, last, c - BON8_code_array_count0, false);
+        } else if (c >= BON8_code_object_count0 and c <= BON8_code_object_count4) {
+            return BON8_skip_container(ptr, last, c - BON8_code_object_count0, true);
+        } else {
+            // Small integers, booleans, null and the floating point constants.
+            return;
+        }
+    }
+}
+
+} // namespace detail
+
+/** A read-only view of a value in a BON8 message.
+ *
+ * The view refers directly to the encoded bytes: strings are returned as a
+ * `std::string_view` into the message, and numbers are only decoded when
+ * requested. Navigating a message does not allocate memory.
+ *
+ * A view is created with `decode_BON8_view()`, which validates the complete
+ * message in a single pass; after this the accessors can not fail on
+ * malformed input. The message must outlive all views into it.
+ */
+class BON8_view {
+public:
+    /** An iterator over the items of an array, or the interleaved keys and values of an object.
+     */
+    class const_iterator {
+    public:
+        using value_type = BON8_view;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr const_iterator() noexcept = default;
+
+        const_iterator(cbyteptr ptr, cbyteptr end, int count) noexcept : _ptr(ptr), _next(ptr), _end(end), _count(count)
+        {
+            find_next();
+        }
+
+        [[nodiscard]] BON8_view operator*() const noexcept
+        {
+            hi_axiom(_count != 0);
+            return BON8_view{_ptr, _next, _end};
+        }
+
+        const_iterator& operator++() noexcept
+        {
+            hi_axiom(_count != 0);
+            _ptr = _next;
+            if (_count > 0) {
+                --_count;
+            }
+            find_next();
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] constexpr friend bool operator==(const_iterator const& lhs, std::default_sentinel_t) noexcept
+        {
+            return lhs._count == 0;
+        }
+
+    private:
+        cbyteptr _ptr = nullptr;
+
+        /** One beyond the current value.
+         */
+        cbyteptr _next = nullptr;
+        cbyteptr _end = nullptr;
+
+        /** The number of values left, or -1 when the container is terminated by end-of-container.
+         */
+        int _count = 0;
+
+        /** Find the end of the current value, or detect the end-of-container.
+         */
+        void find_next() noexcept
+        {
+            if (_count < 0 and *_ptr == static_cast<std::byte>(detail::BON8_code_eoc)) {
+                _count = 0;
+            }
+            if (_count != 0) {
+                // The message was validated by `decode_BON8_view()`, so this can not throw.
+                _next = _ptr;
+                detail::BON8_skip(_next, _end);
+            }
+        }
+    };
+
+    /** The items of an array.
+     */
+    class items_range {
+    public:
+        constexpr items_range(const_iterator first) noexcept : _first(first) {}
+
+        [[nodiscard]] constexpr const_iterator begin() const noexcept
+        {
+            return _first;
+        }
+
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept
+        {
+            return {};
+        }
+
+    private:
+        const_iterator _first;
+    };
+
+    /** The key and value of each member of an object.
+     */
+    class members_range {
+    public:
+        class const_iterator {
+        public:
+            using value_type = std::pair<std::string_view, BON8_view>;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr const_iterator() noexcept = default;
+            constexpr const_iterator(BON8_view::const_iterator it) noexcept : _it(it) {}
+
+            [[nodiscard]] value_type operator*() const noexcept
+            {
+                auto it = _it;
+                auto const key = *it;
+                return {key.string(), *++it};
+            }
+
+            const_iterator& operator++() noexcept
+            {
+                ++_it;
+                ++_it;
+                return *this;
+            }
+
+            const_iterator operator++(int) noexcept
+            {
+                auto tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            [[nodiscard]] constexpr friend bool operator==(const_iterator const& lhs, std::default_sentinel_t rhs) noexcept
+            {
+                return lhs._it == rhs;
+            }
+
+        private:
+            BON8_view::const_iterator _it;
+        };
+
+        constexpr members_range(BON8_view::const_iterator first) noexcept : _first(first) {}
+
+        [[nodiscard]] constexpr const_iterator begin() const noexcept
+        {
+            return _first;
+        }
+
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept
+        {
+            return {};
+        }
+
+    private:
+        BON8_view::const_iterator _first;
+    };
+
+    constexpr BON8_view() noexcept = default;
+    constexpr BON8_view(BON8_view const&) noexcept = default;
+    constexpr BON8_view(BON8_view&&) noexcept = default;
+    constexpr BON8_view& operator=(BON8_view const&) noexcept = default;
+    constexpr BON8_view& operator=(BON8_view&&) noexcept = default;
+
+    /** Create a view of an already validated value.
+     *
+     * @param first The first byte of the encoded value.
+     * @param last One beyond the last byte of the encoded value.
+     * @param end One beyond the last byte of the message.
+     */
+    constexpr BON8_view(cbyteptr first, cbyteptr last, cbyteptr end) noexcept : _first(first), _last(last), _end(end)
+    {
+        hi_axiom(_first != _last);
+        hi_axiom(_last <= _end);
+    }
+
+    [[nodiscard]] bool is_null() const noexcept
+    {
+        return code() == detail::BON8_code_null;
+    }
+
+    [[nodiscard]] bool is_bool() const noexcept
+    {
+        return code() == detail::BON8_code_bool_false or code() == detail::BON8_code_bool_true;
+    }
+
+    [[nodiscard]] bool is_integer() const noexcept
+    {
+        auto const c = code();
+        return c == detail::BON8_code_int32 or c == detail::BON8_code_int64 or
+            (c >= detail::BON8_code_positive_s and c <= detail::BON8_code_negative_e) or
+            (c >= 0xc2 and c <= 0xf7 and not is_string());
+    }
+
+    [[nodiscard]] bool is_float() const noexcept
+    {
+        auto const c = code();
+        return c == detail::BON8_code_binary32 or c == detail::BON8_code_binary64 or
+            (c >= detail::BON8_code_float_min_one and c <= detail::BON8_code_float_one);
+    }
+
+    [[nodiscard]] bool is_string() const noexcept
+    {
+        return detail::BON8_is_string(_first, _last);
+    }
+
+    [[nodiscard]] bool is_array() const noexcept
+    {
+        return code() >= detail::BON8_code_array_count0 and code() <= detail::BON8_code_array;
+    }
+
+    [[nodiscard]] bool is_object() const noexcept
+    {
+        return code() >= detail::BON8_code_object_count0 and code() <= detail::BON8_code_object;
+    }
+
+    /** The encoded bytes of this value.
+     */
+    [[nodiscard]] constexpr bstring_view raw() const noexcept
+    {
+        return bstring_view{_first, narrow_cast<std::size_t>(_last - _first)};
+    }
+
+    /** Get the boolean.
+     *
+     * @throws parse_error When this is not a boolean.
+     */
+    [[nodiscard]] bool get_bool() const
+    {
+        hi_check(is_bool(), "BON8 value is not a boolean");
+        return code() == detail::BON8_code_bool_true;
+    }
+
+    /** Get the integer.
+     *
+     * @throws parse_error When this is not an integer.
+     */
+    [[nodiscard]] long long get_integer() const
+    {
+        hi_check(is_integer(), "BON8 value is not an integer");
+
+        auto const c = code();
+        if (c == detail::BON8_code_int32) {
+            return truncate<int32_t>(truncate<uint32_t>(big_endian(4)));
+        } else if (c == detail::BON8_code_int64) {
+            return truncate<int64_t>(big_endian(8));
+        } else if (c >= detail::BON8_code_positive_s and c <= detail::BON8_code_positive_e) {
+            return c - detail::BON8_code_positive_s;
+        } else if (c >= detail::BON8_code_negative_s and c <= detail::BON8_code_negative_e) {
+            return ~truncate<long long>(c - detail::BON8_code_negative_s);
+        } else {
+            auto ptr = _first;
+            return detail::decode_BON8_UTF8_like_int(ptr, _last, narrow_cast<int>(_last - _first));
+        }
+    }
+
+    /** Get the floating point number.
+     *
+     * @throws parse_error When this is not a floating point number.
+     */
+    [[nodiscard]] double get_float() const
+    {
+        hi_check(is_float(), "BON8 value is not a floating point number");
+
+        switch (code()) {
+        case detail::BON8_code_float_min_one:
+            return -1.0;
+        case detail::BON8_code_float_zero:
+            return 0.0;
+        case detail::BON8_code_float_one:
+            return 1.0;
+        case detail::BON8_code_binary32:
+            {
+                auto const u32 = truncate<uint32_t>(big_endian(4));
+                float f32;
+                std::memcpy(&f32, &u32, sizeof(f32));
+                return f32;
+            }
+        default:
+            {
+                auto const u64 = big_endian(8);
+                double f64;
+                std::memcpy(&f64, &u64, sizeof(f64));
+                return f64;
+            }
+        }
+    }
+
+    /** Get the string.
+     *
+     * @return A view of the UTF-8 string inside the message.
+     * @throws parse_error When this is not a string.
+     */
+    [[nodiscard]] std::string_view string() const
+    {
+        hi_check(is_string(), "BON8 value is not a string");
+
+        auto size = narrow_cast<std::size_t>(_last - _first);
+        if (_last[-1] == static_cast<std::byte>(detail::BON8_code_eot)) {
+            --size;
+        }
+        return std::string_view{reinterpret_cast<char const *>(_first), size};
+    }
+
+    /** Build a datum of this value, including all the nested values.
+     */
+    [[nodiscard]] datum to_datum() const
+    {
+        auto ptr = _first;
+        return detail::decode_BON8(ptr, _end);
+    }
+
+    /** The items of an array.
+     *
+     * @throws parse_error When this is not an array.
+     */
+    [[nodiscard]] items_range items() const
+    {
+        hi_check(is_array(), "BON8 value is not an array");
+        return items_range{children()};
+    }
+
+    /** The key and value of each member of an object.
+     *
+     * @throws parse_error When this is not an object.
+     */
+    [[nodiscard]] members_range members() const
+    {
+        hi_check(is_object(), "BON8 value is not an object");
+        return members_range{children()};
+    }
+
+    /** The number of items of an array, or the number of members of an object.
+     *
+     * @throws parse_error When this is not an array or object.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        auto const c = code();
+        if (c >= detail::BON8_code_array_count0 and c <= detail::BON8_code_array_count4) {
+            return c - detail::BON8_code_array_count0;
+        } else if (c >= detail::BON8_code_object_count0 and c <= detail::BON8_code_object_count4) {
+            return c - detail::BON8_code_object_count0;
+        }
+
+        hi_check(is_array() or is_object(), "BON8 value is not an array or object");
+        auto r = 0_uz;
+        for (auto it = children(); it != std::default_sentinel; ++it) {
+            ++r;
+        }
+        return is_object() ? r / 2 : r;
+    }
+
+    /** Get an item of an array.
+     *
+     * @param index The index of the item.
+     * @return The item, or empty when the index is beyond the end of the array.
+     * @throws parse_error When this is not an array.
+     */
+    [[nodiscard]] std::optional<BON8_view> item(std::size_t index) const
+    {
+        for (auto const item : items()) {
+            if (index-- == 0) {
+                return item;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /** Get the value of a member of an object.
+     *
+     * When the name appears more than once, the first one is returned; just like
+     * the map created by `decode_BON8()`.
+     *
+     * @param name The name of the member.
+     * @return The value, or empty when the object has no member with this name.
+     * @throws parse_error When this is not an object.
+     */
+    [[nodiscard]] std::optional<BON8_view> member(std::string_view name) const
+    {
+        for (auto const [key, value] : members()) {
+            if (key == name) {
+                return value;
+            }
+        }
+        return std::nullopt;
+    }
+
+private:
+    cbyteptr _first = nullptr;
+    cbyteptr _last = nullptr;
+
+    /** The end of the message.
+     *
+     * A string inside a container may be terminated by the next value instead of
+     * an end-of-text, so values are skipped up to the end of the message.
+     */
+    cbyteptr _end = nullptr;
+
+    [[nodiscard]] uint8_t code() const noexcept
+    {
+        hi_axiom_not_null(_first);
+        return static_cast<uint8_t>(*_first);
+    }
+
+    /** Read a big-endian number following the code.
+     */
+    [[nodiscard]] uint64_t big_endian(int count) const noexcept
+    {
+        hi_axiom(_last - _first == count + 1);
+        auto r = uint64_t{0};
+        for (auto i = 1; i <= count; ++i) {
+            r <<= 8;
+            r |= static_cast<uint64_t>(_first[i]);
+        }
+        return r;
+    }
+
+    /** An iterator to the first value inside an array or object.
+     */
+    [[nodiscard]] const_iterator children() const noexcept
+    {
+        auto const c = code();
+        if (c == detail::BON8_code_array or c == detail::BON8_code_object) {
+            return const_iterator{_first + 1, _end, -1};
+        } else if (c <= detail::BON8_code_array_count4) {
+            return const_iterator{_first + 1, _end, c - detail::BON8_code_array_count0};
+        } else {
+            return const_iterator{_first + 1, _end, (c - detail::BON8_code_object_count0) * 2};
+        }
+    }
+};
+
+/** Validate a BON8 message and get a view of its value.
+ *
+ * The message is validated in a single pass, without allocating memory.
+ *
+ * @param buffer A buffer to a BON8 encoded message, which must outlive the view.
+ * @return A view of the value in the message.
+ * @throws parse_error When the message is not correctly encoded, or when there
+ *         are bytes beyond the message.
+ */
+[[nodiscard]] inline BON8_view decode_BON8_view(bstring_view buffer)
+{
+    auto const first = buffer.data();
+    auto const last = first + buffer.size();
+
+    auto ptr = first;
+    detail::BON8_skip(ptr, last);
+    hi_check(ptr == last, "Unexpected data after the BON8 message");
+    return BON8_view{first, last, last};
+}
+
+}} // namespace hi::v1
@@ -0,0 +1,154 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "BON8_view.hpp"
+#include "BON8.hpp"
+#include "../utility/utility.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <limits>
+
+TEST_SUITE(BON8_view_suite) {
+
+[[nodiscard]] static hi::datum make_store()
+{
+    auto book = hi::datum::make_vector();
+    for (auto i = 0; i != 6; ++i) {
+        auto item = hi::datum::make_map();
+        item["author"] = std::string{"author "} + std::to_string(i);
+        item["price"] = 8.5 + i;
+        item["stock"] = i * 1000 - 2000;
+        book.push_back(item);
+    }
+
+    auto r = hi::datum::make_map();
+    r["book"] = book;
+    r["name"] = "caf\xc3\xa9";
+    r["empty"] = "";
+    r["flags"] = hi::datum::make_vector(true, false, nullptr);
+    return r;
+}
+
+TEST_CASE(navigate)
+{
+    auto const message = hi::encode_BON8(make_store());
+    auto const root = hi::decode_BON8_view(message);
+
+    REQUIRE(root.is_object());
+    REQUIRE(root.size() == 4);
+
+    auto const book = root.member("book");
+    REQUIRE(book.has_value());
+    REQUIRE(book->is_array());
+    REQUIRE(book->size() == 6);
+
+    auto const author = book->item(5)->member("author");
+    REQUIRE(author->is_string());
+    REQUIRE(author->string() == "author 5");
+    REQUIRE(book->item(5)->member("price")->get_float() == 13.5);
+    REQUIRE(book->item(0)->member("stock")->get_integer() == -2000);
+    REQUIRE(book->item(4)->member("stock")->get_integer() == 2000);
+    REQUIRE(not book->item(6));
+
+    REQUIRE(root.member("name")->string() == "caf\xc3\xa9");
+    REQUIRE(root.member("empty")->string().empty());
+    REQUIRE(not root.member("nothing"));
+
+    auto const flags = root.member("flags");
+    REQUIRE(flags->item(0)->get_bool());
+    REQUIRE(not flags->item(1)->get_bool());
+    REQUIRE(flags->item(2)->is_null());
+}
+
+TEST_CASE(string_refers_to_message)
+{
+    auto const message = hi::encode_BON8(make_store());
+    auto const name = hi::decode_BON8_view(message).member("name")->string();
+
+    auto const *first = reinterpret_cast<char const *>(message.data());
+    REQUIRE(name.data() >= first and name.data() + name.size() <= first + message.size());
+}
+
+TEST_CASE(iterate)
+{
+    auto const message = hi::encode_BON8(make_store());
+    auto const root = hi::decode_BON8_view(message);
+
+    auto keys = std::vector<std::string_view>{};
+    for (auto const [key, value] : root.members()) {
+        keys.push_back(key);
+    }
+    REQUIRE((keys == std::vector<std::string_view>{"book", "empty", "flags", "name"}));
+
+    auto total = 0.0;
+    for (auto const book : root.member("book")->items()) {
+        total += book.member("price")->get_float();
+    }
+    REQUIRE(total == 8.5 * 6 + 15.0);
+}
+
+TEST_CASE(numbers)
+{
+    auto const values = std::vector<long long>{
+        0,
+        39,
+        40,
+        -1,
+        -10,
+        -11,
+        3879,
+        3880,
+        528167,
+        528168,
+        -264075,
+        67637031,
+        67637032,
+        std::numeric_limits<int32_t>::min(),
+        std::numeric_limits<long long>::max(),
+        std::numeric_limits<long long>::min()};
+
+    for (auto const value : values) {
+        auto const message = hi::encode_BON8(hi::datum{value});
+        auto const view = hi::decode_BON8_view(message);
+        REQUIRE(view.is_integer());
+        REQUIRE(view.get_integer() == value);
+    }
+
+    for (auto const value : {-1.0, 0.0, 1.0, 0.5, 0.1}) {
+        auto const message = hi::encode_BON8(hi::datum{value});
+        auto const view = hi::decode_BON8_view(message);
+        REQUIRE(view.is_float());
+        REQUIRE(view.get_float() == value);
+    }
+}
+
+TEST_CASE(to_datum)
+{
+    auto const store = make_store();
+    auto const message = hi::encode_BON8(store);
+    auto const root = hi::decode_BON8_view(message);
+
+    REQUIRE(root.to_datum() == store);
+    REQUIRE(root.member("book")->item(2)->to_datum() == store["book"][2]);
+    REQUIRE(root.member("name")->to_datum() == hi::datum{"caf\xc3\xa9"});
+}
+
+TEST_CASE(errors)
+{
+    REQUIRE_THROWS(hi::decode_BON8_view(hi::bstring{}), hi::parse_error);
+    REQUIRE_THROWS(hi::decode_BON8_view(hi::to_bstring(0x85, 0x91)), hi::parse_error);
+    REQUIRE_THROWS(hi::decode_BON8_view(hi::to_bstring(0x87, 0x91, 0x91)), hi::parse_error);
+    REQUIRE_THROWS(hi::decode_BON8_view(hi::to_bstring(0x8c, 0x00, 0x00)), hi::parse_error);
+    REQUIRE_THROWS(hi::decode_BON8_view(hi::to_bstring(0xe0, 0x80, 0x00)), hi::parse_error);
+    REQUIRE_THROWS(hi::decode_BON8_view(hi::to_bstring(0xfe)), hi::parse_error);
+    REQUIRE_THROWS(hi::decode_BON8_view(hi::to_bstring(0x90, 0x90)), hi::parse_error);
+
+    auto const message = hi::encode_BON8(hi::datum{42});
+    REQUIRE_THROWS(hi::decode_BON8_view(message).string(), hi::parse_error);
+    REQUIRE_THROWS(hi::decode_BON8_view(message).items(), hi::parse_error);
+}
+
+};
@@ -69,7 +69,8 @@ template<std::input_iterator It, std::sentinel_for<It> ItEnd>
 template<std::input_iterator It, std::sentinel_for<It> ItEnd>
 [[nodiscard]] constexpr std::optional<datum> json_parse_object(It& it, ItEnd last, std::string_view path)
 {
-    auto r = datum::make_map();
+    // The items are sorted once at the end, instead of inserting each one into a sorted map.
+    auto items = datum::map_type::container_type{};
 
     // Required '{'
     if (*it == '{') {
@@ -101,7 +102,7 @@ template<std::input_iterator It, std::sentinel_for<It> ItEnd>
             }
 
             if (auto result = json_parse_value(it, last, path)) {
-                r[name] = std::move(*result);
+                items.emplace_back(datum{std::move(name)}, std::move(*result));
 
             } else {
                 throw parse_error(
@@ -121,7 +122,7 @@ template<std::input_iterator It, std::sentinel_for<It> ItEnd>
         }
     }
 
-    return r;
+    return datum{datum::map_type{std::move(items)}};
 }
 
 template<std::input_iterator It, std::sentinel_for<It> ItEnd>
@@ -246,10 +247,10 @@ hi_export constexpr void format_JSON_impl(datum const& value, std::string& resul
     } else if (auto const *b = get_if<bool>(value)) {
         result += *b ? "true" : "false";
     } else if (auto const *i = get_if<long long>(value)) {
-        result += hi::to_string(*i);
+        append_to_string(result, *i);
     } else if (auto const *f = get_if<double>(value)) {
-        result += hi::to_string(*f);
-    } else if (auto const *s = get_if<std::string>(value)) {
+        append_to_string(result, *f);
+    } else if (auto const s = get_if<std::string>(value)) {
         result += '"';
         for (auto const c : *s) {
             switch (c) {
@@ -0,0 +1,83 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "JSON.hpp"
+#include "JSON_fast.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <format>
+#include <string>
+
+/** A JSON document with an array of records, like a configuration or a theme file.
+ */
+[[nodiscard]] static std::string JSON_benchmark_text()
+{
+    auto r = std::string{"{\"version\": 1, \"records\": [\n"};
+    for (auto i = 0; i != 1000; ++i) {
+        r += std::format(
+            "    {{\"id\": {}, \"name\": \"record \\\"{}\\\"\", \"value\": {}.5, \"enabled\": {}, "
+            "\"tags\": [\"alpha\", \"beta\", \"gamma\"], \"parent\": null}}{}\n",
+            i,
+            i,
+            i * 3,
+            i % 2 == 0 ? "true" : "false",
+            i == 999 ? "" : ",");
+    }
+    r += "]}\n";
+    return r;
+}
+
+hi_benchmark(parse_JSON)
+{
+    auto const text = JSON_benchmark_text();
+
+    state.set_bytes_per_iteration(text.size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::parse_JSON(text));
+    }
+}
+
+hi_benchmark(parse_JSON_fast)
+{
+    auto const text = JSON_benchmark_text();
+
+    state.set_bytes_per_iteration(text.size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::parse_JSON_fast(text));
+    }
+}
+
+/** A JSON document with arrays of sensor readings, mostly numbers.
+ */
+[[nodiscard]] static std::string JSON_numbers_benchmark_text()
+{
+    auto r = std::string{"{\"sensors\": [\n"};
+    for (auto i = 0; i != 100; ++i) {
+        r += std::format("    {{\"id\": {}, \"timestamp\": {}, \"samples\": [", i, 1'700'000'000'000LL + i * 1000);
+        for (auto j = 0; j != 100; ++j) {
+            r += std::format("{}{}.{:03}", j == 0 ? "" : ", ", (i * 37 + j * 11) % 2000 - 1000, (i * 7 + j * 13) % 1000);
+        }
+        r += i == 99 ? "]}\n" : "]},\n";
+    }
+    r += "]}\n";
+    return r;
+}
+
+hi_benchmark(parse_JSON_fast_numbers)
+{
+    auto const text = JSON_numbers_benchmark_text();
+
+    state.set_bytes_per_iteration(text.size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::parse_JSON_fast(text));
+    }
+}
+
+hi_benchmark(format_JSON_numbers)
+{
+    auto const value = hi::parse_JSON_fast(JSON_numbers_benchmark_text());
+
+    while (state.running()) {
+        hi::do_not_optimize(hi::format_JSON(value));
+    }
+}
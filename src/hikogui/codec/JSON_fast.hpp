@@ -0,0 +1,742 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/JSON_fast.hpp A two stage JSON parser.
+ *
+ * The first stage scans the text 64 bytes at a time and builds an index of
+ * the structural characters: the operators `{}[]:,` outside of strings,
+ * the opening quote of each string and the first character of each literal.
+ * On x86-64 the characters are classified with SIMD instructions, selected at
+ * runtime based on the features of the CPU. Quotes escaped with a backslash
+ * and the characters inside strings are found with bit-manipulation on the
+ * 64-bit masks, without branching on each character.
+ *
+ * The second stage walks the index and builds the `datum` directly from the
+ * text, without producing tokens.
+ */
+
+#pragma once
+
+#include "JSON.hpp"
+#include "datum.hpp"
+#include "../file/file.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <span>
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <limits>
+#include <filesystem>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#if HI_PROCESSOR == HI_CPU_X86_64
+#include <immintrin.h>
+#endif
+
+hi_export_module(hikogui.codec.JSON_fast);
+
+hi_warning_push();
+// C26490: Don't use reinterpret_cast (type.1).
+// Needed for loading SIMD registers.
+hi_warning_ignore_msvc(26490);
+
+hi_export namespace hi { inline namespace v1 {
+namespace detail {
+
+/** Bit-masks of the characters in a block of 64 bytes.
+ *
+ * Bit `i` of each mask corresponds to the character at offset `i` in the block.
+ */
+struct json_block_masks {
+    uint64_t quote = 0;
+    uint64_t backslash = 0;
+    uint64_t slash = 0;
+    uint64_t whitespace = 0;
+    uint64_t op = 0;
+};
+
+[[nodiscard]] constexpr json_block_masks json_classify_block_generic(char const *ptr) noexcept
+{
+    auto r = json_block_masks{};
+    for (auto i = 0; i != 64; ++i) {
+        auto const bit = uint64_t{1} << i;
+        switch (ptr[i]) {
+        case '"':
+            r.quote |= bit;
+            break;
+        case '\\':
+            r.backslash |= bit;
+            break;
+        case '/':
+            r.slash |= bit;
+            break;
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+            r.whitespace |= bit;
+            break;
+        case '{':
+        case '}':
+        case '[':
+        case ']':
+        case ':':
+        case ',':
+            r.op |= bit;
+            break;
+        default:;
+        }
+    }
+    return r;
+}
+
+#if HI_PROCESSOR == HI_CPU_X86_64
+hi_target("sse2") [[nodiscard]] inline json_block_masks json_classify_block_sse2(char const *ptr) noexcept
+{
+    auto r = json_block_masks{};
+
+    for (auto i = 0; i != 4; ++i) {
+        auto const chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + i * 16));
+        // Setting bit 5 maps '[' and ']' onto '{' and '}', halving the compares for the brackets.
+        auto const lower = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+
+        auto const quote = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('"'));
+        auto const backslash = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'));
+        auto const slash = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('/'));
+        auto const whitespace = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r'))));
+        auto const op = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(lower, _mm_set1_epi8('{')), _mm_cmpeq_epi8(lower, _mm_set1_epi8('}'))),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(':')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8(','))));
+
+        auto const shift = i * 16;
+        r.quote |= uint64_t{static_cast<uint16_t>(_mm_movemask_epi8(quote))} << shift;
+        r.backslash |= uint64_t{static_cast<uint16_t>(_mm_movemask_epi8(backslash))} << shift;
+        r.slash |= uint64_t{static_cast<uint16_t>(_mm_movemask_epi8(slash))} << shift;
+        r.whitespace |= uint64_t{static_cast<uint16_t>(_mm_movemask_epi8(whitespace))} << shift;
+        r.op |= uint64_t{static_cast<uint16_t>(_mm_movemask_epi8(op))} << shift;
+    }
+
+    return r;
+}
+
+hi_target("avx2") [[nodiscard]] inline json_block_masks json_classify_block_avx2(char const *ptr) noexcept
+{
+    auto r = json_block_masks{};
+
+    for (auto i = 0; i != 2; ++i) {
+        auto const chunk = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr + i * 32));
+        // Setting bit 5 maps '[' and ']' onto '{' and '}', halving the compares for the brackets.
+        auto const lower = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+
+        auto const quote = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('"'));
+        auto const backslash = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\'));
+        auto const slash = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('/'));
+        auto const whitespace = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\r'))));
+        auto const op = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(lower, _mm256_set1_epi8('}'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(','))));
+
+        auto const shift = i * 32;
+        r.quote |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(quote))} << shift;
+        r.backslash |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(backslash))} << shift;
+        r.slash |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(slash))} << shift;
+        r.whitespace |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(whitespace))} << shift;
+        r.op |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(op))} << shift;
+    }
+
+    return r;
+}
+#endif
+
+/** Find the characters that are escaped by a backslash.
+ *
+ * A character is escaped when it is preceded by an odd number of backslashes.
+ *
+ * @param backslash The mask of backslashes in the block.
+ * @param[in,out] carry Set when the first character of the next block is escaped.
+ * @return The mask of escaped characters.
+ */
+[[nodiscard]] constexpr uint64_t json_escaped_mask(uint64_t backslash, uint64_t& carry) noexcept
+{
+    constexpr auto even_bits = uint64_t{0x5555'5555'5555'5555};
+
+    // A backslash that is escaped itself does not start an escape sequence.
+    backslash &= ~carry;
+    auto const follows_escape = (backslash << 1) | carry;
+
+    // Sequences of backslashes that start on an odd bit; when added to the
+    // backslash mask the carry ripples to the end of each sequence.
+    auto const odd_sequence_starts = backslash & ~even_bits & ~follows_escape;
+    auto const sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+    carry = sequences_starting_on_even_bits < odd_sequence_starts ? 1 : 0;
+
+    auto const invert_mask = sequences_starting_on_even_bits << 1;
+    return (even_bits ^ invert_mask) & follows_escape;
+}
+
+/** Calculate for each bit the xor of itself with all the lower bits.
+ *
+ * When applied to the mask of quotes, bits are set from an opening quote up to,
+ * but not including, the closing quote.
+ */
+[[nodiscard]] constexpr uint64_t json_prefix_xor(uint64_t x) noexcept
+{
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+template<json_block_masks (*Classify)(char const *) noexcept>
+[[nodiscard]] inline bool json_structural_index_impl(std::string_view text, std::vector<uint32_t>& index)
+{
+    auto escaped_carry = uint64_t{0};
+    auto in_string_carry = uint64_t{0};
+    auto scalar_carry = uint64_t{0};
+    auto tail = std::array<char, 64>{};
+
+    for (auto offset = 0_uz; offset < text.size(); offset += 64) {
+        auto ptr = text.data() + offset;
+        if (text.size() - offset < 64) {
+            // Pad the last block with white-space, which is never structural.
+            tail.fill(' ');
+            std::memcpy(tail.data(), ptr, text.size() - offset);
+            ptr = tail.data();
+        }
+
+        auto const masks = Classify(ptr);
+
+        auto const quote = masks.quote & ~json_escaped_mask(masks.backslash, escaped_carry);
+        auto const in_string = json_prefix_xor(quote) ^ in_string_carry;
+        in_string_carry = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+        if (masks.slash & ~in_string) [[unlikely]] {
+            // A comment, which may contain quotes; handled by json_structural_index_with_comments().
+            return false;
+        }
+
+        // The first character of each literal: true, false, null and numbers.
+        auto const scalar = ~(masks.op | masks.whitespace | quote) & ~in_string;
+        auto const scalar_start = scalar & ~((scalar << 1) | scalar_carry);
+        scalar_carry = scalar >> 63;
+
+        auto structurals = (masks.op & ~in_string) | (quote & in_string) | scalar_start;
+        while (structurals != 0) {
+            index.push_back(narrow_cast<uint32_t>(offset + std::countr_zero(structurals)));
+            structurals &= structurals - 1;
+        }
+    }
+
+    return true;
+}
+
+/** Build the index of structural characters of a JSON text with `//` line comments.
+ *
+ * This is a character-by-character scan, used for the small configuration files that have comments.
+ */
+inline void json_structural_index_with_comments(std::string_view text, std::vector<uint32_t>& index)
+{
+    index.clear();
+
+    auto in_literal = false;
+    for (auto i = 0_uz; i < text.size(); ++i) {
+        switch (text[i]) {
+        case '"':
+            index.push_back(narrow_cast<uint32_t>(i));
+            in_literal = false;
+            for (++i; i < text.size() and text[i] != '"'; ++i) {
+                if (text[i] == '\\') {
+                    ++i;
+                }
+            }
+            break;
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+            in_literal = false;
+            break;
+        case '{':
+        case '}':
+        case '[':
+        case ']':
+        case ':':
+        case ',':
+            index.push_back(narrow_cast<uint32_t>(i));
+            in_literal = false;
+            break;
+        case '/':
+            if (i + 1 < text.size() and text[i + 1] == '/') {
+                i = std::min(text.find('\n', i), text.size());
+                in_literal = false;
+            } else {
+                // Not part of a literal, so that the parser reports it.
+                index.push_back(narrow_cast<uint32_t>(i));
+                in_literal = true;
+            }
+            break;
+        default:
+            if (not in_literal) {
+                index.push_back(narrow_cast<uint32_t>(i));
+                in_literal = true;
+            }
+            // Same as json_structural_index_impl(), a backslash escapes a quote even outside a string.
+            if (text[i] == '\\' and i + 1 < text.size() and (text[i + 1] == '"' or text[i + 1] == '\\')) {
+                ++i;
+            }
+        }
+    }
+}
+
+/** Build the index of structural characters of a JSON text.
+ *
+ * @param text The JSON text, at most 4 GiB.
+ * @param[out] index The offsets of the structural characters.
+ */
+inline void json_structural_index(std::string_view text, std::vector<uint32_t>& index)
+{
+    hi_axiom(text.size() <= std::numeric_limits<uint32_t>::max());
+
+    index.clear();
+    // A rough estimate, most JSON documents have a structural character every 4 to 8 bytes.
+    index.reserve(text.size() / 4 + 1);
+
+    auto const complete = [&] {
+#if HI_PROCESSOR == HI_CPU_X86_64
+        if (has_avx2()) {
+            return json_structural_index_impl<json_classify_block_avx2>(text, index);
+        } else if (has_sse2()) {
+            return json_structural_index_impl<json_classify_block_sse2>(text, index);
+        }
+#endif
+        return json_structural_index_impl<json_classify_block_generic>(text, index);
+    }();
+
+    if (not complete) {
+        json_structural_index_with_comments(text, index);
+    }
+}
+
+/** Builds a datum from the text and its structural index.
+ */
+class json_fast_parser {
+public:
+    json_fast_parser(std::string_view text, std::span<uint32_t const> index, std::string_view path) noexcept :
+        _text(text), _it(index.data()), _last(index.data() + index.size()), _path(path)
+    {
+    }
+
+    [[nodiscard]] datum parse()
+    {
+        if (_it == _last) {
+            throw parse_error(std::format("{}: No tokens found", location()));
+        }
+
+        auto r = parse_value();
+
+        if (_it != _last) {
+            throw parse_error(std::format("{}: Unexpected text after JSON root object", location()));
+        }
+        return r;
+    }
+
+    /** Parse the value at the current structural character, and advance beyond it.
+     */
+    [[nodiscard]] datum parse_value()
+    {
+        switch (peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"':
+            return datum{parse_string()};
+        case '\0':
+            throw parse_error(std::format("{}: Expecting a JSON value", location()));
+        default:
+            return parse_literal();
+        }
+    }
+
+    /** Parse the string at the current structural character, and advance beyond it.
+     */
+    [[nodiscard]] std::string parse_string()
+    {
+        hi_axiom(peek() == '"');
+
+        auto const first = *_it + 1;
+        auto const last = _text.find('"', first);
+        if (last == std::string_view::npos) {
+            throw parse_error(std::format("{}: Incomplete string", location()));
+        }
+
+        auto const str = _text.substr(first, last - first);
+        if (str.find('\\') == std::string_view::npos) [[likely]] {
+            ++_it;
+            return std::string{str};
+        }
+
+        auto r = parse_escaped_string(first);
+        ++_it;
+        return r;
+    }
+
+private:
+    std::string_view _text;
+    uint32_t const *_it;
+    uint32_t const *_last;
+    std::string_view _path;
+
+    /** The location of the current structural character, in the same format as `token_location()`.
+     */
+    [[nodiscard]] std::string location() const noexcept
+    {
+        if (_it == _last) {
+            return std::format("{}:eof", _path);
+        }
+
+        auto const offset = *_it;
+        auto line_nr = 0_uz;
+        auto line_start = 0_uz;
+        for (auto i = 0_uz; i != offset; ++i) {
+            if (_text[i] == '\n') {
+                ++line_nr;
+                line_start = i + 1;
+            }
+        }
+        return std::format("{}:{}:{}", _path, line_nr + 1, offset - line_start + 1);
+    }
+
+    [[nodiscard]] char peek() const noexcept
+    {
+        return _it == _last ? '\0' : _text[*_it];
+    }
+
+    /** The literal starting at the current structural character.
+     */
+    [[nodiscard]] std::string_view literal() const noexcept
+    {
+        hi_axiom(_it != _last);
+
+        auto const first = *_it;
+        auto last = first + 1;
+        while (last != _text.size()) {
+            switch (_text[last]) {
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',':
+            case '"':
+            case '/':
+                return _text.substr(first, last - first);
+            default:
+                ++last;
+            }
+        }
+        return _text.substr(first);
+    }
+
+    [[nodiscard]] datum parse_array()
+    {
+        hi_axiom(peek() == '[');
+        ++_it;
+
+        auto r = datum::vector_type{};
+        auto comma_after_value = true;
+        while (true) {
+            auto const c = peek();
+            if (c == ']') {
+                ++_it;
+                break;
+
+            } else if (c == '\0') {
+                throw parse_error(std::format("{}: Expecting ']'", location()));
+
+            } else if (c == ',' or c == ':' or c == '}') {
+                throw parse_error(std::format("{}: Expecting a JSON value, found '{}'", location(), c));
+
+            } else if (not comma_after_value) {
+                throw parse_error(std::format("{}: Expecting ',', found '{}'", location(), c));
+            }
+
+            r.push_back(parse_value());
+
+            if (peek() == ',') {
+                ++_it;
+                comma_after_value = true;
+            } else {
+                comma_after_value = false;
+            }
+        }
+
+        return datum{std::move(r)};
+    }
+
+    [[nodiscard]] datum parse_object()
+    {
+        hi_axiom(peek() == '{');
+        ++_it;
+
+        // The items are sorted once at the end, instead of inserting each one into a sorted map.
+        auto items = datum::map_type::container_type{};
+        auto comma_after_value = true;
+        while (true) {
+            auto const c = peek();
+            if (c == '}') {
+                ++_it;
+                break;
+
+            } else if (c == '\0') {
+                throw parse_error(std::format("{}: Expecting '}}'.", location()));
+
+            } else if (c != '"') {
+                throw parse_error(std::format("{}: Unexpected '{}', expected a key or close-brace.", location(), c));
+
+            } else if (not comma_after_value) {
+                throw parse_error(std::format("{}: Expecting ',', found '{}'.", location(), c));
+            }
+
+            auto name = parse_string();
+
+            if (peek() == ':') {
+                ++_it;
+            } else {
+                throw parse_error(std::format("{}: Expecting ':'.", location()));
+            }
+
+            items.emplace_back(datum{std::move(name)}, parse_value());
+
+            if (peek() == ',') {
+                ++_it;
+                comma_after_value = true;
+            } else {
+                comma_after_value = false;
+            }
+        }
+
+        return datum{datum::map_type{std::move(items)}};
+    }
+
+    [[nodiscard]] hi_no_inline std::string parse_escaped_string(std::size_t first)
+    {
+        auto r = std::string{};
+
+        auto i = first;
+        while (i != _text.size()) {
+            auto const c = _text[i++];
+            if (c == '"') {
+                return r;
+
+            } else if (c != '\\') {
+                r += c;
+
+            } else if (i == _text.size()) {
+                break;
+
+            } else {
+                switch (auto const e = _text[i++]) {
+                case '"':
+                case '\\':
+                case '/':
+                    r += e;
+                    break;
+                case 'b':
+                    r += '\b';
+                    break;
+                case 'f':
+                    r += '\f';
+                    break;
+                case 'n':
+                    r += '\n';
+                    break;
+                case 'r':
+                    r += '\r';
+                    break;
+                case 't':
+                    r += '\t';
+                    break;
+                case 'u':
+                    append_code_point(r, parse_unicode_escape(i));
+                    break;
+                default:
+                    throw parse_error(std::format("{}: Invalid escape sequence '\\{}' in string", location(), e));
+                }
+            }
+        }
+        throw parse_error(std::format("{}: Incomplete string", location()));
+    }
+
+    [[nodiscard]] char32_t parse_hex4(std::size_t& i) const
+    {
+        auto r = uint16_t{0};
+        if (i + 4 > _text.size() or std::from_chars(_text.data() + i, _text.data() + i + 4, r, 16).ptr != _text.data() + i + 4) {
+            throw parse_error(std::format("{}: Invalid \\u escape sequence in string", location()));
+        }
+        i += 4;
+        return r;
+    }
+
+    /** Parse the hex-digits of a `\u` escape, combining a surrogate pair into a single code-point.
+     */
+    [[nodiscard]] char32_t parse_unicode_escape(std::size_t& i) const
+    {
+        auto const high = parse_hex4(i);
+        if (high < 0xd800 or high > 0xdbff) {
+            return high;
+        }
+
+        if (i + 2 > _text.size() or _text[i] != '\\' or _text[i + 1] != 'u') {
+            throw parse_error(std::format("{}: Missing low surrogate in string", location()));
+        }
+        i += 2;
+
+        auto const low = parse_hex4(i);
+        if (low < 0xdc00 or low > 0xdfff) {
+            throw parse_error(std::format("{}: Invalid low surrogate in string", location()));
+        }
+        return ((high - 0xd800) << 10 | (low - 0xdc00)) + 0x10000;
+    }
+
+    static void append_code_point(std::string& str, char32_t cp) noexcept
+    {
+        if (cp < 0x80) {
+            str += char_cast<char>(cp);
+        } else if (cp < 0x800) {
+            str += char_cast<char>(0xc0 | (cp >> 6));
+            str += char_cast<char>(0x80 | (cp & 0x3f));
+        } else if (cp < 0x1'0000) {
+            str += char_cast<char>(0xe0 | (cp >> 12));
+            str += char_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+            str += char_cast<char>(0x80 | (cp & 0x3f));
+        } else {
+            str += char_cast<char>(0xf0 | (cp >> 18));
+            str += char_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+            str += char_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+            str += char_cast<char>(0x80 | (cp & 0x3f));
+        }
+    }
+
+    [[nodiscard]] datum parse_literal()
+    {
+        auto const str = literal();
+
+        if (str == "true") {
+            ++_it;
+            return datum{true};
+
+        } else if (str == "false") {
+            ++_it;
+            return datum{false};
+
+        } else if (str == "null") {
+            ++_it;
+            return datum{nullptr};
+        }
+
+        auto const first = str.data();
+        auto const last = str.data() + str.size();
+
+        if (str.find_first_of(".eE") == std::string_view::npos) {
+            auto value = 0LL;
+            auto const [ptr, ec] = from_chars_fast(first, last, value);
+            if (ec == std::errc{} and ptr == last) {
+                ++_it;
+                return datum{value};
+            } else if (ec != std::errc::result_out_of_range) {
+                throw parse_error(std::format("{}: Unexpected '{}', expected a JSON value", location(), str));
+            }
+            // Integers that do not fit in a long long are returned as a double.
+        }
+
+        auto value = 0.0;
+        auto const [ptr, ec] = from_chars_fast(first, last, value);
+        if (ec != std::errc{} or ptr != last) {
+            throw parse_error(std::format("{}: Unexpected '{}', expected a JSON value", location(), str));
+        }
+        ++_it;
+        return datum{value};
+    }
+};
+
+} // namespace detail
+
+/** Parse a JSON string using a SIMD structural index.
+ *
+ * This is faster than `parse_JSON()` for large documents. Unlike `parse_JSON()`
+ * escape sequences in strings are decoded. When the document is larger than
+ * 4 GiB, the text is parsed with `parse_JSON()`.
+ *
+ * @param text The text to parse.
+ * @param path The path of the file being parsed, used in error messages.
+ * @return A datum representing the parsed object.
+ * @throw parse_error When the text is not valid JSON.
+ */
+hi_export [[nodiscard]] inline datum parse_JSON_fast(std::string_view text, std::string_view path = std::string_view{"<none>"})
+{
+    if (text.size() > std::numeric_limits<uint32_t>::max()) {
+        return parse_JSON(text, path);
+    }
+
+    auto index = std::vector<uint32_t>{};
+    detail::json_structural_index(text, index);
+
+    return detail::json_fast_parser{text, index, path}.parse();
+}
+
+/** Parse a JSON string using a SIMD structural index.
+ * @param text The text to parse.
+ * @return A datum representing the parsed object.
+ */
+hi_export [[nodiscard]] inline datum parse_JSON_fast(std::string const& text, std::string_view path = std::string_view{"<none>"})
+{
+    return parse_JSON_fast(std::string_view{text}, path);
+}
+
+/** Parse a JSON string using a SIMD structural index.
+ * @param text The text to parse.
+ * @return A datum representing the parsed object.
+ */
+hi_export [[nodiscard]] inline datum parse_JSON_fast(char const *text, std::string_view path = std::string_view{"<none>"})
+{
+    return parse_JSON_fast(std::string_view{text}, path);
+}
+
+/** Parse a JSON file using a SIMD structural index.
+ *
+ * The file is memory-mapped and the datum is built directly from the mapping.
+ *
+ * @param path A path pointing to the file to parse.
+ * @return A datum representing the parsed object.
+ * @throw parse_error When the file is not valid JSON.
+ */
+hi_export [[nodiscard]] inline datum parse_JSON_fast(std::filesystem::path const& path)
+{
+    auto const view = file_view(path);
+    return parse_JSON_fast(as_string_view(view), path.string());
+}
+
+}} // namespace hi::v1
+
+hi_warning_pop();
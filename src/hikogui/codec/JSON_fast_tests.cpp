@@ -0,0 +1,81 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "JSON_fast.hpp"
+#include "../utility/utility.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <vector>
+
+TEST_SUITE(JSON_fast_suite) {
+
+TEST_CASE(same_as_parse_JSON)
+{
+    auto const samples = std::vector<std::string>{
+        "{}",
+        "[]",
+        "42",
+        "-42",
+        "42.5",
+        "-1e3",
+        "true",
+        "null",
+        "\"foo\"",
+        "{\"foo\": 42}",
+        "{\"foo\": [true, false, null]}",
+        "{\"foo\": {\"bar\": 42, \"baz\": 43,}}",
+        "{\"foo\": 42, \"bar\": 44, \"foo\": 43}",
+        "[1, [2, [3, []]], {\"a\": \"b\"},]",
+        "  {\n\t\"foo\" :\r\n \"bar\" }  \n"};
+
+    for (auto const& sample : samples) {
+        REQUIRE(hi::parse_JSON_fast(sample) == hi::parse_JSON(sample));
+    }
+}
+
+TEST_CASE(comments)
+{
+    auto expected = hi::datum::make_map();
+    expected["foo"] = 42;
+    REQUIRE(hi::parse_JSON_fast("{\n// a \"comment\n\"foo\": 42}") == expected);
+}
+
+TEST_CASE(escapes)
+{
+    REQUIRE(hi::parse_JSON_fast("\"a\\\"b\\\\\"") == hi::datum{"a\"b\\"});
+    REQUIRE(hi::parse_JSON_fast("\"\\n\\t\\/\"") == hi::datum{"\n\t/"});
+    REQUIRE(hi::parse_JSON_fast("\"\\u00e9\\ud83d\\ude00\"") == hi::datum{"\xc3\xa9\xf0\x9f\x98\x80"});
+}
+
+TEST_CASE(long_document)
+{
+    // Strings, escapes and numbers crossing the boundaries of the 64 byte blocks.
+    auto text = std::string{"["};
+    auto expected = hi::datum::make_vector();
+    for (auto i = 0; i != 200; ++i) {
+        auto str = std::string(i % 70, 'x');
+        str += "\\\\\\\"";
+        text += std::format("\"{}\", {}, ", str, i * 1000);
+        expected.push_back(std::string(i % 70, 'x') + "\\\"");
+        expected.push_back(i * 1000);
+    }
+    text += "]";
+
+    REQUIRE(hi::parse_JSON_fast(text) == expected);
+}
+
+TEST_CASE(errors)
+{
+    REQUIRE_THROWS(hi::parse_JSON_fast(""), hi::parse_error);
+    REQUIRE_THROWS(hi::parse_JSON_fast("[1 2]"), hi::parse_error);
+    REQUIRE_THROWS(hi::parse_JSON_fast("[1,"), hi::parse_error);
+    REQUIRE_THROWS(hi::parse_JSON_fast("{\"foo\" 42}"), hi::parse_error);
+    REQUIRE_THROWS(hi::parse_JSON_fast("{42: 42}"), hi::parse_error);
+    REQUIRE_THROWS(hi::parse_JSON_fast("\"foo"), hi::parse_error);
+    REQUIRE_THROWS(hi::parse_JSON_fast("\"foo\\\""), hi::parse_error);
+    REQUIRE_THROWS(hi::parse_JSON_fast("[tru]"), hi::parse_error);
+    REQUIRE_THROWS(hi::parse_JSON_fast("{} {}"), hi::parse_error);
+}
+
+};
@@ -104,4 +104,12 @@ TEST_CASE(ParseTwoItemObject)
     REQUIRE(hi::parse_JSON("{\"foo\": {\"bar\": 42, \"baz\": 43,}}") == expected);
 }
 
+TEST_CASE(ParseDuplicateKey)
+{
+    auto expected = hi::datum::make_map();
+    expected["foo"] = 43;
+    expected["bar"] = 44;
+    REQUIRE(hi::parse_JSON("{\"foo\": 42, \"bar\": 44, \"foo\": 43}") == expected);
+}
+
 };
@@ -0,0 +1,696 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/JSON_view.hpp Read-only access to a JSON text, without building a datum tree.
+ */
+
+#pragma once
+
+#include "JSON_fast.hpp"
+#include "jsonpath.hpp"
+#include "datum.hpp"
+#include "../file/file.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <optional>
+#include <utility>
+#include <limits>
+#include <filesystem>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.JSON_view);
+
+hi_export namespace hi { inline namespace v1 {
+
+class json_view;
+class jsonpath_set;
+
+/** A JSON text with its structural index.
+ *
+ * The structural index is built when the document is opened, see `codec/JSON_fast.hpp`.
+ * The end of each array and object is found lazily, the first time the array or
+ * object is skipped over, and then remembered for later queries.
+ *
+ * The values are accessed through `json_view`, which refers directly into the
+ * text. Strings are only unescaped, and numbers only parsed, when requested.
+ *
+ * @note A json_document is not thread-safe, not even for const access.
+ */
+class json_document {
+public:
+    json_document(json_document const&) = delete;
+    json_document(json_document&&) = delete;
+    json_document& operator=(json_document const&) = delete;
+    json_document& operator=(json_document&&) = delete;
+
+    /** Open a JSON document in a memory mapped file.
+     *
+     * @param path The path to the file.
+     * @throw io_error When the file could not be mapped.
+     * @throw parse_error When the file is larger than 4 GiB.
+     */
+    explicit json_document(std::filesystem::path const& path) : _file(path), _path(path.string())
+    {
+        _text = as_string_view(_file);
+        build_index();
+    }
+
+    /** Open a JSON document in memory.
+     *
+     * @param text The JSON text, which must outlive the document.
+     * @param path The path used in error messages.
+     * @throw parse_error When the text is larger than 4 GiB.
+     */
+    explicit json_document(std::string_view text, std::string_view path = std::string_view{"<none>"}) :
+        _path(path), _text(text)
+    {
+        build_index();
+    }
+
+    explicit json_document(std::string const& text, std::string_view path = std::string_view{"<none>"}) :
+        json_document(std::string_view{text}, path)
+    {
+    }
+
+    explicit json_document(char const *text, std::string_view path = std::string_view{"<none>"}) :
+        json_document(std::string_view{text}, path)
+    {
+    }
+
+    /** The root value of the document.
+     *
+     * @throw parse_error When the document is empty, or has text after the root value.
+     */
+    [[nodiscard]] json_view root() const;
+
+    /** Get the position in the structural index one beyond the value at @a position.
+     *
+     * @throw parse_error When the array or object is not closed.
+     */
+    [[nodiscard]] uint32_t skip(uint32_t position) const
+    {
+        auto const c = at(position);
+        if (c != '{' and c != '[') {
+            return position + 1;
+        }
+
+        if (_close.empty()) {
+            _close.resize(_index.size(), 0);
+        }
+
+        if (_close[position] == 0) {
+            find_close(position);
+        }
+        return _close[position] + 1;
+    }
+
+    /** The character at a position in the structural index.
+     *
+     * @return The structural character, or nul beyond the end of the index.
+     */
+    [[nodiscard]] char at(uint32_t position) const noexcept
+    {
+        return position < _index.size() ? _text[_index[position]] : '\0';
+    }
+
+    /** The offset in the text of a position in the structural index.
+     */
+    [[nodiscard]] uint32_t offset(uint32_t position) const noexcept
+    {
+        return position < _index.size() ? _index[position] : narrow_cast<uint32_t>(_text.size());
+    }
+
+    [[nodiscard]] std::string_view text() const noexcept
+    {
+        return _text;
+    }
+
+    /** A parser positioned at @a position.
+     */
+    [[nodiscard]] detail::json_fast_parser parser(uint32_t position) const noexcept
+    {
+        hi_axiom(position <= _index.size());
+        return detail::json_fast_parser{_text, std::span{_index}.subspan(position), _path};
+    }
+
+    /** Throw a parse_error with the location of @a position.
+     */
+    [[noreturn]] void throw_error(uint32_t position, std::string_view message) const
+    {
+        auto const offset_ = offset(position);
+        auto line_nr = 0_uz;
+        auto line_start = 0_uz;
+        for (auto i = 0_uz; i != offset_; ++i) {
+            if (_text[i] == '\n') {
+                ++line_nr;
+                line_start = i + 1;
+            }
+        }
+        throw parse_error(std::format("{}:{}:{}: {}", _path, line_nr + 1, offset_ - line_start + 1, message));
+    }
+
+private:
+    file_view _file;
+    std::string _path;
+    std::string_view _text;
+    std::vector<uint32_t> _index;
+
+    /** The position of the matching close bracket of each open bracket, zero when not yet known.
+     */
+    mutable std::vector<uint32_t> _close;
+
+    void build_index()
+    {
+        if (_text.size() > std::numeric_limits<uint32_t>::max()) {
+            throw parse_error(std::format("{}: JSON document larger than 4 GiB", _path));
+        }
+        detail::json_structural_index(_text, _index);
+    }
+
+    /** Find the matching close bracket of @a position and of all the brackets nested inside.
+     */
+    void find_close(uint32_t position) const
+    {
+        auto stack = std::vector<uint32_t>{};
+        for (auto i = position; i != _index.size(); ++i) {
+            auto const c = _text[_index[i]];
+            if (c == '{' or c == '[') {
+                if (_close[i] != 0) {
+                    // Already known from an earlier scan.
+                    i = _close[i];
+                    continue;
+                }
+                stack.push_back(i);
+
+            } else if (c == '}' or c == ']') {
+                if (stack.empty()) {
+                    throw_error(i, std::format("Unexpected '{}'", c));
+                }
+
+                auto const open = stack.back();
+                if ((_text[_index[open]] == '{') != (c == '}')) {
+                    throw_error(i, std::format("Unexpected '{}'", c));
+                }
+
+                _close[open] = i;
+                stack.pop_back();
+                if (stack.empty()) {
+                    return;
+                }
+            }
+        }
+        throw_error(position, _text[_index[position]] == '{' ? "Missing '}' of object" : "Missing ']' of array");
+    }
+};
+
+/** A read-only view of a value in a json_document.
+ *
+ * A json_view is cheap to copy. It is only valid as long as its json_document.
+ */
+class json_view {
+public:
+    constexpr json_view() noexcept = default;
+    constexpr json_view(json_view const&) noexcept = default;
+    constexpr json_view(json_view&&) noexcept = default;
+    constexpr json_view& operator=(json_view const&) noexcept = default;
+    constexpr json_view& operator=(json_view&&) noexcept = default;
+
+    constexpr json_view(json_document const& document, uint32_t position) noexcept :
+        _document(std::addressof(document)), _position(position)
+    {
+    }
+
+    [[nodiscard]] bool is_null() const noexcept
+    {
+        return literal() == "null";
+    }
+
+    [[nodiscard]] bool is_bool() const noexcept
+    {
+        auto const str = literal();
+        return str == "true" or str == "false";
+    }
+
+    [[nodiscard]] bool is_number() const noexcept
+    {
+        auto const c = kind();
+        return c == '-' or (c >= '0' and c <= '9');
+    }
+
+    [[nodiscard]] bool is_string() const noexcept
+    {
+        return kind() == '"';
+    }
+
+    [[nodiscard]] bool is_array() const noexcept
+    {
+        return kind() == '[';
+    }
+
+    [[nodiscard]] bool is_object() const noexcept
+    {
+        return kind() == '{';
+    }
+
+    /** The JSON text of this value.
+     *
+     * For arrays and objects this includes the brackets and all the nested values.
+     */
+    [[nodiscard]] std::string_view raw() const
+    {
+        hi_axiom_not_null(_document);
+
+        auto const text = _document->text();
+        auto const first = _document->offset(_position);
+        if (is_array() or is_object()) {
+            auto const last = _document->offset(_document->skip(_position) - 1) + 1;
+            return text.substr(first, last - first);
+
+        } else if (is_string()) {
+            return string_view_with_quotes();
+
+        } else {
+            return literal();
+        }
+    }
+
+    /** The text of a string, without the quotes and with the escape sequences still in place.
+     *
+     * @throw parse_error When this is not a string.
+     */
+    [[nodiscard]] std::string_view raw_string() const
+    {
+        if (not is_string()) {
+            _document->throw_error(_position, "Expecting a string");
+        }
+        auto const str = string_view_with_quotes();
+        return str.substr(1, str.size() - 2);
+    }
+
+    /** The string, with the escape sequences decoded.
+     *
+     * @throw parse_error When this is not a string, or has invalid escape sequences.
+     */
+    [[nodiscard]] std::string string() const
+    {
+        if (not is_string()) {
+            _document->throw_error(_position, "Expecting a string");
+        }
+        return _document->parser(_position).parse_string();
+    }
+
+    /** Build a datum of this value, including all the nested values.
+     *
+     * @throw parse_error When the value is not valid JSON.
+     */
+    [[nodiscard]] datum to_datum() const
+    {
+        hi_axiom_not_null(_document);
+        return _document->parser(_position).parse_value();
+    }
+
+    /** The items of an array, or the values of an object.
+     *
+     * @throw parse_error When the array or object is not valid JSON.
+     */
+    [[nodiscard]] std::vector<json_view> items() const
+    {
+        auto r = std::vector<json_view>{};
+        if (is_array()) {
+            for_each_item([&](json_view item) {
+                r.push_back(item);
+                return true;
+            });
+
+        } else if (is_object()) {
+            for_each_member([&](json_view, json_view value) {
+                r.push_back(value);
+                return true;
+            });
+        }
+        return r;
+    }
+
+    /** The name and value of each member of an object.
+     *
+     * @throw parse_error When the object is not valid JSON.
+     */
+    [[nodiscard]] std::vector<std::pair<json_view, json_view>> members() const
+    {
+        auto r = std::vector<std::pair<json_view, json_view>>{};
+        if (is_object()) {
+            for_each_member([&](json_view name, json_view value) {
+                r.emplace_back(name, value);
+                return true;
+            });
+        }
+        return r;
+    }
+
+    /** The number of items of an array, or the number of members of an object.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        auto r = 0_uz;
+        if (is_array()) {
+            for_each_item([&](json_view) {
+                ++r;
+                return true;
+            });
+
+        } else if (is_object()) {
+            for_each_member([&](json_view, json_view) {
+                ++r;
+                return true;
+            });
+        }
+        return r;
+    }
+
+    /** Get an item of an array.
+     *
+     * @param index The index of the item.
+     * @return The item, or empty when this is not an array or the index is out of range.
+     */
+    [[nodiscard]] std::optional<json_view> item(std::size_t index) const
+    {
+        auto r = std::optional<json_view>{};
+        if (is_array()) {
+            for_each_item([&](json_view item) {
+                if (index-- == 0) {
+                    r = item;
+                    return false;
+                }
+                return true;
+            });
+        }
+        return r;
+    }
+
+    /** Get the value of a member of an object.
+     *
+     * Like `parse_JSON()`, when a name appears multiple times the last member wins.
+     *
+     * @param name The name of the member.
+     * @return The value, or empty when this is not an object or has no member with this name.
+     */
+    [[nodiscard]] std::optional<json_view> member(std::string_view name) const
+    {
+        auto r = std::optional<json_view>{};
+        if (is_object()) {
+            for_each_member([&](json_view name_, json_view value) {
+                if (name_.string_equal(name)) {
+                    r = value;
+                }
+                return true;
+            });
+        }
+        return r;
+    }
+
+    /** Find values by path.
+     *
+     * @param path The json path to the values.
+     * @return The values, in the same order as `datum::find()`.
+     */
+    [[nodiscard]] std::vector<json_view> find(jsonpath const& path) const
+    {
+        auto r = std::vector<json_view>{};
+        find(path.cbegin(), path.cend(), r);
+        return r;
+    }
+
+    /** Find a value by path.
+     *
+     * @param path The json path to the value. Path must be singular.
+     * @return The value, or empty when not found.
+     */
+    [[nodiscard]] std::optional<json_view> find_one(jsonpath const& path) const
+    {
+        hi_axiom(path.is_singular());
+
+        auto r = find(path);
+        if (r.empty()) {
+            return std::nullopt;
+        }
+        return r.front();
+    }
+
+private:
+    json_document const *_document = nullptr;
+    uint32_t _position = 0;
+
+    friend class jsonpath_set;
+
+    /** The first character of the value.
+     */
+    [[nodiscard]] char kind() const noexcept
+    {
+        hi_axiom_not_null(_document);
+        return _document->at(_position);
+    }
+
+    /** The text of a literal, or empty when this is not a literal.
+     */
+    [[nodiscard]] std::string_view literal() const noexcept
+    {
+        switch (kind()) {
+        case '{':
+        case '[':
+        case '"':
+        case '\0':
+            return {};
+        default:;
+        }
+
+        auto const text = _document->text();
+        auto const first = _document->offset(_position);
+        auto last = first;
+        while (last != text.size()) {
+            switch (text[last]) {
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',':
+            case '"':
+            case '/':
+                return text.substr(first, last - first);
+            default:
+                ++last;
+            }
+        }
+        return text.substr(first, last - first);
+    }
+
+    /** The text of a string, including the quotes.
+     */
+    [[nodiscard]] std::string_view string_view_with_quotes() const
+    {
+        hi_axiom(is_string());
+
+        auto const text = _document->text();
+        auto const first = _document->offset(_position);
+        for (auto i = first + 1; i < text.size(); ++i) {
+            if (text[i] == '"') {
+                return text.substr(first, i - first + 1);
+            } else if (text[i] == '\\') {
+                ++i;
+            }
+        }
+        _document->throw_error(_position, "Incomplete string");
+    }
+
+    /** Compare a string with @a rhs, without unescaping when the string has no escape sequences.
+     */
+    [[nodiscard]] bool string_equal(std::string_view rhs) const
+    {
+        auto const raw = raw_string();
+        if (raw.find('\\') == std::string_view::npos) [[likely]] {
+            return raw == rhs;
+        }
+        return string() == rhs;
+    }
+
+    /** Call @a func for each item of an array until it returns false.
+     */
+    template<typename Func>
+    void for_each_item(Func&& func) const
+    {
+        hi_axiom(is_array());
+
+        auto i = _position + 1;
+        while (true) {
+            auto const c = _document->at(i);
+            if (c == ']') {
+                return;
+            } else if (c == ',' or c == ':' or c == '}' or c == '\0') {
+                _document->throw_error(i, "Expecting a JSON value");
+            }
+
+            if (not func(json_view{*_document, i})) {
+                return;
+            }
+
+            i = _document->skip(i);
+            if (_document->at(i) == ',') {
+                ++i;
+            } else if (_document->at(i) != ']') {
+                _document->throw_error(i, "Expecting ',' or ']'");
+            }
+        }
+    }
+
+    /** Call @a func for each name and value of an object until it returns false.
+     */
+    template<typename Func>
+    void for_each_member(Func&& func) const
+    {
+        hi_axiom(is_object());
+
+        auto i = _position + 1;
+        while (true) {
+            auto const c = _document->at(i);
+            if (c == '}') {
+                return;
+            } else if (c != '"') {
+                _document->throw_error(i, "Expecting a key or close-brace");
+            } else if (_document->at(i + 1) != ':') {
+                _document->throw_error(i + 1, "Expecting ':'");
+            }
+
+            auto const value_c = _document->at(i + 2);
+            if (value_c == ',' or value_c == ':' or value_c == '}' or value_c == ']' or value_c == '\0') {
+                _document->throw_error(i + 2, "Expecting a JSON value");
+            }
+
+            if (not func(json_view{*_document, i}, json_view{*_document, i + 2})) {
+                return;
+            }
+
+            i = _document->skip(i + 2);
+            if (_document->at(i) == ',') {
+                ++i;
+            } else if (_document->at(i) != '}') {
+                _document->throw_error(i, "Expecting ',' or '}'");
+            }
+        }
+    }
+
+    void find_wildcard(jsonpath::const_iterator it, jsonpath::const_iterator it_end, std::vector<json_view>& r) const
+    {
+        for (auto const& item : items()) {
+            item.find(it + 1, it_end, r);
+        }
+    }
+
+    void find_descend(jsonpath::const_iterator it, jsonpath::const_iterator it_end, std::vector<json_view>& r) const
+    {
+        find(it + 1, it_end, r);
+
+        for (auto const& item : items()) {
+            item.find(it, it_end, r);
+        }
+    }
+
+    void find_indices(
+        jsonpath::indices const& indices,
+        jsonpath::const_iterator it,
+        jsonpath::const_iterator it_end,
+        std::vector<json_view>& r) const
+    {
+        if (is_array()) {
+            auto const items_ = items();
+            for (auto const index : indices.filter(items_.size())) {
+                items_[index].find(it + 1, it_end, r);
+            }
+        }
+    }
+
+    void find_names(
+        jsonpath::names const& names,
+        jsonpath::const_iterator it,
+        jsonpath::const_iterator it_end,
+        std::vector<json_view>& r) const
+    {
+        for (auto const& name : names) {
+            if (auto const value = member(name)) {
+                value->find(it + 1, it_end, r);
+            }
+        }
+    }
+
+    void find_slice(
+        jsonpath::slice const& slice,
+        jsonpath::const_iterator it,
+        jsonpath::const_iterator it_end,
+        std::vector<json_view>& r) const
+    {
+        if (is_array()) {
+            auto const items_ = items();
+            auto const first = slice.begin(items_.size());
+            auto const last = slice.end(items_.size());
+
+            for (auto index = first; index != last; index += slice.step) {
+                if (index >= 0 and index < items_.size()) {
+                    items_[index].find(it + 1, it_end, r);
+                }
+            }
+        }
+    }
+
+    void find(jsonpath::const_iterator it, jsonpath::const_iterator it_end, std::vector<json_view>& r) const
+    {
+        if (it == it_end) {
+            r.push_back(*this);
+
+        } else if (std::holds_alternative<jsonpath::root>(*it)) {
+            find(it + 1, it_end, r);
+
+        } else if (std::holds_alternative<jsonpath::current>(*it)) {
+            find(it + 1, it_end, r);
+
+        } else if (std::holds_alternative<jsonpath::wildcard>(*it)) {
+            find_wildcard(it, it_end, r);
+
+        } else if (std::holds_alternative<jsonpath::descend>(*it)) {
+            find_descend(it, it_end, r);
+
+        } else if (auto indices = std::get_if<jsonpath::indices>(&*it)) {
+            find_indices(*indices, it, it_end, r);
+
+        } else if (auto names = std::get_if<jsonpath::names>(&*it)) {
+            find_names(*names, it, it_end, r);
+
+        } else if (auto slice = std::get_if<jsonpath::slice>(&*it)) {
+            find_slice(*slice, it, it_end, r);
+
+        } else {
+            hi_no_default();
+        }
+    }
+};
+
+inline json_view json_document::root() const
+{
+    if (_index.empty()) {
+        throw parse_error(std::format("{}: No tokens found", _path));
+    }
+    if (skip(0) != _index.size()) {
+        throw_error(skip(0), "Unexpected text after JSON root object");
+    }
+    return json_view{*this, 0};
+}
+
+}} // namespace hi::v1
@@ -0,0 +1,107 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "JSON_view.hpp"
+#include "../utility/utility.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_SUITE(JSON_view_suite) {
+
+constexpr static auto store_text = std::string_view{
+    "{\n"
+    "  // Comments are allowed.\n"
+    "  \"store\": {\n"
+    "    \"book\": [\n"
+    "      {\"author\": \"Nigel Rees\", \"price\": 8.95},\n"
+    "      {\"author\": \"Evelyn \\\"W\\\"\", \"price\": 12.99},\n"
+    "      {\"author\": \"Herman Melville\", \"price\": 8},\n"
+    "    ],\n"
+    "    \"bicycle\": {\"color\": \"red\", \"price\": 19.95}\n"
+    "  },\n"
+    "  \"empty\": [],\n"
+    "  \"flags\": [true, false, null]\n"
+    "}\n"};
+
+TEST_CASE(navigate)
+{
+    auto const doc = hi::json_document{store_text};
+    auto const root = doc.root();
+    REQUIRE(root.is_object());
+    REQUIRE(root.size() == 3);
+
+    auto const book = root.member("store")->member("book");
+    REQUIRE(book.has_value());
+    REQUIRE(book->is_array());
+    REQUIRE(book->size() == 3);
+
+    auto const author = book->item(1)->member("author");
+    REQUIRE(author->is_string());
+    REQUIRE(author->raw_string() == "Evelyn \\\"W\\\"");
+    REQUIRE(author->string() == "Evelyn \"W\"");
+
+    REQUIRE(book->item(2)->member("price")->to_datum() == hi::datum{8});
+    REQUIRE(not book->item(3));
+    REQUIRE(not root.member("nothing"));
+    REQUIRE(root.member("empty")->size() == 0);
+
+    auto const flags = root.member("flags")->items();
+    REQUIRE(flags.size() == 3);
+    REQUIRE(flags[0].is_bool());
+    REQUIRE(flags[2].is_null());
+}
+
+TEST_CASE(raw)
+{
+    auto const doc = hi::json_document{store_text};
+    auto const bicycle = doc.root().member("store")->member("bicycle");
+    REQUIRE(bicycle->raw() == "{\"color\": \"red\", \"price\": 19.95}");
+
+    auto expected = hi::datum::make_map();
+    expected["color"] = "red";
+    expected["price"] = 19.95;
+    REQUIRE(bicycle->to_datum() == expected);
+}
+
+TEST_CASE(find)
+{
+    auto const doc = hi::json_document{store_text};
+    auto const root = doc.root();
+
+    auto const authors = root.find(hi::jsonpath{"$.store.book[*].author"});
+    REQUIRE(authors.size() == 3);
+    REQUIRE(authors[0].string() == "Nigel Rees");
+    REQUIRE(authors[2].string() == "Herman Melville");
+
+    auto const prices = root.find(hi::jsonpath{"$..price"});
+    REQUIRE(prices.size() == 4);
+
+    auto const last = root.find_one(hi::jsonpath{"$.store.book[-1].author"});
+    REQUIRE(last.has_value());
+    REQUIRE(last->string() == "Herman Melville");
+
+    REQUIRE(root.find(hi::jsonpath{"$.store.book[:2]"}).size() == 2);
+    REQUIRE(not root.find_one(hi::jsonpath{"$.store.car"}));
+}
+
+TEST_CASE(duplicate_key)
+{
+    auto const doc = hi::json_document{"{\"foo\": 42, \"bar\": 44, \"foo\": 43}"};
+    REQUIRE(doc.root().member("foo")->to_datum() == hi::datum{43});
+}
+
+TEST_CASE(errors)
+{
+    REQUIRE_THROWS(hi::json_document{""}.root(), hi::parse_error);
+    REQUIRE_THROWS(hi::json_document{"{} {}"}.root(), hi::parse_error);
+    REQUIRE_THROWS(hi::json_document{"[1, [2, 3]"}.root(), hi::parse_error);
+    REQUIRE_THROWS(hi::json_document{"[1, {2]}"}.root(), hi::parse_error);
+
+    auto const doc = hi::json_document{"[1 2]"};
+    REQUIRE_THROWS(doc.root().size(), hi::parse_error);
+}
+
+};
@@ -0,0 +1,314 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "datum.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.JSON_writer);
+
+hi_export namespace hi::inline v1 {
+
+/** Stream a JSON text to a file.
+ *
+ * The text is built from events, without first creating a `datum`. The text
+ * is collected in a buffer which is written to the sink each time it grows
+ * beyond its capacity; the buffer is reused for the rest of the text.
+ *
+ * The text is compact: no white-space is added between the values.
+ * Strings are escaped as required by the JSON standard. Floating point
+ * numbers that are not finite, which JSON can not represent, are written as `null`.
+ *
+ * Call `flush()` after the last value; text that is not flushed is discarded.
+ *
+ * @tparam Sink A type with a `write(void const *, std::size_t)` member function, like `file`.
+ */
+hi_export template<byte_writer Sink>
+class JSON_writer {
+public:
+    JSON_writer(JSON_writer const&) = delete;
+    JSON_writer(JSON_writer&&) = delete;
+    JSON_writer& operator=(JSON_writer const&) = delete;
+    JSON_writer& operator=(JSON_writer&&) = delete;
+
+    /** Create a writer.
+     *
+     * @param sink The sink to write the text to.
+     * @param capacity The number of bytes to collect before writing to the sink.
+     */
+    explicit JSON_writer(Sink& sink, std::size_t capacity = 65536) : _sink(sink), _capacity(capacity)
+    {
+        _buffer.reserve(capacity);
+    }
+
+    void begin_array()
+    {
+        begin_value();
+        _buffer += '[';
+        _stack.push_back('[');
+        _need_comma = false;
+    }
+
+    void end_array()
+    {
+        hi_axiom(not _stack.empty() and _stack.back() == '[');
+        _stack.pop_back();
+        _buffer += ']';
+        end_value();
+    }
+
+    void begin_object()
+    {
+        begin_value();
+        _buffer += '{';
+        _stack.push_back('{');
+        _need_comma = false;
+    }
+
+    void end_object()
+    {
+        hi_axiom(not _stack.empty() and _stack.back() == '{' and not _after_key);
+        _stack.pop_back();
+        _buffer += '}';
+        end_value();
+    }
+
+    /** Add the name of the next member of an object.
+     */
+    void key(std::string_view name)
+    {
+        hi_axiom(not _stack.empty() and _stack.back() == '{' and not _after_key);
+        if (_need_comma) {
+            _buffer += ',';
+        }
+        append_string(name);
+        _buffer += ':';
+        _after_key = true;
+    }
+
+    void value(nullptr_t)
+    {
+        begin_value();
+        _buffer += "null";
+        end_value();
+    }
+
+    void value(bool value)
+    {
+        begin_value();
+        _buffer += value ? "true" : "false";
+        end_value();
+    }
+
+    template<std::integral T>
+    void value(T value)
+    {
+        begin_value();
+        auto buffer = std::array<char, 24>{};
+        auto const [last, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        hi_axiom(ec == std::errc{});
+        _buffer.append(buffer.data(), last);
+        end_value();
+    }
+
+    template<std::floating_point T>
+    void value(T value)
+    {
+        begin_value();
+        if (std::isfinite(value)) {
+            auto buffer = std::array<char, 32>{};
+            auto const [last, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+            hi_axiom(ec == std::errc{});
+            auto const str = std::string_view{buffer.data(), last};
+            _buffer += str;
+            if (str.find_first_of(".e") == std::string_view::npos) {
+                // Make sure the number is read back as a floating point number.
+                _buffer += ".0";
+            }
+        } else {
+            _buffer += "null";
+        }
+        end_value();
+    }
+
+    void value(std::string_view value)
+    {
+        begin_value();
+        append_string(value);
+        end_value();
+    }
+
+    void value(std::string const& value)
+    {
+        this->value(std::string_view{value});
+    }
+
+    void value(char const *value)
+    {
+        this->value(std::string_view{value});
+    }
+
+    void value(datum const& value)
+    {
+        if (holds_alternative<nullptr_t>(value)) {
+            this->value(nullptr);
+        } else if (auto const *b = get_if<bool>(value)) {
+            this->value(*b);
+        } else if (auto const *i = get_if<long long>(value)) {
+            this->value(*i);
+        } else if (auto const *f = get_if<double>(value)) {
+            this->value(*f);
+        } else if (auto const s = get_if<std::string>(value)) {
+            this->value(*s);
+        } else if (auto const *v = get_if<datum::vector_type>(value)) {
+            this->value(*v);
+        } else if (auto const *m = get_if<datum::map_type>(value)) {
+            begin_object();
+            for (auto const& item : *m) {
+                if (auto const name = get_if<std::string>(item.first)) {
+                    key(*name);
+                } else {
+                    throw operation_error("JSON object keys must be strings");
+                }
+                this->value(item.second);
+            }
+            end_object();
+        } else {
+            throw operation_error("Datum value can not be written as JSON");
+        }
+    }
+
+    template<typename T>
+    void value(std::vector<T> const& items)
+    {
+        begin_array();
+        for (auto const& item : items) {
+            this->value(item);
+        }
+        end_array();
+    }
+
+    template<typename Value>
+    void value(std::map<std::string, Value> const& items)
+    {
+        begin_object();
+        for (auto const& item : items) {
+            key(item.first);
+            this->value(item.second);
+        }
+        end_object();
+    }
+
+    /** Write the buffered text to the sink.
+     */
+    void flush()
+    {
+        if (not _buffer.empty()) {
+            _sink.write(_buffer.data(), _buffer.size());
+            _buffer.clear();
+        }
+    }
+
+private:
+    Sink& _sink;
+    std::size_t _capacity;
+    std::string _buffer;
+
+    /** The open arrays '[' and objects '{'.
+     */
+    std::vector<char> _stack;
+
+    /** A comma is needed before the next value or key.
+     */
+    bool _need_comma = false;
+
+    /** A key has been written, the next value is its value.
+     */
+    bool _after_key = false;
+
+    void begin_value()
+    {
+        if (_after_key) {
+            _after_key = false;
+        } else {
+            hi_axiom(_stack.empty() or _stack.back() == '[');
+            if (_need_comma) {
+                _buffer += ',';
+            }
+        }
+    }
+
+    void end_value()
+    {
+        _need_comma = true;
+        if (_buffer.size() >= _capacity) {
+            flush();
+        }
+    }
+
+    void append_string(std::string_view str)
+    {
+        constexpr auto hex_digits = std::string_view{"0123456789abcdef"};
+
+        _buffer += '"';
+
+        // Append the runs of characters that do not need to be escaped in one go.
+        auto first = str.begin();
+        for (auto it = str.begin(); it != str.end(); ++it) {
+            auto const c = *it;
+            if (c != '"' and c != '\\' and static_cast<uint8_t>(c) >= 0x20) [[likely]] {
+                continue;
+            }
+
+            _buffer.append(first, it);
+            first = it + 1;
+
+            _buffer += '\\';
+            switch (c) {
+            case '"':
+                _buffer += '"';
+                break;
+            case '\\':
+                _buffer += '\\';
+                break;
+            case '\n':
+                _buffer += 'n';
+                break;
+            case '\r':
+                _buffer += 'r';
+                break;
+            case '\t':
+                _buffer += 't';
+                break;
+            case '\f':
+                _buffer += 'f';
+                break;
+            case '\b':
+                _buffer += 'b';
+                break;
+            default:
+                _buffer += "u00";
+                _buffer += hex_digits[static_cast<uint8_t>(c) >> 4];
+                _buffer += hex_digits[static_cast<uint8_t>(c) & 0xf];
+            }
+        }
+        _buffer.append(first, str.end());
+
+        _buffer += '"';
+    }
+};
+
+} // namespace hi::inline v1
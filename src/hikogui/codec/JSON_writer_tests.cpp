@@ -0,0 +1,105 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "JSON_writer.hpp"
+#include "JSON_fast.hpp"
+#include "../utility/utility.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <vector>
+#include <limits>
+
+TEST_SUITE(JSON_writer_suite) {
+
+struct string_sink {
+    std::string text;
+    std::size_t num_writes = 0;
+
+    void write(void const *data, std::size_t size)
+    {
+        text.append(static_cast<char const *>(data), size);
+        ++num_writes;
+    }
+};
+
+TEST_CASE(events)
+{
+    auto sink = string_sink{};
+    auto writer = hi::JSON_writer{sink};
+
+    writer.begin_object();
+    writer.key("name");
+    writer.value("hikogui");
+    writer.key("numbers");
+    writer.begin_array();
+    writer.value(1);
+    writer.value(-2LL);
+    writer.value(2.5);
+    writer.value(3.0);
+    writer.end_array();
+    writer.key("flags");
+    writer.value(std::vector<bool>{true, false});
+    writer.key("empty");
+    writer.begin_object();
+    writer.end_object();
+    writer.key("nothing");
+    writer.value(nullptr);
+    writer.end_object();
+
+    REQUIRE(sink.text.empty());
+    writer.flush();
+    REQUIRE(sink.text == "{\"name\":\"hikogui\",\"numbers\":[1,-2,2.5,3.0],\"flags\":[true,false],\"empty\":{},\"nothing\":null}");
+}
+
+TEST_CASE(escapes)
+{
+    auto sink = string_sink{};
+    auto writer = hi::JSON_writer{sink};
+    writer.value("a\"b\\c\nd\x01");
+    writer.flush();
+    REQUIRE(sink.text == "\"a\\\"b\\\\c\\nd\\u0001\"");
+    REQUIRE(hi::parse_JSON_fast(sink.text) == hi::datum{"a\"b\\c\nd\x01"});
+}
+
+TEST_CASE(non_finite)
+{
+    auto sink = string_sink{};
+    auto writer = hi::JSON_writer{sink};
+    writer.value(std::numeric_limits<double>::infinity());
+    writer.flush();
+    REQUIRE(sink.text == "null");
+}
+
+TEST_CASE(datum_round_trip)
+{
+    auto expected = hi::datum::make_map();
+    expected["foo"] = 42;
+    expected["bar"] = hi::datum::make_vector(1.5, "baz", true);
+
+    auto sink = string_sink{};
+    auto writer = hi::JSON_writer{sink};
+    writer.value(expected);
+    writer.flush();
+    REQUIRE(hi::parse_JSON_fast(sink.text) == expected);
+}
+
+TEST_CASE(reuse_buffer)
+{
+    auto sink = string_sink{};
+    auto writer = hi::JSON_writer{sink, 64};
+
+    writer.begin_array();
+    for (auto i = 0; i != 1000; ++i) {
+        writer.value(i);
+    }
+    writer.end_array();
+    writer.flush();
+
+    REQUIRE(sink.num_writes > 10);
+    auto const result = hi::parse_JSON_fast(sink.text);
+    REQUIRE(result.size() == 1000);
+    REQUIRE(result[999] == 999);
+}
+
+};
@@ -7,6 +7,12 @@
 #include "../container/container.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#if HI_PROCESSOR == HI_CPU_X86_64
+#include <immintrin.h>
+#elif HI_PROCESSOR == HI_CPU_ARM64 and defined(__ARM_FEATURE_SHA2)
+#include <arm_neon.h>
+#endif
 #include <bit>
 #include <array>
 #include <cstdint>
@@ -14,6 +20,11 @@
 #include <string_view>
 #include <exception>
 #include <string>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <concepts>
+#include <type_traits>
 
 hi_export_module(hikogui.codec.SHA2);
 
@@ -23,6 +34,300 @@ hi_warning_push();
 hi_warning_ignore_msvc(26429);
 
 hi_export namespace hi { inline namespace v1 {
+namespace detail {
+
+constexpr auto SHA2_K32 = std::array<uint32_t, 64>{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+constexpr auto SHA2_K64 = std::array<uint64_t, 80>{
+    0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc, 0x3956c25bf348b538,
+    0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118, 0xd807aa98a3030242, 0x12835b0145706fbe,
+    0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2, 0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235,
+    0xc19bf174cf692694, 0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+    0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5, 0x983e5152ee66dfab,
+    0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4, 0xc6e00bf33da88fc2, 0xd5a79147930aa725,
+    0x06ca6351e003826f, 0x142929670a0e6e70, 0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed,
+    0x53380d139d95b3df, 0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+    0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30, 0xd192e819d6ef5218,
+    0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8, 0x19a4c116b8d2d0c8, 0x1e376c085141ab53,
+    0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373,
+    0x682e6ff3d6b2b8a3, 0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+    0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b, 0xca273eceea26619c,
+    0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178, 0x06f067aa72176fba, 0x0a637dc5a2c898a6,
+    0x113f9804bef90dae, 0x1b710b35131c471b, 0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc,
+    0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817};
+
+#if HI_PROCESSOR == HI_CPU_X86_64
+/** Compress SHA-224/256 blocks with the SHA instructions of x86.
+ *
+ * @param[in,out] state The state words a to h.
+ * @param ptr The first block.
+ * @param nr_blocks The number of 64 byte blocks.
+ */
+hi_target("sha,sse4.1") inline void SHA256_blocks_x86_sha(std::array<uint32_t, 8>& state, std::byte const *ptr, std::size_t nr_blocks) noexcept
+{
+    // The SHA instructions use the state words in the order ABEF and CDGH.
+    auto const dcba = _mm_loadu_si128(reinterpret_cast<__m128i const *>(state.data()));
+    auto const hgfe = _mm_loadu_si128(reinterpret_cast<__m128i const *>(state.data() + 4));
+    auto const cdab = _mm_shuffle_epi32(dcba, 0xb1);
+    auto const efgh = _mm_shuffle_epi32(hgfe, 0x1b);
+    auto abef = _mm_alignr_epi8(cdab, efgh, 8);
+    auto cdgh = _mm_blend_epi16(efgh, cdab, 0xf0);
+
+    auto const byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    for (; nr_blocks != 0; --nr_blocks, ptr += 64) {
+        auto const abef_save = abef;
+        auto const cdgh_save = cdgh;
+
+        // The message schedule of the last 16 rounds, 4 words in each register.
+        __m128i msg[4];
+        for (auto i = 0; i != 4; ++i) {
+            msg[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + i * 16)), byte_swap);
+        }
+
+        // Each iteration does 4 rounds, while calculating the message schedule for the next rounds.
+        for (auto i = 0; i != 16; ++i) {
+            auto const &w = msg[i % 4];
+            auto wk = _mm_add_epi32(
+                w,
+                _mm_set_epi32(
+                    static_cast<int>(SHA2_K32[i * 4 + 3]),
+                    static_cast<int>(SHA2_K32[i * 4 + 2]),
+                    static_cast<int>(SHA2_K32[i * 4 + 1]),
+                    static_cast<int>(SHA2_K32[i * 4])));
+
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+            if (i >= 3 and i <= 14) {
+                auto& next = msg[(i + 1) % 4];
+                next = _mm_sha256msg2_epu32(_mm_add_epi32(next, _mm_alignr_epi8(w, msg[(i + 3) % 4], 4)), w);
+            }
+            wk = _mm_shuffle_epi32(wk, 0x0e);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, wk);
+            if (i >= 1 and i <= 12) {
+                auto& prev = msg[(i + 3) % 4];
+                prev = _mm_sha256msg1_epu32(prev, w);
+            }
+        }
+
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+    }
+
+    auto const feba = _mm_shuffle_epi32(abef, 0x1b);
+    auto const dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data()), _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data() + 4), _mm_alignr_epi8(dchg, feba, 8));
+}
+
+template<typename T>
+hi_target("avx2") hi_force_inline inline __m256i SHA2_avx2_add(__m256i a, __m256i b) noexcept
+{
+    if constexpr (sizeof(T) == 4) {
+        return _mm256_add_epi32(a, b);
+    } else {
+        return _mm256_add_epi64(a, b);
+    }
+}
+
+template<typename T, int N>
+hi_target("avx2") hi_force_inline inline __m256i SHA2_avx2_shr(__m256i x) noexcept
+{
+    if constexpr (sizeof(T) == 4) {
+        return _mm256_srli_epi32(x, N);
+    } else {
+        return _mm256_srli_epi64(x, N);
+    }
+}
+
+template<typename T, int N>
+hi_target("avx2") hi_force_inline inline __m256i SHA2_avx2_rotr(__m256i x) noexcept
+{
+    if constexpr (sizeof(T) == 4) {
+        return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+    } else {
+        return _mm256_or_si256(_mm256_srli_epi64(x, N), _mm256_slli_epi64(x, 64 - N));
+    }
+}
+
+template<typename T, int A, int B, int C>
+hi_target("avx2") hi_force_inline inline __m256i SHA2_avx2_S(__m256i x) noexcept
+{
+    return _mm256_xor_si256(_mm256_xor_si256(SHA2_avx2_rotr<T, A>(x), SHA2_avx2_rotr<T, B>(x)), SHA2_avx2_rotr<T, C>(x));
+}
+
+template<typename T, int A, int B, int C>
+hi_target("avx2") hi_force_inline inline __m256i SHA2_avx2_s(__m256i x) noexcept
+{
+    return _mm256_xor_si256(_mm256_xor_si256(SHA2_avx2_rotr<T, A>(x), SHA2_avx2_rotr<T, B>(x)), SHA2_avx2_shr<T, C>(x));
+}
+
+/** Compress blocks of independent messages in parallel with AVX2.
+ *
+ * Each 256-bit register holds the same word of 8 SHA-224/256 states, or of 4 SHA-384/512 states.
+ *
+ * @param[in,out] states The state words a to h of each lane.
+ * @param[in,out] ptrs The next block of each lane, on return advanced by @a nr_blocks times the stride.
+ * @param strides The number of bytes to advance each lane after a block; zero for unused lanes.
+ * @param nr_blocks The number of blocks to compress of each lane.
+ */
+template<typename T, std::size_t NrLanes = 32 / sizeof(T)>
+hi_target("avx2") inline void SHA2_blocks_avx2(
+    std::array<std::array<T, 8> *, NrLanes> const& states,
+    std::array<std::byte const *, NrLanes>& ptrs,
+    std::array<std::size_t, NrLanes> const& strides,
+    std::size_t nr_blocks) noexcept
+{
+    constexpr auto nr_rounds = sizeof(T) == 4 ? 64_uz : 80_uz;
+
+    alignas(32) std::array<std::array<T, NrLanes>, 16> words;
+
+    __m256i state[8];
+    for (auto i = 0_uz; i != 8; ++i) {
+        for (auto lane = 0_uz; lane != NrLanes; ++lane) {
+            words[i][lane] = (*states[lane])[i];
+        }
+        state[i] = _mm256_load_si256(reinterpret_cast<__m256i const *>(words[i].data()));
+    }
+
+    for (; nr_blocks != 0; --nr_blocks) {
+        // Transpose the message blocks, so that each register holds the same word of every lane.
+        for (auto lane = 0_uz; lane != NrLanes; ++lane) {
+            for (auto i = 0_uz; i != 16; ++i) {
+                words[i][lane] = load_be<T>(ptrs[lane] + i * sizeof(T));
+            }
+            ptrs[lane] += strides[lane];
+        }
+
+        __m256i W[16];
+        for (auto i = 0_uz; i != 16; ++i) {
+            W[i] = _mm256_load_si256(reinterpret_cast<__m256i const *>(words[i].data()));
+        }
+
+        auto a = state[0];
+        auto b = state[1];
+        auto c = state[2];
+        auto d = state[3];
+        auto e = state[4];
+        auto f = state[5];
+        auto g = state[6];
+        auto h = state[7];
+
+        for (auto i = 0_uz; i != nr_rounds; ++i) {
+            if (i >= 16) {
+                auto const& w2 = W[(i - 2) % 16];
+                auto const& w15 = W[(i - 15) % 16];
+                __m256i s0;
+                __m256i s1;
+                if constexpr (sizeof(T) == 4) {
+                    s0 = SHA2_avx2_s<T, 7, 18, 3>(w15);
+                    s1 = SHA2_avx2_s<T, 17, 19, 10>(w2);
+                } else {
+                    s0 = SHA2_avx2_s<T, 1, 8, 7>(w15);
+                    s1 = SHA2_avx2_s<T, 19, 61, 6>(w2);
+                }
+                W[i % 16] = SHA2_avx2_add<T>(SHA2_avx2_add<T>(s1, W[(i - 7) % 16]), SHA2_avx2_add<T>(s0, W[i % 16]));
+            }
+
+            __m256i S0;
+            __m256i S1;
+            __m256i K;
+            if constexpr (sizeof(T) == 4) {
+                S0 = SHA2_avx2_S<T, 2, 13, 22>(a);
+                S1 = SHA2_avx2_S<T, 6, 11, 25>(e);
+                K = _mm256_set1_epi32(static_cast<int>(SHA2_K32[i]));
+            } else {
+                S0 = SHA2_avx2_S<T, 28, 34, 39>(a);
+                S1 = SHA2_avx2_S<T, 14, 18, 41>(e);
+                K = _mm256_set1_epi64x(static_cast<long long>(SHA2_K64[i]));
+            }
+
+            auto const ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+            auto const maj = _mm256_xor_si256(_mm256_and_si256(a, _mm256_xor_si256(b, c)), _mm256_and_si256(b, c));
+
+            auto const T1 = SHA2_avx2_add<T>(SHA2_avx2_add<T>(h, S1), SHA2_avx2_add<T>(ch, SHA2_avx2_add<T>(K, W[i % 16])));
+            auto const T2 = SHA2_avx2_add<T>(S0, maj);
+
+            h = g;
+            g = f;
+            f = e;
+            e = SHA2_avx2_add<T>(d, T1);
+            d = c;
+            c = b;
+            b = a;
+            a = SHA2_avx2_add<T>(T1, T2);
+        }
+
+        state[0] = SHA2_avx2_add<T>(state[0], a);
+        state[1] = SHA2_avx2_add<T>(state[1], b);
+        state[2] = SHA2_avx2_add<T>(state[2], c);
+        state[3] = SHA2_avx2_add<T>(state[3], d);
+        state[4] = SHA2_avx2_add<T>(state[4], e);
+        state[5] = SHA2_avx2_add<T>(state[5], f);
+        state[6] = SHA2_avx2_add<T>(state[6], g);
+        state[7] = SHA2_avx2_add<T>(state[7], h);
+    }
+
+    for (auto i = 0_uz; i != 8; ++i) {
+        _mm256_store_si256(reinterpret_cast<__m256i *>(words[i].data()), state[i]);
+        for (auto lane = 0_uz; lane != NrLanes; ++lane) {
+            (*states[lane])[i] = words[i][lane];
+        }
+    }
+}
+#endif
+
+#if HI_PROCESSOR == HI_CPU_ARM64 and defined(__ARM_FEATURE_SHA2)
+/** Compress SHA-224/256 blocks with the ARMv8 cryptography extension.
+ *
+ * @param[in,out] state The state words a to h.
+ * @param ptr The first block.
+ * @param nr_blocks The number of 64 byte blocks.
+ */
+inline void SHA256_blocks_arm_sha2(std::array<uint32_t, 8>& state, std::byte const *ptr, std::size_t nr_blocks) noexcept
+{
+    auto abcd = vld1q_u32(state.data());
+    auto efgh = vld1q_u32(state.data() + 4);
+
+    for (; nr_blocks != 0; --nr_blocks, ptr += 64) {
+        auto const abcd_save = abcd;
+        auto const efgh_save = efgh;
+
+        uint32x4_t msg[4];
+        for (auto i = 0; i != 4; ++i) {
+            msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(reinterpret_cast<uint8_t const *>(ptr + i * 16))));
+        }
+
+        // Each iteration does 4 rounds, while calculating the message schedule for the next rounds.
+        for (auto i = 0; i != 16; ++i) {
+            auto& w = msg[i % 4];
+            auto const wk = vaddq_u32(w, vld1q_u32(SHA2_K32.data() + i * 4));
+            if (i < 12) {
+                w = vsha256su1q_u32(vsha256su0q_u32(w, msg[(i + 1) % 4]), msg[(i + 2) % 4], msg[(i + 3) % 4]);
+            }
+
+            auto const abcd_prev = abcd;
+            abcd = vsha256hq_u32(abcd, efgh, wk);
+            efgh = vsha256h2q_u32(efgh, abcd_prev, wk);
+        }
+
+        abcd = vaddq_u32(abcd, abcd_save);
+        efgh = vaddq_u32(efgh, efgh_save);
+    }
+
+    vst1q_u32(state.data(), abcd);
+    vst1q_u32(state.data() + 4, efgh);
+}
+#endif
+
+} // namespace detail
 
 hi_export template<typename T, std::size_t Bits>
 class SHA2 {
@@ -42,6 +347,16 @@ class SHA2 {
 
         constexpr state_type(T a, T b, T c, T d, T e, T f, T g, T h) noexcept : a(a), b(b), c(c), d(d), e(e), f(f), g(g), h(h) {}
 
+        constexpr explicit state_type(std::array<T, 8> const& words) noexcept :
+            state_type(words[0], words[1], words[2], words[3], words[4], words[5], words[6], words[7])
+        {
+        }
+
+        [[nodiscard]] constexpr std::array<T, 8> get_words() const noexcept
+        {
+            return {a, b, c, d, e, f, g, h};
+        }
+
         [[nodiscard]] constexpr T get_word(std::size_t i) const noexcept
         {
             switch (i) {
@@ -146,38 +461,10 @@ class SHA2 {
 
     [[nodiscard]] constexpr static T K(std::size_t i) noexcept
     {
-        constexpr std::array<uint32_t, 64> K32 = {
-            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
-
-        constexpr std::array<uint64_t, 80> K64 = {
-            0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc, 0x3956c25bf348b538,
-            0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118, 0xd807aa98a3030242, 0x12835b0145706fbe,
-            0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2, 0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235,
-            0xc19bf174cf692694, 0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
-            0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5, 0x983e5152ee66dfab,
-            0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4, 0xc6e00bf33da88fc2, 0xd5a79147930aa725,
-            0x06ca6351e003826f, 0x142929670a0e6e70, 0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed,
-            0x53380d139d95b3df, 0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
-            0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30, 0xd192e819d6ef5218,
-            0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8, 0x19a4c116b8d2d0c8, 0x1e376c085141ab53,
-            0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373,
-            0x682e6ff3d6b2b8a3, 0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
-            0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b, 0xca273eceea26619c,
-            0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178, 0x06f067aa72176fba, 0x0a637dc5a2c898a6,
-            0x113f9804bef90dae, 0x1b710b35131c471b, 0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc,
-            0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817};
-
         if constexpr (std::is_same_v<T, uint32_t>) {
-            return K32[i];
+            return detail::SHA2_K32[i];
         } else {
-            return K64[i];
+            return detail::SHA2_K64[i];
         }
     }
 
@@ -265,6 +552,38 @@ class SHA2 {
         state += tmp;
     }
 
+    /** Compress whole blocks.
+     *
+     * Uses the SHA instructions of the CPU when available.
+     *
+     * @param ptr The first block.
+     * @param nr_blocks The number of blocks.
+     */
+    constexpr void add_blocks(cbyteptr ptr, std::size_t nr_blocks) noexcept
+    {
+        if (not std::is_constant_evaluated()) {
+            if constexpr (sizeof(T) == 4) {
+#if HI_PROCESSOR == HI_CPU_X86_64
+                if (has_sha() and has_sse4_1()) {
+                    auto words = state.get_words();
+                    detail::SHA256_blocks_x86_sha(words, ptr, nr_blocks);
+                    state = state_type{words};
+                    return;
+                }
+#elif HI_PROCESSOR == HI_CPU_ARM64 and defined(__ARM_FEATURE_SHA2)
+                auto words = state.get_words();
+                detail::SHA256_blocks_arm_sha2(words, ptr, nr_blocks);
+                state = state_type{words};
+                return;
+#endif
+            }
+        }
+
+        for (; nr_blocks != 0; --nr_blocks, ptr += block_type::size) {
+            add(block_type{ptr});
+        }
+    }
+
     constexpr void add_to_overflow(cbyteptr& ptr, std::byte const *last) noexcept
     {
         hi_axiom_not_null(ptr);
@@ -289,7 +608,7 @@ class SHA2 {
             while (overflow_it != overflow.end()) {
                 *(overflow_it++) = std::byte{0x00};
             }
-            add(block_type{overflow.data()});
+            add_blocks(overflow.data(), 1);
             overflow_it = overflow.begin();
         }
 
@@ -304,8 +623,7 @@ class SHA2 {
             *(overflow_it++) = i < sizeof(nr_of_bits) ? static_cast<std::byte>(nr_of_bits >> i * 8) : std::byte{0x00};
         }
 
-        auto b = block_type{overflow.data()};
-        add(b);
+        add_blocks(overflow.data(), 1);
     }
 
 public:
@@ -322,7 +640,7 @@ public:
             add_to_overflow(ptr, last);
 
             if (overflow_it == overflow.end()) {
-                add(block_type{overflow.data()});
+                add_blocks(overflow.data(), 1);
                 overflow_it = overflow.begin();
 
             } else {
@@ -333,10 +651,9 @@ public:
             }
         }
 
-        while (ptr + block_type::size <= last) {
-            add(block_type{ptr});
-            ptr += block_type::size;
-        }
+        auto const nr_blocks = narrow_cast<std::size_t>(last - ptr) / block_type::size;
+        add_blocks(ptr, nr_blocks);
+        ptr += nr_blocks * block_type::size;
 
         add_to_overflow(ptr, last);
 
@@ -381,10 +698,125 @@ public:
         add(first, last, finish);
     }
 
+    /** Add a message to each of several hashes.
+     *
+     * This gives the same result as calling `add()` on each hash. When the CPU
+     * supports AVX2, but has no SHA instructions for this hash, the blocks of
+     * different messages are compressed in parallel SIMD lanes: 8 messages at a
+     * time for SHA-224/256 and 4 messages at a time for SHA-384/512.
+     *
+     * @param hashes The hashes, one for each message.
+     * @param messages The messages to add.
+     * @param finish Finish each hash after adding its message.
+     */
+    template<std::derived_from<SHA2> Hash>
+    static void add(std::span<Hash> hashes, std::span<bstring_view const> messages, bool finish = true)
+    {
+        hi_assert(hashes.size() == messages.size());
+
+        auto offsets = std::vector<std::size_t>(messages.size(), 0);
+#if HI_PROCESSOR == HI_CPU_X86_64
+        if (has_avx2() and not(sizeof(T) == 4 and has_sha() and has_sse4_1())) {
+            add_parallel_avx2(hashes, messages, offsets);
+        }
+#endif
+
+        for (auto i = 0_uz; i != messages.size(); ++i) {
+            auto const first = messages[i].data();
+            auto const last = first + messages[i].size();
+            hashes[i].add(first + offsets[i], last, finish);
+        }
+    }
+
     [[nodiscard]] bstring get_bytes() const noexcept
     {
         return state.template get_bytes<Bits / 8>();
     }
+
+private:
+#if HI_PROCESSOR == HI_CPU_X86_64
+    /** Compress the whole blocks of the messages in parallel lanes.
+     *
+     * Each lane is assigned a message; when a message runs out of whole
+     * blocks its lane is given the next message. When less than half of the lanes
+     * can be filled the rest of the messages are left for the caller.
+     *
+     * @param hashes The hashes, one for each message.
+     * @param messages The messages to add.
+     * @param[out] offsets The number of bytes of each message that were added.
+     */
+    template<typename Hash>
+    static void add_parallel_avx2(std::span<Hash> hashes, std::span<bstring_view const> messages, std::vector<std::size_t>& offsets)
+    {
+        constexpr auto nr_lanes = 32 / sizeof(T);
+        constexpr auto no_message = std::numeric_limits<std::size_t>::max();
+
+        // Unused lanes compress a block of zeros into a scratch state.
+        auto const zeros = overflow_type{};
+        auto scratch = std::array<T, 8>{};
+
+        auto message_nrs = std::array<std::size_t, nr_lanes>{};
+        auto words = std::array<std::array<T, 8>, nr_lanes>{};
+        auto states = std::array<std::array<T, 8> *, nr_lanes>{};
+        auto ptrs = std::array<cbyteptr, nr_lanes>{};
+        auto strides = std::array<std::size_t, nr_lanes>{};
+        auto nr_blocks_left = std::array<std::size_t, nr_lanes>{};
+        for (auto lane = 0_uz; lane != nr_lanes; ++lane) {
+            message_nrs[lane] = no_message;
+        }
+
+        auto next_message_nr = 0_uz;
+        while (true) {
+            auto nr_active = 0_uz;
+            auto nr_blocks = std::numeric_limits<std::size_t>::max();
+            for (auto lane = 0_uz; lane != nr_lanes; ++lane) {
+                // Only messages that start at a block boundary can be added in parallel.
+                while (message_nrs[lane] == no_message and next_message_nr != messages.size()) {
+                    auto const i = next_message_nr++;
+                    auto& hash = static_cast<SHA2&>(hashes[i]);
+                    if (hash.overflow_it == hash.overflow.begin() and messages[i].size() >= block_type::size) {
+                        message_nrs[lane] = i;
+                        words[lane] = hash.state.get_words();
+                        ptrs[lane] = messages[i].data();
+                        nr_blocks_left[lane] = messages[i].size() / block_type::size;
+                    }
+                }
+
+                if (message_nrs[lane] == no_message) {
+                    states[lane] = &scratch;
+                    ptrs[lane] = zeros.data();
+                    strides[lane] = 0;
+                } else {
+                    states[lane] = &words[lane];
+                    strides[lane] = block_type::size;
+                    nr_blocks = std::min(nr_blocks, nr_blocks_left[lane]);
+                    ++nr_active;
+                }
+            }
+
+            if (nr_active * 2 < nr_lanes) {
+                break;
+            }
+
+            detail::SHA2_blocks_avx2<T>(states, ptrs, strides, nr_blocks);
+
+            for (auto lane = 0_uz; lane != nr_lanes; ++lane) {
+                if (message_nrs[lane] != no_message) {
+                    auto const i = message_nrs[lane];
+                    auto& hash = static_cast<SHA2&>(hashes[i]);
+                    hash.state = state_type{words[lane]};
+                    hash.size += nr_blocks * block_type::size;
+                    offsets[i] += nr_blocks * block_type::size;
+
+                    nr_blocks_left[lane] -= nr_blocks;
+                    if (nr_blocks_left[lane] == 0) {
+                        message_nrs[lane] = no_message;
+                    }
+                }
+            }
+        }
+    }
+#endif
 };
 
 hi_export class SHA224 final : public SHA2<uint32_t, 224> {
@@ -7,6 +7,8 @@
 #include "../utility/utility.hpp"
 #include "../algorithm/algorithm.hpp"
 #include <hikotest/hikotest.hpp>
+#include <vector>
+#include <span>
 
 TEST_SUITE(SHA2_suite) {
 
@@ -155,4 +157,42 @@ TEST_CASE(NESSIE512Set1)
         "eb009c5c2c49aa2e4eadb217ad8cc09b");
 }
 
+template<typename T>
+static void test_add_multi()
+{
+    // Messages of different lengths, so that lanes are refilled while others are still busy.
+    auto messages = std::vector<hi::bstring>{};
+    for (auto i = 0; i != 19; ++i) {
+        auto message = hi::bstring{};
+        for (auto j = 0; j != i * 97; ++j) {
+            message += static_cast<std::byte>(i * 31 + j);
+        }
+        messages.push_back(message);
+    }
+    auto const views = std::vector<hi::bstring_view>(messages.begin(), messages.end());
+
+    auto hashes = std::vector<T>(messages.size());
+    // Start a hash with a partial block, which can not be added in parallel.
+    hashes[3].add(hi::to_bstring("abc"), false);
+    T::add(std::span<T>{hashes}, std::span<hi::bstring_view const>{views});
+
+    for (auto i = std::size_t{0}; i != messages.size(); ++i) {
+        auto expected = T();
+        if (i == 3) {
+            expected.add(hi::to_bstring("abc"), false);
+        }
+        expected.add(messages[i]);
+        REQUIRE(hashes[i].get_bytes() == expected.get_bytes());
+    }
+}
+
+TEST_CASE(add_multi)
+{
+    test_add_multi<hi::SHA224>();
+    test_add_multi<hi::SHA256>();
+    test_add_multi<hi::SHA384>();
+    test_add_multi<hi::SHA512>();
+    test_add_multi<hi::SHA512_256>();
+}
+
 }; // TEST_SUITE(SHA2_suite)
@@ -7,6 +7,10 @@
 #include "../container/container.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#if HI_PROCESSOR == HI_CPU_X86_64
+#include <immintrin.h>
+#endif
 #include <span>
 #include <cstdint>
 #include <array>
@@ -113,6 +117,285 @@ constexpr auto base85_rfc1924_alphabet =
 constexpr auto base85_btoa_alphabet =
     base_n_alphabet{"!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstu"};
 
+#if HI_PROCESSOR == HI_CPU_X86_64
+/** Split 4 groups of 3 bytes from each 128-bit lane into 4 groups of 6-bit indices.
+ */
+hi_target("ssse3") inline __m128i base64_encode_split_ssse3(__m128i in) noexcept
+{
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    auto const t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    auto const t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t0, t1);
+}
+
+/** Convert 6-bit indices into characters of the alphabet.
+ *
+ * The indices are reduced to an index in a table of the offset between
+ * the index and its character: 0 for 0-25, 1 for 26-51, 2-11 for 52-61 and 12, 13 for 62, 63.
+ */
+hi_target("ssse3") inline __m128i base64_encode_lookup_ssse3(__m128i indices, char c62, char c63) noexcept
+{
+    auto const offsets = _mm_setr_epi8(
+        'a' - 26,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        static_cast<char>(c62 - 62),
+        static_cast<char>(c63 - 63),
+        'A',
+        0,
+        0);
+
+    auto i = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    i = _mm_or_si128(i, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, i), indices);
+}
+
+/** Encode bytes into base-64 characters using SSSE3.
+ *
+ * @param first The bytes to encode.
+ * @param size The number of bytes.
+ * @param[out] output The characters, 4 for every 3 bytes that are encoded.
+ * @param c62 The character for the digit 62.
+ * @param c63 The character for the digit 63.
+ * @return The number of bytes that were encoded, a multiple of 3.
+ */
+hi_target("ssse3") inline std::size_t
+base64_encode_ssse3(std::byte const *first, std::size_t size, char *output, char c62, char c63) noexcept
+{
+    auto i = 0_uz;
+    // 12 bytes are encoded for each 16 byte load.
+    for (; i + 16 <= size; i += 12, output += 16) {
+        auto const in = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), base64_encode_lookup_ssse3(base64_encode_split_ssse3(in), c62, c63));
+    }
+    return i;
+}
+
+/** Convert base-64 characters into 6-bit digits.
+ *
+ * @param in The characters.
+ * @param c62 The character for the digit 62.
+ * @param c63 The character for the digit 63.
+ * @param[out] valid A mask where each byte is 0xff when it was a character of the alphabet.
+ * @return The digits.
+ */
+hi_target("ssse3") inline __m128i base64_decode_lookup_ssse3(__m128i in, char c62, char c63, __m128i& valid) noexcept
+{
+    // Bytes with the top bit set are negative, and are outside every range.
+    auto const upper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), in));
+    auto const lower = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), in));
+    auto const digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), in));
+    auto const is62 = _mm_cmpeq_epi8(in, _mm_set1_epi8(c62));
+    auto const is63 = _mm_cmpeq_epi8(in, _mm_set1_epi8(c63));
+    valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, is62)), is63);
+
+    auto offset = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+    offset = _mm_or_si128(offset, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+    offset = _mm_or_si128(offset, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+    offset = _mm_or_si128(offset, _mm_and_si128(is62, _mm_set1_epi8(static_cast<char>(62 - c62))));
+    offset = _mm_or_si128(offset, _mm_and_si128(is63, _mm_set1_epi8(static_cast<char>(63 - c63))));
+    return _mm_add_epi8(in, offset);
+}
+
+/** Pack groups of 4 6-bit digits into 3 bytes, in the first 12 bytes of each 128-bit lane.
+ */
+hi_target("ssse3") inline __m128i base64_decode_pack_ssse3(__m128i digits) noexcept
+{
+    auto const pairs = _mm_maddubs_epi16(digits, _mm_set1_epi32(0x01400140));
+    auto const quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(quads, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+/** Decode base-64 characters into bytes using SSSE3.
+ *
+ * Decoding stops before the first 16 characters that include a character
+ * that is not part of the alphabet, such as white-space or padding.
+ *
+ * @param first The characters to decode.
+ * @param size The number of characters.
+ * @param[out] output The bytes, 3 for every 4 characters that are decoded; 4 more bytes may be overwritten.
+ * @param c62 The character for the digit 62.
+ * @param c63 The character for the digit 63.
+ * @return The number of characters that were decoded, a multiple of 4.
+ */
+hi_target("ssse3") inline std::size_t
+base64_decode_ssse3(char const *first, std::size_t size, std::byte *output, char c62, char c63) noexcept
+{
+    auto i = 0_uz;
+    for (; i + 16 <= size; i += 16, output += 12) {
+        auto const in = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i));
+        auto valid = __m128i{};
+        auto const digits = base64_decode_lookup_ssse3(in, c62, c63, valid);
+        if (_mm_movemask_epi8(valid) != 0xffff) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), base64_decode_pack_ssse3(digits));
+    }
+    return i;
+}
+
+/** Encode bytes into base-64 characters using AVX2.
+ *
+ * @see base64_encode_ssse3()
+ */
+hi_target("avx2") inline std::size_t
+base64_encode_avx2(std::byte const *first, std::size_t size, char *output, char c62, char c63) noexcept
+{
+    auto const split_shuffle = _mm256_set_epi8(
+        10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1, 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    auto const offsets = _mm256_setr_epi8(
+        'a' - 26,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        static_cast<char>(c62 - 62),
+        static_cast<char>(c63 - 63),
+        'A',
+        0,
+        0,
+        'a' - 26,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        static_cast<char>(c62 - 62),
+        static_cast<char>(c63 - 63),
+        'A',
+        0,
+        0);
+
+    auto i = 0_uz;
+    // 24 bytes are encoded from two 16 byte loads, 12 bytes apart.
+    for (; i + 28 <= size; i += 24, output += 32) {
+        auto const lo = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i));
+        auto const hi = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + i + 12));
+        auto in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+        in = _mm256_shuffle_epi8(in, split_shuffle);
+        auto const t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        auto const t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+        auto const indices = _mm256_or_si256(t0, t1);
+
+        auto j = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        j = _mm256_or_si256(j, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+        auto const out = _mm256_add_epi8(_mm256_shuffle_epi8(offsets, j), indices);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output), out);
+    }
+
+    return i + base64_encode_ssse3(first + i, size - i, output, c62, c63);
+}
+
+/** Decode base-64 characters into bytes using AVX2.
+ *
+ * @see base64_decode_ssse3()
+ */
+hi_target("avx2") inline std::size_t
+base64_decode_avx2(char const *first, std::size_t size, std::byte *output, char c62, char c63) noexcept
+{
+    auto const pack_shuffle = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    auto i = 0_uz;
+    for (; i + 32 <= size; i += 32, output += 24) {
+        auto const in = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(first + i));
+
+        auto const upper =
+            _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), in));
+        auto const lower =
+            _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), in));
+        auto const digit =
+            _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), in));
+        auto const is62 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(c62));
+        auto const is63 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(c63));
+        auto const valid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, is62)), is63);
+        if (_mm256_movemask_epi8(valid) != -1) {
+            break;
+        }
+
+        auto offset = _mm256_and_si256(upper, _mm256_set1_epi8(-'A'));
+        offset = _mm256_or_si256(offset, _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a')));
+        offset = _mm256_or_si256(offset, _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+        offset = _mm256_or_si256(offset, _mm256_and_si256(is62, _mm256_set1_epi8(static_cast<char>(62 - c62))));
+        offset = _mm256_or_si256(offset, _mm256_and_si256(is63, _mm256_set1_epi8(static_cast<char>(63 - c63))));
+        auto const digits = _mm256_add_epi8(in, offset);
+
+        auto const pairs = _mm256_maddubs_epi16(digits, _mm256_set1_epi32(0x01400140));
+        auto const quads = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        auto const out = _mm256_shuffle_epi8(quads, pack_shuffle);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm256_castsi256_si128(out));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 12), _mm256_extracti128_si256(out, 1));
+    }
+
+    return i + base64_decode_ssse3(first + i, size - i, output, c62, c63);
+}
+#endif
+
+/** Encode bytes into base-64 characters using SIMD instructions.
+ *
+ * @param first The bytes to encode.
+ * @param size The number of bytes.
+ * @param[out] output The characters, 4 for every 3 bytes that are encoded.
+ * @param c62 The character for the digit 62.
+ * @param c63 The character for the digit 63.
+ * @return The number of bytes that were encoded, a multiple of 3; the rest
+ *         must be encoded by the scalar code.
+ */
+inline std::size_t base64_encode_simd(std::byte const *first, std::size_t size, char *output, char c62, char c63) noexcept
+{
+#if HI_PROCESSOR == HI_CPU_X86_64
+    if (has_avx2()) {
+        return base64_encode_avx2(first, size, output, c62, c63);
+    } else if (has_ssse3()) {
+        return base64_encode_ssse3(first, size, output, c62, c63);
+    }
+#endif
+    return 0;
+}
+
+/** Decode base-64 characters into bytes using SIMD instructions.
+ *
+ * @param first The characters to decode.
+ * @param size The number of characters.
+ * @param[out] output The bytes, 3 for every 4 characters that are decoded; 4 more bytes may be overwritten.
+ * @param c62 The character for the digit 62.
+ * @param c63 The character for the digit 63.
+ * @return The number of characters that were decoded, a multiple of 4; the rest,
+ *         starting near a character that is not part of the alphabet, must be decoded
+ *         by the scalar code.
+ */
+inline std::size_t base64_decode_simd(char const *first, std::size_t size, std::byte *output, char c62, char c63) noexcept
+{
+#if HI_PROCESSOR == HI_CPU_X86_64
+    if (has_avx2()) {
+        return base64_decode_avx2(first, size, output, c62, c63);
+    } else if (has_ssse3()) {
+        return base64_decode_ssse3(first, size, output, c62, c63);
+    }
+#endif
+    return 0;
+}
+
 } // namespace detail
 
 template<detail::base_n_alphabet Alphabet, int CharsPerBlock, int BytesPerBlock>
@@ -188,7 +471,22 @@ public:
      */
     constexpr static std::string encode(std::span<std::byte const> bytes) noexcept
     {
-        return encode(begin(bytes), end(bytes));
+        auto r = std::string{};
+        auto first = bytes.data();
+        auto const last = first + bytes.size();
+
+        if constexpr (radix == 64) {
+            if (not std::is_constant_evaluated()) {
+                // Encode the whole blocks with SIMD; the scalar code finishes the tail.
+                r.resize(bytes.size() / 3 * 4);
+                auto const n = detail::base64_encode_simd(first, bytes.size(), r.data(), c62, c63);
+                r.resize(n / 3 * 4);
+                first += n;
+            }
+        }
+
+        encode(first, last, std::back_inserter(r));
+        return r;
     }
 
     /** Decodes a UTF-8 string into bytes.
@@ -239,12 +537,55 @@ public:
     static bstring decode(std::string_view str)
     {
         auto r = bstring{};
-        auto i = decode(begin(str), end(str), std::back_inserter(r));
-        hi_check(i == end(str), "base-n encoded string not completely decoded");
+        auto first = str.data();
+        auto const last = first + str.size();
+
+        if constexpr (radix == 64) {
+            // The SIMD code writes up to 4 bytes beyond the decoded bytes.
+            r.resize(str.size() / 4 * 3 + 4);
+            auto output = r.data();
+
+            while (true) {
+                auto const n = detail::base64_decode_simd(first, static_cast<std::size_t>(last - first), output, c62, c63);
+                first += n;
+                output += n / 4 * 3;
+
+                // Decode a single block with the scalar code, skipping the white-space and
+                // padding that stopped the SIMD code; after which the SIMD code can continue.
+                auto block_last = first;
+                auto nr_digits = 0;
+                while (block_last != last and nr_digits != chars_per_block) {
+                    auto const digit = alphabet.int_from_char(*block_last);
+                    if (digit == -2) {
+                        break;
+                    } else if (digit >= 0) {
+                        ++nr_digits;
+                    }
+                    ++block_last;
+                }
+                if (nr_digits != chars_per_block) {
+                    break;
+                }
+
+                decode(first, block_last, output);
+                first = block_last;
+                output += bytes_per_block;
+            }
+
+            r.resize(static_cast<std::size_t>(output - r.data()));
+        }
+
+        auto i = decode(first, last, std::back_inserter(r));
+        hi_check(i == last, "base-n encoded string not completely decoded");
         return r;
     }
 
 private:
+    /** The characters for the last two digits, which differ between the base-64 alphabets.
+     */
+    constexpr static char c62 = radix == 64 ? alphabet.char_from_int_table[62] : '\0';
+    constexpr static char c63 = radix == 64 ? alphabet.char_from_int_table[63] : '\0';
+
     template<typename ItOut>
     static void encode_block(long long block, long long nr_bytes, ItOut output) noexcept
     {
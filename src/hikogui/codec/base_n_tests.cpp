@@ -5,6 +5,9 @@
 #include "base_n.hpp"
 #include "../container/container.hpp"
 #include <hikotest/hikotest.hpp>
+#include <string>
+#include <iterator>
+#include <span>
 
 TEST_SUITE(base_n_suite) {
 
@@ -55,4 +58,48 @@ TEST_CASE(base64_decode)
     REQUIRE_THROWS(hi::base64::decode("SGVsbG8g,V29ybGQK"), hi::parse_error);
 }
 
+template<typename Base>
+static void test_long()
+{
+    auto bytes = hi::bstring{};
+    for (auto i = 0; i != 1000; ++i) {
+        bytes += static_cast<std::byte>(i * 7 + i / 13);
+    }
+
+    // Compare the SIMD code used for spans and strings with the scalar code used for iterators.
+    for (auto size = std::size_t{0}; size <= bytes.size(); size += size < 100 ? 1 : 29) {
+        auto const message = std::span<std::byte const>{bytes.data(), size};
+        auto const text = Base::encode(message);
+        REQUIRE(text == Base::encode(message.begin(), message.end()));
+        REQUIRE(Base::decode(text) == hi::bstring(message.begin(), message.end()));
+
+        // White-space, like line breaks, anywhere in the text.
+        auto wrapped = std::string{};
+        for (auto i = std::size_t{0}; i != text.size(); ++i) {
+            if (i % 76 == 75 or i % 97 == 40) {
+                wrapped += i % 2 == 0 ? "\r\n" : " ";
+            }
+            wrapped += text[i];
+        }
+        REQUIRE(Base::decode(wrapped) == hi::bstring(message.begin(), message.end()));
+
+        // An invalid character anywhere in the text.
+        if (not text.empty()) {
+            auto invalid = text;
+            invalid[size * 5 % invalid.size()] = ',';
+            REQUIRE_THROWS(Base::decode(invalid), hi::parse_error);
+        }
+    }
+}
+
+TEST_CASE(base64_long)
+{
+    test_long<hi::base64>();
+}
+
+TEST_CASE(base64url_long)
+{
+    test_long<hi::base64url>();
+}
+
 };
@@ -3,15 +3,25 @@
 
 #include "base_n.hpp" // export
 #include "BON8.hpp" // export
+#include "BON8_view.hpp" // export
 #include "datum.hpp" // export
+#include "deflate.hpp" // export
 #include "gzip.hpp" // export
 #include "huffman.hpp" // export
 #include "indent.hpp" // export
 #include "inflate.hpp" // export
+#include "inflate_stream.hpp" // export
 #include "JSON.hpp" // export
+#include "JSON_fast.hpp" // export
+#include "JSON_view.hpp" // export
+#include "JSON_writer.hpp" // export
 #include "jsonpath.hpp" // export
+#include "jsonpath_set.hpp" // export
 #include "pickle.hpp" // export
 #include "png.hpp" // export
+#include "png_encode.hpp" // export
+#include "png_unfilter.hpp" // export
+#include "serialize.hpp" // export
 #include "SHA2.hpp" // export
 #include "zlib.hpp" // export
 
@@ -17,7 +17,11 @@
 #include <chrono>
 #include <limits>
 #include <vector>
-#include <map>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <iterator>
+#include <cstring>
 
 hi_warning_push();
 // C26476: Expression/symbol '...' uses a naked union '...' with multiple type pointers: Use variant instead (type.7.).
@@ -192,13 +196,24 @@ constexpr bool is_datum_type_v = is_datum_type<T>::value;
  * of scripting languages, or for serializing and deserializing JSON and other object
  * storage formats.
  *
+ * A datum is 16 bytes. Strings of up to 14 bytes are stored inside the datum, longer
+ * strings, vectors, maps and byte-strings are allocated. Because of this a string is
+ * retrieved as a `std::string_view` with `get<std::string>()` and `get_if<std::string>()`.
+ *
  * Not only does this datum handle the storage of data, but can also different operations
  * which are dynamically executed.
  */
 hi_export class datum {
 public:
     using vector_type = std::vector<datum>;
-    using map_type = std::map<datum, datum>;
+
+    /** The map of a datum.
+     *
+     * A `flat_map` is compact and fast to look up, but inserting a new key is O(n).
+     * Construct large maps from a vector of items, like the JSON parser does, instead
+     * of assigning each key through `operator[]`.
+     */
+    using map_type = flat_map<datum, datum>;
     struct break_type {};
     struct continue_type {};
 
@@ -230,42 +245,60 @@ public:
         delete_pointer();
     }
 
-    constexpr datum(datum const& other) noexcept : _tag(other._tag), _value(other._value)
+    constexpr datum(datum const& other) noexcept
     {
+        copy_representation(other);
         if (other.is_pointer()) {
             copy_pointer(other);
         }
     }
 
-    constexpr datum(datum&& other) noexcept : _tag(other._tag), _value(other._value)
+    constexpr datum(datum&& other) noexcept
     {
-        other._tag = tag_type::monostate;
-        other._value._long_long = 0;
+        copy_representation(other);
+        other._data.tag = tag_type::monostate;
+        other._data.value._long_long = 0;
     }
 
-    constexpr datum() noexcept : _tag(tag_type::monostate), _value(0) {}
-    constexpr explicit datum(std::monostate) noexcept : _tag(tag_type::monostate), _value(0) {}
-    constexpr explicit datum(nullptr_t) noexcept : _tag(tag_type::null), _value(0) {}
-    constexpr explicit datum(continue_type) noexcept : _tag(tag_type::flow_continue), _value(0) {}
-    constexpr explicit datum(break_type) noexcept : _tag(tag_type::flow_break), _value(0) {}
-    constexpr explicit datum(bool value) noexcept : _tag(tag_type::boolean), _value(value) {}
+    constexpr datum() noexcept : _data{tag_type::monostate, 0} {}
+    constexpr explicit datum(std::monostate) noexcept : _data{tag_type::monostate, 0} {}
+    constexpr explicit datum(nullptr_t) noexcept : _data{tag_type::null, 0} {}
+    constexpr explicit datum(continue_type) noexcept : _data{tag_type::flow_continue, 0} {}
+    constexpr explicit datum(break_type) noexcept : _data{tag_type::flow_break, 0} {}
+    constexpr explicit datum(bool value) noexcept : _data{tag_type::boolean, value} {}
     constexpr explicit datum(std::floating_point auto value) noexcept :
-        _tag(tag_type::floating_point), _value(narrow_cast<double>(value))
+        _data{tag_type::floating_point, narrow_cast<double>(value)}
     {
     }
 
     constexpr explicit datum(numeric_integral auto value) noexcept :
-        _tag(tag_type::integral), _value(narrow_cast<long long>(value))
+        _data{tag_type::integral, narrow_cast<long long>(value)}
+    {
+    }
+
+    constexpr explicit datum(std::chrono::year_month_day value) noexcept : _data{tag_type::year_month_day, value} {}
+    explicit datum(std::string value) noexcept
+    {
+        if (value.size() <= short_string_capacity) {
+            construct_short_string(value);
+        } else {
+            _data = {tag_type::string, new std::string{std::move(value)}};
+        }
+    }
+
+    explicit datum(std::string_view value) noexcept
     {
+        if (value.size() <= short_string_capacity) {
+            construct_short_string(value);
+        } else {
+            _data = {tag_type::string, new std::string{value}};
+        }
     }
 
-    constexpr explicit datum(std::chrono::year_month_day value) noexcept : _tag(tag_type::year_month_day), _value(value) {}
-    explicit datum(std::string value) noexcept : _tag(tag_type::string), _value(new std::string{std::move(value)}) {}
-    explicit datum(std::string_view value) noexcept : _tag(tag_type::string), _value(new std::string{value}) {}
-    explicit datum(char const* value) noexcept : _tag(tag_type::string), _value(new std::string{value}) {}
-    explicit datum(vector_type value) noexcept : _tag(tag_type::vector), _value(new vector_type{std::move(value)}) {}
-    explicit datum(map_type value) noexcept : _tag(tag_type::map), _value(new map_type{std::move(value)}) {}
-    explicit datum(bstring value) noexcept : _tag(tag_type::bstring), _value(new bstring{std::move(value)}) {}
+    explicit datum(char const* value) noexcept : datum(std::string_view{value}) {}
+    explicit datum(vector_type value) noexcept : _data{tag_type::vector, new vector_type{std::move(value)}} {}
+    explicit datum(map_type value) noexcept : _data{tag_type::map, new map_type{std::move(value)}} {}
+    explicit datum(bstring value) noexcept : _data{tag_type::bstring, new bstring{std::move(value)}} {}
 
     template<typename... Args>
     [[nodiscard]] static datum make_vector(Args const&... args) noexcept
@@ -309,8 +342,7 @@ public:
         hi_return_on_self_assignment(other);
 
         delete_pointer();
-        _tag = other._tag;
-        _value = other._value;
+        copy_representation(other);
         if (other.is_pointer()) {
             copy_pointer(other);
         }
@@ -319,110 +351,123 @@ public:
 
     constexpr datum& operator=(datum&& other) noexcept
     {
-        std::swap(_tag, other._tag);
-        std::swap(_value, other._value);
+        hi_return_on_self_assignment(other);
+
+        delete_pointer();
+        copy_representation(other);
+        other._data.tag = tag_type::monostate;
+        other._data.value._long_long = 0;
         return *this;
     }
 
     constexpr datum& operator=(std::floating_point auto value) noexcept(sizeof(value) <= 4)
     {
         delete_pointer();
-        _tag = tag_type::floating_point;
-        _value = static_cast<double>(value);
+        _data.tag = tag_type::floating_point;
+        _data.value = static_cast<double>(value);
         return *this;
     }
 
     constexpr datum& operator=(numeric_integral auto value) noexcept(sizeof(value) <= 4)
     {
         delete_pointer();
-        _tag = tag_type::integral;
-        _value = static_cast<long long>(value);
+        _data.tag = tag_type::integral;
+        _data.value = static_cast<long long>(value);
         return *this;
     }
 
     constexpr datum& operator=(bool value) noexcept
     {
         delete_pointer();
-        _tag = tag_type::boolean;
-        _value = value;
+        _data.tag = tag_type::boolean;
+        _data.value = value;
         return *this;
     }
 
     constexpr datum& operator=(std::chrono::year_month_day value) noexcept
     {
         delete_pointer();
-        _tag = tag_type::year_month_day;
-        _value = value;
+        _data.tag = tag_type::year_month_day;
+        _data.value = value;
         return *this;
     }
 
     constexpr datum& operator=(std::monostate) noexcept
     {
         delete_pointer();
-        _tag = tag_type::monostate;
-        _value = 0;
+        _data.tag = tag_type::monostate;
+        _data.value = 0;
         return *this;
     }
 
     constexpr datum& operator=(nullptr_t) noexcept
     {
         delete_pointer();
-        _tag = tag_type::null;
-        _value = 0;
+        _data.tag = tag_type::null;
+        _data.value = 0;
         return *this;
     }
 
     datum& operator=(std::string value) noexcept
     {
-        delete_pointer();
-        _tag = tag_type::string;
-        _value = new std::string{std::move(value)};
+        if (value.size() <= short_string_capacity) {
+            delete_pointer();
+            construct_short_string(value);
+        } else if (_data.tag == tag_type::string) {
+            *_data.value._string = std::move(value);
+        } else {
+            delete_pointer();
+            _data = {tag_type::string, new std::string{std::move(value)}};
+        }
         return *this;
     }
 
     datum& operator=(char const* value) noexcept
     {
-        delete_pointer();
-        _tag = tag_type::string;
-        _value = new std::string{value};
-        return *this;
+        return *this = std::string_view{value};
     }
 
     datum& operator=(std::string_view value) noexcept
     {
-        delete_pointer();
-        _tag = tag_type::string;
-        _value = new std::string{value};
+        if (value.size() <= short_string_capacity) {
+            delete_pointer();
+            construct_short_string(value);
+        } else if (_data.tag == tag_type::string) {
+            *_data.value._string = value;
+        } else {
+            delete_pointer();
+            _data = {tag_type::string, new std::string{value}};
+        }
         return *this;
     }
 
     datum& operator=(vector_type value) noexcept
     {
         delete_pointer();
-        _tag = tag_type::vector;
-        _value = new vector_type{std::move(value)};
+        _data.tag = tag_type::vector;
+        _data.value = new vector_type{std::move(value)};
         return *this;
     }
 
     datum& operator=(map_type value) noexcept
     {
         delete_pointer();
-        _tag = tag_type::map;
-        _value = new map_type{std::move(value)};
+        _data.tag = tag_type::map;
+        _data.value = new map_type{std::move(value)};
         return *this;
     }
 
     datum& operator=(bstring value) noexcept
     {
         delete_pointer();
-        _tag = tag_type::bstring;
-        _value = new bstring{std::move(value)};
+        _data.tag = tag_type::bstring;
+        _data.value = new bstring{std::move(value)};
         return *this;
     }
 
     constexpr explicit operator bool() const noexcept
     {
-        switch (_tag) {
+        switch (_data.tag) {
         case tag_type::floating_point:
             return to_bool(get<double>(*this));
         case tag_type::boolean:
@@ -431,6 +476,7 @@ public:
             return to_bool(get<long long>(*this));
         case tag_type::year_month_day:
             return true;
+        case tag_type::short_string:
         case tag_type::string:
             return not get<std::string>(*this).empty();
         case tag_type::vector:
@@ -446,7 +492,8 @@ public:
 
     [[nodiscard]] constexpr bool empty() const
     {
-        switch (_tag) {
+        switch (_data.tag) {
+        case tag_type::short_string:
         case tag_type::string:
             return get<std::string>(*this).empty();
         case tag_type::vector:
@@ -463,7 +510,7 @@ public:
     template<std::floating_point T>
     constexpr explicit operator T() const
     {
-        switch (_tag) {
+        switch (_data.tag) {
         case tag_type::floating_point:
             return static_cast<T>(get<double>(*this));
         case tag_type::integral:
@@ -512,49 +559,31 @@ public:
 
     explicit operator std::string() const noexcept
     {
-        switch (_tag) {
+        switch (_data.tag) {
         case tag_type::monostate:
             return "undefined";
         case tag_type::floating_point:
-            return hi::to_string(_value._double);
+            return hi::to_string(_data.value._double);
         case tag_type::integral:
-            return to_string(_value._long_long);
+            return to_string(_data.value._long_long);
         case tag_type::boolean:
-            return _value._bool ? "true" : "false";
+            return _data.value._bool ? "true" : "false";
         case tag_type::year_month_day:
-            return std::format("{:%Y-%m-%d}", _value._year_month_day);
+            return std::format("{:%Y-%m-%d}", _data.value._year_month_day);
         case tag_type::null:
             return "null";
         case tag_type::flow_break:
             return "break";
         case tag_type::flow_continue:
             return "continue";
+        case tag_type::short_string:
         case tag_type::string:
-            return *_value._string;
+            return std::string{get<std::string>(*this)};
         case tag_type::vector:
-            {
-                auto r = std::string{"["};
-                for (auto const& item : *_value._vector) {
-                    r += repr(item);
-                    r += ',';
-                }
-                r += ']';
-                return r;
-            };
         case tag_type::map:
-            {
-                auto r = std::string{"{"};
-                for (auto const& item : *_value._map) {
-                    r += repr(item.first);
-                    r += ':';
-                    r += repr(item.second);
-                    r += ',';
-                }
-                r += '}';
-                return r;
-            };
+            return repr(*this);
         case tag_type::bstring:
-            return base64::encode(*_value._bstring);
+            return base64::encode(*_data.value._bstring);
         default:
             hi_no_default();
         }
@@ -563,7 +592,7 @@ public:
     explicit operator std::string_view() const
     {
         if (auto s = get_if<std::string>(*this)) {
-            return std::string_view{*s};
+            return *s;
         } else {
             throw std::domain_error(std::format("Can't convert {} to an std::string_view", repr(*this)));
         }
@@ -590,7 +619,7 @@ public:
     explicit operator bstring() const
     {
         // XXX should be able to base-64 decode a std::string.
-        if (_tag != tag_type::bstring) {
+        if (_data.tag != tag_type::bstring) {
             throw std::domain_error(std::format("Can't convert {} to an bstring", repr(*this)));
         }
         return get<bstring>(*this);
@@ -598,7 +627,7 @@ public:
 
     [[nodiscard]] constexpr char const* type_name() const noexcept
     {
-        switch (_tag) {
+        switch (_data.tag) {
         case tag_type::floating_point:
             return "float";
         case tag_type::integral:
@@ -607,6 +636,7 @@ public:
             return "bool";
         case tag_type::year_month_day:
             return "date";
+        case tag_type::short_string:
         case tag_type::string:
             return "string";
         case tag_type::vector:
@@ -624,7 +654,7 @@ public:
      */
     [[nodiscard]] constexpr bool is_undefined() const noexcept
     {
-        return _tag == tag_type::monostate;
+        return _data.tag == tag_type::monostate;
     }
 
     /** Check if the result of a expression was a break flow control statement.
@@ -632,7 +662,7 @@ public:
      */
     [[nodiscard]] constexpr bool is_break() const noexcept
     {
-        return _tag == tag_type::flow_break;
+        return _data.tag == tag_type::flow_break;
     }
 
     /** Check if the result of a expression was a continue flow control statement.
@@ -640,32 +670,33 @@ public:
      */
     [[nodiscard]] constexpr bool is_continue() const noexcept
     {
-        return _tag == tag_type::flow_continue;
+        return _data.tag == tag_type::flow_continue;
     }
 
     [[nodiscard]] std::size_t hash() const noexcept
     {
-        switch (_tag) {
+        switch (_data.tag) {
         case tag_type::floating_point:
-            return std::hash<double>{}(_value._double);
+            return std::hash<double>{}(_data.value._double);
         case tag_type::integral:
-            return std::hash<long long>{}(_value._long_long);
+            return std::hash<long long>{}(_data.value._long_long);
         case tag_type::boolean:
-            return std::hash<bool>{}(_value._bool);
+            return std::hash<bool>{}(_data.value._bool);
         case tag_type::year_month_day:
             {
                 uint32_t r = 0;
-                r |= narrow_cast<uint32_t>(static_cast<int>(_value._year_month_day.year())) << 16;
-                r |= narrow_cast<uint32_t>(static_cast<unsigned>(_value._year_month_day.month())) << 8;
-                r |= narrow_cast<uint32_t>(static_cast<unsigned>(_value._year_month_day.day()));
+                r |= narrow_cast<uint32_t>(static_cast<int>(_data.value._year_month_day.year())) << 16;
+                r |= narrow_cast<uint32_t>(static_cast<unsigned>(_data.value._year_month_day.month())) << 8;
+                r |= narrow_cast<uint32_t>(static_cast<unsigned>(_data.value._year_month_day.day()));
                 return std::hash<uint32_t>{}(r);
             }
+        case tag_type::short_string:
         case tag_type::string:
-            return std::hash<std::string>{}(*_value._string);
+            return std::hash<std::string_view>{}(get<std::string>(*this));
         case tag_type::vector:
             {
                 std::size_t r = 0;
-                for (auto const& v : *_value._vector) {
+                for (auto const& v : *_data.value._vector) {
                     r = hash_mix(r, v.hash());
                 }
                 return r;
@@ -673,13 +704,13 @@ public:
         case tag_type::map:
             {
                 std::size_t r = 0;
-                for (auto const& kv : *_value._map) {
+                for (auto const& kv : *_data.value._map) {
                     r = hash_mix(r, kv.first.hash(), kv.second.hash());
                 }
                 return r;
             }
         case tag_type::bstring:
-            return std::hash<bstring>{}(*_value._bstring);
+            return std::hash<bstring>{}(*_data.value._bstring);
         default:
             hi_no_default();
         }
@@ -687,7 +718,7 @@ public:
 
     [[nodiscard]] constexpr std::size_t size() const
     {
-        if (auto const* s = get_if<std::string>(*this)) {
+        if (auto const s = get_if<std::string>(*this)) {
             return s->size();
         } else if (auto const* v = get_if<vector_type>(*this)) {
             return v->size();
@@ -1035,7 +1066,7 @@ public:
     [[nodiscard]] constexpr datum& operator++()
     {
         if (holds_alternative<long long>(*this)) {
-            ++_value._long_long;
+            ++_data.value._long_long;
             return *this;
         } else {
             throw std::domain_error(std::format("Can not evaluate ++{}", repr(*this)));
@@ -1045,7 +1076,7 @@ public:
     [[nodiscard]] constexpr datum& operator--()
     {
         if (holds_alternative<long long>(*this)) {
-            --_value._long_long;
+            --_data.value._long_long;
             return *this;
         } else {
             throw std::domain_error(std::format("Can not evaluate --{}", repr(*this)));
@@ -1056,7 +1087,7 @@ public:
     {
         if (holds_alternative<long long>(*this)) {
             auto tmp = *this;
-            _value._long_long++;
+            _data.value._long_long++;
             return tmp;
         } else {
             throw std::domain_error(std::format("Can not evaluate {}++", repr(*this)));
@@ -1066,7 +1097,7 @@ public:
     {
         if (holds_alternative<long long>(*this)) {
             auto tmp = *this;
-            _value._long_long--;
+            _data.value._long_long--;
             return tmp;
         } else {
             throw std::domain_error(std::format("Can not evaluate {}--", repr(*this)));
@@ -1114,8 +1145,8 @@ public:
         } else if (auto const ymds = promote_if<std::chrono::year_month_day>(lhs, rhs)) {
             return ymds.lhs() == ymds.rhs();
 
-        } else if (auto const strings = promote_if<std::string>(lhs, rhs)) {
-            return strings.lhs() == strings.rhs();
+        } else if (holds_alternative<std::string>(lhs) and holds_alternative<std::string>(rhs)) {
+            return get<std::string>(lhs) == get<std::string>(rhs);
 
         } else if (auto const vectors = promote_if<vector_type>(lhs, rhs)) {
             return vectors.lhs() == vectors.rhs();
@@ -1124,7 +1155,7 @@ public:
             return maps.lhs() == maps.rhs();
 
         } else {
-            return lhs._tag == rhs._tag;
+            return lhs._data.tag == rhs._data.tag;
         }
     }
 
@@ -1168,8 +1199,8 @@ public:
         } else if (auto const year_month_days = promote_if<std::chrono::year_month_day>(lhs, rhs)) {
             return year_month_days.lhs() <=> year_month_days.rhs();
 
-        } else if (auto const strings = promote_if<std::string>(lhs, rhs)) {
-            return strings.lhs() <=> strings.rhs();
+        } else if (holds_alternative<std::string>(lhs) and holds_alternative<std::string>(rhs)) {
+            return get<std::string>(lhs) <=> get<std::string>(rhs);
 
         } else if (auto const vectors = promote_if<vector_type>(lhs, rhs)) {
             return vectors.lhs() <=> vectors.rhs();
@@ -1181,7 +1212,7 @@ public:
             return bstrings.lhs() <=> bstrings.rhs();
 
         } else {
-            return lhs._tag <=> rhs._tag;
+            return lhs.type_order() <=> rhs.type_order();
         }
     }
 
@@ -1249,8 +1280,10 @@ public:
         } else if (auto const long_longs = promote_if<long long>(lhs, rhs)) {
             return datum{long_longs.lhs() + long_longs.rhs()};
 
-        } else if (auto const strings = promote_if<std::string>(lhs, rhs)) {
-            return datum{strings.lhs() + strings.rhs()};
+        } else if (holds_alternative<std::string>(lhs) and holds_alternative<std::string>(rhs)) {
+            auto r = std::string{get<std::string>(lhs)};
+            r += get<std::string>(rhs);
+            return datum{std::move(r)};
 
         } else if (auto const vectors = promote_if<vector_type>(lhs, rhs)) {
             auto r = vectors.lhs();
@@ -1542,52 +1575,9 @@ public:
      */
     [[nodiscard]] friend std::string repr(datum const& rhs) noexcept
     {
-        switch (rhs._tag) {
-        case tag_type::monostate:
-            return "undefined";
-        case tag_type::floating_point:
-            return std::format("{:.1f}", rhs._value._double);
-        case tag_type::integral:
-            return std::format("{}", rhs._value._long_long);
-        case tag_type::boolean:
-            return rhs._value._bool ? "true" : "false";
-        case tag_type::year_month_day:
-            return std::format("{:%Y-%m-%d}", rhs._value._year_month_day);
-        case tag_type::null:
-            return "null";
-        case tag_type::flow_break:
-            return "break";
-        case tag_type::flow_continue:
-            return "continue";
-        case tag_type::string:
-            return std::format("\"{}\"", *rhs._value._string);
-        case tag_type::vector:
-            {
-                auto r = std::string{"["};
-                for (auto const& item : *rhs._value._vector) {
-                    r += repr(item);
-                    r += ',';
-                }
-                r += ']';
-                return r;
-            };
-        case tag_type::map:
-            {
-                auto r = std::string{"{"};
-                for (auto const& item : *rhs._value._map) {
-                    r += repr(item.first);
-                    r += ':';
-                    r += repr(item.second);
-                    r += ',';
-                }
-                r += '}';
-                return r;
-            };
-        case tag_type::bstring:
-            return base64::encode(*rhs._value._bstring);
-        default:
-            hi_no_default();
-        }
+        auto r = std::string{};
+        rhs.append_repr(r);
+        return r;
     }
 
     /** Get the string representation of the value.
@@ -1607,29 +1597,29 @@ public:
     [[nodiscard]] friend constexpr bool holds_alternative(datum const& rhs) noexcept
     {
         if constexpr (std::is_same_v<T, double>) {
-            return rhs._tag == tag_type::floating_point;
+            return rhs._data.tag == tag_type::floating_point;
         } else if constexpr (std::is_same_v<T, long long>) {
-            return rhs._tag == tag_type::integral;
+            return rhs._data.tag == tag_type::integral;
         } else if constexpr (std::is_same_v<T, bool>) {
-            return rhs._tag == tag_type::boolean;
+            return rhs._data.tag == tag_type::boolean;
         } else if constexpr (std::is_same_v<T, std::chrono::year_month_day>) {
-            return rhs._tag == tag_type::year_month_day;
+            return rhs._data.tag == tag_type::year_month_day;
         } else if constexpr (std::is_same_v<T, nullptr_t>) {
-            return rhs._tag == tag_type::null;
+            return rhs._data.tag == tag_type::null;
         } else if constexpr (std::is_same_v<T, std::monostate>) {
-            return rhs._tag == tag_type::monostate;
+            return rhs._data.tag == tag_type::monostate;
         } else if constexpr (std::is_same_v<T, break_type>) {
-            return rhs._tag == tag_type::flow_break;
+            return rhs._data.tag == tag_type::flow_break;
         } else if constexpr (std::is_same_v<T, continue_type>) {
-            return rhs._tag == tag_type::flow_continue;
+            return rhs._data.tag == tag_type::flow_continue;
         } else if constexpr (std::is_same_v<T, std::string>) {
-            return rhs._tag == tag_type::string;
+            return rhs._data.tag == tag_type::string or rhs._data.tag == tag_type::short_string;
         } else if constexpr (std::is_same_v<T, vector_type>) {
-            return rhs._tag == tag_type::vector;
+            return rhs._data.tag == tag_type::vector;
         } else if constexpr (std::is_same_v<T, map_type>) {
-            return rhs._tag == tag_type::map;
+            return rhs._data.tag == tag_type::map;
         } else if constexpr (std::is_same_v<T, bstring>) {
-            return rhs._tag == tag_type::bstring;
+            return rhs._data.tag == tag_type::bstring;
         } else {
             hi_static_no_default();
         }
@@ -1665,25 +1655,24 @@ public:
      * @return A copy of the value in the datum.
      */
     template<typename T>
+        requires(not std::is_same_v<T, std::string>)
     [[nodiscard]] friend constexpr T const& get(datum const& rhs) noexcept
     {
         hi_axiom(holds_alternative<T>(rhs));
         if constexpr (std::is_same_v<T, double>) {
-            return rhs._value._double;
+            return rhs._data.value._double;
         } else if constexpr (std::is_same_v<T, long long>) {
-            return rhs._value._long_long;
+            return rhs._data.value._long_long;
         } else if constexpr (std::is_same_v<T, bool>) {
-            return rhs._value._bool;
+            return rhs._data.value._bool;
         } else if constexpr (std::is_same_v<T, std::chrono::year_month_day>) {
-            return rhs._value._year_month_day;
-        } else if constexpr (std::is_same_v<T, std::string>) {
-            return *rhs._value._string;
+            return rhs._data.value._year_month_day;
         } else if constexpr (std::is_same_v<T, vector_type>) {
-            return *rhs._value._vector;
+            return *rhs._data.value._vector;
         } else if constexpr (std::is_same_v<T, map_type>) {
-            return *rhs._value._map;
+            return *rhs._data.value._map;
         } else if constexpr (std::is_same_v<T, bstring>) {
-            return *rhs._value._bstring;
+            return *rhs._data.value._bstring;
         } else {
             hi_static_no_default();
         }
@@ -1698,25 +1687,24 @@ public:
      * @return A copy of the value in the datum.
      */
     template<typename T>
+        requires(not std::is_same_v<T, std::string>)
     [[nodiscard]] friend constexpr T& get(datum& rhs) noexcept
     {
         hi_axiom(holds_alternative<T>(rhs));
         if constexpr (std::is_same_v<T, double>) {
-            return rhs._value._double;
+            return rhs._data.value._double;
         } else if constexpr (std::is_same_v<T, long long>) {
-            return rhs._value._long_long;
+            return rhs._data.value._long_long;
         } else if constexpr (std::is_same_v<T, bool>) {
-            return rhs._value._bool;
+            return rhs._data.value._bool;
         } else if constexpr (std::is_same_v<T, std::chrono::year_month_day>) {
-            return rhs._value._year_month_day;
-        } else if constexpr (std::is_same_v<T, std::string>) {
-            return *rhs._value._string;
+            return rhs._data.value._year_month_day;
         } else if constexpr (std::is_same_v<T, vector_type>) {
-            return *rhs._value._vector;
+            return *rhs._data.value._vector;
         } else if constexpr (std::is_same_v<T, map_type>) {
-            return *rhs._value._map;
+            return *rhs._data.value._map;
         } else if constexpr (std::is_same_v<T, bstring>) {
-            return *rhs._value._bstring;
+            return *rhs._data.value._bstring;
         } else {
             hi_static_no_default();
         }
@@ -1731,6 +1719,7 @@ public:
      * @return A pointer to the value, or nullptr.
      */
     template<typename T>
+        requires(not std::is_same_v<T, std::string>)
     [[nodiscard]] friend constexpr T* get_if(datum& rhs) noexcept
     {
         if (holds_alternative<T>(rhs)) {
@@ -1749,6 +1738,7 @@ public:
      * @return A pointer to the value, or nullptr.
      */
     template<typename T>
+        requires(not std::is_same_v<T, std::string>)
     [[nodiscard]] friend constexpr T const* get_if(datum const& rhs) noexcept
     {
         if (holds_alternative<T>(rhs)) {
@@ -1758,6 +1748,41 @@ public:
         }
     }
 
+    /** Get the string value of a datum.
+     *
+     * Short strings are stored inside the datum, so the string is returned as a view.
+     * It is undefined behavior if the datum does not hold a string.
+     *
+     * @param rhs The datum to get the string from.
+     * @return A view of the string, valid until the datum is modified or destroyed.
+     */
+    template<std::same_as<std::string> T>
+    [[nodiscard]] friend constexpr std::string_view get(datum const& rhs) noexcept
+    {
+        hi_axiom(holds_alternative<std::string>(rhs));
+        if (rhs._data.tag == tag_type::short_string) {
+            return std::string_view{rhs._short_string.data, rhs._short_string.size};
+        } else {
+            return *rhs._data.value._string;
+        }
+    }
+
+    /** Get the string value of a datum.
+     *
+     * @param rhs The datum to get the string from.
+     * @return A view of the string, valid until the datum is modified or destroyed; or empty
+     *         if the datum does not hold a string.
+     */
+    template<std::same_as<std::string> T>
+    [[nodiscard]] friend constexpr std::optional<std::string_view> get_if(datum const& rhs) noexcept
+    {
+        if (holds_alternative<std::string>(rhs)) {
+            return get<std::string>(rhs);
+        } else {
+            return std::nullopt;
+        }
+    }
+
     /** Get the value of a datum.
      *
      * If the type does not matched the stored value this function will return a nullptr.
@@ -1815,6 +1840,7 @@ private:
         year_month_day = 5,
         flow_continue = 6,
         flow_break = 7,
+        short_string = 8,
 
         // pointers are detected by: `std::to_underlying(tag_type) < 0`.
         string = -1,
@@ -1823,7 +1849,6 @@ private:
         bstring = -5
     };
 
-    tag_type _tag = tag_type::monostate;
     union value_type {
         double _double;
         long long _long_long;
@@ -1844,33 +1869,86 @@ private:
         constexpr value_type(bstring* value) noexcept : _bstring(value) {}
     };
 
-    value_type _value;
+    struct data_type {
+        tag_type tag;
+        value_type value;
+    };
+
+    /** The maximum size of a string that is stored inside the datum.
+     */
+    constexpr static std::size_t short_string_capacity = 14;
+
+    /** A short string stored inside the datum, without an allocation.
+     *
+     * The `tag` is in the common initial sequence with `data_type::tag`, and
+     * may be read through `_data.tag` when this is the active member.
+     */
+    struct short_string_type {
+        tag_type tag;
+        uint8_t size;
+        char data[short_string_capacity];
+    };
+
+    union {
+        data_type _data;
+        short_string_type _short_string;
+    };
 
     [[nodiscard]] constexpr bool is_scalar() const noexcept
     {
-        return std::to_underlying(_tag) >= 0;
+        return std::to_underlying(_data.tag) >= 0;
     }
 
     [[nodiscard]] constexpr bool is_pointer() const noexcept
     {
-        return std::to_underlying(_tag) < 0;
+        return std::to_underlying(_data.tag) < 0;
+    }
+
+    /** The tag used for ordering the types, short and long strings are the same type.
+     */
+    [[nodiscard]] constexpr tag_type type_order() const noexcept
+    {
+        return _data.tag == tag_type::short_string ? tag_type::string : _data.tag;
+    }
+
+    /** Copy the tag and the value, without copying the objects that are pointed to.
+     */
+    constexpr void copy_representation(datum const& other) noexcept
+    {
+        if (other._data.tag == tag_type::short_string) {
+            _short_string = other._short_string;
+        } else {
+            _data = other._data;
+        }
+    }
+
+    /** Store a short string.
+     *
+     * The previous value must already have been deleted.
+     */
+    void construct_short_string(std::string_view value) noexcept
+    {
+        hi_axiom(value.size() <= short_string_capacity);
+        _short_string.tag = tag_type::short_string;
+        _short_string.size = narrow_cast<uint8_t>(value.size());
+        std::memcpy(_short_string.data, value.data(), value.size());
     }
 
     hi_no_inline void copy_pointer(datum const& other) noexcept
     {
         hi_axiom(other.is_pointer());
-        switch (other._tag) {
+        switch (other._data.tag) {
         case tag_type::string:
-            _value._string = new std::string{*other._value._string};
+            _data.value._string = new std::string{*other._data.value._string};
             return;
         case tag_type::vector:
-            _value._vector = new vector_type{*other._value._vector};
+            _data.value._vector = new vector_type{*other._data.value._vector};
             return;
         case tag_type::map:
-            _value._map = new map_type{*other._value._map};
+            _data.value._map = new map_type{*other._data.value._map};
             return;
         case tag_type::bstring:
-            _value._bstring = new bstring{*other._value._bstring};
+            _data.value._bstring = new bstring{*other._data.value._bstring};
             return;
         default:
             hi_no_default();
@@ -1880,24 +1958,88 @@ private:
     hi_no_inline void _delete_pointer() noexcept
     {
         hi_axiom(is_pointer());
-        switch (_tag) {
+        switch (_data.tag) {
         case tag_type::string:
-            delete _value._string;
+            delete _data.value._string;
             return;
         case tag_type::vector:
-            delete _value._vector;
+            delete _data.value._vector;
             return;
         case tag_type::map:
-            delete _value._map;
+            delete _data.value._map;
             return;
         case tag_type::bstring:
-            delete _value._bstring;
+            delete _data.value._bstring;
             return;
         default:
             hi_no_default();
         }
     }
 
+    /** Append the string representation of the value.
+     *
+     * Numbers and the items of vectors and maps are appended directly,
+     * without an intermediate string for each value.
+     */
+    void append_repr(std::string& r) const noexcept
+    {
+        switch (_data.tag) {
+        case tag_type::monostate:
+            r += "undefined";
+            break;
+        case tag_type::floating_point:
+            std::format_to(std::back_inserter(r), "{:.1f}", _data.value._double);
+            break;
+        case tag_type::integral:
+            append_to_string(r, _data.value._long_long);
+            break;
+        case tag_type::boolean:
+            r += _data.value._bool ? "true" : "false";
+            break;
+        case tag_type::year_month_day:
+            std::format_to(std::back_inserter(r), "{:%Y-%m-%d}", _data.value._year_month_day);
+            break;
+        case tag_type::null:
+            r += "null";
+            break;
+        case tag_type::flow_break:
+            r += "break";
+            break;
+        case tag_type::flow_continue:
+            r += "continue";
+            break;
+        case tag_type::short_string:
+        case tag_type::string:
+            r += '"';
+            r += get<std::string>(*this);
+            r += '"';
+            break;
+        case tag_type::vector:
+            r += '[';
+            for (auto const& item : *_data.value._vector) {
+                item.append_repr(r);
+                r += ',';
+            }
+            r += ']';
+            break;
+        case tag_type::map:
+            r += '{';
+            for (auto const& item : *_data.value._map) {
+                item.first.append_repr(r);
+                r += ':';
+                item.second.append_repr(r);
+                r += ',';
+            }
+            r += '}';
+            break;
+        case tag_type::bstring:
+            r += base64::encode(*_data.value._bstring);
+            break;
+        default:
+            hi_no_default();
+        }
+    }
+
     constexpr void delete_pointer() noexcept
     {
         if (is_pointer()) {
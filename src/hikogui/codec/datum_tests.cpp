@@ -111,6 +111,59 @@ TEST_CASE(StringOperations)
     REQUIRE(static_cast<std::string>(v) == "Hello World"s);
 }
 
+TEST_CASE(StringCopyMove)
+{
+    using namespace std::literals;
+
+    REQUIRE(sizeof(hi::datum) == 16);
+
+    auto const long_string = "A string that does not fit in the small string buffer"s;
+
+    // The largest string stored inside the datum, and the smallest that is allocated.
+    auto const inline_string = hi::datum{"fourteen bytes"};
+    auto const allocated_string = hi::datum{"fifteen bytes.."};
+    REQUIRE(inline_string == "fourteen bytes");
+    REQUIRE(allocated_string == "fifteen bytes..");
+    REQUIRE(inline_string.size() == 14);
+    REQUIRE(allocated_string.size() == 15);
+    REQUIRE(inline_string < allocated_string);
+    REQUIRE(inline_string + allocated_string == "fourteen bytesfifteen bytes..");
+    REQUIRE(inline_string.hash() == hi::datum{std::string{"fourteen bytes"}}.hash());
+    REQUIRE(get<std::string>(inline_string) == "fourteen bytes"sv);
+    REQUIRE(*get_if<std::string>(allocated_string) == "fifteen bytes.."sv);
+    REQUIRE(not get_if<std::string>(hi::datum{1}));
+
+    auto a = hi::datum{"short"};
+    auto b = hi::datum{long_string};
+
+    auto c = a;
+    auto d = b;
+    REQUIRE(c == "short");
+    REQUIRE(d == long_string);
+
+    auto e = std::move(c);
+    auto f = std::move(d);
+    REQUIRE(e == "short");
+    REQUIRE(f == long_string);
+    REQUIRE(holds_alternative<std::monostate>(c));
+
+    e = std::move(f);
+    REQUIRE(e == long_string);
+    e = "other";
+    REQUIRE(e == "other");
+    e = long_string;
+    REQUIRE(e == long_string);
+    e = 5;
+    REQUIRE(e == 5);
+
+    auto v = hi::datum::vector_type{};
+    for (auto i = 0; i != 100; ++i) {
+        v.emplace_back(i % 2 == 0 ? "short"s : long_string);
+    }
+    REQUIRE(v[98] == "short");
+    REQUIRE(v[99] == long_string);
+}
+
 TEST_CASE(ArrayOperations)
 {
     auto const v = hi::datum::make_vector(11, 12, 13, 14, 15);
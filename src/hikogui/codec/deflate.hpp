@@ -0,0 +1,814 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/deflate.hpp Compress data using the deflate algorithm.
+ *
+ * Large data is split in chunks which are compressed independently on the
+ * global thread pool, like pigz. Each chunk may refer to the 32 KiB of data
+ * before it, and ends on a byte boundary with an empty stored block. This
+ * way the compressed chunks can be concatenated into a single deflate stream.
+ */
+
+#pragma once
+
+#include "inflate.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../container/container.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.deflate);
+
+hi_export namespace hi { inline namespace v1 {
+namespace detail {
+
+/** A bit-writer for the deflate bit-stream.
+ *
+ * Bits are written LSB first into a 64 bit buffer, which is flushed
+ * 32 bits at a time.
+ */
+class deflate_bit_writer {
+public:
+    explicit deflate_bit_writer(bstring& output) noexcept : _output(output) {}
+
+    /** Write bits.
+     *
+     * @param value The bits to write, LSB first.
+     * @param length The number of bits to write, at most 32.
+     */
+    hi_force_inline void put(std::size_t value, std::size_t length)
+    {
+        hi_axiom(length <= 32);
+        hi_axiom(value < (uint64_t{1} << length));
+
+        _buffer |= uint64_t{value} << _num_bits;
+        _num_bits += length;
+        if (_num_bits >= 32) {
+            for (auto i = 0; i != 4; ++i) {
+                _output.push_back(static_cast<std::byte>(_buffer & 0xff));
+                _buffer >>= 8;
+            }
+            _num_bits -= 32;
+        }
+    }
+
+    /** Pad with zero bits to a byte boundary, and write the buffered bytes.
+     */
+    void align()
+    {
+        while (_num_bits != 0) {
+            _output.push_back(static_cast<std::byte>(_buffer & 0xff));
+            _buffer >>= 8;
+            _num_bits = _num_bits > 8 ? _num_bits - 8 : 0;
+        }
+    }
+
+    /** Write bytes.
+     *
+     * @pre The writer must be aligned to a byte boundary.
+     */
+    void append(std::byte const *ptr, std::size_t size)
+    {
+        hi_axiom(_num_bits == 0);
+        _output.append(ptr, size);
+    }
+
+private:
+    bstring& _output;
+    uint64_t _buffer = 0;
+    std::size_t _num_bits = 0;
+};
+
+/** A sequence of literals and matches, which is encoded as a block.
+ */
+struct deflate_token {
+    /** The literal, or the length of the match.
+     */
+    uint16_t value = 0;
+
+    /** The distance of the match, or zero for a literal.
+     */
+    uint16_t distance = 0;
+};
+
+/** The index of the length symbol, minus 257, for each match length.
+ */
+constexpr auto deflate_length_symbols = [] {
+    auto r = std::array<uint8_t, 259>{};
+    for (auto i = 0_uz; i != inflate_length_base.size(); ++i) {
+        auto const last = std::min(inflate_length_base[i] + (1_uz << inflate_length_extra[i]), r.size());
+        for (auto length = inflate_length_base[i]; length != last; ++length) {
+            r[length] = narrow_cast<uint8_t>(i);
+        }
+    }
+    return r;
+}();
+
+[[nodiscard]] constexpr std::size_t deflate_distance_symbol(std::size_t distance) noexcept
+{
+    hi_axiom(distance >= 1 and distance <= 32768);
+
+    auto const d = distance - 1;
+    if (d < 4) {
+        return d;
+    }
+
+    // Each pair of symbols doubles the range of distances.
+    auto const num_bits = narrow_cast<std::size_t>(std::bit_width(d)) - 1;
+    return num_bits * 2 + ((d >> (num_bits - 1)) & 1);
+}
+
+/** Reverse the bits of a huffman code, so that it can be written LSB first.
+ */
+[[nodiscard]] constexpr std::size_t deflate_reverse_bits(std::size_t code, std::size_t length) noexcept
+{
+    auto r = 0_uz;
+    for (auto i = 0_uz; i != length; ++i) {
+        r = (r << 1) | (code & 1);
+        code >>= 1;
+    }
+    return r;
+}
+
+/** Calculate the code lengths of a length-limited huffman code.
+ *
+ * When the huffman code is longer than @a max_length, the lengths are adjusted
+ * so that the code is complete again: the least frequent symbols get the
+ * longest codes.
+ *
+ * @param frequencies The number of times each symbol is used.
+ * @param max_length The maximum length of a code.
+ * @return The code length of each symbol, or zero for unused symbols. At least two symbols have a code.
+ */
+[[nodiscard]] inline std::vector<uint8_t> deflate_code_lengths(std::span<uint32_t const> frequencies, std::size_t max_length)
+{
+    hi_axiom(frequencies.size() >= 2);
+    hi_axiom(max_length <= 15);
+
+    auto symbols = std::vector<std::size_t>{};
+    for (auto i = 0_uz; i != frequencies.size(); ++i) {
+        if (frequencies[i] != 0) {
+            symbols.push_back(i);
+        }
+    }
+
+    // Some decoders require a complete code, which needs at least two symbols.
+    for (auto i = 0_uz; symbols.size() < 2; ++i) {
+        if (frequencies[i] == 0) {
+            symbols.push_back(i);
+        }
+    }
+
+    std::ranges::sort(symbols, [&](auto const& a, auto const& b) {
+        return frequencies[a] != frequencies[b] ? frequencies[a] < frequencies[b] : a < b;
+    });
+
+    // Build the huffman tree with two queues: the sorted leaves and the
+    // internal nodes, which are created in the order of their weight.
+    struct node_type {
+        uint64_t weight = 0;
+        std::size_t parent = 0;
+    };
+
+    auto const num_leaves = symbols.size();
+    auto nodes = std::vector<node_type>(num_leaves * 2 - 1);
+    for (auto i = 0_uz; i != num_leaves; ++i) {
+        nodes[i].weight = frequencies[symbols[i]];
+    }
+
+    auto next_leaf = 0_uz;
+    auto next_internal = num_leaves;
+    auto const pop = [&](std::size_t num_nodes) {
+        if (next_leaf != num_leaves and (next_internal == num_nodes or nodes[next_leaf].weight <= nodes[next_internal].weight)) {
+            return next_leaf++;
+        } else {
+            return next_internal++;
+        }
+    };
+
+    for (auto i = num_leaves; i != nodes.size(); ++i) {
+        auto const a = pop(i);
+        auto const b = pop(i);
+        nodes[i].weight = nodes[a].weight + nodes[b].weight;
+        nodes[a].parent = i;
+        nodes[b].parent = i;
+    }
+
+    // Parents are created after their children, so the depths can be calculated from the root down.
+    auto depths = std::vector<std::size_t>(nodes.size(), 0);
+    auto counts = std::array<std::size_t, 16>{};
+    for (auto i = nodes.size() - 1; i-- != 0;) {
+        depths[i] = depths[nodes[i].parent] + 1;
+        if (i < num_leaves) {
+            ++counts[std::min(depths[i], max_length)];
+        }
+    }
+
+    // The codes that were too long are now too short, lengthen the codes of other symbols until the code is complete.
+    auto total = 0_uz;
+    for (auto length = 1_uz; length <= max_length; ++length) {
+        total += counts[length] << (max_length - length);
+    }
+    while (total != (1_uz << max_length)) {
+        --counts[max_length];
+        for (auto length = max_length - 1; length != 0; --length) {
+            if (counts[length] != 0) {
+                --counts[length];
+                counts[length + 1] += 2;
+                break;
+            }
+        }
+        --total;
+    }
+
+    auto r = std::vector<uint8_t>(frequencies.size(), 0);
+    auto it = symbols.begin();
+    for (auto length = max_length; length != 0; --length) {
+        for (auto i = 0_uz; i != counts[length]; ++i) {
+            r[*it++] = narrow_cast<uint8_t>(length);
+        }
+    }
+    return r;
+}
+
+/** Calculate the canonical huffman codes from the code lengths.
+ *
+ * @return The code of each symbol, bit-reversed so that it can be written LSB first.
+ */
+[[nodiscard]] inline std::vector<uint16_t> deflate_codes(std::span<uint8_t const> lengths)
+{
+    auto counts = std::array<std::size_t, 16>{};
+    for (auto const length : lengths) {
+        ++counts[length];
+    }
+    counts[0] = 0;
+
+    auto next_code = std::array<std::size_t, 16>{};
+    auto code = 0_uz;
+    for (auto length = 1_uz; length != next_code.size(); ++length) {
+        code = (code + counts[length - 1]) << 1;
+        next_code[length] = code;
+    }
+
+    auto r = std::vector<uint16_t>(lengths.size(), 0);
+    for (auto symbol = 0_uz; symbol != lengths.size(); ++symbol) {
+        if (auto const length = lengths[symbol]) {
+            r[symbol] = narrow_cast<uint16_t>(deflate_reverse_bits(next_code[length]++, length));
+        }
+    }
+    return r;
+}
+
+/** A huffman code for encoding.
+ */
+struct deflate_huffman {
+    std::vector<uint8_t> lengths;
+    std::vector<uint16_t> codes;
+
+    deflate_huffman(std::vector<uint8_t> lengths) : lengths(std::move(lengths)), codes(deflate_codes(this->lengths)) {}
+
+    hi_force_inline void put(deflate_bit_writer& writer, std::size_t symbol) const
+    {
+        hi_axiom(lengths[symbol] != 0);
+        writer.put(codes[symbol], lengths[symbol]);
+    }
+};
+
+inline deflate_huffman const deflate_fixed_literal_huffman = [] {
+    auto lengths = std::vector<uint8_t>(288, 8);
+    std::fill(lengths.begin() + 144, lengths.begin() + 256, uint8_t{9});
+    std::fill(lengths.begin() + 256, lengths.begin() + 280, uint8_t{7});
+    return deflate_huffman{std::move(lengths)};
+}();
+
+inline deflate_huffman const deflate_fixed_distance_huffman = deflate_huffman{std::vector<uint8_t>(30, 5)};
+
+/** The number of literal/length and distance symbols used by a block.
+ */
+struct deflate_frequencies {
+    std::array<uint32_t, 286> literals = {};
+    std::array<uint32_t, 30> distances = {};
+
+    explicit deflate_frequencies(std::span<deflate_token const> tokens) noexcept
+    {
+        for (auto const& token : tokens) {
+            if (token.distance == 0) {
+                ++literals[token.value];
+            } else {
+                ++literals[257 + deflate_length_symbols[token.value]];
+                ++distances[deflate_distance_symbol(token.distance)];
+            }
+        }
+        literals[256] = 1;
+    }
+
+    /** The number of bits to encode the tokens, including the extra bits and the end-of-block.
+     */
+    [[nodiscard]] std::size_t cost(deflate_huffman const& literal_huffman, deflate_huffman const& distance_huffman) const noexcept
+    {
+        auto r = 0_uz;
+        for (auto i = 0_uz; i != literals.size(); ++i) {
+            if (literals[i] != 0) {
+                auto const extra = i > 256 ? inflate_length_extra[i - 257] : 0_uz;
+                r += literals[i] * (literal_huffman.lengths[i] + extra);
+            }
+        }
+        for (auto i = 0_uz; i != distances.size(); ++i) {
+            if (distances[i] != 0) {
+                r += distances[i] * (distance_huffman.lengths[i] + inflate_distance_extra[i]);
+            }
+        }
+        return r;
+    }
+};
+
+/** The header of a dynamic block.
+ */
+class deflate_dynamic_header {
+public:
+    deflate_dynamic_header(deflate_huffman const& literal_huffman, deflate_huffman const& distance_huffman) :
+        _code_length_huffman(std::vector<uint8_t>(19, 0))
+    {
+        _num_literals = literal_huffman.lengths.size();
+        while (_num_literals > 257 and literal_huffman.lengths[_num_literals - 1] == 0) {
+            --_num_literals;
+        }
+        _num_distances = distance_huffman.lengths.size();
+        while (_num_distances > 1 and distance_huffman.lengths[_num_distances - 1] == 0) {
+            --_num_distances;
+        }
+
+        auto lengths = std::vector<uint8_t>{};
+        lengths.insert(lengths.end(), literal_huffman.lengths.begin(), literal_huffman.lengths.begin() + _num_literals);
+        lengths.insert(lengths.end(), distance_huffman.lengths.begin(), distance_huffman.lengths.begin() + _num_distances);
+
+        // Run-length encode the code lengths.
+        for (auto i = 0_uz; i != lengths.size();) {
+            auto const length = lengths[i];
+            auto run = 1_uz;
+            while (i + run != lengths.size() and lengths[i + run] == length) {
+                ++run;
+            }
+
+            if (length == 0 and run >= 11) {
+                run = std::min(run, 138_uz);
+                _symbols.emplace_back(uint8_t{18}, narrow_cast<uint8_t>(run - 11));
+            } else if (length == 0 and run >= 3) {
+                _symbols.emplace_back(uint8_t{17}, narrow_cast<uint8_t>(run - 3));
+            } else if (length != 0 and run >= 4) {
+                run = std::min(run, 7_uz);
+                _symbols.emplace_back(length, uint8_t{0});
+                _symbols.emplace_back(uint8_t{16}, narrow_cast<uint8_t>(run - 4));
+            } else {
+                run = 1;
+                _symbols.emplace_back(length, uint8_t{0});
+            }
+            i += run;
+        }
+
+        auto frequencies = std::array<uint32_t, 19>{};
+        for (auto const [symbol, extra] : _symbols) {
+            ++frequencies[symbol];
+        }
+        _code_length_huffman = deflate_huffman{deflate_code_lengths(frequencies, 7)};
+
+        _num_code_lengths = code_length_order.size();
+        while (_num_code_lengths > 4 and _code_length_huffman.lengths[code_length_order[_num_code_lengths - 1]] == 0) {
+            --_num_code_lengths;
+        }
+    }
+
+    /** The number of bits of the header, excluding BFINAL and BTYPE.
+     */
+    [[nodiscard]] std::size_t cost() const noexcept
+    {
+        auto r = 5_uz + 5_uz + 4_uz + _num_code_lengths * 3;
+        for (auto const [symbol, extra] : _symbols) {
+            r += _code_length_huffman.lengths[symbol] + extra_bits(symbol);
+        }
+        return r;
+    }
+
+    void put(deflate_bit_writer& writer) const
+    {
+        writer.put(_num_literals - 257, 5);
+        writer.put(_num_distances - 1, 5);
+        writer.put(_num_code_lengths - 4, 4);
+        for (auto i = 0_uz; i != _num_code_lengths; ++i) {
+            writer.put(_code_length_huffman.lengths[code_length_order[i]], 3);
+        }
+
+        for (auto const [symbol, extra] : _symbols) {
+            _code_length_huffman.put(writer, symbol);
+            writer.put(extra, extra_bits(symbol));
+        }
+    }
+
+private:
+    constexpr static auto code_length_order = std::array<uint8_t, 19>{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+    std::size_t _num_literals = 0;
+    std::size_t _num_distances = 0;
+    std::size_t _num_code_lengths = 0;
+
+    /** The code-length symbols, with the value of their extra bits.
+     */
+    std::vector<std::pair<uint8_t, uint8_t>> _symbols;
+    deflate_huffman _code_length_huffman;
+
+    [[nodiscard]] constexpr static std::size_t extra_bits(std::size_t symbol) noexcept
+    {
+        switch (symbol) {
+        case 16:
+            return 2;
+        case 17:
+            return 3;
+        case 18:
+            return 7;
+        default:
+            return 0;
+        }
+    }
+};
+
+inline void deflate_put_tokens(
+    deflate_bit_writer& writer,
+    std::span<deflate_token const> tokens,
+    deflate_huffman const& literal_huffman,
+    deflate_huffman const& distance_huffman)
+{
+    for (auto const& token : tokens) {
+        if (token.distance == 0) {
+            literal_huffman.put(writer, token.value);
+        } else {
+            auto const length_symbol = deflate_length_symbols[token.value];
+            literal_huffman.put(writer, 257 + length_symbol);
+            writer.put(token.value - inflate_length_base[length_symbol], inflate_length_extra[length_symbol]);
+
+            auto const distance_symbol = deflate_distance_symbol(token.distance);
+            distance_huffman.put(writer, distance_symbol);
+            writer.put(token.distance - inflate_distance_base[distance_symbol], inflate_distance_extra[distance_symbol]);
+        }
+    }
+    literal_huffman.put(writer, 256);
+}
+
+/** Write data as stored blocks.
+ *
+ * @param writer The bit-writer.
+ * @param bytes The data to store, this may be empty.
+ * @param final Set BFINAL on the last block.
+ */
+inline void deflate_put_stored(deflate_bit_writer& writer, std::span<std::byte const> bytes, bool final)
+{
+    constexpr auto max_block_size = 0xffff_uz;
+
+    do {
+        auto const size = std::min(bytes.size(), max_block_size);
+        writer.put(final and size == bytes.size() ? 1 : 0, 1);
+        writer.put(0, 2);
+        writer.align();
+        writer.put(size, 16);
+        writer.put(size ^ 0xffff, 16);
+        writer.append(bytes.data(), size);
+        bytes = bytes.subspan(size);
+    } while (not bytes.empty());
+}
+
+/** Write a block using the smallest of the stored, fixed and dynamic encodings.
+ *
+ * @param writer The bit-writer.
+ * @param tokens The literals and matches of the block.
+ * @param bytes The data that is encoded by @a tokens.
+ * @param final Set BFINAL on the block.
+ */
+inline void deflate_put_block(deflate_bit_writer& writer, std::span<deflate_token const> tokens, std::span<std::byte const> bytes, bool final)
+{
+    auto const frequencies = deflate_frequencies{tokens};
+    auto const literal_huffman = deflate_huffman{deflate_code_lengths(frequencies.literals, 15)};
+    auto const distance_huffman = deflate_huffman{deflate_code_lengths(frequencies.distances, 15)};
+    auto const header = deflate_dynamic_header{literal_huffman, distance_huffman};
+
+    auto const dynamic_cost = header.cost() + frequencies.cost(literal_huffman, distance_huffman);
+    auto const fixed_cost = frequencies.cost(deflate_fixed_literal_huffman, deflate_fixed_distance_huffman);
+    // Including the alignment and the LEN and NLEN fields, of each 64 KiB stored block.
+    auto const stored_cost = bytes.size() * 8 + (bytes.size() / 0xffff + 1) * 40;
+
+    if (stored_cost < fixed_cost and stored_cost < dynamic_cost) {
+        deflate_put_stored(writer, bytes, final);
+
+    } else if (fixed_cost <= dynamic_cost) {
+        writer.put(final ? 1 : 0, 1);
+        writer.put(1, 2);
+        deflate_put_tokens(writer, tokens, deflate_fixed_literal_huffman, deflate_fixed_distance_huffman);
+
+    } else {
+        writer.put(final ? 1 : 0, 1);
+        writer.put(2, 2);
+        header.put(writer);
+        deflate_put_tokens(writer, tokens, literal_huffman, distance_huffman);
+    }
+}
+
+/** The parameters of the match finder for each compression level.
+ */
+struct deflate_level_type {
+    /** The maximum number of earlier positions with the same hash that are compared.
+     */
+    uint16_t max_chain = 0;
+
+    /** Stop searching when a match of this length is found.
+     */
+    uint16_t nice_length = 0;
+
+    /** Check if a longer match starts at the next byte, before emitting a match.
+     */
+    bool lazy = false;
+};
+
+// clang-format off
+constexpr auto deflate_levels = std::array<deflate_level_type, 10>{{
+    {0, 0, false},
+    {4, 8, false},
+    {8, 16, false},
+    {16, 32, false},
+    {16, 16, true},
+    {32, 32, true},
+    {128, 128, true},
+    {256, 128, true},
+    {1024, 258, true},
+    {4096, 258, true}}};
+// clang-format on
+
+/** Find matches in earlier data, using hash chains.
+ */
+class deflate_matcher {
+public:
+    constexpr static std::size_t window_size = 32768;
+    constexpr static std::size_t min_match = 3;
+    constexpr static std::size_t max_match = 258;
+
+    /** Create a match finder.
+     *
+     * @param bytes The data, including the dictionary before the data that is compressed.
+     * @param first The offset in @a bytes where the dictionary starts.
+     * @param level The parameters of the compression level.
+     */
+    deflate_matcher(std::span<std::byte const> bytes, std::size_t first, deflate_level_type level) :
+        _bytes(bytes), _first(first), _next(first), _level(level), _head(hash_size, 0), _prev(window_size, 0)
+    {
+    }
+
+    /** Add the positions before @a position to the hash chains.
+     */
+    void insert_until(std::size_t position) noexcept
+    {
+        auto const last = std::min(position, _bytes.size() - std::min(_bytes.size(), min_match - 1));
+        for (; _next < last; ++_next) {
+            auto const h = hash(_next);
+            _prev[_next % window_size] = _head[h];
+            _head[h] = narrow_cast<uint32_t>(_next - _first + 1);
+        }
+        _next = std::max(_next, position);
+    }
+
+    /** Do not add the positions before @a position to the hash chains.
+     */
+    void skip_until(std::size_t position) noexcept
+    {
+        _next = std::max(_next, position);
+    }
+
+    /** Find the longest match with earlier data.
+     *
+     * @param position The offset in the data to find a match for, this position is added to the hash chains.
+     * @param last The end of the data that a match may extend to.
+     * @return The length and the distance of the match, the length is zero if no match was found.
+     */
+    [[nodiscard]] std::pair<std::size_t, std::size_t> find(std::size_t position, std::size_t last) noexcept
+    {
+        insert_until(position);
+        if (position + min_match > last) {
+            return {0, 0};
+        }
+
+        auto const max_length = std::min(max_match, last - position);
+        auto best_length = min_match - 1;
+        auto best_distance = 0_uz;
+
+        auto candidate = std::size_t{_head[hash(position)]};
+        for (auto chain = _level.max_chain; candidate != 0 and chain != 0; --chain) {
+            auto const offset = _first + candidate - 1;
+            auto const distance = position - offset;
+            if (distance > window_size) {
+                break;
+            }
+
+            // Quickly reject a candidate that can not be longer than the best match.
+            if (_bytes[offset + best_length] == _bytes[position + best_length]) {
+                auto const length = match_length(offset, position, max_length);
+                if (length > best_length) {
+                    best_length = length;
+                    best_distance = distance;
+                    if (length >= _level.nice_length or length == max_length) {
+                        break;
+                    }
+                }
+            }
+
+            auto const next_candidate = std::size_t{_prev[offset % window_size]};
+            if (next_candidate >= candidate) {
+                // The entry was overwritten by a position that is more than a window later.
+                break;
+            }
+            candidate = next_candidate;
+        }
+
+        insert_until(position + 1);
+        if (best_distance == 0) {
+            return {0, 0};
+        }
+        return {best_length, best_distance};
+    }
+
+private:
+    constexpr static std::size_t hash_bits = 15;
+    constexpr static std::size_t hash_size = 1_uz << hash_bits;
+
+    std::span<std::byte const> _bytes;
+    std::size_t _first;
+
+    /** The next position to add to the hash chains.
+     */
+    std::size_t _next;
+    deflate_level_type _level;
+
+    /** The last position, plus one relative to `_first`, with each hash; or zero.
+     */
+    std::vector<uint32_t> _head;
+
+    /** The previous position, plus one relative to `_first`, with the same hash; or zero.
+     */
+    std::vector<uint32_t> _prev;
+
+    [[nodiscard]] hi_force_inline std::size_t hash(std::size_t position) const noexcept
+    {
+        auto const *ptr = _bytes.data() + position;
+        auto const value = (std::to_integer<uint32_t>(ptr[0]) << 16) | (std::to_integer<uint32_t>(ptr[1]) << 8) |
+            std::to_integer<uint32_t>(ptr[2]);
+        return (value * 0x9e37'79b1) >> (32 - hash_bits);
+    }
+
+    [[nodiscard]] hi_force_inline std::size_t match_length(std::size_t a, std::size_t b, std::size_t max_length) const noexcept
+    {
+        auto const *a_ptr = _bytes.data() + a;
+        auto const *b_ptr = _bytes.data() + b;
+
+        auto r = 0_uz;
+        for (; r + sizeof(uint64_t) <= max_length; r += sizeof(uint64_t)) {
+            if (auto const diff = load_le<uint64_t>(a_ptr + r) ^ load_le<uint64_t>(b_ptr + r)) {
+                return r + narrow_cast<std::size_t>(std::countr_zero(diff)) / 8;
+            }
+        }
+        while (r != max_length and a_ptr[r] == b_ptr[r]) {
+            ++r;
+        }
+        return r;
+    }
+};
+
+/** Compress a chunk of data.
+ *
+ * Matches may refer to up to 32 KiB of data before the chunk.
+ *
+ * @param bytes All the data.
+ * @param first The offset of the chunk in @a bytes.
+ * @param last The offset after the chunk in @a bytes.
+ * @param level The compression level, 0 (stored) to 9 (best compression).
+ * @param final True if this is the last chunk, its last block has BFINAL set.
+ *              Otherwise the chunk ends with an empty stored block.
+ * @return The deflate blocks, ending on a byte boundary.
+ */
+[[nodiscard]] inline bstring deflate_chunk(std::span<std::byte const> bytes, std::size_t first, std::size_t last, int level, bool final)
+{
+    hi_axiom(first <= last and last <= bytes.size());
+    hi_axiom(level >= 0 and level <= 9);
+
+    // The maximum number of tokens in a block, after which a new huffman code is calculated.
+    constexpr auto max_block_tokens = 0x4000_uz;
+
+    auto r = bstring{};
+    auto writer = deflate_bit_writer{r};
+
+    if (level == 0) {
+        deflate_put_stored(writer, bytes.subspan(first, last - first), final);
+
+    } else {
+        auto const level_params = deflate_levels[level];
+        auto matcher = deflate_matcher{bytes, first - std::min(first, deflate_matcher::window_size), level_params};
+
+        auto tokens = std::vector<deflate_token>{};
+        tokens.reserve(max_block_tokens);
+
+        auto block_first = first;
+        auto position = first;
+        while (position != last) {
+            auto [length, distance] = matcher.find(position, last);
+
+            if (level_params.lazy and length != 0 and length < level_params.nice_length) {
+                auto const [next_length, next_distance] = matcher.find(position + 1, last);
+                if (next_length > length) {
+                    tokens.emplace_back(std::to_integer<uint16_t>(bytes[position]), uint16_t{0});
+                    ++position;
+                    length = next_length;
+                    distance = next_distance;
+                }
+            }
+
+            if (length != 0) {
+                tokens.emplace_back(narrow_cast<uint16_t>(length), narrow_cast<uint16_t>(distance));
+                if (not level_params.lazy and length > level_params.nice_length) {
+                    // Skip adding the positions of a long match to the hash chains, for speed.
+                    matcher.skip_until(position + length);
+                }
+                position += length;
+            } else {
+                tokens.emplace_back(std::to_integer<uint16_t>(bytes[position]), uint16_t{0});
+                ++position;
+            }
+
+            if (tokens.size() >= max_block_tokens or position == last) {
+                deflate_put_block(writer, tokens, bytes.subspan(block_first, position - block_first), final and position == last);
+                tokens.clear();
+                block_first = position;
+            }
+        }
+
+        if (first == last) {
+            deflate_put_block(writer, tokens, {}, final);
+        }
+    }
+
+    if (not final) {
+        // An empty stored block, so that the next chunk starts on a byte boundary.
+        deflate_put_stored(writer, {}, false);
+    }
+    writer.align();
+    return r;
+}
+
+} // namespace detail
+
+/** Compress data using the deflate algorithm.
+ *
+ * When the data is larger than @a chunk_size it is split into chunks, which
+ * are compressed in parallel on the global thread pool.
+ *
+ * @param bytes The data to compress.
+ * @param level The compression level, 0 (stored) to 9 (best compression).
+ * @param chunk_size The number of bytes of each chunk that is compressed independently.
+ * @return The compressed data.
+ */
+hi_export [[nodiscard]] inline bstring deflate(std::span<std::byte const> bytes, int level = 6, std::size_t chunk_size = 0x2'0000)
+{
+    hi_assert(level >= 0 and level <= 9);
+    hi_assert(chunk_size > 0);
+
+    auto& pool = thread_pool::global();
+
+    auto const num_chunks = std::max(1_uz, ceil(bytes.size(), chunk_size) / chunk_size);
+    if (num_chunks == 1 or pool.on_thread()) {
+        return detail::deflate_chunk(bytes, 0, bytes.size(), level, true);
+    }
+
+    auto chunks = std::vector<bstring>(num_chunks);
+    auto const compress = [&](std::size_t i) {
+        auto const first = i * chunk_size;
+        auto const last = std::min(first + chunk_size, bytes.size());
+        chunks[i] = detail::deflate_chunk(bytes, first, last, level, i == num_chunks - 1);
+    };
+
+    pool.parallel_for(num_chunks, compress);
+
+    auto size = 0_uz;
+    for (auto const& chunk : chunks) {
+        size += chunk.size();
+    }
+
+    auto r = bstring{};
+    r.reserve(size);
+    for (auto const& chunk : chunks) {
+        r.append(chunk);
+    }
+    return r;
+}
+
+}} // namespace hi::v1
@@ -0,0 +1,91 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "deflate.hpp"
+#include "zlib.hpp"
+#include "../file/file.hpp"
+#include "../path/path.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <span>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+TEST_SUITE(deflate_suite) {
+
+[[nodiscard]] static hi::bstring make_random(std::size_t size, std::size_t num_symbols, uint32_t seed)
+{
+    auto r = hi::bstring{};
+    r.reserve(size);
+    for (auto i = std::size_t{0}; i != size; ++i) {
+        seed = seed * 1664525 + 1013904223;
+        r.push_back(static_cast<std::byte>((seed >> 16) % num_symbols));
+    }
+    return r;
+}
+
+[[nodiscard]] static std::vector<hi::bstring> make_inputs()
+{
+    auto r = std::vector<hi::bstring>{};
+    r.emplace_back();
+    r.emplace_back(1, std::byte{'a'});
+    r.emplace_back(100'000, std::byte{'a'});
+    r.push_back(make_random(100'000, 256, 1));
+    r.push_back(make_random(100'000, 4, 2));
+    r.emplace_back(as_bstring_view(hi::file_view{hi::library_test_data_dir() / "gzip_test4.bin"}));
+    return r;
+}
+
+TEST_CASE(round_trip_test)
+{
+    for (auto const& input : make_inputs()) {
+        for (auto level = 0; level <= 9; ++level) {
+            auto const compressed = hi::deflate(input, level);
+
+            auto offset = std::size_t{0};
+            REQUIRE(hi::inflate(compressed, offset, input.size()) == input);
+            REQUIRE(offset == compressed.size());
+        }
+    }
+}
+
+TEST_CASE(chunks_test)
+{
+    for (auto const& input : make_inputs()) {
+        for (auto const chunk_size : {std::size_t{1000}, std::size_t{40'000}}) {
+            auto const compressed = hi::deflate(input, 6, chunk_size);
+
+            auto offset = std::size_t{0};
+            REQUIRE(hi::inflate(compressed, offset, input.size()) == input);
+            REQUIRE(offset == compressed.size());
+        }
+    }
+}
+
+TEST_CASE(compresses_test)
+{
+    auto const input = hi::bstring{as_bstring_view(hi::file_view{hi::library_test_data_dir() / "gzip_test4.bin"})};
+
+    // The canterbury corpus HTML file compresses to less than a third, like zlib.
+    REQUIRE(hi::deflate(input, 6).size() < input.size() / 3);
+    REQUIRE(hi::deflate(input, 1).size() < hi::deflate(input, 0).size());
+}
+
+TEST_CASE(zlib_round_trip_test)
+{
+    for (auto const& input : make_inputs()) {
+        auto const compressed = hi::zlib_compress(input, 6, 40'000);
+        REQUIRE(hi::zlib_decompress(compressed, input.size()) == input);
+    }
+}
+
+TEST_CASE(adler32_test)
+{
+    auto const input = std::string_view{"Wikipedia"};
+    auto const bytes = std::span{reinterpret_cast<std::byte const *>(input.data()), input.size()};
+    REQUIRE(hi::detail::zlib_adler32(bytes) == 0x11e6'0398);
+}
+
+};
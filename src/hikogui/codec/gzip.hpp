@@ -7,10 +7,16 @@
 #include "../container/container.hpp"
 #include "../file/file.hpp"
 #include "../parser/parser.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include "inflate.hpp"
+#include <algorithm>
+#include <vector>
+#include <type_traits>
 #include <cstddef>
 #include <filesystem>
+#include <optional>
 
 hi_export_module(hikogui.codec.gzip);
 
@@ -27,8 +33,19 @@ struct gzip_member_header {
     uint8_t OS;
 };
 
-[[nodiscard]] inline bstring gzip_decompress_member(std::span<std::byte const> bytes, std::size_t &offset, std::size_t max_size)
+/** Parse the header of a gzip member.
+ *
+ * @param bytes The bytes of the gzip file.
+ * @param offset The offset of the member header.
+ * @return The offset after the header, or empty when the header extends beyond the end of @a bytes.
+ * @throw parse_error When the header is invalid.
+ */
+[[nodiscard]] inline std::optional<std::size_t> gzip_parse_member_header(std::span<std::byte const> bytes, std::size_t offset)
 {
+    if (offset + sizeof(gzip_member_header) > bytes.size()) {
+        return std::nullopt;
+    }
+
     auto const header = make_placement_ptr<gzip_member_header>(bytes, offset);
 
     hi_check(header->ID1 == 31, "GZIP Member header ID1 must be 31");
@@ -43,6 +60,9 @@ struct gzip_member_header {
     auto const FCOMMENT = to_bool(header->FLG & 16);
 
     if (FEXTRA) {
+        if (offset + sizeof(little_uint16_buf_t) > bytes.size()) {
+            return std::nullopt;
+        }
         auto const XLEN = **make_placement_ptr<little_uint16_buf_t>(bytes, offset);
         offset += XLEN;
     }
@@ -50,7 +70,9 @@ struct gzip_member_header {
     if (FNAME) {
         auto c = std::byte{};
         do {
-            hi_check(offset < bytes.size(), "GZIP Member header FNAME reading beyond end of buffer");
+            if (offset >= bytes.size()) {
+                return std::nullopt;
+            }
             c = bytes[offset++];
         } while (c != std::byte{0});
     }
@@ -58,39 +80,188 @@ struct gzip_member_header {
     if (FCOMMENT) {
         auto c = std::byte{};
         do {
-            hi_check(offset < bytes.size(), "GZIP Member header FCOMMENT reading beyond end of buffer");
+            if (offset >= bytes.size()) {
+                return std::nullopt;
+            }
             c = bytes[offset++];
         } while (c != std::byte{0});
     }
 
     if (FHCRC) {
-        [[maybe_unused]] auto const CRC16 = make_placement_ptr<little_uint16_buf_t>(bytes, offset);
+        offset += sizeof(little_uint16_buf_t);
+    }
+
+    if (offset > bytes.size()) {
+        return std::nullopt;
+    }
+    return offset;
+}
+
+/** Check if a gzip member header is at an offset.
+ */
+[[nodiscard]] inline bool gzip_is_member_header(std::span<std::byte const> bytes, std::size_t offset) noexcept
+{
+    try {
+        return gzip_parse_member_header(bytes, offset).has_value();
+    } catch (parse_error const&) {
+        return false;
     }
+}
+
+/** Find the offsets of possible gzip members.
+ *
+ * The compressed size of a member is not known before it is inflated, so the
+ * file is scanned for valid member headers. A header may also be found by
+ * chance inside the compressed data of a member.
+ *
+ * @return The sorted offsets of valid member headers.
+ */
+[[nodiscard]] inline std::vector<std::size_t> gzip_find_member_headers(std::span<std::byte const> bytes)
+{
+    auto r = std::vector<std::size_t>{};
+
+    auto const first = bytes.begin();
+    for (auto it = std::find(first, bytes.end(), std::byte{31}); it != bytes.end(); it = std::find(it + 1, bytes.end(), std::byte{31})) {
+        auto const offset = narrow_cast<std::size_t>(std::distance(first, it));
+        if (gzip_is_member_header(bytes, offset)) {
+            r.push_back(offset);
+        }
+    }
+    return r;
+}
 
-    auto r = inflate(bytes, offset, max_size);
+/** Decompress a gzip member.
+ *
+ * @param bytes The bytes of the gzip file.
+ * @param[in,out] offset The offset of the member header, on return the offset after the member.
+ * @param max_size The maximum size of the decompressed data.
+ * @param at_block A function `bool(std::size_t bit_offset, inflate_output const&)` called before
+ *                 each deflate block, see `inflate_blocks()`.
+ * @return The decompressed data.
+ * @throw parse_error When the member is invalid.
+ */
+template<typename Func>
+[[nodiscard]] inline bstring
+gzip_decompress_member(std::span<std::byte const> bytes, std::size_t& offset, std::size_t max_size, Func const& at_block)
+{
+    auto const header_end = gzip_parse_member_header(bytes, offset);
+    hi_check(header_end, "GZIP Member header reading beyond end of buffer");
+
+    auto reader = inflate_bit_reader{bytes, *header_end};
+    auto r = inflate_output{max_size};
+    inflate_blocks(reader, r, at_block);
+    offset = (reader.bit_offset() + 7) / 8;
 
     [[maybe_unused]] auto CRC32 = **make_placement_ptr<little_uint32_buf_t>(bytes, offset);
     [[maybe_unused]] auto ISIZE = **make_placement_ptr<little_uint32_buf_t>(bytes, offset);
 
     hi_check(
-        ISIZE == (size(r) & 0xffffffff),
+        ISIZE == (r.size() & 0xffffffff),
         "GZIP Member header ISIZE must be same as the lower 32 bits of the inflated size.");
-    return r;
+    return r.finish();
 }
 
+[[nodiscard]] inline bstring gzip_decompress_member(std::span<std::byte const> bytes, std::size_t& offset, std::size_t max_size)
+{
+    return gzip_decompress_member(bytes, offset, max_size, [](std::size_t, inflate_output const&) {
+        return true;
+    });
 }
 
-hi_export [[nodiscard]] inline bstring gzip_decompress(std::span<std::byte const> bytes, std::size_t max_size)
+/** Decompress each member of a gzip file, in parallel.
+ *
+ * The members are decompressed speculatively on the global thread pool, at
+ * each offset where a valid member header is found. Afterwards the members
+ * are chained from the start of the file, each member must end where the next
+ * member starts; a member that could not be decompressed speculatively is
+ * decompressed again on the current thread, which reports its error.
+ *
+ * @param bytes The bytes of the gzip file.
+ * @param func A function `T(std::size_t& offset)` which decompresses the member at the offset
+ *             and updates the offset to the end of the member. It may be called concurrently.
+ * @return The results of @a func for each member, in order.
+ * @throw parse_error When a member is invalid.
+ */
+template<typename Func>
+[[nodiscard]] inline auto gzip_for_each_member(std::span<std::byte const> bytes, Func const& func)
 {
-    auto r = bstring{};
+    using value_type = std::invoke_result_t<Func const&, std::size_t&>;
+
+    auto r = std::vector<value_type>{};
+
+    auto& pool = thread_pool::global();
+    auto const headers = pool.on_thread() ? std::vector<std::size_t>{} : gzip_find_member_headers(bytes);
+    if (headers.size() <= 1) {
+        auto offset = 0_uz;
+        while (offset < bytes.size()) {
+            r.push_back(func(offset));
+        }
+        return r;
+    }
+
+    struct speculative_type {
+        std::optional<value_type> value;
+        std::size_t last = 0;
+    };
+
+    auto speculative = std::vector<speculative_type>(headers.size());
+    // A header may be a false positive inside compressed data, so errors are not
+    // propagated here; a corrupt member is reported when chaining the members below.
+    auto const decompress = [&](std::size_t i) noexcept {
+        auto offset = headers[i];
+        try {
+            speculative[i].value = func(offset);
+            speculative[i].last = offset;
+        } catch (...) {
+            // Not a member, or a corrupt member.
+        }
+    };
+
+    pool.parallel_for(headers.size(), decompress);
 
     auto offset = 0_uz;
     while (offset < bytes.size()) {
-        auto member = detail::gzip_decompress_member(bytes, offset, max_size);
-        max_size -= member.size();
-        r.append(member);
+        auto const it = std::ranges::lower_bound(headers, offset);
+        auto const i = narrow_cast<std::size_t>(std::distance(headers.begin(), it));
+        if (it != headers.end() and *it == offset and speculative[i].value) {
+            r.push_back(std::move(*speculative[i].value));
+            offset = speculative[i].last;
+        } else {
+            r.push_back(func(offset));
+        }
     }
+    return r;
+}
+
+} // namespace detail
 
+/** Decompress a gzip file.
+ *
+ * The members of a multi-member gzip file are decompressed in parallel on the
+ * global thread pool.
+ *
+ * @param bytes The bytes of the gzip file.
+ * @param max_size The maximum size of the decompressed data.
+ * @return The decompressed data.
+ * @throw parse_error When the gzip file is invalid.
+ */
+hi_export [[nodiscard]] inline bstring gzip_decompress(std::span<std::byte const> bytes, std::size_t max_size)
+{
+    auto const members = detail::gzip_for_each_member(bytes, [&](std::size_t& offset) {
+        return detail::gzip_decompress_member(bytes, offset, max_size);
+    });
+
+    auto size = 0_uz;
+    for (auto const& member : members) {
+        size += member.size();
+    }
+    hi_check(size <= max_size, "Output buffer overrun");
+
+    auto r = bstring{};
+    r.reserve(size);
+    for (auto const& member : members) {
+        r.append(member);
+    }
     return r;
 }
 
@@ -99,4 +270,137 @@ hi_export [[nodiscard]] inline bstring gzip_decompress(std::filesystem::path con
     return gzip_decompress(as_span<std::byte const>(file_view{path}), max_size);
 }
 
+/** An index for random access in a gzip file.
+ *
+ * The index contains access points at the start of each member, and at deflate
+ * blocks at intervals of the decompressed data. Each access point contains a
+ * snapshot of the 32 KiB window of decompressed data before it, so that
+ * inflating can be resumed at the access point.
+ *
+ * The index only contains offsets, the gzip file, for example a `file_view`, is
+ * passed to `read()`.
+ */
+hi_export class gzip_index {
+public:
+    /** The size of the window of decompressed data that a deflate stream may refer to.
+     */
+    constexpr static std::size_t window_size = 32768;
+
+    struct access_point {
+        /** The bit offset of a deflate block header in the gzip file.
+         */
+        std::size_t bit_offset = 0;
+
+        /** The offset in the decompressed data.
+         */
+        std::size_t position = 0;
+
+        /** The decompressed data of the same member before the access point, at most `window_size` bytes.
+         */
+        bstring window = {};
+    };
+
+    constexpr gzip_index() noexcept = default;
+
+    /** Build an index of a gzip file.
+     *
+     * The gzip file is completely decompressed, but only the windows of the
+     * access points are retained. Members are indexed in parallel on the global
+     * thread pool.
+     *
+     * @param bytes The bytes of the gzip file.
+     * @param interval The minimum number of decompressed bytes between access points in a member.
+     * @param max_size The maximum size of the decompressed data of a single member.
+     * @throw parse_error When the gzip file is invalid.
+     */
+    gzip_index(std::span<std::byte const> bytes, std::size_t interval = 0x10'0000, std::size_t max_size = 0x1000'0000) :
+        _max_size(max_size)
+    {
+        struct member_type {
+            std::size_t size = 0;
+            std::vector<access_point> access_points = {};
+        };
+
+        auto const members = detail::gzip_for_each_member(bytes, [&](std::size_t& offset) {
+            auto r = member_type{};
+            auto next_position = 0_uz;
+            r.size = detail::gzip_decompress_member(
+                         bytes, offset, max_size, [&](std::size_t bit_offset, detail::inflate_output const& output) {
+                             if (output.size() >= next_position) {
+                                 auto const window_offset = output.size() - std::min(output.size(), window_size);
+                                 r.access_points.emplace_back(bit_offset, output.size(), bstring{output.view().substr(window_offset)});
+                                 next_position = output.size() + std::max(interval, 1_uz);
+                             }
+                             return true;
+                         })
+                         .size();
+            return r;
+        });
+
+        for (auto const& member : members) {
+            for (auto const& point : member.access_points) {
+                _access_points.emplace_back(point.bit_offset, _size + point.position, point.window);
+            }
+            _size += member.size;
+        }
+    }
+
+    /** The size of the decompressed data.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] std::vector<access_point> const& access_points() const noexcept
+    {
+        return _access_points;
+    }
+
+    /** Read decompressed data.
+     *
+     * Inflating starts at the nearest access point before @a position.
+     *
+     * @param bytes The bytes of the gzip file, the same as when the index was built.
+     * @param position The offset in the decompressed data.
+     * @param size The number of bytes to read.
+     * @return The decompressed data, shorter than @a size when reading beyond the end.
+     * @throw parse_error When the gzip file is invalid.
+     */
+    [[nodiscard]] bstring read(std::span<std::byte const> bytes, std::size_t position, std::size_t size) const
+    {
+        auto r = bstring{};
+        size = std::min(size, _size - std::min(position, _size));
+
+        while (r.size() < size) {
+            auto const it = std::ranges::upper_bound(_access_points, position, {}, &access_point::position);
+            hi_axiom(it != _access_points.begin());
+            auto const& point = *std::prev(it);
+
+            auto const skip = position - point.position;
+            auto const needed = skip + size - r.size();
+
+            auto reader = detail::inflate_bit_reader{bytes, 0};
+            reader.seek_bits(point.bit_offset);
+            auto output = detail::inflate_output{_max_size, point.window};
+            detail::inflate_blocks(reader, output, [&](std::size_t, detail::inflate_output const& out) {
+                return out.size() - point.window.size() < needed;
+            });
+
+            auto const data = output.view().substr(point.window.size());
+            hi_check(skip < data.size(), "GZIP index does not match the file");
+
+            auto const chunk = data.substr(skip, size - r.size());
+            r.append(chunk);
+            position += chunk.size();
+        }
+        return r;
+    }
+
+private:
+    std::vector<access_point> _access_points;
+    std::size_t _size = 0;
+    std::size_t _max_size = 0;
+};
+
 }} // namespace hi::inline v1
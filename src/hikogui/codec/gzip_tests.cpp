@@ -8,6 +8,9 @@
 #include "../path/path.hpp"
 #include "../utility/utility.hpp"
 #include <hikotest/hikotest.hpp>
+#include <format>
+#include <span>
+#include <utility>
 
 TEST_SUITE(gzip_suite) {
 
@@ -125,4 +128,54 @@ TEST_CASE(unzip_xargs1)
     }
 }
 
+
+/** Concatenate the test files into a multi-member gzip file.
+ */
+[[nodiscard]] static std::pair<hi::bstring, hi::bstring> make_multi_member()
+{
+    auto compressed = hi::bstring{};
+    auto original = hi::bstring{};
+    for (auto const i : {1, 3, 4, 5, 2, 6, 7, 8}) {
+        auto const name = std::format("gzip_test{}.bin", i);
+        compressed += as_bstring_view(hi::file_view{hi::library_test_data_dir() / (name + ".gz")});
+        original += as_bstring_view(hi::file_view{hi::library_test_data_dir() / name});
+    }
+    return {compressed, original};
+}
+
+TEST_CASE(unzip_multi_member)
+{
+    auto const [compressed, original] = make_multi_member();
+
+    auto const decompressed = hi::gzip_decompress(std::span{compressed.data(), compressed.size()}, 0x0100'0000);
+    REQUIRE(decompressed == original);
+}
+
+TEST_CASE(unzip_multi_member_corrupt)
+{
+    auto [compressed, original] = make_multi_member();
+    compressed[5000] = std::byte{0x55};
+
+    REQUIRE_THROWS(hi::gzip_decompress(std::span{compressed.data(), compressed.size()}, 0x0100'0000), hi::parse_error);
+}
+
+TEST_CASE(index_read)
+{
+    auto const [compressed, original] = make_multi_member();
+    auto const bytes = std::span{compressed.data(), compressed.size()};
+
+    for (auto const interval : {std::size_t{1}, std::size_t{4096}, std::size_t{0x10'0000}}) {
+        auto const index = hi::gzip_index{bytes, interval};
+        REQUIRE(index.size() == original.size());
+        // An access point at the start of each member.
+        REQUIRE(index.access_points().size() >= 8);
+
+        for (auto position = std::size_t{0}; position < original.size(); position += 997) {
+            REQUIRE(index.read(bytes, position, 100) == original.substr(position, 100));
+            REQUIRE(index.read(bytes, position, 40000) == original.substr(position, 40000));
+        }
+        REQUIRE(index.read(bytes, original.size(), 100).empty());
+    }
+}
+
 };
@@ -8,215 +8,517 @@
 #include "../container/container.hpp"
 #include "../parser/parser.hpp"
 #include "../macros.hpp"
-#include "huffman.hpp"
 #include <span>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
 
 hi_export_module(hikogui.codec.inflate);
 
 hi_export namespace hi { inline namespace v1 {
 namespace detail {
 
-inline void inflate_copy_block(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t max_size, bstring& r)
-{
-    auto offset = (bit_offset + 7) / 8;
+/** A bit-reader for the deflate bit-stream.
+ *
+ * Bits are read LSB first from a 64 bit buffer, which is refilled with
+ * a single unaligned load while more than 8 bytes are available.
+ */
+class inflate_bit_reader {
+public:
+    inflate_bit_reader(std::span<std::byte const> bytes, std::size_t offset) noexcept : _bytes(bytes)
+    {
+        seek(offset);
+    }
 
-    auto LEN = **make_placement_ptr<little_uint16_buf_t>(bytes, offset);
-    [[maybe_unused]] auto NLEN = **make_placement_ptr<little_uint16_buf_t>(bytes, offset);
+    [[nodiscard]] std::span<std::byte const> bytes() const noexcept
+    {
+        return _bytes;
+    }
 
-    hi_check((offset + LEN) <= bytes.size(), "input buffer overrun");
-    hi_check((r.size() + LEN) <= max_size, "output buffer overrun");
-    r.append(&bytes[offset], LEN);
+    /** The number of bits read from the start of the byte array.
+     */
+    [[nodiscard]] std::size_t bit_offset() const noexcept
+    {
+        return _offset * 8 - _num_bits;
+    }
 
-    bit_offset = offset * 8;
-}
+    /** Continue reading at a byte offset, discarding the bits in the buffer.
+     */
+    void seek(std::size_t offset) noexcept
+    {
+        _offset = offset;
+        _buffer = 0;
+        _num_bits = 0;
+    }
+
+    /** Continue reading at a bit offset, as returned by `bit_offset()`.
+     *
+     * @throw parse_error When the bit offset is beyond the end of the byte array.
+     */
+    void seek_bits(std::size_t bit_offset)
+    {
+        hi_check(bit_offset <= _bytes.size() * 8, "Input buffer overrun");
+        seek(bit_offset / 8);
+        refill();
+        consume(bit_offset % 8);
+    }
+
+    /** Fill the bit-buffer so that at least 56 bits are available.
+     *
+     * When the end of the byte array is reached zero bits are added to the buffer.
+     *
+     * @throw parse_error When the bits past the end of the byte array where used.
+     */
+    hi_force_inline void refill()
+    {
+        if (_offset + sizeof(uint64_t) <= _bytes.size()) [[likely]] {
+            _buffer |= load_le<uint64_t>(_bytes.data() + _offset) << _num_bits;
+            _offset += (63 - _num_bits) >> 3;
+            _num_bits |= 56;
+        } else {
+            refill_slow();
+        }
+    }
+
+    /** Look at the next bits without consuming them.
+     *
+     * @pre `refill()` must have been called so that enough bits are available.
+     */
+    [[nodiscard]] hi_force_inline std::size_t peek(std::size_t length) const noexcept
+    {
+        hi_axiom(length <= _num_bits);
+        return narrow_cast<std::size_t>(_buffer & ((uint64_t{1} << length) - 1));
+    }
+
+    hi_force_inline void consume(std::size_t length) noexcept
+    {
+        hi_axiom(length <= _num_bits);
+        _buffer >>= length;
+        _num_bits -= length;
+    }
+
+    [[nodiscard]] hi_force_inline std::size_t get(std::size_t length) noexcept
+    {
+        auto const r = peek(length);
+        consume(length);
+        return r;
+    }
+
+    /** Check that no bits past the end of the byte array where used.
+     */
+    void check_overrun() const
+    {
+        hi_check(bit_offset() <= _bytes.size() * 8, "Input buffer overrun");
+    }
+
+private:
+    std::span<std::byte const> _bytes;
+
+    /** Offset of the next byte to be loaded in the buffer.
+     *
+     * At the end of the byte array this may point beyond the end.
+     */
+    std::size_t _offset = 0;
+    uint64_t _buffer = 0;
+    std::size_t _num_bits = 0;
+
+    void refill_slow()
+    {
+        check_overrun();
+
+        while (_num_bits < 56) {
+            if (_offset < _bytes.size()) {
+                _buffer |= uint64_t{std::to_integer<uint8_t>(_bytes[_offset])} << _num_bits;
+            }
+            ++_offset;
+            _num_bits += 8;
+        }
+    }
+};
+
+/** An entry in a huffman decode table.
+ */
+struct inflate_code {
+    constexpr static uint8_t extra_mask = 0x0f;
+    constexpr static uint8_t literal = 0x10;
+    constexpr static uint8_t end_of_block = 0x20;
+    constexpr static uint8_t sub_table = 0x40;
+    constexpr static uint8_t invalid = 0x80;
+
+    /** The literal, the base value of a length or distance, or the offset of a sub-table.
+     */
+    uint16_t value = 0;
+
+    /** The number of bits of the huffman code.
+     */
+    uint8_t num_bits = 0;
+
+    /** The kind of code, the lower bits are the number of extra bits or the number of bits of a sub-table.
+     */
+    uint8_t op = invalid;
+};
+
+/** A table for decoding huffman codes multiple bits at a time.
+ *
+ * The primary table is indexed with the next `primary_bits` bits of the bit-stream.
+ * Codes that are longer than `primary_bits` are found in a sub-table that is indexed
+ * with the bits following the primary bits.
+ */
+class inflate_table {
+public:
+    inflate_table() noexcept = default;
+
+    /** Build a decode table from the code lengths of a canonical huffman code.
+     *
+     * @param lengths The code length of each symbol, or zero if the symbol is not used.
+     * @param symbol_codes The value and operation of each symbol.
+     * @param primary_bits The number of bits used to index the primary table.
+     * @throw parse_error When the code lengths are over-subscribed.
+     */
+    inflate_table(std::span<uint8_t const> lengths, std::span<inflate_code const> symbol_codes, std::size_t primary_bits) :
+        _primary_bits(primary_bits)
+    {
+        constexpr auto max_length = 15_uz;
+
+        hi_axiom(lengths.size() <= symbol_codes.size());
+        hi_axiom(primary_bits <= max_length);
+
+        auto counts = std::array<std::size_t, max_length + 1>{};
+        for (auto const length : lengths) {
+            hi_check(length <= max_length, "Huffman code length too large");
+            ++counts[length];
+        }
+        counts[0] = 0;
+
+        auto codes_left = 1_z;
+        auto next_code = std::array<std::size_t, max_length + 1>{};
+        auto code = 0_uz;
+        for (auto length = 1_uz; length <= max_length; ++length) {
+            codes_left = codes_left * 2 - narrow_cast<ptrdiff_t>(counts[length]);
+            hi_check(codes_left >= 0, "Over-subscribed huffman code lengths");
+
+            code = (code + counts[length - 1]) << 1;
+            next_code[length] = code;
+        }
+
+        // Canonical huffman codes are stored MSB first, the table is indexed LSB first.
+        auto reversed_codes = std::vector<std::size_t>(lengths.size(), 0);
+        for (auto symbol = 0_uz; symbol != lengths.size(); ++symbol) {
+            if (auto const length = lengths[symbol]) {
+                reversed_codes[symbol] = reverse_bits(next_code[length]++, length);
+            }
+        }
+
+        auto const primary_size = 1_uz << primary_bits;
+        auto const primary_mask = primary_size - 1;
+        _table.resize(primary_size);
+
+        // Determine the number of bits of each sub-table.
+        auto sub_table_bits = std::vector<uint8_t>(primary_size, 0);
+        for (auto symbol = 0_uz; symbol != lengths.size(); ++symbol) {
+            if (lengths[symbol] > primary_bits) {
+                auto& bits = sub_table_bits[reversed_codes[symbol] & primary_mask];
+                bits = std::max(bits, narrow_cast<uint8_t>(lengths[symbol] - primary_bits));
+            }
+        }
+
+        for (auto prefix = 0_uz; prefix != primary_size; ++prefix) {
+            if (auto const bits = sub_table_bits[prefix]) {
+                _table[prefix].value = narrow_cast<uint16_t>(_table.size());
+                _table[prefix].num_bits = narrow_cast<uint8_t>(primary_bits);
+                _table[prefix].op = inflate_code::sub_table | bits;
+                _table.resize(_table.size() + (1_uz << bits));
+            }
+        }
+
+        for (auto symbol = 0_uz; symbol != lengths.size(); ++symbol) {
+            auto const length = lengths[symbol];
+            if (length == 0) {
+                continue;
+            }
+
+            auto entry = symbol_codes[symbol];
+            entry.num_bits = length;
+
+            auto const reversed_code = reversed_codes[symbol];
+            if (length <= primary_bits) {
+                for (auto i = reversed_code; i < primary_size; i += 1_uz << length) {
+                    _table[i] = entry;
+                }
+
+            } else {
+                auto const& sub_table = _table[reversed_code & primary_mask];
+                auto const offset = sub_table.value;
+                auto const sub_size = 1_uz << (sub_table.op & inflate_code::extra_mask);
+                for (auto i = reversed_code >> primary_bits; i < sub_size; i += 1_uz << (length - primary_bits)) {
+                    _table[offset + i] = entry;
+                }
+            }
+        }
+    }
+
+    /** Decode the next huffman code from the bit-stream.
+     *
+     * @pre `reader.refill()` must have been called so that at least 15 bits are available.
+     * @return The entry of the decoded symbol.
+     * @throw parse_error When the code is not in the table.
+     */
+    [[nodiscard]] hi_force_inline inflate_code decode(inflate_bit_reader& reader) const
+    {
+        auto code = _table[reader.peek(_primary_bits)];
+        if (code.op & inflate_code::sub_table) [[unlikely]] {
+            auto const sub_table_bits = code.op & inflate_code::extra_mask;
+            code = _table[code.value + (reader.peek(_primary_bits + sub_table_bits) >> _primary_bits)];
+        }
+
+        if (code.op & inflate_code::invalid) [[unlikely]] {
+            throw parse_error("Code not in huffman tree.");
+        }
+
+        reader.consume(code.num_bits);
+        return code;
+    }
 
-[[nodiscard]] inline std::size_t
-inflate_decode_length(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t symbol)
+private:
+    std::size_t _primary_bits = 0;
+    std::vector<inflate_code> _table;
+
+    [[nodiscard]] constexpr static std::size_t reverse_bits(std::size_t code, std::size_t length) noexcept
+    {
+        auto r = 0_uz;
+        for (auto i = 0_uz; i != length; ++i) {
+            r = (r << 1) | (code & 1);
+            code >>= 1;
+        }
+        return r;
+    }
+};
+
+/** Copy earlier decompressed data.
+ *
+ * Matches with a distance of 8 or more are copied 8 bytes at a time,
+ * which may write up to 7 bytes beyond `dst + length`.
+ *
+ * @param dst The destination of the copy.
+ * @param distance The number of bytes back from @a dst to copy from.
+ * @param length The number of bytes to copy, this may be larger than the distance.
+ */
+hi_force_inline void inflate_copy_match(std::byte *dst, std::size_t distance, std::size_t length) noexcept
 {
-    switch (symbol) {
-    case 257:
-        return 3;
-    case 258:
-        return 4;
-    case 259:
-        return 5;
-    case 260:
-        return 6;
-    case 261:
-        return 7;
-    case 262:
-        return 8;
-    case 263:
-        return 9;
-    case 264:
-        return 10;
-    case 265:
-        return get_bits(bytes, bit_offset, 1) + 11;
-    case 266:
-        return get_bits(bytes, bit_offset, 1) + 13;
-    case 267:
-        return get_bits(bytes, bit_offset, 1) + 15;
-    case 268:
-        return get_bits(bytes, bit_offset, 1) + 17;
-    case 269:
-        return get_bits(bytes, bit_offset, 2) + 19;
-    case 270:
-        return get_bits(bytes, bit_offset, 2) + 23;
-    case 271:
-        return get_bits(bytes, bit_offset, 2) + 27;
-    case 272:
-        return get_bits(bytes, bit_offset, 2) + 31;
-    case 273:
-        return get_bits(bytes, bit_offset, 3) + 35;
-    case 274:
-        return get_bits(bytes, bit_offset, 3) + 43;
-    case 275:
-        return get_bits(bytes, bit_offset, 3) + 51;
-    case 276:
-        return get_bits(bytes, bit_offset, 3) + 59;
-    case 277:
-        return get_bits(bytes, bit_offset, 4) + 67;
-    case 278:
-        return get_bits(bytes, bit_offset, 4) + 83;
-    case 279:
-        return get_bits(bytes, bit_offset, 4) + 99;
-    case 280:
-        return get_bits(bytes, bit_offset, 4) + 115;
-    case 281:
-        return get_bits(bytes, bit_offset, 5) + 131;
-    case 282:
-        return get_bits(bytes, bit_offset, 5) + 163;
-    case 283:
-        return get_bits(bytes, bit_offset, 5) + 195;
-    case 284:
-        return get_bits(bytes, bit_offset, 5) + 227;
-    case 285:
-        return 258;
-    default:
-        throw parse_error(std::format("Literal/Length symbol out of range {}", symbol));
+    hi_axiom(distance > 0);
+
+    auto const *src = dst - distance;
+    if (distance >= 8) {
+        // Each 8 byte copy reads bytes that are already written.
+        for (auto i = 0_uz; i < length; i += 8) {
+            std::memcpy(dst + i, src + i, 8);
+        }
+    } else if (distance == 1) {
+        std::memset(dst, std::to_integer<int>(*src), length);
+    } else {
+        for (auto i = 0_uz; i != length; ++i) {
+            dst[i] = src[i];
+        }
     }
 }
 
-[[nodiscard]] inline std::size_t
-inflate_decode_distance(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t symbol)
-{
-    switch (symbol) {
-    case 0:
-        return 1;
-    case 1:
-        return 2;
-    case 2:
-        return 3;
-    case 3:
-        return 4;
-    case 4:
-        return get_bits(bytes, bit_offset, 1) + 5;
-    case 5:
-        return get_bits(bytes, bit_offset, 1) + 7;
-    case 6:
-        return get_bits(bytes, bit_offset, 2) + 9;
-    case 7:
-        return get_bits(bytes, bit_offset, 2) + 13;
-    case 8:
-        return get_bits(bytes, bit_offset, 3) + 17;
-    case 9:
-        return get_bits(bytes, bit_offset, 3) + 25;
-    case 10:
-        return get_bits(bytes, bit_offset, 4) + 33;
-    case 11:
-        return get_bits(bytes, bit_offset, 4) + 49;
-    case 12:
-        return get_bits(bytes, bit_offset, 5) + 65;
-    case 13:
-        return get_bits(bytes, bit_offset, 5) + 97;
-    case 14:
-        return get_bits(bytes, bit_offset, 6) + 129;
-    case 15:
-        return get_bits(bytes, bit_offset, 6) + 193;
-    case 16:
-        return get_bits(bytes, bit_offset, 7) + 257;
-    case 17:
-        return get_bits(bytes, bit_offset, 7) + 385;
-    case 18:
-        return get_bits(bytes, bit_offset, 8) + 513;
-    case 19:
-        return get_bits(bytes, bit_offset, 8) + 769;
-    case 20:
-        return get_bits(bytes, bit_offset, 9) + 1025;
-    case 21:
-        return get_bits(bytes, bit_offset, 9) + 1537;
-    case 22:
-        return get_bits(bytes, bit_offset, 10) + 2049;
-    case 23:
-        return get_bits(bytes, bit_offset, 10) + 3073;
-    case 24:
-        return get_bits(bytes, bit_offset, 11) + 4097;
-    case 25:
-        return get_bits(bytes, bit_offset, 11) + 6145;
-    case 26:
-        return get_bits(bytes, bit_offset, 12) + 8193;
-    case 27:
-        return get_bits(bytes, bit_offset, 12) + 12289;
-    case 28:
-        return get_bits(bytes, bit_offset, 13) + 16385;
-    case 29:
-        return get_bits(bytes, bit_offset, 13) + 24577;
-    default:
-        throw parse_error(std::format("Distance symbol out of range {}", symbol));
+/** The output of inflate.
+ *
+ * The buffer is allocated with some slack at the end, so that matches
+ * can be copied 8 bytes at a time.
+ */
+class inflate_output {
+public:
+    inflate_output(std::size_t max_size) noexcept : _max_size(max_size) {}
+
+    /** Continue inflating after earlier decompressed data.
+     *
+     * The @a window is placed at the start of the output, so that matches can
+     * refer to it. It is not counted in @a max_size.
+     *
+     * @param max_size The maximum size of the decompressed data after the window.
+     * @param window Up to 32 KiB of data that was decompressed before.
+     */
+    inflate_output(std::size_t max_size, bstring_view window) : _max_size(max_size + window.size())
+    {
+        append(window.data(), window.size());
+    }
+
+    /** The number of bytes in the output, including the window.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _size;
     }
+
+    [[nodiscard]] bstring_view view() const noexcept
+    {
+        return bstring_view{_data.data(), _size};
+    }
+
+    hi_force_inline void push_back(std::byte c)
+    {
+        reserve(1);
+        _data[_size++] = c;
+    }
+
+    void append(std::byte const *ptr, std::size_t size)
+    {
+        reserve(size);
+        std::memcpy(_data.data() + _size, ptr, size);
+        _size += size;
+    }
+
+    /** Copy earlier decompressed data to the end of the output.
+     *
+     * @param distance The number of bytes back from the end of the output.
+     * @param length The number of bytes to copy, this may be larger than the distance.
+     */
+    hi_force_inline void copy_match(std::size_t distance, std::size_t length)
+    {
+        hi_check(distance <= _size, "Distance beyond start of decompressed data");
+        reserve(length);
+
+        inflate_copy_match(_data.data() + _size, distance, length);
+        _size += length;
+    }
+
+    [[nodiscard]] bstring finish() noexcept
+    {
+        _data.resize(_size);
+        return std::move(_data);
+    }
+
+private:
+    constexpr static std::size_t slack = 8;
+
+    bstring _data;
+    std::size_t _size = 0;
+    std::size_t _max_size;
+
+    hi_force_inline void reserve(std::size_t size)
+    {
+        if (_size + size + slack > _data.size()) [[unlikely]] {
+            grow(size);
+        }
+    }
+
+    void grow(std::size_t size)
+    {
+        hi_check(_size + size <= _max_size, "Output buffer overrun");
+
+        auto new_size = std::max(_data.size() * 2, 0x1'0000_uz);
+        new_size = std::min(new_size, _max_size + slack);
+        new_size = std::max(new_size, _size + size + slack);
+        _data.resize(new_size);
+    }
+};
+
+// clang-format off
+constexpr auto inflate_length_base = std::array<uint16_t, 29>{
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+constexpr auto inflate_length_extra = std::array<uint8_t, 29>{
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+constexpr auto inflate_distance_base = std::array<uint16_t, 30>{
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577};
+constexpr auto inflate_distance_extra = std::array<uint8_t, 30>{
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+// clang-format on
+
+/** The value and operation of each literal/length symbol.
+ *
+ * Symbols 286 and 287 do not occur in valid data.
+ */
+constexpr auto inflate_literal_codes = [] {
+    auto r = std::array<inflate_code, 288>{};
+    for (auto i = 0_uz; i != 256; ++i) {
+        r[i] = inflate_code{narrow_cast<uint16_t>(i), 0, inflate_code::literal};
+    }
+    r[256] = inflate_code{0, 0, inflate_code::end_of_block};
+    for (auto i = 0_uz; i != inflate_length_base.size(); ++i) {
+        r[257 + i] = inflate_code{inflate_length_base[i], 0, inflate_length_extra[i]};
+    }
+    return r;
+}();
+
+/** The value and operation of each distance symbol.
+ *
+ * Symbols 30 and 31 do not occur in valid data.
+ */
+constexpr auto inflate_distance_codes = [] {
+    auto r = std::array<inflate_code, 32>{};
+    for (auto i = 0_uz; i != inflate_distance_base.size(); ++i) {
+        r[i] = inflate_code{inflate_distance_base[i], 0, inflate_distance_extra[i]};
+    }
+    return r;
+}();
+
+/** The value and operation of each code-length symbol.
+ */
+constexpr auto inflate_code_length_codes = [] {
+    auto r = std::array<inflate_code, 19>{};
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        r[i] = inflate_code{narrow_cast<uint16_t>(i), 0, inflate_code::literal};
+    }
+    return r;
+}();
+
+constexpr std::size_t inflate_literal_bits = 10;
+constexpr std::size_t inflate_distance_bits = 8;
+constexpr std::size_t inflate_code_length_bits = 7;
+
+inline void inflate_copy_block(inflate_bit_reader& reader, inflate_output& r)
+{
+    // The bits in the bit-buffer are discarded, and the block is read from the byte array directly.
+    auto offset = (reader.bit_offset() + 7) / 8;
+    reader.check_overrun();
+
+    auto const bytes = reader.bytes();
+    auto const LEN = **make_placement_ptr<little_uint16_buf_t>(bytes, offset);
+    auto const NLEN = **make_placement_ptr<little_uint16_buf_t>(bytes, offset);
+    hi_check(LEN == static_cast<uint16_t>(~NLEN), "Stored block length does not match its complement");
+
+    hi_check((offset + LEN) <= bytes.size(), "input buffer overrun");
+    r.append(&bytes[offset], LEN);
+
+    reader.seek(offset + LEN);
 }
 
 inline void inflate_block(
-    std::span<std::byte const> bytes,
-    std::size_t& bit_offset,
-    std::size_t max_size,
-    huffman_tree<int16_t> const& literal_tree,
-    huffman_tree<int16_t> const& distance_tree,
-    bstring& r)
+    inflate_bit_reader& reader,
+    inflate_table const& literal_table,
+    inflate_table const& distance_table,
+    inflate_output& r)
 {
     while (true) {
-        // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-        // - 15 bits maximum huffman code.
-        // -  5 bits extra length.
-        // -  7 bits rounding up to byte.
-        hi_check(((bit_offset + 27) >> 3) <= bytes.size(), "Input buffer overrun");
+        // A literal/length code with extra bits is at most 20 bits, followed by
+        // a distance code with extra bits of at most 28 bits.
+        reader.refill();
 
-        auto const literal_symbol = literal_tree.get_symbol(bytes, bit_offset);
+        auto const literal_code = literal_table.decode(reader);
+        if (literal_code.op & inflate_code::literal) {
+            r.push_back(static_cast<std::byte>(literal_code.value));
 
-        if (literal_symbol <= 255) {
-            hi_check(r.size() < max_size, "Output buffer overrun");
-            r.push_back(static_cast<std::byte>(literal_symbol));
-
-        } else if (literal_symbol == 256) {
-            // End-of-block.
+        } else if (literal_code.op & inflate_code::end_of_block) {
             return;
 
         } else {
-            auto const length = inflate_decode_length(bytes, bit_offset, literal_symbol);
-            hi_check(r.size() + length <= max_size, "Output buffer overrun");
-
-            // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-            // - 15 bits maximum huffman code.
-            // -  7 bits rounding up to byte.
-            hi_check(((bit_offset + 22) >> 3) <= bytes.size(), "Input buffer overrun");
-            auto const distance_symbol = distance_tree.get_symbol(bytes, bit_offset);
-
-            // Test only every inflate_decode_distance, the trailer is at least 32 bits (Checksum)
-            // - 13 bits extra length.
-            // -  7 bits rounding up to byte.
-            hi_check(((bit_offset + 20) >> 3) <= bytes.size(), "Input buffer overrun");
-            auto const distance = inflate_decode_distance(bytes, bit_offset, distance_symbol);
-
-            hi_check(distance <= r.size(), "Distance beyond start of decompressed data");
-            auto src_i = r.size() - distance;
-            for (auto i = 0; i != length; ++i) {
-                r.push_back(r[src_i++]);
-            }
+            auto const length = literal_code.value + reader.get(literal_code.op & inflate_code::extra_mask);
+
+            auto const distance_code = distance_table.decode(reader);
+            auto const distance = distance_code.value + reader.get(distance_code.op & inflate_code::extra_mask);
+
+            r.copy_match(distance, length);
         }
     }
 }
 
-inline huffman_tree<int16_t> deflate_fixed_literal_tree = []() {
+inline inflate_table const inflate_fixed_literal_table = []() {
     std::vector<uint8_t> lengths;
 
     for (int i = 0; i <= 143; ++i) {
@@ -232,154 +534,131 @@ inline huffman_tree<int16_t> deflate_fixed_literal_tree = []() {
         lengths.push_back(8);
     }
 
-    return huffman_tree<int16_t>::from_lengths(lengths);
+    return inflate_table{lengths, inflate_literal_codes, inflate_literal_bits};
 }();
 
-inline huffman_tree<int16_t> deflate_fixed_distance_tree = []() {
+inline inflate_table const inflate_fixed_distance_table = []() {
     std::vector<uint8_t> lengths;
 
     for (int i = 0; i <= 31; ++i) {
         lengths.push_back(5);
     }
 
-    return huffman_tree<int16_t>::from_lengths(lengths);
+    return inflate_table{lengths, inflate_distance_codes, inflate_distance_bits};
 }();
 
-inline void inflate_fixed_block(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t max_size, bstring& r)
+inline void inflate_fixed_block(inflate_bit_reader& reader, inflate_output& r)
 {
-    inflate_block(bytes, bit_offset, max_size, deflate_fixed_literal_tree, deflate_fixed_distance_tree, r);
+    inflate_block(reader, inflate_fixed_literal_table, inflate_fixed_distance_table, r);
 }
 
-[[nodiscard]] inline huffman_tree<int16_t>
-inflate_code_lengths(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t nr_symbols)
+[[nodiscard]] inline inflate_table inflate_code_lengths(inflate_bit_reader& reader, std::size_t nr_symbols)
 {
     // The symbols are in different order in the table.
     constexpr auto symbols = std::array<int16_t, 19>{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
 
-    hi_check(((bit_offset + (3 * static_cast<std::size_t>(nr_symbols)) + 7) >> 3) <= bytes.size(), "Input buffer overrun");
-
     auto lengths = std::vector<uint8_t>(symbols.size(), 0);
     for (auto i = 0_uz; i != nr_symbols; ++i) {
+        reader.refill();
         auto const symbol = symbols[i];
-        lengths[symbol] = narrow_cast<uint8_t>(get_bits(bytes, bit_offset, 3));
+        lengths[symbol] = narrow_cast<uint8_t>(reader.get(3));
     }
-    return huffman_tree<int16_t>::from_lengths(std::move(lengths));
+    return inflate_table{lengths, inflate_code_length_codes, inflate_code_length_bits};
 }
 
-inline std::vector<uint8_t> inflate_lengths(
-    std::span<std::byte const> bytes,
-    std::size_t& bit_offset,
-    std::size_t nr_symbols,
-    huffman_tree<int16_t> const& code_length_tree)
+inline std::vector<uint8_t>
+inflate_lengths(inflate_bit_reader& reader, std::size_t nr_symbols, inflate_table const& code_length_table)
 {
     auto r = std::vector<uint8_t>{};
-    r.reserve(nr_symbols);
+    r.reserve(nr_symbols + 138);
 
-    auto prev_length = 0_uz;
+    auto prev_length = uint8_t{0};
     while (r.size() < nr_symbols) {
-        // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-        // -  7 bits maximum huffman code.
-        // -  7 bits extra length.
-        // -  7 bits rounding up to byte.
-        hi_check(((bit_offset + 21) >> 3) <= bytes.size(), "Input buffer overrun");
-        auto const symbol = code_length_tree.get_symbol(bytes, bit_offset);
+        // At most 7 bits huffman code and 7 bits extra length.
+        reader.refill();
+        auto const symbol = code_length_table.decode(reader).value;
 
         switch (symbol) {
         case 16:
-            {
-                auto copy_length = get_bits(bytes, bit_offset, 2) + 3;
-                while (copy_length--) {
-                    r.push_back(static_cast<uint8_t>(prev_length));
-                }
-            }
+            hi_check(not r.empty(), "Repeat of code length without a previous code length");
+            r.insert(r.end(), reader.get(2) + 3, prev_length);
             break;
         case 17:
-            {
-                auto copy_length = get_bits(bytes, bit_offset, 3) + 3;
-                while (copy_length--) {
-                    r.push_back(0);
-                }
-            }
+            r.insert(r.end(), reader.get(3) + 3, uint8_t{0});
             break;
         case 18:
-            {
-                auto copy_length = get_bits(bytes, bit_offset, 7) + 11;
-                while (copy_length--) {
-                    r.push_back(0);
-                }
-            }
+            r.insert(r.end(), reader.get(7) + 11, uint8_t{0});
             break;
         default:
-            r.push_back(static_cast<uint8_t>(prev_length = symbol));
+            r.push_back(prev_length = narrow_cast<uint8_t>(symbol));
         }
     }
 
+    hi_check(r.size() == nr_symbols, "Code lengths overrun the number of symbols");
     return r;
 }
 
-inline void inflate_dynamic_block(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t max_size, bstring& r)
+/** Read the code-lengths and build the decode tables of a dynamic block.
+ *
+ * @return The literal/length table and the distance table.
+ */
+[[nodiscard]] inline std::pair<inflate_table, inflate_table> inflate_dynamic_tables(inflate_bit_reader& reader)
 {
-    // Test all lengths, the trailer is at least 32 bits (Checksum)
-    // - 14 bits lengths
-    // -  7 bits rounding up to byte.
-    hi_check(((bit_offset + 21) >> 3) <= bytes.size(), "Input buffer overrun");
-    auto const HLIT = get_bits(bytes, bit_offset, 5);
-    auto const HDIST = get_bits(bytes, bit_offset, 5);
-    auto const HCLEN = get_bits(bytes, bit_offset, 4);
+    reader.refill();
+    auto const HLIT = reader.get(5);
+    auto const HDIST = reader.get(5);
+    auto const HCLEN = reader.get(4);
 
-    auto const code_length_tree = inflate_code_lengths(bytes, bit_offset, HCLEN + 4);
+    auto const code_length_table = inflate_code_lengths(reader, HCLEN + 4);
 
-    auto const lengths = inflate_lengths(bytes, bit_offset, HLIT + HDIST + 258, code_length_tree);
+    auto const lengths = inflate_lengths(reader, HLIT + HDIST + 258, code_length_table);
     hi_check(lengths[256] != 0, "The end-of-block symbol must be in the table");
 
-    auto const lengths_ptr = lengths.data();
-    hi_assert_not_null(lengths_ptr);
-    auto const literal_tree = huffman_tree<int16_t>::from_lengths(lengths_ptr, HLIT + 257);
-    auto const distance_tree = huffman_tree<int16_t>::from_lengths(&lengths_ptr[HLIT + 257], HDIST + 1);
-
-    inflate_block(bytes, bit_offset, max_size, literal_tree, distance_tree, r);
+    auto const lengths_span = std::span{lengths};
+    return {
+        inflate_table{lengths_span.first(HLIT + 257), inflate_literal_codes, inflate_literal_bits},
+        inflate_table{lengths_span.subspan(HLIT + 257, HDIST + 1), inflate_distance_codes, inflate_distance_bits}};
 }
 
-} // namespace detail
+inline void inflate_dynamic_block(inflate_bit_reader& reader, inflate_output& r)
+{
+    auto const [literal_table, distance_table] = inflate_dynamic_tables(reader);
+    inflate_block(reader, literal_table, distance_table, r);
+}
 
-/** Inflate compressed data using the deflate algorithm
- * `bytes` should include at least 32 bit of trailer, for the overflow check which
- * will slightly overrun the actual compressed data for performance reasons.
+/** Inflate the blocks of a deflate stream.
  *
- * - gzip has a CRC32+ISIZE trailer.
- *   Since gzip has no end-of-segment indicator, we need to include the trailer
- *   in the byte array passed to inflate anyway.
- * - zlib has a 32 bit check value.
- *   Since zlib has no end-of-segment indicator, we need to include the trailer
- *   in the byte array passed to inflate anyway.
- * - png IDAT chunks include the full zlib-format, including the 32 bit check value.
+ * @param reader The reader, positioned at the header of a block.
+ * @param r The output.
+ * @param at_block A function `bool(std::size_t bit_offset, inflate_output const&)` called
+ *                 before each block, with the bit offset of the block header. Inflating
+ *                 stops when it returns false.
+ * @retval true When the final block was inflated.
+ * @retval false When stopped by @a at_block.
+ * @throw parse_error When the compressed data is invalid.
  */
-hi_export [[nodiscard]] inline bstring
-inflate(std::span<std::byte const> bytes, std::size_t& offset, std::size_t max_size = 0x0100'0000)
+template<typename Func>
+inline bool inflate_blocks(inflate_bit_reader& reader, inflate_output& r, Func const& at_block)
 {
-    std::size_t bit_offset = offset * 8;
-
-    auto r = bstring{};
-
     auto BFINAL = false;
     do {
-        // Test all lengths, the trailer is at least 32 bits (Checksum)
-        // - 3 bits header
-        // - 7 bits rounding up to byte.
-        hi_check(((bit_offset + 10) >> 3) <= bytes.size(), "Input buffer overrun");
+        if (not at_block(reader.bit_offset(), std::as_const(r))) {
+            return false;
+        }
 
-        BFINAL = get_bit(bytes, bit_offset);
-        auto const BTYPE = get_bits(bytes, bit_offset, 2);
+        reader.refill();
+        BFINAL = to_bool(reader.get(1));
+        auto const BTYPE = reader.get(2);
 
         switch (BTYPE) {
         case 0:
-            detail::inflate_copy_block(bytes, bit_offset, max_size, r);
+            inflate_copy_block(reader, r);
             break;
         case 1:
-            detail::inflate_fixed_block(bytes, bit_offset, max_size, r);
+            inflate_fixed_block(reader, r);
             break;
         case 2:
-            detail::inflate_dynamic_block(bytes, bit_offset, max_size, r);
+            inflate_dynamic_block(reader, r);
             break;
         default:
             throw parse_error("Reserved block type");
@@ -387,8 +666,35 @@ inflate(std::span<std::byte const> bytes, std::size_t& offset, std::size_t max_s
 
     } while (!BFINAL);
 
-    offset = (bit_offset + 7) / 8;
-    return r;
+    reader.check_overrun();
+    return true;
+}
+
+} // namespace detail
+
+/** Inflate compressed data using the deflate algorithm
+ *
+ * The huffman codes are decoded using multi-bit lookup-tables, and the
+ * bit-stream is read 64 bits at a time.
+ *
+ * @param bytes The byte array containing the compressed data.
+ * @param[in,out] offset The byte offset of the compressed data, on return the byte offset after the compressed data.
+ * @param max_size The maximum size of the decompressed data.
+ * @return The decompressed data.
+ * @throw parse_error When the compressed data is invalid.
+ */
+hi_export [[nodiscard]] inline bstring
+inflate(std::span<std::byte const> bytes, std::size_t& offset, std::size_t max_size = 0x0100'0000)
+{
+    auto reader = detail::inflate_bit_reader{bytes, offset};
+    auto r = detail::inflate_output{max_size};
+
+    detail::inflate_blocks(reader, r, [](std::size_t, detail::inflate_output const&) {
+        return true;
+    });
+
+    offset = (reader.bit_offset() + 7) / 8;
+    return r.finish();
 }
 
 }} // namespace hi::v1
@@ -0,0 +1,514 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/inflate_stream.hpp Incremental decompression of deflate, zlib and gzip streams.
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../container/container.hpp"
+#include "../parser/parser.hpp"
+#include "../macros.hpp"
+#include "inflate.hpp"
+#include "zlib.hpp"
+#include "gzip.hpp"
+#include <span>
+#include <limits>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.inflate_stream);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** The container format around the deflate compressed data.
+ */
+hi_export enum class inflate_format {
+    /** Raw deflate compressed data, without header or trailer.
+     */
+    deflate,
+
+    /** A zlib stream, RFC 1950.
+     */
+    zlib,
+
+    /** A gzip file with one or more members, RFC 1952.
+     */
+    gzip
+};
+
+/** Incremental decompressor of deflate, zlib and gzip streams.
+ *
+ * The compressed data is passed in chunks to `decompress()`, which returns a generator
+ * yielding the decompressed data as it becomes available. Only the undecoded tail of the
+ * input and a window of the previously decompressed data are kept in memory.
+ *
+ * Example:
+ * ```
+ * auto stream = hi::inflate_stream{hi::inflate_format::gzip};
+ * while (auto const chunk = read_next_chunk()) {
+ *     for (auto const decompressed : stream.decompress(chunk->bytes, chunk->is_last)) {
+ *         write(decompressed);
+ *     }
+ * }
+ * ```
+ *
+ * @note The checksums in the zlib and gzip trailers are not verified, the same as `zlib_decompress()`
+ *       and `gzip_decompress()`.
+ */
+hi_export class inflate_stream {
+public:
+    /** The maximum distance of a match in deflate compressed data.
+     */
+    constexpr static std::size_t window_size = 32768;
+
+    ~inflate_stream() = default;
+    inflate_stream(inflate_stream const&) = delete;
+    inflate_stream(inflate_stream&&) = delete;
+    inflate_stream& operator=(inflate_stream const&) = delete;
+    inflate_stream& operator=(inflate_stream&&) = delete;
+
+    /** Create a decompressor.
+     *
+     * @param format The container format around the compressed data.
+     * @param max_size The maximum total size of the decompressed data.
+     */
+    explicit inflate_stream(inflate_format format, std::size_t max_size = std::numeric_limits<std::size_t>::max()) :
+        _format(format), _max_size(max_size), _window(window_capacity, std::byte{0})
+    {
+    }
+
+    /** Check if the stream was decompressed completely.
+     *
+     * A gzip file may consist of multiple members, it is complete after each member.
+     */
+    [[nodiscard]] bool done() const noexcept
+    {
+        return _state == state_type::done or
+            (_state == state_type::stream_header and _num_members != 0 and _bit_offset == _input.size() * 8);
+    }
+
+    /** The total number of bytes decompressed.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _num_slid_bytes + _size;
+    }
+
+    /** Decompress a chunk of compressed data.
+     *
+     * The chunk is copied before this function returns. The returned generator
+     * must be iterated to the end before `decompress()` is called again.
+     *
+     * @param input The next chunk of compressed data.
+     * @param last True when this is the last chunk of the stream.
+     * @return A generator yielding views of the decompressed data, each view is valid until the generator is resumed.
+     * @throw parse_error When the compressed data is invalid, or when @a last is set and the stream is incomplete.
+     */
+    [[nodiscard]] generator<bstring_view> decompress(std::span<std::byte const> input, bool last = false)
+    {
+        hi_assert(not _last, "decompress() called after the last chunk.");
+
+        _input.append(input.data(), input.size());
+        _last = last;
+
+        while (true) {
+            auto const result = step();
+
+            if (_flushed != _size) {
+                co_yield bstring_view{_window.data() + _flushed, _size - _flushed};
+                _flushed = _size;
+            }
+
+            if (result != step_result::output_full) {
+                break;
+            }
+            slide_window();
+        }
+
+        // Keep only the input that is not yet decoded.
+        _input.erase(0, _bit_offset / 8);
+        _bit_offset %= 8;
+
+        if (_last) {
+            hi_check(done(), "Unexpected end of compressed data");
+        }
+    }
+
+private:
+    constexpr static std::size_t max_match_length = 258;
+
+    /** The slack at the end of the window, so that matches may be copied 8 bytes at a time.
+     */
+    constexpr static std::size_t window_slack = 8;
+
+    /** The size of the buffer for the window and decompressed data that is not yet slid out.
+     */
+    constexpr static std::size_t window_capacity = 4 * window_size;
+
+    enum class state_type {
+        stream_header,
+        block_header,
+        stored_header,
+        stored_data,
+        dynamic_header,
+        huffman_data,
+        stream_trailer,
+        done
+    };
+
+    enum class step_result { need_input, output_full, done };
+
+    inflate_format _format;
+    std::size_t _max_size;
+    state_type _state = state_type::stream_header;
+    bool _last = false;
+    bool _final_block = false;
+
+    /** The compressed data that is not yet decoded.
+     */
+    bstring _input;
+
+    /** The number of bits of `_input` that where decoded.
+     */
+    std::size_t _bit_offset = 0;
+
+    /** The decompressed data, the first `window_size` bytes after sliding are the window.
+     */
+    bstring _window;
+
+    /** The number of bytes in `_window`.
+     */
+    std::size_t _size = 0;
+
+    /** The number of bytes in `_window` that where yielded.
+     */
+    std::size_t _flushed = 0;
+
+    /** The number of bytes that where slid out of `_window`.
+     */
+    std::size_t _num_slid_bytes = 0;
+
+    /** The number of bytes left to copy of a stored block.
+     */
+    std::size_t _stored_size = 0;
+
+    /** The total decompressed size at the start of the current gzip member.
+     */
+    std::size_t _member_start = 0;
+    std::size_t _num_members = 0;
+
+    detail::inflate_table const *_literal_table = nullptr;
+    detail::inflate_table const *_distance_table = nullptr;
+    detail::inflate_table _dynamic_literal_table;
+    detail::inflate_table _dynamic_distance_table;
+
+    void slide_window() noexcept
+    {
+        hi_axiom(_flushed == _size);
+
+        if (_size > window_size) {
+            auto const num_bytes = _size - window_size;
+            std::memmove(_window.data(), _window.data() + num_bytes, window_size);
+            _num_slid_bytes += num_bytes;
+            _size = window_size;
+            _flushed = window_size;
+        }
+    }
+
+    [[nodiscard]] step_result step()
+    {
+        auto const input = std::span<std::byte const>{_input.data(), _input.size()};
+
+        auto reader = detail::inflate_bit_reader{input, _bit_offset / 8};
+        reader.refill();
+        reader.consume(_bit_offset % 8);
+
+        auto const r = step(reader);
+        _bit_offset = reader.bit_offset();
+        return r;
+    }
+
+    [[nodiscard]] step_result step(detail::inflate_bit_reader& reader)
+    {
+        while (true) {
+            auto const r = [&] {
+                switch (_state) {
+                case state_type::stream_header:
+                    return decode_stream_header(reader);
+                case state_type::block_header:
+                    return decode_block_header(reader);
+                case state_type::stored_header:
+                    return decode_stored_header(reader);
+                case state_type::stored_data:
+                    return decode_stored_data(reader);
+                case state_type::dynamic_header:
+                    return decode_dynamic_header(reader);
+                case state_type::huffman_data:
+                    return decode_huffman_data(reader);
+                case state_type::stream_trailer:
+                    return decode_stream_trailer(reader);
+                case state_type::done:
+                    return std::optional{step_result::done};
+                }
+                hi_no_default();
+            }();
+
+            if (r) {
+                return *r;
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t available_bits(detail::inflate_bit_reader const& reader) const noexcept
+    {
+        return _input.size() * 8 - reader.bit_offset();
+    }
+
+    void end_of_block(detail::inflate_bit_reader& reader) noexcept
+    {
+        if (_final_block) {
+            // The trailer starts at a byte boundary.
+            reader.seek((reader.bit_offset() + 7) / 8);
+            _state = state_type::stream_trailer;
+        } else {
+            _state = state_type::block_header;
+        }
+    }
+
+    [[nodiscard]] std::optional<step_result> decode_stream_header(detail::inflate_bit_reader& reader)
+    {
+        auto const input = reader.bytes();
+        auto const offset = reader.bit_offset() / 8;
+
+        auto header_end = std::optional<std::size_t>{};
+        switch (_format) {
+        case inflate_format::deflate:
+            header_end = offset;
+            break;
+        case inflate_format::zlib:
+            header_end = detail::zlib_parse_header(input, offset);
+            break;
+        case inflate_format::gzip:
+            header_end = detail::gzip_parse_member_header(input, offset);
+            break;
+        default:
+            hi_no_default();
+        }
+
+        if (not header_end) {
+            return step_result::need_input;
+        }
+
+        reader.seek(*header_end);
+        _member_start = size();
+        _state = state_type::block_header;
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<step_result> decode_block_header(detail::inflate_bit_reader& reader)
+    {
+        if (available_bits(reader) < 3) {
+            return step_result::need_input;
+        }
+
+        reader.refill();
+        _final_block = to_bool(reader.get(1));
+        switch (reader.get(2)) {
+        case 0:
+            // The length of the stored block starts at a byte boundary.
+            reader.seek((reader.bit_offset() + 7) / 8);
+            _state = state_type::stored_header;
+            break;
+        case 1:
+            _literal_table = &detail::inflate_fixed_literal_table;
+            _distance_table = &detail::inflate_fixed_distance_table;
+            _state = state_type::huffman_data;
+            break;
+        case 2:
+            _state = state_type::dynamic_header;
+            break;
+        default:
+            throw parse_error("Reserved block type");
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<step_result> decode_stored_header(detail::inflate_bit_reader& reader)
+    {
+        auto const input = reader.bytes();
+        auto offset = reader.bit_offset() / 8;
+        if (offset + 4 > input.size()) {
+            return step_result::need_input;
+        }
+
+        auto const LEN = **make_placement_ptr<little_uint16_buf_t>(input, offset);
+        auto const NLEN = **make_placement_ptr<little_uint16_buf_t>(input, offset);
+        hi_check(LEN == static_cast<uint16_t>(~NLEN), "Stored block length does not match its complement");
+
+        reader.seek(offset);
+        _stored_size = LEN;
+        _state = state_type::stored_data;
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<step_result> decode_stored_data(detail::inflate_bit_reader& reader)
+    {
+        auto const input = reader.bytes();
+        auto const offset = reader.bit_offset() / 8;
+
+        if (_stored_size != 0) {
+            if (_size + window_slack == window_capacity) {
+                return step_result::output_full;
+            }
+            if (offset == input.size()) {
+                return step_result::need_input;
+            }
+
+            auto const num_bytes = std::min({_stored_size, input.size() - offset, window_capacity - window_slack - _size});
+            hi_check(size() + num_bytes <= _max_size, "Output buffer overrun");
+
+            std::memcpy(_window.data() + _size, input.data() + offset, num_bytes);
+            _size += num_bytes;
+            _stored_size -= num_bytes;
+            reader.seek(offset + num_bytes);
+        }
+
+        if (_stored_size == 0) {
+            end_of_block(reader);
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<step_result> decode_dynamic_header(detail::inflate_bit_reader& reader)
+    {
+        auto const input_bits = _input.size() * 8;
+
+        auto const saved_reader = reader;
+        try {
+            auto tables = detail::inflate_dynamic_tables(reader);
+            hi_check(reader.bit_offset() <= input_bits, "Input buffer overrun");
+
+            _dynamic_literal_table = std::move(tables.first);
+            _dynamic_distance_table = std::move(tables.second);
+
+        } catch (parse_error const&) {
+            // The header may be invalid because it continues in the next chunk.
+            if (not _last and reader.bit_offset() + 64 > input_bits) {
+                reader = saved_reader;
+                return step_result::need_input;
+            }
+            throw;
+        }
+
+        _literal_table = &_dynamic_literal_table;
+        _distance_table = &_dynamic_distance_table;
+        _state = state_type::huffman_data;
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<step_result> decode_huffman_data(detail::inflate_bit_reader& reader)
+    {
+        hi_axiom_not_null(_literal_table);
+        hi_axiom_not_null(_distance_table);
+
+        auto const input_bits = _input.size() * 8;
+
+        while (_size + max_match_length + window_slack <= window_capacity) {
+            auto const saved_reader = reader;
+            try {
+                reader.refill();
+                auto const literal_code = _literal_table->decode(reader);
+
+                auto length = 0_uz;
+                auto distance = 0_uz;
+                if (not(literal_code.op & (detail::inflate_code::literal | detail::inflate_code::end_of_block))) {
+                    length = literal_code.value + reader.get(literal_code.op & detail::inflate_code::extra_mask);
+
+                    auto const distance_code = _distance_table->decode(reader);
+                    distance = distance_code.value + reader.get(distance_code.op & detail::inflate_code::extra_mask);
+                }
+
+                // The symbol must be complete before it is written to the output.
+                hi_check(reader.bit_offset() <= input_bits, "Input buffer overrun");
+
+                if (literal_code.op & detail::inflate_code::literal) {
+                    hi_check(size() < _max_size, "Output buffer overrun");
+                    _window[_size++] = static_cast<std::byte>(literal_code.value);
+
+                } else if (literal_code.op & detail::inflate_code::end_of_block) {
+                    end_of_block(reader);
+                    return std::nullopt;
+
+                } else {
+                    hi_check(distance <= _size, "Distance beyond start of decompressed data");
+                    hi_check(size() + length <= _max_size, "Output buffer overrun");
+                    detail::inflate_copy_match(_window.data() + _size, distance, length);
+                    _size += length;
+                }
+
+            } catch (parse_error const&) {
+                // The symbol may be invalid because it continues in the next chunk.
+                if (not _last and saved_reader.bit_offset() + 64 > input_bits) {
+                    reader = saved_reader;
+                    return step_result::need_input;
+                }
+                throw;
+            }
+        }
+
+        return step_result::output_full;
+    }
+
+    [[nodiscard]] std::optional<step_result> decode_stream_trailer(detail::inflate_bit_reader& reader)
+    {
+        auto const input = reader.bytes();
+        auto offset = reader.bit_offset() / 8;
+
+        switch (_format) {
+        case inflate_format::deflate:
+            _state = state_type::done;
+            break;
+
+        case inflate_format::zlib:
+            if (offset + 4 > input.size()) {
+                return step_result::need_input;
+            }
+            {
+                [[maybe_unused]] auto const ADLER32 = **make_placement_ptr<big_uint32_buf_t>(input, offset);
+            }
+            reader.seek(offset);
+            _state = state_type::done;
+            break;
+
+        case inflate_format::gzip:
+            if (offset + 8 > input.size()) {
+                return step_result::need_input;
+            }
+            {
+                [[maybe_unused]] auto const CRC32 = **make_placement_ptr<little_uint32_buf_t>(input, offset);
+                auto const ISIZE = **make_placement_ptr<little_uint32_buf_t>(input, offset);
+                hi_check(
+                    ISIZE == ((size() - _member_start) & 0xffffffff),
+                    "GZIP Member header ISIZE must be same as the lower 32 bits of the inflated size.");
+            }
+            reader.seek(offset);
+            ++_num_members;
+            _state = state_type::stream_header;
+            if (offset == input.size()) {
+                return step_result::need_input;
+            }
+            break;
+
+        default:
+            hi_no_default();
+        }
+        return std::nullopt;
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,86 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "inflate_stream.hpp"
+#include "../file/file.hpp"
+#include "../container/container.hpp"
+#include "../path/path.hpp"
+#include "../utility/utility.hpp"
+#include <hikotest/hikotest.hpp>
+#include <algorithm>
+#include <array>
+#include <string>
+
+TEST_SUITE(inflate_stream_suite) {
+
+[[nodiscard]] static hi::bstring decompress_in_chunks(std::span<std::byte const> bytes, std::size_t chunk_size)
+{
+    auto stream = hi::inflate_stream{hi::inflate_format::gzip};
+
+    auto r = hi::bstring{};
+    auto offset = std::size_t{0};
+    do {
+        auto const size = std::min(chunk_size, bytes.size() - offset);
+        auto const last = offset + size == bytes.size();
+
+        for (auto const decompressed : stream.decompress(bytes.subspan(offset, size), last)) {
+            r.append(decompressed);
+        }
+        offset += size;
+    } while (offset != bytes.size());
+
+    return r;
+}
+
+static void decompress_all(hi::inflate_stream& stream, std::span<std::byte const> bytes)
+{
+    for ([[maybe_unused]] auto const decompressed : stream.decompress(bytes, true)) {
+    }
+}
+
+TEST_CASE(gzip_chunks_test)
+{
+    auto const compressed = hi::file_view{hi::library_test_data_dir() / "gzip_test4.bin.gz"};
+    auto const compressed_bytes = as_span<std::byte const>(compressed);
+
+    auto const original = hi::file_view{hi::library_test_data_dir() / "gzip_test4.bin"};
+    auto const original_bytes = as_bstring_view(original);
+
+    for (auto const chunk_size : {std::size_t{1}, std::size_t{7}, std::size_t{4096}, compressed_bytes.size()}) {
+        auto const decompressed = decompress_in_chunks(compressed_bytes, chunk_size);
+        REQUIRE(decompressed == original_bytes);
+    }
+}
+
+TEST_CASE(deflate_test)
+{
+    // "hello world, hello world, hello world!" compressed with a fixed huffman block.
+    constexpr auto compressed = std::array<uint8_t, 19>{
+        0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x28, 0xcf, 0x2f, 0xca, 0x49, 0xd1, 0x51, 0xc8, 0xc0, 0xc1, 0x51, 0x04, 0x00};
+    auto const compressed_bytes = std::as_bytes(std::span{compressed});
+
+    auto stream = hi::inflate_stream{hi::inflate_format::deflate};
+    auto r = std::string{};
+    for (auto i = std::size_t{0}; i != compressed_bytes.size(); ++i) {
+        for (auto const decompressed : stream.decompress(compressed_bytes.subspan(i, 1), i + 1 == compressed_bytes.size())) {
+            for (auto const c : decompressed) {
+                r += static_cast<char>(c);
+            }
+        }
+    }
+
+    REQUIRE(stream.done());
+    REQUIRE(r == "hello world, hello world, hello world!");
+}
+
+TEST_CASE(truncated_test)
+{
+    constexpr auto compressed = std::array<uint8_t, 6>{0x4b, 0x4c, 0x1c, 0x05, 0xc4, 0x02};
+    auto const compressed_bytes = std::as_bytes(std::span{compressed});
+
+    auto stream = hi::inflate_stream{hi::inflate_format::deflate};
+    REQUIRE_THROWS(decompress_all(stream, compressed_bytes), hi::parse_error);
+}
+
+};
@@ -0,0 +1,169 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "inflate.hpp"
+#include "deflate.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+TEST_SUITE(inflate_suite) {
+
+template<std::size_t N>
+[[nodiscard]] static std::array<std::byte, N> make_bytes(std::array<uint8_t, N> const& values)
+{
+    auto r = std::array<std::byte, N>{};
+    for (auto i = std::size_t{0}; i != N; ++i) {
+        r[i] = static_cast<std::byte>(values[i]);
+    }
+    return r;
+}
+
+[[nodiscard]] static std::string to_string(hi::bstring const& bytes)
+{
+    auto r = std::string{};
+    for (auto const c : bytes) {
+        r += static_cast<char>(c);
+    }
+    return r;
+}
+
+TEST_CASE(stored_test)
+{
+    auto const bytes = make_bytes(std::array<uint8_t, 10>{0x01, 0x05, 0x00, 0xfa, 0xff, 0x68, 0x65, 0x6c, 0x6c, 0x6f});
+
+    auto offset = std::size_t{0};
+    REQUIRE(to_string(hi::inflate(bytes, offset)) == "hello");
+    REQUIRE(offset == bytes.size());
+}
+
+TEST_CASE(fixed_test)
+{
+    auto const bytes = make_bytes(std::array<uint8_t, 19>{
+        0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x28, 0xcf, 0x2f, 0xca, 0x49, 0xd1, 0x51, 0xc8, 0xc0, 0xc1, 0x51, 0x04, 0x00});
+
+    auto offset = std::size_t{0};
+    REQUIRE(to_string(hi::inflate(bytes, offset)) == "hello world, hello world, hello world!");
+    REQUIRE(offset == bytes.size());
+}
+
+TEST_CASE(dynamic_test)
+{
+    // zlib level 9, a single block with dynamic huffman codes.
+    auto const bytes = make_bytes(std::array<uint8_t, 252>{
+        0x85, 0xd6, 0xcd, 0x4d, 0x04, 0x31, 0x0c, 0x80, 0xd1, 0x56, 0x52, 0x00, 0x07, 0xec, 0x38, 0x3f,
+        0x5b, 0x0e, 0x2b, 0x0d, 0xe2, 0x30, 0x62, 0x24, 0x18, 0x89, 0xf6, 0xe9, 0x60, 0xdf, 0xf9, 0xbb,
+        0x3d, 0xc5, 0x76, 0x1e, 0x8f, 0xf6, 0xbc, 0xee, 0xfb, 0x3c, 0x7e, 0xdb, 0xf5, 0xd9, 0x9e, 0xc7,
+        0xf1, 0xd3, 0xae, 0xef, 0x76, 0x7f, 0x1d, 0xed, 0xef, 0xe3, 0x3c, 0xdf, 0xda, 0x63, 0xa3, 0x2f,
+        0xf4, 0x89, 0x3e, 0xd0, 0x0b, 0xbd, 0xa3, 0x27, 0x7a, 0xa0, 0xbf, 0xbf, 0xee, 0x1b, 0x7e, 0x1b,
+        0x7e, 0x1b, 0x7e, 0x1b, 0x7e, 0x1b, 0x7e, 0x1b, 0x7e, 0x1b, 0x7e, 0x1b, 0x7e, 0x1b, 0x7e, 0x1b,
+        0x7e, 0x0b, 0x7e, 0x0b, 0x7e, 0x0b, 0x7e, 0x0b, 0x7e, 0x0b, 0x7e, 0x0b, 0x7e, 0x0b, 0x7e, 0x0b,
+        0x7e, 0x0b, 0x7e, 0x0b, 0x7e, 0x13, 0x7e, 0x13, 0x7e, 0x13, 0x7e, 0x13, 0x7e, 0x13, 0x7e, 0x13,
+        0x7e, 0x13, 0x7e, 0x13, 0x7e, 0x13, 0x7e, 0x13, 0x7e, 0x03, 0x7e, 0x03, 0x7e, 0x03, 0x7e, 0x03,
+        0x7e, 0x03, 0x7e, 0x03, 0x7e, 0x03, 0x7e, 0x03, 0x7e, 0x03, 0x7e, 0x03, 0x7e, 0x05, 0xbf, 0x82,
+        0x5f, 0xc1, 0xaf, 0xe0, 0x57, 0xf0, 0x2b, 0xf8, 0x15, 0xfc, 0x0a, 0x7e, 0x05, 0xbf, 0x82, 0x5f,
+        0x87, 0x5f, 0x87, 0x5f, 0x87, 0x5f, 0x87, 0x5f, 0x87, 0x5f, 0x87, 0x5f, 0x87, 0x5f, 0x87, 0x5f,
+        0x87, 0x5f, 0x87, 0x5f, 0xc2, 0x2f, 0xe1, 0x97, 0xf0, 0x4b, 0xf8, 0x25, 0xfc, 0x12, 0x7e, 0x09,
+        0xbf, 0x84, 0x5f, 0xc2, 0x2f, 0xe1, 0x17, 0xf0, 0x0b, 0xf8, 0x05, 0xfc, 0x02, 0x7e, 0x01, 0xbf,
+        0x80, 0x5f, 0xc0, 0x2f, 0xe0, 0x17, 0xf0, 0x0b, 0xf8, 0xe9, 0xfb, 0x87, 0xeb, 0x8e, 0xe3, 0x85,
+        0xdd, 0x8c, 0xd5, 0x83, 0xc9, 0xc2, 0xc3, 0x81, 0xcb, 0xeb, 0xfc, 0x0f});
+
+    auto expected = std::string{};
+    for (auto i = 99; i != 0; --i) {
+        expected += std::to_string(i) + " bottles of beer on the wall, ";
+    }
+
+    auto offset = std::size_t{0};
+    REQUIRE(to_string(hi::inflate(bytes, offset)) == expected);
+    REQUIRE(offset == bytes.size());
+}
+
+TEST_CASE(long_codes_test)
+{
+    // A dynamic block with literal/length codes of up to 15 bits and distance codes of up to 10 bits.
+    // These are longer than the primary tables, so they are decoded through the sub-tables.
+    // The letters 'a' to 'm' have 1 to 13 bit codes; 'n', 'o', end-of-block and length 3 have 15 bit codes.
+    // The distance codes 0 to 8 have 1 to 9 bits; the distance codes 9 and 10 have 10 bits.
+    auto const bytes = make_bytes(std::array<uint8_t, 87>{
+        0x0d, 0xea, 0x51, 0x82, 0x24, 0xc7, 0xb2, 0x2c, 0xc1, 0xad, 0x55, 0xd4, 0x3c, 0xb2, 0x7a, 0x70,
+        0xee, 0x23, 0xf7, 0xff, 0x47, 0x8a, 0x9a, 0x47, 0x56, 0x0f, 0xa0, 0xdd, 0xfb, 0x7e, 0x7f, 0xff,
+        0xfe, 0xfb, 0xdf, 0xff, 0xfd, 0xbf, 0xff, 0xcf, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xf9, 0x7f, 0xff,
+        0xf7, 0xbf, 0xff, 0xfe, 0xfd, 0xfd, 0xbe, 0x77, 0x8b, 0x76, 0xef, 0xfb, 0xfd, 0xfd, 0xfb, 0xef,
+        0x7f, 0xff, 0xf7, 0xff, 0xfe, 0x3f, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff,
+        0xff, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0x03});
+
+    auto offset = std::size_t{0};
+    REQUIRE(to_string(hi::inflate(bytes, offset)) == "abcdefghijklmnoonmlkjihgfedcbaabcdefghijklmnomnogfegfeeee");
+    REQUIRE(offset == bytes.size());
+}
+
+[[nodiscard]] static hi::bstring make_skewed(uint32_t seed)
+{
+    // Symbol i occurs fibonacci(i) times; the rare symbols get huffman codes longer than the primary table.
+    auto r = hi::bstring{};
+    auto count = std::pair<std::size_t, std::size_t>{1, 1};
+    for (auto i = 0; i != 22; ++i) {
+        r.append(count.first, static_cast<std::byte>('A' + i));
+        count = {count.second, count.first + count.second};
+    }
+
+    for (auto i = r.size() - 1; i != 0; --i) {
+        seed = seed * 1664525 + 1013904223;
+        std::swap(r[i], r[seed % (i + 1)]);
+    }
+    return r;
+}
+
+TEST_CASE(dynamic_round_trip_test)
+{
+    auto const input = make_skewed(1);
+
+    for (auto level = 1; level <= 9; ++level) {
+        auto const compressed = hi::deflate(input, level);
+        // The first block uses dynamic huffman codes.
+        REQUIRE(((std::to_integer<int>(compressed[0]) >> 1) & 3) == 2);
+
+        auto offset = std::size_t{0};
+        REQUIRE(hi::inflate(compressed, offset, input.size()) == input);
+        REQUIRE(offset == compressed.size());
+    }
+}
+
+TEST_CASE(overlapping_match_test)
+{
+    // A match with distance 1.
+    auto const run = make_bytes(std::array<uint8_t, 7>{0x4b, 0x4c, 0x1c, 0x05, 0xc4, 0x02, 0x00});
+    auto offset = std::size_t{0};
+    REQUIRE(to_string(hi::inflate(run, offset)) == std::string(300, 'a'));
+
+    // A match with distance 3.
+    auto const pattern = make_bytes(std::array<uint8_t, 9>{0x4b, 0x4c, 0x4a, 0x4e, 0x1c, 0x45, 0xc4, 0x21, 0x00});
+    auto expected = std::string{};
+    for (auto i = 0; i != 100; ++i) {
+        expected += "abc";
+    }
+    offset = 0;
+    REQUIRE(to_string(hi::inflate(pattern, offset)) == expected);
+}
+
+TEST_CASE(truncated_test)
+{
+    auto const bytes = make_bytes(std::array<uint8_t, 6>{0x4b, 0x4c, 0x1c, 0x05, 0xc4, 0x02});
+
+    auto offset = std::size_t{0};
+    REQUIRE_THROWS(hi::inflate(bytes, offset), hi::parse_error);
+}
+
+TEST_CASE(max_size_test)
+{
+    auto const bytes = make_bytes(std::array<uint8_t, 7>{0x4b, 0x4c, 0x1c, 0x05, 0xc4, 0x02, 0x00});
+
+    auto offset = std::size_t{0};
+    REQUIRE_THROWS(hi::inflate(bytes, offset, 299), hi::parse_error);
+}
+
+};
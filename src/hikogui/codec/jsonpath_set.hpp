@@ -0,0 +1,382 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/jsonpath_set.hpp Evaluate many json-paths in a single traversal.
+ */
+
+#pragma once
+
+#include "jsonpath.hpp"
+#include "datum.hpp"
+#include "JSON_view.hpp"
+#include "BON8_view.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <variant>
+#include <algorithm>
+#include <initializer_list>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.jsonpath_set);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A set of json-paths compiled into a single automaton.
+ *
+ * The paths are compiled in a flat list of steps, each path ending in an
+ * accepting step. While traversing a document the automaton keeps the set of
+ * active steps for each value; the children of a value are only visited when
+ * at least one path can still match inside of it.
+ *
+ * Unlike `datum::find()`, which traverses the document once for each path, all
+ * paths are evaluated in a single depth-first traversal. Matches are passed
+ * to a callback in document order, each value is reported at most once for each path.
+ */
+class jsonpath_set {
+public:
+    constexpr jsonpath_set() noexcept = default;
+    jsonpath_set(jsonpath_set const&) = default;
+    jsonpath_set(jsonpath_set&&) noexcept = default;
+    jsonpath_set& operator=(jsonpath_set const&) = default;
+    jsonpath_set& operator=(jsonpath_set&&) noexcept = default;
+
+    jsonpath_set(std::initializer_list<jsonpath> paths)
+    {
+        for (auto const& path : paths) {
+            add(path);
+        }
+    }
+
+    /** The number of paths in the set.
+     */
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /** Add a path to the set.
+     *
+     * @param path The json-path to add.
+     * @return The index of the path, which is passed to the callback of `find()`.
+     */
+    std::size_t add(jsonpath const& path)
+    {
+        auto const index = _size++;
+
+        _starts.push_back(_steps.size());
+        for (auto const& node : path) {
+            if (auto wildcard = std::get_if<jsonpath::wildcard>(&node)) {
+                _steps.emplace_back(*wildcard);
+            } else if (auto descend = std::get_if<jsonpath::descend>(&node)) {
+                _steps.emplace_back(*descend);
+            } else if (auto names = std::get_if<jsonpath::names>(&node)) {
+                _steps.emplace_back(*names);
+            } else if (auto indices = std::get_if<jsonpath::indices>(&node)) {
+                _steps.emplace_back(*indices);
+            } else if (auto slice = std::get_if<jsonpath::slice>(&node)) {
+                _steps.emplace_back(*slice);
+            } else {
+                // The root '$' and current '@' nodes only appear at the start of a path.
+                hi_axiom(std::holds_alternative<jsonpath::root>(node) or std::holds_alternative<jsonpath::current>(node));
+            }
+        }
+        _steps.emplace_back(accept{index});
+        return index;
+    }
+
+    /** Find the values matching the paths.
+     *
+     * @param root The document to search.
+     * @param func The callback `void(std::size_t index, datum& value)`, called
+     *             with the index of the path and a value matching that path.
+     */
+    template<typename Func>
+    void find(datum& root, Func&& func) const
+    {
+        find_root(root, func);
+    }
+
+    /** Find the values matching the paths.
+     *
+     * @param root The document to search.
+     * @param func The callback `void(std::size_t index, datum const& value)`, called
+     *             with the index of the path and a value matching that path.
+     */
+    template<typename Func>
+    void find(datum const& root, Func&& func) const
+    {
+        find_root(root, func);
+    }
+
+    /** Find the values matching the paths.
+     *
+     * @param root The document to search.
+     * @param func The callback `void(std::size_t index, json_view value)`, called
+     *             with the index of the path and a value matching that path.
+     * @throw parse_error When the JSON text is invalid.
+     */
+    template<typename Func>
+    void find(json_view const& root, Func&& func) const
+    {
+        find_root(root, func);
+    }
+
+    /** Find the values matching the paths.
+     *
+     * @param root The document to search.
+     * @param func The callback `void(std::size_t index, BON8_view value)`, called
+     *             with the index of the path and a value matching that path.
+     * @throw parse_error When the BON8 message is invalid.
+     */
+    template<typename Func>
+    void find(BON8_view const& root, Func&& func) const
+    {
+        find_root(root, func);
+    }
+
+private:
+    /** The last step of a path, the value matches the path.
+     */
+    struct accept {
+        std::size_t index;
+    };
+
+    using step_type = std::variant<accept, jsonpath::wildcard, jsonpath::descend, jsonpath::names, jsonpath::indices, jsonpath::slice>;
+
+    /** The active steps for each depth of the traversal.
+     *
+     * A deque is used so that references to the states of a depth remain valid
+     * while deeper levels are added.
+     */
+    using stack_type = std::deque<std::vector<std::size_t>>;
+
+    std::vector<step_type> _steps = {};
+    std::vector<std::size_t> _starts = {};
+    std::size_t _size = 0;
+
+    template<typename Value, typename Func>
+    void find_root(Value& root, Func& func) const
+    {
+        if (empty()) {
+            return;
+        }
+
+        auto stack = stack_type{};
+        stack.emplace_back(_starts);
+        find(root, stack, 0, func);
+    }
+
+    template<typename Value, typename Func>
+    void find(Value& value, stack_type& stack, std::size_t depth, Func& func) const
+    {
+        auto& states = stack[depth];
+
+        // A descend step also matches at the value itself.
+        for (auto i = 0_uz; i != states.size(); ++i) {
+            if (std::holds_alternative<jsonpath::descend>(_steps[states[i]])) {
+                states.push_back(states[i] + 1);
+            }
+        }
+        std::sort(states.begin(), states.end());
+        states.erase(std::unique(states.begin(), states.end()), states.end());
+
+        auto has_children = false;
+        auto needs_size = false;
+        for (auto const state : states) {
+            auto const& step = _steps[state];
+            if (auto accept_ = std::get_if<accept>(&step)) {
+                func(accept_->index, value);
+            } else {
+                has_children = true;
+                needs_size |= step_needs_size(step);
+            }
+        }
+
+        if (not has_children) {
+            return;
+        }
+
+        if (stack.size() == depth + 1) {
+            stack.emplace_back();
+        }
+        auto& next = stack[depth + 1];
+
+        for_each_child(
+            value,
+            needs_size,
+            [&](std::size_t index, std::size_t size, auto& item) {
+                next.clear();
+                for (auto const state : states) {
+                    advance_item(state, index, size, next);
+                }
+                if (not next.empty()) {
+                    find(item, stack, depth + 1, func);
+                }
+            },
+            [&](auto const& key, auto& item) {
+                next.clear();
+                for (auto const state : states) {
+                    advance_member(state, key, next);
+                }
+                if (not next.empty()) {
+                    find(item, stack, depth + 1, func);
+                }
+            });
+    }
+
+    /** Check if a step needs the size of an array to select an item.
+     */
+    [[nodiscard]] static bool step_needs_size(step_type const& step) noexcept
+    {
+        if (auto indices = std::get_if<jsonpath::indices>(&step)) {
+            return std::ranges::any_of(*indices, [](auto index) {
+                return index < 0;
+            });
+        }
+        return std::holds_alternative<jsonpath::slice>(step);
+    }
+
+    [[nodiscard]] static bool slice_contains(jsonpath::slice const& slice, std::size_t index, std::size_t size) noexcept
+    {
+        if (slice.step == 0 or index >= size) {
+            return false;
+        }
+
+        auto const first = narrow_cast<ptrdiff_t>(slice.begin(size));
+        auto const last = narrow_cast<ptrdiff_t>(slice.end(size));
+        auto const index_ = narrow_cast<ptrdiff_t>(index);
+        if (slice.step > 0) {
+            return index_ >= first and index_ < last and (index_ - first) % slice.step == 0;
+        } else {
+            return index_ <= first and index_ > last and (first - index_) % slice.step == 0;
+        }
+    }
+
+    void advance_item(std::size_t state, std::size_t index, std::size_t size, std::vector<std::size_t>& next) const
+    {
+        auto const& step = _steps[state];
+        if (std::holds_alternative<jsonpath::wildcard>(step)) {
+            next.push_back(state + 1);
+
+        } else if (std::holds_alternative<jsonpath::descend>(step)) {
+            next.push_back(state);
+
+        } else if (auto indices = std::get_if<jsonpath::indices>(&step)) {
+            auto const index_ = narrow_cast<ptrdiff_t>(index);
+            auto const size_ = narrow_cast<ptrdiff_t>(size);
+            if (std::ranges::any_of(*indices, [&](auto i) {
+                    return (i >= 0 ? i : size_ + i) == index_;
+                })) {
+                next.push_back(state + 1);
+            }
+
+        } else if (auto slice = std::get_if<jsonpath::slice>(&step)) {
+            if (slice_contains(*slice, index, size)) {
+                next.push_back(state + 1);
+            }
+        }
+    }
+
+    template<typename Key>
+    void advance_member(std::size_t state, Key const& key, std::vector<std::size_t>& next) const
+    {
+        auto const& step = _steps[state];
+        if (std::holds_alternative<jsonpath::wildcard>(step)) {
+            next.push_back(state + 1);
+
+        } else if (std::holds_alternative<jsonpath::descend>(step)) {
+            next.push_back(state);
+
+        } else if (auto names = std::get_if<jsonpath::names>(&step)) {
+            if (std::ranges::any_of(*names, [&](auto const& name) {
+                    return key_equal(key, name);
+                })) {
+                next.push_back(state + 1);
+            }
+        }
+    }
+
+    [[nodiscard]] static bool key_equal(datum const& key, std::string const& name) noexcept
+    {
+        if (auto key_ = get_if<std::string>(key)) {
+            return *key_ == name;
+        }
+        return false;
+    }
+
+    [[nodiscard]] static bool key_equal(json_view const& key, std::string const& name)
+    {
+        return key.string_equal(name);
+    }
+
+    [[nodiscard]] static bool key_equal(std::string_view key, std::string const& name) noexcept
+    {
+        return key == name;
+    }
+
+    template<typename Value, typename ItemFunc, typename MemberFunc>
+    static void for_each_child(Value& value, bool, ItemFunc const& item_func, MemberFunc const& member_func)
+        requires(std::same_as<std::remove_const_t<Value>, datum>)
+    {
+        if (auto vector = get_if<datum::vector_type>(value)) {
+            auto const size = vector->size();
+            for (auto i = 0_uz; i != size; ++i) {
+                item_func(i, size, (*vector)[i]);
+            }
+
+        } else if (auto map = get_if<datum::map_type>(value)) {
+            for (auto& item : *map) {
+                member_func(item.first, item.second);
+            }
+        }
+    }
+
+    template<typename ItemFunc, typename MemberFunc>
+    static void for_each_child(json_view const& value, bool needs_size, ItemFunc const& item_func, MemberFunc const& member_func)
+    {
+        if (value.is_array()) {
+            // Counting the items is cheap after the first pass, the end of each item is remembered.
+            auto const size = needs_size ? value.size() : 0_uz;
+            auto i = 0_uz;
+            value.for_each_item([&](json_view item) {
+                item_func(i++, size, item);
+                return true;
+            });
+
+        } else if (value.is_object()) {
+            value.for_each_member([&](json_view key, json_view item) {
+                member_func(key, item);
+                return true;
+            });
+        }
+    }
+
+    template<typename ItemFunc, typename MemberFunc>
+    static void for_each_child(BON8_view const& value, bool needs_size, ItemFunc const& item_func, MemberFunc const& member_func)
+    {
+        if (value.is_array()) {
+            auto const size = needs_size ? value.size() : 0_uz;
+            auto i = 0_uz;
+            for (auto item : value.items()) {
+                item_func(i++, size, item);
+            }
+
+        } else if (value.is_object()) {
+            for (auto [key, item] : value.members()) {
+                member_func(key, item);
+            }
+        }
+    }
+};
+
+}} // namespace hi::v1
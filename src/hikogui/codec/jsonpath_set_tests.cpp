@@ -0,0 +1,153 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "jsonpath_set.hpp"
+#include "JSON.hpp"
+#include "BON8.hpp"
+#include "../utility/utility.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+
+using hi::operator""_uz;
+
+TEST_SUITE(jsonpath_set_suite) {
+
+constexpr static auto store_text = std::string_view{
+    "{\n"
+    "  \"store\": {\n"
+    "    \"book\": [\n"
+    "      {\"author\": \"Nigel Rees\", \"price\": 8.95},\n"
+    "      {\"author\": \"Evelyn Waugh\", \"price\": 12.99},\n"
+    "      {\"author\": \"Herman Melville\", \"price\": 8}\n"
+    "    ],\n"
+    "    \"bicycle\": {\"color\": \"red\", \"price\": 19.95}\n"
+    "  },\n"
+    "  \"empty\": []\n"
+    "}\n"};
+
+[[nodiscard]] static hi::jsonpath_set make_paths()
+{
+    return hi::jsonpath_set{
+        "$.store.book[*].author",
+        "$..price",
+        "$.store.book[-1].author",
+        "$.store.book[:2].price",
+        "$.store.car",
+        "$.store.bicycle",
+        "$.store['bicycle','empty'].*",
+        "$"};
+}
+
+/** The expected values when finding the paths, as JSON text.
+ */
+[[nodiscard]] static std::vector<std::vector<std::string>> expected_values()
+{
+    return {
+        {"\"Nigel Rees\"", "\"Evelyn Waugh\"", "\"Herman Melville\""},
+        {"8.95", "12.99", "8", "19.95"},
+        {"\"Herman Melville\""},
+        {"8.95", "12.99"},
+        {},
+        {"{\"color\": \"red\", \"price\": 19.95}"},
+        {"\"red\"", "19.95"},
+        {"root"}};
+}
+
+TEST_CASE(datum)
+{
+    auto const paths = make_paths();
+    REQUIRE(paths.size() == 8);
+
+    auto const document = hi::parse_JSON(store_text);
+
+    auto found = std::vector<std::vector<hi::datum>>(paths.size());
+    paths.find(document, [&](std::size_t index, hi::datum const& value) {
+        found[index].push_back(value);
+    });
+
+    // Each path should find the same values as datum::find().
+    auto const expected = std::vector<std::string_view>{
+        "$.store.book[*].author",
+        "$..price",
+        "$.store.book[-1].author",
+        "$.store.book[:2].price",
+        "$.store.car",
+        "$.store.bicycle",
+        "$.store['bicycle','empty'].*",
+        "$"};
+    for (auto i = 0_uz; i != expected.size(); ++i) {
+        auto expected_values = std::vector<hi::datum>{};
+        for (auto const *value : document.find(hi::jsonpath{expected[i]})) {
+            expected_values.push_back(*value);
+        }
+        // datum::find() reports the members of an object before the values found deeper inside.
+        std::sort(found[i].begin(), found[i].end());
+        std::sort(expected_values.begin(), expected_values.end());
+        REQUIRE(found[i] == expected_values);
+    }
+}
+
+TEST_CASE(json_view)
+{
+    auto const paths = make_paths();
+    auto const document = hi::json_document{store_text};
+
+    auto found = std::vector<std::vector<std::string>>(paths.size());
+    paths.find(document.root(), [&](std::size_t index, hi::json_view value) {
+        found[index].push_back(index == 7 ? std::string{"root"} : std::string{value.raw()});
+    });
+
+    REQUIRE(found == expected_values());
+}
+
+TEST_CASE(BON8_view)
+{
+    auto const paths = make_paths();
+    auto const message = hi::encode_BON8(hi::parse_JSON(store_text));
+    auto const root = hi::decode_BON8_view(message);
+
+    auto num_found = std::vector<std::size_t>(paths.size());
+    auto authors = std::vector<std::string>{};
+    paths.find(root, [&](std::size_t index, hi::BON8_view value) {
+        ++num_found[index];
+        if (index == 0) {
+            authors.emplace_back(value.string());
+        }
+    });
+
+    REQUIRE(num_found == (std::vector<std::size_t>{3, 4, 1, 2, 0, 1, 2, 1}));
+    REQUIRE(authors == (std::vector<std::string>{"Nigel Rees", "Evelyn Waugh", "Herman Melville"}));
+}
+
+TEST_CASE(descend_is_reported_once)
+{
+    auto const paths = hi::jsonpath_set{"$..a", "$..*.a"};
+    auto const document = hi::json_document{"{\"a\": {\"a\": 1}, \"b\": [{\"a\": 2}]}"};
+
+    auto found = std::vector<std::vector<std::string>>(paths.size());
+    paths.find(document.root(), [&](std::size_t index, hi::json_view value) {
+        found[index].emplace_back(value.raw());
+    });
+
+    REQUIRE(found[0] == std::vector<std::string>{"{\"a\": 1}", "1", "2"});
+    REQUIRE(found[1] == (std::vector<std::string>{"1", "2"}));
+}
+
+TEST_CASE(empty)
+{
+    auto const paths = hi::jsonpath_set{};
+    REQUIRE(paths.empty());
+
+    auto const document = hi::parse_JSON(store_text);
+    auto count = 0;
+    paths.find(document, [&](std::size_t, hi::datum const&) {
+        ++count;
+    });
+    REQUIRE(count == 0);
+}
+
+};
@@ -53,7 +53,7 @@ struct pickle {
     [[nodiscard]] T decode(datum rhs) const
         requires(std::has_unique_object_representations_v<T> and not std::is_pointer_v<T>)
     {
-        if (auto *b = get_if<std::string>(rhs)) {
+        if (auto b = get_if<std::string>(rhs)) {
             auto tmp = base64::decode(*b);
             if (tmp.size() != sizeof(T)) {
                 throw parse_error(
@@ -138,8 +138,8 @@ struct pickle<std::string> {
 
     [[nodiscard]] std::string decode(datum rhs) const
     {
-        if (auto *b = get_if<std::string>(rhs)) {
-            return *b;
+        if (auto b = get_if<std::string>(rhs)) {
+            return std::string{*b};
 
         } else {
             throw parse_error(std::format("Expecting std::string to be encoded as a string, got {}", rhs));
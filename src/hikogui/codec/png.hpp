@@ -12,6 +12,7 @@
 #include "../parser/parser.hpp"
 #include "../macros.hpp"
 #include "zlib.hpp"
+#include "png_unfilter.hpp"
 #include <span>
 #include <vector>
 #include <cstddef>
@@ -19,6 +20,11 @@
 #include <numeric>
 #include <filesystem>
 #include <memory>
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <array>
+#include <cstring>
 
 hi_export_module(hikogui.codec.png);
 
@@ -37,6 +43,18 @@ public:
 
     [[nodiscard]] png(std::filesystem::path const& path) : png(file_view{path}) {}
 
+    /** Parse a PNG image that is already in memory.
+     *
+     * @param bytes The PNG encoded image, the bytes must outlive this object.
+     */
+    [[nodiscard]] png(std::span<std::byte const> bytes)
+    {
+        std::size_t offset = 0;
+
+        read_header(bytes, offset);
+        read_chunks(bytes, offset);
+    }
+
     [[nodiscard]] std::size_t width() const noexcept
     {
         return _width;
@@ -48,6 +66,16 @@ public:
     }
 
     void decode_image(pixmap_span<sfloat_rgba16> image) const
+    {
+        auto const image_data = decode_lines();
+        decode_rows(image_data, 0, image);
+    }
+
+    /** Decompress and unfilter the image data.
+     *
+     * @return The image data in the order of the file, with a filter selection byte in front of every line.
+     */
+    [[nodiscard]] bstring decode_lines() const
     {
         // There is a filter selection byte in front of every line.
         auto const image_data_size = _stride * _height;
@@ -56,8 +84,46 @@ public:
         hi_check(ssize(image_data) == image_data_size, "Uncompressed image data has incorrect size.");
 
         unfilter_lines(image_data);
+        return image_data;
+    }
+
+    /** Convert a band of rows of the image data into pixels.
+     *
+     * The rows are converted on multiple threads.
+     *
+     * @param image_data The image data returned by `decode_lines()`.
+     * @param first_row The row of the image, counted from the bottom, that is written into the first row of @a image.
+     * @param image The pixels to write, the width must be the width of the png.
+     */
+    void decode_rows(bstring_view image_data, std::size_t first_row, pixmap_span<sfloat_rgba16> image) const
+    {
+        hi_assert(image_data.size() == narrow_cast<std::size_t>(_stride * _height));
+        hi_assert(image.width() == narrow_cast<std::size_t>(_width));
+        hi_assert(first_row + image.height() <= narrow_cast<std::size_t>(_height));
+
+        // Each thread should convert enough rows to make the overhead of starting a thread worth it.
+        constexpr auto min_rows_per_band = 64_uz;
+        auto const max_num_bands = std::max(1_uz, std::size_t{std::thread::hardware_concurrency()});
+        auto const num_bands = std::clamp(image.height() / min_rows_per_band, 1_uz, max_num_bands);
+        if (num_bands == 1) {
+            return data_to_image(image_data, first_row, image);
+        }
+
+        auto futures = std::vector<std::future<void>>{};
+        futures.reserve(num_bands);
+        for (auto i = 0_uz; i != num_bands; ++i) {
+            auto const band_first = i * image.height() / num_bands;
+            auto const band_last = (i + 1) * image.height() / num_bands;
+            auto const band = image.subimage(0, band_first, image.width(), band_last - band_first);
 
-        data_to_image(image_data, image);
+            futures.push_back(std::async(std::launch::async, [this, image_data, first_row, band_first, band] {
+                data_to_image(image_data, first_row + band_first, band);
+            }));
+        }
+
+        for (auto& future : futures) {
+            future.get();
+        }
     }
 
     [[nodiscard]] static pixmap<sfloat_rgba16> load(std::filesystem::path const& path)
@@ -68,6 +134,14 @@ public:
         return image;
     }
 
+    [[nodiscard]] static pixmap<sfloat_rgba16> load(std::span<std::byte const> bytes)
+    {
+        auto const png_data = png(bytes);
+        auto image = pixmap<sfloat_rgba16>{png_data.width(), png_data.height()};
+        png_data.decode_image(image);
+        return image;
+    }
+
 private:
     struct PNGHeader {
         uint8_t signature[8];
@@ -156,26 +230,6 @@ private:
         throw parse_error("string is not null terminated.");
     }
 
-    static uint8_t paeth_predictor(uint8_t _a, uint8_t _b, uint8_t _c) noexcept
-    {
-        auto const a = static_cast<int>(_a);
-        auto const b = static_cast<int>(_b);
-        auto const c = static_cast<int>(_c);
-
-        auto const p = a + b - c;
-        auto const pa = std::abs(p - a);
-        auto const pb = std::abs(p - b);
-        auto const pc = std::abs(p - c);
-
-        if (pa <= pb && pa <= pc) {
-            return narrow_cast<uint8_t>(a);
-        } else if (pb <= pc) {
-            return narrow_cast<uint8_t>(b);
-        } else {
-            return narrow_cast<uint8_t>(c);
-        }
-    }
-
     static uint16_t get_sample(std::span<std::byte const> bytes, ssize_t& offset, bool two_bytes)
     {
         uint16_t value = static_cast<uint8_t>(bytes[offset++]);
@@ -428,94 +482,95 @@ private:
 
     void unfilter_line(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const
     {
+        auto const bytes_per_pixel = narrow_cast<std::size_t>(_bytes_per_pixel);
+        auto const bytes = line.subspan(1, _bytes_per_line);
+
         switch (line[0]) {
         case 0:
             return;
         case 1:
-            return unfilter_line_sub(line.subspan(1, _bytes_per_line), prev_line);
+            return png_unfilter_sub(bytes, bytes_per_pixel);
         case 2:
-            return unfilter_line_up(line.subspan(1, _bytes_per_line), prev_line);
+            return png_unfilter_up(bytes, prev_line);
         case 3:
-            return unfilter_line_average(line.subspan(1, _bytes_per_line), prev_line);
+            return png_unfilter_average(bytes, prev_line, bytes_per_pixel);
         case 4:
-            return unfilter_line_paeth(line.subspan(1, _bytes_per_line), prev_line);
+            return png_unfilter_paeth(bytes, prev_line, bytes_per_pixel);
         default:
             throw parse_error("Unknown line-filter type");
         }
     }
 
-    void unfilter_line_sub(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+    void data_to_image(bstring_view bytes, std::size_t first_row, pixmap_span<sfloat_rgba16> image) const noexcept
     {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            auto const j = i - _bytes_per_pixel;
+        auto const bytes_span = std::span(bytes.data(), bytes.size());
 
-            uint8_t prev_raw = j >= 0 ? line[j] : 0;
-            line[i] += prev_raw;
-        }
-    }
+        for (auto y = 0_uz; y != image.height(); ++y) {
+            auto const inv_y = narrow_cast<std::size_t>(_height) - (first_row + y) - 1;
 
-    void unfilter_line_up(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
-    {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            line[i] += prev_line[i];
+            auto bytes_line = bytes_span.subspan(inv_y * narrow_cast<std::size_t>(_stride) + 1, _bytes_per_line);
+            auto pixel_line = image[y];
+            data_to_image_line(bytes_line, pixel_line);
         }
     }
 
-    void unfilter_line_average(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+    void data_to_image_line(std::span<std::byte const> bytes, std::span<sfloat_rgba16> line) const noexcept
     {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            auto const j = i - _bytes_per_pixel;
+        static_assert(sizeof(sfloat_rgba16) == 4 * sizeof(uint16_t));
 
-            uint8_t prev_raw = j >= 0 ? line[j] : 0;
-            line[i] += (prev_raw + prev_line[i]) / 2;
-        }
-    }
+        // The pixels are converted in chunks, so that the conversion to half-float is done on many values at once.
+        constexpr auto chunk_size = 64_uz;
+        auto linear = std::array<float, chunk_size * 4>{};
+        auto halfs = std::array<uint16_t, chunk_size * 4>{};
 
-    void unfilter_line_paeth(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
-    {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            auto const j = i - _bytes_per_pixel;
+        for (auto x = 0_uz; x < line.size(); x += chunk_size) {
+            auto const size = std::min(chunk_size, line.size() - x);
+            if (_bit_depth == 16) {
+                data_to_linear<true>(bytes, x, size, linear);
+            } else {
+                data_to_linear<false>(bytes, x, size, linear);
+            }
 
-            uint8_t const up = prev_line[i];
-            uint8_t const left = j >= 0 ? line[j] : 0;
-            uint8_t const left_up = j >= 0 ? prev_line[j] : 0;
-            line[i] += paeth_predictor(left, up, left_up);
+            float_to_half(linear.data(), halfs.data(), size * 4);
+            std::memcpy(line.data() + x, halfs.data(), size * sizeof(sfloat_rgba16));
         }
     }
 
-    void data_to_image(bstring bytes, pixmap_span<sfloat_rgba16> image) const noexcept
+    /** Convert pixels to linear, pre-multiplied, sRGB floating point values.
+     *
+     * @tparam TwoBytes The samples are 16 bits.
+     * @param bytes The bytes of the line.
+     * @param first The index of the first pixel to convert.
+     * @param size The number of pixels to convert.
+     * @param[out] linear The red, green, blue, alpha values of each pixel.
+     */
+    template<bool TwoBytes>
+    void data_to_linear(std::span<std::byte const> bytes, std::size_t first, std::size_t size, std::span<float> linear)
+        const noexcept
     {
-        auto bytes_span = std::span(bytes);
+        hi_axiom(size * 4 <= linear.size());
 
-        for (int y = 0; y != _height; ++y) {
-            int inv_y = _height - y - 1;
-
-            auto bytes_line = bytes_span.subspan(inv_y * _stride + 1, _bytes_per_line);
-            auto pixel_line = image[y];
-            data_to_image_line(bytes_line, pixel_line);
-        }
-    }
-
-    void data_to_image_line(std::span<std::byte const> bytes, std::span<sfloat_rgba16> line) const noexcept
-    {
-        auto const alpha_mul = _bit_depth == 16 ? 1.0f / 65535.0f : 1.0f / 255.0f;
-        for (int x = 0; x != _width; ++x) {
-            auto const value = extract_pixel_from_line(bytes, x);
+        constexpr auto alpha_mul = TwoBytes ? 1.0f / 65535.0f : 1.0f / 255.0f;
+        for (auto i = 0_uz; i != size; ++i) {
+            auto const value = extract_pixel_from_line<TwoBytes>(bytes, first + i);
 
             auto const linear_RGB =
                 f32x4{_transfer_function[value.x()], _transfer_function[value.y()], _transfer_function[value.z()], 1.0f};
-
-            auto const linear_sRGB_color = _color_to_sRGB * linear_RGB;
             auto const alpha = static_cast<float>(value.w()) * alpha_mul;
 
-            // pre-multiply the alpha for use in texture-maps.
-            line[x] = linear_sRGB_color * f32x4::broadcast(alpha);
+            // pre-multiply the alpha for use in texture-maps. This can be done
+            // before the color conversion, since the conversion is linear.
+            auto const pixel = static_cast<std::array<float, 4>>(linear_RGB * f32x4::broadcast(alpha));
+            std::memcpy(linear.data() + i * 4, pixel.data(), sizeof(pixel));
         }
+
+        color_transform(_color_to_sRGB, linear.first(size * 4));
     }
 
-    u16x4 extract_pixel_from_line(std::span<std::byte const> bytes, int x) const noexcept
+    template<bool TwoBytes>
+    u16x4 extract_pixel_from_line(std::span<std::byte const> bytes, std::size_t x) const noexcept
     {
-        hi_axiom(_bit_depth == 8 or _bit_depth == 16);
+        hi_axiom(_bit_depth == (TwoBytes ? 16 : 8));
         hi_axiom(not _is_palletted);
 
         uint16_t r = 0;
@@ -525,16 +580,16 @@ private:
 
         ssize_t offset = x * _bytes_per_pixel;
         if (_is_color) {
-            r = get_sample(bytes, offset, _bit_depth == 16);
-            g = get_sample(bytes, offset, _bit_depth == 16);
-            b = get_sample(bytes, offset, _bit_depth == 16);
+            r = get_sample(bytes, offset, TwoBytes);
+            g = get_sample(bytes, offset, TwoBytes);
+            b = get_sample(bytes, offset, TwoBytes);
         } else {
-            r = g = b = get_sample(bytes, offset, _bit_depth == 16);
+            r = g = b = get_sample(bytes, offset, TwoBytes);
         }
         if (_has_alpha) {
-            a = get_sample(bytes, offset, _bit_depth == 16);
+            a = get_sample(bytes, offset, TwoBytes);
         } else {
-            a = (_bit_depth == 16) ? 65535 : 255;
+            a = TwoBytes ? 65535 : 255;
         }
 
         return u16x4{r, g, b, a};
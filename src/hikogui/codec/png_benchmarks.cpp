@@ -0,0 +1,28 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "png.hpp"
+#include "../file/file.hpp"
+#include "../image/image.hpp"
+#include "../path/path.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <filesystem>
+
+hi_benchmark(png_decode)
+{
+    auto const path = hi::library_source_dir() / "docs" / "media" / "hikogui-logo" / "Logo.png";
+    if (not std::filesystem::exists(path)) {
+        return state.skip("The logo image is not available.");
+    }
+
+    // Decoding includes the decompression of the image data and the unfiltering and conversion of the rows.
+    auto const png = hi::png{hi::file_view{path}};
+    auto image = hi::pixmap<hi::sfloat_rgba16>{png.width(), png.height()};
+
+    state.set_items_per_iteration(png.width() * png.height());
+    while (state.running()) {
+        png.decode_image(image);
+        hi::do_not_optimize(image);
+    }
+}
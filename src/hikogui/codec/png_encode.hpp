@@ -0,0 +1,391 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/png_encode.hpp Encode images in the PNG format.
+ *
+ * Images are encoded as 8 bit sRGB with straight alpha. Converting and
+ * filtering the lines is done in bands of rows in parallel, and the filtered
+ * lines are compressed in independent chunks in parallel, see `deflate()`.
+ */
+
+#pragma once
+
+#include "../file/file.hpp"
+#include "../utility/utility.hpp"
+#include "../image/image.hpp"
+#include "../color/color.hpp"
+#include "../container/container.hpp"
+#include "../macros.hpp"
+#include "zlib.hpp"
+#include "png_unfilter.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <span>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.png_encode);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** The line-filter used when encoding a PNG image.
+ */
+enum class png_filter : uint8_t {
+    none = 0,
+    sub = 1,
+    up = 2,
+    average = 3,
+    paeth = 4,
+
+    /** Select the filter for each line, with the smallest sum of the absolute filtered values.
+     */
+    adaptive = 5,
+};
+
+struct png_encode_options {
+    /** The compression level, 0 (stored) to 9 (best compression).
+     */
+    int level = 6;
+
+    png_filter filter = png_filter::adaptive;
+
+    /** The number of bytes of filtered image data that are compressed independently, in parallel.
+     */
+    std::size_t chunk_size = 0x2'0000;
+};
+
+namespace detail {
+
+constexpr auto png_crc32_table = [] {
+    auto r = std::array<uint32_t, 256>{};
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        auto c = narrow_cast<uint32_t>(i);
+        for (auto j = 0; j != 8; ++j) {
+            c = (c & 1) ? 0xedb8'8320 ^ (c >> 1) : c >> 1;
+        }
+        r[i] = c;
+    }
+    return r;
+}();
+
+/** Calculate the CRC-32 of the type and data of a PNG chunk.
+ *
+ * @param bytes The data.
+ * @param crc The CRC of the data before @a bytes.
+ * @return The CRC.
+ */
+[[nodiscard]] constexpr uint32_t png_crc32(std::span<std::byte const> bytes, uint32_t crc = 0) noexcept
+{
+    crc = ~crc;
+    for (auto const c : bytes) {
+        crc = png_crc32_table[(crc ^ std::to_integer<uint32_t>(c)) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+inline void png_put_big_uint32(bstring& r, uint32_t value)
+{
+    for (auto i = 4_uz; i != 0; --i) {
+        r.push_back(static_cast<std::byte>((value >> ((i - 1) * 8)) & 0xff));
+    }
+}
+
+inline void png_put_chunk(bstring& r, char const (&type)[5], std::span<std::byte const> data)
+{
+    png_put_big_uint32(r, narrow_cast<uint32_t>(data.size()));
+
+    auto const type_offset = r.size();
+    for (auto i = 0_uz; i != 4; ++i) {
+        r.push_back(static_cast<std::byte>(type[i]));
+    }
+    r.append(data.data(), data.size());
+
+    png_put_big_uint32(r, png_crc32(std::span{r.data() + type_offset, r.size() - type_offset}));
+}
+
+/** Filter a line.
+ *
+ * @param filter The filter, not `png_filter::adaptive`.
+ * @param[out] dst The filtered bytes of the line.
+ * @param line The bytes of the line.
+ * @param prev_line The bytes of the previous line, or zeros for the first line.
+ * @param bytes_per_pixel The number of bytes per pixel.
+ */
+inline void png_filter_line(
+    png_filter filter,
+    std::span<uint8_t> dst,
+    std::span<uint8_t const> line,
+    std::span<uint8_t const> prev_line,
+    std::size_t bytes_per_pixel) noexcept
+{
+    hi_axiom(dst.size() == line.size());
+    hi_axiom(prev_line.size() == line.size());
+
+    switch (filter) {
+    case png_filter::none:
+        std::memcpy(dst.data(), line.data(), line.size());
+        return;
+
+    case png_filter::sub:
+        for (auto i = 0_uz; i != line.size(); ++i) {
+            uint8_t const left = i >= bytes_per_pixel ? line[i - bytes_per_pixel] : 0;
+            dst[i] = static_cast<uint8_t>(line[i] - left);
+        }
+        return;
+
+    case png_filter::up:
+        for (auto i = 0_uz; i != line.size(); ++i) {
+            dst[i] = static_cast<uint8_t>(line[i] - prev_line[i]);
+        }
+        return;
+
+    case png_filter::average:
+        for (auto i = 0_uz; i != line.size(); ++i) {
+            uint8_t const left = i >= bytes_per_pixel ? line[i - bytes_per_pixel] : 0;
+            dst[i] = static_cast<uint8_t>(line[i] - (left + prev_line[i]) / 2);
+        }
+        return;
+
+    case png_filter::paeth:
+        for (auto i = 0_uz; i != line.size(); ++i) {
+            uint8_t const up = prev_line[i];
+            uint8_t const left = i >= bytes_per_pixel ? line[i - bytes_per_pixel] : 0;
+            uint8_t const left_up = i >= bytes_per_pixel ? prev_line[i - bytes_per_pixel] : 0;
+            dst[i] = static_cast<uint8_t>(line[i] - png_paeth_predictor(left, up, left_up));
+        }
+        return;
+
+    default:
+        hi_no_default();
+    }
+}
+
+/** The sum of the filtered bytes as signed values.
+ *
+ * Lines that have smaller values compress better.
+ */
+[[nodiscard]] inline std::size_t png_filter_cost(std::span<uint8_t const> filtered) noexcept
+{
+    auto r = 0_uz;
+    for (auto const c : filtered) {
+        auto const value = static_cast<int8_t>(c);
+        r += narrow_cast<std::size_t>(value < 0 ? -value : value);
+    }
+    return r;
+}
+
+/** Filter a line, and select the filter with the adaptive heuristic.
+ *
+ * @param filter The filter, or `png_filter::adaptive`.
+ * @param[out] dst The filter selection byte, followed by the filtered bytes of the line.
+ * @param line The bytes of the line.
+ * @param prev_line The bytes of the previous line, or zeros for the first line.
+ * @param bytes_per_pixel The number of bytes per pixel.
+ * @param scratch A buffer of the same size as @a line.
+ */
+inline void png_filter_line(
+    png_filter filter,
+    std::span<uint8_t> dst,
+    std::span<uint8_t const> line,
+    std::span<uint8_t const> prev_line,
+    std::size_t bytes_per_pixel,
+    std::span<uint8_t> scratch) noexcept
+{
+    hi_axiom(dst.size() == line.size() + 1);
+
+    if (filter != png_filter::adaptive) {
+        dst[0] = std::to_underlying(filter);
+        return png_filter_line(filter, dst.subspan(1), line, prev_line, bytes_per_pixel);
+    }
+
+    auto best_cost = std::numeric_limits<std::size_t>::max();
+    for (auto const candidate : {png_filter::none, png_filter::sub, png_filter::up, png_filter::average, png_filter::paeth}) {
+        png_filter_line(candidate, scratch, line, prev_line, bytes_per_pixel);
+        if (auto const cost = png_filter_cost(scratch); cost < best_cost) {
+            best_cost = cost;
+            dst[0] = std::to_underlying(candidate);
+            std::memcpy(dst.data() + 1, scratch.data(), scratch.size());
+        }
+    }
+}
+
+inline void png_encode_line(std::span<srgb_abgr8_pack const> src, std::span<uint8_t> dst) noexcept
+{
+    hi_axiom(dst.size() == src.size() * 4);
+
+    for (auto x = 0_uz; x != src.size(); ++x) {
+        auto const value = static_cast<uint32_t>(src[x]);
+        dst[x * 4 + 0] = static_cast<uint8_t>(value & 0xff);
+        dst[x * 4 + 1] = static_cast<uint8_t>((value >> 8) & 0xff);
+        dst[x * 4 + 2] = static_cast<uint8_t>((value >> 16) & 0xff);
+        dst[x * 4 + 3] = static_cast<uint8_t>(value >> 24);
+    }
+}
+
+/** Convert linear, pre-multiplied, half-float pixels to sRGB with straight alpha.
+ */
+inline void png_encode_line(std::span<sfloat_rgba16 const> src, std::span<uint8_t> dst) noexcept
+{
+    static_assert(sizeof(sfloat_rgba16) == 4 * sizeof(uint16_t));
+    hi_axiom(dst.size() == src.size() * 4);
+
+    constexpr auto chunk_size = 64_uz;
+    auto halfs = std::array<uint16_t, chunk_size * 4>{};
+    auto linear = std::array<float, chunk_size * 4>{};
+
+    auto const& table = detail::sRGB_linear16_to_gamma8_table;
+    for (auto x = 0_uz; x < src.size(); x += chunk_size) {
+        auto const size = std::min(chunk_size, src.size() - x);
+
+        std::memcpy(halfs.data(), src.data() + x, size * sizeof(sfloat_rgba16));
+        half_to_float(halfs.data(), linear.data(), size * 4);
+        for (auto i = 0_uz; i != size; ++i) {
+            auto const alpha = linear[i * 4 + 3];
+            auto const inv_alpha = alpha > 0.0f ? 1.0f / alpha : 0.0f;
+            linear[i * 4 + 0] *= inv_alpha;
+            linear[i * 4 + 1] *= inv_alpha;
+            linear[i * 4 + 2] *= inv_alpha;
+        }
+        float_to_half(linear.data(), halfs.data(), size * 4);
+
+        for (auto i = 0_uz; i != size; ++i) {
+            dst[(x + i) * 4 + 0] = table[halfs[i * 4 + 0]];
+            dst[(x + i) * 4 + 1] = table[halfs[i * 4 + 1]];
+            dst[(x + i) * 4 + 2] = table[halfs[i * 4 + 2]];
+            dst[(x + i) * 4 + 3] = round_cast<uint8_t>(std::clamp(linear[i * 4 + 3], 0.0f, 1.0f) * 255.0f);
+        }
+    }
+}
+
+template<typename T>
+[[nodiscard]] inline bstring png_encode(pixmap_span<T const> image, png_encode_options const& options)
+{
+    constexpr auto bytes_per_pixel = 4_uz;
+
+    hi_assert(options.level >= 0 and options.level <= 9);
+    hi_check(image.width() != 0 and image.height() != 0, "A PNG image must have at least one pixel");
+
+    auto const width = image.width();
+    auto const height = image.height();
+    auto const bytes_per_line = width * bytes_per_pixel;
+    auto const stride = bytes_per_line + 1;
+
+    // The lines of a PNG image are stored from the top down.
+    auto const line = [&](std::size_t y, std::span<uint8_t> dst) {
+        png_encode_line(image[height - y - 1], dst);
+    };
+
+    // Each band converts the line above it again, so that the bands are independent.
+    auto filtered = bstring(stride * height, std::byte{0});
+    pixmap_parallel_rows(width, height, [&](std::size_t first, std::size_t last) {
+        auto buffer = std::vector<uint8_t>(bytes_per_line * 3, 0);
+        auto prev_line = std::span{buffer}.subspan(0, bytes_per_line);
+        auto cur_line = std::span{buffer}.subspan(bytes_per_line, bytes_per_line);
+        auto const scratch = std::span{buffer}.subspan(bytes_per_line * 2, bytes_per_line);
+
+        if (first != 0) {
+            line(first - 1, prev_line);
+        }
+
+        for (auto y = first; y != last; ++y) {
+            line(y, cur_line);
+            auto const dst = std::span{reinterpret_cast<uint8_t *>(filtered.data()) + y * stride, stride};
+            png_filter_line(options.filter, dst, cur_line, prev_line, bytes_per_pixel, scratch);
+            std::swap(prev_line, cur_line);
+        }
+    });
+
+    auto const compressed = zlib_compress(filtered, options.level, options.chunk_size);
+
+    constexpr auto signature = std::array<uint8_t, 8>{0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+
+    auto r = bstring{};
+    r.reserve(compressed.size() + 128);
+    for (auto const c : signature) {
+        r.push_back(static_cast<std::byte>(c));
+    }
+
+    auto IHDR = bstring{};
+    png_put_big_uint32(IHDR, narrow_cast<uint32_t>(width));
+    png_put_big_uint32(IHDR, narrow_cast<uint32_t>(height));
+    // bit-depth, color-type RGBA, compression-method, filter-method, interlace-method.
+    for (auto const c : {8, 6, 0, 0, 0}) {
+        IHDR.push_back(static_cast<std::byte>(c));
+    }
+    png_put_chunk(r, "IHDR", IHDR);
+
+    // Perceptual rendering intent.
+    auto const sRGB = std::array<std::byte, 1>{std::byte{0}};
+    png_put_chunk(r, "sRGB", sRGB);
+
+    // Large images are split in multiple IDAT chunks.
+    constexpr auto max_IDAT_size = 0x10'0000_uz;
+    auto const compressed_span = std::span{compressed.data(), compressed.size()};
+    for (auto offset = 0_uz; offset < compressed.size(); offset += max_IDAT_size) {
+        png_put_chunk(r, "IDAT", compressed_span.subspan(offset, std::min(max_IDAT_size, compressed.size() - offset)));
+    }
+
+    png_put_chunk(r, "IEND", {});
+    return r;
+}
+
+} // namespace detail
+
+/** Encode an image in the PNG format.
+ *
+ * @param image The sRGB pixels with straight alpha.
+ * @param options The options of the encoder.
+ * @return The PNG file.
+ */
+[[nodiscard]] inline bstring png_encode(pixmap_span<srgb_abgr8_pack const> image, png_encode_options const& options = {})
+{
+    return detail::png_encode(image, options);
+}
+
+/** Encode an image in the PNG format.
+ *
+ * The image is converted to 8 bit sRGB.
+ *
+ * @param image The linear sRGB pixels with pre-multiplied alpha, as used by the GUI.
+ * @param options The options of the encoder.
+ * @return The PNG file.
+ */
+[[nodiscard]] inline bstring png_encode(pixmap_span<sfloat_rgba16 const> image, png_encode_options const& options = {})
+{
+    return detail::png_encode(image, options);
+}
+
+/** Save an image in the PNG format.
+ *
+ * @param path The path of the PNG file.
+ * @param image The sRGB pixels with straight alpha.
+ * @param options The options of the encoder.
+ * @throw io_error When the file could not be written.
+ */
+inline void png_save(std::filesystem::path const& path, pixmap_span<srgb_abgr8_pack const> image, png_encode_options const& options = {})
+{
+    auto file = hi::file(path, access_mode::truncate_or_create_for_write);
+    file.write(png_encode(image, options));
+}
+
+/** Save an image in the PNG format.
+ *
+ * @param path The path of the PNG file.
+ * @param image The linear sRGB pixels with pre-multiplied alpha, as used by the GUI.
+ * @param options The options of the encoder.
+ * @throw io_error When the file could not be written.
+ */
+inline void png_save(std::filesystem::path const& path, pixmap_span<sfloat_rgba16 const> image, png_encode_options const& options = {})
+{
+    auto file = hi::file(path, access_mode::truncate_or_create_for_write);
+    file.write(png_encode(image, options));
+}
+
+}} // namespace hi::v1
@@ -0,0 +1,86 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "png_encode.hpp"
+#include "png.hpp"
+#include "../image/image.hpp"
+#include <hikotest/hikotest.hpp>
+#include <cstdint>
+#include <cstddef>
+
+TEST_SUITE(png_encode_suite) {
+
+[[nodiscard]] static hi::pixmap<hi::srgb_abgr8_pack> make_image(std::size_t width, std::size_t height)
+{
+    auto r = hi::pixmap<hi::srgb_abgr8_pack>{width, height};
+
+    auto seed = uint32_t{1};
+    for (auto y = std::size_t{0}; y != height; ++y) {
+        for (auto x = std::size_t{0}; x != width; ++x) {
+            seed = seed * 1664525 + 1013904223;
+            // A gradient with some noise, so that each filter is selected for some lines.
+            auto const noise = (seed >> 28) == 0 ? seed : 0;
+            r[y][x] = static_cast<uint32_t>(0xff00'0000 | ((x + y) & 0xff) << 16 | (y & 0xff) << 8 | (x & 0xff)) ^ noise;
+        }
+    }
+    return r;
+}
+
+TEST_CASE(round_trip_test)
+{
+    constexpr hi::png_filter filters[] = {
+        hi::png_filter::none,
+        hi::png_filter::sub,
+        hi::png_filter::up,
+        hi::png_filter::average,
+        hi::png_filter::paeth,
+        hi::png_filter::adaptive};
+
+    auto const image = make_image(300, 200);
+    for (auto const filter : filters) {
+        for (auto const level : {0, 1, 6}) {
+            auto const encoded = hi::png_encode(image, hi::png_encode_options{level, filter, 10'000});
+
+            auto const decoded = hi::png{encoded};
+            REQUIRE(decoded.width() == 300);
+            REQUIRE(decoded.height() == 200);
+
+            // The lines are stored from the top down, each with a filter selection byte in front.
+            auto const lines = decoded.decode_lines();
+            auto const stride = std::size_t{300 * 4 + 1};
+            REQUIRE(lines.size() == stride * 200);
+            for (auto y = std::size_t{0}; y != 200; ++y) {
+                auto const row = image[200 - y - 1];
+                for (auto x = std::size_t{0}; x != 300; ++x) {
+                    auto const value = static_cast<uint32_t>(row[x]);
+                    auto const *pixel = lines.data() + y * stride + 1 + x * 4;
+                    REQUIRE(std::to_integer<uint32_t>(pixel[0]) == (value & 0xff));
+                    REQUIRE(std::to_integer<uint32_t>(pixel[1]) == ((value >> 8) & 0xff));
+                    REQUIRE(std::to_integer<uint32_t>(pixel[2]) == ((value >> 16) & 0xff));
+                    REQUIRE(std::to_integer<uint32_t>(pixel[3]) == (value >> 24));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE(linear_test)
+{
+    auto image = hi::pixmap<hi::sfloat_rgba16>{17, 9};
+    fill(image, hi::f32x4{0.25f, 0.5f, 1.0f, 1.0f});
+
+    auto const encoded = hi::png_encode(image);
+
+    auto const decoded = hi::png::load(encoded);
+    REQUIRE(decoded.width() == 17);
+    REQUIRE(decoded.height() == 9);
+
+    auto const pixel = static_cast<hi::f32x4>(static_cast<hi::f16x4>(decoded[4][8]));
+    REQUIRE(pixel.x() == 0.25f, 0.02);
+    REQUIRE(pixel.y() == 0.5f, 0.02);
+    REQUIRE(pixel.z() == 1.0f, 0.02);
+    REQUIRE(pixel.w() == 1.0f, 0.02);
+}
+
+};
@@ -0,0 +1,266 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/png_unfilter.hpp Kernels to undo the line-filters of a PNG image.
+ *
+ * Each filter has a generic implementation and, on x86-64, a SIMD implementation
+ * which is selected at runtime based on the features of the CPU.
+ *
+ * The Sub, Average and Paeth filters depend on the previous pixel on the same line,
+ * therefor the SIMD implementations process all the bytes of a single pixel at once.
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+#if HI_PROCESSOR == HI_CPU_X86_64
+#include <immintrin.h>
+#endif
+
+hi_export_module(hikogui.codec.png_unfilter);
+
+hi_export namespace hi { inline namespace v1 {
+
+[[nodiscard]] constexpr uint8_t png_paeth_predictor(uint8_t _a, uint8_t _b, uint8_t _c) noexcept
+{
+    auto const a = static_cast<int>(_a);
+    auto const b = static_cast<int>(_b);
+    auto const c = static_cast<int>(_c);
+
+    auto const p = a + b - c;
+    auto const pa = p > a ? p - a : a - p;
+    auto const pb = p > b ? p - b : b - p;
+    auto const pc = p > c ? p - c : c - p;
+
+    if (pa <= pb && pa <= pc) {
+        return static_cast<uint8_t>(a);
+    } else if (pb <= pc) {
+        return static_cast<uint8_t>(b);
+    } else {
+        return static_cast<uint8_t>(c);
+    }
+}
+
+inline void png_unfilter_sub_generic(std::span<uint8_t> line, std::size_t bytes_per_pixel) noexcept
+{
+    for (auto i = bytes_per_pixel; i < line.size(); ++i) {
+        line[i] += line[i - bytes_per_pixel];
+    }
+}
+
+inline void png_unfilter_up_generic(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
+{
+    hi_axiom(line.size() == prev_line.size());
+
+    for (auto i = 0_uz; i != line.size(); ++i) {
+        line[i] += prev_line[i];
+    }
+}
+
+inline void
+png_unfilter_average_generic(std::span<uint8_t> line, std::span<uint8_t const> prev_line, std::size_t bytes_per_pixel) noexcept
+{
+    hi_axiom(line.size() == prev_line.size());
+
+    for (auto i = 0_uz; i != line.size(); ++i) {
+        uint8_t const left = i >= bytes_per_pixel ? line[i - bytes_per_pixel] : 0;
+        line[i] += static_cast<uint8_t>((left + prev_line[i]) / 2);
+    }
+}
+
+inline void
+png_unfilter_paeth_generic(std::span<uint8_t> line, std::span<uint8_t const> prev_line, std::size_t bytes_per_pixel) noexcept
+{
+    hi_axiom(line.size() == prev_line.size());
+
+    for (auto i = 0_uz; i != line.size(); ++i) {
+        uint8_t const up = prev_line[i];
+        uint8_t const left = i >= bytes_per_pixel ? line[i - bytes_per_pixel] : 0;
+        uint8_t const left_up = i >= bytes_per_pixel ? prev_line[i - bytes_per_pixel] : 0;
+        line[i] += png_paeth_predictor(left, up, left_up);
+    }
+}
+
+#if HI_PROCESSOR == HI_CPU_X86_64
+namespace detail {
+
+/** Load the bytes of a single pixel into the lower 64 bits of a register.
+ */
+hi_target("sse2") [[nodiscard]] inline __m128i png_load_pixel(uint8_t const *ptr, std::size_t bytes_per_pixel) noexcept
+{
+    auto tmp = uint64_t{0};
+    std::memcpy(&tmp, ptr, bytes_per_pixel);
+    return _mm_loadl_epi64(reinterpret_cast<__m128i const *>(&tmp));
+}
+
+/** Store the bytes of a single pixel from the lower 64 bits of a register.
+ */
+hi_target("sse2") inline void png_store_pixel(uint8_t *ptr, std::size_t bytes_per_pixel, __m128i value) noexcept
+{
+    auto tmp = uint64_t{0};
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(&tmp), value);
+    std::memcpy(ptr, &tmp, bytes_per_pixel);
+}
+
+} // namespace detail
+
+hi_target("sse2") inline void png_unfilter_sub_sse2(std::span<uint8_t> line, std::size_t bytes_per_pixel) noexcept
+{
+    hi_axiom(bytes_per_pixel <= 8);
+    hi_axiom(line.size() % bytes_per_pixel == 0);
+
+    auto left = _mm_setzero_si128();
+    for (auto i = 0_uz; i != line.size(); i += bytes_per_pixel) {
+        left = _mm_add_epi8(left, detail::png_load_pixel(line.data() + i, bytes_per_pixel));
+        detail::png_store_pixel(line.data() + i, bytes_per_pixel, left);
+    }
+}
+
+hi_target("sse2") inline void png_unfilter_up_sse2(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
+{
+    hi_axiom(line.size() == prev_line.size());
+
+    auto i = 0_uz;
+    for (; i + 16 <= line.size(); i += 16) {
+        auto const up = _mm_loadu_si128(reinterpret_cast<__m128i const *>(prev_line.data() + i));
+        auto const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(line.data() + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(line.data() + i), _mm_add_epi8(x, up));
+    }
+    png_unfilter_up_generic(line.subspan(i), prev_line.subspan(i));
+}
+
+hi_target("sse2") inline void
+png_unfilter_average_sse2(std::span<uint8_t> line, std::span<uint8_t const> prev_line, std::size_t bytes_per_pixel) noexcept
+{
+    hi_axiom(line.size() == prev_line.size());
+    hi_axiom(bytes_per_pixel <= 8);
+    hi_axiom(line.size() % bytes_per_pixel == 0);
+
+    auto const ones = _mm_set1_epi8(1);
+
+    auto left = _mm_setzero_si128();
+    for (auto i = 0_uz; i != line.size(); i += bytes_per_pixel) {
+        auto const up = detail::png_load_pixel(prev_line.data() + i, bytes_per_pixel);
+        auto const x = detail::png_load_pixel(line.data() + i, bytes_per_pixel);
+
+        // _mm_avg_epu8() rounds up, the average filter rounds down.
+        auto const average = _mm_sub_epi8(_mm_avg_epu8(left, up), _mm_and_si128(_mm_xor_si128(left, up), ones));
+        left = _mm_add_epi8(x, average);
+        detail::png_store_pixel(line.data() + i, bytes_per_pixel, left);
+    }
+}
+
+hi_target("sse2,ssse3") inline void
+png_unfilter_paeth_ssse3(std::span<uint8_t> line, std::span<uint8_t const> prev_line, std::size_t bytes_per_pixel) noexcept
+{
+    hi_axiom(line.size() == prev_line.size());
+    hi_axiom(bytes_per_pixel <= 8);
+    hi_axiom(line.size() % bytes_per_pixel == 0);
+
+    auto const zero = _mm_setzero_si128();
+
+    // The samples are calculated as 16 bit integers, so that the distances do not overflow.
+    auto left = _mm_setzero_si128();
+    auto left_up = _mm_setzero_si128();
+    for (auto i = 0_uz; i != line.size(); i += bytes_per_pixel) {
+        auto const up = _mm_unpacklo_epi8(detail::png_load_pixel(prev_line.data() + i, bytes_per_pixel), zero);
+        auto const x = _mm_unpacklo_epi8(detail::png_load_pixel(line.data() + i, bytes_per_pixel), zero);
+
+        // p = left + up - left_up
+        // pa = |p - left| = |up - left_up|
+        // pb = |p - up| = |left - left_up|
+        // pc = |p - left_up| = |(up - left_up) + (left - left_up)|
+        auto const up_diff = _mm_sub_epi16(up, left_up);
+        auto const left_diff = _mm_sub_epi16(left, left_up);
+        auto const pa = _mm_abs_epi16(up_diff);
+        auto const pb = _mm_abs_epi16(left_diff);
+        auto const pc = _mm_abs_epi16(_mm_add_epi16(up_diff, left_diff));
+
+        // Select left if pa <= pb and pa <= pc, otherwise up if pb <= pc, otherwise left_up.
+        auto const not_left = _mm_or_si128(_mm_cmpgt_epi16(pa, pb), _mm_cmpgt_epi16(pa, pc));
+        auto const not_up = _mm_cmpgt_epi16(pb, pc);
+        auto predictor = _mm_or_si128(_mm_and_si128(not_up, left_up), _mm_andnot_si128(not_up, up));
+        predictor = _mm_or_si128(_mm_and_si128(not_left, predictor), _mm_andnot_si128(not_left, left));
+
+        auto const r = _mm_packus_epi16(_mm_and_si128(_mm_add_epi16(x, predictor), _mm_set1_epi16(0xff)), zero);
+        detail::png_store_pixel(line.data() + i, bytes_per_pixel, r);
+
+        left = _mm_unpacklo_epi8(r, zero);
+        left_up = up;
+    }
+}
+#endif
+
+/** Undo the Sub filter of a line.
+ *
+ * @param line The bytes of the line, excluding the filter selection byte.
+ * @param bytes_per_pixel The number of bytes per complete pixel, rounded up to one.
+ */
+inline void png_unfilter_sub(std::span<uint8_t> line, std::size_t bytes_per_pixel) noexcept
+{
+#if HI_PROCESSOR == HI_CPU_X86_64
+    if (bytes_per_pixel <= 8 and has_sse2()) {
+        return png_unfilter_sub_sse2(line, bytes_per_pixel);
+    }
+#endif
+    return png_unfilter_sub_generic(line, bytes_per_pixel);
+}
+
+/** Undo the Up filter of a line.
+ *
+ * @param line The bytes of the line, excluding the filter selection byte.
+ * @param prev_line The unfiltered bytes of the previous line.
+ */
+inline void png_unfilter_up(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
+{
+#if HI_PROCESSOR == HI_CPU_X86_64
+    if (has_sse2()) {
+        return png_unfilter_up_sse2(line, prev_line);
+    }
+#endif
+    return png_unfilter_up_generic(line, prev_line);
+}
+
+/** Undo the Average filter of a line.
+ *
+ * @param line The bytes of the line, excluding the filter selection byte.
+ * @param prev_line The unfiltered bytes of the previous line.
+ * @param bytes_per_pixel The number of bytes per complete pixel, rounded up to one.
+ */
+inline void
+png_unfilter_average(std::span<uint8_t> line, std::span<uint8_t const> prev_line, std::size_t bytes_per_pixel) noexcept
+{
+#if HI_PROCESSOR == HI_CPU_X86_64
+    if (bytes_per_pixel <= 8 and has_sse2()) {
+        return png_unfilter_average_sse2(line, prev_line, bytes_per_pixel);
+    }
+#endif
+    return png_unfilter_average_generic(line, prev_line, bytes_per_pixel);
+}
+
+/** Undo the Paeth filter of a line.
+ *
+ * @param line The bytes of the line, excluding the filter selection byte.
+ * @param prev_line The unfiltered bytes of the previous line.
+ * @param bytes_per_pixel The number of bytes per complete pixel, rounded up to one.
+ */
+inline void png_unfilter_paeth(std::span<uint8_t> line, std::span<uint8_t const> prev_line, std::size_t bytes_per_pixel) noexcept
+{
+#if HI_PROCESSOR == HI_CPU_X86_64
+    if (bytes_per_pixel <= 8 and has_ssse3()) {
+        return png_unfilter_paeth_ssse3(line, prev_line, bytes_per_pixel);
+    }
+#endif
+    return png_unfilter_paeth_generic(line, prev_line, bytes_per_pixel);
+}
+
+}} // namespace hi::v1
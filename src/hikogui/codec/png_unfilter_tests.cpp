@@ -0,0 +1,80 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "png_unfilter.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+TEST_SUITE(png_unfilter_suite) {
+
+constexpr static std::size_t bytes_per_pixels[] = {1, 2, 3, 4, 6, 8};
+
+static std::vector<uint8_t> make_line(std::size_t size, uint32_t seed)
+{
+    auto r = std::vector<uint8_t>{};
+    r.reserve(size);
+    for (auto i = std::size_t{0}; i != size; ++i) {
+        seed = seed * 1664525 + 1013904223;
+        r.push_back(static_cast<uint8_t>(seed >> 24));
+    }
+    return r;
+}
+
+TEST_CASE(sub_test)
+{
+    for (auto const bytes_per_pixel : bytes_per_pixels) {
+        auto const size = bytes_per_pixel * 37;
+        auto expected = make_line(size, 1);
+        auto result = expected;
+
+        hi::png_unfilter_sub_generic(expected, bytes_per_pixel);
+        hi::png_unfilter_sub(result, bytes_per_pixel);
+        REQUIRE(result == expected);
+    }
+}
+
+TEST_CASE(up_test)
+{
+    for (auto const size : {std::size_t{1}, std::size_t{15}, std::size_t{16}, std::size_t{100}}) {
+        auto const prev_line = make_line(size, 2);
+        auto expected = make_line(size, 3);
+        auto result = expected;
+
+        hi::png_unfilter_up_generic(expected, prev_line);
+        hi::png_unfilter_up(result, prev_line);
+        REQUIRE(result == expected);
+    }
+}
+
+TEST_CASE(average_test)
+{
+    for (auto const bytes_per_pixel : bytes_per_pixels) {
+        auto const size = bytes_per_pixel * 37;
+        auto const prev_line = make_line(size, 4);
+        auto expected = make_line(size, 5);
+        auto result = expected;
+
+        hi::png_unfilter_average_generic(expected, prev_line, bytes_per_pixel);
+        hi::png_unfilter_average(result, prev_line, bytes_per_pixel);
+        REQUIRE(result == expected);
+    }
+}
+
+TEST_CASE(paeth_test)
+{
+    for (auto const bytes_per_pixel : bytes_per_pixels) {
+        auto const size = bytes_per_pixel * 37;
+        auto const prev_line = make_line(size, 6);
+        auto expected = make_line(size, 7);
+        auto result = expected;
+
+        hi::png_unfilter_paeth_generic(expected, prev_line, bytes_per_pixel);
+        hi::png_unfilter_paeth(result, prev_line, bytes_per_pixel);
+        REQUIRE(result == expected);
+    }
+}
+
+};
@@ -0,0 +1,357 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/serialize.hpp Serialize structs directly to and from JSON and BON8, without building a datum tree.
+ */
+
+#pragma once
+
+#include "BON8.hpp"
+#include "BON8_view.hpp"
+#include "JSON_view.hpp"
+#include "JSON_writer.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <optional>
+#include <ranges>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.serialize);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** The names of the members of a type, for serializing as an object.
+ *
+ * A specialization of `hi::selector` may list the names of its members, so
+ * that the type is serialized as an object with these names as keys:
+ *
+ * ```cpp
+ * template<>
+ * struct hi::selector<my::simple> {
+ *     using names = hi::member_names<"foo", "bar">;
+ *
+ *     template<hi::fixed_string> auto &get(my::simple &) const noexcept;
+ *
+ *     template<> auto &get<"foo">(my::simple &rhs) const noexcept { return rhs.foo; }
+ *     template<> auto &get<"bar">(my::simple &rhs) const noexcept { return rhs.bar; }
+ * };
+ * ```
+ */
+template<fixed_string... Names>
+struct member_names {};
+
+namespace detail {
+
+template<typename T>
+concept serialize_string = std::convertible_to<T const&, std::string_view>;
+
+template<typename T>
+concept serialize_named = requires { typename selector<T>::names; };
+
+template<typename T>
+concept serialize_map = std::ranges::input_range<T> and requires(T const& value) {
+    { value.begin()->first } -> serialize_string;
+    value.begin()->second;
+};
+
+template<typename T>
+struct serialize_is_optional : std::false_type {};
+
+template<typename T>
+struct serialize_is_optional<std::optional<T>> : std::true_type {};
+
+[[nodiscard]] inline bool deserialize_bool(json_view const& view)
+{
+    auto const raw = view.raw();
+    if (raw == "true") {
+        return true;
+    } else if (raw == "false") {
+        return false;
+    }
+    throw parse_error("Expecting a JSON boolean");
+}
+
+[[nodiscard]] inline bool deserialize_bool(BON8_view const& view)
+{
+    return view.get_bool();
+}
+
+template<std::integral T>
+[[nodiscard]] T deserialize_integer(json_view const& view)
+{
+    hi_check(view.is_number(), "Expecting a JSON number");
+    return from_string<T>(view.raw());
+}
+
+template<std::integral T>
+[[nodiscard]] T deserialize_integer(BON8_view const& view)
+{
+    auto const value = view.get_integer();
+    hi_check(std::in_range<T>(value), "BON8 integer is out of range");
+    return static_cast<T>(value);
+}
+
+template<std::floating_point T>
+[[nodiscard]] T deserialize_float(json_view const& view)
+{
+    hi_check(view.is_number(), "Expecting a JSON number");
+    return from_string<T>(view.raw());
+}
+
+template<std::floating_point T>
+[[nodiscard]] T deserialize_float(BON8_view const& view)
+{
+    if (view.is_integer()) {
+        return static_cast<T>(view.get_integer());
+    }
+    return static_cast<T>(view.get_float());
+}
+
+[[nodiscard]] inline std::string deserialize_string(json_view const& view)
+{
+    return view.string();
+}
+
+[[nodiscard]] inline std::string deserialize_string(BON8_view const& view)
+{
+    return std::string{view.string()};
+}
+
+/** Compare the name of a member without unescaping, when possible.
+ */
+[[nodiscard]] inline bool deserialize_key_equal(json_view const& key, std::string_view name)
+{
+    auto const raw = key.raw_string();
+    if (raw.find('\\') == std::string_view::npos) [[likely]] {
+        return raw == name;
+    }
+    return key.string() == name;
+}
+
+[[nodiscard]] inline bool deserialize_key_equal(std::string_view key, std::string_view name) noexcept
+{
+    return key == name;
+}
+
+[[nodiscard]] inline std::string deserialize_key(json_view const& key)
+{
+    return key.string();
+}
+
+[[nodiscard]] inline std::string deserialize_key(std::string_view key)
+{
+    return std::string{key};
+}
+
+} // namespace detail
+
+/** Serialize a value directly to a JSON or BON8 writer.
+ *
+ * The following types are supported:
+ *  - `bool`, `nullptr_t`, integers, floating point numbers and enums (as integers).
+ *  - strings.
+ *  - `std::optional`, where an empty optional is written as null.
+ *  - maps with string keys, as objects.
+ *  - other ranges, as arrays.
+ *  - types with a `hi::selector` which lists its `member_names`, as objects.
+ *  - other aggregates, as an array of its data members in order.
+ *
+ * @param writer A `JSON_writer` or `BON8_writer`.
+ * @param value The value to serialize.
+ */
+template<typename Writer, typename T>
+void serialize(Writer& writer, T const& value)
+{
+    if constexpr (std::same_as<T, bool> or std::same_as<T, nullptr_t> or std::is_arithmetic_v<T>) {
+        writer.value(value);
+
+    } else if constexpr (std::is_enum_v<T>) {
+        writer.value(std::to_underlying(value));
+
+    } else if constexpr (detail::serialize_string<T>) {
+        writer.value(std::string_view{value});
+
+    } else if constexpr (detail::serialize_is_optional<T>::value) {
+        if (value) {
+            serialize(writer, *value);
+        } else {
+            writer.value(nullptr);
+        }
+
+    } else if constexpr (detail::serialize_map<T>) {
+        writer.begin_object();
+        for (auto const& [key, item] : value) {
+            writer.key(std::string_view{key});
+            serialize(writer, item);
+        }
+        writer.end_object();
+
+    } else if constexpr (std::ranges::input_range<T>) {
+        writer.begin_array();
+        for (auto const& item : value) {
+            serialize(writer, item);
+        }
+        writer.end_array();
+
+    } else if constexpr (detail::serialize_named<T>) {
+        // The selector only gives non-const access, the members are only read.
+        auto& value_ = const_cast<T&>(value);
+        writer.begin_object();
+        [&]<fixed_string... Names>(member_names<Names...>) {
+            ((writer.key(std::string_view{Names}), serialize(writer, selector<T>{}.template get<Names>(value_))), ...);
+        }(typename selector<T>::names{});
+        writer.end_object();
+
+    } else if constexpr (std::is_aggregate_v<T>) {
+        writer.begin_array();
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (serialize(writer, get_data_member<I>(value)), ...);
+        }(std::make_index_sequence<number_of_data_members_v<T>>{});
+        writer.end_array();
+
+    } else {
+        hi_static_not_implemented();
+    }
+}
+
+/** Deserialize a JSON or BON8 value directly into a value.
+ *
+ * This is the reverse of `serialize()`. Members of an object which are not
+ * part of the type are ignored, and members which are missing retain their
+ * current value. Data members of an aggregate beyond the items of the array
+ * retain their current value.
+ *
+ * @param view A `json_view` or `BON8_view` to the value to decode.
+ * @param[in,out] value The value to decode into.
+ * @throws parse_error When the encoded value does not match the type.
+ */
+template<typename View, typename T>
+void deserialize(View const& view, T& value)
+    requires(std::same_as<View, json_view> or std::same_as<View, BON8_view>)
+{
+    if constexpr (std::same_as<T, bool>) {
+        value = detail::deserialize_bool(view);
+
+    } else if constexpr (std::integral<T>) {
+        value = detail::deserialize_integer<T>(view);
+
+    } else if constexpr (std::floating_point<T>) {
+        value = detail::deserialize_float<T>(view);
+
+    } else if constexpr (std::is_enum_v<T>) {
+        value = static_cast<T>(detail::deserialize_integer<std::underlying_type_t<T>>(view));
+
+    } else if constexpr (std::same_as<T, std::string>) {
+        value = detail::deserialize_string(view);
+
+    } else if constexpr (detail::serialize_is_optional<T>::value) {
+        if (view.is_null()) {
+            value.reset();
+        } else {
+            deserialize(view, value.emplace());
+        }
+
+    } else if constexpr (detail::serialize_map<T>) {
+        hi_check(view.is_object(), "Expecting an object");
+        value.clear();
+        for (auto const& [key, item] : view.members()) {
+            deserialize(item, value[detail::deserialize_key(key)]);
+        }
+
+    } else if constexpr (requires { value.emplace_back(); }) {
+        hi_check(view.is_array(), "Expecting an array");
+        value.clear();
+        for (auto const& item : view.items()) {
+            deserialize(item, value.emplace_back());
+        }
+
+    } else if constexpr (detail::serialize_named<T>) {
+        hi_check(view.is_object(), "Expecting an object");
+        for (auto const& [key, item] : view.members()) {
+            [&]<fixed_string... Names>(member_names<Names...>) {
+                std::ignore =
+                    ((detail::deserialize_key_equal(key, std::string_view{Names}) and
+                      (deserialize(item, selector<T>{}.template get<Names>(value)), true)) or
+                     ...);
+            }(typename selector<T>::names{});
+        }
+
+    } else if constexpr (std::is_aggregate_v<T>) {
+        hi_check(view.is_array(), "Expecting an array");
+        auto i = 0_uz;
+        for (auto const& item : view.items()) {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                std::ignore = ((i == I and (deserialize(item, get_data_member<I>(value)), true)) or ...);
+            }(std::make_index_sequence<number_of_data_members_v<T>>{});
+            ++i;
+        }
+
+    } else {
+        hi_static_not_implemented();
+    }
+}
+
+/** Serialize a value as JSON text to a sink.
+ *
+ * @param sink A type with a `write(void const *, std::size_t)` member function, like `file`.
+ * @param value The value to serialize.
+ */
+template<byte_writer Sink, typename T>
+void serialize_JSON(Sink& sink, T const& value)
+{
+    auto writer = JSON_writer{sink};
+    serialize(writer, value);
+    writer.flush();
+}
+
+/** Serialize a value as a BON8 message to a sink.
+ *
+ * @param sink A type with a `write(void const *, std::size_t)` member function, like `file`.
+ * @param value The value to serialize.
+ */
+template<byte_writer Sink, typename T>
+void serialize_BON8(Sink& sink, T const& value)
+{
+    auto writer = BON8_writer{sink};
+    serialize(writer, value);
+    writer.flush();
+}
+
+/** Deserialize a JSON text directly into a value.
+ *
+ * @param text The JSON text.
+ * @return The decoded value, with a default constructed value as starting point.
+ * @throws parse_error When the text is not valid JSON, or does not match the type.
+ */
+template<std::default_initializable T>
+[[nodiscard]] T deserialize_JSON(std::string_view text)
+{
+    auto const document = json_document{text};
+    auto r = T{};
+    deserialize(document.root(), r);
+    return r;
+}
+
+/** Deserialize a BON8 message directly into a value.
+ *
+ * @param buffer The BON8 message.
+ * @return The decoded value, with a default constructed value as starting point.
+ * @throws parse_error When the message is not valid BON8, or does not match the type.
+ */
+template<std::default_initializable T>
+[[nodiscard]] T deserialize_BON8(bstring_view buffer)
+{
+    auto r = T{};
+    deserialize(decode_BON8_view(buffer), r);
+    return r;
+}
+
+}} // namespace hi::v1
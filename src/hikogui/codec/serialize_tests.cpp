@@ -0,0 +1,150 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "serialize.hpp"
+#include "../utility/utility.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <optional>
+#include <cstdint>
+
+namespace serialize_tests {
+
+enum class mode : uint8_t { off, on, automatic };
+
+struct position {
+    int x = 0;
+    int y = 0;
+
+    [[nodiscard]] friend bool operator==(position const&, position const&) noexcept = default;
+};
+
+struct settings {
+    std::string name;
+    int64_t count = 0;
+    double scale = 1.0;
+    bool enabled = false;
+    mode state = mode::off;
+    std::vector<position> positions;
+    std::optional<std::string> comment;
+    std::map<std::string, int> counters;
+
+    [[nodiscard]] friend bool operator==(settings const&, settings const&) noexcept = default;
+};
+
+} // namespace serialize_tests
+
+template<>
+struct hi::selector<serialize_tests::settings> {
+    using names = hi::member_names<"name", "count", "scale", "enabled", "state", "positions", "comment", "counters">;
+
+    template<hi::fixed_string Name>
+    [[nodiscard]] auto& get(serialize_tests::settings& rhs) const noexcept
+    {
+        constexpr auto name = std::string_view{Name};
+        if constexpr (name == "name") {
+            return rhs.name;
+        } else if constexpr (name == "count") {
+            return rhs.count;
+        } else if constexpr (name == "scale") {
+            return rhs.scale;
+        } else if constexpr (name == "enabled") {
+            return rhs.enabled;
+        } else if constexpr (name == "state") {
+            return rhs.state;
+        } else if constexpr (name == "positions") {
+            return rhs.positions;
+        } else if constexpr (name == "comment") {
+            return rhs.comment;
+        } else {
+            static_assert(name == "counters");
+            return rhs.counters;
+        }
+    }
+};
+
+TEST_SUITE(serialize_suite) {
+
+struct string_sink {
+    std::string text;
+
+    void write(void const *data, std::size_t size)
+    {
+        text.append(static_cast<char const *>(data), size);
+    }
+};
+
+[[nodiscard]] static serialize_tests::settings make_settings()
+{
+    auto r = serialize_tests::settings{};
+    r.name = "caf\xc3\xa9 \"quoted\"";
+    r.count = -5'000'000'000;
+    r.scale = 2.5;
+    r.enabled = true;
+    r.state = serialize_tests::mode::automatic;
+    r.positions = {{1, 2}, {-3, 4}};
+    r.comment = "hello";
+    r.counters = {{"a", 1}, {"b", 2}};
+    return r;
+}
+
+TEST_CASE(JSON_text)
+{
+    auto value = serialize_tests::settings{};
+    value.name = "foo";
+    value.positions = {{1, 2}};
+
+    auto sink = string_sink{};
+    hi::serialize_JSON(sink, value);
+    REQUIRE(
+        sink.text ==
+        "{\"name\":\"foo\",\"count\":0,\"scale\":1.0,\"enabled\":false,\"state\":0,\"positions\":[[1,2]],\"comment\":null,\"counters\":{}}");
+}
+
+TEST_CASE(JSON_round_trip)
+{
+    auto const value = make_settings();
+
+    auto sink = string_sink{};
+    hi::serialize_JSON(sink, value);
+    REQUIRE(hi::deserialize_JSON<serialize_tests::settings>(sink.text) == value);
+}
+
+TEST_CASE(BON8_round_trip)
+{
+    auto const value = make_settings();
+
+    auto sink = string_sink{};
+    hi::serialize_BON8(sink, value);
+    auto const message = hi::bstring_view{reinterpret_cast<std::byte const *>(sink.text.data()), sink.text.size()};
+    REQUIRE(hi::deserialize_BON8<serialize_tests::settings>(message) == value);
+}
+
+TEST_CASE(JSON_unknown_and_missing_members)
+{
+    auto const value =
+        hi::deserialize_JSON<serialize_tests::settings>(R"({"unknown":[1,{"x":2}],"count":42,"name":"bar"})");
+    REQUIRE(value.name == "bar");
+    REQUIRE(value.count == 42);
+    REQUIRE(value.scale == 1.0);
+    REQUIRE(not value.comment);
+}
+
+TEST_CASE(JSON_aggregate)
+{
+    REQUIRE(hi::deserialize_JSON<serialize_tests::position>("[5,-6]") == serialize_tests::position{5, -6});
+    REQUIRE(hi::deserialize_JSON<std::vector<int>>("[1,2,3]") == (std::vector<int>{1, 2, 3}));
+}
+
+TEST_CASE(JSON_type_mismatch)
+{
+    REQUIRE_THROWS(hi::deserialize_JSON<serialize_tests::settings>("[1,2]"), hi::parse_error);
+    REQUIRE_THROWS(hi::deserialize_JSON<serialize_tests::position>(R"(["a",2])"), hi::parse_error);
+    REQUIRE_THROWS(hi::deserialize_JSON<std::vector<int>>(R"({"a":1})"), hi::parse_error);
+}
+
+};
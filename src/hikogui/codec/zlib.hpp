@@ -9,21 +9,38 @@
 #include "../parser/parser.hpp"
 #include "../macros.hpp"
 #include "inflate.hpp"
+#include "deflate.hpp"
+#include <span>
+#include <array>
+#include <algorithm>
+#include <cstdint>
 #include <cstddef>
 #include <filesystem>
+#include <optional>
 
 hi_export_module(hikogui.codec.zlib);
 
 hi_export namespace hi { inline namespace v1 {
 
-[[nodiscard]] inline bstring zlib_decompress(std::span<std::byte const> bytes, std::size_t max_size)
+namespace detail {
+
+/** Parse the header of a zlib stream.
+ *
+ * @param bytes The bytes of the zlib stream.
+ * @param offset The offset of the header.
+ * @return The offset after the header, or empty when the header extends beyond the end of @a bytes.
+ * @throw parse_error When the header is invalid.
+ */
+[[nodiscard]] inline std::optional<std::size_t> zlib_parse_header(std::span<std::byte const> bytes, std::size_t offset)
 {
     struct zlib_header {
         uint8_t CMF;
         uint8_t FLG;
     };
 
-    auto offset = 0_uz;
+    if (offset + sizeof(zlib_header) > bytes.size()) {
+        return std::nullopt;
+    }
 
     auto const header = make_placement_ptr<zlib_header>(bytes, offset);
 
@@ -34,9 +51,43 @@ hi_export namespace hi { inline namespace v1 {
     hi_check(((header->CMF >> 4) & 0xf) <= 7, "zlib LZ77 window too large");
     hi_check((header->FLG & 0x20) == 0, "zlib must not use a preset dictionary");
 
-    if (header->FLG & 0x20) {
-        [[maybe_unused]] auto FDICT = make_placement_ptr<big_uint32_buf_t>(bytes, offset);
+    return offset;
+}
+
+/** Calculate the Adler-32 checksum.
+ *
+ * @param bytes The data.
+ * @param adler The checksum of the data before @a bytes.
+ * @return The checksum.
+ */
+[[nodiscard]] constexpr uint32_t zlib_adler32(std::span<std::byte const> bytes, uint32_t adler = 1) noexcept
+{
+    constexpr auto modulo = uint32_t{65521};
+    // The largest number of bytes for which the sums do not overflow before the modulo.
+    constexpr auto max_run = 5552_uz;
+
+    auto a = adler & 0xffff;
+    auto b = adler >> 16;
+    while (not bytes.empty()) {
+        auto const run = std::min(bytes.size(), max_run);
+        for (auto const c : bytes.first(run)) {
+            a += std::to_integer<uint32_t>(c);
+            b += a;
+        }
+        a %= modulo;
+        b %= modulo;
+        bytes = bytes.subspan(run);
     }
+    return (b << 16) | a;
+}
+
+} // namespace detail
+
+[[nodiscard]] inline bstring zlib_decompress(std::span<std::byte const> bytes, std::size_t max_size)
+{
+    auto const header_end = detail::zlib_parse_header(bytes, 0);
+    hi_check(header_end, "zlib header reading beyond end of buffer");
+    auto offset = *header_end;
 
     auto r = inflate(bytes, offset, max_size);
 
@@ -45,6 +96,31 @@ hi_export namespace hi { inline namespace v1 {
     return r;
 }
 
+/** Compress data in the zlib format.
+ *
+ * @param bytes The data to compress.
+ * @param level The compression level, 0 (stored) to 9 (best compression).
+ * @param chunk_size The number of bytes that are compressed independently, in parallel, see `deflate()`.
+ * @return The compressed data.
+ */
+[[nodiscard]] inline bstring zlib_compress(std::span<std::byte const> bytes, int level = 6, std::size_t chunk_size = 0x2'0000)
+{
+    // CMF is deflate with a 32 KiB window, FLG contains the compression level and the header checksum.
+    constexpr auto FLGs = std::array<uint8_t, 4>{0x01, 0x5e, 0x9c, 0xda};
+    auto const FLEVEL = level <= 1 ? 0 : level <= 5 ? 1 : level == 6 ? 2 : 3;
+
+    auto r = bstring{};
+    r.push_back(std::byte{0x78});
+    r.push_back(static_cast<std::byte>(FLGs[FLEVEL]));
+    r.append(deflate(bytes, level, chunk_size));
+
+    auto const ADLER32 = detail::zlib_adler32(bytes);
+    for (auto i = 4_uz; i != 0; --i) {
+        r.push_back(static_cast<std::byte>((ADLER32 >> ((i - 1) * 8)) & 0xff));
+    }
+    return r;
+}
+
 [[nodiscard]] inline bstring zlib_decompress(std::filesystem::path const& path, std::size_t max_size = 0x01000000)
 {
     return zlib_decompress(as_span<std::byte const>(file_view(path)), max_size);
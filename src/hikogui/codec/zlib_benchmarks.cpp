@@ -0,0 +1,53 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "zlib.hpp"
+#include "gzip.hpp"
+#include "../file/file.hpp"
+#include "../container/container.hpp"
+#include "../path/path.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <filesystem>
+#include <span>
+
+hi_benchmark(zlib_decompress)
+{
+    auto const path = hi::library_test_data_dir() / "gzip_test7.bin.gz";
+    if (not std::filesystem::exists(path)) {
+        return state.skip("The test data is not available.");
+    }
+
+    // Rewrap the deflate stream of the gzip file as a zlib stream.
+    auto const gzip = hi::file_view{path};
+    auto const gzip_bytes = as_span<std::byte const>(gzip);
+    auto const deflate_offset = hi::detail::gzip_parse_member_header(gzip_bytes, 0);
+    hi_assert(deflate_offset);
+
+    auto bytes = hi::bstring{std::byte{0x78}, std::byte{0x9c}};
+    // The trailer of gzip is 8 bytes; the 4 byte ADLER32 trailer of zlib is not verified by zlib_decompress().
+    bytes.append(gzip_bytes.data() + *deflate_offset, gzip_bytes.size() - *deflate_offset - 8);
+    bytes.append(4, std::byte{0});
+
+    auto const size = hi::zlib_decompress(bytes, 0x0100'0000).size();
+    state.set_bytes_per_iteration(size);
+    while (state.running()) {
+        hi::do_not_optimize(hi::zlib_decompress(bytes, 0x0100'0000));
+    }
+}
+
+hi_benchmark(gzip_decompress)
+{
+    auto const path = hi::library_test_data_dir() / "gzip_test7.bin.gz";
+    if (not std::filesystem::exists(path)) {
+        return state.skip("The test data is not available.");
+    }
+
+    auto const gzip = hi::file_view{path};
+    auto const bytes = as_span<std::byte const>(gzip);
+
+    state.set_bytes_per_iteration(hi::gzip_decompress(bytes, 0x0100'0000).size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::gzip_decompress(bytes, 0x0100'0000));
+    }
+}
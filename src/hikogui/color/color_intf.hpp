@@ -166,6 +166,15 @@ public:
         return _v.w() >= 0.0 && _v.w() <= 1.0;
     }
 
+    /** Check if the color is within the standard dynamic range.
+     *
+     * @return True if the red, green and blue components are between 0.0 and 1.0.
+     */
+    [[nodiscard]] constexpr bool is_sdr() const noexcept
+    {
+        return _v.x() >= 0.0 and _v.x() <= 1.0 and _v.y() >= 0.0 and _v.y() <= 1.0 and _v.z() >= 0.0 and _v.z() <= 1.0;
+    }
+
     [[nodiscard]] constexpr friend bool operator==(color const& lhs, color const& rhs) noexcept
     {
         return equal(lhs._v, rhs._v);
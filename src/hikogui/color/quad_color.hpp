@@ -36,6 +36,15 @@ public:
     {
     }
     constexpr quad_color(color const &c) noexcept : p0(c), p1(c), p2(c), p3(c) {}
+
+    [[nodiscard]] constexpr friend bool operator==(quad_color const &lhs, quad_color const &rhs) noexcept = default;
+
+    /** Check if the color of each corner is within the standard dynamic range.
+     */
+    [[nodiscard]] constexpr bool is_sdr() const noexcept
+    {
+        return p0.is_sdr() and p1.is_sdr() and p2.is_sdr() and p3.is_sdr();
+    }
 };
 
 }} // namespace hi::inline v1
@@ -13,6 +13,8 @@
 #include <cstddef>
 #include <mutex>
 #include <algorithm>
+#include <array>
+#include <new>
 
 hi_export_module(hikogui.concurrency.callback);
 
@@ -20,6 +22,156 @@ hi_export namespace hi {
 inline namespace v1 {
 namespace detail {
 
+/** A per-thread cache of freed callback blocks.
+ *
+ * Each callback is allocated as a single block with its shared-pointer control
+ * block. Widgets subscribe thousands of callbacks while being constructed, so
+ * freed blocks are kept in a small free-list per size class and reused by the
+ * next callback of the same size, instead of going through the global allocator.
+ *
+ * A block may be freed by another thread than the one that allocated it, in that
+ * case the block moves to the cache of the freeing thread.
+ */
+class callback_block_cache {
+public:
+    constexpr static std::size_t granularity = 32;
+    constexpr static std::size_t num_size_classes = 8;
+
+    /** Blocks larger than this are directly allocated with the global allocator.
+     */
+    constexpr static std::size_t max_block_size = granularity * num_size_classes;
+
+    /** The maximum number of free blocks of a size class in a thread's cache.
+     */
+    constexpr static std::size_t max_cached = 64;
+
+    [[nodiscard]] static void *allocate(std::size_t size)
+    {
+        if (size <= max_block_size and not _state.disabled) {
+            auto& list = _state.lists[size_class(size)];
+            if (auto const block = list.head) {
+                list.head = block->next;
+                --list.count;
+                return block;
+            }
+            // Allocate the full size-class, so that the block can be reused by any callback of the same size-class.
+            size = ceil(size, granularity);
+        }
+        return ::operator new(size);
+    }
+
+    static void deallocate(void *ptr, std::size_t size) noexcept
+    {
+        if (size <= max_block_size and not _state.disabled) {
+            if (not _state.guarded) {
+                register_guard();
+            }
+
+            auto& list = _state.lists[size_class(size)];
+            if (list.count < max_cached) {
+                list.head = new (ptr) free_block{list.head};
+                ++list.count;
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+
+private:
+    struct free_block {
+        free_block *next;
+    };
+
+    struct free_list {
+        free_block *head;
+        std::size_t count;
+    };
+
+    /** The state of the cache.
+     *
+     * This is trivially destructible so that it stays valid when callbacks
+     * are destroyed by other thread-local objects during thread exit.
+     */
+    struct state_type {
+        std::array<free_list, num_size_classes> lists;
+        bool guarded;
+        bool disabled;
+    };
+
+    /** Releases the cached blocks when the thread exits.
+     */
+    struct guard_type {
+        guard_type() noexcept = default;
+
+        ~guard_type()
+        {
+            _state.disabled = true;
+            for (auto& list : _state.lists) {
+                while (auto const block = list.head) {
+                    list.head = block->next;
+                    ::operator delete(block);
+                }
+                list.count = 0;
+            }
+        }
+    };
+
+    inline static thread_local constinit state_type _state = {};
+
+    [[nodiscard]] constexpr static std::size_t size_class(std::size_t size) noexcept
+    {
+        hi_axiom(size != 0 and size <= max_block_size);
+        return (size - 1) / granularity;
+    }
+
+    /** Construct the guard on this thread before the first block is cached.
+     */
+    static void register_guard() noexcept
+    {
+        [[maybe_unused]] thread_local auto guard = guard_type{};
+        _state.guarded = true;
+    }
+};
+
+/** The allocator for the shared block of a callback.
+ */
+template<typename T>
+class callback_allocator {
+public:
+    using value_type = T;
+
+    constexpr callback_allocator() noexcept = default;
+
+    template<typename U>
+    constexpr callback_allocator(callback_allocator<U> const&) noexcept
+    {
+    }
+
+    [[nodiscard]] T *allocate(std::size_t n)
+    {
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return std::allocator<T>{}.allocate(n);
+        } else {
+            return static_cast<T *>(callback_block_cache::allocate(n * sizeof(T)));
+        }
+    }
+
+    void deallocate(T *ptr, std::size_t n) noexcept
+    {
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            std::allocator<T>{}.deallocate(ptr, n);
+        } else {
+            callback_block_cache::deallocate(ptr, n * sizeof(T));
+        }
+    }
+
+    template<typename U>
+    [[nodiscard]] constexpr friend bool operator==(callback_allocator const&, callback_allocator<U> const&) noexcept
+    {
+        return true;
+    }
+};
+
 template<typename ResultType, typename... ArgTypes>
 class callback_base {
 public:
@@ -170,7 +322,10 @@ public:
     }
 
     template<typename Func>
-    explicit callback(Func&& func) : _impl(std::make_shared<impl_type<Func>>(std::forward<Func>(func)))
+    explicit callback(Func&& func) :
+        _impl(std::allocate_shared<impl_type<std::decay_t<Func>>>(
+            detail::callback_allocator<impl_type<std::decay_t<Func>>>{},
+            std::forward<Func>(func)))
     {
     }
 
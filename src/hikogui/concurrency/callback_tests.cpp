@@ -6,6 +6,8 @@
 #include "../macros.hpp"
 #include <hikotest/hikotest.hpp>
 #include <future>
+#include <array>
+#include <vector>
 
 TEST_SUITE(callback_suite)
 {
@@ -35,4 +37,56 @@ TEST_CASE(call_through_weak_test)
     REQUIRE(v == 45);
 }
 
+TEST_CASE(expire_test)
+{
+    auto cb = hi::callback<void()>([] {});
+    auto wcb = hi::weak_callback<void()>{cb};
+    REQUIRE(not wcb.expired());
+
+    cb = nullptr;
+    REQUIRE(wcb.expired());
+    REQUIRE(not wcb.lock());
+}
+
+TEST_CASE(recycle_test)
+{
+    auto v = 0;
+    for (auto i = 0; i != 1000; ++i) {
+        auto cb = hi::callback<void(int)>([&v, i](int x) {
+            v += x + i;
+        });
+        cb(1);
+    }
+    REQUIRE(v == 1000 + 999 * 1000 / 2);
+
+    // Larger than the cached blocks.
+    auto large = std::array<int, 1000>{};
+    large[999] = 5;
+    auto cb = hi::callback<int()>([large] {
+        return large[999];
+    });
+    REQUIRE(cb() == 5);
+}
+
+TEST_CASE(destroy_on_other_thread_test)
+{
+    auto v = 0;
+    auto callbacks = std::vector<hi::callback<void()>>{};
+    for (auto i = 0; i != 100; ++i) {
+        callbacks.emplace_back([&v] {
+            ++v;
+        });
+    }
+
+    std::async(std::launch::async, [&] {
+        for (auto& cb : callbacks) {
+            cb();
+        }
+        callbacks.clear();
+    }).wait();
+
+    REQUIRE(v == 100);
+    REQUIRE(callbacks.empty());
+}
+
 };
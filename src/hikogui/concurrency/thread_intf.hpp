@@ -21,6 +21,9 @@
 #include <unordered_map>
 #include <mutex>
 #include <bit>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
 
 hi_export_module(hikogui.concurrency.thread : intf);
 
@@ -70,6 +73,65 @@ void set_thread_name(std::string_view name) noexcept;
     }
 }
 
+/** Give the current thread the scheduling priority of a real-time audio thread.
+ *
+ * On Windows the thread is registered with MMCSS as a "Pro Audio" task for
+ * the rest of the lifetime of the thread.
+ *
+ * @ingroup concurrency
+ * @return True when the priority of the thread was changed.
+ */
+bool set_thread_audio_priority() noexcept;
+
+/** The class of CPU cores a thread prefers to run on.
+ *
+ * On a hybrid CPU the cores have different performance and power efficiency.
+ *
+ * @ingroup concurrency
+ */
+enum class cpu_core_class : uint8_t {
+    /** Run on any core.
+     */
+    any,
+
+    /** Run on the cores with the highest performance.
+     *
+     * For real-time and latency sensitive work, like an audio callback.
+     */
+    performance,
+
+    /** Run on the most power efficient cores.
+     *
+     * For background work, like decoding or logging.
+     */
+    efficiency
+};
+
+/** Information about a logical CPU.
+ *
+ * @ingroup concurrency
+ */
+struct cpu_info {
+    /** The class of the core of this CPU.
+     *
+     * When all cores have the same class this is `cpu_core_class::performance`.
+     */
+    cpu_core_class core_class = cpu_core_class::performance;
+
+    /** The NUMA node of this CPU.
+     */
+    std::size_t numa_node = 0;
+};
+
+/** Get the topology of the CPUs.
+ *
+ * The topology is discovered once, on the first call.
+ *
+ * @ingroup concurrency
+ * @return The information of each logical CPU, indexed by the CPU id of the affinity masks.
+ */
+[[nodiscard]] std::vector<cpu_info> const& cpu_topology() noexcept;
+
 /** Get the current process CPU affinity mask.
  *
  * @ingroup concurrency
@@ -108,6 +170,43 @@ inline std::vector<bool> set_thread_affinity(std::size_t cpu_id)
     return set_thread_affinity_mask(new_mask);
 }
 
+/** Get the CPUs of a core class which the process is allowed to run on.
+ *
+ * @ingroup concurrency
+ * @param core_class The class of the cores.
+ * @return A bit mask of the CPUs, or the mask returned from `process_affinity_mask()`
+ *         when the process may not run on any CPU of the class.
+ */
+[[nodiscard]] inline std::vector<bool> core_class_affinity_mask(cpu_core_class core_class)
+{
+    auto const available_cpus = process_affinity_mask();
+    if (core_class == cpu_core_class::any) {
+        return available_cpus;
+    }
+
+    auto const& topology = cpu_topology();
+
+    auto r = available_cpus;
+    auto found = false;
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        r[i] = r[i] and i < topology.size() and topology[i].core_class == core_class;
+        found |= r[i];
+    }
+    return found ? r : available_cpus;
+}
+
+/** Set the current thread CPU affinity to the cores of a class.
+ *
+ * @ingroup concurrency
+ * @param core_class The class of the cores the thread should run on.
+ * @return The previous bit mask.
+ * @throw std::os_error When unable to set the thread affinity.
+ */
+inline std::vector<bool> set_thread_core_class(cpu_core_class core_class)
+{
+    return set_thread_affinity_mask(core_class_affinity_mask(core_class));
+}
+
 /** Advance thread affinity to the next CPU.
  * It is possible to detect when `advance_thread_affinity()` is at the last cpu;
  * in that case the cpu parameter is less than or equal to the return value.
@@ -15,6 +15,10 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cstddef>
 
 hi_export_module(hikogui.concurrency.thread : impl);
 
@@ -36,6 +40,12 @@ inline void set_thread_name(std::string_view name) noexcept
     detail::thread_names.emplace(current_thread_id(), std::string{name});
 }
 
+inline bool set_thread_audio_priority() noexcept
+{
+    DWORD task_index = 0;
+    return AvSetMmThreadCharacteristicsW(L"Pro Audio", &task_index) != nullptr;
+}
+
 inline  std::vector<bool> mask_int_to_vec(DWORD_PTR rhs) noexcept
 {
     auto r = std::vector<bool>{};
@@ -85,6 +95,77 @@ inline std::vector<bool> set_thread_affinity_mask(std::vector<bool> const &mask)
     return mask_int_to_vec(old_mask);
 }
 
+[[nodiscard]] inline std::vector<cpu_info> const& cpu_topology() noexcept
+{
+    static auto const r = [] {
+        // Like the affinity masks, only the CPUs in the first processor group are used.
+        auto r = std::vector<cpu_info>(64);
+
+        // Without the processor information all CPUs are treated the same.
+        DWORD size = 0;
+        if (GetLogicalProcessorInformationEx(RelationAll, nullptr, &size) or GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
+            return r;
+        }
+
+        auto buffer = std::vector<std::byte>(size);
+        if (not GetLogicalProcessorInformationEx(
+                RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &size)) {
+            return r;
+        }
+
+        auto efficiency_classes = std::vector<BYTE>(r.size(), 0);
+        auto min_efficiency_class = std::numeric_limits<BYTE>::max();
+        auto max_efficiency_class = std::numeric_limits<BYTE>::min();
+
+        for (auto offset = 0_uz; offset < size;) {
+            auto const& info = *reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const *>(buffer.data() + offset);
+            offset += info.Size;
+
+            if (info.Relationship == RelationProcessorCore) {
+                for (auto i = 0_uz; i != info.Processor.GroupCount; ++i) {
+                    auto const& group_mask = info.Processor.GroupMask[i];
+                    if (group_mask.Group != 0) {
+                        continue;
+                    }
+
+                    for (auto cpu = 0_uz; cpu != r.size(); ++cpu) {
+                        if (group_mask.Mask & (KAFFINITY{1} << cpu)) {
+                            efficiency_classes[cpu] = info.Processor.EfficiencyClass;
+                        }
+                    }
+                    min_efficiency_class = std::min(min_efficiency_class, info.Processor.EfficiencyClass);
+                    max_efficiency_class = std::max(max_efficiency_class, info.Processor.EfficiencyClass);
+                }
+
+            } else if (info.Relationship == RelationNumaNode) {
+                auto const& group_mask = info.NumaNode.GroupMask;
+                if (group_mask.Group != 0) {
+                    continue;
+                }
+
+                for (auto cpu = 0_uz; cpu != r.size(); ++cpu) {
+                    if (group_mask.Mask & (KAFFINITY{1} << cpu)) {
+                        r[cpu].numa_node = info.NumaNode.NodeNumber;
+                    }
+                }
+            }
+        }
+
+        // A higher efficiency class has more performance and uses more power.
+        // On a CPU where all cores have the same class, all cores are performance cores.
+        if (min_efficiency_class < max_efficiency_class) {
+            for (auto cpu = 0_uz; cpu != r.size(); ++cpu) {
+                r[cpu].core_class = efficiency_classes[cpu] == max_efficiency_class ? cpu_core_class::performance :
+                                                                                      cpu_core_class::efficiency;
+            }
+        }
+
+        return r;
+    }();
+
+    return r;
+}
+
 [[nodiscard]] inline std::size_t current_cpu_id() noexcept
 {
     auto const index = GetCurrentProcessorNumber();
@@ -17,7 +17,13 @@
 #include <format>
 #include <mutex>
 #include <vector>
+#include <array>
+#include <chrono>
 #include <algorithm>
+#include <cstdint>
+#if HI_PROCESSOR == HI_CPU_X86_64
+#include <immintrin.h>
+#endif
 
 hi_export_module(hikogui.concurrency.unfair_mutex : impl);
 
@@ -65,8 +71,125 @@ inline std::vector<std::pair<void *, void *>> unfair_mutex_deadlock_lock_graph;
     return nullptr;
 }
 
+/** The number of times a mutex was contended and the total time waited.
+ */
+struct unfair_mutex_contention_type {
+    std::atomic<void const *> mutex = nullptr;
+    std::atomic<uint64_t> num_waits = 0;
+    std::atomic<uint64_t> wait_duration = 0;
+};
+
+/** A hash table of the contention of mutexes, keyed by the address of the mutex.
+ *
+ * The table is only filled when statistics are being logged; when the table is
+ * full, contention of new mutexes is not recorded.
+ */
+constinit inline std::array<unfair_mutex_contention_type, 256> unfair_mutex_contention_table = {};
+
+/** The maximum number of spins before blocking, calibrated for this processor.
+ */
+constinit inline std::atomic<uint16_t> unfair_mutex_max_spin = 0;
+
+hi_force_inline inline void unfair_mutex_pause() noexcept
+{
+#if HI_PROCESSOR == HI_CPU_X86_64
+    _mm_pause();
+#endif
+}
+
+/** Calibrate the maximum number of spins.
+ *
+ * The duration of a pause-instruction varies a lot between processors, from
+ * about 10 to 150 clock cycles. The maximum number of spins is selected so that
+ * spinning takes about as long as blocking and waking up a thread.
+ */
+[[nodiscard]] hi_no_inline inline uint16_t unfair_mutex_calibrate_max_spin() noexcept
+{
+    using namespace std::chrono_literals;
+
+    constexpr auto num_samples = 1000;
+    constexpr auto spin_duration = 2us;
+
+    auto const start = std::chrono::steady_clock::now();
+    for (auto i = 0; i != num_samples; ++i) {
+        unfair_mutex_pause();
+    }
+    auto const duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    auto const pause_ns = std::max(duration.count() / num_samples, std::chrono::nanoseconds::rep{1});
+    auto const r = std::clamp(std::chrono::nanoseconds{spin_duration}.count() / pause_ns, decltype(pause_ns){16}, decltype(pause_ns){4096});
+    unfair_mutex_max_spin.store(narrow_cast<uint16_t>(r), std::memory_order::relaxed);
+    return narrow_cast<uint16_t>(r);
+}
+
+[[nodiscard]] inline uint16_t unfair_mutex_get_max_spin() noexcept
+{
+    if (auto const r = unfair_mutex_max_spin.load(std::memory_order::relaxed)) [[likely]] {
+        return r;
+    }
+    return unfair_mutex_calibrate_max_spin();
+}
+
+/** Record the contention of a mutex.
+ *
+ * @param mutex The address of the mutex.
+ * @param wait_duration The time it took to acquire the mutex.
+ */
+hi_no_inline inline void unfair_mutex_add_contention(void const *mutex, std::chrono::nanoseconds wait_duration) noexcept
+{
+    auto const hash = (reinterpret_cast<std::uintptr_t>(mutex) >> 4) * 0x9e37'79b9'7f4a'7c15ULL;
+    for (auto i = 0_uz; i != unfair_mutex_contention_table.size(); ++i) {
+        auto& item = unfair_mutex_contention_table[(hash + i) % unfair_mutex_contention_table.size()];
+
+        void const *expected = nullptr;
+        if (item.mutex.compare_exchange_strong(expected, mutex, std::memory_order::relaxed) or expected == mutex) {
+            item.num_waits.fetch_add(1, std::memory_order::relaxed);
+            item.wait_duration.fetch_add(narrow_cast<uint64_t>(wait_duration.count()), std::memory_order::relaxed);
+            return;
+        }
+    }
+}
+
 } // namespace detail
 
+/** The contention of a mutex.
+ */
+hi_export struct unfair_mutex_contention {
+    void const *mutex;
+
+    /** The number of times a thread had to wait for the mutex.
+     */
+    uint64_t num_waits;
+
+    /** The total time threads waited for the mutex.
+     */
+    std::chrono::nanoseconds wait_duration;
+};
+
+/** Get the contention of all mutexes.
+ *
+ * Contention is only recorded while the statistics are logged.
+ *
+ * @return The mutexes that were contended, sorted by wait time.
+ */
+hi_export [[nodiscard]] inline std::vector<unfair_mutex_contention> get_unfair_mutex_contention() noexcept
+{
+    auto r = std::vector<unfair_mutex_contention>{};
+    for (auto const& item : detail::unfair_mutex_contention_table) {
+        if (auto const mutex = item.mutex.load(std::memory_order::relaxed)) {
+            r.emplace_back(
+                mutex,
+                item.num_waits.load(std::memory_order::relaxed),
+                std::chrono::nanoseconds{narrow_cast<std::chrono::nanoseconds::rep>(item.wait_duration.load(std::memory_order::relaxed))});
+        }
+    }
+
+    std::sort(r.begin(), r.end(), [](auto const& a, auto const& b) {
+        return a.wait_duration > b.wait_duration;
+    });
+    return r;
+}
+
 /** Lock an object on this thread.
  * @param object The object that is being locked.
  * @return nullptr on success, object if the mutex was already locked, a pointer to
@@ -248,12 +371,12 @@ inline void unfair_mutex_impl<UseDeadLockDetector>::unlock() noexcept
 
     hi_axiom(holds_invariant());
 
-    if (semaphore.fetch_sub(1, std::memory_order::relaxed) != 1) {
+    // The release must be on the fetch_sub itself, a fence after it would not
+    // order the writes in the critical section before the unlock.
+    if (semaphore.fetch_sub(1, std::memory_order::release) != 1) {
         [[unlikely]] semaphore.store(0, std::memory_order::release);
 
         semaphore.notify_one();
-    } else {
-        atomic_thread_fence(std::memory_order::release);
     }
 
     hi_axiom(holds_invariant());
@@ -270,6 +393,32 @@ hi_no_inline inline void unfair_mutex_impl<UseDeadLockDetector>::lock_contended(
 {
     hi_axiom(holds_invariant());
 
+    auto const record_contention = to_bool(global_state.load(std::memory_order::relaxed) & global_state_type::log_statistics);
+    auto const start = record_contention ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
+    // Spin for a short while, since the lock is often held only briefly.
+    // Twice the number of spins that was needed on average, so that the estimate can grow.
+    auto const max_spin = std::min(detail::unfair_mutex_get_max_spin(), narrow_cast<uint16_t>(spin_estimate.load(std::memory_order::relaxed) * 2 + 16));
+    for (uint16_t i = 0; i != max_spin; ++i) {
+        detail::unfair_mutex_pause();
+
+        if (semaphore.load(std::memory_order::relaxed) == 0) {
+            expected = 0;
+            if (semaphore.compare_exchange_weak(expected, 1, std::memory_order::acquire, std::memory_order::relaxed)) {
+                auto const estimate = spin_estimate.load(std::memory_order::relaxed);
+                spin_estimate.store(narrow_cast<uint16_t>(estimate + (i - estimate) / 8), std::memory_order::relaxed);
+                if (record_contention) {
+                    detail::unfair_mutex_add_contention(this, std::chrono::steady_clock::now() - start);
+                }
+                return;
+            }
+        }
+    }
+
+    // Spinning did not help, spin less next time.
+    spin_estimate.store(spin_estimate.load(std::memory_order::relaxed) / 2, std::memory_order::relaxed);
+    expected = semaphore.load(std::memory_order::relaxed);
+
     do {
         auto const should_wait = expected == 2;
 
@@ -284,6 +433,10 @@ hi_no_inline inline void unfair_mutex_impl<UseDeadLockDetector>::lock_contended(
         // Set to 2 when acquiring the lock, so that during unlock we wake other waiting threads.
         expected = 0;
     } while (!semaphore.compare_exchange_strong(expected, 2));
+
+    if (record_contention) {
+        detail::unfair_mutex_add_contention(this, std::chrono::steady_clock::now() - start);
+    }
 }
 
 }} // namespace hi::v1
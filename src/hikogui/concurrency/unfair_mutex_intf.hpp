@@ -12,6 +12,7 @@
 #include "../macros.hpp"
 #include <atomic>
 #include <memory>
+#include <cstdint>
 
 hi_export_module(hikogui.concurrency.unfair_mutex : intf);
 
@@ -31,6 +32,10 @@ hi_export namespace hi { inline namespace v1 {
  *     - lock(): MOV r,1; XOR r,r; LOCK CMPXCHG; JNE (skip)
  *     - unlock(): LOCK XADD [],-1; CMP; JE
  *
+ * When the mutex is contended the thread spins for a short while before it
+ * blocks, since the mutex guards short critical sections. Each mutex adapts
+ * the spin count to how long it took to acquire the mutex while spinning.
+ *
  * @ingroup concurrency
  * @tparam UseDeadLockDetector true when the unfair_mutex will use the deadlock detector.
  */
@@ -70,6 +75,10 @@ private:
     std::atomic_unsigned_lock_free semaphore = 0;
     using semaphore_value_type = typename decltype(semaphore)::value_type;
 
+    /** The number of spins it took to acquire the contended lock, on average.
+     */
+    std::atomic<uint16_t> spin_estimate = 0;
+
     bool holds_invariant() const noexcept;
 
     void lock_contended(semaphore_value_type expected) noexcept;
@@ -9,6 +9,9 @@
 #include <iostream>
 #include <string>
 #include <thread>
+#include <vector>
+#include <mutex>
+#include <cstdint>
 
 TEST_SUITE(dead_lock_detector_suite)
 {
@@ -327,4 +330,38 @@ TEST_CASE(good_lock4_test)
     hi::unfair_mutex_deadlock_remove_object(&c);
 }
 
+TEST_CASE(contended_test)
+{
+    hi::global_state_enable(hi::global_state_type::log_statistics);
+
+    auto mutex = hi::unfair_mutex_impl<false>{};
+    auto count = 0;
+
+    {
+        auto threads = std::vector<std::jthread>{};
+        for (auto i = 0; i != 4; ++i) {
+            threads.emplace_back([&] {
+                for (auto j = 0; j != 100'000; ++j) {
+                    auto const lock = std::scoped_lock(mutex);
+                    ++count;
+                }
+            });
+        }
+    }
+
+    REQUIRE(count == 400'000);
+
+    auto num_waits = uint64_t{0};
+    for (auto const& item : hi::get_unfair_mutex_contention()) {
+        if (item.mutex == &mutex) {
+            num_waits = item.num_waits;
+        }
+    }
+    if (std::thread::hardware_concurrency() > 1) {
+        REQUIRE(num_waits != 0);
+    }
+
+    hi::global_state_disable(hi::global_state_type::log_statistics);
+}
+
 };
@@ -3,15 +3,21 @@
 
 #include "byte_string.hpp" // export
 #include "expected_optional.hpp" // export
+#include "flat_map.hpp" // export
 #include "function_fifo.hpp" // export
 #include "lean_vector.hpp" // export
+#include "lru_cache.hpp" // export
 #include "polymorphic_optional.hpp" // export
+#include "rope.hpp" // export
 #include "secure_vector.hpp" // export
+#include "shared_bstring.hpp" // export
 #include "stable_set.hpp" // export
 #include "stack.hpp" // export
 #include "undo_stack.hpp" // export
 #include "vector_span.hpp" // export
 #include "void_span.hpp" // export
 #include "wfree_fifo.hpp" // export
+#include "wfree_message_fifo.hpp" // export
+#include "work_stealing_deque.hpp" // export
 
 hi_export_module(hikogui.container);
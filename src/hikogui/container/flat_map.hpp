@@ -0,0 +1,316 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file flat_map.hpp Defines flat_map<>.
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <initializer_list>
+#include <compare>
+#include <iterator>
+#include <utility>
+#include <tuple>
+#include <stdexcept>
+#include <cstddef>
+
+hi_export_module(hikogui.container.flat_map);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A map stored as a vector of key-value pairs sorted by key.
+ *
+ * Compared to `std::map` there is a single allocation for all the items, and
+ * lookup is a binary search over contiguous memory. Inserting or erasing in
+ * the middle is O(n), appending a key larger than all others is amortized O(1).
+ *
+ * The interface is a subset of `std::map`, with the following differences:
+ *  - Inserting and erasing invalidates iterators and references.
+ *  - The `value_type` is `std::pair<Key, T>`; the key must not be modified through an iterator.
+ *
+ * @tparam Key The type of the key.
+ * @tparam T The type of the value.
+ * @tparam Compare The ordering of the keys.
+ */
+template<typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map {
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using key_compare = Compare;
+    using container_type = std::vector<value_type>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = value_type const&;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    constexpr flat_map() noexcept = default;
+    constexpr flat_map(flat_map const&) = default;
+    constexpr flat_map(flat_map&&) noexcept = default;
+    constexpr flat_map& operator=(flat_map const&) = default;
+    constexpr flat_map& operator=(flat_map&&) noexcept = default;
+
+    /** Construct a map from unsorted items.
+     *
+     * This is O(n log n), much faster than inserting the items one by one.
+     *
+     * @param items The key-value pairs; when a key appears multiple times the last one is used.
+     */
+    constexpr explicit flat_map(container_type items) : _items(std::move(items))
+    {
+        std::stable_sort(_items.begin(), _items.end(), [](value_type const& lhs, value_type const& rhs) {
+            return key_compare{}(lhs.first, rhs.first);
+        });
+
+        // Of equal keys keep the last one.
+        auto out = _items.begin();
+        for (auto it = _items.begin(); it != _items.end(); ++it) {
+            auto const next = std::next(it);
+            if (next != _items.end() and not key_compare{}(it->first, next->first)) {
+                continue;
+            }
+
+            if (out != it) {
+                *out = std::move(*it);
+            }
+            ++out;
+        }
+        _items.erase(out, _items.end());
+    }
+
+    constexpr flat_map(std::initializer_list<value_type> items) : flat_map(container_type{items}) {}
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _items.empty();
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return _items.size();
+    }
+
+    constexpr void reserve(size_type new_capacity)
+    {
+        _items.reserve(new_capacity);
+    }
+
+    constexpr void clear() noexcept
+    {
+        _items.clear();
+    }
+
+    [[nodiscard]] constexpr iterator begin() noexcept
+    {
+        return _items.begin();
+    }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept
+    {
+        return _items.begin();
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return _items.cbegin();
+    }
+
+    [[nodiscard]] constexpr iterator end() noexcept
+    {
+        return _items.end();
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept
+    {
+        return _items.end();
+    }
+
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return _items.cend();
+    }
+
+    [[nodiscard]] constexpr iterator lower_bound(key_type const& key) noexcept
+    {
+        return std::lower_bound(_items.begin(), _items.end(), key, item_less);
+    }
+
+    [[nodiscard]] constexpr const_iterator lower_bound(key_type const& key) const noexcept
+    {
+        return std::lower_bound(_items.begin(), _items.end(), key, item_less);
+    }
+
+    [[nodiscard]] constexpr iterator find(key_type const& key) noexcept
+    {
+        auto it = lower_bound(key);
+        return is_match(it, key) ? it : end();
+    }
+
+    [[nodiscard]] constexpr const_iterator find(key_type const& key) const noexcept
+    {
+        auto it = lower_bound(key);
+        return is_match(it, key) ? it : end();
+    }
+
+    [[nodiscard]] constexpr bool contains(key_type const& key) const noexcept
+    {
+        return is_match(lower_bound(key), key);
+    }
+
+    [[nodiscard]] constexpr size_type count(key_type const& key) const noexcept
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    [[nodiscard]] constexpr mapped_type& at(key_type const& key)
+    {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("flat_map::at() key not found");
+        }
+        return it->second;
+    }
+
+    [[nodiscard]] constexpr mapped_type const& at(key_type const& key) const
+    {
+        auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("flat_map::at() key not found");
+        }
+        return it->second;
+    }
+
+    /** Insert a value if the key does not exist.
+     *
+     * @param key The key to insert.
+     * @param args The arguments to construct the value with, when the key does not exist.
+     * @return An iterator to the item with the key, and true if the item was inserted.
+     */
+    template<typename... Args>
+    constexpr std::pair<iterator, bool> try_emplace(key_type const& key, Args&&...args)
+    {
+        auto it = lower_bound(key);
+        if (is_match(it, key)) {
+            return {it, false};
+        }
+        it = _items.emplace(it, std::piecewise_construct, std::tie(key), std::forward_as_tuple(std::forward<Args>(args)...));
+        return {it, true};
+    }
+
+    template<typename... Args>
+    constexpr std::pair<iterator, bool> try_emplace(key_type&& key, Args&&...args)
+    {
+        auto it = lower_bound(key);
+        if (is_match(it, key)) {
+            return {it, false};
+        }
+        it = _items.emplace(
+            it,
+            std::piecewise_construct,
+            std::forward_as_tuple(std::move(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return {it, true};
+    }
+
+    template<typename... Args>
+    constexpr std::pair<iterator, bool> emplace(Args&&...args)
+    {
+        auto item = value_type(std::forward<Args>(args)...);
+
+        auto it = lower_bound(item.first);
+        if (is_match(it, item.first)) {
+            return {it, false};
+        }
+        return {_items.insert(it, std::move(item)), true};
+    }
+
+    constexpr std::pair<iterator, bool> insert(value_type const& item)
+    {
+        return try_emplace(item.first, item.second);
+    }
+
+    constexpr std::pair<iterator, bool> insert(value_type&& item)
+    {
+        return try_emplace(std::move(item.first), std::move(item.second));
+    }
+
+    template<typename M>
+    constexpr std::pair<iterator, bool> insert_or_assign(key_type const& key, M&& value)
+    {
+        auto it = lower_bound(key);
+        if (is_match(it, key)) {
+            it->second = std::forward<M>(value);
+            return {it, false};
+        }
+        return {_items.emplace(it, key, std::forward<M>(value)), true};
+    }
+
+    /** Get a reference to the value of a key, inserting a default value if the key does not exist.
+     *
+     * @note Inserting a new key moves all the items after it, this is O(n). Building a
+     *       large map by inserting keys in random order is therefor O(n^2); collect the
+     *       items in a `container_type` and use the `flat_map(container_type)` constructor
+     *       instead.
+     * @param key The key to look up.
+     * @return A reference to the value.
+     */
+    [[nodiscard]] constexpr mapped_type& operator[](key_type const& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    [[nodiscard]] constexpr mapped_type& operator[](key_type&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    constexpr iterator erase(const_iterator pos)
+    {
+        return _items.erase(pos);
+    }
+
+    constexpr size_type erase(key_type const& key)
+    {
+        auto it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        _items.erase(it);
+        return 1;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(flat_map const& lhs, flat_map const& rhs) noexcept
+    {
+        return lhs._items == rhs._items;
+    }
+
+    [[nodiscard]] constexpr friend auto operator<=>(flat_map const& lhs, flat_map const& rhs) noexcept
+    {
+        return std::lexicographical_compare_three_way(
+            lhs._items.begin(), lhs._items.end(), rhs._items.begin(), rhs._items.end());
+    }
+
+private:
+    container_type _items;
+
+    [[nodiscard]] constexpr static bool item_less(value_type const& item, key_type const& key) noexcept
+    {
+        return key_compare{}(item.first, key);
+    }
+
+    [[nodiscard]] constexpr bool is_match(const_iterator it, key_type const& key) const noexcept
+    {
+        return it != _items.end() and not key_compare{}(key, it->first);
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,77 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "flat_map.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+
+TEST_SUITE(flat_map) {
+
+TEST_CASE(insert_find)
+{
+    auto m = hi::flat_map<std::string, int>{};
+    REQUIRE(m.empty());
+
+    REQUIRE(m.try_emplace("b", 2).second);
+    REQUIRE(m.try_emplace("a", 1).second);
+    REQUIRE(m.try_emplace("c", 3).second);
+    REQUIRE(not m.try_emplace("b", 20).second);
+    REQUIRE(m.size() == 3);
+
+    REQUIRE(m.begin()->first == "a");
+    REQUIRE(m.at("b") == 2);
+    REQUIRE(m.contains("c"));
+    REQUIRE(not m.contains("d"));
+    REQUIRE(m.find("d") == m.end());
+    REQUIRE_THROWS(m.at("d"), std::out_of_range);
+
+    m["d"] = 4;
+    m["a"] = 10;
+    REQUIRE(m.size() == 4);
+    REQUIRE(m.at("a") == 10);
+    REQUIRE(m.at("d") == 4);
+}
+
+TEST_CASE(erase)
+{
+    auto m = hi::flat_map<int, int>{{3, 30}, {1, 10}, {2, 20}};
+
+    REQUIRE(m.erase(2) == 1);
+    REQUIRE(m.erase(2) == 0);
+    REQUIRE(m.size() == 2);
+
+    auto it = m.erase(m.begin());
+    REQUIRE(it->first == 3);
+    REQUIRE(m.size() == 1);
+}
+
+TEST_CASE(from_unsorted)
+{
+    auto items = hi::flat_map<int, int>::container_type{{5, 1}, {1, 1}, {5, 2}, {3, 1}, {1, 2}, {5, 3}};
+    auto m = hi::flat_map<int, int>{std::move(items)};
+
+    REQUIRE(m.size() == 3);
+    REQUIRE(m.at(1) == 2);
+    REQUIRE(m.at(3) == 1);
+    REQUIRE(m.at(5) == 3);
+
+    auto prev = 0;
+    for (auto const& item : m) {
+        REQUIRE(item.first > prev);
+        prev = item.first;
+    }
+}
+
+TEST_CASE(compare)
+{
+    auto a = hi::flat_map<int, int>{{1, 10}, {2, 20}};
+    auto b = hi::flat_map<int, int>{{2, 20}, {1, 10}};
+    auto c = hi::flat_map<int, int>{{1, 10}, {2, 21}};
+
+    REQUIRE(a == b);
+    REQUIRE(a != c);
+    REQUIRE(a < c);
+}
+
+};
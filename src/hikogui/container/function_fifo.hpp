@@ -4,7 +4,7 @@
 
 #pragma once
 
-#include "wfree_fifo.hpp"
+#include "wfree_message_fifo.hpp"
 #include "functional.hpp"
 #include "../macros.hpp"
 #include <future>
@@ -18,11 +18,11 @@ hi_export namespace hi::inline v1 {
  * This fifo is used to handle asynchronous calls from an event-loop.
  *
  * @tparam Proto The `std::function` prototype.
- * @tparam SlotSize The size in bytes of each slot. This determines the maximum
- *                  number of functions that can be stored on the fifo and if
- *                  functions can be completely stored on the fifo or are allocated on the heap.
+ * @tparam FifoSize The size in bytes of the fifo. Each function object takes
+ *                  as many bytes as it needs; very large function objects are
+ *                  allocated on the heap.
  */
-template<typename Proto = void(), std::size_t SlotSize = 64>
+template<typename Proto = void(), std::size_t FifoSize = 65536>
 class function_fifo {
 public:
     constexpr function_fifo() noexcept = default;
@@ -65,7 +65,7 @@ public:
      * The function object and arguments are stored within the fifo and does
      * not need allocation.
      *
-     * @note wait-free if the function object and arguments fit in the message slot of the fifo.
+     * @note wait-free if the function object and arguments fit in the fifo.
      * @param func A function object.
      */
     template<typename Func>
@@ -92,10 +92,10 @@ public:
             [](auto& item) {
                 return item.get_future();
             },
-            make_function<Proto>(std::forward<Func>(func)));
+            make_async_function<Proto>(std::forward<Func>(func)));
     }
 
-private : wfree_fifo<function<Proto>, SlotSize> _fifo;
+private : wfree_message_fifo<function<Proto>, FifoSize> _fifo;
 };
 
 } // namespace hi::inline v1
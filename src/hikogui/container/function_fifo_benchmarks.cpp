@@ -0,0 +1,82 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "function_fifo.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <memory>
+#include <array>
+#include <vector>
+#include <future>
+#include <cstddef>
+
+using hi::operator""_uz;
+
+hi_benchmark(function_fifo_add_run)
+{
+    // A batch of small lambdas is added, then run; the fifo never becomes full.
+    constexpr auto batch_size = 256_uz;
+
+    auto fifo = std::make_unique<hi::function_fifo<>>();
+    auto sum = 0_uz;
+
+    state.set_items_per_iteration(batch_size);
+    while (state.running()) {
+        for (auto i = 0_uz; i != batch_size; ++i) {
+            fifo->add_function([&sum, i] {
+                sum += i;
+            });
+        }
+        fifo->run_all();
+    }
+    hi::do_not_optimize(sum);
+}
+
+hi_benchmark(function_fifo_add_run_large)
+{
+    // Lambdas with a capture of 64 bytes, like the arguments of a posted event.
+    constexpr auto batch_size = 256_uz;
+
+    auto fifo = std::make_unique<hi::function_fifo<>>();
+    auto sum = 0_uz;
+    auto payload = std::array<std::size_t, 8>{};
+
+    state.set_items_per_iteration(batch_size);
+    while (state.running()) {
+        for (auto i = 0_uz; i != batch_size; ++i) {
+            payload.front() = i;
+            fifo->add_function([&sum, payload] {
+                sum += payload.front();
+            });
+        }
+        fifo->run_all();
+    }
+    hi::do_not_optimize(sum);
+}
+
+hi_benchmark(function_fifo_add_async_run)
+{
+    // Functions which return their result through a std::future, like loop::async_function().
+    constexpr auto batch_size = 256_uz;
+
+    auto fifo = std::make_unique<hi::function_fifo<>>();
+    auto futures = std::vector<std::future<std::size_t>>{};
+    futures.reserve(batch_size);
+    auto sum = 0_uz;
+
+    state.set_items_per_iteration(batch_size);
+    while (state.running()) {
+        for (auto i = 0_uz; i != batch_size; ++i) {
+            futures.push_back(fifo->add_async_function([i] {
+                return i;
+            }));
+        }
+        fifo->run_all();
+
+        for (auto& future : futures) {
+            sum += future.get();
+        }
+        futures.clear();
+    }
+    hi::do_not_optimize(sum);
+}
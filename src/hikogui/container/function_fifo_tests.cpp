@@ -0,0 +1,91 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "function_fifo.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <stdexcept>
+#include <future>
+#include <thread>
+#include <chrono>
+
+TEST_SUITE(function_fifo) {
+
+TEST_CASE(add_function)
+{
+    auto fifo = hi::function_fifo<>{};
+    REQUIRE(fifo.empty());
+
+    auto result = std::string{};
+    fifo.add_function([&] {
+        result += "a";
+    });
+    fifo.add_function([&] {
+        result += "b";
+    });
+    REQUIRE(not fifo.empty());
+
+    fifo.run_all();
+    REQUIRE(fifo.empty());
+    REQUIRE(result == "ab");
+}
+
+TEST_CASE(add_async_function)
+{
+    auto fifo = hi::function_fifo<>{};
+
+    auto future = fifo.add_async_function([] {
+        return 42;
+    });
+    REQUIRE(future.wait_for(std::chrono::seconds{0}) == std::future_status::timeout);
+
+    REQUIRE(fifo.run_one());
+    REQUIRE(future.get() == 42);
+    REQUIRE(not fifo.run_one());
+}
+
+TEST_CASE(add_async_function_void)
+{
+    auto fifo = hi::function_fifo<>{};
+
+    auto called = false;
+    auto future = fifo.add_async_function([&] {
+        called = true;
+    });
+
+    fifo.run_all();
+    future.get();
+    REQUIRE(called);
+}
+
+TEST_CASE(add_async_function_exception)
+{
+    auto fifo = hi::function_fifo<>{};
+
+    auto future = fifo.add_async_function([]() -> int {
+        throw std::runtime_error("async");
+    });
+
+    fifo.run_all();
+    REQUIRE_THROWS(future.get(), std::runtime_error);
+}
+
+TEST_CASE(add_async_function_from_thread)
+{
+    auto fifo = hi::function_fifo<>{};
+
+    auto future = std::future<std::thread::id>{};
+    {
+        auto t = std::jthread{[&] {
+            future = fifo.add_async_function([] {
+                return std::this_thread::get_id();
+            });
+        }};
+    }
+
+    fifo.run_all();
+    REQUIRE(future.get() == std::this_thread::get_id());
+}
+
+};
@@ -17,6 +17,9 @@
 #include <iterator>
 #include <stdexcept>
 #include <format>
+#include <ratio>
+#include <ranges>
+#include <cstring>
 
 hi_export_module(hikogui.container.lean_vector);
 
@@ -31,8 +34,14 @@ hi_export namespace hi { inline namespace v1 {
 /** Lean-vector with (SVO) short-vector-optimization.
  *
  * The maximum number of items in SVO are:`(sizeof(T *) * 3 - 1) / sizeof(T)`
+ *
+ * Items that are trivially copyable are relocated with `memcpy()` and
+ * `memmove()` when the vector grows or when items are inserted.
+ *
+ * @tparam T The type of the items.
+ * @tparam Growth The factor by which the capacity grows when inserting items beyond the capacity.
  */
-template<typename T>
+template<typename T, typename Growth = std::ratio<3, 2>>
 class lean_vector {
 public:
     using value_type = T;
@@ -48,8 +57,12 @@ public:
     using difference_type = std::ptrdiff_t;
     using allocator_type = std::allocator<value_type>;
 
+    using growth_type = Growth;
+
     constexpr static size_t value_alignment = alignof(value_type);
 
+    static_assert(std::ratio_greater_v<growth_type, std::ratio<1>>, "The growth factor must be larger than 1.");
+
     /** The allocator_type used to allocate items.
      */
     constexpr allocator_type get_allocator() const noexcept
@@ -332,7 +345,10 @@ public:
      */
     [[nodiscard]] constexpr size_t short_capacity() const noexcept
     {
-        if constexpr (std::endian::native == std::endian::little) {
+        if constexpr (alignof(value_type) > alignof(pointer)) {
+            // Over-aligned items are always allocated.
+            return 0;
+        } else if constexpr (std::endian::native == std::endian::little) {
             // The first alignment can not be used.
             return (sizeof(pointer) * 3 - alignof(value_type)) / sizeof(value_type);
         } else {
@@ -595,15 +611,23 @@ public:
     iterator insert(const_iterator pos, value_type const& value)
     {
         auto const index = pos - begin();
-        auto const new_size = size() + 1;
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            // Copy first, value may be an item of this vector.
+            auto const tmp = value;
+            std::uninitialized_copy_n(std::addressof(tmp), 1, _insert_gap(index, 1));
+            return begin() + index;
 
-        auto const update = _reserve<true>(new_size);
-        std::uninitialized_copy_n(std::addressof(value), 1, update.end);
-        _reserve_update(update, new_size);
+        } else {
+            auto const new_size = size() + 1;
 
-        auto const new_pos = begin() + index;
-        std::rotate(new_pos, end() - 1, end());
-        return new_pos;
+            auto const update = _reserve<true>(new_size);
+            std::uninitialized_copy_n(std::addressof(value), 1, update.end);
+            _reserve_update(update, new_size);
+
+            auto const new_pos = begin() + index;
+            std::rotate(new_pos, end() - 1, end());
+            return new_pos;
+        }
     }
 
     /** Insert a new item.
@@ -642,15 +666,23 @@ public:
     iterator insert(const_iterator pos, size_type count, value_type const& value)
     {
         auto const index = pos - begin();
-        auto const new_size = size() + count;
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            // Copy first, value may be an item of this vector.
+            auto const tmp = value;
+            std::uninitialized_fill_n(_insert_gap(index, count), count, tmp);
+            return begin() + index;
 
-        auto const update = _reserve<true>(new_size);
-        std::uninitialized_fill_n(update.end, count, value);
-        _reserve_update(update, new_size);
+        } else {
+            auto const new_size = size() + count;
 
-        auto const new_pos = begin() + index;
-        std::rotate(new_pos, end() - count, end());
-        return new_pos;
+            auto const update = _reserve<true>(new_size);
+            std::uninitialized_fill_n(update.end, count, value);
+            _reserve_update(update, new_size);
+
+            auto const new_pos = begin() + index;
+            std::rotate(new_pos, end() - count, end());
+            return new_pos;
+        }
     }
 
     /** Insert new items.
@@ -658,35 +690,69 @@ public:
      * If the items are not placed at the end, the items will be moved to the
      * correct position after they have been copied to the end.
      *
+     * When the number of items can be determined up front, the vector is
+     * grown at most once.
+     *
      * @param pos The position where the items will be inserted.
      * @param first An iterator to the first item to copy.
      * @param last An iterator to one beyond the last item to copy.
      * @return An iterator pointing to the newly inserted item.
      */
-    template<std::input_iterator First, std::input_iterator Last>
+    template<std::input_iterator First, std::sentinel_for<First> Last>
     iterator insert(const_iterator pos, First first, Last last)
     {
-        if constexpr (requires { std::distance(first, last); }) {
-            auto const n = std::distance(first, last);
+        auto const index = pos - begin();
 
-            auto const index = pos - begin();
-            auto const new_size = size() + n;
+        if constexpr (std::forward_iterator<First> or std::sized_sentinel_for<Last, First>) {
+            auto const n = narrow_cast<size_type>(std::ranges::distance(first, last));
 
-            auto const update = _reserve<true>(new_size);
-            std::uninitialized_move_n(first, n, update.end);
-            _reserve_update(update, new_size);
+            if constexpr (std::is_trivially_copyable_v<value_type>) {
+                std::uninitialized_copy_n(first, n, _insert_gap(index, n));
+                return begin() + index;
 
-            auto const new_pos = begin() + index;
-            std::rotate(new_pos, end() - n, end());
-            return new_pos;
+            } else {
+                auto const new_size = size() + n;
+
+                auto const update = _reserve<true>(new_size);
+                std::uninitialized_copy_n(first, n, update.end);
+                _reserve_update(update, new_size);
+
+                auto const new_pos = begin() + index;
+                std::rotate(new_pos, end() - n, end());
+                return new_pos;
+            }
 
         } else {
-            for (auto it = first; it != last; ++it) {
-                pos = insert(pos, *it) + 1;
+            auto it = begin() + index;
+            for (; first != last; ++first) {
+                it = emplace(it, *first) + 1;
             }
+            return begin() + index;
         }
     }
 
+    /** Insert the items of a range.
+     *
+     * @param pos The position where the items will be inserted.
+     * @param range The items to copy into the vector.
+     * @return An iterator pointing to the first inserted item.
+     */
+    template<std::ranges::input_range Range>
+    iterator insert_range(const_iterator pos, Range&& range)
+    {
+        return insert(pos, std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    /** Append the items of a range.
+     *
+     * @param range The items to copy into the vector.
+     */
+    template<std::ranges::input_range Range>
+    void append_range(Range&& range)
+    {
+        insert_range(end(), std::forward<Range>(range));
+    }
+
     /** Insert new items.
      *
      * If the items are not placed at the end, the items will be moved to the
@@ -943,13 +1009,16 @@ private:
 
     [[nodiscard]] pointer _short_data() const noexcept
     {
-        static_assert(alignof(value_type) <= alignof(pointer));
-
-        void *p = const_cast<lean_vector *>(this);
-        if constexpr (std::endian::native == std::endian::little) {
-            p = ceil(advance_bytes(p, 1), alignof(value_type));
+        if constexpr (alignof(value_type) > alignof(pointer)) {
+            // The short capacity is zero, see `short_capacity()`.
+            return nullptr;
+        } else {
+            void *p = const_cast<lean_vector *>(this);
+            if constexpr (std::endian::native == std::endian::little) {
+                p = ceil(advance_bytes(p, 1), alignof(value_type));
+            }
+            return std::launder(static_cast<pointer>(p));
         }
-        return std::launder(static_cast<pointer>(p));
     }
 
     [[nodiscard]] pointer _long_data() const noexcept
@@ -1049,9 +1118,9 @@ private:
         }
 
         if constexpr (ForInsert) {
-            auto next_capacity = capacity + capacity / 2;
+            auto next_capacity = _grow(capacity);
             if (new_capacity > next_capacity) {
-                next_capacity = new_capacity + new_capacity / 2;
+                next_capacity = _grow(new_capacity);
             }
             new_capacity = next_capacity;
         }
@@ -1073,8 +1142,12 @@ private:
         auto const old_size = is_short ? _short_size() : _long_size();
         auto const old_ptr = is_short ? _short_data() : _long_data();
 
-        std::uninitialized_move_n(old_ptr, old_size, update.ptr);
-        std::destroy_n(old_ptr, old_size);
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            std::memcpy(update.ptr, old_ptr, old_size * sizeof(value_type));
+        } else {
+            std::uninitialized_move_n(old_ptr, old_size, update.ptr);
+            std::destroy_n(old_ptr, old_size);
+        }
 
         if (not is_short) {
             auto a = get_allocator();
@@ -1091,6 +1164,35 @@ private:
         _reserve_update(update);
         _set_size(new_size, update.is_short);
     }
+
+    [[nodiscard]] constexpr static size_type _grow(size_type capacity) noexcept
+    {
+        return capacity * growth_type::num / growth_type::den;
+    }
+
+    /** Make room for trivially copyable items.
+     *
+     * The items after @a index are moved with `memmove()`.
+     *
+     * @param index The index where the items will be inserted.
+     * @param count The number of items to insert.
+     * @return A pointer to the uninitialized storage for the items.
+     */
+    [[nodiscard]] pointer _insert_gap(size_type index, size_type count)
+    {
+        static_assert(std::is_trivially_copyable_v<value_type>);
+
+        auto const old_size = size();
+        hi_axiom(index <= old_size);
+
+        auto const update = _reserve<true>(old_size + count);
+        _reserve_update(update);
+
+        auto const p = _begin_data(update.is_short) + index;
+        std::memmove(p + count, p, (old_size - index) * sizeof(value_type));
+        _set_size(old_size + count, update.is_short);
+        return p;
+    }
 };
 
 template<std::input_iterator It, std::input_iterator ItEnd>
@@ -1113,9 +1215,9 @@ lean_vector<T> make_lean_vector(Args &&...args) noexcept
 //    }
 //};
 
-template<typename T>
-struct std::formatter<hi::lean_vector<T>, char> : std::formatter<std::string, char> {
-    auto format(hi::lean_vector<T> const& t, auto& fc) const
+template<typename T, typename Growth>
+struct std::formatter<hi::lean_vector<T, Growth>, char> : std::formatter<std::string, char> {
+    auto format(hi::lean_vector<T, Growth> const& t, auto& fc) const
     {
         auto r = std::string{"["};
 
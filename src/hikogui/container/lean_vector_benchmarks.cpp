@@ -0,0 +1,72 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "lean_vector.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+using hi::operator""_uz;
+
+hi_benchmark(lean_vector_push_back_short)
+{
+    // A few items, the common case for the glyphs of a grapheme; these fit without allocating.
+    constexpr auto batch_size = 256_uz;
+
+    auto sum = 0_uz;
+
+    state.set_items_per_iteration(batch_size);
+    while (state.running()) {
+        for (auto i = 0_uz; i != batch_size; ++i) {
+            auto v = hi::lean_vector<uint32_t>{};
+            v.push_back(static_cast<uint32_t>(i));
+            v.push_back(static_cast<uint32_t>(i + 1));
+            v.push_back(static_cast<uint32_t>(i + 2));
+            sum += v.size();
+        }
+    }
+    hi::do_not_optimize(sum);
+}
+
+hi_benchmark(std_vector_push_back_short)
+{
+    // The same as lean_vector_push_back_short, as a reference.
+    constexpr auto batch_size = 256_uz;
+
+    auto sum = 0_uz;
+
+    state.set_items_per_iteration(batch_size);
+    while (state.running()) {
+        for (auto i = 0_uz; i != batch_size; ++i) {
+            auto v = std::vector<uint32_t>{};
+            v.push_back(static_cast<uint32_t>(i));
+            v.push_back(static_cast<uint32_t>(i + 1));
+            v.push_back(static_cast<uint32_t>(i + 2));
+            sum += v.size();
+        }
+    }
+    hi::do_not_optimize(sum);
+}
+
+hi_benchmark(lean_vector_insert_range)
+{
+    // Insert a range in the middle, which grows the allocation once and opens a gap with memmove().
+    constexpr auto num_items = 1024_uz;
+
+    auto items = std::array<uint32_t, 64>{};
+    for (auto i = 0_uz; i != items.size(); ++i) {
+        items[i] = static_cast<uint32_t>(i);
+    }
+
+    state.set_items_per_iteration(num_items);
+    while (state.running()) {
+        auto v = hi::lean_vector<uint32_t>{};
+        while (v.size() < num_items) {
+            v.insert(v.begin() + v.size() / 2, items.begin(), items.end());
+        }
+        hi::do_not_optimize(v.front());
+    }
+}
@@ -11,6 +11,11 @@
 
 #include "lean_vector.hpp"
 #include <hikotest/hikotest.hpp>
+#include <vector>
+#include <string>
+#include <ratio>
+#include <algorithm>
+#include <cassert>
 
 hi_warning_push();
 // C26439: This kind of function should not throw. Declare it 'noexcept' (f.6)
@@ -733,7 +738,7 @@ TEST_CASE(construct_deduction)
         hi::lean_vector vec(std::begin(arr), std::end(arr));
 
         static_assert(std::is_same_v<decltype(vec), hi::lean_vector<int>>);
-        REQUIRE(vec == arr);
+        REQUIRE(std::ranges::equal(vec, arr));
     }
 
     //  Test the implicit deduction guides
@@ -1616,6 +1621,52 @@ TEST_CASE(swap_noexcept)
     static_assert(noexcept(swap(std::declval<C&>(), std::declval<C&>())));
 }
 
+TEST_CASE(append_range)
+{
+    auto v = hi::lean_vector<int>{1, 2};
+    auto const items = std::vector<int>{3, 4, 5, 6, 7, 8, 9, 10};
+    v.append_range(items);
+    REQUIRE(v.size() == 10);
+    for (auto i = 0; i != 10; ++i) {
+        REQUIRE(v[i] == i + 1);
+    }
+
+    auto s = hi::lean_vector<std::string>{"a"};
+    auto const strings = std::vector<std::string>{"b", "c"};
+    s.append_range(strings);
+    REQUIRE(s == (hi::lean_vector<std::string>{"a", "b", "c"}));
+    REQUIRE(strings[0] == "b");
+}
+
+TEST_CASE(insert_range_middle)
+{
+    auto v = hi::lean_vector<int>{1, 2, 7, 8};
+    auto const items = std::vector<int>{3, 4, 5, 6};
+    auto it = v.insert_range(v.begin() + 2, items);
+    REQUIRE(it == v.begin() + 2);
+    REQUIRE(v == (hi::lean_vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+
+    // Insert items of the vector into itself.
+    v.insert(v.begin(), 2, v[7]);
+    REQUIRE(v == (hi::lean_vector<int>{8, 8, 1, 2, 3, 4, 5, 6, 7, 8}));
+
+    auto s = hi::lean_vector<std::string>{"a", "d"};
+    auto const strings = std::vector<std::string>{"b", "c"};
+    s.insert_range(s.begin() + 1, strings);
+    REQUIRE(s == (hi::lean_vector<std::string>{"a", "b", "c", "d"}));
+}
+
+TEST_CASE(growth)
+{
+    auto v = hi::lean_vector<int, std::ratio<2>>{};
+    for (auto i = 0; i != 100; ++i) {
+        v.push_back(i);
+    }
+    REQUIRE(v.size() == 100);
+    REQUIRE(v.capacity() >= 100);
+    REQUIRE(v[99] == 99);
+}
+
 }; // TEST_SUITE(lean_vector_suite)
 
 hi_warning_pop();
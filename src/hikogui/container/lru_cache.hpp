@@ -0,0 +1,181 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <list>
+#include <unordered_map>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <cstddef>
+
+hi_export_module(hikogui.container.lru_cache);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A cache with a fixed capacity which evicts the least recently used entry.
+ *
+ * Both `find()` and `insert()` are O(1); an entry that is found is moved to
+ * the front of the recently-used list.
+ *
+ * Each entry has a cost, by default 1. The capacity limits the total cost of
+ * the entries, which allows a cache to be bounded by the memory of its values.
+ *
+ * @note This container is not thread-safe, the user must lock it externally.
+ * @tparam Key The type of the key.
+ * @tparam T The type of the value.
+ * @tparam Hash The hash function of the key.
+ */
+template<typename Key, typename T, typename Hash = std::hash<Key>>
+class lru_cache {
+public:
+    using key_type = Key;
+    using value_type = T;
+    using hasher = Hash;
+    using size_type = std::size_t;
+
+    lru_cache(lru_cache const&) = delete;
+    lru_cache(lru_cache&&) = delete;
+    lru_cache& operator=(lru_cache const&) = delete;
+    lru_cache& operator=(lru_cache&&) = delete;
+
+    /** Create an empty cache.
+     *
+     * @param capacity The maximum total cost of the entries in the cache.
+     */
+    explicit lru_cache(size_type capacity) noexcept : _capacity(capacity)
+    {
+        hi_assert(capacity != 0);
+    }
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return _entries.size();
+    }
+
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    /** The total cost of the entries in the cache.
+     */
+    [[nodiscard]] size_type cost() const noexcept
+    {
+        return _cost;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _entries.empty();
+    }
+
+    void clear() noexcept
+    {
+        _index.clear();
+        _entries.clear();
+        _cost = 0;
+    }
+
+    /** Find an entry in the cache.
+     *
+     * The entry that is found becomes the most recently used entry.
+     *
+     * @param key The key to search for.
+     * @return A pointer to the value, or nullptr when the key is not in the cache.
+     *         The pointer is valid until the next modification of the cache.
+     */
+    [[nodiscard]] value_type const *find(key_type const& key) noexcept
+    {
+        auto const it = _index.find(key);
+        if (it == _index.end()) {
+            return nullptr;
+        }
+
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return std::addressof(it->second->value);
+    }
+
+    /** Insert or replace an entry in the cache.
+     *
+     * The entry becomes the most recently used entry. The least recently used
+     * entries are evicted until the total cost fits the capacity; the new entry
+     * itself is never evicted, even when its cost is larger than the capacity.
+     *
+     * @param key The key of the entry.
+     * @param value The value of the entry.
+     * @param cost The cost of the entry.
+     * @return A reference to the value in the cache.
+     */
+    value_type const& insert(key_type key, value_type value, size_type cost = 1)
+    {
+        if (auto const it = _index.find(key); it != _index.end()) {
+            _entries.splice(_entries.begin(), _entries, it->second);
+            _cost -= it->second->cost;
+            it->second->value = std::move(value);
+            it->second->cost = cost;
+            _cost += cost;
+            evict();
+            return it->second->value;
+        }
+
+        _entries.emplace_front(key, std::move(value), cost);
+        _index.emplace(std::move(key), _entries.begin());
+        _cost += cost;
+        evict();
+        return _entries.front().value;
+    }
+
+    /** Remove an entry from the cache.
+     *
+     * @param key The key of the entry.
+     * @return true when the entry was in the cache.
+     */
+    bool erase(key_type const& key) noexcept
+    {
+        auto const it = _index.find(key);
+        if (it == _index.end()) {
+            return false;
+        }
+
+        _cost -= it->second->cost;
+        _entries.erase(it->second);
+        _index.erase(it);
+        return true;
+    }
+
+private:
+    struct entry_type {
+        key_type key;
+        value_type value;
+        size_type cost;
+    };
+
+    using entries_type = std::list<entry_type>;
+
+    size_type _capacity;
+    size_type _cost = 0;
+
+    /** The entries, ordered from most to least recently used.
+     */
+    entries_type _entries;
+
+    std::unordered_map<key_type, typename entries_type::iterator, hasher> _index;
+
+    /** Evict the least recently used entries, except the most recently used entry, until the cost fits the capacity.
+     */
+    void evict() noexcept
+    {
+        while (_cost > _capacity and _entries.size() > 1) {
+            _cost -= _entries.back().cost;
+            _index.erase(_entries.back().key);
+            _entries.pop_back();
+        }
+    }
+};
+
+}} // namespace hi::v1
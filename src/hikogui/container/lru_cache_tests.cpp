@@ -0,0 +1,97 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "lru_cache.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+
+TEST_SUITE(lru_cache) {
+
+TEST_CASE(find_and_insert)
+{
+    auto cache = hi::lru_cache<int, std::string>(2);
+    REQUIRE(cache.empty());
+    REQUIRE(cache.find(1) == nullptr);
+
+    cache.insert(1, "one");
+    cache.insert(2, "two");
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.find(1) != nullptr);
+    REQUIRE(*cache.find(1) == "one");
+    REQUIRE(*cache.find(2) == "two");
+
+    cache.insert(2, "TWO");
+    REQUIRE(cache.size() == 2);
+    REQUIRE(*cache.find(2) == "TWO");
+}
+
+TEST_CASE(evict_least_recently_used)
+{
+    auto cache = hi::lru_cache<int, std::string>(2);
+    cache.insert(1, "one");
+    cache.insert(2, "two");
+
+    // Make 1 the most recently used entry, so that 2 is evicted.
+    REQUIRE(cache.find(1) != nullptr);
+    cache.insert(3, "three");
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.find(2) == nullptr);
+    REQUIRE(*cache.find(1) == "one");
+    REQUIRE(*cache.find(3) == "three");
+
+    // 1 was found before 3, so that 1 is evicted.
+    cache.insert(4, "four");
+    REQUIRE(cache.find(1) == nullptr);
+    REQUIRE(*cache.find(3) == "three");
+    REQUIRE(*cache.find(4) == "four");
+
+    cache.clear();
+    REQUIRE(cache.empty());
+    REQUIRE(cache.find(3) == nullptr);
+}
+
+TEST_CASE(evict_by_cost)
+{
+    auto cache = hi::lru_cache<int, std::string>(10);
+    cache.insert(1, "one", 4);
+    cache.insert(2, "two", 4);
+    REQUIRE(cache.cost() == 8);
+
+    // The total cost would become 12, so the least recently used entry is evicted.
+    cache.insert(3, "three", 4);
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.cost() == 8);
+    REQUIRE(cache.find(1) == nullptr);
+
+    // Replacing an entry updates its cost.
+    cache.insert(2, "TWO", 1);
+    REQUIRE(cache.cost() == 5);
+
+    // An entry that is larger than the capacity evicts everything else, but is kept itself.
+    cache.insert(4, "four", 20);
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.cost() == 20);
+    REQUIRE(*cache.find(4) == "four");
+}
+
+TEST_CASE(erase)
+{
+    auto cache = hi::lru_cache<int, std::string>(10);
+    cache.insert(1, "one", 4);
+    cache.insert(2, "two", 4);
+
+    REQUIRE(cache.erase(1));
+    REQUIRE(not cache.erase(1));
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.cost() == 4);
+    REQUIRE(cache.find(1) == nullptr);
+    REQUIRE(*cache.find(2) == "two");
+
+    // The freed cost can be used by a new entry without evicting the others.
+    cache.insert(3, "three", 6);
+    REQUIRE(cache.size() == 2);
+    REQUIRE(*cache.find(2) == "two");
+}
+
+};
@@ -0,0 +1,566 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file rope.hpp Defines rope<>.
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <vector>
+#include <span>
+#include <ranges>
+#include <iterator>
+#include <algorithm>
+#include <initializer_list>
+#include <compare>
+#include <utility>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.container.rope);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A sequence for large texts with cheap edits and snapshots.
+ *
+ * The items are stored in small chunks in the leaves of a balanced binary tree.
+ * Inserting, erasing or replacing items anywhere in the sequence is O(log n).
+ *
+ * The nodes of the tree are immutable and shared between copies; copying a
+ * rope is O(1) and a modification only allocates the O(log n) nodes on the path
+ * to the modified chunks. This makes a rope well-suited as a snapshot in an
+ * undo stack.
+ *
+ * The items can not be modified through an iterator or reference; use
+ * `replace()` instead. Modifying the rope invalidates iterators.
+ *
+ * @tparam T The type of the items.
+ */
+template<typename T>
+class rope {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type const&;
+    using const_reference = value_type const&;
+    using pointer = value_type const *;
+    using const_pointer = value_type const *;
+
+    /** The maximum number of items in a chunk.
+     */
+    constexpr static size_type chunk_capacity = std::max(size_type{16}, size_type{512} / sizeof(value_type));
+
+    class const_iterator {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type const *;
+        using reference = value_type const&;
+
+        constexpr const_iterator() noexcept = default;
+        constexpr const_iterator(const_iterator const&) noexcept = default;
+        constexpr const_iterator(const_iterator&&) noexcept = default;
+        constexpr const_iterator& operator=(const_iterator const&) noexcept = default;
+        constexpr const_iterator& operator=(const_iterator&&) noexcept = default;
+
+        constexpr const_iterator(rope const *rope, size_type index) noexcept : _rope(rope), _index(index) {}
+
+        /** The index of the item in the rope.
+         */
+        [[nodiscard]] constexpr size_type index() const noexcept
+        {
+            return _index;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept
+        {
+            hi_axiom_not_null(_rope);
+            if (_index < _chunk_first or _index >= _chunk_last) {
+                // Only look up the chunk when the iterator left the previous chunk.
+                auto const [chunk, chunk_first] = _rope->find_chunk(_index);
+                _chunk = chunk.data();
+                _chunk_first = chunk_first;
+                _chunk_last = chunk_first + chunk.size();
+            }
+            return _chunk[_index - _chunk_first];
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept
+        {
+            return std::addressof(**this);
+        }
+
+        [[nodiscard]] reference operator[](difference_type i) const noexcept
+        {
+            return *(*this + i);
+        }
+
+        constexpr const_iterator& operator++() noexcept
+        {
+            ++_index;
+            return *this;
+        }
+
+        constexpr const_iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++_index;
+            return tmp;
+        }
+
+        constexpr const_iterator& operator--() noexcept
+        {
+            --_index;
+            return *this;
+        }
+
+        constexpr const_iterator operator--(int) noexcept
+        {
+            auto tmp = *this;
+            --_index;
+            return tmp;
+        }
+
+        constexpr const_iterator& operator+=(difference_type n) noexcept
+        {
+            _index += n;
+            return *this;
+        }
+
+        constexpr const_iterator& operator-=(difference_type n) noexcept
+        {
+            _index -= n;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr friend const_iterator operator+(const_iterator lhs, difference_type rhs) noexcept
+        {
+            return lhs += rhs;
+        }
+
+        [[nodiscard]] constexpr friend const_iterator operator+(difference_type lhs, const_iterator rhs) noexcept
+        {
+            return rhs += lhs;
+        }
+
+        [[nodiscard]] constexpr friend const_iterator operator-(const_iterator lhs, difference_type rhs) noexcept
+        {
+            return lhs -= rhs;
+        }
+
+        [[nodiscard]] constexpr friend difference_type operator-(const_iterator const& lhs, const_iterator const& rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs._index) - static_cast<difference_type>(rhs._index);
+        }
+
+        [[nodiscard]] constexpr friend bool operator==(const_iterator const& lhs, const_iterator const& rhs) noexcept
+        {
+            return lhs._index == rhs._index;
+        }
+
+        [[nodiscard]] constexpr friend auto operator<=>(const_iterator const& lhs, const_iterator const& rhs) noexcept
+        {
+            return lhs._index <=> rhs._index;
+        }
+
+    private:
+        rope const *_rope = nullptr;
+        size_type _index = 0;
+
+        /** The chunk that contains the last dereferenced item.
+         */
+        mutable value_type const *_chunk = nullptr;
+        mutable size_type _chunk_first = 0;
+        mutable size_type _chunk_last = 0;
+    };
+
+    using iterator = const_iterator;
+
+    constexpr rope() noexcept = default;
+    constexpr rope(rope const&) noexcept = default;
+    constexpr rope(rope&&) noexcept = default;
+    constexpr rope& operator=(rope const&) noexcept = default;
+    constexpr rope& operator=(rope&&) noexcept = default;
+
+    /** Construct a rope from a range of items.
+     *
+     * @param first An iterator to the first item.
+     * @param last An iterator one beyond the last item.
+     */
+    template<std::input_iterator First, std::sentinel_for<First> Last>
+    rope(First first, Last last) : _root(make_tree(std::vector<value_type>(first, last)))
+    {
+    }
+
+    template<std::ranges::input_range Range>
+        requires(not std::same_as<std::remove_cvref_t<Range>, rope>)
+    explicit rope(Range&& range) : rope(std::ranges::begin(range), std::ranges::end(range))
+    {
+    }
+
+    rope(std::initializer_list<value_type> items) : rope(items.begin(), items.end()) {}
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _root == nullptr;
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return size_of(_root);
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return {this, 0};
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+        return {this, size()};
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    /** Get an item.
+     *
+     * This is O(log n); when iterating use the iterators or `for_each_chunk()`.
+     */
+    [[nodiscard]] const_reference operator[](size_type index) const noexcept
+    {
+        hi_axiom_bounds(index, *this);
+        auto const [chunk, chunk_first] = find_chunk(index);
+        return chunk[index - chunk_first];
+    }
+
+    [[nodiscard]] const_reference at(size_type index) const
+    {
+        if (index >= size()) {
+            throw std::out_of_range("rope::at() index out of range");
+        }
+        return (*this)[index];
+    }
+
+    [[nodiscard]] const_reference front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    [[nodiscard]] const_reference back() const noexcept
+    {
+        return (*this)[size() - 1];
+    }
+
+    /** Call a function for each chunk of consecutive items.
+     *
+     * This is the fastest way to read the items, for example to copy them
+     * into contiguous memory.
+     *
+     * @param func A function called with a `std::span<value_type const>` for each chunk, in order.
+     */
+    template<typename Func>
+    void for_each_chunk(Func&& func) const
+    {
+        for_each_chunk(_root, func);
+    }
+
+    void clear() noexcept
+    {
+        _root = nullptr;
+    }
+
+    /** Get a part of the rope.
+     *
+     * The returned rope shares its chunks with this rope.
+     *
+     * @param index The index of the first item.
+     * @param count The number of items.
+     * @return The items in the range [index, index + count).
+     */
+    [[nodiscard]] rope substr(size_type index, size_type count) const
+    {
+        hi_axiom(index + count <= size());
+        auto r = rope{};
+        r._root = split(split(_root, index).second, count).first;
+        return r;
+    }
+
+    /** Replace items.
+     *
+     * @param index The index of the first item to replace.
+     * @param count The number of items to replace.
+     * @param other The items to insert in their place.
+     */
+    void replace(size_type index, size_type count, rope const& other)
+    {
+        hi_axiom(index + count <= size());
+        auto [left, tmp] = split(_root, index);
+        auto right = split(tmp, count).second;
+        _root = join(join(std::move(left), other._root), std::move(right));
+    }
+
+    template<std::ranges::input_range Range>
+        requires(not std::same_as<std::remove_cvref_t<Range>, rope>)
+    void replace(size_type index, size_type count, Range&& range)
+    {
+        replace(index, count, rope{std::forward<Range>(range)});
+    }
+
+    /** Insert items.
+     *
+     * @param index The index where the items will be inserted.
+     * @param other The items to insert.
+     */
+    void insert(size_type index, rope const& other)
+    {
+        replace(index, 0, other);
+    }
+
+    template<std::ranges::input_range Range>
+        requires(not std::same_as<std::remove_cvref_t<Range>, rope>)
+    void insert(size_type index, Range&& range)
+    {
+        replace(index, 0, std::forward<Range>(range));
+    }
+
+    void insert(size_type index, value_type const& value)
+    {
+        replace(index, 0, rope{value});
+    }
+
+    /** Erase items.
+     *
+     * @param index The index of the first item to erase.
+     * @param count The number of items to erase.
+     */
+    void erase(size_type index, size_type count = 1)
+    {
+        replace(index, count, rope{});
+    }
+
+    void push_back(value_type const& value)
+    {
+        insert(size(), value);
+    }
+
+    void pop_back() noexcept
+    {
+        hi_axiom(not empty());
+        _root = split(_root, size() - 1).first;
+    }
+
+    [[nodiscard]] friend bool operator==(rope const& lhs, rope const& rhs) noexcept
+    {
+        if (lhs._root == rhs._root) {
+            return true;
+        }
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    [[nodiscard]] friend auto operator<=>(rope const& lhs, rope const& rhs) noexcept
+    {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+    /** A node of the tree.
+     *
+     * A leaf holds a chunk of items, an internal node always has two children.
+     */
+    struct node_type {
+        size_type size = 0;
+        uint8_t height = 1;
+        std::shared_ptr<node_type const> left = nullptr;
+        std::shared_ptr<node_type const> right = nullptr;
+        std::vector<value_type> items = {};
+    };
+
+    using node_ptr = std::shared_ptr<node_type const>;
+
+    node_ptr _root = nullptr;
+
+    [[nodiscard]] static size_type size_of(node_ptr const& node) noexcept
+    {
+        return node ? node->size : 0;
+    }
+
+    [[nodiscard]] static uint8_t height_of(node_ptr const& node) noexcept
+    {
+        return node ? node->height : uint8_t{0};
+    }
+
+    [[nodiscard]] static node_ptr make_leaf(std::vector<value_type> items)
+    {
+        hi_axiom(not items.empty());
+        auto const size = items.size();
+        return std::make_shared<node_type const>(node_type{size, uint8_t{1}, nullptr, nullptr, std::move(items)});
+    }
+
+    [[nodiscard]] static node_ptr make_node(node_ptr left, node_ptr right)
+    {
+        hi_axiom_not_null(left);
+        hi_axiom_not_null(right);
+        auto const size = left->size + right->size;
+        auto const height = narrow_cast<uint8_t>(std::max(left->height, right->height) + 1);
+        return std::make_shared<node_type const>(node_type{size, height, std::move(left), std::move(right)});
+    }
+
+    /** Build a balanced tree from items.
+     */
+    [[nodiscard]] static node_ptr make_tree(std::span<value_type const> items)
+    {
+        if (items.empty()) {
+            return nullptr;
+
+        } else if (items.size() <= chunk_capacity) {
+            return make_leaf(std::vector<value_type>(items.begin(), items.end()));
+
+        } else {
+            // Split on a chunk boundary so that all leaves, except the last, are full.
+            auto const num_chunks = (items.size() + chunk_capacity - 1) / chunk_capacity;
+            auto const split_index = (num_chunks + 1) / 2 * chunk_capacity;
+            return make_node(make_tree(items.first(split_index)), make_tree(items.subspan(split_index)));
+        }
+    }
+
+    /** Combine two trees whose heights differ by at most two.
+     */
+    [[nodiscard]] static node_ptr balance(node_ptr left, node_ptr right)
+    {
+        if (height_of(left) > height_of(right) + 1) {
+            if (height_of(left->left) >= height_of(left->right)) {
+                return make_node(left->left, make_node(left->right, std::move(right)));
+            } else {
+                return make_node(
+                    make_node(left->left, left->right->left), make_node(left->right->right, std::move(right)));
+            }
+
+        } else if (height_of(right) > height_of(left) + 1) {
+            if (height_of(right->right) >= height_of(right->left)) {
+                return make_node(make_node(std::move(left), right->left), right->right);
+            } else {
+                return make_node(
+                    make_node(std::move(left), right->left->left), make_node(right->left->right, right->right));
+            }
+
+        } else {
+            return make_node(std::move(left), std::move(right));
+        }
+    }
+
+    /** Concatenate two trees.
+     *
+     * This is O(|height(left) - height(right)|).
+     */
+    [[nodiscard]] static node_ptr join(node_ptr left, node_ptr right)
+    {
+        if (not left) {
+            return right;
+        } else if (not right) {
+            return left;
+
+        } else if (left->height == 1 and right->height == 1 and left->size + right->size <= chunk_capacity) {
+            // Merge small chunks to keep the tree shallow after many small edits.
+            auto items = std::vector<value_type>{};
+            items.reserve(left->size + right->size);
+            items.insert(items.end(), left->items.begin(), left->items.end());
+            items.insert(items.end(), right->items.begin(), right->items.end());
+            return make_leaf(std::move(items));
+
+        } else if (left->height > right->height + 1) {
+            return balance(left->left, join(left->right, std::move(right)));
+
+        } else if (right->height > left->height + 1) {
+            return balance(join(std::move(left), right->left), right->right);
+
+        } else {
+            return make_node(std::move(left), std::move(right));
+        }
+    }
+
+    /** Split a tree.
+     *
+     * @param node The tree to split.
+     * @param index The number of items in the first tree.
+     * @return The trees with the items before and after @a index.
+     */
+    [[nodiscard]] static std::pair<node_ptr, node_ptr> split(node_ptr const& node, size_type index)
+    {
+        hi_axiom(index <= size_of(node));
+
+        if (index == 0) {
+            return {nullptr, node};
+
+        } else if (index == node->size) {
+            return {node, nullptr};
+
+        } else if (node->height == 1) {
+            auto const split_it = node->items.begin() + index;
+            return {
+                make_leaf(std::vector<value_type>(node->items.begin(), split_it)),
+                make_leaf(std::vector<value_type>(split_it, node->items.end()))};
+
+        } else if (index <= node->left->size) {
+            auto [left, right] = split(node->left, index);
+            return {std::move(left), join(std::move(right), node->right)};
+
+        } else {
+            auto [left, right] = split(node->right, index - node->left->size);
+            return {join(node->left, std::move(left)), std::move(right)};
+        }
+    }
+
+    /** Find the chunk that contains an item.
+     *
+     * @param index The index of the item.
+     * @return The chunk, and the index of the first item of the chunk.
+     */
+    [[nodiscard]] std::pair<std::span<value_type const>, size_type> find_chunk(size_type index) const noexcept
+    {
+        hi_axiom(index < size());
+
+        auto chunk_first = size_type{0};
+        auto node = _root.get();
+        while (node->height != 1) {
+            if (index < node->left->size) {
+                node = node->left.get();
+            } else {
+                index -= node->left->size;
+                chunk_first += node->left->size;
+                node = node->right.get();
+            }
+        }
+        return {std::span<value_type const>{node->items}, chunk_first};
+    }
+
+    template<typename Func>
+    static void for_each_chunk(node_ptr const& node, Func& func)
+    {
+        if (not node) {
+            return;
+        } else if (node->height == 1) {
+            func(std::span<value_type const>{node->items});
+        } else {
+            for_each_chunk(node->left, func);
+            for_each_chunk(node->right, func);
+        }
+    }
+};
+
+}} // namespace hi::v1
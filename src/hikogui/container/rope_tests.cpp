@@ -0,0 +1,121 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "rope.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <iterator>
+
+TEST_SUITE(rope) {
+
+TEST_CASE(construct)
+{
+    auto r = hi::rope<char>{};
+    REQUIRE(r.empty());
+    REQUIRE(r.size() == 0);
+    REQUIRE(r.begin() == r.end());
+
+    auto const str = std::string(10'000, 'x');
+    r = hi::rope<char>{str};
+    REQUIRE(r.size() == 10'000);
+    REQUIRE(std::string(r.begin(), r.end()) == str);
+}
+
+TEST_CASE(insert_erase)
+{
+    auto r = hi::rope<char>{std::string{"hello world"}};
+    r.insert(5, std::string{","});
+    REQUIRE(std::string(r.begin(), r.end()) == "hello, world");
+
+    r.erase(0, 7);
+    REQUIRE(std::string(r.begin(), r.end()) == "world");
+
+    r.replace(0, 1, std::string{"W"});
+    r.push_back('!');
+    REQUIRE(std::string(r.begin(), r.end()) == "World!");
+    REQUIRE(r.front() == 'W');
+    REQUIRE(r.back() == '!');
+
+    r.pop_back();
+    REQUIRE(r.size() == 5);
+    REQUIRE(r.at(4) == 'd');
+    REQUIRE_THROWS(r.at(5), std::out_of_range);
+}
+
+TEST_CASE(snapshot)
+{
+    auto r = hi::rope<int>{};
+    for (auto i = 0; i != 10'000; ++i) {
+        r.push_back(i);
+    }
+
+    auto const snapshot = r;
+    r.erase(10, 5000);
+    r.insert(0, 42);
+
+    REQUIRE(snapshot.size() == 10'000);
+    REQUIRE(snapshot[5000] == 5000);
+    REQUIRE(r.size() == 5001);
+    REQUIRE(r[0] == 42);
+    REQUIRE(r[10] == 9);
+    REQUIRE(r[11] == 5010);
+
+    REQUIRE(r.substr(10, 3) == (hi::rope<int>{9, 5010, 5011}));
+}
+
+TEST_CASE(algorithms)
+{
+    auto const str = std::string{"the quick brown fox jumps over the lazy dog"};
+    auto r = hi::rope<char>{str};
+    REQUIRE(std::ranges::equal(r, str));
+
+    auto const other = std::string{"the quick red fox jumps over the lazy dog"};
+    REQUIRE(not std::ranges::equal(r, other));
+
+    // The common prefix and suffix, as used by text_widget to find the modified characters.
+    auto const prefix = std::distance(r.begin(), std::mismatch(r.begin(), r.end(), other.begin(), other.end()).first);
+    REQUIRE(prefix == 10);
+
+    auto const suffix = std::distance(
+        std::make_reverse_iterator(r.end()),
+        std::mismatch(std::make_reverse_iterator(r.end()), std::make_reverse_iterator(r.begin() + prefix), other.rbegin()).first);
+    REQUIRE(suffix == 28);
+
+    REQUIRE(std::string(r.begin() + prefix, r.end() - suffix) == "brown");
+}
+
+TEST_CASE(random_edits)
+{
+    auto engine = std::mt19937{42};
+    auto r = hi::rope<int>{};
+    auto v = std::vector<int>{};
+
+    for (auto i = 0; i != 2000; ++i) {
+        auto const index = std::uniform_int_distribution<std::size_t>{0, v.size()}(engine);
+        if (v.size() > 0 and engine() % 3 == 0) {
+            auto const count = std::min(v.size() - index, std::size_t{engine() % 100});
+            r.erase(index, count);
+            v.erase(v.begin() + index, v.begin() + index + count);
+        } else {
+            auto const items = std::vector<int>(engine() % 200, i);
+            r.insert(index, items);
+            v.insert(v.begin() + index, items.begin(), items.end());
+        }
+        REQUIRE(r.size() == v.size());
+    }
+
+    REQUIRE(std::equal(r.begin(), r.end(), v.begin(), v.end()));
+
+    auto chunked = std::vector<int>{};
+    r.for_each_chunk([&](auto chunk) {
+        REQUIRE(chunk.size() <= hi::rope<int>::chunk_capacity);
+        chunked.insert(chunked.end(), chunk.begin(), chunk.end());
+    });
+    REQUIRE(chunked == v);
+}
+
+};
@@ -0,0 +1,161 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file shared_bstring.hpp Defines shared_bstring.
+ */
+
+#pragma once
+
+#include "byte_string.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <span>
+#include <compare>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+
+hi_export_module(hikogui.container.shared_bstring);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A reference counted, immutable view of bytes.
+ *
+ * The bytes are owned by a shared object, which may be a `bstring`, a
+ * memory-mapped file or any other object that holds the bytes. Copying or
+ * slicing a shared_bstring does not copy the bytes; the owner stays alive
+ * as long as any shared_bstring refers to it.
+ */
+class shared_bstring {
+public:
+    using value_type = std::byte;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = std::byte const&;
+    using reference = const_reference;
+    using const_pointer = std::byte const *;
+    using pointer = const_pointer;
+    using const_iterator = bstring_view::const_iterator;
+    using iterator = const_iterator;
+
+    constexpr static size_type npos = bstring_view::npos;
+
+    constexpr shared_bstring() noexcept = default;
+    shared_bstring(shared_bstring const&) noexcept = default;
+    shared_bstring(shared_bstring&&) noexcept = default;
+    shared_bstring& operator=(shared_bstring const&) noexcept = default;
+    shared_bstring& operator=(shared_bstring&&) noexcept = default;
+
+    /** Take ownership of a byte string.
+     *
+     * @param str The bytes, moved into a shared allocation.
+     */
+    explicit shared_bstring(bstring str) : _owner(std::make_shared<bstring const>(std::move(str)))
+    {
+        _view = *std::static_pointer_cast<bstring const>(_owner);
+    }
+
+    /** Refer to bytes owned by another object.
+     *
+     * @param owner The object that keeps the bytes alive.
+     * @param view The bytes owned by @a owner.
+     */
+    shared_bstring(std::shared_ptr<void const> owner, bstring_view view) noexcept : _owner(std::move(owner)), _view(view) {}
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _view.empty();
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return _view.size();
+    }
+
+    [[nodiscard]] constexpr const_pointer data() const noexcept
+    {
+        return _view.data();
+    }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept
+    {
+        return _view.begin();
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept
+    {
+        return _view.end();
+    }
+
+    [[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
+    {
+        hi_axiom_bounds(index, _view);
+        return _view[index];
+    }
+
+    [[nodiscard]] constexpr bstring_view view() const noexcept
+    {
+        return _view;
+    }
+
+    [[nodiscard]] constexpr operator bstring_view() const noexcept
+    {
+        return _view;
+    }
+
+    [[nodiscard]] constexpr std::span<std::byte const> span() const noexcept
+    {
+        return {_view.data(), _view.size()};
+    }
+
+    /** The number of shared_bstrings, and other objects, that share the owner.
+     */
+    [[nodiscard]] long use_count() const noexcept
+    {
+        return _owner.use_count();
+    }
+
+    /** Get a slice of the bytes.
+     *
+     * The slice shares the owner with this.
+     *
+     * @param pos The index of the first byte.
+     * @param count The number of bytes, or up to the end when larger than the remaining bytes.
+     * @return The slice.
+     * @throw std::out_of_range When @a pos is beyond the end.
+     */
+    [[nodiscard]] shared_bstring substr(size_type pos, size_type count = npos) const
+    {
+        return {_owner, _view.substr(pos, count)};
+    }
+
+    /** Copy the bytes into a new byte string.
+     */
+    [[nodiscard]] bstring str() const
+    {
+        return bstring{_view};
+    }
+
+    [[nodiscard]] friend bool operator==(shared_bstring const& lhs, shared_bstring const& rhs) noexcept
+    {
+        return lhs._view == rhs._view;
+    }
+
+    [[nodiscard]] friend bool operator==(shared_bstring const& lhs, bstring_view rhs) noexcept
+    {
+        return lhs._view == rhs;
+    }
+
+    [[nodiscard]] friend std::strong_ordering operator<=>(shared_bstring const& lhs, shared_bstring const& rhs) noexcept
+    {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+    std::shared_ptr<void const> _owner = nullptr;
+    bstring_view _view = {};
+};
+
+}} // namespace hi::v1
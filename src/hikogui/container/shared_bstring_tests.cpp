@@ -0,0 +1,51 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "shared_bstring.hpp"
+#include <hikotest/hikotest.hpp>
+#include <memory>
+#include <array>
+
+TEST_SUITE(shared_bstring) {
+
+TEST_CASE(own_bstring)
+{
+    auto const a = hi::shared_bstring{hi::to_bstring("hello world")};
+    REQUIRE(a.size() == 11);
+    REQUIRE(a.use_count() == 1);
+    REQUIRE(a == hi::to_bstring("hello world"));
+
+    auto const b = a;
+    REQUIRE(a.use_count() == 2);
+    REQUIRE(b.data() == a.data());
+}
+
+TEST_CASE(substr)
+{
+    auto b = hi::shared_bstring{};
+    {
+        auto const a = hi::shared_bstring{hi::to_bstring("hello world")};
+        b = a.substr(6);
+        REQUIRE(b.data() == a.data() + 6);
+    }
+
+    // The slice keeps the bytes alive.
+    REQUIRE(b.use_count() == 1);
+    REQUIRE(b == hi::to_bstring("world"));
+    REQUIRE(b.substr(1, 3) == hi::to_bstring("orl"));
+    REQUIRE(b.substr(1, 3).str() == hi::to_bstring("orl"));
+    REQUIRE(b[0] == std::byte{'w'});
+    REQUIRE_THROWS(b.substr(6), std::out_of_range);
+}
+
+TEST_CASE(foreign_owner)
+{
+    auto const owner = std::make_shared<std::array<std::byte, 4>>(std::array{std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}});
+    auto const a = hi::shared_bstring{owner, hi::bstring_view{owner->data(), owner->size()}};
+    REQUIRE(owner.use_count() == 2);
+    REQUIRE(a.substr(2) == hi::to_bstring(3, 4));
+    REQUIRE(a < a.substr(1));
+}
+
+};
@@ -13,6 +13,10 @@
 #include <map>
 #include <unordered_map>
 #include <functional>
+#include <array>
+#include <bit>
+#include <utility>
+#include <cstddef>
 
 hi_export_module(hikogui.container.stable_set);
 
@@ -27,6 +31,11 @@ hi_export namespace hi::inline v1 {
  *
  * Another use case is for `text_style` objects which only hold an index while
  * the `actual_text_style`  objects are stored in the stable_set.
+ *
+ * Reading is wait-free; `size()`, `empty()` and `operator[]` do not take the lock.
+ * The pointers to the objects are stored in chunks that are never moved or freed
+ * while the set exists, each chunk twice as large as the previous one. A new
+ * object is published by a release-store of the size. Only inserting takes the lock.
  */
 template<typename Key>
 class stable_set {
@@ -44,7 +53,13 @@ public:
     using pointer = value_type const *;
     using const_pointer = value_type const *;
 
-    ~stable_set() = default;
+    ~stable_set()
+    {
+        for (auto& chunk : _chunks) {
+            delete[] chunk.load(std::memory_order::relaxed);
+        }
+    }
+
     constexpr stable_set() noexcept = default;
     stable_set(stable_set const&) = delete;
     stable_set(stable_set&&) = delete;
@@ -53,8 +68,7 @@ public:
 
     [[nodiscard]] size_t size() const noexcept
     {
-        auto const lock = std::scoped_lock(_mutex);
-        return _vector.size();
+        return _size.load(std::memory_order::acquire);
     }
 
     [[nodiscard]] bool empty() const noexcept
@@ -75,9 +89,12 @@ public:
      */
     [[nodiscard]] const_reference operator[](size_t index) const noexcept
     {
-        auto const lock = std::scoped_lock(_mutex);
-        hi_assert_bounds(index, _vector);
-        return *_vector[index];
+        hi_assert_bounds(index, size());
+
+        auto const [chunk_index, offset] = chunk_location(index);
+        auto const *const chunk = _chunks[chunk_index].load(std::memory_order::acquire);
+        hi_axiom_not_null(chunk);
+        return *chunk[offset].load(std::memory_order::acquire);
     }
 
     /** Insert an object into the stable-set.
@@ -94,9 +111,9 @@ public:
     {
         auto const lock = std::scoped_lock(_mutex);
 
-        auto const[it, is_inserted] = _map.emplace(std::forward<Arg>(arg), _vector.size());
+        auto const[it, is_inserted] = _map.emplace(std::forward<Arg>(arg), _size.load(std::memory_order::relaxed));
         if (is_inserted) {
-            _vector.push_back(std::addressof(it->first));
+            push_back(std::addressof(it->first));
         }
         return it->second;
     }
@@ -115,19 +132,56 @@ public:
     {
         auto const lock = std::scoped_lock(_mutex);
 
-        auto const[it, is_inserted] = _map.emplace(value_type{std::forward<Args>(args)...}, _vector.size());
+        auto const[it, is_inserted] = _map.emplace(value_type{std::forward<Args>(args)...}, _size.load(std::memory_order::relaxed));
         if (is_inserted) {
-            _vector.push_back(std::addressof(it->first));
+            push_back(std::addressof(it->first));
         }
         return it->second;
     }
 
 private:
-    // clang-format sucks.
-    using vector_type = std::vector<const_pointer>;
+    /** The number of objects in the first chunk; each next chunk is twice as large.
+     */
+    constexpr static size_t first_chunk_size = 32;
+    constexpr static size_t num_chunks = 64 - std::countr_zero(first_chunk_size);
 
-    vector_type _vector;
+    using chunk_type = std::atomic<const_pointer>;
+
+    std::array<std::atomic<chunk_type *>, num_chunks> _chunks = {};
+    std::atomic<size_t> _size = 0;
     map_type _map;
     mutable unfair_mutex _mutex;
+
+    /** Get the chunk and the offset in the chunk of an index.
+     */
+    [[nodiscard]] constexpr static std::pair<size_t, size_t> chunk_location(size_t index) noexcept
+    {
+        // Chunk `i` starts at index `first_chunk_size * (2^i - 1)`.
+        auto const chunk_index = narrow_cast<size_t>(std::bit_width(index / first_chunk_size + 1)) - 1;
+        auto const chunk_start = first_chunk_size * ((size_t{1} << chunk_index) - 1);
+        return {chunk_index, index - chunk_start};
+    }
+
+    /** Append a pointer to an object and publish it to the readers.
+     *
+     * @note Must be called with `_mutex` locked.
+     */
+    void push_back(const_pointer ptr) noexcept
+    {
+        hi_axiom(_mutex.is_locked());
+
+        auto const index = _size.load(std::memory_order::relaxed);
+        auto const [chunk_index, offset] = chunk_location(index);
+        hi_axiom(chunk_index < num_chunks);
+
+        auto *chunk = _chunks[chunk_index].load(std::memory_order::relaxed);
+        if (chunk == nullptr) {
+            chunk = new chunk_type[first_chunk_size << chunk_index];
+            _chunks[chunk_index].store(chunk, std::memory_order::release);
+        }
+
+        chunk[offset].store(ptr, std::memory_order::release);
+        _size.store(index + 1, std::memory_order::release);
+    }
 };
 } // namespace hi::inline v1
@@ -0,0 +1,80 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "stable_set.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+TEST_SUITE(stable_set) {
+
+TEST_CASE(insert)
+{
+    auto set = hi::stable_set<std::string>{};
+    REQUIRE(set.empty());
+
+    REQUIRE(set.insert(std::string{"foo"}) == 0);
+    REQUIRE(set.insert(std::string{"bar"}) == 1);
+    REQUIRE(set.insert(std::string{"foo"}) == 0);
+    REQUIRE(set.emplace("baz") == 2);
+    REQUIRE(set.size() == 3);
+
+    REQUIRE(set[0] == "foo");
+    REQUIRE(set[1] == "bar");
+    REQUIRE(set[2] == "baz");
+}
+
+TEST_CASE(many_chunks)
+{
+    auto set = hi::stable_set<std::string>{};
+
+    // Fill multiple chunks, the objects must not move.
+    auto pointers = std::vector<std::string const *>{};
+    for (auto i = 0; i != 10'000; ++i) {
+        auto const index = set.insert(std::to_string(i));
+        REQUIRE(index == static_cast<std::size_t>(i));
+        pointers.push_back(&set[index]);
+    }
+
+    REQUIRE(set.size() == 10'000);
+    for (auto i = 0; i != 10'000; ++i) {
+        REQUIRE(set[i] == std::to_string(i));
+        REQUIRE(&set[i] == pointers[i]);
+    }
+}
+
+TEST_CASE(concurrent_read)
+{
+    auto set = hi::stable_set<std::string>{};
+    auto done = std::atomic<bool>{false};
+    auto mismatches = std::atomic<int>{0};
+
+    auto readers = std::vector<std::jthread>{};
+    for (auto i = 0; i != 4; ++i) {
+        readers.emplace_back([&] {
+            while (not done.load()) {
+                // Every object that is counted by size() must be readable.
+                auto const size = set.size();
+                for (auto j = std::size_t{0}; j < size; j += 97) {
+                    if (set[j] != std::to_string(j)) {
+                        mismatches.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto i = 0; i != 20'000; ++i) {
+        [[maybe_unused]] auto const index = set.insert(std::to_string(i));
+    }
+    done.store(true);
+    readers.clear();
+
+    REQUIRE(mismatches.load() == 0);
+    REQUIRE(set.size() == 20'000);
+}
+
+};
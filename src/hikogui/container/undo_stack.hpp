@@ -6,28 +6,144 @@
 
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
-#include <vector>
+#include <deque>
+#include <variant>
+#include <optional>
+#include <string>
+#include <chrono>
+#include <limits>
+#include <algorithm>
+#include <utility>
 #include <cstddef>
 
 hi_export_module(hikogui.container.undo_stack);
 
 hi_export namespace hi::inline v1 {
 
+/** How the states of an undo_stack are stored.
+ *
+ * The default stores a full copy of each state. A specialization may store
+ * the difference between consecutive states, it must define:
+ *  - `delta_type`: The difference between two states, or `std::monostate` for full copies.
+ *  - `make_delta(from, to)`: The difference to get from state @a from to state @a to.
+ *  - `apply_delta(state, delta)`: Modify @a state by applying @a delta to it.
+ *  - `size_of(state)` and `size_of(delta)`: The approximate memory used, in bytes.
+ */
 template<typename T>
+struct undo_traits {
+    using delta_type = std::monostate;
+
+    [[nodiscard]] constexpr static std::size_t size_of(T const&) noexcept
+    {
+        return sizeof(T);
+    }
+};
+
+/** The difference between two strings.
+ *
+ * The common prefix and suffix are retained, the middle part is replaced.
+ */
+template<typename CharT, typename Traits, typename Allocator>
+struct basic_string_undo_delta {
+    std::size_t prefix = 0;
+    std::size_t suffix = 0;
+    std::basic_string<CharT, Traits, Allocator> middle = {};
+};
+
+template<typename CharT, typename Traits, typename Allocator>
+struct undo_traits<std::basic_string<CharT, Traits, Allocator>> {
+    using value_type = std::basic_string<CharT, Traits, Allocator>;
+    using delta_type = basic_string_undo_delta<CharT, Traits, Allocator>;
+
+    [[nodiscard]] constexpr static delta_type make_delta(value_type const& from, value_type const& to) noexcept
+    {
+        auto const max_prefix = std::min(from.size(), to.size());
+        auto const prefix = narrow_cast<std::size_t>(
+            std::distance(from.begin(), std::mismatch(from.begin(), from.begin() + max_prefix, to.begin()).first));
+
+        auto const max_suffix = max_prefix - prefix;
+        auto const suffix = narrow_cast<std::size_t>(
+            std::distance(from.rbegin(), std::mismatch(from.rbegin(), from.rbegin() + max_suffix, to.rbegin()).first));
+
+        return {prefix, suffix, to.substr(prefix, to.size() - prefix - suffix)};
+    }
+
+    constexpr static void apply_delta(value_type& state, delta_type const& delta) noexcept
+    {
+        hi_axiom(delta.prefix + delta.suffix <= state.size());
+        state.replace(delta.prefix, state.size() - delta.prefix - delta.suffix, delta.middle);
+    }
+
+    [[nodiscard]] constexpr static std::size_t size_of(value_type const& rhs) noexcept
+    {
+        return sizeof(value_type) + rhs.size() * sizeof(CharT);
+    }
+
+    [[nodiscard]] constexpr static std::size_t size_of(delta_type const& rhs) noexcept
+    {
+        return sizeof(delta_type) + rhs.middle.size() * sizeof(CharT);
+    }
+};
+
+/** A stack of states for undo and redo.
+ *
+ * The memory of the stack is bounded by both the number of states and an
+ * approximate byte budget; the oldest states are evicted first.
+ *
+ * When the traits define a `delta_type` only every `keyframe_interval`-th
+ * state is stored in full, the states in between are stored as the difference
+ * with the previous state.
+ *
+ * States that are pushed in rapid succession, within the coalesce duration
+ * of the previous stored state, are merged into a single undo step.
+ *
+ * @tparam T The type of the state.
+ * @tparam Traits How the states are stored, see `undo_traits`.
+ */
+template<typename T, typename Traits = undo_traits<T>>
 class undo_stack {
 public:
     using value_type = T;
+    using traits_type = Traits;
+    using delta_type = traits_type::delta_type;
+    using clock_type = std::chrono::steady_clock;
+
+    /** The maximum number of deltas between two full states.
+     */
+    constexpr static std::size_t keyframe_interval = 16;
 
-    constexpr undo_stack(undo_stack const &) noexcept = default;
-    constexpr undo_stack(undo_stack &&) noexcept = default;
-    constexpr undo_stack &operator=(undo_stack const &) noexcept = default;
-    constexpr undo_stack &operator=(undo_stack &&) noexcept = default;
-    constexpr undo_stack(size_t max_depth) noexcept : _stack{}, _max_depth(max_depth), _cursor(0) {}
+    constexpr undo_stack(undo_stack const&) noexcept = default;
+    constexpr undo_stack(undo_stack&&) noexcept = default;
+    constexpr undo_stack& operator=(undo_stack const&) noexcept = default;
+    constexpr undo_stack& operator=(undo_stack&&) noexcept = default;
+
+    /** Create an undo stack.
+     *
+     * @param max_depth The maximum number of states.
+     * @param max_bytes The approximate maximum memory used by the states.
+     * @param coalesce_duration States pushed within this duration after the previous
+     *        stored state are not stored; zero stores every state.
+     */
+    constexpr undo_stack(
+        size_t max_depth,
+        size_t max_bytes = std::numeric_limits<size_t>::max(),
+        clock_type::duration coalesce_duration = clock_type::duration::zero()) noexcept :
+        _stack{}, _max_depth(max_depth), _max_bytes(max_bytes), _coalesce_duration(coalesce_duration), _cursor(0)
+    {
+        hi_axiom(max_depth != 0);
+    }
 
     template<typename... Args>
-    constexpr void emplace(Args &&... args) noexcept
+    constexpr void emplace(Args&&...args) noexcept
     {
+        auto const now = clock_type::now();
+        if (_first_undo and _cursor == _stack.size() and not _stack.empty() and now - _push_time < _coalesce_duration) {
+            // Part of a rapid sequence of edits, undo will return to the state before the sequence.
+            return;
+        }
+
         push(value_type{std::forward<Args>(args)...});
+        _push_time = now;
     }
 
     [[nodiscard]] constexpr bool can_undo() const noexcept
@@ -36,7 +152,7 @@ public:
     }
 
     template<typename... Args>
-    [[nodiscard]] constexpr value_type const &undo(Args &&...args) noexcept
+    [[nodiscard]] constexpr value_type const& undo(Args&&...args) noexcept
     {
         hi_assert(can_undo());
         if (_first_undo) {
@@ -47,7 +163,7 @@ public:
             --_cursor;
             _first_undo = false;
         }
-        return _stack[--_cursor];
+        return get(--_cursor);
     }
 
     [[nodiscard]] constexpr bool can_redo() const noexcept
@@ -55,34 +171,165 @@ public:
         return (_cursor + 1) < _stack.size();
     }
 
-    [[nodiscard]] constexpr value_type const &redo() const noexcept
+    [[nodiscard]] constexpr value_type const& redo() const noexcept
     {
         hi_assert(can_redo());
-        return _stack[++_cursor];
+        return get(++_cursor);
+    }
+
+    /** The number of states on the stack.
+     */
+    [[nodiscard]] constexpr size_t size() const noexcept
+    {
+        return _stack.size();
+    }
+
+    /** The approximate memory used by the states on the stack.
+     */
+    [[nodiscard]] constexpr size_t size_in_bytes() const noexcept
+    {
+        return _num_bytes;
     }
 
 private:
-    std::vector<value_type> _stack;
+    constexpr static bool has_delta = not std::is_same_v<delta_type, std::monostate>;
+
+    using entry_type = std::conditional_t<has_delta, std::variant<value_type, delta_type>, value_type>;
+
+    std::deque<entry_type> _stack;
     size_t _max_depth;
+    size_t _max_bytes;
+    clock_type::duration _coalesce_duration;
+    clock_type::time_point _push_time = {};
+    size_t _num_bytes = 0;
     mutable size_t _cursor;
     mutable bool _first_undo = true;
 
+    /** The last state returned by `get()`, reconstructed from the deltas.
+     */
+    mutable std::optional<value_type> _state = std::nullopt;
+
+    /** The index of the state in `_state`, or max when invalid.
+     */
+    mutable size_t _state_index = std::numeric_limits<size_t>::max();
+
+    [[nodiscard]] constexpr static size_t size_of(entry_type const& entry) noexcept
+    {
+        if constexpr (has_delta) {
+            return std::visit(
+                [](auto const& item) {
+                    return traits_type::size_of(item);
+                },
+                entry);
+        } else {
+            return traits_type::size_of(entry);
+        }
+    }
+
+    /** Get a state.
+     *
+     * @param index The index of the state on the stack.
+     * @return A reference to the state, valid until the next modification or get.
+     */
+    [[nodiscard]] constexpr value_type const& get(size_t index) const noexcept
+    {
+        hi_assert_bounds(index, _stack.size());
+
+        if constexpr (has_delta) {
+            if (_state_index == index) {
+                return *_state;
+            }
+
+            // Apply forward from the last state in `_state`, or from the nearest keyframe.
+            auto i = index;
+            if (_state_index < index and index - _state_index <= keyframe_interval) {
+                i = _state_index;
+            } else {
+                while (not std::holds_alternative<value_type>(_stack[i])) {
+                    hi_axiom(i != 0);
+                    --i;
+                }
+                _state = std::get<value_type>(_stack[i]);
+            }
+
+            while (i != index) {
+                if (auto const *delta = std::get_if<delta_type>(&_stack[++i])) {
+                    traits_type::apply_delta(*_state, *delta);
+                } else {
+                    _state = std::get<value_type>(_stack[i]);
+                }
+            }
+            _state_index = index;
+            return *_state;
+
+        } else {
+            return _stack[index];
+        }
+    }
+
+    /** The number of deltas since the last full state at the top of the stack.
+     */
+    [[nodiscard]] constexpr size_t num_deltas() const noexcept
+    {
+        auto r = 0_uz;
+        for (auto it = _stack.rbegin(); it != _stack.rend() and not std::holds_alternative<value_type>(*it); ++it) {
+            ++r;
+        }
+        return r;
+    }
+
+    constexpr void pop_front() noexcept
+    {
+        hi_axiom(not _stack.empty());
+
+        if constexpr (has_delta) {
+            if (_stack.size() > 1 and std::holds_alternative<delta_type>(_stack[1])) {
+                // The next state becomes the first, so it must be stored in full.
+                auto state = get(1);
+                _num_bytes -= size_of(_stack[1]);
+                _stack[1] = std::move(state);
+                _num_bytes += size_of(_stack[1]);
+            }
+            _state_index = std::numeric_limits<size_t>::max();
+        }
+
+        _num_bytes -= size_of(_stack.front());
+        _stack.pop_front();
+        --_cursor;
+    }
+
     template<forward_of<value_type> Value>
-    constexpr void push(Value &&value) noexcept
+    constexpr void push(Value&& value) noexcept
     {
         hi_assert(_cursor <= _stack.size());
-        _stack.erase(_stack.begin() + _cursor, _stack.end());
-
-        if (_stack.size() > _max_depth) {
-            _stack.erase(_stack.begin());
+        while (_stack.size() > _cursor) {
+            _num_bytes -= size_of(_stack.back());
+            _stack.pop_back();
+        }
+        if constexpr (has_delta) {
+            if (_state_index >= _stack.size()) {
+                _state_index = std::numeric_limits<size_t>::max();
+            }
         }
 
-        _stack.push_back(std::forward<Value>(value));
+        if constexpr (has_delta) {
+            if (not _stack.empty() and num_deltas() + 1 < keyframe_interval) {
+                _stack.push_back(traits_type::make_delta(get(_stack.size() - 1), value));
+            } else {
+                _stack.push_back(std::forward<Value>(value));
+            }
+        } else {
+            _stack.push_back(std::forward<Value>(value));
+        }
+        _num_bytes += size_of(_stack.back());
         _cursor = _stack.size();
 
+        while (_stack.size() > 1 and (_stack.size() > _max_depth or _num_bytes > _max_bytes)) {
+            pop_front();
+        }
+
         _first_undo = true;
     }
 };
 
-
-}
+} // namespace hi::inline v1
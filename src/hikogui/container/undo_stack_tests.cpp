@@ -0,0 +1,98 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "undo_stack.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <chrono>
+#include <limits>
+
+TEST_SUITE(undo_stack) {
+
+TEST_CASE(undo_redo)
+{
+    auto stack = hi::undo_stack<int>{10};
+    REQUIRE(not stack.can_undo());
+
+    stack.emplace(1);
+    stack.emplace(2);
+    REQUIRE(stack.can_undo());
+    REQUIRE(stack.undo(3) == 2);
+    REQUIRE(stack.undo(3) == 1);
+    REQUIRE(not stack.can_undo());
+
+    REQUIRE(stack.can_redo());
+    REQUIRE(stack.redo() == 2);
+    REQUIRE(stack.redo() == 3);
+    REQUIRE(not stack.can_redo());
+}
+
+TEST_CASE(max_depth)
+{
+    auto stack = hi::undo_stack<int>{3};
+    for (auto i = 0; i != 10; ++i) {
+        stack.emplace(i);
+    }
+    REQUIRE(stack.size() == 3);
+    REQUIRE(stack.undo(10) == 9);
+    REQUIRE(stack.undo(10) == 8);
+    REQUIRE(not stack.can_undo());
+}
+
+TEST_CASE(string_delta)
+{
+    auto stack = hi::undo_stack<std::string>{1000};
+
+    auto text = std::string(1000, 'x');
+    auto full_copies_size = std::size_t{0};
+    for (auto i = 0; i != 100; ++i) {
+        stack.emplace(text);
+        full_copies_size += sizeof(std::string) + text.size();
+        text.insert(text.size() / 2, 1, static_cast<char>('a' + i % 26));
+    }
+    auto const final_text = text;
+
+    // Most states only store the inserted character.
+    REQUIRE(stack.size_in_bytes() < full_copies_size / 4);
+
+    for (auto i = 99; i >= 0; --i) {
+        REQUIRE(stack.can_undo());
+        text = stack.undo(final_text);
+        REQUIRE(text.size() == static_cast<std::size_t>(1000 + i));
+    }
+    REQUIRE(not stack.can_undo());
+
+    for (auto i = 1; i != 100; ++i) {
+        REQUIRE(stack.redo().size() == static_cast<std::size_t>(1000 + i));
+    }
+    REQUIRE(stack.redo() == final_text);
+}
+
+TEST_CASE(byte_budget)
+{
+    auto stack = hi::undo_stack<std::string>{1000, 10'000};
+
+    for (auto i = 0; i != 100; ++i) {
+        stack.emplace(std::string(1000, static_cast<char>('a' + i % 26)));
+    }
+    REQUIRE(stack.size_in_bytes() <= 10'000);
+    REQUIRE(stack.size() < 10);
+    REQUIRE(stack.undo(std::string{}) == std::string(1000, static_cast<char>('a' + 99 % 26)));
+}
+
+TEST_CASE(coalesce)
+{
+    using namespace std::literals;
+
+    auto stack = hi::undo_stack<int>{10, std::numeric_limits<size_t>::max(), 1h};
+
+    stack.emplace(1);
+    stack.emplace(2);
+    stack.emplace(3);
+    REQUIRE(stack.size() == 1);
+    REQUIRE(stack.undo(4) == 1);
+    REQUIRE(not stack.can_undo());
+}
+
+};
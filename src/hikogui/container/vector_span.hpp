@@ -191,6 +191,13 @@ public:
         return std::distance(_begin, _end);
     }
 
+    /** The maximum number of elements that fit in the span.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return std::distance(_begin, _max);
+    }
+
     [[nodiscard]] value_type &operator[](std::size_t i) noexcept
     {
         hi_assert_bounds(i, *this);
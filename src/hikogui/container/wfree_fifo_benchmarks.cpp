@@ -0,0 +1,90 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "wfree_fifo.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <cstddef>
+
+using hi::operator""_uz;
+
+namespace wfree_fifo_benchmarks {
+
+struct message_base {
+    virtual ~message_base() = default;
+    [[nodiscard]] virtual std::size_t value() const noexcept = 0;
+};
+
+struct message : message_base {
+    std::size_t payload;
+
+    message(std::size_t x) noexcept : payload(x) {}
+
+    [[nodiscard]] std::size_t value() const noexcept override
+    {
+        return payload;
+    }
+};
+
+using fifo_type = hi::wfree_fifo<message_base, 32>;
+
+} // namespace wfree_fifo_benchmarks
+
+hi_benchmark(wfree_fifo_single_thread)
+{
+    using namespace wfree_fifo_benchmarks;
+
+    // A batch of half the fifo is inserted, then taken; the fifo never becomes full.
+    constexpr auto batch_size = fifo_type::num_slots / 2;
+
+    auto fifo = std::make_unique<fifo_type>();
+    auto sum = 0_uz;
+
+    state.set_items_per_iteration(batch_size);
+    while (state.running()) {
+        for (auto i = 0_uz; i != batch_size; ++i) {
+            fifo->emplace<message>(i);
+        }
+        fifo->take_all([&](message_base const& item) {
+            sum += item.value();
+        });
+    }
+    hi::do_not_optimize(sum);
+}
+
+hi_benchmark(wfree_fifo_producer_consumer)
+{
+    using namespace wfree_fifo_benchmarks;
+
+    // The producer runs on this thread, and is measured, while the consumer empties the fifo.
+    constexpr auto batch_size = 1024_uz;
+
+    auto fifo = std::make_unique<fifo_type>();
+    auto sum = std::atomic<std::size_t>{0};
+    auto consumer = std::jthread{[&](std::stop_token stop_token) {
+        auto local_sum = 0_uz;
+        while (not stop_token.stop_requested()) {
+            fifo->take_all([&](message_base const& item) {
+                local_sum += item.value();
+            });
+        }
+        fifo->take_all([&](message_base const& item) {
+            local_sum += item.value();
+        });
+        sum.store(local_sum, std::memory_order::relaxed);
+    }};
+
+    state.set_items_per_iteration(batch_size);
+    while (state.running()) {
+        for (auto i = 0_uz; i != batch_size; ++i) {
+            fifo->emplace<message>(i);
+        }
+    }
+
+    consumer.request_stop();
+    consumer.join();
+    hi::do_not_optimize(sum);
+}
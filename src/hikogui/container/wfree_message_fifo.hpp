@@ -0,0 +1,411 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <type_traits>
+#include <concepts>
+#include <atomic>
+#include <memory>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <thread>
+#include <optional>
+#include <span>
+#include <new>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.container.wfree_message_fifo);
+
+hi_warning_push();
+// C26490: Don't use reinterpret_cast (type.1).
+// Implementing a container.
+hi_warning_ignore_msvc(26490);
+
+hi_export namespace hi::inline v1 {
+
+/** A wait-free multiple-producer/single-consumer fifo of variable sized messages.
+ *
+ * Unlike `wfree_fifo` a message is not placed in a fixed size slot. Each
+ * message reserves the bytes it needs in a ring-buffer: a small header followed
+ * by the message itself, rounded up to `message_alignment`. When a message does
+ * not fit before the end of the ring-buffer, the remaining bytes are filled with
+ * padding and the message is placed at the start of the ring-buffer.
+ *
+ * Messages larger than `max_message_size`, or with a larger alignment than
+ * `message_alignment`, are allocated on the heap; only the header is placed in
+ * the ring-buffer.
+ *
+ * A message may be followed by a payload with a size known only at run-time,
+ * see `emplace_with_payload()`.
+ *
+ * A writer only waits when the ring-buffer is full.
+ *
+ * @tparam T Base class of the value type stored in the ring buffer.
+ * @tparam FifoSize The size of the ring-buffer in bytes, must be power-of-two.
+ */
+template<typename T, std::size_t FifoSize = 65536>
+class wfree_message_fifo {
+public:
+    static_assert(std::has_single_bit(FifoSize), "Only power-of-two fifo size allowed.");
+
+    using value_type = T;
+
+    constexpr static std::size_t fifo_size = FifoSize;
+
+    /** The alignment of messages in the ring-buffer, and the granularity of their size.
+     */
+    constexpr static std::size_t message_alignment = 16;
+
+    /** The maximum size of a message, including its header, that is placed in the ring-buffer.
+     */
+    constexpr static std::size_t max_message_size = fifo_size / 8;
+
+    static_assert(max_message_size >= message_alignment * 2);
+
+    constexpr wfree_message_fifo() noexcept = default;
+    wfree_message_fifo(wfree_message_fifo const&) = delete;
+    wfree_message_fifo(wfree_message_fifo&&) = delete;
+    wfree_message_fifo& operator=(wfree_message_fifo const&) = delete;
+    wfree_message_fifo& operator=(wfree_message_fifo&&) = delete;
+
+    ~wfree_message_fifo()
+    {
+        take_all([](auto&) {});
+    }
+
+    /** Check if fifo is empty.
+     *
+     * @note Must be called on the reader-thread.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _head.load(std::memory_order::relaxed) == _tail.load(std::memory_order::relaxed);
+    }
+
+    /** Take one message from the fifo.
+     * Reads one message from the ring buffer and passes it to a call of operation.
+     * If no message is available this function returns without calling operation.
+     *
+     * @note Must be called on the reader-thread.
+     * @param func The function to call with the value as argument if it exists.
+     * @return If empty/false the this was empty, otherwise it contains the return value of the function if any.
+     */
+    template<typename Func>
+    auto take_one(Func&& func) noexcept
+    {
+        using func_result = decltype(std::declval<Func>()(std::declval<value_type&>()));
+        using result_type = std::conditional_t<std::is_same_v<func_result, void>, bool, std::optional<func_result>>;
+
+        while (true) {
+            auto const tail = _tail.load(std::memory_order::relaxed);
+            auto& header = get_header(tail);
+
+            // The size is written last by the writer, it is zero until the message is complete.
+            auto const size = std::atomic_ref(header.size).load(std::memory_order::acquire);
+            if (size == 0) {
+                return result_type{};
+            }
+
+            auto const kind = header.kind;
+            auto const ptr = header.pointer;
+
+            if (kind == message_kind::padding) {
+                release(tail, size);
+                continue;
+
+            } else if (kind == message_kind::heap) {
+                // Since the message is on the heap, we can release the ring-buffer immediately.
+                release(tail, size);
+
+                if constexpr (std::is_same_v<func_result, void>) {
+                    std::forward<Func>(func)(*ptr);
+                    delete ptr;
+                    return true;
+                } else {
+                    auto result = std::forward<Func>(func)(*ptr);
+                    delete ptr;
+                    return result_type{std::move(result)};
+                }
+
+            } else if (kind == message_kind::heap_payload) {
+                // The message and its payload were allocated as a single block of storage.
+                auto const storage = get_heap_storage(tail);
+                release(tail, size);
+
+                if constexpr (std::is_same_v<func_result, void>) {
+                    std::forward<Func>(func)(*ptr);
+                    std::destroy_at(ptr);
+                    ::operator delete(storage);
+                    return true;
+                } else {
+                    auto result = std::forward<Func>(func)(*ptr);
+                    std::destroy_at(ptr);
+                    ::operator delete(storage);
+                    return result_type{std::move(result)};
+                }
+
+            } else {
+                if constexpr (std::is_same_v<func_result, void>) {
+                    std::forward<Func>(func)(*ptr);
+                    std::destroy_at(ptr);
+                    release(tail, size);
+                    return true;
+                } else {
+                    auto result = std::forward<Func>(func)(*ptr);
+                    std::destroy_at(ptr);
+                    release(tail, size);
+                    return result_type{std::move(result)};
+                }
+            }
+        }
+    }
+
+    /** Take all message from the queue.
+     * Reads each message from the ring buffer and passes it to a call of operation.
+     * If no message are available this function returns without calling operation.
+     *
+     * @param operation A `void(value_type const &)` which is called when a message is available.
+     */
+    template<typename Operation>
+    void take_all(Operation const& operation) noexcept
+    {
+        while (take_one(operation)) {}
+    }
+
+    /** Create an message in-place on the fifo.
+     *
+     * @tparam Message The message type derived from value_type to be stored on the fifo.
+     * @param func The function to invoke on the message created on the fifo.
+     * @param args The arguments passed to the constructor of Message.
+     * @return The result of the invoked function.
+     */
+    template<typename Message, typename Func, typename... Args>
+    hi_force_inline auto emplace_and_invoke(Func&& func, Args&&...args) noexcept
+    {
+        static_assert(std::derived_from<Message, value_type>);
+        using func_result = decltype(std::declval<Func>()(std::declval<Message&>()));
+
+        constexpr auto inplace_size = ceil(sizeof(header_type) + sizeof(Message), message_alignment);
+        constexpr auto inplace = inplace_size <= max_message_size and alignof(Message) <= message_alignment;
+        constexpr auto size = inplace ? inplace_size : sizeof(header_type);
+
+        Message *ptr = nullptr;
+        if constexpr (not inplace) {
+            // Allocate the message before reserving space in the ring-buffer
+            // to let the reader have some time to release the ring-buffer.
+            ptr = new Message(std::forward<Args>(args)...);
+            hi_assert_not_null(ptr);
+        }
+
+        auto const offset = reserve(size);
+        auto& header = get_header(offset);
+
+        if constexpr (inplace) {
+            ptr = new (reinterpret_cast<char *>(std::addressof(header)) + sizeof(header_type))
+                Message(std::forward<Args>(args)...);
+            hi_assume(ptr != nullptr);
+        }
+
+        header.kind = inplace ? message_kind::inplace : message_kind::heap;
+        header.pointer = ptr;
+
+        if constexpr (std::is_same_v<func_result, void>) {
+            std::forward<Func>(func)(*ptr);
+            std::atomic_ref(header.size).store(narrow_cast<uint32_t>(size), std::memory_order::release);
+
+        } else {
+            auto tmp = std::forward<Func>(func)(*ptr);
+            std::atomic_ref(header.size).store(narrow_cast<uint32_t>(size), std::memory_order::release);
+            return tmp;
+        }
+    }
+
+    /** Create a message in-place on the fifo, followed by a payload.
+     *
+     * The message is constructed with a `std::span<std::byte>` to the payload as its
+     * first argument, followed by @a args. The payload is placed directly after the
+     * message in the ring-buffer and remains valid until the message is destroyed.
+     *
+     * When the message and payload do not fit in `max_message_size` they are
+     * allocated together on the heap.
+     *
+     * @tparam Message The message type derived from value_type to be stored on the fifo.
+     * @param payload_size The number of bytes of the payload.
+     * @param args The arguments passed to the constructor of Message, after the payload.
+     */
+    template<typename Message, typename... Args>
+    hi_force_inline void emplace_with_payload(std::size_t payload_size, Args&&...args) noexcept
+    {
+        static_assert(std::derived_from<Message, value_type>);
+        static_assert(alignof(Message) <= message_alignment);
+
+        auto const inplace_size = ceil(sizeof(header_type) + sizeof(Message) + payload_size, message_alignment);
+        auto const inplace = inplace_size <= max_message_size;
+        // A message on the heap stores the pointer to its storage after the header.
+        auto const size = inplace ? inplace_size : sizeof(header_type) + message_alignment;
+
+        Message *ptr = nullptr;
+        void *storage = nullptr;
+        if (not inplace) [[unlikely]] {
+            // Allocate the message before reserving space in the ring-buffer
+            // to let the reader have some time to release the ring-buffer.
+            storage = ::operator new(sizeof(Message) + payload_size);
+            auto const payload = std::span{static_cast<std::byte *>(storage) + sizeof(Message), payload_size};
+            ptr = new (storage) Message(payload, std::forward<Args>(args)...);
+        }
+
+        auto const offset = reserve(size);
+        auto& header = get_header(offset);
+        auto const header_ptr = reinterpret_cast<std::byte *>(std::addressof(header));
+
+        if (inplace) [[likely]] {
+            auto const payload = std::span{header_ptr + sizeof(header_type) + sizeof(Message), payload_size};
+            ptr = new (header_ptr + sizeof(header_type)) Message(payload, std::forward<Args>(args)...);
+            hi_assume(ptr != nullptr);
+        } else {
+            std::memcpy(header_ptr + sizeof(header_type), &storage, sizeof(storage));
+        }
+
+        header.kind = inplace ? message_kind::inplace : message_kind::heap_payload;
+        header.pointer = ptr;
+        std::atomic_ref(header.size).store(narrow_cast<uint32_t>(size), std::memory_order::release);
+    }
+
+    template<typename Func, typename Object>
+    hi_force_inline auto insert_and_invoke(Func&& func, Object&& object) noexcept
+    {
+        return emplace_and_invoke<std::decay_t<Object>>(std::forward<Func>(func), std::forward<Object>(object));
+    }
+
+    template<typename Message, typename... Args>
+    hi_force_inline void emplace(Args&&...args) noexcept
+    {
+        return emplace_and_invoke<Message>([](Message&) -> void {}, std::forward<Args>(args)...);
+    }
+
+    template<typename Object>
+    hi_force_inline void insert(Object&& object) noexcept
+    {
+        return emplace<std::decay_t<Object>>(std::forward<Object>(object));
+    }
+
+private:
+#if defined(__cpp_lib_hardware_interference_size)
+    constexpr static size_t destructive_interference_size = std::hardware_destructive_interference_size;
+#else
+    constexpr static size_t destructive_interference_size = 128;
+#endif
+
+    enum class message_kind : uint32_t { padding, inplace, heap, heap_payload };
+
+    struct header_type {
+        /** The number of bytes of the message including the header.
+         *
+         * Zero when the message has not been completely written.
+         */
+        uint32_t size;
+        message_kind kind;
+        value_type *pointer;
+    };
+
+    static_assert(sizeof(header_type) <= message_alignment);
+    static_assert(std::is_trivially_copyable_v<header_type>);
+
+    alignas(message_alignment) std::array<std::byte, fifo_size> _buffer = {};
+
+    /** The offset one beyond the last reserved byte.
+     */
+    alignas(destructive_interference_size) std::atomic<uint64_t> _head = 0;
+
+    /** The offset of the next message to read.
+     */
+    alignas(destructive_interference_size) std::atomic<uint64_t> _tail = 0;
+
+    [[nodiscard]] hi_force_inline header_type& get_header(uint64_t offset) noexcept
+    {
+        auto const index = offset % fifo_size;
+        hi_axiom(index % message_alignment == 0);
+        return *std::launder(std::assume_aligned<message_alignment>(reinterpret_cast<header_type *>(_buffer.data() + index)));
+    }
+
+    /** Get the storage of a message and its payload allocated on the heap.
+     */
+    [[nodiscard]] void *get_heap_storage(uint64_t offset) noexcept
+    {
+        void *r = nullptr;
+        std::memcpy(&r, _buffer.data() + offset % fifo_size + sizeof(header_type), sizeof(r));
+        return r;
+    }
+
+    /** Release a message that has been read.
+     *
+     * The bytes are cleared, so that the header of the next message in those
+     * bytes reads as incomplete until it is written.
+     */
+    hi_force_inline void release(uint64_t offset, std::size_t size) noexcept
+    {
+        std::memset(_buffer.data() + offset % fifo_size, 0, size);
+        _tail.store(offset + size, std::memory_order::release);
+    }
+
+    /** Reserve space for a message in the ring-buffer.
+     *
+     * @param size The number of bytes of the message, including the header.
+     * @return The offset of the message.
+     */
+    [[nodiscard]] hi_force_inline uint64_t reserve(std::size_t size) noexcept
+    {
+        while (true) {
+            // We don't care about memory ordering with other writer threads, each
+            // writer gets its own range of bytes.
+            auto const offset = _head.fetch_add(size, std::memory_order::relaxed);
+            if (offset + size - _tail.load(std::memory_order::acquire) > fifo_size) [[unlikely]] {
+                contended_write(offset + size);
+            }
+
+            auto const index = offset % fifo_size;
+            if (index + size <= fifo_size) [[likely]] {
+                return offset;
+            }
+
+            // The message would wrap around the end of the ring-buffer. Fill the
+            // bytes before and after the end with padding and try again.
+            auto const first_size = fifo_size - index;
+            write_padding(offset, first_size);
+            write_padding(offset + first_size, size - first_size);
+        }
+    }
+
+    void write_padding(uint64_t offset, std::size_t size) noexcept
+    {
+        auto& header = get_header(offset);
+        header.kind = message_kind::padding;
+        header.pointer = nullptr;
+        std::atomic_ref(header.size).store(narrow_cast<uint32_t>(size), std::memory_order::release);
+    }
+
+    /** Wait until the reader has released enough of the ring-buffer.
+     *
+     * @param end The offset one beyond the last byte that needs to be available.
+     */
+    hi_no_inline void contended_write(uint64_t end) noexcept
+    {
+        using namespace std::chrono_literals;
+
+        do {
+            // If we get here, that would suck, but nothing to do about it.
+            std::this_thread::sleep_for(1ms);
+        } while (end - _tail.load(std::memory_order::acquire) > fifo_size);
+    }
+};
+
+} // namespace hi::inline v1
+
+hi_warning_pop();
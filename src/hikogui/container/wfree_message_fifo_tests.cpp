@@ -0,0 +1,171 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "wfree_message_fifo.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+#include <vector>
+#include <span>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+
+namespace wfree_message_fifo_tests {
+
+struct message_base {
+    virtual ~message_base() = default;
+    [[nodiscard]] virtual std::size_t value() const noexcept = 0;
+};
+
+template<std::size_t N>
+struct message : message_base {
+    std::array<std::size_t, N> payload = {};
+
+    message(std::size_t x) noexcept
+    {
+        payload.front() = x;
+        payload.back() = x;
+    }
+
+    [[nodiscard]] std::size_t value() const noexcept override
+    {
+        return payload.front() == payload.back() ? payload.front() : 0;
+    }
+};
+
+struct payload_message : message_base {
+    std::span<std::byte> payload;
+
+    payload_message(std::span<std::byte> payload, std::size_t x) noexcept : payload(payload)
+    {
+        for (auto& c : payload) {
+            c = static_cast<std::byte>(x);
+        }
+    }
+
+    [[nodiscard]] std::size_t value() const noexcept override
+    {
+        auto r = std::size_t{0};
+        for (auto const c : payload) {
+            r += static_cast<std::size_t>(c);
+        }
+        return r;
+    }
+};
+
+} // namespace wfree_message_fifo_tests
+
+TEST_SUITE(wfree_message_fifo) {
+
+TEST_CASE(variable_size)
+{
+    using namespace wfree_message_fifo_tests;
+
+    auto fifo = std::make_unique<hi::wfree_message_fifo<message_base, 4096>>();
+    REQUIRE(fifo->empty());
+
+    auto sum = std::size_t{0};
+    auto expected = std::size_t{0};
+    for (auto i = std::size_t{1}; i != 1000; ++i) {
+        // Mix small and large messages, the total size is many times the size of the fifo.
+        switch (i % 3) {
+        case 0:
+            fifo->emplace<message<1>>(i);
+            break;
+        case 1:
+            fifo->emplace<message<20>>(i);
+            break;
+        default:
+            fifo->emplace<message<50>>(i);
+            break;
+        }
+        expected += i;
+
+        REQUIRE(not fifo->empty());
+        REQUIRE(fifo->take_one([&](message_base& m) {
+            sum += m.value();
+        }));
+        REQUIRE(fifo->empty());
+    }
+
+    REQUIRE(sum == expected);
+    REQUIRE(not fifo->take_one([](message_base&) {}));
+}
+
+TEST_CASE(large_message)
+{
+    using namespace wfree_message_fifo_tests;
+
+    auto fifo = std::make_unique<hi::wfree_message_fifo<message_base, 4096>>();
+
+    // Larger than the fifo itself, stored on the heap.
+    fifo->emplace<message<1000>>(42);
+    fifo->emplace<message<2>>(43);
+
+    auto values = std::vector<std::size_t>{};
+    fifo->take_all([&](message_base& m) {
+        values.push_back(m.value());
+    });
+    REQUIRE(values == (std::vector<std::size_t>{42, 43}));
+}
+
+TEST_CASE(payload)
+{
+    using namespace wfree_message_fifo_tests;
+
+    auto fifo = std::make_unique<hi::wfree_message_fifo<message_base, 4096>>();
+
+    auto expected = std::vector<std::size_t>{};
+    for (auto i = std::size_t{0}; i != 200; ++i) {
+        // Payloads of all sizes, including payloads that are larger than the fifo.
+        auto const payload_size = (i * 37) % 5000;
+        fifo->emplace_with_payload<payload_message>(payload_size, i);
+        expected.push_back(payload_size * (i % 256));
+
+        auto values = std::vector<std::size_t>{};
+        fifo->take_all([&](message_base& m) {
+            values.push_back(m.value());
+        });
+        REQUIRE(values.size() == 1);
+        REQUIRE(values.front() == expected.back());
+    }
+    REQUIRE(fifo->empty());
+}
+
+TEST_CASE(multiple_producers)
+{
+    using namespace wfree_message_fifo_tests;
+
+    constexpr auto num_threads = std::size_t{4};
+    constexpr auto num_messages = std::size_t{10'000};
+
+    auto fifo = std::make_unique<hi::wfree_message_fifo<message_base, 4096>>();
+
+    auto threads = std::vector<std::jthread>{};
+    for (auto i = std::size_t{0}; i != num_threads; ++i) {
+        threads.emplace_back([&fifo, i] {
+            for (auto j = std::size_t{1}; j <= num_messages; ++j) {
+                if (j % 2 == 0) {
+                    fifo->emplace<message<1>>(j);
+                } else {
+                    fifo->emplace<message<10>>(j);
+                }
+            }
+        });
+    }
+
+    auto sum = std::size_t{0};
+    auto count = std::size_t{0};
+    while (count != num_threads * num_messages) {
+        if (fifo->take_one([&](message_base& m) {
+                sum += m.value();
+            })) {
+            ++count;
+        }
+    }
+
+    REQUIRE(sum == num_threads * num_messages * (num_messages + 1) / 2);
+}
+
+};
@@ -0,0 +1,193 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <atomic>
+#include <new>
+#include <memory>
+#include <vector>
+#include <optional>
+#include <type_traits>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.container.work_stealing_deque);
+
+hi_export namespace hi::inline v1 {
+
+/** A lock-free work-stealing deque.
+ *
+ * This is the Chase-Lev deque, with the memory ordering described in
+ * "Correct and Efficient Work-Stealing for Weak Memory Models" by Lê et al.
+ *
+ * The owner thread pushes and pops values at the bottom of the deque, while
+ * other threads steal values from the top. Pushing and popping by the owner
+ * is wait-free, except when the deque is full and needs to grow.
+ *
+ * The ring buffer grows when full; the previous ring buffers are retained until
+ * the deque is destroyed, since a thief may still be reading from them.
+ *
+ * @note `push()` and `pop()` may only be called from the owner thread,
+ *       `steal()` may be called from any thread.
+ * @tparam T A trivially copyable type which is lock-free when atomic.
+ */
+template<typename T>
+class work_stealing_deque {
+public:
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    using value_type = T;
+
+    work_stealing_deque(work_stealing_deque const&) = delete;
+    work_stealing_deque(work_stealing_deque&&) = delete;
+    work_stealing_deque& operator=(work_stealing_deque const&) = delete;
+    work_stealing_deque& operator=(work_stealing_deque&&) = delete;
+
+    /** Create a deque.
+     *
+     * @param capacity The initial capacity, rounded up to a power of two.
+     */
+    explicit work_stealing_deque(std::size_t capacity = 256)
+    {
+        _rings.push_back(std::make_unique<ring_type>(std::bit_ceil(std::max(capacity, std::size_t{2}))));
+        _ring.store(_rings.back().get(), std::memory_order::relaxed);
+    }
+
+    /** Check if the deque is empty.
+     *
+     * @note The result may already be outdated when another thread pushes or steals.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _bottom.load(std::memory_order::relaxed) <= _top.load(std::memory_order::relaxed);
+    }
+
+    /** Push a value on the bottom of the deque.
+     *
+     * @note Must be called from the owner thread.
+     * @param value The value to push.
+     */
+    void push(value_type value)
+    {
+        auto const bottom = _bottom.load(std::memory_order::relaxed);
+        auto const top = _top.load(std::memory_order::acquire);
+        auto *ring = _ring.load(std::memory_order::relaxed);
+
+        if (bottom - top > narrow_cast<int64_t>(ring->mask)) {
+            ring = grow(ring, top, bottom);
+        }
+
+        ring->store(bottom, value);
+        std::atomic_thread_fence(std::memory_order::release);
+        _bottom.store(bottom + 1, std::memory_order::relaxed);
+    }
+
+    /** Pop a value from the bottom of the deque.
+     *
+     * @note Must be called from the owner thread.
+     * @return The last pushed value, or empty when the deque is empty.
+     */
+    [[nodiscard]] std::optional<value_type> pop() noexcept
+    {
+        auto const bottom = _bottom.load(std::memory_order::relaxed) - 1;
+        auto *ring = _ring.load(std::memory_order::relaxed);
+        _bottom.store(bottom, std::memory_order::relaxed);
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        auto top = _top.load(std::memory_order::relaxed);
+
+        if (top > bottom) {
+            // The deque was empty.
+            _bottom.store(bottom + 1, std::memory_order::relaxed);
+            return std::nullopt;
+        }
+
+        auto const r = ring->load(bottom);
+        if (top == bottom) {
+            // This is the last value, race against the thieves for it.
+            auto const won = _top.compare_exchange_strong(top, top + 1, std::memory_order::seq_cst, std::memory_order::relaxed);
+            _bottom.store(bottom + 1, std::memory_order::relaxed);
+            if (not won) {
+                return std::nullopt;
+            }
+        }
+        return r;
+    }
+
+    /** Steal a value from the top of the deque.
+     *
+     * @return The first pushed value, or empty when the deque is empty or
+     *         when another thread won the race for the value.
+     */
+    [[nodiscard]] std::optional<value_type> steal() noexcept
+    {
+        auto top = _top.load(std::memory_order::acquire);
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        auto const bottom = _bottom.load(std::memory_order::acquire);
+
+        if (top >= bottom) {
+            return std::nullopt;
+        }
+
+        auto const *ring = _ring.load(std::memory_order::acquire);
+        auto const r = ring->load(top);
+        if (not _top.compare_exchange_strong(top, top + 1, std::memory_order::seq_cst, std::memory_order::relaxed)) {
+            return std::nullopt;
+        }
+        return r;
+    }
+
+private:
+#if defined(__cpp_lib_hardware_interference_size)
+    constexpr static size_t destructive_interference_size = std::hardware_destructive_interference_size;
+#else
+    constexpr static size_t destructive_interference_size = 128;
+#endif
+
+    struct ring_type {
+        std::size_t mask;
+        std::unique_ptr<std::atomic<value_type>[]> values;
+
+        explicit ring_type(std::size_t capacity) : mask(capacity - 1), values(std::make_unique<std::atomic<value_type>[]>(capacity))
+        {
+            static_assert(std::atomic<value_type>::is_always_lock_free);
+        }
+
+        [[nodiscard]] value_type load(int64_t index) const noexcept
+        {
+            return values[static_cast<std::size_t>(index) & mask].load(std::memory_order::relaxed);
+        }
+
+        void store(int64_t index, value_type value) noexcept
+        {
+            values[static_cast<std::size_t>(index) & mask].store(value, std::memory_order::relaxed);
+        }
+    };
+
+    alignas(destructive_interference_size) std::atomic<int64_t> _top = 0;
+    alignas(destructive_interference_size) std::atomic<int64_t> _bottom = 0;
+    std::atomic<ring_type *> _ring = nullptr;
+
+    /** All the ring buffers, owned by the owner thread.
+     */
+    std::vector<std::unique_ptr<ring_type>> _rings;
+
+    ring_type *grow(ring_type *ring, int64_t top, int64_t bottom)
+    {
+        auto new_ring = std::make_unique<ring_type>((ring->mask + 1) * 2);
+        for (auto i = top; i != bottom; ++i) {
+            new_ring->store(i, ring->load(i));
+        }
+
+        auto *r = new_ring.get();
+        _rings.push_back(std::move(new_ring));
+        _ring.store(r, std::memory_order::release);
+        return r;
+    }
+};
+
+} // namespace hi::inline v1
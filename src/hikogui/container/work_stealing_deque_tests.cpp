@@ -0,0 +1,83 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "work_stealing_deque.hpp"
+#include <hikotest/hikotest.hpp>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstddef>
+
+TEST_SUITE(work_stealing_deque) {
+
+TEST_CASE(push_pop_steal)
+{
+    auto deque = hi::work_stealing_deque<int>{4};
+    REQUIRE(deque.empty());
+    REQUIRE(not deque.pop());
+    REQUIRE(not deque.steal());
+
+    // Push more values than the initial capacity, so that the deque grows.
+    for (auto i = 0; i != 10; ++i) {
+        deque.push(i);
+    }
+    REQUIRE(not deque.empty());
+
+    // The owner pops the last pushed value, thieves steal the first.
+    REQUIRE(*deque.pop() == 9);
+    REQUIRE(*deque.steal() == 0);
+    REQUIRE(*deque.steal() == 1);
+    REQUIRE(*deque.pop() == 8);
+
+    for (auto i = 7; i != 1; --i) {
+        REQUIRE(*deque.pop() == i);
+    }
+    REQUIRE(deque.empty());
+    REQUIRE(not deque.pop());
+}
+
+TEST_CASE(concurrent_steal)
+{
+    constexpr auto num_values = 100'000;
+    constexpr auto num_thieves = 3;
+
+    auto deque = hi::work_stealing_deque<int>{16};
+    auto taken = std::vector<std::atomic<int>>(num_values);
+    auto num_taken = std::atomic<int>{0};
+
+    auto thieves = std::vector<std::jthread>{};
+    for (auto i = 0; i != num_thieves; ++i) {
+        thieves.emplace_back([&] {
+            while (num_taken.load() != num_values) {
+                if (auto value = deque.steal()) {
+                    taken[*value].fetch_add(1);
+                    num_taken.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (auto i = 0; i != num_values; ++i) {
+        deque.push(i);
+        if (i % 3 == 0) {
+            if (auto value = deque.pop()) {
+                taken[*value].fetch_add(1);
+                num_taken.fetch_add(1);
+            }
+        }
+    }
+    while (auto value = deque.pop()) {
+        taken[*value].fetch_add(1);
+        num_taken.fetch_add(1);
+    }
+    thieves.clear();
+
+    // Each value is taken exactly once.
+    REQUIRE(num_taken.load() == num_values);
+    for (auto i = 0; i != num_values; ++i) {
+        REQUIRE(taken[i].load() == 1);
+    }
+}
+
+};
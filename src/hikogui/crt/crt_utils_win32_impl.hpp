@@ -93,10 +93,13 @@ hi_export inline std::pair<int, char **> crt_start(int, char **, void *instance,
 
     initialize();
     start_system();
+
+    // Convert time-stamp-counts to UTC without a system call, refined in the background.
+    hi::time_stamp_utc::start_subsystem();
     if (aux_is_cpu_id) {
         hi_log_info("The AUX value from the time-stamp-count is equal to the cpu-id.");
     }
-    hi_log_info("The measured frequency of the TSC is {} Hz.", tsc_frequency);
+    hi_log_info("The frequency of the TSC is {} Hz.", tsc_frequency);
 
     crt_application_instance = instance;
     return {argc, argv};
@@ -0,0 +1,309 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file dispatch/async_loader.hpp Run a long job in the background, with progress and cancellation.
+ */
+
+#pragma once
+
+#include "async_task.hpp"
+#include "progress.hpp"
+#include "task.hpp"
+#include "notifier.hpp"
+#include "thread_pool.hpp"
+#if HI_OPERATING_SYSTEM == HI_OS_WINDOWS
+#include "loop_win32_intf.hpp"
+#elif HI_OPERATING_SYSTEM == HI_OS_LINUX
+#include "loop_linux_intf.hpp"
+#endif
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <exception>
+#include <stop_token>
+#include <type_traits>
+#include <variant>
+
+hi_export_module(hikogui.dispatch.async_loader);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+/** Load something in the background.
+ *
+ * The loader runs a function on `hi::thread_pool::global()`, or a `hi::task`
+ * co-routine, in the same way as `hi::cancelable_async_task()`: when the
+ * function accepts a `std::stop_token` it can be cancelled, and when it
+ * accepts a `hi::progress_token` it can report its progress. A co-routine
+ * can wait for cancellation with `co_await stop_token`.
+ *
+ * Progress from the job is delivered to `hi::loop::main()` at most once per
+ * frame, the default interval is `loop::main().minimum_frame_time()`. The
+ * result of the job is delivered to `hi::loop::main()` as well. Subscribers
+ * are called from the main loop whenever the progress or result changes.
+ *
+ * Starting a new job, or destroying the loader, requests the previous job to
+ * stop and discards its result.
+ *
+ * @note All member functions must be called from the main thread.
+ * @note When the job fails, the result type must be default constructible
+ *       for the failure to be reported.
+ * @tparam ResultType The type returned by the function or co-routine.
+ */
+template<typename ResultType = void>
+class async_loader {
+public:
+    using result_type = ResultType;
+    using callback_type = notifier<>::callback_type;
+
+    async_loader(async_loader const&) = delete;
+    async_loader(async_loader&&) = delete;
+    async_loader& operator=(async_loader const&) = delete;
+    async_loader& operator=(async_loader&&) = delete;
+
+    ~async_loader()
+    {
+        detach();
+    }
+
+    async_loader() noexcept = default;
+
+    /** Start loading.
+     *
+     * @param func The function or co-routine to run.
+     * @param args The arguments passed to the function.
+     */
+    template<typename Func, typename... Args>
+    void load(Func&& func, Args&&... args)
+        requires compatible_cancelable_async_callable<result_type, std::decay_t<Func>, std::decay_t<Args>...>
+    {
+        hi_axiom(loop::main().on_thread());
+
+        detach();
+        _value = {};
+        _exception = nullptr;
+        _progress = 0.0f;
+        _loading = true;
+
+        _state = std::make_shared<state_type>(this, _progress_interval.value_or(loop::main().minimum_frame_time()));
+        run(_state, std::forward<Func>(func), std::forward<Args>(args)...);
+        _notifier();
+    }
+
+    /** Request the current job to stop.
+     *
+     * Stopping is cooperative, the job is only stopped when it accepts a
+     * `std::stop_token`. The result of the job is delivered as normal.
+     *
+     * @retval true When the stop was requested.
+     * @retval false When the job was already requested to stop, or nothing is loading.
+     */
+    bool cancel() noexcept
+    {
+        if (_state and _loading) {
+            return _state->stop_source.request_stop();
+        }
+        return false;
+    }
+
+    /** Check if a job is running.
+     */
+    [[nodiscard]] bool loading() const noexcept
+    {
+        return _loading;
+    }
+
+    /** Check if a job has completed, successfully or with an exception.
+     */
+    [[nodiscard]] bool done() const noexcept
+    {
+        return _state and not _loading;
+    }
+
+    /** Check if stop was requested for the current job.
+     */
+    [[nodiscard]] bool stop_requested() const noexcept
+    {
+        return _state and _state->stop_source.stop_requested();
+    }
+
+    /** The last progress that was delivered to the main loop.
+     */
+    [[nodiscard]] float progress() const noexcept
+    {
+        return _progress;
+    }
+
+    /** Get the result of the job.
+     *
+     * @pre done() must return true.
+     * @throws The exception that was thrown by the job.
+     */
+    [[nodiscard]] decltype(auto) value() const
+    {
+        hi_axiom(done());
+        if (_exception) {
+            std::rethrow_exception(_exception);
+        }
+
+        if constexpr (not std::is_void_v<result_type>) {
+            hi_axiom(_value.has_value());
+            return *_value;
+        }
+    }
+
+    /** Set the minimum interval between progress updates.
+     *
+     * @param interval The interval, or empty to use the frame-time of the main loop.
+     */
+    void set_progress_interval(std::optional<std::chrono::nanoseconds> interval) noexcept
+    {
+        _progress_interval = interval;
+    }
+
+    /** Subscribe a callback for when the progress or state changes.
+     */
+    template<forward_of<void()> Callback>
+    [[nodiscard]] callback_type subscribe(Callback&& callback, callback_flags flags = callback_flags::synchronous)
+    {
+        return _notifier.subscribe(std::forward<Callback>(callback), flags);
+    }
+
+private:
+    using value_type = std::conditional_t<std::is_void_v<result_type>, std::monostate, result_type>;
+
+    /** The state shared between the loader and a single job.
+     *
+     * The job keeps the state alive, so that the job may outlive the loader.
+     * `owner` is only accessed from the main thread.
+     */
+    struct state_type : std::enable_shared_from_this<state_type> {
+        async_loader *owner;
+        std::chrono::nanoseconds progress_interval;
+        std::stop_source stop_source = {};
+        progress_sink sink = {};
+        progress_sink::callback_type sink_cbt = {};
+
+        /** The latest progress, written by the job.
+         */
+        std::atomic<float> progress = 0.0f;
+
+        /** Set while a progress update is posted to the main loop.
+         */
+        std::atomic<bool> progress_posted = false;
+
+        /** The earliest time for the next progress update.
+         */
+        std::atomic<std::chrono::steady_clock::time_point> next_progress = {};
+
+        std::optional<value_type> value = {};
+        std::exception_ptr exception = nullptr;
+
+        state_type(async_loader *owner, std::chrono::nanoseconds progress_interval) noexcept :
+            owner(owner), progress_interval(progress_interval)
+        {
+            // The sink is called on the thread of the job.
+            sink_cbt = sink.subscribe([this] {
+                report_progress();
+            });
+        }
+
+        void report_progress() noexcept
+        {
+            progress.store(sink.value(), std::memory_order::relaxed);
+
+            auto const now = std::chrono::steady_clock::now();
+            if (now < next_progress.load(std::memory_order::relaxed)) {
+                return;
+            }
+            if (progress_posted.exchange(true, std::memory_order::acq_rel)) {
+                return;
+            }
+            next_progress.store(now + progress_interval, std::memory_order::relaxed);
+
+            loop::main().post_function([self = this->shared_from_this()] {
+                self->progress_posted.store(false, std::memory_order::release);
+                if (self->owner != nullptr) {
+                    self->owner->update_progress(self->progress.load(std::memory_order::relaxed));
+                }
+            });
+        }
+    };
+
+    std::shared_ptr<state_type> _state = {};
+    std::optional<value_type> _value = {};
+    std::exception_ptr _exception = nullptr;
+    std::optional<std::chrono::nanoseconds> _progress_interval = {};
+    float _progress = 0.0f;
+    bool _loading = false;
+    notifier<> _notifier = {};
+
+    /** Run the job and deliver its result to the main loop.
+     *
+     * Awaiting the job resumes this co-routine on the main loop. The frame of
+     * this co-routine is destroyed when it completes.
+     */
+    template<typename Func, typename... Args>
+    static detail::thread_pool_detached_task run(std::shared_ptr<state_type> state, Func func, Args... args)
+    {
+        auto job = cancelable_async_task(
+            std::move(func), state->stop_source.get_token(), state->sink.get_token(), std::move(args)...);
+        if (not job.done()) {
+            co_await job;
+        }
+
+        try {
+            if constexpr (std::is_void_v<result_type>) {
+                job.value();
+                state->value = std::monostate{};
+            } else {
+                state->value = job.value();
+            }
+        } catch (...) {
+            state->exception = std::current_exception();
+        }
+
+        if (state->owner != nullptr) {
+            state->owner->finish(*state);
+        }
+    }
+
+    /** Detach from the current job, and request it to stop.
+     */
+    void detach() noexcept
+    {
+        if (_state) {
+            _state->owner = nullptr;
+            _state->stop_source.request_stop();
+            _state = nullptr;
+        }
+        _loading = false;
+    }
+
+    void update_progress(float progress) noexcept
+    {
+        if (_loading and progress != _progress) {
+            _progress = progress;
+            _notifier();
+        }
+    }
+
+    void finish(state_type& state) noexcept
+    {
+        hi_axiom(&state == _state.get());
+
+        _value = std::move(state.value);
+        _exception = state.exception;
+        // The last progress update may have been throttled.
+        _progress = state.progress.load(std::memory_order::relaxed);
+        _loading = false;
+        _notifier();
+    }
+};
+
+} // namespace v1
+}
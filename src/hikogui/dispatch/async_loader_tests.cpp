@@ -0,0 +1,142 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "async_loader.hpp"
+#include "dispatch.hpp"
+#include <hikotest/hikotest.hpp>
+#include <atomic>
+#include <stdexcept>
+
+TEST_SUITE(async_loader_suite)
+{
+    static int many_progress(hi::progress_token progress_token, int count)
+    {
+        for (auto i = 0; i != count; ++i) {
+            progress_token = static_cast<float>(i + 1) / static_cast<float>(count);
+        }
+        return count;
+    }
+
+    TEST_CASE(progress_test)
+    {
+        using namespace std::literals;
+
+        auto loader = hi::async_loader<int>{};
+        loader.set_progress_interval(1h);
+
+        auto num_notifications = 0;
+        auto cbt = loader.subscribe([&] {
+            ++num_notifications;
+        });
+
+        loader.load(async_loader_suite::many_progress, 100'000);
+        REQUIRE(loader.loading());
+
+        while (loader.loading()) {
+            hi::loop::main().resume_once();
+        }
+
+        REQUIRE(loader.done());
+        REQUIRE(loader.value() == 100'000);
+        REQUIRE(loader.progress() == 1.0f);
+
+        // Started, at most one progress update, and finished.
+        REQUIRE(num_notifications <= 3);
+    }
+
+    static int wait_for_stop(std::stop_token stop_token, std::atomic<bool> *started)
+    {
+        using namespace std::literals;
+
+        started->store(true);
+        while (not stop_token.stop_requested()) {
+            std::this_thread::sleep_for(1ms);
+        }
+        return 5;
+    }
+
+    TEST_CASE(cancel_test)
+    {
+        auto started = std::atomic<bool>{false};
+        auto loader = hi::async_loader<int>{};
+
+        REQUIRE(not loader.cancel());
+        loader.load(async_loader_suite::wait_for_stop, &started);
+
+        while (not started.load()) {
+            hi::loop::main().resume_once();
+        }
+        REQUIRE(loader.loading());
+
+        REQUIRE(loader.cancel());
+        REQUIRE(loader.stop_requested());
+
+        while (loader.loading()) {
+            hi::loop::main().resume_once();
+        }
+
+        REQUIRE(loader.value() == 5);
+    }
+
+    static hi::task<int> wait_for_stop_task(std::stop_token stop_token)
+    {
+        co_await stop_token;
+        co_return 6;
+    }
+
+    TEST_CASE(cancel_task_test)
+    {
+        auto loader = hi::async_loader<int>{};
+        loader.load(async_loader_suite::wait_for_stop_task);
+
+        for (auto i = 0; i != 10; ++i) {
+            hi::loop::main().resume_once();
+        }
+        REQUIRE(loader.loading());
+
+        loader.cancel();
+        while (loader.loading()) {
+            hi::loop::main().resume_once();
+        }
+
+        REQUIRE(loader.value() == 6);
+    }
+
+    static int throw_error()
+    {
+        throw std::runtime_error("error");
+    }
+
+    TEST_CASE(exception_test)
+    {
+        auto loader = hi::async_loader<int>{};
+        loader.load(async_loader_suite::throw_error);
+
+        while (loader.loading()) {
+            hi::loop::main().resume_once();
+        }
+
+        REQUIRE(loader.done());
+        REQUIRE_THROWS(loader.value(), std::runtime_error);
+    }
+
+    TEST_CASE(replace_test)
+    {
+        auto started = std::atomic<bool>{false};
+        auto loader = hi::async_loader<int>{};
+
+        loader.load(async_loader_suite::wait_for_stop, &started);
+        while (not started.load()) {
+            hi::loop::main().resume_once();
+        }
+
+        // The first job is stopped, and its result is discarded.
+        loader.load(async_loader_suite::many_progress, 10);
+        while (loader.loading()) {
+            hi::loop::main().resume_once();
+        }
+
+        REQUIRE(loader.value() == 10);
+    }
+};
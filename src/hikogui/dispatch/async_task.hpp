@@ -8,8 +8,16 @@
 #include "progress.hpp"
 #include "task.hpp"
 #include "awaitable.hpp"
-#include "awaitable_timer_intf.hpp"
-#include <future>
+#include "thread_pool.hpp"
+#if HI_OPERATING_SYSTEM == HI_OS_WINDOWS
+#include "loop_win32_intf.hpp"
+#elif HI_OPERATING_SYSTEM == HI_OS_LINUX
+#include "loop_linux_intf.hpp"
+#endif
+#include <optional>
+#include <exception>
+#include <type_traits>
+#include <stop_token>
 
 hi_export_module(hikogui.dispatch.async_task);
 
@@ -29,7 +37,9 @@ template<typename Func, typename... Args>
 
 /** Run a function asynchronously as a co-routine task.
  *
- * @note This will check every 15ms if the function is completed.
+ * The function is called on `thread_pool::global()`, then the co-routine
+ * resumes on the loop of the thread that called `async_task()`.
+ *
  * @param func The function to be called.
  * @param args... The arguments forwarded to @a func.
  */
@@ -37,32 +47,38 @@ template<typename Func, typename... Args>
 [[nodiscard]] task<std::invoke_result_t<Func, Args...>> async_task(Func func, Args... args)
     requires(not is_invocable_task_v<Func, Args...>)
 {
-    using namespace std::literals;
-
-    auto future = std::async(std::launch::async, [func = std::move(func), ... args = std::move(args)] {
-        return func(args...);
-    });
-
-    if (not future.valid()) {
-        throw std::future_error(std::future_errc::no_state);
-    }
-
-    while (true) {
-        switch (future.wait_for(0s)) {
-        case std::future_status::deferred:
-            // This shouldn't really happen, this will cause the GUI to block.
-            co_return future.get();
+    using result_type = std::invoke_result_t<Func, Args...>;
+
+    auto& caller_loop = loop::local();
+    co_await thread_pool::global().schedule();
+
+    // Catch the exception here, so that it is rethrown on the caller's loop.
+    auto exception = std::exception_ptr{};
+    if constexpr (std::is_void_v<result_type>) {
+        try {
+            func(args...);
+        } catch (...) {
+            exception = std::current_exception();
+        }
 
-        case std::future_status::ready:
-            co_return future.get();
+        co_await caller_loop.schedule();
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
 
-        case std::future_status::timeout:
-            co_await 15ms;
-            break;
+    } else {
+        auto r = std::optional<result_type>{};
+        try {
+            r = func(args...);
+        } catch (...) {
+            exception = std::current_exception();
+        }
 
-        default:
-            hi_no_default();
+        co_await caller_loop.schedule();
+        if (exception) {
+            std::rethrow_exception(exception);
         }
+        co_return std::move(*r);
     }
 }
 
@@ -5,6 +5,7 @@
 #include <cstddef> // XXX #619
 #include <memory> // XXX #619
 #include <chrono> // XXX #619
+#include "async_loader.hpp" // export
 #include "async_task.hpp" // export
 #include "awaitable_stop_token_intf.hpp" // export
 #include "awaitable_stop_token_impl.hpp" // export
@@ -14,12 +15,16 @@
 #include "function_timer.hpp" // export
 #if HI_OPERATING_SYSTEM == HI_OS_WINDOWS
 #include "loop_win32_intf.hpp" // export
+#elif HI_OPERATING_SYSTEM == HI_OS_LINUX
+#include "loop_linux_intf.hpp" // export
 #endif
 #include "notifier.hpp" // export
 #include "progress.hpp" // export
 #include "socket_event.hpp" // export
+#include "startup_graph.hpp" // export
 #include "task_controller.hpp" // export
 #include "task.hpp" // export
+#include "thread_pool.hpp" // export
 #include "when_any.hpp" // export
 
 /** @module hikogui.dispatch
@@ -73,10 +78,16 @@
  *
  * Async task
  * ----------
- * The `hi::async_task()` function will call a given function and run it
- * using `std::async()` and control it using a co-routine which loops
- * until the function as completed. If the function passed to `hi::async_task()`
- * is a `hi::task` co-routine, then that function is called directly.
+ * The `hi::async_task()` function will call a given function on the
+ * `hi::thread_pool::global()` from a co-routine, which resumes on the loop of
+ * the calling thread when the function has completed. If the function passed
+ * to `hi::async_task()` is a `hi::task` co-routine, then that function is called directly.
+ *
+ * Thread pool
+ * -----------
+ * The `hi::thread_pool` is a pool of work-stealing threads for heavy work.
+ * A co-routine moves to the pool with `co_await pool.schedule()` and moves
+ * back to the main thread with `co_await hi::loop::main().schedule()`.
  *
  * `hi::cancelable_async_task()` is simular to `hi::async_task()` but it will
  * take a `std::stop_token` and `hi::progress_token` to cancel and track progress
@@ -18,6 +18,15 @@ hi_export_module(hikogui.dispatch.function_timer);
 hi_export namespace hi::inline v1 {
 
 /** A timer that calls functions.
+ *
+ * The functions are stored in a 4-ary min-heap ordered by their deadline, so
+ * that adding a function and re-arming a repeating function are O(log n).
+ *
+ * A function is cancelled by destroying the `callback` that was returned when
+ * it was added. Since a callback may be destroyed from any thread, the function
+ * is not removed from the heap immediately; it is dropped when it reaches the
+ * top of the heap, or when the heap is purged of cancelled functions after it
+ * has doubled in size.
  */
 class function_timer {
 public:
@@ -37,14 +46,8 @@ public:
     template<forward_of<void()> Func>
     [[nodiscard]] std::pair<callback<void()>, bool> delay_function(utc_nanoseconds time_point, Func &&func) noexcept
     {
-        auto const it = std::lower_bound(_functions.begin(), _functions.end(), time_point, [](auto const& x, auto const& time_point) {
-            return x.time_point > time_point;
-        });
-
-        auto const next_to_call = it == _functions.end();
-
         auto token = callback<void()>{std::forward<Func>(func)};
-        _functions.emplace(it, time_point, std::chrono::nanoseconds::max(), token);
+        auto const next_to_call = push(timer_type{time_point, std::chrono::nanoseconds::max(), token});
         return {std::move(token), next_to_call};
     }
 
@@ -61,13 +64,9 @@ public:
         utc_nanoseconds time_point,
         Func &&func) noexcept
     {
-        auto it = std::lower_bound(_functions.begin(), _functions.end(), time_point, [](auto const& x, auto const& time_point) {
-            return x.time_point > time_point;
-        });
-
         auto token = callback<void()>{std::forward<Func>(func)};
-        it = _functions.emplace(it, time_point, period, token);
-        return {std::move(token), it + 1 == _functions.end()};
+        auto const next_to_call = push(timer_type{time_point, period, token});
+        return {std::move(token), next_to_call};
     }
 
     /** Add a function to be called repeatedly.
@@ -91,7 +90,7 @@ public:
         if (_functions.empty()) {
             return utc_nanoseconds::max();
         } else {
-            return _functions.back().time_point;
+            return _functions.front().time_point;
         }
     }
 
@@ -124,51 +123,126 @@ private:
         {
         }
 
-        timer_type(utc_nanoseconds time_point, weak_callback<void()> callback) noexcept :
-            timer_type(time_point, std::chrono::nanoseconds::max(), std::move(callback))
-        {
-        }
-
-        timer_type(std::chrono::nanoseconds period, weak_callback<void()> callback) noexcept :
-            timer_type(std::chrono::utc_clock::now(), period, std::move(callback))
-        {
-        }
-
         [[nodiscard]] constexpr bool repeats() const noexcept
         {
             return period != std::chrono::nanoseconds::max();
         }
     };
 
-    void remove_or_reinsert(utc_nanoseconds current_time) noexcept
+    /** The number of children of each node in the heap.
+     */
+    constexpr static std::size_t arity = 4;
+
+    /** The minimum size of the heap before it is purged of cancelled functions.
+     */
+    constexpr static std::size_t minimum_purge_size = 64;
+
+    /** Functions, as a min-heap on the time_point.
+     */
+    std::vector<timer_type> _functions;
+
+    /** The size of the heap at which the cancelled functions are purged.
+     */
+    std::size_t _purge_size = minimum_purge_size;
+
+    /** Move a function up the heap to its position.
+     *
+     * @param i The index of the function.
+     * @return The new index of the function.
+     */
+    std::size_t sift_up(std::size_t i) noexcept
     {
-        hi_assert(not _functions.empty());
+        auto item = std::move(_functions[i]);
+        while (i != 0) {
+            auto const parent = (i - 1) / arity;
+            if (not(item.time_point < _functions[parent].time_point)) {
+                break;
+            }
+            _functions[i] = std::move(_functions[parent]);
+            i = parent;
+        }
+        _functions[i] = std::move(item);
+        return i;
+    }
 
-        if (_functions.back().repeats() and not _functions.back().callback.expired()) {
-            // When the function is repeating, calculate the new.
-            auto item = std::move(_functions.back());
-            _functions.pop_back();
+    /** Move a function down the heap to its position.
+     *
+     * @param i The index of the function.
+     */
+    void sift_down(std::size_t i) noexcept
+    {
+        auto const size = _functions.size();
+        auto item = std::move(_functions[i]);
+        while (true) {
+            auto const first_child = i * arity + 1;
+            if (first_child >= size) {
+                break;
+            }
 
-            // Delay the function to be called on the next period.
-            // However if the current_time already is passed the deadline, delay it even further.
-            item.time_point += item.period;
-            if (item.time_point > current_time) {
-                item.time_point = current_time + item.period;
+            auto const last_child = std::min(first_child + arity, size);
+            auto smallest = first_child;
+            for (auto child = first_child + 1; child < last_child; ++child) {
+                if (_functions[child].time_point < _functions[smallest].time_point) {
+                    smallest = child;
+                }
             }
 
-            // Reinsert the function in the sorted list of functions.
-            auto const it = std::lower_bound(_functions.begin(), _functions.end(), item.time_point, [](auto const& x, auto const& time_point) {
-                return x.time_point > time_point;
-            });
+            if (not(_functions[smallest].time_point < item.time_point)) {
+                break;
+            }
+            _functions[i] = std::move(_functions[smallest]);
+            i = smallest;
+        }
+        _functions[i] = std::move(item);
+    }
+
+    /** Add a function to the heap.
+     *
+     * @return True if the function is the next to be called.
+     */
+    bool push(timer_type item) noexcept
+    {
+        if (_functions.size() >= _purge_size) {
+            purge();
+        }
+
+        _functions.push_back(std::move(item));
+        return sift_up(_functions.size() - 1) == 0;
+    }
 
-            _functions.insert(it, std::move(item));
+    /** Remove the function at the top of the heap.
+     */
+    void pop() noexcept
+    {
+        hi_assert(not _functions.empty());
 
+        if (_functions.size() > 1) {
+            _functions.front() = std::move(_functions.back());
+            _functions.pop_back();
+            sift_down(0);
         } else {
             _functions.pop_back();
         }
     }
 
-    /** Call the next function on the list.
+    /** Remove all cancelled functions and rebuild the heap.
+     */
+    void purge() noexcept
+    {
+        std::erase_if(_functions, [](auto const& item) {
+            return item.callback.expired();
+        });
+
+        if (auto const size = _functions.size(); size > 1) {
+            for (auto i = (size - 2) / arity + 1; i != 0; --i) {
+                sift_down(i - 1);
+            }
+        }
+
+        _purge_size = std::max(minimum_purge_size, _functions.size() * 2);
+    }
+
+    /** Call the next function on the heap.
      *
      * @note it is undefined behavior to call this function if the current_deadline() has not passed.
      * @param current_time The current time, this is used when reinserting periodic function to handle starvation issues.
@@ -177,16 +251,27 @@ private:
     {
         hi_assert(not _functions.empty());
 
-        auto &callback = _functions.back().callback;
-        if (auto cb = callback.lock()) {
+        auto &item = _functions.front();
+        auto cb = item.callback.lock();
+
+        // Remove or re-arm the function before calling it, since the function may add new functions.
+        if (cb and item.repeats()) {
+            // Delay the function to be called on the next period.
+            // However if the current_time already is passed the deadline, delay it even further.
+            item.time_point += item.period;
+            if (item.time_point <= current_time) {
+                item.time_point = current_time + item.period;
+            }
+            sift_down(0);
+
+        } else {
+            pop();
+        }
+
+        if (cb) {
             cb();
         }
-        remove_or_reinsert(current_time);
     }
-
-    /** Functions, sorted by descending time.
-     */
-    std::vector<timer_type> _functions;
 };
 
 } // namespace hi::inline v1
@@ -0,0 +1,101 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "function_timer.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <chrono>
+
+TEST_SUITE(function_timer) {
+
+TEST_CASE(delay_order)
+{
+    using namespace std::chrono_literals;
+
+    auto const start = hi::utc_nanoseconds{} + 1s;
+    auto timer = hi::function_timer{};
+    auto order = std::vector<int>{};
+    auto tokens = std::vector<hi::callback<void()>>{};
+
+    // Insert the functions out of order; the deadlines of function i is start + i ms.
+    auto const permutation = std::vector<int>{7, 3, 9, 0, 5, 1, 8, 2, 6, 4};
+    for (auto i : permutation) {
+        auto [token, next_to_call] = timer.delay_function(start + i * 1ms, [&order, i] {
+            order.push_back(i);
+        });
+        tokens.push_back(std::move(token));
+        REQUIRE(next_to_call == (i == 7 or i == 3 or i == 0));
+    }
+    REQUIRE(timer.current_deadline() == start);
+
+    timer.run_all(start + 4ms);
+    auto const first_half = std::vector<int>{0, 1, 2, 3, 4};
+    REQUIRE(order == first_half);
+    REQUIRE(timer.current_deadline() == start + 5ms);
+
+    timer.run_all(start + 1s);
+    auto const all = std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    REQUIRE(order == all);
+    REQUIRE(timer.empty());
+}
+
+TEST_CASE(cancel)
+{
+    using namespace std::chrono_literals;
+
+    auto const start = hi::utc_nanoseconds{} + 1s;
+    auto timer = hi::function_timer{};
+    auto count = 0;
+    auto tokens = std::vector<hi::callback<void()>>{};
+
+    for (auto i = 0; i != 1000; ++i) {
+        tokens.push_back(timer.delay_function(start + i * 1ms, [&count] {
+            ++count;
+        }).first);
+    }
+
+    // Cancel every other function by destroying its callback.
+    for (auto i = std::size_t{0}; i < tokens.size(); i += 2) {
+        tokens[i] = nullptr;
+    }
+
+    timer.run_all(start + 1s);
+    REQUIRE(count == 500);
+    REQUIRE(timer.empty());
+}
+
+TEST_CASE(repeat)
+{
+    using namespace std::chrono_literals;
+
+    auto const start = hi::utc_nanoseconds{} + 1s;
+    auto timer = hi::function_timer{};
+    auto fast = 0;
+    auto slow = 0;
+
+    auto fast_token = timer.repeat_function(10ms, start, [&fast] {
+        ++fast;
+    }).first;
+    auto slow_token = timer.repeat_function(25ms, start, [&slow] {
+        ++slow;
+    }).first;
+
+    for (auto t = start; t <= start + 100ms; t += 1ms) {
+        timer.run_all(t);
+    }
+    REQUIRE(fast == 11);
+    REQUIRE(slow == 5);
+
+    // When the timer is late, a repeating function is called once and delayed to the next period.
+    timer.run_all(start + 500ms);
+    REQUIRE(fast == 12);
+    REQUIRE(timer.current_deadline() == start + 510ms);
+
+    fast_token = nullptr;
+    slow_token = nullptr;
+    timer.run_all(start + 1s);
+    REQUIRE(timer.empty());
+}
+
+};
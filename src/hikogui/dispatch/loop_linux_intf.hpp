@@ -0,0 +1,781 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "function_timer.hpp"
+#include "socket_event.hpp"
+#include "notifier.hpp"
+#include "../container/container.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../concurrency/unfair_mutex.hpp" // XXX #616
+#include "../concurrency/thread.hpp" // XXX #616
+#include "../time/time.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#include <functional>
+#include <type_traits>
+#include <concepts>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <chrono>
+#include <thread>
+#include <coroutine>
+#include <ranges>
+#include <atomic>
+#include <optional>
+#include <algorithm>
+#include <format>
+
+hi_export_module(hikogui.dispatch : loop_intf);
+
+hi_export namespace hi::inline v1 {
+
+/** The event loop on Linux.
+ *
+ * The loop blocks in `epoll_wait()` on an eventfd for posted functions, a
+ * timerfd for the render ticks, and on every socket that was added.
+ * Unlike `MsgWaitForMultipleObjects()` on win32 there is no limit on the
+ * number of sockets, and waking up costs the same for one or thousands of
+ * sockets; only the sockets that are ready are returned by the kernel.
+ */
+class loop {
+public:
+    loop(loop const&) = delete;
+    loop(loop&&) noexcept = delete;
+    loop& operator=(loop const&) = delete;
+    loop& operator=(loop&&) noexcept = delete;
+
+    ~loop()
+    {
+        // The sockets are owned by the caller of add_socket(), only the file descriptors of the loop itself are closed.
+        if (::close(_render_fd) != 0) {
+            hi_log_error("Could not close render-timer file descriptor. {}", get_last_error_message());
+        }
+        if (::close(_function_fd) != 0) {
+            hi_log_error("Could not close async-event file descriptor. {}", get_last_error_message());
+        }
+        if (::close(_epoll_fd) != 0) {
+            hi_log_error("Could not close epoll file descriptor. {}", get_last_error_message());
+        }
+    }
+
+    loop() noexcept : _thread_id(current_thread_id())
+    {
+        _epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (_epoll_fd == -1) {
+            hi_log_fatal("Could not create an epoll file descriptor. {}", get_last_error_message());
+        }
+
+        // A counter which is set by notify_has_send() and read when the functions are handled.
+        _function_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (_function_fd == -1) {
+            hi_log_fatal("Could not create an async-event file descriptor. {}", get_last_error_message());
+        }
+
+        // A timer which is armed while there are render functions.
+        _render_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+        if (_render_fd == -1) {
+            hi_log_fatal("Could not create a render-timer file descriptor. {}", get_last_error_message());
+        }
+
+        for (auto const fd : {_function_fd, _render_fd}) {
+            auto event = epoll_event{};
+            event.events = EPOLLIN;
+            event.data.fd = fd;
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+                hi_log_fatal("Could not add file descriptor {} to epoll. {}", fd, get_last_error_message());
+            }
+        }
+
+        _epoll_events.resize(64);
+    }
+
+    /** Get or create the thread-local loop.
+     */
+    [[nodiscard]] static loop& local() noexcept;
+
+    /** Get or create the main-loop.
+     *
+     * @note The first time main() is called must be from the main-thread.
+     *       In this case there is no race condition on the first time main() is called.
+     */
+    [[nodiscard]] hi_no_inline static loop& main() noexcept
+    {
+        if (auto ptr = _main.load(std::memory_order::acquire)) {
+            return *ptr;
+        }
+
+        hi_axiom(_timer.load(std::memory_order::relaxed) == nullptr, "loop::main() must be called before loop::timer()");
+
+        // This is the first time loop::main() is called so we must be on the main-thread
+        // So name the thread "main" so we can find it during debugging.
+        set_thread_name("main");
+
+        auto ptr = std::addressof(local());
+        _main.store(ptr, std::memory_order::release);
+        return *ptr;
+    }
+
+    /** Get or create the timer event-loop.
+     *
+     * @note The first time this is called a thread is started to handle the timer events.
+     */
+    [[nodiscard]] hi_no_inline static loop& timer() noexcept
+    {
+        // The first time timer() is called, make sure that the main-loop exists,
+        // or even create the main-loop on the current thread.
+        [[maybe_unused]] auto const &tmp = loop::main();
+
+        return *start_subsystem_or_terminate(_timer, nullptr, timer_init, timer_deinit);
+    }
+
+    /** Set maximum frame rate.
+     *
+     * @param frame_rate The maximum frame rate that a window will be updated.
+     */
+    void set_maximum_frame_rate(double frame_rate) noexcept
+    {
+        hi_axiom(on_thread());
+        hi_axiom(frame_rate > 0.0);
+
+        _maximum_frame_rate = frame_rate;
+        _minimum_frame_time = std::chrono::nanoseconds(static_cast<int64_t>(1'000'000'000.0 / frame_rate));
+        if (not _render_functions.empty()) {
+            arm_render_timer(_minimum_frame_time);
+        }
+    }
+
+    /** The minimum time between frames, from the maximum frame rate.
+     *
+     * This may be used to throttle updates from background work to the rate at which
+     * windows are redrawn.
+     */
+    [[nodiscard]] std::chrono::nanoseconds minimum_frame_time() const noexcept
+    {
+        return _minimum_frame_time;
+    }
+
+    /** Set the monitor id for vertical sync.
+     *
+     * @note There is no vertical sync on Linux, the render functions are called
+     *       at the maximum frame rate.
+     */
+    void set_vsync_monitor_id(uintptr_t id) noexcept
+    {
+        _selected_monitor_id.store(id, std::memory_order::relaxed);
+    }
+
+    /** Start rendering just in time before the next vertical blank.
+     *
+     * @note There is no vertical sync on Linux, the render functions are called
+     *       at the maximum frame rate in both modes.
+     * @note It is safe to call this function from another thread.
+     * @param low_latency Turn on low-latency mode.
+     */
+    void set_low_latency(bool low_latency) noexcept
+    {
+        _low_latency.store(low_latency, std::memory_order::relaxed);
+    }
+
+    /** Wait-free post a function to be called from the loop.
+     *
+     * @note It is safe to call this function from another thread.
+     * @note The event loop is not directly notified that a new function exists
+     *       and will be delayed until after the loop has woken for other work.
+     * @note The post is only wait-free if the function fifo is not full,
+     *       and the function is small enough to fit in a slot on the fifo.
+     * @param func The function to call from the loop. The function must not take any arguments and return void.
+     */
+    template<forward_of<void()> Func>
+    void wfree_post_function(Func&& func) noexcept
+    {
+        _function_fifo.add_function(std::forward<Func>(func));
+    }
+
+    /** Post a function to be called from the loop.
+     *
+     * @note It is safe to call this function from another thread.
+     * @param func The function to call from the loop. The function must not take any arguments and return void.
+     */
+    template<forward_of<void()> Func>
+    void post_function(Func&& func) noexcept
+    {
+        _function_fifo.add_function(std::forward<Func>(func));
+        notify_has_send();
+    }
+
+    /** Post a range of functions to be called from the loop.
+     *
+     * The loop is woken up only once for all the functions. This should be
+     * used when a background thread sends many results to the loop at once.
+     *
+     * @note It is safe to call this function from another thread.
+     * @param functions The functions to call from the loop, in order. The functions must
+     *                  not take any arguments and return void. Each function is forwarded
+     *                  from the range, an rvalue range of function objects is moved from.
+     */
+    template<std::ranges::input_range Range>
+        requires forward_of<std::ranges::range_reference_t<Range>, void()>
+    void post_functions(Range&& functions) noexcept
+    {
+        for (auto&& func : functions) {
+            _function_fifo.add_function(std::forward<decltype(func)>(func));
+        }
+        notify_has_send();
+    }
+
+    /** An awaiter that resumes the co-routine on the thread of a loop.
+     */
+    class schedule_awaiter {
+    public:
+        constexpr schedule_awaiter(loop& loop) noexcept : _loop(&loop) {}
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return _loop->on_thread();
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            _loop->post_function([handle] {
+                handle.resume();
+            });
+        }
+
+        constexpr void await_resume() const noexcept {}
+
+    private:
+        loop *_loop;
+    };
+
+    /** Create an awaiter which resumes the co-routine on the thread of the loop.
+     *
+     * When the co-routine is already running on the loop's thread it continues without suspending.
+     * This is used to return to the main thread after doing work on a `thread_pool`:
+     * `co_await loop::main().schedule()`.
+     */
+    [[nodiscard]] schedule_awaiter schedule() noexcept
+    {
+        return schedule_awaiter{*this};
+    }
+
+    /** Call a function from the loop.
+     *
+     * @note It is safe to call this function from another thread.
+     * @param func The function to call from the loop. The function must not take any argument,
+     *             but may return a value.
+     * @return A `std::future` for the return value.
+     */
+    template<typename Func>
+    [[nodiscard]] auto async_function(Func&& func) noexcept
+    {
+        auto future = _function_fifo.add_async_function(std::forward<Func>(func));
+        notify_has_send();
+        return future;
+    }
+
+    /** Call a function at a certain time.
+     *
+     * @param time_point The time at which to call the function.
+     * @param func The function to be called.
+     */
+    template<forward_of<void()> Func>
+    [[nodiscard]] callback<void()> delay_function(utc_nanoseconds time_point, Func&& func) noexcept
+    {
+        auto [callback, first_to_call] = _function_timer.delay_function(time_point, std::forward<Func>(func));
+        if (first_to_call) {
+            // Notify if the added function is the next function to call.
+            notify_has_send();
+        }
+        return std::move(callback);
+    }
+
+    /** Call a function repeatedly.
+     *
+     * @param period The period between calls to the function.
+     * @param time_point The time at which to call the function.
+     * @param func The function to be called.
+     */
+    template<forward_of<void()> Func>
+    [[nodiscard]] callback<void()>
+    repeat_function(std::chrono::nanoseconds period, utc_nanoseconds time_point, Func&& func) noexcept
+    {
+        auto [callback, first_to_call] = _function_timer.repeat_function(period, time_point, std::forward<Func>(func));
+        if (first_to_call) {
+            // Notify if the added function is the next function to call.
+            notify_has_send();
+        }
+        return callback;
+    }
+
+    /** Call a function repeatedly.
+     *
+     * @param period The period between calls to the function.
+     * @param func The function to be called.
+     */
+    template<forward_of<void()> Func>
+    [[nodiscard]] callback<void()> repeat_function(std::chrono::nanoseconds period, Func&& func) noexcept
+    {
+        auto [callback, first_to_call] = _function_timer.repeat_function(period, std::forward<Func>(func));
+        if (first_to_call) {
+            // Notify if the added function is the next function to call.
+            notify_has_send();
+        }
+        return std::move(callback);
+    }
+
+    /** Request the render functions to be called on the next frame.
+     *
+     * The render functions are only called on frames for which a render was
+     * requested. When nothing requests a render the render timer is stopped,
+     * so that an idle application does not use CPU or GPU time.
+     *
+     * @note It is safe to call this function from another thread.
+     */
+    void request_render() noexcept
+    {
+        if (not _render_requested.exchange(true, std::memory_order::acq_rel)) {
+            ++global_counter<"loop:render:resume">;
+            arm_render_timer(_minimum_frame_time);
+        }
+    }
+
+    /** Subscribe a render function to be called at the frame rate.
+     *
+     * A render function should call `request_render()` when it needs to be
+     * called again, for example while animating.
+     *
+     * @param f A function to be called on each frame.
+     */
+    template<forward_of<void(utc_nanoseconds)> Func>
+    callback<void(utc_nanoseconds)> subscribe_render(Func &&func) noexcept
+    {
+        hi_axiom(on_thread());
+
+        auto cb = callback<void(utc_nanoseconds)>{std::forward<Func>(func)};
+
+        _render_functions.push_back(cb);
+
+        // Start the render timer once there is a window.
+        _render_requested.store(true, std::memory_order::release);
+        if (_render_functions.size() == 1) {
+            arm_render_timer(_minimum_frame_time);
+        }
+
+        return cb;
+    }
+
+    /** Add a callback that reacts on a socket.
+     *
+     * In most cases @a mode is set to one of the following values:
+     * - error | read: Unblock when there is data available for read.
+     * - error | write: Unblock when there is buffer space available for write.
+     * - error | read | write: Unblock when there is data available for read of when there is buffer space available for write.
+     *
+     * The socket is level-triggered; the callback is called on each iteration of
+     * the loop until the data is read, or the buffer space is used.
+     *
+     * @note Only one callback can be associated with a socket, adding the same
+     *       socket again replaces the callback and event mask.
+     * @param fd File descriptor of the socket.
+     * @param event_mask The socket events to wait for.
+     * @param f The callback to call when the file descriptor unblocks.
+     * @throws os_error When the socket could not be added to epoll.
+     */
+    void add_socket(int fd, socket_event event_mask, std::function<void(int, socket_events const&)> f)
+    {
+        hi_axiom(on_thread());
+        hi_axiom(fd >= 0);
+
+        auto event = epoll_event{};
+        event.events = socket_event_to_epoll(event_mask);
+        event.data.fd = fd;
+
+        auto const it = _sockets.find(fd);
+        auto const op = it == _sockets.end() ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+        if (epoll_ctl(_epoll_fd, op, fd, &event) != 0) {
+            throw os_error(std::format("Could not add socket {} to epoll. '{}'", fd, get_last_error_message()));
+        }
+
+        auto socket = std::make_shared<socket_type>(event_mask, std::move(f));
+        if (it == _sockets.end()) {
+            _sockets.emplace(fd, std::move(socket));
+        } else {
+            it->second = std::move(socket);
+        }
+    }
+
+    /** Remove the callback associated with a socket.
+     *
+     * This may be called from a socket callback, including the callback of the socket itself.
+     *
+     * @param fd The file descriptor of the socket.
+     */
+    void remove_socket(int fd)
+    {
+        hi_axiom(on_thread());
+
+        if (_sockets.erase(fd) == 0) {
+            return;
+        }
+
+        // When the socket was already closed, the kernel has already removed it from epoll.
+        if (epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, nullptr) != 0 and errno != EBADF and errno != ENOENT) {
+            hi_log_error("Could not remove socket {} from epoll. {}", fd, get_last_error_message());
+        }
+    }
+
+    /** Resume the loop on the current thread.
+     *
+     * @param stop_token The thread's stop token to use to determine when to stop.
+     *                   If not stop token is given, then resume will automatically stop when there
+     *                   are no more windows, sockets, functions or timers.
+     * @return Exit code when the loop is exited.
+     */
+    int resume(std::stop_token stop_token = {}) noexcept
+    {
+        _exit_code = {};
+        while (not _exit_code) {
+            resume_once(true);
+
+            if (stop_token.stop_possible()) {
+                if (stop_token.stop_requested()) {
+                    // Stop immediately when stop is requested.
+                    _exit_code = 0;
+                }
+            } else {
+                if (_render_functions.empty() and _function_fifo.empty() and _function_timer.empty() and _sockets.empty()) {
+                    // If there is not stop token, then exit when there are no more resources to wait on.
+                    _exit_code = 0;
+                }
+            }
+        }
+
+        return *_exit_code;
+    }
+
+    /** Resume for a single iteration.
+     *
+     * It should be called often, as it will be used to process network messages and
+     * latency of network processing will be increased based on the amount of times
+     * this function is called.
+     *
+     * @note This function must be called from the same thread as `resume()`.
+     * @param block Allow processing to block, this is normally done only inside `resume()`.
+     */
+    void resume_once(bool block = false) noexcept
+    {
+        using namespace std::chrono_literals;
+
+        hi_axiom(on_thread());
+
+        auto timeout_ms = 0;
+        if (block) {
+            auto current_time = std::chrono::utc_clock::now();
+            auto timeout =
+                std::chrono::duration_cast<std::chrono::milliseconds>(_function_timer.current_deadline() - current_time);
+
+            timeout = std::clamp(timeout, 0ms, 100ms);
+            timeout_ms = narrow_cast<int>(timeout / 1ms);
+        }
+
+        auto const num_events = epoll_wait(_epoll_fd, _epoll_events.data(), narrow_cast<int>(_epoll_events.size()), timeout_ms);
+        if (num_events == -1) {
+            if (errno != EINTR) {
+                hi_log_fatal("Failed on epoll_wait(), {}", get_last_error_message());
+            }
+
+        } else {
+            for (auto i = 0_uz; i != narrow_cast<std::size_t>(num_events); ++i) {
+                auto const& event = _epoll_events[i];
+
+                if (event.data.fd == _function_fd) {
+                    // handle_functions() and handle_timers() is called after every wake-up of epoll_wait().
+                    auto count = uint64_t{};
+                    [[maybe_unused]] auto const r = ::read(_function_fd, &count, sizeof(count));
+
+                } else if (event.data.fd == _render_fd) {
+                    auto count = uint64_t{};
+                    [[maybe_unused]] auto const r = ::read(_render_fd, &count, sizeof(count));
+                    handle_render();
+
+                } else {
+                    handle_socket(event.data.fd, event.events);
+                }
+            }
+
+            // When all the slots were used there may be more sockets ready than fit in the buffer.
+            if (narrow_cast<std::size_t>(num_events) == _epoll_events.size()) {
+                _epoll_events.resize(_epoll_events.size() * 2);
+            }
+        }
+
+        // Make sure timers are handled first, possibly they are time critical.
+        handle_timers();
+
+        // When functions are added wait-free, the function-event is never triggered.
+        // So handle messages after any kind of wake up.
+        handle_functions();
+    }
+
+    /** Check if the current thread is the same as the loop's thread.
+     *
+     * The loop's thread is the thread that calls resume().
+     */
+    [[nodiscard]] bool on_thread() const noexcept
+    {
+        return current_thread_id() == _thread_id;
+    }
+
+private:
+    struct socket_type {
+        socket_event mode;
+        std::function<void(int, socket_events const&)> callback;
+    };
+
+    /** Pointer to the main-loop.
+     */
+    inline static std::atomic<loop *> _main;
+
+    /** Pointer to the timer-loop.
+     */
+    inline static std::atomic<loop *> _timer;
+
+    inline static std::jthread _timer_thread;
+
+    function_fifo<> _function_fifo;
+
+    /** The async-event has been signalled, and the functions have not been handled since.
+     */
+    std::atomic<bool> _function_signalled = false;
+    function_timer _function_timer;
+
+    std::optional<int> _exit_code = {};
+    double _maximum_frame_rate = 30.0;
+    std::chrono::nanoseconds _minimum_frame_time = std::chrono::nanoseconds(33'333'333);
+    thread_id _thread_id;
+    std::vector<weak_callback<void(utc_nanoseconds)>> _render_functions;
+
+    /** A render was requested since the render functions were last called.
+     */
+    std::atomic<bool> _render_requested = true;
+
+    /** The epoll file descriptor which waits on all other file descriptors.
+     */
+    int _epoll_fd = -1;
+
+    /** The eventfd which is written to when a function is posted.
+     */
+    int _function_fd = -1;
+
+    /** The timerfd which expires at the frame rate when there are render functions.
+     */
+    int _render_fd = -1;
+
+    /** The buffer for the events returned by `epoll_wait()`.
+     *
+     * The buffer grows when it was filled completely by `epoll_wait()`.
+     */
+    std::vector<epoll_event> _epoll_events;
+
+    /** The sockets, and the functions to call on an event.
+     *
+     * The socket is held by a shared_ptr so that a callback can remove its own socket.
+     */
+    std::unordered_map<int, std::shared_ptr<socket_type>> _sockets;
+
+    /** The monitor id that is selected for vsync.
+     */
+    std::atomic<std::uintptr_t> _selected_monitor_id = 0;
+
+    /** Render just in time before the next vertical blank.
+     */
+    std::atomic<bool> _low_latency = false;
+
+    static loop *timer_init() noexcept
+    {
+        hi_assert(not _timer_thread.joinable());
+
+        _timer_thread = std::jthread{[](std::stop_token stop_token) {
+            _timer.store(std::addressof(loop::local()), std::memory_order::release);
+
+            set_thread_name("timer");
+            loop::local().resume(stop_token);
+        }};
+
+        while (true) {
+            if (auto ptr = _timer.load(std::memory_order::relaxed)) {
+                return ptr;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    }
+
+    static void timer_deinit() noexcept
+    {
+        if (auto const *const ptr = _timer.exchange(nullptr, std::memory_order::acquire)) {
+            hi_assert(_timer_thread.joinable());
+            _timer_thread.request_stop();
+            _timer_thread.join();
+        }
+    }
+
+    /** Notify the event loop that a function was added to the _function_fifo.
+     */
+    void notify_has_send() noexcept
+    {
+        // Only the first notification since the functions were last handled signals
+        // the event; a burst of posts will wake up the loop once.
+        if (_function_signalled.exchange(true, std::memory_order::acq_rel)) {
+            return;
+        }
+
+        auto const count = uint64_t{1};
+        if (::write(_function_fd, &count, sizeof(count)) != sizeof(count)) {
+            hi_log_error("Could not trigger async-event. {}", get_last_error_message());
+        }
+    }
+
+    /** Start or stop the render timer.
+     *
+     * @param period The period of the timer, or zero to stop the timer.
+     */
+    void arm_render_timer(std::chrono::nanoseconds period) noexcept
+    {
+        auto spec = itimerspec{};
+        spec.it_interval.tv_sec = narrow_cast<time_t>(period.count() / 1'000'000'000);
+        spec.it_interval.tv_nsec = narrow_cast<long>(period.count() % 1'000'000'000);
+        spec.it_value = spec.it_interval;
+        if (timerfd_settime(_render_fd, 0, &spec, nullptr) != 0) {
+            hi_log_error("Could not set the render timer. {}", get_last_error_message());
+        }
+    }
+
+    /** Call the render functions.
+     */
+    void handle_render() noexcept
+    {
+        ++global_counter<"loop:frame">;
+
+        auto const display_time = std::chrono::utc_clock::now() + _minimum_frame_time;
+
+        // The render functions will request a render again if they need another frame.
+        _render_requested.store(false, std::memory_order::release);
+
+        for (auto& render_function : _render_functions) {
+            if (auto rf = render_function.lock()) {
+                rf(display_time);
+            }
+        }
+
+        std::erase_if(_render_functions, [](auto& render_function) {
+            return render_function.expired();
+        });
+
+        if (_render_functions.empty()) {
+            // Stop the render timer when there are no more windows.
+            arm_render_timer(std::chrono::nanoseconds{0});
+
+        } else if (not _render_requested.load(std::memory_order::acquire)) {
+            // Stop the render timer until a render is requested.
+            ++global_counter<"loop:render:idle">;
+            arm_render_timer(std::chrono::nanoseconds{0});
+
+            if (_render_requested.load(std::memory_order::acquire)) {
+                // A render was requested by another thread while stopping the timer.
+                arm_render_timer(_minimum_frame_time);
+            }
+        }
+    }
+
+    /** Call the function of a socket that is ready.
+     *
+     * @param fd The file descriptor of the socket.
+     * @param events The events returned by `epoll_wait()`.
+     */
+    void handle_socket(int fd, uint32_t events) noexcept
+    {
+        auto const it = _sockets.find(fd);
+        if (it == _sockets.end()) {
+            // The socket was removed by a callback earlier in this iteration.
+            return;
+        }
+
+        auto error = 0;
+        if (events & EPOLLERR) {
+            auto error_size = socklen_t{sizeof(error)};
+            if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &error_size) != 0) {
+                error = errno;
+            }
+        }
+
+        // Keep the socket alive, since the callback may remove it.
+        auto const socket = it->second;
+        auto const socket_events_ = socket_events_from_epoll(events, socket->mode, error);
+        if (to_bool(socket_events_.events)) {
+            socket->callback(fd, socket_events_);
+        }
+    }
+
+    /** Handle all function calls.
+     */
+    void handle_functions() noexcept
+    {
+        // Clear the flag before draining the fifo, so that a function posted
+        // while draining will signal the event again.
+        _function_signalled.exchange(false, std::memory_order::acq_rel);
+        _function_fifo.run_all();
+    }
+
+    void handle_timers() noexcept
+    {
+        _function_timer.run_all(std::chrono::utc_clock::now());
+    }
+};
+
+namespace detail {
+inline thread_local std::unique_ptr<loop> thread_local_loop;
+}
+
+/** Get or create the thread-local loop.
+ */
+[[nodiscard]] hi_no_inline inline loop& loop::local() noexcept
+{
+    if (not detail::thread_local_loop) {
+        detail::thread_local_loop = std::make_unique<loop>();
+    }
+    return *detail::thread_local_loop;
+}
+
+template<typename R, typename... Args>
+template<forward_of<void()> Func>
+void notifier<R(Args...)>::loop_local_post_function(Func&& func) const noexcept
+{
+    return loop::local().post_function(std::forward<Func>(func));
+}
+
+template<typename R, typename... Args>
+template<forward_of<void()> Func>
+void notifier<R(Args...)>::loop_main_post_function(Func&& func) const noexcept
+{
+    return loop::main().post_function(std::forward<Func>(func));
+}
+
+template<typename R, typename... Args>
+template<forward_of<void()> Func>
+void notifier<R(Args...)>::loop_timer_post_function(Func&& func) const noexcept
+{
+    return loop::timer().post_function(std::forward<Func>(func));
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,108 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../macros.hpp"
+#if HI_OPERATING_SYSTEM == HI_OS_LINUX
+#include "loop_linux_intf.hpp"
+#include <hikotest/hikotest.hpp>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <array>
+#include <vector>
+#include <thread>
+
+TEST_SUITE(loop_linux) {
+
+TEST_CASE(many_sockets)
+{
+    auto& loop = hi::loop::local();
+
+    // More sockets than fit in a single wait on win32.
+    auto pairs = std::vector<std::array<int, 2>>(200);
+    auto num_reads = 0;
+    auto num_closes = 0;
+    for (auto& pair : pairs) {
+        REQUIRE(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, pair.data()) == 0);
+        loop.add_socket(pair[0], hi::socket_event::read | hi::socket_event::close, [&](int fd, hi::socket_events const& events) {
+            if (to_bool(events.events & hi::socket_event::close)) {
+                ++num_closes;
+                loop.remove_socket(fd);
+
+            } else if (to_bool(events.events & hi::socket_event::read)) {
+                char c;
+                if (::read(fd, &c, 1) == 1) {
+                    ++num_reads;
+                }
+            }
+        });
+    }
+
+    for (auto& pair : pairs) {
+        REQUIRE(::write(pair[1], "x", 1) == 1);
+    }
+    for (auto i = 0; i != 100 and num_reads != 200; ++i) {
+        loop.resume_once(true);
+    }
+    REQUIRE(num_reads == 200);
+
+    for (auto& pair : pairs) {
+        ::close(pair[1]);
+    }
+    for (auto i = 0; i != 100 and num_closes != 200; ++i) {
+        loop.resume_once(true);
+    }
+    REQUIRE(num_closes == 200);
+
+    for (auto& pair : pairs) {
+        ::close(pair[0]);
+    }
+}
+
+TEST_CASE(post_function_wakes_loop)
+{
+    auto& loop = hi::loop::local();
+
+    auto count = 0;
+    auto thread = std::jthread{[&] {
+        loop.post_function([&] {
+            ++count;
+        });
+    }};
+
+    while (count == 0) {
+        loop.resume_once(true);
+    }
+    REQUIRE(count == 1);
+}
+
+TEST_CASE(render_only_when_requested)
+{
+    auto& loop = hi::loop::local();
+
+    auto count = 0;
+    auto const cbt = loop.subscribe_render([&](hi::utc_nanoseconds) {
+        ++count;
+    });
+
+    while (count == 0) {
+        loop.resume_once(true);
+    }
+    REQUIRE(count == 1);
+
+    // Nothing requested another frame, so the render timer is stopped.
+    for (auto i = 0; i != 5; ++i) {
+        loop.resume_once(true);
+    }
+    REQUIRE(count == 1);
+
+    loop.request_render();
+    while (count == 1) {
+        loop.resume_once(true);
+    }
+    REQUIRE(count == 2);
+}
+
+};
+
+#endif
@@ -24,6 +24,10 @@
 #include <memory>
 #include <chrono>
 #include <thread>
+#include <coroutine>
+#include <ranges>
+#include <atomic>
+#include <algorithm>
 
 hi_export_module(hikogui.dispatch : loop_intf);
 
@@ -49,7 +53,7 @@ public:
         }
 
         if (_vsync_thread.joinable()) {
-            _vsync_thread.request_stop();
+            stop_vsync_thread();
             _vsync_thread.join();
         }
 
@@ -142,6 +146,16 @@ public:
         hi_axiom(on_thread());
     }
 
+    /** The minimum time between frames, from the maximum frame rate.
+     *
+     * This may be used to throttle updates from background work to the rate at which
+     * windows are redrawn.
+     */
+    [[nodiscard]] std::chrono::nanoseconds minimum_frame_time() const noexcept
+    {
+        return _minimum_frame_time;
+    }
+
     /** Set the monitor id for vertical sync.
      */
     void set_vsync_monitor_id(uintptr_t id) noexcept
@@ -149,6 +163,21 @@ public:
         _selected_monitor_id.store(id, std::memory_order::relaxed);
     }
 
+    /** Start rendering just in time before the next vertical blank.
+     *
+     * In low-latency mode the vsync thread delays calling the render functions
+     * until the measured duration of rendering before the predicted next
+     * vertical blank. Input that arrives during the delay is displayed on that
+     * vertical blank, instead of one frame later.
+     *
+     * @note It is safe to call this function from another thread.
+     * @param low_latency Turn on low-latency mode.
+     */
+    void set_low_latency(bool low_latency) noexcept
+    {
+        _low_latency.store(low_latency, std::memory_order::relaxed);
+    }
+
     /** Wait-free post a function to be called from the loop.
      *
      * @note It is safe to call this function from another thread.
@@ -176,6 +205,61 @@ public:
         notify_has_send();
     }
 
+    /** Post a range of functions to be called from the loop.
+     *
+     * The loop is woken up only once for all the functions. This should be
+     * used when a background thread sends many results to the loop at once.
+     *
+     * @note It is safe to call this function from another thread.
+     * @param functions The functions to call from the loop, in order. The functions must
+     *                  not take any arguments and return void. Each function is forwarded
+     *                  from the range, an rvalue range of function objects is moved from.
+     */
+    template<std::ranges::input_range Range>
+        requires forward_of<std::ranges::range_reference_t<Range>, void()>
+    void post_functions(Range&& functions) noexcept
+    {
+        for (auto&& func : functions) {
+            _function_fifo.add_function(std::forward<decltype(func)>(func));
+        }
+        notify_has_send();
+    }
+
+    /** An awaiter that resumes the co-routine on the thread of a loop.
+     */
+    class schedule_awaiter {
+    public:
+        constexpr schedule_awaiter(loop& loop) noexcept : _loop(&loop) {}
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return _loop->on_thread();
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            _loop->post_function([handle] {
+                handle.resume();
+            });
+        }
+
+        constexpr void await_resume() const noexcept {}
+
+    private:
+        loop *_loop;
+    };
+
+    /** Create an awaiter which resumes the co-routine on the thread of the loop.
+     *
+     * When the co-routine is already running on the loop's thread it continues without suspending.
+     * This is used to return to the main thread after doing work on a `thread_pool`:
+     * `co_await loop::main().schedule()`.
+     */
+    [[nodiscard]] schedule_awaiter schedule() noexcept
+    {
+        return schedule_awaiter{*this};
+    }
+
     /** Call a function from the loop.
      *
      * @note It is safe to call this function from another thread.
@@ -245,7 +329,28 @@ public:
     {
     }
 
+    /** Request the render functions to be called on the next frame.
+     *
+     * The render functions are only called on frames for which a render was
+     * requested. When nothing requests a render, because no window has anything
+     * to redraw and nothing is animating, the vsync thread is suspended so that
+     * an idle application does not use CPU or GPU time. Input and timers that
+     * change what a window shows will request a render again.
+     *
+     * @note It is safe to call this function from another thread.
+     */
+    void request_render() noexcept
+    {
+        if (not _render_requested.exchange(true, std::memory_order::acq_rel)) {
+            ++global_counter<"loop:render:resume">;
+            _render_requested.notify_all();
+        }
+    }
+
     /** Subscribe a render function to be called on vsync.
+     *
+     * A render function should call `request_render()` when it needs to be
+     * called again, for example while animating.
      *
      * @param f A function to be called when vsync occurs.
      */
@@ -257,6 +362,7 @@ public:
         auto cb = callback<void(utc_nanoseconds)>{std::forward<Func>(func)};
 
         _render_functions.push_back(cb);
+        request_render();
 
         // Startup the vsync thread once there is a window.
         if (not _vsync_thread.joinable()) {
@@ -488,6 +594,10 @@ private:
     inline static std::jthread _timer_thread;
 
     function_fifo<> _function_fifo;
+
+    /** The async-event has been signalled, and the functions have not been handled since.
+     */
+    std::atomic<bool> _function_signalled = false;
     function_timer _function_timer;
 
     std::optional<int> _exit_code = {};
@@ -496,6 +606,12 @@ private:
     thread_id _thread_id;
     std::vector<weak_callback<void(utc_nanoseconds)>> _render_functions;
 
+    /** A render was requested since the render functions were last called.
+     *
+     * The vsync thread waits on this flag while it is false.
+     */
+    std::atomic<bool> _render_requested = true;
+
 struct socket_type {
         int fd;
         socket_event mode;
@@ -523,6 +639,27 @@ struct socket_type {
      */
     bool _vsync_time_from_sleep = true;
 
+    /** Render just in time before the next vertical blank.
+     */
+    std::atomic<bool> _low_latency = false;
+
+    /** The measured duration between vertical blanks.
+     */
+    std::atomic<std::chrono::nanoseconds> _vblank_period = std::chrono::nanoseconds(16'666'667);
+
+    /** The measured duration of calling the render functions.
+     *
+     * After a slow frame the duration decays slowly, so that the next frames
+     * are started earlier instead of missing their vertical blanks.
+     */
+    std::atomic<std::chrono::nanoseconds> _render_duration = std::chrono::nanoseconds(0);
+
+    /** The time between the render functions finishing and the vertical blank in low-latency mode.
+     *
+     * Covers the GPU rendering and the jitter of waking up the main loop.
+     */
+    constexpr static std::chrono::nanoseconds _low_latency_margin = std::chrono::milliseconds(3);
+
     /** pull down ratio for triggering SetEvent from WaitForVBlank.
      *
      * Format is in UQ8.8, this is done to reduce judder introduced by float precision.
@@ -620,6 +757,12 @@ struct socket_type {
      */
     void notify_has_send() noexcept
     {
+        // Only the first notification since the functions were last handled signals
+        // the event; a burst of posts will wake up the loop once.
+        if (_function_signalled.exchange(true, std::memory_order::acq_rel)) {
+            return;
+        }
+
         if (not SetEvent(_handles[_function_handle_idx])) {
             hi_log_error("Could not trigger async-event. {}", get_last_error_message());
         }
@@ -640,14 +783,28 @@ struct socket_type {
             _vsync_time.store(std::chrono::utc_clock::now());
         }
 
-        auto const display_time = _vsync_time.load(std::memory_order::relaxed) + std::chrono::milliseconds(30);
+        // In low-latency mode the frame is displayed on the next vertical blank.
+        auto const display_delay = _low_latency.load(std::memory_order::relaxed) ?
+            _vblank_period.load(std::memory_order::relaxed) :
+            std::chrono::nanoseconds{std::chrono::milliseconds(30)};
+        auto const display_time = _vsync_time.load(std::memory_order::relaxed) + display_delay;
+
+        // The render functions will request a render again if they need another frame.
+        _render_requested.store(false, std::memory_order::release);
 
+        auto const render_start = std::chrono::utc_clock::now();
         for (auto& render_function : _render_functions) {
             if (auto rf = render_function.lock()) {
                 rf(display_time);
             }
         }
 
+        auto const render_duration = std::chrono::utc_clock::now() - render_start;
+        auto const previous_render_duration = _render_duration.load(std::memory_order::relaxed);
+        _render_duration.store(
+            std::max(std::chrono::nanoseconds{render_duration}, previous_render_duration - previous_render_duration / 16),
+            std::memory_order::relaxed);
+
         std::erase_if(_render_functions, [](auto& render_function) {
             return render_function.expired();
         });
@@ -655,17 +812,29 @@ struct socket_type {
         if (_render_functions.empty()) {
             // Stop the vsync thread when there are no more windows.
             if (_vsync_thread.joinable()) {
-                _vsync_thread.request_stop();
+                stop_vsync_thread();
             }
         }
     }
 
+    /** Request the vsync thread to stop, also when it is suspended.
+     */
+    void stop_vsync_thread() noexcept
+    {
+        _vsync_thread.request_stop();
+        _render_requested.store(true, std::memory_order::release);
+        _render_requested.notify_all();
+    }
+
     /** Handle all function calls.
      *
      * @param deadline The deadline before all calls must be executed before moving on.
      */
     void handle_functions() noexcept
     {
+        // Clear the flag before draining the fifo, so that a function posted
+        // while draining will signal the event again.
+        _function_signalled.exchange(false, std::memory_order::acq_rel);
         _function_fifo.run_all();
     }
 
@@ -785,7 +954,7 @@ struct socket_type {
             hi_log_error_once("vsync:error:WaitForVBlank", "WaitForVBlank() failed. {}", get_last_error_message());
         }
 
-        if (vsync_thread_update_time(false) < 1ms) {
+        if (auto const duration = vsync_thread_update_time(false); duration < 1ms) {
             hi_log_info_once("vsync:monitor-off", "WaitForVBlank() did not block; is the monitor turned off?");
             Sleep(16);
 
@@ -793,9 +962,40 @@ struct socket_type {
             vsync_thread_update_time(true);
         } else {
             ++global_counter<"vsync:vertical-blank">;
+
+            // Moving average of the period, a duration after sleeping is not a vertical blank period.
+            if (duration < 100ms) {
+                auto const period = _vblank_period.load(std::memory_order::relaxed);
+                _vblank_period.store(period + (duration - period) / 8, std::memory_order::relaxed);
+            }
         }
     }
 
+    /** Wait until the render functions should start to finish just before the next vertical blank.
+     *
+     * This is only done in low-latency mode, directly after the vertical blank.
+     */
+    void vsync_thread_wait_for_render_deadline() noexcept
+    {
+        using namespace std::chrono_literals;
+
+        if (not _low_latency.load(std::memory_order::relaxed)) {
+            return;
+        }
+
+        auto const next_vblank = _vsync_time.load(std::memory_order::relaxed) + _vblank_period.load(std::memory_order::relaxed);
+        auto const deadline = next_vblank - _render_duration.load(std::memory_order::relaxed) - _low_latency_margin;
+        auto const delay = deadline - std::chrono::utc_clock::now();
+        if (delay < 1ms) {
+            // Rendering takes most of the frame, start immediately.
+            ++global_counter<"vsync:low-latency:no-slack">;
+            return;
+        }
+
+        ++global_counter<"vsync:low-latency:delay">;
+        std::this_thread::sleep_for(delay);
+    }
+
     /** The pull-down algorithm
      *
      * Handles pull-down from the frame rate of the primary monitor to the maximum frame-rate of all windows.
@@ -829,6 +1029,13 @@ struct socket_type {
         set_thread_name("vsync");
 
         while (not stop_token.stop_requested()) {
+            if (not _render_requested.load(std::memory_order::acquire)) {
+                // Nothing to render, suspend until a render is requested.
+                ++global_counter<"vsync:idle">;
+                _render_requested.wait(false, std::memory_order::acquire);
+                continue;
+            }
+
             switch (WaitForSingleObject(_use_vsync_handle, 30)) {
             case WAIT_TIMEOUT:
                 // When use_vsync is off wake the main loop every 30ms.
@@ -848,6 +1055,7 @@ struct socket_type {
                 vsync_thread_wait_for_vblank();
 
                 if (vsync_thread_pull_down()) {
+                    vsync_thread_wait_for_render_deadline();
                     ++global_counter<"vsync:frame">;
                     SetEvent(_handles[_vsync_handle_idx]);
                 }
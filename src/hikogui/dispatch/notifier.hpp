@@ -12,6 +12,10 @@
 #include <functional>
 #include <coroutine>
 #include <mutex>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include <iterator>
 
 hi_export_module(hikogui.dispatch : notifier);
 
@@ -148,8 +152,11 @@ public:
     [[nodiscard]] callback_type subscribe(Func&& func, callback_flags flags = callback_flags::synchronous) noexcept
     {
         auto callback = callback_type{std::forward<Func>(func)};
+
         auto const lock = std::scoped_lock(_mutex);
-        _callbacks.emplace_back(callback, flags);
+        auto callbacks = copy_callbacks();
+        callbacks->emplace_back(callback, flags, is_once(flags) ? std::make_shared<std::atomic<bool>>(false) : nullptr);
+        _callbacks.store(std::move(callbacks), std::memory_order::release);
         return callback;
     }
 
@@ -162,15 +169,30 @@ public:
 
     /** Call the subscribed callbacks with the given arguments.
      *
-     * @note This function is not reentrant.
+     * The callbacks are called from a snapshot of the list of callbacks, without
+     * holding a lock. A callback may subscribe to, or unsubscribe from, this notifier.
+     *
      * @param args The arguments to pass with the invocation of the callback
      */
     void operator()(Args... args) const noexcept
     {
-        auto const lock = std::scoped_lock(_mutex);
+        auto const callbacks = _callbacks.load(std::memory_order::acquire);
+        if (not callbacks) {
+            return;
+        }
+
+        auto needs_clean_up = false;
+        for (auto const& [callback, flags, triggered] : *callbacks) {
+            if (triggered and triggered->exchange(true, std::memory_order::relaxed)) {
+                // A callback that should only be triggered once, like inside an awaitable,
+                // was already triggered by an earlier or concurrent notification.
+                continue;
+            }
+
+            if (callback.expired()) {
+                needs_clean_up = true;
 
-        for (auto& [callback, flags] : _callbacks) {
-            if (is_synchronous(flags)) {
+            } else if (is_synchronous(flags)) {
                 if (auto cb = callback.lock()) {
                     cb(std::forward<Args>(args)...);
                 }
@@ -212,32 +234,65 @@ public:
                 hi_no_default();
             }
 
-            // If the callback should only be triggered once, like inside an awaitable.
-            // Then reset the weak_ptr in _callbacks so that it will be cleaned up.
+            // The callback that should only be triggered once is removed from the list.
             // In the lambda above the weak_ptr is copied first so that it callback will get executed
             // as long as the shared_ptr's use count does not go to zero.
-            if (is_once(flags)) {
-                callback.reset();
-            }
+            needs_clean_up |= static_cast<bool>(triggered);
+        }
+
+        if (needs_clean_up) {
+            clean_up();
         }
-        clean_up();
     }
 
 private:
+    struct callback_entry {
+        weak_callback_type callback;
+        callback_flags flags;
+
+        /** Set when a callback with the `callback_flags::once` flag is triggered.
+         *
+         * The flag is shared between the snapshots of the list of callbacks.
+         */
+        std::shared_ptr<std::atomic<bool>> triggered;
+    };
+
+    using callbacks_type = std::vector<callback_entry>;
+
+    /** Mutex held when the list of callbacks is modified.
+     */
     mutable unfair_mutex _mutex;
 
-    /** A list of callbacks and it's associated token.
+    /** A snapshot of the list of callbacks.
+     *
+     * The list is never modified after it is stored. A subscribe, or a clean-up,
+     * replaces the list with a modified copy, so that notification does not need a lock.
      */
-    mutable std::vector<std::pair<weak_callback_type, callback_flags>> _callbacks;
+    mutable std::atomic<std::shared_ptr<callbacks_type const>> _callbacks;
 
-    void clean_up() const noexcept
+    /** Copy the current list of callbacks, without the callbacks that are no longer needed.
+     */
+    [[nodiscard]] std::shared_ptr<callbacks_type> copy_callbacks() const noexcept
     {
         hi_axiom(_mutex.is_locked());
 
+        auto r = std::make_shared<callbacks_type>();
+        if (auto const old_callbacks = _callbacks.load(std::memory_order::relaxed)) {
+            r->reserve(old_callbacks->size() + 1);
+            std::copy_if(old_callbacks->begin(), old_callbacks->end(), std::back_inserter(*r), [](auto const& item) {
+                return not item.callback.expired() and not (item.triggered and item.triggered->load(std::memory_order::relaxed));
+            });
+        }
+        return r;
+    }
+
+    void clean_up() const noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+
         // Cleanup all callbacks that have expired, or when they may only be triggered once.
-        std::erase_if(_callbacks, [](auto const& item) {
-            return item.first.expired();
-        });
+        auto callbacks = copy_callbacks();
+        _callbacks.store(std::move(callbacks), std::memory_order::release);
     }
 
 #ifndef NDEBUG
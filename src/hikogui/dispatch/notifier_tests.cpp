@@ -9,6 +9,9 @@
 #endif
 #include <hikotest/hikotest.hpp>
 #include <coroutine>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 TEST_SUITE(notifier) {
 
@@ -112,4 +115,61 @@ TEST_CASE(local_coroutine)
     REQUIRE(cr.done());
 }
 
+TEST_CASE(subscribe_in_callback)
+{
+    auto a = 0;
+    auto b = 0;
+
+    auto n = hi::notifier{};
+    auto b_cbt = hi::notifier<>::callback_type{};
+
+    // The callback list is not locked during notification, so a callback may subscribe.
+    auto a_cbt = n.subscribe([&] {
+        ++a;
+        if (not b_cbt) {
+            b_cbt = n.subscribe([&] {
+                ++b;
+            });
+        }
+    });
+
+    n();
+    REQUIRE(a == 1);
+    REQUIRE(b == 0);
+
+    n();
+    REQUIRE(a == 2);
+    REQUIRE(b == 1);
+}
+
+TEST_CASE(once_concurrent)
+{
+    auto a = std::atomic<int>{0};
+    auto b = std::atomic<int>{0};
+
+    auto n = hi::notifier{};
+    auto a_cbt = n.subscribe(
+        [&] {
+            ++a;
+        },
+        hi::callback_flags::synchronous | hi::callback_flags::once);
+    auto b_cbt = n.subscribe([&] {
+        ++b;
+    });
+
+    {
+        auto threads = std::vector<std::jthread>{};
+        for (auto i = 0; i != 4; ++i) {
+            threads.emplace_back([&] {
+                for (auto j = 0; j != 100; ++j) {
+                    n();
+                }
+            });
+        }
+    }
+
+    REQUIRE(a.load() == 1);
+    REQUIRE(b.load() == 400);
+}
+
 };
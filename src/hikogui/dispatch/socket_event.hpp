@@ -7,4 +7,6 @@ hi_export_module(hikogui.dispatch.socket_event);
 #include "socket_event_intf.hpp" // export
 #if HI_OPERATING_SYSTEM == HI_OS_WINDOWS
 #include "socket_event_win32_impl.hpp" // export
+#elif HI_OPERATING_SYSTEM == HI_OS_LINUX
+#include "socket_event_linux_impl.hpp" // export
 #endif
@@ -0,0 +1,98 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "socket_event_intf.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <sys/epoll.h>
+#include <cerrno>
+#include <cstdint>
+
+hi_export_module(hikogui.dispatch.socket_event : impl);
+
+hi_export namespace hi::inline v1 {
+
+/** Convert the socket events to wait for into an epoll event mask.
+ *
+ * epoll reports readiness, not the winsock events; `accept` is a read on a
+ * listening socket and `connect` is a write on a connecting socket.
+ */
+[[nodiscard]] constexpr uint32_t socket_event_to_epoll(socket_event rhs) noexcept
+{
+    auto r = uint32_t{0};
+
+    r |= to_bool(rhs & (socket_event::read | socket_event::accept)) ? uint32_t{EPOLLIN} : uint32_t{0};
+    r |= to_bool(rhs & (socket_event::write | socket_event::connect)) ? uint32_t{EPOLLOUT} : uint32_t{0};
+    r |= to_bool(rhs & socket_event::close) ? uint32_t{EPOLLRDHUP} : uint32_t{0};
+    r |= to_bool(rhs & socket_event::out_of_band) ? uint32_t{EPOLLPRI} : uint32_t{0};
+
+    return r;
+}
+
+/** Convert the events returned by epoll into socket events.
+ *
+ * @param rhs The events returned by `epoll_wait()`.
+ * @param mask The socket events that the socket was registered with.
+ * @return The socket events that happened, limited to the @a mask.
+ */
+[[nodiscard]] constexpr socket_event socket_event_from_epoll(uint32_t rhs, socket_event mask) noexcept
+{
+    if (rhs & EPOLLERR) {
+        // Wake up whoever is waiting on the socket, so that it sees the error.
+        rhs |= EPOLLIN | EPOLLOUT;
+    }
+
+    auto r = socket_event::none;
+
+    r |= (rhs & EPOLLIN) ? socket_event::read | socket_event::accept : socket_event::none;
+    r |= (rhs & EPOLLOUT) ? socket_event::write | socket_event::connect : socket_event::none;
+    r |= (rhs & (EPOLLRDHUP | EPOLLHUP)) ? socket_event::close : socket_event::none;
+    r |= (rhs & EPOLLPRI) ? socket_event::out_of_band : socket_event::none;
+
+    return r & mask;
+}
+
+[[nodiscard]] constexpr socket_error socket_error_from_errno(int rhs) noexcept
+{
+    switch (rhs) {
+    case 0: return socket_error::success;
+    case EAFNOSUPPORT: return socket_error::af_not_supported;
+    case ECONNREFUSED: return socket_error::connection_refused;
+    case ENETUNREACH: return socket_error::network_unreachable;
+    case EHOSTUNREACH: return socket_error::network_unreachable;
+    case ENOBUFS: return socket_error::no_buffers;
+    case ETIMEDOUT: return socket_error::timeout;
+    case ENETDOWN: return socket_error::network_down;
+    case ECONNRESET: return socket_error::connection_reset;
+    case EPIPE: return socket_error::connection_reset;
+    // Unlike winsock, SO_ERROR may return any errno; treat the rest as aborted.
+    default: return socket_error::connection_aborted;
+    }
+}
+
+/** Convert the events returned by epoll into socket events.
+ *
+ * @param rhs The events returned by `epoll_wait()`.
+ * @param mask The socket events that the socket was registered with.
+ * @param error The pending error of the socket, retrieved with `SO_ERROR`.
+ * @return The socket events, each with the pending error.
+ */
+[[nodiscard]] constexpr socket_events socket_events_from_epoll(uint32_t rhs, socket_event mask, int error) noexcept
+{
+    auto r = socket_events{};
+    r.events = socket_event_from_epoll(rhs, mask);
+
+    auto const error_ = socket_error_from_errno(error);
+    for (auto i = 0_uz; i != socket_event_max; ++i) {
+        if (to_bool(r.events & static_cast<socket_event>(1 << i))) {
+            r.errors[i] = error_;
+        }
+    }
+
+    return r;
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,255 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file dispatch/startup_graph.hpp Initialize independent subsystems concurrently.
+ */
+
+#pragma once
+
+#include "thread_pool.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../time/time.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <functional>
+#include <initializer_list>
+#include <string_view>
+#include <exception>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.dispatch.startup_graph);
+
+hi_export namespace hi::inline v1 {
+
+/** A graph of initialization steps, run concurrently on a thread pool.
+ *
+ * Subsystems are normally started lazily, serially, on the first thread that
+ * needs them. At application startup the time-to-first-frame can be reduced by
+ * warming up independent subsystems concurrently, like scanning the font
+ * directories, creating the Vulkan instance and loading translations.
+ *
+ * A step is started as soon as all of its dependencies have finished. Each step
+ * is traced under its tag, so that the startup timeline shows up in the
+ * `trace_recorder_global` and the durations in the `global_counter<Tag>`.
+ *
+ * ```
+ * auto graph = hi::startup_graph{};
+ * auto const fonts = graph.add<"startup:fonts">([] { register_font_directories(font_dirs()); });
+ * graph.add<"startup:themes">([] { register_theme_directories(theme_dirs()); }, {fonts});
+ * graph.add<"startup:gfx_system">([] { std::ignore = gfx_system::global(); });
+ * graph.start();
+ * graph.wait();
+ * ```
+ */
+class startup_graph {
+public:
+    /** The start and duration of a step, relative to the start of the graph.
+     */
+    struct timeline_entry {
+        std::string_view name;
+        std::chrono::nanoseconds start = {};
+        std::chrono::nanoseconds duration = {};
+        bool skipped = false;
+    };
+
+    /** Wait for all the steps to finish.
+     */
+    ~startup_graph()
+    {
+        if (_started) {
+            wait_for_steps();
+        }
+    }
+
+    startup_graph(startup_graph const&) = delete;
+    startup_graph(startup_graph&&) = delete;
+    startup_graph& operator=(startup_graph const&) = delete;
+    startup_graph& operator=(startup_graph&&) = delete;
+    startup_graph() noexcept = default;
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _steps.size();
+    }
+
+    /** Add a step to the graph.
+     *
+     * @tparam Tag The name of the step in the trace.
+     * @param func The function `void()` that initializes the subsystem.
+     * @param dependencies The steps that must have finished before this step is started.
+     * @return The identifier of the step, to be used as a dependency of later steps.
+     */
+    template<fixed_string Tag, forward_of<void()> Func>
+    std::size_t add(Func&& func, std::initializer_list<std::size_t> dependencies = {})
+    {
+        hi_assert(not _started);
+
+        auto const id = _steps.size();
+        auto& step = *_steps.emplace_back(std::make_unique<step_type>());
+        step.name = trace<Tag>::tag_name;
+        step.func = [f = std::forward<Func>(func)]() mutable {
+            auto const t = trace<Tag>();
+            f();
+        };
+
+        for (auto const dependency : dependencies) {
+            // Dependencies can only be made on earlier steps, so that the graph can not have cycles.
+            hi_assert(dependency < id);
+            _steps[dependency]->dependents.push_back(id);
+        }
+        step.num_waiting.store(dependencies.size(), std::memory_order::relaxed);
+        return id;
+    }
+
+    /** Start the steps without dependencies on the pool.
+     *
+     * @param pool The thread pool to run the steps on.
+     */
+    void start(thread_pool& pool = thread_pool::global()) noexcept
+    {
+        hi_assert(not _started);
+        _started = true;
+        _pool = std::addressof(pool);
+        _start = time_stamp_count{time_stamp_count::inplace{}};
+
+        // Find all the roots before posting, a step that finishes early will post its own dependents.
+        auto roots = std::vector<std::size_t>{};
+        for (auto id = 0_uz; id != _steps.size(); ++id) {
+            if (_steps[id]->num_waiting.load(std::memory_order::relaxed) == 0) {
+                roots.push_back(id);
+            }
+        }
+        for (auto const id : roots) {
+            post(id);
+        }
+    }
+
+    /** Wait until all the steps have finished.
+     *
+     * Steps of which a dependency failed are skipped.
+     *
+     * @note Must not be called from a thread of the pool.
+     * @throws The exception of the first step that failed.
+     */
+    void wait()
+    {
+        hi_assert(_started);
+        wait_for_steps();
+
+        // All the steps have finished, so the error is no longer modified.
+        if (auto error = std::exchange(_error, nullptr)) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /** Get the timeline of the steps.
+     *
+     * @pre `wait()` has returned.
+     * @return The start and duration of each step, in the order they were added.
+     */
+    [[nodiscard]] std::vector<timeline_entry> timeline() const noexcept
+    {
+        auto r = std::vector<timeline_entry>{};
+        r.reserve(_steps.size());
+        for (auto const& step : _steps) {
+            auto const begin = step->begin > _start.count() ? step->begin - _start.count() : 0;
+            r.push_back(
+                {step->name,
+                 time_stamp_count::duration_from_count(begin),
+                 time_stamp_count::duration_from_count(step->end - step->begin),
+                 step->skipped});
+        }
+        return r;
+    }
+
+private:
+    struct step_type {
+        std::string_view name;
+        std::function<void()> func;
+        std::vector<std::size_t> dependents;
+        std::atomic<std::size_t> num_waiting = 0;
+        std::atomic<bool> skip = false;
+
+        // Written by the thread that runs the step, read after wait().
+        bool skipped = false;
+        uint64_t begin = 0;
+        uint64_t end = 0;
+    };
+
+    std::vector<std::unique_ptr<step_type>> _steps;
+    thread_pool *_pool = nullptr;
+    time_stamp_count _start = {};
+    bool _started = false;
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::size_t _num_done = 0;
+    std::exception_ptr _error;
+
+    void post(std::size_t id) noexcept
+    {
+        hi_axiom_not_null(_pool);
+        _pool->post_function([this, id] {
+            run(id);
+        });
+    }
+
+    void run(std::size_t id) noexcept
+    {
+        auto& step = *_steps[id];
+
+        step.begin = time_stamp_count{time_stamp_count::inplace{}}.count();
+        auto failed = step.skip.load(std::memory_order::acquire);
+        if (failed) {
+            step.skipped = true;
+        } else {
+            try {
+                step.func();
+            } catch (...) {
+                failed = true;
+                auto const lock = std::scoped_lock(_mutex);
+                if (not _error) {
+                    _error = std::current_exception();
+                }
+            }
+        }
+        step.end = time_stamp_count{time_stamp_count::inplace{}}.count();
+
+        for (auto const dependent_id : step.dependents) {
+            auto& dependent = *_steps[dependent_id];
+            if (failed) {
+                dependent.skip.store(true, std::memory_order::release);
+            }
+            if (dependent.num_waiting.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+                post(dependent_id);
+            }
+        }
+
+        // Notify while holding the lock, so that the graph is not destroyed by wait() before the notify.
+        auto const lock = std::scoped_lock(_mutex);
+        if (++_num_done == _steps.size()) {
+            _condition.notify_all();
+        }
+    }
+
+    void wait_for_steps() noexcept
+    {
+        hi_assert(not _pool->on_thread());
+
+        auto lock = std::unique_lock(_mutex);
+        _condition.wait(lock, [this] {
+            return _num_done == _steps.size();
+        });
+    }
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,99 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "startup_graph.hpp"
+#include <hikotest/hikotest.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+
+TEST_SUITE(startup_graph) {
+
+TEST_CASE(dependencies_run_first)
+{
+    auto pool = hi::thread_pool{4};
+    auto graph = hi::startup_graph{};
+
+    auto order = std::atomic<int>{0};
+    auto a_order = std::atomic<int>{-1};
+    auto b_order = std::atomic<int>{-1};
+    auto c_order = std::atomic<int>{-1};
+
+    auto const a = graph.add<"test:a">([&] {
+        a_order = order.fetch_add(1);
+    });
+    auto const b = graph.add<"test:b">([&] {
+        b_order = order.fetch_add(1);
+    });
+    graph.add<"test:c">(
+        [&] {
+            c_order = order.fetch_add(1);
+        },
+        {a, b});
+
+    graph.start(pool);
+    graph.wait();
+
+    REQUIRE(order.load() == 3);
+    REQUIRE(c_order.load() == 2);
+    REQUIRE(a_order.load() != b_order.load());
+
+    auto const timeline = graph.timeline();
+    REQUIRE(timeline.size() == 3);
+    REQUIRE(timeline[2].name == "test:c");
+    REQUIRE(not timeline[2].skipped);
+}
+
+TEST_CASE(independent_steps_run_concurrently)
+{
+    using namespace std::literals;
+
+    auto pool = hi::thread_pool{2};
+    auto graph = hi::startup_graph{};
+
+    // Both steps wait until the other one has started; this only finishes when they run concurrently.
+    auto num_started = std::atomic<int>{0};
+    auto const step = [&] {
+        num_started.fetch_add(1);
+        auto const deadline = std::chrono::steady_clock::now() + 10s;
+        while (num_started.load() != 2 and std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    };
+    graph.add<"test:x">(step);
+    graph.add<"test:y">(step);
+
+    graph.start(pool);
+    graph.wait();
+    REQUIRE(num_started.load() == 2);
+}
+
+TEST_CASE(failure_skips_dependents)
+{
+    auto pool = hi::thread_pool{2};
+    auto graph = hi::startup_graph{};
+
+    auto dependent_ran = false;
+    auto independent_ran = std::atomic<bool>{false};
+    auto const a = graph.add<"test:fail">([] {
+        throw std::runtime_error("failed");
+    });
+    graph.add<"test:dependent">(
+        [&] {
+            dependent_ran = true;
+        },
+        {a});
+    graph.add<"test:independent">([&] {
+        independent_ran = true;
+    });
+
+    graph.start(pool);
+    REQUIRE_THROWS(graph.wait(), std::runtime_error);
+    REQUIRE(not dependent_ran);
+    REQUIRE(independent_ran.load());
+    REQUIRE(graph.timeline()[1].skipped);
+}
+
+};
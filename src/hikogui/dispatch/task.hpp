@@ -34,7 +34,7 @@ public:
     using notifier_type = notifier<void(value_type)>;
     using callback_type = notifier_type::callback_type;
 
-    struct promise_type {
+    struct promise_type : coroutine_frame_pool_allocated {
         notifier_type notifier;
         std::optional<value_type> value = {};
         std::exception_ptr exception = nullptr;
@@ -200,7 +200,7 @@ public:
     using notifier_type = notifier<void()>;
     using callback_type = notifier_type::callback_type;
 
-    struct promise_type {
+    struct promise_type : coroutine_frame_pool_allocated {
         notifier_type notifier;
         std::exception_ptr exception = nullptr;
 
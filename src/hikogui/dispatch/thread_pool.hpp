@@ -0,0 +1,413 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "awaitable.hpp"
+#include "../container/work_stealing_deque.hpp"
+#include "../concurrency/unfair_mutex.hpp" // XXX #616
+#include "../concurrency/thread.hpp" // XXX #616
+#include "../telemetry/telemetry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <coroutine>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <format>
+#include <exception>
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.dispatch.thread_pool);
+
+hi_export namespace hi::inline v1 {
+namespace detail {
+
+/** A co-routine which is not tracked by anyone, its frame is destroyed when it completes.
+ */
+struct thread_pool_detached_task {
+    struct promise_type : coroutine_frame_pool_allocated {
+        thread_pool_detached_task get_return_object() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+} // namespace detail
+
+/** A pool of threads that resume co-routines.
+ *
+ * Each worker thread has a `work_stealing_deque` of co-routines. A co-routine
+ * that is scheduled from a worker is pushed on the deque of that worker, so that
+ * it is likely to be resumed on the same CPU with a warm cache. Idle workers
+ * steal from the other workers. Co-routines that are scheduled from other threads
+ * are placed on a shared queue.
+ *
+ * A co-routine moves itself onto the pool with `co_await pool.schedule()`, and
+ * may move back to the GUI thread with `co_await loop::main().schedule()`:
+ *
+ * ```
+ * hi::task<image> load_image(std::filesystem::path path)
+ * {
+ *     co_await hi::thread_pool::global().schedule();
+ *     auto r = decode_png(path);
+ *     co_await hi::loop::main().schedule();
+ *     co_return r;
+ * }
+ * ```
+ *
+ * The pool is meant for heavy work like decoding images, loading fonts and
+ * shaping text, that would otherwise block the main loop. Work that blocks on
+ * I/O for a long time should not be run on the pool.
+ */
+class thread_pool {
+public:
+    /** An awaiter that resumes the co-routine on a thread of the pool.
+     */
+    class schedule_awaiter {
+    public:
+        constexpr schedule_awaiter(thread_pool& pool) noexcept : _pool(&pool) {}
+
+        [[nodiscard]] constexpr bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            _pool->post(handle);
+        }
+
+        constexpr void await_resume() const noexcept {}
+
+    private:
+        thread_pool *_pool;
+    };
+
+    thread_pool(thread_pool const&) = delete;
+    thread_pool(thread_pool&&) = delete;
+    thread_pool& operator=(thread_pool const&) = delete;
+    thread_pool& operator=(thread_pool&&) = delete;
+
+    /** Create a pool of threads.
+     *
+     * @param num_threads The number of threads, or zero for one less than the number of CPUs,
+     *                    leaving a CPU for the main thread.
+     * @param pin_threads Give each thread an affinity to its own CPU.
+     * @param core_class The class of CPU cores the threads run on.
+     */
+    explicit thread_pool(std::size_t num_threads = 0, bool pin_threads = false, cpu_core_class core_class = cpu_core_class::any)
+    {
+        if (num_threads == 0) {
+            num_threads = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+        }
+
+        _workers.reserve(num_threads);
+        for (auto i = 0_uz; i != num_threads; ++i) {
+            _workers.push_back(std::make_unique<worker_type>());
+        }
+
+        for (auto i = 0_uz; i != num_threads; ++i) {
+            _workers[i]->thread = std::jthread{[this, i, pin_threads, core_class] {
+                run(i, pin_threads, core_class);
+            }};
+        }
+    }
+
+    /** Stop the pool.
+     *
+     * The co-routines that were already scheduled are resumed before the threads are joined.
+     */
+    ~thread_pool()
+    {
+        _stop.store(true);
+        _epoch.fetch_add(1);
+        _epoch.notify_all();
+
+        for (auto& worker : _workers) {
+            worker->thread.join();
+        }
+    }
+
+    /** The global thread pool.
+     */
+    [[nodiscard]] static thread_pool& global() noexcept
+    {
+        static auto r = thread_pool{};
+        return r;
+    }
+
+    /** The thread pool for background work.
+     *
+     * The threads prefer the power efficient cores of a hybrid CPU, for work
+     * whose result is not needed immediately, like decoding or saving files.
+     */
+    [[nodiscard]] static thread_pool& background() noexcept
+    {
+        static auto r = thread_pool{0, false, cpu_core_class::efficiency};
+        return r;
+    }
+
+    [[nodiscard]] std::size_t num_threads() const noexcept
+    {
+        return _workers.size();
+    }
+
+    /** Check if the current thread is one of the threads of this pool.
+     */
+    [[nodiscard]] bool on_thread() const noexcept
+    {
+        return _current_pool == this;
+    }
+
+    /** Create an awaiter which resumes the co-routine on the pool.
+     */
+    [[nodiscard]] schedule_awaiter schedule() noexcept
+    {
+        return schedule_awaiter{*this};
+    }
+
+    /** Resume a co-routine on the pool.
+     *
+     * @note It is safe to call this function from any thread.
+     * @param handle The co-routine to resume.
+     */
+    void post(std::coroutine_handle<> handle) noexcept
+    {
+        hi_axiom(not _stop.load(std::memory_order::relaxed) or on_thread());
+
+        if (on_thread()) {
+            _workers[_current_index]->deque.push(handle);
+
+        } else {
+            auto const lock = std::scoped_lock(_mutex);
+            _injected.push_back(handle);
+            _num_injected.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        _epoch.fetch_add(1);
+        if (_num_sleeping.load() != 0) {
+            _epoch.notify_one();
+        }
+    }
+
+    /** Call a function on the pool.
+     *
+     * @note It is safe to call this function from any thread.
+     * @param func The function to call. The function must not take any arguments and return void.
+     */
+    template<forward_of<void()> Func>
+    void post_function(Func&& func) noexcept
+    {
+        [](thread_pool& pool, std::decay_t<Func> f) -> detail::thread_pool_detached_task {
+            co_await pool.schedule();
+            f();
+        }(*this, std::forward<Func>(func));
+    }
+
+    /** Call a function for each index, in parallel.
+     *
+     * The calls for the indices `1` to `n - 1` are posted to the pool, the current
+     * thread makes the call for index `0` and then waits until all calls have completed.
+     * When called from a thread of this pool all calls are made on the current thread,
+     * so that the pool does not wait on itself.
+     *
+     * All calls are made, even when some of them throw. After all calls have completed
+     * the exception of the call with the lowest index is rethrown.
+     *
+     * @param n The number of calls.
+     * @param func The function to call as `func(i)`. It may be called concurrently.
+     * @throw The exception thrown by @a func.
+     */
+    template<std::invocable<std::size_t> Func>
+    void parallel_for(std::size_t n, Func const& func)
+    {
+        if (n <= 1 or on_thread()) {
+            auto exception = std::exception_ptr{};
+            for (auto i = 0_uz; i != n; ++i) {
+                try {
+                    func(i);
+                } catch (...) {
+                    if (not exception) {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            return;
+        }
+
+        struct state_type {
+            std::atomic<std::size_t> num_pending;
+            std::vector<std::exception_ptr> exceptions;
+
+            explicit state_type(std::size_t n) : num_pending(n - 1), exceptions(n) {}
+        };
+
+        auto const call = [&func](state_type& state, std::size_t i) noexcept {
+            try {
+                func(i);
+            } catch (...) {
+                state.exceptions[i] = std::current_exception();
+            }
+        };
+
+        // The calls share ownership, so that the counter outlives the notify below.
+        auto const state = std::make_shared<state_type>(n);
+        for (auto i = 1_uz; i != n; ++i) {
+            post_function([state, &call, i] {
+                call(*state, i);
+                if (state->num_pending.fetch_sub(1) == 1) {
+                    state->num_pending.notify_all();
+                }
+            });
+        }
+
+        call(*state, 0);
+
+        for (auto num_pending = state->num_pending.load(); num_pending != 0; num_pending = state->num_pending.load()) {
+            state->num_pending.wait(num_pending);
+        }
+
+        for (auto const& exception : state->exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+
+private:
+    struct worker_type {
+        work_stealing_deque<std::coroutine_handle<>> deque;
+        std::jthread thread;
+    };
+
+    std::vector<std::unique_ptr<worker_type>> _workers;
+
+    /** Co-routines scheduled from threads outside of the pool.
+     */
+    unfair_mutex _mutex;
+    std::deque<std::coroutine_handle<>> _injected;
+    std::atomic<std::size_t> _num_injected = 0;
+
+    /** Incremented each time a co-routine is scheduled; idle threads wait on it.
+     */
+    std::atomic<uint64_t> _epoch = 0;
+    std::atomic<std::size_t> _num_sleeping = 0;
+    std::atomic<bool> _stop = false;
+
+    inline static thread_local thread_pool *_current_pool = nullptr;
+    inline static thread_local std::size_t _current_index = 0;
+
+    [[nodiscard]] std::coroutine_handle<> find_work(std::size_t index) noexcept
+    {
+        if (auto r = _workers[index]->deque.pop()) {
+            return *r;
+        }
+
+        if (_num_injected.load(std::memory_order::relaxed) != 0) {
+            auto const lock = std::scoped_lock(_mutex);
+            if (not _injected.empty()) {
+                auto r = _injected.front();
+                _injected.pop_front();
+                _num_injected.fetch_sub(1, std::memory_order::relaxed);
+                return r;
+            }
+        }
+
+        // Steal from the other workers, starting with the next one so that
+        // the thieves spread out over the workers.
+        for (auto i = 1_uz; i != _workers.size(); ++i) {
+            if (auto r = _workers[(index + i) % _workers.size()]->deque.steal()) {
+                return *r;
+            }
+        }
+
+        return {};
+    }
+
+    void run(std::size_t index, bool pin_thread, cpu_core_class core_class) noexcept
+    {
+        set_thread_name(std::format("pool {}", index));
+
+        try {
+            if (pin_thread) {
+                // The CPUs are ordered by NUMA node, so that consecutive workers share a node.
+                auto const mask = core_class_affinity_mask(core_class);
+                auto cpus = std::vector<std::size_t>{};
+                for (auto i = 0_uz; i != mask.size(); ++i) {
+                    if (mask[i]) {
+                        cpus.push_back(i);
+                    }
+                }
+                auto const& topology = cpu_topology();
+                std::ranges::stable_sort(cpus, [&](auto a, auto b) {
+                    auto const a_node = a < topology.size() ? topology[a].numa_node : 0;
+                    auto const b_node = b < topology.size() ? topology[b].numa_node : 0;
+                    return a_node < b_node;
+                });
+
+                if (not cpus.empty()) {
+                    set_thread_affinity(cpus[index % cpus.size()]);
+                }
+
+            } else if (core_class != cpu_core_class::any) {
+                set_thread_core_class(core_class);
+            }
+        } catch (std::exception const& e) {
+            hi_log_warning("Could not set the CPU affinity of thread pool {}: {}", index, e.what());
+        }
+
+        _current_pool = this;
+        _current_index = index;
+
+        while (true) {
+            auto const epoch = _epoch.load();
+            if (auto handle = find_work(index)) {
+                handle.resume();
+                continue;
+            }
+
+            // All the work is finished, including the work scheduled before the stop.
+            if (_stop.load()) {
+                break;
+            }
+
+            _num_sleeping.fetch_add(1);
+            _epoch.wait(epoch);
+            _num_sleeping.fetch_sub(1);
+        }
+
+        _current_pool = nullptr;
+    }
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,140 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "thread_pool.hpp"
+#include "task.hpp"
+#if HI_OPERATING_SYSTEM == HI_OS_WINDOWS
+#include "loop_win32_intf.hpp"
+#elif HI_OPERATING_SYSTEM == HI_OS_LINUX
+#include "loop_linux_intf.hpp"
+#endif
+#include <hikotest/hikotest.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+TEST_SUITE(thread_pool) {
+
+TEST_CASE(post_function)
+{
+    auto count = std::atomic<int>{0};
+    auto on_pool = std::atomic<int>{0};
+    {
+        auto pool = hi::thread_pool{4};
+        REQUIRE(pool.num_threads() == 4);
+        REQUIRE(not pool.on_thread());
+
+        for (auto i = 0; i != 1000; ++i) {
+            pool.post_function([&] {
+                if (pool.on_thread()) {
+                    on_pool.fetch_add(1);
+                }
+
+                // Work scheduled from the pool lands on the worker's deque and may be stolen.
+                pool.post_function([&] {
+                    count.fetch_add(1);
+                });
+            });
+        }
+
+        // The destructor finishes all scheduled work.
+    }
+
+    REQUIRE(on_pool.load() == 1000);
+    REQUIRE(count.load() == 1000);
+}
+
+TEST_CASE(parallel_for)
+{
+    auto pool = hi::thread_pool{4};
+
+    auto calls = std::vector<std::atomic<int>>(100);
+    pool.parallel_for(calls.size(), [&](std::size_t i) {
+        calls[i].fetch_add(1);
+    });
+
+    for (auto const& call : calls) {
+        REQUIRE(call.load() == 1);
+    }
+
+    // Nothing to do.
+    pool.parallel_for(0, [](std::size_t) {
+        throw std::runtime_error("not called");
+    });
+}
+
+TEST_CASE(parallel_for_exception)
+{
+    auto pool = hi::thread_pool{4};
+
+    // Every call is made, the exception of the lowest index is rethrown.
+    auto count = std::atomic<int>{0};
+    auto what = std::string{};
+    try {
+        pool.parallel_for(10, [&](std::size_t i) {
+            count.fetch_add(1);
+            if (i == 3 or i == 7) {
+                throw std::runtime_error(std::to_string(i));
+            }
+        });
+    } catch (std::runtime_error const& e) {
+        what = e.what();
+    }
+
+    REQUIRE(count.load() == 10);
+    REQUIRE(what == "3");
+}
+
+TEST_CASE(parallel_for_on_pool)
+{
+    auto pool = hi::thread_pool{2};
+
+    // From a thread of the pool the calls are made on that thread, so the pool does not wait on itself.
+    auto done = std::atomic<bool>{false};
+    auto same_thread = std::atomic<int>{0};
+    pool.post_function([&] {
+        auto const pool_thread = std::this_thread::get_id();
+        pool.parallel_for(10, [&](std::size_t) {
+            if (std::this_thread::get_id() == pool_thread) {
+                same_thread.fetch_add(1);
+            }
+        });
+        done.store(true);
+        done.notify_all();
+    });
+
+    done.wait(false);
+    REQUIRE(same_thread.load() == 10);
+}
+
+TEST_CASE(schedule_and_return)
+{
+    auto pool = hi::thread_pool{2};
+    auto& loop = hi::loop::local();
+    auto const main_thread = std::this_thread::get_id();
+
+    auto pool_thread = std::thread::id{};
+    auto caller_thread = std::thread::id{};
+    auto t = [&]() -> hi::task<int> {
+        co_await pool.schedule();
+        pool_thread = std::this_thread::get_id();
+
+        co_await loop.schedule();
+        caller_thread = std::this_thread::get_id();
+        co_return 42;
+    };
+
+    auto r = t();
+    while (not r.done()) {
+        loop.resume_once();
+    }
+
+    REQUIRE(pool_thread != main_thread);
+    REQUIRE(caller_thread == main_thread);
+    REQUIRE(r.value() == 42);
+}
+
+};
@@ -28,6 +28,7 @@ hi_export enum class access_mode {
     no_reuse = 0x4000, ///< Hint that the data should not be cached.
     write_through = 0x8000, ///< Hint that writes should be send directly to disk.
     create_directories = 0x10000, ///< Create directory hierarchy, if the file could not be created.
+    no_buffering = 0x20000, ///< Bypass the operating system's file cache; writes must be sector aligned, see `file_writer`.
 
     open_for_read = open | read, ///< Default open a file for reading.
     open_for_read_and_write = open | read | write, ///< Default open a file for reading and writing.
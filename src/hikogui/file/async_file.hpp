@@ -0,0 +1,107 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file file/async_file.hpp Asynchronous reads from files.
+ * @ingroup file
+ */
+
+#pragma once
+
+#include "file_intf.hpp"
+#include "access_mode.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../container/container.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <span>
+#include <filesystem>
+
+hi_export_module(hikogui.file.async_file);
+
+hi_export namespace hi {
+inline namespace v1 {
+
+/** Read data from a file at an offset asynchronously.
+ *
+ * The read is done on `thread_pool::global()`; the co-routine resumes on
+ * the loop of the thread that called this function.
+ *
+ * @param f The file to read from.
+ * @param offset The offset in the file in bytes.
+ * @param buffers The buffers to read into, filled in order; they must stay
+ *                alive until the task is completed.
+ * @return A task with the total number of bytes read.
+ * @throws io_error On IO error, when awaiting the task.
+ */
+hi_export [[nodiscard]] inline task<std::size_t>
+async_read(file f, std::size_t offset, std::vector<std::span<std::byte>> buffers)
+{
+    return async_task([f = std::move(f), offset, buffers = std::move(buffers)]() mutable {
+        return f.read_at(offset, buffers);
+    });
+}
+
+/** Read data from a file at an offset asynchronously into a buffer.
+ *
+ * @see async_read(file, std::size_t, std::vector<std::span<std::byte>>)
+ */
+hi_export [[nodiscard]] inline task<std::size_t> async_read(file f, std::size_t offset, std::span<std::byte> buffer)
+{
+    return async_read(std::move(f), offset, std::vector<std::span<std::byte>>{buffer});
+}
+
+/** Read bytes from a file at an offset asynchronously.
+ *
+ * @see async_read(file, std::size_t, std::vector<std::span<std::byte>>)
+ * @param f The file to read from.
+ * @param offset The offset in the file in bytes.
+ * @param max_size The maximum number of bytes to read.
+ * @return A task with the data as a byte string.
+ */
+hi_export [[nodiscard]] inline task<bstring>
+async_read_bstring(file f, std::size_t offset = 0, std::size_t max_size = 10'000'000)
+{
+    return async_task([f = std::move(f), offset, max_size]() mutable {
+        return f.read_bstring_at(offset, max_size);
+    });
+}
+
+/** Read many complete files asynchronously.
+ *
+ * All files are opened and read in parallel on `thread_pool::global()`,
+ * so that loading many resources does not wait on the latency of each
+ * read in turn. The files are opened with the `access_mode::sequential` hint.
+ *
+ * @param paths The paths of the files to read.
+ * @param max_size The maximum number of bytes to read from each file.
+ * @return A task with the contents of each file, in the order of @a paths.
+ * @throws io_error When a file could not be opened or read, when awaiting the task.
+ */
+hi_export [[nodiscard]] inline task<std::vector<bstring>>
+async_read_files(std::vector<std::filesystem::path> paths, std::size_t max_size = 10'000'000)
+{
+    // Start all the reads before waiting on any of them.
+    auto tasks = std::vector<task<bstring>>{};
+    tasks.reserve(paths.size());
+    for (auto const& path : paths) {
+        tasks.push_back(async_task([path, max_size] {
+            return file{path, access_mode::open_for_read | access_mode::sequential}.read_bstring(max_size);
+        }));
+    }
+
+    auto r = std::vector<bstring>{};
+    r.reserve(tasks.size());
+    for (auto const& t : tasks) {
+        // The tasks complete on this thread's loop, so a task that is not done
+        // here will notify after the co_await has subscribed.
+        if (not t.done()) {
+            co_await t;
+        }
+        r.push_back(t.value());
+    }
+    co_return r;
+}
+
+}} // namespace hi::v1
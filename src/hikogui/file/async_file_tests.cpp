@@ -0,0 +1,66 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "async_file.hpp"
+#include "../path/path.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+#include <vector>
+#include <span>
+
+TEST_SUITE(async_file) {
+
+TEST_CASE(read_at)
+{
+    auto f = hi::file{hi::library_test_data_dir() / "file_view.txt"};
+
+    auto quick = std::array<std::byte, 5>{};
+    auto brown = std::array<std::byte, 6>{};
+    auto const buffers = std::vector<std::span<std::byte>>{quick, brown};
+    REQUIRE(f.read_at(4, buffers) == 11);
+    REQUIRE(hi::bstring(quick.begin(), quick.end()) == hi::to_bstring("quick"));
+    REQUIRE(hi::bstring(brown.begin(), brown.end()) == hi::to_bstring(" brown"));
+
+    REQUIRE(f.read_bstring_at(40) == hi::to_bstring("dog."));
+    REQUIRE(f.read_bstring_at(100).empty());
+}
+
+TEST_CASE(read_bstring)
+{
+    auto t = hi::async_read_bstring(hi::file{hi::library_test_data_dir() / "file_view.txt"}, 10, 5);
+
+    while (not t.done()) {
+        hi::loop::local().resume_once();
+    }
+
+    REQUIRE(t.value() == hi::to_bstring("brown"));
+}
+
+TEST_CASE(read_files)
+{
+    auto const path = hi::library_test_data_dir() / "file_view.txt";
+    auto t = hi::async_read_files({path, path, path});
+
+    while (not t.done()) {
+        hi::loop::local().resume_once();
+    }
+
+    REQUIRE(t.value().size() == 3);
+    for (auto const& text : t.value()) {
+        REQUIRE(text == hi::to_bstring("The quick brown fox jumps over the lazy dog."));
+    }
+}
+
+TEST_CASE(read_files_error)
+{
+    auto t = hi::async_read_files({hi::library_test_data_dir() / "does_not_exist.txt"});
+
+    while (not t.done()) {
+        hi::loop::local().resume_once();
+    }
+
+    REQUIRE_THROWS(t.value(), hi::io_error);
+}
+
+};
@@ -5,8 +5,12 @@
 #pragma once
 
 #include "access_mode.hpp" // export
+#include "async_file.hpp" // export
 #include "file_intf.hpp" // export
 #include "file_view.hpp" // export
+#include "file_writer.hpp" // export
+#include "parallel_glob.hpp" // export
+#include "resource_archive.hpp" // export
 #include "resource_view.hpp" // export
 #include "seek_whence.hpp" // export
 
@@ -20,6 +24,8 @@ inline namespace v1 {
 
 This module contains file handling utilities:
  - `file` and `file_view` class to read, write and rename files.
+ - `file_writer` to write to a file through a buffer.
+ - `async_read_bstring()` and `async_read_files()` to read files on the thread pool.
 
 File and file-views
 -------------------
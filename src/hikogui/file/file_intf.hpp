@@ -94,6 +94,19 @@ public:
         return _pimpl->size();
     }
 
+    /** Set the size of the file.
+     *
+     * The file is truncated, or extended with zeros. The seek location is
+     * not changed.
+     *
+     * @param size The new size of the file in bytes.
+     * @throw io_error
+     */
+    void set_size(std::size_t size)
+    {
+        return _pimpl->set_size(size);
+    }
+
     /** Set the seek location.
      * @param offset To move the file pointer.
      * @param whence Where to seek from: begin, current or end
@@ -134,6 +147,61 @@ public:
         return _pimpl->read(data, size);
     }
 
+    /** Read data from a file at an offset.
+     *
+     * The read does not depend on the seek location, so that it may be
+     * called from multiple threads at the same time. After the call
+     * the seek location is unspecified.
+     *
+     * @param offset The offset in the file in bytes.
+     * @param data Pointer to a buffer to read into.
+     * @param size The number of bytes to read.
+     * @return The number of bytes read, less than @a size at end-of-file.
+     * @throw io_error
+     */
+    [[nodiscard]] std::size_t read_at(std::size_t offset, void *data, std::size_t size)
+    {
+        return _pimpl->read_at(offset, data, size);
+    }
+
+    /** Read data from a file at an offset into multiple buffers.
+     *
+     * The buffers are filled in order, as-if they were a single buffer.
+     *
+     * @see read_at(std::size_t, void *, std::size_t)
+     * @param offset The offset in the file in bytes.
+     * @param buffers The buffers to read into.
+     * @return The total number of bytes read, less than the total size of
+     *         the buffers at end-of-file.
+     * @throw io_error
+     */
+    [[nodiscard]] std::size_t read_at(std::size_t offset, std::span<std::span<std::byte> const> buffers)
+    {
+        auto total_read = 0_uz;
+        for (auto const buffer : buffers) {
+            auto const bytes_read = read_at(offset + total_read, buffer.data(), buffer.size());
+            total_read += bytes_read;
+            if (bytes_read != buffer.size()) {
+                break;
+            }
+        }
+        return total_read;
+    }
+
+    /** Write data from multiple buffers to a file.
+     *
+     * The buffers are written in order, as-if they were a single buffer.
+     *
+     * @param buffers The buffers to write.
+     * @throw io_error
+     */
+    void write(std::span<std::span<std::byte const> const> buffers)
+    {
+        for (auto const buffer : buffers) {
+            write(buffer.data(), buffer.size());
+        }
+    }
+
     /** Write data to a file.
      *
      * @param bytes The byte string to write
@@ -193,6 +261,27 @@ public:
         return r;
     }
 
+    /** Read bytes from the file at an offset.
+     *
+     * @see read_at()
+     * @param offset The offset in the file in bytes.
+     * @param max_size The maximum number of bytes to read.
+     * @return Data as a byte string, may return less then the requested size.
+     * @throws io_error On IO error.
+     */
+    [[nodiscard]] bstring read_bstring_at(std::size_t offset, std::size_t max_size = 10'000'000)
+    {
+        auto const file_size = this->size();
+        auto const size_ = offset < file_size ? std::min(max_size, file_size - offset) : 0_uz;
+
+        auto r = bstring{};
+        // XXX c++23 resize_and_overwrite()
+        r.resize(size_);
+        auto const bytes_read = read_at(offset, r.data(), size_);
+        r.resize(bytes_read);
+        return r;
+    }
+
     /** Read a UTF-8 string from the file.
      *
      * Because of complications with reading UTF-8 string with sequences
@@ -143,6 +143,52 @@ public:
         return _pimpl->flush(span);
     }
 
+    /** Hint that a part of the mapping will be read soon.
+     *
+     * The pages are read from disk in large requests, instead of one
+     * page-fault at a time when the data is traversed. This is only a hint,
+     * and failures are ignored.
+     *
+     * @param span The part of the mapping to prefetch.
+     */
+    void prefetch(hi::const_void_span span) const noexcept
+    {
+        hi_assert_not_null(_pimpl);
+        return _pimpl->prefetch(span);
+    }
+
+    /** Hint that the whole mapping will be read soon.
+     */
+    void prefetch() const noexcept
+    {
+        return prefetch(const_void_span());
+    }
+
+    /** Lock a part of the mapping in physical memory.
+     *
+     * Use this for data that is used every frame, so that it is never paged
+     * out. The amount of memory a process can lock is limited by the
+     * operating system.
+     *
+     * @param span The part of the mapping to lock.
+     * @return True if the pages are locked.
+     */
+    [[nodiscard]] bool lock(hi::const_void_span span) const noexcept
+    {
+        hi_assert_not_null(_pimpl);
+        return _pimpl->lock(span);
+    }
+
+    /** Unlock a part of the mapping that was locked by `lock()`.
+     *
+     * @param span The part of the mapping to unlock.
+     */
+    void unlock(hi::const_void_span span) const noexcept
+    {
+        hi_assert_not_null(_pimpl);
+        return _pimpl->unlock(span);
+    }
+
     template<typename T>
     [[nodiscard]] friend std::span<T> as_span(file_view const& view) noexcept
     {
@@ -165,6 +211,18 @@ public:
         return as_bstring_view(view.const_void_span());
     }
 
+    /** Get the mapped bytes as a shared byte string, without copying.
+     *
+     * The mapping stays alive for as long as the returned shared_bstring, or any
+     * slice of it, exists.
+     */
+    [[nodiscard]] friend shared_bstring as_shared_bstring(file_view const& view) noexcept
+    {
+        hi_assert(view.offset() == 0);
+        hi_assert_not_null(view._pimpl);
+        return {view._pimpl, as_bstring_view(view.const_void_span())};
+    }
+
 private:
     mutable std::shared_ptr<detail::file_view_impl> _pimpl;
 };
@@ -15,4 +15,16 @@ TEST_CASE(read)
     REQUIRE(as_string_view(view) == "The quick brown fox jumps over the lazy dog.");
 }
 
+TEST_CASE(shared_bstring)
+{
+    auto bytes = hi::shared_bstring{};
+    {
+        auto const view = hi::file_view{hi::library_test_data_dir() / "file_view.txt"};
+        bytes = as_shared_bstring(view).substr(4, 5);
+    }
+
+    // The mapping is kept alive by the shared_bstring.
+    REQUIRE(bytes == hi::to_bstring("quick"));
+}
+
 };
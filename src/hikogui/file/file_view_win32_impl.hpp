@@ -129,6 +129,34 @@ public:
         }
     }
 
+    void prefetch(hi::const_void_span span) const noexcept
+    {
+        if (span.empty()) {
+            return;
+        }
+
+        auto entry = WIN32_MEMORY_RANGE_ENTRY{const_cast<void *>(span.data()), span.size()};
+        if (not PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0)) {
+            hi_log_error_once("file::error::prefetch-view", "Could not prefetch file view. '{}'", get_last_error_message());
+        }
+    }
+
+    [[nodiscard]] bool lock(hi::const_void_span span) const noexcept
+    {
+        if (span.empty()) {
+            return true;
+        }
+
+        return VirtualLock(const_cast<void *>(span.data()), span.size());
+    }
+
+    void unlock(hi::const_void_span span) const noexcept
+    {
+        if (not span.empty()) {
+            VirtualUnlock(const_cast<void *>(span.data()), span.size());
+        }
+    }
+
 private:
     mutable HANDLE _mapping_handle = nullptr;
     mutable std::shared_ptr<file_impl> _file;
@@ -83,6 +83,9 @@ public:
         if (to_bool(access_mode & access_mode::write_through)) {
             flags_and_attributes |= FILE_FLAG_WRITE_THROUGH;
         }
+        if (to_bool(access_mode & access_mode::no_buffering)) {
+            flags_and_attributes |= FILE_FLAG_NO_BUFFERING;
+        }
 
         if (to_bool(access_mode & access_mode::rename)) {
             desired_access |= DELETE;
@@ -158,6 +161,17 @@ public:
         return merge_bit_cast<std::size_t>(file_information.nFileSizeHigh, file_information.nFileSizeLow);
     }
 
+    void set_size(std::size_t size)
+    {
+        hi_assert(_file_handle != INVALID_HANDLE_VALUE);
+
+        auto end_of_file_info = FILE_END_OF_FILE_INFO{};
+        end_of_file_info.EndOfFile.QuadPart = narrow_cast<LONGLONG>(size);
+        if (not SetFileInformationByHandle(_file_handle, FileEndOfFileInfo, &end_of_file_info, sizeof(end_of_file_info))) {
+            throw io_error(std::format("{}: Could not set the size of the file.", get_last_error_message()));
+        }
+    }
+
     std::size_t seek(ssize_t offset, seek_whence whence)
     {
         hi_assert_not_null(_file_handle);
@@ -255,6 +269,40 @@ public:
         return total_read;
     }
 
+    [[nodiscard]] std::size_t read_at(std::size_t offset, void *data, std::size_t size)
+    {
+        hi_assert(_file_handle != INVALID_HANDLE_VALUE);
+
+        auto total_read = 0_uz;
+        while (size) {
+            // Read in blocks of 1 MByte, each with its own offset.
+            auto to_read = size < 0x10'0000 ? narrow_cast<DWORD>(size) : DWORD{0x10'0000};
+            auto has_read = DWORD{};
+
+            auto overlapped = OVERLAPPED{};
+            overlapped.Offset = truncate<DWORD>(offset);
+            overlapped.OffsetHigh = truncate<DWORD>(offset >> 32);
+
+            if (not ReadFile(_file_handle, data, to_read, &has_read, &overlapped)) {
+                if (GetLastError() == ERROR_HANDLE_EOF) {
+                    break;
+                }
+                throw io_error(std::format("{}: Could not read from file.", get_last_error_message()));
+
+            } else if (has_read == 0) {
+                // Read to end-of-file.
+                break;
+            }
+
+            data = advance_bytes(data, has_read);
+            offset += has_read;
+            size -= has_read;
+            total_read += has_read;
+        }
+
+        return total_read;
+    }
+
 private:
     hi::access_mode _access_mode;
     HANDLE _file_handle = nullptr;
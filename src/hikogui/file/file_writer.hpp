@@ -0,0 +1,234 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file file/file_writer.hpp Defines the file_writer class.
+ * @ingroup file
+ */
+
+#pragma once
+
+#include "file_intf.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <cstddef>
+#include <cstring>
+
+hi_export_module(hikogui.file.file_writer);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A buffered writer to a file.
+ * @ingroup file
+ *
+ * Small writes are collected in a buffer, which is written to the file
+ * when it is full or when `flush()` is called. A write that is larger than
+ * the buffer is written together with the buffered data as a single
+ * vectored write, without copying.
+ *
+ * When an alignment is given the buffer is allocated on that alignment and
+ * only whole aligned blocks are written to the file; this is required for
+ * files opened with `access_mode::no_buffering`, where the alignment must be
+ * a multiple of the sector size, a page size of 4096 bytes is a safe choice.
+ * In this mode `flush()` pads the last partial block with zeros and then sets
+ * the size of the file to the number of bytes written; the partial block
+ * is kept in the buffer and rewritten on the next flush.
+ *
+ * `file_writer` conforms to `byte_writer` so that it can be used as the sink
+ * of the JSON and BON8 writers.
+ */
+hi_export class file_writer {
+public:
+    constexpr static std::size_t default_capacity = 0x10'0000;
+
+    file_writer(file_writer const&) = delete;
+    file_writer(file_writer&&) = delete;
+    file_writer& operator=(file_writer const&) = delete;
+    file_writer& operator=(file_writer&&) = delete;
+
+    /** Flush the buffer to the file.
+     *
+     * @throw io_error
+     */
+    ~file_writer()
+    {
+        flush();
+    }
+
+    /** Create a writer that appends at the current seek location of a file.
+     *
+     * @param file The file to write to.
+     * @param capacity The size of the buffer in bytes, rounded up to a multiple of @a alignment.
+     * @param alignment The alignment of the buffer and of the writes to the file. Zero when
+     *                  writes do not need to be aligned.
+     */
+    file_writer(hi::file file, std::size_t capacity = default_capacity, std::size_t alignment = 0) :
+        _file(std::move(file)), _alignment(alignment)
+    {
+        hi_assert(alignment == 0 or std::has_single_bit(alignment));
+        hi_assert(capacity != 0);
+
+        if (_alignment != 0) {
+            _capacity = ceil(capacity, _alignment);
+            _allocation = std::make_unique<std::byte[]>(_capacity + _alignment - 1);
+            _buffer = ceil(_allocation.get(), _alignment);
+        } else {
+            _capacity = capacity;
+            _allocation = std::make_unique<std::byte[]>(_capacity);
+            _buffer = _allocation.get();
+        }
+
+        _offset = _file.get_seek();
+        hi_assert(_alignment == 0 or _offset % _alignment == 0);
+    }
+
+    /** The file that is written to.
+     */
+    [[nodiscard]] hi::file const& file() const noexcept
+    {
+        return _file;
+    }
+
+    /** The size of the buffer in bytes.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    /** The offset in the file where the next byte will be written.
+     */
+    [[nodiscard]] std::size_t offset() const noexcept
+    {
+        return _offset + _size;
+    }
+
+    /** Write data to the buffer.
+     *
+     * @param data Pointer to data to be written.
+     * @param size The number of bytes to write.
+     * @throw io_error
+     */
+    void write(void const *data, std::size_t size)
+    {
+        hi_axiom(data != nullptr or size == 0);
+
+        if (_alignment == 0 and size >= _capacity) {
+            // Write the buffer and the data in one go, instead of copying.
+            auto const buffers = std::array{
+                std::span<std::byte const>{_buffer, _size},
+                std::span<std::byte const>{static_cast<std::byte const *>(data), size}};
+            _file.write(buffers);
+            _offset += _size + size;
+            _size = 0;
+            return;
+        }
+
+        while (size != 0) {
+            auto const to_copy = std::min(size, _capacity - _size);
+            std::memcpy(_buffer + _size, data, to_copy);
+            _size += to_copy;
+            data = advance_bytes(data, to_copy);
+            size -= to_copy;
+
+            if (_size == _capacity) {
+                _file.write(_buffer, _size);
+                _offset += _size;
+                _size = 0;
+            }
+        }
+    }
+
+    /** Write data to the buffer.
+     *
+     * @param bytes The byte string to write
+     * @throw io_error
+     */
+    void write(std::span<std::byte const> bytes)
+    {
+        return write(bytes.data(), bytes.size());
+    }
+
+    /** Write data to the buffer.
+     *
+     * @param text The byte string to write
+     * @throw io_error
+     */
+    void write(bstring_view text)
+    {
+        return write(text.data(), text.size());
+    }
+
+    /** Write data to the buffer.
+     *
+     * @param text The UTF-8 string to write
+     * @throw io_error
+     */
+    void write(std::string_view text)
+    {
+        return write(text.data(), text.size());
+    }
+
+    /** Write the buffered data to the file.
+     *
+     * This does not wait for the data to be physically written to disk,
+     * use `hi::file::flush()` for that.
+     *
+     * @throw io_error
+     */
+    void flush()
+    {
+        if (_size == 0) {
+            return;
+        }
+
+        if (_alignment == 0) {
+            _file.write(_buffer, _size);
+            _offset += _size;
+            _size = 0;
+            return;
+        }
+
+        auto const whole_size = floor(_size, _alignment);
+        auto const padded_size = ceil(_size, _alignment);
+        std::memset(_buffer + _size, 0, padded_size - _size);
+        _file.write(_buffer, padded_size);
+
+        if (whole_size == _size) {
+            _offset += _size;
+            _size = 0;
+            return;
+        }
+
+        // Remove the padding from the file and keep the partial block
+        // in the buffer, so that it is rewritten, completed, on the next flush.
+        _file.set_size(_offset + _size);
+        _offset += whole_size;
+        _size -= whole_size;
+        std::memmove(_buffer, _buffer + whole_size, _size);
+        _file.seek(narrow_cast<std::ptrdiff_t>(_offset));
+    }
+
+private:
+    hi::file _file;
+    std::unique_ptr<std::byte[]> _allocation;
+    std::byte *_buffer = nullptr;
+    std::size_t _capacity = 0;
+    std::size_t _alignment = 0;
+
+    /** The offset in the file of the first byte in the buffer.
+     */
+    std::size_t _offset = 0;
+
+    /** The number of bytes in the buffer.
+     */
+    std::size_t _size = 0;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,70 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "file_writer.hpp"
+#include <hikotest/hikotest.hpp>
+#include <filesystem>
+#include <string>
+
+TEST_SUITE(file_writer_suite) {
+
+[[nodiscard]] static std::string read_back(std::filesystem::path const& path)
+{
+    return hi::file{path}.read_string();
+}
+
+TEST_CASE(small_writes)
+{
+    auto const path = std::filesystem::temp_directory_path() / "hikogui_file_writer_tests_small.txt";
+    {
+        auto w = hi::file_writer{hi::file{path, hi::access_mode::truncate_or_create_for_write}, 16};
+        for (auto i = 0; i != 10; ++i) {
+            w.write(std::string_view{"hello "});
+        }
+        REQUIRE(w.offset() == 60);
+    }
+
+    auto expected = std::string{};
+    for (auto i = 0; i != 10; ++i) {
+        expected += "hello ";
+    }
+    REQUIRE(read_back(path) == expected);
+}
+
+TEST_CASE(large_write)
+{
+    auto const path = std::filesystem::temp_directory_path() / "hikogui_file_writer_tests_large.txt";
+    auto const large = std::string(100, 'x');
+    {
+        auto w = hi::file_writer{hi::file{path, hi::access_mode::truncate_or_create_for_write}, 16};
+        w.write(std::string_view{"abc"});
+        w.write(large);
+        w.write(std::string_view{"def"});
+    }
+    REQUIRE(read_back(path) == "abc" + large + "def");
+}
+
+TEST_CASE(aligned_flush)
+{
+    auto const path = std::filesystem::temp_directory_path() / "hikogui_file_writer_tests_aligned.txt";
+    auto expected = std::string{};
+    {
+        auto w = hi::file_writer{hi::file{path, hi::access_mode::truncate_or_create_for_write}, 100, 64};
+        REQUIRE(w.capacity() == 128);
+
+        for (auto i = 0; i != 10; ++i) {
+            auto const line = std::string(13, static_cast<char>('a' + i));
+            w.write(line);
+            expected += line;
+
+            // Flushing a partial block pads it, then truncates the file.
+            w.flush();
+            REQUIRE(w.offset() == expected.size());
+            REQUIRE(read_back(path) == expected);
+        }
+    }
+    REQUIRE(read_back(path) == expected);
+}
+
+};
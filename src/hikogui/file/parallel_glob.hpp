@@ -0,0 +1,349 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file file/parallel_glob.hpp Find files matching a glob pattern, walking directories in parallel.
+ * @ingroup file
+ */
+
+#pragma once
+
+#include "../path/path.hpp"
+#include "../container/lru_cache.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <optional>
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+#include <cstddef>
+
+hi_export_module(hikogui.file.parallel_glob);
+
+hi_export namespace hi {
+inline namespace v1 {
+namespace detail {
+
+/** The entries of a single directory.
+ */
+struct directory_entries {
+    /** The modification time of the directory when the entries where read.
+     */
+    std::filesystem::file_time_type last_write_time;
+
+    /** The files, and the symbolic links which are not followed.
+     */
+    std::vector<std::filesystem::path> files;
+
+    /** The sub-directories.
+     */
+    std::vector<std::filesystem::path> directories;
+};
+
+/** A cache of the entries of directories.
+ *
+ * The entries of a directory are valid while the modification time of the
+ * directory does not change, which happens when entries are added, removed
+ * or renamed. The cache is checked with a single `stat()` per directory,
+ * instead of reading the directory again.
+ *
+ * The cache is bounded by the total number of paths of the cached directories,
+ * the least recently used directories are evicted first. A directory that
+ * could no longer be read is removed from the cache.
+ */
+class directory_cache {
+public:
+    /** The default maximum total number of paths in the cache.
+     */
+    constexpr static std::size_t default_capacity = 65536;
+
+    directory_cache(directory_cache const&) = delete;
+    directory_cache(directory_cache&&) = delete;
+    directory_cache& operator=(directory_cache const&) = delete;
+    directory_cache& operator=(directory_cache&&) = delete;
+
+    /** Create an empty cache.
+     *
+     * @param capacity The maximum total number of paths of the cached directories.
+     */
+    explicit directory_cache(std::size_t capacity = default_capacity) noexcept : _entries(capacity) {}
+
+    [[nodiscard]] static directory_cache& global() noexcept
+    {
+        static auto r = directory_cache{};
+        return r;
+    }
+
+    /** Get the entries of a directory.
+     *
+     * @note It is safe to call this function from any thread.
+     * @param path The path to the directory.
+     * @param use_cache Use the cached entries when the directory was not modified.
+     * @return The entries of the directory, or nullptr when the directory could not be read.
+     */
+    [[nodiscard]] std::shared_ptr<directory_entries const> get(std::filesystem::path const& path, bool use_cache = true) noexcept
+    {
+        // The modification time is read before the entries, so that a modification
+        // during reading will cause the entries to be read again on the next call.
+        auto ec = std::error_code{};
+        auto const last_write_time = std::filesystem::last_write_time(path, ec);
+        if (ec) {
+            // The directory does not exist.
+            invalidate(path);
+            return nullptr;
+        }
+
+        if (use_cache) {
+            auto const lock = std::scoped_lock(_mutex);
+            if (auto const ptr = _entries.find(path); ptr != nullptr and (*ptr)->last_write_time == last_write_time) {
+                ++global_counter<"directory_cache:hit">;
+                return *ptr;
+            }
+        }
+
+        ++global_counter<"directory_cache:miss">;
+        auto r = read(path, last_write_time);
+        if (r) {
+            auto const cost = r->files.size() + r->directories.size() + 1;
+            auto const lock = std::scoped_lock(_mutex);
+            _entries.insert(path, r, cost);
+        } else {
+            invalidate(path);
+        }
+        return r;
+    }
+
+    /** Remove the entries of a directory from the cache.
+     *
+     * This is needed when a directory is modified without changing its
+     * modification time, for example on filesystems with a coarse time resolution.
+     *
+     * @note It is safe to call this function from any thread.
+     * @param path The path to the directory.
+     */
+    void invalidate(std::filesystem::path const& path) noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        _entries.erase(path);
+    }
+
+    void clear() noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        _entries.clear();
+    }
+
+    /** The number of directories in the cache.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        return _entries.size();
+    }
+
+    /** The total number of paths of the directories in the cache.
+     */
+    [[nodiscard]] std::size_t cost() const noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        return _entries.cost();
+    }
+
+private:
+    struct path_hash {
+        [[nodiscard]] std::size_t operator()(std::filesystem::path const& path) const noexcept
+        {
+            return std::filesystem::hash_value(path);
+        }
+    };
+
+    mutable unfair_mutex _mutex;
+    lru_cache<std::filesystem::path, std::shared_ptr<directory_entries const>, path_hash> _entries;
+
+    [[nodiscard]] static std::shared_ptr<directory_entries const>
+    read(std::filesystem::path const& path, std::filesystem::file_time_type last_write_time) noexcept
+    {
+        try {
+            auto r = std::make_shared<directory_entries>();
+            r->last_write_time = last_write_time;
+
+            auto ec = std::error_code{};
+            auto const last = std::filesystem::directory_iterator{};
+            for (auto it = std::filesystem::directory_iterator{path, ec}; not ec and it != last; it.increment(ec)) {
+                // The file type is returned by the directory listing itself on most
+                // filesystems, so this does not need to stat() each entry.
+                auto entry_ec = std::error_code{};
+                if (not it->is_symlink(entry_ec) and it->is_directory(entry_ec)) {
+                    r->directories.push_back(it->path());
+                } else {
+                    r->files.push_back(it->path());
+                }
+            }
+
+            if (ec) {
+                return nullptr;
+            }
+            return r;
+
+        } catch (...) {
+            return nullptr;
+        }
+    }
+};
+
+/** The state of a parallel walk, shared between the workers.
+ */
+class parallel_glob_walker : public std::enable_shared_from_this<parallel_glob_walker> {
+public:
+    parallel_glob_walker(glob_pattern pattern, bool use_cache, bool parallel) noexcept :
+        _pattern(std::move(pattern)), _max_num_slashes(_pattern.max_num_slashes()), _use_cache(use_cache), _parallel(parallel)
+    {
+    }
+
+    /** Walk the directories, starting at the base path of the pattern.
+     *
+     * @return The paths that match the pattern, sorted.
+     */
+    [[nodiscard]] std::vector<std::filesystem::path> operator()() noexcept
+    {
+        _num_pending.store(1);
+        walk(_pattern.base_path());
+
+        for (auto n = _num_pending.load(); n != 0; n = _num_pending.load()) {
+            _num_pending.wait(n);
+        }
+
+        auto const lock = std::scoped_lock(_mutex);
+        std::ranges::sort(_paths);
+        return std::move(_paths);
+    }
+
+private:
+    glob_pattern _pattern;
+    std::optional<std::size_t> _max_num_slashes;
+    bool _use_cache;
+    bool _parallel;
+
+    /** The number of directories that still need to be walked.
+     */
+    std::atomic<std::size_t> _num_pending = 0;
+
+    unfair_mutex _mutex;
+    std::vector<std::filesystem::path> _paths;
+
+    /** Check if entries of the directory could match the pattern.
+     *
+     * The entries of a sub-directory have one more slash than the sub-directory itself.
+     */
+    [[nodiscard]] bool can_descend(std::filesystem::path const& directory) const noexcept
+    {
+        if (not _max_num_slashes) {
+            return true;
+        }
+
+        auto const num_slashes = narrow_cast<std::size_t>(std::ranges::count(directory.generic_string(), '/'));
+        return num_slashes < *_max_num_slashes;
+    }
+
+    /** Walk a directory.
+     *
+     * @pre `_num_pending` was incremented for this directory.
+     */
+    void walk(std::filesystem::path const& directory) noexcept
+    {
+        if (auto const entries = directory_cache::global().get(directory, _use_cache)) {
+            auto paths = std::vector<std::filesystem::path>{};
+            for (auto const& path : entries->files) {
+                if (_pattern.matches(path)) {
+                    paths.push_back(path);
+                }
+            }
+
+            for (auto const& path : entries->directories) {
+                if (_pattern.matches(path)) {
+                    paths.push_back(path);
+                }
+
+                if (not can_descend(path)) {
+                    continue;
+                }
+
+                _num_pending.fetch_add(1);
+                if (_parallel) {
+                    // The workers share ownership, so that the state outlives the notify below.
+                    thread_pool::global().post_function([self = shared_from_this(), path] {
+                        self->walk(path);
+                    });
+                } else {
+                    walk(path);
+                }
+            }
+
+            if (not paths.empty()) {
+                auto const lock = std::scoped_lock(_mutex);
+                _paths.insert(_paths.end(), std::make_move_iterator(paths.begin()), std::make_move_iterator(paths.end()));
+            }
+        }
+
+        if (_num_pending.fetch_sub(1) == 1) {
+            _num_pending.notify_all();
+        }
+    }
+};
+
+} // namespace detail
+
+/** Find paths on the filesystem that match the glob pattern.
+ * @ingroup file
+ *
+ * Unlike `glob()` the directories are walked in parallel on `thread_pool::global()`,
+ * and sub-directories that are too deep to match the pattern are skipped.
+ * The entries of each directory are cached, and are only read again when the
+ * modification time of the directory changes. The cache is bounded, and
+ * evicts the least recently used directories.
+ *
+ * When called from a thread of the pool, the directories are walked on the
+ * current thread, so that the pool does not wait on itself.
+ *
+ * @param pattern The pattern to search the filesystem for.
+ * @param use_cache Use the cached entries of directories that were not modified.
+ * @return The paths to objects on the filesystem that match the pattern, sorted.
+ */
+hi_export [[nodiscard]] inline std::vector<std::filesystem::path>
+parallel_glob(glob_pattern pattern, bool use_cache = true) noexcept
+{
+    auto const parallel = not thread_pool::global().on_thread();
+    auto walker = std::make_shared<detail::parallel_glob_walker>(std::move(pattern), use_cache, parallel);
+    return (*walker)();
+}
+
+/** Find paths on the filesystem that match the glob pattern.
+ * @ingroup file
+ *
+ * @see parallel_glob(glob_pattern, bool)
+ * @param locations The path-locations to search files in.
+ * @param ref A relative path pattern to search the path-location.
+ * @param use_cache Use the cached entries of directories that were not modified.
+ * @return The paths to objects in the path-locations that match the pattern, in
+ *         the order of @a locations, then sorted.
+ */
+hi_export template<path_range Locations>
+[[nodiscard]] inline std::vector<std::filesystem::path>
+parallel_glob(Locations&& locations, std::filesystem::path const& ref, bool use_cache = true) noexcept
+{
+    auto r = std::vector<std::filesystem::path>{};
+    for (auto const& directory : locations) {
+        auto paths = parallel_glob(glob_pattern{directory / ref}, use_cache);
+        r.insert(r.end(), std::make_move_iterator(paths.begin()), std::make_move_iterator(paths.end()));
+    }
+    return r;
+}
+
+}} // namespace hi::v1
@@ -0,0 +1,182 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "parallel_glob.hpp"
+#include <hikotest/hikotest.hpp>
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+
+TEST_SUITE(parallel_glob_suite) {
+
+static void make_file(std::filesystem::path const& path)
+{
+    auto f = std::ofstream{path};
+    f << "hello";
+}
+
+/** Make a directory tree in the temporary directory.
+ *
+ * ```
+ * a.txt
+ * b.dat
+ * sub1/c.txt
+ * sub1/deep/d.txt
+ * sub1/deep/deeper/e.txt
+ * sub2/f.txt
+ * ```
+ */
+[[nodiscard]] static std::filesystem::path make_tree(std::string_view name)
+{
+    auto const root = std::filesystem::temp_directory_path() / (std::string{"hikogui_parallel_glob_tests_"} + std::string{name});
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "sub1" / "deep" / "deeper");
+    std::filesystem::create_directories(root / "sub2");
+
+    make_file(root / "a.txt");
+    make_file(root / "b.dat");
+    make_file(root / "sub1" / "c.txt");
+    make_file(root / "sub1" / "deep" / "d.txt");
+    make_file(root / "sub1" / "deep" / "deeper" / "e.txt");
+    make_file(root / "sub2" / "f.txt");
+    return root;
+}
+
+[[nodiscard]] static std::vector<std::filesystem::path> sorted_glob(std::filesystem::path const& pattern)
+{
+    auto r = std::vector<std::filesystem::path>{};
+    for (auto const& path : hi::glob(pattern)) {
+        r.push_back(path);
+    }
+    std::ranges::sort(r);
+    return r;
+}
+
+TEST_CASE(same_as_glob)
+{
+    auto const root = make_tree("same_as_glob");
+
+    auto const patterns = std::vector<std::filesystem::path>{
+        root / "**" / "*.txt", root / "sub1" / "**" / "*", root / "*.txt", root / "*" / "*.txt", root / "*" / "*" / "*.txt"};
+    auto const expected_sizes = std::vector<std::size_t>{5, 5, 1, 2, 1};
+
+    for (auto i = std::size_t{0}; i != patterns.size(); ++i) {
+        auto const expected = sorted_glob(patterns[i]);
+        REQUIRE(expected.size() == expected_sizes[i]);
+
+        REQUIRE(hi::parallel_glob(hi::glob_pattern{patterns[i]}, false) == expected);
+        // The second time the entries of the directories are cached.
+        REQUIRE(hi::parallel_glob(hi::glob_pattern{patterns[i]}) == expected);
+        REQUIRE(hi::parallel_glob(hi::glob_pattern{patterns[i]}) == expected);
+    }
+
+    std::filesystem::remove_all(root);
+}
+
+TEST_CASE(max_num_slashes)
+{
+    auto const root = make_tree("max_num_slashes");
+
+    // The directories deeper than the pattern are not read.
+    hi::global_counter<"directory_cache:miss"> = 0;
+    auto const shallow = hi::parallel_glob(hi::glob_pattern{root / "*" / "*.txt"}, false);
+    REQUIRE(shallow.size() == 2);
+    REQUIRE(hi::global_counter<"directory_cache:miss"> == 3);
+
+    hi::global_counter<"directory_cache:miss"> = 0;
+    auto const deep = hi::parallel_glob(hi::glob_pattern{root / "*" / "*" / "*.txt"}, false);
+    REQUIRE(deep.size() == 1);
+    REQUIRE(deep.front() == root / "sub1" / "deep" / "d.txt");
+    REQUIRE(hi::global_counter<"directory_cache:miss"> == 4);
+
+    // Without a maximum depth every directory is read.
+    hi::global_counter<"directory_cache:miss"> = 0;
+    auto const all = hi::parallel_glob(hi::glob_pattern{root / "**" / "*.txt"}, false);
+    REQUIRE(all.size() == 5);
+    REQUIRE(hi::global_counter<"directory_cache:miss"> == 5);
+
+    std::filesystem::remove_all(root);
+}
+
+TEST_CASE(directory_cache_invalidation)
+{
+    auto const root = make_tree("directory_cache_invalidation");
+    auto cache = hi::detail::directory_cache{};
+
+    auto const first = cache.get(root);
+    REQUIRE(first != nullptr);
+    REQUIRE(first->files.size() == 2);
+    REQUIRE(first->directories.size() == 2);
+
+    // An unmodified directory is not read again.
+    REQUIRE(cache.get(root) == first);
+
+    // The cache only looks at the modification time of the directory.
+    auto const last_write_time = std::filesystem::last_write_time(root);
+    make_file(root / "g.txt");
+    std::filesystem::last_write_time(root, last_write_time);
+    REQUIRE(cache.get(root) == first);
+
+    // When the modification time changes the directory is read again.
+    std::filesystem::last_write_time(root, last_write_time + std::chrono::seconds{1});
+    auto const second = cache.get(root);
+    REQUIRE(second != nullptr);
+    REQUIRE(second != first);
+    REQUIRE(second->files.size() == 3);
+    REQUIRE(cache.get(root) == second);
+
+    // Bypassing the cache always reads the directory.
+    auto const third = cache.get(root, false);
+    REQUIRE(third != second);
+    REQUIRE(third->files.size() == 3);
+
+    // An invalidated directory is read again, even when it was not modified.
+    cache.invalidate(root);
+    REQUIRE(cache.size() == 0);
+    auto const fourth = cache.get(root);
+    REQUIRE(fourth != third);
+    REQUIRE(cache.get(root) == fourth);
+
+    // A directory that does not exist has no entries, and is removed from the cache.
+    std::filesystem::remove_all(root);
+    REQUIRE(cache.get(root) == nullptr);
+    REQUIRE(cache.size() == 0);
+    REQUIRE(cache.cost() == 0);
+}
+
+TEST_CASE(directory_cache_capacity)
+{
+    auto const root = make_tree("directory_cache_capacity");
+
+    // The cost of a directory is the number of its entries plus one:
+    // root is 5, sub1 is 3 and sub2 is 2.
+    auto cache = hi::detail::directory_cache{8};
+
+    auto const root_entries = cache.get(root);
+    auto const sub1_entries = cache.get(root / "sub1");
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.cost() == 8);
+
+    // Make root the most recently used directory, so that sub1 is evicted.
+    REQUIRE(cache.get(root) == root_entries);
+    auto const sub2_entries = cache.get(root / "sub2");
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.cost() == 7);
+    REQUIRE(cache.get(root) == root_entries);
+    REQUIRE(cache.get(root / "sub2") == sub2_entries);
+
+    // The evicted directory is read again.
+    auto const sub1_again = cache.get(root / "sub1");
+    REQUIRE(sub1_again != sub1_entries);
+    REQUIRE(sub1_again->files.size() == 1);
+    REQUIRE(cache.cost() <= 8);
+
+    std::filesystem::remove_all(root);
+}
+
+};
@@ -0,0 +1,273 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file file/resource_archive.hpp Defines resource_archive.
+ * @ingroup file
+ */
+
+#pragma once
+
+#include "file_view.hpp"
+#include "resource_view.hpp"
+#include "../path/path.hpp"
+#include "../container/container.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <map>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <algorithm>
+#include <filesystem>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.file.resource_archive);
+
+hi_export namespace hi { inline namespace v1 {
+namespace detail {
+
+/** A resource inside a resource archive.
+ *
+ * The resource holds on to the mapping of the complete archive.
+ */
+class resource_archive_view {
+public:
+    resource_archive_view(file_view view, hi::const_void_span span) noexcept : _view(std::move(view)), _span(span) {}
+
+    [[nodiscard]] hi::const_void_span const_void_span() const noexcept
+    {
+        return _span;
+    }
+
+    void prefetch() const noexcept
+    {
+        _view.prefetch(_span);
+    }
+
+private:
+    file_view _view;
+    hi::const_void_span _span;
+};
+
+} // namespace detail
+
+/** An archive of resources in a single file.
+ *
+ * Loading many small resources as separate files costs an open, a map and
+ * a close for each one. An archive is mapped once, and each resource is
+ * a part of that mapping.
+ *
+ * The archive file is little-endian and consists of:
+ *  - A header with the magic "hiresarc", the version and the number of entries.
+ *  - A table of contents with for each entry the offset and size of its data,
+ *    and the offset and size of its name. The entries are sorted by name.
+ *  - The UTF-8 names of the entries.
+ *  - The data of each entry, starting at a multiple of 64 bytes from the
+ *    start of the file. Resources are stored as they need to be used, for example
+ *    already decompressed.
+ *
+ * @ingroup file
+ */
+class resource_archive {
+public:
+    /** The alignment in bytes of the data of each entry.
+     */
+    constexpr static std::size_t alignment = 64;
+
+    resource_archive() noexcept = default;
+
+    /** Open a resource archive.
+     *
+     * @param view The mapping of the archive file.
+     * @throws parse_error When the archive is corrupt.
+     */
+    explicit resource_archive(file_view view) : _view(std::move(view))
+    {
+        auto const bytes = as_span<std::byte const>(_view);
+
+        hi_check(bytes.size() >= sizeof(header_type), "Resource archive is too small.");
+
+        auto offset = 0_uz;
+        auto const& header = implicit_cast<header_type>(offset, bytes);
+        if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 or *header.version != version) {
+            throw parse_error("Resource archive has an unknown format.");
+        }
+
+        hi_check(offset + std::size_t{*header.num_entries} * sizeof(entry_type) <= bytes.size(), "Resource archive is truncated.");
+        _entries = implicit_cast<entry_type>(offset, bytes, *header.num_entries);
+
+        auto previous_name = std::string_view{};
+        for (auto const& entry : _entries) {
+            if (*entry.data_offset % alignment != 0) {
+                throw parse_error("Resource archive entry is not aligned.");
+            }
+            hi_check_subspan(bytes, *entry.data_offset, *entry.data_size);
+
+            auto const name = as_string_view(hi_check_subspan(bytes, *entry.name_offset, *entry.name_size));
+            if (&entry != &_entries.front() and name <= previous_name) {
+                throw parse_error("Resource archive entries are not sorted by name.");
+            }
+            previous_name = name;
+        }
+    }
+
+    /** Open a resource archive.
+     *
+     * @param path The path to the archive file.
+     * @throws io_error When the archive could not be opened.
+     * @throws parse_error When the archive is corrupt.
+     */
+    explicit resource_archive(std::filesystem::path const& path) : resource_archive(file_view{path}) {}
+
+    /** The number of resources in the archive.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _entries.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _entries.empty();
+    }
+
+    /** Check if the archive contains a resource.
+     *
+     * @param name The name of the resource, a relative path with '/' separators.
+     */
+    [[nodiscard]] bool contains(std::string_view name) const noexcept
+    {
+        return find_entry(name) != nullptr;
+    }
+
+    /** Find a resource in the archive.
+     *
+     * @param name The name of the resource, a relative path with '/' separators.
+     * @return A view of the resource, which keeps the archive mapped; or empty if not found.
+     */
+    [[nodiscard]] std::optional<const_resource_view> find(std::string_view name) const noexcept
+    {
+        if (auto const *entry = find_entry(name)) {
+            auto const bytes = as_span<std::byte const>(_view).subspan(*entry->data_offset, *entry->data_size);
+            return const_resource_view{detail::resource_archive_view{_view, bytes}};
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    /** Create the contents of an archive file.
+     *
+     * @param resources The name and data of each resource.
+     * @return The bytes of the archive file.
+     */
+    [[nodiscard]] static bstring make(std::map<std::string, bstring> const& resources)
+    {
+        auto names_size = 0_uz;
+        for (auto const& [name, data] : resources) {
+            names_size += name.size();
+        }
+
+        auto const names_offset = sizeof(header_type) + resources.size() * sizeof(entry_type);
+        auto data_offset = ceil(names_offset + names_size, alignment);
+
+        auto header = header_type{};
+        std::memcpy(header.magic, magic, sizeof(header.magic));
+        header.version = version;
+        header.num_entries = narrow_cast<uint32_t>(resources.size());
+
+        auto entries = std::vector<entry_type>{};
+        auto names = std::string{};
+        for (auto const& [name, data] : resources) {
+            auto& entry = entries.emplace_back();
+            entry.data_offset = narrow_cast<uint64_t>(data_offset);
+            entry.data_size = narrow_cast<uint64_t>(data.size());
+            entry.name_offset = narrow_cast<uint32_t>(names_offset + names.size());
+            entry.name_size = narrow_cast<uint32_t>(name.size());
+
+            names += name;
+            data_offset = ceil(data_offset + data.size(), alignment);
+        }
+
+        auto r = bstring{};
+        r.reserve(data_offset);
+        r.append(reinterpret_cast<std::byte const *>(&header), sizeof(header));
+        r.append(reinterpret_cast<std::byte const *>(entries.data()), entries.size() * sizeof(entry_type));
+        r.append(reinterpret_cast<std::byte const *>(names.data()), names.size());
+        for (auto const& [name, data] : resources) {
+            r.resize(ceil(r.size(), alignment), std::byte{0});
+            r += data;
+        }
+        return r;
+    }
+
+private:
+    constexpr static char magic[8] = {'h', 'i', 'r', 'e', 's', 'a', 'r', 'c'};
+    constexpr static uint32_t version = 1;
+
+    struct header_type {
+        char magic[8];
+        little_uint32_buf_t version;
+        little_uint32_buf_t num_entries;
+    };
+
+    /** An entry in the table of contents.
+     *
+     * The offsets are in bytes from the start of the file.
+     */
+    struct entry_type {
+        little_uint64_buf_t data_offset;
+        little_uint64_buf_t data_size;
+        little_uint32_buf_t name_offset;
+        little_uint32_buf_t name_size;
+    };
+
+    static_assert(std::is_trivially_copyable_v<header_type>);
+    static_assert(std::is_trivially_copyable_v<entry_type>);
+
+    file_view _view = {};
+    std::span<entry_type const> _entries = {};
+
+    [[nodiscard]] std::string_view entry_name(entry_type const& entry) const noexcept
+    {
+        auto const bytes = as_span<std::byte const>(_view).subspan(*entry.name_offset, *entry.name_size);
+        return as_string_view(bytes);
+    }
+
+    [[nodiscard]] entry_type const *find_entry(std::string_view name) const noexcept
+    {
+        auto const it = std::lower_bound(_entries.begin(), _entries.end(), name, [this](entry_type const& entry, std::string_view key) {
+            return entry_name(entry) < key;
+        });
+
+        if (it != _entries.end() and entry_name(*it) == name) {
+            return std::addressof(*it);
+        } else {
+            return nullptr;
+        }
+    }
+};
+
+/** Open a resource.
+ *
+ * The resource is first looked up in the archive, then in the resource directories.
+ *
+ * @ingroup file
+ * @param archive The archive to look in first.
+ * @param ref A relative path to the resource.
+ * @return A view of the resource.
+ * @throws io_error When the resource is not found.
+ */
+[[nodiscard]] inline const_resource_view open_resource(resource_archive const& archive, std::filesystem::path const& ref)
+{
+    if (auto r = archive.find(ref.generic_string())) {
+        return *std::move(r);
+    }
+
+    return const_resource_view{get_path(resource_dirs(), ref)};
+}
+
+}} // namespace hi::v1
@@ -0,0 +1,75 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "resource_archive.hpp"
+#include <hikotest/hikotest.hpp>
+#include <filesystem>
+#include <map>
+#include <string>
+
+TEST_SUITE(resource_archive_suite) {
+
+[[nodiscard]] static std::filesystem::path save(std::string const& filename, hi::bstring const& bytes)
+{
+    auto const path = std::filesystem::temp_directory_path() / filename;
+    auto f = hi::file{path, hi::access_mode::truncate_or_create_for_write};
+    f.write(bytes);
+    f.close();
+    return path;
+}
+
+TEST_CASE(find)
+{
+    auto resources = std::map<std::string, hi::bstring>{};
+    resources["icons/close.png"] = hi::to_bstring("close");
+    resources["fonts/NotoSans-Regular.ttf"] = hi::to_bstring("The quick brown fox jumps over the lazy dog.");
+    resources["empty.txt"] = hi::bstring{};
+    resources["themes/dark.json"] = hi::to_bstring("{}");
+
+    auto const path = save("hikogui_resource_archive_tests.bin", hi::resource_archive::make(resources));
+    auto const archive = hi::resource_archive{path};
+    REQUIRE(archive.size() == 4);
+
+    for (auto const& [name, data] : resources) {
+        auto const view = archive.find(name);
+        REQUIRE(view.has_value());
+        REQUIRE(as_bstring_view(*view) == data);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(view->const_void_span().data()) % hi::resource_archive::alignment == 0 or data.empty());
+    }
+
+    REQUIRE(archive.contains("themes/dark.json"));
+    REQUIRE(not archive.contains("themes/light.json"));
+    REQUIRE(not archive.find("icons").has_value());
+    REQUIRE(not archive.find("").has_value());
+}
+
+TEST_CASE(view_outlives_archive)
+{
+    auto resources = std::map<std::string, hi::bstring>{};
+    resources["a"] = hi::to_bstring("alpha");
+
+    auto const path = save("hikogui_resource_archive_tests2.bin", hi::resource_archive::make(resources));
+    auto view = hi::const_resource_view{};
+    {
+        auto const archive = hi::resource_archive{path};
+        view = *archive.find("a");
+    }
+
+    REQUIRE(as_bstring_view(view) == hi::to_bstring("alpha"));
+}
+
+TEST_CASE(corrupt)
+{
+    auto resources = std::map<std::string, hi::bstring>{};
+    resources["a"] = hi::to_bstring("alpha");
+    auto bytes = hi::resource_archive::make(resources);
+
+    REQUIRE_THROWS(hi::resource_archive{save("hikogui_resource_archive_tests3.bin", bytes.substr(0, 10))}, hi::parse_error);
+    REQUIRE_THROWS(hi::resource_archive{save("hikogui_resource_archive_tests3.bin", bytes.substr(0, 30))}, hi::parse_error);
+
+    bytes[0] = std::byte{'H'};
+    REQUIRE_THROWS(hi::resource_archive{save("hikogui_resource_archive_tests3.bin", bytes)}, hi::parse_error);
+}
+
+};
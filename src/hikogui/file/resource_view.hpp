@@ -32,6 +32,8 @@ public:
     virtual ~resource_view_base() = default;
 
     [[nodiscard]] virtual hi::const_void_span const_void_span() const noexcept = 0;
+
+    virtual void prefetch() const noexcept = 0;
 };
 
 template<typename T>
@@ -47,6 +49,13 @@ public:
         return _value.const_void_span();
     }
 
+    void prefetch() const noexcept override
+    {
+        if constexpr (requires { _value.prefetch(); }) {
+            _value.prefetch();
+        }
+    }
+
 private:
     value_type _value;
 };
@@ -96,6 +105,17 @@ public:
         return _pimpl->const_void_span();
     }
 
+    /** Hint that the resource will be read soon.
+     *
+     * For a resource that is mapped from a file the pages are read from disk
+     * ahead of use; otherwise this does nothing.
+     */
+    void prefetch() const noexcept
+    {
+        hi_assert_not_null(_pimpl);
+        return _pimpl->prefetch();
+    }
+
     template<typename T>
     [[nodiscard]] friend std::span<T> as_span(const_resource_view const& view) noexcept
     {
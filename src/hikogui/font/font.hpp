@@ -7,8 +7,10 @@
 #include "elusive_icon.hpp" // export
 #include "font_font.hpp" // export
 #include "font_book.hpp" // export
+#include "font_fallback_map.hpp" // export
 #include "font_family_id.hpp" // export
 #include "font_id.hpp" // export
+#include "font_index_cache.hpp" // export
 #include "font_metrics.hpp" // export
 #include "font_variant.hpp" // export
 #include "font_weight.hpp" // export
@@ -6,8 +6,10 @@
 
 #include "font_font.hpp"
 #include "font_id.hpp"
+#include "font_fallback_map.hpp"
 #include "font_glyph_ids.hpp"
 #include "font_family_id.hpp"
+#include "font_index_cache.hpp"
 #include "true_type_font.hpp"
 #include "elusive_icon.hpp"
 #include "hikogui_icon.hpp"
@@ -15,11 +17,13 @@
 #include "../geometry/geometry.hpp"
 #include "../utility/utility.hpp"
 #include "../path/path.hpp"
+#include "../file/file.hpp"
 #include <gsl/gsl>
 #include <limits>
 #include <array>
 #include <new>
 #include <atomic>
+#include <memory>
 #include <filesystem>
 
 hi_export_module(hikogui.font : font_book);
@@ -36,6 +40,15 @@ class font_book {
 public:
     static font_book& global() noexcept;
 
+    /** Use a persistent index of the properties of font files.
+     *
+     * Fonts found in the index are registered without opening the font file,
+     * the index is saved in the data directory after post processing.
+     *
+     * @note Must be set before the first font is registered.
+     */
+    static inline bool font_index_enabled = false;
+
     ~font_book() = default;
     font_book(font_book const&) = delete;
     font_book(font_book&&) = delete;
@@ -51,6 +64,9 @@ public:
      *  - The weight, width, slant & design-size from the 'fdsc' table.
      *  - The character map 'cmap' table.
      *
+     * When `font_index_enabled` is set and the font file did not change since it
+     * was added to the font index, the properties are read from the index instead.
+     *
      * @param path Location of font.
      * @param post_process Calculate font fallback
      */
@@ -61,7 +77,7 @@ public:
         }
 
         auto const font_id = hi::font_id{gsl::narrow_cast<font_id::value_type>(_fonts.size())};
-        auto const &font = *_fonts.emplace_back(std::make_unique<true_type_font>(path));
+        auto const &font = *_fonts.emplace_back(load_font(path));
         _fallback_chain.push_back(font_id);
 
         hi_log_info("Parsed font id={} {}: {}", *font_id, path.string(), to_string(font));
@@ -83,7 +99,7 @@ public:
     void register_font_directory(std::filesystem::path const& path, bool post_process = true)
     {
         auto const font_directory_glob = path / "**" / "*.ttf";
-        for (auto const& font_path : glob(font_directory_glob)) {
+        for (auto const& font_path : parallel_glob(font_directory_glob)) {
             auto const t = trace<"font_scan">{};
 
             try {
@@ -121,6 +137,10 @@ public:
             size(bold_fallback_chain),
             size(italic_fallback_chain));
 
+        auto const regular_fallback_map = make_fallback_map(regular_fallback_chain);
+        auto const bold_fallback_map = make_fallback_map(bold_fallback_chain);
+        auto const italic_fallback_map = make_fallback_map(italic_fallback_chain);
+
         // For each font, find fallback list.
         for (auto const& font : _fallback_chain) {
             auto fallback_chain = std::vector<hi::font_id>{};
@@ -139,15 +159,36 @@ public:
                 // clang-format on
             }
 
+            auto const num_family = fallback_chain.size();
+
+            auto fallback_map = std::shared_ptr<font_fallback_map const>{};
             if (almost_equal(font->weight, font_weight::bold)) {
                 std::copy(begin(bold_fallback_chain), end(bold_fallback_chain), std::back_inserter(fallback_chain));
+                fallback_map = bold_fallback_map;
             } else if (font->style == font_style::italic) {
                 std::copy(begin(italic_fallback_chain), end(italic_fallback_chain), std::back_inserter(fallback_chain));
+                fallback_map = italic_fallback_map;
             } else {
                 std::copy(begin(regular_fallback_chain), end(regular_fallback_chain), std::back_inserter(fallback_chain));
+                fallback_map = regular_fallback_map;
+            }
+
+            if (num_family != 0) {
+                // The fonts of the same family are searched before the shared fallback fonts.
+                auto family_fallback_map = std::make_shared<font_fallback_map>();
+                for (auto i = 0_uz; i != num_family; ++i) {
+                    family_fallback_map->add(fallback_chain[i], fallback_chain[i]->char_map);
+                }
+                family_fallback_map->add(*fallback_map);
+                fallback_map = std::move(family_fallback_map);
             }
 
             font->fallback_chain = std::move(fallback_chain);
+            font->fallback_map = std::move(fallback_map);
+        }
+
+        if (_font_index) {
+            _font_index->save();
         }
     }
 
@@ -229,6 +270,19 @@ public:
             return {font, std::move(glyph_ids)};
         }
 
+        // A single code-point without a canonical decomposition is found in the first fallback
+        // font which supports it, which is known without searching each font.
+        if (grapheme.size() == 1 and font->fallback_map) {
+            auto const code_point = grapheme.starter();
+            auto const decomposition = ucd_get_decomposition(code_point);
+            if (decomposition.type() != unicode_decomposition_type::canonical or decomposition.cp_size() == 0) {
+                if (auto const fallback = font->fallback_map->find(code_point)) {
+                    return {fallback, {fallback->find_glyph(code_point)}};
+                }
+                return {font, {glyph_id{0}}};
+            }
+        }
+
         // Scan fonts which are fallback to this.
         for (auto const fallback : font->fallback_chain) {
             hi_axiom(not fallback.empty());
@@ -253,6 +307,41 @@ private:
     std::vector<std::unique_ptr<font>> _fonts;
     std::vector<hi::font_id> _fallback_chain;
 
+    /** The persistent index of font files, nullptr when `font_index_enabled` is false.
+     */
+    std::unique_ptr<font_index_cache> _font_index;
+
+    /** Load a font, using the font index when available.
+     */
+    [[nodiscard]] std::unique_ptr<true_type_font> load_font(std::filesystem::path const& path)
+    {
+        if (font_index_enabled and not _font_index) {
+            if (auto const dir = data_dir()) {
+                _font_index = std::make_unique<font_index_cache>(*dir / "font_index.bin");
+            } else {
+                hi_log_error("Could not find the data directory for the font index. \"{}\"", dir.error().message());
+                _font_index = std::make_unique<font_index_cache>();
+            }
+        }
+
+        if (not _font_index) {
+            return std::make_unique<true_type_font>(path);
+        }
+
+        auto const stamp = font_index_cache::get_stamp(path);
+        if (not stamp) {
+            return std::make_unique<true_type_font>(path);
+        }
+
+        if (auto record = _font_index->find(path, *stamp)) {
+            return std::make_unique<true_type_font>(path, std::move(*record));
+        }
+
+        auto r = std::make_unique<true_type_font>(path);
+        _font_index->insert(path, *stamp, r->index_record());
+        return r;
+    }
+
     [[nodiscard]] std::vector<hi::font_id> make_fallback_chain(font_weight weight, font_style style) noexcept
     {
         auto r = _fallback_chain;
@@ -272,6 +361,16 @@ private:
         std::erase(r, std::nullopt);
         return r;
     }
+
+    [[nodiscard]] static std::shared_ptr<font_fallback_map const>
+    make_fallback_map(std::vector<hi::font_id> const& fallback_chain)
+    {
+        auto r = std::make_shared<font_fallback_map>();
+        for (auto const& font : fallback_chain) {
+            r->add(font, font->char_map);
+        }
+        return r;
+    }
 };
 
 namespace detail {
@@ -18,6 +18,7 @@
 #include <tuple>
 #include <algorithm>
 #include <string>
+#include <utility>
 
 hi_export_module(hikogui.font.font_char_map);
 
@@ -79,6 +80,44 @@ public:
         return r;
     }
 
+    /** Get the ranges of code-points supported by the char-map.
+     *
+     * @pre `prepare()` must have been called.
+     * @return A sorted list of non-adjacent inclusive ranges of code-points.
+     */
+    [[nodiscard]] std::vector<std::pair<char32_t, char32_t>> ranges() const noexcept
+    {
+#ifndef NDEBUG
+        hi_assert(_prepared);
+#endif
+
+        auto r = std::vector<std::pair<char32_t, char32_t>>{};
+        for (auto const& entry : _map) {
+            if (not r.empty() and r.back().second + 1 == entry.start_code_point()) {
+                r.back().second = entry.end_code_point;
+            } else {
+                r.emplace_back(entry.start_code_point(), entry.end_code_point);
+            }
+        }
+        return r;
+    }
+
+    /** Get the ranges of code-points together with their first glyph.
+     *
+     * Adding each range to an empty char-map, followed by `prepare()`, recreates this char-map.
+     *
+     * @return A list of (start code-point, end code-point (inclusive), start glyph) tuples.
+     */
+    [[nodiscard]] std::vector<std::tuple<char32_t, char32_t, uint16_t>> glyph_ranges() const noexcept
+    {
+        auto r = std::vector<std::tuple<char32_t, char32_t, uint16_t>>{};
+        r.reserve(_map.size());
+        for (auto const& entry : _map) {
+            r.emplace_back(entry.start_code_point(), entry.end_code_point, entry.start_glyph);
+        }
+        return r;
+    }
+
     /** Add a range of code points.
      *
      * @param start_code_point The starting code-point of the range.
@@ -35,4 +35,23 @@ TEST_CASE(add_and_search)
     REQUIRE(cm.find(U'9') == 209);
 }
 
+TEST_CASE(ranges)
+{
+    auto cm = hi::font_char_map{};
+
+    cm.add(U'a', U'z', 100);
+    cm.add(U'0', U'3', 200);
+    // Adjacent ranges with non-consecutive glyphs are still a single range of code-points.
+    cm.add(U'4', U'4', 300);
+    cm.add(U'8', U'9', 208);
+
+    cm.prepare();
+
+    auto const ranges = cm.ranges();
+    REQUIRE(ranges.size() == 3);
+    REQUIRE(ranges[0] == std::pair{U'0', U'4'});
+    REQUIRE(ranges[1] == std::pair{U'8', U'9'});
+    REQUIRE(ranges[2] == std::pair{U'a', U'z'});
+}
+
 };
@@ -0,0 +1,157 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file font/font_fallback_map.hpp Defines the font_fallback_map type.
+ * @ingroup font
+ */
+
+#pragma once
+
+#include "font_id.hpp"
+#include "font_char_map.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+hi_export_module(hikogui.font.font_fallback_map);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A map from a code-point to the first font of a fallback chain that supports it.
+ *
+ * Finding the font for a code-point is a single binary search, instead of
+ * searching the character map of each font in the fallback chain.
+ *
+ * @ingroup font
+ */
+hi_export class font_fallback_map {
+public:
+    constexpr font_fallback_map() noexcept = default;
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _entries.empty();
+    }
+
+    /** The number of ranges of code-points in the map.
+     */
+    [[nodiscard]] constexpr size_t size() const noexcept
+    {
+        return _entries.size();
+    }
+
+    /** Add the code-points of the next font in the fallback chain.
+     *
+     * Only the code-points that are not already supported by a previous font are added.
+     *
+     * @param font The font to add.
+     * @param char_map The character map of the font.
+     */
+    void add(font_id font, font_char_map const& char_map)
+    {
+        auto ranges = std::vector<entry_type>{};
+        for (auto const& [first, last] : char_map.ranges()) {
+            ranges.emplace_back(first, last, font);
+        }
+        add(ranges);
+    }
+
+    /** Add the code-points of the fonts of another fallback map.
+     *
+     * Only the code-points that are not already supported by a previous font are added.
+     *
+     * @param other The fallback map with fonts to add after the current fonts.
+     */
+    void add(font_fallback_map const& other)
+    {
+        add(other._entries);
+    }
+
+    /** Find the first font that supports a code-point.
+     *
+     * @param code_point The code-point to find.
+     * @return The font that supports the code-point, or an empty font_id if no font supports it.
+     */
+    [[nodiscard]] font_id find(char32_t code_point) const noexcept
+    {
+        auto const it = std::lower_bound(_entries.begin(), _entries.end(), code_point, [](auto const& entry, char32_t cp) {
+            return entry.last < cp;
+        });
+
+        if (it != _entries.end() and it->first <= code_point) {
+            return it->font;
+        }
+        return {};
+    }
+
+private:
+    struct entry_type {
+        char32_t first;
+        char32_t last;
+        font_id font;
+    };
+
+    /** Sorted non-overlapping inclusive ranges of code-points.
+     */
+    std::vector<entry_type> _entries;
+
+    /** Fill the gaps in the map with the given ranges.
+     *
+     * @param ranges Sorted non-overlapping ranges of code-points.
+     */
+    void add(std::vector<entry_type> const& ranges)
+    {
+        auto r = std::vector<entry_type>{};
+        r.reserve(_entries.size() + ranges.size());
+
+        auto const push = [&](char32_t first, char32_t last, font_id font) {
+            if (not r.empty() and r.back().font == font and r.back().last + 1 == first) {
+                r.back().last = last;
+            } else {
+                r.emplace_back(first, last, font);
+            }
+        };
+
+        auto it = _entries.begin();
+        for (auto const& range : ranges) {
+            // Copy the current entries before this range.
+            for (; it != _entries.end() and it->last < range.first; ++it) {
+                push(it->first, it->last, it->font);
+            }
+
+            // The first code-point of the range which is not yet added.
+            auto first = range.first;
+            if (not r.empty() and r.back().last >= first) {
+                first = char_cast<char32_t>(r.back().last + 1);
+            }
+
+            while (first <= range.last) {
+                if (it != _entries.end() and it->first <= first) {
+                    // The current entry supports this part of the range.
+                    push(it->first, it->last, it->font);
+                    first = char_cast<char32_t>(it->last + 1);
+                    ++it;
+
+                } else {
+                    // Fill the gap before the next current entry.
+                    auto const last =
+                        it != _entries.end() ? std::min(range.last, char_cast<char32_t>(it->first - 1)) : range.last;
+                    push(first, last, range.font);
+                    first = char_cast<char32_t>(last + 1);
+                }
+            }
+        }
+
+        // Copy the current entries after the last range.
+        for (; it != _entries.end(); ++it) {
+            push(it->first, it->last, it->font);
+        }
+
+        _entries = std::move(r);
+    }
+};
+
+}} // namespace hi::v1
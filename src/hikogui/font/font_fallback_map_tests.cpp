@@ -0,0 +1,64 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "font_fallback_map.hpp"
+#include <hikotest/hikotest.hpp>
+
+TEST_SUITE(font_fallback_map) {
+
+TEST_CASE(first_font_wins)
+{
+    auto latin = hi::font_char_map{};
+    latin.add(U'a', U'z', 100);
+    latin.prepare();
+
+    auto digits = hi::font_char_map{};
+    digits.add(U'0', U'9', 10);
+    digits.add(U'x', U'z', 20);
+    digits.prepare();
+
+    auto map = hi::font_fallback_map{};
+    map.add(hi::font_id{1}, latin);
+    map.add(hi::font_id{2}, digits);
+
+    REQUIRE(map.find(U'a') == hi::font_id{1});
+    REQUIRE(map.find(U'z') == hi::font_id{1});
+    REQUIRE(map.find(U'0') == hi::font_id{2});
+    REQUIRE(map.find(U'9') == hi::font_id{2});
+    REQUIRE(map.find(U'!').empty());
+    REQUIRE(map.find(U'A').empty());
+}
+
+TEST_CASE(fill_gaps)
+{
+    auto sparse = hi::font_char_map{};
+    sparse.add(U'b', U'c', 100);
+    sparse.add(U'x', U'x', 200);
+    sparse.prepare();
+
+    auto full = hi::font_char_map{};
+    full.add(U'a', U'z', 10);
+    full.prepare();
+
+    auto tail = hi::font_fallback_map{};
+    tail.add(hi::font_id{2}, full);
+
+    auto map = hi::font_fallback_map{};
+    map.add(hi::font_id{1}, sparse);
+    map.add(tail);
+
+    REQUIRE(map.find(U'a') == hi::font_id{2});
+    REQUIRE(map.find(U'b') == hi::font_id{1});
+    REQUIRE(map.find(U'c') == hi::font_id{1});
+    REQUIRE(map.find(U'd') == hi::font_id{2});
+    REQUIRE(map.find(U'w') == hi::font_id{2});
+    REQUIRE(map.find(U'x') == hi::font_id{1});
+    REQUIRE(map.find(U'y') == hi::font_id{2});
+    REQUIRE(map.find(U'z') == hi::font_id{2});
+
+    // b-c, x and the gaps a, d-w, y-z.
+    REQUIRE(map.size() == 5);
+}
+
+};
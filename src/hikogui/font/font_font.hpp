@@ -10,15 +10,22 @@
 #include "font_variant.hpp"
 #include "font_metrics.hpp"
 #include "font_char_map.hpp"
+#include "font_fallback_map.hpp"
 #include "font_id.hpp"
 #include "../unicode/unicode.hpp"
 #include "../i18n/i18n.hpp"
 #include "../graphic_path/graphic_path.hpp"
+#include "../image/image.hpp"
+#include "../color/color.hpp"
+#include "../telemetry/telemetry.hpp"
 #include "../utility/utility.hpp"
 #include "../container/container.hpp"
 #include <span>
+#include <array>
+#include <memory>
 #include <vector>
 #include <map>
+#include <optional>
 #include <string>
 
 hi_export_module(hikogui.font : font);
@@ -29,7 +36,7 @@ hi_export namespace hi::inline v1 {
  * This class has information on how to shape text and
  * get glyphs consisting of bezier contours.
  */
-hi_export class font {
+hi_export class font : public tracked_allocated<"font_book"> {
 public:
     /** The family name as parsed from the font file.
      *
@@ -69,6 +76,19 @@ public:
      */
     std::vector<hi::font_id> fallback_chain;
 
+    /** The first font in the `fallback_chain` that supports each code-point.
+     *
+     * Fonts with the same fallback chain share the same map.
+     */
+    std::shared_ptr<font_fallback_map const> fallback_map;
+
+    /** A hash of the font file.
+     *
+     * Used as a key for caches that persist between runs of the application.
+     * Zero when the font does not have a file.
+     */
+    uint64_t file_hash = 0;
+
     font() = default;
     virtual ~font() = default;
     font(font const&) = delete;
@@ -151,6 +171,91 @@ public:
      */
     [[nodiscard]] virtual glyph_metrics get_metrics(hi::glyph_id glyph_id) const = 0;
 
+    /** A layer of a color glyph.
+     */
+    struct color_layer_type {
+        /** The glyph with the outline of this layer.
+         */
+        hi::glyph_id glyph;
+
+        /** The color of this layer, ignored when `foreground` is set.
+         */
+        hi::color color;
+
+        /** The layer is painted in the color of the text.
+         */
+        bool foreground = false;
+
+        /** The bounding rectangle of the layer's glyph, in em-units.
+         */
+        aarectangle bounding_rectangle;
+    };
+
+    /** Get the layers of a color glyph.
+     *
+     * Each layer is an ordinary glyph of the font, so that it can be rendered
+     * through the glyph atlas like any other glyph.
+     *
+     * @param glyph_id The id of a glyph inside the font.
+     * @return The layers painted bottom to top, or empty if this is not a color glyph.
+     *         The layers remain valid for the lifetime of the font.
+     */
+    [[nodiscard]] virtual std::span<color_layer_type const> get_color_layers(hi::glyph_id glyph_id) const
+    {
+        return {};
+    }
+
+    /** Get a color glyph as a path with a layer for each color.
+     *
+     * @param glyph_id The id of a glyph inside the font.
+     * @param foreground_color The color of the layers that are painted in the text color.
+     * @return The layered path of a color glyph, or the ordinary path of any other glyph.
+     */
+    [[nodiscard]] graphic_path get_color_path(hi::glyph_id glyph_id, hi::color foreground_color) const
+    {
+        auto const layers = get_color_layers(glyph_id);
+        if (layers.empty()) {
+            return get_path(glyph_id);
+        }
+
+        auto r = graphic_path{};
+        for (auto const& layer : layers) {
+            r += get_path(layer.glyph);
+            r.closeLayer(layer.foreground ? foreground_color : layer.color);
+        }
+        return r;
+    }
+
+    /** A bitmap image of a glyph.
+     */
+    struct bitmap_type {
+        pixmap<sfloat_rgba16> image;
+
+        /** The rectangle to draw the image in, in em-units relative to the glyph origin.
+         */
+        aarectangle bounding_rectangle;
+    };
+
+    /** Get the bitmap image of a glyph, for fonts with emoji bitmaps.
+     *
+     * @param glyph_id The id of a glyph inside the font.
+     * @return The decoded image of the glyph, or empty if the glyph has no bitmap.
+     * @throws std::exception If there was an error while decoding the image.
+     */
+    [[nodiscard]] virtual std::optional<bitmap_type> get_bitmap(hi::glyph_id glyph_id) const
+    {
+        return std::nullopt;
+    }
+
+    /** Check if the font has bitmap images for some of its glyphs.
+     *
+     * This is a quick check that is done before `get_bitmap()` is called while drawing.
+     */
+    [[nodiscard]] virtual bool has_bitmaps() const noexcept
+    {
+        return false;
+    }
+
     struct shape_run_result_type {
         /** The horizontal advance of each grapheme.
          */
@@ -180,6 +285,12 @@ public:
          */
         std::vector<aarectangle> glyph_rectangles;
 
+        /** For each grapheme, if its glyphs were substituted by glyph-morphing.
+         *
+         * This is empty when no glyphs in the run were substituted.
+         */
+        std::vector<bool> morphed;
+
         void reserve(size_t count) noexcept
         {
             advances.reserve(count);
@@ -229,14 +340,48 @@ public:
      */
     [[nodiscard]] virtual shape_run_result_type shape_run(iso_639 language, iso_15924 script, gstring run) const = 0;
 
-    glyph_atlas_info& atlas_info(glyph_id glyph) const
+    /** The maximum number of glyph atlases, one for each graphics device.
+     */
+    constexpr static std::size_t max_num_atlases = 4;
+
+    /** The location of a glyph in a glyph atlas.
+     *
+     * The table grows on lookup, which invalidates earlier references. The caller must
+     * hold the lock of the atlas exclusively for as long as it uses the reference.
+     *
+     * @param glyph The glyph in this font.
+     * @param atlas_index The index of the atlas, each graphics device has its own atlas.
+     * @return A reference to the location of the glyph, empty when the glyph is not in the atlas.
+     */
+    glyph_atlas_info& atlas_info(glyph_id glyph, std::size_t atlas_index = 0) const
     {
-        if (*glyph >= _glyph_atlas_table.size()) [[unlikely]] {
-            _glyph_atlas_table.resize(*glyph + 1);
+        hi_axiom_bounds(atlas_index, _glyph_atlas_tables);
+        auto& table = _glyph_atlas_tables[atlas_index];
+        if (*glyph >= table.size()) [[unlikely]] {
+            table.resize(*glyph + 1);
         }
 
-        hi_axiom_bounds(*glyph, _glyph_atlas_table);
-        return _glyph_atlas_table[*glyph];
+        hi_axiom_bounds(*glyph, table);
+        return table[*glyph];
+    }
+
+    /** Find the location of a glyph in a glyph atlas.
+     *
+     * Unlike `atlas_info()` the table is not modified, so that glyphs can be
+     * looked up by several threads that hold the lock of the atlas shared.
+     *
+     * @param glyph The glyph in this font.
+     * @param atlas_index The index of the atlas, each graphics device has its own atlas.
+     * @return The location of the glyph, empty when the glyph is not in the atlas.
+     */
+    [[nodiscard]] glyph_atlas_info find_atlas_info(glyph_id glyph, std::size_t atlas_index = 0) const noexcept
+    {
+        hi_axiom_bounds(atlas_index, _glyph_atlas_tables);
+        auto const& table = _glyph_atlas_tables[atlas_index];
+        if (*glyph >= table.size()) [[unlikely]] {
+            return {};
+        }
+        return table[*glyph];
     }
 
     [[nodiscard]] font_variant font_variant() const noexcept
@@ -260,7 +405,7 @@ public:
     }
 
 private:
-    mutable std::vector<glyph_atlas_info> _glyph_atlas_table;
+    mutable std::array<std::vector<glyph_atlas_info>, max_num_atlases> _glyph_atlas_tables;
 };
 
 } // namespace hi::inline v1
@@ -0,0 +1,486 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file font/font_index_cache.hpp Defines the font_index_cache type.
+ * @ingroup font
+ */
+
+#pragma once
+
+#include "font_char_map.hpp"
+#include "font_metrics.hpp"
+#include "font_weight.hpp"
+#include "font_style.hpp"
+#include "../file/file.hpp"
+#include "../container/container.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include <system_error>
+
+hi_export_module(hikogui.font.font_index_cache);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** The properties of a font file that are needed to register the font.
+ *
+ * @ingroup font
+ */
+struct font_index_record {
+    std::string family_name;
+    std::string sub_family_name;
+    std::string features;
+
+    font_weight weight = font_weight::regular;
+    font_style style = font_style::normal;
+    bool condensed = false;
+    bool serif = false;
+    bool monospace = false;
+
+    font_metrics_em metrics;
+    font_char_map char_map;
+    uint64_t file_hash = 0;
+
+    float em_scale = 0.0f;
+    float OS2_x_height = 0.0f;
+    float OS2_cap_height = 0.0f;
+    uint32_t num_glyphs = 0;
+    uint16_t num_horizontal_metrics = 0;
+    bool loca_is_offset32 = false;
+};
+
+/** A persistent index of the properties of font files.
+ *
+ * Registering a font requires parsing several tables of the font file. The
+ * index stores the result, so that on the next run of the application the fonts
+ * can be registered without opening the font files; a font file is only mapped
+ * when its glyphs are needed.
+ *
+ * Each font file is identified by its path, size and last write time. When the
+ * file has changed the record in the index is ignored and replaced.
+ *
+ * The index file is memory mapped when it is opened, records are decoded
+ * when they are found. Records that are added to the index are kept in memory
+ * until `save()` writes a new index file.
+ *
+ * @ingroup font
+ */
+class font_index_cache {
+public:
+    /** The identity of a version of a font file.
+     */
+    struct stamp_type {
+        uint64_t file_size = 0;
+        int64_t last_write_time = 0;
+
+        [[nodiscard]] constexpr friend bool operator==(stamp_type const&, stamp_type const&) noexcept = default;
+    };
+
+    font_index_cache() noexcept = default;
+    font_index_cache(font_index_cache const&) = delete;
+    font_index_cache(font_index_cache&&) = delete;
+    font_index_cache& operator=(font_index_cache const&) = delete;
+    font_index_cache& operator=(font_index_cache&&) = delete;
+
+    /** Open a font index.
+     *
+     * @param path The path to the index file, the file does not need to exist.
+     */
+    explicit font_index_cache(std::filesystem::path path) noexcept : _path(std::move(path))
+    {
+        load();
+    }
+
+    /** Get the stamp of a font file.
+     *
+     * @param font_path The path to the font file.
+     * @return The stamp, or empty when the file can not be examined.
+     */
+    [[nodiscard]] static std::optional<stamp_type> get_stamp(std::filesystem::path const& font_path) noexcept
+    {
+        auto ec = std::error_code{};
+        auto const file_size = std::filesystem::file_size(font_path, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+        auto const last_write_time = std::filesystem::last_write_time(font_path, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+        return stamp_type{narrow_cast<uint64_t>(file_size), narrow_cast<int64_t>(last_write_time.time_since_epoch().count())};
+    }
+
+    /** Find the record of a font file.
+     *
+     * @param font_path The path to the font file.
+     * @param stamp The stamp of the font file.
+     * @return The record, or empty when the font file is not in the index or has changed.
+     */
+    [[nodiscard]] std::optional<font_index_record> find(std::filesystem::path const& font_path, stamp_type stamp) const noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+
+        if (auto const it = _new_records.find(font_path); it != _new_records.end()) {
+            if (it->second.first == stamp) {
+                ++global_counter<"font_index_cache:hit">;
+                return it->second.second;
+            }
+
+        } else if (auto const it = _entries.find(font_path); it != _entries.end()) {
+            auto const& entry = *it->second;
+            if (stamp_type{entry.file_size, entry.last_write_time} == stamp) {
+                ++global_counter<"font_index_cache:hit">;
+                return decode(entry);
+            }
+        }
+
+        ++global_counter<"font_index_cache:miss">;
+        return std::nullopt;
+    }
+
+    /** Add the record of a font file to the index.
+     *
+     * A record of a previous version of the font file is replaced.
+     *
+     * @param font_path The path to the font file.
+     * @param stamp The stamp of the font file.
+     * @param record The properties of the font.
+     */
+    void insert(std::filesystem::path const& font_path, stamp_type stamp, font_index_record record) noexcept
+    {
+        if (_path.empty()) {
+            return;
+        }
+
+        auto const lock = std::scoped_lock(_mutex);
+        _new_records.insert_or_assign(font_path, std::pair{stamp, std::move(record)});
+    }
+
+    /** Write the index file when records where added.
+     *
+     * Records of font files that no longer exist are removed from the index.
+     */
+    void save() noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+
+        if (_new_records.empty()) {
+            return;
+        }
+
+        auto records = std::map<std::filesystem::path, std::pair<stamp_type, font_index_record>>{};
+        for (auto const& [font_path, entry] : _entries) {
+            auto ec = std::error_code{};
+            if (not _new_records.contains(font_path) and std::filesystem::exists(font_path, ec)) {
+                records.emplace(font_path, std::pair{stamp_type{entry->file_size, entry->last_write_time}, decode(*entry)});
+            }
+        }
+        records.merge(_new_records);
+
+        auto header = header_type{};
+        std::memcpy(header.magic, magic, sizeof(header.magic));
+        header.version = version;
+        header.num_entries = narrow_cast<uint32_t>(records.size());
+
+        auto entries = std::vector<entry_type>{};
+        entries.reserve(records.size());
+        auto ranges = std::vector<range_type>{};
+        auto strings = bstring{};
+
+        // The strings are stored after the entries and the ranges, so their offsets are fixed up afterwards.
+        auto const add_string = [&strings](void const *data, std::size_t data_size, uint32_t& offset, uint32_t& size) {
+            offset = narrow_cast<uint32_t>(strings.size());
+            size = narrow_cast<uint32_t>(data_size);
+            strings.append(static_cast<std::byte const *>(data), data_size);
+        };
+
+        for (auto const& [font_path, item] : records) {
+            auto const& [stamp, record] = item;
+
+            auto entry = entry_type{};
+            entry.file_size = stamp.file_size;
+            entry.last_write_time = stamp.last_write_time;
+            entry.file_hash = record.file_hash;
+
+            auto const path_str = font_path.u8string();
+            add_string(path_str.data(), path_str.size(), entry.path_offset, entry.path_size);
+            add_string(record.family_name.data(), record.family_name.size(), entry.family_name_offset, entry.family_name_size);
+            add_string(
+                record.sub_family_name.data(),
+                record.sub_family_name.size(),
+                entry.sub_family_name_offset,
+                entry.sub_family_name_size);
+            add_string(record.features.data(), record.features.size(), entry.features_offset, entry.features_size);
+
+            entry.ranges_offset = narrow_cast<uint32_t>(ranges.size());
+            for (auto const [start_code_point, end_code_point, start_glyph] : record.char_map.glyph_ranges()) {
+                ranges.emplace_back(char_cast<uint32_t>(start_code_point), char_cast<uint32_t>(end_code_point), start_glyph);
+            }
+            entry.num_ranges = narrow_cast<uint32_t>(ranges.size() - entry.ranges_offset);
+
+            entry.em_scale = record.em_scale;
+            entry.OS2_x_height = record.OS2_x_height;
+            entry.OS2_cap_height = record.OS2_cap_height;
+            entry.ascender = record.metrics.ascender.in(unit::em_squares);
+            entry.descender = record.metrics.descender.in(unit::em_squares);
+            entry.line_gap = record.metrics.line_gap.in(unit::em_squares);
+            entry.cap_height = record.metrics.cap_height.in(unit::em_squares);
+            entry.x_height = record.metrics.x_height.in(unit::em_squares);
+            entry.digit_advance = record.metrics.digit_advance.in(unit::em_squares);
+            entry.num_glyphs = record.num_glyphs;
+            entry.num_horizontal_metrics = record.num_horizontal_metrics;
+            entry.weight = narrow_cast<uint8_t>(std::to_underlying(record.weight));
+            entry.style = narrow_cast<uint8_t>(std::to_underlying(record.style));
+            entry.flags = (record.loca_is_offset32 ? flag_loca_is_offset32 : 0) | (record.condensed ? flag_condensed : 0) |
+                (record.serif ? flag_serif : 0) | (record.monospace ? flag_monospace : 0);
+            entries.push_back(entry);
+        }
+
+        auto const ranges_offset = sizeof(header_type) + entries.size() * sizeof(entry_type);
+        auto const strings_offset = ranges_offset + ranges.size() * sizeof(range_type);
+        for (auto& entry : entries) {
+            entry.ranges_offset = narrow_cast<uint32_t>(ranges_offset + entry.ranges_offset * sizeof(range_type));
+            entry.path_offset += narrow_cast<uint32_t>(strings_offset);
+            entry.family_name_offset += narrow_cast<uint32_t>(strings_offset);
+            entry.sub_family_name_offset += narrow_cast<uint32_t>(strings_offset);
+            entry.features_offset += narrow_cast<uint32_t>(strings_offset);
+        }
+
+        // The file that is being replaced must not be mapped.
+        _entries.clear();
+        _new_records.clear();
+        _view = {};
+
+        try {
+            auto tmp_path = _path;
+            tmp_path += ".tmp";
+
+            auto file = hi::file(tmp_path, access_mode::truncate_or_create_for_write | access_mode::rename);
+            file.write(&header, sizeof(header));
+            file.write(entries.data(), entries.size() * sizeof(entry_type));
+            file.write(ranges.data(), ranges.size() * sizeof(range_type));
+            file.write(strings);
+            file.flush();
+            file.rename(_path, true);
+            hi_log_info("Saved {} fonts to font index {}", entries.size(), _path.string());
+
+        } catch (io_error const& e) {
+            hi_log_error("Could not save font index to file. \"{}\"", e.what());
+        }
+
+        load();
+    }
+
+private:
+    constexpr static char magic[8] = {'h', 'i', 'f', 'o', 'n', 't', 'i', 'x'};
+    constexpr static uint32_t version = 1;
+
+    constexpr static uint8_t flag_loca_is_offset32 = 1;
+    constexpr static uint8_t flag_condensed = 2;
+    constexpr static uint8_t flag_serif = 4;
+    constexpr static uint8_t flag_monospace = 8;
+
+    struct header_type {
+        char magic[8];
+        uint32_t version;
+        uint32_t num_entries;
+    };
+
+    /** A font file in the index.
+     *
+     * The offsets of the ranges and strings are in bytes from the start of the file.
+     */
+    struct entry_type {
+        uint64_t file_size;
+        int64_t last_write_time;
+        uint64_t file_hash;
+        uint32_t path_offset;
+        uint32_t path_size;
+        uint32_t family_name_offset;
+        uint32_t family_name_size;
+        uint32_t sub_family_name_offset;
+        uint32_t sub_family_name_size;
+        uint32_t features_offset;
+        uint32_t features_size;
+        uint32_t ranges_offset;
+        uint32_t num_ranges;
+        float em_scale;
+        float OS2_x_height;
+        float OS2_cap_height;
+        float ascender;
+        float descender;
+        float line_gap;
+        float cap_height;
+        float x_height;
+        float digit_advance;
+        uint32_t num_glyphs;
+        uint16_t num_horizontal_metrics;
+        uint8_t weight;
+        uint8_t style;
+        uint8_t flags;
+        uint8_t reserved[7] = {};
+    };
+
+    /** A range of code-points of the character map of a font.
+     */
+    struct range_type {
+        uint32_t start_code_point;
+        uint32_t end_code_point;
+        uint16_t start_glyph;
+        uint16_t reserved = 0;
+    };
+
+    static_assert(std::is_trivially_copyable_v<header_type>);
+    static_assert(std::is_trivially_copyable_v<entry_type>);
+    static_assert(std::is_trivially_copyable_v<range_type>);
+
+    std::filesystem::path _path = {};
+
+    mutable std::mutex _mutex;
+    file_view _view = {};
+
+    /** The entries in the mapped index file.
+     */
+    std::map<std::filesystem::path, entry_type const *> _entries;
+
+    /** The records added since the index file was mapped.
+     */
+    std::map<std::filesystem::path, std::pair<stamp_type, font_index_record>> _new_records;
+
+    [[nodiscard]] std::span<std::byte const> bytes() const noexcept
+    {
+        return as_span<std::byte const>(_view);
+    }
+
+    [[nodiscard]] std::string decode_string(uint32_t offset, uint32_t size) const noexcept
+    {
+        return std::string{reinterpret_cast<char const *>(bytes().data() + offset), size};
+    }
+
+    [[nodiscard]] font_index_record decode(entry_type const& entry) const noexcept
+    {
+        auto r = font_index_record{};
+        r.family_name = decode_string(entry.family_name_offset, entry.family_name_size);
+        r.sub_family_name = decode_string(entry.sub_family_name_offset, entry.sub_family_name_size);
+        r.features = decode_string(entry.features_offset, entry.features_size);
+        r.weight = static_cast<font_weight>(entry.weight);
+        r.style = static_cast<font_style>(entry.style);
+        r.condensed = to_bool(entry.flags & flag_condensed);
+        r.serif = to_bool(entry.flags & flag_serif);
+        r.monospace = to_bool(entry.flags & flag_monospace);
+        r.loca_is_offset32 = to_bool(entry.flags & flag_loca_is_offset32);
+        r.metrics.ascender = unit::em_squares(entry.ascender);
+        r.metrics.descender = unit::em_squares(entry.descender);
+        r.metrics.line_gap = unit::em_squares(entry.line_gap);
+        r.metrics.cap_height = unit::em_squares(entry.cap_height);
+        r.metrics.x_height = unit::em_squares(entry.x_height);
+        r.metrics.digit_advance = unit::em_squares(entry.digit_advance);
+        r.file_hash = entry.file_hash;
+        r.em_scale = entry.em_scale;
+        r.OS2_x_height = entry.OS2_x_height;
+        r.OS2_cap_height = entry.OS2_cap_height;
+        r.num_glyphs = entry.num_glyphs;
+        r.num_horizontal_metrics = entry.num_horizontal_metrics;
+
+        auto const *ranges = reinterpret_cast<range_type const *>(bytes().data() + entry.ranges_offset);
+        r.char_map.reserve(entry.num_ranges);
+        for (auto i = 0_uz; i != entry.num_ranges; ++i) {
+            auto const& range = ranges[i];
+            if (range.start_code_point > range.end_code_point or range.end_code_point > 0x10'ffff or
+                range.start_glyph + (range.end_code_point - range.start_code_point) >= 0xfffe) {
+                // Ignore corrupt ranges, the char-map would not be able to represent them.
+                continue;
+            }
+            r.char_map.add(
+                char_cast<char32_t>(range.start_code_point), char_cast<char32_t>(range.end_code_point), range.start_glyph);
+        }
+        r.char_map.prepare();
+        return r;
+    }
+
+    [[nodiscard]] static bool in_bounds(std::size_t offset, std::size_t size, std::size_t total_size) noexcept
+    {
+        return offset <= total_size and size <= total_size - offset;
+    }
+
+    [[nodiscard]] static bool valid_entry(entry_type const& entry, std::size_t total_size) noexcept
+    {
+        // clang-format off
+        return
+            in_bounds(entry.path_offset, entry.path_size, total_size) and
+            in_bounds(entry.family_name_offset, entry.family_name_size, total_size) and
+            in_bounds(entry.sub_family_name_offset, entry.sub_family_name_size, total_size) and
+            in_bounds(entry.features_offset, entry.features_size, total_size) and
+            in_bounds(entry.ranges_offset, std::size_t{entry.num_ranges} * sizeof(range_type), total_size) and
+            entry.ranges_offset % alignof(range_type) == 0 and
+            entry.weight <= std::to_underlying(font_weight::extra_black) and
+            entry.style <= std::to_underlying(font_style::italic);
+        // clang-format on
+    }
+
+    void load() noexcept
+    {
+        _entries.clear();
+
+        auto ec = std::error_code{};
+        if (_path.empty() or not std::filesystem::exists(_path, ec)) {
+            return;
+        }
+
+        try {
+            _view = file_view{_path};
+        } catch (io_error const& e) {
+            hi_log_warning("Could not open font index file. \"{}\"", e.what());
+            return;
+        }
+
+        auto const bytes = this->bytes();
+        if (bytes.size() < sizeof(header_type)) {
+            hi_log_warning("Font index {} is too small.", _path.string());
+            _view = {};
+            return;
+        }
+
+        auto const& header = *reinterpret_cast<header_type const *>(bytes.data());
+        if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 or header.version != version) {
+            hi_log_warning("Font index {} has an unknown format.", _path.string());
+            _view = {};
+            return;
+        }
+
+        if (sizeof(header_type) + std::size_t{header.num_entries} * sizeof(entry_type) > bytes.size()) {
+            hi_log_warning("Font index {} is truncated.", _path.string());
+            _view = {};
+            return;
+        }
+
+        auto const *entries = reinterpret_cast<entry_type const *>(bytes.data() + sizeof(header_type));
+        for (auto i = 0_uz; i != header.num_entries; ++i) {
+            auto const& entry = entries[i];
+            if (not valid_entry(entry, bytes.size())) {
+                hi_log_warning("Font index {} is corrupt.", _path.string());
+                _entries.clear();
+                _view = {};
+                return;
+            }
+
+            auto const *path_ptr = reinterpret_cast<char8_t const *>(bytes.data() + entry.path_offset);
+            _entries[std::filesystem::path{std::u8string{path_ptr, entry.path_size}}] = &entry;
+        }
+
+        hi_log_info("Loaded {} fonts from font index {}", _entries.size(), _path.string());
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,75 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "font_index_cache.hpp"
+#include <hikotest/hikotest.hpp>
+#include <filesystem>
+
+TEST_SUITE(font_index_cache_suite) {
+
+TEST_CASE(save_and_load)
+{
+    auto const path = std::filesystem::temp_directory_path() / "hikogui_font_index_cache_tests.bin";
+    auto const font_path = std::filesystem::path{"fonts"} / "NotoSans-Regular.ttf";
+    auto const stamp = hi::font_index_cache::stamp_type{12345, 678};
+    std::filesystem::remove(path);
+
+    auto record = hi::font_index_record{};
+    record.family_name = "Noto Sans";
+    record.sub_family_name = "Regular";
+    record.features = "kern,GSUB,";
+    record.weight = hi::font_weight::bold;
+    record.style = hi::font_style::italic;
+    record.serif = true;
+    record.metrics.ascender = hi::unit::em_squares(0.75f);
+    record.metrics.digit_advance = hi::unit::em_squares(0.5f);
+    record.char_map.add(U'a', U'z', 100);
+    record.char_map.add(U'0', U'9', 200);
+    record.char_map.prepare();
+    record.file_hash = 42;
+    record.em_scale = 1.0f / 2048.0f;
+    record.num_glyphs = 300;
+    record.num_horizontal_metrics = 250;
+    record.loca_is_offset32 = true;
+
+    {
+        auto cache = hi::font_index_cache(path);
+        REQUIRE(not cache.find(font_path, stamp));
+        cache.insert(font_path, stamp, record);
+        REQUIRE(cache.find(font_path, stamp));
+        cache.save();
+    }
+
+    {
+        auto const cache = hi::font_index_cache(path);
+        auto const found = cache.find(font_path, stamp);
+        REQUIRE(found.has_value());
+        REQUIRE(found->family_name == "Noto Sans");
+        REQUIRE(found->sub_family_name == "Regular");
+        REQUIRE(found->features == "kern,GSUB,");
+        REQUIRE(found->weight == hi::font_weight::bold);
+        REQUIRE(found->style == hi::font_style::italic);
+        REQUIRE(found->serif);
+        REQUIRE(not found->condensed);
+        REQUIRE(not found->monospace);
+        REQUIRE(found->metrics == record.metrics);
+        REQUIRE(found->char_map.count() == record.char_map.count());
+        REQUIRE(found->char_map.find(U'c') == 102);
+        REQUIRE(found->char_map.find(U'9') == 209);
+        REQUIRE(found->char_map.find(U'A').empty());
+        REQUIRE(found->file_hash == 42);
+        REQUIRE(found->em_scale == 1.0f / 2048.0f);
+        REQUIRE(found->num_glyphs == 300);
+        REQUIRE(found->num_horizontal_metrics == 250);
+        REQUIRE(found->loca_is_offset32);
+
+        // The font file has changed, or is a different font file.
+        REQUIRE(not cache.find(font_path, hi::font_index_cache::stamp_type{12345, 679}));
+        REQUIRE(not cache.find(std::filesystem::path{"fonts"} / "NotoSans-Bold.ttf", stamp));
+    }
+
+    std::filesystem::remove(path);
+}
+
+};
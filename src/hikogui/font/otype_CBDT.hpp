@@ -0,0 +1,203 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "otype_utilities.hpp"
+#include "glyph_id.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <optional>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.font.otype_CBDT);
+
+hi_export namespace hi { inline namespace v1 {
+
+namespace detail {
+
+struct otype_CBDT_small_metrics_type {
+    uint8_t height;
+    uint8_t width;
+    int8_t bearing_x;
+    int8_t bearing_y;
+    uint8_t advance;
+};
+
+struct otype_CBDT_big_metrics_type {
+    uint8_t height;
+    uint8_t width;
+    int8_t hori_bearing_x;
+    int8_t hori_bearing_y;
+    uint8_t hori_advance;
+    int8_t vert_bearing_x;
+    int8_t vert_bearing_y;
+    uint8_t vert_advance;
+};
+
+[[nodiscard]] constexpr aarectangle
+otype_CBDT_rectangle(uint8_t width, uint8_t height, int8_t bearing_x, int8_t bearing_y, float scale) noexcept
+{
+    return aarectangle{bearing_x * scale, (bearing_y - height) * scale, width * scale, height * scale};
+}
+
+} // namespace detail
+
+/** Get a bitmap glyph from the 'CBLC' and 'CBDT' tables.
+ *
+ * The strike with the largest pixels-per-em that contains the glyph is used,
+ * the image is scaled when drawn.
+ *
+ * Only the PNG image-formats 17, 18 and 19 are supported, with the
+ * index sub-table formats 1, 2 and 3.
+ *
+ * @param CBLC_bytes The 'CBLC' table.
+ * @param CBDT_bytes The 'CBDT' table.
+ * @param glyph The glyph to get.
+ * @return The PNG image and bounding rectangle of the glyph, or empty if the glyph has no PNG bitmap.
+ */
+[[nodiscard]] inline std::optional<otype_bitmap_glyph>
+otype_CBDT_get(std::span<std::byte const> CBLC_bytes, std::span<std::byte const> CBDT_bytes, hi::glyph_id glyph)
+{
+    struct header_type {
+        big_uint16_buf_t major_version;
+        big_uint16_buf_t minor_version;
+        big_uint32_buf_t num_sizes;
+    };
+
+    struct bitmap_size_type {
+        big_uint32_buf_t index_sub_table_array_offset;
+        big_uint32_buf_t index_tables_size;
+        big_uint32_buf_t num_index_sub_tables;
+        big_uint32_buf_t color_ref;
+        std::array<uint8_t, 12> hori;
+        std::array<uint8_t, 12> vert;
+        big_uint16_buf_t start_glyph_index;
+        big_uint16_buf_t end_glyph_index;
+        uint8_t ppem_x;
+        uint8_t ppem_y;
+        uint8_t bit_depth;
+        int8_t flags;
+    };
+
+    struct index_sub_table_array_type {
+        big_uint16_buf_t first_glyph_index;
+        big_uint16_buf_t last_glyph_index;
+        big_uint32_buf_t additional_offset_to_index_sub_table;
+    };
+
+    struct index_sub_header_type {
+        big_uint16_buf_t index_format;
+        big_uint16_buf_t image_format;
+        big_uint32_buf_t image_data_offset;
+    };
+
+    auto offset = 0_uz;
+    auto const& header = implicit_cast<header_type>(offset, CBLC_bytes);
+    hi_check(*header.major_version == 3, "'CBLC' table expect major version to be 3.");
+    auto const bitmap_sizes = implicit_cast<bitmap_size_type>(offset, CBLC_bytes, *header.num_sizes);
+
+    bitmap_size_type const *best_size = nullptr;
+    for (auto const& bitmap_size : bitmap_sizes) {
+        if (*glyph >= *bitmap_size.start_glyph_index and *glyph <= *bitmap_size.end_glyph_index and
+            (best_size == nullptr or bitmap_size.ppem_y > best_size->ppem_y)) {
+            best_size = &bitmap_size;
+        }
+    }
+
+    if (best_size == nullptr or best_size->ppem_y == 0) {
+        return std::nullopt;
+    }
+
+    auto const array_bytes = hi_check_subspan(CBLC_bytes, *best_size->index_sub_table_array_offset);
+    offset = 0;
+    auto const index_sub_tables = implicit_cast<index_sub_table_array_type>(offset, array_bytes, *best_size->num_index_sub_tables);
+
+    for (auto const& index_sub_table : index_sub_tables) {
+        auto const first_glyph = *index_sub_table.first_glyph_index;
+        if (*glyph < first_glyph or *glyph > *index_sub_table.last_glyph_index) {
+            continue;
+        }
+
+        auto const i = wide_cast<std::size_t>(*glyph - first_glyph);
+        auto const sub_table_bytes = hi_check_subspan(array_bytes, *index_sub_table.additional_offset_to_index_sub_table);
+        offset = 0;
+        auto const& sub_header = implicit_cast<index_sub_header_type>(offset, sub_table_bytes);
+        auto const image_data_offset = wide_cast<std::size_t>(*sub_header.image_data_offset);
+
+        auto first = 0_uz;
+        auto last = 0_uz;
+        detail::otype_CBDT_big_metrics_type const *index_metrics = nullptr;
+        switch (*sub_header.index_format) {
+        case 1:
+            {
+                auto const offsets = implicit_cast<big_uint32_buf_t>(offset, sub_table_bytes, i + 2);
+                first = image_data_offset + *offsets[i];
+                last = image_data_offset + *offsets[i + 1];
+            }
+            break;
+        case 2:
+            {
+                auto const image_size = wide_cast<std::size_t>(*implicit_cast<big_uint32_buf_t>(offset, sub_table_bytes));
+                index_metrics = &implicit_cast<detail::otype_CBDT_big_metrics_type>(offset, sub_table_bytes);
+                first = image_data_offset + image_size * i;
+                last = first + image_size;
+            }
+            break;
+        case 3:
+            {
+                auto const offsets = implicit_cast<big_uint16_buf_t>(offset, sub_table_bytes, i + 2);
+                first = image_data_offset + *offsets[i];
+                last = image_data_offset + *offsets[i + 1];
+            }
+            break;
+        default:
+            // Formats 4 and 5 are for sparse glyph ranges, which color fonts do not use in practice.
+            return std::nullopt;
+        }
+
+        if (last <= first) {
+            return std::nullopt;
+        }
+
+        auto const glyph_bytes = hi_check_subspan(CBDT_bytes, first, last - first);
+        auto const scale = 1.0f / best_size->ppem_y;
+        offset = 0;
+
+        auto rectangle = aarectangle{};
+        switch (*sub_header.image_format) {
+        case 17:
+            {
+                auto const& m = implicit_cast<detail::otype_CBDT_small_metrics_type>(offset, glyph_bytes);
+                rectangle = detail::otype_CBDT_rectangle(m.width, m.height, m.bearing_x, m.bearing_y, scale);
+            }
+            break;
+        case 18:
+            {
+                auto const& m = implicit_cast<detail::otype_CBDT_big_metrics_type>(offset, glyph_bytes);
+                rectangle = detail::otype_CBDT_rectangle(m.width, m.height, m.hori_bearing_x, m.hori_bearing_y, scale);
+            }
+            break;
+        case 19:
+            {
+                hi_check(index_metrics != nullptr, "'CBDT' image format 19 requires metrics in the 'CBLC' table.");
+                auto const& m = *index_metrics;
+                rectangle = detail::otype_CBDT_rectangle(m.width, m.height, m.hori_bearing_x, m.hori_bearing_y, scale);
+            }
+            break;
+        default:
+            // Only PNG images are supported.
+            return std::nullopt;
+        }
+
+        auto const data_length = wide_cast<std::size_t>(*implicit_cast<big_uint32_buf_t>(offset, glyph_bytes));
+        return otype_bitmap_glyph{hi_check_subspan(glyph_bytes, offset, data_length), rectangle};
+    }
+    return std::nullopt;
+}
+
+}} // namespace hi::v1
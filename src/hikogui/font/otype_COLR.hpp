@@ -0,0 +1,139 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "otype_utilities.hpp"
+#include "glyph_id.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.font.otype_COLR);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A layer of a color glyph.
+ */
+struct otype_COLR_layer {
+    /** The glyph with the outline of the layer.
+     */
+    glyph_id glyph;
+
+    /** The index of the color in the 'CPAL' palette.
+     *
+     * The value 0xffff means that the layer uses the foreground (text) color.
+     */
+    uint16_t palette_index;
+
+    [[nodiscard]] friend bool operator==(otype_COLR_layer const&, otype_COLR_layer const&) noexcept = default;
+};
+
+/** The version 0 'COLR' table, decoded for fast lookup of the layers of a color glyph.
+ *
+ * Version 1 paint-graphs are not supported, the version 0 base-glyphs
+ * of a version 1 table are still decoded.
+ */
+class otype_COLR {
+public:
+    /** The palette-index of a layer which is painted in the foreground color.
+     */
+    constexpr static uint16_t foreground_palette_index = 0xffff;
+
+    constexpr otype_COLR() noexcept = default;
+
+    /** Decode the 'COLR' table.
+     *
+     * @param bytes The 'COLR' table.
+     * @param num_glyphs The number of glyphs in the font.
+     */
+    otype_COLR(std::span<std::byte const> bytes, std::size_t num_glyphs)
+    {
+        struct header_type {
+            big_uint16_buf_t version;
+            big_uint16_buf_t num_base_glyph_records;
+            big_uint32_buf_t base_glyph_records_offset;
+            big_uint32_buf_t layer_records_offset;
+            big_uint16_buf_t num_layer_records;
+        };
+
+        struct base_glyph_record_type {
+            big_uint16_buf_t glyph_id;
+            big_uint16_buf_t first_layer_index;
+            big_uint16_buf_t num_layers;
+        };
+
+        struct layer_record_type {
+            big_uint16_buf_t glyph_id;
+            big_uint16_buf_t palette_index;
+        };
+
+        auto offset = 0_uz;
+        auto const& header = implicit_cast<header_type>(offset, bytes);
+        hi_check(*header.version <= 1, "'COLR' table expect version to be 0 or 1.");
+
+        offset = wide_cast<std::size_t>(*header.layer_records_offset);
+        auto const layer_records = implicit_cast<layer_record_type>(offset, bytes, *header.num_layer_records);
+
+        _layers.reserve(layer_records.size());
+        for (auto const& record : layer_records) {
+            hi_check(*record.glyph_id < num_glyphs, "'COLR' layer refers to an invalid glyph.");
+            _layers.push_back(otype_COLR_layer{glyph_id{*record.glyph_id}, *record.palette_index});
+        }
+
+        offset = wide_cast<std::size_t>(*header.base_glyph_records_offset);
+        auto const base_glyph_records = implicit_cast<base_glyph_record_type>(offset, bytes, *header.num_base_glyph_records);
+
+        _base_glyphs.reserve(base_glyph_records.size());
+        for (auto const& record : base_glyph_records) {
+            auto const first = wide_cast<std::size_t>(*record.first_layer_index);
+            auto const count = wide_cast<std::size_t>(*record.num_layers);
+            hi_check(first + count <= _layers.size(), "'COLR' base glyph extends beyond the layer records.");
+            _base_glyphs.push_back(base_glyph_type{*record.glyph_id, narrow_cast<uint16_t>(first), narrow_cast<uint16_t>(count)});
+        }
+
+        // The base glyph records should already be sorted, but don't depend on it for the binary search.
+        std::sort(_base_glyphs.begin(), _base_glyphs.end(), [](auto const& lhs, auto const& rhs) {
+            return lhs.glyph < rhs.glyph;
+        });
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _base_glyphs.empty();
+    }
+
+    /** Find the layers of a color glyph.
+     *
+     * @param glyph The base glyph.
+     * @return The layers, painted bottom to top; or empty if the glyph is not a color glyph.
+     */
+    [[nodiscard]] std::span<otype_COLR_layer const> find(glyph_id glyph) const noexcept
+    {
+        auto const it = std::lower_bound(_base_glyphs.begin(), _base_glyphs.end(), *glyph, [](auto const& item, auto const& value) {
+            return item.glyph < value;
+        });
+
+        if (it == _base_glyphs.end() or it->glyph != *glyph) {
+            return {};
+        }
+        return std::span{_layers}.subspan(it->first_layer, it->num_layers);
+    }
+
+private:
+    struct base_glyph_type {
+        uint16_t glyph;
+        uint16_t first_layer;
+        uint16_t num_layers;
+    };
+
+    std::vector<base_glyph_type> _base_glyphs;
+    std::vector<otype_COLR_layer> _layers;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,105 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "otype_COLR.hpp"
+#include "otype_CPAL.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+TEST_SUITE(otype_COLR) {
+
+[[nodiscard]] static std::vector<std::byte> make_table(std::vector<uint16_t> const& words)
+{
+    auto r = std::vector<std::byte>{};
+    for (auto const word : words) {
+        r.push_back(static_cast<std::byte>(word >> 8));
+        r.push_back(static_cast<std::byte>(word & 0xff));
+    }
+    return r;
+}
+
+/** A version 0 'COLR' table.
+ *
+ * Glyph 10 has two layers: glyph 11 in palette color 0, glyph 12 in the foreground color.
+ * Glyph 20 has one layer: glyph 21 in palette color 1.
+ */
+[[nodiscard]] static std::vector<std::byte> make_COLR_table()
+{
+    // clang-format off
+    return make_table({
+        // Header, base-glyph records at 14, layer records at 26.
+        0, 2, 0, 14, 0, 26, 3,
+        // Base-glyph records, not sorted.
+        20, 2, 1,
+        10, 0, 2,
+        // Layer records.
+        11, 0,
+        12, 0xffff,
+        21, 1,
+    });
+    // clang-format on
+}
+
+/** A 'CPAL' table with two palettes of two colors.
+ */
+[[nodiscard]] static std::vector<std::byte> make_CPAL_table()
+{
+    // clang-format off
+    return make_table({
+        // Header, color records at 16.
+        0, 2, 2, 4, 0, 16,
+        // Color record indices.
+        0, 2,
+        // Color records BGRA: red, green, blue, white.
+        0x0000, 0xffff,
+        0x00ff, 0x00ff,
+        0xff00, 0x00ff,
+        0xffff, 0xffff,
+    });
+    // clang-format on
+}
+
+TEST_CASE(find_layers)
+{
+    auto const table = make_COLR_table();
+    auto const COLR = hi::otype_COLR(table, 40);
+    REQUIRE(not COLR.empty());
+
+    auto const layers_10 = COLR.find(hi::glyph_id{10});
+    REQUIRE(layers_10.size() == 2);
+    REQUIRE(layers_10[0] == hi::otype_COLR_layer{hi::glyph_id{11}, 0});
+    REQUIRE(layers_10[1] == hi::otype_COLR_layer{hi::glyph_id{12}, hi::otype_COLR::foreground_palette_index});
+
+    auto const layers_20 = COLR.find(hi::glyph_id{20});
+    REQUIRE(layers_20.size() == 1);
+    REQUIRE(layers_20[0] == hi::otype_COLR_layer{hi::glyph_id{21}, 1});
+
+    REQUIRE(COLR.find(hi::glyph_id{11}).empty());
+    REQUIRE(COLR.find(hi::glyph_id{30}).empty());
+}
+
+TEST_CASE(invalid_layer_glyph)
+{
+    auto const table = make_COLR_table();
+    REQUIRE_THROWS(hi::otype_COLR(table, 20), hi::parse_error);
+}
+
+TEST_CASE(palette)
+{
+    auto const table = make_CPAL_table();
+
+    auto const palette_0 = hi::otype_CPAL_get_palette(table, 0);
+    REQUIRE(palette_0.size() == 2);
+    REQUIRE(palette_0[0] == hi::color_from_sRGB(1.0f, 0.0f, 0.0f, 1.0f));
+    REQUIRE(palette_0[1] == hi::color_from_sRGB(0.0f, 1.0f, 0.0f, 1.0f));
+
+    auto const palette_1 = hi::otype_CPAL_get_palette(table, 1);
+    REQUIRE(palette_1.size() == 2);
+    REQUIRE(palette_1[0] == hi::color_from_sRGB(0.0f, 0.0f, 1.0f, 1.0f));
+    REQUIRE(palette_1[1] == hi::color_from_sRGB(1.0f, 1.0f, 1.0f, 1.0f));
+}
+
+};
@@ -0,0 +1,63 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "otype_utilities.hpp"
+#include "../color/color.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.font.otype_CPAL);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Get the colors of a palette from the 'CPAL' table.
+ *
+ * @param bytes The 'CPAL' table.
+ * @param palette_index The index of the palette, palette 0 is the default palette.
+ * @return The linear colors of the palette, indexed by the palette-index of a 'COLR' layer.
+ */
+[[nodiscard]] inline std::vector<color> otype_CPAL_get_palette(std::span<std::byte const> bytes, std::size_t palette_index = 0)
+{
+    struct header_type {
+        big_uint16_buf_t version;
+        big_uint16_buf_t num_palette_entries;
+        big_uint16_buf_t num_palettes;
+        big_uint16_buf_t num_color_records;
+        big_uint32_buf_t color_records_array_offset;
+    };
+
+    struct color_record_type {
+        uint8_t blue;
+        uint8_t green;
+        uint8_t red;
+        uint8_t alpha;
+    };
+
+    auto offset = 0_uz;
+    auto const& header = implicit_cast<header_type>(offset, bytes);
+    auto const num_palette_entries = wide_cast<std::size_t>(*header.num_palette_entries);
+
+    auto const color_record_indices = implicit_cast<big_uint16_buf_t>(offset, bytes, *header.num_palettes);
+    auto const first = wide_cast<std::size_t>(*hi_check_at(color_record_indices, palette_index));
+    hi_check(first + num_palette_entries <= *header.num_color_records, "'CPAL' palette extends beyond the color records.");
+
+    offset = wide_cast<std::size_t>(*header.color_records_array_offset);
+    auto const color_records = implicit_cast<color_record_type>(offset, bytes, *header.num_color_records);
+
+    auto r = std::vector<color>{};
+    r.reserve(num_palette_entries);
+    for (auto i = first; i != first + num_palette_entries; ++i) {
+        auto const& record = color_records[i];
+        r.push_back(color_from_sRGB(record.red, record.green, record.blue, record.alpha));
+    }
+    return r;
+}
+
+}} // namespace hi::v1
@@ -0,0 +1,511 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "otype_utilities.hpp"
+#include "glyph_id.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <bit>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.font.otype_GPOS);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A flat hash table of kerning values keyed by a pair of glyphs.
+ *
+ * The table uses open addressing with linear probing, so that a lookup
+ * is normally a single cache-line access.
+ */
+class otype_glyph_pair_map {
+public:
+    using value_type = std::pair<uint32_t, float>;
+
+    constexpr otype_glyph_pair_map() noexcept = default;
+
+    /** Build the table.
+     *
+     * @param items The key/value pairs, when a key is duplicated the first value is used.
+     */
+    explicit otype_glyph_pair_map(std::vector<value_type> const& items)
+    {
+        if (items.empty()) {
+            return;
+        }
+
+        auto const capacity = std::bit_ceil(items.size() * 2);
+        _shift = 64 - std::countr_zero(capacity);
+        _mask = capacity - 1;
+        _entries.assign(capacity, entry_type{});
+
+        for (auto const& [key, value] : items) {
+            hi_axiom(key != empty_key);
+
+            auto i = slot(key);
+            while (_entries[i].key != empty_key and _entries[i].key != key) {
+                i = (i + 1) & _mask;
+            }
+            if (_entries[i].key == empty_key) {
+                _entries[i] = entry_type{key, value};
+            }
+        }
+    }
+
+    /** Make a key from a pair of glyphs.
+     */
+    [[nodiscard]] constexpr static uint32_t make_key(glyph_id first_glyph_id, glyph_id second_glyph_id) noexcept
+    {
+        return (wide_cast<uint32_t>(*first_glyph_id) << 16) | wide_cast<uint32_t>(*second_glyph_id);
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _entries.empty();
+    }
+
+    [[nodiscard]] std::optional<float> find(uint32_t key) const noexcept
+    {
+        if (_entries.empty()) {
+            return std::nullopt;
+        }
+
+        for (auto i = slot(key);; i = (i + 1) & _mask) {
+            if (_entries[i].key == key) {
+                return _entries[i].value;
+            } else if (_entries[i].key == empty_key) {
+                return std::nullopt;
+            }
+        }
+    }
+
+private:
+    /** Glyph-ids are smaller than 0xffff, since the maximum number of glyphs is 0xffff.
+     */
+    constexpr static uint32_t empty_key = 0xffff'ffff;
+
+    struct entry_type {
+        uint32_t key = empty_key;
+        float value = 0.0f;
+    };
+
+    std::vector<entry_type> _entries;
+    std::size_t _mask = 0;
+    int _shift = 0;
+
+    [[nodiscard]] std::size_t slot(uint32_t key) const noexcept
+    {
+        // Fibonacci hashing, glyph-ids in kerning pairs are often consecutive.
+        return static_cast<std::size_t>((uint64_t{key} * 0x9e37'79b9'7f4a'7c15ULL) >> _shift);
+    }
+};
+
+/** A pair-adjustment sub-table of the 'GPOS' table, decoded for fast lookup.
+ */
+struct otype_GPOS_pair_subtable {
+    constexpr static uint16_t not_covered = 0xffff;
+
+    /** Format 1: The kerning of individual pairs of glyphs.
+     */
+    otype_glyph_pair_map pairs;
+
+    /** Format 2: The class of each first glyph, or `not_covered`.
+     */
+    std::vector<uint16_t> first_classes;
+
+    /** Format 2: The class of each second glyph.
+     */
+    std::vector<uint16_t> second_classes;
+
+    /** Format 2: The kerning for each combination of first and second class.
+     */
+    std::vector<float> class_values;
+    std::size_t num_second_classes = 0;
+
+    /** Find the kerning between two glyphs.
+     *
+     * @return The kerning, or std::nullopt if this sub-table does not apply to this pair.
+     */
+    [[nodiscard]] std::optional<float> find(glyph_id first_glyph_id, glyph_id second_glyph_id) const noexcept
+    {
+        if (first_classes.empty()) {
+            return pairs.find(otype_glyph_pair_map::make_key(first_glyph_id, second_glyph_id));
+        }
+
+        if (*first_glyph_id >= first_classes.size()) {
+            return std::nullopt;
+        }
+        auto const first_class = first_classes[*first_glyph_id];
+        if (first_class == not_covered) {
+            return std::nullopt;
+        }
+
+        // Glyphs that are not in the second class-definition are in class 0.
+        auto const second_class = *second_glyph_id < second_classes.size() ? second_classes[*second_glyph_id] : 0;
+        return class_values[first_class * num_second_classes + second_class];
+    }
+};
+
+/** The pair kerning of the 'GPOS' table, decoded for fast lookup.
+ */
+class otype_GPOS_kerning {
+public:
+    /** The sub-tables of each lookup of the 'kern' feature, in lookup-list order.
+     */
+    std::vector<std::vector<otype_GPOS_pair_subtable>> lookups;
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return lookups.empty();
+    }
+
+    /** Find the horizontal kerning between two glyphs.
+     *
+     * The first sub-table in a lookup that applies to the pair is used,
+     * the adjustments of each lookup are added together.
+     */
+    [[nodiscard]] float find(glyph_id first_glyph_id, glyph_id second_glyph_id) const noexcept
+    {
+        auto r = 0.0f;
+        for (auto const& lookup : lookups) {
+            for (auto const& subtable : lookup) {
+                if (auto const kerning = subtable.find(first_glyph_id, second_glyph_id)) {
+                    r += *kerning;
+                    break;
+                }
+            }
+        }
+        return r;
+    }
+};
+
+[[nodiscard]] inline std::span<std::byte const> otype_GPOS_subspan(std::span<std::byte const> bytes, std::size_t offset)
+{
+    hi_check(offset < bytes.size(), "'GPOS' offset is beyond the end of the table.");
+    return bytes.subspan(offset);
+}
+
+/** Decode a coverage table.
+ *
+ * @return The glyph-ids, ordered by their coverage-index.
+ */
+[[nodiscard]] inline std::vector<uint16_t> otype_GPOS_get_coverage(std::span<std::byte const> bytes)
+{
+    struct range_type {
+        big_uint16_buf_t start_glyph_id;
+        big_uint16_buf_t end_glyph_id;
+        big_uint16_buf_t start_coverage_index;
+    };
+
+    auto offset = 0_uz;
+    auto const format = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+    auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+
+    auto r = std::vector<uint16_t>{};
+    if (format == 1) {
+        r.reserve(count);
+        for (auto const& glyph : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+            r.push_back(*glyph);
+        }
+
+    } else if (format == 2) {
+        for (auto const& range : implicit_cast<range_type>(offset, bytes, count)) {
+            auto const start_glyph_id = *range.start_glyph_id;
+            auto const end_glyph_id = *range.end_glyph_id;
+            hi_check(start_glyph_id <= end_glyph_id, "'GPOS' coverage range is invalid.");
+
+            auto const start_index = wide_cast<std::size_t>(*range.start_coverage_index);
+            auto const num_glyphs = static_cast<std::size_t>(end_glyph_id - start_glyph_id) + 1;
+            if (r.size() < start_index + num_glyphs) {
+                r.resize(start_index + num_glyphs);
+            }
+            for (auto i = 0_uz; i != num_glyphs; ++i) {
+                r[start_index + i] = narrow_cast<uint16_t>(start_glyph_id + i);
+            }
+        }
+
+    } else {
+        throw parse_error("'GPOS' coverage table has an unknown format.");
+    }
+    return r;
+}
+
+/** Decode a class-definition table.
+ *
+ * @param bytes The class-definition table.
+ * @param num_classes The number of classes, used to validate the table.
+ * @param[in,out] classes The class of each glyph; glyphs that are not in the table keep their class.
+ */
+inline void otype_GPOS_get_class_def(std::span<std::byte const> bytes, std::size_t num_classes, std::vector<uint16_t>& classes)
+{
+    struct range_type {
+        big_uint16_buf_t start_glyph_id;
+        big_uint16_buf_t end_glyph_id;
+        big_uint16_buf_t klass;
+    };
+
+    auto const set_class = [&](std::size_t glyph, uint16_t klass) {
+        hi_check(klass < num_classes, "'GPOS' class-definition has an invalid class.");
+        if (glyph < classes.size()) {
+            classes[glyph] = klass;
+        }
+    };
+
+    auto offset = 0_uz;
+    auto const format = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+    if (format == 1) {
+        auto const start_glyph_id = wide_cast<std::size_t>(*implicit_cast<big_uint16_buf_t>(offset, bytes));
+        auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        auto glyph = start_glyph_id;
+        for (auto const& klass : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+            set_class(glyph++, *klass);
+        }
+
+    } else if (format == 2) {
+        auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        for (auto const& range : implicit_cast<range_type>(offset, bytes, count)) {
+            hi_check(*range.start_glyph_id <= *range.end_glyph_id, "'GPOS' class range is invalid.");
+            for (auto glyph = wide_cast<std::size_t>(*range.start_glyph_id); glyph <= *range.end_glyph_id; ++glyph) {
+                set_class(glyph, *range.klass);
+            }
+        }
+
+    } else {
+        throw parse_error("'GPOS' class-definition table has an unknown format.");
+    }
+}
+
+/** The size in bytes of a value-record.
+ */
+[[nodiscard]] constexpr std::size_t otype_GPOS_value_record_size(uint16_t value_format) noexcept
+{
+    return static_cast<std::size_t>(std::popcount(static_cast<uint16_t>(value_format & 0x00ff))) * 2;
+}
+
+/** Get the horizontal advance adjustment of a value-record.
+ */
+[[nodiscard]] inline float otype_GPOS_get_x_advance(std::span<std::byte const> bytes, uint16_t value_format, float em_scale)
+{
+    if (not to_bool(value_format & 0x0004)) {
+        return 0.0f;
+    }
+
+    // Skip over the x-placement and y-placement fields.
+    auto offset = static_cast<std::size_t>(std::popcount(static_cast<uint16_t>(value_format & 0x0003))) * 2;
+    return implicit_cast<otype_fword_buf_t>(offset, bytes) * em_scale;
+}
+
+/** Decode a pair-adjustment sub-table with individual pairs of glyphs.
+ */
+[[nodiscard]] inline otype_GPOS_pair_subtable otype_GPOS_get_pair_format1(std::span<std::byte const> bytes, float em_scale)
+{
+    struct header_type {
+        big_uint16_buf_t pos_format;
+        big_uint16_buf_t coverage_offset;
+        big_uint16_buf_t value_format1;
+        big_uint16_buf_t value_format2;
+        big_uint16_buf_t pair_set_count;
+    };
+
+    auto offset = 0_uz;
+    auto const& header = implicit_cast<header_type>(offset, bytes);
+    auto const pair_set_offsets = implicit_cast<big_uint16_buf_t>(offset, bytes, *header.pair_set_count);
+    auto const coverage = otype_GPOS_get_coverage(otype_GPOS_subspan(bytes, *header.coverage_offset));
+
+    auto const value_format1 = *header.value_format1;
+    auto const record_size = 2 + otype_GPOS_value_record_size(value_format1) + otype_GPOS_value_record_size(*header.value_format2);
+
+    auto items = std::vector<otype_glyph_pair_map::value_type>{};
+    auto const num_pair_sets = std::min(pair_set_offsets.size(), coverage.size());
+    for (auto i = 0_uz; i != num_pair_sets; ++i) {
+        auto const pair_set_bytes = otype_GPOS_subspan(bytes, *pair_set_offsets[i]);
+
+        auto pair_set_offset = 0_uz;
+        auto const count = *implicit_cast<big_uint16_buf_t>(pair_set_offset, pair_set_bytes);
+        auto const records = implicit_cast<std::byte>(pair_set_offset, pair_set_bytes, count * record_size);
+
+        for (auto j = 0_uz; j != count; ++j) {
+            auto const record = records.subspan(j * record_size, record_size);
+            auto const second_glyph_id = glyph_id{*implicit_cast<big_uint16_buf_t>(record)};
+            auto const x_advance = otype_GPOS_get_x_advance(record.subspan(2), value_format1, em_scale);
+            items.emplace_back(otype_glyph_pair_map::make_key(glyph_id{coverage[i]}, second_glyph_id), x_advance);
+        }
+    }
+
+    auto r = otype_GPOS_pair_subtable{};
+    r.pairs = otype_glyph_pair_map{items};
+    return r;
+}
+
+/** Decode a pair-adjustment sub-table with classes of glyphs.
+ */
+[[nodiscard]] inline otype_GPOS_pair_subtable
+otype_GPOS_get_pair_format2(std::span<std::byte const> bytes, std::size_t num_glyphs, float em_scale)
+{
+    struct header_type {
+        big_uint16_buf_t pos_format;
+        big_uint16_buf_t coverage_offset;
+        big_uint16_buf_t value_format1;
+        big_uint16_buf_t value_format2;
+        big_uint16_buf_t class_def1_offset;
+        big_uint16_buf_t class_def2_offset;
+        big_uint16_buf_t class1_count;
+        big_uint16_buf_t class2_count;
+    };
+
+    auto offset = 0_uz;
+    auto const& header = implicit_cast<header_type>(offset, bytes);
+    auto const num_first_classes = wide_cast<std::size_t>(*header.class1_count);
+    auto const num_second_classes = wide_cast<std::size_t>(*header.class2_count);
+    hi_check(num_first_classes != 0 and num_second_classes != 0, "'GPOS' pair-adjustment has no classes.");
+
+    auto r = otype_GPOS_pair_subtable{};
+    r.num_second_classes = num_second_classes;
+
+    // Only glyphs in the coverage table are a first glyph, with class 0 unless in the class-definition.
+    auto first_classes = std::vector<uint16_t>(num_glyphs, 0);
+    otype_GPOS_get_class_def(otype_GPOS_subspan(bytes, *header.class_def1_offset), num_first_classes, first_classes);
+    r.first_classes.assign(num_glyphs, otype_GPOS_pair_subtable::not_covered);
+    for (auto const glyph : otype_GPOS_get_coverage(otype_GPOS_subspan(bytes, *header.coverage_offset))) {
+        if (glyph < num_glyphs) {
+            r.first_classes[glyph] = first_classes[glyph];
+        }
+    }
+
+    r.second_classes.assign(num_glyphs, 0);
+    otype_GPOS_get_class_def(otype_GPOS_subspan(bytes, *header.class_def2_offset), num_second_classes, r.second_classes);
+
+    auto const value_format1 = *header.value_format1;
+    auto const record_size = otype_GPOS_value_record_size(value_format1) + otype_GPOS_value_record_size(*header.value_format2);
+    auto const num_records = num_first_classes * num_second_classes;
+    auto const records = implicit_cast<std::byte>(offset, bytes, num_records * record_size);
+
+    r.class_values.reserve(num_records);
+    for (auto i = 0_uz; i != num_records; ++i) {
+        r.class_values.push_back(otype_GPOS_get_x_advance(records.subspan(i * record_size, record_size), value_format1, em_scale));
+    }
+    return r;
+}
+
+/** Decode the pair-adjustment lookups of the 'kern' feature of the 'GPOS' table.
+ *
+ * The 'kern' features of all scripts and languages are used. Only the
+ * horizontal advance of the first glyph is used, placement adjustments
+ * and device tables are ignored.
+ *
+ * @param bytes The 'GPOS' table.
+ * @param num_glyphs The number of glyphs in the font.
+ * @param em_scale The scale to convert font-units to em.
+ * @return The decoded kerning, empty when the font has no pair kerning in the 'GPOS' table.
+ */
+[[nodiscard]] inline otype_GPOS_kerning
+otype_GPOS_get_kerning(std::span<std::byte const> bytes, std::size_t num_glyphs, float em_scale)
+{
+    struct header_type {
+        big_uint16_buf_t major_version;
+        big_uint16_buf_t minor_version;
+        big_uint16_buf_t script_list_offset;
+        big_uint16_buf_t feature_list_offset;
+        big_uint16_buf_t lookup_list_offset;
+    };
+
+    struct feature_record_type {
+        big_uint32_buf_t feature_tag;
+        big_uint16_buf_t feature_offset;
+    };
+
+    struct lookup_header_type {
+        big_uint16_buf_t lookup_type;
+        big_uint16_buf_t lookup_flag;
+        big_uint16_buf_t subtable_count;
+    };
+
+    struct extension_type {
+        big_uint16_buf_t pos_format;
+        big_uint16_buf_t extension_lookup_type;
+        big_uint32_buf_t extension_offset;
+    };
+
+    auto offset = 0_uz;
+    auto const& header = implicit_cast<header_type>(offset, bytes);
+    hi_check(*header.major_version == 1, "'GPOS' table expect major version to be 1.");
+
+    // Collect the lookups of the 'kern' features.
+    auto const feature_list_bytes = otype_GPOS_subspan(bytes, *header.feature_list_offset);
+    auto feature_list_offset = 0_uz;
+    auto const feature_count = *implicit_cast<big_uint16_buf_t>(feature_list_offset, feature_list_bytes);
+    auto lookup_indices = std::vector<uint16_t>{};
+    for (auto const& feature_record : implicit_cast<feature_record_type>(feature_list_offset, feature_list_bytes, feature_count)) {
+        if (*feature_record.feature_tag != fourcc<"kern">()) {
+            continue;
+        }
+
+        auto const feature_bytes = otype_GPOS_subspan(feature_list_bytes, *feature_record.feature_offset);
+        auto feature_offset = 2_uz; // Skip over the feature-parameters offset.
+        auto const lookup_index_count = *implicit_cast<big_uint16_buf_t>(feature_offset, feature_bytes);
+        for (auto const& lookup_index : implicit_cast<big_uint16_buf_t>(feature_offset, feature_bytes, lookup_index_count)) {
+            lookup_indices.push_back(*lookup_index);
+        }
+    }
+
+    // Lookups are applied in lookup-list order.
+    std::sort(lookup_indices.begin(), lookup_indices.end());
+    lookup_indices.erase(std::unique(lookup_indices.begin(), lookup_indices.end()), lookup_indices.end());
+
+    auto const lookup_list_bytes = otype_GPOS_subspan(bytes, *header.lookup_list_offset);
+    auto lookup_list_offset = 0_uz;
+    auto const lookup_count = *implicit_cast<big_uint16_buf_t>(lookup_list_offset, lookup_list_bytes);
+    auto const lookup_offsets = implicit_cast<big_uint16_buf_t>(lookup_list_offset, lookup_list_bytes, lookup_count);
+
+    auto r = otype_GPOS_kerning{};
+    for (auto const lookup_index : lookup_indices) {
+        hi_check(lookup_index < lookup_offsets.size(), "'GPOS' feature refers to an invalid lookup.");
+
+        auto const lookup_bytes = otype_GPOS_subspan(lookup_list_bytes, *lookup_offsets[lookup_index]);
+        auto lookup_offset = 0_uz;
+        auto const& lookup_header = implicit_cast<lookup_header_type>(lookup_offset, lookup_bytes);
+        auto const lookup_type = *lookup_header.lookup_type;
+        auto const subtable_offsets = implicit_cast<big_uint16_buf_t>(lookup_offset, lookup_bytes, *lookup_header.subtable_count);
+
+        auto subtables = std::vector<otype_GPOS_pair_subtable>{};
+        for (auto const& subtable_offset : subtable_offsets) {
+            auto subtable_bytes = otype_GPOS_subspan(lookup_bytes, *subtable_offset);
+
+            if (lookup_type == 9) {
+                // Extension positioning, allows sub-tables at a 32-bit offset.
+                auto const& extension = implicit_cast<extension_type>(subtable_bytes);
+                if (*extension.extension_lookup_type != 2) {
+                    continue;
+                }
+                subtable_bytes = otype_GPOS_subspan(subtable_bytes, *extension.extension_offset);
+
+            } else if (lookup_type != 2) {
+                continue;
+            }
+
+            auto const pos_format = *implicit_cast<big_uint16_buf_t>(subtable_bytes);
+            if (pos_format == 1) {
+                subtables.push_back(otype_GPOS_get_pair_format1(subtable_bytes, em_scale));
+            } else if (pos_format == 2) {
+                subtables.push_back(otype_GPOS_get_pair_format2(subtable_bytes, num_glyphs, em_scale));
+            } else {
+                throw parse_error("'GPOS' pair-adjustment has an unknown format.");
+            }
+        }
+
+        if (not subtables.empty()) {
+            r.lookups.push_back(std::move(subtables));
+        }
+    }
+    return r;
+}
+
+}} // namespace hi::v1
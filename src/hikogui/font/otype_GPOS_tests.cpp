@@ -0,0 +1,97 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "otype_GPOS.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+TEST_SUITE(otype_GPOS) {
+
+/** A 'GPOS' table with a 'kern' feature with two pair-adjustment lookups.
+ *
+ * Lookup 0 is format 1 with the pairs (5, 6) = -50 and (5, 7) = -20.
+ * Lookup 1 is format 2, first glyphs 10 and 11 with 11 in class 1,
+ * second glyph 6 in class 1; (class 0, class 1) = -10 and (class 1, class 1) = -30.
+ */
+[[nodiscard]] static std::vector<std::byte> make_GPOS_table()
+{
+    auto const n = [](int x) {
+        return static_cast<uint16_t>(x);
+    };
+
+    // clang-format off
+    auto const words = std::vector<uint16_t>{
+        // Header, feature-list at 10, lookup-list at 26.
+        1, 0, 10, 10, 26,
+        // Feature-list: 'kern' feature at 8.
+        1, 0x6b65, 0x726e, 8,
+        // Feature: lookup 0 and 1.
+        0, 2, 0, 1,
+        // Lookup-list: lookups at 6 and 42.
+        2, 6, 42,
+        // Lookup 0: pair-adjustment, sub-table at 8.
+        2, 0, 1, 8,
+        // Format 1: coverage at 12, x-advance, pair-set at 18.
+        1, 12, 4, 0, 1, 18,
+        // Coverage: glyph 5.
+        1, 1, 5,
+        // Pair-set.
+        2, 6, n(-50), 7, n(-20),
+        // Lookup 1: pair-adjustment, sub-table at 8.
+        2, 0, 1, 8,
+        // Format 2: coverage at 24, x-advance, class-def1 at 34, class-def2 at 42, 2 x 2 classes.
+        2, 24, 4, 0, 34, 42, 2, 2,
+        0, n(-10), 0, n(-30),
+        // Coverage: glyph 10 to 11.
+        2, 1, 10, 11, 0,
+        // Class-def1: glyph 11 is class 1.
+        1, 11, 1, 1,
+        // Class-def2: glyph 6 is class 1.
+        2, 1, 6, 6, 1,
+    };
+    // clang-format on
+
+    auto r = std::vector<std::byte>{};
+    for (auto const word : words) {
+        r.push_back(static_cast<std::byte>(word >> 8));
+        r.push_back(static_cast<std::byte>(word & 0xff));
+    }
+    return r;
+}
+
+TEST_CASE(pair_kerning)
+{
+    auto const table = make_GPOS_table();
+    auto const kerning = hi::otype_GPOS_get_kerning(table, 20, 1.0f);
+
+    REQUIRE(kerning.lookups.size() == 2);
+    REQUIRE(kerning.find(hi::glyph_id{5}, hi::glyph_id{6}) == -50.0f);
+    REQUIRE(kerning.find(hi::glyph_id{5}, hi::glyph_id{7}) == -20.0f);
+    REQUIRE(kerning.find(hi::glyph_id{5}, hi::glyph_id{8}) == 0.0f);
+    REQUIRE(kerning.find(hi::glyph_id{6}, hi::glyph_id{5}) == 0.0f);
+    REQUIRE(kerning.find(hi::glyph_id{10}, hi::glyph_id{6}) == -10.0f);
+    REQUIRE(kerning.find(hi::glyph_id{11}, hi::glyph_id{6}) == -30.0f);
+    REQUIRE(kerning.find(hi::glyph_id{11}, hi::glyph_id{7}) == 0.0f);
+    REQUIRE(kerning.find(hi::glyph_id{12}, hi::glyph_id{6}) == 0.0f);
+}
+
+TEST_CASE(glyph_pair_map)
+{
+    auto items = std::vector<hi::otype_glyph_pair_map::value_type>{};
+    for (auto i = uint32_t{0}; i != 1000; ++i) {
+        items.emplace_back(i * 7, static_cast<float>(i));
+    }
+    // Duplicate keys use the first value.
+    items.emplace_back(0, 42.0f);
+
+    auto const map = hi::otype_glyph_pair_map{items};
+    for (auto i = uint32_t{0}; i != 1000; ++i) {
+        REQUIRE(map.find(i * 7) == static_cast<float>(i));
+        REQUIRE(map.find(i * 7 + 1) == std::nullopt);
+    }
+}
+
+};
@@ -4,28 +4,869 @@
 
 #pragma once
 
-#include "../geometry/geometry.hpp"
-#include "../parser/parser.hpp"
+#include "otype_utilities.hpp"
+#include "otype_coverage.hpp"
+#include "otype_class_def.hpp"
+#include "glyph_id.hpp"
 #include "../utility/utility.hpp"
-#include <cstddef>
+#include "../macros.hpp"
 #include <span>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <utility>
+#include <tuple>
+#include <cstddef>
+#include <cstdint>
 
 hi_export_module(hikogui.font.otype_GSUB);
 
-hi_export namespace hi::inline v1 {
+hi_export namespace hi { inline namespace v1 {
+
+/** A glyph in the buffer on which glyph-substitution is performed.
+ */
+struct otype_GSUB_glyph {
+    glyph_id glyph;
+
+    /** The index of the grapheme in the run that this glyph belongs to.
+     *
+     * The glyphs of a ligature belong to the first grapheme of the ligature.
+     */
+    std::size_t cluster;
+
+    [[nodiscard]] friend bool operator==(otype_GSUB_glyph const&, otype_GSUB_glyph const&) noexcept = default;
+};
 
-/** Compatible with version 1.1, all offsets start at the beginning of this header.
+/** A rule of a (chained) contextual sub-table.
+ *
+ * The values in the sequences are glyphs, classes or indices into the coverages
+ * of the sub-table; depending on the format of the sub-table.
  */
-struct GSUB_version_1_0 {
-    big_uint16_t major_version;
-    big_uint16_t minor_version;
-    big_uint16_t script_list_offset;
-    big_uint16_t feature_list_offset;
-    big_uint16_t lookup_list_offset;
+struct otype_GSUB_rule {
+    /** The glyphs before the input sequence, closest glyph first.
+     */
+    std::vector<uint16_t> backtrack;
+
+    /** The input sequence, excluding the first glyph.
+     */
+    std::vector<uint16_t> input;
+
+    /** The glyphs after the input sequence.
+     */
+    std::vector<uint16_t> lookahead;
+
+    /** The lookups to apply on the input sequence: pairs of sequence-index and lookup-index.
+     */
+    std::vector<std::pair<uint16_t, uint16_t>> lookups;
+};
+
+struct otype_GSUB_ligature {
+    uint16_t glyph;
+
+    /** The components, excluding the first one.
+     */
+    std::vector<uint16_t> components;
+};
+
+/** A sub-table of a lookup of the 'GSUB' table, decoded for fast substitution.
+ */
+struct otype_GSUB_subtable {
+    enum class kind_type : uint8_t { single, multiple, ligature, context };
+    enum class match_type : uint8_t { glyph, klass, coverage };
+
+    kind_type kind = kind_type::single;
+
+    /** The coverage of the first glyph.
+     */
+    otype_coverage coverage;
+
+    /** Single substitution format 1: delta to add to the glyph.
+     */
+    uint16_t delta = 0;
+
+    /** Single substitution format 2 and alternate substitution: substitute for each coverage-index.
+     */
+    std::vector<uint16_t> substitutes;
+
+    /** Multiple substitution: sequence of glyphs for each coverage-index.
+     */
+    std::vector<std::vector<uint16_t>> sequences;
+
+    /** Ligature substitution: ligatures for each coverage-index, in order of preference.
+     */
+    std::vector<std::vector<otype_GSUB_ligature>> ligature_sets;
+
+    /** Contextual substitution: how values in the rules are matched.
+     */
+    match_type match = match_type::glyph;
+
+    otype_class_def backtrack_classes;
+    otype_class_def input_classes;
+    otype_class_def lookahead_classes;
+
+    /** Contextual substitution format 3: the coverages referred to by the rule.
+     */
+    std::vector<otype_coverage> coverages;
+
+    /** Contextual substitution: rules for each coverage-index (format 1) or
+     * class of the first glyph (format 2); or a single rule (format 3).
+     */
+    std::vector<std::vector<otype_GSUB_rule>> rule_sets;
+
+    /** Find the rules that start with the given glyph.
+     */
+    [[nodiscard]] std::vector<otype_GSUB_rule> const *find_rules(uint16_t coverage_index, glyph_id glyph) const noexcept
+    {
+        auto const i = match == match_type::glyph ? coverage_index :
+            match == match_type::klass              ? input_classes.find(glyph) :
+                                                      uint16_t{0};
+        return i < rule_sets.size() ? &rule_sets[i] : nullptr;
+    }
+
+    [[nodiscard]] bool matches(otype_class_def const& class_def, uint16_t value, glyph_id glyph) const noexcept
+    {
+        switch (match) {
+        case match_type::glyph:
+            return *glyph == value;
+        case match_type::klass:
+            return class_def.find(glyph) == value;
+        case match_type::coverage:
+            return coverages[value].contains(glyph);
+        }
+        hi_no_default();
+    }
+};
+
+struct otype_GSUB_lookup {
+    std::vector<otype_GSUB_subtable> subtables;
+
+    /** The glyphs covered by any of the sub-tables.
+     */
+    otype_glyph_set first_glyphs;
 };
 
-struct GSUB_ligature {
+/** The 'GSUB' table, decoded for fast substitution.
+ */
+class otype_GSUB {
+public:
+    /** The maximum depth of nested lookups of contextual sub-tables.
+     */
+    constexpr static std::size_t max_nesting_depth = 8;
+
+    struct lang_sys_type {
+        uint32_t tag;
+        std::vector<uint16_t> feature_indices;
+    };
+
+    struct script_type {
+        uint32_t tag;
+
+        /** The features of the default language-system, if the script has one.
+         */
+        std::optional<lang_sys_type> default_lang_sys;
+        std::vector<lang_sys_type> lang_systems;
+    };
+
+    struct feature_type {
+        uint32_t tag;
+        std::vector<uint16_t> lookup_indices;
+    };
+
+    std::vector<script_type> scripts;
+    std::vector<feature_type> features;
+    std::vector<otype_GSUB_lookup> lookups;
+
+    constexpr otype_GSUB() noexcept = default;
+
+    /** Decode the 'GSUB' table.
+     *
+     * @param bytes The 'GSUB' table.
+     * @param num_glyphs The number of glyphs in the font.
+     */
+    otype_GSUB(std::span<std::byte const> bytes, std::size_t num_glyphs) : _num_glyphs(num_glyphs)
+    {
+        struct header_type {
+            big_uint16_buf_t major_version;
+            big_uint16_buf_t minor_version;
+            big_uint16_buf_t script_list_offset;
+            big_uint16_buf_t feature_list_offset;
+            big_uint16_buf_t lookup_list_offset;
+        };
+
+        auto offset = 0_uz;
+        auto const& header = implicit_cast<header_type>(offset, bytes);
+        hi_check(*header.major_version == 1, "'GSUB' table expect major version to be 1.");
+
+        parse_script_list(subspan(bytes, *header.script_list_offset));
+        parse_feature_list(subspan(bytes, *header.feature_list_offset));
+        parse_lookup_list(subspan(bytes, *header.lookup_list_offset));
+    }
+
+    /** Find the lookups of the features for a script and language.
+     *
+     * If the font does not have the script, the 'DFLT' script is used, or if
+     * that does not exist the 'latn' script.
+     *
+     * @param script_tag The OpenType tag of the script.
+     * @param language_tag The OpenType tag of the language, or zero for the default language.
+     * @param feature_tags The OpenType tags of the features to apply.
+     * @return The indices of the lookups, in the order that they should be applied.
+     */
+    [[nodiscard]] std::vector<uint16_t>
+    find_lookups(uint32_t script_tag, uint32_t language_tag, std::span<uint32_t const> feature_tags) const
+    {
+        auto const *script = find_script(script_tag);
+        if (script == nullptr) {
+            script = find_script(fourcc<"DFLT">());
+        }
+        if (script == nullptr) {
+            script = find_script(fourcc<"latn">());
+        }
+        if (script == nullptr) {
+            return {};
+        }
+
+        auto const *lang_sys = script->default_lang_sys ? &*script->default_lang_sys : nullptr;
+        for (auto const& lang_sys_ : script->lang_systems) {
+            if (lang_sys_.tag == language_tag) {
+                lang_sys = &lang_sys_;
+                break;
+            }
+        }
+        if (lang_sys == nullptr) {
+            return {};
+        }
+
+        auto r = std::vector<uint16_t>{};
+        for (auto const feature_index : lang_sys->feature_indices) {
+            auto const& feature = features[feature_index];
+            if (std::find(feature_tags.begin(), feature_tags.end(), feature.tag) != feature_tags.end()) {
+                r.insert(r.end(), feature.lookup_indices.begin(), feature.lookup_indices.end());
+            }
+        }
+
+        // Lookups of all the features are applied in lookup-list order.
+        std::sort(r.begin(), r.end());
+        r.erase(std::unique(r.begin(), r.end()), r.end());
+        return r;
+    }
+
+    /** Apply lookups to the glyphs.
+     *
+     * @param lookup_indices The indices of the lookups, from `find_lookups()`.
+     * @param[in,out] buffer The glyphs to substitute.
+     * @return True if any glyph was substituted.
+     */
+    bool apply(std::span<uint16_t const> lookup_indices, std::vector<otype_GSUB_glyph>& buffer) const
+    {
+        auto r = false;
+        for (auto const lookup_index : lookup_indices) {
+            hi_axiom_bounds(lookup_index, lookups);
+            auto const& lookup = lookups[lookup_index];
+
+            for (auto i = 0_uz; i < buffer.size();) {
+                if (not lookup.first_glyphs.contains(buffer[i].glyph)) {
+                    ++i;
+                } else if (auto const n = apply_lookup(lookup, buffer, i, 0)) {
+                    r = true;
+                    i += *n;
+                } else {
+                    ++i;
+                }
+            }
+        }
+        return r;
+    }
+
+private:
+    std::size_t _num_glyphs = 0;
+
+    [[nodiscard]] static std::span<std::byte const> subspan(std::span<std::byte const> bytes, std::size_t offset)
+    {
+        hi_check(offset < bytes.size(), "'GSUB' offset is beyond the end of the table.");
+        return bytes.subspan(offset);
+    }
+
+    [[nodiscard]] script_type const *find_script(uint32_t script_tag) const noexcept
+    {
+        for (auto const& script : scripts) {
+            if (script.tag == script_tag) {
+                return &script;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] uint16_t check_glyph(uint16_t glyph) const
+    {
+        hi_check(glyph < _num_glyphs, "'GSUB' substitutes an invalid glyph.");
+        return glyph;
+    }
+
+    [[nodiscard]] std::vector<uint16_t> get_glyphs(std::size_t& offset, std::span<std::byte const> bytes, std::size_t count) const
+    {
+        auto r = std::vector<uint16_t>{};
+        r.reserve(count);
+        for (auto const& glyph : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+            r.push_back(check_glyph(*glyph));
+        }
+        return r;
+    }
+
+    [[nodiscard]] static std::vector<uint16_t> get_values(std::size_t& offset, std::span<std::byte const> bytes, std::size_t count)
+    {
+        auto r = std::vector<uint16_t>{};
+        r.reserve(count);
+        for (auto const& value : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+            r.push_back(*value);
+        }
+        return r;
+    }
+
+    [[nodiscard]] static lang_sys_type parse_lang_sys(uint32_t tag, std::span<std::byte const> bytes)
+    {
+        struct header_type {
+            big_uint16_buf_t lookup_order_offset;
+            big_uint16_buf_t required_feature_index;
+            big_uint16_buf_t feature_index_count;
+        };
+
+        auto offset = 0_uz;
+        auto const& header = implicit_cast<header_type>(offset, bytes);
+
+        auto r = lang_sys_type{tag, {}};
+        if (auto const required_feature_index = *header.required_feature_index; required_feature_index != 0xffff) {
+            r.feature_indices.push_back(required_feature_index);
+        }
+        for (auto const& feature_index : implicit_cast<big_uint16_buf_t>(offset, bytes, *header.feature_index_count)) {
+            r.feature_indices.push_back(*feature_index);
+        }
+        return r;
+    }
+
+    void parse_script_list(std::span<std::byte const> bytes)
+    {
+        struct record_type {
+            big_uint32_buf_t tag;
+            big_uint16_buf_t offset;
+        };
+
+        auto offset = 0_uz;
+        auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        for (auto const& script_record : implicit_cast<record_type>(offset, bytes, count)) {
+            auto const script_bytes = subspan(bytes, *script_record.offset);
+
+            auto script_offset = 0_uz;
+            auto const default_lang_sys_offset = *implicit_cast<big_uint16_buf_t>(script_offset, script_bytes);
+            auto const lang_sys_count = *implicit_cast<big_uint16_buf_t>(script_offset, script_bytes);
+
+            auto& script = scripts.emplace_back(*script_record.tag);
+            if (default_lang_sys_offset != 0) {
+                script.default_lang_sys = parse_lang_sys(0, subspan(script_bytes, default_lang_sys_offset));
+            }
+            for (auto const& lang_sys_record : implicit_cast<record_type>(script_offset, script_bytes, lang_sys_count)) {
+                script.lang_systems.push_back(parse_lang_sys(*lang_sys_record.tag, subspan(script_bytes, *lang_sys_record.offset)));
+            }
+        }
+    }
+
+    void parse_feature_list(std::span<std::byte const> bytes)
+    {
+        struct record_type {
+            big_uint32_buf_t tag;
+            big_uint16_buf_t offset;
+        };
+
+        auto offset = 0_uz;
+        auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        for (auto const& feature_record : implicit_cast<record_type>(offset, bytes, count)) {
+            auto const feature_bytes = subspan(bytes, *feature_record.offset);
+
+            auto feature_offset = 2_uz; // Skip over the feature-parameters offset.
+            auto const lookup_index_count = *implicit_cast<big_uint16_buf_t>(feature_offset, feature_bytes);
+            features.emplace_back(*feature_record.tag, get_values(feature_offset, feature_bytes, lookup_index_count));
+        }
+
+        for (auto const& script : scripts) {
+            auto const check_lang_sys = [&](lang_sys_type const& lang_sys) {
+                for (auto const feature_index : lang_sys.feature_indices) {
+                    hi_check(feature_index < features.size(), "'GSUB' language-system refers to an invalid feature.");
+                }
+            };
+
+            if (script.default_lang_sys) {
+                check_lang_sys(*script.default_lang_sys);
+            }
+            for (auto const& lang_sys : script.lang_systems) {
+                check_lang_sys(lang_sys);
+            }
+        }
+    }
+
+    void parse_lookup_list(std::span<std::byte const> bytes)
+    {
+        struct header_type {
+            big_uint16_buf_t lookup_type;
+            big_uint16_buf_t lookup_flag;
+            big_uint16_buf_t subtable_count;
+        };
+
+        struct extension_type {
+            big_uint16_buf_t subst_format;
+            big_uint16_buf_t extension_lookup_type;
+            big_uint32_buf_t extension_offset;
+        };
+
+        auto offset = 0_uz;
+        auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        for (auto const& lookup_offset_buf : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+            auto const lookup_bytes = subspan(bytes, *lookup_offset_buf);
+
+            auto lookup_offset = 0_uz;
+            auto const& header = implicit_cast<header_type>(lookup_offset, lookup_bytes);
+            auto const subtable_offsets = implicit_cast<big_uint16_buf_t>(lookup_offset, lookup_bytes, *header.subtable_count);
+
+            auto& lookup = lookups.emplace_back();
+            for (auto const& subtable_offset : subtable_offsets) {
+                auto subtable_bytes = subspan(lookup_bytes, *subtable_offset);
+
+                auto lookup_type = *header.lookup_type;
+                if (lookup_type == 7) {
+                    // Extension substitution, allows sub-tables at a 32-bit offset.
+                    auto const& extension = implicit_cast<extension_type>(subtable_bytes);
+                    lookup_type = *extension.extension_lookup_type;
+                    subtable_bytes = subspan(subtable_bytes, *extension.extension_offset);
+                }
+
+                if (auto subtable = parse_subtable(lookup_type, subtable_bytes)) {
+                    lookup.first_glyphs.add(subtable->coverage);
+                    lookup.subtables.push_back(std::move(*subtable));
+                }
+            }
+        }
+
+        // Nested lookups of contextual sub-tables must exist.
+        for (auto const& lookup : lookups) {
+            for (auto const& subtable : lookup.subtables) {
+                for (auto const& rule_set : subtable.rule_sets) {
+                    for (auto const& rule : rule_set) {
+                        for (auto const& record : rule.lookups) {
+                            hi_check(record.second < lookups.size(), "'GSUB' rule refers to an invalid lookup.");
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /** Parse a sub-table.
+     *
+     * @return The sub-table, or std::nullopt for lookup-types that are not supported.
+     */
+    [[nodiscard]] std::optional<otype_GSUB_subtable> parse_subtable(uint16_t lookup_type, std::span<std::byte const> bytes) const
+    {
+        auto offset = 0_uz;
+        auto const format = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+
+        auto r = otype_GSUB_subtable{};
+        switch (lookup_type) {
+        case 1:
+            parse_single(format, bytes, r);
+            return r;
+        case 2:
+            parse_multiple(bytes, r);
+            return r;
+        case 3:
+            parse_alternate(bytes, r);
+            return r;
+        case 4:
+            parse_ligature(bytes, r);
+            return r;
+        case 5:
+            parse_context(format, false, bytes, r);
+            return r;
+        case 6:
+            parse_context(format, true, bytes, r);
+            return r;
+        default:
+            // Reverse chaining contextual single substitution is not supported.
+            return std::nullopt;
+        }
+    }
+
+    void parse_single(uint16_t format, std::span<std::byte const> bytes, otype_GSUB_subtable& r) const
+    {
+        auto offset = 2_uz;
+        r.kind = otype_GSUB_subtable::kind_type::single;
+        r.coverage = otype_coverage{subspan(bytes, *implicit_cast<big_uint16_buf_t>(offset, bytes))};
+        if (format == 1) {
+            r.delta = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        } else if (format == 2) {
+            auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            r.substitutes = get_glyphs(offset, bytes, count);
+        } else {
+            throw parse_error("'GSUB' single substitution has an unknown format.");
+        }
+    }
+
+    void parse_multiple(std::span<std::byte const> bytes, otype_GSUB_subtable& r) const
+    {
+        auto offset = 2_uz;
+        r.kind = otype_GSUB_subtable::kind_type::multiple;
+        r.coverage = otype_coverage{subspan(bytes, *implicit_cast<big_uint16_buf_t>(offset, bytes))};
+        auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        for (auto const& sequence_offset : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+            auto const sequence_bytes = subspan(bytes, *sequence_offset);
+            auto sequence_offset_ = 0_uz;
+            auto const glyph_count = *implicit_cast<big_uint16_buf_t>(sequence_offset_, sequence_bytes);
+            r.sequences.push_back(get_glyphs(sequence_offset_, sequence_bytes, glyph_count));
+        }
+    }
+
+    /** Parse an alternate substitution, the first alternate is always selected.
+     */
+    void parse_alternate(std::span<std::byte const> bytes, otype_GSUB_subtable& r) const
+    {
+        auto offset = 2_uz;
+        r.kind = otype_GSUB_subtable::kind_type::single;
+        r.coverage = otype_coverage{subspan(bytes, *implicit_cast<big_uint16_buf_t>(offset, bytes))};
+        auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        for (auto const& alternate_set_offset : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+            auto const alternate_set_bytes = subspan(bytes, *alternate_set_offset);
+            auto alternate_set_offset_ = 0_uz;
+            auto const glyph_count = *implicit_cast<big_uint16_buf_t>(alternate_set_offset_, alternate_set_bytes);
+            hi_check(glyph_count != 0, "'GSUB' alternate set is empty.");
+            r.substitutes.push_back(check_glyph(*implicit_cast<big_uint16_buf_t>(alternate_set_offset_, alternate_set_bytes)));
+        }
+    }
+
+    void parse_ligature(std::span<std::byte const> bytes, otype_GSUB_subtable& r) const
+    {
+        auto offset = 2_uz;
+        r.kind = otype_GSUB_subtable::kind_type::ligature;
+        r.coverage = otype_coverage{subspan(bytes, *implicit_cast<big_uint16_buf_t>(offset, bytes))};
+        auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        for (auto const& ligature_set_offset : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+            auto const ligature_set_bytes = subspan(bytes, *ligature_set_offset);
+            auto ligature_set_offset_ = 0_uz;
+            auto const ligature_count = *implicit_cast<big_uint16_buf_t>(ligature_set_offset_, ligature_set_bytes);
+
+            auto& ligature_set = r.ligature_sets.emplace_back();
+            for (auto const& ligature_offset : implicit_cast<big_uint16_buf_t>(ligature_set_offset_, ligature_set_bytes, ligature_count)) {
+                auto const ligature_bytes = subspan(ligature_set_bytes, *ligature_offset);
+                auto ligature_offset_ = 0_uz;
+                auto const glyph = check_glyph(*implicit_cast<big_uint16_buf_t>(ligature_offset_, ligature_bytes));
+                auto const component_count = *implicit_cast<big_uint16_buf_t>(ligature_offset_, ligature_bytes);
+                hi_check(component_count != 0, "'GSUB' ligature has no components.");
+                ligature_set.emplace_back(glyph, get_values(ligature_offset_, ligature_bytes, component_count - 1));
+            }
+        }
+    }
+
+    /** Parse a rule of a (chained) contextual sub-table.
+     *
+     * @param chained The rule is of a chained contextual sub-table, with backtrack and lookahead sequences.
+     */
+    [[nodiscard]] static otype_GSUB_rule parse_rule(bool chained, std::size_t& offset, std::span<std::byte const> bytes)
+    {
+        auto r = otype_GSUB_rule{};
+        if (chained) {
+            auto const backtrack_count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            r.backtrack = get_values(offset, bytes, backtrack_count);
+        }
+
+        auto const input_count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        hi_check(input_count != 0, "'GSUB' rule has an empty input sequence.");
+
+        if (chained) {
+            r.input = get_values(offset, bytes, input_count - 1);
+            auto const lookahead_count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            r.lookahead = get_values(offset, bytes, lookahead_count);
+            auto const lookup_count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            r.lookups = parse_lookup_records(offset, bytes, lookup_count);
+        } else {
+            auto const lookup_count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            r.input = get_values(offset, bytes, input_count - 1);
+            r.lookups = parse_lookup_records(offset, bytes, lookup_count);
+        }
+        return r;
+    }
+
+    [[nodiscard]] static std::vector<std::pair<uint16_t, uint16_t>>
+    parse_lookup_records(std::size_t& offset, std::span<std::byte const> bytes, std::size_t count)
+    {
+        struct record_type {
+            big_uint16_buf_t sequence_index;
+            big_uint16_buf_t lookup_index;
+        };
+
+        auto r = std::vector<std::pair<uint16_t, uint16_t>>{};
+        r.reserve(count);
+        for (auto const& record : implicit_cast<record_type>(offset, bytes, count)) {
+            r.emplace_back(*record.sequence_index, *record.lookup_index);
+        }
+        return r;
+    }
+
+    [[nodiscard]] static std::vector<otype_GSUB_rule> parse_rule_set(bool chained, std::span<std::byte const> bytes)
+    {
+        auto offset = 0_uz;
+        auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+
+        auto r = std::vector<otype_GSUB_rule>{};
+        for (auto const& rule_offset : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+            auto rule_offset_ = 0_uz;
+            r.push_back(parse_rule(chained, rule_offset_, subspan(bytes, *rule_offset)));
+        }
+        return r;
+    }
+
+    /** Parse a coverage-based rule, the values in the rule are indices into `r.coverages`.
+     */
+    [[nodiscard]] std::vector<uint16_t>
+    parse_coverages(std::size_t& offset, std::span<std::byte const> bytes, std::size_t count, otype_GSUB_subtable& r) const
+    {
+        auto indices = std::vector<uint16_t>{};
+        for (auto const& coverage_offset : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+            indices.push_back(narrow_cast<uint16_t>(r.coverages.size()));
+            r.coverages.emplace_back(subspan(bytes, *coverage_offset));
+        }
+        return indices;
+    }
+
+    void parse_context(uint16_t format, bool chained, std::span<std::byte const> bytes, otype_GSUB_subtable& r) const
+    {
+        r.kind = otype_GSUB_subtable::kind_type::context;
+
+        auto offset = 2_uz;
+        if (format == 1 or format == 2) {
+            r.match = format == 1 ? otype_GSUB_subtable::match_type::glyph : otype_GSUB_subtable::match_type::klass;
+            r.coverage = otype_coverage{subspan(bytes, *implicit_cast<big_uint16_buf_t>(offset, bytes))};
+
+            if (format == 2) {
+                if (chained) {
+                    r.backtrack_classes = otype_class_def{subspan(bytes, *implicit_cast<big_uint16_buf_t>(offset, bytes))};
+                }
+                r.input_classes = otype_class_def{subspan(bytes, *implicit_cast<big_uint16_buf_t>(offset, bytes))};
+                if (chained) {
+                    r.lookahead_classes = otype_class_def{subspan(bytes, *implicit_cast<big_uint16_buf_t>(offset, bytes))};
+                } else {
+                    r.backtrack_classes = r.input_classes;
+                    r.lookahead_classes = r.input_classes;
+                }
+            }
+
+            auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            for (auto const& rule_set_offset : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+                if (*rule_set_offset == 0) {
+                    r.rule_sets.emplace_back();
+                } else {
+                    r.rule_sets.push_back(parse_rule_set(chained, subspan(bytes, *rule_set_offset)));
+                }
+            }
+
+        } else if (format == 3) {
+            r.match = otype_GSUB_subtable::match_type::coverage;
+
+            auto rule = otype_GSUB_rule{};
+            if (chained) {
+                auto const backtrack_count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+                rule.backtrack = parse_coverages(offset, bytes, backtrack_count, r);
+            }
+
+            auto const input_count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            hi_check(input_count != 0, "'GSUB' rule has an empty input sequence.");
+            auto lookup_count = uint16_t{0};
+            if (not chained) {
+                lookup_count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            }
+
+            // The first input coverage is the coverage of the sub-table.
+            r.coverage = otype_coverage{subspan(bytes, *implicit_cast<big_uint16_buf_t>(offset, bytes))};
+            rule.input = parse_coverages(offset, bytes, input_count - 1, r);
+
+            if (chained) {
+                auto const lookahead_count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+                rule.lookahead = parse_coverages(offset, bytes, lookahead_count, r);
+                lookup_count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            }
+            rule.lookups = parse_lookup_records(offset, bytes, lookup_count);
+            r.rule_sets.emplace_back().push_back(std::move(rule));
+
+        } else {
+            throw parse_error("'GSUB' contextual substitution has an unknown format.");
+        }
+    }
+
+    /** Apply a lookup at a position in the buffer.
+     *
+     * @return The number of glyphs to skip over, or std::nullopt if the lookup was not applied.
+     */
+    [[nodiscard]] std::optional<std::size_t>
+    apply_lookup(otype_GSUB_lookup const& lookup, std::vector<otype_GSUB_glyph>& buffer, std::size_t i, std::size_t depth) const
+    {
+        hi_axiom(i < buffer.size());
+
+        for (auto const& subtable : lookup.subtables) {
+            auto const coverage_index = subtable.coverage.find(buffer[i].glyph);
+            if (not coverage_index) {
+                continue;
+            }
+
+            switch (subtable.kind) {
+            case otype_GSUB_subtable::kind_type::single:
+                if (auto const glyph = apply_single(subtable, *coverage_index, buffer[i].glyph)) {
+                    buffer[i].glyph = *glyph;
+                    return 1;
+                }
+                break;
+
+            case otype_GSUB_subtable::kind_type::multiple:
+                if (*coverage_index < subtable.sequences.size()) {
+                    return apply_multiple(subtable.sequences[*coverage_index], buffer, i);
+                }
+                break;
+
+            case otype_GSUB_subtable::kind_type::ligature:
+                if (*coverage_index < subtable.ligature_sets.size()) {
+                    if (apply_ligature(subtable.ligature_sets[*coverage_index], buffer, i)) {
+                        return 1;
+                    }
+                }
+                break;
+
+            case otype_GSUB_subtable::kind_type::context:
+                if (auto const *rules = subtable.find_rules(*coverage_index, buffer[i].glyph)) {
+                    for (auto const& rule : *rules) {
+                        if (matches(subtable, rule, buffer, i)) {
+                            return apply_rule(rule, buffer, i, depth);
+                        }
+                    }
+                }
+                break;
+            }
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<glyph_id> apply_single(otype_GSUB_subtable const& subtable, uint16_t coverage_index, glyph_id glyph) const noexcept
+    {
+        if (subtable.substitutes.empty()) {
+            // Format 1, the addition is modulo 65536.
+            auto const substitute = static_cast<uint16_t>(*glyph + subtable.delta);
+            if (substitute < _num_glyphs) {
+                return glyph_id{substitute};
+            }
+        } else if (coverage_index < subtable.substitutes.size()) {
+            return glyph_id{subtable.substitutes[coverage_index]};
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] static std::size_t
+    apply_multiple(std::vector<uint16_t> const& sequence, std::vector<otype_GSUB_glyph>& buffer, std::size_t i)
+    {
+        auto const cluster = buffer[i].cluster;
+        buffer.erase(buffer.begin() + i);
+
+        auto it = buffer.begin() + i;
+        for (auto const glyph : sequence) {
+            it = buffer.insert(it, otype_GSUB_glyph{glyph_id{glyph}, cluster}) + 1;
+        }
+        return sequence.size();
+    }
+
+    [[nodiscard]] static bool
+    apply_ligature(std::vector<otype_GSUB_ligature> const& ligature_set, std::vector<otype_GSUB_glyph>& buffer, std::size_t i)
+    {
+        for (auto const& ligature : ligature_set) {
+            auto const num_components = ligature.components.size();
+            if (i + num_components >= buffer.size()) {
+                continue;
+            }
+
+            auto match = true;
+            for (auto j = 0_uz; j != num_components; ++j) {
+                match &= *buffer[i + 1 + j].glyph == ligature.components[j];
+            }
+            if (not match) {
+                continue;
+            }
+
+            // The ligature and the glyphs following it in the graphemes of the
+            // components, such as marks, belong to the first grapheme.
+            auto const first_cluster = buffer[i].cluster;
+            auto const last_cluster = buffer[i + num_components].cluster;
+            for (auto j = i + num_components + 1; j < buffer.size() and buffer[j].cluster <= last_cluster; ++j) {
+                buffer[j].cluster = first_cluster;
+            }
+
+            buffer[i].glyph = glyph_id{ligature.glyph};
+            buffer.erase(buffer.begin() + i + 1, buffer.begin() + i + 1 + num_components);
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] static bool matches(
+        otype_GSUB_subtable const& subtable,
+        otype_GSUB_rule const& rule,
+        std::vector<otype_GSUB_glyph> const& buffer,
+        std::size_t i) noexcept
+    {
+        if (rule.backtrack.size() > i or i + rule.input.size() + rule.lookahead.size() >= buffer.size()) {
+            return false;
+        }
+
+        for (auto j = 0_uz; j != rule.backtrack.size(); ++j) {
+            if (not subtable.matches(subtable.backtrack_classes, rule.backtrack[j], buffer[i - 1 - j].glyph)) {
+                return false;
+            }
+        }
+        for (auto j = 0_uz; j != rule.input.size(); ++j) {
+            if (not subtable.matches(subtable.input_classes, rule.input[j], buffer[i + 1 + j].glyph)) {
+                return false;
+            }
+        }
+        auto const lookahead_start = i + 1 + rule.input.size();
+        for (auto j = 0_uz; j != rule.lookahead.size(); ++j) {
+            if (not subtable.matches(subtable.lookahead_classes, rule.lookahead[j], buffer[lookahead_start + j].glyph)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Apply the nested lookups of a matched rule.
+     *
+     * @return The number of glyphs of the input sequence after substitution.
+     */
+    [[nodiscard]] std::size_t
+    apply_rule(otype_GSUB_rule const& rule, std::vector<otype_GSUB_glyph>& buffer, std::size_t i, std::size_t depth) const
+    {
+        auto num_input = rule.input.size() + 1;
+        if (depth == max_nesting_depth) {
+            return num_input;
+        }
+
+        for (auto const& [sequence_index, lookup_index] : rule.lookups) {
+            if (sequence_index >= num_input or i + sequence_index >= buffer.size()) {
+                continue;
+            }
+
+            auto const size_before = buffer.size();
+            std::ignore = apply_lookup(lookups[lookup_index], buffer, i + sequence_index, depth + 1);
+            auto const size_after = buffer.size();
 
+            // A ligature or multiple substitution changes the size of the input sequence.
+            if (size_after >= size_before) {
+                num_input += size_after - size_before;
+            } else {
+                num_input -= std::min(num_input - 1, size_before - size_after);
+            }
+        }
+        return num_input;
+    }
 };
 
-}
+}} // namespace hi::v1
@@ -0,0 +1,164 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "otype_GSUB.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+TEST_SUITE(otype_GSUB) {
+
+/** A 'GSUB' table with the 'liga' and 'calt' features for the 'latn' script.
+ *
+ * Lookup 0, single substitution: 10 -> 20.
+ * Lookup 1, 'liga' feature, ligature substitution: 1 2 3 -> 30, 1 2 -> 31.
+ * Lookup 2, 'calt' feature, chained contextual substitution: 5 [10] 6, applying lookup 0 on 10.
+ */
+[[nodiscard]] static std::vector<std::byte> make_GSUB_table()
+{
+    // clang-format off
+    auto const words = std::vector<uint16_t>{
+        // Header, script-list at 10, feature-list at 32, lookup-list at 58.
+        1, 0, 10, 32, 58,
+        // Script-list: 'latn' script at 8.
+        1, 0x6c61, 0x746e, 8,
+        // Script: default language-system at 4.
+        4, 0,
+        // Language-system: features 0 and 1.
+        0, 0xffff, 2, 0, 1,
+        // Feature-list: 'liga' feature at 14, 'calt' feature at 20.
+        2, 0x6c69, 0x6761, 14, 0x6361, 0x6c74, 20,
+        // Feature 'liga': lookup 1.
+        0, 1, 1,
+        // Feature 'calt': lookup 2.
+        0, 1, 2,
+        // Lookup-list: lookups at 8, 30 and 72.
+        3, 8, 30, 72,
+        // Lookup 0: single substitution, sub-table at 8.
+        1, 0, 1, 8,
+        // Format 2: coverage at 8, 1 substitute.
+        2, 8, 1, 20,
+        // Coverage: glyph 10.
+        1, 1, 10,
+        // Lookup 1: ligature substitution, sub-table at 8.
+        4, 0, 1, 8,
+        // Format 1: coverage at 8, ligature-set at 14.
+        1, 8, 1, 14,
+        // Coverage: glyph 1.
+        1, 1, 1,
+        // Ligature-set: ligatures at 6 and 14.
+        2, 6, 14,
+        // Ligature: 1 2 3 -> 30.
+        30, 3, 2, 3,
+        // Ligature: 1 2 -> 31.
+        31, 2, 2,
+        // Lookup 2: chained contextual substitution, sub-table at 8.
+        6, 0, 1, 8,
+        // Format 3: backtrack coverage at 20, input coverage at 26, lookahead coverage at 32, apply lookup 0 at index 0.
+        3, 1, 20, 1, 26, 1, 32, 1, 0, 0,
+        // Coverage: glyph 5, 10 and 6.
+        1, 1, 5,
+        1, 1, 10,
+        1, 1, 6,
+    };
+    // clang-format on
+
+    auto r = std::vector<std::byte>{};
+    for (auto const word : words) {
+        r.push_back(static_cast<std::byte>(word >> 8));
+        r.push_back(static_cast<std::byte>(word & 0xff));
+    }
+    return r;
+}
+
+[[nodiscard]] static std::vector<hi::otype_GSUB_glyph> make_buffer(std::vector<uint16_t> const& glyphs)
+{
+    auto r = std::vector<hi::otype_GSUB_glyph>{};
+    for (auto const glyph : glyphs) {
+        r.emplace_back(hi::glyph_id{glyph}, r.size());
+    }
+    return r;
+}
+
+TEST_CASE(find_lookups)
+{
+    auto const table = make_GSUB_table();
+    auto const GSUB = hi::otype_GSUB(table, 40);
+
+    auto const liga = std::array{hi::fourcc<"liga">()};
+    auto const liga_calt = std::array{hi::fourcc<"calt">(), hi::fourcc<"liga">()};
+    auto const smcp = std::array{hi::fourcc<"smcp">()};
+
+    auto const liga_lookups = std::vector<uint16_t>{1};
+    auto const liga_calt_lookups = std::vector<uint16_t>{1, 2};
+
+    REQUIRE(GSUB.find_lookups(hi::fourcc<"latn">(), 0, liga) == liga_lookups);
+    REQUIRE(GSUB.find_lookups(hi::fourcc<"latn">(), 0, liga_calt) == liga_calt_lookups);
+    REQUIRE(GSUB.find_lookups(hi::fourcc<"latn">(), 0, smcp).empty());
+
+    // Scripts that are not in the font use the 'latn' script.
+    REQUIRE(GSUB.find_lookups(hi::fourcc<"arab">(), 0, liga) == liga_lookups);
+}
+
+TEST_CASE(ligature)
+{
+    auto const table = make_GSUB_table();
+    auto const GSUB = hi::otype_GSUB(table, 40);
+    auto const lookups = std::vector<uint16_t>{1, 2};
+
+    auto buffer = make_buffer({1, 2, 3, 4});
+    REQUIRE(GSUB.apply(lookups, buffer));
+    REQUIRE(buffer.size() == 2);
+    REQUIRE(buffer[0].glyph == hi::glyph_id{30});
+    REQUIRE(buffer[0].cluster == 0);
+    REQUIRE(buffer[1].glyph == hi::glyph_id{4});
+    REQUIRE(buffer[1].cluster == 3);
+
+    buffer = make_buffer({4, 1, 2, 4});
+    REQUIRE(GSUB.apply(lookups, buffer));
+    REQUIRE(buffer.size() == 3);
+    REQUIRE(buffer[0].glyph == hi::glyph_id{4});
+    REQUIRE(buffer[0].cluster == 0);
+    REQUIRE(buffer[1].glyph == hi::glyph_id{31});
+    REQUIRE(buffer[1].cluster == 1);
+    REQUIRE(buffer[2].glyph == hi::glyph_id{4});
+    REQUIRE(buffer[2].cluster == 3);
+
+    buffer = make_buffer({1, 3});
+    REQUIRE(not GSUB.apply(lookups, buffer));
+    REQUIRE(buffer == make_buffer({1, 3}));
+}
+
+TEST_CASE(chained_context)
+{
+    auto const table = make_GSUB_table();
+    auto const GSUB = hi::otype_GSUB(table, 40);
+    auto const lookups = std::vector<uint16_t>{1, 2};
+
+    auto buffer = make_buffer({5, 10, 6, 10});
+    REQUIRE(GSUB.apply(lookups, buffer));
+    REQUIRE(buffer == make_buffer({5, 20, 6, 10}));
+
+    buffer = make_buffer({7, 10, 6});
+    REQUIRE(not GSUB.apply(lookups, buffer));
+    REQUIRE(buffer == make_buffer({7, 10, 6}));
+}
+
+TEST_CASE(coverage)
+{
+    auto const table = make_GSUB_table();
+    auto const GSUB = hi::otype_GSUB(table, 40);
+
+    REQUIRE(GSUB.lookups.size() == 3);
+    auto const& coverage = GSUB.lookups[0].subtables[0].coverage;
+    REQUIRE(coverage.find(hi::glyph_id{10}) == uint16_t{0});
+    REQUIRE(coverage.find(hi::glyph_id{9}) == std::nullopt);
+    REQUIRE(coverage.find(hi::glyph_id{11}) == std::nullopt);
+    REQUIRE(GSUB.lookups[0].first_glyphs.contains(hi::glyph_id{10}));
+    REQUIRE(not GSUB.lookups[0].first_glyphs.contains(hi::glyph_id{11}));
+}
+
+};
@@ -0,0 +1,106 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "otype_utilities.hpp"
+#include "glyph_id.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.font.otype_class_def);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A class-definition table, decoded into sorted ranges of glyphs.
+ *
+ * A class-definition table assigns a class to glyphs, glyphs that are not
+ * in the table are in class 0.
+ */
+class otype_class_def {
+public:
+    constexpr otype_class_def() noexcept = default;
+
+    /** Decode a class-definition table.
+     *
+     * Consecutive glyphs of a format 1 table with the same class are merged into ranges.
+     */
+    explicit otype_class_def(std::span<std::byte const> bytes)
+    {
+        struct range_buf_type {
+            big_uint16_buf_t start_glyph_id;
+            big_uint16_buf_t end_glyph_id;
+            big_uint16_buf_t klass;
+        };
+
+        auto offset = 0_uz;
+        auto const format = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        if (format == 1) {
+            auto glyph = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            for (auto const& klass_buf : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+                auto const klass = *klass_buf;
+                if (klass != 0) {
+                    if (not _ranges.empty() and _ranges.back().last + 1 == glyph and _ranges.back().klass == klass) {
+                        _ranges.back().last = glyph;
+                    } else {
+                        _ranges.push_back(range_type{glyph, glyph, klass});
+                    }
+                }
+                ++glyph;
+            }
+
+        } else if (format == 2) {
+            auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+            _ranges.reserve(count);
+            for (auto const& range : implicit_cast<range_buf_type>(offset, bytes, count)) {
+                hi_check(*range.start_glyph_id <= *range.end_glyph_id, "Class-definition range is invalid.");
+                _ranges.push_back(range_type{*range.start_glyph_id, *range.end_glyph_id, *range.klass});
+            }
+
+        } else {
+            throw parse_error("Class-definition table has an unknown format.");
+        }
+
+        std::sort(_ranges.begin(), _ranges.end(), [](auto const& lhs, auto const& rhs) {
+            return lhs.first < rhs.first;
+        });
+    }
+
+    /** Find the class of a glyph.
+     *
+     * @return The class of the glyph, or 0 if the glyph is not in the table.
+     */
+    [[nodiscard]] uint16_t find(glyph_id glyph) const noexcept
+    {
+        auto const g = *glyph;
+        auto it = std::upper_bound(_ranges.begin(), _ranges.end(), g, [](uint16_t lhs, auto const& rhs) {
+            return lhs < rhs.first;
+        });
+
+        if (it == _ranges.begin()) {
+            return 0;
+        }
+        --it;
+        return g <= it->last ? it->klass : uint16_t{0};
+    }
+
+private:
+    struct range_type {
+        uint16_t first;
+        uint16_t last;
+        uint16_t klass;
+    };
+
+    /** The ranges, sorted by their first glyph.
+     */
+    std::vector<range_type> _ranges;
+};
+
+}} // namespace hi::v1
@@ -4,72 +4,152 @@
 
 #pragma once
 
-#include "../geometry/geometry.hpp"
-#include "../telemetry/telemetry.hpp"
+#include "otype_utilities.hpp"
+#include "glyph_id.hpp"
 #include "../utility/utility.hpp"
-#include "../parser/parser.hpp"
-#include <cstddef>
+#include "../macros.hpp"
 #include <span>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 
 hi_export_module(hikogui.font.otype_coverage);
 
-hi_export namespace hi::inline v1 {
-
-struct coverage_format1 {
-    big_int16_buf_t coverage_format;
-    big_int16_buf_t glyph_count;
-};
-
-struct coverage_format2 {
-    big_int16_buf_t coverage_format;
-    big_int16_buf_t range_count;
-};
+hi_export namespace hi { inline namespace v1 {
+
+/** A coverage table, decoded into sorted ranges of glyphs.
+ *
+ * A coverage table maps a glyph to a coverage-index, which is used by
+ * the sub-tables of the 'GSUB' and 'GPOS' tables to index their data.
+ */
+class otype_coverage {
+public:
+    struct range_type {
+        uint16_t first;
+        uint16_t last;
+        uint16_t start_index;
+    };
+
+    constexpr otype_coverage() noexcept = default;
+
+    /** Decode a coverage table.
+     *
+     * Individual glyphs of a format 1 coverage table are merged into ranges.
+     */
+    explicit otype_coverage(std::span<std::byte const> bytes)
+    {
+        struct range_buf_type {
+            big_uint16_buf_t start_glyph_id;
+            big_uint16_buf_t end_glyph_id;
+            big_uint16_buf_t start_coverage_index;
+        };
+
+        auto offset = 0_uz;
+        auto const format = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+        auto const count = *implicit_cast<big_uint16_buf_t>(offset, bytes);
+
+        if (format == 1) {
+            auto index = uint16_t{0};
+            for (auto const& glyph_buf : implicit_cast<big_uint16_buf_t>(offset, bytes, count)) {
+                auto const glyph = *glyph_buf;
+                if (not _ranges.empty() and _ranges.back().last + 1 == glyph) {
+                    _ranges.back().last = glyph;
+                } else {
+                    _ranges.push_back(range_type{glyph, glyph, index});
+                }
+                ++index;
+            }
+
+        } else if (format == 2) {
+            _ranges.reserve(count);
+            for (auto const& range : implicit_cast<range_buf_type>(offset, bytes, count)) {
+                hi_check(*range.start_glyph_id <= *range.end_glyph_id, "Coverage range is invalid.");
+                _ranges.push_back(range_type{*range.start_glyph_id, *range.end_glyph_id, *range.start_coverage_index});
+            }
 
-struct coverage_format2_range {
-    big_int16_buf_t start_glyph_id;
-    big_int16_buf_t end_glyph_id;
-    big_int16_buf_t start_coverage_index;
-};
+        } else {
+            throw parse_error("Coverage table has an unknown format.");
+        }
 
-[[nodiscard]] std::ptrdiff_t true_type_font::get_coverage_index(std::span<std::byte const> bytes, hi::glyph_id glyph_id)
-{
-    std::size_t offset = 0;
+        std::sort(_ranges.begin(), _ranges.end(), [](auto const& lhs, auto const& rhs) {
+            return lhs.first < rhs.first;
+        });
+    }
 
-    hi_assert_or_return(*glyph_id >= 0 && *glyph_id < num_glyphs, -2);
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _ranges.empty();
+    }
 
-    auto const header1 = make_placement_ptr<coverage_format1>(bytes, offset);
-    if (*header1->coverage_format == 1) {
-        auto const table = make_placement_array<big_uint16_buf_t>(bytes, offset, *header1->glyph_count);
+    [[nodiscard]] std::vector<range_type> const& ranges() const noexcept
+    {
+        return _ranges;
+    }
 
-        auto const it = std::lower_bound(table.begin(), table.end(), glyph_id, [](auto const &item, auto const &value) {
-            return *item < *value;
+    /** Find the coverage-index of a glyph.
+     *
+     * @return The coverage-index, or std::nullopt if the glyph is not covered.
+     */
+    [[nodiscard]] std::optional<uint16_t> find(glyph_id glyph) const noexcept
+    {
+        auto const g = *glyph;
+        auto it = std::upper_bound(_ranges.begin(), _ranges.end(), g, [](uint16_t lhs, auto const& rhs) {
+            return lhs < rhs.first;
         });
 
-        if (it != table.end() and **it == *glyph_id) {
-            return std::distance(table.begin(), it);
-        } else {
-            return -1;
+        if (it == _ranges.begin()) {
+            return std::nullopt;
         }
+        --it;
+        if (g > it->last) {
+            return std::nullopt;
+        }
+        return narrow_cast<uint16_t>(it->start_index + (g - it->first));
+    }
 
-    } else if (*header1->coverage_format == 2) {
-        offset = 0;
-        auto const header2 = make_placement_ptr<coverage_format2>(bytes, offset);
-
-        auto const table = make_placement_array<coverage_format2_range>(bytes, offset, *header2->range_count);
+    [[nodiscard]] bool contains(glyph_id glyph) const noexcept
+    {
+        return find(glyph).has_value();
+    }
 
-        auto const it = std::lower_bound(table.begin(), table.end(), glyph_id, [](auto const &item, auto const &value) {
-            return *item.end_glyph_id < *value;
-        });
+private:
+    /** The ranges, sorted by their first glyph.
+     */
+    std::vector<range_type> _ranges;
+};
 
-        if (it != table.end() and *it->start_glyph_id <= *glyph_id and *glyph_id <= *it->end_glyph_id) {
-            return *it->start_coverage_index + *glyph_id - *it->start_glyph_id;
-        } else {
-            return -1;
+/** A set of glyphs, implemented as a bitset.
+ *
+ * Used to quickly check if a glyph is covered by any sub-table of a lookup.
+ */
+class otype_glyph_set {
+public:
+    constexpr otype_glyph_set() noexcept = default;
+
+    void add(otype_coverage const& coverage)
+    {
+        for (auto const& range : coverage.ranges()) {
+            auto const size = (wide_cast<std::size_t>(range.last) >> 6) + 1;
+            if (_bits.size() < size) {
+                _bits.resize(size, 0);
+            }
+
+            for (auto glyph = wide_cast<std::size_t>(range.first); glyph <= range.last; ++glyph) {
+                _bits[glyph >> 6] |= uint64_t{1} << (glyph & 63);
+            }
         }
+    }
 
-    } else {
-        return -2;
+    [[nodiscard]] bool contains(glyph_id glyph) const noexcept
+    {
+        auto const i = wide_cast<std::size_t>(*glyph) >> 6;
+        return i < _bits.size() and to_bool((_bits[i] >> (*glyph & 63)) & 1);
     }
-}
 
-} // namespace hi::inline v1
+private:
+    std::vector<uint64_t> _bits;
+};
+
+}} // namespace hi::v1
@@ -9,6 +9,7 @@
 #include "../macros.hpp"
 #include <variant>
 #include <coroutine>
+#include <vector>
 
 hi_export_module(hikogui.font.otype_glyf);
 
@@ -44,13 +45,25 @@ struct otype_glyf_header {
 
 } // namespace detail
 
-/** Get the graphic-path of a simple glyph.
+/** Scratch buffers to decode the points of a simple glyph.
  *
+ * Reusing the buffers for many glyphs avoids allocating them for each glyph.
+ */
+struct otype_glyf_buffers {
+    std::vector<uint8_t> flags;
+    std::vector<int16_t> x_deltas;
+    std::vector<int16_t> y_deltas;
+};
+
+/** Get the graphic-path of a simple glyph.
  *
  * @note Only call this function when `otype_glyf_is_compound() == false`.
+ * @param bytes The bytes of the glyph in the 'glyf' table.
+ * @param em_scale The scale to convert font-units to em.
+ * @param buffers The scratch buffers used while decoding.
  */
 [[nodiscard]] inline graphic_path
-otype_glyf_get_path(std::span<std::byte const> bytes, float em_scale)
+otype_glyf_get_path(std::span<std::byte const> bytes, float em_scale, otype_glyf_buffers& buffers)
 {
     auto r = graphic_path{};
 
@@ -86,7 +99,8 @@ otype_glyf_get_path(std::span<std::byte const> bytes, float em_scale)
     offset += instruction_size;
 
     // Extract all the flags.
-    auto flags = std::vector<uint8_t>(num_points, uint8_t{0});
+    auto& flags = buffers.flags;
+    flags.assign(num_points, uint8_t{0});
     for (auto i = 0_uz; i != num_points; ++i) {
         auto const flag = implicit_cast<uint8_t>(offset, bytes);
 
@@ -102,7 +116,8 @@ otype_glyf_get_path(std::span<std::byte const> bytes, float em_scale)
     }
 
     // Get xCoordinates
-    auto x_deltas = std::vector<int16_t>(num_points, int16_t{0});
+    auto& x_deltas = buffers.x_deltas;
+    x_deltas.assign(num_points, int16_t{0});
     for (auto i = 0_uz; i != num_points; ++i) {
         auto const flag = flags[i];
 
@@ -124,7 +139,8 @@ otype_glyf_get_path(std::span<std::byte const> bytes, float em_scale)
     }
 
     // Get yCoordinates
-    auto y_deltas = std::vector<int16_t>(num_points, int16_t{0});
+    auto& y_deltas = buffers.y_deltas;
+    y_deltas.assign(num_points, int16_t{0});
     for (auto i = 0_uz; i != num_points; ++i) {
         auto const flag = flags[i];
 
@@ -163,6 +179,16 @@ otype_glyf_get_path(std::span<std::byte const> bytes, float em_scale)
     return r;
 }
 
+/** Get the graphic-path of a simple glyph.
+ *
+ * @note Only call this function when `otype_glyf_is_compound() == false`.
+ */
+[[nodiscard]] inline graphic_path otype_glyf_get_path(std::span<std::byte const> bytes, float em_scale)
+{
+    auto buffers = otype_glyf_buffers{};
+    return otype_glyf_get_path(bytes, em_scale, buffers);
+}
+
 struct otype_glyf_component {
     hi::glyph_id glyph_id = {};
     vector2 offset = {};
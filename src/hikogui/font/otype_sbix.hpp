@@ -0,0 +1,121 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "otype_utilities.hpp"
+#include "glyph_id.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <optional>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.font.otype_sbix);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Get the size in pixels of a PNG image from its header.
+ */
+[[nodiscard]] inline extent2 otype_png_size(std::span<std::byte const> bytes)
+{
+    struct header_type {
+        std::array<uint8_t, 8> signature;
+        big_uint32_buf_t IHDR_length;
+        big_uint32_buf_t IHDR_type;
+        big_uint32_buf_t width;
+        big_uint32_buf_t height;
+    };
+
+    auto const& header = implicit_cast<header_type>(bytes);
+    hi_check(*header.IHDR_type == fourcc<"IHDR">(), "Bitmap glyph is not a PNG image.");
+    return extent2{narrow_cast<float>(*header.width), narrow_cast<float>(*header.height)};
+}
+
+/** Get a bitmap glyph from the 'sbix' table.
+ *
+ * The strike with the largest pixels-per-em is used, the image is scaled when drawn.
+ *
+ * @param bytes The 'sbix' table.
+ * @param glyph The glyph to get.
+ * @param num_glyphs The number of glyphs in the font.
+ * @return The PNG image and bounding rectangle of the glyph, or empty if the glyph has no PNG bitmap.
+ */
+[[nodiscard]] inline std::optional<otype_bitmap_glyph>
+otype_sbix_get(std::span<std::byte const> bytes, hi::glyph_id glyph, std::size_t num_glyphs)
+{
+    struct header_type {
+        big_uint16_buf_t version;
+        big_uint16_buf_t flags;
+        big_uint32_buf_t num_strikes;
+    };
+
+    struct strike_type {
+        big_uint16_buf_t ppem;
+        big_uint16_buf_t ppi;
+    };
+
+    struct glyph_data_type {
+        big_int16_buf_t origin_offset_x;
+        big_int16_buf_t origin_offset_y;
+        big_uint32_buf_t graphic_type;
+    };
+
+    auto offset = 0_uz;
+    auto const& header = implicit_cast<header_type>(offset, bytes);
+    auto const strike_offsets = implicit_cast<big_uint32_buf_t>(offset, bytes, *header.num_strikes);
+
+    auto best_strike = std::span<std::byte const>{};
+    auto best_ppem = uint16_t{0};
+    for (auto const& strike_offset : strike_offsets) {
+        auto const strike_bytes = hi_check_subspan(bytes, *strike_offset);
+        auto const& strike = implicit_cast<strike_type>(strike_bytes);
+        if (*strike.ppem > best_ppem) {
+            best_ppem = *strike.ppem;
+            best_strike = strike_bytes;
+        }
+    }
+
+    if (best_ppem == 0) {
+        return std::nullopt;
+    }
+
+    // Follow 'dupe' graphics, but not indefinitely.
+    for (auto i = 0; i != 2; ++i) {
+        offset = sizeof(strike_type);
+        auto const glyph_data_offsets = implicit_cast<big_uint32_buf_t>(offset, best_strike, num_glyphs + 1);
+
+        auto const first = wide_cast<std::size_t>(*hi_check_at(glyph_data_offsets, *glyph));
+        auto const last = wide_cast<std::size_t>(*hi_check_at(glyph_data_offsets, *glyph + 1));
+        if (last <= first + sizeof(glyph_data_type)) {
+            return std::nullopt;
+        }
+
+        auto const glyph_bytes = hi_check_subspan(best_strike, first, last - first);
+        offset = 0;
+        auto const& glyph_data = implicit_cast<glyph_data_type>(offset, glyph_bytes);
+        auto const data = glyph_bytes.subspan(offset);
+
+        if (*glyph_data.graphic_type == fourcc<"dupe">()) {
+            glyph = glyph_id{*implicit_cast<big_uint16_buf_t>(data)};
+            continue;
+
+        } else if (*glyph_data.graphic_type != fourcc<"png ">()) {
+            // JPEG and TIFF images are not supported.
+            return std::nullopt;
+        }
+
+        auto const size = otype_png_size(data);
+        auto const scale = 1.0f / best_ppem;
+        return otype_bitmap_glyph{
+            data,
+            aarectangle{
+                *glyph_data.origin_offset_x * scale, *glyph_data.origin_offset_y * scale, size.width() * scale, size.height() * scale}};
+    }
+    return std::nullopt;
+}
+
+}} // namespace hi::v1
@@ -6,41 +6,54 @@
 
 #include "otype_utilities.hpp"
 #include "../utility/utility.hpp"
+#include "../codec/SHA2.hpp"
+#include "../container/container.hpp"
 #include "../macros.hpp"
 #include <span>
 #include <cstddef>
+#include <cstdint>
+#include <array>
 
 hi_export_module(hikogui.font.otype_sfnt);
 
 hi_export namespace hi {
 inline namespace v1 {
 
-template<fixed_string Name>
-[[nodiscard]] inline std::span<std::byte const> otype_sfnt_search(std::span<std::byte const> bytes)
-{
-    struct header_type {
-        big_uint32_buf_t scaler_type;
-        big_uint16_buf_t num_tables;
-        big_uint16_buf_t search_range;
-        big_uint16_buf_t entry_selector;
-        big_uint16_buf_t range_shift;
-    };
-
-    struct entry_type {
-        big_uint32_buf_t tag;
-        big_uint32_buf_t check_sum;
-        big_uint32_buf_t offset;
-        big_uint32_buf_t length;
-    };
+namespace detail {
+
+struct otype_sfnt_header_type {
+    big_uint32_buf_t scaler_type;
+    big_uint16_buf_t num_tables;
+    big_uint16_buf_t search_range;
+    big_uint16_buf_t entry_selector;
+    big_uint16_buf_t range_shift;
+};
+
+struct otype_sfnt_entry_type {
+    big_uint32_buf_t tag;
+    big_uint32_buf_t check_sum;
+    big_uint32_buf_t offset;
+    big_uint32_buf_t length;
+};
 
+[[nodiscard]] inline std::span<otype_sfnt_entry_type const> otype_sfnt_entries(std::span<std::byte const> bytes)
+{
     std::size_t offset = 0;
-    auto const& header = implicit_cast<header_type>(offset, bytes);
+    auto const& header = implicit_cast<otype_sfnt_header_type>(offset, bytes);
 
     if (not (*header.scaler_type == "true"_fcc or *header.scaler_type == 0x00010000)) {
         throw parse_error("sfnt.scalerType is not 'true' or 0x00010000");
     }
 
-    auto const entries = implicit_cast<entry_type>(offset, bytes, *header.num_tables);
+    return implicit_cast<otype_sfnt_entry_type>(offset, bytes, *header.num_tables);
+}
+
+} // namespace detail
+
+template<fixed_string Name>
+[[nodiscard]] inline std::span<std::byte const> otype_sfnt_search(std::span<std::byte const> bytes)
+{
+    auto const entries = detail::otype_sfnt_entries(bytes);
 
     if (auto const entry = fast_binary_search_eq<std::endian::big>(entries, fourcc<Name>())) {
         return hi_check_subspan(bytes, *entry->offset, *entry->length);
@@ -49,4 +62,34 @@ template<fixed_string Name>
     }
 }
 
+/** Calculate a hash of a font file.
+ *
+ * Only the table directory and the size of the file is hashed. The table
+ * directory includes the check-sum and length of each table, so the hash
+ * changes when the font changes, without reading the complete file.
+ *
+ * @param bytes The bytes of the font file.
+ * @return A non-zero hash of the font.
+ */
+[[nodiscard]] inline uint64_t otype_sfnt_hash(std::span<std::byte const> bytes)
+{
+    auto const entries = detail::otype_sfnt_entries(bytes);
+    auto const directory_size = sizeof(detail::otype_sfnt_header_type) + entries.size_bytes();
+
+    auto size_bytes = std::array<std::byte, sizeof(uint64_t)>{};
+    for (auto i = 0_uz; i != size_bytes.size(); ++i) {
+        size_bytes[i] = static_cast<std::byte>(static_cast<uint64_t>(bytes.size()) >> (i * 8));
+    }
+
+    auto hash = SHA256{};
+    hash.add(size_bytes.data(), size_bytes.data() + size_bytes.size(), false);
+    hash.add(bytes.first(directory_size));
+
+    auto r = uint64_t{0};
+    for (auto const b : hash.get_bytes().substr(0, sizeof(r))) {
+        r = (r << 8) | static_cast<uint8_t>(b);
+    }
+    return r == 0 ? 1 : r;
+}
+
 }}
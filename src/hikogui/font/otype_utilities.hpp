@@ -6,8 +6,12 @@
 
 #include "../utility/utility.hpp"
 #include "../parser/parser.hpp"
+#include "../geometry/geometry.hpp"
 #include "../macros.hpp"
 #include <concepts>
+#include <string_view>
+#include <span>
+#include <cstdint>
 
 hi_export_module(hikogui.font.otype_utilities);
 
@@ -65,6 +69,18 @@ struct otype_fuword_buf_t {
     }
 };
 
+/** A bitmap glyph from the 'sbix' or 'CBDT' table.
+ */
+struct otype_bitmap_glyph {
+    /** The PNG encoded image of the glyph.
+     */
+    std::span<std::byte const> png;
+
+    /** The rectangle to draw the image in, in em-units relative to the glyph origin.
+     */
+    aarectangle bounding_rectangle;
+};
+
 inline std::optional<std::string>
 otype_get_string(std::span<std::byte const> bytes, uint16_t platform_id, uint16_t platform_specific_id)
 {
@@ -93,4 +109,19 @@ otype_get_string(std::span<std::byte const> bytes, uint16_t platform_id, uint16_
     return {};
 }
 
+/** Convert a string to an open-type tag.
+ *
+ * @param str A string of up to 4 characters, it is padded with spaces.
+ * @return The tag as a 32-bit big-endian integer, like `fourcc()`.
+ */
+[[nodiscard]] constexpr uint32_t otype_tag(std::string_view str) noexcept
+{
+    auto r = uint32_t{0};
+    for (auto i = 0_uz; i != 4; ++i) {
+        r <<= 8;
+        r |= i < str.size() ? static_cast<uint8_t>(str[i]) : uint8_t{' '};
+    }
+    return r;
+}
+
 }} // namespace hi::v1
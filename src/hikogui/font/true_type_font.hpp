@@ -7,8 +7,13 @@
 #include "font_font.hpp"
 #include "otype_utilities.hpp"
 #include "otype_sfnt.hpp"
+#include "otype_CBDT.hpp"
 #include "otype_cmap.hpp"
+#include "otype_COLR.hpp"
+#include "otype_CPAL.hpp"
 #include "otype_glyf.hpp"
+#include "otype_GPOS.hpp"
+#include "otype_GSUB.hpp"
 #include "otype_head.hpp"
 #include "otype_hhea.hpp"
 #include "otype_hmtx.hpp"
@@ -17,13 +22,24 @@
 #include "otype_maxp.hpp"
 #include "otype_name.hpp"
 #include "otype_os2.hpp"
+#include "otype_sbix.hpp"
 #include "font_char_map.hpp"
+#include "font_index_cache.hpp"
 #include "../file/file_view.hpp"
+#include "../codec/codec.hpp"
 #include "../graphic_path/graphic_path.hpp"
 #include "../telemetry/telemetry.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../container/container.hpp"
 #include "../utility/utility.hpp"
 #include <memory>
 #include <filesystem>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <array>
+#include <utility>
+#include <algorithm>
 
 hi_export_module(hikogui.font.true_type_font);
 
@@ -37,6 +53,7 @@ public:
         try {
             _bytes = as_span<std::byte const>(_view);
             parse_font_directory(_bytes);
+            file_hash = otype_sfnt_hash(_bytes);
 
             // Clear the view to reclaim resources.
             _view = {};
@@ -48,6 +65,35 @@ public:
         }
     }
 
+    /** Create a font from the properties stored in the font index.
+     *
+     * The font file is not opened until the glyphs or metrics of glyphs are needed.
+     *
+     * @param path The path to the font file.
+     * @param record The properties of the font file, retrieved from the font index.
+     */
+    true_type_font(std::filesystem::path const& path, font_index_record record) : _path(path)
+    {
+        family_name = std::move(record.family_name);
+        sub_family_name = std::move(record.sub_family_name);
+        features = std::move(record.features);
+        weight = record.weight;
+        style = record.style;
+        condensed = record.condensed;
+        serif = record.serif;
+        monospace = record.monospace;
+        metrics = record.metrics;
+        char_map = std::move(record.char_map);
+        file_hash = record.file_hash;
+
+        _em_scale = record.em_scale;
+        OS2_x_height = record.OS2_x_height;
+        OS2_cap_height = record.OS2_cap_height;
+        num_glyphs = narrow_cast<int>(record.num_glyphs);
+        _num_horizontal_metrics = record.num_horizontal_metrics;
+        _loca_is_offset32 = record.loca_is_offset32;
+    }
+
     true_type_font() = delete;
     true_type_font(true_type_font const& other) = delete;
     true_type_font& operator=(true_type_font const& other) = delete;
@@ -55,16 +101,248 @@ public:
     true_type_font& operator=(true_type_font&& other) = delete;
     ~true_type_font() = default;
 
+    /** The properties of the font to store in the font index.
+     */
+    [[nodiscard]] font_index_record index_record() const noexcept
+    {
+        auto r = font_index_record{};
+        r.family_name = family_name;
+        r.sub_family_name = sub_family_name;
+        r.features = features;
+        r.weight = weight;
+        r.style = style;
+        r.condensed = condensed;
+        r.serif = serif;
+        r.monospace = monospace;
+        r.metrics = metrics;
+        r.char_map = char_map;
+        r.file_hash = file_hash;
+
+        r.em_scale = _em_scale;
+        r.OS2_x_height = OS2_x_height;
+        r.OS2_cap_height = OS2_cap_height;
+        r.num_glyphs = narrow_cast<uint32_t>(num_glyphs);
+        r.num_horizontal_metrics = _num_horizontal_metrics;
+        r.loca_is_offset32 = _loca_is_offset32;
+        return r;
+    }
+
     [[nodiscard]] bool loaded() const noexcept override
     {
         return to_bool(_view);
     }
 
     [[nodiscard]] graphic_path get_path(hi::glyph_id glyph_id) const override
+    {
+        {
+            auto const lock = std::scoped_lock(_glyph_path_mutex);
+            if (auto const *cached = _glyph_path_cache.find(glyph_id)) {
+                ++global_counter<"ttf:glyph_path:hit">;
+                return *cached;
+            }
+        }
+        ++global_counter<"ttf:glyph_path:miss">;
+
+        auto r = get_path_uncached(glyph_id);
+
+        auto const lock = std::scoped_lock(_glyph_path_mutex);
+        _glyph_path_cache.insert(glyph_id, r, glyph_path_cost(r));
+        return r;
+    }
+
+    [[nodiscard]] float get_advance(hi::glyph_id glyph_id) const override
+    {
+        load_view();
+
+        hi_check(*glyph_id < num_glyphs, "glyph_id is not valid in this font.");
+        auto const[advance_width, left_side_bearing] = otype_hmtx_get(_hmtx_table_bytes, glyph_id, _num_horizontal_metrics, _em_scale);
+        return advance_width;
+    }
+
+    [[nodiscard]] glyph_metrics get_metrics(hi::glyph_id glyph_id) const override
+    {
+        load_view();
+
+        hi_check(*glyph_id < num_glyphs, "glyph_id is not valid in this font.");
+
+        auto r = glyph_metrics{};
+        if (auto const layers = get_color_layers(glyph_id); not layers.empty()) {
+            // The base glyph of a color glyph often has an empty outline.
+            for (auto const& layer : layers) {
+                r.bounding_rectangle |= layer.bounding_rectangle;
+            }
+
+        } else if (auto const bitmap = find_bitmap(glyph_id)) {
+            r.bounding_rectangle = bitmap->bounding_rectangle;
+
+        } else if (not _glyf_table_bytes.empty()) {
+            auto const glyph_bytes = otype_loca_get(_loca_table_bytes, _glyf_table_bytes, glyph_id, _loca_is_offset32);
+
+            if (otype_glyf_is_compound(glyph_bytes)) {
+                for (auto const& component : otype_glyf_get_compound(glyph_bytes, _em_scale)) {
+                    if (component.use_for_metrics) {
+                        return get_metrics(component.glyph_id);
+                    }
+                }
+            }
+
+            r.bounding_rectangle = otype_glyf_get_bounding_box(glyph_bytes, _em_scale);
+        }
+
+        auto const[advance_width, left_side_bearing] = otype_hmtx_get(_hmtx_table_bytes, glyph_id, _num_horizontal_metrics, _em_scale);
+
+        r.advance = advance_width;
+        r.left_side_bearing = left_side_bearing;
+        r.right_side_bearing = advance_width - (left_side_bearing + r.bounding_rectangle.width());
+        return r;
+    }
+
+    [[nodiscard]] std::span<color_layer_type const> get_color_layers(hi::glyph_id glyph_id) const override
+    {
+        load_view();
+        if (_COLR_table_bytes.empty()) {
+            return {};
+        }
+
+        try {
+            auto COLR_layers = std::span<otype_COLR_layer const>{};
+            {
+                auto const lock = std::scoped_lock(_COLR_mutex);
+                if (not _COLR) {
+                    ++global_counter<"ttf:COLR:decode">;
+                    _COLR = std::make_unique<otype_COLR const>(_COLR_table_bytes, narrow_cast<std::size_t>(num_glyphs));
+                    _CPAL_palette = otype_CPAL_get_palette(_CPAL_table_bytes);
+                }
+
+                if (auto const it = _color_layers.find(glyph_id); it != _color_layers.end()) {
+                    return it->second;
+                }
+                COLR_layers = _COLR->find(glyph_id);
+            }
+
+            // The bounding rectangles are read from the 'glyf' table outside of the lock.
+            auto layers = std::vector<color_layer_type>{};
+            layers.reserve(COLR_layers.size());
+            for (auto const& layer : COLR_layers) {
+                auto const bounding_rectangle = get_outline_bounding_rectangle(layer.glyph);
+                if (layer.palette_index == otype_COLR::foreground_palette_index) {
+                    layers.push_back(color_layer_type{layer.glyph, color{}, true, bounding_rectangle});
+                } else {
+                    auto const layer_color = hi_check_at(_CPAL_palette, layer.palette_index);
+                    layers.push_back(color_layer_type{layer.glyph, layer_color, false, bounding_rectangle});
+                }
+            }
+
+            auto const lock = std::scoped_lock(_COLR_mutex);
+            return _color_layers.emplace(glyph_id, std::move(layers)).first->second;
+
+        } catch (std::exception const& e) {
+            hi_log_error("Turning off invalid 'COLR' table in font '{} {}': {}", family_name, sub_family_name, e.what());
+            _COLR_table_bytes = {};
+            return {};
+        }
+    }
+
+    [[nodiscard]] bool has_bitmaps() const noexcept override
+    {
+        load_view();
+        return not _sbix_table_bytes.empty() or not _CBDT_table_bytes.empty();
+    }
+
+    [[nodiscard]] std::optional<bitmap_type> get_bitmap(hi::glyph_id glyph_id) const override
+    {
+        auto const bitmap = find_bitmap(glyph_id);
+        if (not bitmap) {
+            return std::nullopt;
+        }
+
+        ++global_counter<"ttf:bitmap:decode">;
+        return bitmap_type{png::load(bitmap->png), bitmap->bounding_rectangle};
+    }
+
+    [[nodiscard]] shape_run_result_type shape_run(iso_639 language, iso_15924 script, gstring run) const override
+    {
+        auto key = shape_run_key{language, script, std::move(run)};
+        {
+            auto const lock = std::scoped_lock(_shape_run_mutex);
+            if (auto const *cached = _shape_run_cache.find(key)) {
+                ++global_counter<"ttf:shape_run:hit">;
+                return *cached;
+            }
+        }
+        ++global_counter<"ttf:shape_run:miss">;
+
+        // Shape outside of the lock, when two threads shape the same run at
+        // the same time the last one will replace the entry in the cache.
+        auto r = shape_run_uncached(key.script, key.run);
+
+        auto const lock = std::scoped_lock(_shape_run_mutex);
+        _shape_run_cache.insert(std::move(key), r);
+        return r;
+    }
+
+private:
+    /** The key of the shape-run cache.
+     *
+     * The cache is owned by the font, so the font itself is not part of the key.
+     */
+    struct shape_run_key {
+        iso_639 language;
+        iso_15924 script;
+        gstring run;
+
+        [[nodiscard]] friend bool operator==(shape_run_key const&, shape_run_key const&) noexcept = default;
+    };
+
+    struct shape_run_key_hash {
+        [[nodiscard]] std::size_t operator()(shape_run_key const& rhs) const noexcept
+        {
+            return hash_mix(rhs.language, rhs.script, rhs.run);
+        }
+    };
+
+    /** The maximum number of shaped runs that are retained by each font.
+     */
+    constexpr static std::size_t shape_run_cache_capacity = 1024;
+
+    mutable unfair_mutex _shape_run_mutex;
+
+    /** The most recently shaped runs, unscaled.
+     *
+     * Labels often contain the same words, which do not need to be shaped again.
+     */
+    mutable lru_cache<shape_run_key, shape_run_result_type, shape_run_key_hash> _shape_run_cache{shape_run_cache_capacity};
+
+    /** The maximum total size in bytes of the glyph paths that are retained by each font.
+     */
+    constexpr static std::size_t glyph_path_cache_capacity = 1024 * 1024;
+
+    /** Protects `_glyph_path_cache`, glyphs are decoded without holding it.
+     */
+    mutable unfair_mutex _glyph_path_mutex;
+
+    /** The most recently decoded glyph paths.
+     *
+     * The paths of compound glyphs are stored flattened, so that their components
+     * do not need to be transformed and combined again.
+     */
+    mutable lru_cache<hi::glyph_id, graphic_path> _glyph_path_cache{glyph_path_cache_capacity};
+
+    [[nodiscard]] static std::size_t glyph_path_cost(graphic_path const& path) noexcept
+    {
+        return sizeof(graphic_path) + path.points.size() * sizeof(bezier_point) +
+            path.contourEndPoints.size() * sizeof(ssize_t) + path.layerEndContours.size() * sizeof(std::pair<ssize_t, color>);
+    }
+
+    [[nodiscard]] graphic_path get_path_uncached(hi::glyph_id glyph_id) const
     {
         load_view();
 
         hi_check(*glyph_id < num_glyphs, "glyph_id is not valid in this font.");
+        if (_glyf_table_bytes.empty()) {
+            // Fonts with only bitmap glyphs, like 'CBDT' emoji fonts, have no outlines.
+            return {};
+        }
 
         auto const glyph_bytes = otype_loca_get(_loca_table_bytes, _glyf_table_bytes, glyph_id, _loca_is_offset32);
 
@@ -88,54 +366,88 @@ public:
             return r;
 
         } else {
-            return otype_glyf_get_path(glyph_bytes, _em_scale);
+            // The scratch buffers are per thread, so that glyphs are decoded without holding a lock.
+            thread_local auto buffers = otype_glyf_buffers{};
+            return otype_glyf_get_path(glyph_bytes, _em_scale, buffers);
         }
     }
 
-    [[nodiscard]] float get_advance(hi::glyph_id glyph_id) const override
-    {
-        load_view();
-
-        hi_check(*glyph_id < num_glyphs, "glyph_id is not valid in this font.");
-        auto const[advance_width, left_side_bearing] = otype_hmtx_get(_hmtx_table_bytes, glyph_id, _num_horizontal_metrics, _em_scale);
-        return advance_width;
-    }
-
-    [[nodiscard]] glyph_metrics get_metrics(hi::glyph_id glyph_id) const override
+    /** Get the bounding rectangle of the outline of a glyph, the glyph must be loaded.
+     */
+    [[nodiscard]] aarectangle get_outline_bounding_rectangle(hi::glyph_id glyph_id) const
     {
-        load_view();
-
         hi_check(*glyph_id < num_glyphs, "glyph_id is not valid in this font.");
+        if (_glyf_table_bytes.empty()) {
+            return {};
+        }
 
         auto const glyph_bytes = otype_loca_get(_loca_table_bytes, _glyf_table_bytes, glyph_id, _loca_is_offset32);
-
         if (otype_glyf_is_compound(glyph_bytes)) {
             for (auto const& component : otype_glyf_get_compound(glyph_bytes, _em_scale)) {
                 if (component.use_for_metrics) {
-                    return get_metrics(component.glyph_id);
+                    return get_outline_bounding_rectangle(component.glyph_id);
                 }
             }
         }
+        return otype_glyf_get_bounding_box(glyph_bytes, _em_scale);
+    }
 
-        auto r = glyph_metrics{};
-        r.bounding_rectangle = otype_glyf_get_bounding_box(glyph_bytes, _em_scale);
-        auto const[advance_width, left_side_bearing] = otype_hmtx_get(_hmtx_table_bytes, glyph_id, _num_horizontal_metrics, _em_scale);
+    /** Find the PNG image of a glyph in the 'sbix' or 'CBDT' table, without decoding it.
+     */
+    [[nodiscard]] std::optional<otype_bitmap_glyph> find_bitmap(hi::glyph_id glyph_id) const
+    {
+        load_view();
 
-        r.advance = advance_width;
-        r.left_side_bearing = left_side_bearing;
-        r.right_side_bearing = advance_width - (left_side_bearing + r.bounding_rectangle.width());
-        return r;
+        if (not _sbix_table_bytes.empty()) {
+            try {
+                if (auto r = otype_sbix_get(_sbix_table_bytes, glyph_id, narrow_cast<std::size_t>(num_glyphs))) {
+                    return r;
+                }
+            } catch (std::exception const& e) {
+                hi_log_error("Turning off invalid 'sbix' table in font '{} {}': {}", family_name, sub_family_name, e.what());
+                _sbix_table_bytes = {};
+            }
+        }
+
+        if (not _CBDT_table_bytes.empty()) {
+            try {
+                return otype_CBDT_get(_CBLC_table_bytes, _CBDT_table_bytes, glyph_id);
+            } catch (std::exception const& e) {
+                hi_log_error("Turning off invalid 'CBDT' table in font '{} {}': {}", family_name, sub_family_name, e.what());
+                _CBDT_table_bytes = {};
+            }
+        }
+
+        return std::nullopt;
     }
 
-    [[nodiscard]] shape_run_result_type shape_run(iso_639 language, iso_15924 script, gstring run) const override
+    [[nodiscard]] shape_run_result_type shape_run_uncached(iso_15924 script, gstring const& run) const
     {
         auto r = shape_run_basic(run);
 
         // Glyphs should be morphed only once.
-        // auto morphed = false;
+        auto morphed = false;
         // Glyphs should be positioned only once.
         auto positioned = false;
 
+        if (not morphed and not _GSUB_table_bytes.empty()) {
+            try {
+                morphed = shape_run_GSUB(script, r);
+            } catch (std::exception const& e) {
+                hi_log_error("Turning off invalid 'GSUB' table in font '{} {}': {}", family_name, sub_family_name, e.what());
+                _GSUB_table_bytes = {};
+            }
+        }
+
+        if (not positioned and not _GPOS_table_bytes.empty()) {
+            try {
+                positioned = shape_run_GPOS_kern(r);
+            } catch (std::exception const& e) {
+                hi_log_error("Turning off invalid 'GPOS' table in font '{} {}': {}", family_name, sub_family_name, e.what());
+                _GPOS_table_bytes = {};
+            }
+        }
+
         if (not positioned and not _kern_table_bytes.empty()) {
             try {
                 shape_run_kern(r);
@@ -149,7 +461,6 @@ public:
         return r;
     }
 
-private:
     /** The url to retrieve the view.
      */
     std::filesystem::path _path;
@@ -174,8 +485,50 @@ private:
     mutable std::span<std::byte const> _hmtx_table_bytes;
     mutable std::span<std::byte const> _kern_table_bytes;
     mutable std::span<std::byte const> _GSUB_table_bytes;
+    mutable std::span<std::byte const> _GPOS_table_bytes;
+    mutable std::span<std::byte const> _COLR_table_bytes;
+    mutable std::span<std::byte const> _CPAL_table_bytes;
+    mutable std::span<std::byte const> _sbix_table_bytes;
+    mutable std::span<std::byte const> _CBLC_table_bytes;
+    mutable std::span<std::byte const> _CBDT_table_bytes;
     bool _loca_is_offset32;
 
+    mutable unfair_mutex _GPOS_kerning_mutex;
+
+    /** The pair kerning of the 'GPOS' table, decoded on first use.
+     *
+     * Once decoded it is never replaced, so that a reference can be used outside of the lock.
+     */
+    mutable std::unique_ptr<otype_GPOS_kerning const> _GPOS_kerning;
+
+    mutable unfair_mutex _GSUB_mutex;
+
+    /** The 'GSUB' table, decoded on first use.
+     *
+     * Once decoded it is never replaced, so that a reference can be used outside of the lock.
+     */
+    mutable std::unique_ptr<otype_GSUB const> _GSUB;
+
+    /** The 'GSUB' lookups to apply for each script, entries are never removed.
+     */
+    mutable std::unordered_map<iso_15924, std::vector<uint16_t>> _GSUB_lookups;
+
+    mutable unfair_mutex _COLR_mutex;
+
+    /** The 'COLR' table, decoded on first use.
+     */
+    mutable std::unique_ptr<otype_COLR const> _COLR;
+
+    /** The default palette of the 'CPAL' table, decoded together with the 'COLR' table.
+     */
+    mutable std::vector<color> _CPAL_palette;
+
+    /** The layers of each color glyph with the palette applied, entries are never removed.
+     *
+     * This allows the layers to be returned by reference outside of the lock.
+     */
+    mutable std::unordered_map<hi::glyph_id, std::vector<color_layer_type>> _color_layers;
+
     void cache_tables(std::span<std::byte const> bytes) const
     {
         _loca_table_bytes = otype_sfnt_search<"loca">(bytes);
@@ -185,6 +538,15 @@ private:
         // Optional tables.
         _kern_table_bytes = otype_sfnt_search<"kern">(bytes);
         _GSUB_table_bytes = otype_sfnt_search<"GSUB">(bytes);
+        _GPOS_table_bytes = otype_sfnt_search<"GPOS">(bytes);
+        _COLR_table_bytes = otype_sfnt_search<"COLR">(bytes);
+        _CPAL_table_bytes = otype_sfnt_search<"CPAL">(bytes);
+        _sbix_table_bytes = otype_sfnt_search<"sbix">(bytes);
+        _CBLC_table_bytes = otype_sfnt_search<"CBLC">(bytes);
+        _CBDT_table_bytes = otype_sfnt_search<"CBDT">(bytes);
+        if (_CBLC_table_bytes.empty()) {
+            _CBDT_table_bytes = {};
+        }
     }
 
     void load_view() const noexcept
@@ -197,6 +559,12 @@ private:
         _bytes = as_span<std::byte const>(_view);
         ++global_counter<"ttf:map">;
         cache_tables(_bytes);
+
+        // These tables are read for every glyph, read them from disk in one go.
+        _view.prefetch(_loca_table_bytes);
+        _view.prefetch(_hmtx_table_bytes);
+        _view.prefetch(_kern_table_bytes);
+        _view.prefetch(_GSUB_table_bytes);
     }
 
     /** Parses the directory table of the font file.
@@ -316,6 +684,18 @@ private:
         if (not _GSUB_table_bytes.empty()) {
             features += "GSUB,";
         }
+        if (not _GPOS_table_bytes.empty()) {
+            features += "GPOS,";
+        }
+        if (not _COLR_table_bytes.empty()) {
+            features += "COLR,";
+        }
+        if (not _sbix_table_bytes.empty()) {
+            features += "sbix,";
+        }
+        if (not _CBDT_table_bytes.empty()) {
+            features += "CBDT,";
+        }
 
         if (OS2_x_height > 0.0f) {
             metrics.x_height = unit::em_squares(OS2_x_height);
@@ -341,6 +721,59 @@ private:
         }
     }
 
+    /** Add the glyphs of a grapheme, or of a ligature, to the shape-result.
+     *
+     * The first glyph is the base-glyph, the other glyphs are positioned after it.
+     * The advance of a ligature is divided equally between its graphemes, the
+     * graphemes after the first one in the ligature have no glyphs.
+     *
+     * @param r The shape-result to add the glyphs to.
+     * @param glyphs The glyphs, or empty if the glyphs of the grapheme were removed.
+     * @param num_graphemes The number of graphemes represented by the glyphs.
+     */
+    void shape_run_append(font::shape_run_result_type& r, auto const& glyphs, std::size_t num_graphemes) const
+    {
+        hi_axiom(num_graphemes != 0);
+
+        if (glyphs.empty()) {
+            for (auto i = 0_uz; i != num_graphemes; ++i) {
+                r.advances.push_back(0.0f);
+                r.glyph_count.push_back(0);
+            }
+            return;
+        }
+
+        auto const base_glyph_id = glyphs.front();
+        auto const base_glyph_metrics = get_metrics(base_glyph_id);
+
+        auto const advance = base_glyph_metrics.advance / static_cast<float>(num_graphemes);
+        r.advances.push_back(advance);
+        r.glyph_count.push_back(glyphs.size());
+        for (auto i = 1_uz; i != num_graphemes; ++i) {
+            r.advances.push_back(advance);
+            r.glyph_count.push_back(0);
+        }
+
+        // Store information of the base-glyph
+        r.glyphs.push_back(base_glyph_id);
+        r.glyph_positions.push_back(point2{});
+        r.glyph_rectangles.push_back(base_glyph_metrics.bounding_rectangle);
+
+        // Position the mark-glyphs.
+        auto glyph_position = point2{base_glyph_metrics.advance, 0.0f};
+        for (auto i = 1_uz; i != glyphs.size(); ++i) {
+            auto const glyph_id = glyphs[i];
+
+            auto const glyph_metrics = get_metrics(glyph_id);
+
+            r.glyphs.push_back(glyph_id);
+            r.glyph_positions.push_back(glyph_position);
+            r.glyph_rectangles.push_back(glyph_metrics.bounding_rectangle);
+
+            glyph_position.x() += glyph_metrics.advance;
+        }
+    }
+
     /** Shape the given text with very basic rules.
      */
     [[nodiscard]] font::shape_run_result_type shape_run_basic(gstring run) const
@@ -354,32 +787,149 @@ private:
             // At this point ligature substitution has not been done. So we should
             // have at least one glyph per grapheme.
             hi_axiom(not glyphs.empty());
-            auto const base_glyph_id = glyphs.front();
-            auto const base_glyph_metrics = get_metrics(base_glyph_id);
+            shape_run_append(r, glyphs, 1);
+        }
+        return r;
+    }
+
+    /** Get the lookups of the 'GSUB' table to apply to a script.
+     *
+     * The 'GSUB' table is decoded on first use, and the lookups are cached for each script.
+     */
+    [[nodiscard]] std::pair<otype_GSUB const&, std::vector<uint16_t> const&> GSUB_lookups(iso_15924 script) const
+    {
+        // The features that are applied to all scripts.
+        constexpr auto feature_tags =
+            std::array{fourcc<"ccmp">(), fourcc<"locl">(), fourcc<"rlig">(), fourcc<"liga">(), fourcc<"clig">(), fourcc<"calt">()};
+
+        auto const lock = std::scoped_lock(_GSUB_mutex);
+        if (not _GSUB) {
+            load_view();
+            ++global_counter<"ttf:GSUB:decode">;
+            _GSUB = std::make_unique<otype_GSUB const>(_GSUB_table_bytes, narrow_cast<std::size_t>(num_glyphs));
+        }
 
-            r.advances.push_back(base_glyph_metrics.advance);
-            r.glyph_count.push_back(glyphs.size());
+        auto it = _GSUB_lookups.find(script);
+        if (it == _GSUB_lookups.end()) {
+            auto const script_tag = script.empty() ? fourcc<"DFLT">() : otype_tag(script.code4_open_type());
+            // There is no mapping from iso-639 to open-type language tags, use the default language-system.
+            it = _GSUB_lookups.emplace(script, _GSUB->find_lookups(script_tag, 0, feature_tags)).first;
+        }
+        return {*_GSUB, it->second};
+    }
 
-            // Store information of the base-glyph
-            r.glyphs.push_back(base_glyph_id);
-            r.glyph_positions.push_back(point2{});
-            r.glyph_rectangles.push_back(base_glyph_metrics.bounding_rectangle);
+    /** Substitute glyphs using the lookups of the 'GSUB' table.
+     *
+     * @return true if the font has 'GSUB' lookups for the script.
+     */
+    [[nodiscard]] bool shape_run_GSUB(iso_15924 script, font::shape_run_result_type& shape_result) const
+    {
+        auto const [GSUB, lookup_indices] = GSUB_lookups(script);
+        if (lookup_indices.empty()) {
+            return false;
+        }
 
-            // Position the mark-glyphs.
-            auto glyph_position = point2{base_glyph_metrics.advance, 0.0f};
-            for (auto i = 1_uz; i != glyphs.size(); ++i) {
-                auto const glyph_id = glyphs[i];
+        auto const num_graphemes = shape_result.advances.size();
 
-                auto const glyph_metrics = get_metrics(glyph_id);
+        auto buffer = std::vector<otype_GSUB_glyph>{};
+        buffer.reserve(shape_result.glyphs.size());
+        auto glyph_index = 0_uz;
+        for (auto grapheme_index = 0_uz; grapheme_index != num_graphemes; ++grapheme_index) {
+            for (auto i = 0_uz; i != shape_result.glyph_count[grapheme_index]; ++i) {
+                buffer.emplace_back(shape_result.glyphs[glyph_index++], grapheme_index);
+            }
+        }
 
-                r.glyphs.push_back(glyph_id);
-                r.glyph_positions.push_back(glyph_position);
-                r.glyph_rectangles.push_back(glyph_metrics.bounding_rectangle);
+        if (not GSUB.apply(lookup_indices, buffer)) {
+            return true;
+        }
 
-                glyph_position.x() += glyph_metrics.advance;
+        auto r = font::shape_run_result_type{};
+        r.reserve(num_graphemes);
+
+        // The clusters in the buffer are in ascending order, a cluster that is
+        // skipped is part of the ligature of the previous cluster.
+        auto glyphs = std::vector<glyph_id>{};
+        auto it = buffer.begin();
+        for (auto grapheme_index = 0_uz; grapheme_index != num_graphemes;) {
+            glyphs.clear();
+            for (; it != buffer.end() and it->cluster == grapheme_index; ++it) {
+                glyphs.push_back(it->glyph);
             }
+
+            auto const next_grapheme_index = it == buffer.end() ? num_graphemes : it->cluster;
+            hi_axiom(next_grapheme_index > grapheme_index);
+            shape_run_append(r, glyphs, next_grapheme_index - grapheme_index);
+            grapheme_index = next_grapheme_index;
         }
-        return r;
+
+        // Mark the graphemes of which the glyphs were substituted.
+        r.morphed.resize(num_graphemes, false);
+        auto old_glyph_index = 0_uz;
+        auto new_glyph_index = 0_uz;
+        for (auto grapheme_index = 0_uz; grapheme_index != num_graphemes; ++grapheme_index) {
+            auto const old_glyph_count = shape_result.glyph_count[grapheme_index];
+            auto const new_glyph_count = r.glyph_count[grapheme_index];
+
+            r.morphed[grapheme_index] = not std::equal(
+                shape_result.glyphs.begin() + old_glyph_index,
+                shape_result.glyphs.begin() + old_glyph_index + old_glyph_count,
+                r.glyphs.begin() + new_glyph_index,
+                r.glyphs.begin() + new_glyph_index + new_glyph_count);
+
+            old_glyph_index += old_glyph_count;
+            new_glyph_index += new_glyph_count;
+        }
+
+        shape_result = std::move(r);
+        return true;
+    }
+
+    [[nodiscard]] otype_GPOS_kerning const& GPOS_kerning() const
+    {
+        auto const lock = std::scoped_lock(_GPOS_kerning_mutex);
+        if (not _GPOS_kerning) {
+            load_view();
+            ++global_counter<"ttf:GPOS:decode">;
+            _GPOS_kerning = std::make_unique<otype_GPOS_kerning const>(
+                otype_GPOS_get_kerning(_GPOS_table_bytes, narrow_cast<std::size_t>(num_glyphs), _em_scale));
+        }
+        return *_GPOS_kerning;
+    }
+
+    /** Kern using the pair-adjustment lookups of the 'GPOS' table.
+     *
+     * @return true if the font has pair kerning in the 'GPOS' table.
+     */
+    [[nodiscard]] bool shape_run_GPOS_kern(font::shape_run_result_type& shape_result) const
+    {
+        auto const& kerning = GPOS_kerning();
+        if (kerning.empty()) {
+            return false;
+        }
+
+        auto const num_graphemes = shape_result.advances.size();
+
+        auto prev_base_glyph_id = hi::glyph_id{};
+        auto glyph_index = 0_uz;
+        for (auto grapheme_index = 0_uz; grapheme_index != num_graphemes; ++grapheme_index) {
+            // Kerning is done between base-glyphs of consecutive graphemes.
+            auto const glyph_count = shape_result.glyph_count[grapheme_index];
+            if (glyph_count == 0) {
+                // The grapheme is part of a ligature.
+                continue;
+            }
+            auto const base_glyph_id = shape_result.glyphs[glyph_index];
+
+            if (prev_base_glyph_id) {
+                hi_axiom(grapheme_index != 0);
+                shape_result.advances[grapheme_index - 1] += kerning.find(prev_base_glyph_id, base_glyph_id);
+            }
+
+            prev_base_glyph_id = base_glyph_id;
+            glyph_index += glyph_count;
+        }
+        return true;
     }
 
     void shape_run_kern(font::shape_run_result_type& shape_result) const
@@ -392,6 +942,11 @@ private:
             // Kerning is done between base-glyphs of consecutive graphemes.
             // Marks should be handled by the Unicode mark positioning algorithm.
             // Or by the more stateful GPOS table.
+            auto const glyph_count = shape_result.glyph_count[grapheme_index];
+            if (glyph_count == 0) {
+                // The grapheme is part of a ligature.
+                continue;
+            }
             auto const base_glyph_id = shape_result.glyphs[glyph_index];
 
             if (prev_base_glyph_id) {
@@ -401,7 +956,8 @@ private:
                 shape_result.advances[grapheme_index - 1] += kerning.x();
             }
 
-            glyph_index += shape_result.glyph_count[grapheme_index];
+            prev_base_glyph_id = base_glyph_id;
+            glyph_index += glyph_count;
         }
     }
 };
@@ -0,0 +1,218 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file geometry/bulk_transform.hpp Geometry operations on many points, quads or rectangles at once.
+ * @ingroup geometry
+ *
+ * Transforming a single point by a `matrix3` is a single `f32x4` operation
+ * where the `w` element is wasted work. The functions in this file transpose
+ * 8 points at a time into structure-of-arrays form, so that a `f32x8` holds
+ * the same coordinate of 8 points and no lanes are wasted.
+ */
+
+#pragma once
+
+#include "matrix3.hpp"
+#include "point2.hpp"
+#include "point3.hpp"
+#include "quad.hpp"
+#include "aarectangle.hpp"
+#include "transform.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <span>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.geometry : bulk_transform);
+
+hi_export namespace hi { inline namespace v1 {
+namespace detail {
+
+/** The indices of a coordinate of 8 homogeneous points laid out as f32x4.
+ */
+template<int32_t Coordinate>
+constexpr auto bulk_transform_indices =
+    std::array<int32_t, 8>{Coordinate, 4 + Coordinate, 8 + Coordinate, 12 + Coordinate,
+                           16 + Coordinate, 20 + Coordinate, 24 + Coordinate, 28 + Coordinate};
+
+/** Transform 8 points, given as (x, y, z, w) tuples, by an affine matrix.
+ *
+ * @tparam HasZ The points have a z-coordinate, false for point2.
+ * @param lhs The affine matrix.
+ * @param ptr A pointer to 32 floats, the 8 points to transform.
+ * @param[out] r The 8 transformed points.
+ */
+template<bool HasZ>
+hi_force_inline void bulk_transform_8(matrix3 const& lhs, float const *ptr, point3 *r) noexcept
+{
+    auto const& c0 = get<0>(lhs);
+    auto const& c1 = get<1>(lhs);
+    auto const& c2 = get<2>(lhs);
+    auto const& c3 = get<3>(lhs);
+
+    auto const x = f32x8::gather(ptr, bulk_transform_indices<0>);
+    auto const y = f32x8::gather(ptr, bulk_transform_indices<1>);
+
+    auto rx = f32x8::broadcast(c0.x()) * x + f32x8::broadcast(c1.x()) * y + f32x8::broadcast(c3.x());
+    auto ry = f32x8::broadcast(c0.y()) * x + f32x8::broadcast(c1.y()) * y + f32x8::broadcast(c3.y());
+    auto rz = f32x8::broadcast(c0.z()) * x + f32x8::broadcast(c1.z()) * y + f32x8::broadcast(c3.z());
+    if constexpr (HasZ) {
+        auto const z = f32x8::gather(ptr, bulk_transform_indices<2>);
+        rx += f32x8::broadcast(c2.x()) * z;
+        ry += f32x8::broadcast(c2.y()) * z;
+        rz += f32x8::broadcast(c2.z()) * z;
+    }
+
+    for (auto i = 0uz; i != 8; ++i) {
+        r[i] = point3{rx[i], ry[i], rz[i]};
+    }
+}
+
+template<bool HasZ, typename T>
+inline void bulk_transform(matrix3 const& lhs, std::span<T const> rhs, std::span<point3> r) noexcept
+{
+    static_assert(sizeof(T) == sizeof(f32x4));
+    static_assert(sizeof(point3) == sizeof(f32x4));
+    hi_axiom(rhs.size() <= r.size());
+
+    auto const *ptr = reinterpret_cast<float const *>(rhs.data());
+    auto i = 0uz;
+    for (; i + 8 <= rhs.size(); i += 8) {
+        bulk_transform_8<HasZ>(lhs, ptr + i * 4, r.data() + i);
+    }
+    for (; i != rhs.size(); ++i) {
+        r[i] = lhs * rhs[i];
+    }
+}
+
+} // namespace detail
+
+/** Transform many 2D points by an affine matrix.
+ *
+ * @note The matrix must not have a perspective component.
+ * @param lhs The affine transformation matrix.
+ * @param rhs The points to transform.
+ * @param[out] r The transformed points, at least as large as @a rhs.
+ *               May not partially overlap @a rhs.
+ */
+inline void transform(matrix3 const& lhs, std::span<point2 const> rhs, std::span<point3> r) noexcept
+{
+    detail::bulk_transform<false>(lhs, rhs, r);
+}
+
+/** Transform many 3D points by an affine matrix.
+ *
+ * @note The matrix must not have a perspective component.
+ * @param lhs The affine transformation matrix.
+ * @param rhs The points to transform.
+ * @param[out] r The transformed points, at least as large as @a rhs.
+ *               May be the same span as @a rhs.
+ */
+inline void transform(matrix3 const& lhs, std::span<point3 const> rhs, std::span<point3> r) noexcept
+{
+    detail::bulk_transform<true>(lhs, rhs, r);
+}
+
+/** Transform many quads by an affine matrix.
+ *
+ * @note The matrix must not have a perspective component.
+ * @param lhs The affine transformation matrix.
+ * @param rhs The quads to transform.
+ * @param[out] r The transformed quads, at least as large as @a rhs.
+ *               May be the same span as @a rhs.
+ */
+inline void transform(matrix3 const& lhs, std::span<quad const> rhs, std::span<quad> r) noexcept
+{
+    static_assert(sizeof(quad) == 4 * sizeof(point3));
+    hi_axiom(rhs.size() <= r.size());
+
+    // The corners of consecutive quads are consecutive points.
+    auto const points = std::span{reinterpret_cast<point3 const *>(rhs.data()), rhs.size() * 4};
+    auto const r_points = std::span{reinterpret_cast<point3 *>(r.data()), r.size() * 4};
+    detail::bulk_transform<true>(lhs, points, r_points);
+}
+
+/** Get the axis-aligned bounding rectangle of many points.
+ *
+ * @param rhs The points.
+ * @return The bounding rectangle, or an empty rectangle when @a rhs is empty.
+ */
+[[nodiscard]] inline aarectangle bounding_rectangle(std::span<point2 const> rhs) noexcept
+{
+    static_assert(sizeof(point2) == sizeof(f32x4));
+
+    if (rhs.empty()) {
+        return aarectangle{};
+    }
+
+    auto const *ptr = reinterpret_cast<float const *>(rhs.data());
+
+    // Each f32x8 holds two points, (x, y, z, w, x, y, z, w).
+    constexpr auto both_halves = std::array<int32_t, 8>{0, 1, 2, 3, 0, 1, 2, 3};
+    auto min_p = f32x8::gather(ptr, both_halves);
+    auto max_p = min_p;
+
+    auto i = 1uz;
+    for (; i + 2 <= rhs.size(); i += 2) {
+        auto const p = f32x8::masked_load(ptr + i * 4, 0b1111'1111);
+        min_p = min(min_p, p);
+        max_p = max(max_p, p);
+    }
+    if (i != rhs.size()) {
+        auto const p = f32x8::gather(ptr + i * 4, both_halves);
+        min_p = min(min_p, p);
+        max_p = max(max_p, p);
+    }
+
+    // Combine the two halves; only (x, y) of the result are used.
+    min_p = min(min_p, swizzle<4, 5, 6, 7, 0, 1, 2, 3>(min_p));
+    max_p = max(max_p, swizzle<4, 5, 6, 7, 0, 1, 2, 3>(max_p));
+    return aarectangle{point2{min_p[0], min_p[1]}, point2{max_p[0], max_p[1]}};
+}
+
+/** Intersect many rectangles with a single clipping rectangle.
+ *
+ * The result for each rectangle is the same as `intersect(clipping_rectangle, rhs[i])`,
+ * a rectangle that does not overlap with the clipping rectangle becomes an empty
+ * rectangle at the origin.
+ *
+ * @param clipping_rectangle The rectangle to clip against.
+ * @param rhs The rectangles to clip.
+ * @param[out] r The clipped rectangles, at least as large as @a rhs.
+ *               May be the same span as @a rhs.
+ */
+inline void intersect(aarectangle const& clipping_rectangle, std::span<aarectangle const> rhs, std::span<aarectangle> r) noexcept
+{
+    static_assert(sizeof(aarectangle) == sizeof(f32x4));
+    hi_axiom(rhs.size() <= r.size());
+
+    auto const clip_ = f32x4{clipping_rectangle};
+    auto const clip = f32x8{clip_.x(), clip_.y(), clip_.z(), clip_.w(), clip_.x(), clip_.y(), clip_.z(), clip_.w()};
+
+    auto const *ptr = reinterpret_cast<float const *>(rhs.data());
+    auto *r_ptr = reinterpret_cast<float *>(r.data());
+
+    // Each f32x8 holds two rectangles, (x0, y0, x1, y1, x0, y0, x1, y1).
+    auto i = 0uz;
+    for (; i + 2 <= rhs.size(); i += 2) {
+        auto const rect = f32x8::masked_load(ptr + i * 4, 0b1111'1111);
+
+        // Left-bottom is the maximum, right-top is the minimum.
+        auto const tmp = blend<0b1100'1100>(max(rect, clip), min(rect, clip));
+
+        // Rectangles are only valid if the left-bottom is smaller than the right-top.
+        auto const valid = (tmp < swizzle<2, 3, 0, 1, 6, 7, 4, 5>(tmp)).mask();
+        auto const keep_mask = ((valid & 0b0000'0011) == 0b0000'0011 ? 0b0000'1111 : 0) |
+            ((valid & 0b0011'0000) == 0b0011'0000 ? 0b1111'0000 : 0);
+
+        masked_store(r_ptr + i * 4, tmp & f32x8::make_mask(keep_mask), 0b1111'1111);
+    }
+    for (; i != rhs.size(); ++i) {
+        r[i] = intersect(clipping_rectangle, rhs[i]);
+    }
+}
+
+}} // namespace hi::v1
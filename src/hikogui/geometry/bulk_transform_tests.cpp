@@ -0,0 +1,131 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "bulk_transform.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+
+using namespace hi;
+
+TEST_SUITE(bulk_transform_suite)
+{
+
+TEST_CASE(transform_point2_test)
+{
+    // clang-format off
+    constexpr auto M = matrix3{
+        0.5f, -0.8f, 0.1f, -3.0f,
+        0.7f,  0.6f, 0.2f, -4.0f,
+        0.3f,  0.1f, 1.5f, -5.0f,
+        0.0f,  0.0f, 0.0f,  1.0f};
+    // clang-format on
+
+    // 19 points; two batches of 8 and a tail of 3.
+    auto points = std::vector<point2>{};
+    for (auto i = 0; i != 19; ++i) {
+        points.emplace_back(static_cast<float>(i), static_cast<float>(i * 3 - 20));
+    }
+
+    auto r = std::vector<point3>(points.size());
+    transform(M, std::span<point2 const>{points}, std::span<point3>{r});
+
+    for (auto i = 0uz; i != points.size(); ++i) {
+        auto const expected = M * points[i];
+        REQUIRE(r[i].x() == expected.x(), 0.0001);
+        REQUIRE(r[i].y() == expected.y(), 0.0001);
+        REQUIRE(r[i].z() == expected.z(), 0.0001);
+    }
+}
+
+TEST_CASE(transform_point3_in_place_test)
+{
+    // clang-format off
+    constexpr auto M = matrix3{
+        0.5f, -0.8f, 0.1f, -3.0f,
+        0.7f,  0.6f, 0.2f, -4.0f,
+        0.3f,  0.1f, 1.5f, -5.0f,
+        0.0f,  0.0f, 0.0f,  1.0f};
+    // clang-format on
+
+    auto points = std::vector<point3>{};
+    for (auto i = 0; i != 17; ++i) {
+        points.emplace_back(static_cast<float>(i), static_cast<float>(i * 3 - 20), static_cast<float>(i % 5));
+    }
+    auto const original = points;
+
+    transform(M, std::span<point3 const>{points}, std::span<point3>{points});
+
+    for (auto i = 0uz; i != points.size(); ++i) {
+        auto const expected = M * original[i];
+        REQUIRE(points[i].x() == expected.x(), 0.0001);
+        REQUIRE(points[i].y() == expected.y(), 0.0001);
+        REQUIRE(points[i].z() == expected.z(), 0.0001);
+    }
+}
+
+TEST_CASE(transform_quad_test)
+{
+    // clang-format off
+    constexpr auto M = matrix3{
+        0.5f, -0.8f, 0.1f, -3.0f,
+        0.7f,  0.6f, 0.2f, -4.0f,
+        0.3f,  0.1f, 1.5f, -5.0f,
+        0.0f,  0.0f, 0.0f,  1.0f};
+    // clang-format on
+
+    auto quads = std::vector<quad>{};
+    for (auto i = 0; i != 5; ++i) {
+        quads.emplace_back(aarectangle{static_cast<float>(i), 2.0f, 10.0f, static_cast<float>(i + 1)});
+    }
+
+    auto r = std::vector<quad>(quads.size());
+    transform(M, std::span<quad const>{quads}, std::span<quad>{r});
+
+    for (auto i = 0uz; i != quads.size(); ++i) {
+        auto const expected = M * quads[i];
+        for (auto j = 0uz; j != 4; ++j) {
+            REQUIRE(r[i][j].x() == expected[j].x(), 0.0001);
+            REQUIRE(r[i][j].y() == expected[j].y(), 0.0001);
+            REQUIRE(r[i][j].z() == expected[j].z(), 0.0001);
+        }
+    }
+}
+
+TEST_CASE(bounding_rectangle_test)
+{
+    REQUIRE(bounding_rectangle(std::span<point2 const>{}) == aarectangle{});
+
+    auto points = std::vector<point2>{point2{3.0f, 4.0f}};
+    REQUIRE(bounding_rectangle(std::span<point2 const>{points}) == aarectangle{point2{3.0f, 4.0f}, point2{3.0f, 4.0f}});
+
+    points.emplace_back(-1.0f, 7.0f);
+    REQUIRE(bounding_rectangle(std::span<point2 const>{points}) == aarectangle{point2{-1.0f, 4.0f}, point2{3.0f, 7.0f}});
+
+    points.emplace_back(2.0f, -5.0f);
+    REQUIRE(bounding_rectangle(std::span<point2 const>{points}) == aarectangle{point2{-1.0f, -5.0f}, point2{3.0f, 7.0f}});
+
+    points.emplace_back(9.0f, 0.0f);
+    REQUIRE(bounding_rectangle(std::span<point2 const>{points}) == aarectangle{point2{-1.0f, -5.0f}, point2{9.0f, 7.0f}});
+}
+
+TEST_CASE(intersect_test)
+{
+    auto const clip = aarectangle{0.0f, 0.0f, 10.0f, 10.0f};
+
+    auto rectangles = std::vector<aarectangle>{
+        aarectangle{2.0f, 2.0f, 4.0f, 4.0f},
+        aarectangle{-5.0f, -5.0f, 10.0f, 10.0f},
+        aarectangle{20.0f, 2.0f, 4.0f, 4.0f},
+        aarectangle{8.0f, 8.0f, 5.0f, 5.0f},
+        aarectangle{2.0f, -10.0f, 4.0f, 5.0f}};
+
+    auto r = std::vector<aarectangle>(rectangles.size());
+    intersect(clip, std::span<aarectangle const>{rectangles}, std::span<aarectangle>{r});
+
+    for (auto i = 0uz; i != rectangles.size(); ++i) {
+        REQUIRE(r[i] == intersect(clip, rectangles[i]));
+    }
+}
+
+};
@@ -6,6 +6,7 @@
 
 #include "alignment.hpp" // export
 #include "axis.hpp" // export
+#include "bulk_transform.hpp" // export
 #include "aarectangle.hpp" // export
 #include "circle.hpp" // export
 #include "corner_radii.hpp" // export
@@ -226,22 +226,94 @@ hi_export struct bezier_curve {
      */
     [[nodiscard]] sdf_distance_result sdf_distance(point2 P) const noexcept
     {
-        auto nearest = sdf_distance_result{this};
-
-        auto const ts = solveTForNormalsIntersectingPoint(P);
-        for (auto t : ts) {
-            t = std::clamp(t, 0.0f, 1.0f);
-
-            auto const PN = P - pointAt(t);
-            auto const sq_distance = squared_hypot(PN);
-            if (sq_distance < nearest.sq_distance) {
-                nearest.t = t;
-                nearest.PN = PN;
-                nearest.sq_distance = sq_distance;
+        // Use the same calculation as for many points, so that the results are identical.
+        return sdf_distance(f32x4::broadcast(P.x()), f32x4::broadcast(P.y()))[0];
+    }
+
+    /** Find the distance from 4 points to the curve.
+     *
+     * The roots and the nearest points on the curve are calculated for the
+     * 4 points at once, one point in each lane.
+     *
+     * @param x The x-coordinates of the points.
+     * @param y The y-coordinates of the points.
+     * @return The distance of each point to this curve.
+     */
+    [[nodiscard]] std::array<sdf_distance_result, 4> sdf_distance(f32x4 x, f32x4 y) const noexcept
+    {
+        auto r = std::array<sdf_distance_result, 4>{this, this, this, this};
+
+        // The polynomial of the curve, to calculate the point at t.
+        auto pa = f32x4{};
+        auto pb = f32x4{};
+        auto pc = f32x4{};
+
+        auto ts = std::array<f32x4, 3>{};
+        auto num_ts = 0_uz;
+
+        switch (type) {
+        case Type::Linear:
+            {
+                auto const v = P2 - P1;
+                auto const t_below = dot(v, v);
+                if (t_below != 0.0f) {
+                    auto const px = x - f32x4::broadcast(P1.x());
+                    auto const py = y - f32x4::broadcast(P1.y());
+                    ts[0] = (px * f32x4::broadcast(v.x()) + py * f32x4::broadcast(v.y())) / f32x4::broadcast(t_below);
+                    num_ts = 1;
+                }
+
+                auto const polynomial = bezierToPolynomial(static_cast<f32x4>(P1), static_cast<f32x4>(P2));
+                pb = polynomial[0];
+                pc = polynomial[1];
+            }
+            break;
+
+        case Type::Quadratic:
+            {
+                auto const p1 = C1 - P1;
+                auto const p2 = vector2{static_cast<f32x4>(P2) - f32x4::broadcast(2) * static_cast<f32x4>(C1) + static_cast<f32x4>(P1)};
+                auto const px = x - f32x4::broadcast(P1.x());
+                auto const py = y - f32x4::broadcast(P1.y());
+
+                auto const a = f32x4::broadcast(dot(p2, p2));
+                auto const b = f32x4::broadcast(3 * dot(p1, p2));
+                auto const c = f32x4::broadcast(dot(2 * p1, p1)) - (f32x4::broadcast(p2.x()) * px + f32x4::broadcast(p2.y()) * py);
+                auto const d = -(f32x4::broadcast(p1.x()) * px + f32x4::broadcast(p1.y()) * py);
+                ts = solve_polynomial(a, b, c, d);
+                num_ts = 3;
+
+                auto const polynomial = bezierToPolynomial(static_cast<f32x4>(P1), static_cast<f32x4>(C1), static_cast<f32x4>(P2));
+                pa = polynomial[0];
+                pb = polynomial[1];
+                pc = polynomial[2];
             }
+            break;
+
+        default:
+            hi_no_default();
         }
 
-        return nearest;
+        for (auto i = 0_uz; i != num_ts; ++i) {
+            // Lanes without a root are NaN, these lanes are skipped below.
+            auto const is_root = (ts[i] == ts[i]).mask();
+            auto const t = clamp(ts[i], f32x4::broadcast(0.0f), f32x4::broadcast(1.0f));
+
+            auto const Nx = f32x4::broadcast(pa.x()) * t * t + f32x4::broadcast(pb.x()) * t + f32x4::broadcast(pc.x());
+            auto const Ny = f32x4::broadcast(pa.y()) * t * t + f32x4::broadcast(pb.y()) * t + f32x4::broadcast(pc.y());
+            auto const PNx = x - Nx;
+            auto const PNy = y - Ny;
+            auto const sq_distance = PNx * PNx + PNy * PNy;
+
+            for (auto j = 0_uz; j != 4; ++j) {
+                if (((is_root >> j) & 1) != 0 and sq_distance[j] < r[j].sq_distance) {
+                    r[j].t = t[j];
+                    r[j].PN = vector2{PNx[j], PNy[j]};
+                    r[j].sq_distance = sq_distance[j];
+                }
+            }
+        }
+        return r;
     }
 
     /*! Split a cubic bezier-curve into two cubic bezier-curve.
@@ -384,6 +456,26 @@ hi_export struct bezier_curve {
         return {rhs.type, lhs * rhs.P1, lhs * rhs.C1, lhs * rhs.C2, lhs * rhs.P2};
     }
 
+    /** The bounding rectangle of the control points of the curve.
+     *
+     * The curve lies completely inside the convex-hull of its control points,
+     * therefor also inside this rectangle.
+     */
+    [[nodiscard]] friend constexpr aarectangle bounding_rectangle(bezier_curve const& rhs) noexcept
+    {
+        auto p0 = min(rhs.P1, rhs.P2);
+        auto p3 = max(rhs.P1, rhs.P2);
+        if (rhs.type == Type::Quadratic or rhs.type == Type::Cubic) {
+            p0 = min(p0, rhs.C1);
+            p3 = max(p3, rhs.C1);
+        }
+        if (rhs.type == Type::Cubic) {
+            p0 = min(p0, rhs.C2);
+            p3 = max(p3, rhs.C2);
+        }
+        return aarectangle{p0, p3};
+    }
+
     /*! Reverse direction of a curve.
      */
     [[nodiscard]] friend bezier_curve operator~(bezier_curve const& rhs) noexcept
@@ -542,6 +634,91 @@ constexpr void fillRow(std::span<uint8_t> row, std::size_t rowY, std::vector<bez
     return nearest.signed_distance();
 }
 
+/** Calculate the signed distance of 4 pixels on a row.
+ *
+ * @param x The x-coordinates of the pixels.
+ * @param y The y-coordinate of the row.
+ * @param curves The curves of the path.
+ * @return The signed distance of each pixel.
+ */
+[[nodiscard]] inline std::array<float, 4> generate_sdf_r8_pixels(f32x4 x, float y, std::vector<bezier_curve> const& curves) noexcept
+{
+    auto r = std::array<float, 4>{};
+    if (curves.empty()) {
+        r.fill(-std::numeric_limits<float>::max());
+        return r;
+    }
+
+    auto const y_ = f32x4::broadcast(y);
+
+    auto it = curves.cbegin();
+    auto nearest = (it++)->sdf_distance(x, y_);
+
+    for (; it != curves.cend(); ++it) {
+        auto const distances = it->sdf_distance(x, y_);
+
+        for (auto i = 0_uz; i != 4; ++i) {
+            if (distances[i] < nearest[i]) {
+                nearest[i] = distances[i];
+            }
+        }
+    }
+
+    for (auto i = 0_uz; i != 4; ++i) {
+        r[i] = nearest[i].signed_distance();
+    }
+    return r;
+}
+
+/** Select the curves that may be nearest to any pixel inside a tile.
+ *
+ * The distance from a pixel to a curve is at least the distance from the tile
+ * to the bounding rectangle of the curve's control points. And at most the
+ * distance to the first point of the curve. Curves whose minimum distance is
+ * larger than the smallest maximum distance can never be nearest.
+ *
+ * @param[out] r The curves that need to be evaluated for pixels in the tile.
+ * @param tile The rectangle through the centers of the pixels of the tile.
+ * @param curves All curves of the path.
+ * @param bounding_rectangles The bounding rectangle of each curve.
+ */
+constexpr void cull_sdf_curves(
+    std::vector<bezier_curve>& r,
+    aarectangle const& tile,
+    std::vector<bezier_curve> const& curves,
+    std::vector<aarectangle> const& bounding_rectangles) noexcept
+{
+    hi_axiom(curves.size() == bounding_rectangles.size());
+
+    auto const squared_distance = [](aarectangle const& lhs, aarectangle const& rhs) {
+        auto const dx = std::max({0.0f, rhs.left() - lhs.right(), lhs.left() - rhs.right()});
+        auto const dy = std::max({0.0f, rhs.bottom() - lhs.top(), lhs.bottom() - rhs.top()});
+        return dx * dx + dy * dy;
+    };
+
+    auto max_sq_distance = std::numeric_limits<float>::max();
+    for (auto const& curve : curves) {
+        // The distance to a point is maximum on one of the corners of the tile.
+        auto const sq_distance = std::max(
+            {squared_hypot(curve.P1 - get<0>(tile)),
+             squared_hypot(curve.P1 - get<1>(tile)),
+             squared_hypot(curve.P1 - get<2>(tile)),
+             squared_hypot(curve.P1 - get<3>(tile))});
+        max_sq_distance = std::min(max_sq_distance, sq_distance);
+    }
+
+    // The margin makes sure that curves that could win on orthogonality
+    // in `sdf_distance_result::operator<()` are not culled.
+    max_sq_distance += 0.01f;
+
+    r.clear();
+    for (auto i = 0_uz; i != curves.size(); ++i) {
+        if (squared_distance(tile, bounding_rectangles[i]) <= max_sq_distance) {
+            r.push_back(curves[i]);
+        }
+    }
+}
+
 } // namespace detail
 
 /** Make a contour of Bezier curves from a list of points.
@@ -708,12 +885,47 @@ constexpr void fill(pixmap_span<uint8_t> image, std::vector<bezier_curve> const&
  */
 constexpr void fill(pixmap_span<sdf_r8> image, std::vector<bezier_curve> const& curves) noexcept
 {
-    for (auto row_nr = 0_uz; row_nr != image.height(); ++row_nr) {
-        auto const row = image[row_nr];
-        auto const y = static_cast<float>(row_nr);
-        for (auto column_nr = 0_uz; column_nr != image.width(); ++column_nr) {
-            auto const x = static_cast<float>(column_nr);
-            row[column_nr] = detail::generate_sdf_r8_pixel(point2(x, y), curves);
+    // The image is processed in tiles, for each tile only the curves that
+    // may be nearest to one of its pixels are evaluated.
+    constexpr auto tile_size = 8_uz;
+
+    auto bounding_rectangles = std::vector<aarectangle>{};
+    bounding_rectangles.reserve(curves.size());
+    for (auto const& curve : curves) {
+        bounding_rectangles.push_back(bounding_rectangle(curve));
+    }
+
+    auto tile_curves = std::vector<bezier_curve>{};
+    tile_curves.reserve(curves.size());
+
+    for (auto tile_y = 0_uz; tile_y < image.height(); tile_y += tile_size) {
+        auto const tile_height = std::min(tile_size, image.height() - tile_y);
+
+        for (auto tile_x = 0_uz; tile_x < image.width(); tile_x += tile_size) {
+            auto const tile_width = std::min(tile_size, image.width() - tile_x);
+
+            auto const tile = aarectangle{
+                point2{static_cast<float>(tile_x), static_cast<float>(tile_y)},
+                point2{static_cast<float>(tile_x + tile_width - 1), static_cast<float>(tile_y + tile_height - 1)}};
+            detail::cull_sdf_curves(tile_curves, tile, curves, bounding_rectangles);
+
+            for (auto row_nr = tile_y; row_nr != tile_y + tile_height; ++row_nr) {
+                auto const row = image[row_nr];
+                auto const y = static_cast<float>(row_nr);
+
+                auto column_nr = tile_x;
+                for (; column_nr + 4 <= tile_x + tile_width; column_nr += 4) {
+                    auto const x = f32x4::broadcast(static_cast<float>(column_nr)) + f32x4{0.0f, 1.0f, 2.0f, 3.0f};
+                    auto const distances = detail::generate_sdf_r8_pixels(x, y, tile_curves);
+                    for (auto i = 0_uz; i != 4; ++i) {
+                        row[column_nr + i] = distances[i];
+                    }
+                }
+                for (; column_nr != tile_x + tile_width; ++column_nr) {
+                    auto const x = static_cast<float>(column_nr);
+                    row[column_nr] = detail::generate_sdf_r8_pixel(point2(x, y), tile_curves);
+                }
+            }
         }
     }
 }
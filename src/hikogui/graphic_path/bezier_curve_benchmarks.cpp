@@ -0,0 +1,48 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "bezier_curve.hpp"
+#include "graphic_path.hpp"
+#include "../image/image.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <vector>
+#include <cstdint>
+
+/** The curves of a shape with lines, quadratic and cubic curves, the size of a large glyph.
+ */
+[[nodiscard]] static std::vector<hi::bezier_curve> bezier_benchmark_curves()
+{
+    auto path = hi::graphic_path{};
+    path.addRectangle(hi::aarectangle{4.0f, 4.0f, 56.0f, 40.0f}, hi::corner_radii{8.0f, 8.0f, 8.0f, 8.0f});
+    path.addCircle(hi::point2{32.0f, 48.0f}, 12.0f);
+    path.moveTo(hi::point2{8.0f, 60.0f});
+    path.quadraticCurveTo(hi::point2{32.0f, 40.0f}, hi::point2{56.0f, 60.0f});
+    path.cubicCurveTo(hi::point2{40.0f, 62.0f}, hi::point2{24.0f, 62.0f}, hi::point2{8.0f, 60.0f});
+    path.closeContour();
+    return path.getBeziers();
+}
+
+hi_benchmark(bezier_curve_fill_sdf)
+{
+    auto const curves = bezier_benchmark_curves();
+    auto image = hi::pixmap<hi::sdf_r8>{64, 64};
+
+    state.set_items_per_iteration(image.width() * image.height());
+    while (state.running()) {
+        hi::fill(hi::pixmap_span<hi::sdf_r8>{image}, curves);
+        hi::do_not_optimize(image);
+    }
+}
+
+hi_benchmark(bezier_curve_fill_alpha)
+{
+    auto const curves = bezier_benchmark_curves();
+    auto image = hi::pixmap<uint8_t>{64, 64};
+
+    state.set_items_per_iteration(image.width() * image.height());
+    while (state.running()) {
+        hi::fill(hi::pixmap_span<uint8_t>{image}, curves);
+        hi::do_not_optimize(image);
+    }
+}
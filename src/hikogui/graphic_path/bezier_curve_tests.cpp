@@ -4,6 +4,8 @@
 
 #include "bezier_curve.hpp"
 #include <hikotest/hikotest.hpp>
+#include <vector>
+#include <limits>
 
 TEST_SUITE(bezier_curve) {
 
@@ -15,4 +17,52 @@ TEST_CASE(solve_x_by_y)
     REQUIRE(hi::bezier_curve(hi::point2(1.0f, 2.0f), hi::point2(1.0f, 1.5f), hi::point2(1.0f, 1.0f)).solveXByY(1.5f) == hi::make_lean_vector<double>(1.0f), 0.000001);
 }
 
+TEST_CASE(sdf_distance_batch)
+{
+    auto const curves = std::vector<hi::bezier_curve>{
+        hi::bezier_curve(hi::point2(4.0f, 4.0f), hi::point2(16.0f, 4.0f)),
+        hi::bezier_curve(hi::point2(16.0f, 4.0f), hi::point2(20.0f, 4.0f), hi::point2(20.0f, 8.0f)),
+        hi::bezier_curve(hi::point2(3.0f, 3.0f), hi::point2(3.0f, 3.0f))};
+
+    auto const x = hi::f32x4{0.0f, 17.5f, 19.0f, 10.0f};
+    auto const y = hi::f32x4{0.0f, 6.0f, 5.0f, 4.0f};
+
+    for (auto const& curve : curves) {
+        auto const distances = curve.sdf_distance(x, y);
+        for (auto i = std::size_t{0}; i != 4; ++i) {
+            auto const expected = curve.sdf_distance(hi::point2(x[i], y[i]));
+            REQUIRE(distances[i].sq_distance == expected.sq_distance);
+            REQUIRE(distances[i].t == expected.t);
+        }
+    }
+
+    // The distance to the middle of the line is zero.
+    REQUIRE(curves[0].sdf_distance(x, y)[3].sq_distance == 0.0f);
+    // A zero length line has no nearest point.
+    REQUIRE(curves[2].sdf_distance(x, y)[0].sq_distance == std::numeric_limits<float>::max());
+}
+
+TEST_CASE(fill_sdf_tiled)
+{
+    // A rounded square, the image is larger than a single tile.
+    auto const curves = std::vector<hi::bezier_curve>{
+        hi::bezier_curve(hi::point2(4.0f, 4.0f), hi::point2(16.0f, 4.0f)),
+        hi::bezier_curve(hi::point2(16.0f, 4.0f), hi::point2(20.0f, 4.0f), hi::point2(20.0f, 8.0f)),
+        hi::bezier_curve(hi::point2(20.0f, 8.0f), hi::point2(20.0f, 16.0f)),
+        hi::bezier_curve(hi::point2(20.0f, 16.0f), hi::point2(4.0f, 16.0f)),
+        hi::bezier_curve(hi::point2(4.0f, 16.0f), hi::point2(4.0f, 4.0f))};
+
+    auto image = hi::pixmap<hi::sdf_r8>(23, 19);
+    hi::fill(hi::pixmap_span<hi::sdf_r8>{image.data(), image.width(), image.height()}, curves);
+
+    // Compare against evaluating every curve for every pixel.
+    for (auto y = std::size_t{0}; y != image.height(); ++y) {
+        for (auto x = std::size_t{0}; x != image.width(); ++x) {
+            auto const expected =
+                hi::sdf_r8{hi::detail::generate_sdf_r8_pixel(hi::point2(static_cast<float>(x), static_cast<float>(y)), curves)};
+            REQUIRE(static_cast<float>(image[y][x]) == static_cast<float>(expected));
+        }
+    }
+}
+
 };
@@ -14,6 +14,7 @@
 #include "../macros.hpp"
 #include <vector>
 #include <utility>
+#include <functional>
 #include <cmath>
 
 hi_warning_push();
@@ -677,4 +678,23 @@ hi_export inline void fill(pixmap_span<sdf_r8> dst, graphic_path const& path) no
 
 }} // namespace hi::v1
 
+/** The hash of the shape of a path.
+ *
+ * The colors of the layers are not part of the hash.
+ */
+hi_export template<>
+struct std::hash<hi::graphic_path> {
+    [[nodiscard]] std::size_t operator()(hi::graphic_path const& rhs) const noexcept
+    {
+        auto r = std::hash<std::size_t>{}(rhs.points.size());
+        for (auto const& point : rhs.points) {
+            r = hi::hash_mix(point.p.x(), point.p.y(), std::to_underlying(point.type), r);
+        }
+        for (auto const end_point : rhs.contourEndPoints) {
+            r = hi::hash_mix(end_point, r);
+        }
+        return r;
+    }
+};
+
 hi_warning_pop();
@@ -42,4 +42,28 @@ TEST_CASE(get_bezier_points_of_contour)
     REQUIRE(points[3] == hi::bezier_point(hi::point2(1, 2), hi::bezier_point::Type::Anchor));
 }
 
+TEST_CASE(hash)
+{
+    auto const make_path = [](float x) {
+        auto path = hi::graphic_path();
+        path.moveTo(hi::point2{x, 1});
+        path.lineTo(hi::point2{2, 1});
+        path.lineTo(hi::point2{2, 2});
+        path.closeContour();
+        return path;
+    };
+
+    auto const path = make_path(1.0f);
+    REQUIRE(std::hash<hi::graphic_path>{}(path) == std::hash<hi::graphic_path>{}(make_path(1.0f)));
+    REQUIRE(std::hash<hi::graphic_path>{}(path) != std::hash<hi::graphic_path>{}(make_path(1.5f)));
+
+    // The same points in another order is another shape.
+    auto reversed = hi::graphic_path();
+    reversed.moveTo(hi::point2{2, 2});
+    reversed.lineTo(hi::point2{2, 1});
+    reversed.lineTo(hi::point2{1, 1});
+    reversed.closeContour();
+    REQUIRE(std::hash<hi::graphic_path>{}(path) != std::hash<hi::graphic_path>{}(reversed));
+}
+
 };
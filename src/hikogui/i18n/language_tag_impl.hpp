@@ -17,6 +17,8 @@
 #include <format>
 #include <ranges>
 #include <vector>
+#include <bit>
+#include <cstdint>
 
 hi_export_module(hikogui.i18n.language_tag : impl);
 
@@ -2040,16 +2042,20 @@ inline language_tag::language_tag(std::string_view str) : language(), script(),
     return language_tag{language, script, region};
 }
 
-[[nodiscard]] inline language_tag language_tag::expand() const noexcept
+namespace detail {
+
+/** Expand a language tag, without using the cache.
+ */
+[[nodiscard]] inline language_tag expand_language_tag_uncached(language_tag const& tag) noexcept
 {
-    auto r = *this;
+    auto r = tag;
 
-    if (script and region) {
+    if (r.script and r.region) {
         return r;
     }
 
     if (auto from_language = detail::expand_language_tag(r.language.code())) {
-        auto from_language_tag = parse(*from_language);
+        auto from_language_tag = language_tag::parse(*from_language);
 
         if (not r.script and from_language_tag.script) {
             r.script = from_language_tag.script;
@@ -2059,12 +2065,12 @@ inline language_tag::language_tag(std::string_view str) : language(), script(),
         }
     }
 
-    if (script and region) {
+    if (r.script and r.region) {
         return r;
     }
 
     if (auto from_region = detail::expand_language_tag(std::string{"und-"} + std::string{r.region.code2()})) {
-        auto from_region_tag = parse(*from_region);
+        auto from_region_tag = language_tag::parse(*from_region);
 
         if (not r.script and from_region_tag.script) {
             r.script = from_region_tag.script;
@@ -2074,6 +2080,46 @@ inline language_tag::language_tag(std::string_view str) : language(), script(),
     return r;
 }
 
+/** A cache of expanded language tags.
+ *
+ * Each thread has its own cache, so that it can be used without locking.
+ */
+class language_tag_expand_cache {
+public:
+    [[nodiscard]] language_tag expand(language_tag const& tag) noexcept
+    {
+        auto const hash = tag.intrinsic() * 0x9e37'79b9'7f4a'7c15ULL;
+        auto& entry = _entries[hash >> (64 - std::countr_zero(size))];
+        if (not entry.valid or entry.key != tag) {
+            entry = {tag, expand_language_tag_uncached(tag), true};
+        }
+        return entry.value;
+    }
+
+private:
+    constexpr static auto size = 64_uz;
+
+    struct entry_type {
+        language_tag key;
+        language_tag value;
+        bool valid = false;
+    };
+
+    std::array<entry_type, size> _entries = {};
+};
+
+inline thread_local language_tag_expand_cache language_tag_expand_cache_local;
+
+} // namespace detail
+
+[[nodiscard]] inline language_tag language_tag::expand() const noexcept
+{
+    if (script and region) {
+        return *this;
+    }
+    return detail::language_tag_expand_cache_local.expand(*this);
+}
+
 [[nodiscard]] inline std::vector<language_tag> variants(std::vector<language_tag> languages)
 {
     auto tmp = std::vector<std::vector<language_tag>>{};
@@ -15,6 +15,9 @@
 #include <coroutine>
 #include <format>
 #include <string>
+#include <bit>
+#include <type_traits>
+#include <cstdint>
 
 hi_export_module(hikogui.i18n.language_tag : intf);
 
@@ -139,6 +142,7 @@ public:
     /** Expand the language tag to include script and language.
      *
      * Expansion is done by querying default script, default language and grandfathering tables.
+     * The expansions are cached, since a program uses only a few different language tags.
      */
     [[nodiscard]] language_tag expand() const noexcept;
 
@@ -202,9 +206,24 @@ public:
         return true;
     }
 
-    [[nodiscard]] constexpr friend bool operator==(language_tag const&, language_tag const&) noexcept = default;
+    /** The language tag as a single integer.
+     *
+     * Used to compare and hash language tags as a single integer.
+     */
+    [[nodiscard]] constexpr uint64_t intrinsic() const noexcept
+    {
+        return std::bit_cast<uint64_t>(*this);
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(language_tag const& lhs, language_tag const& rhs) noexcept
+    {
+        return lhs.intrinsic() == rhs.intrinsic();
+    }
 };
 
+static_assert(sizeof(language_tag) == sizeof(uint64_t));
+static_assert(std::is_trivially_copyable_v<language_tag>);
+
 /** Add variants to the list of languages.
  *
  * This function is mostly used to add languages to a list of preferred languages
@@ -221,10 +240,7 @@ hi_export template<>
 struct std::hash<hi::language_tag> {
     [[nodiscard]] size_t operator()(hi::language_tag const& rhs) const noexcept
     {
-        return hi::hash_mix(
-            std::hash<hi::iso_639>{}(rhs.language),
-            std::hash<hi::iso_15924>{}(rhs.script),
-            std::hash<hi::iso_3166>{}(rhs.region));
+        return std::hash<uint64_t>{}(rhs.intrinsic());
     }
 };
 
@@ -4,6 +4,8 @@
 
 #include "language_tag.hpp"
 #include <hikotest/hikotest.hpp>
+#include <string>
+#include <vector>
 
 hi_warning_push();
 hi_warning_ignore_msvc(4834);
@@ -180,6 +182,29 @@ TEST_CASE(variant_vector_test)
     REQUIRE(variants(test) == expected);
 }
 
+TEST_CASE(expand_cache_test)
+{
+    // More tags than fit in the expansion cache, expanded twice.
+    auto const regions = std::vector<std::string>{"NL", "BE", "US", "GB", "DE", "FR", "JP", "CN", "RU", "BR"};
+    for (auto i = 0; i != 2; ++i) {
+        for (auto const language : {"nl", "en", "de", "fr", "ja", "zh", "ru", "pt"}) {
+            for (auto const& region : regions) {
+                auto const t = tag::parse(std::string{language} + "-" + region);
+                REQUIRE(t.expand() == hi::detail::expand_language_tag_uncached(t));
+            }
+        }
+    }
+}
+
+TEST_CASE(intrinsic_test)
+{
+    REQUIRE(tag::parse("nl-NL") == tag::parse("nl-NL"));
+    REQUIRE(tag::parse("nl-NL") != tag::parse("nl-BE"));
+    REQUIRE(tag::parse("nl-NL").intrinsic() == tag::parse("nl-NL").intrinsic());
+    REQUIRE(tag::parse("nl-NL").intrinsic() != tag::parse("nl-Latn-NL").intrinsic());
+    REQUIRE(tag{}.intrinsic() == 0);
+}
+
 };
 
 hi_warning_pop();
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include "pixel_convert.hpp" // export
 #include "pixmap.hpp" // export
+#include "pixmap_algorithm.hpp" // export
 #include "pixmap_span.hpp" // export
 #include "sdf_r8.hpp" // export
 #include "sfloat_rg32.hpp" // export
@@ -15,6 +17,7 @@
 #include "sint_abgr8_pack.hpp" // export
 #include "snorm_r8.hpp" // export
 #include "srgb_abgr8_pack.hpp" // export
+#include "srgb_bc3_block.hpp" // export
 #include "uint_abgr8_pack.hpp" // export
 #include "unorm_a2bgr10_pack.hpp" // export
 
@@ -41,6 +44,7 @@ Pixel formats
  | `int_abgr8_pack`     | `VK_FORMAT_A8B8G8R8_SINT_PACK32`     |                                  |
  | `uint_abgr8_pack`    | `VK_FORMAT_A8B8G8R8_UINT_PACK32`     |                                  |
  | `srgb_abgr8_pack`    | `VK_FORMAT_A8B8G8R8_SRGB_PACK32`     |                                  |
+ | `srgb_bc3_block`     | `VK_FORMAT_BC3_SRGB_BLOCK`           | 4x4 pixels compressed to 16 bytes|
  | `unorm_a2bgr10_pack` | `VK_FORMAT_A2R10G10B10_UNORM_PACK32` |                                  |
  | `sdf_r8`             | `VK_FORMAT_R8_SNORM`                 | To store signed-distance-field.  |
 
@@ -0,0 +1,194 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file image/pixel_convert.hpp Color conversion of many pixels at once.
+ * @ingroup image
+ */
+
+#pragma once
+
+#include "sfloat_rgba16.hpp"
+#include "srgb_abgr8_pack.hpp"
+#include "../color/color.hpp"
+#include "../geometry/geometry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <span>
+#include <array>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.image.pixel_convert);
+
+hi_export namespace hi::inline v1 {
+namespace detail {
+
+/** The number of pixels that are converted through a temporary buffer at once.
+ */
+constexpr auto pixel_convert_chunk_size = 64_uz;
+
+template<int32_t Channel>
+constexpr auto pixel_convert_indices =
+    std::array<int32_t, 8>{Channel, 4 + Channel, 8 + Channel, 12 + Channel, 16 + Channel, 20 + Channel, 24 + Channel, 28 + Channel};
+
+/** Transform the color of 8 interleaved RGBA pixels.
+ *
+ * The red, green and blue channels of the 8 pixels are loaded into separate
+ * registers, so that each channel of the 8 pixels is calculated at once.
+ */
+hi_force_inline void color_transform_8(matrix3 const& lhs, float *rgba) noexcept
+{
+    auto const& c0 = get<0>(lhs);
+    auto const& c1 = get<1>(lhs);
+    auto const& c2 = get<2>(lhs);
+
+    auto const r = f32x8::gather(rgba, pixel_convert_indices<0>);
+    auto const g = f32x8::gather(rgba, pixel_convert_indices<1>);
+    auto const b = f32x8::gather(rgba, pixel_convert_indices<2>);
+
+    auto const r_ = f32x8::broadcast(c0.x()) * r + f32x8::broadcast(c1.x()) * g + f32x8::broadcast(c2.x()) * b;
+    auto const g_ = f32x8::broadcast(c0.y()) * r + f32x8::broadcast(c1.y()) * g + f32x8::broadcast(c2.y()) * b;
+    auto const b_ = f32x8::broadcast(c0.z()) * r + f32x8::broadcast(c1.z()) * g + f32x8::broadcast(c2.z()) * b;
+
+    for (auto i = 0_uz; i != 8; ++i) {
+        rgba[i * 4 + 0] = r_[i];
+        rgba[i * 4 + 1] = g_[i];
+        rgba[i * 4 + 2] = b_[i];
+    }
+}
+
+} // namespace detail
+
+/** Transform the color of interleaved RGBA pixels by a color matrix.
+ *
+ * The alpha channel is not included in the transformation; this means the
+ * pixels may be pre-multiplied by alpha.
+ *
+ * @note It is undefined behavior if the matrix contains a translation.
+ * @param lhs The 3x3 color transformation matrix to use.
+ * @param[in,out] rgba The red, green, blue and alpha values of each pixel.
+ */
+inline void color_transform(matrix3 const& lhs, std::span<float> rgba) noexcept
+{
+    hi_axiom(rgba.size() % 4 == 0);
+
+    auto const num_pixels = rgba.size() / 4;
+    auto i = 0_uz;
+    for (; i + 8 <= num_pixels; i += 8) {
+        detail::color_transform_8(lhs, rgba.data() + i * 4);
+    }
+    for (; i != num_pixels; ++i) {
+        auto pixel = f32x4::masked_load(rgba.data() + i * 4, 0b1111);
+        pixel = get<0>(lhs) * pixel.xxxx() + get<1>(lhs) * pixel.yyyy() + get<2>(lhs) * pixel.zzzz() + pixel._000w();
+        masked_store(rgba.data() + i * 4, pixel, 0b1111);
+    }
+}
+
+/** Convert colors to half-float pixels, while transforming them.
+ *
+ * This is the same as `dst[i] = lhs * src[i]`, but converts many colors at once.
+ *
+ * @param src The colors to convert.
+ * @param[out] dst The converted pixels, at least as large as @a src.
+ * @param lhs The 3x3 color transformation matrix to use.
+ */
+inline void convert(std::span<color const> src, std::span<sfloat_rgba16> dst, matrix3 const& lhs) noexcept
+{
+    static_assert(sizeof(color) == 4 * sizeof(uint16_t));
+    static_assert(sizeof(sfloat_rgba16) == 4 * sizeof(uint16_t));
+    hi_axiom(src.size() <= dst.size());
+
+    constexpr auto chunk_size = detail::pixel_convert_chunk_size;
+    auto halfs = std::array<uint16_t, chunk_size * 4>{};
+    auto linear = std::array<float, chunk_size * 4>{};
+
+    for (auto x = 0_uz; x < src.size(); x += chunk_size) {
+        auto const size = std::min(chunk_size, src.size() - x);
+
+        std::memcpy(halfs.data(), src.data() + x, size * sizeof(color));
+        half_to_float(halfs.data(), linear.data(), size * 4);
+        color_transform(lhs, std::span{linear.data(), size * 4});
+        float_to_half(linear.data(), halfs.data(), size * 4);
+        std::memcpy(dst.data() + x, halfs.data(), size * sizeof(sfloat_rgba16));
+    }
+}
+
+/** Convert linear half-float pixels to sRGB pixels.
+ *
+ * The sRGB transfer function is done through a lookup table
+ * indexed by the half-float value.
+ *
+ * @param src The linear pixels to convert.
+ * @param[out] dst The sRGB pixels, at least as large as @a src.
+ */
+inline void convert(std::span<sfloat_rgba16 const> src, std::span<srgb_abgr8_pack> dst) noexcept
+{
+    static_assert(sizeof(sfloat_rgba16) == 4 * sizeof(uint16_t));
+    hi_axiom(src.size() <= dst.size());
+
+    constexpr auto chunk_size = detail::pixel_convert_chunk_size;
+    auto halfs = std::array<uint16_t, chunk_size * 4>{};
+    auto linear = std::array<float, chunk_size * 4>{};
+
+    for (auto x = 0_uz; x < src.size(); x += chunk_size) {
+        auto const size = std::min(chunk_size, src.size() - x);
+
+        // Only the alpha channel is converted to float, but converting all
+        // channels at once is faster than picking out the alpha values.
+        std::memcpy(halfs.data(), src.data() + x, size * sizeof(sfloat_rgba16));
+        half_to_float(halfs.data(), linear.data(), size * 4);
+
+        for (auto i = 0_uz; i != size; ++i) {
+            auto const& table = detail::sRGB_linear16_to_gamma8_table;
+            auto const r = table[halfs[i * 4 + 0]];
+            auto const g = table[halfs[i * 4 + 1]];
+            auto const b = table[halfs[i * 4 + 2]];
+            auto const a = round_cast<uint8_t>(std::clamp(linear[i * 4 + 3], 0.0f, 1.0f) * 255.0f);
+            dst[x + i] = (static_cast<uint32_t>(a) << 24) | (static_cast<uint32_t>(b) << 16) | (static_cast<uint32_t>(g) << 8) |
+                static_cast<uint32_t>(r);
+        }
+    }
+}
+
+/** Convert sRGB pixels to linear half-float pixels.
+ *
+ * The sRGB transfer function is done through a lookup table.
+ *
+ * @param src The sRGB pixels to convert.
+ * @param[out] dst The linear pixels, at least as large as @a src.
+ */
+inline void convert(std::span<srgb_abgr8_pack const> src, std::span<sfloat_rgba16> dst) noexcept
+{
+    static_assert(sizeof(sfloat_rgba16) == 4 * sizeof(uint16_t));
+    hi_axiom(src.size() <= dst.size());
+
+    constexpr auto chunk_size = detail::pixel_convert_chunk_size;
+    auto halfs = std::array<uint16_t, chunk_size * 4>{};
+    auto alphas = std::array<float, chunk_size>{};
+    auto alpha_halfs = std::array<uint16_t, chunk_size>{};
+
+    for (auto x = 0_uz; x < src.size(); x += chunk_size) {
+        auto const size = std::min(chunk_size, src.size() - x);
+
+        for (auto i = 0_uz; i != size; ++i) {
+            alphas[i] = static_cast<float>(static_cast<uint32_t>(src[x + i]) >> 24) * (1.0f / 255.0f);
+        }
+        float_to_half(alphas.data(), alpha_halfs.data(), size);
+
+        for (auto i = 0_uz; i != size; ++i) {
+            auto const packed = static_cast<uint32_t>(src[x + i]);
+            auto const& table = detail::sRGB_gamma8_to_linear16_table;
+            halfs[i * 4 + 0] = table[packed & 0xff].intrinsic();
+            halfs[i * 4 + 1] = table[(packed >> 8) & 0xff].intrinsic();
+            halfs[i * 4 + 2] = table[(packed >> 16) & 0xff].intrinsic();
+            halfs[i * 4 + 3] = alpha_halfs[i];
+        }
+        std::memcpy(dst.data() + x, halfs.data(), size * sizeof(sfloat_rgba16));
+    }
+}
+
+} // namespace hi::inline v1
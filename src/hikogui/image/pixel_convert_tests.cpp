@@ -0,0 +1,86 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "pixel_convert.hpp"
+#include "../color/Rec2020.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <cstdlib>
+
+TEST_SUITE(pixel_convert) {
+
+TEST_CASE(color_transform_test)
+{
+    auto const M = hi::XYZ_to_sRGB * hi::Rec2020_to_XYZ;
+
+    // 11 pixels; one batch of 8 and a tail of 3.
+    auto rgba = std::vector<float>{};
+    for (auto i = 0; i != 11; ++i) {
+        rgba.push_back(i * 0.09f);
+        rgba.push_back(1.0f - i * 0.09f);
+        rgba.push_back(0.5f);
+        rgba.push_back(i * 0.1f);
+    }
+    auto const original = rgba;
+
+    hi::color_transform(M, rgba);
+
+    for (auto i = std::size_t{0}; i != 11; ++i) {
+        auto const expected = M * hi::f32x4{original[i * 4], original[i * 4 + 1], original[i * 4 + 2], original[i * 4 + 3]};
+        REQUIRE(rgba[i * 4 + 0] == expected.x(), 0.0001);
+        REQUIRE(rgba[i * 4 + 1] == expected.y(), 0.0001);
+        REQUIRE(rgba[i * 4 + 2] == expected.z(), 0.0001);
+        REQUIRE(rgba[i * 4 + 3] == original[i * 4 + 3]);
+    }
+}
+
+TEST_CASE(color_to_sfloat_rgba16_test)
+{
+    auto const M = hi::XYZ_to_sRGB * hi::Rec2020_to_XYZ;
+
+    auto colors = std::vector<hi::color>{};
+    for (auto i = 0; i != 70; ++i) {
+        colors.emplace_back(i / 70.0f, 0.25f, 1.0f - i / 70.0f, 0.5f);
+    }
+
+    auto pixels = std::vector<hi::sfloat_rgba16>(colors.size());
+    hi::convert(std::span<hi::color const>{colors}, std::span<hi::sfloat_rgba16>{pixels}, M);
+
+    for (auto i = std::size_t{0}; i != colors.size(); ++i) {
+        auto const expected = static_cast<hi::f32x4>(M * colors[i]);
+        auto const result = static_cast<hi::f32x4>(static_cast<hi::f16x4>(pixels[i]));
+        REQUIRE(result == expected, 0.002);
+    }
+}
+
+TEST_CASE(sRGB_round_trip_test)
+{
+    auto sRGB = std::vector<hi::srgb_abgr8_pack>{};
+    for (auto i = std::size_t{0}; i != 256; ++i) {
+        auto const v = static_cast<uint32_t>(i);
+        auto const w = static_cast<uint32_t>(255 - i);
+        sRGB.emplace_back((v << 24) | (w << 16) | (v << 8) | w);
+    }
+
+    auto linear = std::vector<hi::sfloat_rgba16>(sRGB.size());
+    hi::convert(std::span<hi::srgb_abgr8_pack const>{sRGB}, std::span<hi::sfloat_rgba16>{linear});
+
+    REQUIRE(static_cast<hi::f32x4>(static_cast<hi::f16x4>(linear[0])) == hi::f32x4{1.0f, 0.0f, 1.0f, 0.0f});
+    REQUIRE(static_cast<hi::f32x4>(static_cast<hi::f16x4>(linear[255])) == hi::f32x4{0.0f, 1.0f, 0.0f, 1.0f});
+
+    auto result = std::vector<hi::srgb_abgr8_pack>(linear.size());
+    hi::convert(std::span<hi::sfloat_rgba16 const>{linear}, std::span<hi::srgb_abgr8_pack>{result});
+
+    // The round trip may be off by one, since the linear value is rounded to a half-float.
+    for (auto i = std::size_t{0}; i != sRGB.size(); ++i) {
+        auto const expected = static_cast<uint32_t>(sRGB[i]);
+        auto const value = static_cast<uint32_t>(result[i]);
+        for (auto shift = 0; shift != 32; shift += 8) {
+            auto const diff = static_cast<int>((value >> shift) & 0xff) - static_cast<int>((expected >> shift) & 0xff);
+            REQUIRE(std::abs(diff) <= 1);
+        }
+    }
+}
+
+};
@@ -0,0 +1,412 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file image/pixmap_algorithm.hpp Bulk operations on images.
+ * @ingroup image
+ *
+ * The operations in this file split the rows of large images into bands,
+ * which are processed in parallel on `thread_pool::global()`.
+ */
+
+#pragma once
+
+#include "pixmap.hpp"
+#include "pixmap_span.hpp"
+#include "pixel_convert.hpp"
+#include "sfloat_rgba16.hpp"
+#include "../dispatch/thread_pool.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <algorithm>
+#include <numbers>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.image.pixmap_algorithm);
+
+hi_export namespace hi { inline namespace v1 {
+namespace detail {
+
+/** Images with fewer pixels than this are processed on the current thread.
+ */
+constexpr auto pixmap_parallel_min_pixels = 65536_uz;
+
+/** The minimum number of rows in a band.
+ */
+constexpr auto pixmap_parallel_min_rows = 16_uz;
+
+/** Call a function on bands of rows, in parallel.
+ *
+ * The current thread processes the first band itself, then waits for the other
+ * bands to complete. When called from a thread of the pool the rows are processed
+ * on the current thread, so that the pool does not wait on itself.
+ *
+ * @param width The width of the image, used to decide if the work is worth splitting.
+ * @param height The number of rows.
+ * @param func The function to call as `func(first_row, last_row)`.
+ */
+template<typename Func>
+inline void pixmap_parallel_rows(std::size_t width, std::size_t height, Func const& func) noexcept
+{
+    auto& pool = thread_pool::global();
+
+    auto const num_bands = std::min(pool.num_threads() + 1, ceil(height, pixmap_parallel_min_rows) / pixmap_parallel_min_rows);
+    if (width * height < pixmap_parallel_min_pixels or num_bands <= 1 or pool.on_thread()) {
+        return func(0_uz, height);
+    }
+
+    auto const rows_per_band = ceil(height, num_bands) / num_bands;
+
+    pool.parallel_for(num_bands, [&](std::size_t i) {
+        auto const first = std::min(i * rows_per_band, height);
+        auto const last = std::min(first + rows_per_band, height);
+        func(first, last);
+    });
+}
+
+/** Convert a row of pixels.
+ *
+ * Uses the bulk `convert()` functions when available, otherwise each pixel is
+ * converted by assignment.
+ */
+template<typename T, typename U>
+inline void pixmap_convert_row(std::span<T const> src, std::span<U> dst) noexcept
+{
+    if constexpr (std::same_as<T, U>) {
+        std::copy(src.begin(), src.end(), dst.begin());
+    } else if constexpr (requires { convert(src, dst); }) {
+        convert(src, dst);
+    } else {
+        for (auto x = 0_uz; x != src.size(); ++x) {
+            dst[x] = src[x];
+        }
+    }
+}
+
+/** The weights of a separable resampling filter.
+ *
+ * For each destination pixel, a contiguous range of source pixels and their weights.
+ */
+struct pixmap_resample_kernel {
+    std::vector<std::size_t> first;
+    std::vector<std::size_t> offset;
+    std::vector<float> weights;
+};
+
+[[nodiscard]] inline float lanczos(float x, float a) noexcept
+{
+    if (x == 0.0f) {
+        return 1.0f;
+    } else if (std::abs(x) >= a) {
+        return 0.0f;
+    }
+
+    auto const pi_x = std::numbers::pi_v<float> * x;
+    return a * std::sin(pi_x) * std::sin(pi_x / a) / (pi_x * pi_x);
+}
+
+/** Make the weights for resampling one axis.
+ *
+ * @param src_size The number of pixels along the axis of the source.
+ * @param dst_size The number of pixels along the axis of the destination.
+ * @param filter The filter used to calculate the weights.
+ */
+template<typename Filter>
+[[nodiscard]] inline pixmap_resample_kernel make_resample_kernel(std::size_t src_size, std::size_t dst_size, Filter const& filter) noexcept
+{
+    hi_axiom(src_size != 0);
+
+    auto r = pixmap_resample_kernel{};
+    r.first.reserve(dst_size);
+    r.offset.reserve(dst_size + 1);
+
+    auto const scale = static_cast<float>(src_size) / static_cast<float>(dst_size);
+    auto const max_index = static_cast<std::ptrdiff_t>(src_size) - 1;
+
+    for (auto x = 0_uz; x != dst_size; ++x) {
+        // The center of the destination pixel in source coordinates.
+        auto const center = (static_cast<float>(x) + 0.5f) * scale;
+
+        auto const [lo, hi] = filter.support(center, scale);
+        auto const first = std::clamp(lo, std::ptrdiff_t{0}, max_index);
+        auto const last = std::clamp(hi, std::ptrdiff_t{0}, max_index);
+
+        r.first.push_back(static_cast<std::size_t>(first));
+        r.offset.push_back(r.weights.size());
+        r.weights.resize(r.weights.size() + static_cast<std::size_t>(last - first + 1), 0.0f);
+        auto const weights = std::span{r.weights}.subspan(r.offset.back());
+
+        // Pixels beyond the edge are replaced by the pixels on the edge.
+        auto total = 0.0f;
+        for (auto i = lo; i <= hi; ++i) {
+            auto const w = filter.weight(static_cast<float>(i) + 0.5f, center, scale);
+            weights[static_cast<std::size_t>(std::clamp(i, first, last) - first)] += w;
+            total += w;
+        }
+
+        if (total != 0.0f) {
+            for (auto& w : weights) {
+                w /= total;
+            }
+        }
+    }
+    r.offset.push_back(r.weights.size());
+    return r;
+}
+
+struct pixmap_box_filter {
+    [[nodiscard]] std::pair<std::ptrdiff_t, std::ptrdiff_t> support(float center, float scale) const noexcept
+    {
+        auto const radius = std::max(scale, 1.0f) * 0.5f;
+        return {
+            static_cast<std::ptrdiff_t>(std::floor(center - radius)), static_cast<std::ptrdiff_t>(std::ceil(center + radius)) - 1};
+    }
+
+    /** The overlap between the destination pixel and a source pixel.
+     */
+    [[nodiscard]] float weight(float src_center, float center, float scale) const noexcept
+    {
+        auto const radius = std::max(scale, 1.0f) * 0.5f;
+        auto const lo = std::max(src_center - 0.5f, center - radius);
+        auto const hi = std::min(src_center + 0.5f, center + radius);
+        return std::max(hi - lo, 0.0f);
+    }
+};
+
+struct pixmap_lanczos_filter {
+    float a = 3.0f;
+
+    [[nodiscard]] std::pair<std::ptrdiff_t, std::ptrdiff_t> support(float center, float scale) const noexcept
+    {
+        auto const radius = std::max(scale, 1.0f) * a;
+        return {
+            static_cast<std::ptrdiff_t>(std::floor(center - radius)), static_cast<std::ptrdiff_t>(std::ceil(center + radius))};
+    }
+
+    [[nodiscard]] float weight(float src_center, float center, float scale) const noexcept
+    {
+        // When downscaling the filter is widened, so that it also acts as a low-pass filter.
+        return lanczos((src_center - center) / std::max(scale, 1.0f), a);
+    }
+};
+
+[[nodiscard]] inline f32x4 to_f32x4(sfloat_rgba16 const& rhs) noexcept
+{
+    return static_cast<f32x4>(static_cast<f16x4>(rhs));
+}
+
+} // namespace detail
+
+/** Fill an image with a single value.
+ *
+ * @ingroup image
+ * @param dst The image to fill.
+ * @param value The value to fill the image with.
+ */
+template<typename T>
+inline void parallel_fill(pixmap_span<T> dst, T const& value) noexcept
+{
+    detail::pixmap_parallel_rows(dst.width(), dst.height(), [&](std::size_t first, std::size_t last) {
+        for (auto y = first; y != last; ++y) {
+            auto const row = dst[y];
+            std::fill(row.begin(), row.end(), value);
+        }
+    });
+}
+
+/** Copy an image, while converting the pixel format.
+ *
+ * Rows are converted with the bulk `convert()` functions when those exist for
+ * the combination of pixel formats, otherwise each pixel is converted by assignment.
+ *
+ * @ingroup image
+ * @param src The image to copy.
+ * @param dst The destination, with the same size as @a src.
+ */
+template<typename T, typename U>
+inline void parallel_copy(pixmap_span<T const> src, pixmap_span<U> dst) noexcept
+{
+    hi_axiom(src.width() == dst.width());
+    hi_axiom(src.height() == dst.height());
+
+    detail::pixmap_parallel_rows(src.width(), src.height(), [&](std::size_t first, std::size_t last) {
+        for (auto y = first; y != last; ++y) {
+            detail::pixmap_convert_row(src[y], dst[y]);
+        }
+    });
+}
+
+/** Multiply the color of each pixel with its alpha.
+ *
+ * @ingroup image
+ * @param image The image to change in place.
+ */
+inline void premultiply_alpha(pixmap_span<sfloat_rgba16> image) noexcept
+{
+    detail::pixmap_parallel_rows(image.width(), image.height(), [&](std::size_t first, std::size_t last) {
+        for (auto y = first; y != last; ++y) {
+            for (auto& pixel : image[y]) {
+                auto const p = detail::to_f32x4(pixel);
+                pixel = p * p.wwww().xyz1();
+            }
+        }
+    });
+}
+
+/** Divide the color of each pixel by its alpha.
+ *
+ * Fully transparent pixels become black.
+ *
+ * @ingroup image
+ * @param image The image to change in place.
+ */
+inline void unpremultiply_alpha(pixmap_span<sfloat_rgba16> image) noexcept
+{
+    detail::pixmap_parallel_rows(image.width(), image.height(), [&](std::size_t first, std::size_t last) {
+        for (auto y = first; y != last; ++y) {
+            for (auto& pixel : image[y]) {
+                auto const p = detail::to_f32x4(pixel);
+                if (p.w() == 0.0f) {
+                    pixel = f32x4{};
+                } else {
+                    pixel = p / p.wwww().xyz1();
+                }
+            }
+        }
+    });
+}
+
+/** The filter to use when resampling an image.
+ *
+ * @ingroup image
+ */
+enum class resample_filter {
+    /** Average of the source pixels covered by each destination pixel.
+     *
+     * Fast, and exact when downscaling by an integer factor.
+     */
+    box,
+
+    /** Lanczos filter with a=3.
+     *
+     * Sharper than box, at the cost of slight ringing near hard edges.
+     */
+    lanczos3
+};
+
+/** Resample an image to a new size.
+ *
+ * The image is resampled separately along the horizontal and vertical axis.
+ * The pixels should be pre-multiplied by alpha, so that the colors of
+ * transparent pixels do not bleed.
+ *
+ * @ingroup image
+ * @param src The image to resample.
+ * @param dst The destination image, with the new size.
+ * @param filter The filter to use.
+ */
+inline void resample(pixmap_span<sfloat_rgba16 const> src, pixmap_span<sfloat_rgba16> dst, resample_filter filter) noexcept
+{
+    if (src.empty() or dst.empty()) {
+        return;
+    }
+
+    auto const make_kernel = [filter](std::size_t src_size, std::size_t dst_size) {
+        if (filter == resample_filter::box) {
+            return detail::make_resample_kernel(src_size, dst_size, detail::pixmap_box_filter{});
+        } else {
+            return detail::make_resample_kernel(src_size, dst_size, detail::pixmap_lanczos_filter{});
+        }
+    };
+
+    auto const h_kernel = make_kernel(src.width(), dst.width());
+    auto const v_kernel = make_kernel(src.height(), dst.height());
+
+    // The horizontal pass, from (src.width, src.height) to (dst.width, src.height).
+    auto tmp = pixmap<f32x4>{dst.width(), src.height()};
+    auto tmp_span = pixmap_span<f32x4>{tmp};
+    detail::pixmap_parallel_rows(src.width(), src.height(), [&](std::size_t first, std::size_t last) {
+        auto src_row = std::vector<f32x4>(src.width());
+
+        for (auto y = first; y != last; ++y) {
+            std::ranges::transform(src[y], src_row.begin(), detail::to_f32x4);
+
+            auto const tmp_row = tmp_span[y];
+            for (auto x = 0_uz; x != dst.width(); ++x) {
+                auto const offset = h_kernel.offset[x];
+                auto const count = h_kernel.offset[x + 1] - offset;
+                auto const *p = src_row.data() + h_kernel.first[x];
+
+                auto sum = f32x4{};
+                for (auto i = 0_uz; i != count; ++i) {
+                    sum += p[i] * f32x4::broadcast(h_kernel.weights[offset + i]);
+                }
+                tmp_row[x] = sum;
+            }
+        }
+    });
+
+    // The vertical pass, from (dst.width, src.height) to (dst.width, dst.height).
+    auto const lanczos_clamp = filter == resample_filter::lanczos3;
+    detail::pixmap_parallel_rows(dst.width(), dst.height(), [&](std::size_t first, std::size_t last) {
+        auto sum_row = std::vector<f32x4>(dst.width());
+
+        for (auto y = first; y != last; ++y) {
+            std::ranges::fill(sum_row, f32x4{});
+
+            auto const offset = v_kernel.offset[y];
+            auto const count = v_kernel.offset[y + 1] - offset;
+            for (auto i = 0_uz; i != count; ++i) {
+                auto const weight = f32x4::broadcast(v_kernel.weights[offset + i]);
+                auto const tmp_row = tmp_span[v_kernel.first[y] + i];
+                for (auto x = 0_uz; x != dst.width(); ++x) {
+                    sum_row[x] += tmp_row[x] * weight;
+                }
+            }
+
+            auto const dst_row = dst[y];
+            for (auto x = 0_uz; x != dst.width(); ++x) {
+                if (lanczos_clamp) {
+                    // Remove the undershoot and overshoot of the negative lobes of the filter.
+                    auto const alpha = std::clamp(sum_row[x].w(), 0.0f, 1.0f);
+                    sum_row[x] = max(sum_row[x], f32x4{});
+                    sum_row[x].w() = alpha;
+                }
+                dst_row[x] = sum_row[x];
+            }
+        }
+    });
+}
+
+/** Make the chain of mipmap levels of an image.
+ *
+ * Each level is half the width and height of the previous level, rounded down
+ * but at least one pixel, until the level is a single pixel.
+ *
+ * @ingroup image
+ * @param image The image at level 0, the pixels should be pre-multiplied by alpha.
+ * @return The images of level 1 and higher.
+ */
+[[nodiscard]] inline std::vector<pixmap<sfloat_rgba16>> make_mipmaps(pixmap_span<sfloat_rgba16 const> image) noexcept
+{
+    auto r = std::vector<pixmap<sfloat_rgba16>>{};
+
+    auto previous = image;
+    while (previous.width() > 1 or previous.height() > 1) {
+        auto const width = std::max(previous.width() / 2, 1_uz);
+        auto const height = std::max(previous.height() / 2, 1_uz);
+
+        auto& level = r.emplace_back(width, height);
+        resample(previous, pixmap_span<sfloat_rgba16>{level}, resample_filter::box);
+        previous = pixmap_span<sfloat_rgba16 const>{level};
+    }
+    return r;
+}
+
+}} // namespace hi::v1
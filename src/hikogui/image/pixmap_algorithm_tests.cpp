@@ -0,0 +1,145 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "pixmap_algorithm.hpp"
+#include <hikotest/hikotest.hpp>
+#include <cstdlib>
+
+using hi::operator""_uz;
+
+TEST_SUITE(pixmap_algorithm) {
+
+[[nodiscard]] static hi::f32x4 get_pixel(hi::pixmap<hi::sfloat_rgba16> const& image, std::size_t x, std::size_t y)
+{
+    return static_cast<hi::f32x4>(static_cast<hi::f16x4>(image[y][x]));
+}
+
+TEST_CASE(parallel_fill_test)
+{
+    // Large enough to be split into bands.
+    auto image = hi::pixmap<hi::sfloat_rgba16>{512, 300};
+    hi::parallel_fill(hi::pixmap_span<hi::sfloat_rgba16>{image}, hi::sfloat_rgba16{hi::f32x4{0.25f, 0.5f, 0.75f, 1.0f}});
+
+    for (auto const [x, y] : {std::pair{0_uz, 0_uz}, std::pair{511_uz, 0_uz}, std::pair{100_uz, 150_uz}, std::pair{511_uz, 299_uz}}) {
+        auto const p = get_pixel(image, x, y);
+        REQUIRE(p.x() == 0.25f);
+        REQUIRE(p.y() == 0.5f);
+        REQUIRE(p.z() == 0.75f);
+        REQUIRE(p.w() == 1.0f);
+    }
+}
+
+TEST_CASE(parallel_copy_convert_test)
+{
+    auto src = hi::pixmap<hi::srgb_abgr8_pack>{400, 200};
+    for (auto y = 0_uz; y != src.height(); ++y) {
+        for (auto x = 0_uz; x != src.width(); ++x) {
+            src[y][x] = static_cast<uint32_t>(0xff000000 | (y % 256) << 8 | (x % 256));
+        }
+    }
+
+    auto linear = hi::pixmap<hi::sfloat_rgba16>{400, 200};
+    hi::parallel_copy(hi::pixmap_span<hi::srgb_abgr8_pack const>{src}, hi::pixmap_span<hi::sfloat_rgba16>{linear});
+
+    auto dst = hi::pixmap<hi::srgb_abgr8_pack>{400, 200};
+    hi::parallel_copy(hi::pixmap_span<hi::sfloat_rgba16 const>{linear}, hi::pixmap_span<hi::srgb_abgr8_pack>{dst});
+
+    for (auto y = 0_uz; y != src.height(); ++y) {
+        for (auto x = 0_uz; x != src.width(); ++x) {
+            auto const expected = static_cast<uint32_t>(src[y][x]);
+            auto const result = static_cast<uint32_t>(dst[y][x]);
+            for (auto shift = 0; shift != 32; shift += 8) {
+                auto const e = static_cast<int>((expected >> shift) & 0xff);
+                auto const r = static_cast<int>((result >> shift) & 0xff);
+                REQUIRE(std::abs(e - r) <= 1);
+            }
+        }
+    }
+}
+
+TEST_CASE(premultiply_alpha_test)
+{
+    auto image = hi::pixmap<hi::sfloat_rgba16>{3, 1};
+    image[0][0] = hi::f32x4{1.0f, 0.5f, 0.25f, 0.5f};
+    image[0][1] = hi::f32x4{1.0f, 1.0f, 1.0f, 0.0f};
+    image[0][2] = hi::f32x4{0.5f, 0.5f, 0.5f, 1.0f};
+
+    hi::premultiply_alpha(hi::pixmap_span<hi::sfloat_rgba16>{image});
+    REQUIRE(equal(get_pixel(image, 0, 0), hi::f32x4(0.5f, 0.25f, 0.125f, 0.5f)));
+    REQUIRE(equal(get_pixel(image, 1, 0), hi::f32x4(0.0f, 0.0f, 0.0f, 0.0f)));
+    REQUIRE(equal(get_pixel(image, 2, 0), hi::f32x4(0.5f, 0.5f, 0.5f, 1.0f)));
+
+    hi::unpremultiply_alpha(hi::pixmap_span<hi::sfloat_rgba16>{image});
+    REQUIRE(equal(get_pixel(image, 0, 0), hi::f32x4(1.0f, 0.5f, 0.25f, 0.5f)));
+    REQUIRE(equal(get_pixel(image, 1, 0), hi::f32x4(0.0f, 0.0f, 0.0f, 0.0f)));
+    REQUIRE(equal(get_pixel(image, 2, 0), hi::f32x4(0.5f, 0.5f, 0.5f, 1.0f)));
+}
+
+TEST_CASE(resample_box_test)
+{
+    // A checkerboard of 2x2 blocks averages to a uniform gray when halved twice.
+    auto src = hi::pixmap<hi::sfloat_rgba16>{8, 8};
+    for (auto y = 0_uz; y != 8; ++y) {
+        for (auto x = 0_uz; x != 8; ++x) {
+            auto const v = ((x / 2) + (y / 2)) % 2 == 0 ? 1.0f : 0.0f;
+            src[y][x] = hi::f32x4{v, v, v, 1.0f};
+        }
+    }
+
+    auto dst = hi::pixmap<hi::sfloat_rgba16>{2, 2};
+    hi::resample(hi::pixmap_span<hi::sfloat_rgba16 const>{src}, hi::pixmap_span<hi::sfloat_rgba16>{dst}, hi::resample_filter::box);
+    for (auto y = 0_uz; y != 2; ++y) {
+        for (auto x = 0_uz; x != 2; ++x) {
+            auto const p = get_pixel(dst, x, y);
+            REQUIRE(p.x() == 0.5f, 0.001);
+            REQUIRE(p.w() == 1.0f, 0.001);
+        }
+    }
+}
+
+TEST_CASE(resample_lanczos_test)
+{
+    // A uniform image stays uniform, also when upscaling.
+    auto src = hi::pixmap<hi::sfloat_rgba16>{5, 7};
+    hi::fill(hi::pixmap_span<hi::sfloat_rgba16>{src}, hi::sfloat_rgba16{hi::f32x4{0.25f, 0.5f, 0.75f, 1.0f}});
+
+    for (auto const [width, height] : {std::pair{2_uz, 3_uz}, std::pair{11_uz, 13_uz}}) {
+        auto dst = hi::pixmap<hi::sfloat_rgba16>{width, height};
+        hi::resample(
+            hi::pixmap_span<hi::sfloat_rgba16 const>{src}, hi::pixmap_span<hi::sfloat_rgba16>{dst}, hi::resample_filter::lanczos3);
+
+        for (auto y = 0_uz; y != height; ++y) {
+            for (auto x = 0_uz; x != width; ++x) {
+                auto const p = get_pixel(dst, x, y);
+                REQUIRE(p.x() == 0.25f, 0.002);
+                REQUIRE(p.y() == 0.5f, 0.002);
+                REQUIRE(p.z() == 0.75f, 0.002);
+                REQUIRE(p.w() == 1.0f, 0.002);
+            }
+        }
+    }
+}
+
+TEST_CASE(make_mipmaps_test)
+{
+    auto src = hi::pixmap<hi::sfloat_rgba16>{16, 4};
+    hi::fill(hi::pixmap_span<hi::sfloat_rgba16>{src}, hi::sfloat_rgba16{hi::f32x4{0.0f, 0.5f, 1.0f, 1.0f}});
+
+    auto const mipmaps = hi::make_mipmaps(hi::pixmap_span<hi::sfloat_rgba16 const>{src});
+    REQUIRE(mipmaps.size() == 4);
+    REQUIRE(mipmaps[0].width() == 8);
+    REQUIRE(mipmaps[0].height() == 2);
+    REQUIRE(mipmaps[1].width() == 4);
+    REQUIRE(mipmaps[1].height() == 1);
+    REQUIRE(mipmaps[2].width() == 2);
+    REQUIRE(mipmaps[2].height() == 1);
+    REQUIRE(mipmaps[3].width() == 1);
+    REQUIRE(mipmaps[3].height() == 1);
+
+    auto const p = get_pixel(mipmaps[3], 0, 0);
+    REQUIRE(p.y() == 0.5f, 0.001);
+    REQUIRE(p.z() == 1.0f, 0.001);
+}
+
+};
@@ -40,7 +40,7 @@ public:
         v = rhs;
         return *this;
     }
-    constexpr operator uint32_t() noexcept
+    constexpr operator uint32_t() const noexcept
     {
         return v;
     }
@@ -0,0 +1,301 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file image/srgb_bc3_block.hpp Defines the srgb_bc3_block type.
+ * @ingroup image
+ */
+
+#pragma once
+
+#include "sfloat_rgba16.hpp"
+#include "pixmap_span.hpp"
+#include "../color/color.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.image.srgb_bc3_block);
+
+hi_export namespace hi::inline v1 {
+
+/** A block of 4x4 pixels compressed in the BC3 format with the sRGB transfer function.
+ *
+ * The color is stored as two RGB565 end-points with a 2-bit index per pixel,
+ * and the alpha as two 8-bit end-points with a 3-bit index per pixel.
+ * A block is 16 bytes, this is 1 byte per pixel instead of the 8 bytes of `sfloat_rgba16`.
+ *
+ * The color components of linear values above 1.0 are clamped, therefor this format
+ * should only be used for standard-dynamic-range images.
+ *
+ * @ingroup image
+ */
+class srgb_bc3_block {
+public:
+    constexpr static std::size_t block_width = 4;
+    constexpr static std::size_t block_height = 4;
+
+    constexpr srgb_bc3_block() noexcept = default;
+    constexpr srgb_bc3_block(srgb_bc3_block const&) noexcept = default;
+    constexpr srgb_bc3_block(srgb_bc3_block&&) noexcept = default;
+    constexpr srgb_bc3_block& operator=(srgb_bc3_block const&) noexcept = default;
+    constexpr srgb_bc3_block& operator=(srgb_bc3_block&&) noexcept = default;
+
+    /** Compress a block of 4x4 pixels.
+     *
+     * The color end-points are chosen along the principal axis of the colors
+     * in this block, the alpha end-points are the minimum and maximum alpha.
+     *
+     * @param pixels The 4x4 pixels in row-major order.
+     */
+    explicit srgb_bc3_block(std::array<sfloat_rgba16, 16> const& pixels) noexcept
+    {
+        auto colors = std::array<std::array<float, 3>, 16>{};
+        auto alphas = std::array<uint8_t, 16>{};
+        for (auto i = 0_uz; i != 16; ++i) {
+            auto const pixel = static_cast<f16x4>(pixels[i]);
+            for (auto j = 0_uz; j != 3; ++j) {
+                colors[i][j] = narrow_cast<float>(sRGB_linear16_to_gamma8(pixel[j]));
+            }
+            alphas[i] = round_cast<uint8_t>(std::clamp(static_cast<float>(pixel[3]), 0.0f, 1.0f) * 255.0f);
+        }
+
+        encode_alpha(alphas);
+        encode_color(colors);
+    }
+
+    /** Decompress the block.
+     *
+     * @return The 4x4 pixels in row-major order.
+     */
+    [[nodiscard]] std::array<sfloat_rgba16, 16> decompress() const noexcept
+    {
+        auto const alpha_palette = make_alpha_palette(_v[0], _v[1]);
+        auto const color_palette = make_color_palette(load_uint16(8), load_uint16(10));
+        auto const alpha_indices = load_uint48(2);
+        auto const color_indices = load_uint32(12);
+
+        auto r = std::array<sfloat_rgba16, 16>{};
+        for (auto i = 0_uz; i != 16; ++i) {
+            auto const& color = color_palette[(color_indices >> (i * 2)) & 3];
+            auto const alpha = alpha_palette[(alpha_indices >> (i * 3)) & 7];
+
+            r[i] = f16x4{
+                sRGB_gamma8_to_linear16(color[0]),
+                sRGB_gamma8_to_linear16(color[1]),
+                sRGB_gamma8_to_linear16(color[2]),
+                static_cast<half>(alpha / 255.0f)};
+        }
+        return r;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(srgb_bc3_block const&, srgb_bc3_block const&) noexcept = default;
+
+private:
+    /** The alpha block in bytes 0 to 7, followed by the color block in bytes 8 to 15.
+     */
+    std::array<uint8_t, 16> _v = {};
+
+    [[nodiscard]] constexpr uint16_t load_uint16(std::size_t offset) const noexcept
+    {
+        return narrow_cast<uint16_t>(_v[offset] | (_v[offset + 1] << 8));
+    }
+
+    [[nodiscard]] constexpr uint32_t load_uint32(std::size_t offset) const noexcept
+    {
+        auto r = uint32_t{0};
+        for (auto i = 4_uz; i != 0; --i) {
+            r = (r << 8) | _v[offset + i - 1];
+        }
+        return r;
+    }
+
+    [[nodiscard]] constexpr uint64_t load_uint48(std::size_t offset) const noexcept
+    {
+        auto r = uint64_t{0};
+        for (auto i = 6_uz; i != 0; --i) {
+            r = (r << 8) | _v[offset + i - 1];
+        }
+        return r;
+    }
+
+    [[nodiscard]] constexpr static std::array<uint8_t, 8> make_alpha_palette(uint8_t a0, uint8_t a1) noexcept
+    {
+        auto r = std::array<uint8_t, 8>{a0, a1};
+        if (a0 > a1) {
+            for (auto i = 1; i != 7; ++i) {
+                r[i + 1] = narrow_cast<uint8_t>(((7 - i) * a0 + i * a1 + 3) / 7);
+            }
+        } else {
+            for (auto i = 1; i != 5; ++i) {
+                r[i + 1] = narrow_cast<uint8_t>(((5 - i) * a0 + i * a1 + 2) / 5);
+            }
+            r[6] = 0;
+            r[7] = 255;
+        }
+        return r;
+    }
+
+    [[nodiscard]] constexpr static std::array<uint8_t, 3> expand_565(uint16_t c) noexcept
+    {
+        auto const r = (c >> 11) & 0x1f;
+        auto const g = (c >> 5) & 0x3f;
+        auto const b = c & 0x1f;
+        return {
+            narrow_cast<uint8_t>((r << 3) | (r >> 2)), narrow_cast<uint8_t>((g << 2) | (g >> 4)), narrow_cast<uint8_t>((b << 3) | (b >> 2))};
+    }
+
+    /** The color palette of a BC3 block, which always uses four colors.
+     */
+    [[nodiscard]] constexpr static std::array<std::array<uint8_t, 3>, 4> make_color_palette(uint16_t c0, uint16_t c1) noexcept
+    {
+        auto r = std::array<std::array<uint8_t, 3>, 4>{expand_565(c0), expand_565(c1)};
+        for (auto j = 0_uz; j != 3; ++j) {
+            r[2][j] = narrow_cast<uint8_t>((2 * r[0][j] + r[1][j] + 1) / 3);
+            r[3][j] = narrow_cast<uint8_t>((r[0][j] + 2 * r[1][j] + 1) / 3);
+        }
+        return r;
+    }
+
+    void encode_alpha(std::array<uint8_t, 16> const& alphas) noexcept
+    {
+        auto const [min_it, max_it] = std::minmax_element(alphas.begin(), alphas.end());
+        _v[0] = *max_it;
+        _v[1] = *min_it;
+
+        auto const palette = make_alpha_palette(_v[0], _v[1]);
+        auto indices = uint64_t{0};
+        for (auto i = 0_uz; i != 16; ++i) {
+            auto best_index = uint64_t{0};
+            auto best_error = 256;
+            for (auto j = 0_uz; j != palette.size(); ++j) {
+                auto const error = std::abs(palette[j] - alphas[i]);
+                if (error < best_error) {
+                    best_error = error;
+                    best_index = j;
+                }
+            }
+            indices |= best_index << (i * 3);
+        }
+
+        for (auto i = 0_uz; i != 6; ++i) {
+            _v[2 + i] = narrow_cast<uint8_t>((indices >> (i * 8)) & 0xff);
+        }
+    }
+
+    [[nodiscard]] static uint16_t quantize_565(std::array<float, 3> const& c) noexcept
+    {
+        auto const r = round_cast<uint16_t>(std::clamp(c[0], 0.0f, 255.0f) * (31.0f / 255.0f));
+        auto const g = round_cast<uint16_t>(std::clamp(c[1], 0.0f, 255.0f) * (63.0f / 255.0f));
+        auto const b = round_cast<uint16_t>(std::clamp(c[2], 0.0f, 255.0f) * (31.0f / 255.0f));
+        return narrow_cast<uint16_t>((r << 11) | (g << 5) | b);
+    }
+
+    void encode_color(std::array<std::array<float, 3>, 16> const& colors) noexcept
+    {
+        auto mean = std::array<float, 3>{};
+        for (auto const& color : colors) {
+            for (auto j = 0_uz; j != 3; ++j) {
+                mean[j] += color[j] / 16.0f;
+            }
+        }
+
+        // The covariance matrix of the colors, used to find the principal axis.
+        auto covariance = std::array<std::array<float, 3>, 3>{};
+        for (auto const& color : colors) {
+            for (auto j = 0_uz; j != 3; ++j) {
+                for (auto k = 0_uz; k != 3; ++k) {
+                    covariance[j][k] += (color[j] - mean[j]) * (color[k] - mean[k]);
+                }
+            }
+        }
+
+        // Power iteration converges to the axis with the largest variance.
+        auto axis = std::array<float, 3>{1.0f, 1.0f, 1.0f};
+        for (auto iteration = 0; iteration != 8; ++iteration) {
+            auto next = std::array<float, 3>{};
+            for (auto j = 0_uz; j != 3; ++j) {
+                next[j] = covariance[j][0] * axis[0] + covariance[j][1] * axis[1] + covariance[j][2] * axis[2];
+            }
+            auto const length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+            if (length < 1e-6f) {
+                break;
+            }
+            for (auto j = 0_uz; j != 3; ++j) {
+                axis[j] = next[j] / length;
+            }
+        }
+
+        auto min_t = 0.0f;
+        auto max_t = 0.0f;
+        for (auto const& color : colors) {
+            auto const t = (color[0] - mean[0]) * axis[0] + (color[1] - mean[1]) * axis[1] + (color[2] - mean[2]) * axis[2];
+            min_t = std::min(min_t, t);
+            max_t = std::max(max_t, t);
+        }
+
+        auto const c0 = quantize_565({mean[0] + axis[0] * max_t, mean[1] + axis[1] * max_t, mean[2] + axis[2] * max_t});
+        auto const c1 = quantize_565({mean[0] + axis[0] * min_t, mean[1] + axis[1] * min_t, mean[2] + axis[2] * min_t});
+
+        auto const palette = make_color_palette(c0, c1);
+        auto indices = uint32_t{0};
+        for (auto i = 0_uz; i != 16; ++i) {
+            auto best_index = uint32_t{0};
+            auto best_error = std::numeric_limits<float>::max();
+            for (auto j = 0_uz; j != palette.size(); ++j) {
+                auto error = 0.0f;
+                for (auto k = 0_uz; k != 3; ++k) {
+                    auto const d = colors[i][k] - palette[j][k];
+                    error += d * d;
+                }
+                if (error < best_error) {
+                    best_error = error;
+                    best_index = narrow_cast<uint32_t>(j);
+                }
+            }
+            indices |= best_index << (i * 2);
+        }
+
+        _v[8] = narrow_cast<uint8_t>(c0 & 0xff);
+        _v[9] = narrow_cast<uint8_t>(c0 >> 8);
+        _v[10] = narrow_cast<uint8_t>(c1 & 0xff);
+        _v[11] = narrow_cast<uint8_t>(c1 >> 8);
+        for (auto i = 0_uz; i != 4; ++i) {
+            _v[12 + i] = narrow_cast<uint8_t>((indices >> (i * 8)) & 0xff);
+        }
+    }
+};
+
+/** Compress an image into BC3 blocks.
+ *
+ * @ingroup image
+ * @param src The image to compress, the width and height must be a multiple of 4.
+ * @param dst The blocks, with a width and height of a quarter of the image.
+ */
+inline void compress(pixmap_span<sfloat_rgba16 const> src, pixmap_span<srgb_bc3_block> dst) noexcept
+{
+    hi_assert(src.width() == dst.width() * srgb_bc3_block::block_width);
+    hi_assert(src.height() == dst.height() * srgb_bc3_block::block_height);
+
+    auto pixels = std::array<sfloat_rgba16, 16>{};
+    for (auto y = 0_uz; y != dst.height(); ++y) {
+        auto const dst_row = dst[y];
+        for (auto x = 0_uz; x != dst.width(); ++x) {
+            for (auto i = 0_uz; i != 4; ++i) {
+                auto const src_row = src[y * 4 + i];
+                for (auto j = 0_uz; j != 4; ++j) {
+                    pixels[i * 4 + j] = src_row[x * 4 + j];
+                }
+            }
+            dst_row[x] = srgb_bc3_block{pixels};
+        }
+    }
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,90 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "srgb_bc3_block.hpp"
+#include "pixmap.hpp"
+#include <hikotest/hikotest.hpp>
+#include <array>
+
+using hi::operator""_uz;
+
+TEST_SUITE(srgb_bc3_block) {
+
+[[nodiscard]] static hi::f32x4 to_f32x4(hi::sfloat_rgba16 const& rhs) noexcept
+{
+    return static_cast<hi::f32x4>(static_cast<hi::f16x4>(rhs));
+}
+
+TEST_CASE(solid_color)
+{
+    auto pixels = std::array<hi::sfloat_rgba16, 16>{};
+    for (auto& pixel : pixels) {
+        pixel = hi::f32x4{1.0f, 0.0f, 1.0f, 1.0f};
+    }
+
+    auto const block = hi::srgb_bc3_block{pixels};
+    for (auto const& pixel : block.decompress()) {
+        auto const p = to_f32x4(pixel);
+        REQUIRE(p.r() == 1.0f);
+        REQUIRE(p.g() == 0.0f);
+        REQUIRE(p.b() == 1.0f);
+        REQUIRE(p.a() == 1.0f);
+    }
+}
+
+TEST_CASE(two_colors)
+{
+    // A checker board of opaque white and transparent black is encoded without loss.
+    auto pixels = std::array<hi::sfloat_rgba16, 16>{};
+    for (auto i = 0_uz; i != 16; ++i) {
+        pixels[i] = ((i + i / 4) % 2) == 0 ? hi::f32x4{1.0f, 1.0f, 1.0f, 1.0f} : hi::f32x4{0.0f, 0.0f, 0.0f, 0.0f};
+    }
+
+    auto const decompressed = hi::srgb_bc3_block{pixels}.decompress();
+    for (auto i = 0_uz; i != 16; ++i) {
+        auto const expected = to_f32x4(pixels[i]);
+        auto const p = to_f32x4(decompressed[i]);
+        REQUIRE(p.r() == expected.r());
+        REQUIRE(p.a() == expected.a());
+    }
+}
+
+TEST_CASE(gradient)
+{
+    // A gradient of alpha from 0.0 to 1.0, the alpha has 8 levels.
+    auto pixels = std::array<hi::sfloat_rgba16, 16>{};
+    for (auto i = 0_uz; i != 16; ++i) {
+        auto const a = static_cast<float>(i) / 15.0f;
+        pixels[i] = hi::f32x4{a, a, a, a};
+    }
+
+    auto const decompressed = hi::srgb_bc3_block{pixels}.decompress();
+    REQUIRE(to_f32x4(decompressed[0]).a() == 0.0f);
+    REQUIRE(to_f32x4(decompressed[15]).a() == 1.0f);
+    for (auto i = 0_uz; i != 16; ++i) {
+        REQUIRE(to_f32x4(decompressed[i]).a() == to_f32x4(pixels[i]).a(), 0.075f);
+    }
+}
+
+TEST_CASE(compress_image)
+{
+    auto image = hi::pixmap<hi::sfloat_rgba16>{8, 4};
+    for (auto y = 0_uz; y != image.height(); ++y) {
+        for (auto x = 0_uz; x != image.width(); ++x) {
+            image[y][x] = x < 4 ? hi::f32x4{1.0f, 0.0f, 0.0f, 1.0f} : hi::f32x4{0.0f, 0.0f, 1.0f, 1.0f};
+        }
+    }
+
+    auto blocks = hi::pixmap<hi::srgb_bc3_block>{2, 1};
+    hi::compress(image, blocks);
+
+    auto const left = to_f32x4(blocks[0][0].decompress()[5]);
+    auto const right = to_f32x4(blocks[0][1].decompress()[5]);
+    REQUIRE(left.r() == 1.0f);
+    REQUIRE(left.b() == 0.0f);
+    REQUIRE(right.r() == 0.0f);
+    REQUIRE(right.b() == 1.0f);
+}
+
+};
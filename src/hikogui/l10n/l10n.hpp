@@ -3,6 +3,7 @@
 #pragma once
 
 #include "label.hpp" // export
+#include "mo_parser.hpp" // export
 #include "po_parser.hpp" // export
 #include "po_translations.hpp" // export
 #include "txt.hpp" // export
@@ -0,0 +1,129 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file l10n/mo_parser.hpp Parse compiled gettext .mo files.
+ * @ingroup l10n
+ */
+
+#pragma once
+
+#include "po_translations.hpp"
+#include "po_parser.hpp"
+#include "../i18n/i18n.hpp"
+#include "../file/file.hpp"
+#include "../container/container.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <filesystem>
+#include <ranges>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.l10n.mo_parser);
+
+hi_export namespace hi { inline namespace v1 {
+
+namespace detail {
+
+constexpr auto mo_magic = uint32_t{0x950412de};
+
+[[nodiscard]] inline uint32_t mo_get_uint32(bstring_view data, std::size_t offset, std::endian endian)
+{
+    hi_check(offset + 4 <= data.size(), "Unexpected end of .mo file");
+    if (endian == std::endian::little) {
+        return load_le<uint32_t>(data.data() + offset);
+    } else {
+        return load_be<uint32_t>(data.data() + offset);
+    }
+}
+
+/** Get a string from the table of original or translated strings.
+ */
+[[nodiscard]] inline std::string_view mo_get_string(bstring_view data, uint32_t table_offset, uint32_t index, std::endian endian)
+{
+    auto const entry = std::size_t{table_offset} + std::size_t{index} * 8;
+    auto const length = mo_get_uint32(data, entry, endian);
+    auto const offset = mo_get_uint32(data, entry + 4, endian);
+    hi_check(std::size_t{offset} + length <= data.size(), "String outside of .mo file");
+    return std::string_view{reinterpret_cast<char const *>(data.data() + offset), length};
+}
+
+} // namespace detail
+
+/** Parse a compiled gettext .mo file.
+ *
+ * A .mo file is produced from a .po file by `msgfmt`. Loading it does not
+ * require tokenizing and parsing the text of the .po file.
+ *
+ * @param data The contents of the .mo file.
+ * @return The translations, in the same form as `parse_po()`.
+ * @throws parse_error When the .mo file is invalid.
+ */
+[[nodiscard]] inline po_translations parse_mo(bstring_view data)
+{
+    using namespace std::literals;
+
+    auto endian = std::endian::little;
+    auto const magic = detail::mo_get_uint32(data, 0, endian);
+    if (magic != detail::mo_magic) {
+        endian = std::endian::big;
+        hi_check(detail::mo_get_uint32(data, 0, endian) == detail::mo_magic, "Not a .mo file");
+    }
+
+    auto const revision = detail::mo_get_uint32(data, 4, endian);
+    hi_check(revision >> 16 == 0, "Unsupported .mo file revision {}", revision);
+
+    auto const num_strings = detail::mo_get_uint32(data, 8, endian);
+    auto const originals_offset = detail::mo_get_uint32(data, 12, endian);
+    auto const translations_offset = detail::mo_get_uint32(data, 16, endian);
+
+    auto r = po_translations{};
+    r.translations.reserve(num_strings);
+    for (auto i = uint32_t{0}; i != num_strings; ++i) {
+        auto original = detail::mo_get_string(data, originals_offset, i, endian);
+        auto const translation = detail::mo_get_string(data, translations_offset, i, endian);
+
+        if (original.empty()) {
+            // The translation of the empty msgid contains the headers.
+            detail::parse_po_header(r, translation, "\n"sv);
+            continue;
+        }
+
+        auto po_translation = hi::po_translation{};
+
+        // The context and the msgid are separated by an EOT character.
+        if (auto const pos = original.find('\x04'); pos != std::string_view::npos) {
+            po_translation.msgctxt = std::string{original.substr(0, pos)};
+            original = original.substr(pos + 1);
+        }
+
+        // The msgid and msgid_plural are separated by a nul character.
+        if (auto const pos = original.find('\0'); pos != std::string_view::npos) {
+            po_translation.msgid = std::string{original.substr(0, pos)};
+            po_translation.msgid_plural = std::string{original.substr(pos + 1)};
+        } else {
+            po_translation.msgid = std::string{original};
+        }
+
+        // The plural forms of the translation are separated by nul characters.
+        for (auto const plural_form : std::views::split(translation, "\0"sv)) {
+            po_translation.msgstr.emplace_back(std::string_view{plural_form});
+        }
+
+        r.translations.push_back(std::move(po_translation));
+    }
+
+    return r;
+}
+
+[[nodiscard]] inline po_translations parse_mo(std::filesystem::path const& path)
+{
+    return parse_mo(as_bstring_view(file_view{path}));
+}
+
+}} // namespace hi::inline v1
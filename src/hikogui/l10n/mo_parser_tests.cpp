@@ -0,0 +1,103 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mo_parser.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+TEST_SUITE(mo_parser_suite) {
+
+/** Make a .mo file in the same layout as produced by `msgfmt`.
+ */
+[[nodiscard]] static hi::bstring make_mo(std::vector<std::pair<std::string_view, std::string_view>> const& strings)
+{
+    auto r = hi::bstring{};
+    auto append_uint32 = [&](uint32_t value) {
+        for (auto i = 0; i != 4; ++i) {
+            r += static_cast<std::byte>(value >> (i * 8));
+        }
+    };
+
+    auto const num_strings = static_cast<uint32_t>(strings.size());
+    auto const originals_offset = uint32_t{28};
+    auto const translations_offset = originals_offset + num_strings * 8;
+    auto string_offset = translations_offset + num_strings * 8;
+
+    append_uint32(0x950412de);
+    append_uint32(0);
+    append_uint32(num_strings);
+    append_uint32(originals_offset);
+    append_uint32(translations_offset);
+    append_uint32(0);
+    append_uint32(0);
+
+    for (auto const& [original, translation] : strings) {
+        append_uint32(static_cast<uint32_t>(original.size()));
+        append_uint32(string_offset);
+        string_offset += static_cast<uint32_t>(original.size() + 1);
+    }
+    for (auto const& [original, translation] : strings) {
+        append_uint32(static_cast<uint32_t>(translation.size()));
+        append_uint32(string_offset);
+        string_offset += static_cast<uint32_t>(translation.size() + 1);
+    }
+    for (auto const& [original, translation] : strings) {
+        for (auto const c : original) {
+            r += static_cast<std::byte>(c);
+        }
+        r += std::byte{0};
+    }
+    for (auto const& [original, translation] : strings) {
+        for (auto const c : translation) {
+            r += static_cast<std::byte>(c);
+        }
+        r += std::byte{0};
+    }
+    return r;
+}
+
+TEST_CASE(parse_test)
+{
+    using namespace std::literals;
+
+    auto const data = make_mo({
+        {""sv, "Language: nl\nPlural-Forms: nplurals=2; plural=(n != 1);\n"sv},
+        {"hello"sv, "hallo"sv},
+        {"menu\x04" "file\0files"sv, "bestand\0bestanden"sv},
+    });
+
+    auto const r = hi::parse_mo(hi::bstring_view{data});
+    REQUIRE(r.language == hi::language_tag{"nl"});
+    REQUIRE(r.translations.size() == 2);
+
+    REQUIRE(not r.translations[0].msgctxt);
+    REQUIRE(r.translations[0].msgid == "hello");
+    REQUIRE(r.translations[0].msgid_plural == "");
+    REQUIRE(r.translations[0].msgstr.size() == 1);
+    REQUIRE(r.translations[0].msgstr[0] == "hallo");
+
+    REQUIRE(r.translations[1].msgctxt == "menu");
+    REQUIRE(r.translations[1].msgid == "file");
+    REQUIRE(r.translations[1].msgid_plural == "files");
+    REQUIRE(r.translations[1].msgstr.size() == 2);
+    REQUIRE(r.translations[1].msgstr[0] == "bestand");
+    REQUIRE(r.translations[1].msgstr[1] == "bestanden");
+}
+
+TEST_CASE(invalid_test)
+{
+    using namespace std::literals;
+
+    auto data = make_mo({{"hello"sv, "hallo"sv}});
+    data[0] = std::byte{0};
+    REQUIRE_THROWS(hi::parse_mo(hi::bstring_view{data}), hi::parse_error);
+
+    auto const truncated = make_mo({{"hello"sv, "hallo"sv}});
+    REQUIRE_THROWS(hi::parse_mo(hi::bstring_view{truncated}.substr(0, 40)), hi::parse_error);
+}
+
+};
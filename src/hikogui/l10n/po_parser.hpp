@@ -116,11 +116,17 @@ template<std::input_iterator It, std::sentinel_for<It> ItEnd>
     return std::nullopt;
 }
 
-constexpr void parse_po_header(po_translations& r, std::string_view header)
+/** Parse the headers of a translation file.
+ *
+ * @param header The headers, the translation of the empty msgid.
+ * @param separator The separator between header lines, which is an escaped
+ *                  new-line in the text of a .po file.
+ */
+constexpr void parse_po_header(po_translations& r, std::string_view header, std::string_view separator = "\\n")
 {
     using namespace std::literals;
 
-    for (auto const line : std::views::split(header, "\\n"sv)) {
+    for (auto const line : std::views::split(header, separator)) {
         if (line.empty()) {
             // Skip empty header lines.
             continue;
@@ -6,16 +6,29 @@
 
 #include "po_translations.hpp"
 #include "po_parser.hpp"
+#include "mo_parser.hpp"
 #include "../i18n/i18n.hpp"
 #include "../utility/utility.hpp"
 #include "../settings/settings.hpp"
 #include "../unicode/unicode.hpp"
 #include "../telemetry/telemetry.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../file/file.hpp"
 #include "../macros.hpp"
 #include <string>
 #include <string_view>
 #include <vector>
 #include <unordered_map>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <latch>
+#include <concepts>
+#include <filesystem>
+#include <limits>
 #include <tuple>
 
 hi_export_module(hikogui.l10n.translation);
@@ -23,91 +36,354 @@ hi_export_module(hikogui.l10n.translation);
 hi_export namespace hi {
 inline namespace v1 {
 
-struct translation_key {
-    std::string msgid;
-    language_tag language;
+/** Incremented each time translations are added.
+ *
+ * This is used to invalidate the translations that are cached in `txt` objects.
+ */
+inline std::atomic<std::size_t> translations_generation = 0;
+
+namespace detail {
+
+/** Hash of a msgid, for looking up a translation with a std::string_view.
+ */
+struct translation_msgid_hash {
+    using is_transparent = void;
 
-    [[nodiscard]] std::size_t hash() const noexcept
+    [[nodiscard]] std::size_t operator()(std::string_view rhs) const noexcept
     {
-        return hash_mix(msgid, language);
+        return std::hash<std::string_view>{}(rhs);
     }
+};
 
-    [[nodiscard]] constexpr friend bool operator==(translation_key const &, translation_key const &) noexcept = default;
+struct translation_entry {
+    language_tag language;
+    std::vector<std::string> plural_forms;
 };
 
-}} // namespace hi::inline v1
+/** The translations of each msgid, for each language.
+ *
+ * The key is the msgid so that a lookup for multiple languages hashes the msgid once.
+ * The nodes and buckets of the table are accounted as "translations" memory.
+ */
+using translation_table = std::unordered_map<
+    std::string,
+    std::vector<translation_entry>,
+    translation_msgid_hash,
+    std::equal_to<>,
+    tracked_allocator<std::pair<std::string const, std::vector<translation_entry>>, "translations">>;
 
-template<>
-struct std::hash<hi::translation_key> {
-    [[nodiscard]] std::size_t operator()(hi::translation_key const &rhs) const noexcept
-    {
-        return rhs.hash();
-    }
+/** A translation file found in the resource directories.
+ */
+struct translation_file {
+    std::filesystem::path path;
+
+    /** The language from the filename, like "nl.po", or empty when the filename is not a language tag.
+     */
+    language_tag language;
+
+    /** The file was loaded, or is being loaded.
+     */
+    bool loaded = false;
 };
 
-hi_export namespace hi {
-inline namespace v1 {
+/** The published translations.
+ *
+ * The table is never modified after it is published, instead a modified copy
+ * of the table is published. A reader holds on to the table it found, so that
+ * the translations it found remain valid.
+ */
+inline std::shared_ptr<translation_table const> translations = std::make_shared<translation_table const>();
+inline unfair_mutex translations_mutex;
 
-inline std::unordered_map<translation_key, std::vector<std::string>> translations;
-inline std::atomic<bool> translations_loaded = false;
+/** Serializes making modified copies of the translations.
+ */
+inline unfair_mutex translations_modify_mutex;
 
-inline void add_translation(std::string_view msgid, language_tag language, std::vector<std::string> const &plural_forms) noexcept
+/** Protects `translation_files`.
+ */
+inline unfair_mutex translation_files_mutex;
+inline std::optional<std::vector<translation_file>> translation_files;
+
+[[nodiscard]] inline std::shared_ptr<translation_table const> get_translations() noexcept
 {
-    auto key = translation_key{std::string{msgid}, language};
-    translations[key] = plural_forms;
+    auto const lock = std::scoped_lock(translations_mutex);
+    return translations;
 }
 
-inline void add_translations(po_translations const &po_translations) noexcept
+template<std::invocable<translation_table&> Func>
+inline void modify_translations(Func&& func) noexcept
+{
+    auto const lock = std::scoped_lock(translations_modify_mutex);
+    auto table = std::make_shared<translation_table>(*get_translations());
+    func(*table);
+    {
+        auto const translations_lock = std::scoped_lock(translations_mutex);
+        translations = std::move(table);
+    }
+    translations_generation.fetch_add(1, std::memory_order::release);
+}
+
+inline void add_translation(translation_table& table, std::string_view msgid, language_tag language, std::vector<std::string> const &plural_forms) noexcept
+{
+    auto it = table.find(msgid);
+    if (it == table.end()) {
+        it = table.emplace(std::string{msgid}, std::vector<translation_entry>{}).first;
+    }
+
+    auto& entries = it->second;
+    auto const jt = std::ranges::find(entries, language, &translation_entry::language);
+    if (jt != entries.end()) {
+        jt->plural_forms = plural_forms;
+    } else {
+        entries.emplace_back(language, plural_forms);
+    }
+}
+
+inline void add_translations(translation_table& table, po_translations const &po_translations) noexcept
 {
     for (auto const &translation : po_translations.translations) {
         auto msgid = translation.msgctxt ? *translation.msgctxt + '|' + translation.msgid : translation.msgid;
-        add_translation(std::move(msgid), po_translations.language, translation.msgstr);
+        add_translation(table, msgid, po_translations.language, translation.msgstr);
+    }
+}
+
+/** Find the translation files in the resource directories.
+ *
+ * The .mo files are sorted after the .po files, so that the compiled
+ * translations override the text translations.
+ */
+[[nodiscard]] inline std::vector<translation_file> find_translation_files()
+{
+    auto r = std::vector<translation_file>{};
+
+    // XXX Waiting for C++23 to extend life-time of temporaries in for loops.
+    auto resource_paths = resource_dirs();
+    for (auto const extension : {"**/*.po", "**/*.mo"}) {
+        for (auto &path : parallel_glob(resource_paths, extension)) {
+            auto language = language_tag{};
+            try {
+                language = language_tag::parse(path.stem().string());
+            } catch (...) {
+                // The file is not named after a language, it is loaded with the first language.
+            }
+            r.emplace_back(std::move(path), language);
+        }
     }
+    return r;
 }
 
+[[nodiscard]] inline std::optional<po_translations> parse_translation_file(std::filesystem::path const& path) noexcept
+{
+    hi_log_info("Loading translation file {}.", path.string());
+    try {
+        if (path.extension() == ".mo") {
+            return parse_mo(path);
+        } else {
+            return parse_po(path);
+        }
+    } catch (std::exception const &e) {
+        hi_log_error("Could not load translation file. {}", e.what());
+        return std::nullopt;
+    }
+}
+
+} // namespace detail
+
+inline void add_translation(std::string_view msgid, language_tag language, std::vector<std::string> const &plural_forms) noexcept
+{
+    detail::modify_translations([&](detail::translation_table& table) {
+        detail::add_translation(table, msgid, language, plural_forms);
+    });
+}
+
+inline void add_translations(po_translations const &po_translations) noexcept
+{
+    detail::modify_translations([&](detail::translation_table& table) {
+        detail::add_translations(table, po_translations);
+    });
+}
+
+/** Load a translation file.
+ *
+ * @param path The path to a `.po` or a compiled `.mo` file.
+ */
 inline void load_translations(std::filesystem::path path)
 {
     hi_log_info("Loading translation file {}.", path.string());
-    return add_translations(parse_po(path));
+    if (path.extension() == ".mo") {
+        return add_translations(parse_mo(path));
+    } else {
+        return add_translations(parse_po(path));
+    }
 }
 
-inline void load_translations()
+/** Load the translation files for the given languages.
+ *
+ * Translation files are found in the resource directories and are named after
+ * their language, like "nl.po" or "nl_BE.mo". Only files of languages that
+ * were not loaded before are loaded. Files that are not named after a language
+ * are loaded on the first call.
+ *
+ * The files are parsed in parallel on the global thread pool, then the
+ * translations of all the files are published at once. While the files are
+ * being parsed, other threads asking for the same languages do not wait,
+ * they use the translations that were published before.
+ *
+ * @param languages The languages to load, usually from `os_settings::language_tags()`.
+ */
+inline void load_translations(std::vector<language_tag> const& languages) noexcept
 {
-    if (not translations_loaded.exchange(true)) {
-        // XXX Waiting for C++23 to extend life-time of temporaries in for loops.
-        auto resource_paths = resource_dirs();
-        for (auto &path : glob(resource_paths, "**/*.po")) {
+    auto files = std::vector<detail::translation_file const *>{};
+    {
+        auto const lock = std::scoped_lock(detail::translation_files_mutex);
+
+        if (not detail::translation_files) {
             try {
-                load_translations(path);
-            } catch (std::exception const &e) {
-                hi_log_error("Could not load translation file. {}", e.what());
+                detail::translation_files = detail::find_translation_files();
+            } catch (std::exception const& e) {
+                hi_log_error("Could not find translation files. {}", e.what());
+                detail::translation_files.emplace();
+            }
+        }
+
+        // The list of files is not modified after it was found, so the pointers remain valid.
+        for (auto& file : *detail::translation_files) {
+            if (not file.loaded and (file.language.empty() or std::ranges::find(languages, file.language) != languages.end())) {
+                file.loaded = true;
+                files.push_back(std::addressof(file));
             }
         }
     }
-}
 
-[[nodiscard]] inline std::pair<std::string_view, language_tag>
-get_translation(std::string_view msgid, long long n, std::vector<language_tag> const &languages) noexcept
-{
-    load_translations();
+    if (files.empty()) {
+        return;
+    }
 
-    // Update only the language in each iteration.
-    auto key = translation_key{std::string{msgid}, language_tag{}};
+    auto results = std::vector<std::optional<po_translations>>(files.size());
+    if (files.size() == 1 or thread_pool::global().on_thread()) {
+        // Don't wait for the pool from inside the pool.
+        for (auto i = 0_uz; i != files.size(); ++i) {
+            results[i] = detail::parse_translation_file(files[i]->path);
+        }
 
-    for (auto const language : languages) {
-        key.language = language;
+    } else {
+        auto todo = std::latch{narrow_cast<std::ptrdiff_t>(files.size())};
+        for (auto i = 0_uz; i != files.size(); ++i) {
+            thread_pool::global().post_function([&, i] {
+                results[i] = detail::parse_translation_file(files[i]->path);
+                todo.count_down();
+            });
+        }
+        todo.wait();
+    }
 
-        auto const i = translations.find(key);
-        if (i != translations.cend()) {
-            auto const plurality = cardinal_plural(language, n, i->second.size());
-            auto const& translation = i->second[plurality];
-            if (translation.size() != 0) {
-                return {translation, language};
+    detail::modify_translations([&](detail::translation_table& table) {
+        for (auto const& result : results) {
+            if (result) {
+                detail::add_translations(table, *result);
+            }
+        }
+    });
+}
+
+/** Get the translation of a message.
+ *
+ * @param table The table of translations to search.
+ * @param msgid The message to translate.
+ * @param n The number used to select the plural form.
+ * @param languages The languages to search for translations, in order of preference.
+ * @return The translated message, valid while @a table is alive, and the language of the translation.
+ */
+[[nodiscard]] inline std::pair<std::string_view, language_tag> get_translation(
+    detail::translation_table const& table,
+    std::string_view msgid,
+    long long n,
+    std::vector<language_tag> const& languages) noexcept
+{
+    if (auto const it = table.find(msgid); it != table.cend()) {
+        for (auto const language : languages) {
+            auto const jt = std::ranges::find(it->second, language, &detail::translation_entry::language);
+            if (jt != it->second.cend()) {
+                auto const plurality = cardinal_plural(language, n, jt->plural_forms.size());
+                auto const& translation = jt->plural_forms[plurality];
+                if (translation.size() != 0) {
+                    return {translation, language};
+                }
             }
         }
     }
     hi_log_debug("No translation found for '{}'", msgid);
-    return {msgid, language_tag{"en-Latn-US"}};
+    return {msgid, language_tag{iso_639{"en"}, iso_15924{"Latn"}, iso_3166{"US"}}};
 }
 
+/** A translation retained between lookups.
+ *
+ * The translation is looked up again only when the list of languages changes
+ * or when translations were added after the previous lookup.
+ */
+class translation_cache {
+public:
+    constexpr translation_cache() noexcept = default;
+
+    /** Copying a cache makes an empty cache.
+     *
+     * The retained translation may reference the msgid of the original owner.
+     */
+    constexpr translation_cache(translation_cache const&) noexcept {}
+    constexpr translation_cache(translation_cache&&) noexcept {}
+
+    translation_cache& operator=(translation_cache const&) noexcept
+    {
+        clear();
+        return *this;
+    }
+
+    translation_cache& operator=(translation_cache&&) noexcept
+    {
+        clear();
+        return *this;
+    }
+
+    void clear() noexcept
+    {
+        _generation = std::numeric_limits<std::size_t>::max();
+        _languages.clear();
+        _table = nullptr;
+    }
+
+    /** Get the translation of a message.
+     *
+     * @param msgid The message to translate, it must remain valid while cached.
+     * @param n The number used to select the plural form.
+     * @param languages The languages to search for translations, in order of preference.
+     * @return The translated message, and the language of the translation.
+     */
+    [[nodiscard]] std::pair<std::string_view, language_tag>
+    get(std::string_view msgid, long long n, std::vector<language_tag> const& languages) noexcept
+    {
+        if (_languages != languages) {
+            load_translations(languages);
+        }
+
+        auto const generation = translations_generation.load(std::memory_order::acquire);
+        if (_generation != generation or _languages != languages) {
+            _table = detail::get_translations();
+            std::tie(_translation, _language) = get_translation(*_table, msgid, n, languages);
+            _languages = languages;
+            _generation = generation;
+        }
+        return {_translation, _language};
+    }
+
+private:
+    std::size_t _generation = std::numeric_limits<std::size_t>::max();
+    std::vector<language_tag> _languages = {};
+
+    /** The table that _translation points into.
+     */
+    std::shared_ptr<detail::translation_table const> _table = {};
+    std::string_view _translation = {};
+    language_tag _language = {};
+};
+
 }} // namespace hi::inline v1
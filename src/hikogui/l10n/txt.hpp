@@ -10,6 +10,7 @@
 #include "../settings/settings.hpp"
 #include "../macros.hpp"
 #include <memory>
+#include <atomic>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -74,6 +75,28 @@ constexpr std::unique_ptr<txt_arguments_base> make_unique_txt_arguments(Args&&..
     return std::make_unique<txt_arguments_type>(std::forward<Args>(args)...);
 }
 
+/** The strings with markup applied, shared between all `txt` objects.
+ */
+inline markup_cache txt_markup_cache;
+
+/** The generation of translations when `txt_markup_cache` was last emptied.
+ */
+inline std::atomic<std::size_t> txt_markup_generation = 0;
+
+/** Apply markup to a translated message.
+ *
+ * When translations are added the cache is emptied, so that the cache only
+ * holds the messages of the current translations.
+ */
+[[nodiscard]] inline std::shared_ptr<gstring const> txt_apply_markup(std::string_view msg, language_tag language) noexcept
+{
+    auto const generation = translations_generation.load(std::memory_order::acquire);
+    if (txt_markup_generation.exchange(generation, std::memory_order::acq_rel) != generation) {
+        txt_markup_cache.clear();
+    }
+    return txt_markup_cache.get(msg, language);
+}
+
 } // namespace detail
 
 [[nodiscard]] constexpr long long get_first_integer_argument() noexcept
@@ -113,6 +136,7 @@ public:
         std::swap(_first_integer_argument, other._first_integer_argument);
         std::swap(_msg_id, other._msg_id);
         std::swap(_args, other._args);
+        other._translation.clear();
     }
 
     txt& operator=(txt const& other) noexcept
@@ -121,6 +145,7 @@ public:
             _first_integer_argument = other._first_integer_argument;
             _msg_id = other._msg_id;
             _args = other._args->make_unique_copy();
+            _translation.clear();
         }
         return *this;
     }
@@ -131,6 +156,8 @@ public:
             std::swap(_first_integer_argument, other._first_integer_argument);
             std::swap(_msg_id, other._msg_id);
             std::swap(_args, other._args);
+            _translation.clear();
+            other._translation.clear();
         }
         return *this;
     }
@@ -186,9 +213,9 @@ public:
         std::vector<language_tag> const& languages = os_settings::language_tags()) const noexcept
     {
         hi_axiom_not_null(_args);
-        auto const[fmt, language_tag] = ::hi::get_translation(_msg_id, _first_integer_argument, languages);
+        auto const[fmt, language_tag] = _translation.get(_msg_id, _first_integer_argument, languages);
         auto const msg = _args->format(loc, fmt);
-        return apply_markup(msg, language_tag);
+        return *detail::txt_apply_markup(msg, language_tag);
     }
 
     /** Translate and format the message.
@@ -206,7 +233,7 @@ public:
     {
         hi_axiom_not_null(_args);
         auto const msg = _args->format(std::locale::classic(), _msg_id);
-        return apply_markup(msg, language_tag{"en-US"});
+        return *detail::txt_apply_markup(msg, language_tag{iso_639{"en"}, iso_15924{"Latn"}, iso_3166{"US"}});
     }
 
     explicit operator std::string() const noexcept
@@ -218,6 +245,10 @@ private:
     long long _first_integer_argument = 0;
     std::string _msg_id = {};
     std::unique_ptr<detail::txt_arguments_base> _args;
+
+    /** The translation of _msg_id, retained between calls to translate().
+     */
+    mutable translation_cache _translation;
 };
 
 }} // namespace hi::v1
@@ -8,6 +8,7 @@
 #include "box_shape.hpp"
 #include "spreadsheet_address.hpp"
 #include "../geometry/geometry.hpp"
+#include "../dispatch/thread_pool.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <cstdint>
@@ -16,6 +17,8 @@
 #include <algorithm>
 #include <utility>
 #include <cmath>
+#include <atomic>
+#include <memory>
 
 hi_export_module(hikogui.layout.grid_layout);
 
@@ -34,6 +37,10 @@ struct grid_layout_cell {
     value_type value = {};
     box_shape shape = {};
 
+    /** The constraints were changed since the grid last calculated its constraints.
+     */
+    mutable bool constraints_modified = true;
+
     constexpr grid_layout_cell() noexcept = default;
     constexpr grid_layout_cell(grid_layout_cell const&) noexcept = default;
     constexpr grid_layout_cell(grid_layout_cell&&) noexcept = default;
@@ -61,7 +68,10 @@ struct grid_layout_cell {
 
     constexpr void set_constraints(box_constraints const& constraints) noexcept
     {
-        _constraints = constraints;
+        if (_constraints != constraints) {
+            _constraints = constraints;
+            constraints_modified = true;
+        }
     }
 
     template<hi::axis Axis>
@@ -243,6 +253,8 @@ public:
          * @note This field is valid after layout.
          */
         std::optional<float> guideline = 0.0f;
+
+        [[nodiscard]] constexpr friend bool operator==(constraint_type const&, constraint_type const&) noexcept = default;
     };
     using constraint_vector = std::vector<constraint_type>;
     using iterator = constraint_vector::iterator;
@@ -272,6 +284,7 @@ public:
     {
         for (auto const& cell : cells) {
             construct_simple_cell(cell);
+            _has_span_cells |= cell.template span<axis>() > 1;
         }
         construct_fixup();
 
@@ -279,6 +292,50 @@ public:
             construct_span_cell(cell);
         }
         construct_fixup();
+
+        if (not _has_span_cells) {
+            construct_cell_index(cells);
+        }
+    }
+
+    /** Update the constraints after the constraints of a single cell have changed.
+     *
+     * Only the constraints of the row/column of the cell and its neighbours
+     * are recalculated, the neighbours are needed to merge the margins.
+     *
+     * @param cells The cells, the same as passed to the constructor.
+     * @param i The index of the cell that was changed.
+     * @retval true The constraints have been updated.
+     * @retval false The axis has cells that span multiple rows/columns, and
+     *               needs to be constructed again.
+     */
+    [[nodiscard]] constexpr bool update_cell(cell_vector const& cells, size_t i) noexcept
+    {
+        if (_has_span_cells or cells.size() != _cell_indices.size()) {
+            return false;
+        }
+
+        auto const index = cells[i].template first<axis>();
+        hi_axiom(index < size());
+        auto const first = index == 0 ? 0_uz : index - 1;
+        auto const last = std::min(index + 2, size());
+
+        for (auto j = first; j != last; ++j) {
+            _constraints[j] = constraint_type{};
+            for (auto k = _cell_offsets[j]; k != _cell_offsets[j + 1]; ++k) {
+                construct_simple_cell(cells[_cell_indices[k]]);
+            }
+        }
+
+        // The margins between the neighbours and the constraints outside of the range did not change.
+        if (first != 0) {
+            inplace_max(_constraints[first].margin_before, _constraints[first - 1].margin_after);
+        }
+        if (last != size()) {
+            inplace_max(_constraints[last - 1].margin_after, _constraints[last].margin_before);
+        }
+        construct_fixup(begin() + first, begin() + last);
+        return true;
     }
 
     [[nodiscard]] constexpr float margin_before() const noexcept
@@ -573,6 +630,18 @@ private:
      */
     bool _forward = true;
 
+    /** One or more cells span multiple rows/columns on this axis.
+     */
+    bool _has_span_cells = false;
+
+    /** The offset into `_cell_indices` for each row/column, plus one beyond the last.
+     */
+    std::vector<size_t> _cell_offsets = {};
+
+    /** The indices of the cells, grouped per row/column.
+     */
+    std::vector<size_t> _cell_indices = {};
+
     /** Shrink cells.
      *
      * This function is called in two different ways:
@@ -738,15 +807,37 @@ private:
         }
     }
 
+    /** Construct an index of the cells on each row/column.
+     *
+     * @param cells The cells, which each span a single row/column.
+     */
+    constexpr void construct_cell_index(cell_vector const& cells) noexcept
+    {
+        _cell_offsets.assign(size() + 1, 0);
+        for (auto const& cell : cells) {
+            ++_cell_offsets[cell.template first<axis>() + 1];
+        }
+        std::partial_sum(_cell_offsets.begin(), _cell_offsets.end(), _cell_offsets.begin());
+
+        auto next = _cell_offsets;
+        _cell_indices.resize(cells.size());
+        for (auto i = 0_uz; i != cells.size(); ++i) {
+            _cell_indices[next[cells[i].template first<axis>()]++] = i;
+        }
+    }
+
     /** Construct fix-up.
      *
      * Fix-up minimum, preferred, maximum. And calculate the padding.
+     *
+     * @param first The first constraint to fix-up.
+     * @param last One beyond the last constraint to fix-up.
      */
-    constexpr void construct_fixup() noexcept
+    constexpr void construct_fixup(iterator first, iterator last) noexcept
     {
-        for (auto it = begin(); it != end(); ++it) {
+        for (auto it = first; it != last; ++it) {
             // Fix the margins so that between two constraints they are equal.
-            if (it + 1 != end()) {
+            if (it + 1 != last) {
                 it->margin_after = (it + 1)->margin_before = std::max(it->margin_after, (it + 1)->margin_before);
             }
 
@@ -756,6 +847,11 @@ private:
         }
     }
 
+    constexpr void construct_fixup() noexcept
+    {
+        construct_fixup(begin(), end());
+    }
+
     /** Get the minimum, preferred, maximum size of the span.
      *
      * The returned minimum, preferred and maximum include the internal margin within the span.
@@ -895,6 +991,10 @@ public:
     using reference = cell_vector::reference;
     using const_reference = cell_vector::const_reference;
 
+    /** The minimum number of cells before the rows and columns are solved concurrently.
+     */
+    constexpr static size_t parallel_threshold = 4096;
+
     ~grid_layout() = default;
     constexpr grid_layout() noexcept = default;
     constexpr grid_layout(grid_layout const&) noexcept = default;
@@ -1043,11 +1143,17 @@ public:
         update_after_insert_or_delete();
     }
 
+    /** Calculate the constraints of the grid.
+     *
+     * When only the constraints of a few cells were changed since the last
+     * call, only the rows and columns of those cells are recalculated.
+     *
+     * @param left_to_right True if the columns are laid out from left to right.
+     * @return The constraints of the grid.
+     */
     [[nodiscard]] constexpr box_constraints constraints(bool left_to_right) const noexcept
     {
-        // Rows in the grid are laid out from top to bottom which is reverse from the y-axis up.
-        _row_constraints = {_cells, num_rows(), false};
-        _column_constraints = {_cells, num_columns(), left_to_right};
+        update_axis_constraints(left_to_right);
 
         auto r = box_constraints{};
         std::tie(r.minimum.width(), r.preferred.width(), r.maximum.width()) = _column_constraints.update_constraints();
@@ -1081,8 +1187,19 @@ public:
     constexpr void set_layout(box_shape const& shape, float baseline_adjustment) noexcept
     {
         // Rows in the grid are laid out from top to bottom which is reverse from the y-axis up.
-        _column_constraints.layout(shape.x(), shape.width(), shape.centerline, 0);
-        _row_constraints.layout(shape.y(), shape.height(), shape.baseline, baseline_adjustment);
+        if (not std::is_constant_evaluated() and _cells.size() >= parallel_threshold) {
+            parallel_invoke(
+                [&] {
+                    _row_constraints.layout(shape.y(), shape.height(), shape.baseline, baseline_adjustment);
+                },
+                [&] {
+                    _column_constraints.layout(shape.x(), shape.width(), shape.centerline, 0);
+                });
+
+        } else {
+            _column_constraints.layout(shape.x(), shape.width(), shape.centerline, 0);
+            _row_constraints.layout(shape.y(), shape.height(), shape.baseline, baseline_adjustment);
+        }
 
         // Assign the shape for each cell.
         for (auto& cell : _cells) {
@@ -1103,6 +1220,87 @@ private:
     mutable detail::grid_layout_axis_constraints<axis::y, value_type> _row_constraints = {};
     mutable detail::grid_layout_axis_constraints<axis::x, value_type> _column_constraints = {};
 
+    /** The row and column constraints were constructed from the current cells.
+     */
+    mutable bool _axis_constraints_valid = false;
+    mutable bool _left_to_right = true;
+
+    /** Call two independent functions, the first on the global thread pool.
+     *
+     * The rows and columns of large grids are solved at the same time. When called
+     * from a thread of the pool both functions are called on this thread, so that
+     * the pool can not dead-lock waiting on itself.
+     *
+     * @param row_func The function that solves the rows, called on the thread pool.
+     * @param column_func The function that solves the columns, called on this thread.
+     */
+    template<typename RowFunc, typename ColumnFunc>
+    static void parallel_invoke(RowFunc const& row_func, ColumnFunc const& column_func) noexcept
+    {
+        auto& pool = thread_pool::global();
+        if (pool.on_thread()) {
+            row_func();
+            column_func();
+            return;
+        }
+
+        // The worker shares ownership, so that the flag outlives the notify below.
+        auto const row_done = std::make_shared<std::atomic<bool>>(false);
+        pool.post_function([row_done, &row_func] {
+            row_func();
+            row_done->store(true);
+            row_done->notify_all();
+        });
+
+        column_func();
+        row_done->wait(false);
+    }
+
+    /** Construct the row and column constraints from all the cells.
+     */
+    constexpr void construct_axis_constraints(bool left_to_right) const noexcept
+    {
+        for (auto const& cell : _cells) {
+            cell.constraints_modified = false;
+        }
+
+        // Rows in the grid are laid out from top to bottom which is reverse from the y-axis up.
+        if (not std::is_constant_evaluated() and _cells.size() >= parallel_threshold) {
+            parallel_invoke(
+                [this] {
+                    _row_constraints = {_cells, num_rows(), false};
+                },
+                [&] {
+                    _column_constraints = {_cells, num_columns(), left_to_right};
+                });
+
+        } else {
+            _row_constraints = {_cells, num_rows(), false};
+            _column_constraints = {_cells, num_columns(), left_to_right};
+        }
+
+        _axis_constraints_valid = true;
+        _left_to_right = left_to_right;
+    }
+
+    /** Update the row and column constraints for the cells that were modified.
+     */
+    constexpr void update_axis_constraints(bool left_to_right) const noexcept
+    {
+        if (not _axis_constraints_valid or _left_to_right != left_to_right) {
+            return construct_axis_constraints(left_to_right);
+        }
+
+        for (auto i = 0_uz; i != _cells.size(); ++i) {
+            if (_cells[i].constraints_modified) {
+                _cells[i].constraints_modified = false;
+                if (not _row_constraints.update_cell(_cells, i) or not _column_constraints.update_cell(_cells, i)) {
+                    return construct_axis_constraints(left_to_right);
+                }
+            }
+        }
+    }
+
     /** Sort the cells ordered by row then column.
      *
      * The ordering is the same as they keyboard focus chain order.
@@ -1123,6 +1321,7 @@ private:
     constexpr void update_after_insert_or_delete() noexcept
     {
         sort_cells();
+        _axis_constraints_valid = false;
 
         _num_rows = 0;
         _num_columns = 0;
@@ -0,0 +1,81 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "grid_layout.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <array>
+#include <tuple>
+#include <cstddef>
+
+using hi::operator""_uz;
+
+/** The constraints of a cell, which changes with @a seed.
+ */
+[[nodiscard]] static hi::box_constraints grid_benchmark_constraints(std::size_t column, std::size_t row, std::size_t seed)
+{
+    auto const w = static_cast<float>((column * 7 + row * 3 + seed) % 11 + 10 + seed * 20);
+    auto const h = static_cast<float>((column * 5 + row * 11 + seed) % 13 + 10 + seed * 20);
+    auto const m = static_cast<float>((column + row * 2 + seed) % 4);
+    return {hi::extent2{w, h}, hi::extent2{w * 2.0f, h * 2.0f}, hi::extent2{w * 4.0f, h * 4.0f}, hi::alignment{}, hi::margins{m}};
+}
+
+/** A grid of 20 columns and 50 rows, like a large table or form.
+ */
+[[nodiscard]] static hi::grid_layout<int> grid_benchmark_grid()
+{
+    constexpr auto num_columns = 20_uz;
+    constexpr auto num_rows = 50_uz;
+
+    auto r = hi::grid_layout<int>{};
+    for (auto row = 0_uz; row != num_rows; ++row) {
+        for (auto column = 0_uz; column != num_columns; ++column) {
+            r.add_cell(column, row, static_cast<int>(row * num_columns + column));
+        }
+    }
+
+    for (auto& cell : r) {
+        cell.set_constraints(grid_benchmark_constraints(cell.first_column, cell.first_row, 0));
+    }
+    return r;
+}
+
+hi_benchmark(grid_layout_constraints)
+{
+    auto grid = grid_benchmark_grid();
+
+    // Changing the direction forces the constraints of all the rows and columns to be calculated again.
+    auto left_to_right = true;
+    state.set_items_per_iteration(grid.size());
+    while (state.running()) {
+        hi::do_not_optimize(grid.constraints(left_to_right));
+        left_to_right = not left_to_right;
+    }
+}
+
+hi_benchmark(grid_layout_update_cell)
+{
+    auto grid = grid_benchmark_grid();
+    std::ignore = grid.constraints(true);
+
+    auto seed = 0_uz;
+    while (state.running()) {
+        auto& cell = grid[grid.size() / 2];
+        cell.set_constraints(grid_benchmark_constraints(cell.first_column, cell.first_row, ++seed % 2));
+        hi::do_not_optimize(grid.constraints(true));
+    }
+}
+
+hi_benchmark(grid_layout_set_layout)
+{
+    auto grid = grid_benchmark_grid();
+    auto const constraints = grid.constraints(true);
+    auto const shapes = std::array{hi::box_shape{constraints.preferred}, hi::box_shape{constraints.maximum}};
+
+    auto i = 0_uz;
+    state.set_items_per_iteration(grid.size());
+    while (state.running()) {
+        grid.set_layout(shapes[i++ % shapes.size()], 0.0f);
+        hi::do_not_optimize(grid);
+    }
+}
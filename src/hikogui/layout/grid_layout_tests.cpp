@@ -0,0 +1,134 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "grid_layout.hpp"
+#include <hikotest/hikotest.hpp>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+TEST_SUITE(grid_layout) {
+
+/** The constraints of a cell, which changes with @a seed.
+ */
+[[nodiscard]] static hi::box_constraints make_constraints(std::size_t column, std::size_t row, std::size_t seed)
+{
+    auto const w = static_cast<float>((column * 7 + row * 3 + seed) % 11 + 10 + seed * 20);
+    auto const h = static_cast<float>((column * 5 + row * 11 + seed) % 13 + 10 + seed * 20);
+    auto const m = static_cast<float>((column + row * 2 + seed) % 4);
+    return {hi::extent2{w, h}, hi::extent2{w * 2.0f, h * 2.0f}, hi::extent2{w * 4.0f, h * 4.0f}, hi::alignment{}, hi::margins{m}};
+}
+
+/** Make a grid with a cell on each column and row.
+ *
+ * @param modified The index of the cell that gets the constraints of the next seed.
+ */
+[[nodiscard]] static hi::grid_layout<int>
+make_grid(std::size_t num_columns, std::size_t num_rows, std::size_t modified = std::numeric_limits<std::size_t>::max())
+{
+    auto r = hi::grid_layout<int>{};
+    for (auto row = std::size_t{0}; row != num_rows; ++row) {
+        for (auto column = std::size_t{0}; column != num_columns; ++column) {
+            r.add_cell(column, row, static_cast<int>(row * num_columns + column));
+        }
+    }
+
+    for (auto i = std::size_t{0}; i != r.size(); ++i) {
+        auto& cell = r[i];
+        cell.set_constraints(make_constraints(cell.first_column, cell.first_row, i == modified ? 1 : 0));
+    }
+    return r;
+}
+
+TEST_CASE(incremental_update)
+{
+    auto grid = make_grid(5, 4);
+    auto const original = grid.constraints(true);
+
+    // Change the constraints of a cell after the grid has calculated its constraints.
+    auto& cell = grid[7];
+    cell.set_constraints(make_constraints(cell.first_column, cell.first_row, 1));
+    auto const updated = grid.constraints(true);
+
+    auto expected_grid = make_grid(5, 4, 7);
+    auto const expected = expected_grid.constraints(true);
+    REQUIRE(updated == expected);
+    REQUIRE(updated != original);
+
+    auto const shape = hi::box_shape{updated.preferred};
+    grid.set_layout(shape, 0.0f);
+    expected_grid.set_layout(shape, 0.0f);
+    for (auto i = std::size_t{0}; i != grid.size(); ++i) {
+        REQUIRE(grid[i].shape == expected_grid[i].shape);
+    }
+}
+
+TEST_CASE(incremental_update_edge)
+{
+    // The first and last cell have only one neighbour to merge margins with.
+    for (auto const modified : {std::size_t{0}, std::size_t{19}}) {
+        auto grid = make_grid(5, 4);
+        [[maybe_unused]] auto const original = grid.constraints(true);
+
+        auto& cell = grid[modified];
+        cell.set_constraints(make_constraints(cell.first_column, cell.first_row, 1));
+
+        auto expected_grid = make_grid(5, 4, modified);
+        REQUIRE(grid.constraints(true) == expected_grid.constraints(true));
+    }
+}
+
+TEST_CASE(span_cell)
+{
+    // Cells that span multiple columns are constructed again from all the cells.
+    auto grid = make_grid(3, 2);
+    grid.add_cell(0, 2, 3, 3, 6);
+    grid[6].set_constraints(make_constraints(0, 2, 0));
+    [[maybe_unused]] auto const original = grid.constraints(true);
+
+    grid[6].set_constraints(make_constraints(0, 2, 1));
+
+    auto expected_grid = make_grid(3, 2);
+    expected_grid.add_cell(0, 2, 3, 3, 6);
+    expected_grid[6].set_constraints(make_constraints(0, 2, 1));
+    REQUIRE(grid.constraints(true) == expected_grid.constraints(true));
+}
+
+TEST_CASE(large_grid)
+{
+    // A spreadsheet-like grid of 10,000 rows and 50 columns, large enough
+    // for the grid to solve the rows and columns in parallel.
+    using cell_type = hi::detail::grid_layout_cell<int>;
+    using cell_vector = std::vector<cell_type>;
+    using row_constraints_type = hi::detail::grid_layout_axis_constraints<hi::axis::y, int>;
+    using column_constraints_type = hi::detail::grid_layout_axis_constraints<hi::axis::x, int>;
+
+    constexpr auto num_columns = std::size_t{50};
+    constexpr auto num_rows = std::size_t{10'000};
+
+    auto cells = cell_vector{};
+    cells.reserve(num_columns * num_rows);
+    for (auto row = std::size_t{0}; row != num_rows; ++row) {
+        for (auto column = std::size_t{0}; column != num_columns; ++column) {
+            auto& cell = cells.emplace_back(column, row, column + 1, row + 1, false, 0);
+            cell.set_constraints(make_constraints(column, row, 0));
+        }
+    }
+
+    REQUIRE(cells.size() >= hi::grid_layout<int>::parallel_threshold);
+
+    auto rows = row_constraints_type{cells, num_rows, false};
+    auto columns = column_constraints_type{cells, num_columns, true};
+
+    // Update a cell in the middle of the grid.
+    auto const modified = 5000 * num_columns + 25;
+    cells[modified].set_constraints(make_constraints(25, 5000, 1));
+    REQUIRE(rows.update_cell(cells, modified));
+    REQUIRE(columns.update_cell(cells, modified));
+
+    REQUIRE(rows == row_constraints_type(cells, num_rows, false));
+    REQUIRE(columns == column_constraints_type(cells, num_columns, true));
+}
+
+};
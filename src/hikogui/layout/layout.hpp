@@ -5,7 +5,9 @@
 #include "box_shape.hpp" // export
 #include "grid_layout.hpp" // export
 #include "row_column_layout.hpp" // export
+#include "spatial_index.hpp" // export
 #include "spreadsheet_address.hpp" // export
+#include "virtual_list_layout.hpp" // export
 
 hi_export_module(hikogui.layout);
 
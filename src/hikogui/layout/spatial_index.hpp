@@ -0,0 +1,164 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file layout/spatial_index.hpp Defines spatial_index.
+ * @ingroup layout
+ */
+
+#pragma once
+
+#include "../geometry/geometry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <algorithm>
+#include <concepts>
+#include <utility>
+#include <cstddef>
+
+hi_export_module(hikogui.layout.spatial_index);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** An index of rectangles, to find the rectangles that overlap an area or point.
+ *
+ * The rectangles are sorted on their bottom edge. A search only visits the
+ * rectangles of which the bottom edge is between the bottom of the area
+ * minus the height of the tallest rectangle and the top of the area, which
+ * is a binary search followed by a scan of about the rows that overlap.
+ *
+ * This works well for the children of containers like grids and lists, where
+ * the children have a similar height. A single very tall rectangle makes every
+ * search visit more rectangles.
+ */
+class spatial_index {
+public:
+    using value_type = std::size_t;
+
+    constexpr spatial_index() noexcept = default;
+    spatial_index(spatial_index const&) noexcept = default;
+    spatial_index(spatial_index&&) noexcept = default;
+    spatial_index& operator=(spatial_index const&) noexcept = default;
+    spatial_index& operator=(spatial_index&&) noexcept = default;
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _items.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _items.empty();
+    }
+
+    void clear() noexcept
+    {
+        _items.clear();
+        _max_height = 0.0f;
+        _sorted = true;
+    }
+
+    void reserve(std::size_t new_capacity)
+    {
+        _items.reserve(new_capacity);
+    }
+
+    /** Add a rectangle to the index.
+     *
+     * @param rectangle The rectangle to add, empty rectangles are never found.
+     * @param value The value to return when the rectangle is found, for example the index of a child.
+     */
+    void add(aarectangle const& rectangle, value_type value)
+    {
+        if (rectangle.empty()) {
+            return;
+        }
+
+        _items.emplace_back(rectangle.left(), rectangle.bottom(), rectangle.right(), rectangle.top(), value);
+        _max_height = std::max(_max_height, rectangle.height());
+        _sorted = false;
+    }
+
+    /** Prepare the index for searching, after the rectangles have been added.
+     */
+    void sort() noexcept
+    {
+        if (not _sorted) {
+            std::ranges::sort(_items, [](auto const& lhs, auto const& rhs) {
+                return lhs.bottom < rhs.bottom;
+            });
+            _sorted = true;
+        }
+    }
+
+    /** Find the rectangles that overlap an area.
+     *
+     * The rectangles are found in order of their bottom edge.
+     *
+     * @pre `sort()` was called after the last rectangle was added.
+     * @param area The area to search.
+     * @param func A function called with the value of each rectangle that overlaps @a area.
+     */
+    template<std::invocable<value_type> Func>
+    void find(aarectangle const& area, Func&& func) const noexcept
+    {
+        if (area.empty()) {
+            return;
+        }
+
+        auto const [first, last] = candidates(area.bottom(), area.top());
+        for (auto it = first; it != last; ++it) {
+            if (it->top >= area.bottom() and it->left <= area.right() and it->right >= area.left()) {
+                func(it->value);
+            }
+        }
+    }
+
+    /** Find the rectangles that contain a point.
+     *
+     * @pre `sort()` was called after the last rectangle was added.
+     * @param position The point to search.
+     * @param func A function called with the value of each rectangle that contains @a position.
+     */
+    template<std::invocable<value_type> Func>
+    void find(point2 const& position, Func&& func) const noexcept
+    {
+        auto const [first, last] = candidates(position.y(), position.y());
+        for (auto it = first; it != last; ++it) {
+            if (it->top > position.y() and it->left <= position.x() and it->right > position.x()) {
+                func(it->value);
+            }
+        }
+    }
+
+private:
+    struct item_type {
+        float left;
+        float bottom;
+        float right;
+        float top;
+        value_type value;
+    };
+
+    using const_iterator = std::vector<item_type>::const_iterator;
+
+    std::vector<item_type> _items;
+    float _max_height = 0.0f;
+    bool _sorted = true;
+
+    /** The items of which the bottom edge is in [bottom - max height, top].
+     */
+    [[nodiscard]] std::pair<const_iterator, const_iterator> candidates(float bottom, float top) const noexcept
+    {
+        hi_axiom(_sorted);
+
+        auto const first = std::ranges::lower_bound(_items, bottom - _max_height, std::ranges::less{}, &item_type::bottom);
+        auto const last = std::upper_bound(first, _items.cend(), top, [](float value, item_type const& item) {
+            return value < item.bottom;
+        });
+        return {first, last};
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,76 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "spatial_index.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+TEST_SUITE(spatial_index) {
+
+using values_type = std::vector<std::size_t>;
+
+/** A grid of 10 columns and 100 rows of 20 x 10 cells, the first row at the bottom.
+ */
+[[nodiscard]] static hi::spatial_index make_grid()
+{
+    auto r = hi::spatial_index{};
+    for (auto row = 0; row != 100; ++row) {
+        for (auto column = 0; column != 10; ++column) {
+            r.add(hi::aarectangle{column * 20.0f, row * 10.0f, 20.0f, 10.0f}, row * 10 + column);
+        }
+    }
+    r.sort();
+    return r;
+}
+
+[[nodiscard]] static values_type find(hi::spatial_index const& index, auto const& area)
+{
+    auto r = values_type{};
+    index.find(area, [&](std::size_t value) {
+        r.push_back(value);
+    });
+    std::ranges::sort(r);
+    return r;
+}
+
+TEST_CASE(find_area)
+{
+    auto const index = make_grid();
+    REQUIRE(index.size() == 1000);
+
+    REQUIRE((find(index, hi::aarectangle{1.0f, 1.0f, 2.0f, 2.0f}) == values_type{0}));
+    REQUIRE((find(index, hi::aarectangle{25.0f, 501.0f, 20.0f, 8.0f}) == values_type{501, 502}));
+    REQUIRE((find(index, hi::aarectangle{35.0f, 495.0f, 2.0f, 10.0f}) == values_type{491, 501}));
+    REQUIRE(find(index, hi::aarectangle{1.0f, 201.0f, 198.0f, 93.0f}).size() == 100);
+    REQUIRE(find(index, hi::aarectangle{300.0f, 200.0f, 20.0f, 20.0f}).empty());
+    REQUIRE(find(index, hi::aarectangle{0.0f, 2000.0f, 20.0f, 20.0f}).empty());
+}
+
+TEST_CASE(find_point)
+{
+    auto const index = make_grid();
+
+    REQUIRE((find(index, hi::point2{0.0f, 0.0f}) == values_type{0}));
+    REQUIRE((find(index, hi::point2{45.0f, 995.0f}) == values_type{992}));
+
+    // The left and bottom edges are inside a rectangle, the right and top edges outside.
+    REQUIRE((find(index, hi::point2{20.0f, 10.0f}) == values_type{11}));
+    REQUIRE(find(index, hi::point2{200.0f, 5.0f}).empty());
+    REQUIRE(find(index, hi::point2{5.0f, 1000.0f}).empty());
+}
+
+TEST_CASE(tall_rectangle)
+{
+    auto index = make_grid();
+    index.add(hi::aarectangle{200.0f, 0.0f, 20.0f, 1000.0f}, 1000);
+    index.add(hi::aarectangle{}, 1001);
+    index.sort();
+
+    REQUIRE((find(index, hi::point2{210.0f, 999.0f}) == values_type{1000}));
+    REQUIRE((find(index, hi::aarectangle{195.0f, 501.0f, 10.0f, 3.0f}) == values_type{509, 1000}));
+}
+
+};
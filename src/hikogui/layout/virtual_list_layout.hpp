@@ -0,0 +1,121 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file layout/virtual_list_layout.hpp Defines virtual_list_layout.
+ * @ingroup layout
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+#include <cmath>
+
+hi_export_module(hikogui.layout.virtual_list_layout);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** The layout of a list of rows with equal height.
+ *
+ * Because each row has the same height, the position of any row and the
+ * rows that are visible in a part of the list are calculated without laying
+ * out each row. This allows a list to only instantiate the widgets for the
+ * visible rows.
+ *
+ * Positions are distances from the top of the list, in the direction of the
+ * rows, the first row is at the top.
+ */
+class virtual_list_layout {
+public:
+    constexpr virtual_list_layout() noexcept = default;
+    constexpr virtual_list_layout(virtual_list_layout const&) noexcept = default;
+    constexpr virtual_list_layout(virtual_list_layout&&) noexcept = default;
+    constexpr virtual_list_layout& operator=(virtual_list_layout const&) noexcept = default;
+    constexpr virtual_list_layout& operator=(virtual_list_layout&&) noexcept = default;
+    [[nodiscard]] constexpr friend bool operator==(virtual_list_layout const&, virtual_list_layout const&) noexcept = default;
+
+    /** Create a layout.
+     *
+     * @param size The number of rows.
+     * @param row_height The height of each row.
+     * @param spacing The space between two rows.
+     */
+    constexpr virtual_list_layout(std::size_t size, float row_height, float spacing = 0.0f) noexcept :
+        _size(size), _row_height(row_height), _spacing(spacing)
+    {
+        hi_axiom(row_height > 0.0f);
+        hi_axiom(spacing >= 0.0f);
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    [[nodiscard]] constexpr float row_height() const noexcept
+    {
+        return _row_height;
+    }
+
+    /** The distance between the tops of two consecutive rows.
+     */
+    [[nodiscard]] constexpr float pitch() const noexcept
+    {
+        return _row_height + _spacing;
+    }
+
+    /** The height of all the rows together.
+     */
+    [[nodiscard]] constexpr float height() const noexcept
+    {
+        if (_size == 0) {
+            return 0.0f;
+        } else {
+            return static_cast<float>(static_cast<double>(_size) * pitch() - _spacing);
+        }
+    }
+
+    /** The distance from the top of the list to the top of a row.
+     */
+    [[nodiscard]] constexpr float row_top(std::size_t index) const noexcept
+    {
+        return static_cast<float>(static_cast<double>(index) * pitch());
+    }
+
+    /** The rows that are visible in a part of the list.
+     *
+     * @param top The distance from the top of the list to the top of the visible part.
+     * @param bottom The distance from the top of the list to the bottom of the visible part.
+     * @return The index of the first visible row, and one beyond the index of the last visible row.
+     */
+    [[nodiscard]] constexpr std::pair<std::size_t, std::size_t> visible_rows(float top, float bottom) const noexcept
+    {
+        if (_size == 0 or _row_height == 0.0f or bottom <= top or bottom <= 0.0f) {
+            return {0, 0};
+        }
+
+        // A row is visible when its top is above the bottom, and its bottom below the top.
+        auto const first_ = std::floor((static_cast<double>(top) - _row_height) / pitch()) + 1.0;
+        auto const last_ = std::ceil(static_cast<double>(bottom) / pitch());
+
+        auto const first = first_ <= 0.0 ? 0_uz : std::min(static_cast<std::size_t>(first_), _size);
+        auto const last = std::min(static_cast<std::size_t>(last_), _size);
+        return {first, std::max(first, last)};
+    }
+
+private:
+    std::size_t _size = 0;
+    float _row_height = 0.0f;
+    float _spacing = 0.0f;
+};
+
+}} // namespace hi::v1
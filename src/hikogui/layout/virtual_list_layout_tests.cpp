@@ -0,0 +1,61 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "virtual_list_layout.hpp"
+#include <hikotest/hikotest.hpp>
+#include <utility>
+#include <cstddef>
+
+TEST_SUITE(virtual_list_layout) {
+
+using rows_type = std::pair<std::size_t, std::size_t>;
+
+TEST_CASE(height)
+{
+    REQUIRE(hi::virtual_list_layout{}.height() == 0.0f);
+    REQUIRE(hi::virtual_list_layout(0, 20.0f, 4.0f).height() == 0.0f);
+    REQUIRE(hi::virtual_list_layout(1, 20.0f, 4.0f).height() == 20.0f);
+    REQUIRE(hi::virtual_list_layout(3, 20.0f, 4.0f).height() == 68.0f);
+    REQUIRE(hi::virtual_list_layout(100'000, 20.0f).height() == 2'000'000.0f);
+
+    REQUIRE(hi::virtual_list_layout(3, 20.0f, 4.0f).row_top(0) == 0.0f);
+    REQUIRE(hi::virtual_list_layout(3, 20.0f, 4.0f).row_top(2) == 48.0f);
+}
+
+TEST_CASE(visible_rows)
+{
+    auto const layout = hi::virtual_list_layout(10, 20.0f, 4.0f);
+
+    REQUIRE((layout.visible_rows(0.0f, 1.0f) == rows_type{0, 1}));
+    REQUIRE((layout.visible_rows(0.0f, 20.0f) == rows_type{0, 1}));
+    REQUIRE((layout.visible_rows(0.0f, 24.0f) == rows_type{0, 1}));
+    REQUIRE((layout.visible_rows(0.0f, 24.5f) == rows_type{0, 2}));
+    // Only the spacing between row 0 and row 1 is visible.
+    REQUIRE((layout.visible_rows(20.0f, 24.0f) == rows_type{1, 1}));
+    REQUIRE((layout.visible_rows(19.0f, 25.0f) == rows_type{0, 2}));
+    REQUIRE((layout.visible_rows(50.0f, 100.0f) == rows_type{2, 5}));
+}
+
+TEST_CASE(visible_rows_clamped)
+{
+    auto const layout = hi::virtual_list_layout(10, 20.0f, 4.0f);
+
+    REQUIRE((layout.visible_rows(-100.0f, 10.0f) == rows_type{0, 1}));
+    REQUIRE((layout.visible_rows(-100.0f, 1000.0f) == rows_type{0, 10}));
+    REQUIRE((layout.visible_rows(230.0f, 1000.0f) == rows_type{9, 10}));
+    REQUIRE((layout.visible_rows(500.0f, 1000.0f) == rows_type{10, 10}));
+    REQUIRE((layout.visible_rows(-100.0f, -10.0f) == rows_type{0, 0}));
+    REQUIRE((layout.visible_rows(50.0f, 50.0f) == rows_type{0, 0}));
+    REQUIRE((hi::virtual_list_layout{}.visible_rows(0.0f, 100.0f) == rows_type{0, 0}));
+}
+
+TEST_CASE(visible_rows_large)
+{
+    auto const layout = hi::virtual_list_layout(1'000'000, 20.0f);
+
+    REQUIRE((layout.visible_rows(10'000'000.0f, 10'000'400.0f) == rows_type{500'000, 500'020}));
+    REQUIRE((layout.visible_rows(19'999'990.0f, 20'000'400.0f) == rows_type{999'999, 1'000'000}));
+}
+
+};
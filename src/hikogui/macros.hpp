@@ -547,14 +547,14 @@
 
 #define hi_log_info_once(name, fmt, ...) \
     do { \
-        if (++::hi::global_counter<name> == 1) { \
+        if (::hi::global_counter<name>.first_increment()) { \
             hi_log(::hi::global_state_type::log_info, fmt __VA_OPT__(, ) __VA_ARGS__); \
         } \
     } while (false)
 
 #define hi_log_error_once(name, fmt, ...) \
     do { \
-        if (++::hi::global_counter<name> == 1) { \
+        if (::hi::global_counter<name>.first_increment()) { \
             hi_log(::hi::global_state_type::log_error, fmt __VA_OPT__(, ) __VA_ARGS__); \
         } \
     } while (false)
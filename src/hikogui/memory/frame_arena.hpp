@@ -0,0 +1,154 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../telemetry/telemetry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <memory_resource>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+hi_export_module(hikogui.memory.frame_arena);
+
+hi_export namespace hi::inline v1 {
+
+/** A monotonic memory resource for temporaries that live for a single frame.
+ *
+ * Allocation bumps a pointer inside a chunk, deallocation does nothing.
+ * All memory is reclaimed at once by `reset()` at the end of the frame.
+ *
+ * When a frame needed more than one chunk, `reset()` replaces the chunks
+ * by a single chunk large enough for the whole frame, so that in a steady
+ * state no memory is allocated from the upstream resource.
+ *
+ * @note This resource is not thread-safe, it is owned by the thread that renders the frame.
+ */
+class frame_arena : public std::pmr::memory_resource {
+public:
+    constexpr static std::size_t default_chunk_size = 64 * 1024;
+
+    ~frame_arena() = default;
+    frame_arena(frame_arena const&) = delete;
+    frame_arena(frame_arena&&) = delete;
+    frame_arena& operator=(frame_arena const&) = delete;
+    frame_arena& operator=(frame_arena&&) = delete;
+
+    /** Create a frame arena.
+     *
+     * @param chunk_size The size of the first chunk, allocated on first use.
+     */
+    explicit frame_arena(std::size_t chunk_size = default_chunk_size) noexcept : _next_chunk_size(chunk_size)
+    {
+        hi_axiom(chunk_size != 0);
+    }
+
+    /** The number of bytes allocated during this frame, including alignment padding.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        if (_chunks.empty()) {
+            return 0;
+        }
+        return _chunks_size + narrow_cast<std::size_t>(_ptr - _chunks.back().data.get());
+    }
+
+    /** The total size of the chunks owned by the arena.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        auto r = 0_uz;
+        for (auto const& chunk : _chunks) {
+            r += chunk.size;
+        }
+        return r;
+    }
+
+    /** Reclaim all memory allocated during this frame.
+     *
+     * @pre All containers using this resource must have been destroyed or cleared.
+     */
+    void reset()
+    {
+        if (_chunks.size() > 1) {
+            // Coalesce into a single chunk, so that the next frame does not need to allocate.
+            auto const chunk_size = capacity();
+            _chunks.clear();
+            add_chunk(chunk_size);
+            _next_chunk_size = chunk_size * 2;
+            ++global_counter<"frame_arena:coalesce">;
+
+        } else if (not _chunks.empty()) {
+            _ptr = _chunks.back().data.get();
+        }
+        _chunks_size = 0;
+    }
+
+protected:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        void *p = _ptr;
+        auto space = narrow_cast<std::size_t>(_end - _ptr);
+        if (p == nullptr or std::align(alignment, bytes, p, space) == nullptr) [[unlikely]] {
+            if (not _chunks.empty()) {
+                _chunks_size += _chunks.back().size;
+            }
+            auto const chunk_size = std::max(_next_chunk_size, bytes + alignment);
+            add_chunk(chunk_size);
+            _next_chunk_size = chunk_size * 2;
+
+            p = _ptr;
+            space = narrow_cast<std::size_t>(_end - _ptr);
+            [[maybe_unused]] auto const *aligned = std::align(alignment, bytes, p, space);
+            hi_axiom_not_null(aligned);
+        }
+
+        _ptr = static_cast<std::byte *>(p) + bytes;
+        return p;
+    }
+
+    void do_deallocate(void *, std::size_t, std::size_t) override
+    {
+        // Memory is reclaimed by reset().
+    }
+
+    [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    struct chunk_type {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+
+    std::vector<chunk_type> _chunks = {};
+
+    /** The free part of the last chunk.
+     */
+    std::byte *_ptr = nullptr;
+    std::byte *_end = nullptr;
+
+    /** The number of bytes used in all but the last chunk.
+     */
+    std::size_t _chunks_size = 0;
+
+    /** The size of the next chunk, chunks grow exponentially within a frame.
+     */
+    std::size_t _next_chunk_size;
+
+    hi_no_inline void add_chunk(std::size_t size)
+    {
+        auto& chunk = _chunks.emplace_back(chunk_type{std::make_unique_for_overwrite<std::byte[]>(size), size});
+        _ptr = chunk.data.get();
+        _end = _ptr + size;
+        ++global_counter<"frame_arena:chunk">;
+    }
+};
+
+} // namespace hi::inline v1
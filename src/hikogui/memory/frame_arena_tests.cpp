@@ -0,0 +1,73 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "frame_arena.hpp"
+#include <hikotest/hikotest.hpp>
+#include <memory_resource>
+#include <vector>
+#include <bit>
+#include <cstdint>
+
+TEST_SUITE(frame_arena) {
+
+TEST_CASE(allocate)
+{
+    auto arena = hi::frame_arena{256};
+    REQUIRE(arena.size() == 0);
+    REQUIRE(arena.capacity() == 0);
+
+    auto *p1 = arena.allocate(10, 1);
+    auto *p2 = arena.allocate(8, 8);
+    REQUIRE(p1 != nullptr);
+    REQUIRE(std::bit_cast<uintptr_t>(p2) % 8 == 0);
+    REQUIRE(static_cast<std::byte *>(p2) >= static_cast<std::byte *>(p1) + 10);
+    REQUIRE(arena.capacity() == 256);
+
+    // Larger than a chunk.
+    auto *p3 = arena.allocate(1000, 64);
+    REQUIRE(std::bit_cast<uintptr_t>(p3) % 64 == 0);
+    REQUIRE(arena.capacity() > 1000);
+}
+
+TEST_CASE(reset_coalesces)
+{
+    auto arena = hi::frame_arena{256};
+
+    for (auto i = 0; i != 100; ++i) {
+        [[maybe_unused]] auto *p = arena.allocate(100, 4);
+    }
+    auto const used = arena.size();
+    REQUIRE(used >= 10000);
+
+    arena.reset();
+    REQUIRE(arena.size() == 0);
+    auto const capacity = arena.capacity();
+    REQUIRE(capacity >= used);
+
+    // A second frame of the same size fits in the coalesced chunk.
+    for (auto i = 0; i != 100; ++i) {
+        [[maybe_unused]] auto *p = arena.allocate(100, 4);
+    }
+    REQUIRE(arena.capacity() == capacity);
+    REQUIRE(arena.size() == 10000);
+}
+
+TEST_CASE(pmr_vector)
+{
+    auto arena = hi::frame_arena{};
+
+    for (auto frame = 0; frame != 3; ++frame) {
+        {
+            auto v = std::pmr::vector<int>(&arena);
+            for (auto i = 0; i != 1000; ++i) {
+                v.push_back(i);
+            }
+            REQUIRE(v[999] == 999);
+        }
+        arena.reset();
+    }
+    REQUIRE(arena.size() == 0);
+}
+
+};
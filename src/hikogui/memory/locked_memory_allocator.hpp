@@ -3,6 +3,9 @@
 #include "locked_memory_allocator_intf.hpp" // export
 #if HI_OPERATING_SYSTEM == HI_OS_WINDOWS
 #include "locked_memory_allocator_win32_impl.hpp" // export
+#else
+#include "locked_memory_allocator_posix_impl.hpp" // export
 #endif
+#include "locked_memory_pool_impl.hpp" // export
 
 hi_export_module(hikogui.memory.locked_memory_allocator);
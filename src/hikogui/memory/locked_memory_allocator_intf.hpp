@@ -12,10 +12,43 @@ hi_export_module(hikogui.memory.locked_memory_allocator : intf);
 
 hi_export namespace hi::inline v1 {
 
+/** Allocate pages of memory that are locked in physical memory.
+ *
+ * @note This is an operating system call, the size is rounded up to whole pages.
+ * @param n The size in bytes.
+ * @return A pointer to the page-aligned memory.
+ */
 [[nodiscard]] std::byte *locked_memory_allocator_allocate(std::size_t n) noexcept;
 
+/** Deallocate pages allocated with `locked_memory_allocator_allocate()`.
+ */
 void locked_memory_allocator_deallocate(std::byte *p, std::size_t n) noexcept;
 
+/** Allocate a block of locked memory.
+ *
+ * Small blocks are allocated from a pool of locked regions, larger blocks
+ * directly with `locked_memory_allocator_allocate()`.
+ *
+ * @param n The size in bytes.
+ * @return A pointer to memory that is aligned to the size rounded up to a power of two,
+ *         or to a page for large blocks.
+ */
+[[nodiscard]] std::byte *locked_memory_pool_allocate(std::size_t n) noexcept;
+
+/** Deallocate a block allocated with `locked_memory_pool_allocate()`.
+ *
+ * The block is securely cleared before it is reused.
+ *
+ * @param p The pointer to the block.
+ * @param n The size in bytes that was passed to `locked_memory_pool_allocate()`.
+ */
+void locked_memory_pool_deallocate(std::byte *p, std::size_t n) noexcept;
+
+/** Memory allocator for memory that is locked in physical memory.
+ *
+ * Locked memory is not paged out to disk, it is used for real-time audio
+ * and for secrets. Memory is securely cleared when deallocated.
+ */
 template<typename T>
 class locked_memory_allocator {
 public:
@@ -39,13 +72,13 @@ public:
 
     [[nodiscard]] value_type *allocate(size_type n) const noexcept
     {
-        auto *p = locked_memory_allocator_allocate(n * sizeof(value_type));
+        auto *p = locked_memory_pool_allocate(n * sizeof(value_type));
         return reinterpret_cast<value_type *>(p);
     }
 
     void deallocate(value_type *p, size_type n) const noexcept
     {
-        locked_memory_allocator_deallocate(reinterpret_cast<std::byte *>(p), n * sizeof(value_type));
+        locked_memory_pool_deallocate(reinterpret_cast<std::byte *>(p), n * sizeof(value_type));
     }
 };
 
@@ -0,0 +1,44 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "locked_memory_allocator_intf.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <sys/mman.h>
+#include <cstddef>
+#include <format>
+
+hi_export_module(hikogui.memory.locked_memory_allocator : impl);
+
+hi_export namespace hi::inline v1 {
+
+[[nodiscard]] inline std::byte *locked_memory_allocator_allocate(std::size_t n) noexcept
+{
+    auto p = mmap(nullptr, n, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        hi_log_fatal("Could not allocate locked memory. '{}'", get_last_error_message());
+    }
+
+    if (mlock(p, n) != 0) {
+        hi_log_warning("Could not lock memory. '{}'", get_last_error_message());
+    }
+
+    return static_cast<std::byte *>(p);
+}
+
+inline void locked_memory_allocator_deallocate(std::byte *p, std::size_t n) noexcept
+{
+    if (munlock(p, n) != 0) {
+        hi_log_warning("Could not unlock memory. '{}'", get_last_error_message());
+    }
+
+    if (munmap(p, n) != 0) {
+        hi_log_fatal("Could not deallocate locked memory. '{}'", get_last_error_message());
+    }
+}
+
+} // namespace hi::inline v1
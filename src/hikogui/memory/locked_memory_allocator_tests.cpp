@@ -0,0 +1,89 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "locked_memory_allocator.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+TEST_SUITE(locked_memory_allocator) {
+
+TEST_CASE(size_class)
+{
+    using pool = hi::detail::locked_memory_pool;
+
+    REQUIRE(pool::size_class(0) == 0);
+    REQUIRE(pool::size_class(16) == 0);
+    REQUIRE(pool::size_class(17) == 1);
+    REQUIRE(pool::size_class(4096) == 8);
+    REQUIRE(pool::block_size(pool::size_class(100)) == 128);
+}
+
+TEST_CASE(allocate)
+{
+    auto blocks = std::vector<std::byte *>{};
+    for (auto i = 0; i != 1000; ++i) {
+        auto const size = std::size_t{1} << (i % 14);
+        auto *p = hi::locked_memory_pool_allocate(size);
+        REQUIRE(p != nullptr);
+        // Blocks are aligned to their size class, large blocks to a page.
+        auto const alignment = std::min(std::bit_ceil(std::max(size, std::size_t{16})), std::size_t{4096});
+        REQUIRE(std::bit_cast<std::uintptr_t>(p) % alignment == 0);
+
+        std::fill_n(p, size, std::byte{0xff});
+        blocks.push_back(p);
+    }
+
+    // Blocks do not overlap.
+    auto sorted = blocks;
+    std::sort(sorted.begin(), sorted.end());
+    REQUIRE(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+    for (auto i = 0; i != 1000; ++i) {
+        hi::locked_memory_pool_deallocate(blocks[i], std::size_t{1} << (i % 14));
+    }
+}
+
+TEST_CASE(cleared_on_reuse)
+{
+    auto *p = hi::locked_memory_pool_allocate(64);
+    std::fill_n(p, 64, std::byte{0x5a});
+    hi::locked_memory_pool_deallocate(p, 64);
+
+    // The thread cache returns the last deallocated block first.
+    auto *q = hi::locked_memory_pool_allocate(64);
+    REQUIRE(q == p);
+    REQUIRE(std::all_of(q, q + 64, [](auto x) {
+        return x == std::byte{0};
+    }));
+    hi::locked_memory_pool_deallocate(q, 64);
+}
+
+TEST_CASE(vector_across_threads)
+{
+    using vector_type = std::vector<int, hi::locked_memory_allocator<int>>;
+
+    auto vectors = std::vector<vector_type>(8);
+    {
+        auto threads = std::vector<std::jthread>{};
+        for (auto i = 0; i != 8; ++i) {
+            threads.emplace_back([&vectors, i] {
+                for (auto j = 0; j != 10'000; ++j) {
+                    vectors[i].push_back(j);
+                }
+            });
+        }
+    }
+
+    // The vectors are destroyed, and their memory deallocated, on a different thread.
+    for (auto const& v : vectors) {
+        REQUIRE(v.size() == 10'000);
+        REQUIRE(v.back() == 9'999);
+    }
+}
+
+};
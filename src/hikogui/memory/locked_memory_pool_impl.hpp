@@ -0,0 +1,264 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "locked_memory_allocator_intf.hpp"
+#include "../security/security.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../concurrency/unfair_mutex.hpp" // XXX #616
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <array>
+#include <mutex>
+#include <bit>
+#include <algorithm>
+#include <utility>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.memory.locked_memory_allocator : pool_impl);
+
+hi_export namespace hi::inline v1 {
+namespace detail {
+
+/** A pool of small blocks of locked memory.
+ *
+ * Locking memory is done per page with two system calls and it counts
+ * against the working set quota of the process. The pool locks large regions
+ * and divides them into blocks of power-of-two size classes.
+ *
+ * Each thread caches a few free blocks of each size class, so that most
+ * allocations and deallocations do not take the lock of the pool. Blocks
+ * are moved between the thread cache and the pool in batches.
+ *
+ * Blocks are securely cleared when deallocated, so that secrets do not
+ * outlive their allocation. Regions are never returned to the operating system.
+ */
+class locked_memory_pool {
+public:
+    /** The size of a region that is allocated from the operating system.
+     */
+    constexpr static std::size_t region_size = 256 * 1024;
+
+    constexpr static std::size_t min_block_size = 16;
+    constexpr static std::size_t num_size_classes = 9;
+
+    /** Blocks larger than this are allocated directly from the operating system.
+     */
+    constexpr static std::size_t max_block_size = min_block_size << (num_size_classes - 1);
+
+    /** The number of blocks that are moved between the thread cache and the pool at once.
+     */
+    constexpr static std::size_t batch_size = 16;
+
+    /** The maximum number of free blocks of a size class in a thread cache.
+     */
+    constexpr static std::size_t max_cached = batch_size * 2;
+
+    constexpr locked_memory_pool() noexcept = default;
+    locked_memory_pool(locked_memory_pool const&) = delete;
+    locked_memory_pool(locked_memory_pool&&) = delete;
+    locked_memory_pool& operator=(locked_memory_pool const&) = delete;
+    locked_memory_pool& operator=(locked_memory_pool&&) = delete;
+
+    [[nodiscard]] constexpr static std::size_t size_class(std::size_t n) noexcept
+    {
+        hi_axiom(n <= max_block_size);
+        auto const block_size_ = std::bit_ceil(std::max(n, min_block_size));
+        return narrow_cast<std::size_t>(std::countr_zero(block_size_) - std::countr_zero(min_block_size));
+    }
+
+    [[nodiscard]] constexpr static std::size_t block_size(std::size_t size_class) noexcept
+    {
+        hi_axiom(size_class < num_size_classes);
+        return min_block_size << size_class;
+    }
+
+    /** Allocate a block.
+     *
+     * @note It is safe to call this function from any thread.
+     * @param n The size in bytes.
+     * @return The block, aligned to its size class.
+     */
+    [[nodiscard]] std::byte *allocate(std::size_t n) noexcept
+    {
+        if (n > max_block_size) {
+            return locked_memory_allocator_allocate(n);
+        }
+
+        auto const size_class_ = size_class(n);
+        auto& list = local_cache().lists[size_class_];
+        if (list.head == nullptr) {
+            refill(size_class_, list);
+        }
+        return list.pop();
+    }
+
+    /** Securely clear and deallocate a block.
+     *
+     * @note It is safe to call this function from any thread, also from a
+     *       different thread than the one that allocated the block.
+     * @param p The block.
+     * @param n The size in bytes that was passed to `allocate()`.
+     */
+    void deallocate(std::byte *p, std::size_t n) noexcept
+    {
+        hi_assert_not_null(p);
+
+        if (n > max_block_size) {
+            secure_clear(p, n);
+            locked_memory_allocator_deallocate(p, n);
+            return;
+        }
+
+        auto const size_class_ = size_class(n);
+        secure_clear(p, block_size(size_class_));
+
+        auto& list = local_cache().lists[size_class_];
+        list.push(p);
+        if (list.count > max_cached) {
+            release(size_class_, list, batch_size);
+        }
+    }
+
+private:
+    /** A free block, the pointer to the next block is stored inside the block itself.
+     */
+    struct free_block {
+        free_block *next;
+    };
+
+    struct free_list {
+        free_block *head = nullptr;
+        std::size_t count = 0;
+
+        void push(std::byte *p) noexcept
+        {
+            head = new (p) free_block{head};
+            ++count;
+        }
+
+        [[nodiscard]] std::byte *pop() noexcept
+        {
+            hi_axiom_not_null(head);
+
+            auto *block = std::exchange(head, head->next);
+            // Blocks in the pool are cleared, also clear the link.
+            block->next = nullptr;
+            --count;
+            return reinterpret_cast<std::byte *>(block);
+        }
+    };
+
+    /** The free blocks cached by a thread.
+     *
+     * The blocks are returned to the pool when the thread exits.
+     */
+    struct thread_cache {
+        std::array<free_list, num_size_classes> lists = {};
+        locked_memory_pool *pool = nullptr;
+
+        ~thread_cache()
+        {
+            if (pool != nullptr) {
+                for (auto i = 0_uz; i != num_size_classes; ++i) {
+                    pool->release(i, lists[i], lists[i].count);
+                }
+            }
+        }
+    };
+
+    std::array<free_list, num_size_classes> _lists = {};
+
+    /** The part of the current region that is not yet divided into blocks.
+     */
+    std::byte *_region_ptr = nullptr;
+    std::byte *_region_end = nullptr;
+
+    mutable unfair_mutex _mutex;
+
+    [[nodiscard]] thread_cache& local_cache() noexcept
+    {
+        thread_local auto r = thread_cache{};
+
+        if (r.pool == nullptr) [[unlikely]] {
+            r.pool = this;
+        }
+        hi_axiom(r.pool == this, "Only a single locked_memory_pool may exist.");
+        return r;
+    }
+
+    /** Move a batch of free blocks from the pool into the thread cache.
+     */
+    hi_no_inline void refill(std::size_t size_class_, free_list& list) noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+
+        auto& pool_list = _lists[size_class_];
+        while (list.count != batch_size and pool_list.head != nullptr) {
+            list.push(pool_list.pop());
+        }
+
+        while (list.count != batch_size) {
+            list.push(carve(block_size(size_class_)));
+        }
+    }
+
+    /** Move free blocks from the thread cache back into the pool.
+     */
+    void release(std::size_t size_class_, free_list& list, std::size_t count) noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+
+        auto& pool_list = _lists[size_class_];
+        for (auto i = 0_uz; i != count; ++i) {
+            pool_list.push(list.pop());
+        }
+    }
+
+    /** Divide a new block from the current region.
+     *
+     * @note Must be called with `_mutex` locked.
+     * @param size The size of the block, the block is aligned to its size.
+     */
+    [[nodiscard]] std::byte *carve(std::size_t size) noexcept
+    {
+        hi_axiom(_mutex.is_locked());
+
+        auto const region_ptr = std::bit_cast<uintptr_t>(_region_ptr);
+        auto const region_end = std::bit_cast<uintptr_t>(_region_end);
+        auto const aligned_ptr = ceil(region_ptr, uintptr_t{size});
+
+        if (_region_ptr == nullptr or aligned_ptr + size > region_end) {
+            // The remainder of the current region is lost, memory is only recycled per size class.
+            _region_ptr = locked_memory_allocator_allocate(region_size);
+            _region_end = _region_ptr + region_size;
+            ++global_counter<"locked_memory_pool:region">;
+            return std::exchange(_region_ptr, _region_ptr + size);
+        }
+
+        auto *r = _region_ptr + (aligned_ptr - region_ptr);
+        _region_ptr = r + size;
+        return r;
+    }
+};
+
+inline locked_memory_pool locked_memory_pool_global;
+
+} // namespace detail
+
+[[nodiscard]] inline std::byte *locked_memory_pool_allocate(std::size_t n) noexcept
+{
+    return detail::locked_memory_pool_global.allocate(n);
+}
+
+inline void locked_memory_pool_deallocate(std::byte *p, std::size_t n) noexcept
+{
+    detail::locked_memory_pool_global.deallocate(p, n);
+}
+
+} // namespace hi::inline v1
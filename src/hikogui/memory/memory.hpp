@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "frame_arena.hpp" // export
 #include "locked_memory_allocator.hpp" // export
 #include "secure_memory_allocator.hpp" // export
 
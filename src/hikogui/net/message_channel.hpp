@@ -0,0 +1,220 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file net/message_channel.hpp Exchange BON8 messages over a socket stream.
+ */
+
+#pragma once
+
+#include "stream.hpp"
+#include "../codec/BON8.hpp"
+#include "../codec/BON8_view.hpp"
+#include "../codec/datum.hpp"
+#include "../container/container.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <chrono>
+#include <array>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.net.message_channel);
+
+hi_export namespace hi::inline v1 {
+
+#if HI_OPERATING_SYSTEM != HI_OS_WINDOWS
+
+/** A channel of BON8 encoded messages over a socket stream.
+ *
+ * Each message is send as a frame: a 32-bit little-endian length followed
+ * by the BON8 encoded message.
+ *
+ * Small messages are coalesced: frames are collected in a batch which is
+ * written to the stream when it is larger than the maximum batch size, or
+ * when the latency budget since the first message in the batch has expired.
+ * So that thousands of small messages result in a few large writes.
+ *
+ * Frames that have not been written to the stream are discarded when the
+ * channel is destroyed; use `co_await channel.flush()` first.
+ *
+ * Received frames are handed to the subscribers as a reference counted slice
+ * of the stream's packets, which may be decoded without copying using
+ * `decode_BON8_view()`, or into a `datum` with `decode_BON8()`.
+ *
+ * ```
+ * auto channel = hi::message_channel{stream};
+ * auto cbt = channel.subscribe([](hi::shared_bstring const& frame) {
+ *     auto const message = hi::decode_BON8_view(frame.view());
+ *     ...
+ * });
+ * co_await channel.send(message);
+ * ```
+ */
+class message_channel {
+public:
+    using notifier_type = notifier<void(shared_bstring)>;
+    using callback_type = notifier_type::callback_type;
+
+    /** The size of the length prefix of each frame.
+     */
+    constexpr static std::size_t header_size = sizeof(uint32_t);
+
+    ~message_channel()
+    {
+        // The receiver is destroyed while it waits on the stream.
+        _stream->cancel_read();
+    }
+
+    message_channel(message_channel const&) = delete;
+    message_channel(message_channel&&) = delete;
+    message_channel& operator=(message_channel const&) = delete;
+    message_channel& operator=(message_channel&&) = delete;
+
+    /** Create a message channel.
+     *
+     * The channel immediately starts receiving frames from the stream.
+     *
+     * @param stream The stream to send and receive messages on; must outlive the channel.
+     *               The channel is the only reader of the stream.
+     * @param latency_budget The maximum time a message is held back to coalesce it with others.
+     * @param max_batch_size The size of a batch at which it is written to the stream directly.
+     * @param max_frame_size The maximum size of a received message.
+     */
+    message_channel(
+        socket_stream& stream,
+        std::chrono::nanoseconds latency_budget = std::chrono::milliseconds(1),
+        std::size_t max_batch_size = 64 * 1024,
+        std::size_t max_frame_size = 16 * 1024 * 1024) :
+        _stream(&stream), _latency_budget(latency_budget), _max_batch_size(max_batch_size), _max_frame_size(max_frame_size)
+    {
+        _batch.reserve(max_batch_size);
+        _receiver = receive_loop();
+    }
+
+    /** Subscribe a function to be called with each received frame.
+     *
+     * @param func A function `void(shared_bstring)` called with the BON8 encoded message of each frame.
+     * @param flags The callback flags.
+     * @return A callback token, a RAII object which when destroyed removes the subscription.
+     */
+    template<forward_of<void(shared_bstring)> Func>
+    [[nodiscard]] callback_type subscribe(Func&& func, callback_flags flags = callback_flags::synchronous) noexcept
+    {
+        return _notifier.subscribe(std::forward<Func>(func), flags);
+    }
+
+    /** Check if the channel stopped receiving.
+     *
+     * This happens when the peer closed the stream, on a socket error or
+     * when a frame was larger than the maximum frame size.
+     */
+    [[nodiscard]] bool closed() const noexcept
+    {
+        return _receiver.done();
+    }
+
+    /** Send a message.
+     *
+     * The message is encoded directly into the current batch.
+     * `co_await channel.send(message)` suspends the caller while the stream
+     * is above its high watermark.
+     *
+     * @param message The message to send.
+     */
+    [[nodiscard]] socket_stream::write_awaiter send(datum const& message)
+    {
+        _encoder.add(message);
+        // Terminate a string at the end of the message, since the frame ends there.
+        _encoder.get();
+        _encoder.take([this](bstring_view bytes) {
+            auto const size = narrow_cast<uint32_t>(bytes.size());
+            auto header = std::array<std::byte, header_size>{};
+            for (auto i = 0_uz; i != header_size; ++i) {
+                header[i] = static_cast<std::byte>(size >> (i * 8));
+            }
+            _batch.append(header.data(), header.size());
+            _batch.append(bytes);
+        });
+
+        if (_batch.size() >= _max_batch_size or _latency_budget == std::chrono::nanoseconds::zero()) {
+            flush_batch();
+        } else if (not _timer) {
+            _timer = loop::local().delay_function(std::chrono::utc_clock::now() + _latency_budget, [this] {
+                try {
+                    flush_batch();
+                } catch (io_error const&) {
+                    // The error is thrown again from the next send() or flush().
+                }
+            });
+        }
+
+        return _stream->write({});
+    }
+
+    /** Write the current batch and wait until it has been send to the socket.
+     */
+    [[nodiscard]] socket_stream::write_awaiter flush()
+    {
+        flush_batch();
+        return _stream->flush();
+    }
+
+private:
+    socket_stream *_stream;
+    std::chrono::nanoseconds _latency_budget;
+    std::size_t _max_batch_size;
+    std::size_t _max_frame_size;
+
+    detail::BON8_encoder _encoder;
+
+    /** The frames that have not been written to the stream.
+     */
+    bstring _batch;
+
+    /** The timer that writes the batch when the latency budget expires.
+     */
+    callback<void()> _timer;
+
+    notifier_type _notifier;
+    scoped_task<> _receiver;
+
+    void flush_batch()
+    {
+        _timer = {};
+        if (not _batch.empty()) {
+            _stream->post(_batch);
+            _batch.clear();
+        }
+    }
+
+    scoped_task<> receive_loop()
+    {
+        while (true) {
+            auto const header = co_await _stream->read_slice(header_size);
+            if (header.empty()) {
+                co_return;
+            }
+
+            auto size = 0_uz;
+            for (auto i = 0_uz; i != header_size; ++i) {
+                size |= static_cast<std::size_t>(header[i]) << (i * 8);
+            }
+            if (size == 0 or size > _max_frame_size) {
+                co_return;
+            }
+
+            auto frame = co_await _stream->read_slice(size);
+            if (frame.empty()) {
+                co_return;
+            }
+            _notifier(std::move(frame));
+        }
+    }
+};
+
+#endif
+
+} // namespace hi::inline v1
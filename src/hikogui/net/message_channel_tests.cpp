@@ -0,0 +1,116 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../macros.hpp"
+#if HI_OPERATING_SYSTEM == HI_OS_LINUX
+#include "message_channel.hpp"
+#include <hikotest/hikotest.hpp>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <array>
+#include <vector>
+#include <string>
+#include <chrono>
+
+TEST_SUITE(message_channel) {
+
+static hi::scoped_task<> produce(hi::message_channel& channel, long long num_messages)
+{
+    for (auto i = 0LL; i != num_messages; ++i) {
+        co_await channel.send(hi::datum{i});
+    }
+    co_await channel.flush();
+}
+
+TEST_CASE(many_small_messages)
+{
+    using namespace std::literals;
+
+    auto pair = std::array<int, 2>{};
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, pair.data()) == 0);
+
+    {
+        auto writer_stream = hi::socket_stream{pair[0]};
+        auto reader_stream = hi::socket_stream{pair[1]};
+        auto writer = hi::message_channel{writer_stream, 1s};
+        auto reader = hi::message_channel{reader_stream};
+
+        auto received = std::vector<long long>{};
+        auto const cbt = reader.subscribe([&](hi::shared_bstring const& frame) {
+            auto const message = hi::decode_BON8_view(frame.view());
+            received.push_back(message.get_integer());
+        });
+
+        auto const produced = produce(writer, 10000);
+        while (not produced.done() or received.size() != 10000) {
+            hi::loop::local().resume_once(true);
+        }
+
+        for (auto i = 0uz; i != received.size(); ++i) {
+            REQUIRE(received[i] == static_cast<long long>(i));
+        }
+    }
+
+    ::close(pair[0]);
+    ::close(pair[1]);
+}
+
+TEST_CASE(coalesce_within_latency_budget)
+{
+    using namespace std::literals;
+
+    auto pair = std::array<int, 2>{};
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, pair.data()) == 0);
+
+    {
+        auto writer_stream = hi::socket_stream{pair[0]};
+        auto reader_stream = hi::socket_stream{pair[1]};
+        auto writer = hi::message_channel{writer_stream, 10ms};
+        auto reader = hi::message_channel{reader_stream};
+
+        auto received = std::vector<std::string>{};
+        auto const cbt = reader.subscribe([&](hi::shared_bstring const& frame) {
+            received.emplace_back(hi::decode_BON8_view(frame.view()).string());
+        });
+
+        // The messages are held back until the latency budget expires.
+        std::ignore = writer.send(hi::datum{"hello"});
+        std::ignore = writer.send(hi::datum{"world"});
+        REQUIRE(reader_stream.num_read_bytes() == 0);
+
+        while (received.size() != 2) {
+            hi::loop::local().resume_once(true);
+        }
+        REQUIRE(received[0] == "hello");
+        REQUIRE(received[1] == "world");
+    }
+
+    ::close(pair[0]);
+    ::close(pair[1]);
+}
+
+TEST_CASE(close_on_oversized_frame)
+{
+    auto pair = std::array<int, 2>{};
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, pair.data()) == 0);
+
+    {
+        auto reader_stream = hi::socket_stream{pair[1]};
+        auto reader = hi::message_channel{reader_stream, std::chrono::milliseconds(1), 64 * 1024, 100};
+
+        auto const header = std::array<unsigned char, 4>{0x00, 0x10, 0x00, 0x00};
+        REQUIRE(::write(pair[0], header.data(), header.size()) == 4);
+        while (not reader.closed()) {
+            hi::loop::local().resume_once(true);
+        }
+        REQUIRE(reader.closed());
+    }
+
+    ::close(pair[0]);
+    ::close(pair[1]);
+}
+
+};
+
+#endif
@@ -0,0 +1,215 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "stream.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <span>
+#include <array>
+#include <list>
+#include <format>
+#include <cstddef>
+#include <cstdint>
+#include <cerrno>
+#if HI_OPERATING_SYSTEM != HI_OS_WINDOWS
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+hi_export_module(hikogui.net.metrics_server);
+
+hi_export namespace hi::inline v1 {
+
+#if HI_OPERATING_SYSTEM != HI_OS_WINDOWS
+
+/** A HTTP server which exports the global counters in the OpenMetrics format.
+ *
+ * The server listens on the loopback interface only, so that a Prometheus
+ * agent or `curl` running on the same machine can scrape the counters of a
+ * running application:
+ *
+ * ```
+ * auto server = hi::metrics_server{};
+ * // $ curl http://127.0.0.1:9464/metrics
+ * ```
+ *
+ * Connections are handled by co-routines on the loop of the thread that
+ * created the server. Each connection serves a single request, after which
+ * the server closes the connection.
+ *
+ * @note Not available on Windows, see `socket_stream`.
+ */
+class metrics_server {
+public:
+    /** The port assigned to OpenMetrics exporters.
+     */
+    constexpr static uint16_t default_port = 9464;
+
+    /** The maximum size of the header of a request.
+     */
+    constexpr static std::size_t max_request_size = 8192;
+
+    ~metrics_server()
+    {
+        _connections.clear();
+        loop::local().remove_socket(_fd);
+        ::close(_fd);
+    }
+
+    metrics_server(metrics_server const&) = delete;
+    metrics_server(metrics_server&&) = delete;
+    metrics_server& operator=(metrics_server const&) = delete;
+    metrics_server& operator=(metrics_server&&) = delete;
+
+    /** Start the server.
+     *
+     * @param port The TCP port to listen on, or zero to let the operating system select a free port.
+     * @throws io_error When the server could not listen on the port.
+     */
+    metrics_server(uint16_t port = default_port)
+    {
+        _fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (_fd == -1) {
+            throw io_error(std::format("Could not create metrics socket. '{}'", get_last_error_message()));
+        }
+
+        auto const reuse = 1;
+        ::setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        auto address = sockaddr_in{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        auto address_size = socklen_t{sizeof(address)};
+
+        if (::bind(_fd, reinterpret_cast<sockaddr *>(&address), address_size) != 0 or ::listen(_fd, SOMAXCONN) != 0 or
+            not set_non_blocking(_fd) or ::getsockname(_fd, reinterpret_cast<sockaddr *>(&address), &address_size) != 0) {
+            auto const message = get_last_error_message();
+            ::close(_fd);
+            throw io_error(std::format("Could not listen for metrics on 127.0.0.1:{}. '{}'", port, message));
+        }
+        _port = ntohs(address.sin_port);
+
+        loop::local().add_socket(_fd, socket_event::read, [this](int, socket_events const&) {
+            accept_connections();
+        });
+        hi_log_info("Serving metrics on http://127.0.0.1:{}/metrics", _port);
+    }
+
+    /** The TCP port the server listens on.
+     */
+    [[nodiscard]] uint16_t port() const noexcept
+    {
+        return _port;
+    }
+
+private:
+    /** Closes the socket, after the stream and the task that use it are destroyed.
+     */
+    struct socket_owner {
+        int fd;
+
+        ~socket_owner()
+        {
+            ::close(fd);
+        }
+    };
+
+    struct connection_type {
+        socket_owner socket;
+        socket_stream stream;
+        scoped_task<> task;
+
+        connection_type(int fd) : socket{fd}, stream(fd), task(serve(stream)) {}
+    };
+
+    int _fd = -1;
+    uint16_t _port = 0;
+    std::list<connection_type> _connections = {};
+
+    [[nodiscard]] static std::string make_response(std::string_view request)
+    {
+        if (request.starts_with("GET /metrics ") or request.starts_with("GET /metrics?")) {
+            auto const body = format_openmetrics();
+            return std::format(
+                "HTTP/1.1 200 OK\r\nContent-Type: {}\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}",
+                openmetrics_content_type,
+                body.size(),
+                body);
+        } else {
+            return std::string{"HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n"};
+        }
+    }
+
+    static scoped_task<> serve(socket_stream& stream)
+    {
+        try {
+            auto request = std::string{};
+            auto buffer = std::array<std::byte, 1024>{};
+            while (not request.contains("\r\n\r\n")) {
+                if (request.size() > max_request_size) {
+                    co_return;
+                }
+
+                auto const size = co_await stream.read(buffer);
+                if (size == 0) {
+                    co_return;
+                }
+                request.append(reinterpret_cast<char const *>(buffer.data()), size);
+            }
+
+            auto const response = make_response(request);
+            co_await stream.write(std::as_bytes(std::span{response}));
+            co_await stream.flush();
+
+            ::shutdown(stream.fd(), SHUT_WR);
+        } catch (io_error const& e) {
+            hi_log_info("Metrics connection failed. {}", e.what());
+        }
+    }
+
+    [[nodiscard]] static bool set_non_blocking(int fd) noexcept
+    {
+        auto const flags = ::fcntl(fd, F_GETFL);
+        return flags != -1 and ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1;
+    }
+
+    void accept_connections()
+    {
+        _connections.remove_if([](auto const& connection) {
+            return connection.task.done();
+        });
+
+        while (true) {
+            auto const fd = ::accept(_fd, nullptr, nullptr);
+            if (fd == -1) {
+                if (errno == EINTR) {
+                    continue;
+                } else if (errno != EAGAIN and errno != EWOULDBLOCK) {
+                    hi_log_error("Could not accept metrics connection. '{}'", get_last_error_message());
+                }
+                return;
+            }
+
+            if (not set_non_blocking(fd)) {
+                ::close(fd);
+                continue;
+            }
+            _connections.emplace_back(fd);
+        }
+    }
+};
+
+#endif
+
+} // namespace hi::inline v1
@@ -0,0 +1,93 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../macros.hpp"
+#if HI_OPERATING_SYSTEM == HI_OS_LINUX
+#include "metrics_server.hpp"
+#include <hikotest/hikotest.hpp>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <array>
+#include <string>
+#include <string_view>
+#include <span>
+
+TEST_SUITE(metrics_server_suite) {
+
+[[nodiscard]] static int connect_to(uint16_t port)
+{
+    auto const fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    auto address = sockaddr_in{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+static hi::scoped_task<std::string> request(hi::socket_stream& stream, std::string_view text)
+{
+    co_await stream.write(std::as_bytes(std::span{text}));
+    co_await stream.flush();
+
+    auto r = std::string{};
+    auto buffer = std::array<std::byte, 1024>{};
+    while (auto const size = co_await stream.read(buffer)) {
+        r.append(reinterpret_cast<char const *>(buffer.data()), size);
+    }
+    co_return r;
+}
+
+[[nodiscard]] static std::string get(uint16_t port, std::string_view text)
+{
+    auto const fd = connect_to(port);
+    if (fd == -1) {
+        return {};
+    }
+
+    auto r = std::string{};
+    {
+        auto stream = hi::socket_stream{fd};
+        auto const response = request(stream, text);
+        while (not response.done()) {
+            hi::loop::local().resume_once(true);
+        }
+        r = response.value();
+    }
+    ::close(fd);
+    return r;
+}
+
+TEST_CASE(metrics_test)
+{
+    ++hi::global_counter<"metrics_server_tests:request">;
+
+    auto server = hi::metrics_server{0};
+    REQUIRE(server.port() != 0);
+
+    auto const response = get(server.port(), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    REQUIRE(response.starts_with("HTTP/1.1 200 OK\r\n"));
+    REQUIRE(response.contains("Content-Type: application/openmetrics-text"));
+    REQUIRE(response.contains("hi_metrics_server_tests_request 1\n"));
+    REQUIRE(response.ends_with("# EOF\n"));
+}
+
+TEST_CASE(not_found_test)
+{
+    auto server = hi::metrics_server{0};
+
+    auto const response = get(server.port(), "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    REQUIRE(response.starts_with("HTTP/1.1 404 Not Found\r\n"));
+}
+
+};
+
+#endif
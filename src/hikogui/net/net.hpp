@@ -1,8 +1,10 @@
 
 #pragma once
 
+#include "message_channel.hpp" // export
+#include "metrics_server.hpp" // export
 #include "packet.hpp" // export
-//#include "packet_buffer.hpp"
-//#include "stream.hpp"
+#include "packet_buffer.hpp" // export
+#include "stream.hpp" // export
 
 hi_export_module(hikogui.net);
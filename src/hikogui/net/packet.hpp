@@ -6,16 +6,95 @@
 
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <span>
 #include <cstddef>
 
 hi_export_module(hikogui.net.packet);
 
 hi_export namespace hi::inline v1 {
 
+/** A pool of fixed-size buffers for packets.
+ *
+ * Network buffers are allocated and released at a high rate; the pool
+ * keeps released buffers around so that they can be reused without going
+ * through the heap. The pool is thread-safe, so that a packet may be
+ * filled by a network thread and released by a parser on another thread.
+ */
+class packet_pool {
+public:
+    /** The size of each buffer in the pool.
+     */
+    constexpr static std::size_t chunk_size = 16384;
+
+    /** The maximum number of released buffers that are kept for reuse.
+     */
+    constexpr static std::size_t max_num_free = 256;
+
+    packet_pool()
+    {
+        _free.reserve(max_num_free);
+    }
+
+    packet_pool(packet_pool const&) = delete;
+    packet_pool(packet_pool&&) = delete;
+    packet_pool& operator=(packet_pool const&) = delete;
+    packet_pool& operator=(packet_pool&&) = delete;
+
+    /** Get a buffer of `chunk_size` bytes.
+     */
+    [[nodiscard]] std::unique_ptr<std::byte[]> allocate()
+    {
+        {
+            auto const lock = std::scoped_lock(_mutex);
+            if (not _free.empty()) {
+                auto r = std::move(_free.back());
+                _free.pop_back();
+                return r;
+            }
+        }
+        return std::make_unique_for_overwrite<std::byte[]>(chunk_size);
+    }
+
+    /** Return a buffer that was returned by `allocate()`.
+     */
+    void deallocate(std::unique_ptr<std::byte[]> buffer) noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        if (_free.size() < max_num_free) {
+            // Does not allocate, since the capacity is reserved up front.
+            _free.push_back(std::move(buffer));
+        }
+    }
+
+    /** The number of buffers available for reuse.
+     */
+    [[nodiscard]] std::size_t num_free() const noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        return _free.size();
+    }
+
+    [[nodiscard]] static packet_pool& global() noexcept
+    {
+        static auto r = packet_pool{};
+        return r;
+    }
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<std::unique_ptr<std::byte[]>> _free;
+};
+
 /** A network message or stream buffer.
+ *
+ * Packets up to `packet_pool::chunk_size` bytes use a buffer from the
+ * global packet pool, which is returned to the pool when the packet is destroyed.
  */
 class packet {
-    std::byte *data;
+    std::unique_ptr<std::byte[]> data;
     std::byte *data_end;
     std::byte *first;
     std::byte *last;
@@ -23,28 +102,40 @@ class packet {
 
 public:
     /** Allocate an empty packet of a certain size.
+     *
+     * @param nrBytes The minimum number of bytes that can be written into
+     *                the packet. Small packets are rounded up to the chunk size.
      */
-    packet(ptrdiff_t nrBytes) noexcept
+    packet(std::size_t nrBytes)
     {
-        data = new std::byte[nrBytes];
-        data_end = data + nrBytes;
-        first = data;
-        last = data;
+        if (nrBytes <= packet_pool::chunk_size) {
+            data = packet_pool::global().allocate();
+            nrBytes = packet_pool::chunk_size;
+        } else {
+            data = std::make_unique_for_overwrite<std::byte[]>(nrBytes);
+        }
+        data_end = data.get() + nrBytes;
+        first = data.get();
+        last = data.get();
     }
 
     ~packet() noexcept
     {
-        delete[] data;
+        if (data and capacity() == packet_pool::chunk_size) {
+            packet_pool::global().deallocate(std::move(data));
+        }
     }
 
     packet(packet const &rhs) noexcept = delete;
-    packet operator=(packet const &rhs) noexcept = delete;
+    packet &operator=(packet const &rhs) noexcept = delete;
 
-    packet(packet &&rhs) noexcept : data(rhs.data), data_end(rhs.data_end), first(rhs.first), last(rhs.last)
+    packet(packet &&rhs) noexcept :
+        data(std::move(rhs.data)), data_end(rhs.data_end), first(rhs.first), last(rhs.last), _pushed(rhs._pushed)
     {
-        rhs.data = nullptr;
     }
 
+    packet &operator=(packet &&rhs) noexcept = delete;
+
     [[nodiscard]] std::byte *begin() noexcept
     {
         return first;
@@ -55,18 +146,49 @@ public:
         return last;
     }
 
+    [[nodiscard]] std::byte const *begin() const noexcept
+    {
+        return first;
+    }
+
+    [[nodiscard]] std::byte const *end() const noexcept
+    {
+        return last;
+    }
+
+    /** The total number of bytes of the buffer.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return static_cast<std::size_t>(data_end - data.get());
+    }
+
     /** How many bytes can be read from this buffer.
      */
-    [[nodiscard]] ptrdiff_t readSize() const noexcept
+    [[nodiscard]] std::size_t readSize() const noexcept
     {
-        return last - first;
+        return static_cast<std::size_t>(last - first);
     }
 
     /** How many bytes can still be written to this buffer.
      */
-    [[nodiscard]] ptrdiff_t writeSize() const noexcept
+    [[nodiscard]] std::size_t writeSize() const noexcept
+    {
+        return static_cast<std::size_t>(data_end - last);
+    }
+
+    /** The bytes that can be read from this buffer.
+     */
+    [[nodiscard]] std::span<std::byte const> readSpan() const noexcept
+    {
+        return {first, last};
+    }
+
+    /** The bytes that can still be written to this buffer.
+     */
+    [[nodiscard]] std::span<std::byte> writeSpan() noexcept
     {
-        return data_end - last;
+        return {last, data_end};
     }
 
     /** Should this packet be pushed onto the network.
@@ -86,19 +208,19 @@ public:
     /** Commit a write.
      * Should be called after data has been copied into this buffer.
      */
-    void write(ptrdiff_t nrBytes) noexcept
+    void write(std::size_t nrBytes) noexcept
     {
+        hi_assert(nrBytes <= writeSize());
         last += nrBytes;
-        hi_assert(last <= data_end);
     }
 
     /** Consume a read.
      * Should be called after data has been copied from this buffer.
      */
-    void read(ptrdiff_t nrBytes) noexcept
+    void read(std::size_t nrBytes) noexcept
     {
+        hi_assert(nrBytes <= readSize());
         first += nrBytes;
-        hi_assert(first <= last);
     }
 };
 
@@ -4,16 +4,32 @@
 
 #pragma once
 
+#include "packet.hpp"
+#include "../container/container.hpp"
+#include "../utility/utility.hpp"
 #include "../macros.hpp"
+#include <deque>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
 
 hi_export_module(hikogui.net.packet_buffer);
 
 hi_export namespace hi::inline v1 {
 
+/** A buffer of data read from, or to be written to, a socket.
+ *
+ * The data is stored in a queue of packets, each using a pooled
+ * fixed-size buffer. The packets are reference counted, so that slices
+ * of the data can be handed to a parser without copying; see `peek_slice()`.
+ */
 class packet_buffer {
-    std::list<packet> packets;
-    ssize_t _totalNrBytes;
-    bool _closed;
+    std::deque<std::shared_ptr<packet>> packets;
+    std::size_t _totalNrBytes = 0;
+    bool _closed = false;
 
 public:
     /** Connection is closed.
@@ -26,7 +42,7 @@ public:
 
     /** Total number of bytes in the buffer.
      */
-    ssize_t nrBytes() const noexcept
+    std::size_t nrBytes() const noexcept
     {
         return _totalNrBytes;
     }
@@ -36,7 +52,7 @@ public:
      * On a stream based socket this number is not useful, but larger
      * than zero when data is available.
      */
-    ssize_t nrpackets() const noexcept
+    std::size_t nrpackets() const noexcept
     {
         return packets.size();
     }
@@ -51,23 +67,26 @@ public:
     /** Get a new packet to write a message into.
      * @return a pointer to an byte array with at least nrBytes of data available.
      */
-    std::span<std::byte> getNewpacket(ssize_t nrBytes) noexcept
+    std::span<std::byte> getNewpacket(std::size_t nrBytes)
     {
-        hi_assert(!closed());
-        packets.emplace_back(nrBytes);
-        return {packets.back().end(), nrBytes};
+        hi_assert(not closed());
+        packets.push_back(std::make_shared<packet>(nrBytes));
+        return {packets.back()->end(), nrBytes};
     }
 
     /** Get a packet to write a stream of bytes into.
+     *
+     * The last packet is reused when it has enough space left.
+     *
      * @return a pointer to an byte array with at least nrBytes of data available.
      */
-    std::span<std::byte> getpacket(ssize_t nrBytes) noexcept
+    std::span<std::byte> getpacket(std::size_t nrBytes)
     {
-        hi_assert(!closed());
-        if (packets.empty() || (packets.back().writeSize() < nrBytes)) {
-            packets.emplace_back(nrBytes);
+        hi_assert(not closed());
+        if (packets.empty() or packets.back()->writeSize() < nrBytes) {
+            packets.push_back(std::make_shared<packet>(nrBytes));
         }
-        return {packets.back().end(), nrBytes};
+        return {packets.back()->end(), nrBytes};
     }
 
     /** Write the data added to the packet.
@@ -77,38 +96,68 @@ public:
      * @param nrBytes The number of bytes written into the packet.
      * @param push Push the data through the socket, bypass Nagel algorithm.
      */
-    void write(ssize_t nrBytes, bool push = true) noexcept
+    void write(std::size_t nrBytes, bool push = true) noexcept
     {
-        hi_assert(!closed());
-        packets.back().write(nrBytes);
+        hi_assert(not closed());
+        hi_assert(not packets.empty());
+        packets.back()->write(nrBytes);
         if (push) {
-            packets.back().push();
+            packets.back()->push();
         }
         _totalNrBytes += nrBytes;
     }
 
+    /** Copy bytes into the buffer.
+     *
+     * @param bytes The bytes to append.
+     * @param push Push the data through the socket, bypass Nagel algorithm.
+     */
+    void write(std::span<std::byte const> bytes, bool push = true)
+    {
+        while (not bytes.empty()) {
+            auto const size = std::min(bytes.size(), packet_pool::chunk_size);
+            auto dst = getpacket(size);
+            std::memcpy(dst.data(), bytes.data(), size);
+            write(size, push and size == bytes.size());
+            bytes = bytes.subspan(size);
+        }
+    }
+
     /** Peek into the data without consuming.
+     *
+     * When the data is spread over multiple packets the first @a nrBytes
+     * are copied into a single packet, so that they become contiguous.
+     *
      * @param nrBytes the minimum amount of data required.
      * @return empty if not enough bytes available; otherwise the data.
      *         The returned size may be larger than requested and
      *         this data may be consumed using `read()`.
      */
-    std::span<std::byte const> peek(ssize_t nrBytes)
+    std::span<std::byte const> peek(std::size_t nrBytes)
     {
-        if (packets.empty() || size() < nrBytes) {
+        if (packets.empty() or nrBytes == 0 or nrBytes > _totalNrBytes) {
             return {};
         }
 
-        while (true) {
-            if (packets.front().readSize() >= nrBytes) {
-                return {packets.front().readSize(), ssize(packets)};
-            }
-
-            // Check if we can merge packets.
-            hi_assert(packets.front().size() >= nrBytes);
+        make_contiguous(nrBytes);
+        return packets.front()->readSpan();
+    }
 
-            // Merge data from next packet.
+    /** Peek into the data without consuming, as a reference counted slice.
+     *
+     * The slice keeps the packet alive after it has been consumed with
+     * `read()`, so that a parser may keep referring to it without a copy.
+     *
+     * @param nrBytes The number of bytes in the slice.
+     * @return empty if not enough bytes available; otherwise exactly @a nrBytes of data.
+     */
+    shared_bstring peek_slice(std::size_t nrBytes)
+    {
+        auto const bytes = peek(nrBytes);
+        if (bytes.empty()) {
+            return {};
         }
+        return {packets.front(), bstring_view{bytes.data(), nrBytes}};
     }
 
     /** Peek into the data a single text-line without consuming.
@@ -118,32 +167,44 @@ public:
      * @return empty if there are no lines; otherwise a line of data.
      *         The line-feed or nul is included at the end of the string.
      */
-    std::string_view peekLine(ssize_t nrBytes = 1024)
+    std::string_view peekLine(std::size_t nrBytes = 1024)
     {
-        ssize_t packetNr = 0;
-        ssize_t byteNr = 0;
-        ssize_t i = 0;
-        while (packetNr < nrpackets()) {
-            hi_check(byteNr < nrBytes, "New-line not found within {} bytes", nrBytes);
-
-            if (i == ssize(packets[packetNr])) {
-                // Advance to next packet.
-                ++packetNr;
-                i = 0;
-            }
+        auto byteNr = 0_uz;
+        for (auto const& p : packets) {
+            for (auto const c : p->readSpan()) {
+                hi_check(byteNr < nrBytes, "New-line not found within {} bytes", nrBytes);
 
-            auto const c = packets[packetNr][i] if (c == '\n' || c == '\0')
-            {
-                // Found end-of-line
-                auto const bspan = peek(byteNr + 1);
-                return {reinterpret_cast<char *>(bspan.data()), byteNr + 1};
+                ++byteNr;
+                if (c == std::byte{'\n'} or c == std::byte{'\0'}) {
+                    // Found end-of-line
+                    auto const bspan = peek(byteNr);
+                    return {reinterpret_cast<char const *>(bspan.data()), byteNr};
+                }
             }
-            ++i;
-            ++byteNr;
         }
 
         // Not enough bytes read yet.
-        return {}
+        return {};
+    }
+
+    /** Get the readable data as a list of spans, without consuming.
+     *
+     * This is used for a gather-write to a socket, like `writev()` or `WSASend()`,
+     * straight from the packets; followed by a `read()` of the number of bytes
+     * the socket accepted.
+     *
+     * @param[out] r The spans to fill in.
+     * @return The number of spans that were filled in.
+     */
+    std::size_t gather(std::span<std::span<std::byte const>> r) const noexcept
+    {
+        auto i = 0_uz;
+        for (auto it = packets.begin(); it != packets.end() and i != r.size(); ++it) {
+            if ((*it)->readSize() != 0) {
+                r[i++] = (*it)->readSpan();
+            }
+        }
+        return i;
     }
 
     /** Consume the data from the buffer.
@@ -152,20 +213,55 @@ public:
      *
      * @param nrBytes The number of bytes to consume.
      */
-    void read(ssize_t nrBytes) noexcept
+    void read(std::size_t nrBytes) noexcept
     {
-        peekBuffer.clear();
+        hi_assert(nrBytes <= _totalNrBytes);
+        _totalNrBytes -= nrBytes;
 
-        while (nrBytes) {
-            auto const packet_size = ssize(packets.front());
+        while (nrBytes != 0) {
+            hi_assert(not packets.empty());
+            auto& front = *packets.front();
+            auto const packet_size = front.readSize();
             if (nrBytes >= packet_size) {
                 packets.pop_front();
+                nrBytes -= packet_size;
             } else {
-                packets.front().read(nrBytes);
-                hi_assert(ssize(packets.front()) > 0);
+                front.read(nrBytes);
+                nrBytes = 0;
+            }
+        }
+    }
+
+private:
+    /** Make sure the first packet contains @a nrBytes of data.
+     *
+     * @pre `nrBytes <= this->nrBytes()`
+     */
+    void make_contiguous(std::size_t nrBytes)
+    {
+        // Skip the packets that were allocated for a write that did not happen.
+        while (packets.front()->readSize() == 0) {
+            packets.pop_front();
+        }
+
+        if (packets.front()->readSize() >= nrBytes) {
+            return;
+        }
+
+        // Merge the data from the first packets into a new packet. The old
+        // packets are released, but stay alive for slices that refer to them.
+        auto merged = std::make_shared<packet>(nrBytes);
+        while (merged->readSize() < nrBytes) {
+            auto& front = *packets.front();
+            auto const size = std::min(front.readSize(), merged->writeSize());
+            std::memcpy(merged->end(), front.begin(), size);
+            merged->write(size);
+            front.read(size);
+            if (front.readSize() == 0) {
+                packets.pop_front();
             }
-            nrBytes -= ssize(packets_size);
         }
+        packets.push_front(std::move(merged));
     }
 };
 
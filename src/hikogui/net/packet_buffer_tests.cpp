@@ -0,0 +1,116 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "packet_buffer.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <array>
+#include <span>
+#include <string_view>
+#include <cstddef>
+
+TEST_SUITE(packet_buffer) {
+
+[[nodiscard]] static std::vector<std::byte> make_bytes(std::size_t size)
+{
+    auto r = std::vector<std::byte>(size);
+    for (auto i = 0uz; i != size; ++i) {
+        r[i] = static_cast<std::byte>(i * 7);
+    }
+    return r;
+}
+
+TEST_CASE(write_read)
+{
+    auto buffer = hi::packet_buffer{};
+    auto const bytes = make_bytes(100);
+    buffer.write(bytes);
+    REQUIRE(buffer.nrBytes() == 100);
+    REQUIRE(buffer.nrpackets() == 1);
+
+    auto const data = buffer.peek(10);
+    REQUIRE(data.size() == 100);
+    REQUIRE(data[42] == bytes[42]);
+
+    buffer.read(60);
+    REQUIRE(buffer.nrBytes() == 40);
+    REQUIRE(buffer.peek(40)[0] == bytes[60]);
+    REQUIRE(buffer.peek(41).empty());
+}
+
+TEST_CASE(peek_across_packets)
+{
+    auto buffer = hi::packet_buffer{};
+    auto const bytes = make_bytes(3 * hi::packet_pool::chunk_size);
+    buffer.write(bytes);
+    REQUIRE(buffer.nrpackets() == 3);
+
+    buffer.read(100);
+    auto const data = buffer.peek(hi::packet_pool::chunk_size);
+    REQUIRE(data.size() >= hi::packet_pool::chunk_size);
+    for (auto i = 0uz; i != data.size(); ++i) {
+        REQUIRE(data[i] == bytes[100 + i]);
+    }
+    REQUIRE(buffer.nrBytes() == bytes.size() - 100);
+}
+
+TEST_CASE(slice_outlives_read)
+{
+    auto buffer = hi::packet_buffer{};
+    auto const bytes = make_bytes(200);
+    buffer.write(bytes);
+
+    auto const slice = buffer.peek_slice(50);
+    REQUIRE(slice.size() == 50);
+    buffer.read(200);
+    REQUIRE(buffer.nrpackets() == 0);
+
+    REQUIRE(slice.use_count() == 1);
+    REQUIRE(slice[49] == bytes[49]);
+}
+
+TEST_CASE(peek_line)
+{
+    auto buffer = hi::packet_buffer{};
+    auto const text = std::string_view{"hello\nworld"};
+    buffer.write(std::as_bytes(std::span{text}));
+
+    REQUIRE(buffer.peekLine() == "hello\n");
+    buffer.read(6);
+    REQUIRE(buffer.peekLine().empty());
+}
+
+TEST_CASE(gather)
+{
+    auto buffer = hi::packet_buffer{};
+    auto const bytes = make_bytes(2 * hi::packet_pool::chunk_size + 10);
+    buffer.write(bytes);
+
+    auto spans = std::array<std::span<std::byte const>, 8>{};
+    auto const num_spans = buffer.gather(spans);
+    REQUIRE(num_spans == 3);
+
+    auto total = 0uz;
+    for (auto i = 0uz; i != num_spans; ++i) {
+        REQUIRE(spans[i][0] == bytes[total]);
+        total += spans[i].size();
+    }
+    REQUIRE(total == bytes.size());
+}
+
+TEST_CASE(pool_reuse)
+{
+    auto const* first = static_cast<std::byte const *>(nullptr);
+    {
+        auto buffer = hi::packet_buffer{};
+        buffer.write(make_bytes(10));
+        first = buffer.peek(10).data();
+    }
+
+    auto buffer = hi::packet_buffer{};
+    buffer.write(make_bytes(10));
+    REQUIRE(buffer.peek(10).data() == first);
+}
+
+};
@@ -4,46 +4,475 @@
 
 #pragma once
 
+#include "packet_buffer.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../utility/utility.hpp"
 #include "../macros.hpp"
+#include <coroutine>
+#include <span>
+#include <array>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <cerrno>
+#if HI_OPERATING_SYSTEM != HI_OS_WINDOWS
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
 
 hi_export_module(hikogui.net.stream);
 
 hi_export namespace hi::inline v1 {
 
-class Socketstream {
-protected:
-    bool connecting = false;
+#if HI_OPERATING_SYSTEM != HI_OS_WINDOWS
+// XXX loop_win32::add_socket() is not implemented, so socket_stream is not available on Windows.
 
-    /** Buffer with data read from the socket.
+/** An asynchronous byte-stream over a non-blocking socket.
+ *
+ * The stream is used from a co-routine on the loop of the thread that
+ * created it:
+ *
+ * ```
+ * hi::task<> send_file(hi::socket_stream& stream, std::span<std::byte const> payload)
+ * {
+ *     co_await stream.write(payload);
+ *     co_await stream.flush();
+ * }
+ * ```
+ *
+ * Writes are buffered. When the write buffer grows beyond the high watermark
+ * the writer is suspended until the socket has drained the buffer to the
+ * low watermark; so a slow peer slows down the producer instead of the
+ * buffer growing without bound. In the same way the stream stops reading
+ * from the socket when the read buffer is above the high watermark.
+ *
+ * Only a single co-routine may wait on a read, and a single co-routine
+ * may wait on a write or flush, at a time.
+ *
+ * @note The socket is owned by the caller, and must outlive the stream.
+ */
+class socket_stream {
+public:
+    class read_awaiter {
+    public:
+        read_awaiter(socket_stream& stream, std::span<std::byte> buffer) noexcept : _stream(&stream), _buffer(buffer) {}
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return _stream->_read_buffer.nrBytes() != 0 or _stream->_read_closed or _stream->_error != 0;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            _stream->suspend_reader(handle, 1);
+        }
+
+        /** Get the data that was read.
+         *
+         * @return The number of bytes copied into the buffer, zero when the peer closed the stream.
+         * @throws io_error On a socket error.
+         */
+        std::size_t await_resume()
+        {
+            return _stream->read_some(_buffer);
+        }
+
+    private:
+        socket_stream *_stream;
+        std::span<std::byte> _buffer;
+    };
+
+    class read_slice_awaiter {
+    public:
+        read_slice_awaiter(socket_stream& stream, std::size_t size) noexcept : _stream(&stream), _size(size) {}
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return _stream->_read_buffer.nrBytes() >= _size or _stream->_read_closed or _stream->_error != 0;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            _stream->suspend_reader(handle, _size);
+        }
+
+        /** Get the data that was read.
+         *
+         * @return The slice of exactly the requested size, or empty when the
+         *         peer closed the stream before all the bytes were received.
+         * @throws io_error On a socket error.
+         */
+        shared_bstring await_resume()
+        {
+            return _stream->read_slice_some(_size);
+        }
+
+    private:
+        socket_stream *_stream;
+        std::size_t _size;
+    };
+
+    class write_awaiter {
+    public:
+        write_awaiter(socket_stream& stream, std::span<std::byte const> bytes, std::size_t watermark) noexcept :
+            _stream(&stream), _bytes(bytes), _watermark(watermark)
+        {
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return _stream->_write_buffer.nrBytes() <= _watermark or _stream->_error != 0;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            hi_assert(not _stream->_writer);
+            _stream->_writer = handle;
+            _stream->_writer_watermark = _watermark;
+        }
+
+        /** Add the data to the write buffer.
+         *
+         * @throws io_error On a socket error.
+         */
+        void await_resume()
+        {
+            _stream->write_all(_bytes);
+        }
+
+    private:
+        socket_stream *_stream;
+        std::span<std::byte const> _bytes;
+        std::size_t _watermark;
+    };
+
+    ~socket_stream()
+    {
+        hi_axiom(_loop->on_thread());
+        if (_registered) {
+            _loop->remove_socket(_fd);
+        }
+    }
+
+    socket_stream(socket_stream const&) = delete;
+    socket_stream(socket_stream&&) = delete;
+    socket_stream& operator=(socket_stream const&) = delete;
+    socket_stream& operator=(socket_stream&&) = delete;
+
+    /** Create a stream for a socket.
+     *
+     * @param fd The file descriptor of a connected, non-blocking, socket.
+     * @param high_watermark The number of bytes buffered above which writers are suspended.
+     * @param low_watermark The number of bytes buffered at which suspended writers are resumed.
      */
-    packet_buffer readBuffer;
+    socket_stream(int fd, std::size_t high_watermark = 1024 * 1024, std::size_t low_watermark = 256 * 1024) :
+        _loop(std::addressof(loop::local())), _fd(fd), _high_watermark(high_watermark), _low_watermark(low_watermark)
+    {
+        hi_assert(fd >= 0);
+        hi_assert(low_watermark <= high_watermark);
+        update_events();
+    }
+
+    [[nodiscard]] int fd() const noexcept
+    {
+        return _fd;
+    }
 
-    /** Buffer with data to write.
+    /** The number of bytes that are waiting to be send.
      */
-    packet_buffer writeBuffer;
+    [[nodiscard]] std::size_t num_write_bytes() const noexcept
+    {
+        return _write_buffer.nrBytes();
+    }
 
-public:
-    /** Handle connected event.
+    /** The number of bytes that have been received, but not read.
+     */
+    [[nodiscard]] std::size_t num_read_bytes() const noexcept
+    {
+        return _read_buffer.nrBytes();
+    }
+
+    /** Read some bytes from the stream.
+     *
+     * `co_await stream.read(buffer)` returns the number of bytes copied into
+     * @a buffer, which is at least one byte; or zero when the peer has
+     * closed the stream.
+     *
+     * @param buffer The buffer to read into.
+     */
+    [[nodiscard]] read_awaiter read(std::span<std::byte> buffer) noexcept
+    {
+        hi_axiom(_loop->on_thread());
+        return {*this, buffer};
+    }
+
+    /** Read an exact number of bytes from the stream, without copying.
+     *
+     * `co_await stream.read_slice(size)` returns a reference counted slice
+     * of the received packets; a copy is only made when the bytes are spread
+     * over multiple packets. The slice stays valid after further reads.
+     *
+     * @param size The number of bytes to read, larger than zero.
      */
-    void handleConnect();
+    [[nodiscard]] read_slice_awaiter read_slice(std::size_t size) noexcept
+    {
+        hi_axiom(_loop->on_thread());
+        hi_axiom(size != 0);
+        return {*this, size};
+    }
 
-    /** Check if the socket-stream needs to read.
+    /** Write bytes to the stream.
+     *
+     * `co_await stream.write(bytes)` suspends while the write buffer is above
+     * the high watermark, and then copies all of @a bytes into the write buffer.
+     *
+     * @param bytes The bytes to write; they only need to stay alive until the co_await completes.
      */
-    virtual bool needToRead();
+    [[nodiscard]] write_awaiter write(std::span<std::byte const> bytes) noexcept
+    {
+        hi_axiom(_loop->on_thread());
+        return {*this, bytes, _high_watermark};
+    }
 
-    /** Check if the socket-stream needs to read.
+    /** Wait until all buffered bytes have been send to the socket.
      */
-    virtual bool needToWrite();
+    [[nodiscard]] write_awaiter flush() noexcept
+    {
+        hi_axiom(_loop->on_thread());
+        return {*this, {}, 0};
+    }
 
-    /** Handle ready-to-read event.
+    /** Forget the co-routine that waits on a read.
      *
+     * This must be called before destroying a co-routine that is suspended on a read.
      */
-    [[nodiscard]] virtual void handleReadyToReadEvent();
+    void cancel_read() noexcept
+    {
+        _reader = {};
+    }
 
-    /** Handle ready-to-write event.
+    /** Write bytes to the stream without waiting for the high watermark.
+     *
+     * This is for callers that do their own flow control, for example by
+     * `co_await stream.write({})` before producing more data.
      *
+     * @param bytes The bytes to write, copied into the write buffer.
+     * @throws io_error On a socket error.
+     */
+    void post(std::span<std::byte const> bytes)
+    {
+        hi_axiom(_loop->on_thread());
+        write_all(bytes);
+    }
+
+private:
+    /** The number of bytes to receive at once.
+     */
+    constexpr static std::size_t recv_size = packet_pool::chunk_size / 4;
+
+    /** The maximum number of packets that are send with a single gather-write.
      */
-    [[nodiscard]] virtual void handleReadyToWriteEvent();
-}
+    constexpr static std::size_t max_num_gather = 16;
+
+    loop *_loop;
+    int _fd;
+    std::size_t _high_watermark;
+    std::size_t _low_watermark;
+
+    packet_buffer _read_buffer;
+    packet_buffer _write_buffer;
+
+    /** The events that the socket is registered with on the loop.
+     */
+    socket_event _events = socket_event::none;
+    bool _registered = false;
+
+    /** The errno of the first error on the socket.
+     */
+    int _error = 0;
+
+    bool _read_closed = false;
+
+    std::coroutine_handle<> _reader = {};
+    std::size_t _reader_size = 0;
+    std::coroutine_handle<> _writer = {};
+    std::size_t _writer_watermark = 0;
+
+    void check_error() const
+    {
+        if (_error != 0) {
+            throw io_error(std::format("Socket {} failed. '{}'", _fd, get_last_error_message(narrow_cast<uint32_t>(_error))));
+        }
+    }
+
+    std::size_t read_some(std::span<std::byte> buffer)
+    {
+        // Data that was received before an error is still returned.
+        if (_read_buffer.nrBytes() == 0) {
+            check_error();
+        }
+
+        auto const size = std::min(buffer.size(), _read_buffer.nrBytes());
+        auto offset = 0_uz;
+        while (offset != size) {
+            auto const bytes = _read_buffer.peek(1);
+            auto const chunk = std::min(bytes.size(), size - offset);
+            std::memcpy(buffer.data() + offset, bytes.data(), chunk);
+            _read_buffer.read(chunk);
+            offset += chunk;
+        }
+
+        if (size != 0) {
+            update_events();
+        }
+        return size;
+    }
+
+    shared_bstring read_slice_some(std::size_t size)
+    {
+        if (_read_buffer.nrBytes() < size) {
+            check_error();
+            return {};
+        }
+
+        auto r = _read_buffer.peek_slice(size);
+        _read_buffer.read(size);
+        update_events();
+        return r;
+    }
+
+    void suspend_reader(std::coroutine_handle<> handle, std::size_t size)
+    {
+        hi_assert(not _reader);
+        _reader = handle;
+        _reader_size = size;
+
+        // A reader that waits for more than the high watermark needs the stream to read on.
+        update_events();
+    }
+
+    /** Read from the socket as long as the read buffer is below this limit.
+     */
+    [[nodiscard]] std::size_t read_limit() const noexcept
+    {
+        return _reader ? std::max(_high_watermark, _reader_size) : _high_watermark;
+    }
+
+    void write_all(std::span<std::byte const> bytes)
+    {
+        check_error();
+
+        if (not bytes.empty()) {
+            _write_buffer.write(bytes);
+
+            // Try sending directly, to skip a round trip through the loop.
+            send_some();
+            update_events();
+            check_error();
+        }
+    }
+
+    /** Register the events of the socket based on the state of the buffers.
+     *
+     * A peer that closes the stream is detected by a read of zero bytes, so
+     * that data the peer send before closing is not lost.
+     */
+    void update_events()
+    {
+        if (_error != 0 or (_read_closed and _write_buffer.nrBytes() == 0)) {
+            // Nothing more will happen on the socket; stop the loop from
+            // reporting the error or hang-up on each iteration.
+            if (_registered) {
+                _loop->remove_socket(_fd);
+                _registered = false;
+            }
+            return;
+        }
+
+        auto events = socket_event::none;
+        if (not _read_closed and _read_buffer.nrBytes() < read_limit()) {
+            events |= socket_event::read;
+        }
+        if (_write_buffer.nrBytes() != 0) {
+            events |= socket_event::write;
+        }
+
+        if (not _registered or events != _events) {
+            _events = events;
+            _registered = true;
+            _loop->add_socket(_fd, events, [this](int, socket_events const& events) {
+                on_socket(events);
+            });
+        }
+    }
+
+    void on_socket(socket_events const& events)
+    {
+        if (to_bool(events.events & socket_event::read)) {
+            recv_some();
+        }
+        if (to_bool(events.events & socket_event::write)) {
+            send_some();
+        }
+
+        update_events();
+
+        // Resume after the state has been updated, the co-routines may
+        // destroy the stream.
+        if (_reader and (_read_buffer.nrBytes() >= _reader_size or _read_closed or _error != 0)) {
+            std::exchange(_reader, {}).resume();
+        }
+        if (_writer and (_write_buffer.nrBytes() <= std::min(_writer_watermark, _low_watermark) or _error != 0)) {
+            std::exchange(_writer, {}).resume();
+        }
+    }
+
+    void recv_some() noexcept
+    {
+        while (not _read_closed and _error == 0 and _read_buffer.nrBytes() < read_limit()) {
+            auto buffer = _read_buffer.getpacket(recv_size);
+            auto const r = ::recv(_fd, buffer.data(), buffer.size(), 0);
+            if (r > 0) {
+                _read_buffer.write(narrow_cast<std::size_t>(r));
+            } else if (r == 0) {
+                _read_closed = true;
+            } else if (errno == EAGAIN or errno == EWOULDBLOCK) {
+                return;
+            } else if (errno != EINTR) {
+                _error = errno;
+            }
+        }
+    }
+
+    void send_some() noexcept
+    {
+        while (_error == 0 and _write_buffer.nrBytes() != 0) {
+            auto spans = std::array<std::span<std::byte const>, max_num_gather>{};
+            auto iov = std::array<iovec, max_num_gather>{};
+
+            auto const num_spans = _write_buffer.gather(spans);
+            for (auto i = 0_uz; i != num_spans; ++i) {
+                iov[i].iov_base = const_cast<std::byte *>(spans[i].data());
+                iov[i].iov_len = spans[i].size();
+            }
+
+            auto msg = msghdr{};
+            msg.msg_iov = iov.data();
+            msg.msg_iovlen = num_spans;
+
+            auto const r = ::sendmsg(_fd, &msg, MSG_NOSIGNAL);
+            if (r >= 0) {
+                _write_buffer.read(narrow_cast<std::size_t>(r));
+            } else if (errno == EAGAIN or errno == EWOULDBLOCK) {
+                return;
+            } else if (errno != EINTR) {
+                _error = errno;
+            }
+        }
+    }
+};
+
+#endif
 
 } // namespace hi::inline v1
@@ -0,0 +1,125 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../macros.hpp"
+#if HI_OPERATING_SYSTEM == HI_OS_LINUX
+#include "stream.hpp"
+#include <hikotest/hikotest.hpp>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <array>
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <cstddef>
+
+TEST_SUITE(socket_stream) {
+
+constexpr static auto payload_size = 4 * 1024 * 1024uz;
+constexpr static auto piece_size = 64 * 1024uz;
+
+[[nodiscard]] static std::byte payload_byte(std::size_t i) noexcept
+{
+    return static_cast<std::byte>((i * 7) ^ (i >> 8));
+}
+
+static hi::scoped_task<std::size_t> produce(hi::socket_stream& stream)
+{
+    auto piece = std::vector<std::byte>(piece_size);
+    auto max_buffered = 0uz;
+
+    for (auto offset = 0uz; offset != payload_size; offset += piece_size) {
+        for (auto i = 0uz; i != piece_size; ++i) {
+            piece[i] = payload_byte(offset + i);
+        }
+        co_await stream.write(piece);
+        max_buffered = std::max(max_buffered, stream.num_write_bytes());
+    }
+    co_await stream.flush();
+    co_return max_buffered;
+}
+
+static hi::scoped_task<std::size_t> consume(hi::socket_stream& stream)
+{
+    auto buffer = std::array<std::byte, 10000>{};
+    auto total = 0uz;
+    auto num_errors = 0uz;
+
+    while (true) {
+        auto const size = co_await stream.read(buffer);
+        if (size == 0) {
+            break;
+        }
+        for (auto i = 0uz; i != size; ++i) {
+            if (buffer[i] != payload_byte(total + i)) {
+                ++num_errors;
+            }
+        }
+        total += size;
+    }
+    co_return num_errors == 0 ? total : 0;
+}
+
+TEST_CASE(backpressure)
+{
+    auto pair = std::array<int, 2>{};
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, pair.data()) == 0);
+
+    auto const high_watermark = 256 * 1024uz;
+    auto const low_watermark = 64 * 1024uz;
+    {
+        auto writer = hi::socket_stream{pair[0], high_watermark, low_watermark};
+        auto reader = hi::socket_stream{pair[1]};
+
+        auto const produced = produce(writer);
+        auto const consumed = consume(reader);
+
+        while (not produced.done()) {
+            hi::loop::local().resume_once(true);
+        }
+        // Only a single piece is accepted above the high watermark.
+        REQUIRE(produced.value() <= high_watermark + piece_size);
+        REQUIRE(writer.num_write_bytes() == 0);
+
+        ::shutdown(pair[0], SHUT_WR);
+        while (not consumed.done()) {
+            hi::loop::local().resume_once(true);
+        }
+        REQUIRE(consumed.value() == payload_size);
+    }
+
+    ::close(pair[0]);
+    ::close(pair[1]);
+}
+
+TEST_CASE(buffered_data_before_close)
+{
+    auto pair = std::array<int, 2>{};
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, pair.data()) == 0);
+    REQUIRE(::write(pair[1], "hello", 5) == 5);
+    ::close(pair[1]);
+
+    {
+        auto reader = hi::socket_stream{pair[0]};
+        auto const consumed = [](hi::socket_stream& stream) -> hi::scoped_task<std::size_t> {
+            auto buffer = std::array<std::byte, 16>{};
+            auto total = 0uz;
+            while (auto const size = co_await stream.read(buffer)) {
+                total += size;
+            }
+            co_return total;
+        }(reader);
+
+        while (not consumed.done()) {
+            hi::loop::local().resume_once(true);
+        }
+        REQUIRE(consumed.value() == 5);
+    }
+
+    ::close(pair[0]);
+}
+
+};
+
+#endif
@@ -11,6 +11,7 @@
 #include <type_traits>
 #include <ostream>
 #include <concepts>
+#include <limits>
 
 hi_export_module(hikogui.numeric.bigint);
 
@@ -220,20 +221,34 @@ struct bigint {
 
     std::string string() const noexcept
     {
-        constexpr auto oneOver10 = reciprocal(bigint<digit_type, num_digits * 2, is_signed>{10});
+        // The largest power of 10 that fits in a digit, so that the division by
+        // a single digit produces many decimal digits at once.
+        constexpr auto chunk = [] {
+            auto r = std::pair{digit_type{1}, 0_uz};
+            while (r.first <= std::numeric_limits<digit_type>::max() / 10) {
+                r.first *= 10;
+                ++r.second;
+            }
+            return r;
+        }();
 
-        auto tmp = *this;
+        auto tmp = is_negative() ? -*this : *this;
 
         std::string r;
+        do {
+            auto remainder = div_digit_carry_chain(tmp.digits, tmp.digits, chunk.first, num_digits);
 
-        if (tmp == 0) {
-            r = "0";
-        } else {
-            while (tmp > 0) {
-                bigint remainder;
-                std::tie(tmp, remainder) = div(tmp, bigint{10}, oneOver10);
-                r += (static_cast<unsigned char>(remainder) + '0');
+            auto const more = static_cast<bool>(tmp);
+            for (auto i = 0_uz; i != chunk.second and (more or remainder != 0); ++i) {
+                r += static_cast<char>('0' + remainder % 10);
+                remainder /= 10;
             }
+        } while (static_cast<bool>(tmp));
+
+        if (r.empty()) {
+            r = "0";
+        } else if (is_negative()) {
+            r += '-';
         }
 
         std::reverse(r.begin(), r.end());
@@ -191,6 +191,38 @@ TEST_CASE(divide)
     REQUIRE(remainder == 38);
 }
 
+TEST_CASE(divide_multi_digit)
+{
+    auto t = hi::ubig128{"3689348814741910323200"};
+
+    auto const [quotient, remainder] = div(t, hi::ubig128{"36893488147419103234"});
+
+    REQUIRE(quotient == 99);
+    REQUIRE(remainder == hi::ubig128{"36893488147419103034"});
+}
+
+TEST_CASE(divide_by_digit)
+{
+    using ubig256 = hi::bigint<uint64_t, 4, false>;
+
+    auto t = ubig256{"123456789012345678901234567890123456789012345678901234567890"};
+
+    auto const [quotient, remainder] = div(t, ubig256{"1000000000000000000"});
+
+    REQUIRE(quotient == ubig256{"123456789012345678901234567890123456789012"});
+    REQUIRE(remainder == ubig256{"345678901234567890"});
+}
+
+TEST_CASE(string_test)
+{
+    REQUIRE(hi::ubig128{0}.string() == "0");
+    REQUIRE(hi::ubig128{"10000000000000000000"}.string() == "10000000000000000000");
+    REQUIRE(hi::ubig128{"9999999999999999999"}.string() == "9999999999999999999");
+    REQUIRE(hi::ubig128{"340282366920938463463374607431768211455"}.string() == "340282366920938463463374607431768211455");
+    REQUIRE(hi::ubig128{"100000000000000000001"}.string() == "100000000000000000001");
+    REQUIRE((-hi::big128{"12345678901234567890123"}).string() == "-12345678901234567890123");
+}
+
 TEST_CASE(reciprocal_test)
 {
     auto t = hi::ubig128{10};
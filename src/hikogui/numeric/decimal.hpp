@@ -12,6 +12,7 @@
 #include <charconv>
 #include <ostream>
 #include <bit>
+#include <array>
 
 hi_export_module(hikogui.numeric.decimal);
 
@@ -336,31 +337,50 @@ public:
         return {lhs_e - rhs_e, lhs_m % rhs_m};
     }
 
-    [[nodiscard]] friend std::string to_string(decimal x) noexcept
+    /** Append the decimal to a string.
+     *
+     * The digits are formatted on the stack, without an intermediate string.
+     *
+     * @param[in,out] str The string to append to.
+     * @param x The decimal value.
+     */
+    friend void append_to_string(std::string& str, decimal x) noexcept
     {
         auto const[e, m] = x.exponent_mantissa();
-        auto s = std::to_string(std::abs(m));
 
-        auto const decimal_position = -e;
-        auto const leading_zeros = (decimal_position - ssize(s)) + 1;
-        if (leading_zeros > 0) {
-            s.insert(0, leading_zeros, '0');
-        }
+        auto buffer = std::array<char, 24>{};
+        auto const abs_m = m < 0 ? 0ULL - static_cast<unsigned long long>(m) : static_cast<unsigned long long>(m);
+        auto const[digits_last, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), abs_m);
+        hi_axiom(ec == std::errc{});
+        auto const digits = std::string_view{buffer.data(), digits_last};
 
-        auto const trailing_zeros = e;
-        if (trailing_zeros > 0) {
-            s.append(trailing_zeros, '0');
+        if (m < 0) {
+            str += '-';
         }
 
-        if (decimal_position > 0) {
-            s.insert(s.size() - decimal_position, 1, '.');
-        }
+        auto const decimal_position = -e;
+        if (decimal_position <= 0) {
+            str += digits;
+            str.append(e, '0');
 
-        if (m < 0) {
-            s.insert(0, 1, '-');
+        } else if (decimal_position >= ssize(digits)) {
+            str += "0.";
+            str.append(decimal_position - ssize(digits), '0');
+            str += digits;
+
+        } else {
+            auto const split = digits.size() - decimal_position;
+            str += digits.substr(0, split);
+            str += '.';
+            str += digits.substr(split);
         }
+    }
 
-        return s;
+    [[nodiscard]] friend std::string to_string(decimal x) noexcept
+    {
+        auto r = std::string{};
+        append_to_string(r, x);
+        return r;
     }
 
     friend std::ostream& operator<<(std::ostream& lhs, decimal rhs)
@@ -532,38 +552,42 @@ private:
 
     [[nodiscard]] std::pair<int, long long> to_exponent_mantissa(std::string_view str)
     {
-        std::string mantissa_str;
+        // The magnitude of the mantissa is accumulated directly, the most negative
+        // mantissa has one more than the maximum positive mantissa.
+        constexpr auto max_mantissa = static_cast<unsigned long long>(std::numeric_limits<long long>::max());
 
+        auto mantissa = 0ULL;
+        auto negative = false;
+        auto out_of_range = false;
         int nr_digits = 0;
         int nr_digits_in_front_of_point = -1;
         for (auto const c : str) {
             if (c >= '0' && c <= '9') {
-                mantissa_str += c;
+                auto const digit = static_cast<unsigned long long>(c - '0');
+                if (mantissa > (max_mantissa + 1 - digit) / 10) {
+                    out_of_range = true;
+                }
+                mantissa = mantissa * 10 + digit;
                 nr_digits++;
             } else if (c == '.') {
                 nr_digits_in_front_of_point = nr_digits;
             } else if (c == '\'' || c == ',') {
                 // Ignore thousand separators.
-            } else if (c == '-') {
-                mantissa_str += c;
+            } else if (c == '-' and nr_digits == 0 and not negative) {
+                negative = true;
             } else {
                 throw parse_error(std::format("Unexpected character in decimal number '{}'", str));
             }
         }
 
-        int exponent = (nr_digits_in_front_of_point >= 0) ? (nr_digits_in_front_of_point - nr_digits) : 0;
-
-        auto first = mantissa_str.data();
-        auto last = first + mantissa_str.size();
-        long long mantissa;
-        auto const result = std::from_chars(first, last, mantissa, 10);
-        if (result.ptr == first) {
-            throw parse_error(std::format("Could not parse mantissa '{}'", mantissa_str));
-        } else if (result.ec == std::errc::result_out_of_range) {
-            throw parse_error(std::format("Mantissa '{}' out of range ", mantissa_str));
-        } else {
-            return {exponent, mantissa};
+        if (nr_digits == 0) {
+            throw parse_error(std::format("Could not parse mantissa '{}'", str));
+        } else if (out_of_range or (not negative and mantissa > max_mantissa)) {
+            throw parse_error(std::format("Mantissa '{}' out of range ", str));
         }
+
+        int exponent = (nr_digits_in_front_of_point >= 0) ? (nr_digits_in_front_of_point - nr_digits) : 0;
+        return {exponent, negative ? static_cast<long long>(0ULL - mantissa) : static_cast<long long>(mantissa)};
     }
 };
 
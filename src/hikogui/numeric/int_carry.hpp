@@ -639,6 +639,10 @@ hi_force_inline constexpr void mul_carry_chain(T *hi_restrict r, T const *lhs, T
 
     for (auto rhs_index = 0; rhs_index < n; rhs_index++) {
         auto const rhs_digit = rhs[rhs_index];
+        if (rhs_digit == 0) {
+            // Common for small values widened into a large bigint.
+            continue;
+        }
 
         T carry = 0;
         for (auto lhs_index = 0; (lhs_index + rhs_index) < n; lhs_index++) {
@@ -652,8 +656,35 @@ hi_force_inline constexpr void mul_carry_chain(T *hi_restrict r, T const *lhs, T
     }
 }
 
+/** Divide unsigned integers by a single digit using a carry-chain.
+ * This function does a digit-wise long division.
+ *
+ * @note @a quotient may alias with @a lhs.
+ * @param quotient The result of the division.
+ * @param lhs The left hand side operand.
+ * @param rhs The right hand side operand, must not be zero.
+ * @param n The number of digits of @a quotient and @a lhs.
+ * @return The remainder of the division.
+ */
+template<std::unsigned_integral T>
+hi_force_inline constexpr T div_digit_carry_chain(T *quotient, T const *lhs, T rhs, std::size_t n) noexcept
+{
+    hi_axiom(rhs != 0);
+
+    auto remainder = T{0};
+    for (auto i = n; i != 0; --i) {
+        // The remainder is smaller than rhs, so the quotient fits in a digit.
+        auto const lhs_digit = lhs[i - 1];
+        auto const q = wide_div(lhs_digit, remainder, rhs);
+        remainder = static_cast<T>(lhs_digit - static_cast<T>(q * rhs));
+        quotient[i - 1] = q;
+    }
+    return remainder;
+}
+
 /** Divide unsigned integers using a carry-chain
- * This function does a bit-wise division.
+ * This function does a bit-wise division, or a digit-wise division
+ * when @a rhs fits in a single digit.
  *
  * @note @a quotient and @a remainder may not alias with @a lhs or @a rhs or with each other.
  * @param quotient The result of the division.
@@ -668,9 +699,24 @@ constexpr void div_carry_chain(T *hi_restrict quotient, T *hi_restrict remainder
     hi_axiom(quotient != lhs and quotient != rhs and quotient != remainder);
     hi_axiom(remainder != lhs and remainder != rhs);
 
-    auto const nr_bits = static_cast<ssize_t>(n * sizeof(T) * CHAR_BIT);
+    if (not std::is_constant_evaluated()) {
+        // `wide_div()` uses intrinsics which are not constexpr on all compilers.
+        auto rhs_is_digit = true;
+        for (std::size_t i = 1; i < n; ++i) {
+            rhs_is_digit &= rhs[i] == 0;
+        }
+
+        if (rhs_is_digit and rhs[0] != 0) {
+            remainder[0] = div_digit_carry_chain(quotient, lhs, rhs[0], n);
+            for (std::size_t i = 1; i < n; ++i) {
+                remainder[i] = 0;
+            }
+            return;
+        }
+    }
 
-    for (ssize_t i = nr_bits - 1; i >= 0; i--) {
+    // The leading zero bits of lhs do not change the quotient nor the remainder.
+    for (ssize_t i = bsr_carry_chain(lhs, n); i >= 0; i--) {
         sll_carry_chain(remainder, remainder, 1, n);
         remainder[0] |= get_bit(lhs, i);
         if (ge_unsigned_carry_chain(remainder, rhs, n)) {
@@ -7,8 +7,12 @@
 #include "../utility/utility.hpp"
 #include "../container/container.hpp"
 #include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
 #include <numbers>
 #include <array>
+#include <limits>
+#include <cmath>
+#include <concepts>
 
 hi_export_module(hikogui.numeric.polynomial);
 
@@ -174,4 +178,72 @@ hi_force_inline constexpr lean_vector<T> solvePolynomial(T const& a, T const& b,
     }
 }
 
+/** Solve many cubic functions at once.
+ * \f[ax^{3}+bx^{2}+cx+d=0\f]
+ *
+ * Each lane of the arguments is a separate function. The coefficients of
+ * the depressed cubic and the arguments of the trigonometric and Cardano's
+ * solutions are calculated for all lanes at once, the same as for a single
+ * function in `solvePolynomial()`.
+ *
+ * @param a, b, c, d The coefficients of the functions.
+ * @return Three roots for each lane of the arguments. When a function has
+ *         less than three real roots, a root is repeated. When a function has
+ *         no roots the three roots are NaN.
+ */
+template<std::floating_point T, std::size_t N>
+[[nodiscard]] inline std::array<simd<T, N>, 3>
+solve_polynomial(simd<T, N> const& a, simd<T, N> const& b, simd<T, N> const& c, simd<T, N> const& d) noexcept
+{
+    using S = simd<T, N>;
+    constexpr T oneThird = T{1} / T{3};
+    constexpr T pi2_3 = (T{2} / T{3}) * std::numbers::pi_v<T>;
+    constexpr T pi4_3 = (T{4} / T{3}) * std::numbers::pi_v<T>;
+
+    // Lanes where a is zero divide by zero here, these lanes are solved separately.
+    auto const p = (S::broadcast(T{3}) * a * c - b * b) / (S::broadcast(T{3}) * a * a);
+    auto const q = (S::broadcast(T{2}) * b * b * b - S::broadcast(T{9}) * a * b * c + S::broadcast(T{27}) * a * a * d) /
+        (S::broadcast(T{27}) * a * a * a);
+    auto const b_3a = b / (S::broadcast(T{3}) * a);
+    auto const D = S::broadcast(T{1} / T{4}) * q * q + S::broadcast(T{1} / T{27}) * p * p * p;
+
+    // Arguments for the trigonometric solution; NaN in lanes where p is positive.
+    auto const acos_arg = ((S::broadcast(T{3}) * q) / (S::broadcast(T{2}) * p)) * sqrt(S::broadcast(T{-3}) / p);
+    auto const V = S::broadcast(T{2}) * sqrt(S::broadcast(-oneThird) * p);
+
+    // Arguments for Cardano's solution; NaN in lanes where D is negative.
+    auto const sqrtD = sqrt(D);
+    auto const minusHalfQ = S::broadcast(T{-0.5}) * q;
+
+    auto r = std::array<S, 3>{};
+    for (auto i = 0_uz; i != N; ++i) {
+        if (a[i] == 0) {
+            auto const roots = solvePolynomial(b[i], c[i], d[i]);
+            for (auto j = 0_uz; j != 3; ++j) {
+                r[j][i] = roots.empty() ? std::numeric_limits<T>::quiet_NaN() : roots[std::min(j, roots.size() - 1)];
+            }
+
+        } else if (p[i] == 0 and q[i] == 0) {
+            r[0][i] = r[1][i] = r[2][i] = -b_3a[i];
+
+        } else if (D[i] < 0 and p[i] != 0) {
+            // Has three real roots.
+            auto const U = oneThird * std::acos(acos_arg[i]);
+            r[0][i] = V[i] * std::cos(U) - b_3a[i];
+            r[1][i] = V[i] * std::cos(U - pi2_3) - b_3a[i];
+            r[2][i] = V[i] * std::cos(U - pi4_3) - b_3a[i];
+
+        } else if (D[i] == 0 and p[i] != 0) {
+            // Has two real roots, or maybe one root
+            r[0][i] = (T{3} * q[i]) / p[i] - b_3a[i];
+            r[1][i] = r[2][i] = (T{-3} * q[i]) / (T{2} * p[i]) - b_3a[i];
+
+        } else {
+            // Has one real root.
+            r[0][i] = r[1][i] = r[2][i] = std::cbrt(minusHalfQ[i] + sqrtD[i]) + std::cbrt(minusHalfQ[i] - sqrtD[i]) - b_3a[i];
+        }
+    }
+    return r;
+}
+
 } // namespace hi::inline v1
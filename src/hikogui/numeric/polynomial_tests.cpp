@@ -5,6 +5,7 @@
 #include "polynomial.hpp"
 #include <hikotest/hikotest.hpp>
 #include <algorithm>
+#include <cmath>
 
 TEST_SUITE(polynomial) {
 
@@ -39,6 +40,29 @@ TEST_CASE(solve_cubic)
     // REQUIRE(solveCubic(1.0, -5.0, 8.0, -4.0) == std::make_tuple(1.0, 2.0, 2.0), 0.000001);
 }
 
+TEST_CASE(solve_cubic_batch)
+{
+    // One three-root, one single-root, one quadratic and one equation without roots.
+    auto const a = hi::f32x4{1.0f, 1.0f, 0.0f, 0.0f};
+    auto const b = hi::f32x4{-6.0f, 1.0f, 1.0f, 0.0f};
+    auto const c = hi::f32x4{11.0f, 1.0f, -10.0f, 0.0f};
+    auto const d = hi::f32x4{-6.0f, -3.0f, 16.0f, 1.0f};
+
+    auto const r = hi::solve_polynomial(a, b, c, d);
+
+    auto const lane = [&](std::size_t i) {
+        auto v = hi::lean_vector<double>{r[0][i], r[1][i], r[2][i]};
+        return sort(v);
+    };
+
+    REQUIRE(lane(0) == hi::make_lean_vector<double>(1.0, 2.0, 3.0), 0.0001);
+    REQUIRE(lane(1) == hi::make_lean_vector<double>(1.0, 1.0, 1.0), 0.0001);
+    REQUIRE(lane(2) == hi::make_lean_vector<double>(2.0, 8.0, 8.0), 0.0001);
+    REQUIRE(std::isnan(r[0][3]));
+    REQUIRE(std::isnan(r[1][3]));
+    REQUIRE(std::isnan(r[2][3]));
+}
+
 TEST_CASE(solve_quadratic)
 {
     REQUIRE(sort(hi::solvePolynomial(1.0, -10.0, 16.0)) == hi::make_lean_vector<double>(2.0, 8.0), 0.000001);
@@ -6,13 +6,12 @@
 
 #include "../utility/utility.hpp"
 #include "../concurrency/concurrency.hpp"
-#include "../concurrency/unfair_mutex.hpp" // XXX #616
 #include "../macros.hpp"
 #include <memory>
-#include <vector>
 #include <functional>
 #include <tuple>
-#include <mutex>
+#include <atomic>
+#include <utility>
 
 hi_export_module(hikogui.observer.group_ptr);
 
@@ -42,66 +41,131 @@ class enable_group_ptr;
 template<typename T, typename... Args>
 class enable_group_ptr<T, void(Args...)> {
 public:
-#ifndef NDEBUG
+    enable_group_ptr() noexcept = default;
+    enable_group_ptr(enable_group_ptr const&) = delete;
+    enable_group_ptr(enable_group_ptr&&) = delete;
+    enable_group_ptr& operator=(enable_group_ptr const&) = delete;
+    enable_group_ptr& operator=(enable_group_ptr&&) = delete;
+
     ~enable_group_ptr()
     {
-        hi_assert(_enable_group_ptr_owners.empty());
+        auto *slot = _enable_group_ptr_slots.load(std::memory_order::acquire);
+        while (slot != nullptr) {
+            hi_assert(slot->owner.load(std::memory_order::relaxed) == nullptr);
+            delete std::exchange(slot, slot->next);
+        }
     }
-#endif
 
     /** Call the callback which are registered with the owning `group_ptr`s.
+     *
+     * This function does not take a lock; owners may join and leave while
+     * the callbacks are being called, but an owner must not be destroyed
+     * while it is being notified.
      *
      * @param args The arguments to pass to the callback function.
      */
     void notify_group_ptr(Args const&...args) const noexcept
     {
-        auto const owners_copy = [&] {
-            auto const lock = std::scoped_lock(_enable_group_ptr_mutex);
-            return _enable_group_ptr_owners;
-        }();
-
-        for (auto owner : owners_copy) {
-            hi_assert_not_null(owner);
-            if (owner->_notify) {
-                owner->_notify(args...);
+        for (auto *slot = _enable_group_ptr_slots.load(std::memory_order::acquire); slot != nullptr; slot = slot->next) {
+            if (auto owner = slot->owner.load(std::memory_order::acquire)) {
+                notify_group_ptr_owner(owner, args...);
             }
         }
     }
 
+protected:
+    /** Call the callback which is registered with a single owning `group_ptr`.
+     *
+     * This is used by a derived class that keeps track itself of which owners
+     * need to be notified.
+     *
+     * @param owner The owning `group_ptr`.
+     * @param args The arguments to pass to the callback function.
+     */
+    static void notify_group_ptr_owner(group_ptr<T> const *owner, Args const&...args) noexcept
+    {
+        hi_assert_not_null(owner);
+        if (owner->_notify) {
+            owner->_notify(args...);
+        }
+    }
+
 private:
     using _enable_group_ptr_notify_proto = void(Args...);
 
-    std::vector<group_ptr<T> *> _enable_group_ptr_owners;
-    mutable unfair_mutex _enable_group_ptr_mutex;
+    /** A slot in the intrusive list of owners.
+     *
+     * Slots are only added to the front of the list and are reused after an
+     * owner leaves, they are only deallocated when the object is destroyed.
+     * This means the list can be traversed and modified without a lock or
+     * a reclamation scheme; `next` never changes after a slot is published.
+     */
+    struct _enable_group_ptr_slot {
+        std::atomic<group_ptr<T> *> owner;
+        _enable_group_ptr_slot *next;
 
-    [[nodiscard]] bool _enable_group_ptr_holds_invariant() const noexcept
-    {
-        hi_axiom(_enable_group_ptr_mutex.is_locked());
+        _enable_group_ptr_slot(group_ptr<T> *owner, _enable_group_ptr_slot *next) noexcept : owner(owner), next(next) {}
+    };
 
-        for (auto owner : _enable_group_ptr_owners) {
-            if (owner == nullptr or owner->_ptr == nullptr or owner->_ptr.get() != this or
-                owner->_ptr.use_count() < _enable_group_ptr_owners.size()) {
-                return false;
+    mutable std::atomic<_enable_group_ptr_slot *> _enable_group_ptr_slots = nullptr;
+
+    void _enable_group_ptr_add_owner(group_ptr<T> *owner) noexcept
+    {
+        hi_axiom_not_null(owner);
+        hi_axiom(owner->_slot == nullptr);
+
+        // First try to reuse the slot of an owner that has left.
+        auto *head = _enable_group_ptr_slots.load(std::memory_order::acquire);
+        for (auto *slot = head; slot != nullptr; slot = slot->next) {
+            group_ptr<T> *expected = nullptr;
+            if (slot->owner.load(std::memory_order::relaxed) == nullptr and
+                slot->owner.compare_exchange_strong(expected, owner, std::memory_order::acq_rel)) {
+                owner->_slot = slot;
+                return;
             }
         }
-        return true;
+
+        auto *slot = new _enable_group_ptr_slot(owner, head);
+        while (not _enable_group_ptr_slots.compare_exchange_weak(slot->next, slot, std::memory_order::acq_rel)) {}
+        owner->_slot = slot;
     }
 
-    void _enable_group_ptr_add_owner(group_ptr<T> *owner) noexcept
+    void _enable_group_ptr_remove_owner(group_ptr<T> *owner) noexcept
     {
-        auto const lock = std::scoped_lock(_enable_group_ptr_mutex);
+        hi_axiom_not_null(owner);
+        hi_assert_not_null(owner->_slot);
+
+        auto *slot = std::exchange(owner->_slot, nullptr);
+        hi_assert(slot->owner.load(std::memory_order::relaxed) == owner);
+        slot->owner.store(nullptr, std::memory_order::release);
 
-        _enable_group_ptr_owners.push_back(owner);
-        hi_axiom(_enable_group_ptr_holds_invariant());
+        // The derived class may keep extra information about its owners.
+        if constexpr (requires(T& self) { self._enable_group_ptr_owner_removed(owner); }) {
+            static_cast<T&>(*this)._enable_group_ptr_owner_removed(owner);
+        }
     }
 
-    void _enable_group_ptr_remove_owner(group_ptr<T> *owner) noexcept
+    /** Move the slot of an owner to a new owner.
+     *
+     * This is used when a `group_ptr` is move-constructed, which avoids
+     * searching for a free slot.
+     *
+     * @param from The owner that leaves the group.
+     * @param to The owner that joins the group, in the slot of @a from.
+     */
+    void _enable_group_ptr_move_owner(group_ptr<T> *from, group_ptr<T> *to) noexcept
     {
-        auto const lock = std::scoped_lock(_enable_group_ptr_mutex);
+        hi_axiom_not_null(from);
+        hi_axiom_not_null(to);
+        hi_assert_not_null(from->_slot);
+        hi_axiom(to->_slot == nullptr);
+
+        to->_slot = std::exchange(from->_slot, nullptr);
+        to->_slot->owner.store(to, std::memory_order::release);
 
-        auto const num_removed = std::erase(_enable_group_ptr_owners, owner);
-        hi_assert(num_removed == 1);
-        hi_axiom(_enable_group_ptr_holds_invariant());
+        if constexpr (requires(T& self) { self._enable_group_ptr_owner_removed(from); }) {
+            static_cast<T&>(*this)._enable_group_ptr_owner_removed(from);
+        }
     }
 
     /** Reseat all the owners with the replacement.
@@ -112,18 +176,26 @@ private:
      */
     void _enable_group_ptr_reseat(std::shared_ptr<enable_group_ptr> const& replacement) noexcept
     {
-        auto const lock = std::scoped_lock(_enable_group_ptr_mutex);
-
         hi_assert_not_null(replacement);
         hi_assert(replacement.get() != this);
 
-        while (not _enable_group_ptr_owners.empty()) {
-            auto *owner = _enable_group_ptr_owners.back();
-            _enable_group_ptr_owners.pop_back();
+        for (auto *slot = _enable_group_ptr_slots.load(std::memory_order::acquire); slot != nullptr; slot = slot->next) {
+            // Claim the owner, so that the owner is reseated only once.
+            auto *owner = slot->owner.exchange(nullptr, std::memory_order::acq_rel);
+            if (owner == nullptr) {
+                continue;
+            }
+
+            hi_axiom(owner->_slot == slot);
+            owner->_slot = nullptr;
             owner->_ptr = replacement;
             owner->_ptr->_enable_group_ptr_add_owner(owner);
+
+            // The derived class may keep extra information about its owners, which is moved to the replacement.
+            if constexpr (requires(T& self) { self._enable_group_ptr_owner_reseated(owner, self); }) {
+                static_cast<T&>(*this)._enable_group_ptr_owner_reseated(owner, static_cast<T&>(*replacement));
+            }
         }
-        hi_axiom(_enable_group_ptr_holds_invariant());
     }
 
     friend class group_ptr<T>;
@@ -227,8 +299,7 @@ public:
     group_ptr(group_ptr&& other) noexcept : _ptr(std::move(other._ptr))
     {
         if (_ptr) {
-            _ptr->_enable_group_ptr_remove_owner(&other);
-            _ptr->_enable_group_ptr_add_owner(this);
+            _ptr->_enable_group_ptr_move_owner(&other, this);
         }
     }
 
@@ -395,6 +466,10 @@ private:
     std::shared_ptr<enable_group_ptr<T, notify_proto>> _ptr = {};
     std::function<notify_proto> _notify = {};
 
+    /** The slot in the owner list of the object, while this `group_ptr` is not empty.
+     */
+    typename enable_group_ptr<T, notify_proto>::_enable_group_ptr_slot *_slot = nullptr;
+
     friend class enable_group_ptr<T, notify_proto>;
 };
 
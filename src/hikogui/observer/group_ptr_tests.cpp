@@ -4,6 +4,8 @@
 
 #include "group_ptr.hpp"
 #include <hikotest/hikotest.hpp>
+#include <thread>
+#include <vector>
 
 hi_warning_push();
 // C26414: Move, copy, reassign or reset a local smart pointer (r.5)
@@ -380,6 +382,68 @@ TEST_CASE(notify_three_args)
     REQUIRE(b_count == 3);
     REQUIRE(c_count == 4);
 }
+
+TEST_CASE(notify_after_leave)
+{
+    auto ptr = std::make_shared<B>(1);
+
+    int a_count = 0;
+    int c_count = 0;
+
+    hi::group_ptr<B> a = ptr;
+    a.subscribe([&](int x) {
+        a_count += x;
+    });
+    {
+        hi::group_ptr<B> b = ptr;
+        b.subscribe([&](int x) {
+            REQUIRE(false);
+        });
+    }
+
+    // c reuses the owner slot of b, which should not be notified.
+    hi::group_ptr<B> c = ptr;
+    c.subscribe([&](int x) {
+        c_count += x;
+    });
+
+    hi::group_ptr<B> d = std::move(c);
+    d.subscribe([&](int x) {
+        c_count += x;
+    });
+
+    ptr->notify_group_ptr(2);
+    REQUIRE(a_count == 2);
+    REQUIRE(c_count == 2);
+}
+
+TEST_CASE(concurrent_copy)
+{
+    auto ptr = std::make_shared<B>(1);
+
+    int count = 0;
+    hi::group_ptr<B> a = ptr;
+    a.subscribe([&](int x) {
+        count += x;
+    });
+
+    auto threads = std::vector<std::jthread>{};
+    for (auto i = 0; i != 4; ++i) {
+        threads.emplace_back([&] {
+            for (auto j = 0; j != 10000; ++j) {
+                hi::group_ptr<B> b = a;
+                auto c = b;
+                auto d = std::move(c);
+                d.reset();
+            }
+        });
+    }
+    threads.clear();
+
+    ptr->notify_group_ptr(1);
+    REQUIRE(count == 1);
+    REQUIRE(a.get() == ptr.get());
+}
 }; // TEST_SUITE(group_ptr_suite)
 
 hi_warning_pop();
@@ -5,22 +5,104 @@
 #pragma once
 
 #include "group_ptr.hpp"
+#include "../concurrency/unfair_mutex.hpp" // XXX #616
+#include "../container/lean_vector.hpp"
+#include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <optional>
+#include <span>
+#include <mutex>
+#include <algorithm>
+#include <utility>
+#include <tuple>
+#include <atomic>
+#include <concepts>
+#include <format>
+#include <cstdint>
 
 hi_export_module(hikogui.observer : observed);
 
 hi_export namespace hi { inline namespace v1 {
 
+/** A component of the path to a sub-object of an observed object.
+ *
+ * Names of members and non-integral indices are interned into an atom, while
+ * integral indices are stored directly with the high bit set. This way paths
+ * are compared without comparing strings.
+ */
+enum class observed_path_component : uint32_t {};
+
+namespace detail {
+
+class observed_atom_table {
+public:
+    [[nodiscard]] observed_path_component intern(std::string_view str) noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        auto const [it, inserted] = _atoms.try_emplace(std::string{str}, narrow_cast<uint32_t>(_atoms.size()));
+        hi_assert(it->second < 0x8000'0000, "Too many names interned for observers.");
+        return static_cast<observed_path_component>(it->second);
+    }
+
+private:
+    mutable unfair_mutex _mutex = {};
+    std::unordered_map<std::string, uint32_t> _atoms;
+};
+
+inline observed_atom_table observed_atoms;
+
+} // namespace detail
+
+/** Intern the name of a member, as a component of an observer's path.
+ */
+[[nodiscard]] inline observed_path_component make_observed_path_component(std::string_view name) noexcept
+{
+    return detail::observed_atoms.intern(name);
+}
+
+/** Intern the name of a member, as a component of an observer's path.
+ *
+ * The name is only interned once for each @a Name.
+ */
+template<fixed_string Name>
+[[nodiscard]] observed_path_component make_observed_path_component() noexcept
+{
+    static auto const r = make_observed_path_component(std::string_view{Name});
+    return r;
+}
+
+/** Make a component of an observer's path from an index.
+ */
+template<typename Index>
+[[nodiscard]] observed_path_component make_observed_path_index(Index const& index) noexcept
+{
+    if constexpr (std::integral<Index>) {
+        if (std::cmp_greater_equal(index, 0) and std::cmp_less(index, 0x8000'0000)) {
+            return static_cast<observed_path_component>(0x8000'0000 | static_cast<uint32_t>(index));
+        }
+    }
+    return make_observed_path_component(std::format("[{}]", index));
+}
+
 struct observable_msg {
     /** The type of the path used for notifying observers.
+     *
+     * Most paths are short enough to be stored without allocation.
      */
-    using path_type = std::vector<std::string>;
+    using path_type = lean_vector<observed_path_component>;
 
     void const * const ptr;
-    path_type const& path;
+
+    /** The paths to the modified sub-objects.
+     *
+     * When the modifications where batched this is the sorted list of unique paths.
+     */
+    std::span<path_type const> paths;
 };
 
 /** An abstract observed object.
@@ -29,6 +111,8 @@ struct observable_msg {
  */
 class observed_base : public enable_group_ptr<observed_base, void(observable_msg)> {
 public:
+    using path_type = observable_msg::path_type;
+
     virtual ~observed_base() = default;
     observed_base(observed_base const&) = delete;
     observed_base(observed_base&&) = delete;
@@ -47,13 +131,355 @@ public:
      * @return A pointer to the value. The `observer` should cast this to a pointer to the value-type.
      */
     [[nodiscard]] virtual void *get() noexcept = 0;
+
+    /** Notify the observers that a sub-object was modified.
+     *
+     * When a batch is in progress the notification is delayed until the batch is finished.
+     * The mutex is only taken while a batch is in progress, the common case of a
+     * modification outside of a batch only loads the atomic batch count.
+     *
+     * @param path The path to the sub-object that was modified.
+     */
+    void notify(path_type const& path) const noexcept
+    {
+        if (_batch_count.load(std::memory_order::acquire) != 0) {
+            auto const lock = std::scoped_lock(_batch_mutex);
+            // The batch may have finished while waiting for the lock.
+            if (_batch_count.load(std::memory_order::relaxed) != 0) {
+                _batch_paths.push_back(path);
+                return;
+            }
+        }
+
+        notify_subscribers(std::span{std::addressof(path), 1});
+    }
+
+    /** Subscribe an owner to the modifications along a path.
+     *
+     * The owner is notified when the sub-object at @a path, one of its parents
+     * or one of its children is modified. A previous subscription of the owner is replaced.
+     * The subscription is removed when the owner leaves the group.
+     *
+     * @param owner The `group_ptr` that owns this object.
+     * @param path The path to the sub-object that the owner observes.
+     */
+    void subscribe_path(group_ptr<observed_base> const *owner, path_type path) noexcept
+    {
+        auto const lock = std::scoped_lock(_subscription_mutex);
+        std::ignore = unsubscribe_path(owner);
+
+        auto const root = _subscriptions.load(std::memory_order::relaxed);
+        _subscriptions.store(add_subscriber(root.get(), path.begin(), path.end(), owner), std::memory_order::release);
+        _subscription_paths.emplace(owner, std::move(path));
+    }
+
+    /** Start a batch of modifications.
+     *
+     * Batches may be nested, the observers are notified when the last batch is finished.
+     *
+     * @note It is safe to call this function from any thread.
+     */
+    void start_batch() const noexcept
+    {
+        auto const lock = std::scoped_lock(_batch_mutex);
+        _batch_count.fetch_add(1, std::memory_order::release);
+    }
+
+    /** Start a deferred batch of modifications.
+     *
+     * Only one deferred batch can be in progress at a time.
+     *
+     * @return True if a deferred batch was started, false when a deferred batch was already in progress.
+     */
+    [[nodiscard]] bool start_deferred_batch() const noexcept
+    {
+        auto const lock = std::scoped_lock(_batch_mutex);
+        if (std::exchange(_batch_deferred, true)) {
+            return false;
+        }
+        _batch_count.fetch_add(1, std::memory_order::release);
+        return true;
+    }
+
+    /** Finish a batch of modifications.
+     *
+     * When this is the last batch, each observer is notified once for all the
+     * modifications that were made during the batch.
+     *
+     * @param deferred True when finishing the batch started with `start_deferred_batch()`.
+     */
+    void finish_batch(bool deferred = false) const noexcept
+    {
+        auto paths = [&] {
+            auto const lock = std::scoped_lock(_batch_mutex);
+            hi_axiom(_batch_count.load(std::memory_order::relaxed) != 0);
+            if (deferred) {
+                hi_axiom(_batch_deferred);
+                _batch_deferred = false;
+            }
+
+            if (_batch_count.fetch_sub(1, std::memory_order::release) != 1) {
+                return std::vector<path_type>{};
+            }
+            return std::exchange(_batch_paths, {});
+        }();
+
+        if (paths.empty()) {
+            return;
+        }
+
+        // Coalesce multiple modifications of the same sub-object.
+        std::sort(paths.begin(), paths.end());
+        paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+        notify_subscribers(paths);
+    }
+
+private:
+    using owner_type = group_ptr<observed_base>;
+
+    /** A node in the trie of subscriptions, one for each component of a path.
+     *
+     * Nodes are never modified after they are published, see `_subscriptions`.
+     */
+    struct subscription_node {
+        std::vector<owner_type const *> owners;
+        std::unordered_map<observed_path_component, std::shared_ptr<subscription_node const>> children;
+    };
+
+    using path_iterator = path_type::const_iterator;
+
+    mutable unfair_mutex _subscription_mutex;
+
+    /** The subscriptions as a trie, so that notifications only visit the owners along a path.
+     *
+     * The trie is immutable, notifications use the current trie without a lock. A subscribe
+     * or an unsubscribe copies the nodes along the path, while holding `_subscription_mutex`,
+     * and replaces the trie. The other nodes are shared between the old and the new trie.
+     *
+     * Empty nodes are not removed, an object has a limited number of distinct paths.
+     */
+    std::atomic<std::shared_ptr<subscription_node const>> _subscriptions;
+
+    /** The path for each subscribed owner.
+     */
+    std::unordered_map<owner_type const *, path_type> _subscription_paths;
+
+    /** Copy the nodes along a path and add an owner to the last node.
+     *
+     * @param node The node to copy, or nullptr when the node does not exist yet.
+     * @param first The first component of the path below @a node.
+     * @param last One beyond the last component of the path.
+     * @param owner The owner to add.
+     * @return The copy of @a node.
+     */
+    [[nodiscard]] static std::shared_ptr<subscription_node const>
+    add_subscriber(subscription_node const *node, path_iterator first, path_iterator last, owner_type const *owner) noexcept
+    {
+        auto r = node ? std::make_shared<subscription_node>(*node) : std::make_shared<subscription_node>();
+        if (first == last) {
+            r->owners.push_back(owner);
+        } else {
+            auto& child = r->children[*first];
+            child = add_subscriber(child.get(), first + 1, last, owner);
+        }
+        return r;
+    }
+
+    /** Copy the nodes along a path and remove an owner from the last node.
+     *
+     * @param node The node to copy.
+     * @param first The first component of the path below @a node.
+     * @param last One beyond the last component of the path.
+     * @param owner The owner to remove.
+     * @return The copy of @a node.
+     */
+    [[nodiscard]] static std::shared_ptr<subscription_node const>
+    remove_subscriber(subscription_node const& node, path_iterator first, path_iterator last, owner_type const *owner) noexcept
+    {
+        auto r = std::make_shared<subscription_node>(node);
+        if (first == last) {
+            std::erase(r->owners, owner);
+        } else {
+            auto& child = r->children.at(*first);
+            child = remove_subscriber(*child, first + 1, last, owner);
+        }
+        return r;
+    }
+
+    /** Remove the subscription of an owner.
+     *
+     * @return The path that the owner was subscribed to, or empty if it was not subscribed.
+     */
+    [[nodiscard]] std::optional<path_type> unsubscribe_path(owner_type const *owner) noexcept
+    {
+        hi_axiom(_subscription_mutex.is_locked());
+
+        auto const it = _subscription_paths.find(owner);
+        if (it == _subscription_paths.end()) {
+            return std::nullopt;
+        }
+
+        auto const root = _subscriptions.load(std::memory_order::relaxed);
+        hi_axiom_not_null(root);
+        _subscriptions.store(remove_subscriber(*root, it->second.begin(), it->second.end(), owner), std::memory_order::release);
+
+        auto r = std::move(it->second);
+        _subscription_paths.erase(it);
+        return r;
+    }
+
+    template<typename Func>
+    static void visit_subscribers(subscription_node const& node, Func const& func) noexcept
+    {
+        for (auto const owner : node.owners) {
+            func(owner);
+        }
+        for (auto const& [component, child] : node.children) {
+            visit_subscribers(*child, func);
+        }
+    }
+
+    /** Visit the owners which are subscribed along a path.
+     *
+     * @param root The root of the trie of subscriptions.
+     * @param path The path of the modified sub-object.
+     * @param func The function called as `func(owner)` for the owners subscribed to the
+     *             sub-object, its parents and its children.
+     */
+    template<typename Func>
+    static void visit_subscribers(subscription_node const& root, path_type const& path, Func const& func) noexcept
+    {
+        auto const *node = &root;
+        for (auto const component : path) {
+            // The owners subscribed to a parent of the modified sub-object.
+            for (auto const owner : node->owners) {
+                func(owner);
+            }
+
+            auto const it = node->children.find(component);
+            if (it == node->children.end()) {
+                return;
+            }
+            node = it->second.get();
+        }
+
+        // The owners subscribed to the modified sub-object or one of its children.
+        visit_subscribers(*node, func);
+    }
+
+    /** Notify the owners which are subscribed along the modified paths.
+     *
+     * Each owner is notified once. The current trie of subscriptions is used
+     * without taking a lock; an owner that subscribes during the notification
+     * is notified of the next modification.
+     *
+     * @param paths The sorted list of unique paths that were modified.
+     */
+    void notify_subscribers(std::span<path_type const> paths) const noexcept
+    {
+        auto const root = _subscriptions.load(std::memory_order::acquire);
+        if (not root) {
+            return;
+        }
+
+        auto const msg = observable_msg{get(), paths};
+        if (paths.size() == 1) {
+            // An owner is subscribed to a single path, so it is visited only once.
+            visit_subscribers(*root, paths.front(), [&](owner_type const *owner) {
+                notify_group_ptr_owner(owner, msg);
+            });
+            return;
+        }
+
+        auto owners = std::vector<owner_type const *>{};
+        for (auto const& path : paths) {
+            visit_subscribers(*root, path, [&](owner_type const *owner) {
+                owners.push_back(owner);
+            });
+        }
+
+        std::sort(owners.begin(), owners.end());
+        owners.erase(std::unique(owners.begin(), owners.end()), owners.end());
+        for (auto const owner : owners) {
+            notify_group_ptr_owner(owner, msg);
+        }
+    }
+
+    void _enable_group_ptr_owner_removed(owner_type const *owner) noexcept
+    {
+        auto const lock = std::scoped_lock(_subscription_mutex);
+        std::ignore = unsubscribe_path(owner);
+    }
+
+    void _enable_group_ptr_owner_reseated(owner_type const *owner, observed_base& replacement) noexcept
+    {
+        auto path = [&] {
+            auto const lock = std::scoped_lock(_subscription_mutex);
+            return unsubscribe_path(owner);
+        }();
+
+        if (path) {
+            replacement.subscribe_path(owner, std::move(*path));
+        }
+    }
+
+    mutable unfair_mutex _batch_mutex;
+
+    /** The number of batches in progress.
+     *
+     * Only modified while holding `_batch_mutex`, but read without the lock by `notify()`.
+     */
+    mutable std::atomic<std::size_t> _batch_count = 0;
+    mutable bool _batch_deferred = false;
+
+    /** The paths of the sub-objects that where modified during the batch.
+     */
+    mutable std::vector<path_type> _batch_paths;
+
+    friend class enable_group_ptr<observed_base, void(observable_msg)>;
+};
+
+/** A scope of modifications to an observed object.
+ *
+ * While the batch exists the notifications of modifications are collected,
+ * so that a bulk update calls each observer only once when the batch is destroyed.
+ */
+class observed_batch {
+public:
+    observed_batch(observed_batch const&) = delete;
+    observed_batch& operator=(observed_batch const&) = delete;
+    observed_batch& operator=(observed_batch&&) = delete;
+
+    ~observed_batch()
+    {
+        finish();
+    }
+
+    observed_batch(observed_batch&& other) noexcept : _ptr(std::move(other._ptr)) {}
+
+    explicit observed_batch(std::shared_ptr<observed_base const> ptr) noexcept : _ptr(std::move(ptr))
+    {
+        hi_assert_not_null(_ptr);
+        _ptr->start_batch();
+    }
+
+    /** Finish the batch before the batch is destroyed.
+     */
+    void finish() noexcept
+    {
+        if (auto ptr = std::exchange(_ptr, nullptr)) {
+            ptr->finish_batch();
+        }
+    }
+
+private:
+    std::shared_ptr<observed_base const> _ptr;
 };
 
 template<std::equality_comparable T>
 class observed final : public observed_base {
 public:
     using value_type = T;
-    using path_type = observable_msg::path_type;
 
     ~observed() = default;
 
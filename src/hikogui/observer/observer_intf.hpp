@@ -392,7 +392,7 @@ public:
 
         // Rewire the callback subscriptions and notify listeners to this observer.
         update_state_callback();
-        _observed->notify_group_ptr(observable_msg{_observed->get(), _path});
+        _observed->notify(_path);
         return *this;
     }
 
@@ -412,7 +412,7 @@ public:
 
         // Rewire the callback subscriptions and notify listeners to this observer.
         update_state_callback();
-        _observed->notify_group_ptr(observable_msg{_observed->get(), _path});
+        _observed->notify(_path);
         return *this;
     }
 
@@ -476,7 +476,7 @@ public:
         using result_type = std::decay_t<decltype(std::declval<value_type>()[index])>;
 
         auto new_path = _path;
-        new_path.push_back(std::format("[{}]", index));
+        new_path.push_back(make_observed_path_index(index));
         return observer<result_type>{
             _observed, std::move(new_path), [convert_copy = this->_convert, index](void *base) -> void * {
                 return std::addressof((*std::launder(static_cast<value_type *>(convert_copy(base))))[index]);
@@ -495,7 +495,7 @@ public:
         using result_type = std::decay_t<decltype(selector<value_type>{}.template get<Name>(std::declval<value_type&>()))>;
 
         auto new_path = _path;
-        new_path.push_back(std::string{Name});
+        new_path.push_back(make_observed_path_component<Name>());
         // clang-format off
         return observer<result_type>(
             _observed,
@@ -681,7 +681,7 @@ private:
 
     void notify() const noexcept
     {
-        _observed->notify_group_ptr(observable_msg{_observed->get(), _path});
+        _observed->notify(_path);
     }
 
     value_type *convert(void *base) const noexcept
@@ -696,17 +696,15 @@ private:
 
     void update_state_callback() noexcept
     {
+        // The observed object only calls this callback when the modification is along the path of this observer.
+        // A batch of modifications notifies this observer once.
         _observed.subscribe([this](observable_msg const& msg) {
-            auto const [msg_it, this_it] = std::mismatch(msg.path.cbegin(), msg.path.cend(), _path.cbegin(), _path.cend());
-            // If the message's path is fully within the this' path, then this is a sub-path.
-            // If this' path is fully within the message's path, then this is along the path.
-            if (msg_it == msg.path.cend() or this_it == _path.cend()) {
 #ifndef NDEBUG
-                _debug_value = *convert(msg.ptr);
+            _debug_value = *convert(msg.ptr);
 #endif
-                _notifier(*convert(msg.ptr));
-            }
+            _notifier(*convert(msg.ptr));
         });
+        _observed->subscribe_path(std::addressof(_observed), _path);
 
 #ifndef NDEBUG
         _debug_value = *convert(_observed->get());
@@ -8,6 +8,7 @@
 #include "observer_intf.hpp"
 #include "../utility/utility.hpp"
 #include "../concurrency/thread.hpp" // XXX #616
+#include "../dispatch/dispatch.hpp"
 #include "../macros.hpp"
 #include <memory>
 
@@ -35,6 +36,10 @@ hi_export namespace hi::inline v1 {
  * - Although `observer` are created from another `observer` they internally do not
  *   refer to each other so their lifetime are not connected.
  *
+ * Bulk modifications should be done inside a `batch()`, or after calling
+ * `defer_notifications()`, so that each observer is notified once instead
+ * of after each modification.
+ *
  * @tparam T type used as the shared state.
  */
 template<typename T>
@@ -88,6 +93,46 @@ public:
         return observer().template sub<Name>();
     }
 
+    /** Start a batch of modifications.
+     *
+     * Until the returned batch is destroyed the notifications are collected.
+     * Then each observer is notified once, even when a sub-object was
+     * modified many times.
+     *
+     * ```
+     * {
+     *     auto const batch = state.batch();
+     *     for (auto i = 0_uz; i != 1000; ++i) {
+     *         state.sub<"values">().sub(i) = i;
+     *     }
+     * }
+     * ```
+     *
+     * @return The batch object.
+     */
+    [[nodiscard]] observed_batch batch() const noexcept
+    {
+        return observed_batch{_pimpl};
+    }
+
+    /** Delay notifications until the next iteration of the main loop.
+     *
+     * All modifications made until the main-loop handles its posted functions
+     * are combined in a single batch, so that observers like widgets are notified
+     * once per frame. Calling this function while a deferred batch is already
+     * in progress is cheap.
+     *
+     * @note It is safe to call this function from any thread.
+     */
+    void defer_notifications() const noexcept
+    {
+        if (_pimpl->start_deferred_batch()) {
+            loop::main().post_function([pimpl = _pimpl] {
+                pimpl->finish_batch(true);
+            });
+        }
+    }
+
 private:
     std::shared_ptr<observed<value_type>> _pimpl;
 };
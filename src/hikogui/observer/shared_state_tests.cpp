@@ -520,6 +520,120 @@ TEST_CASE(callback)
     a = 42;
 }
 
+TEST_CASE(batch)
+{
+    using namespace shared_state_suite_ns;
+
+    auto state = hi::shared_state<A>{B{"hello world", 42}, std::vector<int>{5, 15}};
+
+    auto a_cursor = state.observer();
+    auto foo_cursor = state.sub<"b">().sub<"foo">();
+    auto bar_cursor = state.sub<"b">().sub<"bar">();
+    auto baz_cursor = state.sub<"baz">();
+
+    auto a_count = 0;
+    auto foo_count = 0;
+    auto bar_count = 0;
+    auto baz_count = 0;
+
+    // clang-format off
+    auto a_cbt = a_cursor.subscribe([&](auto...) { ++a_count; });
+    auto foo_cbt = foo_cursor.subscribe([&](auto...) { ++foo_count; });
+    auto bar_cbt = bar_cursor.subscribe([&](auto...) { ++bar_count; });
+    auto baz_cbt = baz_cursor.subscribe([&](auto...) { ++baz_count; });
+    // clang-format on
+
+    {
+        auto const batch = state.batch();
+        for (auto i = 0; i != 1000; ++i) {
+            bar_cursor = i;
+        }
+
+        {
+            // Nested batches are finished with the outer batch.
+            auto const inner_batch = state.batch();
+            foo_cursor = std::string{"batch"};
+        }
+
+        REQUIRE(a_count == 0);
+        REQUIRE(bar_count == 0);
+        REQUIRE(foo_count == 0);
+        REQUIRE(*bar_cursor == 999);
+    }
+
+    REQUIRE(a_count == 1);
+    REQUIRE(bar_count == 1);
+    REQUIRE(foo_count == 1);
+    REQUIRE(baz_count == 0);
+
+    // Without a batch each modification is notified.
+    bar_cursor = 1;
+    bar_cursor = 2;
+    REQUIRE(a_count == 3);
+    REQUIRE(bar_count == 3);
+}
+
+TEST_CASE(path_component)
+{
+    REQUIRE(hi::make_observed_path_component<"foo">() == hi::make_observed_path_component("foo"));
+    REQUIRE(hi::make_observed_path_component("foo") != hi::make_observed_path_component("bar"));
+    REQUIRE(hi::make_observed_path_index(0) != hi::make_observed_path_index(1));
+    REQUIRE(hi::make_observed_path_index(0) != hi::make_observed_path_component("[0]"));
+    REQUIRE(hi::make_observed_path_index(std::string{"foo"}) == hi::make_observed_path_component("[foo]"));
+}
+
+TEST_CASE(copied_sub_observer)
+{
+    using namespace shared_state_suite_ns;
+
+    auto state = hi::shared_state<A>{B{"hello world", 42}, std::vector<int>{5, 15}};
+
+    auto bar_cursor = state.sub<"b">().sub<"bar">();
+    auto bar_copy = bar_cursor;
+
+    auto bar_count = 0;
+    auto bar_cbt = bar_copy.subscribe([&](auto...) { ++bar_count; });
+
+    {
+        // A sub-observer that is destroyed should no longer be notified.
+        auto foo_cursor = state.sub<"b">().sub<"foo">();
+        foo_cursor = std::string{"foo"};
+    }
+    REQUIRE(bar_count == 0);
+
+    state.sub<"b">().sub<"foo">() = std::string{"bar"};
+    REQUIRE(bar_count == 0);
+
+    bar_cursor = 3;
+    REQUIRE(bar_count == 1);
+    REQUIRE(*bar_copy == 3);
+}
+
+TEST_CASE(defer_notifications)
+{
+    using namespace shared_state_suite_ns;
+
+    auto state = hi::shared_state<A>{B{"hello world", 42}, std::vector<int>{5, 15}};
+
+    auto bar_cursor = state.sub<"b">().sub<"bar">();
+    auto bar_count = 0;
+    auto bar_cbt = bar_cursor.subscribe([&](auto...) {
+        ++bar_count;
+    });
+
+    for (auto i = 0; i != 1000; ++i) {
+        state.defer_notifications();
+        bar_cursor = i;
+    }
+    REQUIRE(bar_count == 0);
+
+    hi::loop::main().resume_once();
+    REQUIRE(bar_count == 1);
+
+    bar_cursor = 1;
+    REQUIRE(bar_count == 2);
+}
+
 TEST_CASE(convenience_operators)
 {
     auto a = hi::observer<int>{};
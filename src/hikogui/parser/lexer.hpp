@@ -8,16 +8,29 @@
 #include "../utility/utility.hpp"
 #include "../unicode/unicode.hpp"
 #include "../char_maps/char_maps.hpp"
+#include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
 #include <ranges>
 #include <iterator>
 #include <cstdint>
+#include <cstddef>
+#include <array>
+#include <bit>
 #include <string>
 #include <string_view>
 #include <format>
 #include <ostream>
+#if HI_PROCESSOR == HI_CPU_X86_64
+#include <immintrin.h>
+#endif
 
 hi_export_module(hikogui.parser.lexer);
 
+hi_warning_push();
+// C26490: Don't use reinterpret_cast.
+// Needed for SIMD intrinsics.
+hi_warning_ignore_msvc(26490);
+
 hi_export namespace hi { inline namespace v1 {
 
 struct lexer_config {
@@ -158,6 +171,113 @@ struct lexer_config {
 
 namespace detail {
 
+/** A set of ASCII characters for bulk-skipping in the lexer.
+ *
+ * The character `c` is in the set when bit `c >> 4` of `set[c & 0xf]` is set.
+ * Non-ASCII characters are never in the set.
+ */
+using lexer_skip_set_type = std::array<uint8_t, 16>;
+
+[[nodiscard]] constexpr bool lexer_skip_set_contains(lexer_skip_set_type const& set, char c) noexcept
+{
+    auto const c_ = char_cast<uint8_t>(c);
+    return c_ < 0x80 and ((set[c_ & 0xf] >> (c_ >> 4)) & 1) != 0;
+}
+
+#if HI_PROCESSOR == HI_CPU_X86_64
+/** Classify 16 characters against a skip-set.
+ *
+ * @return A mask with a bit set for each character that is NOT in the set.
+ */
+hi_target("sse2,ssse3") [[nodiscard]] inline unsigned int lexer_skip_block_ssse3(__m128i input, __m128i set) noexcept
+{
+    // The high nibble 8 to 15 means non-ASCII, which looks up a zero bit.
+    auto const bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, char_cast<char>(uint8_t{128}), 0, 0, 0, 0, 0, 0, 0, 0);
+    auto const nibble_mask = _mm_set1_epi8(0x0f);
+
+    auto const row = _mm_shuffle_epi8(set, _mm_and_si128(input, nibble_mask));
+    auto const bit = _mm_shuffle_epi8(bits, _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask));
+    auto const not_in_set = _mm_cmpeq_epi8(_mm_and_si128(row, bit), _mm_setzero_si128());
+    return truncate<unsigned int>(_mm_movemask_epi8(not_in_set));
+}
+
+/** Count the number of leading characters that are in the skip-set, 16 characters at a time.
+ *
+ * @param ptr A pointer to the text.
+ * @param size The number of characters in the text.
+ * @param set The skip-set.
+ * @return The number of characters at the start of the text that are in the set, only complete blocks are counted.
+ */
+hi_target("sse2,ssse3") [[nodiscard]] inline std::size_t
+lexer_skip_ssse3(char const *ptr, std::size_t size, lexer_skip_set_type const& set) noexcept
+{
+    auto const set_ = _mm_loadu_si128(reinterpret_cast<__m128i const *>(set.data()));
+
+    auto i = 0_uz;
+    for (; i + 16 <= size; i += 16) {
+        auto const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + i));
+        if (auto const mask = lexer_skip_block_ssse3(input, set_)) {
+            return i + std::countr_zero(mask);
+        }
+    }
+    return i;
+}
+
+/** Count the number of leading characters that are in the skip-set, 32 characters at a time.
+ *
+ * @param ptr A pointer to the text.
+ * @param size The number of characters in the text.
+ * @param set The skip-set.
+ * @return The number of characters at the start of the text that are in the set, only complete blocks are counted.
+ */
+hi_target("sse2,ssse3,sse4.1,avx,avx2") [[nodiscard]] inline std::size_t
+lexer_skip_avx2(char const *ptr, std::size_t size, lexer_skip_set_type const& set) noexcept
+{
+    auto const set_ = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(set.data())));
+    auto const bits = _mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, char_cast<char>(uint8_t{128}), 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 2, 4, 8, 16, 32, 64, char_cast<char>(uint8_t{128}), 0, 0, 0, 0, 0, 0, 0, 0);
+    auto const nibble_mask = _mm256_set1_epi8(0x0f);
+
+    auto i = 0_uz;
+    for (; i + 32 <= size; i += 32) {
+        auto const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr + i));
+        auto const row = _mm256_shuffle_epi8(set_, _mm256_and_si256(input, nibble_mask));
+        auto const bit = _mm256_shuffle_epi8(bits, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble_mask));
+        auto const not_in_set = _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), _mm256_setzero_si256());
+        if (auto const mask = truncate<uint32_t>(_mm256_movemask_epi8(not_in_set))) {
+            return i + std::countr_zero(mask);
+        }
+    }
+    return i;
+}
+#endif
+
+/** Count the number of leading characters that are in the skip-set.
+ *
+ * @param ptr A pointer to the text.
+ * @param size The number of characters in the text.
+ * @param set The skip-set.
+ * @return The number of characters at the start of the text that are in the set.
+ */
+[[nodiscard]] inline std::size_t lexer_skip(char const *ptr, std::size_t size, lexer_skip_set_type const& set) noexcept
+{
+    auto i = 0_uz;
+#if HI_PROCESSOR == HI_CPU_X86_64
+    if (has_avx2()) {
+        i = lexer_skip_avx2(ptr, size, set);
+    } else if (has_ssse3()) {
+        i = lexer_skip_ssse3(ptr, size, set);
+    }
+#endif
+
+    // The SIMD functions stop at the first character not in the set, or before the incomplete tail.
+    while (i != size and lexer_skip_set_contains(set, ptr[i])) {
+        ++i;
+    }
+    return i;
+}
+
 /** A configurable lexical analyzer with unicode Annex #31 support.
  */
 template<lexer_config Config>
@@ -392,6 +512,19 @@ public:
                 command.next_state = idle;
             }
         }
+
+        // Characters that only get captured while staying in the same state can be skipped in bulk.
+        for (uint8_t i = 0; i != std::to_underlying(_size); ++i) {
+            auto const state = static_cast<state_type>(i);
+            for (uint8_t c = 1; c != 128; ++c) {
+                auto const& command = get_command(state, char_cast<char>(c));
+                if (command.next_state == state and command.emit_token == token::none and
+                    command.char_to_capture == char_cast<char>(c) and command.advance and not command.clear and
+                    not command.advance_line and not command.advance_tab) {
+                    _skip_sets[i][c & 0xf] |= truncate<uint8_t>(1 << (c >> 4));
+                }
+            }
+        }
     }
 
     [[nodiscard]] constexpr command_type& get_command(state_type from, char c) noexcept
@@ -404,6 +537,13 @@ public:
         return _transition_table[std::to_underlying(from) * 128_uz + char_cast<size_t>(c)];
     }
 
+    /** Get the characters that can be skipped in bulk in a state.
+     */
+    [[nodiscard]] constexpr lexer_skip_set_type const& get_skip_set(state_type state) const noexcept
+    {
+        return _skip_sets[std::to_underlying(state)];
+    }
+
     struct proxy {
         using value_type = token;
         using reference = value_type const&;
@@ -671,6 +811,38 @@ public:
             }
         }
 
+        /** Skip over a run of characters which are captured while staying in the same state.
+         *
+         * This is a fast path for white-space, identifiers, numbers, strings and comments
+         * which does the same as calling `process_command()` for each character of the run.
+         *
+         * @param c The current ASCII character.
+         * @return True if the characters were skipped, false if @a c needs to be processed.
+         */
+        [[nodiscard]] bool skip_run(char c) noexcept
+        {
+            if constexpr (
+                std::contiguous_iterator<It> and std::sized_sentinel_for<ItEnd, It> and sizeof(std::iter_value_t<It>) == 1) {
+                auto const& set = _lexer->get_skip_set(_state);
+                if (not lexer_skip_set_contains(set, c)) {
+                    return false;
+                }
+
+                auto const ptr = reinterpret_cast<char const *>(std::to_address(_it));
+                auto const n = lexer_skip(ptr, narrow_cast<std::size_t>(_last - _it), set);
+
+                capture(c);
+                _token.capture.insert(_token.capture.end(), ptr, ptr + n);
+                _column_nr += n + 1;
+                _it += narrow_cast<std::iter_difference_t<It>>(n);
+                _cp = advance();
+                return true;
+
+            } else {
+                return false;
+            }
+        }
+
         [[nodiscard]] constexpr token::kind_type process_command(char c = '\0') noexcept
         {
             auto const command = _lexer->get_command(_state, c);
@@ -709,6 +881,10 @@ public:
 
             while (_cp <= 0x7fff'ffff) {
                 if (_cp <= 0x7f) {
+                    if (not std::is_constant_evaluated() and skip_run(char_cast<char>(_cp))) {
+                        continue;
+                    }
+
                     if (auto token_kind = process_command(char_cast<char>(_cp)); token_kind != token::none) {
                         return token_kind;
                     }
@@ -770,6 +946,10 @@ private:
 
     transition_table_type _transition_table;
 
+    /** For each state the characters that can be skipped in bulk.
+     */
+    std::array<lexer_skip_set_type, std::to_underlying(state_type::_size)> _skip_sets = {};
+
     constexpr void add_string_literal(
         char c,
         token::kind_type string_token,
@@ -1255,3 +1435,5 @@ template<lexer_config Config>
 constexpr auto lexer = detail::lexer<Config>();
 
 }} // namespace hi::v1
+
+hi_warning_pop();
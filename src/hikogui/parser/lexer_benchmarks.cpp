@@ -0,0 +1,78 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "lexer.hpp"
+#include "../file/file.hpp"
+#include "../path/path.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <filesystem>
+#include <format>
+#include <string>
+#include <string_view>
+#include <iterator>
+#include <cstddef>
+
+/** A large indented JSON document with long strings, identifiers and numbers.
+ */
+[[nodiscard]] static std::string lexer_benchmark_JSON_text()
+{
+    auto r = std::string{"{\n    \"version\": 1,\n    \"records\": [\n"};
+    for (auto i = 0; i != 2000; ++i) {
+        r += std::format(
+            "        {{\n"
+            "            \"identifier\": {},\n"
+            "            \"description\": \"A somewhat longer description of record number {} in the table\",\n"
+            "            \"value\": 1234567.{},\n"
+            "            \"enabled\": {},\n"
+            "            \"parent\": null\n"
+            "        }}{}\n",
+            i,
+            i,
+            i * 3,
+            i % 2 == 0 ? "true" : "false",
+            i == 1999 ? "" : ",");
+    }
+    r += "    ]\n}\n";
+    return r;
+}
+
+template<hi::lexer_config Config>
+[[nodiscard]] static std::size_t lexer_benchmark_count_tokens(std::string_view text) noexcept
+{
+    auto r = std::size_t{0};
+    for (auto it = hi::lexer<Config>.parse(text); it != std::default_sentinel; ++it) {
+        ++r;
+    }
+    return r;
+}
+
+hi_benchmark(lexer_JSON)
+{
+    auto const text = lexer_benchmark_JSON_text();
+
+    state.set_bytes_per_iteration(text.size());
+    while (state.running()) {
+        hi::do_not_optimize(lexer_benchmark_count_tokens<hi::lexer_config::json_style()>(text));
+    }
+}
+
+hi_benchmark(lexer_theme)
+{
+    auto const path = hi::library_source_dir() / "resources" / "hikogui_light.theme.json";
+    if (not std::filesystem::exists(path)) {
+        return state.skip("The theme file is not available.");
+    }
+
+    // Repeat the theme file to get a text that is large compared to the setup of the lexer.
+    auto const view = hi::file_view{path};
+    auto text = std::string{};
+    for (auto i = 0; i != 100; ++i) {
+        text += as_string_view(view);
+    }
+
+    state.set_bytes_per_iteration(text.size());
+    while (state.running()) {
+        hi::do_not_optimize(lexer_benchmark_count_tokens<hi::lexer_config::json_style()>(text));
+    }
+}
@@ -4,6 +4,7 @@
 
 #include "lexer.hpp"
 #include <hikotest/hikotest.hpp>
+#include <string>
 
 TEST_SUITE(lexer_suite) {
 
@@ -744,4 +745,26 @@ TEST_CASE(operator_eq_eq)
     REQUIRE(it == std::default_sentinel);
 }
 
+TEST_CASE(long_runs)
+{
+    // Runs longer than a SIMD block are skipped in bulk, they should result in the same tokens and column-numbers.
+    constexpr auto c_lexer = hi::detail::lexer<hi::lexer_config::c_style()>{};
+
+    auto const id = std::string(70, 'x') + "_0123456789";
+    auto const number = std::string(40, '7');
+    auto const text = id + std::string(50, ' ') + number + " \"" + std::string(33, 'a') + "\\n" + std::string(17, 'b') +
+        "\" /* " + std::string(45, '*') + "aéb */";
+
+    auto it = c_lexer.parse(text);
+    REQUIRE(*it == hi::token(hi::token::id, id, 0));
+    ++it;
+    REQUIRE(*it == hi::token(hi::token::integer, number, 131));
+    ++it;
+    REQUIRE(*it == hi::token(hi::token::dstr, std::string(33, 'a') + "\\n" + std::string(17, 'b'), 172));
+    ++it;
+    REQUIRE(*it == hi::token(hi::token::bcomment, " " + std::string(45, '*') + "aéb ", 227));
+    ++it;
+    REQUIRE(it == std::default_sentinel);
+}
+
 };
@@ -25,6 +25,8 @@ hi_export_module(hikogui.path.URI);
 
 hi_export namespace hi { inline namespace v1 {
 
+class URI_view;
+
 #define HI_SUB_DELIM '!', '$', '&', '\'', '(', ')', '*', '+', ',', ';', '='
 #define HI_PCHAR HI_SUB_DELIM, ':', '@'
 
@@ -148,11 +150,13 @@ public:
         std::string _host = {};
         std::optional<std::string> _port = {};
 
+        friend URI_view;
+
         constexpr static void validate_host(std::string_view str)
         {
             if (str.starts_with('[') and not str.ends_with(']')) {
                 throw uri_error("The host-component starts with '[' has missing ']' at end");
-            } else if (str.ends_with(']') and str.starts_with('[')) {
+            } else if (str.ends_with(']') and not str.starts_with('[')) {
                 throw uri_error("The host-component ends with ']' has missing '[' at start");
             }
         }
@@ -200,7 +204,7 @@ public:
 
             auto it = first;
             if (*it == '[') {
-                while (it != last) {
+                for (; it != last; ++it) {
                     if (*it == ']') {
                         set_host(URI::decode(first, it + 1));
                         return it + 1; // Skip over ']'.
@@ -966,6 +970,7 @@ private:
     }
 
     friend struct std::hash<URI>;
+    friend URI_view;
 };
 
 #undef HI_PCHAR
@@ -0,0 +1,315 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file path/URI_view.hpp Defines the URI_view class.
+ * @ingroup path
+ */
+
+#pragma once
+
+#include "URI.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <optional>
+#include <compare>
+#include <algorithm>
+
+hi_export_module(hikogui.path.URI_view);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A view of a Uniform Resource Identifier.
+ * @ingroup path
+ *
+ * The URI is split into its components in a single pass over the string,
+ * without allocating. The components are views into the original string,
+ * which must outlive the URI_view.
+ *
+ * The components are returned still percent-encoded, the `decoded_*()`
+ * functions decode a component on each call. `normalize()` converts the
+ * view to a `URI`, which decodes and normalizes all the components.
+ */
+class URI_view {
+public:
+    constexpr URI_view() noexcept = default;
+    constexpr URI_view(URI_view const&) noexcept = default;
+    constexpr URI_view(URI_view&&) noexcept = default;
+    constexpr URI_view& operator=(URI_view const&) noexcept = default;
+    constexpr URI_view& operator=(URI_view&&) noexcept = default;
+
+    /** Split a string into the components of a URI.
+     *
+     * @param str A URI encoded as a string, which must outlive the view.
+     * @throws uri_error When the scheme, host or port are invalid.
+     */
+    constexpr explicit URI_view(std::string_view str) : _str(str)
+    {
+        parse();
+    }
+
+    /** Split a string into the components of a URI.
+     *
+     * @param str A URI encoded as a string, which must outlive the view.
+     * @throws uri_error When the scheme, host or port are invalid.
+     */
+    constexpr explicit URI_view(char const *str) : URI_view(std::string_view{str}) {}
+
+    constexpr URI_view(std::string&&) = delete;
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _str.empty();
+    }
+
+    constexpr operator bool() const noexcept
+    {
+        return not empty();
+    }
+
+    /** The string that was split.
+     */
+    [[nodiscard]] constexpr std::string_view string() const noexcept
+    {
+        return _str;
+    }
+
+    /** Get the scheme-component of the URI.
+     *
+     * The scheme is never percent-encoded.
+     */
+    [[nodiscard]] constexpr std::optional<std::string_view> scheme() const noexcept
+    {
+        return _scheme;
+    }
+
+    /** Get the percent-encoded authority-component of the URI.
+     */
+    [[nodiscard]] constexpr std::optional<std::string_view> authority() const noexcept
+    {
+        return _authority;
+    }
+
+    /** Get the percent-encoded userinfo of the authority-component.
+     */
+    [[nodiscard]] constexpr std::optional<std::string_view> userinfo() const noexcept
+    {
+        return _userinfo;
+    }
+
+    /** Get the percent-encoded host of the authority-component.
+     *
+     * @return The host, or an empty string if the URI has no authority-component.
+     */
+    [[nodiscard]] constexpr std::string_view host() const noexcept
+    {
+        return _host;
+    }
+
+    /** Get the port of the authority-component.
+     *
+     * The port only contains digits.
+     */
+    [[nodiscard]] constexpr std::optional<std::string_view> port() const noexcept
+    {
+        return _port;
+    }
+
+    /** Get the percent-encoded path-component of the URI.
+     */
+    [[nodiscard]] constexpr std::string_view path() const noexcept
+    {
+        return _path;
+    }
+
+    /** Get the percent-encoded query-component of the URI.
+     */
+    [[nodiscard]] constexpr std::optional<std::string_view> query() const noexcept
+    {
+        return _query;
+    }
+
+    /** Get the percent-encoded fragment-component of the URI.
+     */
+    [[nodiscard]] constexpr std::optional<std::string_view> fragment() const noexcept
+    {
+        return _fragment;
+    }
+
+    [[nodiscard]] constexpr std::optional<std::string> decoded_userinfo() const
+    {
+        return decode(_userinfo);
+    }
+
+    /** Get the decoded and lower-cased host.
+     */
+    [[nodiscard]] constexpr std::string decoded_host() const
+    {
+        return to_lower(URI::decode(_host));
+    }
+
+    /** Get the decoded path-segments.
+     *
+     * @see URI::path_type
+     */
+    [[nodiscard]] constexpr URI::path_type decoded_path() const
+    {
+        return URI::path_type{_path};
+    }
+
+    [[nodiscard]] constexpr std::optional<std::string> decoded_query() const
+    {
+        return decode(_query);
+    }
+
+    [[nodiscard]] constexpr std::optional<std::string> decoded_fragment() const
+    {
+        return decode(_fragment);
+    }
+
+    /** Get the decoded filename, the last segment of the path.
+     *
+     * @see URI::path_type::filename()
+     */
+    [[nodiscard]] constexpr std::optional<std::string> filename() const
+    {
+        auto const i = _path.rfind('/');
+        auto const segment = i == std::string_view::npos ? _path : _path.substr(i + 1);
+
+        if (segment.empty() or segment == "." or segment == ".." or segment == "**") {
+            // ".", ".." and "**" are always directories.
+            return std::nullopt;
+        } else {
+            return URI::decode(segment);
+        }
+    }
+
+    /** Convert to a URI.
+     *
+     * The components are decoded and normalized in the same way as when
+     * a URI is constructed from the string.
+     *
+     * @throws uri_error When the URI can not be normalized.
+     */
+    [[nodiscard]] constexpr URI normalize() const
+    {
+        auto r = URI{};
+        if (_scheme) {
+            r.set_scheme(std::string{*_scheme});
+        }
+        if (_authority) {
+            r.set_authority(URI::authority_type{*_authority});
+        }
+        r.set_path(URI::path_type{_path});
+        r.set_query(decode(_query));
+        r.set_fragment(decode(_fragment));
+        return r;
+    }
+
+    /** Compare the strings of two URI views.
+     *
+     * @note The URIs are compared without normalization.
+     */
+    [[nodiscard]] constexpr friend bool operator==(URI_view const& lhs, URI_view const& rhs) noexcept
+    {
+        return lhs._str == rhs._str;
+    }
+
+    /** Compare the strings of two URI views.
+     *
+     * @note The URIs are compared without normalization.
+     */
+    [[nodiscard]] constexpr friend auto operator<=>(URI_view const& lhs, URI_view const& rhs) noexcept
+    {
+        return lhs._str <=> rhs._str;
+    }
+
+private:
+    std::string_view _str = {};
+    std::optional<std::string_view> _scheme = {};
+    std::optional<std::string_view> _authority = {};
+    std::optional<std::string_view> _userinfo = {};
+    std::string_view _host = {};
+    std::optional<std::string_view> _port = {};
+    std::string_view _path = {};
+    std::optional<std::string_view> _query = {};
+    std::optional<std::string_view> _fragment = {};
+
+    [[nodiscard]] constexpr static std::optional<std::string> decode(std::optional<std::string_view> const& rhs)
+    {
+        if (rhs) {
+            return URI::decode(*rhs);
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    constexpr void parse_authority(std::string_view str)
+    {
+        if (auto const i = str.find('@'); i != std::string_view::npos) {
+            _userinfo = str.substr(0, i);
+            str = str.substr(i + 1);
+        }
+
+        auto host_size = 0_uz;
+        if (str.starts_with('[')) {
+            host_size = str.find(']');
+            if (host_size == std::string_view::npos) {
+                throw uri_error("The host-component starts with '[' has missing ']' at end");
+            }
+            // Include the ']'.
+            ++host_size;
+        } else {
+            host_size = std::min(str.find(':'), str.size());
+        }
+
+        _host = str.substr(0, host_size);
+        str = str.substr(host_size);
+
+        if (str.starts_with(':')) {
+            _port = str.substr(1);
+            URI::authority_type::validate_port(*_port);
+        }
+    }
+
+    constexpr void parse()
+    {
+        auto str = _str;
+
+        if (auto const i = str.find_first_of(":/?#"); i != std::string_view::npos and str[i] == ':') {
+            _scheme = str.substr(0, i);
+            URI::validate_scheme(*_scheme);
+            str = str.substr(i + 1);
+        }
+
+        if (str.starts_with("//")) {
+            str = str.substr(2);
+
+            auto const i = std::min(str.find_first_of("/?#"), str.size());
+            _authority = str.substr(0, i);
+            parse_authority(*_authority);
+            str = str.substr(i);
+        }
+
+        // The path can never start with "//" without an authority, because
+        // that is parsed as an authority. And after an authority the path
+        // is empty or starts with '/', so the path is always valid.
+        auto const path_size = std::min(str.find_first_of("?#"), str.size());
+        _path = str.substr(0, path_size);
+        str = str.substr(path_size);
+
+        if (str.starts_with('?')) {
+            auto const i = std::min(str.find('#'), str.size());
+            _query = str.substr(1, i - 1);
+            str = str.substr(i);
+        }
+
+        if (str.starts_with('#')) {
+            _fragment = str.substr(1);
+        }
+    }
+};
+
+}} // namespace hi::v1
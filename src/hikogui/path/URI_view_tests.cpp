@@ -0,0 +1,87 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "URI_view.hpp"
+#include <hikotest/hikotest.hpp>
+
+TEST_SUITE(URI_view) {
+
+TEST_CASE(components)
+{
+    auto const u = hi::URI_view("http://user%20name@Example.com:8080/a%20b/c.txt?x=1%202#frag%21");
+    REQUIRE(u.scheme() == "http");
+    REQUIRE(u.authority() == "user%20name@Example.com:8080");
+    REQUIRE(u.userinfo() == "user%20name");
+    REQUIRE(u.host() == "Example.com");
+    REQUIRE(u.port() == "8080");
+    REQUIRE(u.path() == "/a%20b/c.txt");
+    REQUIRE(u.query() == "x=1%202");
+    REQUIRE(u.fragment() == "frag%21");
+
+    REQUIRE(u.decoded_userinfo() == "user name");
+    REQUIRE(u.decoded_host() == "example.com");
+    REQUIRE(u.decoded_query() == "x=1 2");
+    REQUIRE(u.decoded_fragment() == "frag!");
+    REQUIRE(u.filename() == "c.txt");
+}
+
+TEST_CASE(no_authority)
+{
+    auto const u = hi::URI_view("resource:fonts/Noto%20Sans.ttf");
+    REQUIRE(u.scheme() == "resource");
+    REQUIRE(not u.authority());
+    REQUIRE(u.host() == "");
+    REQUIRE(u.path() == "fonts/Noto%20Sans.ttf");
+    REQUIRE(not u.query());
+    REQUIRE(not u.fragment());
+    REQUIRE(u.filename() == "Noto Sans.ttf");
+
+    auto const path = u.decoded_path();
+    REQUIRE(path.size() == 2);
+    REQUIRE(path[0] == "fonts");
+    REQUIRE(path[1] == "Noto Sans.ttf");
+}
+
+TEST_CASE(relative)
+{
+    auto const u = hi::URI_view("dir/../file?#");
+    REQUIRE(not u.scheme());
+    REQUIRE(u.path() == "dir/../file");
+    REQUIRE(u.query() == "");
+    REQUIRE(u.fragment() == "");
+
+    REQUIRE(hi::URI_view("dir/..").filename() == std::nullopt);
+    REQUIRE(hi::URI_view("dir/").filename() == std::nullopt);
+}
+
+TEST_CASE(ip_literal)
+{
+    auto const u = hi::URI_view("http://[::1]:80/");
+    REQUIRE(u.host() == "[::1]");
+    REQUIRE(u.port() == "80");
+    REQUIRE(u.path() == "/");
+}
+
+TEST_CASE(invalid)
+{
+    REQUIRE_THROWS(hi::URI_view("1http://example.com/"), hi::uri_error);
+    REQUIRE_THROWS(hi::URI_view("http://example.com:80a/"), hi::uri_error);
+    REQUIRE_THROWS(hi::URI_view("http://[::1/"), hi::uri_error);
+}
+
+TEST_CASE(normalize)
+{
+    for (auto const str : {
+             "file:///C:/Program%20Files/RenderDoc/",
+             "file:foo/bar.txt",
+             "http://user@Example.com:8080/a%20b/c.txt?x=1%202#frag",
+             "http://[::1]:80/",
+             "resource:fonts/Noto%20Sans.ttf",
+             "../a/./b",
+             ""}) {
+        REQUIRE(hi::URI_view(str).normalize() == hi::URI(str));
+    }
+}
+
+};
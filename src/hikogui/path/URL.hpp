@@ -9,6 +9,7 @@
 #pragma once
 
 #include "URI.hpp"
+#include "URI_view.hpp"
 #include "path_location.hpp"
 #include "../char_maps/char_maps.hpp"
 #include "../utility/utility.hpp"
@@ -73,6 +74,13 @@ public:
      */
     constexpr explicit URL(URI&& other) noexcept : URI(std::move(other)){};
 
+    /** Convert a URI_view to an URL.
+     *
+     * @note This constructor will normalize the URI
+     * @throws uri_error When the URI can not be normalized.
+     */
+    constexpr explicit URL(URI_view const& other) : URI(other.normalize()) {}
+
     /** Construct a URI from a string.
      *
      * @note This constructor will normalize the URI
@@ -15,6 +15,9 @@
 #include <variant>
 #include <type_traits>
 #include <coroutine>
+#include <optional>
+#include <algorithm>
+#include <cstddef>
 
 /** @file path/glob.hpp Defines utilities for handling glob patterns.
  * @ingroup path
@@ -206,6 +209,29 @@ public:
         return path;
     }
 
+    /** Get the maximum number of slashes in a string that matches the pattern.
+     *
+     * This is used to stop recursively iterating into directories
+     * that are too deep to match the pattern.
+     *
+     * @return The maximum number of slashes, or std::nullopt if the pattern
+     *         contains a `**` which matches any number of directories.
+     */
+    [[nodiscard]] constexpr std::optional<std::size_t> max_num_slashes() const noexcept
+    {
+        auto r = 0_uz;
+        for (auto const& token : _tokens) {
+            if (token.is_any_directory()) {
+                return std::nullopt;
+            }
+
+            // The textual form of a token includes the slashes of every
+            // alternative, which is more than or equal to what the token matches.
+            r += narrow_cast<std::size_t>(std::ranges::count(token.u32string(), U'/'));
+        }
+        return r;
+    }
+
     /** Match the pattern with the given string.
      *
      * @param str The string to match with this pattern.
@@ -35,4 +35,13 @@ TEST_CASE(parse)
     REQUIRE(hi::glob_pattern{"/**/world"}.debug_string() == "/**/'world'");
 }
 
+TEST_CASE(max_num_slashes)
+{
+    REQUIRE(hi::glob_pattern{"world"}.max_num_slashes() == 0);
+    REQUIRE(hi::glob_pattern{"hello/w*rld"}.max_num_slashes() == 1);
+    REQUIRE(hi::glob_pattern{"/hello/*/world"}.max_num_slashes() == 3);
+    REQUIRE(hi::glob_pattern{"hello/{a/b,c}/world"}.max_num_slashes() == 3);
+    REQUIRE(hi::glob_pattern{"hello/**/world"}.max_num_slashes() == std::nullopt);
+}
+
 };
@@ -5,6 +5,7 @@
 #include "glob.hpp" // export
 #include "path_location.hpp" // export
 #include "URI.hpp" // export
+#include "URI_view.hpp" // export
 #include "URL.hpp" // export
 
 hi_export_module(hikogui.path);
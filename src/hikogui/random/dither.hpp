@@ -10,6 +10,13 @@
 #include <hikocpu/hikocpu.hpp>
 #include <iterator>
 #include <exception>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#if defined(HI_HAS_X86)
+#include <immintrin.h>
+#endif
 
 hi_export_module(hikogui.random.dither);
 
@@ -21,10 +28,17 @@ hi_export namespace hi::inline v1 {
  * this 9 bit TPDF is converted to floating point, which can be added to
  * the original floating point sample.
  *
- * We start of with 128 bit from an xorshift128p random number generated
- * that is split into 8 bit chunks, made into TPDF and converted to 8
+ * The scalar `next()` uses 64 bits from an xorshift128p random number
+ * generator, split into 8 bit chunks, made into TPDF and converted to 4
  * floating point values.
  *
+ * The vectorized `next_avx2()` and `next_avx512()` run 4 or 8 independent
+ * xorshift128p generators in parallel, one in each 64 bit lane, to
+ * create 16 or 32 floating point values per step.
+ *
+ * The portable `next_f32x8()` runs 4 generators in a `xorshift128p_x4`,
+ * where each 32 bits are split into two 16 bit RPDF to create 8 floating
+ * point values per step.
  */
 class dither {
 public:
@@ -49,27 +63,44 @@ public:
         // Triangular probability density function is has twice the range.
         maximum_value *= 2.0f;
 
-        _multiplier = f32x4::broadcast(1.0f / maximum_value);
+        _multiplier = 1.0f / maximum_value;
+        _multiplier16 = 1.0f / (static_cast<float>((1_uz << num_bits) - 1) * 32767.0f * 2.0f);
+
+        // Seed the parallel generators from the scalar generator, a xorshift128p
+        // state may not be zero.
+        for (auto& lane : _lanes) {
+            do {
+                lane = _state.next<uint64_t>();
+            } while (lane == 0);
+        }
+
+        auto s = u64x4{};
+        auto t = u64x4{};
+        for (auto i = 0_uz; i != 4; ++i) {
+            do {
+                s[i] = _state.next<uint64_t>();
+                t[i] = _state.next<uint64_t>();
+            } while (s[i] == 0 or t[i] == 0);
+        }
+        _parallel_state = xorshift128p_x4{s, t};
     }
 
-    /** Get 8 floating point number to add to a samples.
+    /** Get 4 floating point number to add to a samples.
      * The dither is a TPDF with the maximum being 2 quantization steps.
      */
     f32x4 next() noexcept
     {
-        hi_not_implemented();
-        return f32x4{};
-        //if (to_bool(++_counter & 1)) {
-        //    auto const rand = _state.next<u64x2>();
-        //    auto const spdf = i16x16{bit_cast<i8x16>(rand)};
-        //    auto const [spdf1, spdf2] = spdf.split<int16_t>();
-        //
-        //    _tpdf = spdf1 + spdf2;
-        //    return f32x4{i32x4{_tpdf}} * _multiplier;
-        //} else {
-        //    auto const second_tpdf = bit_cast<i16x8>(bit_cast<u64x2>(_tpdf).yx());
-        //    return f32x4{i32x4{second_tpdf}} * _multiplier;
-        //}
+        auto rand = _state.next<uint64_t>();
+
+        auto r = f32x4{};
+        for (auto i = 0_uz; i != 4; ++i) {
+            auto const rpdf1 = truncate<int8_t>(rand);
+            auto const rpdf2 = truncate<int8_t>(rand >> 8);
+            rand >>= 16;
+
+            r[i] = static_cast<float>(rpdf1 + rpdf2) * _multiplier;
+        }
+        return r;
     }
 
     /** Add dither to the given samples.
@@ -92,11 +123,104 @@ public:
         return get<0>(f32x4::broadcast(sample) + next());
     }
 
+    /** Get 8 floating point number to add to a samples.
+     * The dither is a TPDF with the maximum being 2 quantization steps.
+     */
+    [[nodiscard]] f32x8 next_f32x8() noexcept
+    {
+        auto const rand = std::bit_cast<i32x8>(_parallel_state.next());
+
+        // Each 32 bit word is split into two signed 16 bit RPDF which are added into a TPDF.
+        auto const rpdf1 = (rand << 16) >> 16;
+        auto const rpdf2 = rand >> 16;
+        return f32x8{rpdf1 + rpdf2} * f32x8::broadcast(_multiplier16);
+    }
+
+    /** Add dither to the given samples.
+     *
+     * @param samples The samples to add dithering to.
+     * @return The sample with included dither.
+     */
+    [[nodiscard]] f32x8 next(f32x8 samples) noexcept
+    {
+        return samples + next_f32x8();
+    }
+
+#if defined(HI_HAS_X86)
+    /** Get 16 floating point numbers to add to samples.
+     *
+     * @pre The CPU must support AVX2.
+     * @param[out] lo The first vector of 8 dither values.
+     * @param[out] hi The second vector of 8 dither values.
+     */
+    hi_target("sse,sse2,avx,avx2") void next_avx2(__m256& lo, __m256& hi) noexcept
+    {
+        auto s = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(_lanes.data()));
+        auto const t = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(_lanes.data() + 8));
+
+        s = _mm256_xor_si256(s, _mm256_slli_epi64(s, 23));
+        s = _mm256_xor_si256(s, _mm256_srli_epi64(s, 17));
+        s = _mm256_xor_si256(s, _mm256_xor_si256(t, _mm256_srli_epi64(t, 26)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(_lanes.data()), t);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(_lanes.data() + 8), s);
+        auto const rand = _mm256_add_epi64(s, t);
+
+        // Each 16 bit word is split into two signed 8 bit RPDF which are added into a TPDF.
+        auto const rpdf1 = _mm256_srai_epi16(_mm256_slli_epi16(rand, 8), 8);
+        auto const rpdf2 = _mm256_srai_epi16(rand, 8);
+        auto const tpdf = _mm256_add_epi16(rpdf1, rpdf2);
+
+        auto const multiplier = _mm256_set1_ps(_multiplier);
+        lo = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(tpdf)));
+        hi = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(tpdf, 1)));
+        lo = _mm256_mul_ps(lo, multiplier);
+        hi = _mm256_mul_ps(hi, multiplier);
+    }
+
+    /** Get 32 floating point numbers to add to samples.
+     *
+     * @pre The CPU must support AVX512F and AVX512BW.
+     * @param[out] lo The first vector of 16 dither values.
+     * @param[out] hi The second vector of 16 dither values.
+     */
+    hi_target("sse,sse2,avx,avx2,avx512f,avx512bw") void next_avx512(__m512& lo, __m512& hi) noexcept
+    {
+        auto s = _mm512_loadu_si512(_lanes.data());
+        auto const t = _mm512_loadu_si512(_lanes.data() + 8);
+
+        s = _mm512_xor_si512(s, _mm512_slli_epi64(s, 23));
+        s = _mm512_xor_si512(s, _mm512_srli_epi64(s, 17));
+        s = _mm512_xor_si512(s, _mm512_xor_si512(t, _mm512_srli_epi64(t, 26)));
+
+        _mm512_storeu_si512(_lanes.data(), t);
+        _mm512_storeu_si512(_lanes.data() + 8, s);
+        auto const rand = _mm512_add_epi64(s, t);
+
+        // Each 16 bit word is split into two signed 8 bit RPDF which are added into a TPDF.
+        auto const rpdf1 = _mm512_srai_epi16(_mm512_slli_epi16(rand, 8), 8);
+        auto const rpdf2 = _mm512_srai_epi16(rand, 8);
+        auto const tpdf = _mm512_add_epi16(rpdf1, rpdf2);
+
+        auto const multiplier = _mm512_set1_ps(_multiplier);
+        lo = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm512_castsi512_si256(tpdf)));
+        hi = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(tpdf, 1)));
+        lo = _mm512_mul_ps(lo, multiplier);
+        hi = _mm512_mul_ps(hi, multiplier);
+    }
+#endif
+
 private:
-    f32x4 _multiplier = {};
-    i16x8 _tpdf = {};
+    float _multiplier = 0.0f;
+    float _multiplier16 = 0.0f;
     xorshift128p _state = {};
-    unsigned char _counter = 0;
+    xorshift128p_x4 _parallel_state = {u64x4{}, u64x4{}};
+
+    /** The state of 8 parallel xorshift128p generators.
+     * The first 8 elements are the first half of the state of each generator,
+     * the last 8 elements are the second half.
+     */
+    std::array<uint64_t, 16> _lanes = {};
 };
 
 } // namespace hi::inline v1
@@ -56,4 +56,65 @@ private:
     u64x2 _state;
 };
 
+/** Multiple independent xorshift128+ generators in parallel.
+ *
+ * Each lane of the SIMD registers is a separate xorshift128+ generator, so
+ * that a single step produces @a N random 64 bit values.
+ *
+ * @tparam N The number of generators: 2, 4 or 8.
+ */
+template<std::size_t N>
+class xorshift128p_lanes {
+public:
+    using value_type = simd<uint64_t, N>;
+
+    constexpr xorshift128p_lanes(xorshift128p_lanes const &) noexcept = default;
+    constexpr xorshift128p_lanes(xorshift128p_lanes &&) noexcept = default;
+    constexpr xorshift128p_lanes &operator=(xorshift128p_lanes const &) noexcept = default;
+    constexpr xorshift128p_lanes &operator=(xorshift128p_lanes &&) noexcept = default;
+
+    /** Construct with an explicit state.
+     *
+     * Lane `i` produces the same sequence as `xorshift128p{u64x2{s[i], t[i]}}`.
+     */
+    [[nodiscard]] constexpr xorshift128p_lanes(value_type s, value_type t) noexcept : _s(s), _t(t) {}
+
+    /** Construct with a random state from `seed`.
+     */
+    [[nodiscard]] xorshift128p_lanes() noexcept : _s(), _t()
+    {
+        for (auto i = 0_uz; i != N; ++i) {
+            while (_s[i] == 0 or _t[i] == 0) {
+                auto const tmp = seed<u64x2>{}();
+                _s[i] = tmp.x();
+                _t[i] = tmp.y();
+            }
+        }
+    }
+
+    /** Get the next 64 bit random value of each generator.
+     */
+    [[nodiscard]] constexpr value_type next() noexcept
+    {
+        auto s = _s;
+        auto const t = _t;
+
+        s ^= s << 23; // a
+        s ^= s >> 17; // b
+        s ^= t ^ (t >> 26); // c
+
+        _s = t;
+        _t = s;
+        return s + t;
+    }
+
+private:
+    value_type _s;
+    value_type _t;
+};
+
+using xorshift128p_x2 = xorshift128p_lanes<2>;
+using xorshift128p_x4 = xorshift128p_lanes<4>;
+using xorshift128p_x8 = xorshift128p_lanes<8>;
+
 } // namespace hi::inline v1
@@ -4,9 +4,30 @@
 
 #include "xorshift128p.hpp"
 #include <hikotest/hikotest.hpp>
+#include <array>
 
 TEST_SUITE(xorshift128p) {
 
+TEST_CASE(lanes_match_scalar)
+{
+    auto const s = hi::u64x4{1, 0x1234'5678'9abc'def0, 42, 0xffff'ffff'ffff'ffff};
+    auto const t = hi::u64x4{2, 0x0fed'cba9'8765'4321, 7, 0x8000'0000'0000'0000};
+
+    auto lanes = hi::xorshift128p_x4{s, t};
+    auto scalars = std::array<hi::xorshift128p, 4>{
+        hi::xorshift128p{hi::u64x2{s[0], t[0]}},
+        hi::xorshift128p{hi::u64x2{s[1], t[1]}},
+        hi::xorshift128p{hi::u64x2{s[2], t[2]}},
+        hi::xorshift128p{hi::u64x2{s[3], t[3]}}};
+
+    for (auto i = 0; i != 1000; ++i) {
+        auto const r = lanes.next();
+        for (auto j = 0; j != 4; ++j) {
+            REQUIRE(r[j] == scalars[j].next<uint64_t>());
+        }
+    }
+}
+
 //TEST(xorshift128p, compare_64_and_128_bits)
 //{
 //    auto r1 = hi::xorshift128p();
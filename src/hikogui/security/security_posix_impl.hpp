@@ -0,0 +1,21 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "security_intf.hpp"
+#include "../macros.hpp"
+#include <string.h>
+
+hi_export_module(hikogui.security : impl);
+
+hi_export namespace hi::inline v1 {
+
+inline void secure_clear(void *ptr, size_t size) noexcept
+{
+    // explicit_bzero() is not optimized away when the memory is not read afterwards.
+    explicit_bzero(ptr, size);
+}
+
+}
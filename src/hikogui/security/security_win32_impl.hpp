@@ -10,7 +10,7 @@
 
 hi_export_module(hikogui.security : impl);
 
-namespace tt::inline v1 {
+hi_export namespace hi::inline v1 {
 
 
 inline void secure_clear(void *ptr, size_t size) noexcept
@@ -7,10 +7,17 @@
 #include "../random/random.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
+#if HI_PROCESSOR == HI_CPU_X86_64
+#include <immintrin.h>
+#endif
 #include <string_view>
 #include <string>
 #include <span>
 #include <bit>
+#include <array>
+#include <algorithm>
+#include <type_traits>
 
 hi_export_module(hikogui.security.sip_hash);
 
@@ -30,6 +37,138 @@ inline auto sip_hash_seed = sip_hash_seed_type();
 
 struct sip_hash_seed_tag {};
 
+/** Get a word of a message to compress.
+ *
+ * @param src The message.
+ * @param size The size of the message in bytes.
+ * @param i The index of the word.
+ * @return The word; for the last word the tail of the message and its size.
+ *         Words beyond the last word are zero.
+ */
+[[nodiscard]] hi_force_inline inline uint64_t sip_hash_word(char const *src, std::size_t size, std::size_t i) noexcept
+{
+    if (i < size / 8) {
+        return load_le<uint64_t>(src + i * 8);
+
+    } else if (i == size / 8) {
+        auto m = wide_cast<uint64_t>(size & 0xff) << 56;
+        for (auto j = 0_uz; j != (size & 7); ++j) {
+            m |= char_cast<uint64_t>(src[i * 8 + j]) << (j * CHAR_BIT);
+        }
+        return m;
+
+    } else {
+        return 0;
+    }
+}
+
+#if HI_PROCESSOR == HI_CPU_X86_64
+template<int N>
+hi_target("avx2") hi_force_inline inline __m256i sip_hash_rotl_avx2(__m256i x) noexcept
+{
+    if constexpr (N == 32) {
+        return _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    } else if constexpr (N == 16) {
+        return _mm256_shuffle_epi8(
+            x, _mm256_setr_epi8(6, 7, 0, 1, 2, 3, 4, 5, 14, 15, 8, 9, 10, 11, 12, 13, 6, 7, 0, 1, 2, 3, 4, 5, 14, 15, 8, 9, 10, 11, 12, 13));
+    } else {
+        return _mm256_or_si256(_mm256_slli_epi64(x, N), _mm256_srli_epi64(x, 64 - N));
+    }
+}
+
+hi_target("avx2") hi_force_inline inline void sip_hash_round_avx2(__m256i& v0, __m256i& v1, __m256i& v2, __m256i& v3) noexcept
+{
+    v0 = _mm256_add_epi64(v0, v1);
+    v2 = _mm256_add_epi64(v2, v3);
+    v1 = sip_hash_rotl_avx2<13>(v1);
+    v3 = sip_hash_rotl_avx2<16>(v3);
+    v1 = _mm256_xor_si256(v1, v0);
+    v3 = _mm256_xor_si256(v3, v2);
+    v0 = sip_hash_rotl_avx2<32>(v0);
+
+    v0 = _mm256_add_epi64(v0, v3);
+    v2 = _mm256_add_epi64(v2, v1);
+    v1 = sip_hash_rotl_avx2<17>(v1);
+    v3 = sip_hash_rotl_avx2<21>(v3);
+    v1 = _mm256_xor_si256(v1, v2);
+    v3 = _mm256_xor_si256(v3, v0);
+    v2 = sip_hash_rotl_avx2<32>(v2);
+}
+
+/** Hash four complete messages in parallel, one in each 64-bit lane.
+ *
+ * Each lane stops compressing after its own last word, so that the messages
+ * may have different sizes.
+ *
+ * @param v The initial state, the same for each message.
+ * @param ptrs The messages.
+ * @param sizes The size of each message in bytes.
+ * @param[out] hashes The hash of each message.
+ */
+template<std::size_t C, std::size_t D>
+hi_target("avx2") inline void sip_hash_x4_avx2(
+    std::array<uint64_t, 4> const& v,
+    std::array<char const *, 4> const& ptrs,
+    std::array<std::size_t, 4> const& sizes,
+    uint64_t *hashes) noexcept
+{
+    auto v0 = _mm256_set1_epi64x(std::bit_cast<long long>(v[0]));
+    auto v1 = _mm256_set1_epi64x(std::bit_cast<long long>(v[1]));
+    auto v2 = _mm256_set1_epi64x(std::bit_cast<long long>(v[2]));
+    auto v3 = _mm256_set1_epi64x(std::bit_cast<long long>(v[3]));
+
+    // The number of whole words in each message; the last word holds the tail and the size.
+    auto const nr_words = std::array<std::size_t, 4>{sizes[0] / 8, sizes[1] / 8, sizes[2] / 8, sizes[3] / 8};
+    auto const max_nr_words = std::max(std::max(nr_words[0], nr_words[1]), std::max(nr_words[2], nr_words[3]));
+
+    // A lane is active while its word index is less than or equal to its number of whole words.
+    auto const last_word = _mm256_set_epi64x(
+        narrow_cast<long long>(nr_words[3]),
+        narrow_cast<long long>(nr_words[2]),
+        narrow_cast<long long>(nr_words[1]),
+        narrow_cast<long long>(nr_words[0]));
+    auto const all_active = nr_words[0] == nr_words[1] and nr_words[0] == nr_words[2] and nr_words[0] == nr_words[3];
+
+    for (auto i = 0_uz; i <= max_nr_words; ++i) {
+        auto const m = _mm256_set_epi64x(
+            std::bit_cast<long long>(sip_hash_word(ptrs[3], sizes[3], i)),
+            std::bit_cast<long long>(sip_hash_word(ptrs[2], sizes[2], i)),
+            std::bit_cast<long long>(sip_hash_word(ptrs[1], sizes[1], i)),
+            std::bit_cast<long long>(sip_hash_word(ptrs[0], sizes[0], i)));
+
+        auto n0 = v0;
+        auto n1 = v1;
+        auto n2 = v2;
+        auto n3 = _mm256_xor_si256(v3, m);
+        for (auto j = 0_uz; j != C; ++j) {
+            sip_hash_round_avx2(n0, n1, n2, n3);
+        }
+        n0 = _mm256_xor_si256(n0, m);
+
+        if (all_active) {
+            v0 = n0;
+            v1 = n1;
+            v2 = n2;
+            v3 = n3;
+        } else {
+            auto const mask = _mm256_cmpgt_epi64(_mm256_add_epi64(last_word, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(narrow_cast<long long>(i)));
+            v0 = _mm256_blendv_epi8(v0, n0, mask);
+            v1 = _mm256_blendv_epi8(v1, n1, mask);
+            v2 = _mm256_blendv_epi8(v2, n2, mask);
+            v3 = _mm256_blendv_epi8(v3, n3, mask);
+        }
+    }
+
+    v2 = _mm256_xor_si256(v2, _mm256_set1_epi64x(0xff));
+    for (auto j = 0_uz; j != D; ++j) {
+        sip_hash_round_avx2(v0, v1, v2, v3);
+    }
+
+    auto const r = _mm256_xor_si256(_mm256_xor_si256(v0, v1), _mm256_xor_si256(v2, v3));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(hashes), r);
+}
+#endif
+
 } // namespace detail
 
 template<size_t C, size_t D>
@@ -145,6 +284,108 @@ public:
      * @note The `sip_hash` instance can be reused when using this function
      */
     [[nodiscard]] uint64_t complete_message(void const *data, size_t size) const noexcept
+    {
+        return _complete_message(data, size);
+    }
+
+    /** Hash a complete message of a size known at compile time.
+     *
+     * For keys like integers and small structs the loop over the words and
+     * the handling of the tail are resolved at compile time.
+     *
+     * @tparam Size The size of the data in bytes.
+     * @param data The data to hash.
+     * @return The value of the hash.
+     */
+    template<size_t Size>
+    [[nodiscard]] uint64_t complete_message(void const *data) const noexcept
+    {
+        return _complete_message(data, Size);
+    }
+
+    /** Hash many complete messages.
+     *
+     * On CPUs with AVX2 four messages are hashed in parallel, which is
+     * faster than hashing many short messages one at a time.
+     *
+     * @param messages The messages to hash.
+     * @param[out] hashes The hash of each message.
+     */
+    void complete_messages(std::span<std::string_view const> messages, std::span<uint64_t> hashes) const noexcept
+    {
+        hi_axiom(messages.size() == hashes.size());
+
+        auto i = 0_uz;
+#if HI_PROCESSOR == HI_CPU_X86_64
+        if (has_avx2()) {
+            for (; i + 4 <= messages.size(); i += 4) {
+                auto const ptrs = std::array<char const *, 4>{
+                    messages[i].data(), messages[i + 1].data(), messages[i + 2].data(), messages[i + 3].data()};
+                auto const sizes = std::array<std::size_t, 4>{
+                    messages[i].size(), messages[i + 1].size(), messages[i + 2].size(), messages[i + 3].size()};
+                detail::sip_hash_x4_avx2<C, D>({_v0, _v1, _v2, _v3}, ptrs, sizes, hashes.data() + i);
+            }
+        }
+#endif
+        for (; i != messages.size(); ++i) {
+            hashes[i] = _complete_message(messages[i].data(), messages[i].size());
+        }
+    }
+
+    /** Hash many keys.
+     *
+     * @see complete_messages()
+     * @param keys The keys to hash, each is hashed by its object representation.
+     * @param[out] hashes The hash of each key.
+     */
+    template<typename T>
+    void complete_messages(std::span<T const> keys, std::span<uint64_t> hashes) const noexcept
+        requires(std::has_unique_object_representations_v<T> and not std::is_pointer_v<T>)
+    {
+        hi_axiom(keys.size() == hashes.size());
+
+        auto i = 0_uz;
+#if HI_PROCESSOR == HI_CPU_X86_64
+        if (has_avx2()) {
+            constexpr auto sizes = std::array<std::size_t, 4>{sizeof(T), sizeof(T), sizeof(T), sizeof(T)};
+            for (; i + 4 <= keys.size(); i += 4) {
+                auto const ptrs = std::array<char const *, 4>{
+                    reinterpret_cast<char const *>(&keys[i]),
+                    reinterpret_cast<char const *>(&keys[i + 1]),
+                    reinterpret_cast<char const *>(&keys[i + 2]),
+                    reinterpret_cast<char const *>(&keys[i + 3])};
+                detail::sip_hash_x4_avx2<C, D>({_v0, _v1, _v2, _v3}, ptrs, sizes, hashes.data() + i);
+            }
+        }
+#endif
+        for (; i != keys.size(); ++i) {
+            hashes[i] = _complete_message(&keys[i], sizeof(T));
+        }
+    }
+
+    /** Hash a complete message.
+     *
+     * @see complete_message()
+     */
+    [[nodiscard]] uint64_t operator()(void const *data, size_t size) const noexcept
+    {
+        return complete_message(data, size);
+    }
+
+private:
+    uint64_t _v0;
+    uint64_t _v1;
+    uint64_t _v2;
+    uint64_t _v3;
+
+    uint64_t _m;
+    uint8_t _b;
+#ifndef NDEBUG
+    enum class debug_state_type : uint8_t { idle, full, partial, finalized };
+    debug_state_type _debug_state;
+#endif
+
+    [[nodiscard]] hi_force_inline uint64_t _complete_message(void const *data, size_t size) const noexcept
     {
         auto *src = static_cast<char const *>(data);
         hi_axiom_not_null(src);
@@ -176,28 +417,6 @@ public:
         return v0 ^ v1 ^ v2 ^ v3;
     }
 
-    /** Hash a complete message.
-     *
-     * @see complete_message()
-     */
-    [[nodiscard]] uint64_t operator()(void const *data, size_t size) const noexcept
-    {
-        return complete_message(data, size);
-    }
-
-private:
-    uint64_t _v0;
-    uint64_t _v1;
-    uint64_t _v2;
-    uint64_t _v3;
-
-    uint64_t _m;
-    uint8_t _b;
-#ifndef NDEBUG
-    enum class debug_state_type : uint8_t { idle, full, partial, finalized };
-    debug_state_type _debug_state;
-#endif
-
     hi_force_inline constexpr static void _round(uint64_t& v0, uint64_t& v1, uint64_t& v2, uint64_t& v3) noexcept
     {
         v0 += v1;
@@ -259,7 +478,7 @@ struct sip_hash24 {
     [[nodiscard]] uint64_t operator()(T const& rhs) const noexcept
         requires(std::has_unique_object_representations_v<T> and not std::is_pointer_v<T>)
     {
-        return _sip_hash24{}(&rhs, sizeof(rhs));
+        return _sip_hash24{}.complete_message<sizeof(T)>(&rhs);
     }
 };
 
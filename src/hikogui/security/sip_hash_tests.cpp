@@ -6,6 +6,7 @@
 #include<hikotest/hikotest.hpp>
 #include <array>
 #include <string_view>
+#include <vector>
 
 TEST_SUITE(sip_hash) {
 
@@ -112,6 +113,49 @@ TEST_CASE(standard_vectors_complete_message)
     }
 }
 
+TEST_CASE(standard_vectors_complete_messages)
+{
+    std::array<char, 64> message;
+
+    for (char i = 0; i != 64; ++i) {
+        message[i] = i;
+    }
+
+    // Messages of different sizes, so that the lanes finish at different words.
+    auto messages = std::vector<std::string_view>{};
+    for (auto i = 0; i != 64; ++i) {
+        messages.emplace_back(message.data(), (i * 37) % 64);
+    }
+
+    auto hashes = std::vector<uint64_t>(messages.size());
+    auto sh = hi::_sip_hash24{0x0706050403020100, 0x0f0e0d0c0b0a0908};
+    sh.complete_messages(messages, hashes);
+
+    for (size_t i = 0; i != messages.size(); ++i) {
+        REQUIRE(hashes[i] == results[messages[i].size()], std::format("message: {}", i));
+    }
+}
+
+TEST_CASE(complete_messages_keys)
+{
+    using key_type = std::array<uint32_t, 4>;
+
+    auto keys = std::vector<key_type>{};
+    for (uint32_t i = 0; i != 23; ++i) {
+        keys.push_back({i, i * 3, i * 5, i * 7});
+    }
+
+    auto hashes = std::vector<uint64_t>(keys.size());
+    auto sh = hi::_sip_hash24{};
+    sh.complete_messages(std::span<key_type const>{keys}, hashes);
+
+    for (size_t i = 0; i != keys.size(); ++i) {
+        REQUIRE(hashes[i] == sh(keys[i].data(), sizeof(keys[i])));
+        REQUIRE(hashes[i] == sh.complete_message<sizeof(keys[i])>(keys[i].data()));
+        REQUIRE(hashes[i] == hi::sip_hash24<key_type>{}(keys[i]));
+    }
+}
+
 TEST_CASE(global)
 {
     std::array<char, 64> message;
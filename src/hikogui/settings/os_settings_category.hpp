@@ -0,0 +1,57 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <utility>
+#include <cstdint>
+
+hi_export_module(hikogui.settings.os_settings_category);
+
+hi_export namespace hi::inline v1 {
+
+/** A group of operating system settings that are gathered together.
+ *
+ * When the operating system notifies that a setting has changed, only the
+ * settings of the category of that setting are gathered again.
+ *
+ * These flags can be combined by using OR.
+ */
+enum class os_settings_category : uint32_t {
+    none = 0x00,
+    device = 0x01, ///< The device type.
+    language = 0x02, ///< The language tags, locale and writing direction.
+    theme = 0x04, ///< The theme mode, sub-pixel orientation and HDR.
+    mouse = 0x08, ///< The double click interval and distance.
+    keyboard = 0x10, ///< The keyboard repeat and cursor blink timing.
+    window = 0x20, ///< The minimum and maximum window size.
+    monitor = 0x40, ///< The primary monitor and the desktop rectangles.
+    gpu = 0x80, ///< The GPU policy.
+
+    all = device | language | theme | mouse | keyboard | window | monitor | gpu
+};
+
+[[nodiscard]] constexpr os_settings_category operator|(os_settings_category const& lhs, os_settings_category const& rhs) noexcept
+{
+    return static_cast<os_settings_category>(std::to_underlying(lhs) | std::to_underlying(rhs));
+}
+
+[[nodiscard]] constexpr os_settings_category operator&(os_settings_category const& lhs, os_settings_category const& rhs) noexcept
+{
+    return static_cast<os_settings_category>(std::to_underlying(lhs) & std::to_underlying(rhs));
+}
+
+constexpr os_settings_category& operator|=(os_settings_category& lhs, os_settings_category const& rhs) noexcept
+{
+    return lhs = lhs | rhs;
+}
+
+[[nodiscard]] constexpr bool to_bool(os_settings_category const& rhs) noexcept
+{
+    return to_bool(std::to_underlying(rhs));
+}
+
+} // namespace hi::inline v1
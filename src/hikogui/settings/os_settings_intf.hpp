@@ -6,6 +6,7 @@
 
 #include "theme_mode.hpp"
 #include "subpixel_orientation.hpp"
+#include "os_settings_category.hpp"
 #include "../i18n/i18n.hpp"
 #include "../geometry/geometry.hpp"
 #include "../utility/utility.hpp"
@@ -302,13 +303,37 @@ public:
      */
     [[nodiscard]] static std::vector<uuid> preferred_gpus(hi::policy performance_policy) noexcept;
 
-    template<forward_of<void()> Func>
-    [[nodiscard]] static callback<void()> subscribe(Func &&func, callback_flags flags = callback_flags::synchronous) noexcept
+    /** Subscribe to changes of the settings.
+     *
+     * @param func The function to call with the categories of the settings that have changed.
+     * @param flags How the function is called.
+     * @return The callback, which unsubscribes when destroyed.
+     */
+    template<forward_of<void(os_settings_category)> Func>
+    [[nodiscard]] static callback<void(os_settings_category)>
+    subscribe(Func &&func, callback_flags flags = callback_flags::synchronous) noexcept
     {
         auto const lock = std::scoped_lock(_mutex);
         return _notifier.subscribe(std::forward<Func>(func), flags);
     }
 
+    /** Subscribe to changes of the settings.
+     *
+     * @param func The function to call when any setting has changed.
+     * @param flags How the function is called.
+     * @return The callback, which unsubscribes when destroyed.
+     */
+    template<forward_of<void()> Func>
+    [[nodiscard]] static callback<void(os_settings_category)>
+    subscribe(Func &&func, callback_flags flags = callback_flags::synchronous) noexcept
+    {
+        return subscribe(
+            [func = std::forward<Func>(func)](os_settings_category) mutable {
+                func();
+            },
+            flags);
+    }
+
     /** Get the global os_settings instance.
      *
      * @return True on success.
@@ -319,17 +344,137 @@ public:
     }
 
     /** Gather the settings from the operating system now.
+     *
+     * Subscribers are notified with the categories of which a setting has changed.
+     *
+     * @param categories The categories of settings to gather.
      */
-    static void gather() noexcept
+    static void gather(os_settings_category categories = os_settings_category::all) noexcept
     {
         auto const lock = std::scoped_lock(_mutex);
-        auto setting_has_changed = false;
 
-        auto const current_time = std::chrono::utc_clock::now();
-        if (current_time < _gather_last_time + gather_minimum_interval) {
-            return;
+        if (categories == os_settings_category::all) {
+            // Limit the rate of full gathers, which are expensive.
+            auto const current_time = std::chrono::utc_clock::now();
+            if (current_time < _gather_last_time + gather_minimum_interval) {
+                return;
+            }
+            _gather_last_time = current_time;
+        }
+
+        auto changed = os_settings_category::none;
+        if (to_bool(categories & os_settings_category::device) and gather_device_settings()) {
+            changed |= os_settings_category::device;
+        }
+        if (to_bool(categories & os_settings_category::language) and gather_language_settings()) {
+            changed |= os_settings_category::language;
+        }
+        if (to_bool(categories & os_settings_category::theme) and gather_theme_settings()) {
+            changed |= os_settings_category::theme;
+        }
+        if (to_bool(categories & os_settings_category::mouse) and gather_mouse_settings()) {
+            changed |= os_settings_category::mouse;
+        }
+        if (to_bool(categories & os_settings_category::keyboard) and gather_keyboard_settings()) {
+            changed |= os_settings_category::keyboard;
+        }
+        if (to_bool(categories & os_settings_category::window) and gather_window_settings()) {
+            changed |= os_settings_category::window;
+        }
+        if (to_bool(categories & os_settings_category::monitor) and gather_monitor_settings()) {
+            changed |= os_settings_category::monitor;
+        }
+        if (to_bool(categories & os_settings_category::gpu) and gather_gpu_settings()) {
+            changed |= os_settings_category::gpu;
+        }
+
+        if (categories == os_settings_category::all) {
+            _populated.store(true, std::memory_order::release);
+        }
+        if (changed != os_settings_category::none) {
+            _notifier(changed);
         }
-        _gather_last_time = current_time;
+    }
+
+private:
+    constexpr static std::chrono::duration gather_interval = std::chrono::seconds(5);
+    constexpr static std::chrono::duration gather_minimum_interval = std::chrono::seconds(1);
+
+    static inline std::atomic<bool> _started = false;
+    static inline std::atomic<bool> _populated = false;
+    static inline unfair_mutex _mutex;
+    static inline utc_nanoseconds _gather_last_time;
+
+    static inline notifier<void(os_settings_category)> _notifier;
+
+    static inline std::atomic<hi::device_type> _device_type = hi::device_type::desktop;
+    static inline std::vector<language_tag> _language_tags = {};
+    static inline std::locale _locale = std::locale{""};
+    static inline std::atomic<bool> _left_to_right = true;
+    static inline std::atomic<hi::theme_mode> _theme_mode = theme_mode::dark;
+    static inline std::atomic<bool> _uniform_HDR = false;
+    static inline std::atomic<hi::subpixel_orientation> _subpixel_orientation = hi::subpixel_orientation::unknown;
+    static inline std::atomic<std::chrono::milliseconds> _double_click_interval = std::chrono::milliseconds(500);
+    static inline std::atomic<float> _double_click_distance = 4.0f;
+    static inline std::atomic<std::chrono::milliseconds> _keyboard_repeat_delay = std::chrono::milliseconds(250);
+    static inline std::atomic<std::chrono::milliseconds> _keyboard_repeat_interval = std::chrono::milliseconds(33);
+    static inline std::atomic<std::chrono::milliseconds> _cursor_blink_interval = std::chrono::milliseconds(1000);
+    static inline std::atomic<std::chrono::milliseconds> _cursor_blink_delay = std::chrono::milliseconds(1000);
+    static inline std::atomic<float> _minimum_window_width = 40.0f;
+    static inline std::atomic<float> _minimum_window_height = 25.0f;
+    static inline std::atomic<float> _maximum_window_width = 1920.0f;
+    static inline std::atomic<float> _maximum_window_height = 1080.0f;
+    static inline std::atomic<uintptr_t> _primary_monitor_id = 0;
+    static inline aarectangle _primary_monitor_rectangle = aarectangle{0.0f, 0.0f, 1920.0f, 1080.0f};
+    static inline aarectangle _desktop_rectangle = aarectangle{0.0f, 0.0f, 1920.0f, 1080.0f};
+    static inline std::atomic<hi::policy> _gpu_policy = policy::unspecified;
+
+    static inline callback<void()> _gather_cbt;
+
+    [[nodiscard]] static bool subsystem_init() noexcept
+    {
+        gather();
+
+        if (not start_notifications()) {
+            // Without notifications from the operating system, poll for changes.
+            hi_log_warning("Could not subscribe to changes of OS settings, gathering every {}.", gather_interval);
+            _gather_cbt = loop::timer().repeat_function(gather_interval, [] {
+                os_settings::gather();
+            });
+        }
+
+        return true;
+    }
+
+    static void subsystem_deinit() noexcept
+    {
+        if (_started.exchange(false)) {
+            stop_notifications();
+            _gather_cbt = nullptr;
+        }
+    }
+
+    /** Subscribe to the notifications of the operating system when settings change.
+     *
+     * On each notification `gather()` is called with the categories of the
+     * settings that have changed.
+     *
+     * @return True if the settings do not need to be polled.
+     */
+    [[nodiscard]] static bool start_notifications() noexcept;
+
+    /** Unsubscribe from the notifications of the operating system.
+     */
+    static void stop_notifications() noexcept;
+
+    /** Gather the device type settings.
+     *
+     * @pre `_mutex` is locked.
+     * @return True if a setting has changed.
+     */
+    [[nodiscard]] static bool gather_device_settings() noexcept
+    {
+        auto setting_has_changed = false;
 
         if (auto optional_device_type = gather_device_type()) {
             if (compare_store(_device_type, *optional_device_type)) {
@@ -341,6 +486,18 @@ public:
             hi_log_error("Failed to get device type: {}", optional_device_type.error().message());
         }
 
+        return setting_has_changed;
+    }
+
+    /** Gather the language settings.
+     *
+     * @pre `_mutex` is locked.
+     * @return True if a setting has changed.
+     */
+    [[nodiscard]] static bool gather_language_settings() noexcept
+    {
+        auto setting_has_changed = false;
+
         try {
             auto language_tags = gather_languages();
             if (language_tags.empty()) {
@@ -373,6 +530,18 @@ public:
             hi_log_info("OS mirrored-GUI has changed: {}", not _left_to_right);
         }
 
+        return setting_has_changed;
+    }
+
+    /** Gather the theme settings.
+     *
+     * @pre `_mutex` is locked.
+     * @return True if a setting has changed.
+     */
+    [[nodiscard]] static bool gather_theme_settings() noexcept
+    {
+        auto setting_has_changed = false;
+
         try {
             if (compare_store(_theme_mode, gather_theme_mode())) {
                 setting_has_changed = true;
@@ -400,6 +569,18 @@ public:
             hi_log_error("Failed to get OS uniform-HDR: {}", e.what());
         }
 
+        return setting_has_changed;
+    }
+
+    /** Gather the mouse settings.
+     *
+     * @pre `_mutex` is locked.
+     * @return True if a setting has changed.
+     */
+    [[nodiscard]] static bool gather_mouse_settings() noexcept
+    {
+        auto setting_has_changed = false;
+
         try {
             if (compare_store(_double_click_interval, gather_double_click_interval())) {
                 setting_has_changed = true;
@@ -418,6 +599,18 @@ public:
             hi_log_error("Failed to get OS double click distance: {}", e.what());
         }
 
+        return setting_has_changed;
+    }
+
+    /** Gather the keyboard settings.
+     *
+     * @pre `_mutex` is locked.
+     * @return True if a setting has changed.
+     */
+    [[nodiscard]] static bool gather_keyboard_settings() noexcept
+    {
+        auto setting_has_changed = false;
+
         try {
             if (compare_store(_keyboard_repeat_delay, gather_keyboard_repeat_delay())) {
                 setting_has_changed = true;
@@ -458,6 +651,18 @@ public:
             hi_log_error("Failed to get OS cursor blink delay: {}", e.what());
         }
 
+        return setting_has_changed;
+    }
+
+    /** Gather the window settings.
+     *
+     * @pre `_mutex` is locked.
+     * @return True if a setting has changed.
+     */
+    [[nodiscard]] static bool gather_window_settings() noexcept
+    {
+        auto setting_has_changed = false;
+
         try {
             if (compare_store(_minimum_window_width, gather_minimum_window_width())) {
                 setting_has_changed = true;
@@ -494,6 +699,18 @@ public:
             hi_log_error("Failed to get OS maximum window height: {}", e.what());
         }
 
+        return setting_has_changed;
+    }
+
+    /** Gather the monitor settings.
+     *
+     * @pre `_mutex` is locked.
+     * @return True if a setting has changed.
+     */
+    [[nodiscard]] static bool gather_monitor_settings() noexcept
+    {
+        auto setting_has_changed = false;
+
         try {
             auto const primary_monitor_id = gather_primary_monitor_id();
             if (compare_store(_primary_monitor_id, primary_monitor_id)) {
@@ -523,6 +740,18 @@ public:
             hi_log_error("Failed to get OS desktop rectangle: {}", e.what());
         }
 
+        return setting_has_changed;
+    }
+
+    /** Gather the GPU settings.
+     *
+     * @pre `_mutex` is locked.
+     * @return True if a setting has changed.
+     */
+    [[nodiscard]] static bool gather_gpu_settings() noexcept
+    {
+        auto setting_has_changed = false;
+
         try {
             if (compare_store(_gpu_policy, gather_gpu_policy())) {
                 setting_has_changed = true;
@@ -532,61 +761,7 @@ public:
             hi_log_error("Failed to get the GPU policy: {}", e.what());
         }
 
-        _populated.store(true, std::memory_order::release);
-        if (setting_has_changed) {
-            _notifier();
-        }
-    }
-
-private:
-    constexpr static std::chrono::duration gather_interval = std::chrono::seconds(5);
-    constexpr static std::chrono::duration gather_minimum_interval = std::chrono::seconds(1);
-
-    static inline std::atomic<bool> _started = false;
-    static inline std::atomic<bool> _populated = false;
-    static inline unfair_mutex _mutex;
-    static inline utc_nanoseconds _gather_last_time;
-
-    static inline notifier<void()> _notifier;
-
-    static inline std::atomic<hi::device_type> _device_type = hi::device_type::desktop;
-    static inline std::vector<language_tag> _language_tags = {};
-    static inline std::locale _locale = std::locale{""};
-    static inline std::atomic<bool> _left_to_right = true;
-    static inline std::atomic<hi::theme_mode> _theme_mode = theme_mode::dark;
-    static inline std::atomic<bool> _uniform_HDR = false;
-    static inline std::atomic<hi::subpixel_orientation> _subpixel_orientation = hi::subpixel_orientation::unknown;
-    static inline std::atomic<std::chrono::milliseconds> _double_click_interval = std::chrono::milliseconds(500);
-    static inline std::atomic<float> _double_click_distance = 4.0f;
-    static inline std::atomic<std::chrono::milliseconds> _keyboard_repeat_delay = std::chrono::milliseconds(250);
-    static inline std::atomic<std::chrono::milliseconds> _keyboard_repeat_interval = std::chrono::milliseconds(33);
-    static inline std::atomic<std::chrono::milliseconds> _cursor_blink_interval = std::chrono::milliseconds(1000);
-    static inline std::atomic<std::chrono::milliseconds> _cursor_blink_delay = std::chrono::milliseconds(1000);
-    static inline std::atomic<float> _minimum_window_width = 40.0f;
-    static inline std::atomic<float> _minimum_window_height = 25.0f;
-    static inline std::atomic<float> _maximum_window_width = 1920.0f;
-    static inline std::atomic<float> _maximum_window_height = 1080.0f;
-    static inline std::atomic<uintptr_t> _primary_monitor_id = 0;
-    static inline aarectangle _primary_monitor_rectangle = aarectangle{0.0f, 0.0f, 1920.0f, 1080.0f};
-    static inline aarectangle _desktop_rectangle = aarectangle{0.0f, 0.0f, 1920.0f, 1080.0f};
-    static inline std::atomic<hi::policy> _gpu_policy = policy::unspecified;
-
-    static inline callback<void()> _gather_cbt;
-
-    [[nodiscard]] static bool subsystem_init() noexcept
-    {
-        _gather_cbt = loop::timer().repeat_function(gather_interval, [] {
-            os_settings::gather();
-        });
-
-        return true;
-    }
-
-    static void subsystem_deinit() noexcept
-    {
-        if (_started.exchange(false)) {
-            _gather_cbt = nullptr;
-        }
+        return setting_has_changed;
     }
 
     [[nodiscard]] static std::expected<hi::device_type, std::error_code> gather_device_type() noexcept;
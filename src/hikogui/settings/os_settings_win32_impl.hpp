@@ -11,12 +11,320 @@
 #include "../telemetry/telemetry.hpp"
 #include "../utility/utility.hpp"
 #include "../path/path.hpp"
+#include "../concurrency/concurrency.hpp"
 #include "../macros.hpp"
+#include <thread>
+#include <latch>
+#include <array>
+#include <vector>
+#include <string_view>
+#include <bit>
 
 hi_export_module(hikogui.settings.os_settings : impl);
 
 hi_export namespace hi { inline namespace v1 {
 
+namespace detail {
+
+/** Watches the operating system for changes of the settings.
+ *
+ * A thread waits on:
+ *  - registry change notifications (`RegNotifyChangeKeyValue()`) of the keys
+ *    that hold the settings, and
+ *  - the `WM_SETTINGCHANGE` and `WM_DISPLAYCHANGE` messages, which are only
+ *    broadcast to top-level windows, so the thread owns a hidden window.
+ *
+ * A single change in the control-panel often causes a burst of notifications,
+ * so the categories are collected until there are no more notifications for
+ * a short while, then `os_settings::gather()` is called with those categories.
+ */
+class os_settings_win32_notifications {
+public:
+    [[nodiscard]] static os_settings_win32_notifications& global() noexcept
+    {
+        static auto r = os_settings_win32_notifications{};
+        return r;
+    }
+
+    /** Start the thread that waits for notifications.
+     *
+     * @return True if the thread was able to subscribe to the notifications.
+     */
+    [[nodiscard]] bool start() noexcept
+    {
+        if ((_stop_event = CreateEventW(NULL, TRUE, FALSE, NULL)) == NULL) {
+            hi_log_error("Could not create the stop event for OS settings notifications: {}", get_last_error_message());
+            return false;
+        }
+
+        auto started = std::latch{1};
+        auto success = false;
+        _thread = std::jthread{[&] {
+            // Copy the result, start() returns after count_down().
+            auto const initialized = success = initialize();
+            started.count_down();
+            if (initialized) {
+                run();
+            }
+            deinitialize();
+        }};
+        started.wait();
+
+        if (not success) {
+            stop();
+        }
+        return success;
+    }
+
+    void stop() noexcept
+    {
+        if (_stop_event != NULL) {
+            SetEvent(_stop_event);
+            if (_thread.joinable()) {
+                _thread.join();
+            }
+            CloseHandle(_stop_event);
+            _stop_event = NULL;
+        }
+    }
+
+private:
+    /** How long to wait for more notifications before gathering the settings.
+     */
+    constexpr static auto debounce_timeout = DWORD{100};
+
+    struct registry_watch_type {
+        char const *path;
+        os_settings_category category;
+        HKEY key = NULL;
+        HANDLE event = NULL;
+    };
+
+    std::jthread _thread;
+    HANDLE _stop_event = NULL;
+    HWND _window = NULL;
+
+    /** The registry keys that hold the settings, and the categories of their settings.
+     */
+    std::array<registry_watch_type, 6> _registry_watches = {
+        registry_watch_type{"Control Panel\\International", os_settings_category::language},
+        registry_watch_type{"Control Panel\\Desktop", os_settings_category::keyboard | os_settings_category::theme},
+        registry_watch_type{"Control Panel\\Keyboard", os_settings_category::keyboard},
+        registry_watch_type{"Control Panel\\Mouse", os_settings_category::mouse},
+        registry_watch_type{"Software\\Microsoft\\Windows\\CurrentVersion\\Themes\\Personalize", os_settings_category::theme},
+        registry_watch_type{"Software\\Microsoft\\DirectX\\UserGpuPreferences", os_settings_category::gpu}};
+
+    /** The categories of settings that have changed, since the last gather.
+     */
+    os_settings_category _pending = os_settings_category::none;
+
+    /** Get the categories of settings that changed from a `WM_SETTINGCHANGE` message.
+     */
+    [[nodiscard]] static os_settings_category setting_change_category(WPARAM wParam, LPARAM lParam) noexcept
+    {
+        switch (wParam) {
+        case SPI_SETDOUBLECLICKTIME:
+        case SPI_SETDOUBLECLKWIDTH:
+        case SPI_SETDOUBLECLKHEIGHT:
+            return os_settings_category::mouse;
+
+        case SPI_SETKEYBOARDDELAY:
+        case SPI_SETKEYBOARDSPEED:
+            return os_settings_category::keyboard;
+
+        case SPI_SETFONTSMOOTHING:
+        case SPI_SETFONTSMOOTHINGTYPE:
+        case SPI_SETFONTSMOOTHINGORIENTATION:
+        case SPI_SETCLEARTYPE:
+            return os_settings_category::theme;
+
+        case SPI_SETWORKAREA:
+        case SPI_SETNONCLIENTMETRICS:
+            return os_settings_category::window | os_settings_category::monitor;
+
+        case 0:
+            if (lParam != 0) {
+                auto const area = std::wstring_view{std::bit_cast<wchar_t const *>(lParam)};
+                if (area == L"intl") {
+                    return os_settings_category::language;
+                } else if (area == L"ImmersiveColorSet") {
+                    return os_settings_category::theme;
+                } else if (area == L"ConvertibleSlateMode" or area == L"UserInteractionMode") {
+                    return os_settings_category::device;
+                }
+            }
+            return os_settings_category::none;
+
+        default:
+            // The other system parameters are not used by os_settings.
+            return os_settings_category::none;
+        }
+    }
+
+    static LRESULT CALLBACK window_proc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) noexcept
+    {
+        auto *self = std::bit_cast<os_settings_win32_notifications *>(GetWindowLongPtrW(hwnd, GWLP_USERDATA));
+        if (self != nullptr) {
+            switch (uMsg) {
+            case WM_SETTINGCHANGE:
+                self->_pending |= setting_change_category(wParam, lParam);
+                return 0;
+
+            case WM_DISPLAYCHANGE:
+                self->_pending |= os_settings_category::monitor | os_settings_category::window;
+                return 0;
+
+            case WM_THEMECHANGED:
+                self->_pending |= os_settings_category::theme;
+                return 0;
+
+            default:;
+            }
+        }
+        return DefWindowProcW(hwnd, uMsg, wParam, lParam);
+    }
+
+    /** Register for a change notification of a registry key.
+     *
+     * A notification fires only once, so it needs to be registered again after each change.
+     */
+    [[nodiscard]] static bool watch(registry_watch_type const& watch) noexcept
+    {
+        constexpr auto filter = REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET;
+        if (auto const r = RegNotifyChangeKeyValue(watch.key, TRUE, filter, watch.event, TRUE); r != ERROR_SUCCESS) {
+            hi_log_error("Could not watch registry key '{}': {}", watch.path, get_last_error_message(narrow_cast<uint32_t>(r)));
+            return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool initialize() noexcept
+    {
+        set_thread_name("os_settings");
+
+        auto const instance = GetModuleHandleW(NULL);
+
+        auto window_class = WNDCLASSW{};
+        window_class.lpfnWndProc = window_proc;
+        window_class.hInstance = instance;
+        window_class.lpszClassName = L"HikoGUI OS Settings Class";
+        if (RegisterClassW(&window_class) == 0 and GetLastError() != ERROR_CLASS_ALREADY_EXISTS) {
+            hi_log_error("Could not register the OS settings window class: {}", get_last_error_message());
+            return false;
+        }
+
+        // A hidden top-level window, because message-only windows do not receive broadcast messages.
+        _window = CreateWindowExW(0, window_class.lpszClassName, L"", WS_OVERLAPPED, 0, 0, 0, 0, NULL, NULL, instance, NULL);
+        if (_window == NULL) {
+            hi_log_error("Could not create the OS settings window: {}", get_last_error_message());
+            return false;
+        }
+        SetWindowLongPtrW(_window, GWLP_USERDATA, std::bit_cast<LONG_PTR>(this));
+
+        for (auto& watch_ : _registry_watches) {
+            auto const wpath = win32_MultiByteToWideChar(watch_.path);
+            if (not wpath) {
+                return false;
+            }
+
+            if (RegOpenKeyExW(HKEY_CURRENT_USER, wpath->c_str(), 0, KEY_NOTIFY, &watch_.key) != ERROR_SUCCESS) {
+                // The key could not exist, for example when no GPU preferences are set.
+                // These settings are still gathered when other settings change.
+                watch_.key = NULL;
+                continue;
+            }
+
+            if ((watch_.event = CreateEventW(NULL, FALSE, FALSE, NULL)) == NULL) {
+                hi_log_error("Could not create an event for OS settings notifications: {}", get_last_error_message());
+                return false;
+            }
+
+            if (not watch(watch_)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void deinitialize() noexcept
+    {
+        for (auto& watch_ : _registry_watches) {
+            if (watch_.key != NULL) {
+                RegCloseKey(watch_.key);
+                watch_.key = NULL;
+            }
+            if (watch_.event != NULL) {
+                CloseHandle(watch_.event);
+                watch_.event = NULL;
+            }
+        }
+
+        if (_window != NULL) {
+            DestroyWindow(_window);
+            _window = NULL;
+        }
+    }
+
+    void run() noexcept
+    {
+        auto handles = std::vector<HANDLE>{_stop_event};
+        auto watches = std::vector<registry_watch_type const *>{nullptr};
+        for (auto const& watch_ : _registry_watches) {
+            if (watch_.event != NULL) {
+                handles.push_back(watch_.event);
+                watches.push_back(std::addressof(watch_));
+            }
+        }
+        while (true) {
+            auto const num_handles = narrow_cast<DWORD>(handles.size());
+            auto const timeout = _pending == os_settings_category::none ? INFINITE : debounce_timeout;
+            auto const r = MsgWaitForMultipleObjects(num_handles, handles.data(), FALSE, timeout, QS_ALLINPUT);
+
+            if (r == WAIT_OBJECT_0) {
+                // Stop event.
+                return;
+
+            } else if (r > WAIT_OBJECT_0 and r < WAIT_OBJECT_0 + num_handles) {
+                auto const index = r - WAIT_OBJECT_0;
+                _pending |= watches[index]->category;
+                if (not watch(*watches[index])) {
+                    // Stop waiting for this key, the settings are still gathered on window messages.
+                    handles.erase(handles.begin() + index);
+                    watches.erase(watches.begin() + index);
+                }
+
+            } else if (r == WAIT_OBJECT_0 + num_handles) {
+                // Messages are handled by window_proc(), which updates _pending.
+                auto msg = MSG{};
+                while (PeekMessageW(&msg, NULL, 0, 0, PM_REMOVE)) {
+                    TranslateMessage(&msg);
+                    DispatchMessageW(&msg);
+                }
+
+            } else if (r == WAIT_TIMEOUT) {
+                os_settings::gather(std::exchange(_pending, os_settings_category::none));
+
+            } else {
+                hi_log_error("Failed waiting for OS settings notifications: {}", get_last_error_message());
+                return;
+            }
+        }
+    }
+};
+
+} // namespace detail
+
+inline bool os_settings::start_notifications() noexcept
+{
+    return detail::os_settings_win32_notifications::global().start();
+}
+
+inline void os_settings::stop_notifications() noexcept
+{
+    detail::os_settings_win32_notifications::global().stop();
+}
+
 [[nodiscard]] inline std::expected<device_type, std::error_code> os_settings::gather_device_type() noexcept
 {
     auto const is_tablet = static_cast<bool>(GetSystemMetrics(SM_TABLETPC));
@@ -3,6 +3,7 @@
 
 //#include "cpu_id.hpp"
 #include "os_settings.hpp"
+#include "os_settings_category.hpp"
 #include "preferences.hpp"
 #include "subpixel_orientation.hpp"
 #include "theme_mode.hpp"
@@ -2,6 +2,10 @@
 
 #pragma once
 
+#include "../codec/codec.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../telemetry/telemetry.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <optional>
@@ -10,13 +14,317 @@
 #include <cstdlib>
 #include <expected>
 #include <system_error>
+#include <mutex>
+#include <atomic>
+#include <chrono>
 
 hi_export_module(hikogui.settings.user_settings : intf);
 
 hi_export namespace hi { inline namespace v1 {
 
-[[nodiscard]] std::expected<std::string, std::error_code> get_user_setting_string(std::string_view key) noexcept;
-[[nodiscard]] std::expected<long long, std::error_code> get_user_setting_integral(std::string_view key) noexcept;
+namespace detail {
+
+/** The location of the user-settings of the application.
+ *
+ * @throws std::logic_error When the application name or vendor was not set.
+ */
+[[nodiscard]] std::string user_settings_path();
+
+/** Read all the user-settings of the application.
+ *
+ * @param path The location of the user-settings.
+ * @return A map of key to a string or integral value.
+ */
+[[nodiscard]] std::expected<datum, std::error_code> load_user_settings(std::string_view path) noexcept;
+
+/** Write changes to the user-settings of the application.
+ *
+ * @param path The location of the user-settings.
+ * @param changes A map of key to a string or integral value, or a null value to delete the user-setting.
+ * @return The first error that happened, all the changes are attempted.
+ */
+[[nodiscard]] std::error_code save_user_settings(std::string_view path, datum const& changes) noexcept;
+
+/** Delete all the user-settings of the application.
+ *
+ * @param path The location of the user-settings.
+ */
+[[nodiscard]] std::error_code remove_user_settings(std::string_view path) noexcept;
+
+/** An in-memory copy of the user-settings.
+ *
+ * All the user-settings are read at once on first use, after which reading
+ * a user-setting does not access the operating system.
+ *
+ * Changes are written behind; they are collected and written together on the
+ * timer thread a short time after the first change. The changes are also
+ * written when the system shuts down.
+ */
+class user_settings_cache {
+public:
+    /** The time between the first change and writing the changes.
+     */
+    constexpr static std::chrono::milliseconds flush_delay = std::chrono::milliseconds(500);
+
+    [[nodiscard]] static user_settings_cache& global() noexcept
+    {
+        static auto r = user_settings_cache{};
+        return r;
+    }
+
+    [[nodiscard]] std::expected<datum, std::error_code> get(std::string_view key) noexcept
+    {
+        if (auto const ec = load()) {
+            return std::unexpected{ec};
+        }
+
+        auto const lock = std::scoped_lock(_mutex);
+        if (auto const it = _values.find(datum{key}); it != _values.end()) {
+            return it->second;
+        } else {
+            return std::unexpected{std::make_error_code(std::errc::no_such_file_or_directory)};
+        }
+    }
+
+    /** Set a user-setting.
+     *
+     * @param key The key of the user-setting.
+     * @param value A string or integral value, or null to delete the user-setting.
+     */
+    std::error_code set(std::string_view key, datum value) noexcept
+    {
+        if (auto const ec = load()) {
+            return ec;
+        }
+
+        {
+            auto const lock = std::scoped_lock(_mutex);
+            if (holds_alternative<nullptr_t>(value)) {
+                _values.erase(datum{key});
+            } else {
+                _values.insert_or_assign(datum{key}, value);
+            }
+            _dirty.insert_or_assign(datum{key}, std::move(value));
+
+            if (std::exchange(_flush_scheduled, true)) {
+                return {};
+            }
+        }
+
+        if (start_subsystem()) {
+            auto const lock = std::scoped_lock(_mutex);
+            _flush_cbt = loop::timer().delay_function(std::chrono::utc_clock::now() + flush_delay, [] {
+                std::ignore = global().flush();
+            });
+            return {};
+
+        } else {
+            // Write-through, when the system is not running there is no flush at shutdown.
+            return flush();
+        }
+    }
+
+    /** Write the changed user-settings now.
+     *
+     * If the changes could not be written they are retried with the next flush.
+     */
+    std::error_code flush() noexcept
+    {
+        auto const flush_lock = std::scoped_lock(_flush_mutex);
+
+        auto path = std::string{};
+        auto changes = datum::map_type{};
+        {
+            auto const lock = std::scoped_lock(_mutex);
+            _flush_scheduled = false;
+            path = _path;
+            changes = std::exchange(_dirty, {});
+        }
+
+        if (changes.empty()) {
+            return {};
+        }
+
+        auto const ec = save_user_settings(path, datum{changes});
+        if (ec) {
+            hi_log_error("Failed to write user-settings: {}", ec.message());
+
+            // Keep the changes for the next flush, except those changed again since.
+            auto const lock = std::scoped_lock(_mutex);
+            for (auto& [key, value] : changes) {
+                _dirty.try_emplace(key, std::move(value));
+            }
+        }
+        return ec;
+    }
+
+    /** Delete all the user-settings.
+     */
+    std::error_code clear() noexcept
+    {
+        auto const flush_lock = std::scoped_lock(_flush_mutex);
+        auto const lock = std::scoped_lock(_mutex);
+
+        if (auto const ec = select_path()) {
+            return ec;
+        }
+
+        _values.clear();
+        _dirty.clear();
+        _loaded = true;
+        return remove_user_settings(_path);
+    }
+
+private:
+    static inline std::atomic<bool> _started = false;
+
+    /** Serializes the writes to the operating system.
+     *
+     * When both mutexes are locked, this one is locked first.
+     */
+    unfair_mutex _flush_mutex;
+    unfair_mutex _mutex;
+
+    /** The location of the cached user-settings.
+     */
+    std::string _path;
+    bool _loaded = false;
+    datum::map_type _values;
+
+    /** The keys changed since the last flush, null values are deleted.
+     */
+    datum::map_type _dirty;
+    bool _flush_scheduled = false;
+    callback<void()> _flush_cbt;
+
+    /** Make sure the user-settings of the current application are loaded.
+     */
+    [[nodiscard]] std::error_code load() noexcept
+    {
+        auto path = detail::user_settings_path();
+        {
+            auto const lock = std::scoped_lock(_mutex);
+            if (_loaded and _path == path) {
+                return {};
+            }
+        }
+
+        auto const flush_lock = std::scoped_lock(_flush_mutex);
+        auto const lock = std::scoped_lock(_mutex);
+        if (auto const ec = select_path()) {
+            return ec;
+        }
+        if (_loaded) {
+            // Loaded by another thread in the short time before the lock.
+            return {};
+        }
+
+        if (auto values = load_user_settings(_path)) {
+            if (auto const map = get_if<datum::map_type>(*values)) {
+                _values = *map;
+            }
+        } else {
+            return values.error();
+        }
+
+        // Changes made before the load are overlayed on the values.
+        for (auto const& [key, value] : _dirty) {
+            if (holds_alternative<nullptr_t>(value)) {
+                _values.erase(key);
+            } else {
+                _values.insert_or_assign(key, value);
+            }
+        }
+        _loaded = true;
+        return {};
+    }
+
+    /** Switch the cache to the user-settings of the current application.
+     *
+     * The application name or vendor changes at startup and in tests, the changes
+     * made to the user-settings of the previous application are written first.
+     *
+     * @pre `_flush_mutex` and `_mutex` are locked.
+     */
+    [[nodiscard]] std::error_code select_path() noexcept
+    {
+        auto path = detail::user_settings_path();
+        if (path == _path) {
+            return {};
+        }
+
+        if (not _dirty.empty()) {
+            if (auto const ec = save_user_settings(_path, datum{_dirty})) {
+                hi_log_error("Failed to write user-settings: {}", ec.message());
+            }
+        }
+
+        _path = std::move(path);
+        _loaded = false;
+        _values.clear();
+        _dirty.clear();
+        return {};
+    }
+
+    static bool start_subsystem() noexcept
+    {
+        return hi::start_subsystem(_started, false, subsystem_init, subsystem_deinit);
+    }
+
+    [[nodiscard]] static bool subsystem_init() noexcept
+    {
+        return true;
+    }
+
+    static void subsystem_deinit() noexcept
+    {
+        if (_started.exchange(false)) {
+            // Write the last changes before the application exits.
+            global()._flush_cbt = nullptr;
+            std::ignore = global().flush();
+        }
+    }
+};
+
+} // namespace detail
+
+/** Get a user-setting as a string.
+ *
+ * @param key A key for the user setting.
+ * @return The value from the user-settings, or std::errc::no_such_file_or_directory
+ *         if the key was not found, or std::errc::invalid_argument if the value is not a string.
+ */
+[[nodiscard]] inline std::expected<std::string, std::error_code> get_user_setting_string(std::string_view key) noexcept
+{
+    if (auto const value = detail::user_settings_cache::global().get(key)) {
+        if (auto const str = get_if<std::string>(*value)) {
+            return std::string{*str};
+        } else {
+            return std::unexpected{std::make_error_code(std::errc::invalid_argument)};
+        }
+    } else {
+        return std::unexpected{value.error()};
+    }
+}
+
+/** Get a user-setting as an integer.
+ *
+ * @param key A key for the user setting.
+ * @return The value from the user-settings, or std::errc::no_such_file_or_directory
+ *         if the key was not found, or std::errc::invalid_argument if the value is not an integer.
+ */
+[[nodiscard]] inline std::expected<long long, std::error_code> get_user_setting_integral(std::string_view key) noexcept
+{
+    if (auto const value = detail::user_settings_cache::global().get(key)) {
+        if (auto const integral = get_if<long long>(*value)) {
+            return *integral;
+        } else {
+            return std::unexpected{std::make_error_code(std::errc::invalid_argument)};
+        }
+    } else {
+        return std::unexpected{value.error()};
+    }
+}
 
 /** Get a user-setting for the application.
  *
@@ -40,7 +348,10 @@ template<typename T>
  * @throws std::invalid_argument When the key is not valid.
  * @throws std::out_of_range if the value in the default does not fit in the return value.
  */
-std::error_code set_user_setting(std::string_view key, std::string_view value) noexcept;
+inline std::error_code set_user_setting(std::string_view key, std::string_view value) noexcept
+{
+    return detail::user_settings_cache::global().set(key, datum{value});
+}
 
 /** Set a user-setting for the application.
  *
@@ -51,7 +362,10 @@ std::error_code set_user_setting(std::string_view key, std::string_view value) n
  * @throws std::invalid_argument When the key is not valid.
  * @throws std::out_of_range if the value in the default does not fit in the return value.
  */
-std::error_code set_user_setting(std::string_view key, long long value) noexcept;
+inline std::error_code set_user_setting(std::string_view key, long long value) noexcept
+{
+    return detail::user_settings_cache::global().set(key, datum{value});
+}
 
 /** Delete a user-setting for the application.
  *
@@ -61,11 +375,27 @@ std::error_code set_user_setting(std::string_view key, long long value) noexcept
  * @throws std::invalid_argument When the key is not valid.
  * @throws std::out_of_range if the value in the default does not fit in the return value.
  */
-std::error_code delete_user_setting(std::string_view key) noexcept;
+inline std::error_code delete_user_setting(std::string_view key) noexcept
+{
+    return detail::user_settings_cache::global().set(key, datum{nullptr});
+}
 
 /** Delete all user-setting for the application.
  */
-std::error_code delete_user_settings() noexcept;
+inline std::error_code delete_user_settings() noexcept
+{
+    return detail::user_settings_cache::global().clear();
+}
+
+/** Write the changed user-settings to the operating system now.
+ *
+ * Changes are normally written a short time after they are made, and when
+ * the application shuts down.
+ */
+inline std::error_code flush_user_settings() noexcept
+{
+    return detail::user_settings_cache::global().flush();
+}
 
 template<>
 [[nodiscard]] inline std::expected<std::string, std::error_code> get_user_setting(std::string_view key) noexcept
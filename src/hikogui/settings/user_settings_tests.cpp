@@ -55,4 +55,16 @@ TEST_CASE(delete_int_value)
     REQUIRE(result.error() == std::errc::no_such_file_or_directory);
 }
 
+TEST_CASE(flush_values)
+{
+    hi::set_user_setting("foo", 1);
+    hi::set_user_setting("bar", "hello");
+    hi::delete_user_setting("baz");
+    REQUIRE(not hi::flush_user_settings());
+
+    REQUIRE((hi::get_user_setting<int>("foo") == 1));
+    REQUIRE((hi::get_user_setting<std::string>("bar") == "hello"));
+    REQUIRE(hi::get_user_setting<int>("bar").error() == std::errc::invalid_argument);
+}
+
 }; // TEST_SUITE(user_settings)
@@ -10,6 +10,7 @@
 #include <string>
 #include <expected>
 #include <system_error>
+#include <variant>
 #include <Windows.h>
 #include <winreg.h>
 
@@ -17,70 +18,100 @@ hi_export_module(hikogui.settings.user_settings : impl);
 
 hi_export namespace hi { inline namespace v1 {
 
-[[nodiscard]] inline std::string user_setting_registry_path()
+namespace detail {
+
+[[nodiscard]] inline std::string user_settings_path()
 {
     return std::format("Software\\{}\\{}", get_application_vendor(), get_application_name());
 }
 
-/** 
- * 
- * @return A string value, or std::errc::file_not_found if entry not found, or other error.
+/** Read the values of a registry key into the map.
+ *
+ * @return Success, also when the registry key does not exist, or an error.
  */
-[[nodiscard]] inline std::expected<std::string, std::error_code> get_user_setting_string(std::string_view name) noexcept
+[[nodiscard]] inline std::error_code load_user_settings(datum::map_type& r, HKEY key, std::string_view path) noexcept
 {
-    // First check the registry of the current-user.
-    if (auto const value = win32_RegGetValue<std::string>(HKEY_CURRENT_USER, user_setting_registry_path(), name)) {
-        return *value;
-    } else if (value.error() != win32_error::file_not_found) {
-        return std::unexpected{std::error_code{value.error()}};
-    }
+    if (auto values = win32_RegEnumValue(key, path)) {
+        for (auto& [name, value] : *values) {
+            if (auto const dword = std::get_if<uint32_t>(&value)) {
+                r.insert_or_assign(datum{std::move(name)}, datum{static_cast<long long>(*dword)});
+            } else if (auto const str = std::get_if<std::string>(&value)) {
+                r.insert_or_assign(datum{std::move(name)}, datum{std::move(*str)});
+            }
+        }
+        return {};
+
+    } else if (values.error() == win32_error::file_not_found) {
+        return {};
 
-    // Now check the registry for the local-machine.
-    // These are settings that where made by the Administrator of the machine.
-    if (auto const value = win32_RegGetValue<std::string>(HKEY_LOCAL_MACHINE, user_setting_registry_path(), name)) {
-        return *value;
     } else {
-        return std::unexpected{std::error_code{value.error()}};
+        return std::error_code{values.error()};
     }
 }
 
-[[nodiscard]] inline std::expected<long long, std::error_code> get_user_setting_integral(std::string_view name) noexcept
+[[nodiscard]] inline std::expected<datum, std::error_code> load_user_settings(std::string_view path) noexcept
 {
-    // First check the registry of the current-user.
-    if (auto const value = win32_RegGetValue<long long>(HKEY_CURRENT_USER, user_setting_registry_path(), name)) {
-        return *value;
-    } else if (value.error() != win32_error::file_not_found) {
-        return std::unexpected{std::error_code{value.error()}};
-    }
+    auto r = datum::map_type{};
 
-    // Now check the registry for the local-machine.
+    // First read the registry for the local-machine.
     // These are settings that where made by the Administrator of the machine.
-    if (auto const value = win32_RegGetValue<long long>(HKEY_LOCAL_MACHINE, user_setting_registry_path(), name)) {
-        return *value;
-    } else {
-        return std::unexpected{std::error_code{value.error()}};
+    if (auto const ec = load_user_settings(r, HKEY_LOCAL_MACHINE, path)) {
+        return std::unexpected{ec};
     }
-}
 
-inline std::error_code set_user_setting(std::string_view name, std::string_view value) noexcept
-{
-    return win32_RegSetKeyValue(HKEY_CURRENT_USER, user_setting_registry_path(), name, value);
-}
+    // The registry of the current-user overrides the local-machine.
+    if (auto const ec = load_user_settings(r, HKEY_CURRENT_USER, path)) {
+        return std::unexpected{ec};
+    }
 
-inline std::error_code set_user_setting(std::string_view name, long long value) noexcept
-{
-    return win32_RegSetKeyValue(HKEY_CURRENT_USER, user_setting_registry_path(), name, narrow_cast<uint32_t>(value));
+    return datum{std::move(r)};
 }
 
-inline std::error_code delete_user_setting(std::string_view name) noexcept
+[[nodiscard]] inline std::error_code save_user_settings(std::string_view path, datum const& changes) noexcept
 {
-    return win32_RegDeleteKeyValue(HKEY_CURRENT_USER, user_setting_registry_path(), name);
+    auto const map = get_if<datum::map_type>(changes);
+    if (not map) {
+        return std::make_error_code(std::errc::invalid_argument);
+    }
+
+    auto r = std::error_code{};
+    for (auto const& [key, value] : *map) {
+        auto const name = get_if<std::string>(key);
+        if (not name) {
+            continue;
+        }
+
+        auto status = win32_error::success;
+        if (holds_alternative<nullptr_t>(value)) {
+            status = win32_RegDeleteKeyValue(HKEY_CURRENT_USER, path, *name);
+            if (status == win32_error::file_not_found) {
+                // Deleted a value that was never written.
+                status = win32_error::success;
+            }
+
+        } else if (auto const integral = get_if<long long>(value)) {
+            status = win32_RegSetKeyValue(HKEY_CURRENT_USER, path, *name, narrow_cast<uint32_t>(*integral));
+
+        } else if (auto const str = get_if<std::string>(value)) {
+            status = win32_RegSetKeyValue(HKEY_CURRENT_USER, path, *name, *str);
+        }
+
+        if (static_cast<bool>(status) and not r) {
+            r = std::error_code{status};
+        }
+    }
+    return r;
 }
 
-inline std::error_code delete_user_settings() noexcept
+[[nodiscard]] inline std::error_code remove_user_settings(std::string_view path) noexcept
 {
-    return win32_RegDeleteKey(HKEY_CURRENT_USER, user_setting_registry_path());
+    if (auto const status = win32_RegDeleteKey(HKEY_CURRENT_USER, path); status != win32_error::file_not_found) {
+        return std::error_code{status};
+    } else {
+        return {};
+    }
 }
 
-}}
+} // namespace detail
 
+}} // namespace hi::v1
@@ -0,0 +1,457 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file telemetry/benchmark.hpp Micro-benchmarks with machine-readable results.
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <format>
+#include <print>
+#include <charconv>
+#include <exception>
+#include <thread>
+#include <memory>
+#include <utility>
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.telemetry : benchmark);
+
+hi_export namespace hi::inline v1 {
+namespace detail {
+
+inline void const *volatile benchmark_sink = nullptr;
+
+}
+
+/** Prevent the compiler from optimizing away the calculation of a value.
+ *
+ * @param value The result of the code being benchmarked.
+ */
+template<typename T>
+hi_force_inline void do_not_optimize(T const& value) noexcept
+{
+#if HI_COMPILER == HI_CC_MSVC
+    // MSVC does not support inline assembly on x64, storing the address in a
+    // volatile forces the value to be materialized in memory.
+    detail::benchmark_sink = std::addressof(value);
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/** The result of a single benchmark.
+ */
+struct benchmark_result {
+    std::string name;
+
+    /** The total number of iterations that were measured.
+     */
+    std::size_t iterations = 0;
+
+    /** The mean, median and fastest duration of an iteration, in nanoseconds.
+     */
+    double mean = 0.0;
+    double median = 0.0;
+    double minimum = 0.0;
+
+    /** The number of bytes processed each second, or zero if not set by the benchmark.
+     */
+    double bytes_per_second = 0.0;
+
+    /** The number of items processed each second, or zero if not set by the benchmark.
+     */
+    double items_per_second = 0.0;
+
+    /** Additional measurements reported by the benchmark, by name.
+     */
+    std::vector<std::pair<std::string, double>> metrics;
+
+    /** The reason the benchmark was skipped, or empty.
+     */
+    std::string skipped;
+
+    /** The message of the exception thrown by the benchmark, or empty.
+     */
+    std::string error;
+};
+
+/** The state of a running benchmark.
+ *
+ * The benchmark repeatedly runs the code in a `while (state.running())` loop.
+ * The iterations are measured in batches; the size of a batch is doubled until
+ * it takes at least the batch time, after which each batch is a sample.
+ * Sampling stops when the minimum time has passed and enough samples were taken.
+ *
+ * Setup before the loop is not included in the measurement.
+ */
+class benchmark_state {
+public:
+    using clock = std::chrono::steady_clock;
+
+    constexpr static auto batch_time = std::chrono::milliseconds(10);
+    constexpr static std::size_t min_samples = 10;
+    constexpr static std::size_t max_samples = 1000;
+
+    benchmark_state(benchmark_state const&) = delete;
+    benchmark_state(benchmark_state&&) = delete;
+    benchmark_state& operator=(benchmark_state const&) = delete;
+    benchmark_state& operator=(benchmark_state&&) = delete;
+
+    /** Create the state of a benchmark.
+     *
+     * @param min_time The minimum time to spend sampling.
+     */
+    explicit benchmark_state(std::chrono::nanoseconds min_time) noexcept : _min_time(min_time) {}
+
+    /** Check if another iteration should be run.
+     */
+    [[nodiscard]] hi_force_inline bool running() noexcept
+    {
+        if (_remaining != 0) {
+            --_remaining;
+            return true;
+        }
+        return next_batch();
+    }
+
+    /** Set the number of bytes processed in a single iteration.
+     */
+    void set_bytes_per_iteration(std::size_t num_bytes) noexcept
+    {
+        _bytes_per_iteration = num_bytes;
+    }
+
+    /** Set the number of items processed in a single iteration.
+     */
+    void set_items_per_iteration(std::size_t num_items) noexcept
+    {
+        _items_per_iteration = num_items;
+    }
+
+    /** Report an additional measurement.
+     *
+     * For example the duration of the phases of a frame, measured by the
+     * benchmark itself. Setting a metric a second time replaces its value.
+     *
+     * @param name The name of the metric.
+     * @param value The value of the metric.
+     */
+    void set_metric(std::string name, double value) noexcept
+    {
+        auto const it = std::find_if(_metrics.begin(), _metrics.end(), [&name](auto const& item) {
+            return item.first == name;
+        });
+        if (it != _metrics.end()) {
+            it->second = value;
+        } else {
+            _metrics.emplace_back(std::move(name), value);
+        }
+    }
+
+    /** Skip the benchmark, for example when a resource it needs is not available.
+     *
+     * @param reason The reason why the benchmark was skipped.
+     */
+    void skip(std::string reason) noexcept
+    {
+        _skipped = std::move(reason);
+    }
+
+    /** Get the result of the benchmark.
+     *
+     * @param name The name of the benchmark.
+     */
+    [[nodiscard]] benchmark_result result(std::string name) const noexcept
+    {
+        auto r = benchmark_result{};
+        r.name = std::move(name);
+        r.skipped = _skipped;
+        if (_samples.empty()) {
+            if (r.skipped.empty()) {
+                r.skipped = "The benchmark has no loop.";
+            }
+            return r;
+        }
+
+        auto samples = _samples;
+        std::sort(samples.begin(), samples.end());
+
+        r.iterations = _iterations;
+        r.mean = std::chrono::duration<double, std::nano>(_total).count() / static_cast<double>(_iterations);
+        r.median = samples[samples.size() / 2];
+        r.minimum = samples.front();
+        if (_bytes_per_iteration != 0) {
+            r.bytes_per_second = static_cast<double>(_bytes_per_iteration) * 1e9 / r.median;
+        }
+        if (_items_per_iteration != 0) {
+            r.items_per_second = static_cast<double>(_items_per_iteration) * 1e9 / r.median;
+        }
+        r.metrics = _metrics;
+        return r;
+    }
+
+private:
+    std::chrono::nanoseconds _min_time;
+
+    std::size_t _batch_size = 0;
+    std::size_t _remaining = 0;
+    clock::time_point _batch_start = {};
+
+    /** The duration of an iteration in nanoseconds, for each sampled batch.
+     */
+    std::vector<double> _samples;
+    std::size_t _iterations = 0;
+    clock::duration _total = {};
+
+    std::size_t _bytes_per_iteration = 0;
+    std::size_t _items_per_iteration = 0;
+    std::vector<std::pair<std::string, double>> _metrics;
+    std::string _skipped;
+
+    [[nodiscard]] hi_no_inline bool next_batch() noexcept
+    {
+        auto const end = clock::now();
+
+        if (_batch_size == 0) {
+            _batch_size = 1;
+            _samples.reserve(max_samples);
+
+        } else if (auto const duration = end - _batch_start; _samples.empty() and duration < batch_time) {
+            // Warming up, until a batch is long enough to be measured accurately.
+            _batch_size *= 2;
+
+        } else {
+            _samples.push_back(
+                std::chrono::duration<double, std::nano>(duration).count() / static_cast<double>(_batch_size));
+            _iterations += _batch_size;
+            _total += duration;
+
+            if ((_total >= _min_time and _samples.size() >= min_samples) or _samples.size() == max_samples) {
+                return false;
+            }
+        }
+
+        _remaining = _batch_size - 1;
+        _batch_start = clock::now();
+        return true;
+    }
+};
+
+namespace detail {
+
+struct benchmark_entry {
+    std::string_view name;
+    void (*func)(benchmark_state&);
+};
+
+[[nodiscard]] inline std::vector<benchmark_entry>& benchmark_entries() noexcept
+{
+    static auto r = std::vector<benchmark_entry>{};
+    return r;
+}
+
+[[nodiscard]] inline std::string benchmark_json_string(std::string_view str)
+{
+    auto r = std::string{};
+    r.reserve(str.size() + 2);
+    r += '"';
+    for (auto const c : str) {
+        if (c == '"' or c == '\\') {
+            r += '\\';
+            r += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            r += std::format("\\u{:04x}", static_cast<unsigned int>(c));
+        } else {
+            r += c;
+        }
+    }
+    r += '"';
+    return r;
+}
+
+[[nodiscard]] inline std::string benchmark_json_object(benchmark_result const& result)
+{
+    auto r = std::format("{{\"name\": {}", benchmark_json_string(result.name));
+    if (not result.error.empty()) {
+        r += std::format(", \"error\": {}", benchmark_json_string(result.error));
+    } else if (not result.skipped.empty()) {
+        r += std::format(", \"skipped\": {}", benchmark_json_string(result.skipped));
+    } else {
+        r += std::format(
+            ", \"iterations\": {}, \"mean_ns\": {:.3f}, \"median_ns\": {:.3f}, \"min_ns\": {:.3f}",
+            result.iterations,
+            result.mean,
+            result.median,
+            result.minimum);
+        if (result.bytes_per_second != 0.0) {
+            r += std::format(", \"bytes_per_second\": {:.0f}", result.bytes_per_second);
+        }
+        if (result.items_per_second != 0.0) {
+            r += std::format(", \"items_per_second\": {:.0f}", result.items_per_second);
+        }
+        if (not result.metrics.empty()) {
+            r += ", \"metrics\": {";
+            for (auto i = 0_uz; i != result.metrics.size(); ++i) {
+                r += std::format(
+                    "{}{}: {:.3f}", i == 0 ? "" : ", ", benchmark_json_string(result.metrics[i].first), result.metrics[i].second);
+            }
+            r += '}';
+        }
+    }
+    r += '}';
+    return r;
+}
+
+} // namespace detail
+
+/** Register a benchmark.
+ *
+ * Use the `hi_benchmark()` macro to define and register a benchmark.
+ */
+struct benchmark_registration {
+    benchmark_registration(std::string_view name, void (*func)(benchmark_state&)) noexcept
+    {
+        detail::benchmark_entries().emplace_back(name, func);
+    }
+};
+
+/** Run a single benchmark.
+ *
+ * @param name The name of the benchmark.
+ * @param func The benchmark function.
+ * @param min_time The minimum time to spend sampling.
+ * @return The result of the benchmark.
+ */
+[[nodiscard]] inline benchmark_result
+run_benchmark(std::string_view name, void (*func)(benchmark_state&), std::chrono::nanoseconds min_time) noexcept
+{
+    auto state = benchmark_state{min_time};
+    try {
+        func(state);
+    } catch (std::exception const& e) {
+        auto r = benchmark_result{};
+        r.name = std::string{name};
+        r.error = e.what();
+        return r;
+    }
+    return state.result(std::string{name});
+}
+
+/** Run the registered benchmarks.
+ *
+ * The results are written as a JSON document to standard output, so that
+ * they can be compared between releases. Progress is reported on standard error.
+ *
+ * Command line options:
+ *  - `--filter=<text>`: only run the benchmarks whose name contains text.
+ *  - `--min-time=<seconds>`: the minimum time to spend sampling each benchmark, default 0.5.
+ *  - `--list`: list the names of the benchmarks.
+ *
+ * @return The exit code: 0 on success, 1 if a benchmark failed, 2 on a command line error.
+ */
+inline int run_benchmarks(int argc, char *argv[]) noexcept
+{
+    auto filter = std::string_view{};
+    auto min_time = std::chrono::nanoseconds{std::chrono::milliseconds(500)};
+    auto list = false;
+
+    for (auto i = 1; i < argc; ++i) {
+        auto const arg = std::string_view{argv[i]};
+        if (arg.starts_with("--filter=")) {
+            filter = arg.substr(9);
+
+        } else if (arg.starts_with("--min-time=")) {
+            auto const value = arg.substr(11);
+            auto seconds = 0.0;
+            auto const [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), seconds);
+            if (ec != std::errc{} or ptr != value.data() + value.size() or seconds < 0.0) {
+                std::println(stderr, "Invalid minimum time '{}'.", value);
+                return 2;
+            }
+            min_time = std::chrono::nanoseconds{static_cast<int64_t>(seconds * 1e9)};
+
+        } else if (arg == "--list") {
+            list = true;
+
+        } else {
+            std::println(stderr, "Unknown option '{}'.", arg);
+            return 2;
+        }
+    }
+
+    auto entries = detail::benchmark_entries();
+    std::sort(entries.begin(), entries.end(), [](auto const& a, auto const& b) {
+        return a.name < b.name;
+    });
+    std::erase_if(entries, [filter](auto const& entry) {
+        return not entry.name.contains(filter);
+    });
+
+    if (list) {
+        for (auto const& entry : entries) {
+            std::println("{}", entry.name);
+        }
+        return 0;
+    }
+
+    auto exit_code = 0;
+    std::println("{{");
+    std::println("  \"hardware_concurrency\": {},", std::thread::hardware_concurrency());
+    std::println("  \"min_time_s\": {},", std::chrono::duration<double>(min_time).count());
+    std::print("  \"benchmarks\": [");
+    for (auto i = 0_uz; i != entries.size(); ++i) {
+        auto const& entry = entries[i];
+        std::print(stderr, "{}: ", entry.name);
+        std::fflush(stderr);
+
+        auto const result = run_benchmark(entry.name, entry.func, min_time);
+        if (not result.error.empty()) {
+            std::println(stderr, "error: {}", result.error);
+            exit_code = 1;
+        } else if (not result.skipped.empty()) {
+            std::println(stderr, "skipped: {}", result.skipped);
+        } else {
+            std::println(stderr, "{:.1f} ns", result.median);
+        }
+
+        std::print("{}\n    {}", i == 0 ? "" : ",", detail::benchmark_json_object(result));
+        std::fflush(stdout);
+    }
+    std::print("\n  ]\n}}\n");
+    return exit_code;
+}
+
+} // namespace hi::inline v1
+
+/** Define and register a benchmark.
+ *
+ * The body of the benchmark has access to `hi::benchmark_state& state`.
+ *
+ * ```
+ * hi_benchmark(parse_JSON)
+ * {
+ *     auto const text = make_text();
+ *     state.set_bytes_per_iteration(text.size());
+ *     while (state.running()) {
+ *         hi::do_not_optimize(hi::parse_JSON(text));
+ *     }
+ * }
+ * ```
+ *
+ * @param name The name of the benchmark, an identifier.
+ */
+#define hi_benchmark(name) \
+    static void hi_benchmark_##name(::hi::benchmark_state& state); \
+    static auto const hi_benchmark_registration_##name = ::hi::benchmark_registration{#name, hi_benchmark_##name}; \
+    static void hi_benchmark_##name([[maybe_unused]] ::hi::benchmark_state& state)
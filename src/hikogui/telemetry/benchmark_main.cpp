@@ -0,0 +1,10 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "benchmark.hpp"
+
+int main(int argc, char *argv[])
+{
+    return hi::run_benchmarks(argc, argv);
+}
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "log.hpp"
+#include "histogram.hpp"
 #include "../utility/utility.hpp"
 #include "../concurrency/concurrency.hpp"
 #include "../concurrency/unfair_mutex.hpp" // XXX #616
@@ -17,11 +18,17 @@
 #include <string>
 #include <atomic>
 #include <map>
+#include <array>
+#include <new>
 #include <memory>
 #include <mutex>
 #include <chrono>
 #include <limits>
 #include <concepts>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <optional>
 
 hi_export_module(hikogui.telemetry : counters);
 
@@ -31,6 +38,17 @@ namespace detail {
 
 class counter {
 public:
+    /** A snapshot of a counter.
+     */
+    struct sample_type {
+        std::string name;
+        uint64_t total = 0;
+
+        /** The durations added since the last log, in `time_stamp_count` ticks.
+         */
+        std::optional<log_linear_histogram<>> durations = {};
+    };
+
     /** Get the named counter.
      *
      * @pre main() must have been started.
@@ -50,6 +68,57 @@ public:
         }
     }
 
+    /** Get the counters with the highest total count.
+     *
+     * @pre main() must have been started.
+     * @param n The maximum number of counters to return.
+     * @return The name and total count of the counters, largest count first.
+     */
+    [[nodiscard]] static std::vector<std::pair<std::string, uint64_t>> largest(std::size_t n) noexcept
+    {
+        auto r = std::vector<std::pair<std::string, uint64_t>>{};
+        {
+            auto const lock = std::scoped_lock(_mutex);
+            auto const& map_ = _map.get_or_make();
+            r.reserve(map_.size());
+            for (auto const& [name, counter] : map_) {
+                hi_assert(counter);
+                r.emplace_back(name, static_cast<uint64_t>(*counter));
+            }
+        }
+
+        n = std::min(n, r.size());
+        std::partial_sort(r.begin(), r.begin() + n, r.end(), [](auto const& lhs, auto const& rhs) {
+            return lhs.second > rhs.second;
+        });
+        r.resize(n);
+        return r;
+    }
+
+    /** Make a snapshot of all the counters.
+     *
+     * Unlike `log()` the durations are not taken from the counters.
+     *
+     * @pre main() must have been started.
+     * @return The snapshot of each counter, ordered by name.
+     */
+    [[nodiscard]] static std::vector<sample_type> sample() noexcept
+    {
+        auto r = std::vector<sample_type>{};
+
+        auto const lock = std::scoped_lock(_mutex);
+        auto const& map_ = _map.get_or_make();
+        r.reserve(map_.size());
+        for (auto const& [name, counter] : map_) {
+            hi_assert(counter);
+            auto& item = r.emplace_back(name, static_cast<uint64_t>(*counter));
+            if (auto const *durations_ptr = counter->_durations.load(std::memory_order::acquire)) {
+                item.durations.emplace(*durations_ptr);
+            }
+        }
+        return r;
+    }
+
     counter(counter const&) = delete;
     counter(counter&&) = delete;
     counter& operator=(counter const&) = delete;
@@ -57,107 +126,188 @@ public:
 
     constexpr counter() noexcept {}
 
+    /** The total count.
+     *
+     * The count of all the shards is added together, which is slower than
+     * incrementing the counter.
+     */
     operator uint64_t() const noexcept
     {
-        return _total_count.load(std::memory_order::relaxed);
+        auto r = uint64_t{0};
+        for (auto const& shard : _shards) {
+            r += shard.count.load(std::memory_order::relaxed);
+        }
+        return r;
     }
 
     static void log() noexcept
     {
-        auto const lock = std::scoped_lock(_mutex);
-        log_header();
-        for (auto const & [ string, counter ] : _map.get_or_make()) {
-            hi_assert(counter);
-            counter->log(string);
+        {
+            auto const lock = std::scoped_lock(_mutex);
+            log_header();
+            for (auto const & [ string, counter ] : _map.get_or_make()) {
+                hi_assert(counter);
+                counter->log(string);
+            }
+        }
+
+        log_mutex_contention();
+    }
+
+    /** Log the mutexes that threads had to wait for.
+     */
+    static void log_mutex_contention() noexcept
+    {
+        auto const contention = get_unfair_mutex_contention();
+        if (contention.empty()) {
+            return;
+        }
+
+        hi_log_statistics("");
+        hi_log_statistics("{:>18} {:>10} {:>10} {}", "waits", "total", "mean", "mutex");
+        hi_log_statistics("------------------ ---------- ---------- ------------------");
+        for (auto const& item : contention) {
+            hi_log_statistics(
+                "{:18d} {:>10} {:>10} {}",
+                item.num_waits,
+                format_engineering(item.wait_duration),
+                format_engineering(item.wait_duration / narrow_cast<std::chrono::nanoseconds::rep>(std::max(item.num_waits, uint64_t{1}))),
+                item.mutex);
         }
     }
 
     static void log_header() noexcept
     {
         hi_log_statistics("");
-        hi_log_statistics("{:>18} {:>9} {:>10} {:>10} {:>10}", "total", "delta", "min", "max", "mean");
-        hi_log_statistics("------------------ --------- ---------- ---------- ----------");
+        hi_log_statistics(
+            "{:>18} {:>9} {:>10} {:>10} {:>10} {:>10} {:>10}", "total", "delta", "min", "p50", "p99", "p999", "max");
+        hi_log_statistics("------------------ --------- ---------- ---------- ---------- ---------- ----------");
     }
 
-    /** Log the counter.
-     */
     /** Log the counter.
      */
     void log(std::string const& tag) noexcept
     {
-        auto const total_count = _total_count.load(std::memory_order::relaxed);
-        auto const prev_count = _prev_count.exchange(_total_count, std::memory_order::relaxed);
+        auto const total_count = static_cast<uint64_t>(*this);
+        auto const prev_count = _prev_count.exchange(total_count, std::memory_order::relaxed);
         auto const delta_count = total_count - prev_count;
         if (delta_count != 0) {
-            auto const duration_max = time_stamp_count::duration_from_count(_duration_max.exchange(0, std::memory_order::relaxed));
-            auto const duration_min = time_stamp_count::duration_from_count(
-                _duration_min.exchange(std::numeric_limits<uint64_t>::max(), std::memory_order::relaxed));
-
-            auto const duration_avg = _duration_avg.exchange(0, std::memory_order::relaxed);
-            if (duration_avg == 0) {
-                hi_log_statistics("{:>18} {:>+9} {:10} {:10} {:10} {}", total_count, delta_count, "", "", "", tag);
+            auto *durations_ptr = _durations.load(std::memory_order::acquire);
+            if (durations_ptr == nullptr) {
+                hi_log_statistics("{:>18} {:>+9} {:10} {:10} {:10} {:10} {:10} {}", total_count, delta_count, "", "", "", "", "", tag);
 
             } else {
-                auto const avg_count = duration_avg & 0xffff;
-                auto const avg_sum = duration_avg >> 16;
-                auto const average = time_stamp_count::duration_from_count(avg_sum / avg_count);
+                // Only the durations since the previous log are reported.
+                auto const durations = durations_ptr->take();
+                auto const to_string = [](uint64_t count) {
+                    return format_engineering(time_stamp_count::duration_from_count(count));
+                };
 
                 hi_log_statistics(
-                    "{:18d} {:+9d} {:>10} {:>10} {:>10} {}",
+                    "{:18d} {:+9d} {:>10} {:>10} {:>10} {:>10} {:>10} {}",
                     total_count,
                     delta_count,
-                    format_engineering(duration_min),
-                    format_engineering(duration_max),
-                    format_engineering(average),
+                    to_string(durations.min()),
+                    to_string(durations.percentile(0.5)),
+                    to_string(durations.percentile(0.99)),
+                    to_string(durations.percentile(0.999)),
+                    to_string(durations.max()),
                     tag);
             }
         }
     }
 
-    /** Rest the counter.
-     * 
-     * @return Old value of the 
+    /** Reset the counter.
+     *
+     * @note This should not be called while other threads increment the counter.
      */
     counter &operator=(std::integral auto count) noexcept
     {
         hi_axiom(count >= 0);
-        _total_count.store(count, std::memory_order::relaxed);
+        for (auto& shard : _shards) {
+            shard.count.store(0, std::memory_order::relaxed);
+        }
+        _shards.front().count.store(narrow_cast<uint64_t>(count), std::memory_order::relaxed);
+        return *this;
+    }
+
+    /** Increment the counter.
+     *
+     * The counter is only summed when the returned reference is converted to an integer.
+     */
+    counter& operator++() noexcept
+    {
+        local_shard().fetch_add(1, std::memory_order::relaxed);
         return *this;
     }
 
-    uint64_t operator++() noexcept
+    void operator++(int) noexcept
     {
-        return _total_count.fetch_add(1, std::memory_order::relaxed) + 1;
+        local_shard().fetch_add(1, std::memory_order::relaxed);
     }
 
-    uint64_t operator++(int) noexcept
+    counter& operator--() noexcept
     {
-        return _total_count.fetch_add(1, std::memory_order::relaxed);
+        // The shard may wrap around, the total count is still correct.
+        local_shard().fetch_sub(1, std::memory_order::relaxed);
+        return *this;
     }
 
-    uint64_t operator--() noexcept
+    void operator--(int) noexcept
     {
-        return _total_count.fetch_sub(1, std::memory_order::relaxed) + 1;
+        local_shard().fetch_sub(1, std::memory_order::relaxed);
     }
 
-    uint64_t operator--(int) noexcept
+    /** Add to the counter.
+     */
+    counter& operator+=(uint64_t rhs) noexcept
+    {
+        local_shard().fetch_add(rhs, std::memory_order::relaxed);
+        return *this;
+    }
+
+    /** Subtract from the counter.
+     *
+     * Like `operator--()` the shard may wrap around, the total count is still correct.
+     */
+    counter& operator-=(uint64_t rhs) noexcept
+    {
+        local_shard().fetch_sub(rhs, std::memory_order::relaxed);
+        return *this;
+    }
+
+    /** Increment the counter, and check if this is the first increment.
+     *
+     * @note It is safe to call this function from any thread.
+     * @return True for only one call, even when called concurrently.
+     */
+    [[nodiscard]] bool first_increment() noexcept
     {
-        return _total_count.fetch_sub(1, std::memory_order::relaxed);
+        local_shard().fetch_add(1, std::memory_order::relaxed);
+        return not _incremented.load(std::memory_order::relaxed) and not _incremented.exchange(true, std::memory_order::relaxed);
     }
 
     /** Add a duration.
+     *
+     * @param duration The duration in `time_stamp_count` ticks.
      */
     void add_duration(uint64_t duration) noexcept
     {
-        _total_count.fetch_add(1, std::memory_order::relaxed);
-        fetch_max(_duration_max, duration, std::memory_order::relaxed);
-        fetch_min(_duration_min, duration, std::memory_order::relaxed);
+        local_shard().fetch_add(1, std::memory_order::relaxed);
+        durations().add(duration);
+    }
 
-        // Combine duration with count in a single atomic.
-        hi_axiom(duration <= (std::numeric_limits<uint64_t>::max() >> 10));
-        duration <<= 16;
-        ++duration;
-        _duration_avg.fetch_add(duration, std::memory_order::relaxed);
+    /** Take the durations that were added since the previous take or log.
+     *
+     * @return The histogram of durations in `time_stamp_count` ticks.
+     */
+    [[nodiscard]] log_linear_histogram<> take_durations() noexcept
+    {
+        if (auto *durations_ptr = _durations.load(std::memory_order::acquire)) {
+            return durations_ptr->take();
+        } else {
+            return {};
+        }
     }
 
 protected:
@@ -169,17 +319,69 @@ protected:
     constinit static inline unfair_mutex_impl<false> _mutex;
     constinit static inline atomic_unique_ptr<map_type> _map;
 
-    std::atomic<uint64_t> _total_count = 0;
+private:
+#if defined(__cpp_lib_hardware_interference_size)
+    constexpr static size_t destructive_interference_size = std::hardware_destructive_interference_size;
+#else
+    constexpr static size_t destructive_interference_size = 128;
+#endif
+
+    /** The number of shards of a counter.
+     *
+     * Threads are assigned to the shards round-robin, threads only share
+     * a shard when there are more threads than shards.
+     */
+    constexpr static std::size_t num_shards = 16;
+
+    struct alignas(destructive_interference_size) shard_type {
+        std::atomic<uint64_t> count = 0;
+    };
+
+    /** Each shard is on its own cache-line, so that threads do not contend on the counter.
+     */
+    std::array<shard_type, num_shards> _shards = {};
+
     std::atomic<uint64_t> _prev_count = 0;
-    std::atomic<uint64_t> _duration_max = 0;
-    std::atomic<uint64_t> _duration_min = std::numeric_limits<uint64_t>::max();
+    std::atomic<bool> _incremented = false;
 
-    /** Average duration.
+    /** The histogram of durations, allocated on the first call to `add_duration()`.
      *
-     * - [9:0] Count.
-     * - [63:10] Sum.
+     * The histogram is never deallocated, so that durations may still be added
+     * from destructors of other global objects.
      */
-    std::atomic<uint64_t> _duration_avg = 0;
+    std::atomic<log_linear_histogram<> *> _durations = nullptr;
+
+    constinit static inline std::atomic<std::size_t> _next_shard_index = 0;
+
+    /** The shard of the current thread.
+     *
+     * The thread-local index is constant-initialized, so that it may be used before main().
+     */
+    [[nodiscard]] hi_force_inline std::atomic<uint64_t>& local_shard() noexcept
+    {
+        constinit static thread_local std::size_t shard_index = num_shards;
+
+        if (shard_index == num_shards) [[unlikely]] {
+            shard_index = _next_shard_index.fetch_add(1, std::memory_order::relaxed) % num_shards;
+        }
+        return _shards[shard_index].count;
+    }
+
+    [[nodiscard]] log_linear_histogram<>& durations() noexcept
+    {
+        auto expected = _durations.load(std::memory_order::acquire);
+        if (expected != nullptr) [[likely]] {
+            return *expected;
+        }
+
+        auto desired = new log_linear_histogram<>();
+        if (not _durations.compare_exchange_strong(expected, desired, std::memory_order::acq_rel, std::memory_order::acquire)) {
+            // Lost construction race.
+            delete desired;
+            return *expected;
+        }
+        return *desired;
+    }
 };
 
 template<fixed_string Tag>
@@ -204,17 +406,43 @@ inline detail::tagged_counter<Tag> global_counter;
     return detail::counter::get_if(name);
 }
 
+/** Make a snapshot of all the global counters.
+ *
+ * @return The name, total count and durations of each counter, ordered by name.
+ */
+[[nodiscard]] inline std::vector<detail::counter::sample_type> get_global_counter_samples() noexcept
+{
+    return detail::counter::sample();
+}
+
+/** Get the global counters with the highest total count.
+ *
+ * @param n The maximum number of counters to return.
+ * @return The name and total count of the counters, largest count first.
+ */
+[[nodiscard]] inline std::vector<std::pair<std::string, uint64_t>> get_largest_global_counters(std::size_t n) noexcept
+{
+    return detail::counter::largest(n);
+}
+
 inline void log::log_thread_main(std::stop_token stop_token) noexcept
 {
     using namespace std::chrono_literals;
 
     set_thread_name("log");
     hi_log_info("log thread started");
+    try {
+        set_thread_core_class(cpu_core_class::efficiency);
+    } catch (std::exception const& e) {
+        hi_log_warning("Could not run the log thread on the efficiency cores: {}", e.what());
+    }
 
     auto counter_statistics_deadline = std::chrono::utc_clock::now() + 1min;
 
     while (not stop_token.stop_requested()) {
-        log_global.flush();
+        // When messages were written, check again soon, so that a burst of
+        // messages does not fill up the queues of the threads.
+        auto const num_messages = log_global.flush();
 
         auto const now = std::chrono::utc_clock::now();
         if (now >= counter_statistics_deadline) {
@@ -222,7 +450,7 @@ inline void log::log_thread_main(std::stop_token stop_token) noexcept
             detail::counter::log();
         }
 
-        std::this_thread::sleep_for(100ms);
+        std::this_thread::sleep_for(num_messages != 0 ? 1ms : 100ms);
     }
 
     hi_log_info("log thread finished");
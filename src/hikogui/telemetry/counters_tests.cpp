@@ -4,6 +4,9 @@
 
 #include "counters.hpp"
 #include <hikotest/hikotest.hpp>
+#include <thread>
+#include <atomic>
+#include <vector>
 
 TEST_SUITE(counters) {
 
@@ -35,4 +38,40 @@ TEST_CASE(search_and_read)
     REQUIRE(*hi::get_global_counter_if("bar_b") == 2);
 }
 
+TEST_CASE(concurrent_increment)
+{
+    hi::global_counter<"foo_c"> = 0;
+
+    auto num_first = std::atomic<int>{0};
+    auto threads = std::vector<std::jthread>{};
+    for (auto i = 0; i != 8; ++i) {
+        threads.emplace_back([&] {
+            for (auto j = 0; j != 1000; ++j) {
+                ++hi::global_counter<"foo_c">;
+                if (hi::global_counter<"foo_c">.first_increment()) {
+                    ++num_first;
+                }
+            }
+        });
+    }
+    threads.clear();
+
+    REQUIRE(hi::global_counter<"foo_c"> == 16000);
+    REQUIRE(num_first.load() == 1);
+}
+
+
+TEST_CASE(largest_counters)
+{
+    hi::global_counter<"foo_d"> = 2'000'000'000;
+    hi::global_counter<"bar_d"> = 1'000'000'000;
+
+    auto const largest = hi::get_largest_global_counters(2);
+    REQUIRE(largest.size() == 2);
+    REQUIRE(largest[0].first == "foo_d");
+    REQUIRE(largest[0].second == 2'000'000'000);
+    REQUIRE(largest[1].first == "bar_d");
+    REQUIRE(largest[1].second == 1'000'000'000);
+}
+
 };
\ No newline at end of file
@@ -8,6 +8,14 @@
 #include "../macros.hpp"
 #include <format>
 #include <tuple>
+#include <string>
+#include <string_view>
+#include <span>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
 
 hi_export_module(hikogui.telemetry.delayed_format);
 
@@ -78,4 +86,135 @@ private:
     }
 };
 
+namespace detail {
+
+/** The type of a value after it was decoded from the payload of a `binary_format`.
+ *
+ * Strings are decoded as a view into the payload.
+ */
+template<typename Value>
+using binary_format_decoded_t = std::conditional_t<std::is_same_v<Value, std::string>, std::string_view, Value>;
+
+template<typename Value, typename Arg>
+[[nodiscard]] constexpr std::size_t binary_format_size(Arg const& arg) noexcept
+{
+    if constexpr (std::is_same_v<Value, std::string>) {
+        return sizeof(uint32_t) + std::string_view{arg}.size();
+    } else {
+        return sizeof(Value);
+    }
+}
+
+template<typename Value, typename Arg>
+hi_force_inline void binary_format_encode(std::byte *& ptr, Arg const& arg) noexcept
+{
+    if constexpr (std::is_same_v<Value, std::string>) {
+        auto const str = std::string_view{arg};
+        auto const size = narrow_cast<uint32_t>(str.size());
+        std::memcpy(ptr, &size, sizeof(size));
+        ptr += sizeof(size);
+        std::memcpy(ptr, str.data(), size);
+        ptr += size;
+
+    } else {
+        Value const value = arg;
+        std::memcpy(ptr, std::addressof(value), sizeof(Value));
+        ptr += sizeof(Value);
+    }
+}
+
+template<typename Value>
+[[nodiscard]] binary_format_decoded_t<Value> binary_format_decode(std::byte const *& ptr) noexcept
+{
+    if constexpr (std::is_same_v<Value, std::string>) {
+        auto size = uint32_t{};
+        std::memcpy(&size, ptr, sizeof(size));
+        ptr += sizeof(size);
+        auto const r = std::string_view{reinterpret_cast<char const *>(ptr), size};
+        ptr += size;
+        return r;
+
+    } else {
+        auto bytes = std::array<std::byte, sizeof(Value)>{};
+        std::memcpy(bytes.data(), ptr, sizeof(Value));
+        ptr += sizeof(Value);
+        return std::bit_cast<Value>(bytes);
+    }
+}
+
+} // namespace detail
+
+/** Delayed formatting of arguments encoded in a binary payload.
+ *
+ * Unlike `delayed_format` the arguments are not stored in a tuple, but encoded
+ * in a payload provided by the caller, for example directly after a message in
+ * a `wfree_message_fifo`. Trivially copyable values are copied byte-wise and
+ * strings are copied inline prefixed with their length, so that encoding a
+ * string does not allocate.
+ *
+ * The payload is only decoded when formatting, strings are then passed to
+ * `std::format()` as a `std::string_view` into the payload.
+ *
+ * @tparam Fmt The format string.
+ * @tparam Values The storage types of the arguments, see `forward_value_t`.
+ */
+template<fixed_string Fmt, typename... Values>
+class binary_format {
+public:
+    static_assert(std::is_same_v<typename decltype(Fmt)::value_type, char>, "Fmt must be a fixed_string<char>");
+
+    /** True when all the values can be encoded in a payload.
+     */
+    constexpr static bool encodable = ((std::is_same_v<Values, std::string> or std::is_trivially_copyable_v<Values>) and ...);
+
+    /** The number of bytes needed to encode the arguments.
+     */
+    template<typename... Args>
+    [[nodiscard]] constexpr static std::size_t payload_size(Args const&...args) noexcept
+        requires(sizeof...(Args) == sizeof...(Values))
+    {
+        return (detail::binary_format_size<Values>(args) + ... + 0_uz);
+    }
+
+    binary_format(binary_format const&) noexcept = default;
+    binary_format& operator=(binary_format const&) noexcept = default;
+
+    /** Encode the arguments in the payload.
+     *
+     * @param payload The payload, of `payload_size(args...)` bytes, which must outlive this object.
+     * @param args The parameters to std::format, excluding the fmt parameter and locale.
+     */
+    template<typename... Args>
+    hi_force_inline binary_format(std::span<std::byte> payload, Args const&...args) noexcept
+        requires(sizeof...(Args) == sizeof...(Values))
+        : _payload(payload.data())
+    {
+        static_assert(encodable);
+        hi_axiom(payload.size() == payload_size(args...));
+
+        auto ptr = payload.data();
+        (detail::binary_format_encode<Values>(ptr, args), ...);
+    }
+
+    /** Format now.
+     * @return The formatted string.
+     */
+    [[nodiscard]] std::string operator()() const noexcept
+    {
+        auto ptr = static_cast<std::byte const *>(_payload);
+        // The elements of a braced-init-list are evaluated in order.
+        auto const values = std::tuple<detail::binary_format_decoded_t<Values>...>{detail::binary_format_decode<Values>(ptr)...};
+        return std::apply(format_wrapper<detail::binary_format_decoded_t<Values> const&...>, values);
+    }
+
+private:
+    std::byte const *_payload;
+
+    template<typename... Args>
+    static std::string format_wrapper(Args const&...args)
+    {
+        return std::format(static_cast<std::string_view>(Fmt), args...);
+    }
+};
+
 } // namespace hi::inline v1
@@ -0,0 +1,58 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "delayed_format.hpp"
+#include "../utility/utility.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+TEST_SUITE(delayed_format_suite) {
+
+TEST_CASE(delayed_format)
+{
+    auto const str = std::string{"world"};
+    auto const f = hi::delayed_format<"hello {} {}", std::string, int>(str, 42);
+    REQUIRE(f() == "hello world 42");
+}
+
+TEST_CASE(binary_format)
+{
+    using format_type = hi::binary_format<"{} {} {:.1f} {} {}", std::string, int, double, char const *, std::string>;
+    static_assert(format_type::encodable);
+
+    auto str = std::string{"hello"};
+    auto const view = std::string_view{"world"};
+    auto const size = format_type::payload_size(str, 42, 2.25, "literal", view);
+    REQUIRE(size == 4 + 5 + sizeof(int) + sizeof(double) + sizeof(char const *) + 4 + 5);
+
+    auto payload = std::vector<std::byte>(size);
+    auto const f = format_type(payload, str, 42, 2.25, "literal", view);
+
+    // The strings are copied into the payload.
+    str = "xxxxx";
+    REQUIRE(f() == "hello 42 2.2 literal world");
+}
+
+TEST_CASE(binary_format_empty)
+{
+    using format_type = hi::binary_format<"{} and {}", std::string, std::string>;
+
+    auto const size = format_type::payload_size(std::string{}, std::string_view{});
+    REQUIRE(size == 8);
+
+    auto payload = std::vector<std::byte>(size);
+    auto const f = format_type(payload, std::string{}, std::string_view{});
+    REQUIRE(f() == " and ");
+}
+
+TEST_CASE(binary_format_not_encodable)
+{
+    static_assert(not hi::binary_format<"{}", std::vector<int>>::encodable);
+    static_assert(hi::binary_format<"">::encodable);
+}
+
+};
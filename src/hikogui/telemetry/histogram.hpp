@@ -0,0 +1,193 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file histogram.hpp
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <atomic>
+#include <array>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.telemetry : histogram);
+
+hi_export namespace hi::inline v1 {
+
+/** A histogram with logarithmically sized buckets.
+ *
+ * Each power-of-two range of values is split in `2^SubBucketBits` linear
+ * buckets, so that the relative error of a reported value is at most
+ * `1 / 2^SubBucketBits`. Values below `2^SubBucketBits` are counted exactly.
+ *
+ * Adding a value is a single relaxed atomic increment, so that the histogram
+ * can be used from real-time threads. The histogram is used to report tail
+ * latencies, like the 99th percentile, which an average hides.
+ *
+ * @tparam SubBucketBits The number of bits of precision of a bucket.
+ */
+template<std::size_t SubBucketBits = 3>
+class log_linear_histogram {
+public:
+    static_assert(SubBucketBits > 0 and SubBucketBits < 16);
+
+    constexpr static std::size_t num_sub_buckets = std::size_t{1} << SubBucketBits;
+    constexpr static std::size_t num_buckets = (64 - SubBucketBits + 1) * num_sub_buckets;
+
+    constexpr log_linear_histogram() noexcept = default;
+    log_linear_histogram& operator=(log_linear_histogram const&) = delete;
+    log_linear_histogram& operator=(log_linear_histogram&&) = delete;
+
+    /** Make a snapshot of a histogram.
+     *
+     * @note The snapshot is not atomic with values that are added concurrently.
+     */
+    log_linear_histogram(log_linear_histogram const& other) noexcept
+    {
+        for (auto i = 0_uz; i != num_buckets; ++i) {
+            _buckets[i].store(other._buckets[i].load(std::memory_order::relaxed), std::memory_order::relaxed);
+        }
+    }
+
+    /** The index of the bucket that counts a value.
+     */
+    [[nodiscard]] constexpr static std::size_t bucket_index(uint64_t value) noexcept
+    {
+        if (value < num_sub_buckets) {
+            return narrow_cast<std::size_t>(value);
+        }
+
+        auto const exponent = narrow_cast<std::size_t>(std::bit_width(value)) - 1;
+        auto const shift = exponent - SubBucketBits;
+        auto const sub_bucket = narrow_cast<std::size_t>(value >> shift) - num_sub_buckets;
+        return (shift + 1) * num_sub_buckets + sub_bucket;
+    }
+
+    /** The lowest value that is counted in a bucket.
+     */
+    [[nodiscard]] constexpr static uint64_t bucket_lowest(std::size_t index) noexcept
+    {
+        hi_axiom(index < num_buckets);
+
+        if (index < num_sub_buckets) {
+            return index;
+        }
+
+        auto const shift = index / num_sub_buckets - 1;
+        auto const sub_bucket = index % num_sub_buckets;
+        return static_cast<uint64_t>(num_sub_buckets + sub_bucket) << shift;
+    }
+
+    /** The highest value that is counted in a bucket.
+     */
+    [[nodiscard]] constexpr static uint64_t bucket_highest(std::size_t index) noexcept
+    {
+        hi_axiom(index < num_buckets);
+
+        if (index + 1 == num_buckets) {
+            return std::numeric_limits<uint64_t>::max();
+        }
+        return bucket_lowest(index + 1) - 1;
+    }
+
+    /** Add a value to the histogram.
+     *
+     * @note It is safe to call this function from any thread.
+     */
+    void add(uint64_t value) noexcept
+    {
+        _buckets[bucket_index(value)].fetch_add(1, std::memory_order::relaxed);
+    }
+
+    /** Move the counts to a new histogram, and clear this histogram.
+     *
+     * Values that are added concurrently are either counted in the returned
+     * histogram or remain in this histogram, they are never lost.
+     */
+    [[nodiscard]] log_linear_histogram take() noexcept
+    {
+        auto r = log_linear_histogram{};
+        for (auto i = 0_uz; i != num_buckets; ++i) {
+            if (_buckets[i].load(std::memory_order::relaxed) != 0) {
+                r._buckets[i].store(_buckets[i].exchange(0, std::memory_order::relaxed), std::memory_order::relaxed);
+            }
+        }
+        return r;
+    }
+
+    /** The number of values in the histogram.
+     */
+    [[nodiscard]] uint64_t count() const noexcept
+    {
+        auto r = uint64_t{0};
+        for (auto const& bucket : _buckets) {
+            r += bucket.load(std::memory_order::relaxed);
+        }
+        return r;
+    }
+
+    /** The value below which a fraction of the values fall.
+     *
+     * The value returned is the highest value of the bucket containing
+     * the percentile, so that a reported latency is never lower than measured.
+     *
+     * @param fraction The fraction between 0.0 and 1.0, for example 0.99 for the 99th percentile.
+     * @return The value at the percentile, or zero when the histogram is empty.
+     */
+    [[nodiscard]] uint64_t percentile(double fraction) const noexcept
+    {
+        hi_axiom(fraction >= 0.0 and fraction <= 1.0);
+
+        auto const total = count();
+        if (total == 0) {
+            return 0;
+        }
+
+        auto const rank = std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(total))));
+        auto sum = uint64_t{0};
+        for (auto i = 0_uz; i != num_buckets; ++i) {
+            sum += _buckets[i].load(std::memory_order::relaxed);
+            if (sum >= rank) {
+                return bucket_highest(i);
+            }
+        }
+        return std::numeric_limits<uint64_t>::max();
+    }
+
+    /** The lowest bucket value of the smallest value in the histogram.
+     */
+    [[nodiscard]] uint64_t min() const noexcept
+    {
+        for (auto i = 0_uz; i != num_buckets; ++i) {
+            if (_buckets[i].load(std::memory_order::relaxed) != 0) {
+                return bucket_lowest(i);
+            }
+        }
+        return 0;
+    }
+
+    /** The highest bucket value of the largest value in the histogram.
+     */
+    [[nodiscard]] uint64_t max() const noexcept
+    {
+        for (auto i = num_buckets; i != 0; --i) {
+            if (_buckets[i - 1].load(std::memory_order::relaxed) != 0) {
+                return bucket_highest(i - 1);
+            }
+        }
+        return 0;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, num_buckets> _buckets = {};
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,70 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "histogram.hpp"
+#include <hikotest/hikotest.hpp>
+#include <limits>
+#include <cstdint>
+
+TEST_SUITE(histogram) {
+
+TEST_CASE(bucket_index)
+{
+    using histogram_type = hi::log_linear_histogram<3>;
+
+    // Small values are counted exactly.
+    for (auto i = uint64_t{0}; i != 8; ++i) {
+        REQUIRE(histogram_type::bucket_index(i) == i);
+        REQUIRE(histogram_type::bucket_lowest(histogram_type::bucket_index(i)) == i);
+    }
+
+    REQUIRE(histogram_type::bucket_index(8) == 8);
+    REQUIRE(histogram_type::bucket_index(15) == 15);
+    REQUIRE(histogram_type::bucket_index(16) == 16);
+    REQUIRE(histogram_type::bucket_index(17) == 16);
+    REQUIRE(histogram_type::bucket_index(18) == 17);
+    REQUIRE(histogram_type::bucket_index(std::numeric_limits<uint64_t>::max()) == histogram_type::num_buckets - 1);
+
+    // Each value falls between the lowest and highest value of its bucket.
+    for (auto i = uint64_t{1}; i < (uint64_t{1} << 40); i = i * 3 + 1) {
+        auto const index = histogram_type::bucket_index(i);
+        REQUIRE(histogram_type::bucket_lowest(index) <= i);
+        REQUIRE(histogram_type::bucket_highest(index) >= i);
+        REQUIRE(histogram_type::bucket_highest(index) - histogram_type::bucket_lowest(index) <= i / 8);
+    }
+}
+
+TEST_CASE(percentile)
+{
+    auto histogram = hi::log_linear_histogram<>{};
+    REQUIRE(histogram.percentile(0.5) == 0);
+
+    for (auto i = uint64_t{1}; i <= 1000; ++i) {
+        histogram.add(i);
+    }
+    histogram.add(1'000'000);
+
+    REQUIRE(histogram.count() == 1001);
+    REQUIRE(histogram.min() == 1);
+    REQUIRE(histogram.percentile(0.5) >= 501);
+    REQUIRE(histogram.percentile(0.5) <= 501 + 501 / 8);
+    REQUIRE(histogram.percentile(0.99) >= 991);
+    REQUIRE(histogram.percentile(0.99) <= 991 + 991 / 8);
+    REQUIRE(histogram.percentile(1.0) >= 1'000'000);
+    REQUIRE(histogram.max() == histogram.percentile(1.0));
+}
+
+TEST_CASE(take)
+{
+    auto histogram = hi::log_linear_histogram<>{};
+    histogram.add(5);
+    histogram.add(100);
+
+    auto const snapshot = histogram.take();
+    REQUIRE(snapshot.count() == 2);
+    REQUIRE(snapshot.min() == 5);
+    REQUIRE(histogram.count() == 0);
+}
+
+};
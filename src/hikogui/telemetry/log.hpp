@@ -22,6 +22,9 @@
 #include <memory>
 #include <thread>
 #include <filesystem>
+#include <vector>
+#include <algorithm>
+#include <iterator>
 #include <cstdio>
 
 hi_export_module(hikogui.telemetry : log);
@@ -35,11 +38,22 @@ public:
     hi_force_inline log_message_base() noexcept = default;
     virtual ~log_message_base() = default;
 
-    [[nodiscard]] virtual std::string format() const noexcept = 0;
-    [[nodiscard]] virtual std::unique_ptr<log_message_base> make_unique_copy() const noexcept = 0;
+    /** Format the message as a line of text.
+     *
+     * @param buffer The buffer to append the line to, including the line-feed.
+     */
+    virtual void format_to(std::string& buffer) const noexcept = 0;
+
+    /** The time when the message was logged.
+     */
+    [[nodiscard]] virtual time_stamp_count const& time_stamp() const noexcept = 0;
 };
 
-template<global_state_type Level, fixed_string SourcePath, int SourceLine, fixed_string Fmt, typename... Values>
+/** A message on the log queue.
+ *
+ * @tparam What The delayed formatter of the text of the message, `delayed_format` or `binary_format`.
+ */
+template<global_state_type Level, fixed_string SourcePath, int SourceLine, typename What>
 class log_message : public log_message_base {
 public:
     static_assert(std::popcount(std::to_underlying(Level)) == 1);
@@ -66,7 +80,7 @@ public:
     {
     }
 
-    std::string format() const noexcept override
+    void format_to(std::string& buffer) const noexcept override
     {
         auto const utc_time_point = time_stamp_utc::make(_time_stamp);
         auto const sys_time_point = std::chrono::clock_cast<std::chrono::system_clock>(utc_time_point);
@@ -76,12 +90,14 @@ public:
         auto const thread_id = _time_stamp.thread_id();
         auto const thread_name = get_thread_name(thread_id);
 
+        auto out = std::back_inserter(buffer);
         if constexpr (to_bool(Level & global_state_type::log_statistics)) {
-            return std::format("{} {}({}) {:5} {}", local_time_point, thread_name, cpu_id, log_level_name, _what());
+            std::format_to(out, "{} {}({}) {:5} {}\n", local_time_point, thread_name, cpu_id, log_level_name, _what());
         } else {
             auto source_filename = std::filesystem::path{static_cast<std::string_view>(SourcePath)}.filename().generic_string();
-            return std::format(
-                "{} {}({}) {:5} {} ({}:{})",
+            std::format_to(
+                out,
+                "{} {}({}) {:5} {} ({}:{})\n",
                 local_time_point,
                 thread_name,
                 cpu_id,
@@ -92,14 +108,14 @@ public:
         }
     }
 
-    [[nodiscard]] std::unique_ptr<log_message_base> make_unique_copy() const noexcept override
+    [[nodiscard]] time_stamp_count const& time_stamp() const noexcept override
     {
-        return std::make_unique<log_message>(*this);
+        return _time_stamp;
     }
 
 private:
     time_stamp_count _time_stamp;
-    delayed_format<Fmt, Values...> _what;
+    What _what;
 };
 
 } // namespace detail
@@ -123,15 +139,25 @@ public:
             return;
         }
 
-        // Add messages in the queue, block when full.
+        // Add messages in the queue of this thread, block when full.
         // * This reduces amount of instructions needed to be executed during logging.
+        // * The arguments are copied, formatting is done later by the logger thread.
+        // * Threads do not contend with each other when logging.
         // * Simplifies logged_fatal_message logic.
         // * Will make sure everything gets logged.
         // * Blocking is bad in a real time thread, so maybe count the number of times it is blocked.
 
         // Emplace a message directly on the queue.
-        _fifo.emplace<detail::log_message<Level, SourcePath, SourceLine, Fmt, forward_value_t<Args>...>>(
-            std::forward<Args>(args)...);
+        using binary_what = binary_format<Fmt, forward_value_t<Args>...>;
+        if constexpr (binary_what::encodable) {
+            // The arguments are encoded in a payload directly after the message, strings are
+            // copied into the queue itself instead of being allocated on the heap.
+            local_fifo().emplace_with_payload<detail::log_message<Level, SourcePath, SourceLine, binary_what>>(
+                binary_what::payload_size(args...), args...);
+        } else {
+            local_fifo().emplace<detail::log_message<Level, SourcePath, SourceLine, delayed_format<Fmt, forward_value_t<Args>...>>>(
+                std::forward<Args>(args)...);
+        }
 
         if (to_bool(Level & global_state_type::log_fatal) or not to_bool(state & global_state_type::log_is_running)) [[unlikely]] {
             // If the logger did not start we will log in degraded mode and log from the current thread.
@@ -143,26 +169,55 @@ public:
     /** Flush all messages from the log_queue directly from this thread.
      * Flushing includes writing the message to a log file or displaying
      * them on the console.
+     *
+     * The messages are taken from the queues of all threads in batches. Each
+     * batch is formatted into a single buffer, sorted by time and written at once.
+     *
+     * @return The number of messages that were written.
      */
-    hi_no_inline void flush() noexcept
+    hi_no_inline std::size_t flush() noexcept
     {
-        bool wrote_message;
-        do {
-            std::unique_ptr<detail::log_message_base> copy_of_message;
-
-            {
-                auto const lock = std::scoped_lock(_mutex);
+        auto const lock = std::scoped_lock(_mutex);
+
+        {
+            // Make a copy of the list of queues, so that threads can add their
+            // queue while messages are being formatted.
+            auto const fifos_lock = std::scoped_lock(_fifos_mutex);
+            std::erase_if(_fifos, [](auto const& item) {
+                return item->abandoned.load(std::memory_order::acquire) and item->fifo.empty();
+            });
+            _flush_fifos = _fifos;
+        }
 
-                wrote_message = _fifo.take_one([&copy_of_message](auto& message) {
-                    copy_of_message = message.make_unique_copy();
-                });
+        auto r = 0_uz;
+        while (true) {
+            _buffer.clear();
+            _lines.clear();
+
+            for (auto const& item : _flush_fifos) {
+                for (auto i = 0_uz; i != max_batch_size; ++i) {
+                    auto const took_message = item->fifo.take_one([this](auto const& message) {
+                        auto const first = _buffer.size();
+                        message.format_to(_buffer);
+                        _lines.emplace_back(message.time_stamp().count(), first, _buffer.size());
+                    });
+
+                    if (not took_message) {
+                        break;
+                    }
+                }
             }
 
-            if (wrote_message) {
-                hi_assert_not_null(copy_of_message);
-                write(copy_of_message->format());
+            if (_lines.empty()) {
+                break;
             }
-        } while (wrote_message);
+
+            r += _lines.size();
+            write_batch();
+        }
+
+        _flush_fifos.clear();
+        return r;
     }
 
     /** Start the logger system.
@@ -183,18 +238,107 @@ public:
     }
 
 private:
-    /** The global log queue contains messages to be displayed by the logger thread.
+    using fifo_type = wfree_message_fifo<detail::log_message_base>;
+
+    /** The log queue of a thread.
+     */
+    struct thread_fifo {
+        fifo_type fifo;
+
+        /** The thread that owns the queue has exited.
+         */
+        std::atomic<bool> abandoned = false;
+    };
+
+    /** Mark the queue of a thread as abandoned when the thread exits.
+     */
+    struct thread_fifo_owner {
+        std::shared_ptr<thread_fifo> ptr;
+
+        ~thread_fifo_owner()
+        {
+            if (ptr) {
+                ptr->abandoned.store(true, std::memory_order::release);
+            }
+        }
+    };
+
+    /** A formatted message in the `_buffer`.
+     */
+    struct line_type {
+        uint64_t time_stamp;
+        std::size_t first;
+        std::size_t last;
+    };
+
+    /** The maximum number of messages taken from a single queue in one batch.
+     */
+    constexpr static std::size_t max_batch_size = 256;
+
+    /** The log queues of each thread, which logged a message.
+     */
+    std::vector<std::shared_ptr<thread_fifo>> _fifos;
+    mutable unfair_mutex _fifos_mutex;
+
+    /** The mutex held by the thread that is flushing.
      */
-    wfree_fifo<detail::log_message_base, 64> _fifo;
     mutable unfair_mutex _mutex;
 
+    /** The copy of `_fifos` used during flush.
+     */
+    std::vector<std::shared_ptr<thread_fifo>> _flush_fifos;
+
+    /** Buffers reused between batches.
+     */
+    std::string _buffer;
+    std::string _sorted_buffer;
+    std::vector<line_type> _lines;
+
+    inline static thread_local thread_fifo_owner _local_fifo;
+
+    /** Get the log queue of the current thread.
+     */
+    [[nodiscard]] hi_force_inline fifo_type& local_fifo() noexcept
+    {
+        if (auto const ptr = _local_fifo.ptr.get()) [[likely]] {
+            return ptr->fifo;
+        }
+        return make_local_fifo();
+    }
+
+    [[nodiscard]] hi_no_inline fifo_type& make_local_fifo() noexcept
+    {
+        _local_fifo.ptr = std::make_shared<thread_fifo>();
+
+        auto const lock = std::scoped_lock(_fifos_mutex);
+        _fifos.push_back(_local_fifo.ptr);
+        return _local_fifo.ptr->fifo;
+    }
+
+    /** Write the formatted messages of a batch in order of time.
+     */
+    void write_batch() noexcept
+    {
+        std::stable_sort(_lines.begin(), _lines.end(), [](auto const& a, auto const& b) {
+            return a.time_stamp < b.time_stamp;
+        });
+
+        _sorted_buffer.clear();
+        for (auto const& line : _lines) {
+            _sorted_buffer.append(_buffer, line.first, line.last - line.first);
+        }
+        write(_sorted_buffer);
+    }
+
     /** Write to a log file and console.
      * This will write to the console if one is open.
      * It will also create a log file in the application-data directory.
+     *
+     * @param str The lines of text to write, each line ends in a line-feed.
      */
     void write(std::string const& str) const noexcept
     {
-        std::println(stderr, "{}", str);
+        std::fwrite(str.data(), 1, str.size(), stderr);
     }
 
     /** The global logger thread.
@@ -0,0 +1,216 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file memory_tracking.hpp Account the memory used by each subsystem.
+ *
+ * The memory of a subsystem is accounted in two global counters:
+ *  - "memory:<tag>:bytes" The number of bytes currently allocated.
+ *  - "memory:<tag>:allocations" The number of allocations currently alive.
+ *
+ * Because they are global counters, they are logged with the statistics,
+ * exported with `format_openmetrics()` and shown on the performance overlay.
+ */
+
+#pragma once
+
+#include "counters.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <memory_resource>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <format>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.telemetry : memory_tracking);
+
+hi_export namespace hi::inline v1 {
+namespace detail {
+
+template<fixed_string Tag>
+constexpr auto memory_bytes_tag = fixed_string{"memory:"} + Tag + ":bytes";
+
+template<fixed_string Tag>
+constexpr auto memory_allocations_tag = fixed_string{"memory:"} + Tag + ":allocations";
+
+} // namespace detail
+
+/** Account for an allocation of a subsystem.
+ *
+ * @tparam Tag The name of the subsystem.
+ * @param size The size of the allocation in bytes.
+ */
+template<fixed_string Tag>
+void track_allocation(std::size_t size) noexcept
+{
+    global_counter<detail::memory_bytes_tag<Tag>> += size;
+    ++global_counter<detail::memory_allocations_tag<Tag>>;
+}
+
+/** Account for a deallocation of a subsystem.
+ *
+ * @tparam Tag The name of the subsystem.
+ * @param size The size of the allocation in bytes, the same as passed to `track_allocation()`.
+ */
+template<fixed_string Tag>
+void track_deallocation(std::size_t size) noexcept
+{
+    global_counter<detail::memory_bytes_tag<Tag>> -= size;
+    --global_counter<detail::memory_allocations_tag<Tag>>;
+}
+
+/** A memory resource which accounts the allocations of a subsystem.
+ *
+ * @tparam Tag The name of the subsystem.
+ */
+template<fixed_string Tag>
+class tracked_memory_resource : public std::pmr::memory_resource {
+public:
+    /** Create a memory resource.
+     *
+     * @param upstream The memory resource that allocates the memory.
+     */
+    explicit tracked_memory_resource(std::pmr::memory_resource *upstream = std::pmr::get_default_resource()) noexcept :
+        _upstream(upstream)
+    {
+        hi_axiom_not_null(_upstream);
+    }
+
+    [[nodiscard]] std::pmr::memory_resource *upstream_resource() const noexcept
+    {
+        return _upstream;
+    }
+
+private:
+    std::pmr::memory_resource *_upstream;
+
+    void *do_allocate(std::size_t size, std::size_t alignment) override
+    {
+        auto const r = _upstream->allocate(size, alignment);
+        track_allocation<Tag>(size);
+        return r;
+    }
+
+    void do_deallocate(void *ptr, std::size_t size, std::size_t alignment) override
+    {
+        _upstream->deallocate(ptr, size, alignment);
+        track_deallocation<Tag>(size);
+    }
+
+    [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+/** An allocator for the containers of a subsystem, which accounts the allocations.
+ *
+ * @tparam T The type of the values to allocate.
+ * @tparam Tag The name of the subsystem.
+ */
+template<typename T, fixed_string Tag>
+class tracked_allocator {
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = tracked_allocator<U, Tag>;
+    };
+
+    constexpr tracked_allocator() noexcept = default;
+
+    template<typename U>
+    constexpr tracked_allocator(tracked_allocator<U, Tag> const&) noexcept
+    {
+    }
+
+    [[nodiscard]] T *allocate(std::size_t n)
+    {
+        auto const r = std::allocator<T>{}.allocate(n);
+        track_allocation<Tag>(n * sizeof(T));
+        return r;
+    }
+
+    void deallocate(T *ptr, std::size_t n) noexcept
+    {
+        std::allocator<T>{}.deallocate(ptr, n);
+        track_deallocation<Tag>(n * sizeof(T));
+    }
+
+    template<typename U>
+    [[nodiscard]] constexpr bool operator==(tracked_allocator<U, Tag> const&) const noexcept
+    {
+        return true;
+    }
+};
+
+/** A base class which accounts the objects of a subsystem allocated with `new`.
+ *
+ * The sized `operator delete` is used, so that when the base class has a
+ * virtual destructor the size of the most derived class is accounted.
+ *
+ * @tparam Tag The name of the subsystem.
+ */
+template<fixed_string Tag>
+class tracked_allocated {
+public:
+    [[nodiscard]] static void *operator new(std::size_t size)
+    {
+        auto const r = ::operator new(size);
+        track_allocation<Tag>(size);
+        return r;
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept
+    {
+        ::operator delete(ptr);
+        track_deallocation<Tag>(size);
+    }
+};
+
+/** The memory used by a subsystem.
+ */
+struct memory_usage_type {
+    std::string tag;
+    std::size_t bytes = 0;
+    std::size_t allocations = 0;
+};
+
+/** Get the memory used by each subsystem.
+ *
+ * @return The memory usage of each subsystem, ordered by the number of bytes, largest first.
+ */
+[[nodiscard]] inline std::vector<memory_usage_type> get_memory_usage() noexcept
+{
+    constexpr auto prefix = std::string_view{"memory:"};
+    constexpr auto bytes_suffix = std::string_view{":bytes"};
+
+    auto r = std::vector<memory_usage_type>{};
+    for (auto const& sample : get_global_counter_samples()) {
+        auto name = std::string_view{sample.name};
+        if (not name.starts_with(prefix) or not name.ends_with(bytes_suffix)) {
+            continue;
+        }
+        name.remove_prefix(prefix.size());
+        name.remove_suffix(bytes_suffix.size());
+
+        auto& item = r.emplace_back(std::string{name}, narrow_cast<std::size_t>(sample.total));
+        if (auto const allocations = get_global_counter_if(std::format("memory:{}:allocations", name))) {
+            item.allocations = narrow_cast<std::size_t>(static_cast<uint64_t>(*allocations));
+        }
+    }
+
+    std::ranges::sort(r, [](auto const& a, auto const& b) {
+        return a.bytes > b.bytes;
+    });
+    return r;
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,77 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "memory_tracking.hpp"
+#include <hikotest/hikotest.hpp>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <array>
+
+TEST_SUITE(memory_tracking_suite) {
+
+TEST_CASE(resource_test)
+{
+    auto resource = hi::tracked_memory_resource<"tests_resource">{};
+    {
+        auto v = std::pmr::vector<int>{&resource};
+        v.resize(100);
+        REQUIRE(hi::global_counter<"memory:tests_resource:bytes"> == 100 * sizeof(int));
+        REQUIRE(hi::global_counter<"memory:tests_resource:allocations"> == 1);
+    }
+    REQUIRE(hi::global_counter<"memory:tests_resource:bytes"> == 0);
+    REQUIRE(hi::global_counter<"memory:tests_resource:allocations"> == 0);
+}
+
+TEST_CASE(allocator_test)
+{
+    {
+        auto m = std::map<int, int, std::less<>, hi::tracked_allocator<std::pair<int const, int>, "tests_allocator">>{};
+        m[1] = 1;
+        m[2] = 2;
+        REQUIRE(hi::global_counter<"memory:tests_allocator:allocations"> == 2);
+        REQUIRE(hi::global_counter<"memory:tests_allocator:bytes"> > 2 * sizeof(std::pair<int const, int>));
+    }
+    REQUIRE(hi::global_counter<"memory:tests_allocator:bytes"> == 0);
+    REQUIRE(hi::global_counter<"memory:tests_allocator:allocations"> == 0);
+}
+
+struct tracked_base : hi::tracked_allocated<"tests_object"> {
+    virtual ~tracked_base() = default;
+};
+
+struct tracked_derived : tracked_base {
+    std::array<char, 100> data = {};
+};
+
+TEST_CASE(allocated_test)
+{
+    {
+        auto const ptr = std::unique_ptr<tracked_base>{std::make_unique<tracked_derived>()};
+        REQUIRE(hi::global_counter<"memory:tests_object:bytes"> == sizeof(tracked_derived));
+        REQUIRE(hi::global_counter<"memory:tests_object:allocations"> == 1);
+    }
+    // Deleted through the base class, the size of the derived class is accounted.
+    REQUIRE(hi::global_counter<"memory:tests_object:bytes"> == 0);
+    REQUIRE(hi::global_counter<"memory:tests_object:allocations"> == 0);
+}
+
+TEST_CASE(usage_test)
+{
+    hi::track_allocation<"tests_usage">(1000);
+    hi::track_allocation<"tests_usage">(24);
+
+    auto const usages = hi::get_memory_usage();
+    auto const it = std::ranges::find(usages, "tests_usage", &hi::memory_usage_type::tag);
+    REQUIRE(it != usages.end());
+    REQUIRE(it->bytes == 1024);
+    REQUIRE(it->allocations == 2);
+
+    hi::track_deallocation<"tests_usage">(1000);
+    hi::track_deallocation<"tests_usage">(24);
+}
+
+};
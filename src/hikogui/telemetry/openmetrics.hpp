@@ -0,0 +1,108 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file openmetrics.hpp Format the global counters in the OpenMetrics text format.
+ */
+
+#pragma once
+
+#include "counters.hpp"
+#include "../time/time.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <span>
+#include <array>
+#include <chrono>
+#include <format>
+#include <iterator>
+
+hi_export_module(hikogui.telemetry : openmetrics);
+
+hi_export namespace hi::inline v1 {
+
+/** The content type of the OpenMetrics text format.
+ */
+constexpr auto openmetrics_content_type = std::string_view{"application/openmetrics-text; version=1.0.0; charset=utf-8"};
+
+/** Convert the name of a counter to the name of a metric.
+ *
+ * The name is prefixed with "hi_", and each character that is not allowed
+ * in a metric name is replaced with an underscore. For example
+ * "gfx_surface:input-to-present" becomes "hi_gfx_surface_input_to_present".
+ *
+ * @param name The name of the counter.
+ * @return The name of the metric.
+ */
+[[nodiscard]] constexpr std::string openmetrics_name(std::string_view name) noexcept
+{
+    auto r = std::string{"hi_"};
+    r.reserve(r.size() + name.size());
+    for (auto const c : name) {
+        if ((c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z') or (c >= '0' and c <= '9')) {
+            r += c;
+        } else {
+            r += '_';
+        }
+    }
+    return r;
+}
+
+/** Format counters in the OpenMetrics text format.
+ *
+ * Counters are used both as monotonic counters and as gauges, so their type
+ * is "unknown". A counter with durations is also exported as a summary in
+ * seconds, named with the "_duration_seconds" suffix; the quantiles are of
+ * the durations since the counters were last logged.
+ *
+ * @param samples The snapshots of the counters.
+ * @return The text, terminated with "# EOF".
+ */
+[[nodiscard]] inline std::string format_openmetrics(std::span<detail::counter::sample_type const> samples)
+{
+    constexpr auto quantiles = std::array{0.5, 0.9, 0.99, 0.999};
+
+    auto r = std::string{};
+    auto out = std::back_inserter(r);
+    for (auto const& sample : samples) {
+        auto const name = openmetrics_name(sample.name);
+
+        std::format_to(out, "# TYPE {} unknown\n", name);
+        std::format_to(out, "# HELP {} The global counter \"{}\".\n", name, sample.name);
+        std::format_to(out, "{} {}\n", name, sample.total);
+
+        if (sample.durations) {
+            auto const to_seconds = [](uint64_t count) {
+                return std::chrono::duration<double>{time_stamp_count::duration_from_count(count)}.count();
+            };
+
+            std::format_to(out, "# TYPE {}_duration_seconds summary\n", name);
+            std::format_to(out, "# UNIT {}_duration_seconds seconds\n", name);
+            for (auto const quantile : quantiles) {
+                std::format_to(
+                    out,
+                    "{}_duration_seconds{{quantile=\"{}\"}} {}\n",
+                    name,
+                    quantile,
+                    to_seconds(sample.durations->percentile(quantile)));
+            }
+            std::format_to(out, "{}_duration_seconds_count {}\n", name, sample.durations->count());
+        }
+    }
+    r += "# EOF\n";
+    return r;
+}
+
+/** Format all the global counters in the OpenMetrics text format.
+ *
+ * This includes the frame statistics and the memory budgets, which are kept in global counters.
+ *
+ * @return The text, terminated with "# EOF".
+ */
+[[nodiscard]] inline std::string format_openmetrics()
+{
+    return format_openmetrics(get_global_counter_samples());
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,45 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "openmetrics.hpp"
+#include <hikotest/hikotest.hpp>
+#include <vector>
+#include <string>
+
+TEST_SUITE(openmetrics_suite) {
+
+TEST_CASE(name_test)
+{
+    REQUIRE(hi::openmetrics_name("gfx_surface:input-to-present") == "hi_gfx_surface_input_to_present");
+    REQUIRE(hi::openmetrics_name("gfx_device:memory:glyph-atlas") == "hi_gfx_device_memory_glyph_atlas");
+    REQUIRE(hi::openmetrics_name("") == "hi_");
+}
+
+TEST_CASE(format_test)
+{
+    auto samples = std::vector<hi::detail::counter::sample_type>{};
+    samples.push_back(hi::detail::counter::sample_type{"frame:count", 42});
+    samples.push_back(hi::detail::counter::sample_type{"log:overflow", 0});
+
+    auto const expected = std::string{
+        "# TYPE hi_frame_count unknown\n"
+        "# HELP hi_frame_count The global counter \"frame:count\".\n"
+        "hi_frame_count 42\n"
+        "# TYPE hi_log_overflow unknown\n"
+        "# HELP hi_log_overflow The global counter \"log:overflow\".\n"
+        "hi_log_overflow 0\n"
+        "# EOF\n"};
+    REQUIRE(hi::format_openmetrics(samples) == expected);
+}
+
+TEST_CASE(global_test)
+{
+    ++hi::global_counter<"openmetrics_tests:global">;
+
+    auto const text = hi::format_openmetrics();
+    REQUIRE(text.contains("hi_openmetrics_tests_global 1\n"));
+    REQUIRE(text.ends_with("# EOF\n"));
+}
+
+};
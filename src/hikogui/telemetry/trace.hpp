@@ -7,10 +7,12 @@
 #include "../utility/utility.hpp"
 #include "../time/time.hpp"
 #include "counters.hpp"
+#include "trace_recorder.hpp"
 #include "../macros.hpp"
 #include <array>
 #include <tuple>
 #include <exception>
+#include <string_view>
 
 hi_export_module(hikogui.telemetry : trace);
 
@@ -39,9 +41,17 @@ protected:
     trace_base *_next = nullptr;
 };
 
+/** Trace the duration of a scope.
+ *
+ * The duration is added to the `global_counter<Tag>` and recorded in the `trace_recorder_global`.
+ *
+ * @tparam Tag The name of the scope.
+ */
 template<fixed_string Tag>
 class trace : public trace_base {
 public:
+    constexpr static std::string_view tag_name = Tag;
+
     trace() noexcept : trace_base() {}
 
     virtual ~trace() noexcept
@@ -52,6 +62,7 @@ public:
 
         auto const current_time_stamp = time_stamp_count{time_stamp_count::inplace{}};
         global_counter<Tag>.add_duration(current_time_stamp.count() - _time_stamp.count());
+        trace_recorder_global.record(tag_name, _time_stamp.count(), current_time_stamp.count());
     }
 
     void log() const noexcept override
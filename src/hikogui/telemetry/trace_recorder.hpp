@@ -0,0 +1,304 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file trace_recorder.hpp
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../time/time.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../concurrency/unfair_mutex.hpp" // XXX #616
+#include "../concurrency/thread.hpp" // XXX #616
+#include "../macros.hpp"
+#include <atomic>
+#include <array>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <format>
+#include <iterator>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.telemetry : trace_recorder);
+
+hi_export namespace hi::inline v1 {
+
+/** A recorder of trace events.
+ *
+ * Each thread records the begin and end time stamps of its `trace`s into its
+ * own ring buffer. Recording is lock-free and wait-free, it does not format any
+ * text, so that tracing can always be left on. When the ring buffer is full the
+ * oldest events are overwritten.
+ *
+ * After a problem, like a dropped frame, the last events of all the threads can be
+ * dumped in the Chrome trace event format, which can be opened with `chrome://tracing`
+ * or https://ui.perfetto.dev.
+ *
+ * @note The ring buffers are owned by the threads, therefor `trace_recorder_global`
+ *       should be the only instance.
+ */
+class trace_recorder {
+public:
+    /** The size of the ring buffer of each thread.
+     *
+     * One slot in the ring buffer may be in the process of being written,
+     * so only the last `capacity - 1` events of each thread can be read.
+     */
+    constexpr static std::size_t capacity = 2048;
+
+    /** A trace event copied from a ring buffer.
+     */
+    struct event_type {
+        std::string_view name;
+        thread_id thread = 0;
+        uint64_t begin = 0;
+        uint64_t end = 0;
+    };
+
+    trace_recorder() noexcept = default;
+    trace_recorder(trace_recorder const&) = delete;
+    trace_recorder(trace_recorder&&) = delete;
+    trace_recorder& operator=(trace_recorder const&) = delete;
+    trace_recorder& operator=(trace_recorder&&) = delete;
+
+    /** Record an event.
+     *
+     * @note It is safe to call this function from any thread.
+     * @param name The name of the event. The string_view must have static storage duration,
+     *             like the tag of a `trace`, since only its address is recorded.
+     * @param begin The time stamp count when the event started.
+     * @param end The time stamp count when the event ended.
+     */
+    void record(std::string_view const& name, uint64_t begin, uint64_t end) noexcept
+    {
+        auto& buffer = local_buffer();
+
+        auto const index = buffer.head.load(std::memory_order::relaxed);
+        // Make sure the reader sees the new head before the event is overwritten.
+        std::atomic_thread_fence(std::memory_order::release);
+
+        auto& event = buffer.events[index % capacity];
+        event.name.store(&name, std::memory_order::relaxed);
+        event.begin.store(begin, std::memory_order::relaxed);
+        event.end.store(end, std::memory_order::relaxed);
+        buffer.head.store(index + 1, std::memory_order::release);
+    }
+
+    /** Copy the events from the ring buffers of all threads.
+     *
+     * Events that are overwritten while they are copied are discarded.
+     *
+     * @note It is safe to call this function from any thread, while other threads are recording.
+     * @return The events, sorted by their begin time.
+     */
+    [[nodiscard]] std::vector<event_type> events() const noexcept
+    {
+        auto r = std::vector<event_type>{};
+
+        auto const lock = std::scoped_lock(_mutex);
+        for (auto const& buffer : _buffers) {
+            auto const head = buffer->head.load(std::memory_order::acquire);
+            auto const first = head >= capacity ? head - capacity + 1 : 0;
+
+            auto const offset = r.size();
+            for (auto i = first; i != head; ++i) {
+                auto const& event = buffer->events[i % capacity];
+                r.emplace_back(
+                    *event.name.load(std::memory_order::relaxed),
+                    buffer->thread,
+                    event.begin.load(std::memory_order::relaxed),
+                    event.end.load(std::memory_order::relaxed));
+            }
+
+            // Check which events where overwritten by the thread while copying.
+            std::atomic_thread_fence(std::memory_order::acquire);
+            auto const new_head = buffer->head.load(std::memory_order::relaxed);
+            auto const valid_first = new_head >= capacity ? new_head - capacity + 1 : 0;
+            if (valid_first > first) {
+                auto const num_overwritten = std::min(valid_first - first, head - first);
+                r.erase(r.begin() + offset, r.begin() + offset + num_overwritten);
+            }
+        }
+
+        std::stable_sort(r.begin(), r.end(), [](auto const& a, auto const& b) {
+            return a.begin < b.begin;
+        });
+        return r;
+    }
+
+    /** Dump the events in the Chrome trace event format.
+     *
+     * @return A JSON document with complete-events and the names of the threads.
+     */
+    [[nodiscard]] std::string chrome_trace() const noexcept
+    {
+        return chrome_trace(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    /** Dump the events that overlap a period in the Chrome trace event format.
+     *
+     * @param first The time stamp count of the start of the period.
+     * @param last The time stamp count of the end of the period.
+     * @param other_data A JSON object to add as "otherData" to the document, or empty.
+     * @return A JSON document with complete-events and the names of the threads.
+     */
+    [[nodiscard]] std::string chrome_trace(uint64_t first, uint64_t last, std::string_view other_data = {}) const noexcept
+    {
+        auto events_ = events();
+        std::erase_if(events_, [first, last](auto const& event) {
+            return event.end < first or event.begin > last;
+        });
+
+        auto r = std::string{};
+        auto out = std::back_inserter(r);
+        r += "{\"traceEvents\":[";
+
+        auto threads = std::vector<thread_id>{};
+        for (auto const& event : events_) {
+            threads.push_back(event.thread);
+        }
+        std::sort(threads.begin(), threads.end());
+        threads.erase(std::unique(threads.begin(), threads.end()), threads.end());
+
+        auto first = true;
+        for (auto const thread : threads) {
+            std::format_to(
+                out,
+                "{}\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+                first ? "" : ",",
+                thread,
+                json_escape(get_thread_name(thread)));
+            first = false;
+        }
+
+        auto const epoch = events_.empty() ? uint64_t{0} : events_.front().begin;
+        for (auto const& event : events_) {
+            // Timestamps are in microseconds.
+            auto const ts = time_stamp_count::duration_from_count(event.begin - epoch).count();
+            auto const dur = time_stamp_count::duration_from_count(event.end - event.begin).count();
+            std::format_to(
+                out,
+                "{}\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{}.{:03},\"dur\":{}.{:03}}}",
+                first ? "" : ",",
+                json_escape(event.name),
+                event.thread,
+                ts / 1000,
+                ts % 1000,
+                dur / 1000,
+                dur % 1000);
+            first = false;
+        }
+
+        r += "\n]";
+        if (not other_data.empty()) {
+            r += ",\n\"otherData\":";
+            r += other_data;
+        }
+        r += "}\n";
+        return r;
+    }
+
+private:
+    struct event_slot {
+        std::atomic<std::string_view const *> name = nullptr;
+        std::atomic<uint64_t> begin = 0;
+        std::atomic<uint64_t> end = 0;
+    };
+
+    struct buffer_type {
+        std::array<event_slot, capacity> events = {};
+
+        /** The index of the next event to write.
+         */
+        std::atomic<uint64_t> head = 0;
+
+        thread_id thread = 0;
+
+        /** The thread that recorded into the buffer has exited.
+         */
+        std::atomic<bool> abandoned = false;
+    };
+
+    /** Mark the buffer of a thread as abandoned when the thread exits.
+     */
+    struct buffer_owner {
+        std::shared_ptr<buffer_type> ptr;
+
+        ~buffer_owner()
+        {
+            if (ptr) {
+                ptr->abandoned.store(true, std::memory_order::release);
+            }
+        }
+    };
+
+    /** The maximum number of buffers of exited threads to keep.
+     */
+    constexpr static std::size_t max_abandoned = 16;
+
+    std::vector<std::shared_ptr<buffer_type>> _buffers;
+    mutable unfair_mutex _mutex;
+
+    inline static thread_local buffer_owner _local_buffer;
+
+    [[nodiscard]] hi_force_inline buffer_type& local_buffer() noexcept
+    {
+        if (auto const ptr = _local_buffer.ptr.get()) [[likely]] {
+            return *ptr;
+        }
+        return make_local_buffer();
+    }
+
+    [[nodiscard]] hi_no_inline buffer_type& make_local_buffer() noexcept
+    {
+        _local_buffer.ptr = std::make_shared<buffer_type>();
+        _local_buffer.ptr->thread = current_thread_id();
+
+        auto const lock = std::scoped_lock(_mutex);
+
+        // Keep the events of recently exited threads, as they may be needed to diagnose a problem.
+        auto num_abandoned = narrow_cast<std::size_t>(std::count_if(_buffers.begin(), _buffers.end(), [](auto const& item) {
+            return item->abandoned.load(std::memory_order::acquire);
+        }));
+        std::erase_if(_buffers, [&num_abandoned](auto const& item) {
+            if (num_abandoned >= max_abandoned and item->abandoned.load(std::memory_order::acquire)) {
+                --num_abandoned;
+                return true;
+            }
+            return false;
+        });
+
+        _buffers.push_back(_local_buffer.ptr);
+        return *_local_buffer.ptr;
+    }
+
+    [[nodiscard]] static std::string json_escape(std::string_view str) noexcept
+    {
+        auto r = std::string{};
+        for (auto const c : str) {
+            if (c == '"' or c == '\\') {
+                r += '\\';
+                r += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                std::format_to(std::back_inserter(r), "\\u{:04x}", static_cast<unsigned char>(c));
+            } else {
+                r += c;
+            }
+        }
+        return r;
+    }
+};
+
+/** The trace recorder used by all `trace`s.
+ */
+inline trace_recorder trace_recorder_global;
+
+} // namespace hi::inline v1
@@ -0,0 +1,92 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "trace_recorder.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+
+TEST_SUITE(trace_recorder) {
+
+constexpr static std::string_view foo_name = "trace_recorder_tests:foo";
+constexpr static std::string_view bar_name = "trace_recorder_tests:bar";
+
+TEST_CASE(record)
+{
+    hi::trace_recorder_global.record(foo_name, 1000, 2000);
+    auto thread = std::jthread([] {
+        hi::trace_recorder_global.record(bar_name, 1500, 1600);
+    });
+    thread.join();
+
+    auto foo_count = 0;
+    auto bar_count = 0;
+    auto foo_thread = hi::thread_id{};
+    auto bar_thread = hi::thread_id{};
+    for (auto const& event : hi::trace_recorder_global.events()) {
+        if (event.name == foo_name) {
+            ++foo_count;
+            foo_thread = event.thread;
+            REQUIRE(event.begin == 1000);
+            REQUIRE(event.end == 2000);
+        } else if (event.name == bar_name) {
+            ++bar_count;
+            bar_thread = event.thread;
+        }
+    }
+
+    REQUIRE(foo_count == 1);
+    REQUIRE(bar_count == 1);
+    REQUIRE(foo_thread != bar_thread);
+
+    auto const json = hi::trace_recorder_global.chrome_trace();
+    REQUIRE(json.starts_with("{\"traceEvents\":["));
+    REQUIRE(json.find("\"name\":\"trace_recorder_tests:foo\",\"ph\":\"X\"") != std::string::npos);
+}
+
+TEST_CASE(overwrite)
+{
+    constexpr static std::string_view name = "trace_recorder_tests:overwrite";
+
+    auto thread = std::jthread([] {
+        for (auto i = uint64_t{0}; i != hi::trace_recorder::capacity + 10; ++i) {
+            hi::trace_recorder_global.record(name, i, i + 1);
+        }
+    });
+    thread.join();
+
+    auto count = std::size_t{0};
+    auto first = std::numeric_limits<uint64_t>::max();
+    for (auto const& event : hi::trace_recorder_global.events()) {
+        if (event.name == name) {
+            ++count;
+            first = std::min(first, event.begin);
+        }
+    }
+
+    // Only the last events are kept.
+    REQUIRE(count == hi::trace_recorder::capacity - 1);
+    REQUIRE(first == 11);
+}
+
+TEST_CASE(chrome_trace_period)
+{
+    constexpr static std::string_view inside = "trace_recorder_tests:inside";
+    constexpr static std::string_view outside = "trace_recorder_tests:outside";
+
+    hi::trace_recorder_global.record(outside, 100, 200);
+    hi::trace_recorder_global.record(inside, 250, 400);
+    hi::trace_recorder_global.record(outside, 500, 600);
+
+    auto const json = hi::trace_recorder_global.chrome_trace(300, 450, "{\"frame\":1}");
+    REQUIRE(json.find(inside) != std::string::npos);
+    REQUIRE(json.find(outside) == std::string::npos);
+    REQUIRE(json.find("\"otherData\":{\"frame\":1}") != std::string::npos);
+}
+
+};
@@ -12,10 +12,16 @@
 #include "../font/font.hpp"
 #include "../geometry/geometry.hpp"
 #include "../unicode/unicode.hpp"
+#include "../dispatch/thread_pool.hpp"
 #include "../units/units.hpp"
 #include "../macros.hpp"
 #include <vector>
+#include <atomic>
+#include <memory>
+#include <memory_resource>
 #include <tuple>
+#include <utility>
+#include <iterator>
 #include <coroutine>
 
 hi_export_module(hikogui.text.text_shaper);
@@ -97,10 +103,7 @@ public:
 
         _text.reserve(text.size());
         for (auto const& c : text) {
-            auto const clean_c = c == '\n' ? grapheme{unicode_PS} : c;
-
-            auto& tmp = _text.emplace_back(clean_c, style, _pixel_density);
-            tmp.initialize_glyph(font);
+            _text.push_back(make_char(c, style, _pixel_density, font));
         }
 
         _text_direction = unicode_bidi_direction(
@@ -111,24 +114,19 @@ public:
             },
             _bidi_context);
 
-        _line_break_opportunities = unicode_line_break(_text.begin(), _text.end(), [](auto const& c) -> decltype(auto) {
-            return c.grapheme.starter();
-        });
+        auto break_opportunities = get_break_opportunities(0, size());
+        _line_break_opportunities = std::move(break_opportunities.line);
+        _word_break_opportunities = std::move(break_opportunities.word);
+        _sentence_break_opportunities = std::move(break_opportunities.sentence);
 
         _line_break_widths.reserve(text.size());
         for (auto const& c : _text) {
-            _line_break_widths.push_back(is_visible(c.general_category) ? c.width : -c.width);
+            _line_break_widths.push_back(line_break_width(c));
         }
-
-        _word_break_opportunities = unicode_word_break(_text.begin(), _text.end(), [](auto const& c) -> decltype(auto) {
-            return c.grapheme.starter();
-        });
-
-        _sentence_break_opportunities = unicode_sentence_break(_text.begin(), _text.end(), [](auto const& c) -> decltype(auto) {
-            return c.grapheme.starter();
-        });
+        _line_break_cache = unicode_line_break_cache{_line_break_opportunities, _line_break_widths};
 
         resolve_script();
+        _generation = make_generation();
     }
 
     [[nodiscard]] text_shaper(
@@ -142,6 +140,144 @@ public:
     {
     }
 
+    /** Replace part of the text.
+     *
+     * Instead of shaping the whole text again, the break opportunities, text-direction
+     * and scripts are only determined for the paragraphs that contain the edit.
+     *
+     * The lines of the other paragraphs are retained; when the text has been laid out
+     * before, the next call to `layout()` with the same width will only lay out the lines
+     * of the edited paragraphs.
+     *
+     * @param first The index of the first character to replace.
+     * @param last The index one beyond the last character to replace.
+     * @param text The replacement text.
+     * @param style The text-style to display the replacement text, same as passed to the constructor.
+     */
+    void replace(size_t first, size_t last, gstring_view text, text_style_set const& style) noexcept
+    {
+        hi_axiom(first <= last);
+        hi_axiom(last <= size());
+        _generation = make_generation();
+
+        auto const old_size = size();
+        auto const old_first_script = get_first_script();
+        auto const paragraph_first = get_paragraph_first(first);
+        auto const old_paragraph_last = get_paragraph_last(last);
+        auto const paragraph_last = old_paragraph_last - (last - first) + text.size();
+
+        // Keep the lines outside of the edited paragraphs, the iterators are converted to indices
+        // since they are invalidated when the text is modified. When a partial layout is
+        // already pending the whole text will be laid out again.
+        auto retained_lines = line_vector{};
+        auto retained_indices = std::vector<line_indices>{};
+        auto num_lines_before = 0_uz;
+        auto const partial_layout = not _lines.empty() and not _relayout;
+        if (partial_layout) {
+            for (auto& line : _lines) {
+                auto const line_first = get_index(line.first);
+                auto const line_last = get_index(line.last);
+
+                // Only the line at the end of the text may be empty.
+                auto const is_empty = line_first == line_last;
+                auto const is_before = line_last <= paragraph_first and not is_empty;
+                auto const is_after = line_first >= old_paragraph_last and (not is_empty or old_paragraph_last != old_size);
+                if (not is_before and not is_after) {
+                    continue;
+                }
+
+                // The characters after the edited paragraphs are moved.
+                auto const new_index = [&](size_t index) {
+                    return is_after ? index - old_paragraph_last + paragraph_last : index;
+                };
+
+                auto& indices = retained_indices.emplace_back(new_index(line_first), new_index(line_last));
+                indices.columns.reserve(line.columns.size());
+                for (auto const it : line.columns) {
+                    indices.columns.push_back(new_index(get_index(it)));
+                }
+
+                retained_lines.push_back(std::move(line));
+                num_lines_before += is_before ? 1 : 0;
+            }
+        }
+        _lines.clear();
+        _relayout = false;
+
+        auto const font = style.front().font_chain()[0];
+        auto new_chars = char_vector{};
+        auto new_widths = std::vector<float>{};
+        new_chars.reserve(text.size());
+        new_widths.reserve(text.size());
+        for (auto const& c : text) {
+            new_widths.push_back(line_break_width(new_chars.emplace_back(make_char(c, style, _pixel_density, font))));
+        }
+
+        _text.erase(_text.begin() + first, _text.begin() + last);
+        _text.insert(_text.begin() + first, std::make_move_iterator(new_chars.begin()), std::make_move_iterator(new_chars.end()));
+        _line_break_widths.erase(_line_break_widths.begin() + first, _line_break_widths.begin() + last);
+        _line_break_widths.insert(_line_break_widths.begin() + first, new_widths.begin(), new_widths.end());
+
+        // Paragraph separators are mandatory breaks for lines, words and sentences. Therefor
+        // the break opportunities inside the edited paragraphs do not depend on the rest of the text.
+        auto const break_opportunities = get_break_opportunities(paragraph_first, paragraph_last);
+        replace_break_opportunities(_line_break_opportunities, paragraph_first, old_paragraph_last, break_opportunities.line);
+        replace_break_opportunities(_word_break_opportunities, paragraph_first, old_paragraph_last, break_opportunities.word);
+        replace_break_opportunities(
+            _sentence_break_opportunities, paragraph_first, old_paragraph_last, break_opportunities.sentence);
+        _line_break_cache = unicode_line_break_cache{_line_break_opportunities, _line_break_widths};
+
+        // The text-direction is determined by the first paragraph.
+        if (paragraph_first == 0) {
+            _text_direction = unicode_bidi_direction(
+                _text.begin(),
+                _text.end(),
+                [](text_shaper::char_const_reference it) {
+                    return it.grapheme.starter();
+                },
+                _bidi_context);
+        }
+
+        if (get_first_script() != old_first_script) {
+            // The script of every character may have changed, shape the whole text again.
+            resolve_script();
+            return;
+        }
+
+        // The scripts of characters around the edited paragraphs may change too. In that case
+        // lay out the following paragraphs up to the last modified character as well.
+        auto const [script_first, script_last] = resolve_script(paragraph_first, paragraph_last);
+        auto const relayout_last = script_last > paragraph_last ? get_paragraph_last(script_last - 1) : paragraph_last;
+
+        if (not partial_layout or script_first < paragraph_first) {
+            return;
+        }
+
+        auto line_it = retained_lines.begin();
+        auto indices_it = retained_indices.begin();
+        for (; line_it != retained_lines.end(); ++line_it, ++indices_it) {
+            if (std::distance(retained_lines.begin(), line_it) >= static_cast<ptrdiff_t>(num_lines_before)) {
+                auto const is_empty = indices_it->first == indices_it->last;
+                if (indices_it->first < relayout_last or (is_empty and relayout_last == size())) {
+                    // This line is in the extended range of paragraphs that will be laid out.
+                    continue;
+                }
+            }
+
+            line_it->first = _text.begin() + indices_it->first;
+            line_it->last = _text.begin() + indices_it->last;
+            for (auto i = 0_uz; i != line_it->columns.size(); ++i) {
+                line_it->columns[i] = _text.begin() + indices_it->columns[i];
+            }
+            _lines.push_back(std::move(*line_it));
+        }
+
+        _relayout = true;
+        _relayout_first = paragraph_first;
+        _relayout_last = relayout_last;
+        _relayout_line = num_lines_before;
+    }
+
     [[nodiscard]] bool empty() const noexcept
     {
         return _text.empty();
@@ -187,6 +323,19 @@ public:
         return _lines;
     }
 
+    /** The generation of the shaped text.
+     *
+     * A new generation is made when the text is shaped, replaced or laid out
+     * again. A copy of a text_shaper has the same generation as the original.
+     *
+     * This allows the glyphs of unchanged text to be retained between frames,
+     * see `draw_text_cache`.
+     */
+    [[nodiscard]] size_t generation() const noexcept
+    {
+        return _generation;
+    }
+
     /** Get bounding rectangle.
      *
      * It will estimate the width and height based on the glyphs before glyph-morphing and kerning
@@ -235,16 +384,40 @@ public:
      * @param sub_pixel_size The size of a sub-pixel in device-independent-pixels.
      * @param line_spacing The scaling of the spacing between lines (default: 1.0).
      * @param paragraph_spacing The scaling of the spacing between paragraphs (default: 1.5).
+     * @param resource The memory resource for temporaries, for example the frame arena from the widget_layout;
+     *                 nullptr for the default memory resource.
      */
     void layout(
         aarectangle rectangle,
         float baseline,
-        extent2 sub_pixel_size) noexcept
+        extent2 sub_pixel_size,
+        std::pmr::memory_resource *resource = nullptr) noexcept
     {
+        if (not _relayout and not _lines.empty() and rectangle == _rectangle and baseline == _baseline and
+            sub_pixel_size == _sub_pixel_size) {
+            // The text was not modified and is laid out in the same place.
+            return;
+        }
+
+        if (resource == nullptr) {
+            resource = std::pmr::get_default_resource();
+        }
+
+        _generation = make_generation();
+        auto const same_width = rectangle.left() == _rectangle.left() and rectangle.right() == _rectangle.right() and
+            sub_pixel_size == _sub_pixel_size;
+
         _rectangle = rectangle;
+        _baseline = baseline;
+        _sub_pixel_size = sub_pixel_size;
+        if (std::exchange(_relayout, false) and same_width) {
+            // Only the paragraphs modified by `replace()` need to be laid out.
+            return layout_paragraphs(rectangle, baseline, sub_pixel_size, resource);
+        }
+
         _lines = make_lines(rectangle, baseline, sub_pixel_size);
         hi_assert(not _lines.empty());
-        position_glyphs(rectangle, sub_pixel_size);
+        position_glyphs(rectangle, sub_pixel_size, resource);
     }
 
     /** The rectangle used when laying out the text.
@@ -847,6 +1020,12 @@ private:
      */
     std::vector<float> _line_break_widths;
 
+    /** The break candidates and accumulated widths of _line_break_opportunities and _line_break_widths.
+     *
+     * Used to fit the lines to a new width without scanning each character.
+     */
+    unicode_line_break_cache _line_break_cache;
+
     /** A list of word break opportunities.
      */
     unicode_break_vector _word_break_opportunities;
@@ -881,6 +1060,193 @@ private:
      */
     aarectangle _rectangle;
 
+    /** The baseline used for laying out.
+     */
+    float _baseline = 0.0f;
+
+    /** The size of a sub-pixel used for laying out.
+     */
+    extent2 _sub_pixel_size;
+
+    /** Set by `replace()` when only the lines of the modified paragraphs need to be laid out.
+     */
+    bool _relayout = false;
+
+    /** The index of the first character of the modified paragraphs.
+     */
+    size_t _relayout_first = 0;
+
+    /** The index one beyond the last character of the modified paragraphs.
+     */
+    size_t _relayout_last = 0;
+
+    /** The index in `_lines` where the lines of the modified paragraphs are inserted.
+     */
+    size_t _relayout_line = 0;
+
+    /** The generation of the shaped text, see `generation()`.
+     */
+    size_t _generation = 0;
+
+    inline static std::atomic<size_t> _generation_counter = 0;
+
+    /** The position of the characters of a line as indices.
+     *
+     * Used to retain lines while the text is modified.
+     */
+    struct line_indices {
+        size_t first;
+        size_t last;
+        std::vector<size_t> columns = {};
+    };
+
+    [[nodiscard]] static size_t make_generation() noexcept
+    {
+        return _generation_counter.fetch_add(1, std::memory_order::relaxed) + 1;
+    }
+
+    [[nodiscard]] static text_shaper_char
+    make_char(grapheme const& c, text_style_set const& style, unit::pixel_density pixel_density, font_id font) noexcept
+    {
+        auto const clean_c = c == '\n' ? grapheme{unicode_PS} : c;
+
+        auto r = text_shaper_char{clean_c, style, pixel_density};
+        r.initialize_glyph(font);
+        return r;
+    }
+
+    [[nodiscard]] static float line_break_width(text_shaper_char const& c) noexcept
+    {
+        return is_visible(c.general_category) ? c.width : -c.width;
+    }
+
+    /** Get the index of the first character of the paragraph that contains a character.
+     */
+    [[nodiscard]] size_t get_paragraph_first(size_t index) const noexcept
+    {
+        hi_axiom(index <= size());
+
+        while (index != 0 and _text[index - 1].general_category != unicode_general_category::Zp) {
+            --index;
+        }
+        return index;
+    }
+
+    /** Get the index one beyond the paragraph separator of the paragraph that contains a character.
+     */
+    [[nodiscard]] size_t get_paragraph_last(size_t index) const noexcept
+    {
+        hi_axiom(index <= size());
+
+        while (index != size()) {
+            if (_text[index++].general_category == unicode_general_category::Zp) {
+                break;
+            }
+        }
+        return index;
+    }
+
+    /** Texts with fewer characters than this are analysed on the current thread.
+     */
+    constexpr static size_t parallel_break_min_chars = 65536;
+
+    struct break_opportunities_type {
+        unicode_break_vector line;
+        unicode_break_vector word;
+        unicode_break_vector sentence;
+    };
+
+    /** Get the line, word and sentence break opportunities of a range of paragraphs.
+     *
+     * Large texts are split after paragraph separators into chunks, which are analysed
+     * in parallel on `thread_pool::global()`. Paragraph separators are mandatory breaks
+     * for lines, words and sentences, so the opportunities of the chunks can be joined.
+     *
+     * @param first The index of the first character of the paragraphs.
+     * @param last The index one beyond the paragraphs.
+     * @return The break opportunities, each with `last - first + 1` entries.
+     */
+    [[nodiscard]] break_opportunities_type get_break_opportunities(size_t first, size_t last) const noexcept
+    {
+        hi_axiom(first <= last);
+        hi_axiom(last <= size());
+
+        auto& pool = thread_pool::global();
+
+        auto chunks = std::vector<size_t>{first};
+        if (last - first >= parallel_break_min_chars and not pool.on_thread()) {
+            auto const num_chunks = pool.num_threads() + 1;
+            auto const chunk_size = std::max(ceil(last - first, num_chunks) / num_chunks, parallel_break_min_chars / 4);
+            while (last - chunks.back() > chunk_size) {
+                auto const chunk_last = get_paragraph_last(chunks.back() + chunk_size);
+                if (chunk_last >= last) {
+                    break;
+                }
+                chunks.push_back(chunk_last);
+            }
+        }
+        chunks.push_back(last);
+
+        auto r = std::vector<break_opportunities_type>(chunks.size() - 1);
+        auto const analyse = [&](size_t i) {
+            auto const get_code_point = [](auto const& c) -> decltype(auto) {
+                return c.grapheme.starter();
+            };
+
+            auto const chunk_first = _text.begin() + chunks[i];
+            auto const chunk_last = _text.begin() + chunks[i + 1];
+            r[i].line = unicode_line_break(chunk_first, chunk_last, get_code_point);
+            r[i].word = unicode_word_break(chunk_first, chunk_last, get_code_point);
+            r[i].sentence = unicode_sentence_break(chunk_first, chunk_last, get_code_point);
+        };
+
+        if (r.size() == 1) {
+            analyse(0);
+            return std::move(r.front());
+        }
+
+        pool.parallel_for(r.size(), analyse);
+
+        // The opportunity before each chunk is the one after the paragraph separator at the end of the previous chunk.
+        auto const join = [&](auto member) {
+            auto joined = std::move(r.front().*member);
+            joined.reserve(last - first + 1);
+            for (auto i = 1_uz; i != r.size(); ++i) {
+                auto const& part = r[i].*member;
+                joined.insert(joined.end(), part.begin() + 1, part.end());
+            }
+            return joined;
+        };
+
+        return {
+            join(&break_opportunities_type::line),
+            join(&break_opportunities_type::word),
+            join(&break_opportunities_type::sentence)};
+    }
+
+    /** Replace the break opportunities of a range of paragraphs.
+     *
+     * The break opportunity before the first paragraph is retained, it belongs to the
+     * paragraph separator of the previous paragraph or to the start of the text.
+     *
+     * @param[in,out] opportunities The break opportunities of the whole text.
+     * @param first The index of the first character of the paragraphs.
+     * @param old_last The index one beyond the paragraphs, before they were modified.
+     * @param paragraph_opportunities The break opportunities of the modified paragraphs.
+     */
+    static void replace_break_opportunities(
+        unicode_break_vector& opportunities,
+        size_t first,
+        size_t old_last,
+        unicode_break_vector const& paragraph_opportunities) noexcept
+    {
+        hi_axiom(not paragraph_opportunities.empty());
+
+        opportunities.erase(opportunities.begin() + first + 1, opportunities.begin() + old_last + 1);
+        opportunities.insert(
+            opportunities.begin() + first + 1, paragraph_opportunities.begin() + 1, paragraph_opportunities.end());
+    }
+
     static void
     layout_lines_vertical_spacing(text_shaper::line_vector& lines) noexcept
     {
@@ -954,14 +1320,18 @@ private:
      * @param[in,out] lines The lines to be modified
      * @param[in,out] text The input text. non-const because modifications on the text is required.
      * @param writing_direction The initial writing direction.
+     * @param resource The memory resource for temporaries.
      */
-    static void
-    bidi_algorithm(text_shaper::line_vector& lines, text_shaper::char_vector& text, unicode_bidi_context bidi_context) noexcept
+    static void bidi_algorithm(
+        text_shaper::line_vector& lines,
+        text_shaper::char_vector& text,
+        unicode_bidi_context bidi_context,
+        std::pmr::memory_resource *resource) noexcept
     {
         hi_assert(not lines.empty());
 
         // Create a list of all character indices.
-        auto char_its = std::vector<text_shaper::char_iterator>{};
+        auto char_its = std::pmr::vector<text_shaper::char_iterator>{resource};
         // Make room for implicit line-separators.
         char_its.reserve(text.size() + lines.size());
         for (auto const& line : lines) {
@@ -975,6 +1345,9 @@ private:
             }
         }
 
+        // Text may be shaped on multiple threads at the same time, while drawing in parallel.
+        thread_local auto bidi_scratch = unicode_bidi_scratch{};
+
         auto const[char_its_last, paragraph_directions] = unicode_bidi(
             char_its.begin(),
             char_its.end(),
@@ -994,7 +1367,8 @@ private:
                     it->direction = direction;
                 }
             },
-            bidi_context);
+            bidi_context,
+            bidi_scratch);
 
         // The unicode bidi algorithm may have deleted a few characters.
         char_its.erase(char_its_last, char_its.cend());
@@ -1042,7 +1416,7 @@ private:
     }
 
     [[nodiscard]] static generator<std::pair<std::vector<size_t>, float>>
-    get_widths(unicode_break_vector const& opportunities, std::vector<float> const& widths, unit::pixel_density pixel_density) noexcept
+    get_widths(unicode_line_break_cache const& cache, unit::pixel_density pixel_density) noexcept
     {
         struct entry_type {
             size_t min_height;
@@ -1057,27 +1431,35 @@ private:
         auto const a4_two_column = (au::milli(au::meters)(88.0f) * pixel_density.ppi).in(unit::pixels);
 
         // Max-width first.
-        auto [max_width, max_lines] = detail::unicode_LB_maximum_width(opportunities, widths);
+        auto const fit_lines = [&](float maximum_line_width) {
+            auto lines = cache.fit_lines(0, cache.size(), maximum_line_width);
+            auto const width = cache.width(0, lines);
+            return std::pair{width, std::move(lines)};
+        };
+
+        auto max_lines = cache.mandatory_lines(0, cache.size());
+        auto const max_width = cache.width(0, max_lines);
         auto height = max_lines.size();
         co_yield {std::move(max_lines), max_width};
 
         if (max_width >= a4_two_column) {
             // If this is wide text, then only try a few sizes.
             if (max_width > a4_one_column) {
-                auto [width, lines] = detail::unicode_LB_width(opportunities, widths, a4_one_column);
+                auto [width, lines] = fit_lines(a4_one_column);
                 if (std::exchange(height, lines.size()) > lines.size()) {
                     co_yield {std::move(lines), width};
                 }
             }
 
-            auto [width, lines] = detail::unicode_LB_width(opportunities, widths, a4_two_column);
+            auto [width, lines] = fit_lines(a4_two_column);
             if (std::exchange(height, lines.size()) > lines.size()) {
                 co_yield {std::move(lines), width};
             }
 
         } else {
             // With small text we try every size that changes the number of lines.
-            auto [min_width, min_lines] = detail::unicode_LB_minimum_width(opportunities, widths);
+            auto min_lines = cache.optional_lines(0, cache.size());
+            auto const min_width = cache.width(0, min_lines);
             if (min_lines.size() >= height) {
                 // There are no multiple sizes.
                 co_return;
@@ -1094,7 +1476,7 @@ private:
                     // There lines between the current two sizes; split in two.
                     auto const half_width = (entry.min_width + entry.max_width) * 0.5f;
 
-                    auto [split_width, split_lines] = detail::unicode_LB_width(opportunities, widths, half_width);
+                    auto [split_width, split_lines] = fit_lines(half_width);
                     auto const split_height = split_lines.size();
 
                     if (split_height == entry.min_height) {
@@ -1118,41 +1500,49 @@ private:
         }
     }
 
-    /** Create lines from the characters in the text shaper.
+    /** Create lines from a range of characters in the text shaper.
      *
-     * @param rectangle The rectangle to position the glyphs in.
-     * @param baseline The position of the recommended base-line.
-     * @param sub_pixel_size The size of a sub-pixel in device-independent-pixels.
-     * @param line_spacing The scaling of the spacing between lines.
-     * @param paragraph_spacing The scaling of the spacing between paragraphs.
+     * @param first The index of the first character of the first line.
+     * @param line_sizes The number of characters on each line.
+     * @param line_nr The line number of the first line.
+     * @return The lines, without vertical layout.
      */
-    [[nodiscard]] line_vector make_lines(
-        aarectangle rectangle,
-        float baseline,
-        extent2 sub_pixel_size) noexcept
+    [[nodiscard]] line_vector make_lines(size_t first, std::vector<size_t> const& line_sizes, size_t line_nr) noexcept
     {
-        auto const line_sizes = unicode_line_break(_line_break_opportunities, _line_break_widths, rectangle.width());
-
         auto r = text_shaper::line_vector{};
-        r.reserve(line_sizes.size());
+        r.reserve(line_sizes.size() + 1);
 
-        auto char_it = _text.begin();
-        auto width_it = _line_break_widths.begin();
-        auto line_nr = 0_uz;
+        auto char_it = _text.begin() + first;
         for (auto const line_size : line_sizes) {
             hi_axiom(line_size > 0);
             auto const char_eol = char_it + line_size;
-            auto const width_eol = width_it + line_size;
 
-            auto const line_width = detail::unicode_LB_width(width_it, width_eol);
+            auto const line_width = _line_break_cache.width(first, first + line_size);
             r.emplace_back(line_nr++, _text.begin(), char_it, char_eol, line_width, _initial_line_metrics);
 
             char_it = char_eol;
-            width_it = width_eol;
+            first += line_size;
         }
+        return r;
+    }
+
+    /** Create lines from the characters in the text shaper.
+     *
+     * @param rectangle The rectangle to position the glyphs in.
+     * @param baseline The position of the recommended base-line.
+     * @param sub_pixel_size The size of a sub-pixel in device-independent-pixels.
+     * @param line_spacing The scaling of the spacing between lines.
+     * @param paragraph_spacing The scaling of the spacing between paragraphs.
+     */
+    [[nodiscard]] line_vector make_lines(
+        aarectangle rectangle,
+        float baseline,
+        extent2 sub_pixel_size) noexcept
+    {
+        auto r = make_lines(0, unicode_line_break(_line_break_cache, 0, size(), rectangle.width()), 0);
 
         if (r.empty() or is_Zp_or_Zl(r.back().last_category)) {
-            r.emplace_back(line_nr++, _text.begin(), _text.end(), _text.end(), 0.0f, _initial_line_metrics);
+            r.emplace_back(r.size(), _text.begin(), _text.end(), _text.end(), 0.0f, _initial_line_metrics);
             r.back().paragraph_direction = _text_direction;
         }
 
@@ -1163,37 +1553,162 @@ private:
         return r;
     }
 
+    /** Lay out the lines of the paragraphs modified by `replace()`.
+     *
+     * The other lines are moved vertically, when the number of lines above them changed.
+     *
+     * @param rectangle The rectangle to position the glyphs in, with the same width as before.
+     * @param baseline The position of the recommended base-line.
+     * @param sub_pixel_size The size of a sub-pixel in device-independent-pixels.
+     * @param resource The memory resource for temporaries.
+     */
+    void
+    layout_paragraphs(aarectangle rectangle, float baseline, extent2 sub_pixel_size, std::pmr::memory_resource *resource) noexcept
+    {
+        hi_axiom(_relayout_first <= _relayout_last);
+        hi_axiom(_relayout_last <= size());
+        hi_axiom(_relayout_line <= _lines.size());
+
+        auto const line_sizes = unicode_line_break(_line_break_cache, _relayout_first, _relayout_last, rectangle.width());
+        auto lines = make_lines(_relayout_first, line_sizes, _relayout_line);
+
+        if (_relayout_last == size()) {
+            // Add an empty line at the end of the text, same as `make_lines()`.
+            auto const* last_line = not lines.empty() ? &lines.back() :
+                _relayout_line != 0                     ? &_lines[_relayout_line - 1] :
+                                                          nullptr;
+            if (last_line == nullptr or is_Zp_or_Zl(last_line->last_category)) {
+                auto const line_nr = _relayout_line + lines.size();
+                lines.emplace_back(line_nr, _text.begin(), _text.end(), _text.end(), 0.0f, _initial_line_metrics);
+                lines.back().paragraph_direction = _text_direction;
+            }
+        }
+
+        // The bidi-algorithm works on each paragraph independently.
+        if (not lines.empty()) {
+            bidi_algorithm(lines, _text, _bidi_context, resource);
+        }
+
+        auto const first_line_nr = _relayout_line;
+        auto const last_line_nr = _relayout_line + lines.size();
+        _lines.insert(
+            _lines.begin() + _relayout_line, std::make_move_iterator(lines.begin()), std::make_move_iterator(lines.end()));
+        hi_assert(not _lines.empty());
+
+        // Renumber the lines after the modified paragraphs.
+        for (auto line_nr = last_line_nr; line_nr != _lines.size(); ++line_nr) {
+            auto& line = _lines[line_nr];
+            if (line.line_nr != line_nr) {
+                line.line_nr = line_nr;
+                for (auto const& char_it : line.columns) {
+                    char_it->line_nr = line_nr;
+                }
+            }
+        }
+
+        auto old_y = std::pmr::vector<float>{resource};
+        old_y.reserve(_lines.size());
+        for (auto const& line : _lines) {
+            old_y.push_back(line.y);
+        }
+
+        layout_lines_vertical_spacing(_lines);
+        layout_lines_vertical_alignment(
+            _lines, _alignment.vertical(), baseline, rectangle.bottom(), rectangle.top(), sub_pixel_size.height());
+
+        for (auto line_nr = 0_uz; line_nr != _lines.size(); ++line_nr) {
+            auto& line = _lines[line_nr];
+            if (line_nr >= first_line_nr and line_nr < last_line_nr) {
+                line.layout(_alignment.horizontal(), rectangle.left(), rectangle.right(), sub_pixel_size.width());
+            } else {
+                line.reposition(old_y[line_nr]);
+            }
+        }
+    }
+
     /** Position the glyphs.
      *
      * @param rectangle The rectangle to position the glyphs in.
      * @param sub_pixel_size The size of a sub-pixel in device-independent-pixels.
+     * @param resource The memory resource for temporaries.
      * @post Glyphs in _text are positioned inside the given rectangle.
      */
-    void position_glyphs(aarectangle rectangle, extent2 sub_pixel_size) noexcept
+    void position_glyphs(aarectangle rectangle, extent2 sub_pixel_size, std::pmr::memory_resource *resource) noexcept
     {
         hi_assert(not _lines.empty());
 
         // The bidi algorithm will reorder the characters on each line, and mirror the brackets in the text when needed.
-        bidi_algorithm(_lines, _text, _bidi_context);
+        bidi_algorithm(_lines, _text, _bidi_context, resource);
         for (auto& line : _lines) {
             // Position the glyphs on each line. Possibly morph glyphs to handle ligatures and calculate the bounding rectangles.
             line.layout(_alignment.horizontal(), rectangle.left(), rectangle.right(), sub_pixel_size.width());
         }
     }
 
-    /** Resolve the script of each character in text.
+    /** Find the first script in the text if no script is found use the text_shaper's default script.
      */
-    void resolve_script() noexcept
+    [[nodiscard]] iso_15924 get_first_script() const noexcept
     {
-        // Find the first script in the text if no script is found use the text_shaper's default script.
-        auto first_script = _script;
         for (auto& c : _text) {
-            auto const script = ucd_get_script(c.grapheme.starter());
+            auto const script = ucd_get_text_properties(c.grapheme.starter()).script();
             if (script != iso_15924::wildcard() or script == iso_15924::uncoded() or script == iso_15924::common() or
                 script == iso_15924::inherited()) {
-                first_script = script;
-                break;
+                return script;
+            }
+        }
+        return _script;
+    }
+
+    /** Resolve the script of each character in text.
+     */
+    void resolve_script() noexcept
+    {
+        resolve_script(0, _text.size());
+    }
+
+    /** Resolve the script of each character in a range of the text.
+     *
+     * Characters without a script of their own take the script of their neighbours. Therefor
+     * the range is extended on both sides up to the nearest characters with a script of their own.
+     *
+     * @param first The index of the first character.
+     * @param last The index one beyond the last character.
+     * @return The range of characters whose script was modified, including the range [first, last).
+     */
+    std::pair<size_t, size_t> resolve_script(size_t first, size_t last) noexcept
+    {
+        hi_axiom(first <= last);
+        hi_axiom(last <= _text.size());
+
+        auto const has_own_script = [&](size_t i) {
+            auto const script = ucd_get_text_properties(_text[i].grapheme.starter()).script();
+            return script != iso_15924::uncoded() and script != iso_15924::common() and script != iso_15924::inherited();
+        };
+
+        auto const first_script = get_first_script();
+
+        // Remember the scripts of the characters outside of the range, to check if they were modified.
+        auto const extended_first = [&] {
+            auto i = first;
+            while (i != 0 and not has_own_script(i - 1)) {
+                --i;
             }
+            return i;
+        }();
+        auto const extended_last = [&] {
+            auto i = last;
+            while (i != _text.size() and not has_own_script(i)) {
+                ++i;
+            }
+            return i;
+        }();
+        auto old_scripts = std::vector<iso_15924>{};
+        old_scripts.reserve((first - extended_first) + (extended_last - last));
+        for (auto i = extended_first; i != first; ++i) {
+            old_scripts.push_back(_text[i].script);
+        }
+        for (auto i = last; i != extended_last; ++i) {
+            old_scripts.push_back(_text[i].script);
         }
 
         // Backward pass: fix start of words and open-brackets.
@@ -1201,16 +1716,20 @@ private:
         // Close brackets will not be fixed, those will be fixed in the last forward pass.
         auto word_script = iso_15924::common();
         auto previous_script = first_script;
-        for (auto i = std::ssize(_text) - 1; i >= 0; --i) {
+        if (extended_last != _text.size()) {
+            previous_script = word_script = ucd_get_text_properties(_text[extended_last].grapheme.starter()).script();
+        }
+        for (auto i = static_cast<ptrdiff_t>(extended_last) - 1; i >= static_cast<ptrdiff_t>(extended_first); --i) {
             auto& c = _text[i];
 
             if (_word_break_opportunities[i + 1] != unicode_break_opportunity::no) {
                 word_script = iso_15924::common();
             }
 
-            c.script = ucd_get_script(c.grapheme.starter());
+            auto const properties = ucd_get_text_properties(c.grapheme.starter());
+            c.script = properties.script();
             if (c.script == iso_15924::uncoded() or c.script == iso_15924::common()) {
-                auto const bracket_type = ucd_get_bidi_paired_bracket_type(c.grapheme.starter());
+                auto const bracket_type = properties.bidi_paired_bracket_type();
                 // clang-format off
                 c.script =
                     bracket_type == unicode_bidi_paired_bracket_type::o ? previous_script :
@@ -1224,8 +1743,8 @@ private:
         }
 
         // Forward pass: fix all common and inherited with previous or first script.
-        previous_script = first_script;
-        for (auto i = 0_uz; i != _text.size(); ++i) {
+        previous_script = extended_first != 0 ? _text[extended_first - 1].script : first_script;
+        for (auto i = extended_first; i != extended_last; ++i) {
             auto& c = _text[i];
 
             if (c.script == iso_15924::common() or c.script == iso_15924::inherited()) {
@@ -1235,6 +1754,20 @@ private:
                 previous_script = c.script;
             }
         }
+
+        auto r = std::pair{first, last};
+        auto old_script_it = old_scripts.cbegin();
+        for (auto i = extended_first; i != first; ++i) {
+            if (_text[i].script != *old_script_it++) {
+                inplace_min(r.first, i);
+            }
+        }
+        for (auto i = last; i != extended_last; ++i) {
+            if (_text[i].script != *old_script_it++) {
+                r.second = i + 1;
+            }
+        }
+        return r;
     }
 
     [[nodiscard]] std::pair<text_cursor, text_cursor>
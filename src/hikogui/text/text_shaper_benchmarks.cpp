@@ -0,0 +1,91 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "text_shaper.hpp"
+#include "../font/font.hpp"
+#include "../path/path.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <optional>
+#include <array>
+#include <string>
+
+using hi::operator""_uz;
+
+/** The text style using the first sans-serif font found on the system.
+ */
+[[nodiscard]] static std::optional<hi::text_style_set> const& benchmark_style()
+{
+    static auto const r = [] -> std::optional<hi::text_style_set> {
+        hi::register_font_directories(hi::font_dirs());
+
+        for (auto const family_name : {"Noto Sans", "Arial", "DejaVu Sans", "Liberation Sans"}) {
+            if (auto const font = hi::find_font(family_name)) {
+                auto style = hi::text_style{};
+                style.set_font_chain({font});
+                style.set_size(hi::unit::points_per_em(12));
+                style.set_color(hi::color::white());
+                style.set_line_spacing(1.0f);
+                style.set_paragraph_spacing(1.5f);
+
+                auto style_set = hi::text_style_set{};
+                style_set.push_back({}, style);
+                return style_set;
+            }
+        }
+        return std::nullopt;
+    }();
+    return r;
+}
+
+/** A few paragraphs of mostly latin text, with some punctuation and digits.
+ */
+[[nodiscard]] static hi::gstring benchmark_text()
+{
+    auto r = std::string{};
+    for (auto i = 0; i != 8; ++i) {
+        r += "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et "
+             "dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip "
+             "ex ea commodo consequat (1234.56). ";
+    }
+    return hi::to_gstring(r);
+}
+
+constexpr auto benchmark_pixel_density = hi::unit::pixel_density{hi::unit::pixels_per_inch(96.0f), hi::device_type::desktop};
+
+hi_benchmark(text_shaper_construct)
+{
+    auto const& style = benchmark_style();
+    if (not style) {
+        return state.skip("No sans-serif font found.");
+    }
+
+    auto const text = benchmark_text();
+    state.set_items_per_iteration(text.size());
+    while (state.running()) {
+        auto shaper = hi::text_shaper{text, *style, benchmark_pixel_density, hi::alignment::top_flush(), true};
+        hi::do_not_optimize(shaper);
+    }
+}
+
+hi_benchmark(text_shaper_layout)
+{
+    auto const& style = benchmark_style();
+    if (not style) {
+        return state.skip("No sans-serif font found.");
+    }
+
+    auto const text = benchmark_text();
+    auto shaper = hi::text_shaper{text, *style, benchmark_pixel_density, hi::alignment::top_flush(), true};
+
+    // Alternate between two widths, so that each layout folds the lines again.
+    auto const rectangles = std::array{hi::aarectangle{0.0f, 0.0f, 400.0f, 1000.0f}, hi::aarectangle{0.0f, 0.0f, 401.0f, 1000.0f}};
+    auto const sub_pixel_size = hi::extent2{1.0f / 3.0f, 1.0f};
+
+    state.set_items_per_iteration(text.size());
+    auto i = 0_uz;
+    while (state.running()) {
+        shaper.layout(rectangles[i++ % rectangles.size()], 0.0f, sub_pixel_size);
+        hi::do_not_optimize(shaper);
+    }
+}
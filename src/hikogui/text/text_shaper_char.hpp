@@ -127,13 +127,17 @@ public:
      */
     bool glyph_is_initial = false;
 
+    /** The glyph was substituted by glyph-morphing.
+     */
+    bool glyph_is_morphed = false;
+
     [[nodiscard]] text_shaper_char(hi::grapheme const& grapheme, text_style_set const& style, unit::pixel_density pixel_density) noexcept :
         grapheme(grapheme),
         style(style[grapheme.attributes()]),
         pixel_density(pixel_density),
         line_nr(std::numeric_limits<size_t>::max()),
         column_nr(std::numeric_limits<size_t>::max()),
-        general_category(ucd_get_general_category(grapheme.starter()))
+        general_category(ucd_get_text_properties(grapheme.starter()).general_category())
     {
     }
 
@@ -176,6 +180,36 @@ public:
         glyph_is_initial = false;
     }
 
+    /** Called by glyph-morphing to replace the glyphs with the glyphs substituted by the font.
+     *
+     * @param new_glyphs The substituted glyphs from the same font, or empty if this character is
+     *                   part of a ligature which is drawn by the first character of the ligature.
+     * @post `glyph` and `metrics` are modified. `glyph_is_initial` is set to false.
+     * @note The `width` remains based on the original glyph.
+     */
+    void morph_glyphs(hi::font_glyph_ids::container_type new_glyphs) noexcept
+    {
+        if (new_glyphs.empty()) {
+            glyphs.glyphs.clear();
+            metrics.bounding_rectangle = {};
+        } else {
+            set_glyph(hi::font_glyph_ids{glyphs.font, std::move(new_glyphs)});
+        }
+        glyph_is_initial = false;
+        glyph_is_morphed = true;
+    }
+
+    /** Called by glyph-morphing to restore the glyphs when they are no longer substituted.
+     *
+     * @post `glyph` and `metrics` are modified. `glyph_is_initial` is set to true.
+     */
+    void unmorph_glyphs() noexcept
+    {
+        set_glyph(find_glyph(glyphs.font, grapheme));
+        glyph_is_initial = true;
+        glyph_is_morphed = false;
+    }
+
     /** Get the scaled font metrics for this character.
      */
     [[nodiscard]] font_metrics_px font_metrics() const noexcept
@@ -102,17 +102,33 @@ public:
         font_metrics_px const& metrics) noexcept :
         first(first), last(last), columns(), metrics(metrics), line_nr(line_nr), y(0.0f), width(width), last_category()
     {
-        auto last_visible_it = first;
         for (auto it = first; it != last; ++it) {
-            // Reset the trailing white space marker.
-            it->is_trailing_white_space = false;
-
             // Only calculate line metrics based on visible characters.
             // For example a paragraph separator is seldom available in a font.
             if (is_visible(it->general_category)) {
                 this->metrics = max(metrics, it->font_metrics());
                 this->line_spacing = std::max(this->line_spacing, it->style.line_spacing());
                 this->paragraph_spacing = std::max(this->paragraph_spacing, it->style.paragraph_spacing());
+            }
+        }
+
+        mark_trailing_white_space();
+        last_category = first != last ? (last - 1)->general_category : unicode_general_category::Cn;
+    }
+
+    /** Mark the white space at the end of the line.
+     *
+     * The markers are shared by all lines made from the same text, and need
+     * to be restored after other lines were made over the same characters.
+     */
+    void mark_trailing_white_space() noexcept
+    {
+        auto last_visible_it = first;
+        for (auto it = first; it != last; ++it) {
+            // Reset the trailing white space marker.
+            it->is_trailing_white_space = false;
+
+            if (is_visible(it->general_category)) {
                 last_visible_it = it;
             }
         }
@@ -122,10 +138,6 @@ public:
             for (auto it = last_visible_it + 1; it != last; ++it) {
                 it->is_trailing_white_space = true;
             }
-
-            last_category = (last - 1)->general_category;
-        } else {
-            last_category = unicode_general_category::Cn;
         }
     }
 
@@ -178,6 +190,30 @@ public:
         }
     }
 
+    /** Move the glyphs of a line that was laid out before to the new base-line.
+     *
+     * This is used instead of `layout()` when the characters on the line did not
+     * change, but lines above it were added or removed.
+     *
+     * @pre `y` is set to the new position of the base-line.
+     * @param old_y The position of the base-line when the line was laid out.
+     */
+    void reposition(float old_y) noexcept
+    {
+        mark_trailing_white_space();
+
+        if (y == old_y) {
+            return;
+        }
+
+        auto const offset = translate2{0.0f, y - old_y};
+        for (auto const& char_it : columns) {
+            char_it->position = offset * char_it->position;
+            char_it->rectangle = offset * char_it->rectangle;
+        }
+        rectangle = offset * rectangle;
+    }
+
     /** Get the character nearest to position.
      *
      * @return An iterator to the character, and true if the position is after the character.
@@ -245,9 +281,19 @@ private:
         hi_axiom(result.glyph_count.size() == run.size());
 
         auto grapheme_index = 0_uz;
+        auto glyph_index = 0_uz;
         for (auto it = first; it != last; ++it, ++grapheme_index) {
             (*it)->position = p;
 
+            auto const glyph_count = result.glyph_count[grapheme_index];
+            if (not result.morphed.empty() and result.morphed[grapheme_index]) {
+                auto const glyphs_first = result.glyphs.begin() + glyph_index;
+                (*it)->morph_glyphs(font_glyph_ids::container_type(glyphs_first, glyphs_first + glyph_count));
+            } else if ((*it)->glyph_is_morphed) {
+                (*it)->unmorph_glyphs();
+            }
+            glyph_index += glyph_count;
+
             p += vector2{result.advances[grapheme_index], 0.0f};
         }
     }
@@ -21,7 +21,7 @@ inline namespace v1 {
 
 class style {
 public:
-    using attributes_from_theme_type = std::function<style_attributes(style_path, style_pseudo_class)>;
+    using attributes_from_theme_type = std::function<style_attributes(style_path const&, style_pseudo_class)>;
     using notifier_type = notifier<void(style_modify_mask, bool)>;
     using callback_type = notifier_type::callback_type;
     using callback_proto = notifier_type::callback_proto;
@@ -77,7 +77,8 @@ public:
 
     void set_name(std::string name)
     {
-        _name = name;
+        _name = std::move(name);
+        update_path();
         reload(true);
     }
 
@@ -89,6 +90,7 @@ public:
     void set_id(std::string id)
     {
         _id = std::move(id);
+        update_path();
         reload(true);
     }
 
@@ -100,6 +102,7 @@ public:
     void set_classes(std::vector<std::string> classes)
     {
         _classes = std::move(classes);
+        update_path();
         reload(true);
     }
 
@@ -108,22 +111,29 @@ public:
         return _classes;
     }
 
-    void set_parent_path(style_path new_parent_path) noexcept
+    void set_parent_path(style_path const& new_parent_path) noexcept
     {
-        _parent_path = new_parent_path;
+        auto segment = std::move(_path.back());
+        _path.assign(new_parent_path.begin(), new_parent_path.end());
+        _path.push_back(std::move(segment));
         reload(true);
     }
 
-    [[nodiscard]] style_path const &parent_path() const noexcept
+    [[nodiscard]] style_path parent_path() const noexcept
     {
-        return _parent_path;
+        auto r = path();
+        r.pop_back();
+        return r;
     }
 
-    [[nodiscard]] style_path path() const noexcept
+    /** The path of this style, the last segment is for this style itself.
+     *
+     * The path is retained in the style and only rebuild when the parent path,
+     * the name, the id or the classes change.
+     */
+    [[nodiscard]] style_path const& path() const noexcept
     {
-        auto r = parent_path();
-        r.emplace_back(_name, _id, _classes);
-        return r;
+        return _path;
     }
 
     /** Parse the given string to configure this style.
@@ -149,6 +159,7 @@ public:
     {
         if (auto const optional_style = parse_style(style_string)) {
             std::tie(_override_attributes, _id, _classes) = *optional_style;
+            update_path();
             reload(true);
         } else if (optional_style.has_error()) {
             throw parse_error(optional_style.error());
@@ -212,7 +223,7 @@ public:
         }
 
         for (auto i = size_t{0}; i != style_pseudo_class_size; ++i) {
-            _loaded_attributes[i] = _attributes_from_theme(path(), static_cast<style_pseudo_class>(i));
+            _loaded_attributes[i] = _attributes_from_theme(_path, static_cast<style_pseudo_class>(i));
             _loaded_attributes[i].apply(_override_attributes);
         }
 
@@ -253,7 +264,9 @@ private:
     std::string _id;
     std::vector<std::string> _classes;
 
-    style_path _parent_path;
+    /** The parent's path with the interned name, id and classes of this style appended.
+     */
+    style_path _path = style_path{style_path_segment{}};
     unit::pixel_density _pixel_density;
     style_pseudo_class _pseudo_class;
 
@@ -279,6 +292,11 @@ private:
 
     notifier_type _notifier;
 
+    void update_path() noexcept
+    {
+        _path.back() = style_path_segment{_name, _id, _classes};
+    }
+
     void update_attributes(style_modify_mask mask)
     {
         if (to_bool(mask & style_modify_mask::color)) {
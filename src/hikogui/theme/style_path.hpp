@@ -4,20 +4,103 @@
 
 #pragma once
 
+#include "../utility/utility.hpp"
+#include "../concurrency/concurrency.hpp"
 #include "../macros.hpp"
 #include <string>
+#include <string_view>
 #include <vector>
+#include <deque>
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+#include <mutex>
 #include <cstdint>
+#include <cstddef>
 
 hi_export_module(hikogui.theme : style_path);
 
 hi_export namespace hi {
 inline namespace v1 {
 
+/** An interned name, id or class of a style.
+ *
+ * Strings that are equal are interned to the same atom, so that style-paths
+ * can be compared and hashed without comparing strings.
+ *
+ * The empty string is always interned as `style_atom::empty`.
+ */
+enum class style_atom : uint32_t { empty = 0 };
+
+namespace detail {
+
+class style_atom_table {
+public:
+    style_atom_table() : _strings{std::string{}}
+    {
+        _atoms.emplace(std::string{}, style_atom::empty);
+    }
+
+    [[nodiscard]] style_atom intern(std::string_view str) noexcept
+    {
+        if (str.empty()) {
+            return style_atom::empty;
+        }
+
+        auto const lock = std::scoped_lock(_mutex);
+        if (auto it = _atoms.find(std::string{str}); it != _atoms.end()) {
+            return it->second;
+        }
+
+        auto const r = static_cast<style_atom>(narrow_cast<uint32_t>(_strings.size()));
+        _strings.emplace_back(str);
+        _atoms.emplace(_strings.back(), r);
+        return r;
+    }
+
+    [[nodiscard]] std::string const& get(style_atom atom) const noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        hi_axiom(std::to_underlying(atom) < _strings.size());
+        return _strings[std::to_underlying(atom)];
+    }
+
+private:
+    mutable unfair_mutex _mutex = {};
+
+    /** The interned strings, indexed by atom.
+     *
+     * A deque is used so that references to the strings remain valid.
+     */
+    std::deque<std::string> _strings;
+    std::unordered_map<std::string, style_atom> _atoms;
+};
+
+inline style_atom_table style_atoms;
+
+} // namespace detail
+
+/** Intern a name, id or class of a style.
+ */
+[[nodiscard]] inline style_atom make_style_atom(std::string_view str) noexcept
+{
+    return detail::style_atoms.intern(str);
+}
+
+/** Get the string of an interned name, id or class.
+ */
+[[nodiscard]] inline std::string const& to_string(style_atom atom) noexcept
+{
+    return detail::style_atoms.get(atom);
+}
+
 struct style_path_segment {
-    std::string name;
-    std::string id;
-    std::vector<std::string> classes;
+    style_atom name = style_atom::empty;
+    style_atom id = style_atom::empty;
+
+    /** The classes of the segment, sorted on atom.
+     */
+    std::vector<style_atom> classes;
 
     constexpr style_path_segment() noexcept = default;
     constexpr style_path_segment(style_path_segment const&) noexcept = default;
@@ -26,8 +109,28 @@ struct style_path_segment {
     constexpr style_path_segment& operator=(style_path_segment&&) noexcept = default;
     [[nodiscard]] constexpr friend bool operator==(style_path_segment const&, style_path_segment const&) noexcept = default;
 
-    constexpr explicit style_path_segment(std::string name, std::string id, std::vector<std::string> classes) noexcept :
-        name(std::move(name)), id(std::move(id)), classes(std::move(classes)) {}
+    constexpr explicit style_path_segment(style_atom name, style_atom id, std::vector<style_atom> classes) noexcept :
+        name(name), id(id), classes(std::move(classes))
+    {
+        std::ranges::sort(this->classes);
+    }
+
+    explicit style_path_segment(std::string_view name, std::string_view id, std::vector<std::string> const& classes) noexcept :
+        name(make_style_atom(name)), id(make_style_atom(id))
+    {
+        this->classes.reserve(classes.size());
+        for (auto const& class_ : classes) {
+            this->classes.push_back(make_style_atom(class_));
+        }
+        std::ranges::sort(this->classes);
+    }
+
+    /** Check if the segment has the given class.
+     */
+    [[nodiscard]] constexpr bool has_class(style_atom class_) const noexcept
+    {
+        return std::ranges::binary_search(classes, class_);
+    }
 };
 
 class style_path : public std::vector<style_path_segment> {
@@ -36,3 +139,27 @@ class style_path : public std::vector<style_path_segment> {
 };
 
 }}
+
+hi_export template<>
+struct std::hash<hi::style_path_segment> {
+    [[nodiscard]] std::size_t operator()(hi::style_path_segment const& rhs) const noexcept
+    {
+        auto r = hi::hash_mix(std::to_underlying(rhs.name), std::to_underlying(rhs.id));
+        for (auto const class_ : rhs.classes) {
+            r = hi::hash_mix(std::to_underlying(class_), r);
+        }
+        return r;
+    }
+};
+
+hi_export template<>
+struct std::hash<hi::style_path> {
+    [[nodiscard]] std::size_t operator()(hi::style_path const& rhs) const noexcept
+    {
+        auto r = std::hash<std::size_t>{}(rhs.size());
+        for (auto const& segment : rhs) {
+            r = hi::hash_mix(std::hash<hi::style_path_segment>{}(segment), r);
+        }
+        return r;
+    }
+};
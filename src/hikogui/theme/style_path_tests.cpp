@@ -0,0 +1,45 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "style_path.hpp"
+#include <hikotest/hikotest.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+TEST_SUITE(style_path_suite) {
+    TEST_CASE(atom_test) {
+        auto const foo = hi::make_style_atom("foo");
+        auto const bar = hi::make_style_atom("bar");
+        REQUIRE(foo != bar);
+        REQUIRE(hi::make_style_atom(std::string{"foo"}) == foo);
+        REQUIRE(hi::make_style_atom("") == hi::style_atom::empty);
+        REQUIRE(hi::to_string(foo) == "foo");
+        REQUIRE(hi::to_string(hi::style_atom::empty) == "");
+    }
+
+    TEST_CASE(segment_test) {
+        auto const a = hi::style_path_segment{"label", "ok", std::vector<std::string>{"red", "bold"}};
+        auto const b = hi::style_path_segment{"label", "ok", std::vector<std::string>{"bold", "red"}};
+        REQUIRE(a == b);
+        REQUIRE(a.name == hi::make_style_atom("label"));
+        REQUIRE(a.id == hi::make_style_atom("ok"));
+        REQUIRE(a.has_class(hi::make_style_atom("bold")));
+        REQUIRE(a.has_class(hi::make_style_atom("red")));
+        REQUIRE(not a.has_class(hi::make_style_atom("green")));
+    }
+
+    TEST_CASE(hash_test) {
+        auto const window = hi::style_path_segment{"window", "", std::vector<std::string>{}};
+        auto const label = hi::style_path_segment{"label", "", std::vector<std::string>{"bold"}};
+
+        auto const a = hi::style_path{window, label};
+        auto const b = hi::style_path{window, label};
+        auto const c = hi::style_path{label, window};
+        REQUIRE(a == b);
+        REQUIRE(std::hash<hi::style_path>{}(a) == std::hash<hi::style_path>{}(b));
+        REQUIRE(a != c);
+        REQUIRE(std::hash<hi::style_path>{}(a) != std::hash<hi::style_path>{}(c));
+    }
+};
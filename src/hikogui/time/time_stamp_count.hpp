@@ -9,12 +9,14 @@
 #include "../concurrency/concurrency.hpp"
 #include "../numeric/numeric.hpp"
 #include "../macros.hpp"
+#include <hikocpu/hikocpu.hpp>
 #include <atomic>
 #include <array>
 #include <cstdint>
 #include <chrono>
 #include <utility>
 #include <thread>
+#include <algorithm>
 
 #if HI_OPERATING_SYSTEM == HI_OS_WINDOWS
 #include <intrin.h>
@@ -137,6 +139,25 @@ public:
         return 1ns * static_cast<int64_t>((hi << 32) | (lo >> 32));
     }
 
+    /** Convert a duration to a time-stamp count.
+     *
+     * This is used to add durations that where measured by a different clock,
+     * such as the GPU, to a counter.
+     *
+     * @param duration A duration between 0 and 1 second.
+     * @return The number of clock ticks during the duration.
+     */
+    [[nodiscard]] static uint64_t count_from_duration(std::chrono::nanoseconds duration) noexcept
+    {
+        auto const period = _period.load(std::memory_order::relaxed);
+        if (period == 0) {
+            return 0;
+        }
+
+        auto const ns = static_cast<uint64_t>(std::clamp(duration.count(), int64_t{0}, int64_t{1'000'000'000}));
+        return (ns << 32) / period;
+    }
+
     /** Convert to nanoseconds since epoch.
      * The epoch is the same as the TSC count's epoch. In most cases the epoch
      * is at system startup time.
@@ -254,10 +275,47 @@ public:
         return wide_div(delta_tsc_lo, delta_tsc_hi, duration);
     }
 
+    /** Get the frequency of the time-stamp-counter from the CPU.
+     *
+     * On Intel CPUs leaf 0x15 of the CPUID instruction returns the ratio between
+     * the TSC and the crystal clock, and on most models the frequency of the crystal
+     * clock. Otherwise leaf 0x16 returns the base frequency of the CPU, which is
+     * in practice the frequency of an invariant TSC.
+     *
+     * @return The frequency in Hz, or zero when the CPU does not report it.
+     */
+    [[nodiscard]] static uint64_t cpuid_frequency() noexcept
+    {
+#if HI_PROCESSOR == HI_CPU_X86_64
+        auto const max_leaf = hi::cpu_id(0).eax;
+
+        if (max_leaf >= 0x15) {
+            auto const leaf15 = hi::cpu_id(0x15);
+            if (leaf15.eax != 0 and leaf15.ebx != 0 and leaf15.ecx != 0) {
+                return uint64_t{leaf15.ecx} * leaf15.ebx / leaf15.eax;
+            }
+        }
+
+        if (max_leaf >= 0x16) {
+            auto const base_mhz = hi::cpu_id(0x16).eax & 0xffff;
+            if (base_mhz != 0) {
+                return uint64_t{base_mhz} * 1'000'000;
+            }
+        }
+#endif
+        return 0;
+    }
+
     static void set_frequency(uint64_t frequency) noexcept
     {
-        auto const period = (uint64_t{1'000'000'000} << 32) / frequency;
-        _period.store(period, std::memory_order_relaxed);
+        _period.store(period_from_frequency(frequency), std::memory_order_relaxed);
+    }
+
+    /** The period in nanoseconds/cycle as Q32.32, or zero when the frequency is unknown.
+     */
+    [[nodiscard]] static uint64_t period() noexcept
+    {
+        return _period.load(std::memory_order::relaxed);
     }
 
     /** Start the time_stamp_count subsystem.
@@ -289,9 +347,17 @@ private:
      */
     uint32_t _thread_id;
 
+    [[nodiscard]] static uint64_t period_from_frequency(uint64_t frequency) noexcept
+    {
+        return frequency == 0 ? 0 : (uint64_t{1'000'000'000} << 32) / frequency;
+    }
+
     /** The period in nanoseconds/cycle as Q32.32
+     *
+     * It is initialized from CPUID before main(), so that durations are usable
+     * before the frequency is measured.
      */
-    inline static std::atomic<uint64_t> _period = 0;
+    inline static std::atomic<uint64_t> _period = period_from_frequency(cpuid_frequency());
 
     inline static std::atomic<bool> _aux_is_cpu_id = false;
 
@@ -375,9 +441,14 @@ private:
         using namespace std::chrono_literals;
 
         // This function is called from the crt and must therefor be quick as we do not
-        // want to keep the user waiting. We are satisfied if the measured frequency is
-        // to within 1% accuracy.
+        // want to keep the user waiting. The frequency reported by the CPU is exact enough
+        // until time_stamp_utc refines it in the background.
+        if (auto const frequency = cpuid_frequency()) {
+            time_stamp_count::set_frequency(frequency);
+            return frequency;
+        }
 
+        // Otherwise measure it, we are satisfied if the measured frequency is to within 1% accuracy.
         // We take an average over 4 times in case the hires_utc_clock gets reset by a time server.
         uint64_t frequency = 0;
         uint64_t num_samples = 0;
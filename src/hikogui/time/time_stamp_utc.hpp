@@ -19,6 +19,9 @@
 #include <numeric>
 #include <mutex>
 #include <chrono>
+#include <span>
+#include <limits>
+#include <exception>
 
 hi_export_module(hikogui.time.time_stamp_utc);
 
@@ -76,28 +79,27 @@ struct time_stamp_utc {
      * This function will work in two modes:
      *  - subsystem off: Uses now() and the time_stamp_count frequency to
      *    estimate a timepoint from the given tsc.
-     *  - subsystem on: Uses the calibrated TSC offset and more accurate
-     *    frequency to estimate a timepoint from the given tsc.
-     *    this is much faster and a lot more accurate.
+     *  - subsystem on: Uses the published calibration and the offset of the
+     *    TSC of the CPU to calculate the timepoint from the given tsc.
+     *    This is lock-free and without branches, and a lot more accurate.
      */
     [[nodiscard]] static utc_nanoseconds make(time_stamp_count const& tsc) noexcept
     {
-        auto i = tsc.cpu_id();
-        if (i >= 0) {
-            auto const tsc_epoch = tsc_epochs[i].load(std::memory_order::relaxed);
-            if (tsc_epoch != utc_nanoseconds{}) {
-                return tsc_epoch + tsc.time_since_epoch();
-            }
+        auto const generation = _generation.load(std::memory_order::acquire);
+        if (generation == 0) {
+            [[unlikely]] return make_fallback(tsc);
         }
 
-        // Fallback.
-        auto const ref_tp = std::chrono::utc_clock::now();
-        auto const ref_tsc = time_stamp_count::now();
-        auto const diff_ns = ref_tsc.time_since_epoch() - tsc.time_since_epoch();
-        return ref_tp - diff_ns;
+        // An unknown cpu-id (-1) selects the last entry, which has no skew.
+        auto const cpu = std::min(static_cast<std::size_t>(tsc.cpu_id()), maximum_num_cpus);
+        return make(generation, tsc.count(), _tsc_skews[cpu].load(std::memory_order::relaxed));
     }
 
     /** This will start the calibration subsystem.
+     *
+     * A calibration, from the frequency which the time_stamp_count already knows,
+     * is published before this function returns. The frequency is refined in the
+     * background.
      */
     static bool start_subsystem() noexcept
     {
@@ -120,22 +122,102 @@ struct time_stamp_utc {
     static void adjust_for_drift() noexcept;
 
 private:
+    /** The relation between the TSC of the reference CPU and UTC.
+     */
+    struct calibration_type {
+        std::atomic<int64_t> utc = 0;
+        std::atomic<uint64_t> tsc = 0;
+        std::atomic<uint64_t> period = 0;
+    };
+
     inline static std::jthread subsystem_thread;
     inline static unfair_mutex mutex;
-    inline static std::array<std::atomic<utc_nanoseconds>, maximum_num_cpus> tsc_epochs = {};
 
-    static void subsystem_proc_frequency_calibration(std::stop_token stop_token)
+    /** A ring of calibrations; the one at `_generation` is the current.
+     *
+     * A calibration is written in the next slot before it is published by incrementing
+     * the generation. A reader only sees a mixed calibration if it is preempted while
+     * more calibrations are published than there are slots, each 100 ms apart.
+     */
+    inline static std::array<calibration_type, 4> _calibrations = {};
+    inline static std::atomic<uint64_t> _generation = 0;
+
+    /** The number of counts the TSC of each CPU is ahead of the TSC of the reference CPU.
+     *
+     * The extra entry at the end is for CPUs that are unknown.
+     */
+    inline static std::array<std::atomic<int64_t>, maximum_num_cpus + 1> _tsc_skews = {};
+
+    /** Convert a count to UTC using a calibration.
+     *
+     * @param generation The generation of the calibration to use.
+     * @param count The time-stamp-count.
+     * @param skew The skew of the TSC of the CPU on which @a count was taken.
+     */
+    [[nodiscard]] static utc_nanoseconds make(uint64_t generation, uint64_t count, int64_t skew) noexcept
     {
-        using namespace std::chrono_literals;
+        auto const& calibration = _calibrations[generation % _calibrations.size()];
+        auto const utc = calibration.utc.load(std::memory_order::relaxed);
+        auto const ref_tsc = calibration.tsc.load(std::memory_order::relaxed);
+        auto const period = calibration.period.load(std::memory_order::relaxed);
+
+        // A signed Q32.32 multiply: the full unsigned product is corrected for a negative delta.
+        auto const delta = count - ref_tsc - static_cast<uint64_t>(skew);
+        auto [lo, hi] = mul_carry(delta, period);
+        hi -= period & (0 - (delta >> 63));
+        auto const ns = static_cast<int64_t>((hi << 32) | (lo >> 32));
+
+        return utc_nanoseconds{std::chrono::nanoseconds{utc + ns}};
+    }
 
-        // Calibrate the TSC frequency to within 1 ppm.
-        // A 1s measurement already brings is to about 1ppm. We are
-        // going to be taking average of the IQR of 11 samples, just
-        // in case there are UTC clock adjustment made during the measurement.
+    [[nodiscard]] static utc_nanoseconds make_fallback(time_stamp_count const& tsc) noexcept
+    {
+        auto const ref_tp = std::chrono::utc_clock::now();
+        auto const ref_tsc = time_stamp_count::now();
+        auto const diff_ns = ref_tsc.time_since_epoch() - tsc.time_since_epoch();
+        return ref_tp - diff_ns;
+    }
+
+    /** Publish a new calibration.
+     *
+     * @pre `mutex` must be locked.
+     * @param tp The UTC time of the sample on the reference CPU.
+     * @param tsc The time-stamp-count of the sample on the reference CPU.
+     */
+    static void publish(utc_nanoseconds tp, time_stamp_count tsc) noexcept
+    {
+        auto const generation = _generation.load(std::memory_order::relaxed) + 1;
+        auto& calibration = _calibrations[generation % _calibrations.size()];
+        calibration.utc.store(tp.time_since_epoch().count(), std::memory_order::relaxed);
+        calibration.tsc.store(tsc.count(), std::memory_order::relaxed);
+        calibration.period.store(time_stamp_count::period(), std::memory_order::relaxed);
+        _generation.store(generation, std::memory_order::release);
+    }
+
+    /** Take a sample on the current CPU and publish it as the calibration.
+     *
+     * @pre The thread affinity is set to a single CPU.
+     */
+    static void publish_sample()
+    {
+        auto const lock = std::scoped_lock(time_stamp_utc::mutex);
 
-        std::array<uint64_t, 16> frequencies;
-        for (auto i = 0; i != frequencies.size();) {
-            auto const f = time_stamp_count::measure_frequency(1s);
+        time_stamp_count tsc;
+        auto const tp = time_stamp_utc::now(tsc);
+        publish(tp, tsc);
+        _reference_cpu = tsc.cpu_id();
+    }
+
+    /** The CPU on which the calibration are sampled.
+     */
+    inline static ssize_t _reference_cpu = -1;
+
+    /** Refine the frequency, and republish the calibration with it.
+     */
+    static void refine_frequency(std::chrono::milliseconds sample_duration, std::span<uint64_t> frequencies, std::stop_token const& stop_token)
+    {
+        for (auto i = 0_uz; i != frequencies.size();) {
+            auto const f = time_stamp_count::measure_frequency(sample_duration);
             if (f != 0) {
                 frequencies[i] = f;
                 ++i;
@@ -145,13 +227,36 @@ private:
                 return;
             }
         }
+
+        // Take the average of the inter-quartile-range, in case there are UTC clock adjustment
+        // made during the measurement.
         std::ranges::sort(frequencies);
-        auto const iqr_size = frequencies.size() / 2;
-        auto const iqr_first = std::next(frequencies.cbegin(), frequencies.size() / 4);
+        auto const iqr_size = std::max(frequencies.size() / 2, 1_uz);
+        auto const iqr_first = std::next(frequencies.begin(), frequencies.size() / 4);
         auto const iqr_last = std::next(iqr_first, iqr_size);
         auto const frequency = std::accumulate(iqr_first, iqr_last, uint64_t{0}) / iqr_size;
 
         time_stamp_count::set_frequency(frequency);
+
+        auto const cpu = _reference_cpu >= 0 ? narrow_cast<std::size_t>(_reference_cpu) : current_cpu_id();
+        auto const prev_mask = set_thread_affinity(cpu);
+        publish_sample();
+        set_thread_affinity_mask(prev_mask);
+    }
+
+    static void subsystem_proc_frequency_calibration(std::stop_token stop_token)
+    {
+        using namespace std::chrono_literals;
+
+        // First a short refinement, in case the frequency was not reported by the CPU.
+        auto short_frequencies = std::array<uint64_t, 4>{};
+        refine_frequency(50ms, short_frequencies, stop_token);
+
+        // Calibrate the TSC frequency to within 1 ppm.
+        // A 1s measurement already brings is to about 1ppm. We are
+        // going to be taking average of the IQR of 16 samples.
+        auto frequencies = std::array<uint64_t, 16>{};
+        refine_frequency(1s, frequencies, stop_token);
     }
     static void subsystem_proc(std::stop_token stop_token)
     {
@@ -167,13 +272,23 @@ private:
             auto const current_cpu = advance_thread_affinity(next_cpu);
 
             std::this_thread::sleep_for(100ms);
+            if (narrow_cast<ssize_t>(current_cpu) == _reference_cpu) {
+                // Follow the drift between the TSC and the UTC clock.
+                publish_sample();
+                continue;
+            }
+
             auto const lock = std::scoped_lock(time_stamp_utc::mutex);
 
             time_stamp_count tsc;
             auto const tp = time_stamp_utc::now(tsc);
             hi_assert(tsc.cpu_id() == narrow_cast<ssize_t>(current_cpu));
 
-            tsc_epochs[current_cpu].store(tp - tsc.time_since_epoch(), std::memory_order::relaxed);
+            // The difference between the actual time and the time converted without skew,
+            // is the skew of the TSC of this CPU.
+            auto const error = make(_generation.load(std::memory_order::acquire), tsc.count(), 0) - tp;
+            auto const skew_count = static_cast<int64_t>(time_stamp_count::count_from_duration(std::chrono::abs(error)));
+            _tsc_skews[current_cpu].store(error < 0ns ? -skew_count : skew_count, std::memory_order::relaxed);
         }
     }
 
@@ -181,6 +296,15 @@ private:
      */
     static bool init_subsystem() noexcept
     {
+        // Publish a calibration from the current frequency, so that make() is fast from the start.
+        auto const prev_mask = set_thread_affinity(current_cpu_id());
+        try {
+            publish_sample();
+        } catch (std::exception const&) {
+            // Keep using the fallback until the subsystem thread publishes a calibration.
+        }
+        set_thread_affinity_mask(prev_mask);
+
         time_stamp_utc::subsystem_thread = std::jthread{subsystem_proc};
         return true;
     }
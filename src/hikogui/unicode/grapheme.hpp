@@ -13,7 +13,7 @@
 #include "unicode_normalization.hpp"
 #include "ucd_general_categories.hpp"
 #include "ucd_canonical_combining_classes.hpp"
-#include "ucd_scripts.hpp"
+#include "ucd_text_properties.hpp"
 #include "phrasing.hpp"
 #include "../macros.hpp"
 #include <cstdint>
@@ -26,7 +26,6 @@
 #include <bit>
 #include <array>
 #include <atomic>
-#include <unordered_map>
 #include <mutex>
 #include <chrono>
 #include <format>
@@ -36,14 +35,47 @@ hi_export_module(hikogui.unicode : grapheme);
 hi_export namespace hi::inline v1 {
 namespace detail {
 
+/** A table of graphemes that consist of more than one code-point.
+ *
+ * The code-points are stored in an arena of chunks, which are allocated when
+ * the first grapheme is placed in them. Since almost all graphemes are a
+ * single code-point, most processes never allocate a chunk.
+ *
+ * Finding an existing grapheme is done through a flat open-addressing hash
+ * table which references the graphemes in the arena.
+ *
+ * A grapheme is never removed from the table and its code-points never move,
+ * which allows reading a grapheme without locking.
+ */
 class long_grapheme_table {
 public:
+    /** The maximum number of code-points in the table.
+     */
+    constexpr static uint32_t capacity = 0x0f'0000;
+
+    /** The number of code-points in a chunk of the arena.
+     */
+    constexpr static uint32_t chunk_size = 0x1000;
+
+    constexpr static uint32_t num_chunks = capacity / chunk_size;
+    static_assert(capacity % chunk_size == 0);
+
     long_grapheme_table() = default;
     long_grapheme_table(long_grapheme_table const&) = delete;
     long_grapheme_table(long_grapheme_table&&) = delete;
     long_grapheme_table& operator=(long_grapheme_table const&) = delete;
     long_grapheme_table& operator=(long_grapheme_table&&) = delete;
 
+    ~long_grapheme_table()
+    {
+        for (auto& chunk : _chunks) {
+            if (auto const chunk_ptr = chunk.load(std::memory_order::relaxed)) {
+                delete[] chunk_ptr;
+                track_deallocation<"long_grapheme_table">(chunk_size * sizeof(char32_t));
+            }
+        }
+    }
+
     /** Get the grapheme from the table.
      *
      * @param start The start position of the grapheme in the table.
@@ -54,9 +86,7 @@ public:
      */
     [[nodiscard]] std::u32string get_grapheme(uint32_t start) const noexcept
     {
-        // If `start` came from another thread it will have been transferred
-        // to this thread pr
-        auto src = std::addressof(_table[start]);
+        auto const src = get_code_points(start);
         auto const length = *src >> 21;
 
         auto r = std::u32string{};
@@ -78,7 +108,7 @@ public:
      */
     [[nodiscard]] size_t get_grapheme_size(uint32_t start) const noexcept
     {
-        return _table[start] >> 21;
+        return *get_code_points(start) >> 21;
     }
 
     /** Get the starter (first) code-point of a grapheme.
@@ -91,7 +121,7 @@ public:
      */
     [[nodiscard]] char32_t get_grapheme_starter(uint32_t start) const noexcept
     {
-        return char32_t{_table[start] & 0x1f'ffff};
+        return char32_t{*get_code_points(start) & 0x1f'ffff};
     }
 
     /** Find or insert a grapheme in the table.
@@ -111,41 +141,138 @@ public:
 
         auto const lock = std::scoped_lock(_mutex);
 
+        if (_index.empty()) {
+            _index.resize(initial_index_size, 0);
+        }
+
         // See if this grapheme already exists and return its index.
-        if (auto const it = _indices.find(code_points); it != _indices.end()) {
-            return it->second;
+        auto const hash = hash_code_points(code_points.cbegin(), code_points.cend());
+        auto const mask = _index.size() - 1;
+        auto slot = hash & mask;
+        for (; _index[slot] != 0; slot = (slot + 1) & mask) {
+            if (equal_code_points(_index[slot] - 1, code_points)) {
+                return narrow_cast<int32_t>(_index[slot] - 1);
+            }
+        }
+
+        auto const size = narrow_cast<uint32_t>(code_points.size());
+
+        // A grapheme must not cross the boundary of a chunk.
+        auto insert_index = _head;
+        if (insert_index / chunk_size != (insert_index + size - 1) / chunk_size) {
+            insert_index = (insert_index / chunk_size + 1) * chunk_size;
         }
 
         // Check if there is enough room in the table to add the code-points.
-        if (_head + code_points.size() >= _table.size()) {
+        if (insert_index + size > capacity) {
             return -1;
         }
 
-        auto const insert_index = _head;
-        _head += narrow_cast<uint32_t>(code_points.size());
+        auto& chunk = _chunks[insert_index / chunk_size];
+        auto chunk_ptr = chunk.load(std::memory_order::relaxed);
+        if (chunk_ptr == nullptr) {
+            chunk_ptr = new char32_t[chunk_size];
+            track_allocation<"long_grapheme_table">(chunk_size * sizeof(char32_t));
+            chunk.store(chunk_ptr, std::memory_order::release);
+        }
 
         // Copy the grapheme into the table, and set the size on the first entry.
-        std::copy(code_points.cbegin(), code_points.cend(), _table.begin() + insert_index);
-        _table[insert_index] |= char_cast<char32_t>(code_points.size() << 21);
+        auto const dst = chunk_ptr + insert_index % chunk_size;
+        std::copy(code_points.cbegin(), code_points.cend(), dst);
+        *dst |= char_cast<char32_t>(size << 21);
+        _head = insert_index + size;
 
         // Add the grapheme to the quickly searchable index table.
-        _indices.emplace(std::forward<CodePoints>(code_points), insert_index);
+        _index[slot] = insert_index + 1;
+        if (++_index_count * 2 > _index.size()) {
+            grow_index();
+        }
 
-        return insert_index;
+        return narrow_cast<int32_t>(insert_index);
     }
 
 private:
+    constexpr static size_t initial_index_size = 256;
+
+    using index_allocator_type = tracked_allocator<uint32_t, "long_grapheme_table">;
+
     mutable unfair_mutex _mutex = {};
     uint32_t _head = {};
 
-    /** Table of code-points for graphemes.
+    /** Chunks of code-points for graphemes.
+     *
+     * - [20:0] code-point.
+     * - [25:21] number of code-point of the grapheme (only on the first code-point).
+     */
+    std::array<std::atomic<char32_t *>, num_chunks> _chunks = {};
+
+    /** Open-addressing hash table, with linear probing.
      *
-     * - [7:0] number of code-point of the grapheme (only on the first code-point).
-     * - [28:8] code-point.
+     * Each slot contains the start of a grapheme plus one, or zero when empty.
+     * The load factor is kept below 50%.
+     */
+    std::vector<uint32_t, index_allocator_type> _index = {};
+    size_t _index_count = 0;
+
+    /** Get a pointer to the code-points of a grapheme.
      */
-    std::array<char32_t, 0x0f'0000> _table = {};
+    [[nodiscard]] char32_t const *get_code_points(uint32_t start) const noexcept
+    {
+        hi_axiom(start < capacity);
+        auto const chunk_ptr = _chunks[start / chunk_size].load(std::memory_order::acquire);
+        hi_axiom_not_null(chunk_ptr);
+        return chunk_ptr + start % chunk_size;
+    }
+
+    template<typename It, typename ItEnd>
+    [[nodiscard]] constexpr static size_t hash_code_points(It first, ItEnd last) noexcept
+    {
+        // FNV-1a, with a code-point per step.
+        auto r = uint32_t{0x811c'9dc5};
+        for (; first != last; ++first) {
+            r = (r ^ char_cast<uint32_t>(*first)) * uint32_t{0x0100'0193};
+        }
+        return r;
+    }
+
+    [[nodiscard]] size_t hash_grapheme(uint32_t start) const noexcept
+    {
+        auto const code_points = get_grapheme(start);
+        return hash_code_points(code_points.cbegin(), code_points.cend());
+    }
 
-    std::unordered_map<std::u32string, uint32_t> _indices = {};
+    template<typename CodePoints>
+    [[nodiscard]] bool equal_code_points(uint32_t start, CodePoints const& code_points) const noexcept
+    {
+        auto const src = get_code_points(start);
+        if ((*src >> 21) != code_points.size()) {
+            return false;
+        }
+
+        auto it = code_points.cbegin();
+        if ((*src & 0x1f'ffff) != *it++) {
+            return false;
+        }
+        return std::equal(it, code_points.cend(), src + 1);
+    }
+
+    void grow_index() noexcept
+    {
+        auto index = std::vector<uint32_t, index_allocator_type>(_index.size() * 2, 0);
+        auto const mask = index.size() - 1;
+
+        for (auto const entry : _index) {
+            if (entry != 0) {
+                auto slot = hash_grapheme(entry - 1) & mask;
+                while (index[slot] != 0) {
+                    slot = (slot + 1) & mask;
+                }
+                index[slot] = entry;
+            }
+        }
+
+        _index = std::move(index);
+    }
 };
 
 inline long_grapheme_table long_graphemes = {};
@@ -307,7 +434,7 @@ struct grapheme {
      */
     [[nodiscard]] constexpr iso_15924 starter_script() const noexcept
     {
-        return ucd_get_script(starter());
+        return ucd_get_text_properties(starter()).script();
     }
 
     /** Get the script of the starter code-point.
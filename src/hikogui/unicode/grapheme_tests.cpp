@@ -4,6 +4,9 @@
 
 #include "gstring.hpp"
 #include <hikotest/hikotest.hpp>
+#include <memory>
+#include <string>
+#include <vector>
 
 TEST_SUITE(grapheme_suite) {
 
@@ -137,4 +140,27 @@ TEST_CASE(set_language_tag_wrong_script)
     REQUIRE(c.phrasing() == hi::phrasing::success);
 }
 
+TEST_CASE(long_grapheme_table_add)
+{
+    auto table = std::make_unique<hi::detail::long_grapheme_table>();
+
+    // Enough graphemes to span multiple chunks and to grow the index a couple of times.
+    auto indices = std::vector<int32_t>{};
+    for (auto i = char32_t{0}; i != 3000; ++i) {
+        auto const code_points = std::u32string{static_cast<char32_t>(U'\u4e00' + i), U'\u0301', U'\u0302'};
+        auto const index = table->add_grapheme(code_points);
+        REQUIRE(index >= 0);
+        indices.push_back(index);
+    }
+
+    for (auto i = char32_t{0}; i != 3000; ++i) {
+        auto const code_points = std::u32string{static_cast<char32_t>(U'\u4e00' + i), U'\u0301', U'\u0302'};
+        auto const index = hi::narrow_cast<uint32_t>(indices[i]);
+        REQUIRE(table->add_grapheme(code_points) == indices[i]);
+        REQUIRE(table->get_grapheme_size(index) == 3);
+        REQUIRE(table->get_grapheme_starter(index) == static_cast<char32_t>(U'\u4e00' + i));
+        REQUIRE(table->get_grapheme(index) == code_points);
+    }
+}
+
 };
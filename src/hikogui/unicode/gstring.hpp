@@ -21,6 +21,9 @@
 #include <cuchar>
 #include <cwchar>
 #include <compare>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 
 hi_export_module(hikogui.unicode.gstring);
 
@@ -250,17 +253,11 @@ constexpr void fix_language(It first, ItEnd last, language_tag default_language_
     return str;
 }
 
-/** Convert a UTF-32 string-view to a grapheme-string.
- *
- * Before conversion to `gstring` a string is first normalized using the Unicode
- * normalization algorithm. By default it is normalized using NFC.
- *
- * @param rhs The UTF-32 string to convert.
- * @param config The attributes used for normalizing the input string.
- * @return A grapheme-string.
+namespace detail {
+
+/** Convert a UTF-32 string-view to a grapheme-string, one code-point at a time.
  */
-[[nodiscard]] constexpr gstring
-to_gstring(std::u32string_view rhs, unicode_normalize_config config = unicode_normalize_config::NFC()) noexcept
+[[nodiscard]] constexpr gstring to_gstring_slow(std::u32string_view rhs, unicode_normalize_config const& config) noexcept
 {
     auto const normalized_string = unicode_normalize(rhs, config);
 
@@ -284,6 +281,127 @@ to_gstring(std::u32string_view rhs, unicode_normalize_config config = unicode_no
     return r;
 }
 
+template<typename CharT>
+[[nodiscard]] constexpr bool is_printable_ascii(CharT c) noexcept
+{
+    return c >= CharT{0x20} and c <= CharT{0x7e};
+}
+
+/** Check if eight characters are all printable ASCII, using SIMD-within-a-register.
+ *
+ * A byte below 0x20 borrows into its high bit, a byte above 0x7e carries into
+ * its high bit. Carries and borrows only leak into the next byte when the
+ * chunk already contains a byte that is not printable.
+ *
+ * @param chunk Eight characters loaded as an integer.
+ */
+[[nodiscard]] constexpr bool is_eight_printable_ascii(uint64_t chunk) noexcept
+{
+    constexpr auto ones = uint64_t{0x0101'0101'0101'0101};
+    return ((chunk | (chunk - ones * 0x20) | (chunk + ones)) & (ones * 0x80)) == 0;
+}
+
+/** Find the first character that is not printable ASCII.
+ */
+template<typename CharT>
+[[nodiscard]] constexpr std::size_t find_not_printable_ascii(std::basic_string_view<CharT> str, std::size_t i) noexcept
+{
+    if constexpr (sizeof(CharT) == 1) {
+        for (; str.size() - i >= 8; i += 8) {
+            if (not is_eight_printable_ascii(load_le<uint64_t>(str.data() + i))) {
+                break;
+            }
+        }
+    }
+
+    for (; i != str.size(); ++i) {
+        if (not is_printable_ascii(str[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+/** Check if the printable ASCII characters are passed through unchanged by normalization.
+ */
+[[nodiscard]] constexpr bool keeps_printable_ascii(unicode_normalize_config const& config) noexcept
+{
+    auto const is_printable = [](char32_t c) {
+        return is_printable_ascii(c);
+    };
+    return std::ranges::none_of(config.line_separators, is_printable) and
+        std::ranges::none_of(config.paragraph_separators, is_printable) and std::ranges::none_of(config.drop, is_printable);
+}
+
+/** Convert a string to a grapheme-string, with a fast path for printable ASCII.
+ *
+ * Each printable ASCII character is a grapheme of its own, unless it is preceded by
+ * a prepend character or followed by a combining character. Therefor runs of printable
+ * ASCII are converted directly, while a printable ASCII character on each side of
+ * other characters is passed with those characters to the full normalization and
+ * grapheme cluster break algorithms.
+ *
+ * @param rhs A UTF-8 or UTF-32 string.
+ * @param config The attributes used for normalizing the input string, which must
+ *               keep the printable ASCII characters.
+ */
+template<typename CharT>
+[[nodiscard]] constexpr gstring to_gstring_fast(std::basic_string_view<CharT> rhs, unicode_normalize_config const& config) noexcept
+{
+    hi_axiom(keeps_printable_ascii(config));
+
+    auto r = gstring{};
+    r.reserve(rhs.size());
+
+    auto i = 0_uz;
+    while (i != rhs.size()) {
+        auto const run_last = find_not_printable_ascii(rhs, i);
+
+        // The last character of a run may combine with the character that follows.
+        auto const fast_last = run_last == rhs.size() or run_last == i ? run_last : run_last - 1;
+        for (; i != fast_last; ++i) {
+            r += grapheme{char_cast<char>(rhs[i])};
+        }
+        if (i == rhs.size()) {
+            break;
+        }
+
+        // End the slow part after a printable ASCII character, which is followed by another.
+        auto slow_last = run_last;
+        do {
+            slow_last = std::find_if(rhs.begin() + slow_last, rhs.end(), is_printable_ascii<CharT>) - rhs.begin();
+            if (slow_last != rhs.size()) {
+                ++slow_last;
+            }
+        } while (slow_last != rhs.size() and not is_printable_ascii(rhs[slow_last]));
+
+        r += to_gstring_slow(to_u32string(rhs.substr(i, slow_last - i)), config);
+        i = slow_last;
+    }
+    return r;
+}
+
+} // namespace detail
+
+/** Convert a UTF-32 string-view to a grapheme-string.
+ *
+ * Before conversion to `gstring` a string is first normalized using the Unicode
+ * normalization algorithm. By default it is normalized using NFC.
+ *
+ * @param rhs The UTF-32 string to convert.
+ * @param config The attributes used for normalizing the input string.
+ * @return A grapheme-string.
+ */
+[[nodiscard]] constexpr gstring
+to_gstring(std::u32string_view rhs, unicode_normalize_config config = unicode_normalize_config::NFC()) noexcept
+{
+    if (detail::keeps_printable_ascii(config)) {
+        return detail::to_gstring_fast(rhs, config);
+    } else {
+        return detail::to_gstring_slow(rhs, config);
+    }
+}
+
 /** Convert a UTF-8 string to a grapheme-string.
  *
  * Before conversion to `gstring` a string is first normalized using the Unicode
@@ -296,7 +414,11 @@ to_gstring(std::u32string_view rhs, unicode_normalize_config config = unicode_no
 [[nodiscard]] constexpr gstring
 to_gstring(std::string_view rhs, unicode_normalize_config config = unicode_normalize_config::NFC()) noexcept
 {
-    return to_gstring(to_u32string(rhs), config);
+    if (detail::keeps_printable_ascii(config)) {
+        return detail::to_gstring_fast(rhs, config);
+    } else {
+        return detail::to_gstring_slow(to_u32string(rhs), config);
+    }
 }
 
 /** Convert a grapheme string to UTF-8.
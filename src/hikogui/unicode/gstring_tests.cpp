@@ -4,6 +4,8 @@
 
 #include "gstring.hpp"
 #include <hikotest/hikotest.hpp>
+#include <string>
+#include <vector>
 
 TEST_SUITE(gstring) {
 
@@ -14,4 +16,28 @@ TEST_CASE(from_utf8)
     REQUIRE(static_cast<int>(test[10].starter()) != 0);
 }
 
+TEST_CASE(ascii_fast_path)
+{
+    auto const config = hi::unicode_normalize_config::NFC();
+
+    // Combining marks, prepend characters, Hebrew, an emoji sequence and line feeds around and inside of ASCII runs.
+    auto const tests = std::vector<std::u32string>{
+        U"",
+        U"Hello, world!",
+        U"e\u0301",
+        U"cafe\u0301 au lait",
+        U"\u0600abc",
+        U"ab\u0600cd\u0301ef",
+        U"This is a \u05dc\u05b0\u05de\u05b7\u05ea\u05b5\u05d2.\nAnd another sentence.",
+        U"x\U0001f469\u200d\U0001f4bbyz",
+        U"a\r\nb\n\nc",
+        U"0123456789abcdefghij\u0301klmnopqrstuvwxyz"};
+
+    for (auto const& test : tests) {
+        auto const expected = hi::detail::to_gstring_slow(test, config);
+        REQUIRE(hi::to_gstring(test) == expected);
+        REQUIRE(hi::to_gstring(hi::to_string(test)) == expected);
+    }
+}
+
 };
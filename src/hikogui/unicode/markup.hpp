@@ -7,8 +7,15 @@
 #include "gstring.hpp"
 #include "../i18n/i18n.hpp"
 #include "../utility/utility.hpp"
+#include "../concurrency/concurrency.hpp"
 #include <string>
 #include <string_view>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <functional>
+#include <utility>
+#include <cstddef>
 #include <algorithm>
 #include <iterator>
 #include <ranges>
@@ -57,7 +64,7 @@ hi_export namespace hi { inline namespace v1 {
  */
 hi_export template<std::input_or_output_iterator It, std::sentinel_for<It> ItEnd>
 constexpr It
-apply_markup(It first, ItEnd last, language_tag default_language = language_tag{"en-US"}, phrasing default_phrasing = phrasing::regular) noexcept
+apply_markup(It first, ItEnd last, language_tag default_language = language_tag{iso_639{"en"}, iso_15924{"Latn"}, iso_3166{"US"}}, phrasing default_phrasing = phrasing::regular) noexcept
     requires std::same_as<typename It::value_type, grapheme>
 {
     enum class state_type { idle, command };
@@ -153,7 +160,7 @@ apply_markup(It first, ItEnd last, language_tag default_language = language_tag{
  * @return A grapheme string with the markup applied.
  */
 hi_export [[nodiscard]] constexpr gstring
-apply_markup(gstring str, language_tag default_language = language_tag{"en-US"}, phrasing default_phrasing = phrasing::regular) noexcept
+apply_markup(gstring str, language_tag default_language = language_tag{iso_639{"en"}, iso_15924{"Latn"}, iso_3166{"US"}}, phrasing default_phrasing = phrasing::regular) noexcept
 {
     auto it = apply_markup(str.begin(), str.end(), default_language, default_phrasing);
     str.erase(it, str.end());
@@ -168,9 +175,133 @@ apply_markup(gstring str, language_tag default_language = language_tag{"en-US"},
  * @return A grapheme string with the markup applied.
  */
 hi_export [[nodiscard]] constexpr gstring
-apply_markup(std::string_view str, language_tag default_language = language_tag{"en-US"}, phrasing default_phrasing = phrasing::regular) noexcept
+apply_markup(std::string_view str, language_tag default_language = language_tag{iso_639{"en"}, iso_15924{"Latn"}, iso_3166{"US"}}, phrasing default_phrasing = phrasing::regular) noexcept
 {
     return apply_markup(to_gstring(str), default_language, default_phrasing);
 }
 
+/** A cache of strings with the markup applied.
+ *
+ * Labels apply markup to the same strings each time they are laid out, the
+ * cache returns the earlier result instead of converting and parsing the
+ * string again. The results are shared and immutable, so that they can
+ * be returned without copying while other threads use the cache.
+ *
+ * The cache is emptied when it becomes full.
+ *
+ * @note It is thread-safe to use the cache.
+ */
+hi_export class markup_cache {
+public:
+    constexpr static std::size_t default_capacity = 4096;
+
+    markup_cache(markup_cache const&) = delete;
+    markup_cache(markup_cache&&) = delete;
+    markup_cache& operator=(markup_cache const&) = delete;
+    markup_cache& operator=(markup_cache&&) = delete;
+
+    /** Construct a cache.
+     *
+     * @param capacity The maximum number of strings in the cache.
+     */
+    explicit markup_cache(std::size_t capacity = default_capacity) noexcept : _capacity(capacity)
+    {
+        hi_axiom(capacity != 0);
+    }
+
+    /** The number of strings in the cache.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        return _map.size();
+    }
+
+    /** Remove all strings from the cache.
+     */
+    void clear() noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        _map.clear();
+    }
+
+    /** Apply markup to a string, or get the earlier result.
+     *
+     * @see apply_markup(std::string_view, language_tag, phrasing)
+     * @param str A UTF-8 string to apply the markup to.
+     * @param default_language The language of the text outside of language commands.
+     * @param default_phrasing The phrasing of the text outside of phrasing commands.
+     * @return A shared grapheme string with the markup applied.
+     */
+    [[nodiscard]] std::shared_ptr<gstring const> get(
+        std::string_view str,
+        language_tag default_language = language_tag{iso_639{"en"}, iso_15924{"Latn"}, iso_3166{"US"}},
+        phrasing default_phrasing = phrasing::regular) noexcept
+    {
+        auto const key = key_view_type{str, default_language, default_phrasing};
+        {
+            auto const lock = std::scoped_lock(_mutex);
+            if (auto const it = _map.find(key); it != _map.end()) {
+                return it->second;
+            }
+        }
+
+        // Apply the markup without holding the lock, another thread may do the same.
+        auto r = std::make_shared<gstring const>(apply_markup(str, default_language, default_phrasing));
+
+        auto const lock = std::scoped_lock(_mutex);
+        if (_map.size() >= _capacity) {
+            _map.clear();
+        }
+        return _map.try_emplace(key_type{std::string{str}, default_language, default_phrasing}, std::move(r)).first->second;
+    }
+
+private:
+    struct key_view_type {
+        std::string_view str;
+        language_tag language;
+        hi::phrasing phrasing;
+
+        [[nodiscard]] constexpr friend bool operator==(key_view_type const&, key_view_type const&) noexcept = default;
+    };
+
+    struct key_type {
+        std::string str;
+        language_tag language;
+        hi::phrasing phrasing;
+
+        [[nodiscard]] constexpr operator key_view_type() const noexcept
+        {
+            return {str, language, phrasing};
+        }
+    };
+
+    struct key_hash {
+        using is_transparent = void;
+
+        [[nodiscard]] std::size_t operator()(key_view_type const& rhs) const noexcept
+        {
+            return hash_mix(rhs.str, rhs.language, std::to_underlying(rhs.phrasing));
+        }
+
+        [[nodiscard]] std::size_t operator()(key_type const& rhs) const noexcept
+        {
+            return (*this)(static_cast<key_view_type>(rhs));
+        }
+    };
+
+    struct key_equal {
+        using is_transparent = void;
+
+        [[nodiscard]] bool operator()(key_view_type const& lhs, key_view_type const& rhs) const noexcept
+        {
+            return lhs == rhs;
+        }
+    };
+
+    std::size_t _capacity;
+    mutable unfair_mutex _mutex = {};
+    std::unordered_map<key_type, std::shared_ptr<gstring const>, key_hash, key_equal> _map = {};
+};
+
 }} // namespace hi::v1
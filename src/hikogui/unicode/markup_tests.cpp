@@ -189,4 +189,27 @@ TEST_CASE(language_unknown)
     REQUIRE(tmp == "a[no-lang]bc");
 }
 
+TEST_CASE(cache)
+{
+    auto cache = hi::markup_cache{2};
+
+    auto const a = cache.get("a[e]b[.]c");
+    REQUIRE(*a == "abc");
+    REQUIRE(a->at(1).phrasing() == hi::phrasing::emphasis);
+    REQUIRE(cache.get("a[e]b[.]c") == a);
+    REQUIRE(cache.size() == 1);
+
+    // Different phrasing or language are cached separately.
+    auto const b = cache.get("a[e]b[.]c", hi::language_tag{"en-US"}, hi::phrasing::strong);
+    REQUIRE(b != a);
+    REQUIRE(b->at(0).phrasing() == hi::phrasing::strong);
+    REQUIRE(cache.size() == 2);
+
+    // The cache is emptied when full.
+    auto const c = cache.get("abc");
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.get("a[e]b[.]c") != a);
+    REQUIRE(*a == "abc");
+}
+
 };
@@ -13,847 +13,6 @@ hi_export_module(hikogui.unicode.ucd_bidi_classes);
 
 hi_export namespace hi {
 inline namespace v1 {
-namespace detail {
-
-constexpr auto ucd_bidi_classes_chunk_size = 128_uz;
-constexpr auto ucd_bidi_classes_index_width = 8_uz;
-constexpr auto ucd_bidi_classes_indices_size = 8704_uz;
-constexpr auto ucd_bidi_class_width = 5_uz;
-
-static_assert(std::has_single_bit(ucd_bidi_classes_chunk_size));
-
-constexpr uint8_t ucd_bidi_classes_indices_bytes[8720] = {
-     0,  1,  2,  2,  2,  3,  4,  5,  2,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
-    29, 30,  2,  2, 31, 32, 33, 34, 35,  2,  2,  2,  2, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,  2, 49,  2,  2, 50, 51,
-    52, 53, 54, 55, 56, 57, 58, 59, 57, 60, 57, 57, 57, 61, 57, 57,  2,  2, 57, 57, 57, 57, 57, 57,  2, 62, 63, 64, 57, 57, 57, 57,
-    65, 66, 67, 68, 69, 70, 71, 72,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 73,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2, 74,  2,  2, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 87,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 88, 89, 90, 91, 92, 92, 93, 94, 95, 96, 97, 98,
-    99,100,101,102, 57,103,104,105,  2,106,107,108,  2,  2,109,110,111,112,113,114,115,116,117,118,119,120,121, 57,122,123,124,125,
-   126,127,128,129,130,131,132, 57,133,134, 57,135,136,137,138, 57,139,140,141,142,143,144,145, 57,146,147,148,149, 57,150,151,152,
-     2,  2,  2,  2,  2,  2,  2,153,154,  2,155, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,156,
-     2,  2,  2,  2,  2,  2,  2,  2,157, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57,  2,  2,  2,  2,158, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,  2,  2,  2,  2,159,160,161,162, 57, 57, 57, 57,163,164,165,166,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,167,  2,  2,  2,  2,  2,  2,  2,  2,  2,168, 55, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,169,
-     2,  2,170,  2,  2,171, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,172,173, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,174,155,
-     2,175,176,177,178,179,180, 57,181,182,183,  2,  2,184,185,186,  2,  2,  2,  2,187,188, 57, 57, 57, 57, 57, 57, 57, 57,189, 57,
-   190,191,192, 57, 57,193, 57, 57, 57,194, 57, 57, 57, 57, 57,195,196,197,198, 57, 57, 57, 57, 57,199,200,201, 57,202,203, 57, 57,
-    57, 57,204,205,206, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,207, 57, 57, 57, 57, 57, 57, 57, 57,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,208,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,209,  2,210,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,211,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,212, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,  2,  2,  2,  2,213, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,214,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,215, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-   216, 57,217,218, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,219,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,219,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-constexpr uint8_t ucd_bidi_classes_bytes[17616] = {
-    24,198, 49,140, 99, 25, 10, 67, 20, 99, 24,198, 49,140, 99, 24,198, 50,148,164, 48,  0,115,156,  0,  0,  0,132,161, 41, 82,148,
-   165, 41, 74, 82,146,  0,  0,  0,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  3, 24,198, 49,148, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,
-   198, 49,140, 99, 72, 14,115,156,  0,  0,  2,  0, 12,  0, 57,212,160,  4,  0,  2,130,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 32,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,
-     0,  0,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,128,  0,  0,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107,  8, 66, 16,  0, 33,  0,  2, 16,132,  1,  0,  0,  0,  0, 32,  8, 66,  0,128, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 64, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  1,  8, 66, 16,132, 33,
-     8, 66,181,173,107, 90,194, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 32,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 64,  0,  0,  7,  2,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,172, 75, 18,214, 37,172, 75,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132,  0,  0,  2, 16,132, 33,  0,  0,  0,  0,  0,  0,  0, 99, 24,198, 48,  0,105,206,212,180,  0, 90,214,181,173,107, 90,
-   214,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 99, 24,198, 49,140, 99, 14,198, 53,173, 91, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,107, 90,214,181,176, 11, 90,214,181,181,
-   171, 88, 22,181,173,173, 82,148,165, 41, 74, 82,154,214,181,173,107, 90,214,181,173,107, 90,214,180, 13,106,218,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,
-    53,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,107, 90,214,181,173,107, 91, 64,
-     0,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132,181,173,107, 90,214,177,  8,  0,  0,  4,  0, 44, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  9,107, 90,
-   196,181,173,107, 90,214,177, 45,107, 18,214,181,172,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 64, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 18,214,176,  0, 64,107, 90,214,181,173,107, 90,  0,  0,  0,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,160, 99,  0,  0,  0,  0, 90,214,181,173,107,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 86,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,216,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 86, 21,132, 33, 10,214,181,173,107, 88, 66, 16,
-   172, 33, 10,214,181,173,107,  8, 66, 16,132, 33,  8, 86,176,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-    10,194, 16,  4, 33,  8, 66, 16,128,  1,  8,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,132, 33,  8,  2,
-     0,  0, 33,  8, 64,  5,132, 33, 10,214,181,128,  1,  8,  0, 16,172, 32,  0,  0,  0,  0,  1,  0,  0,  0,132,  1,  8, 86,176,  0,
-    33,  8, 66, 16,132, 33,  8, 78,112,132, 33,  8, 66,112,133, 96,  2,214, 16,  4, 33,  8, 66,  0,  0,  1,  8,  0, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,132, 33,  8,  2, 16,  4, 32,  8, 64,  5,128, 33, 10,214,  0,  0, 11, 88,  0,181,
-   172,  0,  2,192,  0,  0,  0,  0, 66, 16,128, 32,  0,  0,  0,  0, 33,  8, 66, 16,132, 33, 90,194, 16,172, 32,  0,  0,  0,  0,  0,
-     2,214, 16,  4, 33,  8, 66, 16,132,  1,  8, 64, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,132, 33,  8,  2,
-    16,  4, 33,  8, 64,  5,132, 33, 10,214,181,172, 11, 88, 64, 16,172,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 86,176,  0,
-    33,  8, 66, 16,132, 33,  9,192,  0,  0,  0,  0, 86,181,173,107,  2,194, 16,  4, 33,  8, 66, 16,128,  1,  8,  0, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,132, 33,  8,  2, 16,  4, 33,  8, 64,  5,132, 43, 10,214,181,128,  1,  8,  0, 16,
-   172,  0,  0,  0,  0, 45, 97,  0,  0,  0,132,  1,  8, 86,176,  0, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,
-     0, 22, 16,  4, 33,  8, 66,  0,  0, 33,  8,  2, 16,132,  0,  0, 66,  0,128, 33,  0,  0, 16,128,  0,  8, 66,  0,  0, 33,  8, 66,
-    16,132, 33,  8, 64,  0,  0, 33, 88, 66,  0,  0, 33,  8,  2, 16,172,  0,  8,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  1,192,  0,  0,  0, 88, 66, 21,132, 33,  8, 66, 16,128, 33,  8,  2, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,132, 33,  8, 66, 16,132, 33,  8, 64,  5,133,107, 88, 66, 16,129,107, 88, 22,181,
-   172,  0,  0,  0,  0, 45, 96,  8, 66,  0,  4,  0,  8, 86,176,  0, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,
-    10,194, 16,132, 33,  8, 66, 16,128, 33,  8,  2, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,132, 33,  8, 66,
-    16,  4, 33,  8, 64,  5,132, 33,  8, 66, 16,128, 33,  8,  2, 21,172,  0,  0,  0,  0,  4, 32,  0,  0,  0,  4, 32,  8, 86,176,  0,
-    33,  8, 66, 16,132, 33,  0, 66, 16,  0,  0,  0,  0,  0,  0,  0, 90,194, 16,132, 33,  8, 66, 16,128, 33,  8,  2, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,181,132, 33, 10,214,181,128, 33,  8,  2, 16,
-   172, 33,  0,  0,  0,132, 33,  8, 66, 16,132, 33,  8, 86,176,  0, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     2,194, 16,  4, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  0,  2, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 64,
-    16,132, 33,  8, 66, 16,  4,  0,  8, 66, 16,132, 32,  0, 22,  0,  0,  1,  8, 86,181,129, 96,  8, 66, 16,132, 33,  0,  0,  0,  0,
-    33,  8, 66, 16,132, 33,  0,  2, 16,128,  0,  0,  0,  0,  0,  0,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 10,194, 21,173,107, 90,214,  0,  0,  7,  8, 66, 16,132, 43, 90,214,181,
-   173, 97,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0, 66,  0,128, 33,  8, 66,  0,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  4,  1,  8, 66, 16,132, 33, 10,194,
-    21,173,107, 90,214,181,132,  0,  8, 66, 16,128, 32, 90,214,181,173, 96,  8, 66, 16,132, 33,  8, 64,  0,132, 33,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 90,
-   194, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,172, 43, 10,192,  0,  0, 33,  8, 66, 16,132, 33,  0, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,  0,  2,214,181,173,107, 90,214,181,173, 97,
-    90,214,181,133,107,  8, 66, 16,173,107, 90,214,181,173,107,  2,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,128, 33,  8, 66, 16,133, 97,  8, 66, 16,128, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,173,107, 88, 86,181,173,107, 10,214, 16,173, 97,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33, 90,194, 16,133,107, 88, 66, 16,132, 33,  8, 66, 16,132, 33, 10,214,181,132, 33,  8, 66, 16,132, 33,
-     8, 86, 16,173, 97,  8, 66, 16,172, 33,  8, 66, 16,132, 33,  8, 66, 16,172, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  1,  0,  0,  0,  4,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,
-   132,  0,  8, 66, 16,132, 32,  8,  2, 16,132,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8,  2, 16,132,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  2,
-    16,132,  0,  8, 66, 16,132, 32,  8,  2, 16,132,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,132,  0,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66,  0, 45,107,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  8, 66, 16,132,  0,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-    48, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 86,181,132,  0,  0,
-     0,  0,  0,  1,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 86,176,132, 32,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 86,176,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,128, 33,  8, 22,176,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    21,172, 43, 90,214,181,172, 33,  8, 66, 16,133, 97, 10,214,181,173,107, 90,214,176,132, 33,  8, 66,112,172,  0,  8, 66, 16,132,
-    33,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,181,172,107,  8, 66, 16,132, 33,  8,
-    64,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,
-     8, 66, 16,173, 97,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 10,194,  0,  0,  0,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 32, 90,214, 16,132, 43, 88, 66, 16,  0,  0,  8, 86, 16,132, 33, 10,214,176,  0,  0,  0,  0,  0,  0, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  8, 66, 16,128,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 43, 88,
-    66,176,  0, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,133, 97, 90,214,181,173, 96, 88, 86, 16,173,107, 90,214,181,132, 33,  8, 66,181,173,107, 90,214,181,128, 11,
-     8, 66, 16,132, 33,  8, 64,  0,  0,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132,  0, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,176,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 21,133,107, 90,214, 21,132, 33,  8, 86, 16,132, 33,  8, 66, 16,
-   128,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,181,173,107, 90,214,176,132, 33,  8, 66, 16,132, 32,
-    90,194, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 86,181,172, 33, 90,194,181,172, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,133,
-    97, 90,194, 16,172, 43, 90,194, 16,  0,  0,  0,  0,  0,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 21,173,107, 90,214,176,133,107,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 64,  0,
-     4, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66,  0,  4, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0, 90,214, 21,173,107, 90,214,181,173,107, 88, 86,181,173,
-   107, 88, 66, 16,172, 33,  8, 66, 21,132, 33, 90,194,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  8, 66, 16,132,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  8, 66, 16,132,  0,  8, 66, 16,132, 33,  0, 64, 16,  4,  1,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128, 33,  8, 66, 16,128, 32,  0,  2, 16,128, 33,  8, 66, 16,
-   128,  0,  8, 66, 16,  0, 33,  8, 66, 16,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,128,  0,  0,  2, 16,128, 33,  8, 66, 16,128,  0,
-    49,140, 99, 24,198, 49,140, 49,140, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 92,248, 70, 73, 57,206,
-   115,128,  0,  0,  0,  0,  0,  0,  0,  0,  4,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6, 24,198, 49,130,
-   116,173,134, 49,140, 99, 80, 64,  5, 41, 74, 82,144,128,  0,  1, 82,148,165, 41, 74, 82,144,128,  0,  0,  8, 66, 16,132, 33,  8,
-    66, 16,128,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 56,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  2,  0,  0,  1,  0,  2, 16,132, 33,  8, 66, 16,  4,  0,  0, 66, 16,132,  0,  0,  0,  0,128, 32,  8,  2, 16,132,225,  8, 66,
-    16,132, 33,  8, 64,  0,132, 33,  0,  0,  0,  4, 33,  8, 64,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,160,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,
-     0,  0,  0, 16,132, 43, 90,194, 16,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132,  1,  0,  0,  0,  4,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  1,  8,  0,  0,  0,  0,  0,  0,  0,  0, 11,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  0,  0,  0,  0,  0,  8, 66, 16,132, 32,  8, 66, 16,132, 32,  8, 66,
-    16,132, 32,  8, 66, 16,132, 32,  8, 66, 16,132, 32,  8, 66, 16,132, 32,  8, 66, 16,132, 32,  8, 66, 16,132, 32, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 48,  0,  0,  4, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0, 66, 16,132, 33,  8, 86,181,172, 33,  0, 66, 16,132,  0,  8, 66, 16,128,  0,  0, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  2,214,  0,  4, 33,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,132, 33,  0,  0,  0,  4, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 32,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,128,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  1,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  0,  0, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,  0,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 43, 90,214,  5,173,107, 90,214,181,172,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,133,107,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33, 90,194, 16,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  2, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  8, 64, 16,  4, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  2, 16,132, 33,  8, 66, 16,132, 33,  8, 86, 16,133, 97,  8, 66,176,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,173, 97,  0,  0,  5,128,  0,  8, 66, 16,132, 33, 57,192,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 21,172,  0,  0,  0,  0,  0, 33,  8, 66, 16,132, 33,  8, 64,  0,  0,  0, 90,214,181,173,
-   107, 90,214,181,173,107, 90,194, 16,132, 33,  8, 66, 16,132, 43,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,133,107, 90,214,181,172, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 43, 90,214,181,
-   173,107, 90,194, 16,  0,  0,  0,  0,  0,  0,  1,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,  0,
-    90,214, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-   176,133,107, 90,194, 21,172, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  1,  8, 66, 16,132, 33,  8, 64,  0,  0, 33,  8, 66, 16,172,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33, 10,214,181,173, 97, 10,214, 16,173, 96,  0,  0,  0,  0,  0,  8, 66,176,132, 33,  8, 66, 21,
-   132,  0,  8, 66, 16,132, 33,  8, 64,  0,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 21,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 88, 86,
-   181,132, 43, 88, 66, 16,133,107, 10,194,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 21,172, 33,  8, 66, 16,133, 96,  0,  0,  0,  0,  0,  0, 66, 16,132, 32,  0, 66, 16,132, 32,  0, 66, 16,132, 32,  0,
-     0,  0,  0,  0,  8, 66, 16,132, 32,  8, 66, 16,132, 32,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,172,
-    33, 88, 66, 16,172,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  0,  0, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 32,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  0,  0,  0,  9, 98, 16,132, 33,  8, 66, 18,  4, 33,  8, 66, 16,132,
-    33,  8, 64, 16,132, 33,  0, 64, 16,128, 33,  0, 66, 16,132, 33,  8, 66,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,180,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,  0, 26,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,107, 90,214,181,173,107, 90,214,128,  0, 90,214,181,173,107, 90,214,181,173,107,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 72, 18,  0, 36,  0,  0,  0,  0,  0,  7,  0, 16,128,  0,  0,  1,206,  0,  0,  0,107, 90,214,129,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,128,  3,  0,  0,115,156,  0,  0,  0,132,161, 41, 82,148,165, 41, 74, 82,
-   146,  0,  0,  0,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 32,  0,  2, 16,132, 33,  0,  2, 16,132, 33,  0,  2, 16,132, 33,  0,  2, 16,128,  0, 57,192,  0, 28,
-   224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,  4, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 32,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,132,  1,  8, 66, 16,132, 33,  8, 66, 16,
-   132,  0,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  8,  2,  0,  0,  1,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  1,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  4, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,172,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,128,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,160,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  0,  0,  0,  4, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,133,107, 90,214,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132,  1,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  8, 66, 16,
-   132, 33,  8, 66, 16,132,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  0,  0,  0,  0,  1,  8, 66, 16,132, 33,  8, 66,  0,132, 33,
-     8, 66, 16,132, 33,  8, 66,  0,132, 33,  8, 66,  0,132,  1,  8, 66, 16,132, 33,  8, 64, 16,132, 33,  8, 66, 16,132, 33,  8, 64,
-    16,132, 33,  8, 64, 16,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132,  1,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  2,
-    16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  8,  0, 16,  4, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,  0,  1,  0,  2, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8,  2, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  2, 16,132, 33,  8, 66,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132,  1,  8,  0,  0,  0, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 32,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66,  0,  0,  1,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  4, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 18,214,176, 45, 96,  0,  0,  5,173,107, 16,132, 32,  8, 66,  0,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0, 90,214,  0,  0, 11, 16,132, 33,  8, 66, 16,  0,  0,
-     0,  0, 16,132, 33,  8, 66, 16,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 45,
-    96,  0,  0, 33,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  0,  0, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,  0,  0,  0,  0,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,132, 33,  8, 66,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-     0,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132,  0,  0,  0,  0,  4, 33,  8, 66,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,213,173,107,  0,  0,  0,  0,  0, 99, 24,198, 49,140, 99,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99, 24,198, 49,
-   140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,128, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,181,136,  0, 16,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,107,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,107, 90,214,181,173,107, 91, 90,214,181,173,107, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,150,181,172, 66, 16,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,
-    10,194, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33, 90,214,181,173,107, 90,214,181,173, 97,  8, 66, 16,132,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    33,  8, 66, 16,132, 33, 88, 66,181,132,  0,  0,  0,  0,  0, 11, 90,194, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,181,173, 97, 10,214, 16,132, 33,  8, 86,  0,  0,  0,  0,  0,  0,
-     4,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,
-    90,214, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 43, 90,214,176,173,107, 90,214,
-   181,128, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66,176,132, 32,  0,  0,  0,  0,  0, 90,194, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,133,107, 90,214,181,173, 97,  8, 66, 16,132, 33, 10,214,181,
-   132, 43,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 64, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 43, 90,194,
-    21,133,107,  8, 66, 16,133, 97, 10,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 32,  8,  2, 16,132,  1,  8, 66, 16,132, 33,  8,
-    66, 16,132,  1,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 43,  8, 66,181,173,107, 90,214,  0,  0,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,
-    90,194, 16,  4, 33,  8, 66, 16,128,  1,  8,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,132, 33,  8,  2,
-    16,  4, 33,  8, 64,181,132, 33, 88, 66, 16,128,  1,  8,  0, 16,132,  0,  8,  0,  0,  0,  1,  0,  0,  0,  4, 33,  8, 66, 16,  1,
-   107, 90,214,181,128,  0, 90,214,181,128,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 90,214,181,173,107,  8, 86,181,133, 97,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,  5, 97,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-   181,173,107, 88, 86, 16,132, 43, 88, 86,176,132, 33,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 86,181,172,  0,  8, 66, 21,172, 43, 88, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 21,172,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-   181,173,107, 90,214, 16,172, 43, 88, 66, 16,128,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,176,172, 33, 90,214,181,172, 43,  8, 64,  0,  0,  0,  8, 66, 16,132, 33,  8, 64,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0, 45,107,  8, 86,181,172, 43, 90,214,176,  0,  0,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 43, 90,214,181,173,107, 10,214, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,  1,  8, 66, 16,132, 32,  0, 64,  0,132, 33,  8, 66, 16,  4, 32,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  1,  8,  0,181,133, 97,  8, 66,176,132, 32,  0,  0,  0,
-     0,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  0,  2, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 21,173,107,  0, 22,176,132, 33, 88, 66, 16,128,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,214,181,173, 97, 10,214, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,181,173,107, 88, 66,181,173, 97,  8, 66, 16,132, 43,  0,  0,  0,
-     0,  0, 10,214,181,173, 97, 10,214,176,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 86,181,173,107, 90,214,181,173, 97, 90,194, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8,  2, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 90,214,
-   181,173, 96, 90,214,181,172, 33,  8, 66, 16,132,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,128,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0, 22,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107,  0, 86,181,173,107, 88, 86,176,173, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 32,  8, 64, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 10,214,
-   181,173, 96,  0, 22,  5,172, 11, 90,214,181,172, 43,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  8, 66, 16,132,
-     1,  8,  2, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32, 90,192, 16,172, 43,  8,
-     0,  0,  0,  0,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66,181,132, 33,  8,  0,  0,  0,  0, 90,194, 16,132, 33,  8, 66, 16,132, 33,  8,  2, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,133,107, 90,214,  0,  0, 33, 88, 86, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,  0,  0,  0,  0, 28,231, 56,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 32,  8, 66, 16,128,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 88, 66, 16,132, 43, 90,214,181,
-   173,107, 90,214,181,172,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  8, 66, 16,132, 33,  8, 64,  0,  0, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 32,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132,  0, 90,214,181,132,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33, 90,214,181,173, 97,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  0,  0,  0,
-     0,  0,  8, 66, 16,132, 33,  8, 64, 16,132, 33,  8, 64, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  4, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,
-     0, 11,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  0,  0,  0,  0, 11, 90,214, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 64, 21,128,
-     0,  0,  0,  0,  0,  0,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,  4, 33,  8, 66, 16,  4, 32,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,132,
-    33,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,128,  0,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,  8, 66, 16,132, 33,  8,
-    64,  0,173, 97, 24,198, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173, 96,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  0, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    43, 90,194, 16,132, 33,  8, 66, 49,140, 99, 24,198,181,173,107, 90,214, 16,173,107, 90,214,176,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 86,181,172, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0, 22,181,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,128, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128, 33,  0,  2,  0,  4, 32,  0, 66, 16,128, 33,  8, 66,
-    16,132, 33,  8, 64, 16,  4, 33,  8, 66, 16,  4, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  1,  8, 66,  0,  4, 33,  8, 66, 16,128, 33,  8,
-    66, 16,128, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 64, 16,132, 32,  8, 66, 16,128, 32,  0,  2, 16,
-   132, 33,  8,  2, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 32,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8,  2, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,132, 33,  8, 66, 16,  1, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41,
-    74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 97,  8, 66,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,132, 33,  8, 66, 16,172, 33,  8, 66, 16,132, 33,
-     8, 66, 21,132, 33,  8, 66, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,181,173,107,  2,214,181,173,107, 90,214,181,173,107,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 32,  0,  0,  0,  4, 33,  8, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173, 96, 90,214,181,173,107, 90,214,181,173,107, 88,  0,181,173,107, 90,192,181,129,107, 90,214,  0,  0,  0,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,  0, 90,214,
-   181,173, 97,  8, 66, 16,132,  0,  8, 66, 16,132, 33,  8, 64,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,133, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 21,173,107,  8, 66, 16,132, 33,  8, 64,  0,  0,  7,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 21,173,107,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 32,  8, 66, 16,  4, 32,  8, 66, 16,132, 33,  8, 66, 16,132, 32,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  2, 16,132, 33,
-     8, 66, 90,214,181,173, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 37,173,107, 90,214, 32,  0,  0, 16,132, 33,  8, 66, 16,128,  0,  0, 66,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,180,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   107, 90,208, 53,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,  3, 90,  6,128, 13,  3, 90,214,181,173,107, 90,
-     6,181,173,  3, 64,208,  0,  0,  0, 26,  0,  0, 13,  3, 64,208, 53,173,  3, 90,  6,128, 13,  3, 64,208, 52, 13,  3, 90,  6,128,
-    13,107, 90,  6,181,173,107, 90,  6,181,173,  3, 90,214,129,160,107, 90,214,181,173,107, 64,214,181,173,107, 90,214,181,173,107,
-    90,208,  0,  0,  3, 90,208, 53,173,107, 64,214,181,173,107, 90,214,181,173,107, 90,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    82,148,165, 41, 74, 82,148,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 64,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,  0,  0,  8, 66, 16,132, 33,  8,  0,  0,  0,  0,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 82,148,165, 41, 74, 82,128,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198,
-    49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140,
-    99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-
-} // namespace detail
 
 /** Bidirectional class
  * Unicode Standard Annex #9: https://unicode.org/reports/tr9/
@@ -963,30 +122,5 @@ enum class unicode_bidi_class : uint8_t {
     }
 }
 
-[[nodiscard]] constexpr unicode_bidi_class ucd_get_bidi_class(char32_t code_point) noexcept
-{
-    constexpr auto max_code_point_hi = detail::ucd_bidi_classes_indices_size - 1;
-
-    auto code_point_hi = code_point / detail::ucd_bidi_classes_chunk_size;
-    auto const code_point_lo = code_point % detail::ucd_bidi_classes_chunk_size;
-
-    if (code_point_hi > max_code_point_hi) {
-        code_point_hi = max_code_point_hi;
-    }
-
-    auto const chunk_index = load_bits_be<detail::ucd_bidi_classes_index_width>(
-        detail::ucd_bidi_classes_indices_bytes,
-        code_point_hi * detail::ucd_bidi_classes_index_width);
-
-    // Add back in the lower-bits of the code-point.
-    auto const index = (chunk_index * detail::ucd_bidi_classes_chunk_size) + code_point_lo;
-
-    // Get the canonical combining class from the table.
-    auto const value = load_bits_be<detail::ucd_bidi_class_width>(
-        detail::ucd_bidi_classes_bytes, index * detail::ucd_bidi_class_width);
-
-    return static_cast<unicode_bidi_class>(value);
-}
-
 }} // namespace hi::v1
 
@@ -13,277 +13,6 @@ hi_export_module(hikogui.unicode.ucd_east_asian_widths);
 
 hi_export namespace hi {
 inline namespace v1 {
-namespace detail {
-
-constexpr auto ucd_east_asian_widths_chunk_size = 256_uz;
-constexpr auto ucd_east_asian_widths_index_width = 6_uz;
-constexpr auto ucd_east_asian_widths_indices_size = 4352_uz;
-constexpr auto ucd_east_asian_width_width = 3_uz;
-
-static_assert(std::has_single_bit(ucd_east_asian_widths_chunk_size));
-
-constexpr uint8_t ucd_east_asian_widths_indices_bytes[3280] = {
-     0, 16,131, 16, 81, 69, 20, 81, 69, 20, 81, 69, 20, 97, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 28,130, 74, 44,195, 78, 20,241,
-    80, 20, 84, 82, 77, 69, 86, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,117,150, 89,101,150, 89,
-   101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150,
-    89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 96, 81, 69, 21,145,
-    69, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,
-   101,154, 20, 81, 69, 20, 81, 69,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,101,133, 20, 87, 29,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 94, 89,101,150, 89,101,150, 89,101,150, 89,101,150,
-    89,101,150, 89,101,159, 89,101,150,130, 17, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 98, 90, 57,  5, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,150,105,232,166,170,236, 22,219,133, 20, 81, 69,
-    89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,
-   150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,
-   101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150,
-    89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,
-   150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,
-   101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,175,
-    89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,
-   150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,
-   101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150,
-    89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,
-   150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,
-   101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,175,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    23,  1, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-    69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20,
-    81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,241,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,241,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-constexpr uint8_t ucd_east_asian_widths_bytes[4816] = {
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,148, 74, 65,
-     2,145, 73, 36, 18, 73,  4,146,  0,  0, 16,  0,  0,  0, 64,  0,  2, 64,  0, 18, 72,  0, 16, 73,  4,128, 65, 32,  2, 73,  4, 16,
-     8,  0,  0,  0,  0,  0,  8, 32,  0,  0, 32,  0,  0,  0, 18,  0, 32,  0,  9, 32,  0, 64,  0,  2, 73,  4,  0, 73, 32,128,  1, 32,
-     0,  0,  0,  0,  0,  0, 18,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16, 65,  4, 16, 65,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
-     0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  2,  9, 32,128, 64,  0,  0, 73, 32,130,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9, 36,146, 73, 36,146, 72, 36,146, 72,
-     0,  0,  9, 36,146, 73, 36,146, 72, 36,146, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     8,  0,  0,  0,  0,  0, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,  8,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0, 64, 36,144, 72,  4,128, 73,  4,146,  0,  0,  0, 65, 32,128,  0, 32, 16,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  2,  9, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,
-     4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0, 32,128,  8,  0,  0,  0, 32, 16,  0,  0,  0,  9,  0, 16,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,
-     0,  0, 36,144, 73, 36,146, 73, 32,  0, 73, 36,146, 72,  0,  0,  0,  0,  0,  8,  0,  0, 73, 36,146, 72,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,  0,  1,  4,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    65, 32,  2, 64, 32,  2,  8,  0,128,  1,  0,146, 64, 32,130, 73, 36, 16,  0,  4,146,  0,  4,128,  0,  0,  0, 64,  4,  0,  1,  0,
-     0,  0,  0,  0, 72,  4,146,  1, 32, 18,  0,  0,  0,  0,  0,  0,  1, 32, 18,  0,  0,  0,  0,  0,128,  8,  0,  0,  0,  0,128,  0,
-     0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  1,  0,  0,  1,176,  0,  0,  0,  0, 13,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,182,  0, 96, 48,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 72, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 32,  0, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 32,  0,  0,  0,  0, 73, 36,146, 73, 36,146,  1, 36,128,  0,  0,  0, 72, 36,146, 72,
-     0,  0,  1, 32, 18,  0,  4,128, 72,  0, 18, 64, 32, 18, 72,  0,  0,  0,  0,  0,  1, 36,128,  0,  0,  2,  0,  0,  0,  0,  0,216,
-     0,  0,144,  8,  0, 18,  0,  6,192,  0,  4, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,109,182,219,109,176,
-     0,  0,  0,  0, 72, 36,130, 73,  4,130,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0, 18, 12,  0,  0,  1,
-   176,  0,  0,  0,  0,  0,  0,218,  0,  6,210, 73, 36,154, 73, 38,146, 73, 36,146, 72, 32,  0, 73,164,146, 73,180,210, 73,164,210,
-     0,  0,192,  1,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,  0,  6, 24,  0, 54,
-   195,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18, 73, 36,146,  0,  0,  0,  0,  0,  0,  0,  0,219,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 96,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9, 36,146, 64,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 96,  0,
-   210, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,182,219,109,182,219,109,182,219,108, 54,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,176,  0,  0,  0,  0,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,182,219,109,176,  0,
-   173,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,216, 13,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,216, 13,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,
-     0,  0,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219, 13,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,216,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,176,  0,  0,  0,  0,109,182,219,109,182,219,
-   109,182,219,109,182,219,109,182,219,109,182,216,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219, 73, 36,146,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,  0,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,216,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,109,182,219,109,182,219,109,182,219,109,182,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,176,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146,109,182,219,108,  0,  0,  0,  0,  0,  0,  0,  0,109,182,219,109,182,219,109,182,219,109,182,219,109,134,
-   219,109,182,219,109,182,216,109,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    22,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,
-   109,182,219,109,178, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 32,  2, 73, 36,  2, 73, 36,  2, 73, 36,  2, 72,  0,182,219,104,146, 73, 32,  0,  0,  0,  0,  0,128,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,182,  0,  0,  0,  0,108,  0,  0,  0,  0,  0,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,  0,  0,  0,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   109,182,219, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,176,219,109,176,216,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,128,  0,  0,  0,  0,  1,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,128,
-   192,  0,  0,  0,  0,  6,219,  0,  0,  0,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,176,  0,
-     0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    73, 36,146, 73,  0,  0, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,128, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 72,  0,  0, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,154, 77,182,219,109,164,146, 73, 36,146, 73,
-    36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   109,128,  0,  0,  0,  0,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,176,  0,109,182,219, 96,  0,  0,108,  0,
-     0,  0,  0,  0,109,182,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   109,182,219,109,182,219,109,182,219,109,182,219, 96,  0,  0,  0,  0,219,109,182,195,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182, 27,109,182,219,109,182,219,109,176,  0,  0,  0,  0,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,128,  3,109,176,  0,  0,  0,  0,109,182,219,109,182,219, 96,  6,  0,109,182,219,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,216, 97,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,  3,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,192,  0,  0,  0,  0, 54,216,109,182,
-   219,109,182,219,109,182,219,  0,  0,  0,  0,  0,  0,  1,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0,  0,  6,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,219,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,192,  0,  6,  0,109,128,219,  0,  6,219,  0,  0,  0,  0, 54,  0,  0,  6,219,109,182,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,182,219,109,176,  0, 96,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  6,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,134,219,109,182,195,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,182,219,109,182,  0,109,182,219, 96,  0,  0,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,195,109,182,192,  0,  0, 27,109,182,219,109,176,  0,109,182,219, 96,  0,  0,109,182,219, 96,  0,  0,
-   109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,192,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,  0,  0,  0,  0,  0,  0,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,128,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-
-} // namespace detail
 
 enum class unicode_east_asian_width : uint8_t {
     N = 0,
@@ -294,31 +23,5 @@ enum class unicode_east_asian_width : uint8_t {
     F = 5,
 };
 
-
-[[nodiscard]] constexpr unicode_east_asian_width ucd_get_east_asian_width(char32_t code_point) noexcept
-{
-    constexpr auto max_code_point_hi = detail::ucd_east_asian_widths_indices_size - 1;
-
-    auto code_point_hi = code_point / detail::ucd_east_asian_widths_chunk_size;
-    auto const code_point_lo = code_point % detail::ucd_east_asian_widths_chunk_size;
-
-    if (code_point_hi > max_code_point_hi) {
-        code_point_hi = max_code_point_hi;
-    }
-
-    auto const chunk_index = load_bits_be<detail::ucd_east_asian_widths_index_width>(
-        detail::ucd_east_asian_widths_indices_bytes,
-        code_point_hi * detail::ucd_east_asian_widths_index_width);
-
-    // Add back in the lower-bits of the code-point.
-    auto const index = (chunk_index * detail::ucd_east_asian_widths_chunk_size) + code_point_lo;
-
-    // Get the canonical combining class from the table.
-    auto const value = load_bits_be<detail::ucd_east_asian_width_width>(
-        detail::ucd_east_asian_widths_bytes, index * detail::ucd_east_asian_width_width);
-
-    return static_cast<unicode_east_asian_width>(value);
-}
-
 }} // namespace hi::v1
 
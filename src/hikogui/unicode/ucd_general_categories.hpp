@@ -18,932 +18,6 @@ hi_export_module(hikogui.unicode.ucd_general_categories);
 
 hi_export namespace hi {
 inline namespace v1 {
-namespace detail {
-
-constexpr auto ucd_general_categories_chunk_size = 128_uz;
-constexpr auto ucd_general_categories_index_width = 8_uz;
-constexpr auto ucd_general_categories_indices_size = 8704_uz;
-constexpr auto ucd_general_category_width = 5_uz;
-
-static_assert(std::has_single_bit(ucd_general_categories_chunk_size));
-
-constexpr uint8_t ucd_general_categories_indices_bytes[8720] = {
-     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-    32, 33, 34, 34, 35, 36, 37, 38, 39, 34, 34, 34, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
-    60, 61, 62, 63, 64, 64, 65, 66, 67, 68, 69, 70, 71, 69, 72, 73, 69, 69, 64, 74, 64, 64, 75, 76, 77, 78, 79, 80, 81, 82, 69, 83,
-    84, 85, 86, 87, 88, 89, 69, 69, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 90, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    91, 34, 34, 34, 34, 34, 34, 34, 34, 92, 34, 34, 93, 94, 95, 96, 97, 98, 99,100,101,102,103,104, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,105,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107, 34, 34,108,109,110,111, 34, 34,112,113,114,115,116,117,
-   118,119,120,121,122,123,124,125,126,127,128,129, 34, 34,130,131,132,133,134,135,136,137,138,139,140,141,142,122,143,144,145,146,
-   147,148,149,150,151,152,153,122,154,155,122,156,157,158,159,122,160,161,162,163,164,165,166,122,167,168,169,170,122,171,172,173,
-    34, 34, 34, 34, 34, 34, 34,174,175, 34,176,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,177,
-    34, 34, 34, 34, 34, 34, 34, 34,178,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122, 34, 34, 34, 34,179,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122, 34, 34, 34, 34,180,181,182,183,122,122,122,122,184,185,186,187,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,188, 34, 34, 34, 34, 34, 34, 34, 34, 34,189,190,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,191,
-    34, 34,192, 34, 34,193,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,194,195,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,196,197,
-    69,198,199,200,201,202,203,122,204,205,206,207,208,209,210,211, 69, 69, 69, 69,212,213,122,122,122,122,122,122,122,122,214,122,
-   215,216,217,122,122,218,122,122,122,219,122,122,122,122,122,220, 34,221,222,122,122,122,122,122,223,224,225,122,226,227,122,122,
-   228,229,230,231,232,122, 69,233, 69, 69, 69, 69, 69,234,235,236,237,238, 69, 69,239,240, 69,241,122,122,122,122,122,122,122,122,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,242, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,243, 34,244, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,245, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,246,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122, 34, 34, 34, 34,247,122,122,122,122,122,122,122,122,122,122,122,
-    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34,248, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
-    34, 34, 34, 34, 34, 34, 34,249,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   250,122,251,252,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,253,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,253,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-constexpr uint8_t ucd_general_categories_bytes[20336] = {
-     8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,237,107, 91,214,181,180,171,154,198,181,107, 90,
-   214,181,173,107,107, 92,231, 53,170, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 83,106,203, 16,193, 74, 82,148,
-   165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 75,108,203, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,237,111,123,223, 85,198,143, 76,139, 88,214, 94,252, 22,181,195,207, 55,189,245, 74, 82,148,165, 41, 74, 82,148,
-   165, 41, 74, 82,148,165, 57, 74, 82,148,165, 37, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,185, 41, 74, 82,148,165,
-    73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82,
-    84,149, 37, 42, 74,146,164,169, 42, 74,146,164,169, 41, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149,
-    37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 74, 74,146,164,165, 42, 82, 84,149, 41, 42, 82,146,149, 41, 74, 74,148,149, 41, 73,
-    74, 84,164,169, 73, 82, 84,149, 41, 42, 74, 84,149, 41, 42, 82,146,164,169, 73, 74,116,148,165, 57,206,116,160,169, 65, 82,130,
-   164,169, 42, 74,146,164,169, 42, 74,146,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 42, 80, 84,149, 41, 73, 82, 84,149, 37,
-    73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82,
-    82,148,165, 41, 82,146,165, 37, 42, 74,148,165, 37, 73, 82, 84,149, 37, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,
-   165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 83,148,165, 41,
-    74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,177,140, 96,198, 49,140, 99,
-    24,198, 49,177,140, 99, 24,198, 49,140, 99, 24, 49,140, 99, 99, 24,198, 49,131, 96,216,198, 49,140, 99, 24,198, 49,140, 99, 24,
-    99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,
-   198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,
-   140, 99, 24,198, 49,140, 73, 82, 83, 97, 37,  0, 12, 82,150,169,  0,  0, 12, 97, 53, 74, 82,  4,129, 41, 42, 82,148,165, 41, 74,
-    82,148,165, 41, 74, 64,148,165, 41, 74, 82,146,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,
-   148,169, 41, 82,148,148,165, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 41, 74, 84,151, 41, 42, 82, 82,165, 41,
-    74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 41, 74,
-    82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 73, 82, 84,149,
-    37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73,116,198, 49,140, 90,210, 84,149, 37, 73, 82, 84,149, 37, 73,
-    82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 74, 74,146,164,169, 42, 74,146,
-   164,165, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37,
-    73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37,  2, 82,
-   148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 32,  1,171, 90,214,181, 41, 74, 82,148,
-   165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 45, 98,  0,107, 87,  3, 24,198, 49,140, 99,
-    24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 50, 44,171, 25, 86, 50,172,  0,  0,  0,
-     0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,  0,  0,  7, 57,207, 90,128,  0,  0,  0,  0,  0,  0,
-    16,132, 33, 11, 57,205,107,122,215, 90, 99, 24,198, 49,140, 99, 25, 81, 86,181, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 49,206,115,156,231, 57,206,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140,107, 90,214,181,
-   173,107,107, 90,212,231, 97,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,122,157,140, 99, 24,198, 11, 76, 99, 24,198, 24,204,102,152,198, 48,231,107, 90,214,181,173,107, 78,115,235, 71,
-   173,107, 90,214,181,173,107, 90,212,  2, 59, 14,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 99, 24,
-   198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,  0, 28,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,157,140, 99, 24,198, 49,140, 97,192,  0,  0,  0,  0,  0,  0,  0,  0,107, 90,214,181,173,107, 78,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,198, 49,140, 99, 24,195, 27, 85,173, 76,  0, 50,247,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,157,140, 99, 12,198, 49,140, 99, 24,195, 49,140, 51, 24,198, 48,  0,173,107,
-    90,214,181,173,107, 90,214,160, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 59, 24,192,  2,160, 57,206,115,156,
-   231, 57,206,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,193,206,115,156,224, 16,128,  0,  0,  0, 99,
-    24,198, 49,140, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,152,198,
-    49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99,  4,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140,
-    99, 24,163,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,216,166, 29, 74, 83, 24,198, 49,140, 98,148,165, 49, 74, 59, 24,198, 49,140, 57,206,115,156,231, 57,216,202,213,
-   173,107, 90,214,181,173,169,142,115,156,231, 57,206,115,156,231, 59, 20,160, 28,231, 57,206,115,128,  7, 56,  0,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 56, 14,115,156,231, 56, 14,  0,  0,231, 57,192,  6, 29, 74, 83, 24,198,  0, 10, 80,  0,165,
-    48,224,  0,  0,  0,  0, 10,  0,  0,  3,156,  7, 57,216,192,  1,173,107, 90,214,181,173, 57,239,119,189,239,123,245,115,213,128,
-     3, 24,160, 28,231, 57,206,  0,  0,  7, 56,  0,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 56, 14,115,156,231, 56, 14,
-   112, 28,224, 57,192,  6,  1, 74, 83, 24,  0,  0, 12, 96,  0,198, 48,  0,  3,  0,  0,  0,  0,  1,206,115,128,224,  0,  0,  0,  1,
-   173,107, 90,214,181,173, 99, 14,115,178,160,  0,  0,  0,  0,  0,  3, 24,160, 28,231, 57,206,115,156,  7, 57,192,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 56, 14,115,156,231, 56, 14,112, 28,231, 57,192,  6, 29, 74, 83, 24,198, 48, 12, 98,128,165,
-    48,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,216,192,  1,173,107, 90,214,181,173,173,192,  0,  0,  0,  1,216,198, 49,140,
-     3, 20,160, 28,231, 57,206,115,128,  7, 56,  0,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 56, 14,115,156,231, 56, 14,
-   112, 28,231, 57,192,  6, 29, 76, 83, 24,198,  0, 10, 80,  0,165, 48,  0,  0,  0,  0, 49,138,  0,  0,  3,156,  7, 57,216,192,  1,
-   173,107, 90,214,181,173,209,222,247,189,239,  0,  0,  0,  0,  0,  0, 24,112, 28,231, 57,206,  0,  0,231, 56, 14,115,156,  0,  1,
-   206,  3,128,231,  0,  0,115,128,  0, 57,206,  0,  0,231, 57,206,115,156,231, 57,192,  0,  1, 74, 98,148,  0,  1, 74, 80, 20,165,
-    48,  0, 56,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  1,173,107, 90,214,181,173,123,223,173,107, 90,213,244,  0,  0,  0,
-    98,148,166, 28,231, 57,206,115,128,231, 56, 14,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 56, 14,115,156,231, 57,206,
-   115,156,231, 57,192,  6, 29,140, 98,148,165,  1,140, 96, 24,198, 48,  0,  0,  0,  0, 49,128, 57,206,  0, 28,  0, 57,216,192,  1,
-   173,107, 90,214,181,173,  0,  0,  0,  0, 21,123,222,247,189,250, 59, 20,170,156,231, 57,206,115,128,231, 56, 14,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 56, 14,115,156,231, 57,206,112, 28,231, 57,192,  6, 29, 76, 82,148,165,  1,138, 80, 20,166,
-    48,  0,  0,  0,  0, 41, 64,  0,  0,  0, 28,224, 57,216,192,  1,173,107, 90,214,181,173,  1,206,160,  0,  0,  0,  0,  0,  0,  0,
-    99, 20,163,156,231, 57,206,115,128,231, 56, 14,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,198, 29, 74, 83, 24,198,  1, 74, 80, 20,165, 48,250,  0,  0,  3,156,234,123,222,247,189,231, 57,216,192,  1,
-   173,107, 90,214,181,173,123,222,247,189,239,126,142,115,156,231,  3, 20,160, 28,231, 57,206,115,156,231, 57,206,115,156,224,  0,
-    14,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,192,115,156,231, 57,206,112, 28,  0, 57,206,115,156,224,  0, 24,  0,
-     0, 10, 82,152,198,  1,128, 82,148,165, 41, 74,  0,  0,  0,  1,173,107, 90,214,181,173,  0, 20,170,128,  0,  0,  0,  0,  0,  0,
-     1,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 59, 14,
-   118, 49,140, 99, 24,  0,  0, 23, 57,206,115,156,204, 99, 24,198, 49,149,107, 90,214,181,173,107,107, 80,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,206,  3,128,231, 57,206,  3,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,112, 28,  7, 57,206,115,156,231, 59, 14,118, 49,140, 99, 24,198, 28,  0, 57,206,115,128,192, 99, 24,198,
-    49,128,107, 90,214,181,173,107, 64,  3,156,231,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    62,181,170,214,181,173,107, 90,214,181,173,107,170,235, 90, 99, 53,173,107, 90,107, 90,214,181,173,107, 94,247,189,239,123,222,
-   253, 51, 76,211, 45, 43, 73, 74, 57,206,115,156,231,  1,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,128,  0,  3, 24,198, 49,140, 99, 24,198, 49,138, 99, 24,198, 85,140, 57,206,115,177,140, 99, 24,198, 49,140,  3,
-    24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198,  3, 90,214,181,173,105,154,214,181,173,
-     3, 90,173,107, 90,235, 90,213,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,165, 49,140, 98,152,
-   198, 49,140, 83, 24,165, 49,135,107, 90,214,181,173,107,107, 90,214,181, 57,206,115,157, 74, 99, 14,115,157,140, 97,212,165, 28,
-   234, 82,148,165, 40,231, 59, 24,198, 28,231, 57,206,115,156,231, 57,216,165, 49,138, 82,148,165, 48,234,107, 90,214,181,173,107,
-    84,165, 51, 90, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,164,  9,  0,  0,  0,
-    36,  0, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 75, 83, 20,165,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 56, 14,115,
-   156,  0, 57,206,115,156,224, 56, 14,115,156,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 56, 14,115,156,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 56, 14,
-   115,156,  0, 57,206,115,156,224, 56, 14,115,156,  0, 57,206,115,156,231, 57,206,115,156,224, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 56, 14,115,156,  0, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,  0, 49,140,173,107, 90,214,181,171,222,247,189,239,123,222,247,189,239,123,222,247,128,  0,
-    57,206,115,156,231, 57,206,115,156,231,214,181,173,107, 90,214,128,  0,  0,  0, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,
-   148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165,
-    41, 74, 82,148,165, 41, 74, 82,148,164,  0, 41, 74, 82,148,  0,137,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,234,167, 57,206,115,156,231, 57,206,115,156,231,233,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   207,105,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,207, 90,213,206,113,206,115,156,231, 56,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,216,198, 40,  0,  0,  0,  0,  0,  7, 57,206,115,156,231, 57,206,115,156,231, 57,216,
-   197, 86,160,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,216,192,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,
-   231, 57,206,115,128,231, 56, 24,192,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,118, 49, 76, 99, 24,198, 49, 74, 82,148,165, 41,138, 83, 24,198,
-    49,140, 99, 24,202,214,166,173,107,115,176,  0,107, 90,214,181,173,107, 64,  0,  0,  0,123,222,247,189,239,123,192,  0,  0,  0,
-   173,107, 90,214, 53,173,106,198, 48, 76,107, 90,214,181,173,107, 64,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206, 99,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 56,  0,  0,  0,  0, 57,206,115,177,135, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 59, 14,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,224, 99, 24,165, 41, 76, 98,148,160,  0,  0, 82,152,
-   165, 41, 74, 83, 24,192,  0,  0,208,  0, 10,213,173,107, 90,214,181,173, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,  0, 57,206,115,128,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,112,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,192,  0,
-     0,  0,107, 90,214,181,173,107, 94,  0,  3, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,236, 98,148,192,  2,181, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,169,138, 99, 24,198, 49,128, 98,152,165, 49,
-   140, 99, 24,198, 41, 74, 82,148,198, 49,140, 99, 24,198,  0, 12,107, 90,214,181,173,107, 64,  0,  0,  0,107, 90,214,181,173,107,
-    64,  0,  0,  0,173,107, 90,214,166,173,107, 90,212,  0, 99, 24,198, 49,140, 99, 24,198, 49,108, 99, 24,198, 49,140, 99, 24,198,
-    49,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    99, 24,197, 28,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   118, 41,140, 99, 24,166, 41, 74, 82,152,165, 28,231, 57,206,115,128,  0,107, 90,214,181,173,107,107, 90,214,181,174,181,173,107,
-    90,214,180,198, 49,140, 99, 24,205,107, 90,214,181,173, 86,160, 99, 20,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 58,152,198, 49, 74, 99, 20,198, 48,231,107, 90,214,181,173,107, 78,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,157,138, 99, 20,165, 49, 76, 99, 20,160,  0,  0,  0,  0, 10,214,181,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,117, 41, 74, 82,148,166, 49,140, 99, 24,
-   197, 41,140,  0,  1, 90,214,181,107, 90,214,181,173,107, 64,  0, 28,231,107, 90,214,181,173,107, 78,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 49,140, 99, 26,181, 41, 74, 82,148,165, 40,  0,  0,  0,  0, 74, 82,148,165, 41, 74,
-    82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,  0, 37, 41,173,107, 90,214,181,  0,  0,  0,
-     0,  0, 99, 25, 86, 49,140, 99, 24,198, 49,140, 98,152,198, 49,140, 97,206,115,176,231, 57,206,118, 28,234, 99, 14,  0,  0,  0,
-    41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 83, 24,198, 49,140,
-    99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,
-   198, 49,140, 82,148,165, 41, 74, 82,148,165, 49, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41,
-    74, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 99, 24,198, 49,140, 99, 24,198,
-    49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140,
-    73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82,
-    84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149,
-    37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,148,165, 41,
-    74, 82,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,
-   149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37,
-    41, 74, 82,148,165, 74, 82,148,165, 41, 41, 74, 82,148,  0, 74, 82,148,164,  0, 41, 74, 82,148,165, 74, 82,148,165, 41, 41, 74,
-    82,148,165, 74, 82,148,165, 41, 41, 74, 82,148,  0, 74, 82,148,164,  0, 41, 74, 82,148,165,  2, 64,144, 36,  9, 41, 74, 82,148,
-   165, 74, 82,148,165, 41, 41, 74, 82,148,165, 41, 74, 82,148,  0, 41, 74, 82,148,165, 66, 16,132, 33,  8, 41, 74, 82,148,165, 66,
-    16,132, 33,  8, 41, 74, 82,148,165, 66, 16,132, 33,  8, 41, 74, 82,128,165, 74, 82,148, 96,184,198, 10, 82,128,165, 74, 82,148,
-    99, 24, 41, 74, 80,  0,165, 74, 82,144, 99, 24, 41, 74, 82,148,165, 74, 82,148,227, 24,  0, 10, 82,128,165, 74, 82,148, 99,  0,
-   239,123,222,247,189,239,122, 33,  8, 66,140, 99, 24,198,181,164,237, 74, 78,212,173,107, 90,214,181,223,  4, 33,  8, 93,173,107,
-    90,214,181,173, 39, 90,214,176,133,107, 92,218, 85,173,107, 90,214,181,173,115, 88, 86,181,173,107, 90,214,189, 16,132, 33,  0,
-    66, 16,132, 33,  8, 66,121,128,  7,189,239,123,243,156,218, 70,123,222,247,189,239,123,243,156,218, 64, 49,140, 99, 24,198, 49,
-   140, 99,  0,  0,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,184,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 99, 24,198, 49,140, 99, 24,198, 45,107, 91, 22,181,177,140, 99, 24,198, 49,140, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   214,147,173,107, 73,214,138,148,164,165, 74, 82, 93, 39, 90,202, 82,148,167, 90,214,181,164,233, 58, 78,146,148,167, 69, 74, 82,
-   146,156,231, 57,117,162,149, 41,206,115,156,164,165, 41,117,157,104,186,123,222,247,189,239,123,222,247,189,239,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,146,185,206,115,245,160,  0,  0,206,115,156,235, 90,214,
-   179,157,107, 90,206,181,157,107, 58,214,181,173,107, 58,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 57,214,179,172,235, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,214,181,173,107, 90,180,173, 45,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,206,117,173,107, 90,213,165,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,235, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   157,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,231, 57,206,117,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,180,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,
-   123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,253,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,158,247,189,239,123,222,247,189,239,123,222,247,189,239,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 89,214,181,173,107, 90,214,117,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,206,115,156,231, 57,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 89,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,180,173, 43, 74,210,180,173, 43, 73,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,253,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,206,115,156,218, 89,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,230,210,180,173, 43, 74,210,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,150,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,180,173, 44,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,155, 75, 57,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,206,115,156,231, 57,206,115,156,231, 57,206,115,156,235, 89,206,115,156,
-   235, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,160,  3, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,104, 26,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,
-    82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,
-   148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 73, 82,148,148,169, 42, 74,146,165, 41, 73, 82, 82,164,165, 41, 74, 83, 25, 41,
-    73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82,
-    84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 82,235,
-    90,214,180,146,164,172, 99, 18, 80,  0,  0,  5,107, 90,190,181, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41,
-    74, 82,148,165, 41, 74, 82,148,  5,  0,  0,  0, 20,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  0,  0,  0,  0,  6,168,  0,  0,  0,  0,  0,  0,  0,  0, 12,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,224,  0,  0,  0,  0,  0, 57,206,115,156,224, 57,206,115,156,224, 57,206,
-   115,156,224, 57,206,115,156,224, 57,206,115,156,224, 57,206,115,156,224, 57,206,115,156,224, 57,206,115,156,224, 99, 24,198, 49,
-   140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140,173,105, 58, 78,181,173, 39, 90, 78,181,173,107, 90,214,177,173,
-    99, 90, 78,181,164,237, 43, 74,210,180,171, 90,214,166,173,107, 90,214,181,173, 99, 26,214,181,141,109, 90,214,181,173,107, 90,
-   214,181,214,171, 90,218, 86,149,165,105, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,129,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,160,  0,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,104,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,160,  0,  0,
-   237,107, 93, 24,238,180,173, 43, 74,210,180,181,171, 74,210,180,173, 40,218, 82,211,156,231, 57,206,115,152,198, 49, 74,137,140,
-    99, 27, 90,115,156, 99,215, 90,  1,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,224,  3,
-    25,140, 24,199,137,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,207, 83, 24,199,
-     0,  0,  0, 28,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  1,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,224,214,158,247,191, 90,214,
-   181,173,107, 90, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,160,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 64,123,222,247,189,239,123,245,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,123,222,247,189,239,211,222,247,189,239,123,222,247,189,239,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,123,222,247,189,239,123,245,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,211,222,247,189,239,123,222,247,189,239,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,152,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,128,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 64,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 49,140, 99, 26,181, 57,206,115,156,231, 57,206,115, 86,181, 57,206,115,156,231, 57,
-   206,115,156,231,107, 90,214,181,173,107, 78,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 73, 82, 84,149, 37, 73, 82, 84,
-   149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,148,236, 90,215, 86, 49,140, 99, 24,198, 50,166,
-    73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 83, 25,140, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,157,
-   206,115,156,231, 57,206, 99, 43, 90,214,181,  0,  0,  0,  0,  0,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99,  6, 49,
-   140, 99, 24,198,198, 18, 84,149, 37, 73, 82, 84,149, 37, 41, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,
-   149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 49, 74, 82,148,165, 42, 74,146,165, 37,
-    73, 82, 84,149, 37, 54, 48,146,164,167, 73, 82, 82,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82,148,165, 37, 74, 82,
-   148,149, 37, 73, 82, 84,149, 37, 73, 82, 84,165, 41, 42, 74,  0,  0,  0, 73, 64, 80, 21, 37, 73, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0, 12, 99, 36,167, 49,138,115,156,231, 57,216,115,157,135, 57,206,195,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,165, 49,138,214,181,166,  0,  0,123,222,247,191, 90,190,128,  0,  0,  0, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,122,214,181,  0,  0,  0,  0,  0,
-    82,142,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   117, 41, 74, 82,148,165, 41, 74, 82,148,166, 48,  0,  0,  0,  0,  2,181,107, 90,214,181,173,107, 64,  0,  0,  0, 99, 24,198, 49,
-   140, 99, 24,198, 49,140, 99, 14,115,156,231,173,106,122,156,236,107, 90,214,181,173,107, 78,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,157,140, 99, 24,198, 50,181, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,236, 99, 24,198,
-    49,140, 99, 20,160,  0,  0,  0,  0,  0,  0, 21, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,128,  0,
-    99, 24,163,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   197, 41,140, 99, 20,166, 49, 74, 85,107, 90,214,181,173,107, 90,212,  6,107, 90,214,181,173,107, 64,  0,  2,181, 57,206,115,176,
-   199, 57,206,115,156,231,107, 90,214,181,173,107, 78,115,156,224, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 59, 24,198, 49,138, 83, 24,165, 49,128,  0,  0,  0,  0,  0, 57,206,195,156,231, 57,206,118,
-    40,  0,107, 90,214,181,173,107, 64, 10,214,181, 57,206,115,156,231, 57,206,115,156,231, 49,206,115,156,250,214,142,166, 40,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 97,216,
-   198, 28,236, 97,206,115,157,140, 59, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,154,181, 57,206,115,156,
-   231, 57,206,166, 49, 74,173, 78, 99, 41,128,  0,  0,  0,  0,  0,  1,206,115,156,224,  1,206,115,156,224,  1,206,115,156,224,  0,
-     0,  0,  0,  0, 57,206,115,156,224, 57,206,115,156,224, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,
-   148,165, 41, 74, 82,148,165, 41, 75,131, 24,198, 41, 74, 82,148,165, 41,177,128,  0,  0, 41, 74, 82,148,165, 41, 74, 82,148,165,
-    41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,
-    82,148,165, 41, 74, 82,148,165, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,165, 49,
-    74, 98,149, 85, 48,  0,107, 90,214,181,173,107, 64,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,112,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,224,  0,  0,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,112,  0,  0,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,
-   132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,
-   198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,
-   140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    41, 74, 82,148,160,  0,  0,  0,  0,  0,  0,  0, 82,148,165,  0,  0,  0, 29,135, 57,206,115,156,231, 62, 78,115,156,231, 57,206,
-   115,156,224, 57,206,115,128,224, 57,192,115,128,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,241,140, 99, 24,198, 49,140, 99, 24,198, 48,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,158, 86,214,181,173,107, 90,214,181,173,107, 90, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  0, 14,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  0,  0,  0,
-     0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,123,235, 90,
-    99, 24,198, 49,140, 99, 24,198, 49,140,173,107, 90,214,182,149, 64,  0,  0,  0, 99, 24,198, 49,140, 99, 24,198, 49,140,172, 99,
-     8, 90, 86,149,165,105, 90, 86,149,165,105, 86,182,149,107, 90,194, 16,173,106, 10,214,181,141,165,105, 90, 85,173,115, 28,231,
-    32,173,235, 80,  0,  0, 57,206,115,128,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,128,  2,
-     5,107, 91,214,181,180,171,154,198,181,107, 90,214,181,173,107,107, 92,231, 53,170, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,
-   148,165, 41, 74, 83,106,203, 16,193, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 75,108,203, 54,149,109, 42,212,
-   231, 57,206,115,156,231, 49,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,198, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,224,  0, 14,115,156,231,  0, 14,115,
-   156,231,  0, 14,115,156,231,  0, 14,115,128,  0,189,243,141, 94,224,214,115,156,235, 64,  0,  0,  0,  0,  0,  0,132, 45,104,  0,
-    57,206,115,156,231, 57,206,112, 28,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,224, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,  3,156,  7, 57,206,115,156,231, 57,206,115,156,  0, 57,206,115,156,231, 57,206,115,156,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,  0,  0,  0,
-   173,106,  0,  0, 15,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,
-   240,  0, 26,214,181,173,107, 90,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 61,239,126,181,173,107, 90,214,181,173,107, 90,214,158,253,107, 64,214,181,173,107, 90,214,
-   181,173,  0,  0,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 48,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,128,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,240,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,123,222,240,  0,  0,  0,  0,  0, 28,231, 57,206,
-   115,156,231, 57,206,115,156,231, 59,142,115,156,231, 57,220,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,157,140, 99, 24,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156, 21, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,112,  0,  0, 57,206,115,
-   156,231,171,156,231, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 41, 74, 82,148,165, 41, 74,
-    82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,  0,107, 90,214,181,173,107, 64,  0,  0,  0, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,
-   165, 41, 74, 82,144,  0,  0, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 80,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  0,  0,  0,  0,  0, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,112,  0,
-     0,  0,  0,  0,  0, 21, 74, 82,148,165, 41, 74, 82,  4,165, 41, 74, 82,148,165, 41, 74, 82,  4,165, 41, 74, 82,  4,164,  5, 41,
-    74, 82,148,165, 41, 64, 82,148,165, 41, 74, 82,148,165, 41, 64, 82,148,165, 41, 64, 82,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,224,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,  0,  0,  0,  0,  0,  0, 57,206,115,156,
-   231,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,140, 99, 24,  6, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,
-   140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 48, 12, 99, 24,198, 49,140,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,  0, 56, 14,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,  7, 56,  0,  3,128,  7, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156, 21,123,222,247,189,239, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,250,211,222,247,189,239, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,224,  0,  0,  0,  0, 15,123,222,247,189,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,  3,156,  0,  0,  0,247,189,239,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,157,239,123,222,240,  0, 21, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,192,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  0,  0,  7,188,231,123,222,247,189,239,123,222,247,
-   189,239,  0, 30,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,
-    59, 24,192, 49,128,  0,  0,  6, 49,140, 57,206,112, 28,231,  1,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,  0, 99, 24,  0,  0, 12,123,222,247,189,239,120,  0,  0,  0,  0,173,107, 90,214,181,168,  0,  0,  0,  0, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,189,245, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,189,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231,209,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,177,128,  0,  0,247,189,239,173,107, 90,214,160,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,  0,  5,107, 90,214,181, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,  0,123,222,247,189,239, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,  0,  0,  0,123,222,247,189,239, 57,206,115,156,231, 57,206,115,156,231, 57,192,  0,  0,  0,  5,
-   107, 90,128,  0,  0,  0,  0,  0,  0,  3,222,247,189,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,
-    82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,  0,  0,  0,  0,  0,  0,  0,  0, 41, 74, 82,148,165, 41, 74, 82,
-   148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,  0,  0,  0,  0, 30,247,189,239,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,118, 49,140,  0,  0,  0,  0,  0,107, 90,
-   214,181,173,107, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,224,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,192,198, 68,  0, 57,192,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,140, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,189,239,123,222,247,189,231,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,157,140, 99, 24,198,
-    49,140, 99,222,247,214,181,173, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231,
-    57,216,198, 50,181,173, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,189,239,123,222,240,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,224,  0,  0,  0,  0,  0, 83, 20,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 99, 24,198, 49,140, 99, 24,198, 49,149,173,107, 90,
-   212,  0,  0, 30,247,189,239,123,222,247,189,239,123,222,247,189,173,107, 90,214,181,173, 97,206,198, 28,  0,  0,  0,  0,  0, 12,
-    99, 20,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 82,148,
-   198, 49,138, 83, 25, 90,138,181,173, 88,  0,  0,  0,  0,  0,  0,  8,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 56,  0,  0,  0,  0,107, 90,214,181,173,107, 64,  0,  0,  0, 99, 24,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,236, 99, 24,197, 49,140, 99, 24,198,  1,173,107, 90,214,181,173,173,107, 83,169, 71,  0,  0,  0,
-     0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,202,212,224,  0,  0,  0,  0,  0,
-    99, 20,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   165, 41,140, 99, 24,198, 49,138, 81,206,115,214,181,171, 24,198, 85, 76,107, 90,214,181,173,107, 79, 83,214,181,  3,222,247,189,
-   239,123,222,247,189,239,123,222,247,128,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,192,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,117, 41, 76, 99, 20,166, 41,140,173,107, 90,213,135, 59,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,224, 56, 14,115,156,  7, 57,206,115,156,231, 57,206,115,156,  7, 57,206,115,156,231, 61, 64,  0,  0,  0, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,236, 82,148,198, 49,
-   140, 99, 24,  0,  0,  0,107, 90,214,181,173,107, 64,  0,  0,  0, 99, 20,160, 28,231, 57,206,115,128,  7, 56,  0,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 56, 14,115,156,231, 56, 14,112, 28,231, 57,192,198, 29, 74, 98,148,165,  0, 10, 80,  0,165,
-    40,  0, 56,  0,  0,  0, 10,  0,  0,  0, 28,231, 57,212,160,  1,140, 99, 24,198,  0,  0, 99, 24,198,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,169, 74, 99, 24,198, 49,140, 82,152,198, 41,135, 57,207, 90,214,181,107, 90,214,181,173,107,107, 80, 85,135, 57,192,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 82,148,198, 49,140, 98,152,165, 41, 76, 98,152,195,158,167,  0,  0,  0,
-     0,  0,107, 90,214,181,173,107, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,234, 82,152,
-   198, 48,  0, 82,148,166, 49, 76,101,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181, 57,206,118, 48,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 82,148,198, 49,140, 99, 24,165, 49, 76,101,107, 83,128,  0,  0,  0,  0,
-     0,  0,107, 90,214,181,173,107, 64,  0,  0,  0,173,107, 90,214,181,173,107, 90,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,197, 49, 74, 99, 24,
-   198, 49, 76, 61, 64,  0,  0,  0,107, 90,214,181,173,107, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,  0, 49,140, 82,152,198, 49, 76, 99, 24,192,  0,  0,107, 90,214,181,173,107, 94,250,214,186, 57,206,115,156,224,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,117, 41, 76, 99, 24,
-   198, 49,140, 83, 25, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 41, 74, 82,148,165, 41, 74, 82,
-   148,165, 41, 74, 82,148,165, 41, 74, 82,148,165,107, 90,214,181,173,107, 94,247,189,239,123,222,  0,  0,  0,  0,  0,  0,  0,  7,
-    57,206,115,156,224,  1,192,  3,156,231, 57,206,112, 28,224, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 82,148,
-   165, 40, 10, 80,  0,198, 41,135, 81,212,202,214,160,  0,  0,  0,  0,  0,107, 90,214,181,173,107, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 57,206,115,156,231,  0, 14,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 58,148,166, 49,140,  0, 24,197, 41, 74, 97,234,117,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    59, 24,198, 49,140, 99, 24,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   198, 49,140, 98,142,198, 49,149,173,107, 90,214,172,  0,  0,  0,  0,  0, 59, 24,198, 49,138, 83, 24,195,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,216,198, 49,140, 99, 24,198, 49,138, 99,
-    43, 90,158,181,173,106,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 56,  0,  0,  0,  0,
-   173,107, 90,214,181,173, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 56, 14,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,234, 99, 24,198, 49,128, 99, 24,198, 49, 76, 61,107, 90,212,  0,  0,  0,  0,
-     0,  0,107, 90,214,181,173,107, 94,247,189,239,123,222,247,189,239,123,222,247,128,  0,173, 78,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,156,231,  0, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140,  2,152,198, 49,140, 98,152,
-   197, 49,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,224, 57,192,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 59, 24,198, 49,128,  0, 24,  6, 48, 12, 99, 24,198, 48,236,  0,  0,  0,
-     0,  0,107, 90,214,181,173,107, 64,  0,  0,  0, 57,206,115,156,  7, 56, 14,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,212,165, 41, 64, 99,  0,165, 49, 76, 56,  0,  0,  0,  0,107, 90,214,181,173,107, 64,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,198, 41, 85,168,  0,  0,  0,  0,
-    99, 14,163,156,231, 57,206,115,156,231, 56, 14,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   117, 41,140, 99, 24,  0,  1, 74, 98,153, 90,214,181,173,107, 90,214,181,107, 90,214,181,173,107, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,123,222,247,189,239,123,222,247,
-   189,239,123,222,247,235, 90,214,181,173, 94,247,190,181,173,107, 90,214,181,173,107, 90,214,128,  0,  0,  0,  0,  0,  0,  0, 21,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,192,173,107, 90,128,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 61,106,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 97,206,115,156,236, 99, 24,198, 49,140, 99, 24,198, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,224,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 56,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,224,107, 90,214,181,
-   173,107, 64,  0,  2,181, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,224,107, 90,214,181,173,107, 64,  0,
-     0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,  0, 99, 24,198, 84,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 99, 24,
-   198, 49,149,173,107, 93,107, 90, 49,140,106,232,  0,  0,  0,  0,  0,  0,107, 90,214,181,173,107, 64,247,189,239,123,192,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231,  0,  0,  0, 28,231, 57,206,115,156,231, 57,206,115,156,231,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 41, 74, 82,148,
-   165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165,123,222,247,189,239,123,222,247,189,239,123,222,247,189,245,173,
-   106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,  0,  0, 12, 58,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41,
-    74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,  0,  0,  0,  0, 12, 99, 24, 99, 24,198, 49,
-   140, 99, 24,198,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,170,102,  0,  0,  0,  0,  0,  0,  0, 82,128,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,140, 96, 24,198, 49,140, 96, 24,192,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  3,156,
-   231,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,112,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,  0,  0,  0, 57,206,115,156,231, 57,206,115,128,  0, 57,206,115,156,231, 56,  0,  0,  0,  0, 57,206,115,156,231, 57,
-   192, 13, 49,149, 16,132, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 48,  0, 99, 24,
-   198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,128,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,160,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,104,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 64,  6,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 41, 76, 99, 53,173, 41, 74, 82,148, 33,  8, 66, 16,132,198, 49,140,
-    99, 25,173, 49,140, 99, 24,205,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,152,198, 51, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,152,198,104,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,123,222,247,189,239,123,222,247,189,239,123,222,240,  0,  0,  0,  0,  0,  0,  0,123,222,247,189,
-   239,123,222,247,189,239,123,222,240,  0,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 64,  0,  0,  0,  0,  0,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,120,  0,  0,  0,  0,
-    74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,
-    84,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,164,165, 41, 74, 82,128,165, 41, 74, 82,148,165, 41, 74, 82,148,
-   165, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41,
-    74, 84,129, 41,  0, 18,  0, 37, 32,  2, 82,148,129, 41, 74, 82,148,164,165, 41, 64, 80, 20,165, 41, 74, 80, 20,165, 41, 74, 82,
-   148,165, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165,
-    41, 74, 84,164,  9, 74, 82,  0, 37, 41, 74, 82,148,129, 41, 74, 82,148,128,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,
-    82,148,165, 74, 64,148,165, 32, 74, 82,148,129, 32,  0, 18,148,165, 41, 72, 10, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,
-   165, 41, 74, 84,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,164,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41,
-    74, 82,148,165, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,
-   148,165, 41, 74, 84,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,164,165, 41, 74, 82,148,165, 41, 74, 82,148,165,
-    41, 74, 82,148,165, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,
-    82,148,165, 41, 74, 84,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,164,165, 41, 74, 82,148,165, 41, 74, 82,148,
-   165, 41, 74, 82,148,165, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 74, 82,148,165, 41, 74, 82,148,165, 41,
-    74, 82,148,165, 41, 74, 82,148,  0, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 78, 74, 82,148,165, 41, 74, 82,
-   148,165, 41, 74, 82,148,165, 41, 75,146,148,165, 41, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 83,146,148,165,
-    41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,228,165, 41, 74, 84,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,
-   148,228,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,185, 41, 74, 82,149, 41, 74, 82,148,165, 41, 74, 82,148,165,
-    41, 74, 82,148,165, 57, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 46, 74, 82,148,165, 74, 82,148,165, 41, 74,
-    82,148,165, 41, 74, 82,148,165, 41, 78, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 75,146,148,165, 41, 82, 80,
-     1,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-    99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,
-   198, 49,154,214,180,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,
-   140, 99, 24,198,107, 90,214,181,173, 51, 90,214,181,173,107, 90,214,181,166,107, 85,173,107, 80,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,198, 49,140,  3, 24,198, 49,140, 99, 24,198, 49,140,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    41, 74, 82,148,165, 41, 78, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,160,  0,  0,  0, 20,165, 41, 74,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99, 24,198, 49,128, 99, 24,198, 49,140, 99, 24,198, 49,140, 96,
-     0,198, 49,140, 99,  0,198,  1,140, 99, 24,  0,  0,  0, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99,
-    24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,128,  0, 99, 24,198, 49,134, 49,140, 99, 24,  0,107, 90,214,181,173,107, 64,  0,
-     0,250,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,157,128,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,118, 49,140,107, 90,214,181,173,107, 64,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,102, 49,140,107, 90,214,181,173,107, 64,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,
-   224, 57,206,112, 28,224, 57,206,115,156,231, 57,206,115,156,224, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,128, 15,123,222,247,
-   189,239, 99, 24,198, 49,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,
-    82,148,165, 41, 74, 82,148,165, 41, 74, 86, 49,140, 99, 24, 96,  0,  0,107, 90,214,181,173,107, 64,  0,  2,181,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,222,247,189,239,123,222,247,189,239,
-   123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,222,253, 61,239,187,222,
-   247,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,222,247,189,239,123,222,247,189,239,123,222,247,189,239,123,
-   222,247,189,239,123,222,247,189,239,123,222,247,191, 79,123,222,247,189,239,123,222,247,188,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,112, 28,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  1,206,  3,128,  7,  1,206,115,156,231, 57,206,
-     3,156,231,  1,192,112,  0,  0,  0, 14,  0,  0,  7,  1,192,112, 28,231,  1,206,  3,128,  7,  1,192,112, 28,  7,  1,206,  3,128,
-     7, 57,206,  3,156,231, 57,206,  3,156,231,  1,206,115,128,224, 57,206,115,156,231, 57,192,115,156,231, 57,206,115,156,231, 57,
-   206,112,  0,  0,  1,206,112, 28,231, 57,192,115,156,231, 57,206,115,156,231, 57,206,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,206, 64,  0,  0,  0,  0,  0,  0,  0,  0,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,160,  0,  0,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,160,  0,  0,  0,
-     0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 64,  6,181,173,107, 90,214,181,173,107, 90,  6,181,173,107, 90,214,181,173,
-   107, 90,  6,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,104,  0,  0,  0,  0,  0,  0,
-   123,222,247,189,239,123,222,247,235, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,104,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,180,  0,  0,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,160,  0,  0,214,181,173,107, 90,208,  0,  0,  0,  0,214,128,  0,  0,  0,  0,  0,  0,  0,  0,214,181,173,104,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,140, 99, 24,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,  0,  0, 13,107, 90,214,181,173,107,
-    90,214,181,173,  0,  0,214,181,173,107, 90,214,181,173,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 64,  0,  1,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,128,  0,  0,  0,214,181,173,107,
-    90,214,181,160,  0,  0,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,160,  0,  0,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,  0,  0,  0,
-     0,  0,214,181,173,107, 90,214,128,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,104,  0,214,128,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,160,  0,  0,  0,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,104,  0,214,181,173,107, 90,214,181,173,  0,  0,
-   214,181,173,107, 90,208,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,104, 26,214,181,173,104,  0,  0,  0,  0,  3, 90,214,181,173,107, 90,214,181,160,  0,  0,214,181,173,107,
-    90,208,  0,  0,  0,  0,214,181,173,107, 90,208,  0,  0,  0,  0,214,181,173,107, 90,214,181,173,107, 90,214,180, 13,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,180,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,107, 90,214,181,173,107, 64,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,192,  0,  0,  0, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,192,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 56,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,  0,  0,  0, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8,
-    66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99,
-    24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198,
-    49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140,
-    99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,
-   198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,
-   140, 99, 24,198, 49,140,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,
-   198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,
-   140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-
-} // namespace detail
 
 enum class unicode_general_category : uint8_t {
     Cn = 0,
@@ -1050,30 +124,5 @@ enum class unicode_general_category : uint8_t {
     return rhs_ >= 0x11'0000 or (rhs_ & 0xfffe) == 0xfffe or (rhs >= 0xfdd0 and rhs <= 0xfdef);
 }
 
-[[nodiscard]] constexpr unicode_general_category ucd_get_general_category(char32_t code_point) noexcept
-{
-    constexpr auto max_code_point_hi = detail::ucd_general_categories_indices_size - 1;
-
-    auto code_point_hi = code_point / detail::ucd_general_categories_chunk_size;
-    auto const code_point_lo = code_point % detail::ucd_general_categories_chunk_size;
-
-    if (code_point_hi > max_code_point_hi) {
-        code_point_hi = max_code_point_hi;
-    }
-
-    auto const chunk_index = load_bits_be<detail::ucd_general_categories_index_width>(
-        detail::ucd_general_categories_indices_bytes,
-        code_point_hi * detail::ucd_general_categories_index_width);
-
-    // Add back in the lower-bits of the code-point.
-    auto const index = (chunk_index * detail::ucd_general_categories_chunk_size) + code_point_lo;
-
-    // Get the canonical combining class from the table.
-    auto const value = load_bits_be<detail::ucd_general_category_width>(
-        detail::ucd_general_categories_bytes, index * detail::ucd_general_category_width);
-
-    return static_cast<unicode_general_category>(value);
-}
-
 }} // namespace hi::v1
 
@@ -18,990 +18,6 @@ hi_export_module(hikogui.unicode.ucd_line_break_classes);
 
 hi_export namespace hi {
 inline namespace v1 {
-namespace detail {
-
-constexpr auto ucd_line_break_classes_chunk_size = 128_uz;
-constexpr auto ucd_line_break_classes_index_width = 8_uz;
-constexpr auto ucd_line_break_classes_indices_size = 7173_uz;
-constexpr auto ucd_line_break_class_width = 6_uz;
-
-static_assert(std::has_single_bit(ucd_line_break_classes_chunk_size));
-
-constexpr uint8_t ucd_line_break_classes_indices_bytes[7189] = {
-     0,  1,  2,  2,  2,  3,  4,  5,  2,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
-    29, 30, 31, 32, 33, 34, 35, 36, 37,  2,  2,  2,  2, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,  2, 51,  2,  2, 52, 53,
-    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,  2,  2,  2, 70,  2,  2, 71, 72,  2, 73, 74, 75, 76, 77, 78, 79,
-    80, 81, 82, 83, 84, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 85, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    86, 78, 78, 78, 78, 78, 78, 78, 78, 87,  2,  2, 88, 89,  2, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,100,101,102,103,104,105, 99,
-   100,101,102,103,104,105, 99,100,101,102,103,104,105, 99,100,101,102,103,104,105, 99,100,101,102,103,104,105, 99,100,101,102,103,
-   104,105, 99,100,101,102,103,104,105, 99,100,101,102,103,104,105, 99,100,101,102,103,104,105, 99,100,101,102,103,104,105, 99,100,
-   101,102,103,104,105, 99,100,101,102,103,104,105, 99,100,101,106,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108, 78, 78, 78, 78,109,110,  2,  2,111,112,113,114,115,116,
-   117,118,119,120,108,121,122,123,  2,124,125,126,  2,  2,127,128,129,130,131,132,133,134,135,136,137,138,139,108,140,141,142,143,
-   144,145,146,147,148,149,150,108,151,152,108,153,154,155,156,108,157,158,159,160,161,162,163,108,164,165,166,167,108,168,169,170,
-     2,  2,  2,  2,  2,  2,  2,171,172,  2,173,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,174,
-     2,  2,  2,  2,175,176,177,  2,178,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,  2,  2,  2,179,180,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,  2,  2,  2,  2,181,182,183,184,108,108,108,108,185,186,187,188,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,189, 78, 78, 78, 78, 78, 78,  2,  2,  2,190,191,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,192,
-    78, 78,193, 78, 78,194,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,195,196,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,197,173,
-     2,198,199,200,201,202,203,108,204,205,206,  2,  2,207,  2,208,  2,  2,  2,  2,209,210,108,108,108,108,108,108,108,108,211,108,
-   212,213,214,108,108,215,108,108,108,216,108,108,108,108,108,217,  2,218,219,108,108,108,108,108,220,221,222,108,223,224,108,108,
-    78, 78,225,226, 78, 78, 78,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,  2,242, 78, 78, 78, 78, 78, 78, 78,243,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,243,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
-    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,243,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
-   244,108,245,246,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-constexpr uint8_t ucd_line_break_classes_bytes[23728] = {
-     4, 16, 65,  4, 16, 65,  4, 32,196, 16, 80, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65, 24,114,  9, 40,178, 72, 48,210,
-    74, 56,243,144, 69, 20, 81, 69, 20, 81, 69, 19,142, 36,146, 71, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 76, 40,210, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 76,  9, 34, 65,
-     4, 16, 65,  5, 48, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65, 80,194,202, 40,162, 85, 84,149,
-    72, 36, 34, 73, 44,165, 85, 88,149, 85, 85, 85, 72, 85, 85, 76, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 85, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 85, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 85, 89, 85, 85, 89, 82, 73, 84,146, 73, 36,
-   146, 73, 85, 85, 85, 37, 82, 86, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-     4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 84,  4, 16, 65,  4,
-    16, 65,  4, 16, 65, 81, 69, 20, 81, 69,  1,  4, 16, 65,  4, 16, 65,  4, 16, 65, 36,146, 73, 36,146, 73,  0,  2, 73, 36,147,137,
-     0,  0,  0, 36,146, 73, 36,146, 64, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  9, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 65,  4, 16, 65,  4, 18, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 64,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,224,128,  0,146, 74,  0, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16,129, 36, 16, 73,  4, 17,193,  0,  0,  0,  0,  0,  0, 93,117,215, 93,
-   117,215, 93,117,215, 93,117,215, 93,117,215, 93,117,215, 93,117,192,  0,  0, 23, 93,117,201, 36,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,178,203, 56,226, 73,  4, 16, 65,  4, 16, 65,  4, 16, 71,  4,113,199, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4, 16, 65,  4, 16, 65,  4,
-    16, 65,  4, 16, 65,  4, 16, 65, 69, 20, 81, 69, 20, 81, 69, 18,209, 68,146, 73,  4,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 28,
-   144, 65,  4, 16, 65,  4,146, 65,  4, 16, 65,  4,146, 65,  4,144, 65,  4, 18, 73, 69, 20, 81, 69, 20, 81, 69, 18, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,144,  9, 36, 18, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 64,  0,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  4, 16,
-    65,  4, 16, 65,  4,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 20, 81, 69, 20, 81, 69, 18, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4, 16, 65,  4, 16, 65, 36,146, 73, 56,114, 64,  0, 18,138,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  4, 18, 65,  4, 16, 65,  4, 16, 65, 36, 16, 65, 36, 16,
-    65,  4, 16,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36, 16, 65,  0,  2, 64, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64, 36,144,  0,  0,  0,  0,  4, 16, 65,  4, 16, 65, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  4, 16, 65,  4, 16, 65,  4,
-    16, 65,  4, 16, 65,  4, 16, 65,  4, 18, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,
-     4, 16, 65, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  4,144, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65, 36, 16, 65,  4,
-    16, 65, 36,146, 73, 36,146, 73, 36,144, 65,  8, 36, 81, 69, 20, 81, 69, 20, 81, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36, 16, 65,  0,146, 73, 36,146, 73, 36,  0,  9, 36,  0,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2,
-    73, 36,146, 73, 36,  2, 64,  0,  2, 73, 36,144,  0,  4,144, 65,  4, 16, 65,  4,  0,  1,  4,  0,  1,  4, 18, 64,  0,  0,  0,  0,
-     0,  1,  0,  0,  0, 36,144,  9, 36,144, 65,  0,  4, 81, 69, 20, 81, 69, 20, 81, 36,146,203, 36,146, 73, 36,178, 74, 36,144, 64,
-     0, 16, 65,  0,146, 73, 36,146, 64,  0,  0,  9, 36,  0,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2,
-    73, 36,146, 73, 36,  2, 73,  0,146, 64, 36,144,  0,  4,  0, 65,  4, 16, 64,  0,  0,  1,  4,  0,  1,  4, 16,  0,  0, 16,  0,  0,
-     0,  0,  0,146, 73, 36,  2, 64,  0,  0,  0,  0,  4, 81, 69, 20, 81, 69, 20, 81,  4, 18, 73, 36, 18, 64,  0,  0,  0,  0,  0,  0,
-     0, 16, 65,  0,146, 73, 36,146, 73, 36,144,  9, 36,144,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2,
-    73, 36,146, 73, 36,  2, 73,  0,146, 73, 36,144,  0,  4,144, 65,  4, 16, 65,  4, 16,  1,  4, 16,  1,  4, 16,  0, 36,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 36,144, 65,  0,  4, 81, 69, 20, 81, 69, 20, 81, 36,160,  0,  0,  0,  0,  0,144, 65,  4, 16, 65,
-     0, 16, 65,  0,146, 73, 36,146, 73, 36,  0,  9, 36,  0,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2,
-    73, 36,146, 73, 36,  2, 73,  0,146, 73, 36,144,  0,  4,144, 65,  4, 16, 65,  4,  0,  1,  4,  0,  1,  4, 16,  0,  0,  0,  0,  0,
-    16, 65,  0,  0,  0, 36,144,  9, 36,144, 65,  0,  4, 81, 69, 20, 81, 69, 20, 81, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,
-     0,  0, 73,  0,146, 73, 36,146, 64,  0,  2, 73, 36,  2, 73, 36,144,  0,  0,146, 64, 36,  2, 73,  0,  0,  9, 36,  0,  0, 36,146,
-    64,  0,  2, 73, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0, 65,  4, 16, 64,  0,  0, 65,  4,  0, 65,  4, 16,  0, 36,  0,  0,  0,
-     0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4, 81, 69, 20, 81, 69, 20, 81, 36,146, 73, 36,146, 73, 36,162, 64,  0,  0,  0,
-     4, 16, 65,  4,146, 73, 36,146, 73, 36,  2, 73, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  4,144, 65,  4, 16, 65,  4,  0, 65,  4,  0, 65,  4, 16,  0,  0,  0,  0,  0,
-    16, 64, 36,146, 64,  0,144,  0, 36,144, 65,  0,  4, 81, 69, 20, 81, 69, 20, 81,  0,  0,  0,  0,  0, 22, 36,146, 73, 36,146, 73,
-    36, 16, 65, 88,146, 73, 36,146, 73, 36,  2, 73, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2,
-    73, 36,146, 73, 36,146, 73,  0,146, 73, 36,144,  0,  4,144, 65,  4, 16, 65,  4,  0, 65,  4,  0, 65,  4, 16,  0,  0,  0,  0,  0,
-    16, 64,  0,  0,  0,  0,146, 64, 36,144, 65,  0,  4, 81, 69, 20, 81, 69, 20, 81,  0,146, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     4, 16, 65, 36,146, 73, 36,146, 73, 36,  2, 73, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4,144, 65,  4, 16, 65,  4,  0, 65,  4,  0, 65,  4, 18, 73,  0,  0,  0, 36,
-   146, 65, 36,146, 73, 36,146, 73, 36,144, 65,  0,  4, 81, 69, 20, 81, 69, 20, 81, 36,146, 73, 36,146, 73, 36,178, 73, 36,146, 73,
-     0, 16, 65,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,144,  9, 36,146, 73, 36,146, 73,  0,144,  0, 36,146, 73, 36,146, 64,  0,  0, 64,  0,  0,  1,  4, 16, 65,  4,
-     0, 64,  4, 16, 65,  4, 16, 65,  0,  0,  0,  0,  4, 81, 69, 20, 81, 69, 20, 81,  0,  0, 65, 36,  0,  0,  0,  0,  0,  0,  0,  0,
-     1,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134,
-    24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134,  0,  0,  0, 10, 97,134, 24, 97,134, 24, 97,134, 24, 97,134,  9, 69, 20, 81, 69,
-    20, 81, 69, 16,130,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     1,134,  0, 96,  6, 24, 97,134,  0, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24,  1,128, 24, 97,134,
-    24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,128,  0, 97,134, 24, 96,  6,  0, 97,134, 24, 97,134,  0, 69, 20, 81, 69,
-    20, 81, 69, 16,  0, 97,134, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    37,101,150, 88,149,150, 81,101,130, 80,113,199, 28,117,  9, 28,146, 73,  4, 18, 73, 36,146, 73, 69, 20, 81, 69, 20, 81, 69, 18,
-    73, 36,146, 73, 36,146, 73,  8, 18, 65, 36, 19, 18, 49, 32, 65, 36,146, 73, 36,146, 73,  0,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,  0, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 66,
-     4, 16, 65,  4, 32, 65, 36,146, 73, 36, 16, 65,  4, 16, 65,  4, 16, 65,  0, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,  0,130, 36,146, 73, 36,144, 73, 36,146, 73, 36,  2, 73, 89, 96,150, 36,
-   146, 73, 37, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134,
-    24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 69, 20, 81, 69, 20, 81, 69, 16,130, 36,146, 73, 97,134, 24, 97,
-   134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24,
-    97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 69, 20, 81, 69, 20, 81, 69, 22, 24, 97,134, 24, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  9,  0,  0,  0,  0,144,  0, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-   101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150,
-    89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,
-   150, 89,101,150, 89,101,150, 89,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,
-   105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,109,182,
-   219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2, 73, 36,144,  0, 36,146, 73, 36,
-   146, 64, 36,  2, 73, 36,144,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,  2, 73, 36,144,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,  2, 73, 36,144,  0, 36,146, 73, 36,146, 64, 36,  2, 73, 36,144,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 64, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2, 73, 36,144,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 64,  0, 16, 65, 36, 34, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0, 36,146, 73, 36,144,  0,
-     8,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-     8,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 76, 72,  0,  0, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 66,  8, 34, 73, 36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  4, 16,  0,  0,  0,  0,  0,  0,  9, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,144, 65,  4, 32,128,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2, 73, 36,  0, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134,
-    24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24,  8,
-    39, 24,  8,144,138, 97,128,  0, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0,  0,
-    36,145,199,  8, 37,137, 28,114, 65,  4, 21,  1, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0,
-    36,146, 73, 36, 16, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36, 18,
-    64,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  4, 16, 65,  4, 16, 65,  4, 16,
-    65,  0,  0,  0,  4, 16, 65,  4, 16, 65,  4, 16, 65,  0,  0,  0, 36,  0,  0, 28,116, 81, 69, 20, 81, 69, 20, 81, 97,134, 24, 97,
-   134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,128,  0, 97,134, 24, 96,  0,  0,  0,  0,  0,  0,  0,  0,
-    97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134,
-    24,  0,  0,  0, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,128,  0,  0,  0,  0, 69, 20, 81, 69,
-    20, 81, 69, 22,  0,  0,  6, 24, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4, 16, 65,  0,  2, 73, 97,134, 24, 97,134, 24, 97,134,
-    24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,
-   134, 24, 97,134, 24, 97,134,  0, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 96,  0,  1,
-    69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0, 97,134, 24, 97,134, 24, 97,134,
-    24, 97,128,  0,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 64,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     4, 16, 65,  4,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,146, 73, 36,146, 73, 36,  0,  0, 69, 20, 81, 69,
-    20, 81, 69, 16,130, 36, 32,130,  8,146, 73, 36,146, 73, 36,146, 65,  4, 16, 65,  4, 16, 65, 36,146, 73, 36,146, 73, 36, 32,128,
-     4, 16, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 18, 73, 69, 20, 81, 69, 20, 81, 69, 18, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  0,  0,  0,  0,  0,  0, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  4, 16, 65,  4, 16,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  0,  0,  2,  8, 32,130, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,146, 73, 69, 20, 81, 69,
-    20, 81, 69, 18, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,130,
-    36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,  4, 16, 73,  4,
-    16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,146, 73, 36, 18, 73, 36,146, 73,  4,146, 65,  4, 18, 64,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  4, 16, 65,  4, 16, 65,  4, 16, 65,  5, 64, 65,  4, 16, 65,  4,
-    16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65, 80, 16, 65,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0, 36,146, 73, 36,144,  0, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0, 36,146, 73, 36,144,  0, 36,146, 73, 36,
-   146, 73,  0,144,  9,  0,144,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,
-     2, 73, 36,146, 73,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  2, 73, 36,  2, 73, 36,146, 73, 37, 98, 64,
-     8, 32,130,  8, 32,148,  8, 32,157,  5,224, 65,  9, 64,130,125, 85, 73, 32,131,  8, 32,131,  8, 85, 82, 73,130,  8,  2, 16, 64,
-    65,  4, 16, 84, 44,178,203, 44,178,203, 36,130, 21,113,194, 73, 36,146, 73, 56,196,156,113,194, 73, 36,146, 73, 36,146, 73, 36,
-   144,139,  8, 32,130, 36, 32,130,132,146, 73, 36,  0, 65,  4, 16, 65,  4, 16, 65, 36,144,  0, 84,146, 73, 36,146, 73, 36,196,149,
-    37, 85, 85, 84,146, 73, 36,146, 73, 36,196,128, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0, 40,162,138, 40,162,139, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,202, 40,162,139, 40,162,202, 44,162,138, 40,162,138, 40,162,138, 40,162,138,  4, 16, 65,  4,
-    16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 75, 37, 82, 73, 36,178, 73, 36,146, 73, 36,146, 85, 36,146,137, 36,146, 73, 36,146, 73, 37, 85, 73, 36,146, 73, 36,146,
-    85, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 85,
-    82, 73, 36,146, 85, 36,149, 73, 85, 85, 85, 85, 85, 85, 85, 85, 85, 36,146, 73, 85, 85, 85, 85, 85, 85, 85, 82, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 37, 82, 73,  0,  0,  0, 85, 85, 85, 85, 85, 85, 85, 82, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,149, 73, 84,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    84,149, 85, 36,146, 85, 84,146, 85, 36,146, 85, 37, 82,138, 37, 82, 73, 36,149, 73, 37, 85, 85, 84,146, 85, 37, 82, 85, 85, 85,
-    85, 84,149, 73, 36,146, 73, 85, 85, 85, 36,146, 73, 85, 82, 73, 36,146, 73, 36,146, 73, 84,146, 73, 84,146, 73, 36,149, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 85, 82, 73, 85, 85, 85, 36,149, 85, 36,149, 85, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,149, 85, 36,149, 85, 36,146, 73, 36,146, 73, 36,146, 73, 37, 82, 73, 37, 82, 73, 36,146, 73, 36,146, 73, 37, 82, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 85, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 96, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 49, 35, 18, 36,146, 73, 36,149, 73, 36,146, 73, 36,152,162, 36,146, 73, 36,146, 73, 36,146, 73, 36,196,
-   137, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,138, 40,162, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 73,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 36,146, 73, 85, 85, 85, 85,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 84,146, 73, 36,146, 73, 36,146, 73,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 36,149, 85, 85, 82, 73, 36,146, 73, 36,146, 73, 85, 82, 85, 85, 85, 85, 85, 82,
-    73, 36,146, 73, 36,149, 85, 36,149, 85, 36,146, 73, 85, 82, 73, 85, 82, 73, 36,149, 85, 84,146, 85, 36,149, 85, 85, 82, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,149, 85, 85, 82, 73, 36,146, 73, 36,146, 85, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-   138, 40,162, 37, 85, 73, 37, 82, 73, 36,149, 85, 36,146, 73,138, 37, 85,136,152,162,138, 56,162, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 38, 40,162, 36,146, 73, 84,149, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 85, 82, 85, 85, 82, 85,137, 85, 73, 85, 82, 85, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 98,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,149, 85, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 38, 40,162,138, 40,162,138, 40,162,137, 85, 85, 86, 34, 98,138, 37, 98,137,
-    85, 85,138, 37, 85,137, 85, 98,138, 34, 85, 36,146, 73, 85, 88,149, 85, 85, 85, 86, 40,162,138, 37, 98,138, 56,149, 86, 40,162,
-   138, 40,162,136,146, 73,138, 40,227,142, 50, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 85, 36,146, 72, 32,130,  8, 32,145,199,136,146, 73, 49, 35, 18, 49, 35, 18, 49, 35, 18, 49, 37, 85, 85, 85, 85, 85, 85, 85,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,196,137, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,147, 18, 49, 35, 18, 49, 35, 18, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 76, 72,196,140, 72,196,140, 72,196,140, 72,196,140, 72,196,140, 72,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 49, 35, 18, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 49, 34, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 37,
-    85, 85, 85, 82, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  2, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4, 18, 73,  0,  0,  0,  0,112,130,  8,145,194,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  9,  0,  0,
-     0,  0,144,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  9,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 64, 36,146,
-    73, 36,146, 64, 36,146, 73, 36,146, 64, 36,146, 73, 36,146, 64, 36,146, 73, 36,146, 64, 36,146, 73, 36,146, 64, 36,146, 73, 36,
-   146, 64, 36,146, 73, 36,146, 64,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,
-    32,130,  8, 32,130,  8, 32,130,  8, 32,128,130,  8, 32,130,  8, 34, 66, 48, 34, 73, 32,130, 73, 32,131, 18, 49, 35, 18, 49, 32,
-   130,  8, 33,201,  8, 34, 66,  8,146, 73, 36,151,223,  8, 32,137,  8, 35,  2,  8, 32,130,  8, 32,137,  8,144,130, 36,146, 71, 28,
-   196,140, 72,196,140, 72, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 32, 34,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,138, 40,162,138, 40,162,138, 40,162,  0,  0,  0,
-     9, 36,162,137,200,162, 49, 35, 18, 49, 35, 18, 49, 40,162, 49, 35, 18, 49, 35, 18,112,196,146,138, 40,162,138, 40,162,138, 32,
-    65,  4, 16, 65,138, 40,162,136, 24,162,138, 40,156,114, 40,162,  2, 72,164,138, 72,164,138, 72,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,164,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-   138, 40,164,138, 72,164,138, 40,162,138, 41, 34,138, 40,162,138, 73,  0,  0, 16, 92,113,199, 34,114, 72,164,138, 72,164,138, 72,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,164,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,164,138, 72,164,138, 40,162,138, 41, 34,138, 40,162,138, 73, 34,138, 40,156,145,199, 34,
-     0,  0,  0,  2, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,  2, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,128,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,  0,  0,  0,  0,  0,  0,  0,  0,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,128,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162, 85, 85, 85, 85, 85, 85,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,137,200,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,136,  0,  0,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,128,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,130,
-    36,146, 73, 36,146, 73, 36,146, 73, 36, 33,194, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 69, 20, 81, 69, 20, 81, 69, 18,
-    73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4, 16, 73,  4, 16, 65,  4, 16, 65,  4, 18, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  4, 18, 66,  8, 32,130,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0, 36,144,  9,  0,
-   146, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,144, 73, 36,144, 73, 36,146, 65, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4, 16, 65, 36,146,
-    73,  4,  0,  0, 36,146, 73, 36,146, 73, 44,144,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 89, 97,199,  0,  0,  0,  0,  0,  0,
-     4, 18, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16,  0,  0,  0,  0,  0,  0,130, 69, 20, 81, 69,
-    20, 81, 69, 16,  0,  0,  0,  0,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 18, 73, 36,146, 73, 36,146, 73, 88,146, 65,
-    69, 20, 81, 69, 20, 81, 69, 18, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  4, 16,
-    65,  4, 16,130, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  0,
-     0,  0,  0,  0,  0,  0,  0,  9,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,101,150, 89,100,  0,  0,
-     4, 16, 65, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,146, 73, 36,146, 66,  8, 34, 73, 36,144,  9, 69, 20, 81, 69,
-    20, 81, 69, 16,  0,  0,  2, 73, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 69, 20, 81, 69, 20, 81, 69, 22, 24, 97,134,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36, 16,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 64,  0,  0,  0,  0,  0,  0, 36,146, 65, 36,146, 73, 36,146, 73,  4, 16,  0, 69, 20, 81, 69,
-    20, 81, 69, 16,  0, 36, 32,130, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24,
-    97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134,
-    24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 24, 97,134, 24, 36,146, 73, 36,146, 73, 36,146, 65,  4, 16, 65,  8, 34, 73, 36, 16, 64,  0,  0,  0,  0,  0,  0,
-     0,146, 73, 36,146, 64,  0,146, 73, 36,146, 64,  0,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 64, 36,146,
-    73, 36,146, 64, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4, 16, 65,  4, 16, 66,  4, 16,  0, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0,
-   150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,
-   166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,
-   105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,
-   154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,
-   166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,
-   105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,
-   154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,
-   166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,
-   105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,
-   154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,
-   166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,
-   105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,
-   154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,
-   166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,
-   105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,
-   154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,
-   166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,
-   105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,
-   154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,
-   166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,
-   105,166,154,105,166,154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,
-   154,105,166,154,105,166,150,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,128,  0,  0, 27,109,182,219,109,182,219,109,
-   182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,109,182,219,  0,  0,  0,
-   158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,
-   231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,
-   121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,158,121,231,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0,  0,  9, 36,146, 73,  0,  0,  0,  1,112, 87, 93,117,215, 93,117,215, 92,149,
-   215, 93,117,215, 93,117,215, 93,117,192, 93,117,215, 92,  5,192, 93,112, 23, 92,  5,215, 93,117,215, 93,117,215, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,148,140, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  9,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 44,146, 73,
-     4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65, 57, 36,142, 56,113,204, 74,  0,  0,  0,  0,  0,  4, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 16, 65,138, 40,162,136,196,140, 72,196,140, 72,196,140, 72,196,140, 74, 40,140, 74, 40,162,138, 40,162, 74, 36,128,113,
-   193,199,136,196,140, 72,196,162,138, 40,162,138, 40,128,136,162,226,  0,  0,  0, 36,146, 73, 36,  2, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0, 33,
-     0,120,162, 40,184,162, 49, 40,162, 74, 36,162,138, 40,162,138, 40,162,138, 39, 28,138, 40,135,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,140,137, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,140,137, 40,140, 73, 35, 18, 73,200,164,146, 73, 36,146, 73, 36,146, 40,162,138, 40,162,138, 40,162,138, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 39, 28,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,128,  0,  8,162,138, 40,162,  0,  8,162,138, 40,162,  0,  8,162,138,
-    40,162,  0,  8,162,136,  0,  0, 44,168,162,136,162,128, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0, 16, 65,161, 80,  0,
-    36,146, 73, 36,146, 73, 36,146, 73,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64, 36,144,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,
-     8, 32,128,  0,  0,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73,  0,  0,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36, 16,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  4,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,
-     0,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  4, 16, 64,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  2, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0, 36,146, 73, 36,146, 73,  8,146, 73, 36,
-   144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0, 69, 20, 81, 69, 20, 81, 69, 16,
-     0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,
-     0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,
-     0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,  0,  9, 36,146, 73, 36,146, 73, 36,146, 64, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 64, 36,146, 73, 36,146, 64, 36,144,  9, 36,146, 73, 36,146, 73, 36,144,  9, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,144,  9, 36,146, 73, 36,144,  9, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   144,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,144,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,  2, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,144,  0, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,144,  9, 36,  0,  0, 36,  0,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   144,  2, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  9, 36,146,
-    73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64, 36,144,  0,  0,  0,  9, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  2, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  2, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36, 16, 65,  0, 16, 64,  0,  0,  0,  4, 16, 65, 36,146, 73,  0,146, 73,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,144,  0,  4, 16, 64,  0,  0,  1, 36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0,  8, 32,130,  8,
-    32,130, 36,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36, 16, 64,  0,  0,  9, 36,146, 73,  8, 32,130,  8, 40,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,144,  0,  0, 32,130,  8, 32,130, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   144,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0,  0,  0,146, 73, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,146,
-    73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  2, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  4, 16, 65,  0,  0,
-     0,  0,  0,  0, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,
-     1,  4, 32,  0, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16, 65,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,
-     0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  4, 16, 65,  4, 16, 65,  4,146, 73, 36,
-   146, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,144, 65,  4, 18, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,
-     4, 16, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 66,  8,146, 73, 36,144,  0,  0,  2, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,148, 81, 69, 20, 81, 69, 20, 81,  4,146, 65,  4,144,  0,  0,  0,  0,  0,  0,  1,
-     4, 16, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73,  4, 16, 65,  4, 16, 65,  4, 16, 73, 36,144,130,  8, 32, 64,  0,  0,  0,  0,  0,  0,  0,144,  0, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0,
-     4, 16, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4, 16,
-    65,  4, 16, 65,  4, 16, 65,  4,  4, 81, 69, 20, 81, 69, 20, 81,  8, 32,130, 36, 16, 73,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65, 37, 98, 64,  0,  0,  0,  0,  0,  0,
-     4, 16, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,146, 73, 36, 32,137,  8, 16, 65,  4,144, 65, 69, 20, 81, 69,
-    20, 81, 69, 18, 86, 36, 32,130,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73,  4, 16, 65,  4, 16, 65,  4, 16, 65,  8, 34, 66,  8,144, 73, 36, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 64, 36,  2, 73, 36,144,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  9, 36,146, 73, 36,146, 73, 36, 32,
-     0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 65,  4, 16, 65,  4, 16, 65,  4, 16, 64,  0,  0,  0, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0,
-     4, 16, 65,  0,146, 73, 36,146, 73, 36,  0,  9, 36,  0,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2,
-    73, 36,146, 73, 36,  2, 73,  0,146, 73, 36,144,  1,  4,144, 65,  4, 16, 65,  4,  0,  1,  4,  0,  1,  4, 16,  0, 36,  0,  0,  0,
-     0,  1,  0,  0,  0,  0,146, 73, 36,144, 65,  0,  0, 65,  4, 16, 65,  4,  0,  0,  4, 16, 65,  4,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 73, 36,146, 66,  8, 32,137, 69, 20, 81, 69,
-    20, 81, 69, 16,130,  0,144, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65, 36,146, 73,  0,  0,  0,  0,  0,  0, 69, 20, 81, 69,
-    20, 81, 69, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 65,  4, 16, 65,  4, 16,  0,  4, 16, 65,  4, 16, 65,  5, 96,130, 28,114, 73, 36, 32,130,  8, 32,130,  8, 32,130,  8,
-    32,130, 36,146, 73,  4, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 32,137, 36,  0,  0,  0,  0,  0,  0,  0,  0, 69, 20, 81, 69,
-    20, 81, 69, 16,  0,  0,  0,  0, 89,101,150, 89,101,150, 89,101,150, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 65, 36,144,  0,  0,  0,  0, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134, 24, 97,134,  0,  1,134, 24, 97,134, 24, 97,134, 24, 97,134,
-    24,  0,  0,  0, 69, 20, 81, 69, 20, 81, 69, 22, 24,  8, 32,152, 97,134, 24, 97,134,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 69, 20, 81, 69, 20, 81, 69, 18, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0,  0,  9,
-    36,146, 73, 36,146, 64,  0,144,  0, 36,146, 73, 36,146, 73,  0,146, 64, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73,  4, 16, 65,  4, 16,  1,  4,  0,  1,  4, 16, 73,  4,144, 65,  8, 32,128,  0,  0,  0,  0,  0,  0, 69, 20, 81, 69,
-    20, 81, 69, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73,  0,  2,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36, 16, 65,  4,
-    16, 65,  0,  0, 65,  4, 16, 65,  4,149,137,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36, 16, 65,  4, 16, 65,  4, 16, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 65,  4, 16, 65,  4, 18, 65,  4, 16, 86, 36, 32,130,  9, 98, 65,  0,  0,  0,  0,  0,  0, 36, 16, 65,  4,
-    16, 65,  4, 16, 65, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,144, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16,130,  8,149,150, 88, 32,128,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0,
-    89,101,150, 89,101,150, 89, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 65,  4, 16, 65,  4, 16, 64,  4, 16, 65,  4, 16, 65, 36, 32,130,  8, 32,  0,  0,  0,  0,  0,  0,  0, 69, 20, 81, 69,
-    20, 81, 69, 18, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0, 88,114, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  0, 16,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 64, 36,144,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36, 16, 65,  4, 16, 64,  0,  0, 64,  4, 16,  1,  4, 16, 65,  4, 18, 65,  0,  0,  0,  0,  0,  0, 69, 20, 81, 69,
-    20, 81, 69, 16,  0,  0,  0,  0, 36,146, 73, 36,144,  9, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,144, 65,  4, 16, 64,  4, 16,  1,  4, 16, 65, 36,  0,  0,  0,  0,  0, 69, 20, 81, 69, 20, 81, 69, 16,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 65,  4, 16, 73, 36,  0,  0,  0,  0,  0,
-     4, 18, 65, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73,  4, 16, 65,  4, 16, 64,  0,  0, 65,  4, 16, 66, 10, 40,162,138, 40,162,138, 40,162, 69, 20, 81, 69,
-    20, 81, 69, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,178,203, 44,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  8, 32,130,  8,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 48,195, 18, 73, 34, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,148,137, 36,147, 18, 49, 34, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,196,146, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 81, 69, 20, 81, 69, 12, 73, 69, 20, 49, 35, 18,  4,146, 73, 36,146, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,
-    16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,147, 18, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 64, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,130, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  4, 16, 65,  4, 32,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73,  4, 16, 65,  4, 16, 66,  8, 34, 73, 36,146, 73, 36,146, 73,  8,144,  0,  0,  0,  0,  0,  0,  0, 69, 20, 81, 69,
-    20, 81, 69, 16,  9, 36,146, 73, 36,144,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 66,  8,146, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  1, 36, 16, 65,  4,
-    16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,
-     4, 16, 65,  4, 16, 65,  0,  0,  0,  0,  0,  1,  4, 16, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,113,199, 28, 80,  0,  0,  0,  0,  0,  0,  0,  0,  4, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   138, 40,162,138, 40,162,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73,  0,146, 73, 36,146, 73,  0,146, 64,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,128,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146, 73,  0,  2,
-    64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146, 73, 36,  0,  0,  0,  0,  0,  0,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,
-    36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,144,  0, 36, 16, 66,  4, 16, 65,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 16,  0,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 64,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36, 16, 65,  4, 18, 73, 36, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,
-     4, 16, 73, 36, 16, 65,  4, 16, 65, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,
-    65,  4, 18, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144, 65,  4,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 64,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-     2, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  2, 73,  0,  2, 64,  0,146, 64,  0,146,
-    73, 36,  2, 73, 36,146, 73, 36,146, 73, 36,144,  9,  0,146, 73, 36,146, 73,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,144,  9, 36,146, 64,  0,146, 73, 36,146, 73, 36,  2, 73, 36,146, 73, 36,  2, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  9, 36,146, 64, 36,146, 73, 36,  2, 64,  0,  2, 73, 36,146, 73, 36,  2, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  4, 81, 69, 20, 81, 69,
-    20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81, 69, 20, 81,
-     4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 73, 36,146, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,
-    16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,146, 73, 36,146, 73, 36, 18, 73, 36,146, 73, 36,146, 73,
-    36,146, 73,  4,146, 66,  8, 32,137,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  4, 16, 65,  0, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 16, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,146, 73, 36,146,
-    64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     4, 16, 65,  4, 16, 64,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,  0,  1,  4, 16, 65,  4, 16,  1,  4,  0, 65,  4, 16,
-    64,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,  0,  0,  4, 16, 65,  4, 16, 73, 36,146, 73, 36,144,  0, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  2, 73,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,144, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  4, 16, 65, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0, 10,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  4, 16, 65, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 36,146, 73, 36,146, 64, 36,146, 73,  0,146, 64, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,  0,  9, 36,146, 73, 36,146, 73,  4, 16, 65,  4,
-    16, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  4, 16, 65,  4, 16, 73,  0,  0,  0, 69, 20, 81, 69,
-    20, 81, 69, 16,  0,  0,  3, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 44,146, 73, 44,146, 73, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    36,146, 73,  0,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,146, 64, 36,  0,  9,  0,146,
-    73, 36,146, 73, 36,146, 64, 36,146, 73,  0,144,  9,  0,  0,  0,  0,  2, 64,  0,  0,  9,  0,144,  9,  0,146, 73,  0,146, 64, 36,
-     0,  9,  0,144,  9,  0,144,  9,  0,146, 64, 36,  0,  9, 36,146, 64, 36,146, 73, 36,146, 64, 36,146, 73,  0,146, 73, 36,  2, 64,
-    36,146, 73, 36,146, 73, 36,144,  9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,146, 73,  0,146, 73, 36,144,
-     9, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 86, 40,162, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
-    85, 85, 82, 73, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 82, 73, 38, 40,162, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
-    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
-    85, 86, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 42,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,166,154,105,
-   138, 40,162,138, 56,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162, 36,152,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,136,146, 98,138, 40,162, 38, 40,162,138, 40,227,142, 40,163,138, 40,227,142, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,170,170,170,170,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,227,138, 40,227,142, 56,227,142, 56,227,142, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,227,142, 56,227,142, 56,227,142, 56,227,142, 56,227,142, 40,162,142, 40,162,
-   138, 56,227,138, 56,227,138, 40,162,138, 40,163,138, 56,162,138, 40,162,138, 40,162,138, 40,162, 38, 34, 98, 38, 40,162,138, 40,
-   226,138, 40,137,136,146, 98,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-    36,146, 73, 36,146, 98,138, 40,162,138, 40,162,138, 40,162,138, 40,137, 36,146, 73, 36,146, 73, 36,146, 73, 38, 40,162,138, 40,
-   162,138, 40,162,138, 34, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,152,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,142, 56,162,138, 40,226,138, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,142, 40,162,138, 56,226,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162, 36,
-   146, 73, 36,146, 73,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162, 36,146, 73, 36,152,162,138, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 56,227,138, 40,163,142, 56,227, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,  8, 33,199, 28, 36,146, 73,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,163,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,142, 56,226,138, 40,162,138, 40,162,142, 40,162,138, 40,162,138, 40,162,142, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,
-   146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,138, 40,162,138, 40,162,138, 40,162,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 38,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-    36,146, 73, 36,146, 73, 36,146, 73,138, 40,162, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,138, 40,162,138, 40,162, 36,146, 73, 36,
-   146, 73, 36,152,162,138, 40,162, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,
-    36,146, 73, 36,146, 73,138, 40,162,138, 40,162, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,152,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-    36,146, 73, 36,146, 73, 36,146, 73,142, 40,163,138, 40,162,138, 40,162,142, 56,227,142, 56,227,138, 40,162,138, 40,226,138, 40,
-   162,138, 40,162,142, 56,227,142, 56,227,142, 56,162,142, 56,226,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,163,138, 40,162,138, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 56,226,142, 56,163,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 56,227,138, 56,227,142,
-    56,227,142, 56,227,142, 56,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,163,142, 56,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,142, 56,227,142, 56,227,142, 40,162,138, 40,162,
-    36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146,
-    73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 73, 36,146, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 20, 81, 69, 20, 81, 69, 16,  0,  0,  0,  0,
-   138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,
-   162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138,
-    40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 40,162,138, 32,  0,
-     0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,
-    16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,
-     4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,
-    16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,
-     4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16,
-    65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4,
-    16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  4, 16, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-
-} // namespace detail
 
 // Windows.h adds a "IN" macro that is used in this enum.
 #ifdef IN
@@ -1060,30 +76,5 @@ enum class unicode_line_break_class : uint8_t {
     EM = 42,
 };
 
-[[nodiscard]] constexpr unicode_line_break_class ucd_get_line_break_class(char32_t code_point) noexcept
-{
-    constexpr auto max_code_point_hi = detail::ucd_line_break_classes_indices_size - 1;
-
-    auto code_point_hi = code_point / detail::ucd_line_break_classes_chunk_size;
-    auto const code_point_lo = code_point % detail::ucd_line_break_classes_chunk_size;
-
-    if (code_point_hi > max_code_point_hi) {
-        code_point_hi = max_code_point_hi;
-    }
-
-    auto const chunk_index = load_bits_be<detail::ucd_line_break_classes_index_width>(
-        detail::ucd_line_break_classes_indices_bytes,
-        code_point_hi * detail::ucd_line_break_classes_index_width);
-
-    // Add back in the lower-bits of the code-point.
-    auto const index = (chunk_index * detail::ucd_line_break_classes_chunk_size) + code_point_lo;
-
-    // Get the canonical combining class from the table.
-    auto const value = load_bits_be<detail::ucd_line_break_class_width>(
-        detail::ucd_line_break_classes_bytes, index * detail::ucd_line_break_class_width);
-
-    return static_cast<unicode_line_break_class>(value);
-}
-
 }} // namespace hi::v1
 
@@ -14,1484 +14,6 @@ hi_export_module(hikogui.unicode.ucd_scripts);
 
 hi_export namespace hi {
 inline namespace v1 {
-namespace detail {
-
-constexpr auto ucd_scripts_chunk_size = 128_uz;
-constexpr auto ucd_scripts_index_width = 8_uz;
-constexpr auto ucd_scripts_indices_size = 7173_uz;
-constexpr auto ucd_script_width = 10_uz;
-
-static_assert(std::has_single_bit(ucd_scripts_chunk_size));
-
-constexpr uint8_t ucd_scripts_indices_bytes[7189] = {
-     0,  1,  2,  2,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
-    30, 31, 32, 32, 33, 34, 35, 36, 37, 37, 37, 37, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,  2,  2, 53, 54,
-    55, 56, 57, 58, 59, 59, 59, 59, 60, 59, 59, 59, 59, 59, 59, 59, 61, 61, 59, 59, 59, 59, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
-    72, 73, 74, 75, 76, 77, 78, 59, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 79, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    80, 80, 80, 80, 80, 80, 80, 80, 80, 81, 82, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 70, 70, 97, 98, 99,100,101,101,102,103,104,105,106,107,
-   108,109,110,111, 96,112,113,114,115,116,117,118,119,119,120,121,122,123,124,125,126,127,128,129,130,131,132, 96,133,134,135,136,
-   137,138,139,140,141,142,143, 96,144,145, 96,146,147,148,149, 96,150,151,152,153,154,155,156, 96,157,158,159,160, 96,161,162,163,
-   164,164,164,164,164,164,164,165,166,164,167, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,168,
-   169,169,169,169,169,169,169,169,170, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96,171,171,171,171,172, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,173,173,173,173,174,175,176,177, 96, 96, 96, 96,178,179,180,181,
-   182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,
-   182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,183,182,182,182,182,182,182,184,184,184,185,186, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,187,
-   188,189,190,191,191,192, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,193,194, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,195,196,
-    59,197,198,199,200,201,202, 96,203,204,205, 59, 59,206, 59,207,208,208,208,208,208,209, 96, 96, 96, 96, 96, 96, 96, 96,210, 96,
-   211,212,213, 96, 96,214, 96, 96, 96,215, 96, 96, 96, 96, 96,216,217,218,219, 96, 96, 96, 96, 96,220,221,222, 96,223,224, 96, 96,
-   225,226, 59,227,228, 96, 59, 59, 59, 59, 59, 59, 59,229,230,231,232,233, 59, 59,234,235, 59,236, 96, 96, 96, 96, 96, 96, 96, 96,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,237, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,238, 70,239, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,240, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,241, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 70, 70, 70, 70,242, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70,243, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-    70, 70, 70, 70, 70, 70, 70,244, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
-   245, 96, 59,246, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-constexpr uint8_t ucd_scripts_bytes[39536] = {
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,141,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,
-   205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 95,226,248,190, 47,139,226,248,141,115, 92,215, 53,205,115,
-    92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 95,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 35, 95,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 35, 95,226,248,190, 47,139,226, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,
-   205,115, 92,215, 53,205,115, 92,215, 53,205,115, 95,226, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115,
-    92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 95,226, 53,205,115, 92,215, 53,205,115, 92,215,
-    53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,
-   115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,
-   215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,
-   205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115,
-    92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215,
-    53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,
-   115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,
-   215, 53,205,115, 92,215, 53,254, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226, 53,205,115, 92,215, 53,254, 47,
-   139,226,248,190, 36,117, 29,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226, 50, 12,131, 32,200,248,140,131, 32,200,  0,  0,  3, 32,200, 50, 12,143,136,200,
-     0,  0,  0,  0,  0, 50, 62, 35, 35,226, 50, 12,131, 32,  0, 50,  0,  3, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,
-   131, 32,200, 50, 12,131, 32,200, 50, 12,128,  0,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,
-   200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50,
-    12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 48,204, 51, 12,195,
-    48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200,
-    55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,
-   195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,
-   220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55,
-    13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,
-   112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220,
-    55, 13,195,112,220, 55, 62, 47,136,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,
-   195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,
-   220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55,
-    13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,
-   112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220,
-    55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,
-   195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220,  0, 14, 99,152,
-   230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,
-   142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,  0,  0, 14, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,
-   152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230,
-    57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,  0,  0, 14, 99,152,230,  0,  7,209,244,125, 31, 71,209,244,125, 31, 71,
-   209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,  0,  0,  0,  0,  0,125, 31, 71,209,244,125, 31, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    40, 10,  2,128,160, 40, 62, 34,128,160, 40, 10,  2,128,160,248,138,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,
-     2,131,226, 40, 10,  2,131,226, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,
-   160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,248,138,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,131,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 34,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,248,138,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-    40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,
-     2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,
-   160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40,
-    10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 62, 34,128,160, 40, 10,  2,128,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-    33,200,114, 28,135, 33,200,114, 28,135, 33,200,114, 28,135, 33,200,112,  0,135, 33,200,114, 28,135, 33,200,114, 28,135, 33,200,
-   114, 28,135, 33,200,114, 28,135, 33,200,114, 28,135, 33,200,114, 28,135, 33,200,114, 28,135, 33,200,114, 28,135, 33,200,114, 28,
-   135, 33,200,114, 28,135, 33,200,114, 28,135, 33,200,114, 28,135, 33,200,114, 28,135, 33,200,114, 28,135, 33,200,114, 28,  0,  0,
-     8,114, 28,135, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-    42,138,162,168,170, 42,138,162,168,170, 42,138,162,168,170, 42,138,162,168,170, 42,138,162,168,170, 42,138,162,168,170, 42,138,
-   162,168,170, 42,138,162,168,170, 42,138,162,168,170, 42,138,162,168,170, 42,138,162,168,170, 42,138,162,168,170, 42,138,160,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41,
-    74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,
-   148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,  0,  0, 10, 82,148,165,
-    30,199,177,236,123, 30,199,177,236,123, 30,199,177,236,123, 30,199,177,236,123, 30,199,177,236,123, 30,199,177,236,123, 30,199,
-   177,236,123, 30,199,177,236,123, 30,199,177,236,123, 30,199,177,236,123, 30,199,177,236,123, 30,199,176,  0,  0, 30,199,177,236,
-   123, 30,199,177,236,123, 30,199,177,236,123, 30,199,177,236,  0, 35,  8,194, 48,140, 35,  8,194, 48,140, 35,  8,194, 48,140, 35,
-     8,194, 48,140, 35,  8,194, 48,140, 35,  8,194, 48,140, 35,  8,194, 48,140,  0,  0,  2, 48,  0, 33,200,114, 28,135, 33,200,114,
-    28,135, 33,200,114, 28,  0,  0,  0,  0,  0,  0, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-    40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,  0, 40, 10,  0,  0,  0,  0,  0,  0,  0,  0, 40, 10,
-     2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,
-   160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40,
-    10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10, 15,136,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-    78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,
-   180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237,
-    59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,
-   211,180,237, 59, 78,254, 47,139,226,248,147,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59,248,190, 36,
-   237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59,
-    81, 84, 85, 21, 69,  0, 20, 85, 21, 69, 81, 84, 85, 21, 69, 81, 64,  0,  1, 69, 81, 64,  0,  1, 69, 81, 84, 85, 21, 69, 81, 84,
-    85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 64,  5, 21, 69, 81, 84, 85, 21, 69, 81, 64,  5, 20,
-     0,  0,  0,  5, 21, 69, 81, 84, 80,  0,  0, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 64,  0,  1, 69, 81, 64,  0,  1, 69, 81,
-    84, 85, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1, 69,  0,  0,  0,  0,  0, 81, 84, 80,  1, 69, 81, 84, 85, 21, 69,  0,  0,  5,
-    21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 20,  0,
-     0, 19,100,217, 54,  0, 19,100,217, 54, 77,147,100,216,  0,  0,  0,  0,  1, 54, 77,128,  0,  1, 54, 77,147,100,217, 54, 77,147,
-   100,217, 54, 77,147,100,217, 54, 77,147,100,217, 54, 77,147,100,217, 54, 77,128,  4,217, 54, 77,147,100,217, 54, 77,128,  4,217,
-    54,  0, 19,100,216,  0, 77,147, 96,  0,  0, 77,128,  4,217, 54, 77,147,100,216,  0,  0,  0,  0,  1, 54, 77,128,  0,  1, 54, 77,
-   147, 96,  0,  0,  0, 19, 96,  0,  0,  0,  0,  0,  0,  0,  0, 19,100,217, 54, 77,128,  4,216,  0,  0,  0,  0,  0,  0,  0,  0,  4,
-   217, 54, 77,147,100,217, 54, 77,147,100,217, 54, 77,147,100,217, 54, 77,147,100,216,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0, 20,  5,  1, 64,  0, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  0,  1, 64, 80, 20,  0,  1, 64, 80, 20,  5,  1, 64, 80, 20,
-     5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80,  0,  5,  1, 64, 80, 20,  5,  1, 64, 80,  0,  5,  1,
-    64,  0, 20,  5,  1, 64, 80, 20,  0,  0,  0, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  0,  1, 64, 80, 20,  0,  1, 64, 80,
-    20,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80, 20,  5,  1, 64,  0,  0,  5,
-     1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  5,  1, 64, 80, 20,  5,  1, 64,
-     0, 20,117, 29, 71,  0, 20,117, 29, 71, 81,212,117, 29, 71, 81,192,  0,  1, 71, 81,192,  0,  1, 71, 81,212,117, 29, 71, 81,212,
-   117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,192,  5, 29, 71, 81,212,117, 29, 71, 81,192,  5, 29,
-    71,  0, 20,117, 29, 71, 81,212,112,  0,  0, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,192,  0,  1, 71, 81,192,  0,  1, 71, 81,
-   212,112,  0,  0,  0,  0,  0,  0,  0,  0, 20,117, 29, 71,  0,  0,  0,  0,  0, 81,212,112,  1, 71, 81,212,117, 29, 71,  0,  0,  5,
-    29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  5,105, 90,  0, 21,165,105, 90, 86,149,165,104,  0,  0,  0,  5,105, 90, 86,128,  5,105, 90, 86,149,160,  0,  0,  0, 21,
-   165,104,  0, 86,128,  5,105, 90,  0,  0,  0,  1, 90, 86,128,  0,  0,  0, 86,149,165,104,  0,  0,  0,  5,105, 90, 86,149,165,105,
-    90, 86,149,165,105, 90, 86,149,160,  0,  0,  0,  0,  5,105, 90, 86,149,165,104,  0,  0,  0,  5,105, 90, 86,128,  5,105, 90, 86,
-   149,160,  0,  0, 86,128,  0,  0,  0,  0,  0,  0,  1, 90,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,
-   105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,104,  0,  0,  0,  0,  0,  0,
-    85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85,  0,  5, 81, 84, 85,  0,  5, 81, 84, 85, 21, 69, 81, 84, 85, 21,
-    69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85,  0,  5, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81,
-    84, 85, 21, 69, 81, 84, 85, 21, 64,  0,  0, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85,  0,  5, 81, 84, 85,  0,  5, 81, 84, 85,
-    21, 64,  0,  0,  0,  0,  0,  0,  0,  0, 21, 69, 80,  0, 85, 21, 69, 80,  0,  0, 21, 64,  0,  0, 85, 21, 69, 81, 84,  0,  0,  5,
-    81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84,  0,  0,  0,  0,  0,  0,  0,  0,  1, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84,
-    86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 64,  5,101, 89, 86, 64,  5,101, 89, 86, 85,149,101, 89, 86, 85,
-   149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 64,  5,101, 89, 86, 85,149,101, 89, 86, 85,149,101,
-    89,  0, 21,149,101, 89, 86, 85,144,  0,  0, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 64,  5,101, 89, 86, 64,  5,101, 89, 86,
-    85,144,  0,  0,  0,  0,  0,  0,  0,  0, 21,149,100,  0,  0,  0,  0,  0,  0,  0, 21,149,100,  0, 86, 85,149,101, 89,  0,  0,  5,
-   101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89,  0, 21,149,101, 89,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,192,  5,109, 91, 86,192,  5,109, 91, 86,213,181,109, 91, 86,213,
-   181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109,
-    91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,192,  5,109, 91, 86,192,  5,109, 91, 86,
-   213,181,109, 91,  0,  0,  0,  0,  0, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91,  0,  0,  5,
-   109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91,
-     0, 21,197,113, 92,  0, 21,197,113, 92, 87, 21,197,113, 92, 87, 21,197,113, 92, 87, 21,197,113, 92, 87, 21,197,112,  0,  0,  0,
-     5,113, 92, 87, 21,197,113, 92, 87, 21,197,113, 92, 87, 21,197,113, 92, 87, 21,197,113, 92, 87, 21,197,113, 92, 87, 21,192,  1,
-    92, 87, 21,197,113, 92, 87, 21,197,113, 92,  0, 21,192,  0,  0, 87, 21,197,113, 92, 87, 21,197,112,  0,  0,  0,  5,112,  0,  0,
-     0,  0,  1, 92, 87, 21,197,113, 92, 87,  0,  5,112,  0, 87, 21,197,113, 92, 87, 21,197,113, 92,  0,  0,  0,  0,  0,  0,  0,  5,
-   113, 92, 87, 21,197,113, 92, 87, 21,197,113, 92,  0,  0,  5,113, 92, 87,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,
-     5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129,
-    96, 88, 22,  5,129, 96, 88, 22,  5,128,  0,  0,  0,  0,  3,226, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88,
-    22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96, 88, 22,  5,129, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0, 22, 69,144,  0, 89,  0,  5,145,100, 89, 22, 69,144,  0, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22,
-    69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100,  0, 22, 64,  1,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,
-   100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 64,  0,  0, 89, 22, 69,145,100, 89,  0,  5,144,  0, 89, 22, 69,145,100, 89,
-    22, 69,144,  0, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 64,  0,  0, 89, 22, 69,145,100,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,
-   165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41,
-    74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,  0, 20,165, 41, 74, 82,
-   148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165,
-    41, 74, 82,148,165, 41, 74, 82,128,  0,  0,  0,  0, 20,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,
-    82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74,  0, 20,
-   165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41,
-    74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,128,  5, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,
-   128,  5, 41, 74, 82,148,165, 41, 74, 82,190, 47,139,226,248,148,165, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,
-   229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121,
-    94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,
-   149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,
-   121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94,
-    87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,
-   229,121, 94, 87,149,229,121, 94, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,
-   240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  0,  0,240,  0,  0,  0,  0,  0,  0,
-    15,  0,  0,  0, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,
-   192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,195,226, 60, 15,  3,192,240,
-    71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,
-   228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121,
-    30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,
-   145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,
-   121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30,
-   107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,
-   230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,
-   174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,128,  6,185,174,107,
-   154,224,  0,  0,107,154,230,185,174,107,154,230,184,  0,107,128,  6,185,174,107,154,224,  0,  0,107,154,230,185,174,107,154,230,
-   185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,
-   107,154,230,185,174,107,154,230,185,174,107,128,  6,185,174,107,154,224,  0,  0,107,154,230,185,174,107,154,230,185,174,107,154,
-   230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,128,  6,185,
-   174,107,154,224,  0,  0,107,154,230,185,174,107,154,230,184,  0,107,128,  6,185,174,107,154,224,  0,  0,107,154,230,185,174,107,
-   154,230,185,174,107,154,230,185,174,107,154,230,184,  0,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,
-   185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,
-   107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,128,  6,185,174,107,154,224,  0,  0,107,154,
-   230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,
-   174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,
-   154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,184,  0,  0, 26,230,185,174,107,154,230,185,174,107,154,230,
-   185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,128,  0,  0,  0,
-   107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,
-   224,  0,  0,  0,  0,  0,  0,  0,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,
-   189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111,
-    91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,
-   245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,208,  0,  0,111, 91,214,245,189,111, 91,208,  0,  0,
-   110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,
-   134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,
-   184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110,
-    27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,
-   225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,
-    53, 13, 67, 80,212, 53, 13, 67, 80,212, 53, 13, 67, 80,212, 53, 13, 67, 80,212, 53, 13, 67, 80,212, 53, 13, 67, 80,212, 53, 13,
-    67, 80,212, 53,  0,  0,  0,  0, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,
-   211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,
-   205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,205, 51,
-    76,211, 52,205, 51, 79,226,248,190, 35, 76,211, 52,205, 51, 76,211, 52,205, 51, 76,211, 52,192,  0,  0,  0,  0,  0,  0,  0,  0,
-    92,151, 37,201,114, 92,151, 37,201,114, 92,151, 37,201,114, 92,151, 37,201,114, 92,151, 37,201,114, 92,151, 32,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  1,114, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,
-   115, 92,254, 47,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93, 23, 69,209,116, 93, 23, 69,209,116, 93, 23, 69,209,116, 93,
-    23, 69,209,116, 93, 23, 69,209,116,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93, 87, 85,213,117, 93, 87, 85,
-   213,117, 93, 87, 85,213,117, 93, 64,  5,213,117, 93, 64,  5,213,117,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214,
-    53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141,
-    99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,
-   214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 48,  0,  0, 88,214, 53,141, 99, 88,214, 53,
-   141, 99, 88,214, 48,  0,  0,  0,  0,  0,  0,  0, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 48,  0,  0,  0,  0,  0,  0,  0,
-    36, 73, 31,139,226, 36,126, 34, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73,
-    16,  0,  0,  0,  0,  0,  0,  0, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,
-   145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36,
-    73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18,
-    68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 64,  0,  0,  0,  0,  0,  0,  0,  0,
-    36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73,
-    18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,145, 36, 73, 18, 68,  0,  0,  0,  0,  0,  0,110, 27,134,225,
-   184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110,
-    27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,
-   225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184,110, 27,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,
-     5, 65, 80, 84, 21,  5, 64,  0, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80,  0,  0,  0,  0,  0, 84, 21,  5, 65,
-    80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80,  0,  0,  0,  0,  0, 84,  0,  0,  0,  0, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84,
-    21,  5, 65, 80, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,
-   133, 97, 88, 86, 21,133, 97, 88, 86, 16,  0,  0, 88, 86, 21,133, 97, 88, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150,
-    37,137, 98, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 37,137, 98,  0,  0,  0,  0,  0, 88,150, 37,137,
-    98, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 32,  0,  0,  0,
-     0,  0,  0,  0, 88,150, 37,137, 98, 88,150, 37,137, 98, 88,150, 37,136,  0,  0,  0,  5,137, 98, 88,214, 53,141, 99, 88,214, 53,
-   141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99, 88,214, 53,141, 99,
-    91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,
-   245,189,111,  0,  0,  5,189,111, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125,
-    95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,
-   213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,124,  0, 87,213,245,125, 95, 87,213,245,
-   125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,192,  0,  1, 95,
-    87,213,245,125, 95, 87,213,245,125, 95, 87,213,240,  0,  0,  0,  0,  0,  0,  0, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,
-   240,  0,  0,  0,  0,  0,  0,  0, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,245,125, 95, 87,213,240,  0,  0,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,
-   133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,
-   104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90,
-     0,  0,  0,  0, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,
-   161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,161,104, 90, 22,133,160,  0,
-    90,150,165,169,106, 90,150,165,169,106, 90,150,165,169,106, 90,150,165,169,106, 90,150,165,169,106, 90,150,165,169,106, 90,150,
-   165,169,106, 90,150,165,169,106, 90,150,165,169,106, 90,150,165,169,106, 90,150,165,169,106, 90,150,165,169,106, 90,150,165,169,
-   106, 90,150,165,169,106, 90,150,165,169,106, 90,150,165,169,106, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91,
-    86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,
-   181,109, 91, 86,213,181,109, 91, 86,213,181,109, 91, 86,213,181,109,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91, 86,213,181,109,
-    83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,
-   245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61,
-    79, 83,212,245, 61, 79,  0,  0,  0,  1, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,240,  0,  0,  0,
-    20,245, 61, 79, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84,
-    21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5,
-    55, 13,195,112,220, 55, 13,195,112,220, 55,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,
-     3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,
-   240, 60, 15,  3,192,240, 60, 15,  3,192,  0,  0, 15,  3,192,240, 90,150,165,169,106, 90,150,165,169,106,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0,  0,  0,  0,  0,  0,
-    53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,
-   115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 32,200, 50, 12,131, 32,220, 53,205,115, 92,215, 53,205,115, 92,
-   215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,
-   205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,204,131, 32,200, 50, 12,131, 92,215, 53,205,115,
-    32,200, 50, 12,131, 32,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 55, 13,115, 92,215, 53,205,115, 92,215,
-    53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,
-   115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,
-   215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,200,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-    50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,128,  0,  0, 50, 12,
-   131, 32,200, 50, 12,128,  0,  0, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,
-   200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,128,  0,  0, 50, 12,131, 32,200, 50,
-    12,128,  0,  0, 50, 12,131, 32,200, 50, 12,131, 32,200,  0, 12,128,  0,200,  0, 12,128,  0,200, 50, 12,131, 32,200, 50, 12,131,
-    32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,128,  0,  0,
-    50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,
-   131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,
-   200, 50,  0,  3, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50,  0,  3, 32,200, 50, 12,131, 32,200, 50,
-    12,131, 32,200, 50, 12,131, 32,200,  0,  0,  3, 32,200, 50, 12,131, 32,200,  0, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131,
-    32,200, 50, 12,131, 32,200, 50, 12,131, 32,200,  0,  0,  3, 32,200, 50,  0,  3, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,128, 15,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,141,112,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,215,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,
-   115, 92,215, 53,192,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 35, 35,226,248,190, 35, 92,215,248,190, 47,139,226,248,190, 35, 95,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 35, 95,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226, 53,205,115, 92,215, 53,205,115,
-    92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215,
-    53,205,115, 92,215, 53,205,115, 92,215, 53,254, 47,139,226,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,
-   168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234,
-    58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,
-   163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,
-   234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,142,163,168,234, 58,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0, 15,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  3,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-    56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78,
-    19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,
-   225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56,
-    78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 53,205,115, 92,215, 53,205,115,
-    92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215,
-    51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,
-   195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,
-   204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51,
-    12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195,
-    48,204, 51, 12,195, 48,204, 51, 12,195, 48,204, 51, 12,195, 48,204,  0,  0,  0,  0,  0,  0, 12,195, 48,204, 51, 12,195, 48,204,
-    60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,
-     3,192,240, 60, 15,  3,192,240, 60, 15,  3,192,240, 60, 15,  0,  0,240,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0, 30,  7,129,224,
-   120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,
-     7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,
-   224,120,  0,  0,  0,  0,  0,  0,  0,  0,  0,120, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,120,
-   107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,184,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,107,154,230,185,174,107,154,230,184,  0,107,154,230,185,174,107,154,230,184,  0,107,154,230,185,
-   174,107,154,230,184,  0,107,154,230,185,174,107,154,230,184,  0,107,154,230,185,174,107,154,230,184,  0,107,154,230,185,174,107,
-   154,230,184,  0,107,154,230,185,174,107,154,230,184,  0,107,154,230,185,174,107,154,230,184,  0, 55, 13,195,112,220, 55, 13,195,
-   112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    64,  1,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,
-    31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,
-   209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,
-    31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,
-   209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,
-    31, 71,209,244,125, 31, 71,209,244,125, 31, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,159, 79,137,244,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,159, 71,209,244,125, 31, 71,209,244,125, 31, 79,139,226,248,190, 36,121, 30,248,190, 47,139,
-   226,248,190, 47,139,226,125, 31, 71,209,244,248,190, 47,139,226,  0, 25,166,105,154,102,153,166,105,154,102,153,166,105,154,102,
-   153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,
-   105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,
-   102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,104,  0,  0, 62,
-    47,139,226,248,153,166,105,154,248,153,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,
-   155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,
-   217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,
-   109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,111,226,248,153,182,109,155,
-     0,  0,  0,  0,  0,  0, 17,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,
-   212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29,  0, 17,228,121,
-    30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,
-   145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,
-   121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30,
-    71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,120,  0,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117,
-    29, 71, 81,212,117, 29, 71, 81,212,117, 29, 71, 81,212,117, 29,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,
-    71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,
-   228,121, 30, 71,145,228,120,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226, 71,145,228,121, 30, 71,145,228,
-   121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,123,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,
-   109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,111,226,
-   102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,
-   182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,
-   155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,
-   217,182,109,155,102,217,182,109,155,102,217,182,109,155,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,
-   199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,
-   204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115,
-    28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199,
-    49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,
-   115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115,  0,  0,  0,  0,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,
-   199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,
-   204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 48,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 99,216,246, 61,143, 99,216,246, 61,143, 99,216,246, 61,143, 99,216,246, 61,143, 99,216,246, 61,143, 99,216,246,
-    61,143, 99,216,246, 61,143, 99,216,246, 61,143, 99,216,246, 61,143, 99,216,246, 61,143, 99,216,246, 61,143, 99,216,246, 61,143,
-   117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,
-   103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,
-   214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,
-   157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103,
-    89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,
-   117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,
-   103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55,
-    13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,
-   112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220,
-    55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,
-   195,112,220, 55, 13,195,112,220,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,
-   179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,
-   219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,
-   205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 35, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,
-   215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,
-   205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115,
-    92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215,
-    53,205,115, 92,215, 53,205,115, 92,215,248,190, 47,136,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,
-   115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,
-   215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,  0,  0,
-     0,  0,  0,  0, 53,205,112,  0,215,  0, 13,115, 92,215, 53,205,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215,
-    79, 19,196,241, 60, 79, 19,196,241, 60, 79, 19,196,241, 60, 79, 19,196,241, 60, 79, 19,196,241, 60, 79, 19,196,241, 60, 79, 19,
-   196,241, 60, 79, 19,196,241, 60, 79, 19,196,241, 60, 79, 19,196,241, 60, 79, 19,196,241, 60, 79,  0,  0,  0,  0,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 32,  0,  0,  0,  0,  0,  0,  0, 82,212,181, 45, 75, 82,212,181, 45, 75, 82,212,181, 45, 75, 82,
-   212,181, 45, 75, 82,212,181, 45, 75, 82,212,181, 45, 75, 82,212,181, 45, 75, 82,212,181, 45, 75, 82,212,181, 45, 75, 82,212,181,
-    45, 75, 82,212,181, 45, 75, 82,212,181, 45, 75, 82,212,181, 45, 75, 82,212,181, 45, 75,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,
-   133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97,
-    88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,128,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  5, 97, 88, 86, 21,133, 97, 88, 86, 21,133, 97, 88, 86, 21,128,  0,  0,  0,  0,  0,  0,  0, 78,211,180,237, 59, 78,211,180,
-   237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59, 78,211,180,237, 59,
-    89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86,
-    85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 95,137,101, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,107, 71,145,228,121, 30, 71,145,228,
-   121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,128,  0,  0,  0,
-    90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,
-   149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,
-   105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90,
-    86,144,  3,226, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,144,  0,  0,  0,  0,  5,165,105, 87,149,229,121, 94, 87,149,229,
-   121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,120,  0,
-    89,150,101,153,102, 89,150,101,153,102, 89,150,101,153,102, 89,150,101,153,102, 89,150,101,153,102, 89,150,101,153,102, 89,150,
-   101,153,102, 89,150,101,153,102, 89,150,101,153,102, 89,150,101,153,102, 89,150,101,153,102, 89,150,101,153,102, 89,150,101,153,
-   102, 89,150,101,152,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,150,101,153,102, 89,150,101,153,102, 89,150,101,153,102, 89,
-   150, 96,  0,  0, 89,150,101,153,102, 89,150,101,153,102, 89,150, 96,  0,  0, 89,150,101,153,102, 87,149,229,121, 94, 87,149,229,
-   121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94, 87,149,229,121, 94,
-    89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,
-   117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,
-   103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,157,103, 89,214,117,156,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,103, 89,214,117,157,103, 84, 85, 21, 69, 81, 84, 85, 21,
-    69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0, 26,230,185,174,107,154,230,184,  0,  0, 26,230,185,174,107,154,230,184,  0,  0, 26,230,185,174,107,154,230,184,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,107,154,230,185,174,107,154,230,184,  0,107,154,230,185,174,107,154,230,184,  0, 53,205,115, 92,
-   215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,
-   205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 95,226, 53,205,115, 92,215, 53,205,115, 92,215, 53,204,131,
-    92,215, 53,205,127,139,226,  0,  0,  0,  0,  0,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,
-   111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,
-   214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,
-   189,111, 91,214,245,189,111, 91,214,245,189,111, 91,214,245,189, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84,
-    85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 21,
-    69, 81, 84, 85, 21, 69, 81, 84, 85, 16,  0,  0, 84, 85, 21, 69, 81, 84, 85, 21, 69, 81, 84, 85, 16,  0,  0,  0,  0,  0,  0,  0,
-    71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,
-   228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,145,228,121,
-    30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,120,  0,  0,  0,  0,  1, 30, 71,
-   145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,
-   121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,
-    31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,
-   209,244,125, 31, 71,209,244,125, 31, 64,  0,  0,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,
-    31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    53,205,115, 92,215, 53,205,115, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,230, 57,142, 99,152,230,  0,  0,
-     0,  0,  0,  0,  7,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,
-   125, 31, 71,209,244,  0, 31, 71,209,244,125, 31, 64,  1,244,  0, 31, 71,208,  0,125, 31, 64,  1,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-    40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,
-     2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,
-   160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-    40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,
-     2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,
-   160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40,
-    10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-    40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,
-     2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,
-   160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10, 15,139,226, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40,
-    10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-    40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,  0,  0,  2,128,160, 40, 10,  2,128,160, 40, 10,
-     2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,
-   160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    32,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 35,112,220,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,136,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   136,  0,248,190, 47,139,226,  0,  0,  0,  0,  0, 40, 10,  2,128,160, 40,  0,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160,
-    40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,
-     2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,
-   160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40,
-    10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40,  0,  0,  3,226,
-     0, 62, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,141,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,
-   215, 53,205,115, 92,215, 53,205,115, 95,226,248,190, 47,139,226,248,141,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,
-   205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 95,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 38,
-   109,155,102,217,182,109,155,102,217,182,109,155,248,153,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,
-   102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,
-   182,109,155,102,217,191,139,226, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,121,
-    30, 71,145,228,121, 30, 71,145,228,121, 30, 71,145,228,120,  0,  0,  0,  4,121, 30, 71,145,228,121, 30,  0,  0,  4,121, 30, 71,
-   145,228,121, 30,  0,  0,  4,121, 30, 71,145,228,121, 30,  0,  0,  4,121, 30, 71,128,  0,  0,  0,248,190, 47,139,226,248,190, 47,
-   136,  0,248,190, 47,139,226,248,190, 47,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62, 47,139,226,248,190, 32,  0,  0,
-   100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,  0, 25, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89,
-    22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 68,  0,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,
-   145,100, 89, 22, 69,145,100, 89, 22, 68,  0,100, 89, 16,  1,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100,
-    89, 16,  0,  0,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89,
-    22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,
-   145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100,
-    89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22,
-    69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 69,145,100, 89, 22, 68,  0,  0,  0,  0,  0,  0,
-   248,190, 47,136,  0,  0,  0,  0,  3,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,  0,  0,  0,  3,226,248,190, 47,139,226,248,190, 47,139,226, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50,
-    12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131,
-    32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200,
-    50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,  0,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,128,  0,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,
-    50,140,163, 40,202, 50,140,163, 40,202, 50,140,163, 40,202, 50,140,163, 40,202, 50,140,163, 40,202, 50,140,163, 40,202, 50,140,
-   163, 40,202, 50,128,  0,  0,  0, 50, 76,147, 36,201, 50, 76,147, 36,201, 50, 76,147, 36,201, 50, 76,147, 36,201, 50, 76,147, 36,
-   201, 50, 76,147, 36,201, 50, 76,147, 36,201, 50, 76,147, 36,201, 50, 76,147, 36,201, 50, 76,147, 36,201, 50, 76,147, 36,201, 50,
-    76,147, 36,201, 50, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,
-    52,141, 35, 72,210, 52,141, 35, 72,210, 52,141, 35, 72,210, 52,141, 35, 72,210, 52,141, 35, 72,210, 52,141, 35, 72,210, 52,141,
-    35, 72,210, 52,141, 35, 72,210, 52,141, 35, 72,210,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13, 35, 72,210, 51,140,227, 56,
-   206, 51,140,227, 56,206, 51,140,227, 56,206, 51,140,227, 56,206, 51,140,227, 56,206, 51,140,227, 56,206, 51,140,227, 56,  0,  0,
-     0,  0,  0,  0, 56,206, 51,140,227, 56,206, 51,140,227, 56,206, 51,140,227, 56,206, 51,140,227, 56,206, 51,140,227, 56,206, 51,
-   140,227, 56,206, 51,140,227, 56,206, 51,140,227, 56,206, 51,140,227, 56,206, 51,140,227, 56,206, 51,140,  0,  0,  0,  0,  0,  0,
-    10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,  0, 40,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120,
-    30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  7,129,224,120, 30,  0,  0,  0,  0,  0,  7,129,224,120, 30,  7,
-   129,224,120, 30,  7,129,224,120, 30,  7,129,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,
-   163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,
-   250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,143,163,232,250, 62,
-   143,163,232,250, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,
-   101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25,
-    65, 16, 68, 17,  4, 65, 16, 68, 17,  4, 65, 16, 68, 17,  4, 65, 16, 68, 17,  4, 65, 16, 68, 17,  4, 65, 16, 68, 17,  4, 65, 16,
-    68, 17,  4, 65, 16, 64,  0,  0, 65, 16, 68, 17,  4, 65, 16, 68, 17,  4, 65, 16, 64,  0,  0,  0,  0,  0,  0,  0, 54,205,179,108,
-   219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,
-   205,179,108,219, 54,205,179,108,219,  0,  0,  0,  0,  0, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,
-   108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219,  0,  0,  0,  0,  0,
-    56,142, 35,136,226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142,
-    35,136,226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142, 35,136,226,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,206,243,188,
-   239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,
-   206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,239, 57, 14, 67,144,228, 57, 14, 67,144,228, 57, 14, 67,144,  0, 57, 14, 67,144,228,
-    57, 14, 67,144,228, 57, 14, 67,144,228, 57, 14, 67,144,  0, 57, 14, 67,144,228, 57, 14, 67,144,  0, 57, 14, 64,  0,228, 57, 14,
-    67,144,228, 57, 14, 67,144,228, 57, 14, 64,  0,228, 57, 14, 67,144,228, 57, 14, 67,144,228, 57, 14, 67,144,228, 57, 14, 64,  0,
-   228, 57, 14, 67,144,228, 57, 14, 64,  0,228, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,
-     6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,
-   144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100,
-    25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6,
-    65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,
-   100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,
-     6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,
-   144,100, 25,  6, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100,
-    25,  6, 65,144,100, 25,  6, 65,144,100, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100, 25,  6, 65,144,100, 25,  6,
-    65,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    53,205,115, 92,215, 53,205,112,  0,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,
-   115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,192,  3, 92,
-   215, 53,205,115, 92,215, 53,205,115, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   100,217, 54, 77,147,100,217, 48,  0,  0,100,192,  6, 77,147,100,217, 54, 77,147,100,217, 54, 77,147,100,217, 54, 77,147,100,217,
-    54, 77,147,100,217, 54, 77,147,100,217, 54, 77,147,100,217, 54, 77,147,100,217, 54, 77,147,100,217, 54, 77,147,100,217, 54, 77,
-   147,100,217, 48,  1,147,100,192,  0,  0,  0,100,192,  0,  1,147, 31,  7,193,240,124, 31,  7,193,240,124, 31,  7,193,240,124, 31,
-     7,193,240,124, 31,  7,193,240,124, 31,  7,192,  0,124, 31,  7,193,240,124, 31,  7,193,240,124, 31,135,225,248,126, 31,135,225,
-   248,126, 31,135,225,248,126, 31,135,225,248,126, 31,135,225,248,126, 31,135,225,248,126, 31,135,225,248,126, 31,135,225,248,126,
-    39,201,242,124,159, 39,201,242,124,159, 39,201,242,124,159, 39,201,242,124,159, 39,201,242,124,159, 39,201,242,124,159, 39,201,
-   242,124,159, 39,201,242,124,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,159, 39,201,242,124,159, 39,201,242,124,159,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,199,241,252,127, 31,199,241,
-   252,127, 31,199,241,252,127, 31,199,241,252,127, 31,199,241,252,  0, 31,199,240,  0,  0,  0,  0,  0,  0,127, 31,199,241,252,127,
-    28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199, 49,204,115, 28,199,
-    49,204,115,  0,  0,  0,  0,115, 29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,208,
-   116, 29,  7, 65,208,116, 29,  7, 64,  0,  0,  0,  0,  0,  0,116,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6,
-    65,144,100, 25,  6, 65,144,100, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,
-   101, 25, 70, 81,148,101,  0,  0,  0,  0,  0, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25,
-    70, 81,148,101,  0,  0,  1,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,
-   148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101,
-    76, 83, 20,197, 49,  0, 19, 20,196,  0,  0,  0,  0,  0,  0, 76, 83, 20,197, 49, 76, 83, 20,197, 49,  0, 19, 20,197, 49,  0, 19,
-    20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197,
-    49, 76, 83, 16,  0,  0, 76, 83, 20,196,  0,  0,  0,  0,  1, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76, 64,  0,  0,  0,  0,
-     0,  0,  0,  0, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76, 64,  0,  0,  0,  0,  0,  0,  0,  0, 26, 70,145,164,105, 26, 70,145,
-   164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105,
-    26,134,161,168,106, 26,134,161,168,106, 26,134,161,168,106, 26,134,161,168,106, 26,134,161,168,106, 26,134,161,168,106, 26,134,
-   161,168,106, 26,134,161,168,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,200,178, 44,139, 34,200,178, 44,139, 34,200,178, 44,139, 34,
-   200,178, 44,139, 34,200,178, 44,139, 34,200,178, 44,139, 34,200,178, 44,139, 34,200,178, 44,139, 34,200,178, 44,139, 34,200,178,
-    44,  0,  0,  0,  0,  0,139, 34,200,178, 44,139, 34,200,178, 44,139, 34,200,178, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    33,136, 98, 24,134, 33,136, 98, 24,134, 33,136, 98, 24,134, 33,136, 98, 24,134, 33,136, 98, 24,134, 33,136, 98, 24,134, 33,136,
-    98, 24,134, 33,136, 98, 24,134, 33,136, 98, 24,134, 33,136, 98, 24,134, 33,136, 98, 24,134, 33,136, 98, 24,134, 33,136, 98, 24,
-   134, 33,136, 96,  0,  0,  0,  8, 98, 24,134, 33,136, 98, 24,134, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,
-   136, 34,  8,130, 32,136, 34,  8,130, 32,136, 32,  0,  0, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,200, 50, 12,131, 32,200, 50,
-    12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,  0,  0,  0,  0,  0,  0, 32,200, 50, 12,131, 32,200, 50, 12,131,
-    33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 64,  0,  0,  0,  0,  0,  0,  0,  0,  8,
-    66, 16,132, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8, 66, 16,132, 33,  8, 66, 16,132,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,202,
-   242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,
-   175, 43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,202,242,188,175, 43,192,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,
-     2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44,
-    11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,
-   192,176, 44, 11,  2,192,176, 44, 11,  2,192,176, 44, 11,  2,192,  0,  0,  0,  0,  0,  0,  0,  0,  2,192,176, 44, 11,  2,192,176,
-    41,202,114,156,167, 41,202,114,156,167, 41,202,114,156,167, 41,202,114,156,167, 41,202,114,156,167, 41,202,114,156,167, 41,202,
-   114,156,167, 41,202,114,156,167, 41,202,114,156,167, 41,202,114,156,167,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,202,114,156,
-   167, 41,202,114,156,167, 41,202,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40, 10,  2,128,160, 40, 10,  2,
-   128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,  0,
-    48, 12,  3,  0,192, 48, 12,  3,  0,192, 48, 12,  3,  0,192, 48, 12,  3,  0,192, 48, 12,  3,  0,192, 48, 12,  3,  0,192, 48, 12,
-     3,  0,192, 48, 12,  3,  0,192, 48, 12,  3,  0,192, 48, 12,  3,  0,192, 48, 12,  0,  0,192, 48, 12,  0,  0,  0, 48, 12,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  2,128,160,
-    35,136,226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142, 35,136,
-   226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142, 35,136,226, 56,142,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35, 72,210, 52,
-   141, 35, 72,210, 52,141, 35, 72,210, 52,141, 35, 72,210, 52,141, 35, 72,210, 52,141, 35, 72,210, 52,141, 35, 72,210, 52,141, 35,
-    72,210, 52,141, 35, 72,210, 52,141, 35, 72,210, 52,141, 35, 72,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,200,242, 60,143, 35,200,242, 60,143, 35,200,242, 60,143, 35,200,242, 60,143,
-    35,200,242, 60,143, 35,200,242, 60,143, 35,200,240,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27, 70,209,180,
-   109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,109,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  8,  2,  0,128, 32,  8,  2,
-     0,128, 32,  8,  2,  0,128, 32,  8,  2,  0,128, 32,  8,  2,  0,128, 32,  8,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,
-   196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177,
-    44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75,
-    18,192,  0,  0,  0,  0,  4,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,
-   177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,196,177, 44, 75, 18,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1, 44,
-    79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,
-   212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245,
-    61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,245, 61, 79, 83,212,244,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    19,208,  0,  0, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,230,
-    57,142, 99,128,  0,  0,  0,  0,  0,  0,  0,  0, 99,152,230, 57,142, 99,152,230, 57,142, 99,152,224,  0,  0,  0,  0,  0,  0,  0,
-    87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,
-   213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117,
-    93, 87, 64,  5,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 78,147,164,233, 58, 78,147,164,233, 58, 78,147,164,233, 58, 78,147,164,233, 58, 78,147,164,233, 58, 78,147,164,
-   233, 58, 78,147,164,233, 58, 78,147,164,233, 58, 78,147,164,233, 58, 78,147,164,232,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,
-   244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253,
-    63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,
-   211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63, 79,211,244,253, 63,  0, 21,197,113, 92, 87, 21,197,
-   113, 92, 87, 21,197,113, 92, 87, 21,197,113, 92, 87, 21,197,113, 92, 87,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 32,  1, 66, 80,148, 37,  9, 66, 80,148,
-    37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9,
-    66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    80,212, 53, 13, 67, 80,212, 53, 12,  0, 80,192,  5, 13, 67, 80,212, 48,  1, 67, 80,212, 53, 13, 67, 80,212, 53, 13, 67, 80,212,
-    53, 13, 67, 80,212, 48,  1, 67, 80,212, 53, 13, 67, 80,212, 53, 13, 67, 80,212, 48,  0,  0,  0,  0,  0,  0,  0, 79,147,228,249,
-    62, 79,147,228,249, 62, 79,147,228,249, 62, 79,147,228,249, 62, 79,147,228,249, 62, 79,147,228,249, 62, 79,147,228,249, 62, 79,
-   147,228,249, 62, 79,147,228,249, 62, 79,147,228,249, 62, 79,147,228,249, 62, 79,147,228,249, 62, 79,147,228,249, 62, 79,147,228,
-   249, 62, 79,147,228,248,  0,  0,  0,  0,  0,  0, 79,147,228,249, 62, 79,147,228,249, 62, 79,147,224,  0,  0,  0,  0,  0,  0,  0,
-    85,213,117, 93, 87,  0, 21,117, 93, 87, 85,213,117, 93, 87, 85,192,  0,  1, 87, 85,192,  0,  1, 87, 85,213,117, 93, 87, 85,213,
-   117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,192,  5, 93, 87, 85,213,117, 93, 87, 85,192,  5, 93,
-    87,  0, 21,117, 93, 87, 85,213,112,  3,226, 85,213,117, 93, 87, 85,213,117, 93, 87, 85,192,  0,  1, 87, 85,192,  0,  1, 87, 85,
-   213,112,  0,  0, 85,192,  0,  0,  0,  0,  0,  0,  1, 87,  0,  0,  0,  0,  0,  0, 21,117, 93, 87, 85,213,117, 93, 87,  0,  0,  5,
-    93, 87, 85,213,117, 93, 87, 85,192,  0,  0,  0, 85,213,117, 93, 87, 85,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,
-   213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53,
-    77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83,
-    84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77,  0, 20,213, 53, 77, 83, 84,208,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,
-   101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25,
-    70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148,101, 25, 70,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 81,148,101, 25, 70, 81,148,101, 25, 70, 81,148, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,
-   228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185,
-    46, 75,146,224,  0,  0, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,
-   146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,228,185, 46, 75,146,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20,
-    69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17,
-    68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 81, 20, 69, 17, 68, 81, 20, 69, 17, 68, 81, 20, 64,  0,  0,  0,  0,  0,  0,  0, 36, 73, 18, 68,145, 36, 73, 18,
-    68,145, 36, 73, 18, 68,145, 36, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84,
-    21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 21,  5,
-    65, 80, 84, 21,  5, 65, 80, 84, 16,  0,  0,  0,  0,  0,  0,  0, 80, 84, 21,  5, 65, 80, 84, 21,  5, 65, 80, 84, 16,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149,
-    37, 72,  0,  0, 21, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82,  0,  0,  0,  0,  0, 84,149, 37, 73,
-    82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 72,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    82, 20,133, 33, 72, 82, 20,133, 33, 72, 82, 20,133, 33, 72, 82, 20,133, 33, 72, 82, 20,133, 33, 72, 82, 20,133, 33, 72, 82, 20,
-   133, 33, 72, 82, 20,133, 33, 72, 82, 20,133, 33, 72, 82, 20,133, 33, 72, 82, 20,133, 33, 72, 82, 20,133, 33, 72, 82, 20,133, 33,
-    72, 82, 20,133, 33, 72, 82, 20,133, 33, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,
-     6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,
-   144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100,
-    25,  6, 65,144,100, 25,  6, 65,144,100, 25,  6, 65,144,100, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  6,
-    85,149,101, 89, 86, 85,149,101, 88,  0,  0, 21, 96,  0,  0, 85,149,101, 89, 86, 85,149,101, 89, 86,  0, 21,101, 88,  0, 85,149,
-   101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 89,
-    86, 85,149, 96,  1, 86, 85,128,  0,  1, 86, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149,101, 88,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 85,149,101, 89, 86, 85,149,101, 89, 86, 85,149, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 77,211,116,221, 55, 77,211,116,221, 55,  0,  0,  4,221, 55, 77,211,116,221, 55, 77,211,116,221,
-    55, 77,211,116,221, 55, 77,211,116,221, 55, 77,211,116,221, 55, 77,211,116,221, 55, 77,211,116,221, 55, 77,211,116,221, 55, 77,
-   211,116,221, 55, 77,211,116,221, 55, 77,211,116,221, 55,  0,  0,  4,221, 55, 77,211,116,221, 55, 77,211,116,221, 55, 77,192,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213,
-    53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77,
-    83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83, 84,213, 53, 77, 83,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149,
-    37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73,
-    82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 37, 73, 82, 84,
-   149, 37, 73, 82, 84,149, 37, 73, 82, 84,149, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,110, 27,134,225,
-   184,110, 27,134,225,184,110, 27,134,225,184,110, 27,134,225,184, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,
-   208,116, 29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,208,116,
-    29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,208,116, 29,  7, 65,192,  0,  0,  0,  0,  0,  0,  0,  0,
-    78,211,180,237, 59, 78,211,180,237, 59, 78,211,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    83,148,229, 57, 78, 83,148,229, 57, 78, 83,128,  5, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,
-   229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57,
-    78, 83,148,229, 56,  0, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,224,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229,
-    57, 78, 83,148,229, 57, 78, 83,128,  0,  0,  0, 83, 20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76,
-    83, 20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76,  0,  0,  5, 49, 76, 83, 20,197, 49, 76, 83, 20,
-   197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49, 76,  0, 20,197, 49, 76, 83, 20,197, 49, 76, 83, 20,197, 49,
-    76, 83, 20,197, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    78, 83,148,229, 57, 78, 83,148,228,  0, 78, 83,144,  1, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,
-   148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,148,229,
-    57, 78, 83,148,228,  0,  0,  0,  4,228,  0, 78, 83,144,  1, 57, 78, 83,148,229, 57, 78, 83,148,229, 57,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 78, 83,148,229, 57, 78, 83,148,229, 57, 78, 83,144,  0,  0,  0,  0,  0,  0,  0, 78, 19,132,225, 56, 78, 19,128,
-     1, 56, 78,  0,  4,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56,
-    78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,224,  0, 78, 19,128,  1, 56, 78, 19,132,225, 56, 78,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,150,229,185,110, 91,150,229,
-   185,110, 91,150,229,185,110, 91,150,229,185,110, 91,150,229,185,110, 91,150,229,185,110, 91,128,  0,  0,  0,  0,  0,  0,  0,  0,
-    92, 23,  5,193,112, 92, 23,  5,193,112, 92, 23,  5,193,112, 92, 23,  5,193,112, 92,  0,  5,193,112, 92, 23,  5,193,112, 92, 23,
-     5,193,112, 92, 23,  5,193,112, 92, 23,  5,193,112, 92, 23,  5,193,112, 92, 23,  5,193,112, 92, 23,  5,193,112, 92, 23,  5,193,
-   112, 92, 23,  5,193,112, 92, 23,  5,192,  0,  0,  0,  5,193,112, 92, 23,  5,193,112, 92, 23,  5,193,112, 92, 23,  5,193,112, 92,
-    23,  5,193,112, 92, 23,  5,193,112, 92, 23,  5,193,112, 92, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99,192,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,
-   149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,165,
-   105, 90, 86,149,165,105, 90, 86,149,165,105, 90, 86,149,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1, 90,
-     5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1,
-    64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80,
-    20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,
-     1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64,
-    80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,
-     5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1,
-    64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1,
-    64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80,
-    20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,
-     1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64,
-    80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80,  0,  5,  1, 64, 80, 20,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1,
-    64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80,
-    20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,153, 38, 73,146,100,153, 38, 73,146,100,153,
-    38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,
-   146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,
-   153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38,
-    73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131,
-    32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200,
-    50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,
-   131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,
-   200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50,
-    12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131,
-    32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200,
-    50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,
-   131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,
-     1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64,
-    80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,
-     5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1,
-    64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80,
-    20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,
-     1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64,
-    80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64, 80, 20,  5,  1, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219,
-    54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,
-   179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,
-   219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,
-   205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,
-   108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219,
-    54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,179,108,219, 54,205,
-   179,108,219, 54,205,179,108,192,  0,  0,  0,  0,  0,  0,  0,  0, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66,
-    16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 33,  8, 66, 16,132, 32,  0, 66, 16,132, 33,  8, 66, 16,132,
-    33,  8, 66, 16,128,  0,  0,  0,  0,  4, 33,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,
-   130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,
-   136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,
-     8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 32,  0,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,128,  0,  0,  0,
-     0,  0,  0,  0, 64,208, 52, 13,  3, 64,208, 52, 13,  3, 64,208, 52, 13,  3, 64,208, 52, 13,  3, 64,208, 52, 13,  3, 64,208, 52,
-    13,  3, 64,208, 52, 13,  3, 64,208, 48,  0,  0, 64,208, 52, 13,  3, 64,208, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156,
-    39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,
-   194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 32,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 32,  1,194,112,156, 39,  9,194,112,156, 32,  1,194,112,156, 39,
-     9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,  0,  0,  0,  0,  0,  0, 28, 39,  9,194,
-   112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,112,156, 39,  9,194,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66,
-    80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148,
-    37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9,
-    66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,148, 37,  9, 66, 80,
-   148, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,
-   164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105,
-    26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,104,  0,  0,
-     0,  0,  1, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,
-   105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,164,105, 26,
-    70,145,164,105, 26, 70,145,164,105, 26,  0,  0,  0,  0,  0,  0,  0,  0,  1, 26, 70,145,164,105, 26, 70,145,164,105, 26, 70,145,
-   164,105, 26, 70,145,164,105, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,130, 31, 55,209,244, 72,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,125, 31, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,
-   136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,
-     8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130,
-    32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136,
-    34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,
-   130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,
-   136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,
-     8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130,
-    32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136,
-    34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,130, 32,136, 34,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,
-     4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129,
-    32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72,
-    18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,
-   129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32,
-    72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,
-     4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129,
-    32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  4,129, 32, 72,
-    18,  4,129, 32, 72, 18,  4,129, 32, 72, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   130, 32,136, 34,  8,130, 32,136, 34,  8,130,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,102,217,182,109,155,  0, 25,182,109,155,102,217,182,109,155,  0, 25,182,108,  0,
-   102,217,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,
-   166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,
-   154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,
-   153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,
-   105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,
-   102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,
-   166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,
-   154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,
-   153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,
-   105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,
-   102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,166,105,154,102,153,
-   166,105,154,102,153,166,105,154,102,217,182,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,104,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,102,153,166,104,  0,  0, 25,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,102,217,182,
-   109,155,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,
-   124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223,
-    55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,
-   243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,
-   223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,
-   205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,
-   124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223,
-    55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,
-   243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,
-   223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,
-   205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,124,223, 55,205,243,  0,  0,  0,  0,  0,
-   188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239,
-    59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,
-   243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,
-   239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,
-   206,243,188,239, 59,204,  0,  0,  0,  0,  0,  0,188,239, 59,206,243,188,239, 59,206,243,188,239, 59,206,243,188,192,  0,  0,  0,
-   188,239, 59,206,243,188,239, 59,206,243,188,192,  0,  0,  0,  0,  0,  0,  0,  0,188,239, 59,206,243,188,239, 59,206,243,188,239,
-    48,  0,  0,188,239, 59,206,243,248,190, 47,139,226,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0,  0, 62, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,
-   131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,
-   200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,131, 32,200, 50, 12,128,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,128,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,128, 15,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,128, 15,139,226,  0,  0, 15,136,  0,  0, 62, 47,136,  0,  0, 62, 47,139,226,248,128, 15,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 32,  3,226,  0, 62, 47,139,226,248,190, 47,139,226,  0, 62, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 32,  3,226,248,190, 47,136,  0,  0, 62, 47,139,226,248,190, 47,139,226,248,128, 15,139,226,248,190,
-    47,139,226,248,128, 15,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 32,  3,226,248,190, 47,136,  0,248,190, 47,139,226,248,128, 15,136,  0,  0,  0, 15,139,226,248,
-   190, 47,139,226,248,128, 15,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,
-     0, 15,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-    23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,
-   241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124,
-    95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,
-   197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,
-   124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95,
-    23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 95, 23,197,241,124, 95,  0,  5,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95, 23,197,241,124, 95,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,115, 92,215, 53,205,
-   115, 92,215, 53,205,115, 92,  0,  0,  0,  0,  0,  0,  0, 13,115, 92,215, 53,205,115, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    56, 78, 19,132,225, 56, 78, 19,132,  0, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 78, 19,132,225, 56, 64,
-     0,  0,225, 56, 78, 19,132,225, 56, 78, 16,  0,225, 56, 64,  3,132,225, 56, 78, 19,132,  0,  0,  0,  0,  0,  0, 55, 13,195,112,
-   220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55,
-    13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,
-   112,220, 55, 13,195,112,220, 55, 13,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,220,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220,
-    55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 55, 13,195,112,192,  0,  0,  0,112,220, 55, 13,
-   195,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 48,  0,  0,112,220, 55, 13,195,112,220, 55, 13,195,112,220, 48,  0,  0,  0,
-     0,  7, 13,195,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,
-   100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,153, 38, 73,146,100,152,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,
-   209,180,109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,
-   109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,180,109, 27, 70,209,176,  0,  0,  0,  0,  0,  1, 27,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 73,210,116,157, 39, 73,210,116,157, 39, 73,210,116,157, 39, 73,210,116,157, 39, 73,210,116,157, 39, 73,210,116,
-   157, 39, 73,210,116,157, 39, 73,210,116,157, 39, 73,210,116,157, 39, 73,210,116,157, 39, 73,210,112,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,107,154,230,185,174,107,154,230,
-   184,  0,107,154,230,185,174,  0, 26,230,184,  0,107,154,230,185,174,107,154,230,185,174,107,154,230,185,174,107,154,230,184,  0,
-   109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,
-   102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,
-   182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,
-   155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,
-   217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,
-   109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,
-   102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,
-   182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,155,102,217,182,109,128,  0,  1,182,109,155,102,217,182,109,
-   155,102,217,182,109,155,102,217,182,109,155,102,216,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138,
-    98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,
-   166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 98,152,166,  0,
-     0,  0,  0,  0, 41,138, 98,152,166, 41,138, 98,152,166, 41,138, 96,  0,  0,  0,  0,  2,152,166,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0, 62, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    40, 10,  2,128,160,  0, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,
-     2,128,160, 40, 10,  2,128,160,  0, 10,  2,128,  0, 40,  0,  0,  0,160,  0, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,
-     0, 40, 10,  2,128,160,  0, 10,  0,  0,160,  0,  0,  0,  0,  0,  0,  0,  2,128,  0,  0,  0,  0,  0,160,  0, 10,  0,  0,160,  0,
-    10,  2,128,160,  0, 10,  2,128,  0, 40,  0,  0,  0,160,  0, 10,  0,  0,160,  0, 10,  0,  0,160,  0, 10,  2,128,  0, 40,  0,  0,
-     0,160, 40, 10,  2,128,  0, 40, 10,  2,128,160, 40, 10,  2,128,  0, 40, 10,  2,128,160,  0, 10,  2,128,160, 40,  0,  2,128,  0,
-    40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  0,  0,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,  2,128,160, 40, 10,
-     2,128,160,  0,  0,  0,  0,  0,  0, 10,  2,128,160,  0, 10,  2,128,160, 40, 10,  0,  0,160, 40, 10,  2,128,160, 40, 10,  2,128,
-   160, 40, 10,  2,128,160, 40, 10,  2,128,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0,  0, 62, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0, 62, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,  0, 62, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   102,190, 47,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,128,  0,  0,  0,  0,
-     0,  0,  0,  0,248,190, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 32,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,128,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,128,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0,  0,  0,  0,  3,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,248,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,248,190, 32,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 32,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,128,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,128,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  3,226,248,190, 47,139,226,248,190, 32,  0,  0,  0,  0,  0,  0,  0,  0,
-     0, 15,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,
-   139,226,248,128,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,128,  0,  0,  0,  0,  0,  0,  0,  0,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,136,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 32,  0,  0,  0,  0,  0,  0,  0,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,
-    31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 64,  0,  0,  0,  0,  0,  0,  0,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,
-    31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,
-   209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 64,  0,  0,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,
-    31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,
-   209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,
-    31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,
-   209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,
-    31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,
-   244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,208,  0,  0,
-     0,  0,  0,  0,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,
-   209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,
-   125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31,
-    71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,125, 31, 71,209,244,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0, 62, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,
-   248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190,
-    47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,
-   226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,
-   190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,139,226,248,190, 47,
-   139,226,248,190, 47,139,226,248,190, 47,139,226,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-
-} // namespace detail
 
 enum class unicode_script : uint16_t {
     Adlam = 166,
@@ -1665,31 +187,5 @@ enum class unicode_script : uint16_t {
     return lhs.intrinsic() == std::to_underlying(rhs);
 }
 
-[[nodiscard]] constexpr iso_15924 ucd_get_script(char32_t code_point) noexcept
-{
-    constexpr auto max_code_point_hi = detail::ucd_scripts_indices_size - 1;
-
-    auto code_point_hi = code_point / detail::ucd_scripts_chunk_size;
-    auto const code_point_lo = code_point % detail::ucd_scripts_chunk_size;
-
-    if (code_point_hi > max_code_point_hi) {
-        code_point_hi = max_code_point_hi;
-    }
-
-    auto const chunk_index = load_bits_be<detail::ucd_scripts_index_width>(
-        detail::ucd_scripts_indices_bytes,
-        code_point_hi * detail::ucd_scripts_index_width);
-
-    // Add back in the lower-bits of the code-point.
-    auto const index = (chunk_index * detail::ucd_scripts_chunk_size) + code_point_lo;
-
-    // Get the canonical combining class from the table.
-    auto const value = load_bits_be<detail::ucd_script_width>(
-        detail::ucd_scripts_bytes, index * detail::ucd_script_width);
-
-    return iso_15924{value};
-}
-
-
 }} // namespace hi::v1
 
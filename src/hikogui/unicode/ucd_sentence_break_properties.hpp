@@ -13,673 +13,6 @@ hi_export_module(hikogui.unicode.ucd_sentence_break_properties);
 
 hi_export namespace hi {
 inline namespace v1 {
-namespace detail {
-
-constexpr auto ucd_sentence_break_properties_chunk_size = 256_uz;
-constexpr auto ucd_sentence_break_properties_index_width = 8_uz;
-constexpr auto ucd_sentence_break_properties_indices_size = 3587_uz;
-constexpr auto ucd_sentence_break_property_width = 4_uz;
-
-static_assert(std::has_single_bit(ucd_sentence_break_properties_chunk_size));
-
-constexpr uint8_t ucd_sentence_break_properties_indices_bytes[3603] = {
-     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 17, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
-    31, 32, 33, 34, 35, 33, 33, 36, 33, 37, 33, 33, 38, 39, 40, 33, 41, 42, 33, 33, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 43, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 44, 17, 45, 46, 47, 48, 49, 50, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 51, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 17, 52, 53, 17, 54, 55, 56,
-    57, 58, 59, 60, 61, 62, 17, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 33, 83, 84, 85, 86,
-    17, 17, 17, 87, 88, 89, 33, 33, 33, 33, 33, 33, 33, 33, 33, 90, 17, 17, 17, 17, 91, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 17, 17, 92, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 17, 17, 93, 94, 33, 33, 95, 96, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 97, 17, 17, 17, 17, 98, 99, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,100, 17,101,102, 33, 33, 33, 33, 33, 33, 33, 33, 33,103, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,104, 33,105,106, 33,107,108,109,110, 33, 33,111, 33, 33, 33, 33,112,
-   113,114,115, 33,116, 33, 33,117,118,119, 33, 33, 33, 33,120, 33, 33,121, 33, 33, 33, 33,122, 33, 33, 33, 33,123, 33, 33, 33, 33,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17,124, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,125,126, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,127, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,128, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 17, 17,129, 33, 33, 33, 33, 33,
-    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,130, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17,131, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
-   132,133, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-constexpr uint8_t ucd_sentence_break_properties_bytes[17168] = {
-     0,  0,  0,  0,  1, 33, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 80,  0,  5, 85,  0,102,112,136,136,136,136,136, 96,  0,  4,
-     9,153,153,153,153,153,153,153,153,153,153,153,153,149,  5,  0, 10,170,170,170,170,170,170,170,170,170,170,170,170,165,  5,  0,
-     0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  0,165, 12,  0,  0,  0, 10,  0,  0,165,  0,  0,
-   153,153,153,153,153,153,153,153,153,153,153,144,153,153,153,154,170,170,170,170,170,170,170,170,170,170,170,160,170,170,170,170,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,169,169,169,169,
-   169,169,169,169,170,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,153,169,169,170,
-   169,154,154,153,169,153,170,153,153,169,154,153,154,170,153,169,154,154,154,153,169,170,154,153,169,153,169,169,154,173,154,170,
-   221,221,153,169,154,153,169,169,169,169,169,169,169,169,170,154,154,154,154,154,154,154,154,154,169,154,154,153,154,154,154,154,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,170,170,170,153,169,154,
-   169,169,153,154,154,154,154,154,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
-   170,170,170,170,170,170,170,170,170,170,218,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,173,221,221,221,
-   170,  0,  0,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,170,170,160,  0,  0,  0,208,208,  0,  0,  0,  0,  0,  0,  0,  0,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,154,154,208,154,  0,170,170,  9,
-     0,  0,  0,144,153,144,144,153,169,153,153,153,153,153,153,153,153,  9,153,153,153,153,170,170,170,170,170,170,170,170,170,170,
-   170,170,170,170,170,170,170,169,170,153,154,170,154,154,154,154,154,154,154,154,154,154,154,154,170,170,154,  9,169,154,169,153,
-   153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
-   154, 14,238,238,238,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
-   153,169,169,169,169,169,169,170,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,  9,153,153,153,153,153,153,153,
-   153,153,153,153,153,153,153,153,153,153,153,144, 13,  0,  6,  0,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
-   170,170,170,170,164,  0,  0,  0, 14,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238, 14,
-    14,224,238, 14,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0, 13,221,221,  0,  0,  0,  0,  0,  0,
-   204,204,204,  0,  0,  0,102,  0,238,238,238,238,238,224,196, 68,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,222,238,238,238,238,238,238,238,238,238,238,136,136,136,136,136,  8,128,221,237,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221, 77,238,238,238,236, 14,238,238,237,222,224,238,238,221,136,136,136,136,136,221,208, 13,
-    68, 64,  0,  0,  0,  0,  0, 12,222,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,238,238,238,
-   238,238,238,238,238,224, 13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,237,  0,  0,  0,  0,  0,  0,  0,
-   136,136,136,136,136,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,221,  0,100,208, 14,  0,
-   221,221,221,221,221,221,221,221,221,221,221,238,238,222,238,238,238,238,222,238,222,238,238,  0,  0,  0,  0,  4,  4,  0,  4, 64,
-   221,221,221,221,221,221,221,221,221,221,221,221,222,238,  0,  0,221,221,221,221,221,208,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221, 13,221,221,208,204,  0,  0,  0,238,238,238,238,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,238,238,238,238,238,238,238,238,238,238,238,238,206,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
-   238,238,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,237,238,
-   238,238,238,238,238,238,238,238,222,238,238,238,221,221,221,221,221,238, 68,136,136,136,136,136, 13,221,221,221,221,221,221,221,
-   222,238, 13,221,221,221,208, 13,208, 13,221,221,221,221,221,221,221,221,221,221,208,221,221,221,208,208,  0,221,221,  0,237,238,
-   238,238,224, 14,224, 14,238,208,  0,  0,  0, 14,  0,  0,221, 13,221,238,  0,136,136,136,136,136,221,  0,  0,  0,  0,  0,208,224,
-    14,238, 13,221,221,208,  0, 13,208, 13,221,221,221,221,221,221,221,221,221,221,208,221,221,221,208,221, 13,208,221,  0,224,238,
-   238,224,  0, 14,224, 14,238,  0, 14,  0,  0,  0, 13,221,208,208,  0,  0,  0,136,136,136,136,136,238,221,222,  0,  0,  0,  0,  0,
-    14,238, 13,221,221,221,221, 13,221, 13,221,221,221,221,221,221,221,221,221,221,208,221,221,221,208,221, 13,221,221,  0,237,238,
-   238,238,238, 14,238, 14,238,  0,208,  0,  0,  0,  0,  0,  0,  0,221,238,  0,136,136,136,136,136,  0,  0,  0,  0, 13,238,238,238,
-    14,238, 13,221,221,221,208, 13,208, 13,221,221,221,221,221,221,221,221,221,221,208,221,221,221,208,221, 13,221,221,  0,237,238,
-   238,238,224, 14,224, 14,238,  0,  0,  0, 14,238,  0,  0,221, 13,221,238,  0,136,136,136,136,136, 13,  0,  0,  0,  0,  0,  0,  0,
-     0,237, 13,221,221,208,  0,221,208,221,221,  0, 13,208,208,221,  0, 13,208,  0,221,208,  0,221,221,221,221,221,221,  0,  0,238,
-   238,224,  0,238,224,238,238,  0,208,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,
-   238,238,237,221,221,221,208,221,208,221,221,221,221,221,221,221,221,221,221,221,208,221,221,221,221,221,221,221,221,  0,237,238,
-   238,238,224,238,224,238,238,  0,  0,  0, 14,224,221,208, 13,  0,221,238,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,
-   222,238, 13,221,221,221,208,221,208,221,221,221,221,221,221,221,221,221,221,221,208,221,221,221,221,221, 13,221,221,  0,237,238,
-   238,238,224,238,224,238,238,  0,  0,  0, 14,224,  0,  0, 13,208,221,238,  0,136,136,136,136,136, 13,222,  0,  0,  0,  0,  0,  0,
-   238,238,221,221,221,221,208,221,208,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,237,238,
-   238,238,224,238,224,238,238,208,  0,  0,221,222,  0,  0,  0, 13,221,238,  0,136,136,136,136,136,  0,  0,  0,  0,  0,221,221,221,
-    14,238, 13,221,221,221,221,221,221,221,221,208,  0,221,221,221,221,221,221,221,221,221,221,221,221, 13,221,221,221,221, 13,  0,
-   221,221,221,208,  0,224,  0, 14,238,238,224,224,238,238,238,238,  0,  0,  0,136,136,136,136,136,  0,238,  0,  0,  0,  0,  0,  0,
-    13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,221,238,238,238,224,  0,  0,
-   221,221,221,222,238,238,238,224,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    13,208,208,221,221,208,221,221,221,221,221,221,221,221,221,221,221,221, 13, 13,221,221,221,221,222,221,238,238,238,238,237,  0,
-   221,221,208,208,238,238,238,224,136,136,136,136,136,  0,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,238,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0, 14, 14, 14, 85, 85,238,
-   221,221,221,221, 13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0, 14,238,238,238,238,238,238,238,
-   238,238,224,238,221,221,222,238,238,238,238,238, 14,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,224,  0,
-     0,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,238,238,238,238,238,237,
-   136,136,136,136,136, 68,  0,  0,221,221,221,238,238,221,221,238,237,238,237,222,238,238,238,221,222,238,237,221,221,221,221,221,
-   221,238,238,238,238,238,238,222,136,136,136,136,136,238,238,  0,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,
-   153,153,153,  9,  0,  0,  9,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,173,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,208,221,221,  0,221,221,221,208,208,221,221,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,208,221,221,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,221,221,  0,221,221,221,208,
-   208,221,221,  0,221,221,221,221,221,221,221,208,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,208,221,221,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,208, 14,238,  0, 64,  0,  4, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,
-   153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,  0,170,170,170,  0,
-    13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208, 77,221,221,221,221,221,221,221,221,
-    29,221,221,221,221,221,221,221,221,221,221,221,221,213, 80,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,221,221,221,221,221,208,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,238,238,  0,  0,  0,  0, 13,221,221,221,221,221,221,221,221,221,238,228, 64,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,238,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,208,221,208,238,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,238,
-   238,238,238,238,238,238,238,238,238,238,  0, 13,  0,  0,222,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,100,  0,  0,100, 14,238,206,136,136,136,136,136,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,
-   221,221,222,237,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,208,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,238,238,238,238,238,238,  0,  0,238,238,238,238,238,238,  0,  0,
-     0,  0, 68,136,136,136,136,136,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,221,221,208,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,222,238,238,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,224,238,238,238,238,238,238,238,238,238,238,238,238,238,238,224, 14,
-   136,136,136,136,136,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0, 13, 68, 68,  0,  0,238,238,238,238,238,238,238,238,
-   238,238,238,238,238,238,238,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   238,238,237,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,238,
-   238,238,237,221,221,221,208,  0,136,136,136,136,136, 68,  0, 68,  0,  0,  0,  0,  0, 14,238,238,238,238,  0,  0,  0,  0,  4, 64,
-   238,237,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,238,238,221,136,136,136,136,136,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,238,238,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,238,238,238,238,238,  0,  4, 64,  0,
-   136,136,136,136,136,  0, 13,221,136,136,136,136,136,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221, 68,
-   170,170,170,170,160,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208, 13,221,
-     0,  0,  0,  0,  0,  0,  0,  0,238,224,238,238,238,238,238,238,238,238,238,238,237,221,222,221,221,221,237,222,238,208,  0,  0,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
-   154,154,154,154,154,154,154,154,154,154,154,170,170,170,170,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
-   170,170,170,170,153,153,153,153,170,170,170,  0,153,153,153,  0,170,170,170,170,153,153,153,153,170,170,170,170,153,153,153,153,
-   170,170,170,  0,153,153,153,  0,170,170,170,170,  9,  9,  9,  9,170,170,170,170,153,153,153,153,170,170,170,170,170,170,170,  0,
-   170,170,170,170,153,153,153,153,170,170,170,170,153,153,153,153,170,170,170,170,153,153,153,153,170,170,160,170,153,153,144,160,
-     0,170,160,170,153,153,144,  0,170,170,  0,170,153,153,  0,  0,170,170,170,170,153,153,144,  0,  0,170,160,170,153,153,144,  0,
-    17, 17, 17, 17, 17, 28,238,204,  0,  6, 96,  0, 85, 85, 85, 85,  0,  0,112,  0,187,204,204,193,  0,  0,  0,  0,  5, 80, 68,  0,
-     0,  0,  5, 84, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,204,204,192,204,204,204,204,204, 10,  0,  0,  0,  0,  0,  5, 90,
-     0,  0,  0,  0,  0,  0,  5, 80,170,170,170,170,170,170,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,224,  0,  0,  0,  0,  0,  0,  0,
-     0,144,  0,  9,  0,169,153,170,153,154,  9,  0,  9,153,153,  0,  0,  0,144,144,144,153,153, 10,153,153,173,221,218,  0,170,153,
-     0,  0,  9,170,170,  0,  0,160,  0,  0,  0,  0,  0,  0,  0,  0,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,
-   221,217,173,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 85, 85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,153,153,153,153,153,
-   153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,170,170,170,170,170,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5, 85, 85, 80,  0,  0,  0, 85, 85, 85, 85, 85, 85, 85,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  5, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85, 85, 85, 85, 85,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  5, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85, 85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,  0,
-   153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,154,153,154,169,169,169,169,153,154,154,169,170,170,170,170,153,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,160,  0,  0,  9,169,174,238,154,  0,  0,  0,  0,  0,  0,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170, 10,  0,  0, 10,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 14,
-   221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,221,221,221,208,221,221,221,208,221,221,221,208,221,221,221,208,
-   221,221,221,208,221,221,221,208,221,221,221,208,221,221,221,208,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
-    85, 85, 85, 85, 85, 85, 85,  0,  0,  0,  0,  0,  0,  0, 85,  0, 85, 85, 85, 85, 85,  0,  0, 77,  0,  0,  0,  0,  0,  0, 64,  0,
-     0, 80,  0,  0,  0,  0,  0,  0,  0,  4, 69, 85, 85, 85, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    22, 64, 13,221, 85, 85, 85, 85, 85,  0, 85, 85, 85, 85,  5, 85, 13,221,221,221,221,238,238,238, 13,221,221,  0,221,221,208,  0,
-    13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,208, 14,224, 13,221, 13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,221,221,
-     0,  0, 13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221, 13,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  4,
-   221,221,221,221,221,221,208, 68,221,221,221,221,221,221,221,221,136,136,136,136,136,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,222,238,224,238,238,238,238,238, 13,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,170,238,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,  4,  0,  4,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,221,221,221,221,  0,154,154,154,154,154,154,154,170,154,154,154,154,154,154,154,
-   154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,170,170,170,170,169,169,169,154,
-   154,154,154,154,208,  9,169,173,154,154,170,154,154,154,154,154,154,154,154,154,154,153,153,154,153,153,154,154,154,154,154,154,
-   154,154,153,153,169,160,  0,  0,154, 10, 10,154,154,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,170,169,173,170,173,221,221,
-   221,237,221,237,221,222,221,221,221,221,221,221,221,221,221,221,221,222,238,238,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0, 68,  0,  0,  0,  0,
-   238,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,238,
-   238,238,238,  0,  0,  0,  0, 68,136,136,136,136,136,  0,  0,  0,238,238,238,238,238,238,238,238,238,221,221,221,  0, 13, 13,222,
-   136,136,136,136,136,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,  4,221,221,221,221,221,221,221,221,
-   221,221,221,222,238,238,238,238,238,238,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,
-   238,238,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,238,238,
-   224,  0,  0,  0, 68,  0,  0, 13,136,136,136,136,136,  0,  0,  0,221,221,222,221,221,221,221,221,136,136,136,136,136,221,221,208,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,238,238,224,  0,  0,  0,  0,
-   221,222,221,221,221,221,238,  0,136,136,136,136,136,  0,  4, 68,221,221,221,221,221,221,221,221,221,221,221,208,  0,222,238,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,237,238,237,222,237,221,221,238,
-   222,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,221,  0,221,221,221,221,221,222,238,238, 68,221,222,224,  0,  0,  0,  0,
-    13,221,221,208, 13,221,221,208, 13,221,221,208,  0,  0,  0,  0,221,221,221,208,221,221,221,208,170,170,170,170,170,170,170,170,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,160,170,170,170,170,170,170,170,  0,  0,  0,170,170,170,170,170,170,170,170,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,228,238,  0,136,136,136,136,136,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,208,  0, 13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   170,170,170,160,  0,  0,  0,  0,  0, 10,170,170,  0,  0, 13,237,221,221,221,221,208,221,221,221,221,221,221,208,221,221,208,208,
-   221, 13,208,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0, 13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221, 85,
-     0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,  0,  0,
-   238,238,238,238,238,238,238,238,102,  6,  0,  5, 80,  0,  0,  0,238,238,238,238,238,238,238,238,  6, 96,  5, 85, 85, 85, 85, 85,
-    85, 85, 80,  5, 80,  0,  0,  0,102,112,  6, 68,101, 85, 85, 80,  0,  6,  0,  0,  0,  0,  0,  0,221,221,208,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208, 12,
-     4,  0,  0,  0, 85,  0,102,112,136,136,136,136,136, 96,  0,  4,  9,153,153,153,153,153,153,153,153,153,153,153,153,149,  5,  0,
-    10,170,170,170,170,170,170,170,170,170,170,170,170,165,  5,  5, 84, 85, 96,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,
-     0,221,221,221,  0,221,221,221,  0,221,221,221,  0,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,204,  0,  0,
-   221,221,221,221,221,221, 13,221,221,221,221,221,221,221,221,221,221,221,221,208,221,221,221,221,221,221,221,221,221,208,221, 13,
-   221,221,221,221,221,221,221,  0,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0, 13,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,208,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,224,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,  0,  0,221,221,221,221, 13,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,170,170,170,170,
-   170,170,170,170,170,170,170,170,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,136,136,136,136,136,  0,  0,  0,153,153,153,153,153,153,153,153,
-   153,153,153,153,153,153,153,153,153,153,  0,  0,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,153,153,153,153,153,144,153,153,
-   153,153,153,153,153,144,153,153,153,144,153, 10,170,170,170,170,170, 10,170,170,170,170,170,170,170, 10,170,170,170, 10,160,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   173,218,170, 10,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,160,170,170,170,170,160,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,  0,208,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221, 13,208,  0,208, 13,
-   221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,208,221,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,221,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   222,238, 14,224,  0,  0,238,238,221,221, 13,221, 13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,238,224,  0, 14,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221, 13,221,221,221,221,221,221,221,221,221,221,221,221,221,222,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,144,  0,  0,  0,  0,  0,  0,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,160,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,  0,  0,  0,  0,136,136,136,136,136,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221, 14,224,  0,221,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,238,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0, 13,  0,  0,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,238,238,238,238,238,224,  0,  4, 68, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,
-   221,238,238, 68, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,
-   238,237,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,
-   238,238,238,228, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,136,136,136,136,136,237,222,237,  0,  0,  0,  0, 14,
-   238,237,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,224, 12, 68,
-    68,224,  0,  0,  0,  0, 12,  0,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,136,136,136,136,136,  0,  0,  0,
-   238,237,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,238,238,224,136,136,136,136,136,
-     4, 68,222,237,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,  0,208,  0,  0,  0,  0,
-   238,237,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,238,238,
-   237,221,212, 64, 14,238,228,238,136,136,136,136,136,208,208, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221, 13,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,238, 68,  4, 64,237,
-   222,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,208,208,221,221, 13,221,221,221,221,221,221,221, 13,221,221,221,221,212,  0,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,238,224,  0,  0,136,136,136,136,136,  0,  0,  0,
-   238,238, 13,221,221,221,208, 13,208, 13,221,221,221,221,221,221,221,221,221,221,208,221,221,221,208,221, 13,221,221, 14,237,238,
-   238,238,224, 14,224, 14,238,  0,208,  0,  0, 14,  0,  0, 13,221,221,238,  0,238,238,238,224,  0,238,238,224,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,238,
-   238,238,238,237,221,212, 64,  0,136,136,136,136,136,  0,  0,237,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,238,238,238,
-   238,238,221, 13,  0,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,  0,238,238,238,238,
-   224, 68,  0,  0,  4, 68, 68, 68, 68, 68, 68, 68,221,221,238,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,238,238,238,
-   228, 64,208,  0,  0,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,238,238,238,208,  0,  0,  0,
-   136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,208, 14,238,238,238,238,238,238,238,  0,  0,136,136,136,136,136,  0, 68, 64,
-   221,221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,238,238,238,238,224,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,
-   221,221,221,208, 13,  0,221,221,221,221, 13,208,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238, 14,224, 14,238,237,
-   237,238, 64, 64,  0,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,  0,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,222,238,238,238,  0,238,238,238,237, 13,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   222,238,238,238,238,237,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,222,238,224,
-     0, 68,  0, 14,  0,  0,  0,  0,222,238,238,238,238,238,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,238,238,238,238,238,238,238,238,  4, 77,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,
-   221,221,221,221,208,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,238,224,238,238,238,238,
-   212, 64,  0,  0,  0,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,  0,238,238,238,238,238,238,238,238,238,238,238, 14,238,238,238,238,238,238,224,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,208,221, 13,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,222,238,238,224,  0,224,238, 14,
-   238,238,238,222,  0,  0,  0,  0,136,136,136,136,136,  0,  0,  0,221,221,221, 13,208,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,238,238,224,238, 14,238,238,208,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,222,238,228, 64,  0,  0,  0,
-   238,222,221,221,221,221,221,221,208,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,224,  0,238,
-   238,228, 64,  0,  0,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,208,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,204,204,204,204,204,204,204,204,
-   237,221,221,222,238,238,238,238,238,238,238,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,136,136,136,136,136,  0,  0, 68,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,
-   136,136,136,136,136,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,238,238,228,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,238,228, 64,  0,  0,  0,
-   221,221, 64,  0,  0,  0,  0,  0,136,136,136,136,136,  0,  0,  0,  0, 13,221,221,221,221,221,221,221,221,221,221,  0,  0, 13,221,
-   221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,208,  0, 14,222,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
-   238,238,238,238,  0,  0,  0, 14,238,237,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221, 13,224,  0,  0,  0,  0,  0,238,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221, 13,221,221,221, 13,208,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,208,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,221,208, 13,  0,  0,  0,  0,  0,  0,  0,221,221,  0,  0,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,221,221,221,221,221,221,208,  0,
-   221,221,221,221,208,  0,  0,  0,221,221,221,221,221,  0, 14,228,204,204,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,  0,238,238,238,238,238,238,238,238,
-   238,238,238,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,238,238,  0, 14,238,238,236,204,204,204,206,238,238,
-   238,224, 14,238,238,238,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,238,238,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,238,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   153,153,153,153,153,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,170,170,170,170,170,153,153,153,153,153,153,
-   153,153,153,153,153,153,153,170,170,170,160,170,170,170,170,170,170,170,170,170,153,153,153,153,153,153,153,153,153,153,153,153,
-   153,170,170,170,170,170,170,170,170,170,170,170,170,170,144,153,  0,144,  9,144,  9,153,144,153,153,153,153,170,170, 10, 10,170,
-   170,170, 10,170,170,170,170,170,153,153,153,153,153,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,170,170,170,
-   170,170,153,  9,153,144,  9,153,153,153,144,153,153,153,144,170,170,170,170,170,170,170,170,170,170,170,170,170,153,  9,153,144,
-   153,153,144,144,  0,153,153,153,144,170,170,170,170,170,170,170,170,170,170,170,170,170,153,153,153,153,153,153,153,153,153,153,
-   153,153,153,170,170,170,170,170,170,170,170,170,170,170,170,170,153,153,153,153,153,153,153,153,153,153,153,153,153,170,170,170,
-   170,170,170,170,170,170,170,170,170,170,153,153,153,153,153,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,170,
-   170,170,170,170,153,153,153,153,153,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,170,170,170,170,170,153,153,
-   153,153,153,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,170,170,170,170,170,153,153,153,153,153,153,153,153,
-   153,153,153,153,153,170,170,170,170,170,170,170,170,170,170,170,170,170,170,  0,153,153,153,153,153,153,153,153,153,153,153,153,
-   144,170,170,170,170,170,170,170,170,170,170,170,170,160,170,170,170,153,153,153,153,153,153,153,153,153,153,153,153,144,170,170,
-   170,170,170,170,170,170,170,170,170,170,160,170,170,170,153,153,153,153,153,153,153,153,153,153,153,153,144,170,170,170,170,170,
-   170,170,170,170,170,170,170,160,170,170,170,153,153,153,153,153,153,153,153,153,153,153,153,144,170,170,170,170,170,170,170,170,
-   170,170,170,170,160,170,170,170,153,153,153,153,153,153,153,153,153,153,153,153,144,170,170,170,170,170,170,170,170,170,170,170,
-   170,160,170,170,170,154,  0,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,224,  0, 14,238,238,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,224,  0,  0,  0, 14,  0,  0,  0,  0,  0,
-     0,  0,224,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0, 14,238,238, 14,238,238,238,238,238,238,238,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   170,170,170,170,170,218,170,170,170,170,170,170,170,170,170,160,  0,  0, 10,170,170,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   238,238,238,224,238,238,238,238,238,238,238,238,224, 14,238,238,238, 14,224,238,238,224,  0,  0,170,170,170,170,170,170,170,170,
-   170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,238,238,238,237,221,221,221,  0,
-   136,136,136,136,136,  0,  0,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,224,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,136,136,136,136,136,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,238,238,136,136,136,136,136,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,221,221,208,221,221, 13,208,221,221,221,221,221,221,221,208,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,208,  0,  0,  0,  0,  0,238,238,238,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
-   170,170,238,238,238,237,  0,  0,136,136,136,136,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221, 13,221,221,221,221,221,221,221,221,221,221,221,221,221, 13,208,208, 13, 13,221,221,221,221,208,221,221, 13, 13,  0,  0,
-     0,208,  0, 13, 13, 13, 13,221, 13,208,208, 13, 13, 13, 13, 13, 13,208,208, 13,221,208,221,221,221,208,221,221, 13,221,208,208,
-   221,221,221,221,221, 13,221,221,221,221,221,221,221,221,  0,  0, 13,221, 13,221,221, 13,221,221,221,221,221,221,221,221,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,153,153,153,153,153,153,153,153,
-   153,153,153,153,153,  0,  0,  0,153,153,153,153,153,153,153,153,153,153,153,153,153,  0,  0,  0,153,153,153,153,153,153,153,153,
-   153,153,153,153,153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85, 80,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,136,136,136,136,136,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,208,  0,  0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,
-   221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
-   238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-
-} // namespace detail
 
 enum class unicode_sentence_break_property : uint8_t {
     Other = 0,
@@ -699,30 +32,5 @@ enum class unicode_sentence_break_property : uint8_t {
     Extend = 14,
 };
 
-[[nodiscard]] constexpr unicode_sentence_break_property ucd_get_sentence_break_property(char32_t code_point) noexcept
-{
-    constexpr auto max_code_point_hi = detail::ucd_sentence_break_properties_indices_size - 1;
-
-    auto code_point_hi = code_point / detail::ucd_sentence_break_properties_chunk_size;
-    auto const code_point_lo = code_point % detail::ucd_sentence_break_properties_chunk_size;
-
-    if (code_point_hi > max_code_point_hi) {
-        code_point_hi = max_code_point_hi;
-    }
-
-    auto const chunk_index = load_bits_be<detail::ucd_sentence_break_properties_index_width>(
-        detail::ucd_sentence_break_properties_indices_bytes,
-        code_point_hi * detail::ucd_sentence_break_properties_index_width);
-
-    // Add back in the lower-bits of the code-point.
-    auto const index = (chunk_index * detail::ucd_sentence_break_properties_chunk_size) + code_point_lo;
-
-    // Get the canonical combining class from the table.
-    auto const value = load_bits_be<detail::ucd_sentence_break_property_width>(
-        detail::ucd_sentence_break_properties_bytes, index * detail::ucd_sentence_break_property_width);
-
-    return static_cast<unicode_sentence_break_property>(value);
-}
-
 }} // namespace hi::v1
 
@@ -0,0 +1,2256 @@
+// This file was generated by generate_unicode_data.py
+
+#pragma once
+
+#include "ucd_bidi_classes.hpp"
+#include "ucd_bidi_paired_bracket_types.hpp"
+#include "ucd_east_asian_widths.hpp"
+#include "ucd_general_categories.hpp"
+#include "ucd_grapheme_cluster_breaks.hpp"
+#include "ucd_line_break_classes.hpp"
+#include "ucd_sentence_break_properties.hpp"
+#include "ucd_word_break_properties.hpp"
+#include "../utility/utility.hpp"
+#include "../i18n/i18n.hpp"
+#include <cstdint>
+#include <bit>
+
+hi_export_module(hikogui.unicode.ucd_text_properties);
+
+hi_export namespace hi {
+inline namespace v1 {
+namespace detail {
+
+constexpr auto ucd_text_properties_chunk_size = 128_uz;
+constexpr auto ucd_text_properties_index_width = 9_uz;
+constexpr auto ucd_text_properties_indices_size = 8704_uz;
+constexpr auto ucd_text_properties_record_index_width = 11_uz;
+
+static_assert(std::has_single_bit(ucd_text_properties_chunk_size));
+
+constexpr uint8_t ucd_text_properties_indices_bytes[9808] = {
+     0,  0, 64, 64, 48, 32, 20, 12,  7,  4,  2, 65, 64,176, 96, 52, 28, 15,  8,  4, 66, 65, 48,160, 84, 44, 23, 12,  6, 67, 65,176,
+   224,116, 60, 31, 16,  8, 68, 66, 49, 32,148, 76, 39, 20, 10, 69, 34,145, 80,172, 88, 45, 23, 11,198,  3, 17,144,204,104, 53, 27,
+    13,199,  3,145,208,236,120, 61, 31, 15,200,  4, 18, 17, 12,136, 69, 35, 17,201,  4,146, 81, 44,152, 77, 39, 19,137,229,  2,137,
+    68,164, 83, 42, 21, 74,197,114,193,100,180, 91, 46, 23, 75,197,243,  1,132,196, 99, 50, 25, 12,134, 67, 33,144,200,100, 50, 25,
+    12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,
+   200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 83, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,
+   134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,
+   100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134,
+    67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100,
+    50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67,
+    33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50,
+    25, 12,134, 67, 33,144,200,100, 51, 25,204,230,115, 57,156,206,103, 51,154, 13, 38,147, 81,172,216,109, 55, 27,206,  7, 19,145,
+   204,232,117, 59, 29,207,  7,147,209,236,248,118, 59,158, 15, 39,163,217,240,236,119, 60, 30, 79, 71,179,225,216,238,120, 60,158,
+   143,103,195,177,220,240,121, 61, 30,207,135, 99,185,224,242,122, 61,159, 14,199,115,193,228,244,123, 62, 29,142,231,131,201,232,
+   246,124, 59, 29,207,  7,147,209,236,248,118, 59,158, 15, 39,163,217,240,236,119, 60, 30, 79, 71,179,225,216,238,120, 60,158,143,
+   103,195,177,220,240,125, 63, 31,143,199,227,241,248,252,126, 63, 31,143,199,227,241,248,252,126, 63,159,207,231,243,249,252,254,
+   127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,
+   243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,204,134, 68,  2,  5,  4,131, 66, 33, 16,168,100, 58, 33, 18,138,
+    69,163, 17,168,228,122, 65, 34,146, 73,165, 18,169,100,186, 93, 48,153, 77, 38,211,137,212,242,125, 64,161, 81, 40,212,136,245,
+    42,153, 78,168, 84,170,149,106,197,106,185, 94,143, 88, 44, 81,235, 37,154,209,106,143, 91, 45,215, 11,149,210,237,120,143, 94,
+   175,151,236,  4,123,  5,132,195, 98, 49, 24,140, 70, 35, 17,136,197, 99, 49, 24,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,200,100,178, 89, 44,150, 83, 45,152,201,102,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,103, 51,153,204,246,130, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143,104,180, 90, 45, 22,147, 77,168,213, 71,163,209,232,246,179, 93,176,217,109, 54,155, 77,
+   166,211,105,180,218,109, 54,155, 77,166,211,105,180,218,109, 54,155, 77,166,211,105,180,218,109, 54,155, 77,166,211,105,180,218,
+   109, 54,155, 77,166,211,105,180,218,109, 54,155, 77,166,211,105,180,219,109, 54,155, 77,166,211,105,184,220,110, 55, 91,200,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,223,112, 56, 92, 78, 55, 27,145, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143,114,185,145,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,206,232,116,186,157,110,199,107,185,222,143,120, 60, 94,
+    79, 55,163,213,236,247,124, 62, 31, 15,135,203,233, 30,143, 71,163,209,232,244,122, 61,246,143,126, 63, 95,200,244,123,253, 30,
+   143, 71,192, 17,232,244,122, 61, 31,  1,129, 64,224,136,244,122, 61, 30,143,130,193,160,232,248, 68, 37, 30,143,133, 66,225,144,
+   216,116, 62, 33, 17,137, 68,226,145, 88,180, 94, 49, 25,141, 70,227,145,216,244,126, 65, 33,135,195,225,240,248,124, 62, 31, 34,
+    50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67,
+    33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50,
+    25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,
+   144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25,
+    12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,
+   200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,
+   134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,
+   100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134,
+    67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100,
+    50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67,
+    33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50,
+    25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 36,140,200,100, 50, 25, 12,134, 67, 33,
+   144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,146, 72,100,146,153,
+    12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,
+   200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 36,152,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,
+   134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,
+   100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,201, 39,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,
+   137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40, 50, 25, 12,134, 73, 76,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 42,
+    50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67,
+    33,144,200,100, 50, 25, 12,134, 67, 33,146, 86,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50,
+    25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,201, 44,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,
+   162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74,
+    37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162,
+    81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37,
+    18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81,
+    40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,
+   137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,
+   148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137,
+    68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148,
+    74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,
+   162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74,
+    37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162,
+    81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37,
+    18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81,
+    40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,
+   137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 42,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+   150,203,165,243,  9,116,186, 93, 46,151, 75,165,210,233,116,186, 93, 46,151, 75,165,210,233,116,186, 93, 46,151, 75,165,210,233,
+   116,186, 93, 46, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,
+   249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,
+   159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,
+   252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,
+   207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,
+   254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,
+   231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,
+   127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,
+   243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127,
+    63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,
+   249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,
+   159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,
+   252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,
+   207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,
+   254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,
+   231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,
+   127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,
+   243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,255, 49,
+    63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,
+   249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,
+   159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,
+   252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,
+   207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,
+   254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,
+   231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,
+   127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,
+   243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127,
+    63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,
+   249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,
+   159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,
+   252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,
+   207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,
+   254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,
+   231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,
+   127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,
+   243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,255, 49,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+constexpr uint8_t ucd_text_properties_record_indices_bytes[53872] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  1,  0, 48,  8,  1, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0, 12,  1,128, 48,  7,  1,  0, 36,  5,  0,176, 24,  3, 64,112, 15,  2,  0, 68,  7,  1, 32, 38,  5,  0,
+   168, 22,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 12,  1,144, 52,  6,128,208,  9,  1,192,108, 13,129,176, 54,  6,
+   192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,  0, 56,
+     4, 64,232, 30,  3,160,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240,
+    62,  7,192,248, 31,  3,224,124, 15,129,  0, 64,  8, 64,208,  0,  0,  0,  0,  0,  0,  0,  0,  8,128,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4, 96,144, 18,
+   128,192, 76,  3,  1, 56, 40,  5, 32,168, 21,130,192, 52, 11, 65,112, 29,  5,224,192, 24,131, 16,100, 12,193, 64, 52,  5, 32,196,
+    21,131, 80,108, 13,129,176, 36,  6,224,220, 27,131,112,110, 13,193,192, 55,  6,224,220, 27,131,112,110, 13,193,184, 55,  7,  0,
+   220, 27,131,112,110, 13,193,184, 57,  7,  0,220, 27,131,112,110, 13,193,192, 58,  7, 64,232, 29,131,176,118, 14,193,208, 59,  7,
+    64,232, 29,  3,176,116, 14,129,216, 59,  7, 64,236, 29,  3,160,118, 14,193,216, 57,  7, 64,232, 29,  3,176,116, 14,193,208, 59,
+     6,224,232, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,232, 27,131,160,110, 14,193,184,
+    59,  6,224,236, 27,131,160,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,192, 58,  6,224,236, 27,131,160,110, 14,193,
+   184, 59,  6,224,232, 28,  3,160,110, 14,193,184, 59,  7, 64,220, 29,131,112,118, 13,193,216, 56,  7, 64,224, 29,  3,112,116, 13,
+   193,216, 55,  7, 64,232, 28,  3,160,110, 14,129,184, 59,  6,224,236, 28,  3,160,110, 14,193,184, 59,  6,224,236, 27,131,176,110,
+    14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,192, 58,  6,224,236, 27,131,160,110, 14,193,184, 59,  6,224,236, 27,131,176,
+   110, 14,193,184, 59,  6,224,220, 29,131,112,118, 13,193,216, 59,  7, 96,220, 27,131,176,110, 14,193,184, 55,  7, 96,220, 27,131,
+   112,118, 14,193,184, 55,  6,224,220, 29,131,112,110, 14,193,184, 55,  6,224,236, 29,131,176,110, 13,193,216, 55,  6,224,236, 27,
+   131,176,110, 14,193,184, 55,  7, 96,220, 29,131,176,110, 14,193,184, 55,  7, 96,220, 27,131,112,118, 13,193,216, 55,  6,224,236,
+    29,131,192,110, 14,193,216, 59,  7,128,240, 30,  3,192,110, 15, 65,216, 55,  7,160,236, 27,131,208,118, 13,193,208, 55,  7, 64,
+   220, 29,  3,112,116, 13,193,208, 55,  7, 64,220, 29,  3,112,116, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,
+   224,236, 27,131,176,110, 14,193,184, 59,  7, 96,220, 30,131,176,110, 14,193,184, 55,  6,224,236, 27,131,176,110, 14,193,184, 59,
+     6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184,
+    59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,
+   184, 59,  6,224,236, 27,131,176,118, 14,193,216, 59,  7, 96,236, 27,131,112,118, 13,193,184, 59,  7, 96,220, 29,131,112,110, 13,
+   193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  7, 96,232, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118,
+    14,193,216, 59,  7, 96,232, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,
+   118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,
+   176,118, 14,193,216, 59,  7, 96,236, 29,131,176,120, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,
+   131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,252,
+    31,132,  0,128, 16,  2,  0, 64,  8, 33,  4, 33,  4, 32,134, 16,129,248, 68,  8,161, 16, 34,  4, 64,138, 17,  1,248, 63,  8,193,
+     0, 33,  4, 32,132, 16,130, 16, 66,  5, 32,164, 20,130,144,142, 10, 66, 16, 72,  7,192,248, 31,  3,224,124, 16,130, 16, 66,  8,
+    65,  8, 36,132,144,126, 16,130,  0, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,
+     9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80,
+    74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130,
+    80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,
+   130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 75,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,150,
+    18,194, 88, 75,  9, 97, 44, 37,132,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9,129, 52, 38,  4,208,
+   126, 19,130, 96, 77,  9,225, 60, 40,  4,208,154, 19, 66,136, 76,  9,225, 60, 39,132,240,156, 17,194, 96, 82,  9,129, 48, 38,  4,
+   240,152, 19,194, 96, 76,  9,161, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 39,
+   133, 48,166, 20,194,152, 83, 10, 97, 76, 38,  4,192,154, 19, 66,104, 77,  9,161, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80,
+    42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 38,133, 64,168, 21,  2,160, 84, 10,129, 80, 38,132,208,154, 19, 66,104, 76,  9,161,
+    52, 38,  4,192,152, 19, 66,104, 77,  9,129, 52, 38,  4,208,152, 19, 66, 96, 77,  9,129, 52, 42,133, 96,170, 21,130,168, 86, 10,
+   161, 88, 42,133, 96,170, 21,130,168, 86,  9,161, 52, 38,132,208,152, 19, 66,184, 76,  9,161, 48, 38,  4,208,154, 19,  2, 96, 76,
+    11,  1,100, 44,  5,128,176, 22,  2,192, 88, 11,  1, 96, 44,  5,128,176, 22,  2,192, 88, 11, 33,100, 44,133,144,178, 22, 66,200,
+    89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,
+   200, 89, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,
+   130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 97,104, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182,
+    22,194,216, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,
+   176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 46,  5,208,186, 23,130,240, 93, 11,225,124, 44,  5,
+   176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,
+     5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108,
+    44,  5,176,176, 22,194,192, 91, 11,  1, 96, 45,133,128,182, 22,  2,216, 88, 11, 97, 96, 45,133,128,182, 22,  2,216, 91, 11,  1,
+   108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,
+     1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91,
+    11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192,
+    91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,
+   192, 91,  9,225,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 79,  9,225,132, 49,  6, 32,196,
+    24,195, 16,100, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,
+   202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,152, 51,132,
+   240,158, 26,  3, 64,105,  9,225,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,
+     6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168,
+    53,  6,160,212, 26,131, 88,106, 13,129,168, 53,  6,192,212, 26,131,104,106,  9,225, 60, 39,132,240,158, 19,194,120, 79, 13,193,
+   184, 55,  6,224,220, 27,131,112,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,
+   193,184, 55,  4,240,158, 19,194,120,110, 13,193,184, 55,  6,240,224, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    14, 33,196, 56,135, 16,226, 28,131,152,115, 14,129,212, 58,135, 96,238, 30,  3,200,121, 15, 65,232, 61,  7,160,244, 30,131,208,
+   122, 15, 65,232, 61,  7,176,248, 31, 67,232,126, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,
+   248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 16,  1,252, 63,135,240,254, 31,
+   195,248,127, 15,225,252, 63,133,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,131,208,122, 15, 65,232, 61,  7,160,244,
+    30,131,208,122, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 58,136, 33,  6, 33,  3,248,127, 11,193,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,
+   240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,
+   135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252,
+    63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,
+   252, 63,135,240,250, 31,195,208,122, 15, 65,232, 61,  7,160,244, 28,131,200,122, 15, 65,232, 61,  7,160,244, 33, 68, 40,122, 15,
+    65,228, 61,  7,160,244, 30,131,248,127, 16,194, 24, 67,  8, 97, 12, 33,132, 48,134, 16,194, 24, 63,135,240,254, 33,196, 56,127,
+    17,  2, 32, 68,  8,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 66,120,138, 17, 98, 48, 69,136,177, 22, 34,196, 88,
+   139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196,
+    88,139, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,
+     4, 96,140, 17,130, 48, 70,  4,240,158, 34,196, 88,139, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254,
+    31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,
+   209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,
+   136,209, 26, 35, 68,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 52, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 72,  9,  1, 32, 36,  4,128,144, 18,  2,
+    64, 72,  9,  1, 32, 36,  4,128,144, 18,  2, 64, 72,  9,  1, 32, 36,  4,128,144, 18,  2, 64, 72,  9,  1, 32, 36,  4,128,144, 18,
+     2, 64, 72,  9, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 36, 36,132,152,148, 18,162, 88, 73,  4,240,158, 36, 68,184,151,
+    19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,200,
+   153, 19, 34,100, 77,  9,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 52, 38, 68,200,153, 19, 66,100, 76,137,145, 50, 38, 66,
+   120, 79, 19, 98,108, 77,137,177, 54, 38,196,216,156, 19, 98,112, 77,137,177, 54, 39,  4,224, 79, 19,162,116, 78,137,209, 58, 39,
+    68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,120, 79,  9,224,158,
+    19,196,248, 79, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,132,240,158, 19,194,120, 79, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 20,  1,252, 63,135,
+   240,254, 31,195,248, 79, 14, 33,196, 39,132,240,158, 19,194,120, 79, 15, 65,232, 61,  7,160,244, 30,131,208,122, 15,225,252, 63,
+   135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252,
+    63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,226, 20, 61,  7,160,244, 30,131,208,122, 15, 65,
+   232, 61,  7,160,244, 30,131,208,122, 15, 65,232, 61,  7,160,244, 30,131,208,122, 15, 65,232, 57,  7,160,244, 30,131,208,122, 15,
+    65,232, 61,  7,160,244, 30,131,208,122, 15, 65,232, 61,  7,160,244, 30,131,208,122, 15, 65,232, 61,  7,160,244, 30,131,208,122,
+    20, 34,132, 80,138, 33, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,
+   163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197,
+    24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 80,138, 33, 66, 40,197, 16,162, 20, 66,132, 80,138, 17, 66, 40,
+    69,  8,161, 20, 34,136, 81, 10, 33, 68, 40, 69, 16,162, 20, 97,120, 47,  5,224,188, 40, 69,  8,161, 20, 98,140, 81,138, 49, 70,
+    40,197, 24,163, 20, 98,140, 80,138, 17, 72, 41,  5, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,194,156, 81,138, 49,
+    70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 21,  2,164, 85, 10,160,158, 42,  5, 64,168, 21,  2,160, 84, 10,
+   129, 80, 19,194,120,168, 21,  1, 60, 39,138,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84,
+    10,129, 80, 42,  5, 64,168, 21,  1, 60, 84, 10,129, 80, 42,  5, 64,168, 21,  1, 60, 84,  4,240,158, 19,197, 64,168, 21,  2,160,
+    39,132,241, 82, 42,  5, 88,170, 21, 66,164, 84,138,145, 82, 19,194,120,170, 21, 65, 60, 39,138,161, 84, 42, 69, 64, 79,  9,225,
+    60, 39,132,240,158, 19,194,120,171,  9,225, 60, 39,132,241, 80, 42,  2,120,168, 21,  2,160, 84,138,144,158, 19,197, 96,172, 21,
+   130,176, 86, 10,193, 88, 43,  5, 96,172, 21,  2,160, 86,138,209, 92, 43,133,112,174, 21,194,188, 88, 11, 17, 80, 44,133, 72, 79,
+     9,226,204, 89,139, 64,158, 45, 69,168,181, 22,162,212, 90,132,240,158, 19,194,120,181, 22,161, 60, 39,139, 81,106, 45, 69,168,
+   181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,161, 60, 90,139, 81,106, 45, 69,
+   168,181, 22,161, 60, 90,139, 80,158, 45, 69,168, 79, 22,162,212, 39,132,241,102, 19,197,160,180, 22,130,204, 89,132,240,158, 19,
+   194,120,179, 22, 97, 60, 39,139, 49,102, 44,194,120, 79,  9,226,204, 39,132,240,158, 19,194,120, 79,  9,226,212, 90,139, 81,106,
+    19,197,168, 79,  9,225, 60, 39,132,240,158, 19,197,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22, 98,204, 90,139, 81,
+   106, 44,197,184, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,226,224, 92, 11,144,158, 46,133,208,186, 23, 66,232, 93, 11,
+   161,116, 46,130,120,186, 23, 66,232, 39,139,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93,
+    11,161,116, 46,133,208,186, 23, 65, 60, 93, 11,161,116, 46,133,208,186, 23, 65, 60, 93, 11,160,158, 46,133,208,186, 23, 66,232,
+    39,132,241,112, 46,133,200,185, 23, 34,224, 92, 11,129,112, 46,  2,120,184, 23,  2,228, 39,139,145,114, 46,  2,120, 79, 23, 65,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 23, 66,232, 92, 11,128,158, 19,197,216,187, 23,
+    98,236, 93,139,177,118, 46,197,216,187, 23,130,244, 39,132,240,158, 19,194,120, 79,  9,226,232, 92, 11,129,112, 46,  5,192,184,
+     9,226,248, 95,139,240,158, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 19,194,120,192, 24,  1, 60, 39,140,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  1, 60, 96, 12,  1,128, 48,  6,
+     0,192, 24,  1, 60, 96, 12,  0,158, 48,  6,  0,192, 24,  3,  0, 39,132,241,124, 48,  6,  8,190, 23,226,248, 95, 11,225,124, 19,
+   194,120,191, 23,225, 60, 39,139,241,126, 47,130,120, 79,  9,225, 60, 39,132,240,158, 47,133,240,193,  9,225, 60, 39,132,241,128,
+    48,  2,120,192, 24,  3,  0, 95, 11,224,158, 19,198, 16,194, 24, 67,  8, 97, 12, 33,132, 48,134, 16,194, 24, 99,  0, 98, 12, 65,
+   136, 49,  6, 32,196,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 98,140, 96,158, 49,134, 48,198, 24,195, 24, 99,  4,
+   240,158, 19,198, 48,198, 24,193, 60, 99, 12, 97,140, 49,130,120, 79,  9,227, 24, 99,  4,241,140, 19,198, 48,198,  9,225, 60, 39,
+   140, 97,140, 19,194,120, 79, 24,195, 24, 99,  4,240,158, 19,198, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24,
+    39,132,240,158, 19,198, 56,200, 24,163, 32,100,  4,240,158, 19,198, 64,200, 25,  1, 60,100, 12,129,144, 49, 66,120, 79, 24,193,
+    60, 39,132,240,158, 19,194,120,199,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,198, 72,201, 25,
+    35, 36,100,140,145,146, 50, 70, 72,201, 25, 67, 40,101, 12,177,150, 50,198, 88,203, 25, 99, 48,101,132,240,158, 19,194,120, 79,
+    25,163, 56,103, 12,225,154, 51,198,120,207, 25,227, 60,103,140,241,158, 19,198,120,207, 25,225, 60,103,140,241,158, 51,198,120,
+   207, 25,227, 60,103,140,241,158, 51,198,120,207, 25,227, 60,103,140,241,158, 51,198,120,207, 25,225, 60,103,140,241,158, 51,198,
+   120,207, 25,227, 60,103,140,241,158, 51,198,120,207, 25,227, 60, 39,132,241,154, 51,198,104,205, 25,163, 56,103, 12,225,156, 19,
+   198,104,205, 25,161, 60,102,140,209,154, 51, 66,120, 79,  9,225, 60, 39,132,240,158, 51, 70,104, 79, 25,227, 60,103,132,240,158,
+    51,194,120, 79, 25,227, 60,102,140,208,158, 19,198,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208,  9,225, 60, 39,132,240,
+   158, 19,194,120,209, 26, 67, 72,105, 13, 33,164, 52,134,144,211, 26,131, 84,107, 13, 97,174, 53,  6,160,212, 26,131, 80,106, 13,
+    65,168, 19,198,160,212, 26,129, 60,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106,
+    13, 65,168, 53,  6,160,212, 26,129, 60,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 64,158, 53,  6,160,212, 26,131, 80,
+    39,132,241,170, 53,  6,176,216, 26,195, 88,108,141, 97,172, 19,198,192,214, 26,193, 60,107, 13, 97,170, 53, 66,120, 79,  9,225,
+    60, 39,132,240,158, 54, 70,200, 79,  9,225, 60, 39,132,240,158, 53,  6,160, 79, 26,131, 80,106,141, 80,158, 19,198,208,218, 27,
+    67,104,109, 13,161,180, 54,134,208,218,  9,227, 80,106, 13, 96,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    27, 99,108,110, 13,193,186, 55, 70,232,221, 27,163,116,110,141,209,186, 19,198,232,221, 27,161, 60,110,141,209,186, 55, 70,232,
+   221, 27,163,116,110,141,209,186, 55, 70,232,221, 27,163,116,110,141,209,186, 55, 70,232,221, 27,163,116,110,141,209,186, 55, 70,
+   232,221, 27,163,116,110,141,209,186, 55, 70,232,221, 27,163,116,110,141,177,182, 55, 70,240,220, 27,131,108,109,141,177,182, 19,
+   198,224,220, 27,129, 60,110, 13,193,184, 54,198,248,224,  9,225, 60, 39,132,241,186, 55, 70,232,222, 28, 35,132,112,142, 17,194,
+    56, 71,  8,221, 27,163,116,109,141,176,158, 19,199, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 35,132,112,142, 17,
+   194, 56, 71,  8,225, 28, 35,140,110,141,209,186, 55, 70,232,221,  9,227,144,114,142, 80,158, 57,135, 48,230, 28,195,152,115, 14,
+    97,204, 57,135, 48,230, 28,195,152,115, 14, 97,204, 57,135, 48, 79,  9,225, 60,115, 14, 97,204, 57,135, 48,230, 28,195,152,115,
+    14, 97,204, 57,135, 48,230, 28,195,152,115, 14, 97,204, 57,135, 48,230, 28,195,152, 39,142, 97,204, 57,135, 48,230, 28,195,152,
+   115, 14, 96,158, 57,130,120, 79, 28,195,152,115, 14, 97,204, 57,135, 48, 79,  9,225, 60,114,  4,240,158, 19,194,120,231, 28,163,
+   148,114, 14, 65,200, 19,199, 32, 79, 28,163,148,114,142, 81,202, 57, 71, 40,231,  9,225, 60, 39,132,240,158, 19,199, 64,232, 29,
+     3,160,116, 14,129,208, 58,  7, 64,232,  9,225, 60,114,142, 81,210, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     9,227,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,
+   234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135,
+    80,234, 29, 67,172,117, 14,193,214, 58,199, 88,235, 29, 99,172,117,132,240,158, 19,194,120,237, 29, 67,168,117, 14,161,212, 58,
+   135,112,235, 29, 99,172,117,142,177,214, 58,199, 88,239, 30,  3,192,120, 15,  1,224, 60,  7,128,240, 30,  3,192,120,143, 16,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,227,200,121,  4,241,228, 19,199,144,242, 30, 67,200,121,  4,
+   241,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121,
+    15, 32,158, 60,130,120,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,204,121, 15, 65,230, 60,199,152,243, 30, 99,204,
+   121,143, 49,230, 60,130,120, 79, 30, 67,200,121, 15, 33,228, 19,199,168, 79, 30, 99,204,121,143, 49,230, 60,199,152, 79, 30,195,
+   216,123, 15, 97,236, 61,135,176,246, 30,195,216, 39,132,241,228, 60,135,144,242,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    30,227,224,124, 15,129,242, 62,135,200,249, 31, 99,228,124,143,193,246, 63, 71,232,253, 31,163,244,125,143,225,250, 63,135,240,
+   254, 31,227,252,127, 15,225,252, 63,135,240,254, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128,144, 18,  2, 64, 72,
+     9,  1, 32, 36,  4,128,144, 18,  4, 63,199,240,255, 31,195,252,129,144, 66,  6, 65,  8, 41,  5, 30,227,220,123,143,113,238, 61,
+   199,184,247,  9,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238,
+    61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 19,194,120, 79,  9,227,252,127,143,241,
+   254, 63,199,248,255, 31,227,252,127,143,241,254, 63,199,249,  6, 31,227,252,127,143,241,254, 63,  7,248,255, 30,227,220,123,143,
+   113,238, 63,199,248,255, 31,227,252,127,143,241,254, 63,199,248,255,  9,227,252,127,143,241,254, 63,199,248,255, 31,227,252,127,
+   143,241,254, 63,199,248,255, 31,227,252,127,143,241,254, 63,199,248,255, 31,227,252,127,143,241,254, 63,199,248,255, 31,227,252,
+   127,143,241,254, 19,200, 17,  2, 31,195,248,127, 15,225,252, 63,135,248,254, 31,195,248,127, 15,225,252, 19,199,240,254, 31, 35,
+   228,126, 15,145,244, 65,200, 57,  7, 32,227,236,125,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,
+     8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,146, 18, 66,136,
+    81, 10, 33, 68, 44,133, 16,162, 20, 66,136, 81, 10, 33, 36, 40,133, 16,178, 22, 66,136, 81,  8, 33,132, 48,134, 16,194, 24, 67,
+     8, 97, 12, 33,132, 48,134,144,210, 28, 67,136,113, 14, 33,  4, 32,132, 16,130, 16, 66,  8, 89, 11, 33, 68, 40,132, 16,130, 16,
+    66,  8, 81, 10, 33, 68, 32,132,144,146, 18, 66,  8, 65,  9, 33, 36, 36,132,144,146, 18, 66, 72, 65,  8, 33,  4, 40,133, 16,162,
+    20, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,133, 16,146, 22, 66,136, 81,  9, 33, 36, 36,132,144,
+   146, 18, 66,136, 65,  9, 33,132, 48,134, 16,194, 24, 67,  8, 97, 12, 33,132, 48,132,144,146, 18, 66,136,121, 15, 34,  4, 64,136,
+    17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,
+   136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  2,121, 16,  9,225, 60, 39,132,240,158, 68,  2,120, 79, 34, 36,
+    68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34,
+    36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 34, 38, 68, 72,137, 17,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161,
+    20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,
+   161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,
+     8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40,
+    69,  8,161, 20, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82,
+    42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145,
+    82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,
+   145, 82, 42, 69, 72,169, 21, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,
+   139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196,
+    88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,
+   196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22,
+    34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185,
+    23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,
+   185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,
+   200,185, 23, 34,225, 60,139,145,114, 46, 69,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,225, 60,139,145,114, 46,
+    69,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114,
+    46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,225, 60,139,145,
+   114, 46, 69,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,
+   145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,225, 60,139,145,114, 46, 69,194,120, 79, 34,228, 92,
+   139,145,114, 46, 69,200,184, 79, 34,225, 60,139,145,114, 46, 69,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228,
+    92,139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,
+   228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23,
+    34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,225, 60,139,145,114, 46, 69,194,120,
+    79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,
+   185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,
+   200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,132,240,158,
+    70,  8,193, 24, 35, 36,104,141,145,146, 50, 70, 72,201, 27, 35,100,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194,
+    56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 19,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,
+   114, 46, 69,200,185, 23, 35,164,116,142,145,210, 58, 71, 72,233, 29, 35,164,116, 39,132,240,158, 19,194,120, 79, 35,196,120,143,
+    17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,
+   143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,
+   120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,
+   196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,130,120, 79, 35,228,124,143,145,242, 62, 71,194,120, 79,
+    36,  4,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9,
+    33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,
+     9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72,
+    73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66,
+    72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18,
+    66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146,
+    18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,
+   146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,
+   144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,
+   132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36,
+    36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33,
+    36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9,
+    33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,
+     9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72,
+    73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66,
+    72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72,137, 25, 33, 36, 36,132,144,146, 18,
+    66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36,132,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146,
+    82, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146, 98, 78, 19,194,120, 79, 37,  4,160,148,
+    18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,
+   148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,
+   160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,
+     4,160,148, 18,146, 82, 74, 73, 81, 42, 37, 68,160,148, 18,130, 80, 74,  9, 65, 40, 37,  1, 60, 39,132,240,158, 19,194,120, 79,
+    37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,150, 18,194, 88, 75, 66,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,121, 43, 37,196,184,151, 18,226, 92, 75,137,113, 46, 37,196,184,151, 18,226, 92, 75,137,
+   113, 46, 37,196,184,151,146,242, 96, 41,  5, 32, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 38, 36,196,152,147, 18, 98, 76,
+    73,137, 49, 38, 36,196,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,153, 19, 32,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 19,201,153, 51, 38, 97, 60,154, 19, 64,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147,
+    82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,
+   147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,108, 77,137,185, 54, 38,196,216,
+   155, 19, 98,108, 77,137,185, 55, 38,228,220,155,147,114,110, 77,201,177, 55, 38,228,216,155, 19, 98,108, 77,137,177, 54, 38,196,
+   216,155, 19, 98,112, 78,  9,201, 58, 39,  4,236,156, 19,194,106, 77,130,120, 79, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,
+   164,244, 39,132,240,158, 19,194,120, 79, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248, 39,132,240,158, 19,194,120, 79,
+    39,228,252,160, 20, 18,132, 80,202, 33, 63, 40,165, 24,159,148,114,142, 81,202, 65, 71, 41, 37, 36,164,148,146,146, 82, 74, 73,
+    73, 41, 37, 36, 39,132,240,158, 19,194,120, 79, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138,
+    81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,178,148, 82,
+   138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148,
+    82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,
+   148, 82,138, 81, 74, 41, 65, 60, 39,132,240,158, 19,194,120, 79, 41, 69, 40,165, 20,162,148, 81,202, 57, 74, 41, 69, 40,165, 20,
+   162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165,
+    20,162,148, 82,138, 81, 74, 41, 69, 28,165,  4,240,158, 19,194,120, 79, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,
+   144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,
+   132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36,
+    36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 66,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97,
+    76, 41,133, 48,166, 20,194,152, 83, 10, 96, 79, 41,165, 52,166,148,226,156, 83,138,113, 77, 41,165, 56,167, 20,224,158, 19,194,
+   120, 79, 41,197, 56,166,148,226,156, 83,138,113, 78, 41,197, 52,166,148,208,158, 19,194,120, 79, 41,225, 60, 39,132,242,160, 84,
+    10,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164,
+    84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,130,120, 79, 42, 69, 72,169, 21, 34,
+   164, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149,
+    50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,
+   149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 48,158, 19,194,120, 79, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,
+   169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76, 39,132,240,158, 19,194,120, 79, 42,133,
+    80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170,132,240,158, 19,202,177, 86, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,
+   229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87,
+    43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193,
+    89, 43, 37,104,173, 21,144,158, 19,202,217, 91, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,
+   225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87,
+    10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 74,241, 93, 43,197,120,175, 21,226,188,
+    87,138,240, 79, 43,197,124,175, 21,242,190, 87,138,241, 94, 43,197,120,175, 21,226,188, 87, 74,233, 93, 43,165,116,174,149,226,
+   188, 87,138,241, 94, 43,197,120,175, 21,226,188, 19,194,121, 96, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132, 39,132,
+   240,158, 19,194,120, 79, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132, 39,132,240,158, 19,194,120, 79, 44, 69,136,177,
+    22, 34,196, 88,139, 17, 99, 44,133,144,178, 22, 66,196, 88,130,120, 79, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120,
+    47,  5,224,188, 23,139, 40, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    44,197,152,179, 22, 98,206, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,
+   104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11,
+    65,104, 45,  5,160,180, 22,130,204, 90, 75, 49,102, 44,197,152,179, 22,114,204, 89,203, 57,103, 44,229,156,179, 22,114,206, 90,
+    11, 65,104, 45,  5,160,180, 22,130,208, 19,194,120, 79, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181,150,178,216,
+    91, 75, 89,107, 45,165,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,
+   220, 91,139,113,110, 45,197,184,183, 22,226,220, 90,203, 88, 79, 45,229,188,184, 23, 18,226, 92, 75,137,113, 46, 37,196,184,151,
+    18,226, 92, 75,137,113, 46, 37,196,184,151, 18,226, 92, 75,137,113, 46, 37,196,184,151, 18,226, 92, 75,137,113, 46, 37,192,183,
+   150,242,222, 91,203,129,112, 45,229,188,184, 22,242,222, 91,203,137,113, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,
+   184,151, 18,226, 92, 75,137,113, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,
+   204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,161,117, 46,
+   133,208,186,151, 82,234, 93, 11,169,116, 46,133,208,186,151, 80,158, 19,194,120, 79,  9,225, 60, 39,132,242,236, 93,139,177,118,
+    46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,
+   119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,240, 94, 11,193,120, 47,  5,224,188, 23,130,242, 94, 75,
+   201,121, 47, 37,228,188,151,146,240, 94, 11,201,121,  9,225, 60, 39,151,162,244, 94,203,217,123, 47,133,240,190, 23,194,248, 95,
+    11,225,124, 47,133,240, 39,132,240,158, 93,203,185,119, 47,165,244,190,151,210,250, 95, 75,233,125, 47,165,244,191, 23,226,252,
+    95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,
+   252, 95,139,241,126, 47,229,252,191,151,242,254, 95,204,  1,128, 11, 97,108, 45,133,176,182, 22,194,216, 91, 11, 97, 60, 39,132,
+   240,158, 19,194,120, 79, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,
+   152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,
+   192,132,240,158, 96, 76,  9,129, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130,  9,225, 60, 39,132,240,158, 19,194,120, 79, 11,193,
+   120, 47, 17, 32,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,198, 12, 47,  5,224,188, 23,130,240, 94, 11,
+   198, 16,194, 24, 67,  8, 23,140, 33,132, 48,134, 16,194, 24, 64,188, 97, 12, 33,131, 11,193,120,194,  4,240,158, 19,194,120, 79,
+     7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216,
+    59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,194,104, 77,  9,161, 52, 38,133,176,124, 15,129,
+   240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,
+   129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124,
+    20,  2,128, 80, 10,  1, 64, 31,  3,224,124, 15,130,128, 80, 10,  1, 64, 40,  3,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,
+   118, 14,193,216, 59, 48,160,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,
+   176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,224,124, 15,129,240, 62,  7,192,248, 31,
+     3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248,
+    31,  3,224,124, 15,129,240, 80, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 97,130,240, 94, 11,193,
+   120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,
+   193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,227, 12, 23,130,240, 94,
+     6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184,
+    59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,
+   184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,
+   193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110,
+    14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,
+   110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,
+   176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,184, 59,  6,224,236, 27,
+   131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236,
+    27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,
+   236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,
+   224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,
+     9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,161, 52, 38,132,208,154, 19, 66,120,
+    79,  9,129, 48, 38,  4,192,152, 19,  2,120, 79,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,129, 48, 38,  4,192,152, 19,  2,
+    96, 76,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,161, 52, 38,132,208,154, 19,
+    66,120, 79,  9,129, 48, 38,  4,192,152, 19,  2,120, 79,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,225, 48, 39,132,192,158,
+    19,  2,120, 76,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,161, 52, 38,132,208,
+   154, 19, 66,104, 77,  9,161, 52, 38,132,208,154, 19, 66,120, 79,  9,161, 52, 38,132,208,154, 19, 66,104, 77, 48,230, 28,195,152,
+   115, 14, 97,204, 57,135,  9,161, 52, 38,132,208,154, 19, 66,104, 77, 48,230, 28,195,152,115, 14, 97,204, 57,135,  9,161, 52, 38,
+   132,208,154, 19, 66,104, 77, 48,230, 28,195,152,115, 14, 97,204, 57,135,  9,161, 52, 38,132,208,154, 19,194,104, 77,  9,129, 48,
+    38,  4,195, 14, 19,130,104, 78,  9,193, 56, 38,132,208,154, 19,194,104, 77,  9,129, 48, 38,  4,195, 14, 19,130,112, 78,  9,161,
+    52, 38,132,208,158, 19,194,104, 77,  9,129, 48, 38,  4,192,158, 19,130,112, 78,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,
+   129, 48, 38,  4,192,152, 19,130,112, 78,  9,225, 60, 38,132,208,154, 19,194,104, 77,  9,129, 48, 38,  4,195, 14, 98,  2,112, 79,
+    49, 38, 36,196,152,147, 18, 98, 76, 73,138, 49, 38, 36,196,152,179, 24, 99, 76,113,143, 50,  6, 68,201, 25, 51, 40,101, 65, 65,
+   150, 50,230, 96,204,130,195, 52,102,204,200, 44,  5,  0,160,206, 25, 99, 58,103,140,241,159, 52,  6,132,209, 26, 51, 72,105, 77,
+    49,167, 53,  6,164,212, 26,131, 82,106,141, 89,171, 50,192,176, 26,130,131, 88,107, 76,225,174, 53,198, 88,203, 25, 99, 94,108,
+    13,137,173, 53,166,176,203, 25, 99, 44,101,140,177,150, 50,198, 88,217, 25, 99, 92,101,138, 25,171, 40,101, 12,161,148, 51, 44,
+    80,202, 25,137, 54,102,208,218, 27, 67,104,109, 77,177,183, 55,  6,228,221, 27,163,116,110,141,209,186, 55, 96,248, 39,132,240,
+    98,110,205,217,187, 55,102,236,222, 27,195,100,108, 13,137,189, 55, 96,196, 24,131, 16, 98,110,205,217,187, 55,102,236,222, 27,
+   195,100,108, 13,136, 79,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 19,194,120, 79, 29,163,180,118,
+   142,209,218, 59, 71,105,190, 29,166,252,118,142,208, 76, 59, 71,104,237, 29,163,180,118,142,209,218, 59, 77,240,237, 29,163,180,
+   118,155,225,218, 59, 77,240,237, 55,199,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 11,193,
+   120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 89, 75, 41,101, 44,161,120,178,150, 82,202, 23,130,240, 94, 11,
+   193,120, 47,  5,224,188, 23,130,240, 94, 11,193, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    56, 39,  4,225, 28, 51,130,113, 14,  9,194, 56, 39, 12, 25,156, 35,132,112,129,152, 51, 56, 71,  8,225, 28, 83,130,112,142, 49,
+   193, 54, 71,  8,225, 28, 35,132,112,142,  9,193, 56, 39, 16,227,156, 19,132,112, 66,153,193, 56, 71,  4, 27,156,131,132,112,142,
+    72, 51, 56, 71,  8, 27,156, 32,102, 97, 12, 33,132, 48,135, 40,224,156, 16,102, 12,206, 17,194, 54, 70,200,217, 27, 35,100,112,
+   129,152, 51,  6, 96,204,224,155, 35,130,112, 65,217,  7, 57,103, 44,229,156,192,108,115, 78, 89,203, 57,103, 44,229,131, 99,152,
+   115,  1,177,203, 57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,158,115,206,121,207, 58,  7, 64,232, 29,  3,
+   160,116, 14,129,208, 58,  7, 64,232,157, 19,162,116, 78,137,209, 58, 71, 72,233,  3,112,118,116,142,145,210, 58, 64,216,224,156,
+    16,158, 19,194,120, 79,  7, 32,228, 28,131,147,166,113,206, 57,199, 56,231, 28,217, 27, 35,130,112, 78,  9,193, 54, 71,  4,224,
+   155, 35,130,112, 77,145,193, 56, 32,168, 21, 28, 19,130,112, 77,145,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 58,135, 80,
+   224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 77,145,178, 56, 39,
+     4, 28,156, 16,114,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,212, 56,
+    39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178,
+     7, 38,200, 28,131,147,100,108,141,144, 57,  7, 38,200,217,  3,147,100,108,141,144, 57, 54, 64,228,234,157, 99,100, 14, 77,145,
+   178, 54, 70,200, 28,155, 35,100, 14, 65,200, 57,  7, 38,200,217,  3,147,100, 14, 77,144, 57,  7, 32,228, 28,131,144,114,108,129,
+   201,178, 54, 70,200,217, 27, 32,114, 14, 65,200, 57, 54, 70,200,217, 27, 32,114, 14, 77,145,178, 54, 70,200,217, 27, 35,100,108,
+   141,145,178,  7, 38,200,217, 27, 32,114,108,141,145,178, 54, 70,200, 28,155, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,
+   108,141,145,178,  7, 32,228,217, 27, 32,114, 14, 65,200, 57, 54, 70,200, 28,131,147,100,108,129,200, 57, 54, 70,200,217, 27, 35,
+   100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200, 28,131,147,100,108,129,200, 57, 54, 70,200,217, 27,
+    35,100,108,141,145,178, 54, 70,200,217, 27, 35,100, 14, 77,145,178, 54, 64,228,217, 27, 35,100,108,141,145,178, 54, 70,200,217,
+    27, 35,100, 14, 77,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,
+   217, 27, 35,100,108,141,144, 57, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,
+   200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54,
+    70,200,217, 27, 35,100,108,141,145,215, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178,
+    56, 39,  4,224,156, 19,130,112, 78,  9,193, 54,  6,196,216, 27, 19,130,112, 78,  9,193, 56, 39,  4,226, 28, 19,130,112, 78,  9,
+   193, 56, 39,  4,236, 29,131,130,112, 78,  9,193, 54, 70,200,224,156, 19,130,112, 78,  9,193,  5, 71,100,237, 28, 19,130,112, 78,
+     9,193, 56, 39,  4,224,156, 19,130,112, 72, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,
+   200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14,
+    65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114,
+    14, 65,200, 57,  7, 32,228, 28,131,156, 19,100,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193,  5, 71,  4,224,156,
+    19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130, 65,206,  9,193, 56, 39,  4,224,155, 35,100,108,141,145,178, 54, 70,200,217,
+    27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,130,112, 78,  9,193, 56, 39,  4,
+   224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  8, 42, 56, 39,
+     4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,100,108,141,145,178, 54, 70,200,224,156, 19,130,112, 78,  9,193, 56,
+    39,108,237,157,179,182, 10,129, 80, 42, 59,  7,112,238, 29,131,130,112, 78,  9,193,  5, 64,168, 21, 28, 19,130,112, 78,  9,193,
+    56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,
+   193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  8, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 56, 39,  4,224,156, 19,130,112,
+    78,  9,193, 56, 39,  4,224,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,
+   108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6, 32,196, 24,131,
+    16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 19,186,119, 78,233,221, 59,167,116,238,
+   157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,241,222, 59,199,120,
+   239, 29,227,188,119,142,241,222, 59,199,120,239,157,227,188,119,142,241,222, 59,199,120,239, 29,227,188,119,142,241,222, 60,  7,
+   128,240, 30,  3,192,120, 15,  1,224, 60,  7,128,240, 30,  3,192,120, 15,  1,224, 60,  7,128,240, 30,  3,192,120, 15,  1,224, 60,
+     7,128,230,131, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,177,204,
+    56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,
+   196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14,
+    33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113,
+    14, 33,196, 56,135, 16,226, 28, 67,130,112, 78,  9,193, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,
+   113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,
+   194,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28,
+    67,136,113, 14, 33,196, 56, 39,  4,226, 28, 67,136,113, 14,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56,135, 16,224,
+   156, 67,136,113, 14, 33,196, 56,135, 16, 21,  2,163,130,112, 78,  9,193, 56, 39,  4,226, 28, 67,130,112, 78, 56, 57, 56, 39,  4,
+   224,156, 19,136,113, 14,  9,193, 56,224,228,224,156, 19,130,112, 78, 33,196, 56,135,  4,224,156, 67,130,112, 78, 33,196, 56,135,
+    16,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,226, 28, 67,136,113, 14,  9,193, 56,
+    39,  4,224,156, 19,130,112, 78,  9,196, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 54, 70,200,217, 30, 35,196,120,207, 25,178,
+    59,135,112,238, 29,192, 84,113,206, 32, 42,  5, 71, 28, 21,  2,160, 84, 10,142, 57,199,  5, 64,168, 21, 28, 19,176,118, 15, 33,
+   228, 59,128,168,238, 29,195,202,121,143, 41,220,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129,
+    80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 71,112,238, 29,192, 84, 10,129, 80, 42, 56,224,168,227,130,160, 84, 10,
+   129, 80, 42, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,176, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84,
+    10,129, 80, 42, 56,231, 28, 21, 28,115,142,113,193, 81,199, 60,167, 28,227,130,163,142,113,193, 81,211,  5, 64,168, 21,  2,160,
+    84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 81,216,  5, 64,168, 21,  2,160, 84, 10,142,  9,193, 56, 39,  4,224,156,
+    19,130,112, 78,  9,193,  5, 64,168, 21, 29,176, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,142, 57,199,  5, 71,108, 21,
+     2,160, 84, 10,129, 80, 42,  5, 64,168,237,157,179,206, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168,
+    21,  2,160, 84,118, 14,193,229, 59,135,112,238, 29,195,176,118, 15, 41,229, 60,167, 28,227,156,115,142,121, 78,217,229, 60,167,
+   148,227,158, 83,176,113,206, 57,199, 60,167,148,227,156,115,202,113,206, 57,229, 60,167,148, 21, 28,112, 84, 10,129, 80, 42, 56,
+   231, 28,236, 28,115,142,113,206, 57,199, 56,231,148,236, 29,131,202,118, 14, 57,229, 60,167,160,236, 28,115,142,118, 15, 41,229,
+    59,135,112,238, 29,195,184,118,206,  9,193, 59,135,112,244,158,147,204,121,129, 80, 42,  5, 64,168, 21, 28, 16, 84,112, 65, 81,
+   193, 56, 39,  4,224,156, 19,130, 10,142,  9,193, 56, 32,168,224,156, 19,130,112, 78,  9,193, 59,103,  4,224,156, 19,130,112, 78,
+     9,193, 56, 39,  4,224,130,160, 84,112, 78,  9,193, 56, 39,  4,224,156, 19,130,117, 14,  9,193, 56, 39,  4,224,156, 16, 84,112,
+    78,  8, 42, 56, 39,  4,224,156, 19,182,112, 78,217,193, 56, 39,  4,224,157,179,182,118,206,  9,234, 56, 39,  4,224,158,179,214,
+   122,207, 89,235, 61,103,  4,246, 30,211,184, 10,129, 80, 42, 54,  6,196,216, 27, 19, 96,108, 77,129,177, 54,  6,196,216, 27, 19,
+    96,108, 65,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,
+   211,154,115, 78,105,205, 57,167, 52,230,156,211,130,118,206,217,219, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 32,168,224,
+   156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 59,103,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,
+   224,156, 19,130,112, 78,  9,219, 54, 70,200,217, 27, 35,100,108, 13,137,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,
+   200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,128,128, 33,  2,
+     0,132,  8,  2, 16, 32,  8, 77,129,177, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178,
+    61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,
+   238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,
+   113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,
+   143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,
+   123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,
+   220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27,
+    35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217,
+    27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,196,120,141,145,178, 54, 70,200,
+   217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,
+   200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54,
+    70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178,
+    54, 70,200,217, 27,  3, 98,  4,  1,  9,176, 54, 38,192,216,155,  3, 98,108, 13,137,176, 54, 38,192,216,155,  3, 98,108, 13,137,
+   176, 54, 38,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,
+   145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,
+   141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54,  6,196,216, 27, 19,100,
+   108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,
+   100,108,141,145,178, 54, 70,200,217, 27, 35, 96,108, 77,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27,
+    35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217,
+    27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,
+   217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,
+   200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54,
+    70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178,
+    56, 39,  4,224,156, 19,130, 10,129, 80, 42, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,
+   193, 56, 39,  4,224,157,179,182,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,
+     9,193, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,112,
+    78,  9,178, 54, 70,200,217, 27, 35,100,112, 78,  9,193, 59,103,  4,224,156, 19,130,122,142, 33,196, 56,135, 16,224,156, 19,130,
+   112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 16,
+   158, 19,206,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156,
+    19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 66,121,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,
+   156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,
+   224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,
+     4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56,
+    39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193,
+    61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,207,121,
+   239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,207,
+   121,239, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124,
+    15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,
+   124, 15,129,240,  6,224,236, 27,131,112,110, 14,193,216, 55,  7, 96,220, 29,131,112,118, 13,193,184, 55,  6,224,236, 27,131,176,
+   118, 13,193,216, 59,  7, 96,236, 29,131,176,124, 15,129,184, 55, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133,
+    96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,
+   133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88,
+    42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161,
+    88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,172,124, 79,137,241, 62,
+    39,196,248,133, 80,172, 21, 66,177,242, 62, 71,200, 42,133, 96,158, 19,194,120, 79,  9,231,204,250, 31, 67,232,125, 79,153,244,
+    62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,
+   246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,130,121,246,  9,225, 60, 39,132,240,158,125,130,
+   120, 79, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,
+   207,185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,
+   125,207,185,247, 62,231,220,251,159,115,238,125,207,185,247,  9,225, 60, 39,132,240,158, 19,194,121,248, 63, 33, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,121,250, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,
+   114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,184, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 34,228, 92,139,
+   145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,228, 92,
+   139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,228,
+    92,139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,
+   161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93,
+    63,103,236, 22,  3, 80, 88, 13, 79,217,251, 63, 96,176, 26,159,176, 88, 13, 74, 25, 67, 40,101, 12,161,148, 50,134, 80,204,177,
+   146, 63,133, 12,254,153, 96, 88, 13, 76,177,150,  5,128,212,216, 27, 19, 96,108, 77,129,177, 54,  6,196,161,148, 50,134, 80,202,
+     8, 63, 40,101, 12,203, 20, 50,134,101,140,177,150, 50,198, 88,255, 31,227,254, 80,202, 25,150, 50, 69, 12,204,148, 50,134, 80,
+   202, 25, 67, 40,101, 12,161,153, 98,134,101,138, 25, 67, 56, 39,  4,203, 20, 18,130,108, 13,137,176, 54, 38,192,216,155,  3, 98,
+   100,130,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,
+     4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  0, 39,160,  4,  0,128, 16,  2,  0, 64,  8,  1,  0,
+    32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,
+     0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,
+     1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,
+     8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  0,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,
+     0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,
+     2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128,
+    16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,
+   128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,
+     0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,
+     4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0,
+    32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,
+     0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,
+     1,  0, 32,  4,  0,128,  2,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 16,158, 19,194,120, 79,
+    64, 72, 13,  2, 32, 84,  2,129,144, 58,  8, 59, 39,104,236,157,163,178,118,142,201,218, 59, 39,105,  0,160, 19,178,118,142,201,
+   218, 59, 39,104,236,157,164, 18,130,144, 90, 11, 64, 40, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  6, 32,196, 24,131, 16,
+   106, 13, 65,200, 61,  7,160,244, 30,132, 16, 10,  1, 65,  8, 33,  4, 32,100, 34,132,144, 10, 19,  9,232, 81, 10,161, 68, 42,133,
+    16,170, 20, 66,168, 81, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,
+   133, 80,170, 21, 66,168, 85, 10,161, 68, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84,
+    42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 68, 42,133, 16,170, 20, 66,168, 85, 10,161,
+    84, 42,133, 80,162, 21, 66,168, 85, 10,161, 84, 42,133, 16,160, 79,  9,232, 49,  6, 33,100, 44,133,208,186, 21, 67,  8,101, 13,
+    33,148, 52,134, 80,210, 25, 67, 72,101, 13, 33,164, 52,134,144,210, 26, 67, 72,105, 13, 33,164, 52,134,144,210, 26, 67, 72,105,
+    13, 33,164, 52,134,144,210, 26, 67, 72,105, 13, 33,148, 52,134,144,210, 26, 67, 72,105, 13, 33,164, 52,134,144,210, 26, 67, 72,
+   105, 13, 33,164, 52,134,144,210, 26, 67, 72,105, 13, 33,164, 52,134,144,210, 26, 67, 72,105, 13, 33,148, 52,134, 80,210, 25, 67,
+    72,105, 13, 33,164, 52,134,144,202, 26, 67, 72,105, 13, 33,164, 52,134, 80,202, 26, 67, 72,105, 13, 33,180, 56,135, 80,234, 26,
+     9,225, 60, 39,132,240,158,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242,
+    30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,
+   242, 30,  9,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,
+   208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,
+   135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244,
+    62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,
+   244, 62,135,208,248, 79, 68,  8,129, 16,162, 20, 66,136, 81,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 67,200,121, 15,
+    33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121,
+    15, 33,228, 60,135,144,242, 30, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,
+     5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 16,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25,
+    68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18,
+    34, 68, 72,137, 17, 34, 36, 68,136,209, 24, 79, 68, 40,133, 16,162, 20, 66,136, 81, 10, 33, 68, 40,133, 16, 34,  4, 64,136, 17,
+     2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136,
+    17,  2, 32, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 64, 40,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,
+   137, 81, 42, 37, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36,
+    68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 70,136,209, 26, 32, 68, 40,133, 16,162, 20, 66,136, 81, 10, 33, 68, 40,133, 16, 34,
+     4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 38, 68,  8,153, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16,
+    34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149,
+    18,162, 84, 74,137, 81, 42, 37, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4,  2,128, 80, 10,  1, 68,232,
+   157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,
+   232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 32,
+    68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58,
+    39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209,
+    58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,
+   209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,  8,129, 16, 34,  4, 64,
+   136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4,
+    64,136, 17,  2,  1, 64, 40,  5,  0,162,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,
+     4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16,
+    34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129,
+    16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,
+   129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 16, 10,  1, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,
+     8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2,  1,
+    69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66,
+    40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17,
+    66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138,
+    17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,
+   138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132,
+    80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,
+   132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161,
+    20, 34,132, 80,138, 17, 66, 40, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,
+     4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56,
+    39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193,
+    69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138,145, 74,
+    41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81,
+    74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138,
+    81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,
+   138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148,
+    82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,
+   148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,
+   162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165,
+    20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,
+   165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69,
+    40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41,
+    69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82, 19,194,120, 79, 69,104,173, 21,162,180, 86,138,209, 90,
+    43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209,
+    90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,
+   209, 88, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,
+   139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196,
+    88,139, 17, 98, 44, 69,168,181, 22,162,212, 90,139, 81,114, 47, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,
+     4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24,
+    35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193,
+    24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,
+   193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,
+     8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48,
+    70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 98,140,145,154, 52, 70,  8,193, 24, 35,  4, 96,140, 17,130,
+    48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,168,213, 26,163, 84,106,141, 81,170, 53, 70,168,213, 24, 35,  0,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 11,  1,108, 44,  5,176,176, 22,
+   194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176,
+    22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,209,176, 93, 11,225,124, 47,163,112,
+   186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 81,186, 56, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,
+   176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,179, 10, 97, 66,232, 93, 71, 40,229, 28,
+   163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229,
+    28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,
+   229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,210, 58, 71,
+    72,233, 29, 35,164,116,142,145,210, 58, 71,104,237, 30, 35,212,124,143,145,242, 61,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     8,225, 28, 35,132,112,142, 17,194, 56, 71,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16,
+    63,  7,224,252, 31,131,240,126, 15,193,248, 63,  8, 65,  8, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,
+   184, 59,  7, 96,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,
+   193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110,
+    14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  7,192,236, 29,131,176,
+   118, 14,193,216, 59,  7, 96,220, 29,131,112,118, 13,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  7,232,253, 31,131,
+   112,118, 13,193,216, 60,  6,224,236, 27,131,176,118, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,
+   131,176,110, 14,193,184, 59,  6,224,236, 27,131,112,110, 13,193,184, 59,  6,224,220, 27,131,112,110, 14,193,184, 59,  6,224,236,
+    27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 13,193,184, 55,  7, 96,220, 29,132,240,158, 19,194,120, 79,  6,224,
+   236, 39,131,176,158, 14,193,184, 59,  6,224,236, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 31,  3,224,124, 13,193,216, 60,  7,192,248, 29,131,192,120, 15,  1,224, 60,
+    72,  9,  1, 32,164,  4,128,144, 18, 10, 64, 72,  9,  1, 32, 36, 20,128,144, 18,  2, 64, 72,  9,  1, 32, 36,  4,128,144, 18,  2,
+    64, 72,  9,  1, 32, 36,  4,128,144, 18,  2, 64, 72,  9,  1, 32, 36, 36,132,144, 82, 10, 66, 72,105, 13, 33,164, 52,130, 19,194,
+   120, 79, 72,137, 17, 34, 36, 68,136,145,  8, 57,  7, 55,199, 36, 39,132,240,158, 19,194,120, 79, 72,169, 21, 34,164, 84,138,145,
+    82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,
+   145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,
+   140,145,146, 58, 71,  9,225, 60, 39,132,240,158, 19,194,120, 79, 73,  9, 33, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,
+   148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,
+   164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,144,146, 18, 66, 72, 73,  9, 33,
+    36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,148,146,130,120, 79,  9,225, 60, 39,132,240,158, 19,210, 90, 75, 73,137,
+    49, 38, 36,196,152,147, 18, 98, 76, 73,137, 48, 39,132,240,158, 19,194,120, 79, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 81,138, 49, 70, 40,197, 24,163, 20,194,152, 83, 10, 52,154, 40,197, 24,161,
+    73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,210,122,
+    79, 73,233, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,210,130, 80, 74,  9, 65, 40, 37,  4,160,148,  9,
+    74, 81, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,
+   146,146, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 42, 37, 64,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,122, 85, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66,
+    40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 19,194,120, 79, 74,201, 89, 43, 37,116,176,150, 18,194, 88, 75,  9, 97, 44, 37,
+   132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44,
+    37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,100,174,149,210,178, 86, 74,201, 89,
+    43,165,116,172,149,146,186, 87, 74,233,101, 44,165,148,178,150, 82,202, 90, 75,105,109, 44,165,148,178,150, 66,120, 64, 75,137,
+   113, 46, 37,196,184,151, 18,226, 92, 75,137,112, 39,132,240,158, 19,210,202, 89, 33,  4, 32,132, 16,130, 16, 66,146,233,  8, 33,
+     4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,132, 48,134, 16,194, 24, 67,  8, 97, 12, 33,132, 48,132, 16,130, 16, 66,  8, 64, 79,
+    75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242,
+    94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,125, 47,165,244,190,151,210,
+   250, 96, 76,  9,125, 47,166,  4,192,151,210,248, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 75,201,121, 47, 37,244,188,151,
+   146,242, 94, 75,201,121, 47, 37,228,190,152,  2,120, 79, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,132, 39,132,244,196,
+   152,211, 26, 99, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 75,164, 32,132, 16,130,
+    16, 66,  8, 65, 15, 33,228, 60,132, 16,146, 20, 66, 72, 65,  8, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38,
+    68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50,
+    38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,169,145, 50,166, 84,202,153, 19, 34,101, 76,169,145,
+    50, 38, 68,200,153, 19, 42,101, 76,137,149, 50,  4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,166, 68,200,153,147, 58,103, 77,  9,161, 52, 38,132,208,154, 19, 66,104, 77,
+     9,161, 52, 38,148,212,154,147, 74,105, 77,105,173, 52, 38,196,216,154, 83, 80, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     9,228, 92,139,145,114, 46, 69,200,184, 79,  9,228, 92,139,145,114, 46, 69,200,184, 79,  9,228, 92,139,145,114, 46, 69,200,184,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,
+   184, 79,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,
+   193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,163,240,124,
+    15,129,240, 62,  7, 96,236, 29,131,176,118, 19, 65,216, 59,  7, 96,248, 35,132,112,158, 19,194,120, 79, 35,228,124,143,145,242,
+    62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,
+   242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,
+   145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,
+   143,145,242, 62, 71,200,249, 31, 77,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,
+   161, 52, 38,132,208,154, 19, 66,104, 77,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,161, 52, 38,148,210,154,147, 74,105, 77,
+    73,165, 52,166,180,210,154,130,120, 79, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,180, 39,132,240,158, 19,194,120, 79,
+    77,201,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,
+   111, 77,233,189, 55,166,244,220,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,
+   122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,201,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,
+   211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,220,155,211,122,111, 77,233,189, 55,166,244,222,
+   155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,201,189, 55,166,244,
+   222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,
+   244,220,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,
+   166,244,222,155,211,122,111, 77,201,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189,
+    55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,220,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,
+   189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,201,189, 55,166,244,222,155,211,122,111, 77,
+   233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,220,155,211,122,111,
+    77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,
+   111, 77,201,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,
+   122,111, 77,233,189, 55,166,244,220,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,
+   211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,201,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,
+   155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,220,155,211,122,111, 77,233,189, 55,166,244,
+   222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,201,189, 55,166,
+   244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,
+   166,244,220,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189,
+    55,166,244,222,155,211,122,111, 77,201,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,
+   189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,220,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,
+   233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,201,189, 55,166,244,222,155,211,122,111,
+    77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,220,155,211,122,
+   111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,
+   122,111, 77,201,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,
+   211,122,111, 77,233,189, 55,166,244,220,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,
+   155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,201,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,
+   222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,220,155,211,122,111, 77,233,189, 55,166,
+   244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,201,189, 55,
+   166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189,
+    55,166,244,220,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,
+   189, 55,166,244,222,155,211,122,111, 77,201,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,
+   233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,220,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111,
+    77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,201,189, 55,166,244,222,155,211,122,
+   111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,220,155,211,
+   122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,
+   211,122,111, 77,201,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,
+   155,211,122,111, 77,233,189, 55,166,244,220,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,
+   222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,201,189, 55,166,
+   244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,
+   166,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,
+   138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,168, 79,  9,225, 60, 39,145, 98, 44, 69,136,177, 22, 34,196,
+    88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,
+   196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 96,158, 19,194,120, 79,
+    78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,
+   112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+   130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156,
+    19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,
+   156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,
+   224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167,
+    20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,
+   167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197,
+    56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,
+   197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78,
+    41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113,
+    69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66,
+    40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17,
+    66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138,
+    17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,
+   138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 19,146,114, 69,  8,161, 20, 34,132,
+    80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,
+   132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161,
+    20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,
+   161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78,
+    73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114,
+     7, 96,236, 29,131,176,118, 14,193,216, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,134, 80,202, 25, 67, 40,
+   101,  9,225, 60, 39,132,240,158, 27,131, 80,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,201,204, 55,  6,224,220, 27,131,
+   112,110, 13,193,184, 55,  6,224,220, 27,131,112, 79, 13,193,184, 55,  6,224,220, 19,195,112, 79, 13,193,184, 39,134,224,220, 19,
+   195,112,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254,
+    31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,
+   240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,
+   135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128,
+    80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80,  4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,
+   225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127,
+    15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,
+   127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,
+   248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,
+   195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254,
+    31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,
+   240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,
+   135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252,
+    63,135,240,254, 31,211,161,153, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15,225,
+   252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,
+   225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127,
+    15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127,  9,225, 60, 63,135,240,254, 31,195,248,
+   127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,
+   248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,
+   195,248,127,  9,225, 60, 39,132,240,158, 19,194,120,121,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,236, 30, 67,200,121,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,
+   160,148, 18,130, 80, 74, 78,168, 13, 59, 39,116,240,158, 83,202, 10, 65,105,232, 39,132,240,158, 19,194,120, 79, 11,193,120, 47,
+     5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,232, 93, 64,169,237, 61,167,196,248,130,144, 90, 10, 65,104, 41,
+     5,160,164, 22,130,144, 90, 10, 65,104, 41,  5,160,164, 22,129, 80, 42, 10, 65,104, 21,  2,160, 84, 10,159, 19,226,124, 79,169,
+   249, 63,132,245,  0,160, 84, 18,130, 79,103,100,237, 29,147,180,118, 78,210,131, 64,168, 21, 66, 40, 85, 12,161,148, 48, 79, 64,
+   170, 29, 68, 32, 80,158, 19,194,120, 79, 15,225,252, 63,135,240,254, 19,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127,
+    15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,
+   127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,
+   248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,
+   195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254,
+    31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 19,194,121,179,  9,234, 37, 69, 40,181, 24,163, 84, 82,142, 81,234, 65, 69, 41,
+    21, 36,164,212,162,149, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75,169,133, 50,166, 84,202,137, 81, 74,105, 77,
+    41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105,
+    77, 40,245, 20,164, 20,218,156, 83,106,117, 78,169,213, 58,167, 84,234,157, 83,170,117, 78,169,213, 58,167, 84,234,157, 83,170,
+   117, 78,169,213, 58,167, 84,234,157, 83,170,117, 78,168,245, 50,164, 20,202,143, 82, 10,121, 79,170,  5, 66,168,149, 26,164, 84,
+   138,145, 82, 42, 69, 72,169, 21, 34,164, 84,170,141, 81,170, 53, 70,168,213, 26,163, 84,106,141, 81,170, 53, 70,168,213, 26,163,
+    84,106,141, 81,170, 53, 70,168,213, 26,163, 84,106,141, 81,170, 53, 70,168,213, 26,163, 84,106,141, 81,170, 53, 70,168,213, 26,
+   163, 84,106,141, 81,170, 53, 70,168,213, 50,166, 84,234,157, 83,170,117, 78,169,213, 58,167, 84,234,157, 83,170,117, 78,169,213,
+    58,167, 84,234,157, 83,170,117, 78,169,213, 58,167, 84,234,157, 83,170,117, 78,169,213, 56, 79,  9,225, 61, 83,170,117, 78,169,
+   213, 58,167,  9,225, 61, 83,170,117, 78,169,213, 58,167,  9,225, 61, 83,170,117, 78,169,213, 58,167,  9,225, 61, 83,170,117, 78,
+    19,194,120, 79, 85, 10, 49, 76,169,181, 82,163, 20, 96, 79, 85, 74,173, 85,170,181, 86,170,149, 80, 79, 54,166,212,218,155, 83,
+   106,109, 77,169,181, 54,170,177, 86, 42,197, 90,113,  2,120, 79, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,
+   224,158,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87,
+    42,229, 92,171,149,112, 79, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185,
+    87,  4,245, 92,171,130,122,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,130,120, 79, 85,202,
+   185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,130,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,
+   174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,
+   114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,
+   149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,
+   171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229,
+    92,171,149,114,174, 85,202,185, 87,  4,240,158, 19,194,120, 79, 37, 37, 12,148,132,240,158, 19,194,122, 68, 72,137, 17, 34, 36,
+    68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34,
+    36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 64,158, 19,194,121,  7, 32,228, 28,
+   131,144,114, 14, 65,200, 57,  7, 85,234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,175, 85,234,
+   189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,175, 85,
+   234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,172, 21,130,176, 86, 10,197, 88,171, 21, 98,172, 85,138,177,
+    86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88, 43,  5, 98,172,149,144, 79, 56, 39,  4,224,156, 19,130,112, 78,  9,
+   193, 56, 39,  4,224,156, 19,130, 19,194,120, 79, 86, 33, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14,
+    65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114,
+    14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 23,130,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,
+   179, 86,106,205, 89,171, 53,102, 19,194,120, 79, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,
+   162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173,
+    21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,129, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79, 11,198,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,179,
+   118,110,205,217,187, 55,102,236,221,155,176,158, 19,194,120, 79, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171,
+    85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,202,217, 91,
+    43, 96,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,173, 85,170,181, 86,234,221, 91,171,117,110,173,213,186,183, 86,234,221,
+    91,171,117,110,173,213,186,183, 86,234,225, 91,171,117,110,173,213,186,183, 86,234,221, 92,  4,240,158, 19,194,120, 79, 87, 42,
+   229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87,
+    42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,210,186, 87, 74,233, 93,  4,240,158, 19,194,120, 79,
+    87,106,237, 93,171,181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,213,218,
+   187, 87,106,237, 93,171,181,118,174,194,122,188, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,175, 85,
+   234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,208,158, 19,
+   194,120, 79, 87,170,245, 94,171,213,122,175, 85,234,189, 87,202,253, 95,171,245,126,175,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 88, 11,  1, 96, 44,  5,128,176, 22,  2,192, 88, 11,  1, 96, 44,
+     5,128,176, 22,  2,192, 88, 11,  1, 96, 44,  5,128,176, 22,  2,192, 88, 11,  1, 96, 44,  5,128,176, 22,  2,192, 88, 11,  1, 96,
+    44,  5,128,176, 22,  2,192, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5,
+    96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 75,
+     9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88,
+    75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194,
+    88,107, 13, 97,172, 53,134,176,214, 26,195, 88,107, 13, 97,172, 53,134,176,214, 26,195, 88,107, 13, 97,172, 53,134,176,214, 26,
+   195, 88,107, 13, 97,172, 53,134,176,194,120, 79, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 16, 39,132,240,158, 19,194,
+   120, 79, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 85,138,177,
+    86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 80,158, 19,194,120, 79, 88,203, 25, 99, 44,101,140,
+   177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,
+   140,177,150, 50,198, 88,203, 25, 99, 44, 96,158, 19,194,120, 79, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,235, 29, 99,172,
+   117,142,177,214, 58,199, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,235, 29, 99,
+   172,117,142,177,214, 58,199,  9,225, 60, 39,132,240,158, 19,194,120, 79, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,
+   100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11,
+    33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,128,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,122,201, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101,  4,245,148,178,150, 82,202,
+    89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101,  4,245,148,178,150, 82,202, 89, 75, 41,101,  4,245,148,178,130,122,
+   203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 44, 39,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214,
+    90,203, 89,107, 44, 39,172,181,150,178,214, 90,203, 89,107, 44, 39,172,181,150, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,
+   197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102,
+    44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,
+   102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139,
+    49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,
+   139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204,
+    89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,
+   204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22,
+    98,204, 89,139, 49,102, 44,197,152,179, 22, 96, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 89,139, 49,102, 44,197,152,179,
+    22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179,  2,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79, 89,139, 49,102, 44,197,152,179, 22, 98,204,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  7,203, 53,102,131,224,124, 15,130,120, 62,  7,192,248, 31,  3,
+   224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,
+     3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,193, 60, 31,  3,224,124, 15,129,240, 62,  7,192,248,
+    31,  4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    89,203, 57,103, 44,229,156,179,130,120, 79, 89,193, 61,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,
+   206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,
+   114,206, 89,203, 57,103, 44,229,156,179,130,122,206, 89,193, 60, 39,132,245,156, 19,194,122,206, 89,235, 61,103,172,245,158,179,
+   214,122,207, 89,235, 61,103,172,245,158,179,214,122,207, 89,235, 61,103,172,245,158,179,194,122,208, 90, 43, 69,104,173, 21,162,
+   180, 86,138,209, 90, 75, 73,105, 45, 37,164,180,150,146,210, 90, 75, 73,105, 45, 37,164,180,150,146,210, 90, 75, 73,105, 45, 37,
+   164,180,150,146,211, 90,107, 81,106, 45, 69,168,181, 22,162,212, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173,
+    85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,168, 79,  9,225, 60, 39,
+   132,240,158, 19,194,122,214, 90,203, 89,107, 45,101,172,181,150,178,214,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 90,235, 93,107,173,117,174,181,214,186,215, 90,
+   235, 93,107,173,117,174,181,214,186,215, 90,235, 93,107,132,245,174,181,194,120, 79,  9,225, 60, 39,173,133,176,182, 22,194,216,
+    91, 43,101,108,173,149,178,182, 86,202,217, 91, 43,101,108,173,149,178,182, 86,202,217, 91, 43,101,108,173,149,178,182, 86,210,
+   218, 91, 75,105,109, 45,160,158, 19,194,122,219, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,
+   226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,112, 39,132,240,158, 19,194,122,221,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 91,203,121,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,
+   229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,150,242,222, 91,235,125,111,
+   173,245,190,183,214,250,223, 91,235,125,111,173,245,190,183,214,250,223, 91,235,125,111,173,245,190,183,214,250,223,  9,225, 60,
+    39,132,245,192,184, 22,250,223, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224,  9,225,
+    61,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92,
+    11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224,
+    92, 43,137,113, 46, 32,158,184,151, 16, 79,  9,225, 60, 39,132,245,196,184,151, 18,226, 92, 43,133,112,174, 16,158,184, 87, 10,
+   225,  9,235,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87,
+    10,225, 92, 43,133,112,174, 21,194,184, 66,120, 79, 92, 75,137,113,  4,240,158, 19,194,122,226, 92,107,141,113,174, 53,198,184,
+   215, 26,227, 92, 97, 60, 39,132,240,158, 19,194,120, 79, 92,139,145,114, 46, 69,200,185, 23, 42,229, 92,193, 60, 39,132,240,158,
+    19,194,120, 79, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,
+   206,185,215, 58,231, 92,235,157,115,174,117,206,186, 23, 66,233, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,
+   165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,215, 90,235,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,171,177,118, 46,197,216,187, 23, 98,236, 93,139,
+   177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187,151,112, 79,  9,
+   225, 60, 39,174,245,222,187,215,122,239, 94, 11,193,120, 47,  5,224,188, 23,136, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,
+   242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,
+   146,242, 94, 75,201,121, 47, 37,228,188,130,120, 79,  9,235,205,121,175, 53,230,188,215,154,243, 94,139,209,122, 47, 69,232,189,
+    23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189,  2,120, 79, 94,171,213,122,175, 85,234,
+   189, 87,170,245, 94,203,217,123, 47,101,236,189,151,178,246, 94,203,217,123, 47,101,236,189,151,178,246, 94,203,217,123,  4,240,
+   158, 19,194,120, 79, 94,235,221,123,175,117,238,189,215,186,247, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,
+   133,240,190, 23,194,248, 95, 11,224, 39,132,240,158, 19,194,120, 79,  9,235,229,124,175,149,242, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,235,233,125, 47,165,244,190,151,210,250,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,
+   251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,
+   218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,
+   215,218,251, 95, 97, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,
+   197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126,
+    47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126,  4,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79, 95,171,245,126,175,213,250,191, 87,234,253, 95,171,245,126,175,213,250,191, 87,234,253, 95,171,
+   245,126,175,213,250,191, 87,234,253, 95,171,245,126,175,213,250,191, 87,234,253, 95,171,245,126,175,213,250,191, 87,234,253, 95,
+   171,245,126,175,213,250,191, 87,234,253, 95,171,245,126,132,240,158, 19,194,120, 79,  9,225, 61,127, 47,229,252,191,151,242,254,
+    95,235,253,127,175,245,254,191,215,250,255, 95,235,253,127,175,245,254,191,215,250,255, 95,235,253,127,175,245,254,191,215,250,
+   255, 95,235,253,127,175,245,254,191,215,250,255, 95,235,253,127,175,246,  0,192, 24,  3,  0,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79, 96, 44,  5,128,176, 22,  2,192, 88, 11,  1, 96, 44,  4, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96,
+    76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 16, 79,
+    96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,
+     3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 12, 39,176, 70,  8,193, 66,
+   120, 79, 96,108, 12, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 30,131,208,122, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,
+   102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,216, 59,  7, 96,236, 29,131,
+   176,118, 14,193,216, 59,  6,  9,225, 60, 39,132,240,158, 19,194,120, 79, 97, 12, 33,132, 48,134, 16,194, 24, 67,  8, 97, 12, 33,
+   132, 48,134, 16,194, 24, 67,  8, 97, 12, 33,132, 48,134, 16,194, 24, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44,
+    41,133, 48,166, 20,194,216, 91, 11, 97,108, 44, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12,
+    97,140, 49,134,176,214, 26,195, 88,115, 14, 97,204, 56, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,196,
+    24,131, 16, 98, 12, 65,136, 49,  0,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22,
+    34,196, 88,136, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 98, 76, 77,137, 49, 70, 40,197, 24,163, 20, 98,140, 81,138, 49,
+    70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 81,138,
+    49, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,108, 77,
+   137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 21, 98,172, 89,139, 49,102, 44,197,130,120, 79,  9,225,
+    61,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,195, 24, 99,
+    12, 97,140, 49,134, 48,198, 24,195, 24, 98,108, 81,138, 49, 54, 38,197,  2,120, 79,  9,225, 60, 39,132,240,158, 19,194,123, 19,
+    99, 44,101,141, 49,182, 54,198,216,219, 27, 99,108,109,141,177,182, 54,198,216,219, 27, 99,108,109,141,177,182, 54,198,216,219,
+    27, 99,108,109,141,177,182, 54,198,216,219, 27, 99,108,109,141,177,182, 54,198,216,219, 27, 99,108,109,141,177,182, 54,198,216,
+   219, 27, 99, 76,105,141, 49,150, 50,198, 88,203, 26, 99, 76,101,140,177,198, 56,199, 88,243, 30, 99,204,121,140,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158,199, 66,120, 79, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,
+   199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,225, 60, 39,132,240,158, 19,194,120, 79,100, 12,129,144, 50,  6,
+    64,200, 25,  3, 32,100, 12,128, 39,132,240,158, 19,194,120, 79,100, 44,133,144,178, 38, 68,200,153, 19, 34,100, 76,137,145, 50,
+    38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145,
+    50, 38, 68,200,153, 19, 33,100, 44,133,144,178, 22, 70,200, 89, 11, 33,100, 44,133,144,178, 22, 66, 19,217, 35, 36,100,140,145,
+   146, 50, 70, 72,201, 25, 35, 36,100,172,153,147, 50,102, 68,200,217, 27, 34,  9,225, 60, 39,132,240,158, 19,194,120, 79,100,236,
+   157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,
+   236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,134, 82,202,153, 56, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   101,108,173,150, 50,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107,
+    45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,
+   107, 45,101,172,181,150,178,198, 88,203, 25, 91, 43,101,108,173,149,178,182, 86,202,217, 91, 44,101,140,181,151, 50,230, 90,203,
+   217,123, 48,102, 44,173,149,178,182, 86,204,153, 99, 43,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,150,179, 70, 90,
+   204, 89,123, 47,  9,236,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,
+   106, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,
+   102,108,205,153,179, 54,102,204,216, 39,179,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155,
+    51,102,108,205,153,179, 54,102,204,217,155, 51,102,110,205,217,187, 56,103, 12,225,155,179,118,112,205,217,195, 56,103, 44,229,
+   157, 51,150,114,206,153,195, 54,102,204,224, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   103,108,237,157,179,182,118,206,217,216, 79,103, 97, 61,157,179,182,118,206,194,123, 59,103,108,237,157,179,182,118,206,217,219,
+    59,103,108,237,157,179,182,118,206,194,123, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,240, 39,132,240,158, 19,194,
+   120, 79,103,172,245,158,179,214,122,207, 89,235, 61,103,172,245,158,179,214,122,207, 89,235, 61,103,172,245,158,179,214,122,207,
+    89,235, 61,103,172,245,158,179,214,122,207, 89,235, 61,103,172,245,158,179,214,122,207, 89,235, 61,103,172,245,158,179,214,122,
+   207, 89,235, 62,103,236,253,159,179,230,124,207,153,243, 62,103,204,249,159,  4,240,158, 19,194,120, 79,104, 13,  1,160, 52,  6,
+   128,208, 26,  3, 64,104, 13,  0, 39,132,240,158, 19,194,120, 79,104, 45,  5,161, 52, 32,158,208,218, 27, 67,104,109, 13,161,180,
+    54,134, 19,194,123, 67,104, 97, 60, 39,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,
+   180, 54,134,208,218, 27, 67,104, 97, 61,161,180, 54,134,208,218, 27, 67,104, 97, 61,161,180, 48,158,208,218, 27, 67,104,109, 12,
+    39,133,230,130,208,218, 35, 66,104, 45,  9,161, 52, 38,132, 19,194,123, 66,104, 65, 60, 39,180, 38,132,208,130,120, 79,104, 97,
+    60, 39,132,240,158, 19,194,123, 68,  9,225, 60, 39,132,240,158,208,218, 27, 67,104,109, 13,161, 52, 32,158, 19,218, 11, 65,104,
+    45,  5,160,180, 22,130, 19,194,120, 79,104, 45,  5,160,180, 22,130, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43,
+    69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90,
+    43, 69,104,173, 21,162,180, 86,138,209,154, 51, 70,104,237, 29,163,180,118,142,209,218, 59, 71,104,205, 25,163,180,118,142,209,
+   154, 59, 69,104,173, 21,162,180,134,144,210, 90, 75, 74,105,109, 45,165,180,182,150,210,218, 91, 75,105,109, 45,164,180,144,158,
+   210,154, 59, 69,104,173, 20, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166, 52,
+   198,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166,
+    52,198,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,173, 57,167, 52,246,158,211,218,123, 79,105,237, 57,
+   167,180,230,156,211, 90,115, 79,105,237, 57,167,180,246,152,211, 26,131, 76,  9,225, 60, 39,132,240,158, 19,194,120, 79,106, 45,
+    69,168,181, 22,162,212, 90,139, 81,106, 45, 68, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147,
+    82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,
+   147, 83,106,141, 81,170,181, 86,170,213, 66,120, 79,106,141, 81,170, 53, 70,170,213, 90,163, 85,106,173, 89,171,181,118,176,214,
+    26,203, 89,107, 45, 93,171,181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,213,218,187, 87,106, 77, 73,169, 53, 38,170,
+   213, 66,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,
+   166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173,
+    53,166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107,109,109,173,181,198,184,215, 26,227, 92,107,141,113,
+   174, 53,182,182,215, 26,219, 92,107,141,117,174,181,230,180, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,107,237,
+   125,175,181,246,190,215,218,251, 95,107,237,124, 39,132,240,158, 19,194,120, 79,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108,
+    13,129,176, 54,  6,192, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   108, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22,194,216, 91, 11,
+    97,108, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 38,198,216,155,
+    27, 99,108, 77,137,177, 54, 38,196,216,155, 27, 98,108, 45,144, 39,132,240,158, 19,194,120, 79,108,173,149,178,182, 86,202,217,
+    91, 43,101,108,173,148, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,
+   102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179,  4,240,158,217,219, 59,103,109, 13,161,179,
+   182,118,206,217,219, 75,103,108,237,157,179,182,112,158, 19,194,120, 79,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,
+   181,182,182,216,219, 27, 99,109,108,205,153,179, 54,102,204,217,155, 48, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,
+   110,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,222,219,219,
+   123,112,110, 13,193,184, 55,  6,224,220, 27,131,112,109,237,193,184, 55, 16,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,110, 77,201,185,
+    55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,
+   185, 55, 38,228,220,155,147,114,110,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,110,109,
+   205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,110,141,209,186, 55, 70,232,221, 27,163,116,110,
+   141,209,186,183, 86,234,221, 91,171,117,110,173,213,186,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,123,118,
+   110,237,221,187,183,118,238,221,219,184, 79,  9,237,220, 39,132,246,238,221,219,187,119,110,237,221,187,183,112,158,221,219,184,
+    79,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,
+   187,119,111, 13,229,188,183,150,242,222, 66,123,121,111, 33, 60, 39,183,166,244,222, 91,211,123,111, 45,237,188,183,166,248,223,
+    91,224, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,111,205,249,191, 55,230,252,223,155,243,126,111,205,248, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,111,237,253,191,
+   183,246,254,223,219,251,127,  9,225, 61,191,183,246,254,223,219,251,127,111,237,253,191,183,246,254,223,219,251,127,111,237,253,
+   191,183,246,254,223,219,251,127,111,237,253,191,183,246,254,223,219,251,127,111,237,253,191,183,246,254,223,219,251,127,111,238,
+     1,192, 56,  7,  2,224, 92, 11,129,  9,225, 61,192,184, 23,  0,224, 28,  3,128,112, 45,253,193, 55,247,  0, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   112,110, 17,194, 56, 71,  8,225, 28, 35,133,112,174, 17,194, 56, 55,  6,224,220, 27,131,112,110, 13,193,184, 55,  6,224,220, 27,
+   131,112,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,193,184, 55,  6,224,220,
+    27,131,112,110, 13,193,184, 71,  8,225, 28, 35,132,112,142, 25,195,184, 71,  8,225, 28, 35,136,113, 46, 41,197,184,183, 20,226,
+    28, 75,132,  9,225, 60, 39,132,240,158, 19,194,120, 79,113,142, 53,198,184,215, 26,227, 92,107,142,113,206, 53,198,184,215, 24,
+   227, 28, 99,140,113,142, 49,198, 56,199, 24,227, 28, 99,140,113,142, 49,198, 56,199, 24,227, 28, 99,140,113,142, 49,198, 56,199,
+    24,227, 28, 99,140,113,142, 49,198, 56,199, 24,227, 28, 99,140,113,142, 49,198, 56,199, 30,227,220,123,143,113,238, 61,198,184,
+   215, 26,227, 92,107,141,113,174, 53,198,184,215, 26,227, 92,107,142,113,174, 53,200, 57, 23, 34,227, 28,147,146,114, 78, 65,200,
+     4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,
+   144,146, 18, 66, 72, 73,  9, 33,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110,
+    77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,
+   110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114, 97, 60, 39,132,240,158, 19,194,120, 79,
+    73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 52, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,129, 61,202, 57,
+    71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202,
+    57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,149,114,206, 89,203, 57,103, 44,229,156,176, 79,114,206, 89,
+   203, 57,103, 44,229,156,171,151,114,142, 97,204, 57,151, 50,230, 66,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,115, 78,
+   105,205, 57,167, 52,230,156,211,154,115, 78,105,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,
+   110,109,205,185,183, 54, 19,194,120, 79,115,142,117,207, 57,231, 60,231,156,243,158,115,206,121,207, 57,231, 60,231,156,243,158,
+   115,206,121,207, 57,231, 60,231,156,243,158,115,206,121,207, 57,231, 60,231,156,243,158,  9,225, 61,207,185,247, 62,231,220,251,
+   159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,  9,238,129,207,185,247, 62,231,220,
+   251,159,115,238,129,207,185,247, 64,231,220,248, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,116, 46,133,208,186, 23, 66,232, 93,  8, 79,116, 46,132, 39,186,
+    23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,
+   186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,137,209, 58, 39, 68,232,157, 16, 79,  9,225, 61,
+   209,  4,247, 68,232,130,123,162,116, 78,137,209, 58, 39, 68,232,157, 27,162,  9,225, 60, 39,132,240,158, 19,194,120, 79,116,142,
+   145,210, 58, 71, 72,233, 29, 35,164,116,142,144, 39,132,240,158, 19,194,120, 79,116,174,149,210,186, 87, 74,233, 66,123,165,116,
+   161, 61,210,186, 87, 74,233, 93, 43,165,116,174,149,210,186, 87, 74,233, 93, 43,165,116,174,149,210,186, 87, 74,233, 93, 43,165,
+   116,174,149,210,186, 87, 74,233, 93, 43,165,116,174,149,211, 58,103, 76,233,157, 48, 79,116,238,156, 39,186,103, 76,233,221, 51,
+   167,116,161, 60, 39,132,240,158, 19,194,120, 79,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,160, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,117, 46,165,212,186,151, 82,234, 93, 75,169,117,
+    46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,167, 84,234,221, 91,172,117,129, 60, 39,132,240,158, 19,194,120, 79,
+   117,174,181,215, 58,247, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118,  1, 61,216, 59,  7, 96,236, 29,131,
+   176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,
+   131,176,118, 14,193,216, 59,  7, 94,235,221,107,173,117,174,181,214,132,240,158, 19,221,123,175,117,174,189,214,187, 23, 98,236,
+   157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118,110,205,217,187, 55,102,236,221,155,179,118,110,204, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 69,129, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67,
+    40,101, 12,161,148, 50,198, 88,203, 25, 99, 44,101,140,177,150,237, 29,163,180,118,131, 44,101,140,177,150, 50,198, 88,203, 25,
+    99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,123,181,
+   118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,
+   182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,
+   179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,
+   157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,
+   237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,
+   108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,
+   103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,216, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,
+   183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,
+   187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,
+   221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,
+   237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,184, 79,119, 14,225,220, 59,135,
+   112, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,
+   103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219,
+    59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,
+   219, 59,103,108,237,157,179,182,118,206,217,219, 59, 96,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,119, 46,229,220,187,151,114,238, 93,203,
+   185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,
+   203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238,
+    93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,
+   238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,233,221,  4,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,
+   183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,
+   187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,
+   221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,
+   237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,
+   110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,
+   119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,
+   187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,
+   219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,
+   221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,142,241,222, 59,215,122,
+   239, 93,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,
+   118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,222,187,183,118,238,221,227,189,119,142,245,221,187,
+   183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,
+   187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,
+   221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,
+   237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,
+   110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,
+   119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,
+   187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,
+   219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,
+   221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,
+   238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,
+   118,238,221,219,187,119,110,241,222,187,215,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,
+   183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,
+   187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,206,249,223, 59,231,124,239,157,243,191,120, 14,249,
+   223, 59,231,126,240, 29,251,192,120, 46,237,221,187,183,118,238,221,219,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,
+     5,224,188, 23,130,240, 66,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 27,196,120, 79,
+     9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 16, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,
+   148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,
+   163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229,
+    28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,
+   229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71,
+    40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57,
+    71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202,
+    57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,
+   202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 33, 60, 39,132,240,158, 19,194,120, 79,120,175, 21,226,188, 87,138,241,
+    94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,
+   241, 94, 40, 79,120,207, 25,227, 60,103,140,241,158, 51,198,120,207, 24, 39,132,240,158, 19,222, 59,199,121, 15, 33,228, 60,135,
+   144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,
+   135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228,
+    60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,
+   228, 60,135,144,242, 30, 64, 79,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 36, 39,132,240,158, 19,194,120, 79,121, 79,
+    41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121,
+    79, 41,229, 60,167,148,242,130,120, 79,121,111, 45,229,188,183,150,243,  2,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,
+   205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,
+   107,205,121,207, 57,231, 60,231,156,243,158,115,207,121,239, 65,232,189, 23,164,244,158,147,210,122,111, 77,233,189, 55,158,244,
+   130,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 80, 39,189, 87,170,
+   245, 94,171,213,122,175, 84, 39,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,
+   154,243, 94,107,205,  9,225, 60, 39,132,240,158,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,
+   215,154,243, 94,107,205,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,122,207, 89,235, 61,103,172,245,
+   158,179,214,122,207, 89,235, 61,103,172,245,158,179,214,122,207, 89,235, 61,103,172,245,158,179,214,122,207, 89,235, 61,103,172,
+   245,158,179,214,122,239, 93,235,189,119,174,245,222,187,215,122,239, 93,235,189,119,174,245,222,187,215,122,239, 93,235,189,119,
+   174,245,222,187,215,122,239, 93,235,189,119,174,245,222,187,215,123, 15, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,
+   135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,195,217,123, 79,109,237,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,
+   220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,
+   227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247,
+    30,227,220,123,143,113,238,  4,240,158, 19,194,123,221,123,143,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,
+   247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,
+   188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,  9,225, 60, 39,132,
+   240,158, 19,194,123,221,123,175,117,238,189,247,190,247,222,251,223,123,239,125,239,189,247,190,247,222,251,223,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,124, 15,133,241, 32,103,198, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,124,143,144, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,
+   229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95,
+    43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249,
+    95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,
+   249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,
+   202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190,
+    87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,
+   190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,
+   242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,
+   149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,
+   175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,
+   230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159,
+    51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,
+   159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,
+   249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,
+   204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,
+   103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243,
+    62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,
+   243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,
+   153,243, 62,103,204,249,130,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   124,175,149,242,190, 87,202,249, 95, 43,229,124,161, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,124,239,157,243,190,112,158,249,223, 59,231,124,239,157,243,190,112,158,249,223, 56, 79,
+    67, 72, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170,
+    21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,
+   170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133,
+    80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,
+   133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84,
+    42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161,
+    84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,
+   161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85,
+    10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168,
+    85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,
+   168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21,
+    66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170,
+    21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 67, 72,105, 13,  4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 61, 10,  4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 66,136, 81, 10,  4,240,158,134, 66,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,244, 50,134, 80,202, 25,  9,225, 60, 39,132,240,158, 19,194,120, 79,125, 15,161,244, 62,135,
+   208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,
+   135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244,
+    62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,
+   244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,
+   161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125,
+    15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,
+   125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,
+   232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31,
+    67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250,
+    31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,
+   250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,
+   208,250, 31, 67,232,125, 15,161,244, 62,128,158, 19,194,120, 79,125, 47,165,244,190,151,210,250, 95, 75,233,125, 47,165,244,190,
+   151,210,250, 95, 75,233,125, 47,165,244,190,151,210,250, 95, 75,233,125, 47,165,244,190,151,210,250, 95, 75,233,125, 47,165,244,
+   190,151,210,250, 95, 75,233,125, 47,165,244,190,151,210,250, 95, 75,233,125, 47,165,244,190,151,210,250, 95, 75,233,125, 47,165,
+   244,190,151,210,250, 95, 75,233,125, 47,165,244,190,151,210,250, 95, 75,233,125, 47,165,244,190,151,210,250, 95, 75,233,125, 47,
+   165,244,190,151,210,250, 95, 75,233,125, 47,165,244,190,151,210,250, 95, 75,233,125, 47,165,244,190,151,210,250, 95, 75,233,125,
+    47,165,244,132,240,158, 19,194,120, 79,125, 47,165,244,190,151,210,250, 95, 75,233,125, 47,165,244,190,151,210, 19,194,120, 79,
+   125, 47,165,244,190,151,210,250, 95, 75,233,125, 33, 60, 39,132,240,158, 19,194,120, 79,125, 47,165,244,190,151,210,250, 95, 75,
+   233,125, 47,164, 39,132,247,212,250,223, 91,236, 55, 70,232,221, 27,160,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,
+   224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,
+     5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,120, 79, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120,
+    47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 32,228,
+    28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,
+   228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7,
+    32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,
+     7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200,
+    57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,112,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,
+   114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,
+   144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,
+   131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228,
+    28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,
+   228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7,
+    32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,
+     7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200,
+    57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,
+   200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14,
+    65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114,
+    14, 65,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,
+   114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,
+   144,114, 14, 65,200, 56, 79,  9,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,
+   131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228,
+    28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14,251, 76, 24, 94, 11,
+   193,120,131,144,114, 14, 96,223,107,237,125,175,181,246,155,163,116,110,141,209,186, 55, 70,232,221,  5,224,188, 23,130,240, 94,
+    11,193,120, 47, 16,114, 14, 23,130,240, 94, 11,193,120, 47,  5,226, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,
+     7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28, 47,  5,224,188, 23,136,
+    57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,
+   200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14,
+    65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,231,  4,224,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,171,
+    21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,
+   171, 21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197,
+    88,171, 21, 98,172, 85,138,177, 86, 42,197,247, 62,231,220,172, 66,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 72,137, 17, 34, 36, 68,136,145,
+    18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 64,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 64,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156,
+    19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,
+   156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,
+   224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,
+     4,224,156, 19,130,112, 78,  8, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,
+   137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,129, 60, 39,132,240,158, 19,194,120, 79,
+    56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,
+   194, 56, 71,  8, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,
+   152, 51,  6, 96,204, 25,131, 51,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,
+   142, 17,194, 56, 71,  8,225, 28, 35,132,112,129,152, 51,  6, 96,204, 25,131, 48,102, 19,193,152, 51,  6, 96,204, 25,131, 48,102,
+    12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,
+   132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131,
+    48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 51,132, 19,206, 17,194,  9,225, 60,225,
+     4,240,158,112,142, 16, 79,  9,231,  8,225, 28, 35,132, 19,206, 17,194, 56, 71,  8,225, 28, 35,132,112,129,152, 51,  6, 96,204,
+    39,131, 48,158, 12,193,152, 51,  6, 96,204, 25,131, 48,158, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 71,
+     8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56,
+    71,  8, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,
+     6, 96,204, 25,131, 51,132,112,130,121,194, 56, 71,  8,225,  4,240,158,112,142, 17,194, 56, 71,  8,225, 28, 35,132, 19,206, 17,
+   194, 56, 71,  8,225, 28, 35,132, 19,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,
+   152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 71,  8, 39,156, 35,132,112,142, 16, 79, 56, 71,  8,225, 28, 35,132, 19,
+   206, 16, 79,  9,225, 60,225, 28, 35,132,112,142, 17,194, 56, 65, 60, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102,
+    12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 51,132,112,142, 17,194, 56, 71,  8,225, 28, 35,
+   132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,129,152, 51,  6, 96,204, 25,131,
+    48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 71,  8,225,
+    28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,
+    25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,
+   204, 25,131, 51,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56,
+    71,  8,225, 28, 35,132,112,129,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,
+     6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,
+   194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,
+   152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 51,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,
+   142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,129,152, 51,  6, 96,204, 25,131, 48,102,
+    12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 71,  8,225, 28, 35,
+   132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8, 25,131,
+    48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,
+   131, 48,102, 12,194,120, 79, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,
+   225, 28, 35,132,112,142, 17,194, 56, 79,188, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,
+   204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,155, 32,102, 12,193,152, 51,  6, 96,204,225, 28, 35,132,112,142, 17,194, 56,
+    71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 62,240,102, 12,193,152, 51,
+     6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102,108,129,152,
+    51,  6, 96,204, 25,131, 51,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142,
+    17,194, 56, 71,  8,225, 28, 35,132,251,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,
+   193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,153,178,  6, 96,204, 25,131, 48,102, 12,206, 17,194, 56, 71,  8,225, 28, 35,132,
+   112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 19,239,  6, 96,204, 25,131, 48,
+   102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6,102,200, 25,131,
+    48,102, 12,193,152, 51, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225,
+    28, 35,132,112,142, 17,194, 56, 79,188, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204,
+    25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,155, 32,102, 12,193,152, 51,  6, 96,204,225,  3, 48,158, 19,223,131,240,126, 15,
+   193,248, 63,  7,224,252, 31,131,240,126, 15,193,248, 63,  7,224,252, 31,131,240,126, 15,193,248, 63,  7,224,252, 31,131,240,126,
+    15,193,248, 63,  7,224,252, 31,131,240,126, 15,193,248, 63,  7,224,252, 31,131,240,126, 15,193,248, 63,  7,224,252, 31,131,240,
+   126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,
+   241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,
+   139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252,
+    95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,
+   252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,
+   226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63,
+    39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249,
+    63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,241,126, 47,197,
+   248,191, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,
+   201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126,
+    79,201,249, 63, 39,228,252, 95,139,241,126, 47,197,248,191, 23,226,252,159,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,
+   126, 47,197,248,191, 23,228,252, 95,139,243,126,143,205,249,191, 80,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,191, 39,228,252,159,147,242,  9,239,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,
+   147,242,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 30,  3,
+   176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 79,  9,225, 60, 39,
+   132,240,158, 14,193,216, 59,  7, 96,236, 29,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   126,207,217,251, 63,103,236,253,159,176, 79,126,207,217,251, 63,103,236,253,159,179,246,126,207,217,251, 63,103,236,253,159,179,
+   246,126,193, 60, 39,191,103,236,253,159,179,246,126,207,216, 39,191,103,236, 19,223,179,246,126,207,217,251,  4,240,158, 19,194,
+   120, 79, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97,
+    76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10,
+    97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 66,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 93,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   126,239,221,251,191,119,238,253,223,187,247,126,239,221,251,191,119,238,253,223,187,247,126,239,221,251,191,119,238,253,223,187,
+   247,126,239,221,251,191,119,238,253,223,187,247,126,239,221,251,191,119,238,253,223,187,247,126,239,221,251,191,119,238, 19,194,
+   120, 79,127, 15,225,252, 63,135,240,254, 31,195,249,127, 47,229,252,191,151,242,254, 66,120, 79,127, 79,233,253, 63,167,244,254,
+   159,211,250,127, 79,232, 39,132,240,158, 19,223,187,251,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,127,143,241,254, 63,199,248,255, 31,227,252,127,143,241,254, 63,199,248,255, 31,227,252,127,143,241,254,
+    63,199,248,255, 31,227,252,127,143,241,254, 63,199,248,255, 31,232, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,
+   249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,
+   207,249,255, 63,231,254,255,223,251,255,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  0, 39,132,240,158, 19,194,124,  1,
+     9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,
+     0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 56,  9,  1, 32, 36,  4,128,176, 22,  2,192, 88,
+    11,  1, 96, 44,  5,128,176, 20, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,
+   228, 92,139,145,112,158, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,184, 79,
+   128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,
+     6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160,
+    52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,
+   160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,
+     1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104,
+    13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,
+   104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3,
+    64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,
+     3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 12, 19,194,124,  7,128,240, 30,  3,192,120, 15,  1,224, 60,  7,129, 16,
+    34,  4, 64,136, 17,  2, 32, 64, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,
+     9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160,
+    84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 23,  2,
+   224, 92, 11,129,112, 46,  5,192,192,158, 19,194,120, 79,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 52, 39,132,240,158,
+    19,224,116, 14,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,
+   129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124,
+    15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 33,  3,224,
+   124, 15,130, 48, 62,  7,192,248, 30, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,
+   248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,
+   192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,148, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,
+     7,192,248, 31,  3,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    15,225,252, 63,135,240,158, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,
+   127, 15,225,252, 63,135,240,254, 31,195,248,127,  9,225,252, 63,132,240,254, 19,194,120,127,  9,225,252, 63,135,240,254, 31,195,
+   248,127, 15,225,252, 63,132,240,254, 31,195,248,127,  9,225,252, 39,135,240,158, 19,194,120, 79,  9,225, 60, 63,132,240,158, 19,
+   194,120,127,  9,225,252, 39,135,240,158, 31,195,248,127,  9,225,252, 63,132,240,254, 19,194,120,127,  9,225,252, 39,135,240,158,
+    31,194,120,127,  9,225,252, 63,132,240,254, 19,194,120,127, 15,225,252, 63,132,240,254, 31,195,248,127, 15,225,252, 63,132,240,
+   254, 31,195,248,127,  9,225,252, 63,135,240,254, 19,195,248, 79, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 39,135,
+   240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,158, 19,194,120, 79,  9,225,252, 63,
+   135,240,158, 31,195,248,127, 15,225,252, 39,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252,
+    63,135,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79, 14, 97,204, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    59,135,112,238, 29,195,176,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,
+   220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,200, 39,  4,224,
+   156, 19, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119,
+    14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,
+   119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,
+   184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,
+   195,184,119, 14,225,220, 59,135,112,238, 29,200, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19, 59,135,112,238,
+    29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,228, 19,130,103,112,238, 29,195,184,119, 14,225,220, 59,135,112,
+   238, 29,195,184,119, 14,225,220,130,103,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,216,130,103,
+   112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,
+   135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 32,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+     6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,156,211,154,119, 14,225,220, 59,167,116,238,157,211,186,119, 78,233,
+   221, 59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 72,
+    56, 42, 59,199,120,239, 29,227,188,119,142,241,222, 59,199,120,239, 29,227,188,119,142,241,222, 59,199,120,239, 29,227,188,119,
+   142,241,222, 59,199,120,238,157,211,186,119, 78,233,221, 59,199,120,239, 29,227,188,119,142,241,222, 59,199,120,239, 29,227,188,
+   119,142,241,222, 59,199,120,239, 29,227,188,119,142,241,222, 59,199,120,224,156, 16, 84,119, 14,225,220, 59,231,124,239, 29,227,
+   188,119,142,241,222, 59,199,120,239, 29,227,188,119,142,249,223, 59,199,120,239, 29,227,188,119,142,241,222, 59,199,120,238,157,
+   211,186,119, 96,161,221, 59,176, 82, 10, 65, 72, 41,  5, 32,164, 20,130,144, 82, 10, 29,211,186,119, 78,233,221, 59,167,116,238,
+   157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 32,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,
+     9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112,
+    78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,172, 21,130,
+   176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,
+   130,200,153, 19, 65, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19, 68,  8,129, 16, 34,  4, 64,136, 17,  2,
+    32, 68,  8,129, 19, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,
+     2, 38, 68,  8,129, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,  8, 39,  4,224,156, 19, 68,  8,129, 16, 34,  4, 64,136,
+    17,  2, 32, 68, 16, 78,  9,193, 56, 39,  4,224,156, 19, 68,200,154,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,
+     4,224,156, 19, 59,  7, 96,236, 29,131,176,118, 32,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56,
+    39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193,
+    56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,
+   193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,
+     9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112,
+    78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,
+   112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+    59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,
+   216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,118, 14,
+   193,216, 59,  7, 96,236, 29,131,176,118, 14,225,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118,
+    14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,
+   118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,
+   176,118, 14,193,216, 59,  7, 96,236, 29,131,176,119, 14,193,216, 59,  7, 96,236, 29,131,176,122, 78,193,216, 59,  7, 96,236, 29,
+   131,176,118, 14,193,216, 59,  7, 96,236, 29,131,184,119, 14,225,220, 59,135,112,238, 29,192, 84, 10,142,225,220, 59,  7, 96,236,
+    29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118,206,217,216, 59,  7, 96,
+   236, 29,131,182,118, 14,193,216, 59,  7, 96,244,158,147,210,118, 14,193,233, 59,  7, 96,244,158, 99,204,119, 14,225,216, 59,  7,
+    96,236, 29,131,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,
+     7, 96,236, 29,131,176,118, 14,193,216, 59,  7,112,238, 29,195,176,119, 14,225,220, 59,  7, 96,236, 65,120, 47,  5,224,188, 23,
+    59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,
+   216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,
+   193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,220, 59,  7,112,244,158,147,176,118,
+    15, 73,233, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,
+   118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 15, 73,233, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,
+   210,122, 79, 73,233, 61, 39, 96,236, 29,131,210,118, 14,193,216, 59,  7,164,244,158,147,176,122, 79, 73,233, 59,  7, 96,236, 29,
+   131,176,118, 14,193,233, 59,  7,164,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,103, 96,237,
+   157,131,182,118, 14,193,216, 59,  7, 96,244,157,131,176,118, 14,193,219, 59,  7,108,237,157,131,176,118, 14,193,216, 59,  7, 96,
+   236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7,
+    96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,
+     7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,119, 14,225,216,
+    59,103,108,237,157,179,182,118,206,217,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,
+   219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,
+   193,216, 59,  7, 96,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,  9,193, 56, 39,  4,224,156, 19,130,112,
+    65, 80, 42,  5, 64,168,238, 29,131,176,118, 14,193,220, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,
+   118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,
+   204,121,142,225,220, 59,135,112,244,157,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,
+   195,184,119, 14,225,220, 60,199,112,238, 29,195,184,122, 79, 73,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238,
+    29,195,176,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,
+   238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,
+   112,238, 29,192, 84, 10,129, 80, 42,  5, 64,168, 21,  2,163,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,
+   135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,192, 84, 10,129, 80, 42,  5, 64,168,238, 29,131,176,118, 14,193,216,
+    59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,
+   216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,
+   193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,122,
+    79, 73,233, 59,  7, 96,236, 30,147,210,122, 79, 73,233, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,
+   112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+   130,112, 79, 89,235, 61,112, 98, 12, 65,131,130,112, 78,  9,193, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,
+   131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236,
+    30,147,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,210,122, 79, 73,216, 59,  7, 96,
+   236, 29,131,176,118, 14,193,216, 61, 39, 96,236, 29,131,176,118, 14,225,220, 59,135,112,238, 29,195,210,119, 14,225,220, 59,  7,
+    96,236, 29,195,184,118, 14,193,216,130,112, 78,  9,193, 51,176,118, 14,193,216, 59,135,112,238, 29,195,184,119, 14,225,220, 59,
+   135,112,238, 29,131,177,  4,224,156, 19, 59,135,112,238, 29,195,176,118, 14,193,216, 59,  7, 96,236, 29,131,177,  4,224,156, 19,
+    56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,
+   193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,
+     9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112,
+    78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,
+   112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+   184,119, 14,228, 19,130,112, 78,  9,157,195,184,119, 14,225,220, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156,
+    19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,
+   156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,
+   224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,
+     4,224,156, 19,130,119, 14,225,220, 59,135,114,  9,193, 56, 39,  4,224,156, 19, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,
+     7, 96,236, 29,136, 39,  4,224,156, 19, 59, 16, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+    56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 24, 39,  4,224,156, 19, 56, 39,  4,224,156, 19,130,112, 78,  9,
+   193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,
+     9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112,
+    78,  9,193,130,112, 78,  9,193, 56, 39,  4,224,156, 19, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  6,  9,193, 56, 39,
+     4,224,156, 19, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+   130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193,130,112, 78,  9,193,
+    56, 39,  4,224,156, 19, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,
+   156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 96,156, 19, 59,135,114,  9,193, 56, 39,  4,224,156, 19,130,112, 78,
+     9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112,
+    78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,
+   112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+    56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,210,118, 14,193,233, 59,  7, 96,236, 29,131,176,118, 14,193,
+   216, 61, 39,164,244,158,147,210,122, 79, 73,233, 59,  7, 96,236, 29,131,176,118, 15, 73,216, 59,  7, 96,236, 29,131,176,118, 14,
+   193,216, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,236, 33, 51,210,122, 79, 73,216, 59,  7, 96,236, 29,131,176,118,
+    16,153,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,
+   118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,
+   176,118, 14,193,233, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,
+   131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236,
+    29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,122, 79, 73,216, 61, 39,164,
+   236, 30,147,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,122, 79, 73,233, 59,  7,
+   164,244,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,210,122, 78,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,
+     7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216,
+     5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80,
+    42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129,
+    80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,
+   129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,168, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,
+     4,224,156, 19, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 32,156, 19, 59,  7, 96,236, 29,131,
+   176,118, 14,193,216, 59,  7, 96,236, 29,131,177,  4,224,156, 19, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59, 16, 78,  9,193,
+    56, 39,  4,224,156, 19, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236,
+    29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,
+   236, 29,131,176,118, 32,153,216, 59,  7, 96,236, 30,147,210,122, 96,156, 19,130,112, 78,  9,193, 56, 39,  4,206,193,216, 59,  7,
+    96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,136, 39,  4,224,156, 19, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,
+    16, 78,  9,193, 56, 39,  4,224,156, 19, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 48, 78,  9,193, 56, 39,  4,224,156, 19,
+    56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,
+   193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,
+     9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112,
+    78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,
+   112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+   130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156,
+    19,130,112, 78,  9,193, 56, 39,  4,224,132,243,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,
+   156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,
+   224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,126, 15,193,248, 63,  7,224,252, 31,131,240,126, 15,192, 39,132,240,158, 19,194,120, 79,
+   130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156,
+    19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,
+   156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,
+   224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,
+     4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56,
+    39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,194,120, 79, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,
+   132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161,
+    20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,
+   161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78,
+    73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114,
+    69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66,
+    40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17,
+    66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 57, 39, 36,228,156,147,146,114, 69,  8,161, 20, 34,132, 80,138,
+    17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,
+   138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132,
+    80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,
+   132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 19,146,114, 69,  8,161, 20,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161,
+    20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,
+   161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,
+     8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40,
+    69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66,
+    40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,
+   146,114, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138,
+    17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,
+   138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132,
+    80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,
+   132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161,
+    20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,
+   161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  9,201, 57, 39, 36,228,156,147,146,114, 78,
+    73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114,
+    78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,
+   114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,
+   146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,
+   147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,
+   156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,
+   228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,
+   132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 19,146,114, 78, 73,201, 57,
+    39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201,
+    57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,
+   201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78,
+    73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114,
+    78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,
+   114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,
+   146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,
+   147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,
+   156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,
+   228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,130,120, 79, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,
+   132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161,
+    20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 39, 36,228,156,147,146,114, 69,  8,
+   161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,
+     8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40,
+    69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66,
+    40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17,
+    66, 40, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,
+   147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,
+   156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,
+   228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 54,166,232,218,155, 83,106,109, 77,169,181, 54,166,212,218,155,
+    83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 49,134, 48,198,
+    24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,
+   198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134,
+    48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,
+   134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140,
+    54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,
+   181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,
+   169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109,
+    77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,
+   109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,
+   106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,
+   160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,
+     4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40,
+    37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65,
+    40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9,
+    65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,
+     9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80,
+    74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130,
+    80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,
+   130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148,
+    18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74, 54,166,212,218,155, 83,
+   106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167,
+    20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,
+   167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197,
+    56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,
+   197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78,
+    41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 66,120, 79,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+constexpr uint64_t ucd_text_properties_records[1049] = {
+    0x00000f8818000221, 0x00000f8820100421, 0x00000f8828208641, 0x00000f8820110821, 0x00000f8830110821, 0x00000f8828318a61, 0x00000f8828000221, 0x00000f8820000221,
+    0x00000f8831120c1d, 0x00000f8801400e15, 0x00000f8801529015, 0x00000f8839001215, 0x00000f8839001417, 0x00000f8839001615, 0x00000f8801001215, 0x00000f8801531015,
+    0x00000f8901501816, 0x00000f8a01501a12, 0x00000f8841001419, 0x00000f8849639c15, 0x00000f8841601e11, 0x00000f8849741c15, 0x00000f8849002015, 0x00000f885184a20d,
+    0x00000f8849651c15, 0x00000f8801039c15, 0x00000f8801001219, 0x0000035c09959209, 0x00000f8801001415, 0x00000f8801001218, 0x00000f8801061210, 0x0000035c09a59205,
+    0x00000f8801000419, 0x00000f8a01502412, 0x00000f8828b12621, 0x00000f884810281d, 0x00000f8802001815, 0x00000f8839001617, 0x00000f883a001417, 0x00000f880100121a,
+    0x00000f8802002a15, 0x00000f8802002a18, 0x00000f880000129a, 0x0000035c0aa5aa07, 0x00000f8800501014, 0x00000f881ac68422, 0x00000f880200129a, 0x00000f883a00161a,
+    0x00000f883a001419, 0x00000f8852002a0f, 0x00000f8802002c18, 0x00000f8808a59205, 0x00000f8802052a15, 0x00000f8800501013, 0x00000f8802002a0f, 0x0000035c08959209,
+    0x0000035c0a959209, 0x00000f8802002a19, 0x0000035c0aa59205, 0x0000035c08a59205, 0x0000035c08d59207, 0x0000035c08959208, 0x0000035c08a59206, 0x00000f8800d59206,
+    0x00000f8808d59206, 0x00000f8808a59206, 0x00000f8800059218, 0x00000f8802059218, 0x00000f8802d5aa06, 0x00000f8800d5ac06, 0x00000f880ad5aa06, 0x00000f8800001218,
+    0x00000f880205ac18, 0x0000047400059218, 0x00000f885ae702ac, 0x00000f885ae728ac, 0x0000032008959209, 0x0000032008a59205, 0x0000032000001218, 0x0000000000000000,
+    0x0000032008a59206, 0x00000f8800039c15, 0x00000f8800051215, 0x000003200a959209, 0x000003200aa59205, 0x0000033008959209, 0x0000033008a59205, 0x0000032000001219,
+    0x0000037008959209, 0x000003700a959209, 0x000003700aa59205, 0x0000037008a59205, 0x000003700800121a, 0x0000037058e702ac, 0x00000f8858e702ac, 0x0000037058e702ab,
+    0x0000039808959209, 0x0000039808d59206, 0x0000039808059215, 0x0000039808601215, 0x0000039808051215, 0x0000039808a59205, 0x0000039808439c15, 0x0000039800058411,
+    0x000003980000121a, 0x0000039838001417, 0x000001f458e702ac, 0x000001f410000411, 0x000001f410001215, 0x000001f410000e15, 0x000001f410d7ae07, 0x000001f410d59215,
+    0x000001f410051215, 0x0000028060c692c2, 0x00000f8860c692c2, 0x0000028000001219, 0x0000028068001219, 0x0000028038001615, 0x0000028068001617, 0x00000f8848639c15,
+    0x0000028068639c15, 0x000002800000121a, 0x0000028058e702ac, 0x00000f8868000e15, 0x0000028068c68222, 0x0000028068400e15, 0x00000f8868400e15, 0x0000028068d59207,
+    0x00000f8868d59206, 0x000002806084a20d, 0x000002806084a215, 0x000002806083a215, 0x0000028068001215, 0x0000028068d59206, 0x000002805084a20d, 0x000002806800121a,
+    0x0000021c68401215, 0x0000021c68001215, 0x0000021c68c692c2, 0x0000021c68d59207, 0x0000021c58e702ac, 0x000002a868d59207, 0x000002a858e702ac, 0x000002941084a20d,
+    0x0000029410d59207, 0x0000029458e702ac, 0x0000029410d59206, 0x000002940000121a, 0x0000029400001215, 0x0000029400639c15, 0x0000029400400e15, 0x0000029410001417,
+    0x000001ec10d59207, 0x000001ec58e702ac, 0x000001ec10d59206, 0x000001ec10001215, 0x000001ec10401215, 0x0000023010d59207, 0x0000023058e702ac, 0x0000023010001215,
+    0x0000028068001218, 0x000004ec58e702ac, 0x000004ec08e702ea, 0x000004ec08d59207, 0x00000f8808400415, 0x000004ec0884a20d, 0x000004ec08001215, 0x000004ec08d59206,
+    0x0000051408d59207, 0x0000051458e702ac, 0x0000051408e702ea, 0x0000051408e702aa, 0x000005140884a20d, 0x0000051438001617, 0x000005140800120f, 0x000005140800160f,
+    0x000005140800121a, 0x0000051438001417, 0x0000051408001215, 0x000004d858e702ac, 0x000004d808e702ea, 0x000004d808d59207, 0x000004d80884a20d, 0x000004d808001215,
+    0x0000050058e702ac, 0x0000050008e702ea, 0x0000050008d59207, 0x000005000884a20d, 0x0000050008001215, 0x0000050038001417, 0x0000051c58e702ac, 0x0000051c08e702ea,
+    0x0000051c08d59207, 0x0000051c08e702aa, 0x0000051c0884a20d, 0x0000051c0800121a, 0x0000051c0800120f, 0x0000056858e702ac, 0x0000056808d59207, 0x0000056808e702aa,
+    0x0000056808e702ea, 0x000005680884a20d, 0x000005680800120f, 0x000005680000121a, 0x0000056838001417, 0x0000055058e702ac, 0x0000055008e702ea, 0x0000055008d59207,
+    0x000005500884a20d, 0x0000055008002c15, 0x000005500000120f, 0x000005500800121a, 0x0000056408d59207, 0x0000056458e702ac, 0x0000056408e702ea, 0x0000056408002c15,
+    0x0000056408e702ac, 0x0000056408e702aa, 0x000005640884a20d, 0x0000056c58e702ac, 0x0000056c08e702ea, 0x0000056c08d59207, 0x0000056c08e702aa, 0x0000056c08d592c7,
+    0x0000056c0800121a, 0x0000056c0800120f, 0x0000056c0884a20d, 0x0000056c0800161a, 0x0000057058e702ac, 0x0000057008e702ea, 0x0000057008d59207, 0x0000057008e702aa,
+    0x000005700884a20d, 0x0000057008001215, 0x0000058008d03007, 0x0000058058e730ac, 0x0000058008d030e7, 0x00000f8838001417, 0x0000058008d03006, 0x0000058008001215,
+    0x000005800884a20d, 0x0000058008000415, 0x0000059008d03007, 0x0000059058e730ac, 0x0000059008d030e7, 0x0000059008d03006, 0x000005900884a20d, 0x0000052808d59207,
+    0x0000052808002c1a, 0x0000052808002c15, 0x0000052808001215, 0x0000052808002815, 0x0000052808000415, 0x0000052808000e15, 0x000005280800121a, 0x0000052858e702ac,
+    0x000005280884a20d, 0x000005280800120f, 0x000005280800041a, 0x0000052900501816, 0x0000052a00502412, 0x0000052808e702ea, 0x0000052808e704ea, 0x00000f880800121a,
+    0x0000057808d03007, 0x0000057808e7300a, 0x0000057858e730ac, 0x0000057808e730ea, 0x000005780884a20d, 0x0000057808400415, 0x0000057808001215, 0x000005780800301a,
+    0x000003c008959209, 0x000003c008d59205, 0x00000f8808001215, 0x000003c008a59206, 0x000004780bd5b307, 0x0000047808d5b527, 0x0000047808d5b747, 0x000006b808d59207,
+    0x000006b858e702ac, 0x000006b808001215, 0x000006b808000415, 0x000006b808401215, 0x000006b80800120f, 0x000006b80000121a, 0x000006f408959209, 0x000006f408a59205,
+    0x000006e000000411, 0x000006e008d59207, 0x000006e00800121a, 0x000006e008401215, 0x000003503012041d, 0x0000035008d59207, 0x0000035100501816, 0x0000035200502412,
+    0x0000034c08d59207, 0x00000f8808000415, 0x0000034c08d5920e, 0x000005c808d59207, 0x000005c858e702ac, 0x000005c808e702ea, 0x000005cc08d59207, 0x000005cc58e702ac,
+    0x000005cc08e702ea, 0x000005d008d59207, 0x000005d058e702ac, 0x000005d408d59207, 0x000005d458e702ac, 0x0000058c08d03007, 0x0000058c58e730ac, 0x0000058c08e730ea,
+    0x0000058c08000415, 0x0000058c08003815, 0x0000058c08d03006, 0x0000058c08001215, 0x0000058c38001417, 0x0000058c0884a20d, 0x0000058c0000120f, 0x0000024400001215,
+    0x00000f8800600e15, 0x00000f8800400e15, 0x0000024400000415, 0x00000f8800000415, 0x0000024400002c11, 0x0000024400600e15, 0x0000024400400e15, 0x0000024458e702ac,
+    0x0000024418c6a822, 0x000002440884a20d, 0x0000024408d59207, 0x0000024408d59206, 0x0000054008d59207, 0x0000054058e702ac, 0x0000054008e702ea, 0x000005400000121a,
+    0x0000054000400e15, 0x000005400884a20d, 0x0000058408d03007, 0x0000058808d03007, 0x000005880884a20d, 0x000005880800300f, 0x000005880000301a, 0x0000058c0000121a,
+    0x000005bc08d59207, 0x000005bc58e702ac, 0x000005bc08e702ea, 0x000005bc08001215, 0x0000057c08d03007, 0x0000057c08e730ea, 0x0000057c58e730ac, 0x0000057c08e7300a,
+    0x0000057c58e702ac, 0x0000057c0884a20d, 0x0000057c08003015, 0x0000057c08d03006, 0x0000057c08403015, 0x00000f8858e702ab, 0x000005a058e702ac, 0x000005a008e702ea,
+    0x000005a008d59207, 0x000005a008e702aa, 0x000005a00884a20d, 0x000005a008400415, 0x000005a008001215, 0x000005a008000415, 0x000005a00800121a, 0x000005a858e702ac,
+    0x000005a808e702ea, 0x000005a808d59207, 0x000005a80884a20d, 0x000005b408d59207, 0x000005b458e702ac, 0x000005b408e702ea, 0x000005b408001215, 0x0000053c08d59207,
+    0x0000053c08e702ea, 0x0000053c58e702ac, 0x0000053c08400415, 0x0000053c08000415, 0x0000053c0884a20d, 0x000004140884a20d, 0x0000041408d59207, 0x0000041408d59206,
+    0x0000041408400415, 0x000003c008d59209, 0x000005a808001215, 0x00000f8808e702ea, 0x00000f8808d59207, 0x0000037008a59206, 0x00000f8858e728ac, 0x0000032008959208,
+    0x0000032000002c18, 0x00000f883012041d, 0x00000f883010281d, 0x00000f8818c03a22, 0x00000f8818e702a2, 0x00000f8818e83d62, 0x00000f8808c68222, 0x00000f8810c68222,
+    0x00000f8802000411, 0x00000f8800002811, 0x00000f8800000411, 0x00000f8802600411, 0x00000f8802603e11, 0x00000f8802002a11, 0x00000f8800001215, 0x00000f8802541014,
+    0x00000f8802541013, 0x00000f8800501816, 0x00000f8802501014, 0x00000f8802501013, 0x00000f8802001215, 0x00000f8802744015, 0x00000f8802004015, 0x00000f8802050415,
+    0x00000f8830b1083b, 0x00000f8828b1083c, 0x00000f8870c68222, 0x00000f8878c68222, 0x00000f8880c68222, 0x00000f8888c68222, 0x00000f8890c68222, 0x00000f884816281d,
+    0x00000f883a001615, 0x00000f8838001615, 0x00000f8802001615, 0x00000f8800001615, 0x00000f8800403895, 0x00000f8800403815, 0x00000f8800061210, 0x00000f8848039c19,
+    0x00000f8900501816, 0x00000f8a00502412, 0x00000f8800001219, 0x00000f8818c6c222, 0x00000f8818c69222, 0x0000000000000020, 0x00000f8898c68222, 0x00000f88a0c68222,
+    0x00000f88a8c68222, 0x00000f88b0c68222, 0x00000f8818c68222, 0x00000f885000120f, 0x00000f8840001219, 0x0000035c0aa5aa06, 0x00000f8838001617, 0x00000f883c001417,
+    0x0000000000001400, 0x00000f880000121a, 0x00000f8808959209, 0x00000f880200161a, 0x00000f8802002a1a, 0x00000f880aa5aa05, 0x00000f880200141a, 0x00000f8802002a9a,
+    0x0000035c0a95aa09, 0x00000f883800121a, 0x00000f8808a59285, 0x00000f880000120f, 0x00000f880200120f, 0x00000f8800002a0f, 0x0000035c0a95aa0e, 0x0000035c0895920e,
+    0x0000035c0aa5aa0e, 0x0000035c08a5920e, 0x0000035c08d5920e, 0x00000f8802002a99, 0x00000f880200121a, 0x00000f8840001419, 0x00000f8838001419, 0x00000f8800004019,
+    0x00000f880300449a, 0x00000f8903501816, 0x00000f8a03502412, 0x00000f880300129a, 0x00000f880000449a, 0x00000f880a002a1a, 0x00000f880a95aa1a, 0x00000f880a95aa9a,
+    0x00000f880aa5aa1a, 0x00000f8800002a1a, 0x00000f8800001299, 0x00000f8803001299, 0x00000f8800002a9a, 0x00000f880200449a, 0x00000f880000469a, 0x00000f880800129a,
+    0x00000f880200469a, 0x00000f880300469a, 0x00000f8803002a9a, 0x00000f880050101a, 0x00000f8800000e1a, 0x00000f8800000e9a, 0x000008e80800121a, 0x0000038408959209,
+    0x0000038408a59205, 0x000003300000121a, 0x0000033058e702ac, 0x0000033000000e15, 0x0000033000000415, 0x000003300000120f, 0x000003c008a59205, 0x000001e008d59207,
+    0x000001e008d59206, 0x000001e008000415, 0x000001e058e702ac, 0x00000f8800501015, 0x00000f8800001815, 0x00000f8800001211, 0x00000f8800003e11, 0x00000f8800400415,
+    0x000007d00300441a, 0x00000f880300441a, 0x00000f883512041d, 0x00000f8803602415, 0x00000f8803402415, 0x00000f8803004415, 0x000007d00bd5b806, 0x00000f880bd04407,
+    0x000007d00bd0440e, 0x00000f8803003811, 0x00000f8803501816, 0x00000f8803502412, 0x00000f885be702ac, 0x000004780be702aa, 0x00000f8803004491, 0x00000f880bd8c406,
+    0x00000f880bd88206, 0x00000f880bd5b807, 0x00000f8803004495, 0x00000f880000441a, 0x000006680bd04807, 0x000006680bd04407, 0x00000f880308b818, 0x000006680bd03806,
+    0x00000f880308b811, 0x0000066c0bd8c807, 0x0000066c0bd8c407, 0x00000f8803003815, 0x00000f880bd8c806, 0x0000066c0bd8b806, 0x000004740bd5c407, 0x000004780bd5c407,
+    0x00000f880b00441a, 0x00000f880b00440f, 0x000004780b00441a, 0x000004780300441a, 0x00000f880a002a0f, 0x00000f880300440f, 0x00000f880b00449a, 0x0000066c0b08c41a,
+    0x000007d00bd04407, 0x000007300bd5c407, 0x000007300bd5b806, 0x000007300300441a, 0x0000063c08d59207, 0x0000063c08d59206, 0x0000063c08000415, 0x0000063c08400415,
+    0x0000075808d59207, 0x0000075808d59206, 0x0000075800000415, 0x0000075800400e15, 0x0000075800400415, 0x000007580884a20d, 0x0000037008d59207, 0x0000037000001215,
+    0x0000037000d59206, 0x000006cc08d59207, 0x000006cc08d5920e, 0x000006cc58e702ac, 0x000006cc08001215, 0x000006cc08400415, 0x000006cc08000415, 0x00000f8808059218,
+    0x000004f008d59207, 0x000004f058e702ac, 0x000004f008e702ea, 0x000004f00000121a, 0x00000f880800120f, 0x0000052c08d59207, 0x0000052c00002c15, 0x0000052c00400e15,
+    0x0000056008e702ea, 0x0000056008d59207, 0x0000056058e702ac, 0x0000056008400415, 0x000005600884a20d, 0x000004ec08002c15, 0x000005940884a20d, 0x0000059408d59207,
+    0x0000059458e702ac, 0x0000059408400415, 0x000005ac08d59207, 0x000005ac58e702ac, 0x000005ac08e702ea, 0x000005ac08001215, 0x000005a458e702ac, 0x000005a408e702ea,
+    0x000005a408d59207, 0x000005a408001215, 0x000005a408000415, 0x000005a408400415, 0x000005a40884a20d, 0x0000057808d03006, 0x0000059808d59207, 0x0000059858e702ac,
+    0x0000059808e702ea, 0x000005980884a20d, 0x0000059808001215, 0x0000059808400415, 0x0000059c08d03007, 0x0000059c58e730ac, 0x0000059c08d03006, 0x0000059c08003015,
+    0x0000054408d59207, 0x0000054408e702ea, 0x0000054458e702ac, 0x0000054408400415, 0x0000054408d59206, 0x000005440884a20d, 0x000004780bd5cb87, 0x000004780bd5cda7,
+    0x0000000008004e04, 0x000000000a000003, 0x0000000003004400, 0x000001f440001219, 0x00000f8800502412, 0x00000f8803639c15, 0x00000f8803002415, 0x00000f8803651c15,
+    0x00000f8803039c15, 0x00000f8803000e15, 0x00000f8803004015, 0x00000f8803604411, 0x00000f8803064410, 0x00000f884b63a415, 0x00000f8803604415, 0x00000f884b742415,
+    0x00000f880303b815, 0x00000f884b653815, 0x00000f8803400e15, 0x00000f883b004415, 0x00000f8843004419, 0x00000f8843604411, 0x00000f8803004419, 0x00000f883b001417,
+    0x00000f883b001615, 0x00000f8805400e15, 0x00000f8805004415, 0x00000f883d004415, 0x00000f883d001417, 0x00000f883d001615, 0x00000f8805044415, 0x00000f8905501816,
+    0x00000f8a05502412, 0x00000f8845004419, 0x00000f884d63a415, 0x00000f8845604411, 0x00000f884d742415, 0x00000f884d004415, 0x00000f885584c40d, 0x00000f884d653815,
+    0x00000f880503b815, 0x00000f8805004419, 0x0000035c0d95c409, 0x00000f8805004418, 0x00000f8805064410, 0x0000035c0da5c405, 0x00000f8804402415, 0x00000f8904501816,
+    0x00000f8a04502412, 0x00000f8804602415, 0x00000f8804003815, 0x0000066c0cd8c407, 0x0000066c0cd8c807, 0x00000f880cd8c806, 0x00000f880ce738a6, 0x000004780cd5c407,
+    0x00000f883d001617, 0x00000f880500441a, 0x00000f880400121a, 0x00000f8804001219, 0x00000f8800c68222, 0x00000f880000501a, 0x0000064408d59207, 0x0000032000d5920e,
+    0x000003200000120f, 0x000003200000121a, 0x000003200800121a, 0x0000032808d59207, 0x0000032408d59207, 0x0000034808d59207, 0x000003480800120f, 0x0000033808d59207,
+    0x0000033808d5920e, 0x0000038c08d59207, 0x0000038c58e702ac, 0x000000a008d59207, 0x000000a008000415, 0x0000007808d59207, 0x0000007808000415, 0x0000007808d5920e,
+    0x000003e808959209, 0x000003e808a59205, 0x0000046408d59207, 0x0000041008d59207, 0x000004100884a20d, 0x0000036c08959209, 0x0000036c08a59205, 0x0000038808d59207,
+    0x000003bc08d59207, 0x000003bc08001215, 0x0000039008959209, 0x0000039008a59205, 0x0000064008d59207, 0x0000035c08d59206, 0x0000064c10d59207, 0x000001f010d59207,
+    0x000001f010000415, 0x000001f01000120f, 0x000001f810d59207, 0x000001f81000121a, 0x000001f81000120f, 0x0000027c10d59207, 0x0000027c1000120f, 0x000001fc10d59207,
+    0x000001fc1000120f, 0x000001cc10d59207, 0x000001cc1000120f, 0x000001cc00000415, 0x000001d010d59207, 0x000001d010001215, 0x0000019010d59207, 0x0000019410d59207,
+    0x000001941000120f, 0x000004c410d59207, 0x000004c458e702ac, 0x000004c41000120f, 0x000004c410000415, 0x000004c410400415, 0x000004c410001215, 0x000001a410d59207,
+    0x000001a41000120f, 0x000001a410001215, 0x000001a810d59207, 0x000001a81000120f, 0x0000022c10d59207, 0x0000022c1000121a, 0x0000022c58e702ac, 0x0000022c1000120f,
+    0x0000022c10000415, 0x0000022c10004015, 0x0000021810d59207, 0x0000021800000415, 0x0000020810d59207, 0x000002081000120f, 0x0000020c10d59207, 0x0000020c1000120f,
+    0x0000021010d59207, 0x0000021010001215, 0x000002101000120f, 0x000002bc10d59207, 0x000002c010959209, 0x000002c010a59205, 0x000002c01000120f, 0x0000029c68d59207,
+    0x0000029c58e702ac, 0x0000029c6084a20d, 0x000002806000120f, 0x0000030010d59207, 0x0000030058e702ac, 0x0000030010000411, 0x0000023810d59207, 0x000002381000120f,
+    0x0000023468d59207, 0x0000023458e702ac, 0x000002346800120f, 0x0000023468401215, 0x0000023c10d59207, 0x0000023c58e702ac, 0x0000023c10401215, 0x000001b410d59207,
+    0x000001b41000120f, 0x0000020010d59207, 0x000004b008e702ea, 0x000004b058e702ac, 0x000004b008d59207, 0x000004b008400415, 0x000004b008001215, 0x000004b00000120f,
+    0x000004b00884a20d, 0x000004f458e702ac, 0x000004f408e702ea, 0x000004f408d59207, 0x000004f408001215, 0x000004f408c692c2, 0x000004f408400415, 0x0000063808d59207,
+    0x000006380884a20d, 0x0000057458e702ac, 0x0000057408d59207, 0x0000057408e702ea, 0x000005740884a20d, 0x0000057408000415, 0x0000057408400415, 0x000004e808d59207,
+    0x000004e858e702ac, 0x000004e808001215, 0x000004e808002c15, 0x000004fc58e702ac, 0x000004fc08e702ea, 0x000004fc08d59207, 0x000004fc08d592c7, 0x000004fc08400415,
+    0x000004fc08001215, 0x000004fc08000415, 0x000004fc08401215, 0x000004fc0884a20d, 0x000004fc08002c15, 0x000005700800120f, 0x0000050808d59207, 0x0000050808e702ea,
+    0x0000050858e702ac, 0x0000050808400415, 0x0000050808001215, 0x0000050c08d59207, 0x0000050c08400415, 0x000004f808d59207, 0x000004f858e702ac, 0x000004f808e702ea,
+    0x000004f80884a20d, 0x0000055c58e702ac, 0x0000055c08e702ea, 0x0000055c08d59207, 0x0000055c08e702aa, 0x0000053408d59207, 0x0000053408e702ea, 0x0000053458e702ac,
+    0x0000053408400415, 0x0000053408000415, 0x0000053408001215, 0x000005340884a20d, 0x0000051808d59207, 0x0000051808e702aa, 0x0000051808e702ea, 0x0000051858e702ac,
+    0x0000051808001215, 0x000005180884a20d, 0x000004b808d59207, 0x000004b808e702aa, 0x000004b808e702ea, 0x000004b858e702ac, 0x000004b808002c15, 0x000004b808400415,
+    0x000004b808000e15, 0x000004b808001215, 0x0000051008d59207, 0x0000051008e702ea, 0x0000051058e702ac, 0x0000051008400415, 0x0000051008001215, 0x000005100884a20d,
+    0x0000024400002c15, 0x0000050408d59207, 0x0000050458e702ac, 0x0000050408e702ea, 0x0000050408001215, 0x000005040884a20d, 0x0000054808d03007, 0x0000054858e730ac,
+    0x0000054808e7300a, 0x0000054808e730ea, 0x000005480884a20d, 0x000005480800300f, 0x0000054808400415, 0x000005480800301a, 0x0000052008d59207, 0x0000052008e702ea,
+    0x0000052058e702ac, 0x0000052008001215, 0x0000041808959209, 0x0000041808a59205, 0x000004180884a20d, 0x000004180800120f, 0x0000041808d59207, 0x0000055808d59207,
+    0x0000055808e702aa, 0x0000055808e702ea, 0x0000055858e702ac, 0x0000055808d592c7, 0x0000055808400415, 0x0000055808000415, 0x000005580884a20d, 0x000004dc08d59207,
+    0x000004dc08e702ea, 0x000004dc58e702ac, 0x000004dc08002c15, 0x0000054c08d59207, 0x0000054c58e702ac, 0x0000054c08e702ac, 0x0000054c08e702ea, 0x0000054c08d592c7,
+    0x0000054c08002c15, 0x0000054c08001215, 0x0000054c08000415, 0x0000054c08400415, 0x0000052408d59207, 0x0000052458e702ac, 0x0000052408e702ea, 0x0000052408d592c7,
+    0x0000052408000415, 0x0000052408400415, 0x0000052408002c15, 0x0000041c08d59207, 0x0000053808d59207, 0x0000053808e702ea, 0x0000053858e702ac, 0x0000053808e702ac,
+    0x0000053808400415, 0x0000053808000415, 0x000005380884a20d, 0x000005380800120f, 0x0000053008002c15, 0x0000053008000e15, 0x0000053008d59207, 0x0000053058e702ac,
+    0x0000053008e702ea, 0x000004e408d59207, 0x000004e458e702ac, 0x000004e408d592c7, 0x000004e40884a20d, 0x000004e008d59207, 0x000004e008e702ea, 0x000004e058e702ac,
+    0x000004e00884a20d, 0x000005b808d59207, 0x000005b858e702ac, 0x000005b808e702ea, 0x000005b808401215, 0x000005c058e702ac, 0x000005c008d592c7, 0x000005c008e702ea,
+    0x000005c008d59207, 0x000005c008400415, 0x000005c008004415, 0x000005c00884a20d, 0x0000056838001617, 0x0000056808000415, 0x0000005008d59207, 0x0000005008d5920e,
+    0x0000005008000415, 0x0000064808d59207, 0x0000064808001215, 0x000000c808d59207, 0x000000c808d59807, 0x000000c808d5a407, 0x000000c808c6a822, 0x000000c808c69822,
+    0x000000c808c6a422, 0x000000c858e702ac, 0x0000014008d59207, 0x0000014008d59807, 0x0000014008d5a407, 0x0000042008d59207, 0x000004200884a20d, 0x0000042008400415,
+    0x0000082008d59207, 0x000008200884a20d, 0x0000040c08d59207, 0x0000040c58e702ac, 0x0000040c08400415, 0x0000070808d59207, 0x0000070858e702ac, 0x0000070808400415,
+    0x0000070808000415, 0x0000070808001215, 0x000007080800121a, 0x0000070808d59206, 0x000007080884a20d, 0x000007080800120f, 0x0000042408959209, 0x0000042408a59205,
+    0x000004240800120f, 0x0000042408000415, 0x0000042408400415, 0x0000042408001215, 0x0000046808d59207, 0x0000046858e702ac, 0x0000046808e702ea, 0x0000046808d59206,
+    0x000008200bd5b806, 0x000007cc0bd5b806, 0x000007d003003815, 0x000004805be728ac, 0x000007d00be702ea, 0x000008200bd04407, 0x000004800bd01207, 0x0000066c0bd89206,
+    0x000007cc0bd04407, 0x00000bcc08d59207, 0x00000bcc0800121a, 0x00000bcc58e702ac, 0x00000bcc08400415, 0x00000f8808e702aa, 0x0000032058e702ac, 0x00000f8808001219,
+    0x00000f885084a20d, 0x0000017c0800121a, 0x0000017c58e702ac, 0x0000017c08000415, 0x0000017c08400415, 0x0000017c08001215, 0x0000038458e702ac, 0x0000070c08d59207,
+    0x0000070c58e702ac, 0x0000070c08d59206, 0x0000070c0884a20d, 0x0000070c0800121a, 0x0000049808d59207, 0x0000049858e702ac, 0x0000046c08d59207, 0x0000046c58e702ac,
+    0x0000046c0884a20d, 0x0000046c38001417, 0x0000049c08d59207, 0x0000049c08d59206, 0x0000049c58e702ac, 0x0000049c0884a20d, 0x000006d810d59207, 0x000006d81000120f,
+    0x000006d858e702ac, 0x0000029810959209, 0x0000029810a59205, 0x0000029858e702ac, 0x0000029810d59206, 0x000002981084a20d, 0x0000029810001815, 0x00000f886800120f,
+    0x00000f886800161a, 0x00000f8868001617, 0x00000f886800121a, 0x0000000000004480, 0x00000f880b002a9a, 0x00000f88080953da, 0x000006680b00441a, 0x00000f88030754b8,
+    0x00000f880000381a,
+};
+
+} // namespace detail
+
+/** The Unicode properties of a code-point that are used during text analysis.
+ *
+ * All the properties are retrieved with a single table lookup, instead of
+ * a lookup in a separate table for each property.
+ */
+class ucd_text_properties {
+public:
+    constexpr ucd_text_properties() noexcept = default;
+    constexpr explicit ucd_text_properties(uint64_t value) noexcept : _value(value) {}
+
+    [[nodiscard]] constexpr unicode_general_category general_category() const noexcept
+    {
+        return static_cast<unicode_general_category>(get<0, 5>());
+    }
+
+    [[nodiscard]] constexpr unicode_grapheme_cluster_break grapheme_cluster_break() const noexcept
+    {
+        return static_cast<unicode_grapheme_cluster_break>(get<5, 4>());
+    }
+
+    [[nodiscard]] constexpr unicode_line_break_class line_break_class() const noexcept
+    {
+        return static_cast<unicode_line_break_class>(get<9, 6>());
+    }
+
+    [[nodiscard]] constexpr unicode_word_break_property word_break_property() const noexcept
+    {
+        return static_cast<unicode_word_break_property>(get<15, 5>());
+    }
+
+    [[nodiscard]] constexpr unicode_sentence_break_property sentence_break_property() const noexcept
+    {
+        return static_cast<unicode_sentence_break_property>(get<20, 4>());
+    }
+
+    [[nodiscard]] constexpr unicode_east_asian_width east_asian_width() const noexcept
+    {
+        return static_cast<unicode_east_asian_width>(get<24, 3>());
+    }
+
+    [[nodiscard]] constexpr unicode_bidi_class bidi_class() const noexcept
+    {
+        return static_cast<unicode_bidi_class>(get<27, 5>());
+    }
+
+    [[nodiscard]] constexpr unicode_bidi_paired_bracket_type bidi_paired_bracket_type() const noexcept
+    {
+        return static_cast<unicode_bidi_paired_bracket_type>(get<32, 2>());
+    }
+
+    [[nodiscard]] constexpr iso_15924 script() const noexcept
+    {
+        return iso_15924{get<34, 10>()};
+    }
+
+private:
+    uint64_t _value = 0;
+
+    template<unsigned int Shift, unsigned int Width>
+    [[nodiscard]] constexpr uint64_t get() const noexcept
+    {
+        return (_value >> Shift) & ((uint64_t{1} << Width) - 1);
+    }
+};
+
+[[nodiscard]] constexpr ucd_text_properties ucd_get_text_properties(char32_t code_point) noexcept
+{
+    constexpr auto max_code_point_hi = detail::ucd_text_properties_indices_size - 1;
+
+    auto code_point_hi = code_point / detail::ucd_text_properties_chunk_size;
+    auto const code_point_lo = code_point % detail::ucd_text_properties_chunk_size;
+
+    if (code_point_hi > max_code_point_hi) {
+        code_point_hi = max_code_point_hi;
+    }
+
+    auto const chunk_index = load_bits_be<detail::ucd_text_properties_index_width>(
+        detail::ucd_text_properties_indices_bytes,
+        code_point_hi * detail::ucd_text_properties_index_width);
+
+    // Add back in the lower-bits of the code-point.
+    auto const index = (chunk_index * detail::ucd_text_properties_chunk_size) + code_point_lo;
+
+    // Get the index of the record from the table.
+    auto const record_index = load_bits_be<detail::ucd_text_properties_record_index_width>(
+        detail::ucd_text_properties_record_indices_bytes, index * detail::ucd_text_properties_record_index_width);
+
+    return ucd_text_properties{detail::ucd_text_properties_records[record_index]};
+}
+
+}} // namespace hi::v1
+
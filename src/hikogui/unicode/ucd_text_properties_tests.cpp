@@ -0,0 +1,113 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ucd_text_properties.hpp"
+#include "ucd_scripts.hpp"
+#include <hikotest/hikotest.hpp>
+
+TEST_SUITE(ucd_text_properties) {
+
+TEST_CASE(latin_letter)
+{
+    auto const properties = hi::ucd_get_text_properties(U'A');
+    REQUIRE(properties.general_category() == hi::unicode_general_category::Lu);
+    REQUIRE(properties.grapheme_cluster_break() == hi::unicode_grapheme_cluster_break::Other);
+    REQUIRE(properties.line_break_class() == hi::unicode_line_break_class::AL);
+    REQUIRE(properties.word_break_property() == hi::unicode_word_break_property::ALetter);
+    REQUIRE(properties.sentence_break_property() == hi::unicode_sentence_break_property::Upper);
+    REQUIRE(properties.east_asian_width() == hi::unicode_east_asian_width::Na);
+    REQUIRE(properties.bidi_class() == hi::unicode_bidi_class::L);
+    REQUIRE(properties.bidi_paired_bracket_type() == hi::unicode_bidi_paired_bracket_type::n);
+    REQUIRE(properties.script() == hi::unicode_script::Latin);
+}
+
+TEST_CASE(opening_bracket)
+{
+    auto const properties = hi::ucd_get_text_properties(U'(');
+    REQUIRE(properties.general_category() == hi::unicode_general_category::Ps);
+    REQUIRE(properties.grapheme_cluster_break() == hi::unicode_grapheme_cluster_break::Other);
+    REQUIRE(properties.line_break_class() == hi::unicode_line_break_class::OP);
+    REQUIRE(properties.word_break_property() == hi::unicode_word_break_property::Other);
+    REQUIRE(properties.sentence_break_property() == hi::unicode_sentence_break_property::Close);
+    REQUIRE(properties.east_asian_width() == hi::unicode_east_asian_width::Na);
+    REQUIRE(properties.bidi_class() == hi::unicode_bidi_class::ON);
+    REQUIRE(properties.bidi_paired_bracket_type() == hi::unicode_bidi_paired_bracket_type::o);
+    REQUIRE(properties.script() == hi::unicode_script::Common);
+}
+
+TEST_CASE(line_feed)
+{
+    auto const properties = hi::ucd_get_text_properties(U'\n');
+    REQUIRE(properties.general_category() == hi::unicode_general_category::Cc);
+    REQUIRE(properties.grapheme_cluster_break() == hi::unicode_grapheme_cluster_break::LF);
+    REQUIRE(properties.line_break_class() == hi::unicode_line_break_class::LF);
+    REQUIRE(properties.word_break_property() == hi::unicode_word_break_property::LF);
+    REQUIRE(properties.sentence_break_property() == hi::unicode_sentence_break_property::LF);
+    REQUIRE(properties.east_asian_width() == hi::unicode_east_asian_width::N);
+    REQUIRE(properties.bidi_class() == hi::unicode_bidi_class::B);
+    REQUIRE(properties.bidi_paired_bracket_type() == hi::unicode_bidi_paired_bracket_type::n);
+    REQUIRE(properties.script() == hi::unicode_script::Common);
+}
+
+TEST_CASE(combining_mark)
+{
+    // U+0301 COMBINING ACUTE ACCENT
+    auto const properties = hi::ucd_get_text_properties(U'\u0301');
+    REQUIRE(properties.general_category() == hi::unicode_general_category::Mn);
+    REQUIRE(properties.grapheme_cluster_break() == hi::unicode_grapheme_cluster_break::Extend);
+    REQUIRE(properties.line_break_class() == hi::unicode_line_break_class::CM);
+    REQUIRE(properties.word_break_property() == hi::unicode_word_break_property::Extend);
+    REQUIRE(properties.sentence_break_property() == hi::unicode_sentence_break_property::Extend);
+    REQUIRE(properties.east_asian_width() == hi::unicode_east_asian_width::A);
+    REQUIRE(properties.bidi_class() == hi::unicode_bidi_class::NSM);
+    REQUIRE(properties.bidi_paired_bracket_type() == hi::unicode_bidi_paired_bracket_type::n);
+    REQUIRE(properties.script() == hi::unicode_script::Inherited);
+}
+
+TEST_CASE(hebrew_letter)
+{
+    // U+05D0 HEBREW LETTER ALEF
+    auto const properties = hi::ucd_get_text_properties(U'\u05d0');
+    REQUIRE(properties.general_category() == hi::unicode_general_category::Lo);
+    REQUIRE(properties.grapheme_cluster_break() == hi::unicode_grapheme_cluster_break::Other);
+    REQUIRE(properties.line_break_class() == hi::unicode_line_break_class::HL);
+    REQUIRE(properties.word_break_property() == hi::unicode_word_break_property::Hebrew_Letter);
+    REQUIRE(properties.sentence_break_property() == hi::unicode_sentence_break_property::OLetter);
+    REQUIRE(properties.east_asian_width() == hi::unicode_east_asian_width::N);
+    REQUIRE(properties.bidi_class() == hi::unicode_bidi_class::R);
+    REQUIRE(properties.bidi_paired_bracket_type() == hi::unicode_bidi_paired_bracket_type::n);
+    REQUIRE(properties.script() == hi::unicode_script::Hebrew);
+}
+
+TEST_CASE(han_ideograph)
+{
+    // U+4E00 CJK UNIFIED IDEOGRAPH-4E00
+    auto const properties = hi::ucd_get_text_properties(U'\u4e00');
+    REQUIRE(properties.general_category() == hi::unicode_general_category::Lo);
+    REQUIRE(properties.grapheme_cluster_break() == hi::unicode_grapheme_cluster_break::Other);
+    REQUIRE(properties.line_break_class() == hi::unicode_line_break_class::ID);
+    REQUIRE(properties.word_break_property() == hi::unicode_word_break_property::Other);
+    REQUIRE(properties.sentence_break_property() == hi::unicode_sentence_break_property::OLetter);
+    REQUIRE(properties.east_asian_width() == hi::unicode_east_asian_width::W);
+    REQUIRE(properties.bidi_class() == hi::unicode_bidi_class::L);
+    REQUIRE(properties.bidi_paired_bracket_type() == hi::unicode_bidi_paired_bracket_type::n);
+    REQUIRE(properties.script() == hi::unicode_script::Han);
+}
+
+TEST_CASE(unassigned)
+{
+    // U+0378 is not assigned.
+    auto const properties = hi::ucd_get_text_properties(U'\u0378');
+    REQUIRE(properties.general_category() == hi::unicode_general_category::Cn);
+    REQUIRE(properties.grapheme_cluster_break() == hi::unicode_grapheme_cluster_break::Other);
+    REQUIRE(properties.line_break_class() == hi::unicode_line_break_class::XX);
+    REQUIRE(properties.word_break_property() == hi::unicode_word_break_property::Other);
+    REQUIRE(properties.sentence_break_property() == hi::unicode_sentence_break_property::Other);
+    REQUIRE(properties.east_asian_width() == hi::unicode_east_asian_width::N);
+    REQUIRE(properties.bidi_class() == hi::unicode_bidi_class::ON);
+    REQUIRE(properties.bidi_paired_bracket_type() == hi::unicode_bidi_paired_bracket_type::n);
+    REQUIRE(properties.script() == hi::unicode_script::Zzzz);
+}
+
+};
@@ -18,726 +18,6 @@ hi_export_module(hikogui.unicode.ucd_word_break_properties);
 
 hi_export namespace hi {
 inline namespace v1 {
-namespace detail {
-
-constexpr auto ucd_word_break_properties_chunk_size = 128_uz;
-constexpr auto ucd_word_break_properties_index_width = 8_uz;
-constexpr auto ucd_word_break_properties_indices_size = 7173_uz;
-constexpr auto ucd_word_break_property_width = 5_uz;
-
-static_assert(std::has_single_bit(ucd_word_break_properties_chunk_size));
-
-constexpr uint8_t ucd_word_break_properties_indices_bytes[7189] = {
-     0,  1,  2,  2,  2,  3,  4,  5,  2,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
-    29, 30,  2,  2, 31, 32, 33, 34, 35,  2,  2,  2, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,  2, 50,  2,  2, 51, 52,
-    53, 54, 55, 56, 57, 57, 57, 57, 57, 58, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,  2, 59, 60, 61, 62, 57, 57, 57,
-    63, 64, 65, 66, 57, 67, 68, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-     2,  2,  2,  2,  2,  2,  2,  2,  2, 69,  2,  2, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 82, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 83, 84,  2,  2, 85, 86, 87, 88, 89, 90,
-    91, 92, 93, 94, 57, 95, 96, 97,  2, 98, 99,100,  2,  2,101,102,103,104,105,106,107,108,109,110,111,112,113, 57, 57,114,115,116,
-   117,118,119,120,121,122,123, 57,124,125, 57,126,127,128,129, 57,130,131,132,133,134,135, 57, 57,136,137,138,139, 57,140,141,142,
-     2,  2,  2,  2,  2,  2,  2,143,144,  2,145, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,146,
-     2,  2,  2,  2,  2,  2,  2,  2,147, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57,  2,  2,  2,  2,148, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,  2,  2,  2,  2,149,150,151,152, 57, 57, 57, 57,153, 57,154,155,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,156,
-   157, 57,158, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,159,160, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,161, 57,
-    57, 57,162,163,164, 57, 57, 57,165,166,167,  2,  2,168,169,170, 57, 57, 57, 57,171,172, 57, 57, 57, 57, 57, 57, 57, 57,173, 57,
-   174,175,176, 57, 57,177, 57, 57, 57,178, 57, 57, 57, 57, 57,179,  2,180,181, 57, 57, 57, 57, 57, 57, 57, 57, 57,182,183, 57, 57,
-    57, 57,184,185, 57, 57, 57,186, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,187, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
-   188, 57,189,190, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-constexpr uint8_t ucd_word_break_properties_bytes[15296] = {
-     0,  0,  0,  0,  0,  0,  2, 33, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32, 10,  0,  0,  6,  0,  0,  3,129,  0, 74, 82,
-   148,165, 41, 74, 84,112,  0,  0,  2,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,  0, 12,  2,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0, 52,  0,  0,  0,  0, 44, 10,  0, 22,  0,  0,  0, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173, 96, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 96, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107,  0,  0,  0,  1,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206, 90,214,181,129,107,  0, 22,181,172,235,  0,  0,  0,  1,106, 90,214,  5,129,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,192,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172, 11, 90,214,181,173,107,
-    90,192,231, 57,206,115,150,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,  2,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173, 96,  2,214,181,129,106, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 89,214,  0,  0,  0,  3,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 56, 14,  3,156,  7, 56, 14,  0,  0,  0,  0,  0,123,222,247,189,239,123,222,247,189,239,123,222,247,189,
-   239,123,222,  0,  0, 15,123,222,181,  0,  0,  0,  0,  0,  0,  0,107, 90,214,180,  0,  0,  0,  3,156,  0,115,156,231, 57,206,115,
-   156,  6,128,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206, 74, 82,148,165, 41, 74, 64,147,129,107,114,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,176, 45,206,115,156,231, 52, 14,115,156,231, 45,
-   110,112, 28,231, 57,107, 74, 82,148,165, 41, 74, 86,181,128, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13, 91,150,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,  0,
-    45,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,206,115,156,231, 57,206,114,192,
-     0,  0,  0,  0,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 86,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,231, 57,206,115,156,229,172,  0, 56, 22,  0, 56,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,206,115,
-   150,231, 57,206,115,156,229,185,206, 91,156,231, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 91,156,224,  0,  0, 90,214,181,173,107, 90,214,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107,  2,214,181,173, 96,107, 64,  0,  0,  0,115,156,231, 57,206, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,220,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,154,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,229,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,220,231, 45,206,115,156,231, 57,206,115,156,231,
-    57,206, 91,156,231, 57,206, 90,214,181,173,107, 90,220,224,  1, 41, 74, 82,148,165, 41,  2,214,181,173,107, 90,214,181,173,107,
-    91,156,224, 45,107, 90,214,181,128, 11, 88,  0,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88, 22,181,173,107, 88, 22,
-     0,  1,107, 90,192,  7, 45,206,115,156,231,  0, 14,112,  0,231, 57, 96,  0,  0,  0,  0, 14,  0,  0,  5,172, 11, 90,220,224,  1,
-    41, 74, 82,148,165, 41, 90,192,  0,  0,  0,  0,  0,  5,129,192,  3,156,224, 45,107, 90,214,  0,  0, 11, 88,  0,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 88, 22,181,173,107, 88, 22,176, 45, 96, 90,192,  7,  1,206,115,156,  0,  0, 14,112,  0,231,
-    56,  0,  3,128,  0,  0,  0,  2,214,181,129, 96,  0,  0,  0,  1, 41, 74, 82,148,165, 41,115,150,181,184,  0,  0,  0,  0,  0,  0,
-     3,156,224, 45,107, 90,214,181,172, 11, 90,192,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88, 22,181,173,107, 88, 22,
-   176, 45,107, 90,192,  7, 45,206,115,156,231, 56, 14,115,128,231, 56,  0, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,220,224,  1,
-    41, 74, 82,148,165, 41,  0,  0,  0,  0,  0,  2,220,231, 57,206,  3,156,224, 45,107, 90,214,181,128, 11, 88,  0,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 88, 22,181,173,107, 88, 22,176, 45,107, 90,192,  7, 45,206,115,156,231,  0, 14,112,  0,231,
-    56,  0,  0,  0,  0, 57,206,  0,  0,  5,172, 11, 90,220,224,  1, 41, 74, 82,148,165, 41,  2,192,  0,  0,  0,  0,  0,  0,  0,  0,
-     0, 28,176, 45,107, 90,214,  0,  1,107, 88, 22,181,172,  0,  2,214,  5,129,107,  0,  0,181,128,  0, 90,214,  0,  1,107, 90,214,
-   181,173,107, 90,192,  0,  1,206,115,156,  0,  1,206,112, 28,231, 56,  0, 88,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  1,
-    41, 74, 82,148,165, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,156,231, 45,107, 90,214,181,129,107, 88, 22,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 88, 22,181,173,107, 90,214,181,173,107, 90,192,  7, 45,206,115,156,231,  1,206,112, 28,231,
-    56,  0,  0,  0,  0, 57,192, 90,214,  0, 44,  0, 90,220,224,  1, 41, 74, 82,148,165, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    91,156,224, 45,107, 90,214,181,129,107, 88, 22,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88, 22,181,173,107, 90,214,
-   176, 45,107, 90,192,  7, 45,206,115,156,231,  1,206,112, 28,231, 56,  0,  0,  0,  0, 57,192,  0,  0,  0, 45, 96, 90,220,224,  1,
-    41, 74, 82,148,165, 41,  2,214,224,  0,  0,  0,  0,  0,  0,  0,115,156,229,173,107, 90,214,181,129,107, 88, 22,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,231, 45,206,115,156,231,  1,206,112, 28,231,
-    57, 96,  0,  0,  5,173,110,  0,  0,  0,  0, 11, 90,220,224,  1, 41, 74, 82,148,165, 41,  0,  0,  0,  0,  0,  0, 22,181,173,107,
-     3,156,224, 45,107, 90,214,181,173,107, 90,214,181,173, 96,  0, 22,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,192,
-   181,173,107, 90,214,176, 44,  0, 90,214,181,173, 96,  0, 28,  0,  0, 14,115,156,231,  1,192,115,156,231, 57,206,  0,  0,  0,  1,
-    41, 74, 82,148,165, 41,  0, 28,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,128,  7, 57,206,115,156,  0,  0,  0,  0,  0,  0,  0, 14,115,156,231,
-    57,192, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,128,
-     7, 57,206,115,156,231,  0,  0,  0,  0,  0,  0,  0,115,156,231, 57,192, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,
-   128,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0, 56, 14,  3,128,  0,  1,206, 90,214,181,173,107,  2,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,128,  0,  3,156,231, 57,206,115,156,231, 57,206,
-   115,156,231,  1,206, 90,214,181,185,206,115,156,231, 57,206,  3,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231,  0,  0,  0,  0,  0,  1,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,231, 57,206,115,156,231, 57,206,115,156,231, 57,192, 74, 82,148,165, 41, 74, 64,  0,
-     0,  0,  0,  0,  0,  1,206,115,128,  0,  1,206,112, 28,231,  0, 14,115,156,231, 56,  0,  3,156,231,  0,  0,  0,  0,  0,  0,  0,
-     0, 28,231, 57,206,115,156,231, 56, 14, 74, 82,148,165, 41, 74, 92,231, 56,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,172, 11,  0,  0,  0, 44,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  5,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88, 22,181,
-   172,  0, 90,214,181,173, 96, 88, 22,181,172,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 88, 22,181,172,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88, 22,
-   181,172,  0, 90,214,181,173, 96, 88, 22,181,172,  0, 90,214,181,173,107, 90,214,181,173, 96, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88, 22,181,172,  0, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,  0, 57,206,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,172,  0, 90,214,181,172,  0,  2,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,128, 11, 90,214,181,173,107, 90,214,181,173,107, 34,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,  1,107, 90,214,181,173,107, 88,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,220,231, 56,  0,  0,  0,  0,  0, 11, 90,214,181,173,107, 90,214,181,173,107, 90,220,
-   231,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,220,224,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,
-   107, 90,214,181,129,107, 88, 28,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,224,  0,  0,  0,  0,  0, 56,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,231, 57,174, 74, 82,148,165, 41, 74, 64,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 88,  0,  0,  0,  0, 90,214,181,185,203, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 91,150,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 96,115,156,231, 57,206,115,156,224,  0,  0,115,156,
-   231, 57,206,115,156,224,  0,  0,  0,  0,  0,  1, 41, 74, 82,148,165, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,110,115,156,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206,115,156,231, 57,192,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  0, 14, 74, 82,148,165, 41, 74, 64,  0,  0,  0, 74, 82,148,165, 41, 74,
-    64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   115,156,231, 45,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   183, 57,206,115,156,231, 57,206,115,156,231, 45,107, 90,214,181,128,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,231, 57,206,115,156,224,  0,  0,  0,  0,  0,  0,  0,115,156,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 91,156,231, 57,206,115,156,231, 57,107, 74, 82,148,165, 41, 74, 86,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,206,115,156,231, 57,206,115,156,224,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,183, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,  0,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0, 45,107, 74, 82,148,165, 41, 74, 86,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0, 90,214,181,173,107, 88,  0,  0,  0,  0, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0, 45,107,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,115,156,  7, 57,206,115,156,231, 57,206,115,156,231, 57,206,114,214,181,185,107, 90,214,183, 45,110,115,150,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0, 90,
-   214,181,172,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0, 90,214,181,
-   172,  0, 90,214,181,173,107,  2,192,176, 44, 11, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,129,107, 90,214,181,129, 96,  0, 22,181,129,107, 90,214,181,128,  0, 90,214,176,  1,107, 90,214,176,  0,  0, 90,214,181,173,
-   107, 90,214,181,128,  0,  0, 22,181,129,107, 90,214,181,128,  0, 33,  8, 66, 16,128, 33,  8,  7, 65,173,  0,  0,  0,  0,  0, 66,
-     0,  0,  0,  0,  0,  0,  4,  0, 10, 16,154,214,181,172,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12, 96,  0,  3,128,  0,  0,  0,  0,
-     0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  4,107, 90,214,129,173,107, 90,214,181,173,  2,192,  0,  0,  0,  0,  0,  0,  0, 11,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0, 11,  0, 22,181,173,107, 90,214,176, 44,  0,  2,
-   214,181,172,  0,  0,  0,  5,129, 96, 88, 22,181,172, 11, 90,214,181,173,107, 90,192,  5,173,107,  0,  0,  0, 45,107, 90,192,  0,
-     1, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  1,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,128,  0,  0,  0,181,173,110,115,150,176,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172, 11,  0,  0,  0, 44,  0, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 96,  0,
-     0,  0,  0,  0, 90,214,181,173, 96, 90,214,181,173, 96, 90,214,181,173, 96, 90,214,181,173, 96, 90,214,181,173, 96, 90,214,181,
-   173, 96, 90,214,181,173, 96, 90,214,181,173, 96,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,231, 57,206,  4, 99, 24,196,  0,  0,  0,181,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,157, 24,128,  0,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99,
-    24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198,
-    49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 98,  8,198, 49,  0,  0,  0, 45,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,  2,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,140, 99, 24,198, 49,140, 99, 24,198, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 32,
-   140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99,
-    24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,128,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0,
-    90,214,181,173,107, 90,214,181,128,  0, 90,214,181,173,107, 90,214,181,173,107, 74, 82,148,165, 41, 74, 86,176,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,110,115,156,  7, 57,206,115,156,231, 56, 11, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,206, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,115,128,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,
-     0,  0, 90,192,176, 45,107, 90,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,181,173,107, 90,214,181,173,107,
-    90,220,181,173,203, 90,214,229,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,231, 57,206,  0,  0,  7,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,176,  0,  0,  0,  0,  0,  0,  0,115,150,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,183, 57,206,115,156,231, 57,206,115,156,231, 56,  0,  0,  0,  0,
-     0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,115,156,231, 57,206,115,156,231, 57,206,115,150,181,173,107,  0,  0,176, 45,110,
-    74, 82,148,165, 41, 74, 86,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,206,115,156,231, 56,  0, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,110,115,156,231, 57,206,115,156,224,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,128,  0,115,156,229,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,231, 57,206,115,156,231, 57,206,112,  0,  0,  0,  0,  0,  0,  0,
-     0, 11, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 91,156,231, 57,206,115,156,
-   231, 57,192,  0,  0,  0,  0,  0, 90,214,229,173,107, 90,214,183, 56,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,231, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,112, 28,231,  0, 14,112,  0,  0,  1,206,  3,128,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,231, 57,206,  0, 22,181,185,192,  0,  0,  0,  0,  0,
-     2,214,181,173, 96,  2,214,181,173, 96,  2,214,181,173, 96,  0,  0,  0,  0,  0, 90,214,181,173, 96, 90,214,181,173, 96, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,192,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,231, 57,206,115,156,  7, 56,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,176,  0,  0,  0,  0,  0,  0,  0, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173, 96,  0,  0,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,176,  0,  0, 90,214,181,173, 96,  0,  0,  0,  0,  0,  0,  0,181,173,107,  0,
-     0,  0, 61,207,123,222,247,189,239,120, 30,247,189,239,123,222,247,189,224,123,222,247,129,224,123,192,247,129,239,123,222,247,
-   189,239, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,192,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107,  0, 22,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,176,  0,  0,115,156,231, 57,206,115,156,231, 57,206, 56,  0,163,128,  0,  0,
-     0,  0,  0,  0,115,156,231, 57,206,115,156,231, 57,206,  0,  0,198,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    49,140, 56, 16,  3,168,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,129,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,128, 13,  0,  0,  0,  0,  8,  0,  0,  3,129,  0, 74, 82,148,165, 41, 74,
-    84,112,  0,  0,  2,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,  0, 12,  2,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,  0,  0,  0,  0,  0,  0,  2, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,
-   140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,198, 49,140, 99, 24,197,206, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173, 96,  0, 22,181,173,107,  0, 22,181,173,107,  0, 22,181,173,107,  0, 22,181,128,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3, 90,208,  0,  0, 90,214,181,173,107, 90,214,176, 45,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173, 96, 90,214,181,173,107, 90,214,181,173,107, 90,214,  5,172, 11, 90,214,181,173,107, 90,214,181,
-   172,  0, 90,214,181,173,107, 90,214,181,172,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,128,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,128,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,  0,  0,  0,  0,  0,  0,  0,  0, 45,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,206,115,156,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,172,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,176,  0,  0, 90,214,181,
-   173,107,  2,214,181,172,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,176,  0,  0, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,176,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,176,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,  5,173,107,
-    90,214,181,173,107, 90,214,  5,173,107, 90,214,  5,172, 11, 90,214,181,173,107, 90,192,181,173,107, 90,214,181,173,107, 90,192,
-   181,173,107, 90,192,181,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 96,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,172,  0,  0,  0,  0,  0,  0, 90,214,181,173,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,172, 11, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88, 22,
-   181,173,107, 90,214,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,172,  0, 88, 22,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172, 11, 88,  0,  5,128, 11, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,172,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 96,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,  5,172,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0,  0,
-     0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107,  0,  0,  0,  1,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,156,224, 57,192,  0,  0,  7, 57,206, 90,214,176, 45,107,  2,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0,115,156,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,128,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107,  2,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,185,
-   192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,172,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-     0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,183, 57,206,  0,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,192,231,  0,  0, 90,192,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,206, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,128,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,206,115,156,231,
-    57,206,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107,
-    90,220,231, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173, 96,  0,  0,  0,  0,  0,115,156,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,115,156,231, 57,206,115,156,231, 57,192,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1, 41, 74, 82,148,165, 41,114,214,231, 44,  0,  0,  0,  0,  0, 14,
-   115,156,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,115,156,
-   231, 57,206,115,156,  0, 52,  0,  0, 28,  0,  0,  0,  0,  0,  0, 52,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 88,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,115,156,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,110,115,156,231, 57,206,115,156,231,  1, 41, 74, 82,148,165, 41,  0,  0,  5,185,203,  0,  0,  0,
-     0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,224,  1, 96,  0,  0,  0,  0,  0,
-   115,156,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   231, 57,206,115,156,231, 57,206,114,214,181,128,  0,  3,156,231,  1,206, 74, 82,148,165, 41, 74, 86,  5,128,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,192,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,183, 57,206,115,156,231, 57,206,  0,  0,  0,  1,203, 91,128,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173, 96, 88, 22,181,172, 11, 90,214,181,173,107, 90,214,181,172, 11, 90,214,181,173,107, 88,  0,  0,  0,  0, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,110,115,156,231, 57,
-   206,115,156,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,115,156,224, 45,107, 90,214,181,128, 11, 88,  0,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 88, 22,181,173,107, 88, 22,176, 45,107, 90,192,231, 45,206,115,156,231,  0, 14,112,  0,231,
-    56,  0, 88,  0,  0,  0, 14,  0,  0,  0, 45,107, 90,220,224,  1,206,115,156,231,  0,  0,115,156,231,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,185,206,115,156,231, 57,206,115,156,231, 57,203, 90,214,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  1,203, 90,192,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,115,156,231, 57,206,115,156,231, 57,206,115,156,229,172, 11,  0,  0,  0,
-     0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,110,115,156,
-   231, 56,  0,115,156,231, 57,206,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,183, 56,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,115,156,231, 57,206,115,156,231, 57,206,112,  0,  5,128,  0,  0,  0,  0,
-     0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,231, 57,206,115,156,
-   231, 57,206, 88,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0, 57,206,115,156,231, 57,206,115,156,224,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,183, 57,206,115,156,
-   231, 57,206,115,156,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,
-    90,214,181,173, 96,  2,192,  5,173,107, 90,214,176, 45, 96, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,115,156,
-   231, 56, 14,112,  0,231, 57,203,114,220,224,  0,  0,  0,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0, 90,214,181,173,107,  0, 22,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 91,156,231, 57,206,  0, 28,231, 57,206,114,192,183,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    91,156,231, 57,206,115,156,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   231, 57,206,115,150,231, 57,192,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0, 91,156,231, 57,206,115,156,229,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,220,231, 57,206,115,156,231, 57,206,115,
-   128,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88,  0,  0,  0,  0,
-    90,214,181,173,107, 88, 22,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,110,115,156,
-   231, 57,192,115,156,231, 57,206, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0, 22,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,  0, 28,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,  3,156,231, 57,206,115,156,231, 57,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173, 96, 90,192,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 91,156,
-   231, 57,192,  0, 28,  7, 56, 14,115,156,231, 57,110,  0,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0, 90,214,181,172,
-    11, 88, 22,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,220,231, 57,192,115,128,231, 57,206, 88,
-     0,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,231, 57,192,  0,  0,  0,  0,  0,115,150,229,173,107, 90,214,181,173,107, 88, 22,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,183, 57,206,115,156,  0,  1,206,115,156,  0,  0,  0,  0,  0,  0,
-     0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,176,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,107, 90,214,181,173,107, 90,214,181,173,114,214,181,173,110,115,156,231,
-    57,206,115,156,231, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173, 96, 74, 82,148,165, 41, 74, 64,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173, 96, 74, 82,148,165, 41, 74, 64,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,172,  0,115,156,231,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,115,156,231, 57,192,  0,  0,  0,  0,  0, 90,214,176,  0,  0,  0,  0,  0,
-     0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,181,173,107, 90,214,181,173,107, 90,214,181,173,107,  0,  0,  0, 45,107,
-    90,214,181,173,107, 90,214,181,173,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,  0, 14, 91,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,  0,  0,  0,  0, 14,115,156,181,173,107, 90,
-   214,181,173,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,192,183,  0,  0,  0,  0,  0,  0,  0,115,128,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,140, 99, 16, 70, 49,140, 99, 16, 70, 32,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140, 98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,  0,  8,198,
-    49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  0,  0,  0, 90,214,181,173,107, 90,214,181,128,  0,
-    90,214,181,173,107, 88,  0,  0,  0,  0, 90,214,181,173,107, 90,192,  0, 57,192,107, 90,208,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 56,  0,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,192,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,
-   206,115,128,  0, 57,206,115,156,214,181,173,107, 90,231, 57,206,115,156,  0, 57,206,115,156,224,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,231, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0, 28,231,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,129,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,129,107,  0, 22,  0, 45, 96,  2,214,181,129,107, 90,214,
-   181,173,107, 90,192,176, 45,107, 90,214,176, 45,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172, 11, 90,214,  0, 45,107, 90,214,181,129,107, 90,
-   214,181,129,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,192,181,173, 96, 90,214,181,129, 96,  0, 22,181,
-   173,107, 88, 22,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,172,  0, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 88, 22,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  5,173,107, 90,214,181,173,
-   107, 90,214,181,173,107, 90,214,181,173,107, 90,214,  5,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,129,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,129,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,
-   173, 96, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173, 96, 90,214,181,173,107, 90,214,181,173,107,
-    90,214,181,173,107, 88, 22,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 88, 22,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,  5,173,107, 90,214,176,  1, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165,
-    41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,192,  0,  0,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,  0,  0,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,
-     0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,231, 57,206,  3,156,231, 57,206,115,156,231, 57,206,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173, 96,  0,  0,  0, 45,107, 90,214,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-   115,156,231, 57,192,115,156,231, 57,206,115,156,231, 57,206,112,  0,231, 57,206,115,128,231,  1,206,115,156,  0,  0,  0, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,181,172,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,128,  0,115,156,
-   231, 57,203, 90,214,181,172,  0, 74, 82,148,165, 41, 74, 64,  0,  1, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,
-   173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,183, 57,206, 74, 82,148,165, 41, 74, 64,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,214,183, 57,206, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173, 96, 90,214,176, 45, 96, 90,214,181,173,107, 90,214,181,173, 96,
-    90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,128,  0,  0,  0,  0,  0,  0,115,156,231, 57,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,
-   214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,183, 57,206,115,156,176,
-     0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    90,214,176, 45,107, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107,  2,214,  5,128, 11,  2,214,181,173,107, 90,214,
-     5,173,107,  2,192,176,  0,  0,  0, 22,  0,  0, 11,  2,192,176, 45,107,  2,214,  5,128, 11,  2,192,176, 44, 11,  2,214,  5,128,
-    11, 90,214,  5,173,107, 90,214,  5,173,107,  2,214,181,129, 96, 90,214,181,173,107, 90,192,181,173,107, 90,214,181,173,107, 90,
-   214,176,  0,  0,  2,214,176, 45,107, 90,192,181,173,107, 90,214,181,173,107, 90,214,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,214,
-   181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,192,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,
-   107, 90,192,  0,  0,  0, 90,214,181,173,107, 90,214,181,173,107, 90,214,181,173,107, 90,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,148,165, 41, 74, 82,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,231, 57,206,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74, 82,148,165, 41, 74, 64,  0,  0,  0,
-     3, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,
-   156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231,
-    57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,
-   115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,
-   231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,206,115,156,231, 57,
-   206,115,156,231, 57,206,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-};
-
-
-} // namespace detail
 
 enum class unicode_word_break_property : uint8_t {
     Other = 0,
@@ -761,30 +41,5 @@ enum class unicode_word_break_property : uint8_t {
     Regional_Indicator = 18,
 };
 
-[[nodiscard]] constexpr unicode_word_break_property ucd_get_word_break_property(char32_t code_point) noexcept
-{
-    constexpr auto max_code_point_hi = detail::ucd_word_break_properties_indices_size - 1;
-
-    auto code_point_hi = code_point / detail::ucd_word_break_properties_chunk_size;
-    auto const code_point_lo = code_point % detail::ucd_word_break_properties_chunk_size;
-
-    if (code_point_hi > max_code_point_hi) {
-        code_point_hi = max_code_point_hi;
-    }
-
-    auto const chunk_index = load_bits_be<detail::ucd_word_break_properties_index_width>(
-        detail::ucd_word_break_properties_indices_bytes,
-        code_point_hi * detail::ucd_word_break_properties_index_width);
-
-    // Add back in the lower-bits of the code-point.
-    auto const index = (chunk_index * detail::ucd_word_break_properties_chunk_size) + code_point_lo;
-
-    // Get the canonical combining class from the table.
-    auto const value = load_bits_be<detail::ucd_word_break_property_width>(
-        detail::ucd_word_break_properties_bytes, index * detail::ucd_word_break_property_width);
-
-    return static_cast<unicode_word_break_property>(value);
-}
-
 }} // namespace hi::v1
 
@@ -19,9 +19,11 @@
 #include "ucd_general_categories.hpp" // export
 #include "ucd_grapheme_cluster_breaks.hpp" // export
 #include "ucd_lexical_classes.hpp" // export
+#include "ucd_NFC_quick_checks.hpp" // export
 #include "ucd_line_break_classes.hpp" // export
 #include "ucd_scripts.hpp" // export
 #include "ucd_sentence_break_properties.hpp" // export
+#include "ucd_text_properties.hpp" // export
 #include "ucd_word_break_properties.hpp" // export
 #include "unicode_bidi.hpp" // export
 #include "unicode_break_opportunity.hpp" // export
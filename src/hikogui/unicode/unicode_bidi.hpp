@@ -9,6 +9,7 @@
 #include "ucd_bidi_mirroring_glyphs.hpp"
 #include "ucd_decompositions.hpp"
 #include "ucd_general_categories.hpp"
+#include "ucd_text_properties.hpp"
 #include "../utility/utility.hpp"
 #include "../container/container.hpp"
 #include "../algorithm/algorithm.hpp"
@@ -20,6 +21,8 @@
 #include <utility>
 #include <iterator>
 #include <algorithm>
+#include <optional>
+#include <array>
 
 hi_export_module(hikogui.unicode.unicode_bidi);
 
@@ -87,8 +90,9 @@ struct unicode_bidi_char_info {
         this->index = index;
         this->code_point = code_point;
         this->embedding_level = 0;
-        this->direction = this->bidi_class = ucd_get_bidi_class(code_point);
-        this->bracket_type = ucd_get_bidi_paired_bracket_type(code_point);
+        auto const properties = ucd_get_text_properties(code_point);
+        this->direction = this->bidi_class = properties.bidi_class();
+        this->bracket_type = properties.bidi_paired_bracket_type();
     }
 
     /** Constructor for testing to bypass normal initialization.
@@ -274,6 +278,22 @@ struct unicode_bidi_bracket_pair {
     }
 };
 
+} // namespace detail
+
+/** Buffers used by the unicode bidi algorithm.
+ *
+ * Reusing the same buffers for each call to `unicode_bidi()` avoids
+ * allocating them for every paragraph that is shaped.
+ */
+struct unicode_bidi_scratch {
+    detail::unicode_bidi_char_info_vector characters;
+    std::vector<detail::unicode_bidi_level_run> level_runs;
+    std::vector<detail::unicode_bidi_isolated_run_sequence> isolated_run_sequences;
+    std::vector<detail::unicode_bidi_bracket_pair> bracket_pairs;
+};
+
+namespace detail {
+
 constexpr void unicode_bidi_X1(
     unicode_bidi_char_info_iterator first,
     unicode_bidi_char_info_iterator last,
@@ -595,7 +615,13 @@ constexpr void unicode_bidi_W7(unicode_bidi_isolated_run_sequence& sequence) noe
     }
 }
 
-constexpr std::vector<unicode_bidi_bracket_pair> unicode_bidi_BD16(unicode_bidi_isolated_run_sequence& isolated_run_sequence)
+/** Find the bracket pairs in an isolated run sequence.
+ *
+ * @param isolated_run_sequence The isolated run sequence to search.
+ * @param[out] pairs The bracket pairs, sorted by the position of the opening bracket.
+ */
+constexpr void
+unicode_bidi_BD16(unicode_bidi_isolated_run_sequence& isolated_run_sequence, std::vector<unicode_bidi_bracket_pair>& pairs)
 {
     struct bracket_start {
         unicode_bidi_isolated_run_sequence::iterator it;
@@ -604,7 +630,7 @@ constexpr std::vector<unicode_bidi_bracket_pair> unicode_bidi_BD16(unicode_bidi_
 
     using enum unicode_bidi_class;
 
-    auto pairs = std::vector<unicode_bidi_bracket_pair>{};
+    pairs.clear();
     auto stack = hi::stack<bracket_start, 63>{};
 
     for (auto it = begin(isolated_run_sequence); it != end(isolated_run_sequence); ++it) {
@@ -614,14 +640,14 @@ constexpr std::vector<unicode_bidi_bracket_pair> unicode_bidi_BD16(unicode_bidi_
                 if (stack.full()) {
                     // Stop processing
                     std::sort(pairs.begin(), pairs.end());
-                    return pairs;
+                    return;
 
                 } else {
                     // If there is a canonical equivalent of the opening bracket, find it's mirrored glyph
                     // to compare with the closing bracket.
                     auto mirrored_glyph = ucd_get_bidi_mirroring_glyph(it->code_point);
                     if (auto const canonical_equivalent = ucd_get_decomposition(it->code_point).canonical_equivalent()) {
-                        hi_axiom(ucd_get_bidi_paired_bracket_type(*canonical_equivalent) == unicode_bidi_paired_bracket_type::o);
+                        hi_axiom(ucd_get_text_properties(*canonical_equivalent).bidi_paired_bracket_type() == unicode_bidi_paired_bracket_type::o);
 
                         mirrored_glyph = ucd_get_bidi_mirroring_glyph(*canonical_equivalent);
                     }
@@ -653,7 +679,6 @@ constexpr std::vector<unicode_bidi_bracket_pair> unicode_bidi_BD16(unicode_bidi_
     }
 
     std::sort(pairs.begin(), pairs.end());
-    return pairs;
 }
 
 [[nodiscard]] constexpr unicode_bidi_class unicode_bidi_N0_strong(unicode_bidi_class direction)
@@ -710,7 +735,10 @@ unicode_bidi_N0_enclosed_strong_type(unicode_bidi_bracket_pair const& pair, unic
     return opposite_direction;
 }
 
-constexpr void unicode_bidi_N0(unicode_bidi_isolated_run_sequence& isolated_run_sequence, unicode_bidi_context const& context)
+constexpr void unicode_bidi_N0(
+    unicode_bidi_isolated_run_sequence& isolated_run_sequence,
+    unicode_bidi_context const& context,
+    std::vector<unicode_bidi_bracket_pair>& bracket_pairs)
 {
     using enum unicode_bidi_class;
 
@@ -718,7 +746,7 @@ constexpr void unicode_bidi_N0(unicode_bidi_isolated_run_sequence& isolated_run_
         return;
     }
 
-    auto bracket_pairs = unicode_bidi_BD16(isolated_run_sequence);
+    unicode_bidi_BD16(isolated_run_sequence, bracket_pairs);
     auto const embedding_direction = isolated_run_sequence.embedding_direction();
 
     for (auto& pair : bracket_pairs) {
@@ -824,10 +852,12 @@ constexpr void unicode_bidi_I1_I2(unicode_bidi_isolated_run_sequence& isolated_r
     }
 }
 
-constexpr std::vector<unicode_bidi_level_run>
-unicode_bidi_BD7(unicode_bidi_char_info_iterator first, unicode_bidi_char_info_iterator last) noexcept
+constexpr void unicode_bidi_BD7(
+    unicode_bidi_char_info_iterator first,
+    unicode_bidi_char_info_iterator last,
+    std::vector<unicode_bidi_level_run>& level_runs) noexcept
 {
-    std::vector<unicode_bidi_level_run> level_runs;
+    level_runs.clear();
 
     auto embedding_level = int8_t{0};
     auto run_start = first;
@@ -845,14 +875,18 @@ unicode_bidi_BD7(unicode_bidi_char_info_iterator first, unicode_bidi_char_info_i
     if (run_start != last) {
         level_runs.emplace_back(run_start, last);
     }
-
-    return level_runs;
 }
 
-[[nodiscard]] constexpr std::vector<unicode_bidi_isolated_run_sequence>
-unicode_bidi_BD13(std::vector<unicode_bidi_level_run> level_runs) noexcept
+/** Combine level runs into isolated run sequences.
+ *
+ * @param[in,out] level_runs The level runs, which are consumed.
+ * @param[out] r The isolated run sequences.
+ */
+constexpr void unicode_bidi_BD13(
+    std::vector<unicode_bidi_level_run>& level_runs,
+    std::vector<unicode_bidi_isolated_run_sequence>& r) noexcept
 {
-    std::vector<unicode_bidi_isolated_run_sequence> r;
+    r.clear();
 
     std::reverse(begin(level_runs), end(level_runs));
     while (!level_runs.empty()) {
@@ -882,8 +916,6 @@ unicode_bidi_BD13(std::vector<unicode_bidi_level_run> level_runs) noexcept
 
         r.push_back(std::move(isolated_run_sequence));
     }
-
-    return r;
 }
 
 [[nodiscard]] constexpr std::pair<unicode_bidi_class, unicode_bidi_class> unicode_bidi_X10_sos_eos(
@@ -923,9 +955,12 @@ constexpr void unicode_bidi_X10(
     unicode_bidi_char_info_iterator first,
     unicode_bidi_char_info_iterator last,
     int8_t paragraph_embedding_level,
-    unicode_bidi_context const& context) noexcept
+    unicode_bidi_context const& context,
+    unicode_bidi_scratch& scratch) noexcept
 {
-    auto isolated_run_sequence_set = unicode_bidi_BD13(unicode_bidi_BD7(first, last));
+    unicode_bidi_BD7(first, last, scratch.level_runs);
+    unicode_bidi_BD13(scratch.level_runs, scratch.isolated_run_sequences);
+    auto& isolated_run_sequence_set = scratch.isolated_run_sequences;
 
     // All sos and eos calculations must be done before W*, N*, I* parts are executed,
     // since those will change the embedding levels of the characters outside of the
@@ -943,7 +978,7 @@ constexpr void unicode_bidi_X10(
         unicode_bidi_W5(isolated_run_sequence);
         unicode_bidi_W6(isolated_run_sequence);
         unicode_bidi_W7(isolated_run_sequence);
-        unicode_bidi_N0(isolated_run_sequence, context);
+        unicode_bidi_N0(isolated_run_sequence, context, scratch.bracket_pairs);
         unicode_bidi_N1(isolated_run_sequence);
         unicode_bidi_N2(isolated_run_sequence);
         unicode_bidi_I1_I2(isolated_run_sequence);
@@ -1115,17 +1150,18 @@ constexpr void unicode_bidi_P1_line(
 [[nodiscard]] constexpr std::pair<unicode_bidi_char_info_iterator, unicode_bidi_class> unicode_bidi_P1_paragraph(
     unicode_bidi_char_info_iterator first,
     unicode_bidi_char_info_iterator last,
-    unicode_bidi_context const& context) noexcept
+    unicode_bidi_context const& context,
+    unicode_bidi_scratch& scratch) noexcept
 {
     auto const[paragraph_embedding_level, paragraph_direction] = unicode_bidi_P2_P3(first, last, context);
 
     unicode_bidi_X1(first, last, paragraph_embedding_level, context);
     last = unicode_bidi_X9(first, last);
-    unicode_bidi_X10(first, last, paragraph_embedding_level, context);
+    unicode_bidi_X10(first, last, paragraph_embedding_level, context, scratch);
 
     auto line_begin = first;
     for (auto it = first; it != last; ++it) {
-        auto const general_category = ucd_get_general_category(it->code_point);
+        auto const general_category = ucd_get_text_properties(it->code_point).general_category();
         if (context.enable_line_separator and general_category == unicode_general_category::Zl) {
             auto const line_end = it + 1;
             unicode_bidi_P1_line(line_begin, line_end, paragraph_embedding_level, context);
@@ -1143,7 +1179,8 @@ constexpr void unicode_bidi_P1_line(
 [[nodiscard]] constexpr std::pair<unicode_bidi_char_info_iterator, std::vector<unicode_bidi_class>> unicode_bidi_P1(
     unicode_bidi_char_info_iterator first,
     unicode_bidi_char_info_iterator last,
-    unicode_bidi_context const& context) noexcept
+    unicode_bidi_context const& context,
+    unicode_bidi_scratch& scratch) noexcept
 {
     auto it = first;
     auto paragraph_begin = it;
@@ -1151,7 +1188,7 @@ constexpr void unicode_bidi_P1_line(
     while (it != last) {
         if (it->direction == unicode_bidi_class::B) {
             auto const paragraph_end = it + 1;
-            auto const[new_paragraph_end, paragraph_bidi_class] = unicode_bidi_P1_paragraph(paragraph_begin, paragraph_end, context);
+            auto const[new_paragraph_end, paragraph_bidi_class] = unicode_bidi_P1_paragraph(paragraph_begin, paragraph_end, context, scratch);
             paragraph_directions.push_back(paragraph_bidi_class);
 
             // Move the removed items of the paragraph to the end of the text.
@@ -1165,7 +1202,7 @@ constexpr void unicode_bidi_P1_line(
     }
 
     if (paragraph_begin != last) {
-        auto const[new_paragraph_end, paragraph_bidi_class] = unicode_bidi_P1_paragraph(paragraph_begin, last, context);
+        auto const[new_paragraph_end, paragraph_bidi_class] = unicode_bidi_P1_paragraph(paragraph_begin, last, context, scratch);
         paragraph_directions.push_back(paragraph_bidi_class);
         last = new_paragraph_end;
     }
@@ -1190,6 +1227,62 @@ constexpr void unicode_bidi_L4(
     }
 }
 
+/** The bidi classes of the ASCII characters.
+ */
+constexpr auto unicode_bidi_ASCII_classes = [] {
+    auto r = std::array<unicode_bidi_class, 128>{};
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        r[i] = ucd_get_text_properties(char32_t(i)).bidi_class();
+    }
+    return r;
+}();
+
+/** Check if the text is left-to-right, without running the bidi-algorithm.
+ *
+ * When the paragraphs start left-to-right and the text has no characters with a
+ * right-to-left, arabic-number, boundary-neutral or explicit-formatting bidi class,
+ * then every character resolves to embedding level 0: nothing is reordered, mirrored or removed.
+ *
+ * @param first The first iterator
+ * @param last The last iterator
+ * @param get_code_point A function to get the code-point of an item.
+ * @param context The context/configuration to use for the bidi-algorithm.
+ * @return The number of paragraphs, or empty when the bidi-algorithm needs to be run.
+ */
+template<typename It, typename GetCodePoint>
+[[nodiscard]] constexpr std::optional<std::size_t>
+unicode_bidi_LTR_only(It first, It last, GetCodePoint const& get_code_point, unicode_bidi_context const& context) noexcept
+{
+    using enum unicode_bidi_class;
+
+    if (context.direction_mode != unicode_bidi_context::mode_type::LTR and
+        context.direction_mode != unicode_bidi_context::mode_type::auto_LTR) {
+        return std::nullopt;
+    }
+
+    auto num_paragraphs = 0_uz;
+    auto in_paragraph = false;
+    for (auto it = first; it != last; ++it) {
+        auto const code_point = get_code_point(*it);
+        auto const bidi_class = code_point < 128 ? unicode_bidi_ASCII_classes[code_point] : ucd_get_text_properties(code_point).bidi_class();
+
+        // Only the classes ON, L, S, B, WS, ET, ES, CS, EN and NSM are allowed, at paragraph
+        // embedding level 0 they are all resolved to L.
+        if (std::to_underlying(bidi_class) > std::to_underlying(NSM) or bidi_class == R or bidi_class == BN) {
+            return std::nullopt;
+        }
+
+        if (bidi_class == B) {
+            ++num_paragraphs;
+            in_paragraph = false;
+        } else {
+            in_paragraph = true;
+        }
+    }
+
+    return in_paragraph ? num_paragraphs + 1 : num_paragraphs;
+}
+
 } // namespace detail
 
 /** Reorder a given range of characters based on the unicode_bidi algorithm.
@@ -1213,6 +1306,7 @@ constexpr void unicode_bidi_L4(
  * @param set_code_point A function to set the character in an item.
  * @param set_text_direction A function to set the text direction in an item.
  * @param context The context/configuration to use for the bidi-algorithm.
+ * @param scratch Buffers that are reused between calls, to reduce allocations.
  * @return Iterator pointing one beyond the last element, the writing direction for each paragraph.
  */
 template<typename It, typename GetCodePoint, typename SetCodePoint, typename SetTextDirection>
@@ -1222,9 +1316,19 @@ constexpr std::pair<It, std::vector<unicode_bidi_class>> unicode_bidi(
     GetCodePoint get_code_point,
     SetCodePoint set_code_point,
     SetTextDirection set_text_direction,
-    unicode_bidi_context const& context = {})
+    unicode_bidi_context const& context,
+    unicode_bidi_scratch& scratch)
 {
-    auto proxy = detail::unicode_bidi_char_info_vector{};
+    if (auto const num_paragraphs = detail::unicode_bidi_LTR_only(first, last, get_code_point, context)) {
+        // Most text is left-to-right, skip the algorithm.
+        for (auto it = first; it != last; ++it) {
+            set_text_direction(*it, unicode_bidi_class::L);
+        }
+        return {last, std::vector<unicode_bidi_class>(*num_paragraphs, unicode_bidi_class::L)};
+    }
+
+    auto& proxy = scratch.characters;
+    proxy.clear();
     proxy.reserve(std::distance(first, last));
 
     std::size_t index = 0;
@@ -1232,7 +1336,7 @@ constexpr std::pair<It, std::vector<unicode_bidi_class>> unicode_bidi(
         proxy.emplace_back(index++, get_code_point(*it));
     }
 
-    auto [proxy_last, paragraph_directions] = detail::unicode_bidi_P1(begin(proxy), end(proxy), context);
+    auto [proxy_last, paragraph_directions] = detail::unicode_bidi_P1(begin(proxy), end(proxy), context, scratch);
     last = shuffle_by_index(first, last, begin(proxy), proxy_last, [](auto const& item) {
         return item.index;
     });
@@ -1246,6 +1350,37 @@ constexpr std::pair<It, std::vector<unicode_bidi_class>> unicode_bidi(
     return {last, std::move(paragraph_directions)};
 }
 
+/** Reorder a given range of characters based on the unicode_bidi algorithm.
+ *
+ * @see unicode_bidi(It, It, GetCodePoint, SetCodePoint, SetTextDirection, unicode_bidi_context const&, unicode_bidi_scratch&)
+ * @param first The first iterator
+ * @param last The last iterator
+ * @param get_code_point A function to get the character of an item.
+ * @param set_code_point A function to set the character in an item.
+ * @param set_text_direction A function to set the text direction in an item.
+ * @param context The context/configuration to use for the bidi-algorithm.
+ * @return Iterator pointing one beyond the last element, the writing direction for each paragraph.
+ */
+template<typename It, typename GetCodePoint, typename SetCodePoint, typename SetTextDirection>
+constexpr std::pair<It, std::vector<unicode_bidi_class>> unicode_bidi(
+    It first,
+    It last,
+    GetCodePoint get_code_point,
+    SetCodePoint set_code_point,
+    SetTextDirection set_text_direction,
+    unicode_bidi_context const& context = {})
+{
+    auto scratch = unicode_bidi_scratch{};
+    return unicode_bidi(
+        first,
+        last,
+        std::move(get_code_point),
+        std::move(set_code_point),
+        std::move(set_text_direction),
+        context,
+        scratch);
+}
+
 /** Get the unicode bidi direction for the first paragraph and context.
  *
  * @param first The first iterator
@@ -1288,7 +1423,7 @@ constexpr It unicode_bidi_control_filter(It first, EndIt last, CodePointFunc con
 {
     return std::remove_if(first, last, [&](auto const& item) {
         auto const code_point = code_point_func(item);
-        auto const bidi_class = ucd_get_bidi_class(code_point);
+        auto const bidi_class = ucd_get_text_properties(code_point).bidi_class();
         return is_control(bidi_class);
     });
 }
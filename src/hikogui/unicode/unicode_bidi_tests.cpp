@@ -142,6 +142,9 @@ hi::generator<unicode_bidi_test> parse_bidi_test(int test_line_nr = -1)
 
 TEST_CASE(bidi_test)
 {
+    // The scratch buffers are reused between tests, like text_shaper does.
+    auto scratch = hi::unicode_bidi_scratch{};
+
     for (auto test : parse_bidi_test()) {
         for (auto paragraph_direction : test.get_paragraph_directions()) {
             auto test_parameters = hi::unicode_bidi_context{};
@@ -158,7 +161,7 @@ TEST_CASE(bidi_test)
             auto first = begin(input);
             auto last = end(input);
 
-            auto const[new_last, paragraph_directions] = unicode_bidi_P1(first, last, test_parameters);
+            auto const[new_last, paragraph_directions] = unicode_bidi_P1(first, last, test_parameters, scratch);
             last = new_last;
 
             // We are using the index from the iterator to find embedded levels
@@ -331,4 +334,27 @@ TEST_CASE(bidi_character_test)
     }
 }
 
+TEST_CASE(LTR_only)
+{
+    auto const get_code_point = [](char32_t c) {
+        return c;
+    };
+    auto const context = hi::unicode_bidi_context{};
+
+    auto const latin = std::u32string_view{U"Hello (world) 42.\u2029caf\u00e9"};
+    REQUIRE(hi::detail::unicode_bidi_LTR_only(latin.begin(), latin.end(), get_code_point, context) == 2);
+
+    auto const hebrew = std::u32string_view{U"Hello \u05e9\u05dc\u05d5\u05dd"};
+    REQUIRE(not hi::detail::unicode_bidi_LTR_only(hebrew.begin(), hebrew.end(), get_code_point, context));
+
+    auto const arabic_number = std::u32string_view{U"\u0661\u0662"};
+    REQUIRE(not hi::detail::unicode_bidi_LTR_only(arabic_number.begin(), arabic_number.end(), get_code_point, context));
+
+    auto const zero_width_joiner = std::u32string_view{U"a\u200db"};
+    REQUIRE(not hi::detail::unicode_bidi_LTR_only(zero_width_joiner.begin(), zero_width_joiner.end(), get_code_point, context));
+
+    auto const rtl_context = hi::unicode_bidi_context{hi::unicode_bidi_class::R};
+    REQUIRE(not hi::detail::unicode_bidi_LTR_only(latin.begin(), latin.end(), get_code_point, rtl_context));
+}
+
 };
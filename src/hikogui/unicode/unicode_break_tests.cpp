@@ -18,6 +18,7 @@
 #include <span>
 #include <format>
 #include <ranges>
+#include <algorithm>
 
 TEST_SUITE(unicode_break_suite) {
 
@@ -127,4 +128,70 @@ TEST_CASE(line_break)
     }
 }
 
+TEST_CASE(join_at_paragraph_separator)
+{
+    // The break opportunities of a text can be determined for each paragraph and joined,
+    // which is used to analyse paragraphs in parallel.
+    auto const text = std::u32string{U"Hello world. \"Quoted.\" Next\u2029Second, 1.5 km.\u2029\u2029Third"};
+    auto const get_code_point = [](auto const code_point) -> decltype(auto) {
+        return code_point;
+    };
+
+    auto const join = [&](auto const& break_func) {
+        auto r = hi::unicode_break_vector{};
+        auto first = text.begin();
+        while (true) {
+            auto const last = std::find(first, text.end(), U'\u2029');
+            auto const paragraph_last = last == text.end() ? last : last + 1;
+            auto const paragraph = break_func(first, paragraph_last, get_code_point);
+            r.insert(r.end(), r.empty() ? paragraph.begin() : paragraph.begin() + 1, paragraph.end());
+            if (paragraph_last == text.end()) {
+                return r;
+            }
+            first = paragraph_last;
+        }
+    };
+
+    REQUIRE(
+        join([](auto... args) { return hi::unicode_line_break(args...); }) ==
+        hi::unicode_line_break(text.begin(), text.end(), get_code_point));
+    REQUIRE(
+        join([](auto... args) { return hi::unicode_word_break(args...); }) ==
+        hi::unicode_word_break(text.begin(), text.end(), get_code_point));
+    REQUIRE(
+        join([](auto... args) { return hi::unicode_sentence_break(args...); }) ==
+        hi::unicode_sentence_break(text.begin(), text.end(), get_code_point));
+}
+
+TEST_CASE(line_break_cache)
+{
+    for (auto const& test : parse_tests(hi::library_test_data_dir() / "LineBreakTest.txt")) {
+        auto const opportunities =
+            hi::unicode_line_break(test.code_points.begin(), test.code_points.end(), [](auto const code_point) -> decltype(auto) {
+                return code_point;
+            });
+
+        // Spaces have a negative width, so that they do not count at the end of a line.
+        auto widths = std::vector<float>{};
+        for (auto const code_point : test.code_points) {
+            widths.push_back(code_point == U' ' ? -1.0f : static_cast<float>(code_point % 3 + 1));
+        }
+
+        auto const cache = hi::unicode_line_break_cache{opportunities, widths};
+        REQUIRE(cache.size() == widths.size());
+        REQUIRE(cache.mandatory_lines(0, cache.size()) == hi::detail::unicode_LB_mandatory_lines(opportunities), test.comment);
+        REQUIRE(cache.optional_lines(0, cache.size()) == hi::detail::unicode_LB_optional_lines(opportunities), test.comment);
+
+        for (auto const maximum_line_width : {0.0f, 1.0f, 2.5f, 4.0f, 7.0f, 100.0f}) {
+            auto const expected = hi::detail::unicode_LB_fit_lines(opportunities, widths, maximum_line_width);
+            REQUIRE(cache.fit_lines(0, cache.size(), maximum_line_width) == expected, test.comment);
+            REQUIRE(cache.width(0, expected) == hi::detail::unicode_LB_width(widths, expected), test.comment);
+            REQUIRE(
+                hi::unicode_line_break(cache, 0, cache.size(), maximum_line_width) ==
+                    hi::unicode_line_break(opportunities, widths, maximum_line_width),
+                test.comment);
+        }
+    }
+}
+
 };
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "ucd_grapheme_cluster_breaks.hpp"
+#include "ucd_text_properties.hpp"
 #include "unicode_break_opportunity.hpp"
 #include "../macros.hpp"
 #include <cstdint>
@@ -136,7 +137,7 @@ struct grapheme_break_state {
  */
 [[nodiscard]] constexpr bool breaks_grapheme(char32_t code_point, grapheme_break_state& state) noexcept
 {
-    return breaks_grapheme(ucd_get_grapheme_cluster_break(code_point), state);
+    return breaks_grapheme(ucd_get_text_properties(code_point).grapheme_cluster_break(), state);
 }
 
 } // namespace detail
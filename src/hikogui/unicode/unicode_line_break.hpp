@@ -12,6 +12,7 @@
 #include "ucd_grapheme_cluster_breaks.hpp"
 #include "ucd_line_break_classes.hpp"
 #include "ucd_east_asian_widths.hpp"
+#include "ucd_text_properties.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <cstdint>
@@ -88,10 +89,11 @@ unicode_LB1(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
 
     for (auto it = first; it != last; ++it) {
         auto const code_point = code_point_func(*it);
-        auto const east_asian_width = ucd_get_east_asian_width(code_point);
-        auto const break_class = ucd_get_line_break_class(code_point);
-        auto const general_category = ucd_get_general_category(code_point);
-        auto const grapheme_cluster_break = ucd_get_grapheme_cluster_break(code_point);
+        auto const properties = ucd_get_text_properties(code_point);
+        auto const east_asian_width = properties.east_asian_width();
+        auto const break_class = properties.line_break_class();
+        auto const general_category = properties.general_category();
+        auto const grapheme_cluster_break = properties.grapheme_cluster_break();
 
         auto const resolved_break_class = [&]() {
             switch (break_class) {
@@ -621,6 +623,206 @@ unicode_LB_width(unicode_break_vector const& opportunities, std::vector<float> c
 
 } // namespace detail
 
+/** Cached break candidates and accumulated widths of a text.
+ *
+ * Fitting lines to a maximum width with this cache is a binary search for each line,
+ * instead of a scan over each character of the text. This makes it cheap to fit the
+ * same text to many different widths, for example while resizing a window.
+ */
+class unicode_line_break_cache {
+public:
+    /** Create a cache for an empty text.
+     */
+    constexpr unicode_line_break_cache() noexcept : _prefix_widths{0.0}, _visible_last{0} {}
+
+    /** Create a cache for a text.
+     *
+     * @param opportunities The break-opportunity per character, see `unicode_line_break()`.
+     * @param widths The width of each character, negative for white-space.
+     */
+    constexpr unicode_line_break_cache(unicode_break_vector const& opportunities, std::vector<float> const& widths) noexcept
+    {
+        hi_axiom(opportunities.size() == widths.size() + 1);
+
+        _prefix_widths.reserve(widths.size() + 1);
+        _visible_last.reserve(widths.size() + 1);
+
+        _prefix_widths.push_back(0.0);
+        _visible_last.push_back(0);
+        for (auto i = 0_uz; i != widths.size(); ++i) {
+            _prefix_widths.push_back(_prefix_widths.back() + abs(widths[i]));
+            _visible_last.push_back(widths[i] >= 0.0f ? i + 1 : _visible_last.back());
+
+            if (auto const opportunity = opportunities[i + 1]; opportunity == unicode_break_opportunity::mandatory) {
+                _mandatory.push_back(i + 1);
+                _candidates.push_back(i + 1);
+            } else if (opportunity != unicode_break_opportunity::no) {
+                _candidates.push_back(i + 1);
+            }
+        }
+    }
+
+    /** The number of characters in the text.
+     */
+    [[nodiscard]] constexpr size_t size() const noexcept
+    {
+        return _visible_last.size() - 1;
+    }
+
+    /** Calculate the width of a line.
+     *
+     * White-space at the end of the line does not count towards the width.
+     *
+     * @param first The index of the first character of the line.
+     * @param last The index one beyond the last character of the line.
+     * @return The width of the line.
+     */
+    [[nodiscard]] constexpr float width(size_t first, size_t last) const noexcept
+    {
+        hi_axiom(first <= last);
+        hi_axiom(last <= size());
+
+        auto const visible_last = std::max(first, _visible_last[last]);
+        return static_cast<float>(_prefix_widths[visible_last] - _prefix_widths[first]);
+    }
+
+    /** Get the maximum width of a set of lines.
+     *
+     * @param first The index of the first character of the first line.
+     * @param lengths Number of characters on each line.
+     * @return The maximum line width.
+     */
+    [[nodiscard]] constexpr float width(size_t first, std::vector<size_t> const& lengths) const noexcept
+    {
+        auto max_width = 0.0f;
+        for (auto length : lengths) {
+            inplace_max(max_width, width(first, first + length));
+            first += length;
+        }
+        return max_width;
+    }
+
+    /** Check if all the lines fit the maximum width.
+     *
+     * @param first The index of the first character of the first line.
+     * @param lengths Number of characters on each line.
+     * @param maximum_line_width The maximum line width allowed.
+     * @return True if all the lines fit the maximum width.
+     */
+    [[nodiscard]] constexpr bool
+    width_check(size_t first, std::vector<size_t> const& lengths, float maximum_line_width) const noexcept
+    {
+        for (auto length : lengths) {
+            if (width(first, first + length) > maximum_line_width) {
+                return false;
+            }
+            first += length;
+        }
+        return true;
+    }
+
+    /** Get the length of each line when broken with mandatory breaks.
+     *
+     * @param first The index of the first character of the text to break.
+     * @param last The index one beyond the last character of the text to break.
+     * @return A list of line lengths.
+     */
+    [[nodiscard]] constexpr std::vector<size_t> mandatory_lines(size_t first, size_t last) const noexcept
+    {
+        return lines(_mandatory, first, last);
+    }
+
+    /** Get the length of each line when broken with mandatory and optional breaks.
+     *
+     * @param first The index of the first character of the text to break.
+     * @param last The index one beyond the last character of the text to break.
+     * @return A list of line lengths.
+     */
+    [[nodiscard]] constexpr std::vector<size_t> optional_lines(size_t first, size_t last) const noexcept
+    {
+        return lines(_candidates, first, last);
+    }
+
+    /** Find the end of a line when folding text to a maximum width.
+     *
+     * @param first The index of the first character of the line.
+     * @param last The index one beyond the last character of the text to break.
+     * @param maximum_line_width The maximum width of the line.
+     * @return The index one beyond the last character of the line.
+     */
+    [[nodiscard]] constexpr size_t fit_line(size_t first, size_t last, float maximum_line_width) const noexcept
+    {
+        hi_axiom(first < last);
+        hi_axiom(last <= size());
+
+        auto const mandatory_it = std::upper_bound(_mandatory.begin(), _mandatory.end(), first);
+        auto const end_of_paragraph = mandatory_it != _mandatory.end() ? std::min(*mandatory_it, last) : last;
+        if (width(first, end_of_paragraph) <= maximum_line_width) {
+            return end_of_paragraph;
+        }
+
+        // The width of a line only grows when the end of the line is moved forward.
+        auto const candidates_first = std::upper_bound(_candidates.begin(), _candidates.end(), first);
+        auto const candidates_last = std::lower_bound(candidates_first, _candidates.end(), end_of_paragraph);
+        auto const it = std::partition_point(candidates_first, candidates_last, [&](size_t end_of_line) {
+            return width(first, end_of_line) <= maximum_line_width;
+        });
+
+        if (it != candidates_first) {
+            return *std::prev(it);
+        }
+
+        // We couldn't break the line to fit the maximum line width, use the first break opportunity.
+        return candidates_first != candidates_last ? *candidates_first : end_of_paragraph;
+    }
+
+    /** Get the length of each line when broken after folding text to a maximum width.
+     *
+     * @param first The index of the first character of the text to break.
+     * @param last The index one beyond the last character of the text to break.
+     * @param maximum_line_width The maximum width of a line.
+     * @return A list of line lengths.
+     */
+    [[nodiscard]] constexpr std::vector<size_t> fit_lines(size_t first, size_t last, float maximum_line_width) const noexcept
+    {
+        auto r = std::vector<size_t>{};
+        while (first != last) {
+            auto const end_of_line = fit_line(first, last, maximum_line_width);
+            r.push_back(end_of_line - first);
+            first = end_of_line;
+        }
+        return r;
+    }
+
+private:
+    /** The accumulated absolute width of the characters before each index.
+     */
+    std::vector<double> _prefix_widths;
+
+    /** The index one beyond the last non-white-space character before each index.
+     */
+    std::vector<size_t> _visible_last;
+
+    /** The index one beyond each character followed by a mandatory break, in order.
+     */
+    std::vector<size_t> _mandatory;
+
+    /** The index one beyond each character followed by a mandatory or optional break, in order.
+     */
+    std::vector<size_t> _candidates;
+
+    [[nodiscard]] constexpr static std::vector<size_t>
+    lines(std::vector<size_t> const& breaks, size_t first, size_t last) noexcept
+    {
+        auto r = std::vector<size_t>{};
+        for (auto it = std::upper_bound(breaks.begin(), breaks.end(), first); it != breaks.end() and *it <= last; ++it) {
+            r.push_back(*it - first);
+            first = *it;
+        }
+        return r;
+    }
+};
+
 /** The unicode line break algorithm UAX #14
  *
  * @param first An iterator to the first character.
@@ -665,5 +867,27 @@ unicode_line_break(unicode_break_vector const& opportunities, std::vector<float>
     return r;
 }
 
+/** Unicode break lines.
+ *
+ * @param cache The break candidates and widths of the text.
+ * @param first The index of the first character of the text to break.
+ * @param last The index one beyond the last character of the text to break.
+ * @param maximum_line_width The maximum line width.
+ * @return A list of line lengths.
+ */
+[[nodiscard]] constexpr std::vector<size_t>
+unicode_line_break(unicode_line_break_cache const& cache, size_t first, size_t last, float maximum_line_width) noexcept
+{
+    // See if the lines after mandatory breaks will fit the width and return.
+    auto r = cache.mandatory_lines(first, last);
+    if (cache.width_check(first, r, maximum_line_width)) {
+        return r;
+    }
+
+    r = cache.fit_lines(first, last, maximum_line_width);
+    hi_axiom(cache.width_check(first, r, maximum_line_width));
+    return r;
+}
+
 
 } // namespace hi::inline v1
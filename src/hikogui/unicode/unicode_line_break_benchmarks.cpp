@@ -0,0 +1,48 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "unicode_line_break.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <string>
+#include <vector>
+
+/** Text with words, punctuation, numbers and a few mandatory breaks.
+ */
+[[nodiscard]] static std::u32string line_break_text()
+{
+    auto r = std::u32string{};
+    for (auto i = 0; i != 64; ++i) {
+        r += U"Lorem ipsum dolor sit amet, consectetur adipiscing elit (12.345,67) “quoted” text-with-hyphens; ";
+        if (i % 8 == 7) {
+            r += U'\n';
+        }
+    }
+    return r;
+}
+
+hi_benchmark(unicode_line_break)
+{
+    auto const text = line_break_text();
+
+    state.set_items_per_iteration(text.size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::unicode_line_break(text.begin(), text.end(), [](char32_t c) {
+            return c;
+        }));
+    }
+}
+
+hi_benchmark(unicode_line_break_fold)
+{
+    auto const text = line_break_text();
+    auto const opportunities = hi::unicode_line_break(text.begin(), text.end(), [](char32_t c) {
+        return c;
+    });
+    auto const widths = std::vector<float>(text.size(), 7.0f);
+
+    state.set_items_per_iteration(text.size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::unicode_line_break(opportunities, widths, 400.0f));
+    }
+}
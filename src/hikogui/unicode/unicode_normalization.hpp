@@ -7,6 +7,7 @@
 #include "ucd_decompositions.hpp"
 #include "ucd_compositions.hpp"
 #include "ucd_canonical_combining_classes.hpp"
+#include "ucd_NFC_quick_checks.hpp"
 #include "unicode_description.hpp"
 #include "../algorithm/algorithm.hpp"
 #include "../utility/utility.hpp"
@@ -15,6 +16,8 @@
 #include <string>
 #include <string_view>
 #include <algorithm>
+#include <utility>
+#include <concepts>
 
 hi_export_module(hikogui.unicode.unicode_normalization);
 
@@ -64,6 +67,28 @@ struct unicode_normalize_config {
         return *this;
     }
 
+    /** Check if only canonical decompositions are used, as with NFD and NFC.
+     */
+    [[nodiscard]] constexpr bool canonical_only() const noexcept
+    {
+        return decomposition_mask == (1_uz << std::to_underlying(unicode_decomposition_type::canonical));
+    }
+
+    /** Check if the code-point is passed through unchanged by the separator and drop rules.
+     */
+    [[nodiscard]] constexpr bool is_kept(char32_t code_point) const noexcept
+    {
+        if (drop_C0 and (code_point <= U'\u001f' or code_point == U'\u007f')) {
+            return false;
+        }
+        if (drop_C1 and code_point >= U'\u0080' and code_point <= U'\u009f') {
+            return false;
+        }
+
+        return line_separators.find(code_point) == std::u32string::npos and
+            paragraph_separators.find(code_point) == std::u32string::npos and drop.find(code_point) == std::u32string::npos;
+    }
+
     [[nodiscard]] constexpr static unicode_normalize_config NFD() noexcept
     {
         auto r = unicode_normalize_config();
@@ -282,6 +307,99 @@ constexpr void unicode_clean(std::u32string& text) noexcept
     }
 }
 
+/** Check if a code-point passes the NFC quick check and is kept by the config.
+ *
+ * @param code_point The code-point to check.
+ * @param config The normalization config.
+ * @param[in,out] prev_ccc The canonical combining class of the previous code-point.
+ * @return True if the code-point is known to be unchanged by NFC normalization.
+ */
+[[nodiscard]] constexpr bool
+unicode_NFC_is_quick_yes(char32_t code_point, unicode_normalize_config const& config, uint8_t& prev_ccc) noexcept
+{
+    if (code_point < U'\u0300') {
+        // Fast path, these are all starters with NFC_Quick_Check=Yes.
+        prev_ccc = 0;
+        return config.is_kept(code_point);
+    }
+
+    auto const ccc = ucd_get_canonical_combining_class(code_point);
+    if (ccc != 0 and ccc < prev_ccc) {
+        // Combining marks are not in canonical order.
+        return false;
+    }
+    prev_ccc = ccc;
+
+    return ucd_get_NFC_quick_check(code_point) == unicode_NFC_quick_check::yes and config.is_kept(code_point);
+}
+
+/** Find the next span of text that may be changed by NFC normalization.
+ *
+ * A span starts and ends at a starter which passes the NFC quick check, code-points
+ * outside of the spans can not interact with the code-points inside the spans.
+ *
+ * @param text The text to search.
+ * @param first The index in the text to start searching, which must be the start of text or end of a previous span.
+ * @param config The normalization config.
+ * @return The first and last index of the span, or the size of the text when the rest of the text is normalized.
+ */
+[[nodiscard]] constexpr std::pair<size_t, size_t>
+unicode_NFC_find_span(std::u32string_view text, size_t first, unicode_normalize_config const& config) noexcept
+{
+    auto span_first = first;
+    auto prev_ccc = uint8_t{0};
+    for (auto i = first; i != text.size(); ++i) {
+        if (unicode_NFC_is_quick_yes(text[i], config, prev_ccc)) {
+            if (prev_ccc == 0) {
+                span_first = i;
+            }
+            continue;
+        }
+
+        // Extend the span up to the next starter that passes the quick check.
+        for (++i; i != text.size(); ++i) {
+            prev_ccc = 0;
+            if (unicode_NFC_is_quick_yes(text[i], config, prev_ccc) and prev_ccc == 0) {
+                break;
+            }
+        }
+        return {span_first, i};
+    }
+    return {text.size(), text.size()};
+}
+
+/** Normalize the spans of text that may be changed by NFC normalization.
+ *
+ * @param text The text to normalize.
+ * @param span The first span to normalize, as returned by `unicode_NFC_find_span()`.
+ * @param config The normalization config.
+ * @return The normalized text.
+ */
+[[nodiscard]] constexpr std::u32string
+unicode_normalize_spans(std::u32string_view text, std::pair<size_t, size_t> span, unicode_normalize_config const& config) noexcept
+{
+    auto r = std::u32string{};
+    r.reserve(text.size());
+
+    auto tmp = std::u32string{};
+    auto done = 0_uz;
+    while (span.first != text.size()) {
+        r.append(text.substr(done, span.first - done));
+
+        tmp.clear();
+        unicode_decompose(text.substr(span.first, span.second - span.first), config, tmp);
+        unicode_reorder(tmp);
+        unicode_compose(tmp);
+        unicode_clean(tmp);
+        r.append(tmp);
+
+        done = span.second;
+        span = unicode_NFC_find_span(text, span.second, config);
+    }
+    r.append(text.substr(done));
+    return r;
+}
+
 } // namespace detail
 
 /** Convert text to a Unicode decomposed normal form.
@@ -307,6 +425,15 @@ unicode_decompose(std::u32string_view text, unicode_normalize_config config = un
 [[nodiscard]] constexpr std::u32string
 unicode_normalize(std::u32string_view text, unicode_normalize_config config = unicode_normalize_config::NFC()) noexcept
 {
+    if (config.canonical_only()) {
+        // Only the spans of text that fail the NFC quick check need to be normalized.
+        auto const span = detail::unicode_NFC_find_span(text, 0, config);
+        if (span.first == text.size()) {
+            return std::u32string{text};
+        }
+        return detail::unicode_normalize_spans(text, span, config);
+    }
+
     auto r = std::u32string{};
     detail::unicode_decompose(text, config, r);
     detail::unicode_reorder(r);
@@ -315,6 +442,29 @@ unicode_normalize(std::u32string_view text, unicode_normalize_config config = un
     return r;
 }
 
+/** Convert text to a Unicode composed normal form.
+ *
+ * When the text is already normalized, which is the common case, the text is
+ * returned without allocating memory.
+ *
+ * @param text to normalize, only accepts a `std::u32string` rvalue.
+ * @param normalization_mask Extra features for normalization.
+ */
+template<std::same_as<std::u32string> Text>
+[[nodiscard]] constexpr std::u32string
+unicode_normalize(Text&& text, unicode_normalize_config config = unicode_normalize_config::NFC()) noexcept
+{
+    if (config.canonical_only()) {
+        auto const span = detail::unicode_NFC_find_span(text, 0, config);
+        if (span.first == text.size()) {
+            return std::move(text);
+        }
+        return detail::unicode_normalize_spans(text, span, config);
+    }
+
+    return unicode_normalize(std::u32string_view{text}, config);
+}
+
 /** Check if the string of code-points is a single grapheme in NFC normal form.
  * 
  * @param it An iterator pointing to the first code-point.
@@ -0,0 +1,49 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "unicode_normalization.hpp"
+#include "../telemetry/benchmark.hpp"
+#include <string>
+
+/** Text in NFC with latin, greek and hangul characters.
+ */
+[[nodiscard]] static std::u32string normalization_text()
+{
+    auto r = std::u32string{};
+    for (auto i = 0; i != 64; ++i) {
+        r += U"Café naïve Ångström ἀλφα 한국어 plain ascii text. ";
+    }
+    return r;
+}
+
+hi_benchmark(unicode_normalize_NFC_quick_check)
+{
+    // Text that is already in NFC only needs the quick check.
+    auto const text = normalization_text();
+
+    state.set_items_per_iteration(text.size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::unicode_normalize(text));
+    }
+}
+
+hi_benchmark(unicode_normalize_NFC)
+{
+    auto const text = hi::unicode_normalize(normalization_text(), hi::unicode_normalize_config::NFD());
+
+    state.set_items_per_iteration(text.size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::unicode_normalize(text));
+    }
+}
+
+hi_benchmark(unicode_normalize_NFD)
+{
+    auto const text = normalization_text();
+
+    state.set_items_per_iteration(text.size());
+    while (state.running()) {
+        hi::do_not_optimize(hi::unicode_normalize(text, hi::unicode_normalize_config::NFD()));
+    }
+}
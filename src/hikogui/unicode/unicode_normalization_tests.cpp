@@ -129,6 +129,23 @@ TEST_CASE(unicode_NFC_colon)
     REQUIRE(hi::unicode_decompose(hi::to_u32string("Audio device:")) == hi::to_u32string("Audio device:"));
 }
 
+TEST_CASE(NFC_quick_check)
+{
+    // Already normalized text is moved without reallocating.
+    auto text = std::u32string(U"The quick brown fox jumps over the lazy dog.");
+    auto const *text_ptr = text.data();
+    auto result = hi::unicode_normalize(std::move(text));
+    REQUIRE(result == U"The quick brown fox jumps over the lazy dog.");
+    REQUIRE(result.data() == text_ptr);
+
+    // Only the span around the combining mark is composed.
+    REQUIRE(hi::unicode_normalize(std::u32string(U"cafe\u0301 au lait")) == U"caf\u00e9 au lait");
+
+    // The separator and drop rules are also applied to the already normalized text.
+    auto const config = hi::unicode_normalize_config::NFC_PS_noctr();
+    REQUIRE(hi::unicode_normalize(std::u32string(U"one\r\ntwo"), config) == U"one\u2029two");
+}
+
 TEST_CASE(NFC)
 {
     for (auto const& test : parseNormalizationTests()) {
@@ -14,6 +14,12 @@
 #include "../macros.hpp"
 #include <concepts>
 #include <array>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <type_traits>
 #include <cstdint>
 #include <cstddef>
 #include <bit>
@@ -918,6 +924,68 @@ using cardinal_plural_fptr = plurality (*)(plural_operand);
 
 constexpr auto cardinal_plural_table = cardinal_plural_table_init();
 
+/** The plurality of small integers, for each rule in the `cardinal_plural_table`.
+ *
+ * Numbers in translated messages are nearly always small integers, for these
+ * the rules are evaluated once, and then looked up.
+ */
+class cardinal_plural_cache {
+public:
+    /** The integers below this value are looked up.
+     */
+    constexpr static auto size = 1001_uz;
+
+    cardinal_plural_cache() noexcept
+    {
+        // The rules are shared by many languages; give each rule an index.
+        auto rules = std::vector<cardinal_plural_fptr>{};
+        for (auto i = 0_uz; i != cardinal_plural_table.size(); ++i) {
+            auto const rule = cardinal_plural_table[i];
+            auto it = std::ranges::find(rules, rule);
+            if (it == rules.end()) {
+                rules.push_back(rule);
+                it = rules.end() - 1;
+            }
+            _rule_index[i] = narrow_cast<uint8_t>(std::distance(rules.begin(), it));
+        }
+
+        _masks.resize(rules.size());
+        _values.resize(rules.size() * size);
+        for (auto i = 0_uz; i != rules.size(); ++i) {
+            for (auto n = 0_uz; n != size; ++n) {
+                auto const p = rules[i](plural_operand(narrow_cast<long long>(n)));
+                _masks[i] = p.mask;
+                _values[i * size + n] = p.value;
+            }
+        }
+    }
+
+    [[nodiscard]] static cardinal_plural_cache const& global() noexcept
+    {
+        static auto const r = cardinal_plural_cache{};
+        return r;
+    }
+
+    /** Get the plurality of a small integer.
+     *
+     * @param language_index The intrinsic value of the iso_639 language.
+     * @param n A number smaller than `size`.
+     */
+    [[nodiscard]] plurality get(std::size_t language_index, std::size_t n) const noexcept
+    {
+        hi_axiom_bounds(language_index, _rule_index);
+        hi_axiom(n < size);
+
+        auto const i = _rule_index[language_index];
+        return {_values[i * size + n], _masks[i]};
+    }
+
+private:
+    std::array<uint8_t, std::tuple_size_v<decltype(cardinal_plural_table)>> _rule_index = {};
+    std::vector<plurality_mask> _masks;
+    std::vector<plurality_value> _values;
+};
+
 } // namespace detail
 
 /** Get plural information of a number in a given language.
@@ -928,14 +996,18 @@ constexpr auto cardinal_plural_table = cardinal_plural_table_init();
  */
 [[nodiscard]] constexpr plurality cardinal_plural(language_tag language, std::integral auto n) noexcept
 {
-    if (language == language_tag{"pt-PT"}) {
+    if (language.language == iso_639{"pt"} and language.region == iso_3166{"PT"}) {
         // Portuguese in Portugal is different from Portuguese spoken in
         // other regions.
-        return cardinal_plural_afrikaans(detail::plural_operand(n));
+        return detail::cardinal_plural_afrikaans(detail::plural_operand(n));
     }
 
-    auto const language_index = language.region.intrinsic();
+    auto const language_index = language.language.intrinsic();
     hi_axiom_bounds(language_index, detail::cardinal_plural_table);
+
+    if (not std::is_constant_evaluated() and std::cmp_greater_equal(n, 0) and std::cmp_less(n, detail::cardinal_plural_cache::size)) {
+        return detail::cardinal_plural_cache::global().get(language_index, static_cast<std::size_t>(n));
+    }
     return detail::cardinal_plural_table[language_index](detail::plural_operand(n));
 }
 
@@ -0,0 +1,46 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "unicode_plural.hpp"
+#include <hikotest/hikotest.hpp>
+
+TEST_SUITE(unicode_plural) {
+
+TEST_CASE(cardinal_plural_english)
+{
+    auto const en = hi::language_tag{"en"};
+    REQUIRE(hi::cardinal_plural(en, 0).value == hi::plurality_value::other);
+    REQUIRE(hi::cardinal_plural(en, 1).value == hi::plurality_value::one);
+    REQUIRE(hi::cardinal_plural(en, 2).value == hi::plurality_value::other);
+    REQUIRE(hi::cardinal_plural(en, 1, 2) == 0);
+    REQUIRE(hi::cardinal_plural(en, 5, 2) == 1);
+}
+
+TEST_CASE(cardinal_plural_polish)
+{
+    auto const pl = hi::language_tag{"pl"};
+    REQUIRE(hi::cardinal_plural(pl, 1).value == hi::plurality_value::one);
+    REQUIRE(hi::cardinal_plural(pl, 2).value == hi::plurality_value::few);
+    REQUIRE(hi::cardinal_plural(pl, 5).value == hi::plurality_value::many);
+    REQUIRE(hi::cardinal_plural(pl, 22).value == hi::plurality_value::few);
+    REQUIRE(hi::cardinal_plural(pl, 1022).value == hi::plurality_value::few);
+}
+
+TEST_CASE(cardinal_plural_cache)
+{
+    // The small integers are looked up, they must match the rules.
+    for (auto const language : {"en", "fr", "pl", "ru", "ar", "cy", "ja"}) {
+        auto const language_index = hi::language_tag{language}.language.intrinsic();
+        auto const rule = hi::detail::cardinal_plural_table[language_index];
+
+        for (auto n = 0LL; n != 1001; ++n) {
+            auto const expected = rule(hi::detail::plural_operand(n));
+            auto const plurality = hi::cardinal_plural(hi::language_tag{language}, n);
+            REQUIRE(plurality.value == expected.value);
+            REQUIRE(plurality.mask == expected.mask);
+        }
+    }
+}
+
+};
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "ucd_sentence_break_properties.hpp"
+#include "ucd_text_properties.hpp"
 #include "unicode_break_opportunity.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
@@ -264,7 +265,7 @@ unicode_sentence_break(It first, ItEnd last, CodePointFunc const& code_point_fun
     infos.reserve(size);
     std::transform(first, last, std::back_inserter(infos), [&] (auto const &item) {
         auto const code_point = code_point_func(item);
-        return detail::unicode_sentence_break_info{ucd_get_sentence_break_property(code_point)};
+        return detail::unicode_sentence_break_info{ucd_get_text_properties(code_point).sentence_break_property()};
         });
 
     detail::unicode_sentence_break_SB1_SB4(r, infos);
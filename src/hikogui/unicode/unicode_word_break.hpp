@@ -11,6 +11,7 @@
 #include "ucd_general_categories.hpp"
 #include "ucd_grapheme_cluster_breaks.hpp"
 #include "ucd_word_break_properties.hpp"
+#include "ucd_text_properties.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <algorithm>
@@ -246,8 +247,9 @@ template<typename It, typename ItEnd, typename CodePointFunc>
     infos.reserve(size);
     std::transform(first, last, std::back_inserter(infos), [&](auto const& item) {
         auto const code_point = code_point_func(item);
-        auto const word_break_property = ucd_get_word_break_property(code_point);
-        auto const grapheme_cluster_break = ucd_get_grapheme_cluster_break(code_point);
+        auto const properties = ucd_get_text_properties(code_point);
+        auto const word_break_property = properties.word_break_property();
+        auto const grapheme_cluster_break = properties.grapheme_cluster_break();
         return detail::unicode_word_break_info{
             word_break_property, grapheme_cluster_break == unicode_grapheme_cluster_break::Extended_Pictographic};
     });
@@ -283,7 +285,7 @@ void wrap_lines(auto first, auto last, float max_width, auto get_width, auto get
 
     for (auto it = first; it != last; ++it) {
         auto const code_point = get_code_point(*it);
-        auto const general_category = ucd_get_general_category(code_point);
+        auto const general_category = ucd_get_text_properties(code_point).general_category();
 
         if (general_category == Zp || general_category == Zl) {
             // Reset the line on existing line and paragraph separator.
@@ -7,24 +7,27 @@
 #include "../macros.hpp"
 #include "terminate.hpp"
 #include "exception.hpp"
+#include "endian.hpp"
 #include <concepts>
 #include <charconv>
 #include <string>
 #include <string_view>
 #include <iterator>
+#include <array>
+#include <cstdint>
 
 hi_export_module(hikogui.utility.charconv);
 
 hi_export namespace hi { inline namespace v1 {
 
-/** Convert integer to string.
- * This function bypasses std::locale.
+/** Append an integer to a string.
+ * This function bypasses std::locale and does not allocate an intermediate string.
  *
+ * @param[in,out] str The string to append to.
  * @param value The signed or unsigned integer value.
- * @return The integer converted to a decimal string.
  */
 template<std::integral T>
-[[nodiscard]] std::string to_string(T const &value) noexcept
+void append_to_string(std::string& str, T const& value) noexcept
 {
     std::array<char, 21> buffer;
 
@@ -34,19 +37,19 @@ template<std::integral T>
     auto const[new_last, ec] = std::to_chars(first, last, value);
     hi_assert(ec == std::errc{});
 
-    auto r = std::string{};
-    std::copy(first, new_last, std::back_inserter(r));
-    return r;
+    str.append(first, new_last);
 }
 
-/** Convert floating point to string.
- * This function bypasses std::locale.
+/** Append a floating point number to a string.
+ * This function bypasses std::locale and does not allocate an intermediate string.
  *
- * @param value The signed or unsigned integer value.
- * @return The integer converted to a decimal string.
+ * The shortest string is used which parses back to the same value.
+ *
+ * @param[in,out] str The string to append to.
+ * @param value The floating point value.
  */
 template<std::floating_point T>
-[[nodiscard]] std::string to_string(T const &value) noexcept
+void append_to_string(std::string& str, T const& value) noexcept
 {
     std::array<char, 128> buffer;
 
@@ -56,11 +59,202 @@ template<std::floating_point T>
     auto const[new_last, ec] = std::to_chars(first, last, value, std::chars_format::general);
     hi_assert(ec == std::errc{});
 
+    str.append(first, new_last);
+}
+
+/** Convert integer to string.
+ * This function bypasses std::locale.
+ *
+ * @param value The signed or unsigned integer value.
+ * @return The integer converted to a decimal string.
+ */
+template<std::integral T>
+[[nodiscard]] std::string to_string(T const &value) noexcept
+{
     auto r = std::string{};
-    std::copy(first, new_last, std::back_inserter(r));
+    append_to_string(r, value);
     return r;
 }
 
+/** Convert floating point to string.
+ * This function bypasses std::locale.
+ *
+ * @param value The signed or unsigned integer value.
+ * @return The integer converted to a decimal string.
+ */
+template<std::floating_point T>
+[[nodiscard]] std::string to_string(T const &value) noexcept
+{
+    auto r = std::string{};
+    append_to_string(r, value);
+    return r;
+}
+
+namespace detail {
+
+/** Check if eight characters are all decimal digits.
+ *
+ * @param chunk Eight characters loaded as a little-endian integer.
+ */
+[[nodiscard]] constexpr bool is_eight_digits(uint64_t chunk) noexcept
+{
+    return ((chunk & 0xf0f0'f0f0'f0f0'f0f0) | (((chunk + 0x0606'0606'0606'0606) & 0xf0f0'f0f0'f0f0'f0f0) >> 4)) ==
+        0x3333'3333'3333'3333;
+}
+
+/** Convert eight decimal digits to an integer, using SIMD-within-a-register.
+ *
+ * @param chunk Eight decimal digits loaded as a little-endian integer.
+ * @return The value of the eight digits.
+ */
+[[nodiscard]] constexpr uint32_t parse_eight_digits(uint64_t chunk) noexcept
+{
+    chunk -= 0x3030'3030'3030'3030;
+    // Combine pairs of digits, then combine the pairs of pairs using two multiplies.
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x0000'00ff'0000'00ff) * 0x000f'4240'0000'0064) +
+             (((chunk >> 16) & 0x0000'00ff'0000'00ff) * 0x0000'2710'0000'0001)) >>
+        32;
+    return static_cast<uint32_t>(chunk);
+}
+
+/** Accumulate decimal digits, eight at a time when possible.
+ *
+ * Only the first 19 digits are accumulated, so that the mantissa can not overflow.
+ *
+ * @param first The first character.
+ * @param last One beyond the last character.
+ * @param[in,out] mantissa The value of the digits is accumulated into the mantissa.
+ * @param[in,out] num_digits The number of digits is added to this.
+ * @return Pointer to the first character that is not a digit.
+ */
+[[nodiscard]] inline char const *
+accumulate_digits(char const *first, char const *last, uint64_t& mantissa, int& num_digits) noexcept
+{
+    while (last - first >= 8 and num_digits <= 11) {
+        auto const chunk = load_le<uint64_t>(first);
+        if (not is_eight_digits(chunk)) {
+            break;
+        }
+        mantissa = mantissa * 100'000'000 + parse_eight_digits(chunk);
+        num_digits += 8;
+        first += 8;
+    }
+
+    while (first != last and *first >= '0' and *first <= '9') {
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + (*first - '0');
+        }
+        ++num_digits;
+        ++first;
+    }
+    return first;
+}
+
+} // namespace detail
+
+/** Parse a decimal integer.
+ *
+ * Behaves the same as `std::from_chars()`, but long runs of digits are
+ * parsed eight at a time. Integers of more than 18 digits are handled
+ * by `std::from_chars()`.
+ *
+ * @param first The first character.
+ * @param last One beyond the last character.
+ * @param[out] value The parsed value.
+ * @return The pointer to the first character that is not part of the number, and the error code.
+ */
+[[nodiscard]] inline std::from_chars_result from_chars_fast(char const *first, char const *last, long long& value) noexcept
+{
+    auto it = first;
+    auto const negative = it != last and *it == '-';
+    if (negative) {
+        ++it;
+    }
+
+    auto mantissa = uint64_t{0};
+    auto num_digits = 0;
+    it = detail::accumulate_digits(it, last, mantissa, num_digits);
+    if (num_digits == 0) {
+        return {first, std::errc::invalid_argument};
+    } else if (num_digits > 18) {
+        return std::from_chars(first, last, value);
+    }
+
+    value = negative ? -static_cast<long long>(mantissa) : static_cast<long long>(mantissa);
+    return {it, std::errc{}};
+}
+
+/** Parse a decimal floating point number.
+ *
+ * Behaves the same as `std::from_chars()`. Numbers with at most 19 significant
+ * digits, a mantissa of at most 2^53 and a decimal exponent within -22 and 22
+ * are exactly calculated with a single floating point multiply or divide;
+ * all other numbers are handled by `std::from_chars()`.
+ *
+ * @param first The first character.
+ * @param last One beyond the last character.
+ * @param[out] value The parsed value.
+ * @return The pointer to the first character that is not part of the number, and the error code.
+ */
+[[nodiscard]] inline std::from_chars_result from_chars_fast(char const *first, char const *last, double& value) noexcept
+{
+    constexpr auto powers_of_ten = std::array{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                              1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    auto it = first;
+    auto const negative = it != last and *it == '-';
+    if (negative) {
+        ++it;
+    }
+
+    auto mantissa = uint64_t{0};
+    auto num_digits = 0;
+    it = detail::accumulate_digits(it, last, mantissa, num_digits);
+    if (num_digits == 0) {
+        return std::from_chars(first, last, value);
+    }
+
+    auto exponent = 0;
+    if (it != last and *it == '.') {
+        auto const fraction_first = ++it;
+        it = detail::accumulate_digits(it, last, mantissa, num_digits);
+        if (it == fraction_first) {
+            return std::from_chars(first, last, value);
+        }
+        exponent = -static_cast<int>(it - fraction_first);
+    }
+
+    if (it != last and (*it == 'e' or *it == 'E')) {
+        ++it;
+        auto const exponent_negative = it != last and *it == '-';
+        if (it != last and (*it == '-' or *it == '+')) {
+            ++it;
+        }
+
+        auto const exponent_first = it;
+        auto exponent_ = 0;
+        while (it != last and *it >= '0' and *it <= '9' and it - exponent_first < 4) {
+            exponent_ = exponent_ * 10 + (*it - '0');
+            ++it;
+        }
+        if (it == exponent_first or (it != last and *it >= '0' and *it <= '9')) {
+            return std::from_chars(first, last, value);
+        }
+        exponent += exponent_negative ? -exponent_ : exponent_;
+    }
+
+    if (num_digits > 19 or mantissa > (uint64_t{1} << 53) or exponent < -22 or exponent > 22) {
+        return std::from_chars(first, last, value);
+    }
+
+    // Both the mantissa and the power of ten are exact, so the result is correctly rounded.
+    auto r = static_cast<double>(mantissa);
+    r = exponent < 0 ? r / powers_of_ten[-exponent] : r * powers_of_ten[exponent];
+    value = negative ? -r : r;
+    return {it, std::errc{}};
+}
+
 /** Convert a string to an integer.
  * This function bypasses std::locale
  *
@@ -77,7 +271,14 @@ template<std::integral T>
     auto const first = str.data();
     auto const last = first + ssize(str);
 
-    auto const[new_last, ec] = std::from_chars(first, last, value, base);
+    auto const[new_last, ec] = [&] {
+        if constexpr (std::same_as<T, long long>) {
+            if (base == 10) {
+                return from_chars_fast(first, last, value);
+            }
+        }
+        return std::from_chars(first, last, value, base);
+    }();
     if (ec != std::errc{} or new_last != last) {
         throw parse_error("Can not convert string to integer");
     }
@@ -100,7 +301,13 @@ template<std::floating_point T>
     auto const first = str.data();
     auto const last = first + ssize(str);
 
-    auto const[new_last, ec] = std::from_chars(first, last, value);
+    auto const[new_last, ec] = [&] {
+        if constexpr (std::same_as<T, double>) {
+            return from_chars_fast(first, last, value);
+        } else {
+            return std::from_chars(first, last, value);
+        }
+    }();
     if (ec != std::errc{} or new_last != last) {
         throw parse_error("Can not convert string to floating point");
     }
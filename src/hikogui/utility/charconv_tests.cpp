@@ -0,0 +1,106 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "charconv.hpp"
+#include <hikotest/hikotest.hpp>
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <limits>
+#include <bit>
+
+TEST_SUITE(charconv_suite) {
+
+[[nodiscard]] static bool same_as_from_chars(std::string_view str)
+{
+    auto const first = str.data();
+    auto const last = first + str.size();
+
+    auto int_value = 0LL;
+    auto int_expected = 0LL;
+    auto const int_r = hi::from_chars_fast(first, last, int_value);
+    auto const int_e = std::from_chars(first, last, int_expected);
+    if (int_r.ptr != int_e.ptr or int_r.ec != int_e.ec or (int_r.ec == std::errc{} and int_value != int_expected)) {
+        return false;
+    }
+
+    auto float_value = 0.0;
+    auto float_expected = 0.0;
+    auto const float_r = hi::from_chars_fast(first, last, float_value);
+    auto const float_e = std::from_chars(first, last, float_expected);
+    if (float_r.ptr != float_e.ptr or float_r.ec != float_e.ec) {
+        return false;
+    }
+    return float_r.ec != std::errc{} or std::bit_cast<uint64_t>(float_value) == std::bit_cast<uint64_t>(float_expected);
+}
+
+TEST_CASE(eight_digits)
+{
+    REQUIRE(hi::detail::is_eight_digits(hi::load_le<uint64_t>("12345678")));
+    REQUIRE(not hi::detail::is_eight_digits(hi::load_le<uint64_t>("1234:678")));
+    REQUIRE(not hi::detail::is_eight_digits(hi::load_le<uint64_t>("1234/678")));
+    REQUIRE(hi::detail::parse_eight_digits(hi::load_le<uint64_t>("12345678")) == 12345678);
+    REQUIRE(hi::detail::parse_eight_digits(hi::load_le<uint64_t>("99999999")) == 99999999);
+    REQUIRE(hi::detail::parse_eight_digits(hi::load_le<uint64_t>("00000001")) == 1);
+}
+
+TEST_CASE(from_chars_fast_integer)
+{
+    REQUIRE(same_as_from_chars("0"));
+    REQUIRE(same_as_from_chars("-0"));
+    REQUIRE(same_as_from_chars("-"));
+    REQUIRE(same_as_from_chars(""));
+    REQUIRE(same_as_from_chars("12345678"));
+    REQUIRE(same_as_from_chars("123456789012345678"));
+    REQUIRE(same_as_from_chars("1234567890123456789"));
+    REQUIRE(same_as_from_chars("9223372036854775807"));
+    REQUIRE(same_as_from_chars("-9223372036854775808"));
+    REQUIRE(same_as_from_chars("99999999999999999999"));
+    REQUIRE(same_as_from_chars("123456789abc"));
+}
+
+TEST_CASE(from_chars_fast_float)
+{
+    REQUIRE(same_as_from_chars("1.5"));
+    REQUIRE(same_as_from_chars("-12.345"));
+    REQUIRE(same_as_from_chars("0.1"));
+    REQUIRE(same_as_from_chars("3.14159265358979"));
+    REQUIRE(same_as_from_chars("12345678.87654321"));
+    REQUIRE(same_as_from_chars("1e5"));
+    REQUIRE(same_as_from_chars("1E-5"));
+    REQUIRE(same_as_from_chars("1e+22"));
+    REQUIRE(same_as_from_chars("1e23"));
+    REQUIRE(same_as_from_chars("9007199254740993"));
+    REQUIRE(same_as_from_chars("1."));
+    REQUIRE(same_as_from_chars(".5"));
+    REQUIRE(same_as_from_chars("1e"));
+    REQUIRE(same_as_from_chars("1e+"));
+    REQUIRE(same_as_from_chars("1.5x"));
+    REQUIRE(same_as_from_chars("00000000000000000000001"));
+}
+
+TEST_CASE(from_string)
+{
+    REQUIRE(hi::from_string<long long>("-1234567890") == -1234567890);
+    REQUIRE(hi::from_string<double>("-12.5") == -12.5);
+    REQUIRE_THROWS(hi::from_string<long long>("12a"), hi::parse_error);
+    REQUIRE_THROWS(hi::from_string<double>("1.5e"), hi::parse_error);
+}
+
+TEST_CASE(append_to_string)
+{
+    auto str = std::string{"["};
+    hi::append_to_string(str, 42);
+    str += ',';
+    hi::append_to_string(str, std::numeric_limits<long long>::min());
+    str += ',';
+    hi::append_to_string(str, 0.1);
+    str += ',';
+    hi::append_to_string(str, 1e100);
+    str += ']';
+    REQUIRE(str == "[42,-9223372036854775808,0.1,1e+100]");
+    REQUIRE(hi::to_string(-2.5) == "-2.5");
+}
+
+};
@@ -12,6 +12,7 @@
 #include <limits>
 #include <coroutine>
 #include <chrono>
+#include <cstddef>
 
 hi_export_module(hikogui.utility.concepts);
 
@@ -119,6 +120,15 @@ concept sizeable = requires(T v) {
 template<typename T>
 concept scalar = std::is_scalar_v<T>;
 
+/** A type that bytes can be written to, like `hi::file`.
+ */
+template<typename T>
+concept byte_writer = requires(T& v, void const *data, std::size_t size) {
+    {
+        v.write(data, size)
+    };
+};
+
 /** Concept for std::is_scoped_enum_v<T>.
  *
  * XXX std::is_scoped_enum_v<T> is a c++23 feature, so right now we use std::is_enum_v<T> instead.
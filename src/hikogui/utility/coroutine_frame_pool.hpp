@@ -0,0 +1,150 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../macros.hpp"
+#include <array>
+#include <new>
+#include <cstddef>
+
+hi_export_module(hikogui.utility.coroutine_frame_pool);
+
+hi_export namespace hi::inline v1 {
+namespace detail {
+
+struct coroutine_frame_pool_node {
+    coroutine_frame_pool_node *next;
+};
+
+template<std::size_t NumBuckets, std::size_t MaxFreeFrames>
+struct coroutine_frame_pool_local {
+    struct bucket_type {
+        coroutine_frame_pool_node *head = nullptr;
+        std::size_t count = 0;
+    };
+
+    std::array<bucket_type, NumBuckets> buckets = {};
+
+    ~coroutine_frame_pool_local()
+    {
+        for (auto& bucket : buckets) {
+            while (auto const node = bucket.head) {
+                bucket.head = node->next;
+                ::operator delete(node);
+            }
+            // Frames that are destroyed after the pool, by other thread-local
+            // objects, are returned directly to the global heap.
+            bucket.count = MaxFreeFrames;
+        }
+    }
+};
+
+} // namespace detail
+
+/** A thread-local pool of coroutine frames.
+ *
+ * Coroutines like `hi::generator` are created and destroyed at a high rate,
+ * for example `widget::children()` on every layout, draw and hit-test
+ * traversal. The pool recycles the frames, so that no allocation is needed
+ * in the steady state.
+ *
+ * Frames are rounded up to `granularity` and kept in a free-list for each size.
+ * Frames larger than `max_size` are allocated with the global `operator new`.
+ *
+ * A frame may be deallocated on a different thread than it was allocated on,
+ * it is then recycled by the pool of the deallocating thread. Each free-list
+ * holds at most `max_free_frames`, the rest is returned to the global heap.
+ */
+class coroutine_frame_pool {
+public:
+    constexpr static std::size_t granularity = 64;
+    constexpr static std::size_t max_size = 2048;
+    constexpr static std::size_t max_free_frames = 64;
+
+    /** Allocate memory for a coroutine frame.
+     *
+     * @param size The size of the frame in bytes.
+     * @return A pointer to the memory, aligned to `__STDCPP_DEFAULT_NEW_ALIGNMENT__`.
+     */
+    [[nodiscard]] static void *allocate(std::size_t size)
+    {
+        if (size > max_size) {
+            return ::operator new(size);
+        }
+
+        auto& bucket = _local.buckets[bucket_index(size)];
+        if (auto const node = bucket.head) {
+            bucket.head = node->next;
+            --bucket.count;
+            return node;
+        }
+        return ::operator new(bucket_size(size));
+    }
+
+    /** Deallocate memory of a coroutine frame.
+     *
+     * @param ptr The pointer returned by `allocate()`.
+     * @param size The same size that was passed to `allocate()`.
+     */
+    static void deallocate(void *ptr, std::size_t size) noexcept
+    {
+        if (size > max_size) {
+            return ::operator delete(ptr);
+        }
+
+        auto& bucket = _local.buckets[bucket_index(size)];
+        if (bucket.count >= max_free_frames) {
+            return ::operator delete(ptr);
+        }
+
+        auto const node = static_cast<node_type *>(ptr);
+        node->next = bucket.head;
+        bucket.head = node;
+        ++bucket.count;
+    }
+
+    /** The number of free frames in the pool of the current thread.
+     */
+    [[nodiscard]] static std::size_t num_free_frames() noexcept
+    {
+        auto r = std::size_t{0};
+        for (auto const& bucket : _local.buckets) {
+            r += bucket.count;
+        }
+        return r;
+    }
+
+private:
+    using node_type = detail::coroutine_frame_pool_node;
+
+    inline static thread_local detail::coroutine_frame_pool_local<max_size / granularity, max_free_frames> _local;
+
+    [[nodiscard]] constexpr static std::size_t bucket_index(std::size_t size) noexcept
+    {
+        return size == 0 ? 0 : (size - 1) / granularity;
+    }
+
+    [[nodiscard]] constexpr static std::size_t bucket_size(std::size_t size) noexcept
+    {
+        return (bucket_index(size) + 1) * granularity;
+    }
+};
+
+/** A base class for a promise_type, to allocate the coroutine frame from the `coroutine_frame_pool`.
+ */
+class coroutine_frame_pool_allocated {
+public:
+    [[nodiscard]] static void *operator new(std::size_t size)
+    {
+        return coroutine_frame_pool::allocate(size);
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept
+    {
+        coroutine_frame_pool::deallocate(ptr, size);
+    }
+};
+
+} // namespace hi::inline v1
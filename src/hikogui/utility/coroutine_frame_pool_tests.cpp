@@ -0,0 +1,58 @@
+// Copyright Take Vos 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "coroutine_frame_pool.hpp"
+#include "generator.hpp"
+#include <hikotest/hikotest.hpp>
+#include <cstddef>
+
+TEST_SUITE(coroutine_frame_pool_suite) {
+
+hi::generator<int> count_to(int n)
+{
+    for (auto i = 0; i != n; ++i) {
+        co_yield i;
+    }
+}
+
+TEST_CASE(recycle_test)
+{
+    auto const free_before = hi::coroutine_frame_pool::num_free_frames();
+
+    auto const a = hi::coroutine_frame_pool::allocate(100);
+    hi::coroutine_frame_pool::deallocate(a, 100);
+    REQUIRE(hi::coroutine_frame_pool::num_free_frames() == free_before + 1);
+
+    // A frame of a size that rounds up to the same granularity is recycled.
+    auto const b = hi::coroutine_frame_pool::allocate(120);
+    REQUIRE(b == a);
+    REQUIRE(hi::coroutine_frame_pool::num_free_frames() == free_before);
+    hi::coroutine_frame_pool::deallocate(b, 120);
+}
+
+TEST_CASE(large_test)
+{
+    auto const free_before = hi::coroutine_frame_pool::num_free_frames();
+
+    auto const size = hi::coroutine_frame_pool::max_size + 1;
+    auto const a = hi::coroutine_frame_pool::allocate(size);
+    hi::coroutine_frame_pool::deallocate(a, size);
+    REQUIRE(hi::coroutine_frame_pool::num_free_frames() == free_before);
+}
+
+TEST_CASE(generator_test)
+{
+    auto total = 0;
+    for (auto i = 0; i != 10; ++i) {
+        for (auto x : count_to(5)) {
+            total += x;
+        }
+    }
+    REQUIRE(total == 100);
+
+    // The frame of the generator is returned to the pool.
+    REQUIRE(hi::coroutine_frame_pool::num_free_frames() >= 1);
+}
+
+};
@@ -0,0 +1,27 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../macros.hpp"
+#include "exception_intf.hpp"
+#include <string>
+#include <system_error>
+#include <cerrno>
+
+hi_export_module(hikogui.utility.exception : impl);
+
+hi_export namespace hi { inline namespace v1 {
+
+hi_export [[nodiscard]] inline std::string get_last_error_message(uint32_t error_code)
+{
+    return std::system_category().message(static_cast<int>(error_code));
+}
+
+hi_export [[nodiscard]] inline std::string get_last_error_message()
+{
+    return std::system_category().message(errno);
+}
+
+}} // namespace hi::v1
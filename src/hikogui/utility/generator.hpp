@@ -12,6 +12,7 @@
 #include <type_traits>
 #include "../macros.hpp"
 #include "debugger.hpp"
+#include "coroutine_frame_pool.hpp"
 
 hi_export_module(hikogui.utility.generator);
 
@@ -35,7 +36,7 @@ public:
     static_assert(not std::is_reference_v<value_type>);
     static_assert(not std::is_const_v<value_type>);
 
-    class promise_type {
+    class promise_type : public coroutine_frame_pool_allocated {
     public:
         generator get_return_object()
         {
@@ -233,7 +234,7 @@ class generator<T&> {
 public:
     using value_type = T&;
 
-    class promise_type {
+    class promise_type : public coroutine_frame_pool_allocated {
     public:
         generator get_return_object()
         {
@@ -668,6 +668,9 @@ using variant_decay_t = variant_decay<T>::type;
  * The prototype of the `get()` function are as follows:
  *  - `template<fixed_string> auto &get(T &) const noexcept`
  *
+ * The specialization may also list the names of the members as `using names = member_names<...>`,
+ * which allows the type to be serialized as an object, see `codec/serialize.hpp`.
+ *
  * Here is an example how to specialize `hi::selector` for the `my::simple` type:
  *
  * ```cpp
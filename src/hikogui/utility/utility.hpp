@@ -16,6 +16,7 @@
 #if HI_OPERATING_SYSTEM == HI_OS_WINDOWS
 #include "console_win32.hpp" // export
 #endif
+#include "coroutine_frame_pool.hpp" // export
 #include "debugger.hpp" // export
 #include "defer.hpp" // export
 #include "device_type.hpp" // export
@@ -87,9 +87,9 @@ public:
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
-        _on_label_constraints = _on_label_widget->update_constraints();
-        _off_label_constraints = _off_label_widget->update_constraints();
-        _other_label_constraints = _other_label_widget->update_constraints();
+        _on_label_constraints = _on_label_widget->constraints();
+        _off_label_constraints = _off_label_widget->constraints();
+        _other_label_constraints = _other_label_widget->constraints();
         return max(_on_label_constraints, _off_label_constraints, _other_label_constraints);
     }
 
@@ -99,9 +99,9 @@ public:
         _off_label_widget->set_mode(value() == widget_value::off ? widget_mode::display : widget_mode::invisible);
         _other_label_widget->set_mode(value() == widget_value::other ? widget_mode::display : widget_mode::invisible);
 
-        _on_label_widget->set_layout(context.transform(_on_label_shape));
-        _off_label_widget->set_layout(context.transform(_off_label_shape));
-        _other_label_widget->set_layout(context.transform(_other_label_shape));
+        _on_label_widget->update_layout(context.transform(_on_label_shape));
+        _off_label_widget->update_layout(context.transform(_off_label_shape));
+        _other_label_widget->update_layout(context.transform(_other_label_shape));
     }
 
     [[nodiscard]] generator<widget_intf&> children(bool include_invisible) noexcept override
@@ -111,6 +111,13 @@ public:
         co_yield *_other_label_widget;
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        func(*_on_label_widget);
+        func(*_off_label_widget);
+        func(*_other_label_widget);
+    }
+
     [[nodiscard]] color background_color() const noexcept override
     {
         hi_axiom(loop::main().on_thread());
@@ -16,6 +16,7 @@
 #include "../macros.hpp"
 #include <type_traits>
 #include <memory>
+#include <functional>
 
 hi_export_module(hikogui.widgets.async_delegate);
 
@@ -51,6 +52,15 @@ public:
         return widget_value::off;
     }
 
+    /** Used by the widget to show the progress of the function.
+     *
+     * @return The progress between 0.0 and 1.0.
+     */
+    [[nodiscard]] virtual float progress(widget_intf const& sender) const noexcept
+    {
+        return 0.0f;
+    }
+
     /** Subscribe a callback for notifying the widget of a data change.
      */
     template<forward_of<void()> Func>
@@ -65,8 +75,9 @@ protected:
 
 /** A default async button delegate.
  *
- * The default async button delegate manages the state of a button widget using
- * observer values.
+ * The default async button delegate runs the function with an `async_loader`,
+ * so that the widget is notified from the main loop, with progress updates
+ * at most once per frame.
  *
  * @ingroup widget_delegates
  * @tparam Traits The traits of the arguments passed to the constructor.
@@ -87,9 +98,12 @@ public:
      */
     template<typename Func, typename... Args>
     default_async_delegate(Func&& func, Args&&... args) noexcept :
-        _task_controller(std::forward<Func>(func), std::forward<Args>(args)...)
+        _features(cancel_features_v<std::decay_t<Func>, std::decay_t<Args>...>),
+        _load([func = std::forward<Func>(func), ... args = std::forward<Args>(args)](async_loader<result_type>& loader) {
+            loader.load(func, args...);
+        })
     {
-        _task_controller_cbt = _task_controller.subscribe([this] {
+        _loader_cbt = _loader.subscribe([this] {
             this->_notifier();
         });
     }
@@ -97,10 +111,7 @@ public:
     /// @privatesection
     [[nodiscard]] widget_value state(widget_intf const& sender) const noexcept override
     {
-        if (not _task_controller.runnable()) {
-            return widget_value::other;
-
-        } else if (_task_controller.running()) {
+        if (_loader.loading()) {
             return widget_value::on;
 
         } else {
@@ -110,27 +121,29 @@ public:
 
     [[nodiscard]] cancel_features_type features() const noexcept override
     {
-        return _task_controller.features();
+        return _features;
     }
 
-    void activate(widget_intf const& sender) noexcept override
+    [[nodiscard]] float progress(widget_intf const& sender) const noexcept override
     {
-        if (not _task_controller.runnable()) {
-            return;
+        return _loader.progress();
+    }
 
-        } else if (not _task_controller.running()) {
-            _task_controller.run();
+    void activate(widget_intf const& sender) noexcept override
+    {
+        if (not _loader.loading()) {
+            _load(_loader);
 
-        } else if (
-            _task_controller.features() == cancel_features_type::stop or
-            _task_controller.features() == cancel_features_type::stop_and_progress) {
-            _task_controller.request_stop();
+        } else if (_features == cancel_features_type::stop or _features == cancel_features_type::stop_and_progress) {
+            _loader.cancel();
         }
     }
     /// @endprivatesection
 private:
-    task_controller<result_type> _task_controller;
-    task_controller<result_type>::callback_type _task_controller_cbt;
+    cancel_features_type _features;
+    std::function<void(async_loader<result_type>&)> _load;
+    async_loader<result_type> _loader;
+    async_loader<result_type>::callback_type _loader_cbt;
 };
 
 template<typename FuncType, typename... ArgTypes>
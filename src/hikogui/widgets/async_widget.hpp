@@ -143,6 +143,8 @@ public:
     }
 
     /// @privatesection
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override {}
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _button_size = {theme().size(), theme().size()};
@@ -51,16 +51,38 @@ public:
         _sync_device_list_task = sync_device_list();
     }
 
+    /** The timing statistics of the selected audio device.
+     *
+     * This can be used to show callback load, xruns and latency to the user,
+     * for example to help choose a buffer size.
+     *
+     * @return The statistics, or empty when the selected device is not available.
+     */
+    [[nodiscard]] std::optional<audio_stream_statistics::snapshot_type> statistics() const noexcept
+    {
+        for (auto& device : audio_devices(hi::audio_device_state::active, *direction)) {
+            if (device.id() == *device_id) {
+                return device.statistics();
+            }
+        }
+        return std::nullopt;
+    }
+
     /// @privatesection
     [[nodiscard]] generator<widget_intf&> children(bool include_invisible) noexcept override
     {
         co_yield *_grid_widget;
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        func(*_grid_widget);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
-        _grid_constraints = _grid_widget->update_constraints();
+        _grid_constraints = _grid_widget->constraints();
         return _grid_constraints;
     }
 
@@ -71,7 +93,7 @@ public:
             _grid_shape = {_grid_constraints, grid_rectangle, theme().baseline_adjustment()};
         }
 
-        _grid_widget->set_layout(context.transform(_grid_shape, transform_command::level));
+        _grid_widget->update_layout(context.transform(_grid_shape, transform_command::level));
     }
 
     void draw(draw_context const& context) noexcept override
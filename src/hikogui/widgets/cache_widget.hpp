@@ -0,0 +1,160 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file widgets/cache_widget.hpp Defines cache_widget.
+ * @ingroup widgets
+ */
+
+#pragma once
+
+#include "widget.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <coroutine>
+
+hi_export_module(hikogui.widgets.cache_widget);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A GUI widget that retains the drawing of its content between frames.
+ * @ingroup widgets
+ *
+ * The content is drawn once, after that the recorded vertices are replayed
+ * each frame until the content requests a redraw, relayout or reconstrain.
+ * This is useful for content that is expensive to draw but rarely changes,
+ * like charts and large static panels.
+ *
+ * When the cache widget is fully visible and is moved by a whole number of
+ * pixels, for example by scrolling, the recorded vertices are moved instead
+ * of drawing the content again.
+ *
+ * The content should not draw outside of its own rectangle, like the pull-down
+ * menu of a selection widget does.
+ */
+class cache_widget : public widget {
+public:
+    using super = widget;
+
+    ~cache_widget() {}
+
+    /** Constructs an empty cache widget.
+     */
+    cache_widget() noexcept : super() {}
+
+    void set_widget(std::unique_ptr<widget> new_widget) noexcept
+    {
+        if (new_widget) {
+            new_widget->set_parent(this);
+        }
+        auto old_widget = std::exchange(_content, std::move(new_widget));
+        if (old_widget) {
+            old_widget->set_parent(nullptr);
+        }
+
+        ++global_counter<"cache_widget:set_widget:constrain">;
+        process_event({gui_event_type::window_reconstrain});
+    }
+
+    /** Add a content widget directly to this cache widget.
+     *
+     * @pre No content widgets have been added before.
+     * @tparam Widget The type of the widget to be constructed.
+     * @param args The arguments passed to the constructor of the widget.
+     * @return A reference to the widget that was created.
+     */
+    template<typename Widget, typename... Args>
+    Widget& emplace(Args&&... args) noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+        hi_assert(_content == nullptr);
+
+        auto tmp = std::make_unique<Widget>(std::forward<Args>(args)...);
+        auto& ref = *tmp;
+        set_widget(std::move(tmp));
+        return ref;
+    }
+
+    /// @privatesection
+    [[nodiscard]] generator<widget_intf&> children(bool include_invisible) noexcept override
+    {
+        if (_content) {
+            co_yield *_content;
+        }
+    }
+
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        if (_content) {
+            func(*_content);
+        }
+    }
+
+    [[nodiscard]] box_constraints update_constraints() noexcept override
+    {
+        hi_assert_not_null(_content);
+
+        _layout = {};
+        _draw_cache.invalidate();
+        _content_constraints = _content->constraints();
+        return _content_constraints;
+    }
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        hi_assert_not_null(_content);
+
+        if (_layout.shape != context.shape or _layout.elevation != context.elevation or _layout.layer != context.layer or
+            _layout.sub_pixel_size != context.sub_pixel_size) {
+            // The content will be drawn differently, not only at another position on the window.
+            _draw_cache.invalidate();
+        }
+
+        _layout = context;
+        _content_shape = box_shape{_content_constraints, context.rectangle(), theme().baseline_adjustment()};
+        _content->update_layout(context.transform(_content_shape, transform_command::level));
+    }
+
+    void draw(draw_context const& context) noexcept override
+    {
+        if (mode() > widget_mode::invisible and overlaps(context, layout())) {
+            // The content is not clipped by the parents when the clipping rectangle is the default from
+            // widget_layout::transform(), in that case the recorded vertices may be moved.
+            auto const unclipped = layout().clipping_rectangle == layout().rectangle() + widget_layout::redraw_overhang;
+
+            _draw_cache.draw(context, layout().clipping_rectangle_on_window(), unclipped, [&](draw_context const& sub_context) {
+                _content->draw(sub_context);
+            });
+        }
+    }
+
+    bool process_event(gui_event const& event) const noexcept override
+    {
+        if (event == gui_event_type::window_redraw or event == gui_event_type::window_relayout or
+            event == gui_event_type::window_reconstrain) {
+            // The content has changed.
+            _draw_cache.invalidate();
+        }
+        return super::process_event(event);
+    }
+
+    [[nodiscard]] hitbox hitbox_test(point2 position) const noexcept override
+    {
+        hi_axiom(loop::main().on_thread());
+
+        if (mode() >= widget_mode::partial) {
+            return _content->hitbox_test_from_parent(position);
+        } else {
+            return {};
+        }
+    }
+    /// @endprivatesection
+private:
+    std::unique_ptr<widget> _content;
+    box_constraints _content_constraints;
+    box_shape _content_shape;
+
+    mutable draw_context_cache _draw_cache;
+};
+
+}} // namespace hi::v1
@@ -44,6 +44,36 @@ class grid_widget : public widget {
 public:
     using super = widget;
 
+    /** Draw the cells of the grid in parallel.
+     *
+     * This is useful for grids with a large number of cells, where the cells
+     * are independent of each other. Only enable this when the draw() of each
+     * of the cells is thread-safe, for example label- and icon-widgets.
+     */
+    bool parallel_draw = false;
+
+    /** The minimum number of cells before drawing in parallel.
+     */
+    constexpr static std::size_t parallel_draw_threshold = 64;
+
+    /** Retain the vertices of the cells between frames.
+     *
+     * When none of the cells have requested a redraw, relayout or reconstrain
+     * the vertices of the previous frame are reused. This is useful for large
+     * mostly static panels, which are redrawn because a part of the window
+     * that overlaps with them has changed.
+     */
+    bool retain_draw = false;
+
+    /** Only draw and hit-test the cells that overlap the visible area or the mouse.
+     *
+     * This is useful for large grids inside a scroll widget, where only a
+     * small part of the grid is visible. Do not enable this when a cell's widget
+     * shows an overlay outside of the cell, like the pull-down menu of a
+     * selection widget, as it will not be drawn when the cell is out of view.
+     */
+    bool cull_cells = false;
+
     ~grid_widget() {}
 
     /** Constructs an empty grid widget.
@@ -277,7 +307,16 @@ public:
      */
     void clear() noexcept
     {
+        hi_axiom(loop::main().on_thread());
+
         _grid.clear();
+
+        // The spatial index refers to cells by index, which are now gone.
+        _cell_index.clear();
+        _cell_index_valid = false;
+
+        ++global_counter<"grid_widget:clear:constrain">;
+        process_event({gui_event_type::window_reconstrain});
     }
 
     /// @privatesection
@@ -288,12 +327,19 @@ public:
         }
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        for (auto const& cell : _grid) {
+            func(*cell.value);
+        }
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
 
         for (auto& cell : _grid) {
-            cell.set_constraints(cell.value->update_constraints());
+            cell.set_constraints(cell.value->constraints());
         }
 
         return _grid.constraints(os_settings::left_to_right());
@@ -301,32 +347,69 @@ public:
 
     void set_layout(widget_layout const& context) noexcept override
     {
+        // The display time point changes every frame, a relayout of a cell
+        // invalidates the cache through `process_event()`.
+        if (not _layout.same_placement(context)) {
+            _draw_cache.invalidate();
+        }
+
         if (compare_store(_layout, context)) {
             _grid.set_layout(context.shape, theme().baseline_adjustment());
+            _cell_index_valid = false;
+        }
+
+        if (cull_cells and not _cell_index_valid) {
+            _cell_index.clear();
+            _cell_index.reserve(_grid.size());
+            for (auto i = 0_uz; i != _grid.size(); ++i) {
+                _cell_index.add(_grid[i].shape.rectangle + widget_layout::redraw_overhang, i);
+            }
+            _cell_index.sort();
+            _cell_index_valid = true;
         }
 
         for (auto const& cell : _grid) {
-            cell.value->set_layout(context.transform(cell.shape, transform_command::level));
+            cell.value->update_layout(context.transform(cell.shape, transform_command::level));
         }
     }
 
     void draw(draw_context const& context) noexcept override
     {
         if (mode() > widget_mode::invisible) {
-            for (auto const& cell : _grid) {
-                cell.value->draw(context);
+            if (retain_draw) {
+                _draw_cache.draw(context, layout().clipping_rectangle_on_window(), [&](draw_context const& sub_context) {
+                    draw_cells(sub_context);
+                });
+            } else {
+                draw_cells(context);
             }
         }
     }
 
+    bool process_event(gui_event const& event) const noexcept override
+    {
+        if (event == gui_event_type::window_redraw or event == gui_event_type::window_relayout or
+            event == gui_event_type::window_reconstrain) {
+            // One of the cells has changed.
+            _draw_cache.invalidate();
+        }
+        return super::process_event(event);
+    }
+
     [[nodiscard]] hitbox hitbox_test(point2 position) const noexcept override
     {
         hi_axiom(loop::main().on_thread());
 
         if (mode() >= widget_mode::partial) {
             auto r = hitbox{};
-            for (auto const& cell : _grid) {
-                r = cell.value->hitbox_test_from_parent(position, r);
+            if (cull_cells) {
+                _cell_index.find(position, [&](std::size_t i) {
+                    r = _grid[i].value->hitbox_test_from_parent(position, r);
+                });
+            } else {
+                for (auto const& cell : _grid) {
+                    r = cell.value->hitbox_test_from_parent(position, r);
+                }
             }
             return r;
         } else {
@@ -336,6 +419,62 @@ public:
     /// @endprivatesection
 private:
     grid_layout<std::unique_ptr<widget>> _grid;
+
+    /** Vertex storage for drawing the cells in parallel, reused between frames.
+     */
+    std::vector<std::unique_ptr<draw_context_buffers>> _draw_buffers;
+
+    mutable draw_context_cache _draw_cache;
+
+    /** The rectangles of the cells, used when culling.
+     */
+    spatial_index _cell_index;
+    bool _cell_index_valid = false;
+
+    /** The cells that are visible in the current frame, reused between frames.
+     */
+    std::vector<widget *> _visible_cells;
+
+    void draw_cells(draw_context const& context) noexcept
+    {
+        if (cull_cells) {
+            // The retained vertices are reused for partial redraws, so only
+            // cull against the scissor rectangle when not retaining.
+            auto area = layout().clipping_rectangle;
+            if (not retain_draw) {
+                area = intersect(area, layout().from_window * context.scissor_rectangle);
+            }
+
+            _visible_cells.clear();
+            _cell_index.find(area, [&](std::size_t i) {
+                _visible_cells.push_back(_grid[i].value.get());
+            });
+            ++global_counter<"grid_widget:draw:cull">;
+
+            if (parallel_draw and _visible_cells.size() >= parallel_draw_threshold) {
+                ++global_counter<"grid_widget:draw:parallel">;
+                context.draw_parallel(_draw_buffers, _visible_cells, [](draw_context const& sub_context, widget *cell) {
+                    cell->draw(sub_context);
+                });
+
+            } else {
+                for (auto *cell : _visible_cells) {
+                    cell->draw(context);
+                }
+            }
+
+        } else if (parallel_draw and _grid.size() >= parallel_draw_threshold) {
+            ++global_counter<"grid_widget:draw:parallel">;
+            context.draw_parallel(_draw_buffers, _grid, [](draw_context const& sub_context, auto const& cell) {
+                cell.value->draw(sub_context);
+            });
+
+        } else {
+            for (auto const& cell : _grid) {
+                cell.value->draw(context);
+            }
+        }
+    }
 };
 
 }} // namespace hi::v1
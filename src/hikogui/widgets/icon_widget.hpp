@@ -73,6 +73,8 @@ public:
     }
 
     /// @privatesection
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override {}
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
@@ -157,7 +159,13 @@ public:
                 break;
 
             case icon_type::pixmap:
-                if (not context.draw_image(layout(), _icon_rectangle, _pixmap_backing)) {
+                if (_pixmap_backing.device != context.device) {
+                    // The window was moved to another device, upload the image to that device.
+                    _icon_has_modified = true;
+                    ++global_counter<"icon_widget:device-changed:constrain">;
+                    process_event({gui_event_type::window_reconstrain});
+
+                } else if (not context.draw_image(layout(), _icon_rectangle, _pixmap_backing)) {
                     // Continue redrawing until the image is loaded.
                     request_redraw();
                 }
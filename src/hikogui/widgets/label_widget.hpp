@@ -94,6 +94,12 @@ public:
         co_yield *_text_widget;
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        func(*_icon_widget);
+        func(*_text_widget);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
@@ -143,7 +149,7 @@ public:
         _icon_widget->maximum = extent2{icon_size, icon_size};
 
         for (auto& cell : _grid) {
-            cell.set_constraints(cell.value->update_constraints());
+            cell.set_constraints(cell.value->constraints());
         }
 
         return _grid.constraints(os_settings::left_to_right());
@@ -155,7 +161,7 @@ public:
         }
 
         for (auto const& cell : _grid) {
-            cell.value->set_layout(context.transform(cell.shape, transform_command::level));
+            cell.value->update_layout(context.transform(cell.shape, transform_command::level));
         }
     }
     
@@ -0,0 +1,127 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file widgets/list_view_delegate.hpp Defines list_view_delegate and a default list-view delegate.
+ * @ingroup widget_delegates
+ */
+
+#pragma once
+
+#include "widget.hpp"
+#include "label_widget.hpp"
+#include "../l10n/l10n.hpp"
+#include "../observer/observer.hpp"
+#include "../utility/utility.hpp"
+#include "../dispatch/dispatch.hpp"
+#include "../GUI/GUI.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+hi_export_module(hikogui.widgets.list_view_delegate);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A delegate that supplies the rows of a list_view_widget.
+ *
+ * The list-view only creates widgets for the rows that are visible. These row
+ * widgets are recycled: when a row scrolls out of view its widget is bound to
+ * a row that scrolls into view.
+ *
+ * @ingroup widget_delegates
+ */
+class list_view_delegate {
+public:
+    virtual ~list_view_delegate() = default;
+
+    virtual void init(widget_intf const& sender) noexcept {}
+    virtual void deinit(widget_intf const& sender) noexcept {}
+
+    /** The number of rows.
+     */
+    [[nodiscard]] virtual std::size_t size(widget_intf const& sender) const noexcept
+    {
+        return 0;
+    }
+
+    [[nodiscard]] bool empty(widget_intf const& sender) const noexcept
+    {
+        return size(sender) == 0;
+    }
+
+    /** Create a new widget to show a row.
+     *
+     * For a table, the row widget contains a widget for each column.
+     *
+     * @param sender The list-view widget that uses this delegate.
+     * @return A new widget, which will be bound to rows with `bind_row_widget()`.
+     */
+    [[nodiscard]] virtual std::unique_ptr<widget> make_row_widget(widget_intf const& sender) noexcept = 0;
+
+    /** Show a row in a row widget.
+     *
+     * This is called each time a row widget is recycled to show another row.
+     *
+     * @param sender The list-view widget that uses this delegate.
+     * @param row_widget A widget that was created by `make_row_widget()`.
+     * @param index The index of the row to show.
+     */
+    virtual void bind_row_widget(widget_intf const& sender, widget& row_widget, std::size_t index) noexcept = 0;
+
+    /** Subscribe a callback for notifying the widget of a change in the rows.
+     */
+    template<forward_of<void()> Func>
+    [[nodiscard]] callback<void()> subscribe(Func&& func, callback_flags flags = callback_flags::synchronous) noexcept
+    {
+        return _notifier.subscribe(std::forward<Func>(func), flags);
+    }
+
+protected:
+    notifier<void()> _notifier;
+};
+
+/** A delegate that shows a list of labels.
+ *
+ * @ingroup widget_delegates
+ */
+class default_list_view_delegate : public list_view_delegate {
+public:
+    using rows_type = std::vector<label>;
+
+    observer<rows_type> rows;
+
+    /** Construct a default list-view delegate.
+     *
+     * @param rows An observer std::vector<label> with a label for each row.
+     */
+    template<forward_of<observer<rows_type>> Rows>
+    explicit default_list_view_delegate(Rows&& rows) noexcept : rows(std::forward<Rows>(rows))
+    {
+        // clang-format off
+        _rows_cbt = this->rows.subscribe([&](auto...){ this->_notifier(); });
+        // clang-format on
+    }
+
+    [[nodiscard]] std::size_t size(widget_intf const& sender) const noexcept override
+    {
+        return rows->size();
+    }
+
+    [[nodiscard]] std::unique_ptr<widget> make_row_widget(widget_intf const& sender) noexcept override
+    {
+        return std::make_unique<label_widget>(alignment::middle_left());
+    }
+
+    void bind_row_widget(widget_intf const& sender, widget& row_widget, std::size_t index) noexcept override
+    {
+        hi_axiom(index < rows->size());
+        static_cast<label_widget&>(row_widget).label = rows->at(index);
+    }
+
+private:
+    callback<void(rows_type)> _rows_cbt;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,298 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file widgets/list_view_widget.hpp Defines list_view_widget.
+ * @ingroup widgets
+ */
+
+#pragma once
+
+#include "widget.hpp"
+#include "list_view_delegate.hpp"
+#include "../layout/layout.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <coroutine>
+
+hi_export_module(hikogui.widgets.list_view_widget);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A widget that shows a long list of rows.
+ *
+ * Only the rows that are visible in the clipping rectangle get a widget.
+ * A small pool of row widgets is created by the delegate and recycled
+ * when the list is scrolled, so a list with 100'000 rows costs about as
+ * much to constrain, lay out and draw as a list with the number of rows that
+ * fit in the window.
+ *
+ * All rows have the same height: the largest preferred height of the row
+ * widgets that have been bound so far. This allows the total height of the
+ * list to be calculated without laying out each row.
+ *
+ * The list-view is normally the content of a `vertical_scroll_widget`:
+ * @code
+ * auto& scroll = grid.emplace<vertical_scroll_widget>("A1");
+ * scroll.emplace<list_view_widget>(log_lines);
+ * @endcode
+ *
+ * @ingroup widgets
+ */
+class list_view_widget : public widget {
+public:
+    using super = widget;
+    using delegate_type = list_view_delegate;
+
+    std::shared_ptr<delegate_type> delegate;
+
+    /** The number of rows above and below the visible rows that also get a widget.
+     *
+     * This reduces the number of rows that are bound for each step
+     * when scrolling.
+     */
+    std::size_t overscan = 2;
+
+    ~list_view_widget()
+    {
+        delegate->deinit(*this);
+    }
+
+    /** Construct a list-view widget with a delegate.
+     *
+     * @param delegate The delegate which supplies the rows.
+     */
+    explicit list_view_widget(std::shared_ptr<delegate_type> delegate) noexcept : super(), delegate(std::move(delegate))
+    {
+        hi_axiom(loop::main().on_thread());
+        hi_axiom_not_null(this->delegate);
+
+        _delegate_cbt = this->delegate->subscribe(
+            [&] {
+                // The rows may have changed, so each row widget needs to be bound again.
+                for (auto& slot : _slots) {
+                    slot.index = unbound;
+                }
+                ++global_counter<"list_view_widget:delegate:constrain">;
+                process_event({gui_event_type::window_reconstrain});
+            },
+            callback_flags::main);
+
+        this->delegate->init(*this);
+    }
+
+    /** Construct a list-view widget that shows a list of labels.
+     *
+     * @param rows A vector or an observer vector of labels, one for each row.
+     */
+    template<forward_of<observer<std::vector<label>>> Rows>
+    explicit list_view_widget(Rows&& rows) noexcept :
+        list_view_widget(std::make_shared<default_list_view_delegate>(std::forward<Rows>(rows)))
+    {
+    }
+
+    /** The index of the first row that has a widget, and one beyond the last.
+     */
+    [[nodiscard]] std::pair<std::size_t, std::size_t> bound_rows() const noexcept
+    {
+        return {_first, _last};
+    }
+
+    /// @privatesection
+    [[nodiscard]] generator<widget_intf&> children(bool include_invisible) noexcept override
+    {
+        for (auto const& slot : _slots) {
+            if (include_invisible or slot.index != unbound) {
+                co_yield *slot.widget;
+            }
+        }
+    }
+
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        for (auto const& slot : _slots) {
+            if (include_invisible or slot.index != unbound) {
+                func(*slot.widget);
+            }
+        }
+    }
+
+    [[nodiscard]] box_constraints update_constraints() noexcept override
+    {
+        _layout = {};
+
+        auto const size = delegate->size(*this);
+
+        // Keep the rows that were visible, and bind at least one row to measure.
+        auto last = std::min(_last, size);
+        auto first = std::min(_first, last);
+        if (first == last and size != 0) {
+            first = last == 0 ? 0 : last - 1;
+            last = first + 1;
+        }
+        std::ignore = bind_rows(first, last);
+
+        _row_constraints = {};
+        for (auto& slot : _slots) {
+            if (slot.index != unbound) {
+                slot.constraints = slot.widget->constraints();
+                _row_constraints = max(_row_constraints, slot.constraints);
+            }
+        }
+
+        auto const spacing = std::max(_row_constraints.margins.top(), _row_constraints.margins.bottom());
+        _list = virtual_list_layout{size, std::max(_row_constraints.preferred.height(), 1.0f), spacing};
+
+        auto const height = _list.height();
+        return {
+            extent2{_row_constraints.minimum.width(), height},
+            extent2{_row_constraints.preferred.width(), height},
+            extent2{_row_constraints.maximum.width(), height},
+            _row_constraints.alignment,
+            _row_constraints.margins};
+    }
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        if (compare_store(_layout, context)) {
+            // The rows are laid out from the top of the widget.
+            auto const top = context.height() - context.clipping_rectangle.top();
+            auto const bottom = context.height() - context.clipping_rectangle.bottom();
+            auto const [first, last] = _list.visible_rows(top, bottom);
+
+            if (bind_rows(first > overscan ? first - overscan : 0, std::min(last + overscan, _list.size()))) {
+                // A row that scrolled into view needs more room than the other rows.
+                ++global_counter<"list_view_widget:bind_rows:constrain">;
+                process_event({gui_event_type::window_reconstrain});
+            }
+        }
+
+        for (auto const& slot : _slots) {
+            if (slot.index != unbound) {
+                auto const y = context.height() - _list.row_top(slot.index) - _list.row_height();
+                auto const rectangle = aarectangle{0.0f, y, context.width(), _list.row_height()};
+
+                // A newly bound row may be larger than the current constraints,
+                // until the reconstrain requested above.
+                auto const shape = box_shape{std::in_place, slot.constraints, rectangle, theme().baseline_adjustment()};
+                slot.widget->update_layout(context.transform(shape, transform_command::level));
+            }
+        }
+    }
+
+    void draw(draw_context const& context) noexcept override
+    {
+        if (mode() > widget_mode::invisible) {
+            for (auto const& slot : _slots) {
+                if (slot.index != unbound) {
+                    slot.widget->draw(context);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] hitbox hitbox_test(point2 position) const noexcept override
+    {
+        hi_axiom(loop::main().on_thread());
+
+        if (mode() >= widget_mode::partial) {
+            auto r = hitbox{};
+            for (auto const& slot : _slots) {
+                if (slot.index != unbound) {
+                    r = slot.widget->hitbox_test_from_parent(position, r);
+                }
+            }
+            return r;
+        } else {
+            return {};
+        }
+    }
+    /// @endprivatesection
+private:
+    constexpr static std::size_t unbound = std::numeric_limits<std::size_t>::max();
+
+    struct slot_type {
+        std::unique_ptr<widget> widget;
+
+        /** The index of the row shown by the widget, or `unbound`.
+         */
+        std::size_t index = unbound;
+
+        box_constraints constraints;
+    };
+
+    /** The pool of row widgets.
+     */
+    std::vector<slot_type> _slots;
+
+    /** The combined constraints of the bound rows.
+     */
+    box_constraints _row_constraints;
+
+    virtual_list_layout _list;
+
+    std::size_t _first = 0;
+    std::size_t _last = 0;
+
+    callback<void()> _delegate_cbt;
+
+    /** Bind the rows to widgets from the pool.
+     *
+     * Rows that already have a widget keep it; widgets of rows outside
+     * the range are recycled for the new rows.
+     *
+     * @param first The index of the first row.
+     * @param last One beyond the index of the last row.
+     * @return True if a newly bound row does not fit the current row constraints.
+     */
+    [[nodiscard]] bool bind_rows(std::size_t first, std::size_t last) noexcept
+    {
+        hi_axiom(first <= last);
+
+        auto has_widget = std::vector<bool>(last - first, false);
+        for (auto& slot : _slots) {
+            if (slot.index < first or slot.index >= last) {
+                slot.index = unbound;
+            } else {
+                has_widget[slot.index - first] = true;
+            }
+        }
+
+        auto r = false;
+        auto free_index = 0_uz;
+        for (auto i = first; i != last; ++i) {
+            if (has_widget[i - first]) {
+                continue;
+            }
+
+            while (free_index != _slots.size() and _slots[free_index].index != unbound) {
+                ++free_index;
+            }
+            if (free_index == _slots.size()) {
+                auto& new_slot = _slots.emplace_back();
+                new_slot.widget = delegate->make_row_widget(*this);
+                new_slot.widget->set_parent(this);
+            }
+
+            auto& slot = _slots[free_index];
+            slot.index = i;
+            delegate->bind_row_widget(*this, *slot.widget, i);
+
+            // The widget shows a different row, so it is always constrained again.
+            slot.constraints = slot.widget->update_constraints();
+
+            r |= slot.constraints.preferred.height() > _list.row_height() or
+                slot.constraints.minimum.width() > _row_constraints.minimum.width();
+        }
+
+        _first = first;
+        _last = last;
+        return r;
+    }
+};
+
+}} // namespace hi::v1
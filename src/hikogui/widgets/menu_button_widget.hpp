@@ -162,17 +162,17 @@ public:
 
         for (auto& cell : _grid) {
             if (cell.value == grid_cell_type::button) {
-                auto constraints = _button_widget->update_constraints();
+                auto constraints = _button_widget->constraints();
                 inplace_max(constraints.minimum.width(), theme().size() * 2.0f);
                 inplace_max(constraints.preferred.width(), theme().size() * 2.0f);
                 inplace_max(constraints.maximum.width(), theme().size() * 2.0f);
                 cell.set_constraints(constraints);
 
             } else if (cell.value == grid_cell_type::label) {
-                cell.set_constraints(_label_widget->update_constraints());
+                cell.set_constraints(_label_widget->constraints());
 
             } else if (cell.value == grid_cell_type::shortcut) {
-                auto constraints = _shortcut_widget->update_constraints();
+                auto constraints = _shortcut_widget->constraints();
                 inplace_max(constraints.minimum.width(), theme().size() * 3.0f);
                 inplace_max(constraints.preferred.width(), theme().size() * 3.0f);
                 inplace_max(constraints.maximum.width(), theme().size() * 3.0f);
@@ -201,13 +201,13 @@ public:
 
         for (auto const& cell : _grid) {
             if (cell.value == grid_cell_type::button) {
-                _button_widget->set_layout(context.transform(cell.shape, transform_command::level));
+                _button_widget->update_layout(context.transform(cell.shape, transform_command::level));
 
             } else if (cell.value == grid_cell_type::label) {
-                _label_widget->set_layout(context.transform(cell.shape));
+                _label_widget->update_layout(context.transform(cell.shape));
 
             } else if (cell.value == grid_cell_type::shortcut) {
-                _shortcut_widget->set_layout(context.transform(cell.shape));
+                _shortcut_widget->update_layout(context.transform(cell.shape));
 
             } else {
                 hi_no_default();
@@ -246,6 +246,13 @@ public:
         co_yield *_shortcut_widget;
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        func(*_button_widget);
+        func(*_label_widget);
+        func(*_shortcut_widget);
+    }
+
     [[nodiscard]] hitbox hitbox_test(point2 position) const noexcept override
     {
         hi_axiom(loop::main().on_thread());
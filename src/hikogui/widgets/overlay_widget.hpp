@@ -95,10 +95,17 @@ public:
         }
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        if (_content) {
+            func(*_content);
+        }
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
-        _content_constraints = _content->update_constraints();
+        _content_constraints = _content->constraints();
         return _content_constraints;
     }
 
@@ -113,7 +120,7 @@ public:
         _content_shape = box_shape{_content_constraints, content_rectangle, theme().baseline_adjustment()};
 
         // The content should not draw in the border of the overlay, so give a tight clipping rectangle.
-        _content->set_layout(_layout.transform(_content_shape, context.rectangle()));
+        _content->update_layout(_layout.transform(_content_shape, context.rectangle()));
     }
 
     void draw(draw_context const& context) noexcept override
@@ -126,6 +133,16 @@ public:
         }
     }
 
+    void add_occluders(draw_context const& context) const noexcept override
+    {
+        if (mode() > widget_mode::invisible) {
+            if (static_cast<float>(background_color().a()) >= 1.0f) {
+                context.add_occluder(layout(), layout().rectangle());
+            }
+            _content->add_occluders(context);
+        }
+    }
+
     [[nodiscard]] color background_color() const noexcept override
     {
         return theme().fill_color(_layout.layer + 1);
@@ -40,27 +40,27 @@ public:
 
         _content_width_cbt = content_width.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:content_width:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _content_height_cbt = content_height.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:content_height:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _aperture_width_cbt = aperture_width.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:aperture_width:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _aperture_height_cbt = aperture_height.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:aperture_height:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _offset_x_cbt = offset_x.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:offset_x:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _offset_y_cbt = offset_y.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:offset_y:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _minimum_cbt = minimum.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:minimum:reconstrain">;
@@ -109,10 +109,17 @@ public:
         }
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        if (_content) {
+            func(*_content);
+        }
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
-        _content_constraints = _content->update_constraints();
+        _content_constraints = _content->constraints();
 
         // The aperture can scroll so its minimum width and height are zero.
         auto aperture_constraints = _content_constraints;
@@ -160,7 +167,7 @@ public:
 
         // The content needs to be at a higher elevation, so that hitbox check
         // will work correctly for handling scrolling with mouse wheel.
-        _content->set_layout(context.transform(_content_shape, transform_command::level, context.rectangle()));
+        _content->update_layout(context.transform(_content_shape, transform_command::level, context.rectangle()));
     }
 
     void draw(draw_context const& context) noexcept override
@@ -200,7 +207,7 @@ public:
             offset_x = std::clamp(new_offset_x, 0.0f, max_offset_x);
             offset_y = std::clamp(new_offset_y, 0.0f, max_offset_y);
             ++global_counter<"scroll_aperture_widget:mouse_wheel:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
             return true;
         } else {
             return super::handle_event(event);
@@ -57,20 +57,22 @@ public:
     {
         _content_cbt = this->content.subscribe([&](auto...) {
             ++global_counter<"scroll_bar_widget:content:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _aperture_cbt = this->aperture.subscribe([&](auto...) {
             ++global_counter<"scroll_bar_widget:aperture:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _offset_cbt = this->offset.subscribe([&](auto...) {
             ++global_counter<"scroll_bar_widget:offset:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
     }
 
     ~scroll_bar_widget() {}
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override {}
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
@@ -121,12 +121,19 @@ public:
         co_yield *_horizontal_scroll_bar;
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        func(*_aperture);
+        func(*_vertical_scroll_bar);
+        func(*_horizontal_scroll_bar);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
 
         for (auto& cell : _grid) {
-            cell.set_constraints(cell.value->update_constraints());
+            cell.set_constraints(cell.value->constraints());
         }
         auto grid_constraints = _grid.constraints(os_settings::left_to_right());
         return grid_constraints.constrain(*minimum, *maximum);
@@ -153,7 +160,7 @@ public:
                 }
             }
 
-            cell.value->set_layout(context.transform(shape, transform_command::level));
+            cell.value->update_layout(context.transform(shape, transform_command::level));
         }
     }
 
@@ -180,6 +180,13 @@ public:
         co_yield *_off_label_widget;
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        func(*_overlay_widget);
+        func(*_current_label_widget);
+        func(*_off_label_widget);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         hi_assert_not_null(_off_label_widget);
@@ -187,9 +194,9 @@ public:
         hi_assert_not_null(_overlay_widget);
 
         _layout = {};
-        _off_label_constraints = _off_label_widget->update_constraints();
-        _current_label_constraints = _current_label_widget->update_constraints();
-        _overlay_constraints = _overlay_widget->update_constraints();
+        _off_label_constraints = _off_label_widget->constraints();
+        _current_label_constraints = _current_label_widget->constraints();
+        _overlay_constraints = _overlay_widget->constraints();
 
         auto const extra_size = extent2{theme().size() + theme().margin<float>() * 2.0f, theme().margin<float>() * 2.0f};
 
@@ -252,10 +259,10 @@ public:
         auto const overlay_rectangle_request = aarectangle{overlay_x, overlay_y, overlay_width, overlay_height};
         auto const overlay_rectangle = make_overlay_rectangle(overlay_rectangle_request);
         _overlay_shape = box_shape{_overlay_constraints, overlay_rectangle, theme().baseline_adjustment()};
-        _overlay_widget->set_layout(context.transform(_overlay_shape, transform_command::overlay));
+        _overlay_widget->update_layout(context.transform(_overlay_shape, transform_command::overlay));
 
-        _off_label_widget->set_layout(context.transform(_off_label_shape));
-        _current_label_widget->set_layout(context.transform(_current_label_shape));
+        _off_label_widget->update_layout(context.transform(_off_label_shape));
+        _current_label_widget->update_layout(context.transform(_current_label_shape));
     }
 
     void draw(draw_context const& context) noexcept override
@@ -296,7 +303,7 @@ public:
                 close_overlay();
             }
             ++global_counter<"selection_widget:gui_activate:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
             return true;
 
         case gui_event_type::gui_cancel:
@@ -30,6 +30,8 @@ public:
         co_return;
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override {}
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
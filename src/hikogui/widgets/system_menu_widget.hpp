@@ -54,12 +54,17 @@ public:
         co_yield *_icon_widget;
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        func(*_icon_widget);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         hi_assert_not_null(_icon_widget);
 
         _layout = {};
-        _icon_constraints = _icon_widget->update_constraints();
+        _icon_constraints = _icon_widget->constraints();
 
         auto const size = extent2{theme().large_size(), theme().large_size()};
         return {size, size, size};
@@ -80,7 +85,7 @@ public:
                 context.height() - theme().margin<float>()};
         }
 
-        _icon_widget->set_layout(context.transform(_icon_shape));
+        _icon_widget->update_layout(context.transform(_icon_shape));
     }
 
     void draw(draw_context const& context) noexcept override
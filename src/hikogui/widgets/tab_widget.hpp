@@ -120,6 +120,13 @@ public:
         }
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        for (auto const& child : _children) {
+            func(*child);
+        }
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
@@ -136,7 +143,7 @@ public:
             child->set_mode(child.get() == &selected_child_ ? widget_mode::enabled : widget_mode::invisible);
         }
 
-        return selected_child_.update_constraints();
+        return selected_child_.constraints();
     }
 
     void set_layout(widget_layout const& context) noexcept override
@@ -145,7 +152,7 @@ public:
 
         for (auto const& child : _children) {
             if (child->mode() > widget_mode::invisible) {
-                child->set_layout(context);
+                child->update_layout(context);
             }
         }
     }
@@ -91,7 +91,7 @@ public:
         hi_assert_not_null(this->delegate);
         _delegate_cbt = this->delegate->subscribe([&] {
             ++global_counter<"text_field_widget:delegate:layout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         this->delegate->init(*this);
 
@@ -152,6 +152,16 @@ public:
         }
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        if (_scroll_widget) {
+            func(*_scroll_widget);
+        }
+        if (_error_label_widget) {
+            func(*_error_label_widget);
+        }
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         hi_assert_not_null(delegate);
@@ -168,7 +178,7 @@ public:
         }
 
         _layout = {};
-        _scroll_constraints = _scroll_widget->update_constraints();
+        _scroll_constraints = _scroll_widget->constraints();
 
         auto const scroll_width = 100;
         auto const box_size = extent2{
@@ -179,11 +189,11 @@ public:
         auto margins = theme().margin();
         if (_error_label->empty()) {
             _error_label_widget->set_mode(widget_mode::invisible);
-            _error_label_constraints = _error_label_widget->update_constraints();
+            _error_label_constraints = _error_label_widget->constraints();
 
         } else {
             _error_label_widget->set_mode(widget_mode::display);
-            _error_label_constraints = _error_label_widget->update_constraints();
+            _error_label_constraints = _error_label_widget->constraints();
             inplace_max(size.width(), _error_label_constraints.preferred.width());
             size.height() += _error_label_constraints.margins.top() + _error_label_constraints.preferred.height();
             inplace_max(margins.left(), _error_label_constraints.margins.left());
@@ -215,9 +225,9 @@ public:
         }
 
         if (_error_label_widget->mode() > widget_mode::invisible) {
-            _error_label_widget->set_layout(context.transform(_error_label_shape));
+            _error_label_widget->update_layout(context.transform(_error_label_shape));
         }
-        _scroll_widget->set_layout(context.transform(_scroll_shape));
+        _scroll_widget->update_layout(context.transform(_scroll_shape));
     }
     void draw(draw_context const& context) noexcept override
     {
@@ -24,6 +24,9 @@
 #include <future>
 #include <limits>
 #include <chrono>
+#include <algorithm>
+#include <iterator>
+#include <variant>
 
 hi_export_module(hikogui.widgets.text_widget);
 
@@ -95,6 +98,8 @@ public:
                 auto const old_constraints = _constraints_cache;
 
                 // Constrain and layout according to the old layout.
+                // Only the modified part of the text needs to be shaped again.
+                _shape_incrementally = true;
                 auto const new_constraints = update_constraints();
                 new_layout.shape.rectangle = aarectangle{
                     new_layout.shape.x(),
@@ -153,21 +158,56 @@ public:
     }
 
     /// @privatesection
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override {}
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
 
         // Read the latest text from the delegate.
         hi_assert_not_null(delegate);
-        _text_cache = delegate->read(*this);
+        auto const new_text = delegate->read(*this);
 
         // Make sure that the current selection fits the new text.
-        _selection.resize(_text_cache.size());
+        _selection.resize(new_text.size());
+
+        // Find the characters between the common prefix and suffix of the old and new text.
+        auto const old_size = _text.size();
+        auto const prefix = narrow_cast<size_t>(std::distance(
+            _text.begin(), std::mismatch(_text.begin(), _text.end(), new_text.begin(), new_text.end()).first));
+        auto const max_suffix = std::min(old_size, new_text.size()) - prefix;
+        auto const suffix = narrow_cast<size_t>(std::distance(
+            std::make_reverse_iterator(_text.end()),
+            std::mismatch(
+                std::make_reverse_iterator(_text.end()), std::make_reverse_iterator(_text.end() - max_suffix), new_text.rbegin())
+                .first));
+        auto const middle = gstring_view{new_text}.substr(prefix, new_text.size() - suffix - prefix);
+
+        auto const text_changed = prefix != old_size or prefix != new_text.size();
+        if (text_changed) {
+            // The unmodified chunks of the text remain shared with the undo states.
+            _text.replace(prefix, old_size - suffix - prefix, middle);
+        }
 
-        // Create a new text_shaper with the new text.
-        auto alignment_ = os_settings::left_to_right() ? *alignment : mirror(*alignment);
+        if (std::exchange(_shape_incrementally, false)) {
+            // Shape only the modified characters.
+            _shaped_text.replace(prefix, old_size - suffix, middle, theme().text_style_set());
+
+        } else {
+            auto const left_to_right = os_settings::left_to_right();
+            auto alignment_ = left_to_right ? *alignment : mirror(*alignment);
+            auto shaped_text_key = shaped_text_key_type{theme().text_style_set(), style.pixel_density(), alignment_, left_to_right};
 
-        _shaped_text = text_shaper{_text_cache, theme().text_style_set(), style.pixel_density(), alignment_, os_settings::left_to_right()};
+            if (text_changed or _shaped_text_key != shaped_text_key) {
+                // Create a new text_shaper with the new text.
+                _shaped_text = text_shaper{new_text, shaped_text_key.style, shaped_text_key.pixel_density, alignment_, left_to_right};
+                _shaped_text_key = std::move(shaped_text_key);
+
+            } else {
+                // Most text is static, it does not need to be shaped again when an unrelated change causes a reconstrain.
+                ++global_counter<"text_widget:constrain:cached">;
+            }
+        }
 
         auto const shaped_text_rectangle = ceil(_shaped_text.bounding_rectangle(std::numeric_limits<float>::infinity()));
         auto const shaped_text_size = shaped_text_rectangle.size();
@@ -197,7 +237,7 @@ public:
         if (compare_store(_layout, context)) {
             hi_assert(context.shape.baseline);
 
-            _shaped_text.layout(context.rectangle(), *context.shape.baseline, context.sub_pixel_size);
+            _shaped_text.layout(context.rectangle(), *context.shape.baseline, context.sub_pixel_size, context.frame_resource);
         }
     }
 
@@ -231,7 +271,7 @@ public:
         }
 
         if (mode() > widget_mode::invisible and overlaps(context, layout())) {
-            context.draw_text(layout(), _shaped_text);
+            context.draw_text(layout(), _shaped_text, _draw_text_cache);
 
             context.draw_text_selection(layout(), _shaped_text, _selection, theme().text_select_color());
 
@@ -674,7 +714,7 @@ public:
                 }
 
                 ++global_counter<"text_widget:mouse_down:relayout">;
-                process_event({gui_event_type::window_relayout});
+                request_relayout();
                 request_scroll();
                 return true;
             }
@@ -754,15 +794,56 @@ private:
     enum class add_type { append, insert, dead };
 
     struct undo_type {
-        gstring text;
+        rope<grapheme> text;
         text_selection selection;
     };
 
+    /** Store the undo states as full snapshots of the text.
+     */
+    struct undo_traits_type {
+        using delta_type = std::monostate;
+
+        /** The approximate memory used by a state.
+         *
+         * A snapshot shares the unmodified chunks with the snapshots before and
+         * after it; an edit only copies the modified chunks and the path to them.
+         */
+        [[nodiscard]] static std::size_t size_of(undo_type const& rhs) noexcept
+        {
+            return sizeof(undo_type) + rope<grapheme>::chunk_capacity * sizeof(grapheme);
+        }
+    };
+
     enum class cursor_state_type { off, on, busy, none };
 
-    gstring _text_cache;
+    /** The text read from the delegate.
+     */
+    rope<grapheme> _text;
     text_shaper _shaped_text;
 
+    /** The glyph instances of `_shaped_text` retained from the previous frame.
+     */
+    mutable draw_text_cache _draw_text_cache;
+
+    /** Set when `update_constraints()` only needs to shape the modified part of the text.
+     */
+    bool _shape_incrementally = false;
+
+    /** The arguments, beside the text, with which `_shaped_text` was constructed.
+     */
+    struct shaped_text_key_type {
+        text_style_set style;
+        unit::pixel_density pixel_density;
+        hi::alignment alignment;
+        bool left_to_right;
+
+        [[nodiscard]] friend bool operator==(shaped_text_key_type const&, shaped_text_key_type const&) noexcept = default;
+    };
+
+    /** The key of `_shaped_text`, empty when the text has not been shaped yet.
+     */
+    std::optional<shaped_text_key_type> _shaped_text_key;
+
     mutable box_constraints _constraints_cache;
 
     text_selection _selection;
@@ -804,7 +885,9 @@ private:
      */
     std::optional<grapheme> _has_dead_character = std::nullopt;
 
-    undo_stack<undo_type> _undo_stack = {1000};
+    /** Undo states, limited to 1000 steps and 4 MiB; edits within half a second are a single step.
+     */
+    undo_stack<undo_type, undo_traits_type> _undo_stack = {1000, 4 * 1024 * 1024, std::chrono::milliseconds(500)};
 
     callback<void()> _delegate_cbt;
     callback<void(cursor_state_type)> _cursor_state_cbt;
@@ -878,24 +961,32 @@ private:
         }
     }
 
-    [[nodiscard]] gstring_view selected_text() const noexcept
+    [[nodiscard]] gstring selected_text() const noexcept
     {
         auto const[first, last] = _selection.selection_indices();
 
-        return gstring_view{_text_cache}.substr(first, last - first);
+        auto const first_it = _text.begin() + first;
+        return gstring(first_it, first_it + (last - first));
+    }
+
+    /** Write the text to the delegate.
+     */
+    void write_text(rope<grapheme> const& text) noexcept
+    {
+        delegate->write(*this, gstring(text.begin(), text.end()));
     }
 
     void undo_push() noexcept
     {
-        _undo_stack.emplace(_text_cache, _selection);
+        _undo_stack.emplace(_text, _selection);
     }
 
     void undo() noexcept
     {
         if (_undo_stack.can_undo()) {
-            auto const & [ text, selection ] = _undo_stack.undo(_text_cache, _selection);
+            auto const & [ text, selection ] = _undo_stack.undo(_text, _selection);
 
-            delegate->write(*this, text);
+            write_text(text);
             _selection = selection;
         }
     }
@@ -905,7 +996,7 @@ private:
         if (_undo_stack.can_redo()) {
             auto const & [ text, selection ] = _undo_stack.redo();
 
-            delegate->write(*this, text);
+            write_text(text);
             _selection = selection;
         }
     }
@@ -945,7 +1036,7 @@ private:
      */
     void fix_cursor_position() noexcept
     {
-        auto const size = _text_cache.size();
+        auto const size = _text.size();
         if (_overwrite_mode and _selection.empty() and _selection.cursor().after()) {
             _selection = _selection.cursor().before_neighbor(size);
         }
@@ -960,9 +1051,9 @@ private:
 
         auto const[first, last] = _selection.selection_indices();
 
-        auto text = _text_cache;
+        auto text = _text;
         text.replace(first, last - first, replacement);
-        delegate->write(*this, text);
+        write_text(text);
 
         _selection = text_cursor{first + replacement.size() - 1, true};
         fix_cursor_position();
@@ -975,11 +1066,11 @@ private:
      */
     void add_character(grapheme c, add_type keyboard_mode) noexcept
     {
-        auto const[start_selection, end_selection] = _selection.selection(_text_cache.size());
+        auto const[start_selection, end_selection] = _selection.selection(_text.size());
         auto original_grapheme = grapheme{char32_t{0xffff}};
 
         if (_selection.empty() and _overwrite_mode and start_selection.before()) {
-            original_grapheme = _text_cache[start_selection.index()];
+            original_grapheme = _text[start_selection.index()];
 
             auto const[first, last] = _shaped_text.select_char(start_selection);
             _selection.drag_selection(last);
@@ -991,7 +1082,7 @@ private:
             _selection = start_selection;
 
         } else if (keyboard_mode == add_type::dead) {
-            _selection = start_selection.before_neighbor(_text_cache.size());
+            _selection = start_selection.before_neighbor(_text.size());
             _has_dead_character = original_grapheme;
         }
     }
@@ -1000,17 +1091,15 @@ private:
     {
         if (_has_dead_character) {
             hi_assert(_selection.cursor().before());
-            hi_assert_bounds(_selection.cursor().index(), _text_cache);
+            hi_assert_bounds(_selection.cursor().index(), _text.size());
 
+            auto text = _text;
             if (_has_dead_character != U'\uffff') {
-                auto text = _text_cache;
-                text[_selection.cursor().index()] = *_has_dead_character;
-                delegate->write(*this, text);
+                text.replace(_selection.cursor().index(), 1, gstring{*_has_dead_character});
             } else {
-                auto text = _text_cache;
                 text.erase(_selection.cursor().index(), 1);
-                delegate->write(*this, text);
             }
+            write_text(text);
         }
         _has_dead_character = std::nullopt;
     }
@@ -148,6 +148,8 @@ public:
     }
 
     /// @privatesection
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override {}
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _button_size = {theme().size() * 2.0f, theme().size()};
@@ -238,7 +240,7 @@ public:
             if (mode() >= widget_mode::partial) {
                 delegate->activate(*this);
                 ++global_counter<"toggle_widget:handle_event:relayout">;
-                process_event({gui_event_type::window_relayout});
+                request_relayout();
                 return true;
             }
             break;
@@ -185,8 +185,8 @@ public:
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
-        _on_label_constraints = _on_label_widget->update_constraints();
-        _off_label_constraints = _off_label_widget->update_constraints();
+        _on_label_constraints = _on_label_widget->constraints();
+        _off_label_constraints = _off_label_widget->constraints();
 
         _label_constraints = max(_on_label_constraints, _off_label_constraints);
 
@@ -210,8 +210,8 @@ public:
         _on_label_widget->set_mode(value() == widget_value::on ? widget_mode::display : widget_mode::invisible);
         _off_label_widget->set_mode(value() != widget_value::on ? widget_mode::display : widget_mode::invisible);
 
-        _on_label_widget->set_layout(context.transform(_on_label_shape));
-        _off_label_widget->set_layout(context.transform(_off_label_shape));
+        _on_label_widget->update_layout(context.transform(_on_label_shape));
+        _off_label_widget->update_layout(context.transform(_off_label_shape));
     }
 
     void draw(draw_context const& context) noexcept override
@@ -234,6 +234,12 @@ public:
         co_yield *_off_label_widget;
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        func(*_on_label_widget);
+        func(*_off_label_widget);
+    }
+
     [[nodiscard]] color background_color() const noexcept override
     {
         hi_axiom(loop::main().on_thread());
@@ -85,12 +85,19 @@ public:
         }
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        for (auto const& child : _children) {
+            func(*child.value);
+        }
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
 
         for (auto& child : _children) {
-            child.set_constraints(child.value->update_constraints());
+            child.set_constraints(child.value->constraints());
         }
 
         auto r = _children.constraints(os_settings::left_to_right());
@@ -118,7 +125,7 @@ public:
             auto const child_clipping_rectangle =
                 aarectangle{child.shape.x() - overhang, 0, child.shape.width() + overhang * 2, context.height() + overhang * 2};
 
-            child.value->set_layout(context.transform(child.shape, transform_command::menu_item, child_clipping_rectangle));
+            child.value->update_layout(context.transform(child.shape, transform_command::menu_item, child_clipping_rectangle));
         }
     }
     void draw(draw_context const& context) noexcept override
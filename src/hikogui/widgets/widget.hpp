@@ -78,24 +78,30 @@ public:
     /** Call hitbox_test from a parent widget.
      *
      * This function will transform the position from parent coordinates to local coordinates.
+     * The sub-tree is skipped when the position is outside of its `hitbox_bounds()`.
      *
      * @param position The coordinate of the mouse local to the parent widget.
      */
     [[nodiscard]] virtual hitbox hitbox_test_from_parent(point2 position) const noexcept
     {
+        if (not hitbox_bounds().contains(position)) {
+            ++global_counter<"widget:hitbox_test:skip">;
+            return {};
+        }
         return hitbox_test(_layout.from_parent * position);
     }
 
     /** Call hitbox_test from a parent widget.
      *
      * This function will transform the position from parent coordinates to local coordinates.
+     * The sub-tree is skipped when the position is outside of its `hitbox_bounds()`.
      *
      * @param position The coordinate of the mouse local to the parent widget.
      * @param sibling_hitbox The hitbox of a sibling to combine with the hitbox of this widget.
      */
     [[nodiscard]] virtual hitbox hitbox_test_from_parent(point2 position, hitbox sibling_hitbox) const noexcept
     {
-        return std::max(sibling_hitbox, hitbox_test(_layout.from_parent * position));
+        return std::max(sibling_hitbox, hitbox_test_from_parent(position));
     }
 
     /** Check if the widget will accept keyboard focus.
@@ -121,9 +127,18 @@ public:
     void draw(draw_context const& context) noexcept override {}
 
     /** Send a event to the window.
+     *
+     * A reconstrain or relayout event marks each widget on the way to the
+     * window, so that only those widgets are constrained or laid out again.
      */
     bool process_event(gui_event const& event) const noexcept override
     {
+        if (event == gui_event_type::window_reconstrain) {
+            invalidate_constraints();
+        } else if (event == gui_event_type::window_relayout) {
+            invalidate_layout();
+        }
+
         if (auto *p = parent()) {
             return p->process_event(event);
         } else {
@@ -244,9 +259,9 @@ public:
 
         auto handled = false;
 
-        for (auto& child : this->children(false)) {
+        this->for_each_child(false, [&](widget_intf& child) {
             handled |= child.handle_event_recursive(event, reject_list);
-        }
+        });
 
         if (!std::ranges::any_of(reject_list, [&](auto const& x) {
                 return x == id;
@@ -275,9 +290,9 @@ public:
         }
 
         auto children_ = std::vector<widget_intf const *>{};
-        for (auto& child : children(false)) {
+        for_each_child(false, [&children_](widget_intf const& child) {
             children_.push_back(std::addressof(child));
-        }
+        });
 
         if (direction == keyboard_focus_direction::backward) {
             std::reverse(begin(children_), end(children_));
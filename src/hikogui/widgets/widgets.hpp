@@ -5,11 +5,14 @@
 #include "async_delegate.hpp" // export
 #include "async_widget.hpp" // export
 #include "audio_device_widget.hpp" // export
+#include "cache_widget.hpp" // export
 #include "button_delegate.hpp" // export
 #include "checkbox_widget.hpp" // export
 #include "grid_widget.hpp" // export
 #include "icon_widget.hpp" // export
 #include "label_widget.hpp" // export
+#include "list_view_delegate.hpp" // export
+#include "list_view_widget.hpp" // export
 #include "menu_button_widget.hpp" // export
 #include "momentary_button_widget.hpp" // export
 #include "overlay_widget.hpp" // export
@@ -33,6 +33,8 @@ public:
     window_controls_win32_widget() noexcept : super() {}
 
     /// @privatesection
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override {}
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
@@ -100,14 +100,24 @@ public:
             co_yield *_content;
         }
     }
+
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        if (_toolbar) {
+            func(*_toolbar);
+        }
+        if (_content) {
+            func(*_content);
+        }
+    }
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         hi_assert_not_null(_content);
         hi_assert_not_null(_toolbar);
 
         _layout = {};
-        _content_constraints = _content->update_constraints();
-        _toolbar_constraints = _toolbar->update_constraints();
+        _content_constraints = _content->constraints();
+        _toolbar_constraints = _toolbar->constraints();
 
         auto r = box_constraints{};
         r.minimum.width() = std::max(
@@ -177,8 +187,8 @@ public:
                 point2{context.width() - _content_constraints.margins.right(), toolbar_rectangle.bottom() - between_margin}};
             _content_shape = box_shape{_content_constraints, content_rectangle, theme().baseline_adjustment()};
         }
-        _toolbar->set_layout(context.transform(_toolbar_shape));
-        _content->set_layout(context.transform(_content_shape));
+        _toolbar->update_layout(context.transform(_toolbar_shape));
+        _content->update_layout(context.transform(_content_shape));
     }
     void draw(draw_context const& context) noexcept override
     {
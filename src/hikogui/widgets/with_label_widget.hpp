@@ -201,12 +201,12 @@ public:
 
         for (auto& cell : _grid) {
             if (cell.value == grid_cell_type::button) {
-                cell.set_constraints(_button_widget->update_constraints());
+                cell.set_constraints(_button_widget->constraints());
 
             } else if (cell.value == grid_cell_type::label) {
-                auto const on_label_constraints = _on_label_widget->update_constraints();
-                auto const off_label_constraints = _off_label_widget->update_constraints();
-                auto const other_label_constraints = _other_label_widget->update_constraints();
+                auto const on_label_constraints = _on_label_widget->constraints();
+                auto const off_label_constraints = _off_label_widget->constraints();
+                auto const other_label_constraints = _other_label_widget->constraints();
                 cell.set_constraints(max(on_label_constraints, off_label_constraints, other_label_constraints));
 
             } else {
@@ -225,12 +225,12 @@ public:
 
         for (auto const& cell : _grid) {
             if (cell.value == grid_cell_type::button) {
-                _button_widget->set_layout(context.transform(cell.shape, transform_command::level));
+                _button_widget->update_layout(context.transform(cell.shape, transform_command::level));
 
             } else if (cell.value == grid_cell_type::label) {
-                _on_label_widget->set_layout(context.transform(cell.shape));
-                _off_label_widget->set_layout(context.transform(cell.shape));
-                _other_label_widget->set_layout(context.transform(cell.shape));
+                _on_label_widget->update_layout(context.transform(cell.shape));
+                _off_label_widget->update_layout(context.transform(cell.shape));
+                _other_label_widget->update_layout(context.transform(cell.shape));
 
             } else {
                 hi_no_default();
@@ -271,6 +271,20 @@ public:
         }
     }
 
+    void visit_children(bool include_invisible, function<void(widget_intf&)>& func) noexcept override
+    {
+        func(*_button_widget);
+        if (include_invisible or _on_label_widget->mode() > widget_mode::invisible) {
+            func(*_on_label_widget);
+        }
+        if (include_invisible or _off_label_widget->mode() > widget_mode::invisible) {
+            func(*_off_label_widget);
+        }
+        if (include_invisible or _other_label_widget->mode() > widget_mode::invisible) {
+            func(*_other_label_widget);
+        }
+    }
+
     [[nodiscard]] hitbox hitbox_test(point2 position) const noexcept override
     {
         hi_axiom(loop::main().on_thread());
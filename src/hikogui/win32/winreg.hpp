@@ -10,8 +10,12 @@
 #include <string_view>
 #include <string>
 #include <vector>
+#include <array>
 #include <cstdint>
 #include <optional>
+#include <variant>
+#include <utility>
+#include <cstring>
 #include <cassert>
 
 hi_export_module(hikogui.win32 : winreg);
@@ -260,6 +264,136 @@ win32_RegGetValue_multi_string(HKEY key, std::string_view path, std::string_view
     return std::unexpected{win32_error::more_data};
 }
 
+/** Get the names of the subkeys of a registry key.
+ *
+ * @param key The registry's key
+ * @param path The path to the subkeys.
+ * @return The names of the subkeys, or win32_error::file_not_found if the path was not found, otherwise an error.
+ */
+[[nodiscard]] inline std::expected<std::vector<std::string>, win32_error> win32_RegEnumKeyEx(HKEY key, std::string_view path) noexcept
+{
+    auto const wpath = win32_MultiByteToWideChar(path);
+    if (not wpath) {
+        return std::unexpected{wpath.error()};
+    }
+
+    HKEY path_key;
+    if (auto const status = static_cast<win32_error>(::RegOpenKeyExW(key, wpath->c_str(), 0, KEY_READ, &path_key));
+        static_cast<bool>(status)) {
+        return std::unexpected{status};
+    }
+
+    auto r = std::vector<std::string>{};
+    for (auto i = DWORD{0};; ++i) {
+        // The maximum length of a key name is 255 characters.
+        auto name = std::array<wchar_t, 256>{};
+        auto name_length = static_cast<DWORD>(name.size());
+        auto const status = static_cast<win32_error>(
+            ::RegEnumKeyExW(path_key, i, name.data(), &name_length, NULL, NULL, NULL, NULL));
+
+        if (status == win32_error::no_more_items) {
+            break;
+
+        } else if (static_cast<bool>(status)) {
+            ::RegCloseKey(path_key);
+            return std::unexpected{status};
+        }
+
+        if (auto name_ = win32_WideCharToMultiByte(std::wstring_view{name.data(), name_length})) {
+            r.push_back(std::move(*name_));
+        } else {
+            ::RegCloseKey(path_key);
+            return std::unexpected{name_.error()};
+        }
+    }
+
+    ::RegCloseKey(path_key);
+    return r;
+}
+
+/** Get the names and values of a registry key.
+ *
+ * Only REG_DWORD and REG_SZ values are returned, other values are skipped.
+ *
+ * @param key The registry's key
+ * @param path The path to the values.
+ * @return The names and values, or win32_error::file_not_found if the path was not found, otherwise an error.
+ */
+[[nodiscard]] inline std::expected<std::vector<std::pair<std::string, std::variant<uint32_t, std::string>>>, win32_error>
+win32_RegEnumValue(HKEY key, std::string_view path) noexcept
+{
+    auto const wpath = win32_MultiByteToWideChar(path);
+    if (not wpath) {
+        return std::unexpected{wpath.error()};
+    }
+
+    HKEY path_key;
+    if (auto const status = static_cast<win32_error>(::RegOpenKeyExW(key, wpath->c_str(), 0, KEY_READ, &path_key));
+        static_cast<bool>(status)) {
+        return std::unexpected{status};
+    }
+
+    // The lengths exclude the null-terminator.
+    DWORD max_name_length = 0;
+    DWORD max_data_size = 0;
+    if (auto const status = static_cast<win32_error>(::RegQueryInfoKeyW(
+            path_key, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &max_name_length, &max_data_size, NULL, NULL));
+        static_cast<bool>(status)) {
+        ::RegCloseKey(path_key);
+        return std::unexpected{status};
+    }
+
+    auto name = std::wstring(max_name_length + 1, L'\0');
+    auto data = std::vector<BYTE>(max_data_size + sizeof(wchar_t));
+
+    auto r = std::vector<std::pair<std::string, std::variant<uint32_t, std::string>>>{};
+    for (auto i = DWORD{0};; ++i) {
+        auto name_length = static_cast<DWORD>(name.size());
+        auto data_size = static_cast<DWORD>(data.size());
+        DWORD type = 0;
+        auto const status = static_cast<win32_error>(
+            ::RegEnumValueW(path_key, i, name.data(), &name_length, NULL, &type, data.data(), &data_size));
+
+        if (status == win32_error::no_more_items) {
+            break;
+
+        } else if (static_cast<bool>(status)) {
+            // Includes win32_error::more_data when a value was changed during the enumeration.
+            ::RegCloseKey(path_key);
+            return std::unexpected{status};
+        }
+
+        auto name_ = win32_WideCharToMultiByte(std::wstring_view{name.data(), name_length});
+        if (not name_) {
+            ::RegCloseKey(path_key);
+            return std::unexpected{name_.error()};
+        }
+
+        if (type == REG_DWORD and data_size == sizeof(DWORD)) {
+            DWORD value;
+            std::memcpy(&value, data.data(), sizeof(DWORD));
+            r.emplace_back(std::move(*name_), static_cast<uint32_t>(value));
+
+        } else if (type == REG_SZ) {
+            auto value = std::wstring_view{reinterpret_cast<wchar_t const *>(data.data()), data_size / sizeof(wchar_t)};
+            // The data may or may not include the null-terminator.
+            while (value.ends_with(L'\0')) {
+                value.remove_suffix(1);
+            }
+
+            if (auto value_ = win32_WideCharToMultiByte(value)) {
+                r.emplace_back(std::move(*name_), std::move(*value_));
+            } else {
+                ::RegCloseKey(path_key);
+                return std::unexpected{value_.error()};
+            }
+        }
+    }
+
+    ::RegCloseKey(path_key);
+    return r;
+}
+
 /** Read from the registry value.
  *
  * @tparam T The type of the value to read.
@@ -70,6 +70,7 @@
 #include <mmdeviceapi.h>
 #include <endpointvolume.h>
 #include <audioclient.h>
+#include <avrt.h>
 
 // The windows headers create all sort of insane macros.
 #undef IN
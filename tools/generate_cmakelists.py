@@ -27,6 +27,18 @@ def get_test_files():
     return test_files
 
 
+def get_benchmark_files():
+    benchmark_files = []
+    for dirpath, dirnames, filenames in os.walk("src"):
+        for filename in filenames:
+            path = os.path.join(dirpath, filename)
+            if path.endswith("_benchmarks.cpp"):
+                benchmark_files.append(path)
+
+    benchmark_files.sort()
+    return benchmark_files
+
+
 def make_cmakelist_includes_text(header_files, suppressed_header_files):
     r  = "# This file was generated with tools/generate_cmakelists.sh\n"
     r += "\n"
@@ -141,6 +153,34 @@ def make_cmakelist_tests_text(test_files, suppressed_test_files):
     return r
 
 
+def make_cmakelist_benchmarks_text(benchmark_files):
+    r  = "# This file was generated with tools/generate_cmakelists.sh\n"
+    r += "\n"
+    r += "add_executable(hikogui_benchmarks)\n"
+    r += "target_link_libraries(hikogui_benchmarks PRIVATE hikogui)\n"
+    r += "target_include_directories(hikogui_benchmarks PRIVATE \"${CMAKE_CURRENT_BINARY_DIR}\")\n"
+    r += "set_target_properties(hikogui_benchmarks PROPERTIES DEBUG_POSTFIX \"-dbg\")\n"
+    r += "set_target_properties(hikogui_benchmarks PROPERTIES RELEASE_POSTFIX \"-rel\")\n"
+    r += "set_target_properties(hikogui_benchmarks PROPERTIES RELWITHDEBINFO_POSTFIX \"-rdi\")\n"
+    r += "\n"
+    r += "# Run the benchmarks and write the results to benchmarks.json in the build directory.\n"
+    r += "add_custom_target(run_benchmarks\n"
+    r += "    COMMAND hikogui_benchmarks > \"${CMAKE_CURRENT_BINARY_DIR}/benchmarks.json\"\n"
+    r += "    DEPENDS hikogui_benchmarks\n"
+    r += "    WORKING_DIRECTORY \"${CMAKE_CURRENT_BINARY_DIR}\"\n"
+    r += "    USES_TERMINAL)\n"
+    r += "\n"
+    r += "target_sources(hikogui_benchmarks PRIVATE\n"
+    r += "    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/benchmark_main.cpp\n"
+    for benchmark_file in benchmark_files:
+        r += "    ${CMAKE_CURRENT_SOURCE_DIR}/%s\n" % benchmark_file.replace("\\", "/")
+
+    r += ")\n"
+    r += "\n"
+    r += "show_build_target_properties(hikogui_benchmarks)\n"
+    return r
+
+
 def generate_cmakelists_includes():
     header_files = get_header_files()
     suppressed_header_files = [
@@ -156,12 +196,8 @@ def generate_cmakelists_includes():
 def generate_cmakelists_tests():
     test_files = get_test_files()
     suppressed_test_files = [
-        "src/hikogui/audio/audio_sample_packer_tests.cpp",
-        "src/hikogui/audio/audio_sample_unpacker_tests.cpp",
         "src/hikogui/random/dither_tests.cpp",
-        "src/hikogui/widgets/text_widget_tests.cpp",
-        # Disabled until C++23
-        "src/hikogui/container/lean_vector_tests.cpp"
+        "src/hikogui/widgets/text_widget_tests.cpp"
     ]
 
     suppressed_test_files = set(os.path.normcase(x) for x in suppressed_test_files)
@@ -169,9 +205,16 @@ def generate_cmakelists_tests():
     with open("CMakeLists_tests.cmake", "w") as fd:
         fd.write(make_cmakelist_tests_text(test_files, suppressed_test_files))
 
+def generate_cmakelists_benchmarks():
+    benchmark_files = get_benchmark_files()
+
+    with open("CMakeLists_benchmarks.cmake", "w") as fd:
+        fd.write(make_cmakelist_benchmarks_text(benchmark_files))
+
 def main():
     generate_cmakelists_includes()
     generate_cmakelists_tests()
+    generate_cmakelists_benchmarks()
 
 
 
@@ -38,6 +38,8 @@ def parse_options():
     parser.add_argument("--line-break", dest="line_break_class_path", action="store", required=True)
     parser.add_argument("--line-break-classes-output", dest="line_break_classes_output_path", action="store", required=True)
     parser.add_argument("--line-break-classes-template", dest="line_break_classes_template_path", action="store", required=True)
+    parser.add_argument("--NFC-quick-checks-output", dest="NFC_quick_checks_output_path", action="store", required=True)
+    parser.add_argument("--NFC-quick-checks-template", dest="NFC_quick_checks_template_path", action="store", required=True)
     parser.add_argument("--prop-list", dest="prop_list_path", action="store", required=True)
     parser.add_argument("--scripts", dest="scripts_path", action="store", required=True)
     parser.add_argument("--scripts-output", dest="scripts_output_path", action="store", required=True)
@@ -45,6 +47,8 @@ def parse_options():
     parser.add_argument("--sentence-break-properties-output", dest="sentence_break_properties_output_path", action="store", required=True)
     parser.add_argument("--sentence-break-properties-template", dest="sentence_break_properties_template_path", action="store", required=True)
     parser.add_argument("--sentence-break-property", dest="sentence_break_property_path", action="store", required=True)
+    parser.add_argument("--text-properties-output", dest="text_properties_output_path", action="store", required=True)
+    parser.add_argument("--text-properties-template", dest="text_properties_template_path", action="store", required=True)
     parser.add_argument("--unicode-data", dest="unicode_data_path", action="store", required=True)
     parser.add_argument("--word-break-properties-output", dest="word_break_properties_output_path", action="store", required=True)
     parser.add_argument("--word-break-properties-template", dest="word_break_properties_template_path", action="store", required=True)
@@ -80,8 +84,10 @@ def main():
     ucd.generate_grapheme_cluster_breaks(options.grapheme_cluster_breaks_template_path, options.grapheme_cluster_breaks_output_path, descriptions)
     ucd.generate_lexical_classes(options.lexical_classes_template_path, options.lexical_classes_output_path, descriptions)
     ucd.generate_line_break_classes(options.line_break_classes_template_path, options.line_break_classes_output_path, descriptions)
+    ucd.generate_NFC_quick_checks(options.NFC_quick_checks_template_path, options.NFC_quick_checks_output_path, descriptions)
     ucd.generate_scripts(options.scripts_template_path, options.scripts_output_path, descriptions)
     ucd.generate_sentence_break_properties(options.sentence_break_properties_template_path, options.sentence_break_properties_output_path, descriptions)
+    ucd.generate_text_properties(options.text_properties_template_path, options.text_properties_output_path, descriptions)
     ucd.generate_word_break_properties(options.word_break_properties_template_path, options.word_break_properties_output_path, descriptions)
 
 
@@ -24,6 +24,8 @@ $PYTHON3 tools/generate_unicode_data.py \
     --general-categories-output=src/hikogui/unicode/ucd_general_categories.hpp \
     --lexical-classes-template=tools/ucd/ucd_lexical_classes.hpp.psp \
     --lexical-classes-output=src/hikogui/unicode/ucd_lexical_classes.hpp \
+    --NFC-quick-checks-template=tools/ucd/ucd_NFC_quick_checks.hpp.psp \
+    --NFC-quick-checks-output=src/hikogui/unicode/ucd_NFC_quick_checks.hpp \
     --scripts-template=tools/ucd/ucd_scripts.hpp.psp \
     --scripts-output=src/hikogui/unicode/ucd_scripts.hpp \
     --east-asian-widths-template=tools/ucd/ucd_east_asian_widths.hpp.psp \
@@ -44,6 +46,8 @@ $PYTHON3 tools/generate_unicode_data.py \
     --sentence-break-properties-output=src/hikogui/unicode/ucd_sentence_break_properties.hpp \
     --canonical-combining-classes-template=tools/ucd/ucd_canonical_combining_classes.hpp.psp \
     --canonical-combining-classes-output=src/hikogui/unicode/ucd_canonical_combining_classes.hpp \
+    --text-properties-template=tools/ucd/ucd_text_properties.hpp.psp \
+    --text-properties-output=src/hikogui/unicode/ucd_text_properties.hpp \
     --index-template=tools/ucd/ucd_index.hpp.psp \
     --index-output=src/hikogui/unicode/ucd_index.hpp \
     --descriptions-template=tools/ucd/ucd_descriptions.hpp.psp \
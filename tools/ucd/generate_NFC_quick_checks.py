@@ -0,0 +1,55 @@
+
+from .psp import psp_execute
+from .deduplicate import deduplicate
+from .bits_as_bytes import bits_as_bytes
+import sys
+
+def generate_NFC_quick_checks(template_path, output_path, descriptions):
+    """
+    The NFC_Quick_Check property is derived from the decompositions, combining classes and composition exclusions,
+    so that it matches the compositions table exactly.
+    See Unicode Standard Annex #15, "Unicode Normalization Forms", section 9 "Detecting Normalization Forms".
+    """
+    print("Processing NFC_quick_checks:", file=sys.stderr, flush=True)
+
+    NFC_quick_check_enum = {"yes": 0, "no": 1, "maybe": 2}
+    NFC_quick_checks = [NFC_quick_check_enum["yes"]] * len(descriptions)
+
+    for cp, d in enumerate(descriptions):
+        if d.decomposition_type is not None or len(d.decomposition_mapping) == 0:
+            continue
+
+        singleton = len(d.decomposition_mapping) == 1
+        non_starter = d.canonical_combining_class != 0 or descriptions[d.decomposition_mapping[0]].canonical_combining_class != 0
+        if singleton or non_starter or d.composition_exclusion:
+            # This code-point never appears in NFC.
+            NFC_quick_checks[cp] = NFC_quick_check_enum["no"]
+
+        else:
+            # The second code-point of a primary composite may compose with a previous code-point.
+            second_cp = d.decomposition_mapping[1]
+            if NFC_quick_checks[second_cp] == NFC_quick_check_enum["yes"]:
+                NFC_quick_checks[second_cp] = NFC_quick_check_enum["maybe"]
+
+    NFC_quick_checks, indices, chunk_size = deduplicate(NFC_quick_checks)
+    NFC_quick_checks_bytes, NFC_quick_check_width = bits_as_bytes(NFC_quick_checks)
+    indices_bytes, index_width = bits_as_bytes(indices)
+
+    print("    chunk-size={} #indices={}:{} #NFC_quick_checks={}:{} total={} bytes".format(
+        chunk_size,
+        len(indices), index_width,
+        len(NFC_quick_checks), NFC_quick_check_width,
+        len(indices_bytes) + len(NFC_quick_checks_bytes)),
+        file=sys.stderr)
+
+    psp_execute(
+        template_path,
+        output_path,
+        chunk_size=chunk_size,
+        indices_size=len(indices),
+        index_width=index_width,
+        indices_bytes=indices_bytes,
+        NFC_quick_check_enum=NFC_quick_check_enum,
+        NFC_quick_check_width=NFC_quick_check_width,
+        NFC_quick_checks_bytes=NFC_quick_checks_bytes
+    )
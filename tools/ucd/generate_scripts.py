@@ -1,13 +1,9 @@
 
 from .psp import psp_execute
-from .deduplicate import deduplicate
-from .bits_as_bytes import bits_as_bytes
 import sys
 
-def generate_scripts(template_path, output_path, descriptions):
-    print("Processing scripts:", file=sys.stderr, flush=True)
-
-    script_enum = {
+def make_script_enum():
+    return {
         "Adlam": 166,
         "Ahom": 338,
         "Anatolian_Hieroglyphs": 80,
@@ -175,32 +171,19 @@ def generate_scripts(template_path, output_path, descriptions):
         "Zzzz": 0,
     }
 
+
+def generate_scripts(template_path, output_path, descriptions):
+    print("Processing scripts:", file=sys.stderr, flush=True)
+
+    script_enum = make_script_enum()
+
     used_scripts = set(x.script for x in descriptions)
     unused_scripts = script_enum.keys() - used_scripts
     for unused_script in sorted(unused_scripts):
         print("    unused script:", unused_script, file=sys.stderr)
 
-    scripts = [script_enum[x.script] for x in descriptions]
-
-    scripts, indices, chunk_size = deduplicate(scripts)
-    scripts_bytes, script_width = bits_as_bytes(scripts)
-    indices_bytes, index_width = bits_as_bytes(indices)
-
-    print("    chunk-size={} #indices={}:{} #scripts={}:{} total={} bytes".format(
-        chunk_size,
-        len(indices), index_width,
-        len(scripts), script_width,
-        len(indices_bytes) + len(scripts_bytes)),
-        file=sys.stderr)
-
     psp_execute(
         template_path,
         output_path,
-        chunk_size=chunk_size,
-        indices_size=len(indices),
-        index_width=index_width,
-        indices_bytes=indices_bytes,
-        script_enum=script_enum,
-        script_width=script_width,
-        scripts_bytes=scripts_bytes
+        script_enum=script_enum
     )
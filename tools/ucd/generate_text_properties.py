@@ -0,0 +1,82 @@
+
+from .psp import psp_execute
+from .deduplicate import deduplicate
+from .bits_as_bytes import bits_as_bytes
+from .generate_bidi_classes import make_bidi_class_enum
+from .generate_bidi_paired_bracket_types import make_bidi_paired_bracket_type_enum
+from .generate_east_asian_widths import make_east_asian_width_enum
+from .generate_general_categories import make_general_category_enum
+from .generate_grapheme_cluster_breaks import make_grapheme_cluster_break_enum, grapheme_cluster_break_name
+from .generate_line_break_classes import make_line_break_class_enum
+from .generate_scripts import make_script_enum
+from .generate_sentence_break_properties import make_sentence_break_property_enum
+from .generate_word_break_properties import make_word_break_property_enum
+import sys
+
+def generate_text_properties(template_path, output_path, descriptions):
+    """
+    Generate a single table with all the properties that are used during text analysis.
+
+    Each code-point maps to an index into a table of unique records; each record
+    contains the properties packed into a 64 bit integer. The enum values are the same as
+    in the separate property tables.
+    """
+    print("Processing text_properties:", file=sys.stderr, flush=True)
+
+    # The fields of the record, from least significant to most significant.
+    # (name, enum, function to get the name of the value from a description)
+    field_definitions = [
+        ("general_category", make_general_category_enum(descriptions), lambda x: x.general_category),
+        ("grapheme_cluster_break", make_grapheme_cluster_break_enum(descriptions), grapheme_cluster_break_name),
+        ("line_break_class", make_line_break_class_enum(descriptions), lambda x: x.line_break),
+        ("word_break_property", make_word_break_property_enum(descriptions), lambda x: x.word_break),
+        ("sentence_break_property", make_sentence_break_property_enum(descriptions), lambda x: x.sentence_break),
+        ("east_asian_width", make_east_asian_width_enum(descriptions), lambda x: x.east_asian_width),
+        ("bidi_class", make_bidi_class_enum(descriptions), lambda x: x.bidi_class),
+        ("bidi_paired_bracket_type", make_bidi_paired_bracket_type_enum(descriptions), lambda x: x.bidi_paired_bracket_type),
+        ("script", make_script_enum(), lambda x: x.script),
+    ]
+
+    fields = []
+    shift = 0
+    for name, enum, _ in field_definitions:
+        width = max(enum.values()).bit_length()
+        fields.append((name, shift, width))
+        shift += width
+    assert shift <= 64
+
+    records = {}
+    record_indices = []
+    for x in descriptions:
+        record = 0
+        for (name, enum, get_name), (_, shift, _) in zip(field_definitions, fields):
+            record |= enum[get_name(x)] << shift
+        record_indices.append(records.setdefault(record, len(records)))
+
+    records = sorted(records.items(), key=lambda x: x[1])
+    records = [x[0] for x in records]
+
+    record_indices, indices, chunk_size = deduplicate(record_indices)
+    record_indices_bytes, record_index_width = bits_as_bytes(record_indices)
+    indices_bytes, index_width = bits_as_bytes(indices)
+
+    print("    chunk-size={} #indices={}:{} #record_indices={}:{} #records={}:64 total={} bytes".format(
+        chunk_size,
+        len(indices), index_width,
+        len(record_indices), record_index_width,
+        len(records),
+        len(indices_bytes) + len(record_indices_bytes) + len(records) * 8),
+        file=sys.stderr)
+
+    psp_execute(
+        template_path,
+        output_path,
+        chunk_size=chunk_size,
+        indices_size=len(indices),
+        index_width=index_width,
+        indices_bytes=indices_bytes,
+        record_index_width=record_index_width,
+        record_indices_bytes=record_indices_bytes,
+        records=records,
+        fields=dict((name, (shift, width)) for name, shift, width in fields)
+    )